@@ -95,6 +95,11 @@ int entry(const int argc, char **argv)
     .default_value("h5")
     .help("Input data format. h5/hdf5 (default) or directory");
 
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .help("Evaluate input data with this many pairs of interpreters, each run in its own thread. "
+          "Each of them needs its own memory for activations (default: 1)");
+
   try
   {
     arser.parse(argc, argv);
@@ -115,6 +120,7 @@ int entry(const int argc, char **argv)
   std::string metric;
   std::string input_data_format;
   std::string output_prefix;
+  int32_t num_threads = 1;
 
   if (arser["--first_input_data"])
     first_input_data_path = arser.get<std::string>("--first_input_data");
@@ -154,6 +160,12 @@ int entry(const int argc, char **argv)
 
   input_data_format = arser.get<std::string>("--input_data_format");
 
+  if (arser["--num_threads"])
+    num_threads = arser.get<int32_t>("--num_threads");
+
+  if (num_threads < 1)
+    throw std::runtime_error("Number of threads must be positive");
+
   auto ctx = std::make_unique<CircleEvalDiff::Context>();
   {
     ctx->first_model_path = first_model_path;
@@ -163,6 +175,7 @@ int entry(const int argc, char **argv)
     ctx->metric = metrics;
     ctx->input_format = to_input_format(input_data_format);
     ctx->output_prefix = output_prefix;
+    ctx->num_threads = static_cast<uint32_t>(num_threads);
   }
 
   CircleEvalDiff ced(std::move(ctx));
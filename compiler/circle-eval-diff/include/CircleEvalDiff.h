@@ -55,6 +55,8 @@ public:
     std::vector<Metric> metric;
     InputFormat input_format = InputFormat::Undefined;
     std::string output_prefix;
+    // Number of threads, each of which evaluates data with its own interpreters
+    uint32_t num_threads = 1;
   };
 
 public:
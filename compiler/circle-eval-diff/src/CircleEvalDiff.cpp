@@ -22,7 +22,13 @@
 #include <foder/FileLoader.h>
 #include <luci/Importer.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 namespace
 {
@@ -65,7 +71,10 @@ std::unique_ptr<luci::Module> import(const std::string &model_path)
   if (not circle_model)
     throw std::runtime_error("Failed to load '" + model_path + "'");
 
-  auto module = luci::Importer().importModule(circle_model);
+  // The model is only executed, so profile information tracing nodes back to it is not needed
+  luci::Importer importer;
+  importer.skip_profile(true);
+  auto module = importer.importModule(circle_model);
 
   if (not module)
     throw std::runtime_error("Failed to load '" + model_path + "'");
@@ -117,16 +126,29 @@ void checkOutputs(const luci::Module *first, const luci::Module *second)
   }
 }
 
+// Interpreters of a worker, which are reused for all data it evaluates
+struct Evaluator
+{
+  std::unique_ptr<luci_interpreter::Interpreter> first;
+  std::unique_ptr<luci_interpreter::Interpreter> second;
+};
+
+// Outputs of the first and the second model for a data
+struct EvalResult
+{
+  std::vector<std::shared_ptr<circle_eval_diff::Tensor>> first;
+  std::vector<std::shared_ptr<circle_eval_diff::Tensor>> second;
+};
+
 } // namespace
 
 namespace circle_eval_diff
 {
 
-std::vector<std::shared_ptr<Tensor>> interpret(const luci::Module *module,
+std::vector<std::shared_ptr<Tensor>> interpret(luci_interpreter::Interpreter *interpreter,
+                                               const luci::Module *module,
                                                const InputDataLoader::Data &data)
 {
-  auto interpreter = std::make_unique<luci_interpreter::Interpreter>(module);
-
   auto input_nodes = ::inputs_of(module);
   auto output_nodes = ::outputs_of(module);
 
@@ -216,39 +238,145 @@ void CircleEvalDiff::evalDiff(void) const
   auto second_input_loader = circle_eval_diff::makeDataLoader(
     _ctx->second_input_data_path, _ctx->input_format, ::inputs_of(_second_module.get()));
 
-  for (uint32_t data_idx = 0; data_idx < first_input_loader->size(); data_idx++)
+  const uint32_t num_data = first_input_loader->size();
+  const uint32_t num_workers = std::max(1u, std::min(_ctx->num_threads, num_data));
+  // Results waiting for accumulation are bounded, so memory does not grow with the data
+  const uint32_t max_pending = 2 * num_workers;
+
+  // Interpreters of the same module share its constants, so each worker has only its activations
+  std::vector<Evaluator> evaluators(num_workers);
+  for (auto &evaluator : evaluators)
   {
-    std::cout << "Evaluating " << data_idx << "'th data" << std::endl;
+    evaluator.first = std::make_unique<luci_interpreter::Interpreter>(_first_module.get());
+    evaluator.second = std::make_unique<luci_interpreter::Interpreter>(_second_module.get());
+  }
 
-    auto first_data = first_input_loader->get(data_idx);
-    auto second_data = second_input_loader->get(data_idx);
+  // HDF5 library is not thread-safe, so loading is serialized while others interpret
+  std::mutex load_mutex;
+  uint32_t next_load = 0;
 
-    auto first_output = interpret(_first_module.get(), first_data);
-    auto second_output = interpret(_second_module.get(), second_data);
+  std::mutex result_mutex;
+  std::condition_variable result_cv;
+  std::map<uint32_t, EvalResult> results;
+  uint32_t next_accum = 0;
+  std::exception_ptr error;
 
-    for (auto &metric : _metrics)
+  auto set_error = [&](std::exception_ptr e) {
     {
-      metric->accumulate(first_output, second_output);
+      std::lock_guard<std::mutex> lock(result_mutex);
+      if (not error)
+        error = e;
     }
+    result_cv.notify_all();
+  };
 
-    if (_ctx.get()->output_prefix.empty())
-      continue;
-
-    for (uint32_t i = 0; i < first_output.size(); i++)
+  // Workers load and interpret data ahead of accumulation, which is done in the order of data
+  auto run_worker = [&](Evaluator &evaluator) {
+    try
     {
-      auto out = first_output[i];
-      writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data_idx) + ".first.output" +
-                        std::to_string(i),
-                      (char *)(out->buffer()), out->byte_size());
+      while (true)
+      {
+        uint32_t data_idx = 0;
+        {
+          std::lock_guard<std::mutex> lock(load_mutex);
+          if (next_load >= num_data)
+            return;
+          data_idx = next_load++;
+        }
+
+        {
+          std::unique_lock<std::mutex> lock(result_mutex);
+          result_cv.wait(lock, [&] { return error or data_idx < next_accum + max_pending; });
+          if (error)
+            return;
+        }
+
+        InputDataLoader::Data first_data;
+        InputDataLoader::Data second_data;
+        {
+          std::lock_guard<std::mutex> lock(load_mutex);
+          first_data = first_input_loader->get(data_idx);
+          second_data = second_input_loader->get(data_idx);
+        }
+
+        EvalResult result;
+        result.first = interpret(evaluator.first.get(), _first_module.get(), first_data);
+        result.second = interpret(evaluator.second.get(), _second_module.get(), second_data);
+
+        {
+          std::lock_guard<std::mutex> lock(result_mutex);
+          results.emplace(data_idx, std::move(result));
+        }
+        result_cv.notify_all();
+      }
+    }
+    catch (...)
+    {
+      set_error(std::current_exception());
     }
-    for (uint32_t i = 0; i < second_output.size(); i++)
+  };
+
+  std::vector<std::thread> threads;
+  for (auto &evaluator : evaluators)
+    threads.emplace_back(run_worker, std::ref(evaluator));
+
+  try
+  {
+    for (uint32_t data_idx = 0; data_idx < num_data; data_idx++)
     {
-      auto out = second_output[i];
-      writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data_idx) +
-                        ".second.output" + std::to_string(i),
-                      (char *)(out->buffer()), out->byte_size());
+      EvalResult result;
+      {
+        std::unique_lock<std::mutex> lock(result_mutex);
+        result_cv.wait(lock, [&] { return error or results.find(data_idx) != results.end(); });
+        if (error)
+          break;
+
+        auto iter = results.find(data_idx);
+        result = std::move(iter->second);
+        results.erase(iter);
+        next_accum = data_idx + 1;
+      }
+      result_cv.notify_all();
+
+      std::cout << "Evaluating " << data_idx << "'th data" << std::endl;
+
+      const auto &first_output = result.first;
+      const auto &second_output = result.second;
+
+      for (auto &metric : _metrics)
+      {
+        metric->accumulate(first_output, second_output);
+      }
+
+      if (_ctx.get()->output_prefix.empty())
+        continue;
+
+      for (uint32_t i = 0; i < first_output.size(); i++)
+      {
+        auto out = first_output[i];
+        writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data_idx) +
+                          ".first.output" + std::to_string(i),
+                        (char *)(out->buffer()), out->byte_size());
+      }
+      for (uint32_t i = 0; i < second_output.size(); i++)
+      {
+        auto out = second_output[i];
+        writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data_idx) +
+                          ".second.output" + std::to_string(i),
+                        (char *)(out->buffer()), out->byte_size());
+      }
     }
   }
+  catch (...)
+  {
+    set_error(std::current_exception());
+  }
+
+  for (auto &thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
 
   for (auto &metric : _metrics)
   {
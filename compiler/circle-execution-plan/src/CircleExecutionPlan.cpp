@@ -42,6 +42,19 @@ int entry(int argc, char **argv)
     .required(false)
     .default_value(false)
     .help("Plan with or without dsp (now can be used only with cmsisnn)");
+  arser.add_argument("--search_execution_order")
+    .nargs(1)
+    .type(arser::DataType::BOOL)
+    .required(false)
+    .default_value(false)
+    .help("Try a memory-aware execution order as well and use it if it needs less memory");
+  arser.add_argument("--ignore_consts")
+    .nargs(1)
+    .type(arser::DataType::BOOL)
+    .required(false)
+    .default_value(false)
+    .help("Plan without constants, for runtimes which keep them out of the shared buffer "
+          "(e.g. onert)");
   arser.add_argument("--save_allocations")
     .nargs(1)
     .required(false)
@@ -65,6 +78,8 @@ int entry(int argc, char **argv)
   const std::string output_path = arser.get<std::string>("output");
   const std::string platform_name = arser.get<std::string>("--platform");
   const bool use_dsp = arser.get<bool>("--use_dsp");
+  const bool search_execution_order = arser.get<bool>("--search_execution_order");
+  const bool ignore_consts = arser.get<bool>("--ignore_consts");
   const std::string json_path = arser.get<std::string>("--save_allocations");
 
   if (platform_name != "cmsisnn" && use_dsp)
@@ -132,6 +147,8 @@ int entry(int argc, char **argv)
 
   // Do main job
   circle_planner::ExecutionPlanner execution_planner(module->graph(), {platform_type, use_dsp});
+  execution_planner.change_planning_mode(ignore_consts, false, false);
+  execution_planner.change_execution_order_mode(search_execution_order);
   execution_planner.make_execution_plan();
 
   if (is_save_allocations)
@@ -20,6 +20,9 @@
 
 #include <json.h>
 #include <fstream>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace circle_planner
 {
@@ -61,6 +64,17 @@ bool isTensorProducingNode(const luci::CircleNode *node)
   }
 }
 
+// Size of the tensor produced by the node
+uint32_t node_size(const luci::CircleNode *node)
+{
+  uint32_t elements = 1;
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+  {
+    elements *= node->dim(axis).value();
+  }
+  return elements * loco::size(node->dtype());
+}
+
 // Create allocation node part for current circle node for json allocation info file
 void create_allocation_node(Json::Value &allocations_node,
                             AllocationNodeInformation &alloca_node_inform, uint32_t alive_till_max,
@@ -90,6 +104,29 @@ void ExecutionPlanner::make_execution_plan()
 {
   get_default_execution_order_plan();
   _required_size = get_offsets_with_greedy_by_size();
+  if (_is_search_order)
+  {
+    const auto default_order = _ordered_nodes;
+    auto best_order = default_order;
+    for (auto get_order : {&ExecutionPlanner::get_greedy_execution_order_plan,
+                           &ExecutionPlanner::get_subtree_first_execution_order_plan})
+    {
+      _ordered_nodes = default_order;
+      (this->*get_order)();
+      const auto required_size = get_offsets_with_greedy_by_size();
+      if (required_size < _required_size)
+      {
+        _required_size = required_size;
+        best_order = _ordered_nodes;
+      }
+    }
+    // Plan the best order again to restore its offsets
+    if (_ordered_nodes != best_order)
+    {
+      _ordered_nodes = best_order;
+      _required_size = get_offsets_with_greedy_by_size();
+    }
+  }
   for (uint32_t i = 0; i < _ordered_nodes.size(); i++)
   {
     luci::CircleNodeExecutionPlan execution_plan(i, _offsets[i]);
@@ -150,6 +187,166 @@ void ExecutionPlanner::get_default_execution_order_plan()
   _ordered_nodes = loco::postorder_traversal(loco::output_nodes(const_cast<loco::Graph *>(_graph)));
 }
 
+void ExecutionPlanner::get_greedy_execution_order_plan()
+{
+  const auto default_order = _ordered_nodes;
+
+  // Number of nodes which read the tensor of each node and did not execute yet
+  std::unordered_map<loco::Node *, uint32_t> remaining_uses;
+  // *Out nodes of each multiple-output node
+  std::unordered_map<loco::Node *, std::vector<loco::Node *>> out_nodes;
+  for (auto node : default_order)
+  {
+    const auto prev_nodes = preds(node);
+    for (auto prev_node : prev_nodes)
+      remaining_uses[prev_node]++;
+    if (!isExecutableNode(loco::must_cast<luci::CircleNode *>(node)))
+      out_nodes[*prev_nodes.begin()].push_back(node);
+  }
+  // Graph outputs live until the end
+  for (auto output_node : output_nodes(_graph))
+    remaining_uses[output_node]++;
+
+  // Source nodes such as constants live from the beginning in get_usage_interval(),
+  // so they are emitted right before their first use.
+  auto is_source = [](loco::Node *node) { return preds(node).empty(); };
+
+  _ordered_nodes.clear();
+  std::unordered_set<loco::Node *> emitted;
+  auto emit = [&](loco::Node *node) {
+    if (emitted.insert(node).second)
+      _ordered_nodes.push_back(node);
+  };
+
+  // Inputs go first as in get_usage_interval() they are allocated at the first node
+  for (auto input_node : input_nodes(_graph))
+  {
+    if (std::find(default_order.begin(), default_order.end(), input_node) != default_order.end())
+      emit(input_node);
+  }
+
+  while (true)
+  {
+    // Pick the ready node which increases the size of live tensors the least, and the earliest
+    // one in the default order among those
+    loco::Node *best_node = nullptr;
+    int64_t best_delta = std::numeric_limits<int64_t>::max();
+    for (auto node : default_order)
+    {
+      auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+      if (emitted.count(node) || is_source(node) || !isExecutableNode(circle_node))
+        continue;
+
+      const auto prev_nodes = preds(node);
+      bool ready = true;
+      int64_t delta = 0;
+      for (auto prev_node : prev_nodes)
+      {
+        if (!emitted.count(prev_node) && !is_source(prev_node))
+        {
+          ready = false;
+          break;
+        }
+        if (remaining_uses[prev_node] == 1)
+          delta -= node_size(loco::must_cast<luci::CircleNode *>(prev_node));
+      }
+      if (!ready)
+        continue;
+
+      if (isTensorProducingNode(circle_node))
+        delta += node_size(circle_node);
+      for (auto out_node : out_nodes[node])
+        delta += node_size(loco::must_cast<luci::CircleNode *>(out_node));
+
+      if (delta < best_delta)
+      {
+        best_node = node;
+        best_delta = delta;
+      }
+    }
+    if (best_node == nullptr)
+      break;
+
+    for (auto prev_node : preds(best_node))
+    {
+      emit(prev_node);
+      remaining_uses[prev_node]--;
+    }
+    emit(best_node);
+    for (auto out_node : out_nodes[best_node])
+    {
+      emit(out_node);
+      remaining_uses[best_node]--;
+    }
+  }
+  assert(_ordered_nodes.size() == default_order.size());
+}
+
+void ExecutionPlanner::get_subtree_first_execution_order_plan()
+{
+  const auto default_order = _ordered_nodes;
+
+  // Size of the output of each node. Source nodes such as constants live from the beginning in
+  // get_usage_interval(), so they do not count.
+  auto output_size = [](loco::Node *node) -> uint64_t {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (preds(node).empty() || !isTensorProducingNode(circle_node))
+      return 0;
+    return node_size(circle_node);
+  };
+
+  // Operands of each node, in the order to visit
+  std::unordered_map<loco::Node *, std::vector<loco::Node *>> operands;
+  // Estimated peak of live tensors to compute each node, as if the graph were a tree.
+  // Default order has operands before their users.
+  std::unordered_map<loco::Node *, uint64_t> peak;
+  for (auto node : default_order)
+  {
+    const auto prev_nodes = preds(node);
+    auto &node_operands = operands[node];
+    node_operands.assign(prev_nodes.begin(), prev_nodes.end());
+    // Stable sort keeps the default order for ties
+    std::stable_sort(node_operands.begin(), node_operands.end(),
+                     [&](loco::Node *lhs, loco::Node *rhs) {
+                       return peak[lhs] - output_size(lhs) > peak[rhs] - output_size(rhs);
+                     });
+
+    uint64_t held = 0;
+    uint64_t node_peak = 0;
+    for (auto operand : node_operands)
+    {
+      node_peak = std::max(node_peak, held + peak[operand]);
+      held += output_size(operand);
+    }
+    peak[node] = std::max(node_peak, held + output_size(node));
+  }
+
+  // Postorder traversal from outputs with the operands in the order above
+  _ordered_nodes.clear();
+  std::unordered_set<loco::Node *> visited;
+  std::vector<std::pair<loco::Node *, uint32_t>> stack;
+  for (auto output_node : output_nodes(_graph))
+  {
+    if (visited.insert(output_node).second)
+      stack.emplace_back(output_node, 0);
+    while (!stack.empty())
+    {
+      auto &top = stack.back();
+      const auto &node_operands = operands[top.first];
+      if (top.second < node_operands.size())
+      {
+        auto operand = node_operands[top.second++];
+        if (visited.insert(operand).second)
+          stack.emplace_back(operand, 0);
+        continue;
+      }
+      _ordered_nodes.push_back(top.first);
+      stack.pop_back();
+    }
+  }
+  assert(_ordered_nodes.size() == default_order.size());
+}
+
 void ExecutionPlanner::get_usage_interval()
 {
   // Initialize vectors of first and last nodes for usage interval
@@ -241,6 +438,7 @@ uint32_t ExecutionPlanner::get_offsets_with_greedy_by_size()
   get_usage_interval();
   auto required_size = greedy_by_size_approach();
 
+  _offsets.clear();
   _offsets.resize(_ordered_nodes.size());
   for (const auto &alloc : _alloc_node_inform_vector)
   {
@@ -338,17 +536,12 @@ void ExecutionPlanner::create_alloc_node_inform_vector(bool null_consts, bool nu
     return this->_alloc_node[idx1] < this->_alloc_node[idx2];
   };
 
+  _alloc_node_inform_vector.clear();
   _alloc_node_inform_vector.resize(_ordered_nodes.size());
 
   for (size_t i = 0; i < _ordered_nodes.size(); i++)
   {
     auto circle_node = loco::must_cast<luci::CircleNode *>(_ordered_nodes[i]);
-    auto node_size = 1;
-    for (uint32_t axis = 0; axis < circle_node->rank(); ++axis)
-    {
-      node_size *= circle_node->dim(axis).value();
-    }
-    node_size *= size(circle_node->dtype());
 
     _alloc_node_inform_vector[i].node_num = i;
     _alloc_node_inform_vector[i].first_node = _alloc_node[i];
@@ -369,7 +562,7 @@ void ExecutionPlanner::create_alloc_node_inform_vector(bool null_consts, bool nu
     }
     else
     {
-      _alloc_node_inform_vector[i].size = node_size;
+      _alloc_node_inform_vector[i].size = node_size(circle_node);
     }
 
     // Scratchpad If needed
@@ -104,6 +104,14 @@ public:
     _is_null_scratchpads = is_null_scratchpads;
   };
 
+  // Method change execution order mode:
+  // is_search_order = true - besides the default order, memory-aware orders are also tried and
+  //                          the one that requires the smallest buffer is used
+  void change_execution_order_mode(bool is_search_order) { _is_search_order = is_search_order; };
+
+  // Required size of buffer for the plan made by make_execution_plan().
+  uint32_t required_size() const { return _required_size; }
+
   void create_json_allocation_file(const std::string &json_path);
 
 private:
@@ -111,6 +119,15 @@ private:
   // There can be different variants of execution order and this method provides main one.
   void get_default_execution_order_plan();
 
+  // Methods get memory-aware execution order plans and save them in _ordered_nodes vector.
+  // They must be called with the default execution order plan in _ordered_nodes.
+  // - greedy: among nodes ready to execute, picks the node that increases the size of live
+  //   tensors the least
+  // - subtree first: traverses graph in postorder, visiting first the operand whose computation
+  //   needs the most memory besides its own output (like Sethi-Ullman numbering)
+  void get_greedy_execution_order_plan();
+  void get_subtree_first_execution_order_plan();
+
   // Method provides nodes with usage interval information.
   void get_usage_interval();
 
@@ -174,6 +191,10 @@ private:
   bool _is_null_consts = false;
   bool _is_null_inputs = false;
   bool _is_null_scratchpads = false;
+
+  // Flag for choosing execution order mode:
+  // _is_search_order = true - memory-aware execution orders are tried as well as the default one
+  bool _is_search_order = false;
 };
 
 } // namespace circle_planner
@@ -36,6 +36,9 @@ int entry(int argc, char **argv)
     .help("Dump Conv2D series weight operators in circle file");
   arser.add_argument("--op_version").nargs(0).help("Dump versions of the operators in circle file");
   arser.add_argument("--tensor_dtype").nargs(0).help("Dump dtype of tensors");
+  arser.add_argument("--cost")
+    .nargs(0)
+    .help("Dump estimated MACs, FLOPs and memory of operators with peak activation memory");
   arser.add_argument("circle").help("Circle file to inspect");
 
   try
@@ -50,7 +53,7 @@ int entry(int argc, char **argv)
   }
 
   if (!arser["--operators"] && !arser["--conv2d_weight"] && !arser["--op_version"] &&
-      !arser["--tensor_dtype"])
+      !arser["--tensor_dtype"] && !arser["--cost"])
   {
     std::cout << "At least one option must be specified" << std::endl;
     std::cout << arser;
@@ -67,6 +70,8 @@ int entry(int argc, char **argv)
     dumps.push_back(std::make_unique<circleinspect::DumpOperatorVersion>());
   if (arser["--tensor_dtype"])
     dumps.push_back(std::make_unique<circleinspect::DumpTensorDType>());
+  if (arser["--cost"])
+    dumps.push_back(std::make_unique<circleinspect::DumpCost>());
 
   std::string model_file = arser.get<std::string>("circle");
 
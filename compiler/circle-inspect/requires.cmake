@@ -1,3 +1,5 @@
 require("arser")
 require("mio-circle04")
+require("luci")
+require("logo")
 require("safemain")
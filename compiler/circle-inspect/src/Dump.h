@@ -69,6 +69,18 @@ public:
   void run(std::ostream &os, const circle::Model *model);
 };
 
+/**
+ * @brief Dump estimated compute and memory costs of Ops of the main graph in execution order
+ */
+class DumpCost final : public DumpInterface
+{
+public:
+  DumpCost() = default;
+
+public:
+  void run(std::ostream &os, const circle::Model *model);
+};
+
 } // namespace circleinspect
 
 #endif // __DUMP_H__
@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Dump.h"
+
+#include <luci/Importer.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/Pass/CircleShapeInferencePass.h>
+#include <luci/Pass/CircleTypeInferencePass.h>
+#include <luci/Plan/CircleNodeExecutionPlan.h>
+
+#include <loco/IR/DataTypeTraits.h>
+#include <logo/Phase.h>
+
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+uint64_t num_elements(const luci::CircleNode *node)
+{
+  // Unknown dimensions are counted as 1, for a lower bound of the cost
+  uint64_t count = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    count *= node->dim(i).known() ? node->dim(i).value() : 1;
+  return count;
+}
+
+bool has_unknown_dim(const luci::CircleNode *node)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID)
+    return true;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (!node->dim(i).known())
+      return true;
+  }
+  return false;
+}
+
+uint64_t num_bytes(const luci::CircleNode *node)
+{
+  if (node->dtype() == loco::DataType::Unknown)
+    return 0;
+  return num_elements(node) * loco::size(node->dtype());
+}
+
+uint64_t dim(const loco::Node *node, uint32_t axis)
+{
+  auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+  if (axis >= circle_node->rank() || !circle_node->dim(axis).known())
+    return 1;
+  return circle_node->dim(axis).value();
+}
+
+class QueryVirtual final : public luci::CircleNodeVisitor<bool>
+{
+public:
+#define CIRCLE_NODE(OPCODE, CIRCLE_CLASS) \
+  bool visit(const CIRCLE_CLASS *) final { return false; }
+#define CIRCLE_VNODE(OPCODE, CIRCLE_CLASS) \
+  bool visit(const CIRCLE_CLASS *) final { return true; }
+
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+};
+
+class QueryOpCode final : public luci::CircleNodeVisitor<circle::BuiltinOperator>
+{
+public:
+// NOTE only circle operators are queried (NOT virtual nodes)
+#define CIRCLE_NODE(OPCODE, CIRCLE_CLASS)                \
+  circle::BuiltinOperator visit(const CIRCLE_CLASS *) final \
+  {                                                         \
+    return circle::BuiltinOperator_##OPCODE;                \
+  }
+#define CIRCLE_VNODE(OPCODE, CIRCLE_CLASS)
+
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+};
+
+bool is_virtual(const luci::CircleNode *node)
+{
+  QueryVirtual query;
+  return node->accept(&query);
+}
+
+bool is_param(const loco::Node *node)
+{
+  return dynamic_cast<const luci::CircleConst *>(node) != nullptr ||
+         dynamic_cast<const luci::CircleVariable *>(node) != nullptr;
+}
+
+bool has_bias(const luci::CircleNode *node)
+{
+  auto bias = dynamic_cast<const luci::CircleNodeMixin<luci::CircleNodeTrait::Bias> *>(node);
+  return bias != nullptr && bias->bias() != nullptr &&
+         dynamic_cast<luci::CircleOutputExclude *>(bias->bias()) == nullptr;
+}
+
+struct Compute
+{
+  uint64_t macs = 0;
+  uint64_t flops = 0;
+};
+
+/**
+ * @brief Estimate MACs and FLOPs of an Op from the shapes of its inputs and outputs
+ * @note  A multiply-accumulate is 2 FLOPs. Other Ops cost a FLOP for each output element, or for
+ *        each input element of reductions, and data movement Ops cost none.
+ */
+class EstimateCompute final : public luci::CircleNodeVisitor<Compute>
+{
+public:
+  Compute visit(const luci::CircleConv2D *node) final
+  {
+    // filter is [O, H, W, I]
+    const auto filter = node->filter();
+    return withMACs(node, num_elements(node) * dim(filter, 1) * dim(filter, 2) * dim(filter, 3));
+  }
+
+  Compute visit(const luci::CircleDepthwiseConv2D *node) final
+  {
+    // filter is [1, H, W, O]
+    const auto filter = node->filter();
+    return withMACs(node, num_elements(node) * dim(filter, 1) * dim(filter, 2));
+  }
+
+  Compute visit(const luci::CircleTransposeConv *node) final
+  {
+    // Every input element is scattered to H * W * O outputs
+    const auto filter = node->filter();
+    const auto input = loco::must_cast<const luci::CircleNode *>(node->outBackprop());
+    return withMACs(node,
+                    num_elements(input) * dim(filter, 0) * dim(filter, 1) * dim(filter, 2));
+  }
+
+  Compute visit(const luci::CircleFullyConnected *node) final
+  {
+    // weights are [O, I]
+    return withMACs(node, num_elements(node) * dim(node->weights(), 1));
+  }
+
+  Compute visit(const luci::CircleBCQFullyConnected *node) final
+  {
+    return withMACs(node, num_elements(node) * node->weights_hidden_size());
+  }
+
+  Compute visit(const luci::CircleBatchMatMul *node) final
+  {
+    const auto x = loco::must_cast<const luci::CircleNode *>(node->x());
+    const auto rank = x->rank();
+    if (rank < 2)
+      return Compute{};
+    const auto depth = dim(x, node->adj_x() ? rank - 2 : rank - 1);
+    return withMACs(node, num_elements(node) * depth);
+  }
+
+  Compute visit(const luci::CircleAveragePool2D *node) final
+  {
+    return pooling(node, node->filter());
+  }
+
+  Compute visit(const luci::CircleMaxPool2D *node) final { return pooling(node, node->filter()); }
+
+  Compute visit(const luci::CircleL2Pool2D *node) final { return pooling(node, node->filter()); }
+
+  Compute visit(const luci::CircleNode *node) final
+  {
+    Compute compute;
+    switch (node->opcode())
+    {
+      case luci::CircleOpcode::ABS:
+      case luci::CircleOpcode::ADD:
+      case luci::CircleOpcode::ADD_N:
+      case luci::CircleOpcode::CAST:
+      case luci::CircleOpcode::COS:
+      case luci::CircleOpcode::DEQUANTIZE:
+      case luci::CircleOpcode::DIV:
+      case luci::CircleOpcode::ELU:
+      case luci::CircleOpcode::EXP:
+      case luci::CircleOpcode::FLOOR_DIV:
+      case luci::CircleOpcode::FLOOR_MOD:
+      case luci::CircleOpcode::GELU:
+      case luci::CircleOpcode::HARD_SWISH:
+      case luci::CircleOpcode::INSTANCE_NORM:
+      case luci::CircleOpcode::L2_NORMALIZATION:
+      case luci::CircleOpcode::LAYER_NORM:
+      case luci::CircleOpcode::LEAKY_RELU:
+      case luci::CircleOpcode::LOCAL_RESPONSE_NORMALIZATION:
+      case luci::CircleOpcode::LOG:
+      case luci::CircleOpcode::LOGISTIC:
+      case luci::CircleOpcode::LOG_SOFTMAX:
+      case luci::CircleOpcode::MAXIMUM:
+      case luci::CircleOpcode::MINIMUM:
+      case luci::CircleOpcode::MUL:
+      case luci::CircleOpcode::NEG:
+      case luci::CircleOpcode::POW:
+      case luci::CircleOpcode::PRELU:
+      case luci::CircleOpcode::QUANTIZE:
+      case luci::CircleOpcode::RELU:
+      case luci::CircleOpcode::RELU6:
+      case luci::CircleOpcode::RELU_N1_TO_1:
+      case luci::CircleOpcode::RESIZE_BILINEAR:
+      case luci::CircleOpcode::RSQRT:
+      case luci::CircleOpcode::SIN:
+      case luci::CircleOpcode::SOFTMAX:
+      case luci::CircleOpcode::SQRT:
+      case luci::CircleOpcode::SQUARE:
+      case luci::CircleOpcode::SQUARED_DIFFERENCE:
+      case luci::CircleOpcode::SUB:
+      case luci::CircleOpcode::TANH:
+        compute.flops = num_elements(node);
+        break;
+      case luci::CircleOpcode::MEAN:
+      case luci::CircleOpcode::REDUCE_MAX:
+      case luci::CircleOpcode::REDUCE_MIN:
+      case luci::CircleOpcode::REDUCE_PROD:
+      case luci::CircleOpcode::SUM:
+        compute.flops = num_elements(loco::must_cast<const luci::CircleNode *>(node->arg(0)));
+        break;
+      default:
+        break;
+    }
+    return compute;
+  }
+
+private:
+  Compute withMACs(const luci::CircleNode *node, uint64_t macs)
+  {
+    Compute compute;
+    compute.macs = macs;
+    compute.flops = 2 * macs + (has_bias(node) ? num_elements(node) : 0);
+    return compute;
+  }
+
+  Compute pooling(const luci::CircleNode *node, const luci::Filter *filter)
+  {
+    Compute compute;
+    compute.flops = num_elements(node) * filter->h() * filter->w();
+    return compute;
+  }
+};
+
+/**
+ * @brief Ops of a graph in execution order
+ * @note  The order of the execution plan is used if every Op has one, or the order of the
+ *        operators in the model, in which luci creates the nodes.
+ */
+std::vector<luci::CircleNode *> execution_order(loco::Graph *g)
+{
+  std::vector<luci::CircleNode *> ops;
+  for (uint32_t i = 0; i < g->nodes()->size(); ++i)
+  {
+    auto node = loco::must_cast<luci::CircleNode *>(g->nodes()->at(i));
+    if (!is_virtual(node))
+      ops.push_back(node);
+  }
+
+  const bool planned = !ops.empty() && std::all_of(ops.begin(), ops.end(), [](auto node) {
+    return luci::has_execution_plan(node);
+  });
+  if (planned)
+  {
+    std::stable_sort(ops.begin(), ops.end(), [](auto lhs, auto rhs) {
+      return luci::get_execution_plan(lhs).order_in_plan() <
+             luci::get_execution_plan(rhs).order_in_plan();
+    });
+  }
+  return ops;
+}
+
+/**
+ * @brief Tensors an Op writes, which are its virtual output nodes for multiple outputs
+ */
+std::vector<luci::CircleNode *> op_outputs(luci::CircleNode *op)
+{
+  std::vector<luci::CircleNode *> outputs;
+  for (auto succ : loco::succs(op))
+  {
+    auto node = loco::must_cast<luci::CircleNode *>(succ);
+    if (is_virtual(node) && dynamic_cast<luci::CircleOutput *>(node) == nullptr)
+      outputs.push_back(node);
+  }
+  if (outputs.empty())
+    outputs.push_back(op);
+  return outputs;
+}
+
+std::string opcode_name(const luci::CircleNode *node)
+{
+  QueryOpCode query;
+  return circle::EnumNameBuiltinOperator(node->accept(&query));
+}
+
+double intensity(uint64_t flops, uint64_t bytes)
+{
+  return bytes == 0 ? 0.0 : static_cast<double>(flops) / static_cast<double>(bytes);
+}
+
+} // namespace
+
+namespace circleinspect
+{
+
+void DumpCost::run(std::ostream &os, const circle::Model *model)
+{
+  luci::Importer importer;
+  auto module = importer.importModule(model);
+
+  // Costs of the main graph, where other graphs are run by control flow Ops
+  auto g = module->graph();
+  {
+    logo::Phase phase;
+
+    phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+    phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+
+    logo::PhaseRunner<logo::PhaseStrategy::Saturate> phase_runner{g};
+    phase_runner.run(phase);
+  }
+
+  const auto ops = execution_order(g);
+
+  // Step of the last Op which reads each activation, where graph outputs are read at the end
+  const auto end_step = ops.size();
+  std::map<const luci::CircleNode *, size_t> last_use;
+  for (size_t step = 0; step < ops.size(); ++step)
+  {
+    for (uint32_t i = 0; i < ops[step]->arity(); ++i)
+    {
+      auto input = loco::must_cast<const luci::CircleNode *>(ops[step]->arg(i));
+      if (!is_param(input) && dynamic_cast<const luci::CircleOutputExclude *>(input) == nullptr)
+        last_use[input] = step;
+    }
+  }
+  for (auto output : loco::output_nodes(g))
+  {
+    auto circle_output = loco::must_cast<luci::CircleOutput *>(output);
+    last_use[loco::must_cast<const luci::CircleNode *>(circle_output->from())] = end_step;
+  }
+
+  // Graph inputs live from the start
+  uint64_t live_bytes = 0;
+  for (auto input : loco::input_nodes(g))
+    live_bytes += num_bytes(loco::must_cast<const luci::CircleNode *>(input));
+  uint64_t peak_bytes = live_bytes;
+  std::string peak_op = "(inputs)";
+
+  Compute total;
+  uint64_t total_activation_bytes = live_bytes;
+  std::set<const loco::Node *> params;
+  uint64_t total_param_bytes = 0;
+  bool unknown_shape = false;
+
+  os << "Order,Name,Opcode,MACs,FLOPs,ParamBytes,ActivationBytes,Intensity" << std::endl;
+  for (size_t step = 0; step < ops.size(); ++step)
+  {
+    auto op = ops[step];
+
+    EstimateCompute estimate;
+    const auto compute = op->accept(&estimate);
+
+    uint64_t param_bytes = 0;
+    uint64_t activation_bytes = 0;
+    for (uint32_t i = 0; i < op->arity(); ++i)
+    {
+      auto input = loco::must_cast<const luci::CircleNode *>(op->arg(i));
+      if (dynamic_cast<const luci::CircleOutputExclude *>(input) != nullptr)
+        continue;
+      unknown_shape |= has_unknown_dim(input);
+      if (is_param(input))
+      {
+        param_bytes += num_bytes(input);
+        if (params.insert(input).second)
+          total_param_bytes += num_bytes(input);
+      }
+      else
+        activation_bytes += num_bytes(input);
+    }
+
+    // Outputs are allocated while inputs are still alive
+    const auto outputs = op_outputs(op);
+    for (auto output : outputs)
+    {
+      unknown_shape |= has_unknown_dim(output);
+      activation_bytes += num_bytes(output);
+      live_bytes += num_bytes(output);
+      total_activation_bytes += num_bytes(output);
+    }
+    if (live_bytes > peak_bytes)
+    {
+      peak_bytes = live_bytes;
+      peak_op = op->name();
+    }
+
+    // Free the activations read for the last time, and outputs never read
+    for (uint32_t i = 0; i < op->arity(); ++i)
+    {
+      auto input = loco::must_cast<const luci::CircleNode *>(op->arg(i));
+      auto it = last_use.find(input);
+      if (it != last_use.end() && it->second == step)
+      {
+        live_bytes -= num_bytes(input);
+        // Not to free an input read twice by this Op again
+        last_use.erase(it);
+      }
+    }
+    for (auto output : outputs)
+    {
+      if (last_use.find(output) == last_use.end())
+        live_bytes -= num_bytes(output);
+    }
+
+    total.macs += compute.macs;
+    total.flops += compute.flops;
+
+    os << step << "," << op->name() << "," << opcode_name(op) << "," << compute.macs << ","
+       << compute.flops << "," << param_bytes << "," << activation_bytes << ","
+       << intensity(compute.flops, param_bytes + activation_bytes) << std::endl;
+  }
+
+  os << std::endl;
+  os << "Total MACs: " << total.macs << std::endl;
+  os << "Total FLOPs: " << total.flops << std::endl;
+  os << "Parameter bytes: " << total_param_bytes << std::endl;
+  os << "Activation bytes: " << total_activation_bytes << std::endl;
+  os << "Peak activation bytes: " << peak_bytes << " (at " << peak_op << ")" << std::endl;
+  os << "Arithmetic intensity: "
+     << intensity(total.flops, total_param_bytes + total_activation_bytes) << " FLOPs/byte"
+     << std::endl;
+  if (unknown_shape)
+    os << "NOTE Unknown dimensions are counted as 1" << std::endl;
+}
+
+} // namespace circleinspect
@@ -15,6 +15,8 @@
  */
 
 #include "ModuleIO.h"
+#include "HotOps.h"
+#include "HotOpExtractor.h"
 
 #include <luci/Profile/CircleNodeID.h>
 
@@ -26,9 +28,12 @@
 #include <vector>
 #include <algorithm>
 #include <cctype>
+#include <cerrno>
 #include <numeric>
 #include <sstream>
 
+#include <sys/stat.h>
+
 void print_version(void)
 {
   std::cout << "circle-opselector version " << vconone::get_string() << std::endl;
@@ -164,11 +169,17 @@ int entry(int argc, char **argv)
   // TODO Add new options!
 
   arser.add_argument("input").help("Input circle model");
-  arser.add_argument("output").help("Output circle model");
+  arser.add_argument("output").help("Output circle model, or directory with '--by_profile'");
 
   // select option
   arser.add_argument("--by_id").help("Input operation id to select nodes.");
   arser.add_argument("--by_name").help("Input operation name to select nodes.");
+  arser.add_argument("--by_profile")
+    .help("Input onert trace or exec_time.json to select the most expensive nodes. Each of them "
+          "is written to the output directory as a model with its input data.");
+  arser.add_argument("--top")
+    .type(arser::DataType::INT32)
+    .help("Number of nodes to select with '--by_profile' (default: 5)");
 
   try
   {
@@ -189,13 +200,57 @@ int entry(int argc, char **argv)
   std::vector<uint32_t> by_id;
   std::vector<std::string> by_name;
 
-  if (!arser["--by_id"] && !arser["--by_name"] || arser["--by_id"] && arser["--by_name"])
+  const int num_select_options = (arser["--by_id"] ? 1 : 0) + (arser["--by_name"] ? 1 : 0) +
+                                 (arser["--by_profile"] ? 1 : 0);
+  if (num_select_options != 1)
   {
-    std::cerr << "ERROR: Either option '--by_id' or '--by_name' must be specified" << std::endl;
+    std::cerr << "ERROR: Either option '--by_id', '--by_name' or '--by_profile' must be specified"
+              << std::endl;
     std::cerr << arser;
     return EXIT_FAILURE;
   }
 
+  if (arser["--by_profile"])
+  {
+    int top = 5;
+    if (arser["--top"])
+      top = arser.get<int>("--top");
+    if (top <= 0)
+    {
+      std::cerr << "ERROR: '--top' must be positive" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    opselector::Profile profile;
+    try
+    {
+      profile = opselector::readProfile(arser.get<std::string>("--by_profile"));
+    }
+    catch (const std::runtime_error &err)
+    {
+      std::cerr << "ERROR: " << err.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // The output is a directory of the models of the selected nodes
+    if (::mkdir(output_path.c_str(), 0755) != 0 && errno != EEXIST)
+    {
+      std::cerr << "ERROR: Failed to create '" << output_path << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    auto module = opselector::getModule(input_path);
+    auto hot_ops =
+      opselector::selectHotOps(module->graph(), profile, static_cast<uint32_t>(top));
+    if (hot_ops.empty())
+    {
+      std::cerr << "ERROR: No operator of the model is found in the profile" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    return opselector::extractHotOps(module.get(), hot_ops, output_path) ? 0 : EXIT_FAILURE;
+  }
+
   if (arser["--by_id"])
   {
     operator_input = arser.get<std::string>("--by_id");
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HotOpExtractor.h"
+#include "ModuleIO.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Partition.h>
+#include <luci/Profile/CircleNodeID.h>
+
+#include <loco.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+namespace
+{
+
+const std::string kHotGroup = "hot";
+const std::string kRestGroup = "rest";
+
+/**
+ * @brief Give names to unnamed operators, as partition selects operators by their names
+ */
+void nameOperators(loco::Graph *graph)
+{
+  for (auto node : loco::all_nodes(graph))
+  {
+    auto cnode = loco::must_cast<luci::CircleNode *>(node);
+    if (cnode->name().empty() && luci::has_node_id(cnode))
+      cnode->name("opselector_" + std::to_string(luci::get_node_id(cnode)));
+  }
+}
+
+uint32_t numElements(const luci::CircleNode *node)
+{
+  uint32_t elements = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    // unknown dimensions of dynamic shapes are regarded as 1
+    if (node->dim(i).known())
+      elements *= node->dim(i).value();
+  }
+  return elements;
+}
+
+template <typename T, typename Dist>
+std::vector<char> randomData(uint32_t elements, Dist dist, std::mt19937 &gen)
+{
+  std::vector<char> data(elements * sizeof(T));
+  for (uint32_t i = 0; i < elements; ++i)
+  {
+    const T value = static_cast<T>(dist(gen));
+    std::memcpy(data.data() + i * sizeof(T), &value, sizeof(T));
+  }
+  return data;
+}
+
+std::vector<char> inputData(const luci::CircleInput *input, std::mt19937 &gen)
+{
+  const auto elements = numElements(input);
+  switch (input->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      return randomData<float>(elements, std::uniform_real_distribution<float>(-1.f, 1.f), gen);
+    case loco::DataType::U8:
+      return randomData<uint8_t>(elements, std::uniform_int_distribution<int>(0, 255), gen);
+    case loco::DataType::S8:
+      return randomData<int8_t>(elements, std::uniform_int_distribution<int>(-128, 127), gen);
+    case loco::DataType::S16:
+      return randomData<int16_t>(elements, std::uniform_int_distribution<int>(-32768, 32767),
+                                 gen);
+    default:
+      // indices, shapes and so on, whose valid values depend on the operator
+      return std::vector<char>(elements * loco::size(input->dtype()), 0);
+  }
+}
+
+} // namespace
+
+namespace opselector
+{
+
+std::unique_ptr<luci::Module> extractOp(luci::Module *module, const luci::CircleNode *node)
+{
+  auto graph = module->graph();
+  nameOperators(graph);
+
+  for (auto other : loco::all_nodes(graph))
+  {
+    auto cother = loco::must_cast<const luci::CircleNode *>(other);
+    if (cother != node && luci::has_node_id(cother) && cother->name() == node->name())
+    {
+      std::cerr << "ERROR: Operator name '" << node->name() << "' is not unique" << std::endl;
+      return nullptr;
+    }
+  }
+
+  luci::PartitionTable table;
+  table.groups = {kHotGroup, kRestGroup};
+  table.default_group = kRestGroup;
+  table.comply = luci::PartitionTable::COMPLY::OPNAME;
+  table.byopnames[node->name()] = kHotGroup;
+
+  auto pms = luci::apply(module, table);
+  for (auto &pm : pms.pmodules)
+  {
+    if (pm.group == kHotGroup)
+      return std::move(pm.module);
+  }
+
+  std::cerr << "ERROR: Failed to extract '" << node->name() << "'" << std::endl;
+  return nullptr;
+}
+
+bool writeInputs(luci::Module *module, const std::string &prefix)
+{
+  // Fixed seed to reproduce the same inputs for the same model
+  std::mt19937 gen(0);
+
+  const auto input_nodes = loco::input_nodes(module->graph());
+  for (uint32_t n = 0; n < input_nodes.size(); ++n)
+  {
+    auto input = loco::must_cast<const luci::CircleInput *>(input_nodes[n]);
+    const auto data = inputData(input, gen);
+
+    const auto path = prefix + std::to_string(n);
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+      std::cerr << "ERROR: Failed to write '" << path << "'" << std::endl;
+      return false;
+    }
+    file.write(data.data(), data.size());
+  }
+  return true;
+}
+
+bool extractHotOps(luci::Module *module, const std::vector<HotOp> &hot_ops,
+                   const std::string &output_dir)
+{
+  const auto list_path = output_dir + "/hot_ops.csv";
+  std::ofstream list(list_path);
+  if (!list.is_open())
+  {
+    std::cerr << "ERROR: Failed to write '" << list_path << "'" << std::endl;
+    return false;
+  }
+  list << "Rank,Id,Name,Time(us),Model,Inputs" << std::endl;
+
+  for (uint32_t rank = 0; rank < hot_ops.size(); ++rank)
+  {
+    const auto &op = hot_ops.at(rank);
+    auto op_module = extractOp(module, op.node);
+    if (op_module == nullptr)
+      return false;
+
+    std::string model_path = output_dir + "/op" + std::to_string(op.id) + ".circle";
+    if (!exportModule(op_module.get(), model_path))
+      return false;
+    if (!writeInputs(op_module.get(), model_path + ".input"))
+      return false;
+
+    const auto num_inputs = loco::input_nodes(op_module->graph()).size();
+    list << rank << "," << op.id << "," << op.node->name() << "," << op.time << "," << model_path
+         << "," << num_inputs << std::endl;
+    std::cout << "#" << rank << " " << op.node->name() << " (" << op.time << " us) -> "
+              << model_path << std::endl;
+  }
+
+  return true;
+}
+
+} // namespace opselector
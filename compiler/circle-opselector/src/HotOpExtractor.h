@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_OPSELECTOR_HOTOP_EXTRACTOR_H__
+#define __CIRCLE_OPSELECTOR_HOTOP_EXTRACTOR_H__
+
+#include "HotOps.h"
+
+#include <luci/IR/Module.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opselector
+{
+
+/**
+ * @brief Return a model of a single operator of the main graph of module
+ *
+ * @note  Inputs of the operator become inputs of the model of their shapes and types, while its
+ *        constant inputs like weights are copied into the model.
+ */
+std::unique_ptr<luci::Module> extractOp(luci::Module *module, const luci::CircleNode *node);
+
+/**
+ * @brief Write random data of each input n of the main graph to "${prefix}n"
+ *
+ * @note  Files are raw data of the input tensors like luci-eval-driver reads.
+ *        Integer inputs other than 8 and 16 bits like indices are filled with zeros.
+ */
+bool writeInputs(luci::Module *module, const std::string &prefix);
+
+/**
+ * @brief Write each of hot_ops as a model with its inputs in output_dir, and their list
+ */
+bool extractHotOps(luci::Module *module, const std::vector<HotOp> &hot_ops,
+                   const std::string &output_dir);
+
+} // namespace opselector
+
+#endif // __CIRCLE_OPSELECTOR_HOTOP_EXTRACTOR_H__
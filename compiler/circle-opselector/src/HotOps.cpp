@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HotOps.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/Profile/CircleNodeID.h>
+
+#include <loco.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+/**
+ * @brief Return the value of "key" : "value" in a line of Chrome trace, or empty string
+ */
+std::string fieldValue(const std::string &line, const std::string &key)
+{
+  const std::string quoted = "\"" + key + "\"";
+  auto pos = line.find(quoted);
+  if (pos == std::string::npos)
+    return "";
+  pos = line.find('"', line.find(':', pos + quoted.size()));
+  if (pos == std::string::npos)
+    return "";
+  const auto end = line.find('"', pos + 1);
+  if (end == std::string::npos)
+    return "";
+  return line.substr(pos + 1, end - pos - 1);
+}
+
+class QueryOpCodeName final : public luci::CircleNodeVisitor<const char *>
+{
+public:
+#define CIRCLE_NODE(OPCODE, CIRCLE_CLASS) \
+  const char *visit(const luci::CIRCLE_CLASS *) final { return #OPCODE; }
+#define CIRCLE_VNODE(OPCODE, CIRCLE_CLASS) \
+  const char *visit(const luci::CIRCLE_CLASS *) final { return #OPCODE; }
+
+#include <luci/IR/CircleNodes.lst>
+#undef CIRCLE_VNODE
+#undef CIRCLE_NODE
+};
+
+uint32_t tensorBytes(const luci::CircleNode *node)
+{
+  if (dynamic_cast<const luci::CircleOutputExclude *>(node) != nullptr)
+    return 0;
+  if (node->dtype() == loco::DataType::Unknown)
+    return 0;
+
+  uint32_t elements = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (node->dim(i).known())
+      elements *= node->dim(i).value();
+  }
+  return elements * loco::size(node->dtype());
+}
+
+/**
+ * @brief Bytes of inputs and outputs of an operator, like the "size" of exec_time.json
+ */
+uint32_t ioBytes(const luci::CircleNode *node)
+{
+  uint32_t bytes = 0;
+  for (uint32_t i = 0; i < node->arity(); ++i)
+    bytes += tensorBytes(loco::must_cast<const luci::CircleNode *>(node->arg(i)));
+
+  // Operators of multiple outputs are followed by virtual nodes of the outputs
+  uint32_t out_bytes = 0;
+  bool multiple_outputs = false;
+  for (auto succ : loco::succs(node))
+  {
+    auto csucc = loco::must_cast<const luci::CircleNode *>(succ);
+    if (luci::has_node_id(csucc) || dynamic_cast<const luci::CircleOutput *>(csucc) != nullptr)
+      continue;
+    multiple_outputs = true;
+    out_bytes += tensorBytes(csucc);
+  }
+  return bytes + (multiple_outputs ? out_bytes : tensorBytes(node));
+}
+
+/**
+ * @brief Time of the record whose size is the closest to the given size
+ */
+uint64_t closestTime(const std::map<uint32_t, int64_t> &records, uint32_t size)
+{
+  if (records.empty())
+    return 0;
+
+  auto it = records.lower_bound(size);
+  if (it == records.end())
+    it = std::prev(it);
+  else if (it != records.begin() && size - std::prev(it)->first < it->first - size)
+    it = std::prev(it);
+  return it->second > 0 ? static_cast<uint64_t>(it->second) : 0;
+}
+
+} // namespace
+
+namespace opselector
+{
+
+Profile readTrace(std::istream &is)
+{
+  Profile profile;
+
+  // Begin timestamps of operations which are running on each thread
+  std::map<std::pair<std::string, std::string>, std::vector<uint64_t>> begins;
+
+  for (std::string line; std::getline(is, line);)
+  {
+    const auto name = fieldValue(line, "name");
+    // Only operations of the main subgraph, "@<index> <name>" on "$<session> sess, $0 subg, ..."
+    if (name.size() < 2 || name[0] != '@')
+      continue;
+    const auto tid = fieldValue(line, "tid");
+    if (tid.find("$0 subg") == std::string::npos)
+      continue;
+
+    const auto ph = fieldValue(line, "ph");
+    const auto ts = std::strtoull(fieldValue(line, "ts").c_str(), nullptr, 10);
+    auto &stack = begins[{tid, name}];
+    if (ph == "B")
+    {
+      stack.push_back(ts);
+    }
+    else if (ph == "E" && !stack.empty())
+    {
+      const auto begin = stack.back();
+      stack.pop_back();
+      const auto index = static_cast<uint32_t>(std::strtoul(name.c_str() + 1, nullptr, 10));
+      profile.op_times[index] += ts > begin ? ts - begin : 0;
+    }
+  }
+
+  return profile;
+}
+
+Profile readExecTime(std::istream &is)
+{
+  Profile profile;
+
+  // exec_time.json is {"<backend>": {"<operation>": {"<quant>": [[size, time, age], ...]}}}
+  std::vector<std::string> keys; // keys of the objects which are open
+  std::vector<int64_t> record;
+  std::string last_string;
+  std::string number;
+  int list_depth = 0;
+  char c;
+
+  while (is.get(c))
+  {
+    if (std::isdigit(c) || c == '-')
+    {
+      number.push_back(c);
+      continue;
+    }
+    if (!number.empty())
+    {
+      record.push_back(std::atoll(number.c_str()));
+      number.clear();
+    }
+
+    switch (c)
+    {
+      case '"':
+        std::getline(is, last_string, '"');
+        break;
+      case '{':
+        keys.push_back(last_string);
+        break;
+      case '}':
+        if (!keys.empty())
+          keys.pop_back();
+        break;
+      case '[':
+        if (++list_depth == 2)
+          record.clear();
+        break;
+      case ']':
+        if (list_depth-- == 2 && keys.size() >= 3 && record.size() >= 2)
+        {
+          const auto size = static_cast<uint32_t>(record[0]);
+          auto &records = profile.exec_times[keys[2]];
+          auto it = records.find(size);
+          // Keep the fastest of backends, as the scheduler would choose it
+          if (it == records.end() || record[1] < it->second)
+            records[size] = record[1];
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  return profile;
+}
+
+Profile readProfile(const std::string &path)
+{
+  std::ifstream file(path);
+  if (!file.is_open())
+    throw std::runtime_error("Failed to open profile '" + path + "'");
+
+  std::stringstream ss;
+  ss << file.rdbuf();
+  const auto content = ss.str();
+
+  std::istringstream is(content);
+  if (content.find("\"traceEvents\"") != std::string::npos)
+    return readTrace(is);
+  return readExecTime(is);
+}
+
+std::string normalizeOpName(const std::string &name)
+{
+  std::string normalized;
+  for (unsigned char c : name)
+  {
+    if (c != '_')
+      normalized.push_back(static_cast<char>(std::tolower(c)));
+  }
+  return normalized;
+}
+
+std::vector<HotOp> selectHotOps(loco::Graph *graph, const Profile &profile, uint32_t top)
+{
+  // Operation names of exec_time.json by the normalized names
+  std::map<std::string, const std::map<uint32_t, int64_t> *> exec_times;
+  for (const auto &item : profile.exec_times)
+    exec_times[normalizeOpName(item.first)] = &item.second;
+
+  std::vector<HotOp> hot_ops;
+  for (auto node : loco::all_nodes(graph))
+  {
+    auto cnode = loco::must_cast<const luci::CircleNode *>(node);
+    if (!luci::has_node_id(cnode)) // not an operator
+      continue;
+
+    HotOp op;
+    op.node = cnode;
+    op.id = luci::get_node_id(cnode);
+
+    if (!profile.op_times.empty())
+    {
+      auto it = profile.op_times.find(op.id);
+      if (it != profile.op_times.end())
+        op.time = it->second;
+    }
+    else
+    {
+      QueryOpCodeName query;
+      auto it = exec_times.find(normalizeOpName(cnode->accept(&query)));
+      if (it != exec_times.end())
+        op.time = closestTime(*it->second, ioBytes(cnode));
+    }
+
+    if (op.time > 0)
+      hot_ops.push_back(op);
+  }
+
+  std::sort(hot_ops.begin(), hot_ops.end(), [](const HotOp &lhs, const HotOp &rhs) {
+    return lhs.time != rhs.time ? lhs.time > rhs.time : lhs.id < rhs.id;
+  });
+  if (hot_ops.size() > top)
+    hot_ops.resize(top);
+
+  return hot_ops;
+}
+
+} // namespace opselector
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_OPSELECTOR_HOTOPS_H__
+#define __CIRCLE_OPSELECTOR_HOTOPS_H__
+
+#include <luci/IR/CircleNode.h>
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace opselector
+{
+
+/**
+ * @brief Execution times of a model measured by onert
+ *
+ * @note  Either of them is filled by readProfile():
+ *        - op_times from a Chrome trace of onert written to TRACE_FILEPATH, which has
+ *          events named "@<operation index> <operation name>" for each operation
+ *        - exec_times from exec_time.json of onert profiling mode, which has times of
+ *          operation names for each "size", the sum of input and output bytes
+ */
+struct Profile
+{
+  // microseconds of each operation index of the main subgraph, summed over runs
+  std::map<uint32_t, uint64_t> op_times;
+  // microseconds of operation name for sizes, the fastest of backends
+  std::map<std::string, std::map<uint32_t, int64_t>> exec_times;
+};
+
+/**
+ * @brief Operator selected from a profile with its execution time in microseconds
+ */
+struct HotOp
+{
+  const luci::CircleNode *node = nullptr;
+  uint32_t id = 0;
+  uint64_t time = 0;
+};
+
+Profile readTrace(std::istream &is);
+Profile readExecTime(std::istream &is);
+Profile readProfile(const std::string &path);
+
+/**
+ * @brief Lower-cased name without '_', to match names of circle opcodes and onert operations
+ *        like "CONV_2D" and "Conv2D"
+ */
+std::string normalizeOpName(const std::string &name);
+
+/**
+ * @brief Return at most top operators of the main graph, the most expensive first
+ */
+std::vector<HotOp> selectHotOps(loco::Graph *graph, const Profile &profile, uint32_t top);
+
+} // namespace opselector
+
+#endif // __CIRCLE_OPSELECTOR_HOTOPS_H__
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HotOps.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeID.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace
+{
+
+/**
+ * @brief Graph of input - Abs(id 0) - Sqrt(id 1) - output of [1, 4] float
+ */
+class AbsSqrtGraph
+{
+public:
+  AbsSqrtGraph()
+  {
+    _g = loco::make_graph();
+    auto input = _g->nodes()->create<luci::CircleInput>();
+    abs = _g->nodes()->create<luci::CircleAbs>();
+    sqrt = _g->nodes()->create<luci::CircleSqrt>();
+    auto output = _g->nodes()->create<luci::CircleOutput>();
+
+    for (luci::CircleNode *node : {static_cast<luci::CircleNode *>(input),
+                                   static_cast<luci::CircleNode *>(abs),
+                                   static_cast<luci::CircleNode *>(sqrt)})
+    {
+      node->dtype(loco::DataType::FLOAT32);
+      node->shape({1, 4});
+    }
+    abs->x(input);
+    sqrt->x(abs);
+    output->from(sqrt);
+
+    luci::set_node_id(abs, 0);
+    luci::set_node_id(sqrt, 1);
+  }
+
+  loco::Graph *g(void) { return _g.get(); }
+
+  luci::CircleAbs *abs = nullptr;
+  luci::CircleSqrt *sqrt = nullptr;
+
+private:
+  std::unique_ptr<loco::Graph> _g;
+};
+
+} // namespace
+
+TEST(HotOpsTest, readTrace)
+{
+  std::istringstream is(R"({
+  "traceEvents": [
+    { "name" : "@0 Abs", "pid" : "0", "tid" : "$0 sess, $0 subg, cpu", "ph" : "B", "ts" : "10" },
+    { "name" : "@0 Abs", "pid" : "0", "tid" : "$0 sess, $0 subg, cpu", "ph" : "E", "ts" : "15" },
+    { "name" : "@1 Sqrt", "pid" : "0", "tid" : "$0 sess, $0 subg, cpu", "ph" : "B", "ts" : "15" },
+    { "name" : "@1 Sqrt", "pid" : "0", "tid" : "$0 sess, $0 subg, cpu", "ph" : "E", "ts" : "40" },
+    { "name" : "@0 Abs", "pid" : "0", "tid" : "$0 sess, $0 subg, cpu", "ph" : "B", "ts" : "50" },
+    { "name" : "@0 Abs", "pid" : "0", "tid" : "$0 sess, $0 subg, cpu", "ph" : "E", "ts" : "53" },
+    { "name" : "@0 Add", "pid" : "0", "tid" : "$0 sess, $1 subg, cpu", "ph" : "B", "ts" : "60" },
+    { "name" : "@0 Add", "pid" : "0", "tid" : "$0 sess, $1 subg, cpu", "ph" : "E", "ts" : "90" },
+    { "name" : "$0 subg", "pid" : "0", "tid" : "$0 sess, $0 subg", "ph" : "B", "ts" : "0" },
+    { }
+  ]
+})");
+
+  auto profile = opselector::readTrace(is);
+
+  ASSERT_EQ(2, profile.op_times.size());
+  EXPECT_EQ(8, profile.op_times.at(0));
+  EXPECT_EQ(25, profile.op_times.at(1));
+  EXPECT_TRUE(profile.exec_times.empty());
+}
+
+TEST(HotOpsTest, readExecTime)
+{
+  std::istringstream is(R"({"cpu": {"Abs": {"0": [[32, 7, 0], [64, 12, 1]]}, )"
+                        R"("Sqrt": {"0": [[32, 20]]}}, )"
+                        R"("acl_cl": {"Abs": {"0": [[32, 5, 0]]}}})");
+
+  auto profile = opselector::readExecTime(is);
+
+  ASSERT_EQ(2, profile.exec_times.size());
+  // the fastest of backends
+  EXPECT_EQ(5, profile.exec_times.at("Abs").at(32));
+  EXPECT_EQ(12, profile.exec_times.at("Abs").at(64));
+  EXPECT_EQ(20, profile.exec_times.at("Sqrt").at(32));
+  EXPECT_TRUE(profile.op_times.empty());
+}
+
+TEST(HotOpsTest, normalizeOpName)
+{
+  EXPECT_EQ(opselector::normalizeOpName("CONV_2D"), opselector::normalizeOpName("Conv2D"));
+  EXPECT_EQ("fullyconnected", opselector::normalizeOpName("FULLY_CONNECTED"));
+}
+
+TEST(HotOpsTest, selectHotOps_trace)
+{
+  AbsSqrtGraph graph;
+  opselector::Profile profile;
+  profile.op_times[0] = 8;
+  profile.op_times[1] = 25;
+
+  auto hot_ops = opselector::selectHotOps(graph.g(), profile, 1);
+
+  ASSERT_EQ(1, hot_ops.size());
+  EXPECT_EQ(graph.sqrt, hot_ops.at(0).node);
+  EXPECT_EQ(1, hot_ops.at(0).id);
+  EXPECT_EQ(25, hot_ops.at(0).time);
+}
+
+TEST(HotOpsTest, selectHotOps_exec_time)
+{
+  AbsSqrtGraph graph;
+  opselector::Profile profile;
+  // Abs and Sqrt of [1, 4] float have 32 bytes of input and output
+  profile.exec_times["Abs"][30] = 40;
+  profile.exec_times["Abs"][1024] = 400;
+  profile.exec_times["Sqrt"][32] = 20;
+
+  auto hot_ops = opselector::selectHotOps(graph.g(), profile, 5);
+
+  ASSERT_EQ(2, hot_ops.size());
+  EXPECT_EQ(graph.abs, hot_ops.at(0).node);
+  EXPECT_EQ(40, hot_ops.at(0).time);
+  EXPECT_EQ(graph.sqrt, hot_ops.at(1).node);
+}
+
+TEST(HotOpsTest, selectHotOps_none_NEG)
+{
+  AbsSqrtGraph graph;
+  opselector::Profile profile;
+  profile.op_times[7] = 100;
+
+  auto hot_ops = opselector::selectHotOps(graph.g(), profile, 5);
+
+  EXPECT_TRUE(hot_ops.empty());
+}
@@ -23,6 +23,7 @@
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
 #include <luci/CircleOptimizer.h>
+#include <luci/PartitionAuto.h>
 #include <luci/PartitionDump.h>
 #include <luci/PartitionValidate.h>
 #include <luci/Log.h>
@@ -42,6 +43,8 @@ const char *opt_def = "--default";
 const char *opt_part_file = "--part_file";
 const char *opt_input_file = "--input_file";
 const char *opt_work_path = "--work_path";
+const char *opt_cost_file = "--cost_file";
+const char *opt_memory_budget = "--memory_budget";
 
 void print_version(void)
 {
@@ -57,12 +60,18 @@ void build_arser(arser::Arser &arser)
 
   arser.add_argument(opt_def).help("Default backend to assign");
 
+  arser.add_argument(opt_memory_budget)
+    .type(arser::DataType::INT32)
+    .help("Memory budget in MB of each partitioned model for constants and activations");
+
   arser.add_argument(opt_part_file)
     .required(true)
     .help("Partition file which provides backend to assign");
   arser.add_argument(opt_input_file).required(true).help("Input circle model filename");
   arser.add_argument(opt_work_path)
     .help("Work folder of partition, input files exist and output files are produced");
+  arser.add_argument(opt_cost_file)
+    .help("Cost file of Ops in each backend to partition automatically, in work folder");
 }
 
 std::unique_ptr<luci::Module> load_model(const std::string &input_path)
@@ -141,6 +150,16 @@ int entry(int argc, char **argv)
     {
       partition.default_group = arser.get<std::string>(opt_def);
     }
+    if (arser[opt_memory_budget])
+    {
+      auto budget_mb = arser.get<int32_t>(opt_memory_budget);
+      if (budget_mb < 0)
+      {
+        std::cerr << "ERROR: Invalid memory budget " << budget_mb << std::endl;
+        return EXIT_FAILURE;
+      }
+      partition.memory_budget = static_cast<uint64_t>(budget_mb) * 1024 * 1024;
+    }
   }
   if (!luci::validate(partition))
   {
@@ -148,6 +167,15 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  // assign backends to minimize cost when cost file is given
+  if (arser[opt_cost_file])
+  {
+    std::string cost_path = work_folder + "/" + arser.get<std::string>(opt_cost_file);
+    INFO(l) << "--- Auto partition with PartitionCost---------" << std::endl;
+    auto cost = partee::read_cost(cost_path);
+    luci::auto_partition(module.get(), cost, partition);
+  }
+
   INFO(l) << "--- PartitionConfig final----------------------" << std::endl;
   INFO(l) << partition << std::endl;
 
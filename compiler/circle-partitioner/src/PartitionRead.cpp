@@ -38,8 +38,34 @@ const char *_comply_opname = "opname";
 const char *_key_backends = "backends";
 const char *_key_default = "default";
 const char *_key_comply = "comply";
+const char *_key_memory_budget = "memory_budget";
 const char *_key_underscore = "_";
 
+const char *_section_cost = "cost";
+
+const char *_goal_latency = "latency";
+const char *_goal_throughput = "throughput";
+
+const char *_key_goal = "goal";
+const char *_key_transfer = "transfer";
+
+// returns bytes from value in MB
+uint64_t parse_megabytes(const std::string &key, const std::string &value)
+{
+  try
+  {
+    size_t pos = 0;
+    auto megabytes = std::stoull(value, &pos);
+    if (pos == value.size() && value.find('-') == std::string::npos)
+      return megabytes * 1024 * 1024;
+  }
+  catch (const std::exception &)
+  {
+    // fall through
+  }
+  throw std::invalid_argument("Invalid MB '" + value + "' for '" + key + "'");
+}
+
 luci::PartitionTable parse_table(const crew::Sections &sections)
 {
   luci::PartitionTable table;
@@ -65,6 +91,10 @@ luci::PartitionTable parse_table(const crew::Sections &sections)
       table.groups = pepper::csv_to_vector<std::string>(items.at(_key_backends));
       table.default_group = items.at(_key_default);
 
+      auto budget = items.find(_key_memory_budget);
+      if (budget != items.end())
+        table.memory_budget = parse_megabytes(budget->first, budget->second);
+
       auto comply = items.at(_key_comply);
 
       // check valid comply types
@@ -124,6 +154,57 @@ luci::PartitionTable parse_table(const crew::Sections &sections)
   return table;
 }
 
+double parse_cost_value(const std::string &key, const std::string &value)
+{
+  try
+  {
+    size_t pos = 0;
+    auto cost = std::stod(value, &pos);
+    if (pos == value.size() && cost >= 0.0)
+      return cost;
+  }
+  catch (const std::exception &)
+  {
+    // fall through
+  }
+  throw std::invalid_argument("Invalid cost '" + value + "' for '" + key + "'");
+}
+
+luci::PartitionCost parse_cost(const crew::Sections &sections)
+{
+  luci::PartitionCost cost;
+
+  for (auto &section : sections)
+  {
+    auto &items = section.items;
+
+    // '[cost]' section for common settings, other sections are for each backend
+    if (section.name == _section_cost)
+    {
+      auto it = items.find(_key_goal);
+      if (it != items.end())
+      {
+        if (it->second == _goal_latency)
+          cost.goal = luci::PartitionCost::GOAL::LATENCY;
+        else if (it->second == _goal_throughput)
+          cost.goal = luci::PartitionCost::GOAL::THROUGHPUT;
+        else
+          throw std::invalid_argument("Invalid goal '" + it->second + "'");
+      }
+      it = items.find(_key_transfer);
+      if (it != items.end())
+        cost.transfer = parse_cost_value(it->first, it->second);
+      continue;
+    }
+
+    auto &ops = cost.ops[section.name];
+    for (auto &item : items)
+      ops[item.first] = parse_cost_value(item.first, item.second);
+  }
+
+  return cost;
+}
+
 } // namespace
 
 namespace partee
@@ -144,4 +225,17 @@ luci::PartitionTable read(const std::string &path)
   return partition_table;
 }
 
+luci::PartitionCost read_cost(const std::string &path)
+{
+  LOGGER(l);
+
+  INFO(l) << "PartitionCost: " << path << std::endl;
+
+  auto cost_config = crew::read_ini(path);
+
+  INFO(l) << cost_config << std::endl;
+
+  return parse_cost(cost_config);
+}
+
 } // namespace partee
@@ -19,6 +19,7 @@
 
 #include <luci/IR/Module.h>
 #include <luci/Partition.h>
+#include <luci/PartitionAuto.h>
 
 #include <string>
 #include <unordered_map>
@@ -32,6 +33,11 @@ namespace partee
  */
 luci::PartitionTable read(const std::string &path);
 
+/**
+ * @brief Reads and parse cost file and return PartitionCost for automatic partitioning
+ */
+luci::PartitionCost read_cost(const std::string &path);
+
 } // namespace partee
 
 #endif // __CIRCLE_PARTITION_READ_H__
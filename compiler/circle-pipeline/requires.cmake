@@ -0,0 +1,7 @@
+require("loco")
+require("safemain")
+require("luci")
+require("arser")
+require("vconone")
+require("circle2circle")
+require("record-minmax")
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <circle2circle/OptimizeOptions.h>
+#include <RecordMinMax.h>
+
+#include <luci/ImporterEx.h>
+#include <luci/CircleOptimizer.h>
+#include <luci/CircleQuantizer.h>
+#include <luci/Service/ChangeOutputs.h>
+#include <luci/Service/Validate.h>
+#include <luci/CircleExporter.h>
+#include <luci/CircleFileExpContract.h>
+#include <luci/UserSettings.h>
+
+#include <arser/arser.h>
+#include <vconone/vconone.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using QuantizeAlgorithms = luci::CircleQuantizer::Options::Algorithm;
+using QuantizeParameters = luci::CircleQuantizer::Options::AlgorithmParameters;
+
+namespace
+{
+
+void print_version(void)
+{
+  std::cout << "circle-pipeline version " << vconone::get_string() << std::endl;
+  std::cout << vconone::get_copyright() << std::endl;
+}
+
+void csv_tokenize(const std::string &data, std::vector<std::string> &result)
+{
+  const char delim = ',';
+  std::string token;
+  std::stringstream ss(data);
+
+  while (std::getline(ss, token, delim))
+    result.push_back(token);
+}
+
+// Quantize all graphs of module, like circle-quantizer does for its input model
+bool quantize(luci::CircleQuantizer &quantizer, luci::Module *module)
+{
+  for (size_t idx = 0; idx < module->size(); ++idx)
+  {
+    auto graph = module->graph(idx);
+
+    quantizer.quantize(graph);
+
+    if (!luci::validate(graph))
+    {
+      std::cerr << "ERROR: Quantized graph is invalid" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Record min/max of activations of module with the arguments of record-minmax
+std::unique_ptr<luci::Module> record_minmax(arser::Arser &arser,
+                                            std::unique_ptr<luci::Module> &&module,
+                                            uint32_t num_threads)
+{
+  // Default values of record-minmax
+  std::string mode("percentile");
+  float min_percentile = 1.0;
+  float max_percentile = 99.0;
+  std::string input_data_format("h5");
+  int32_t batch_size = 1;
+
+  if (arser["--min_percentile"])
+    min_percentile = arser.get<float>("--min_percentile");
+
+  if (arser["--max_percentile"])
+    max_percentile = arser.get<float>("--max_percentile");
+
+  if (arser["--mode"])
+    mode = arser.get<std::string>("--mode");
+
+  if (mode != "percentile" && mode != "moving_average" && mode != "mse")
+    throw std::runtime_error("Unsupported mode");
+
+  if (arser["--input_data_format"])
+    input_data_format = arser.get<std::string>("--input_data_format");
+
+  if (arser["--batch_size"])
+    batch_size = arser.get<int32_t>("--batch_size");
+
+  if (batch_size < 1)
+    throw std::runtime_error("Batch size must be positive");
+
+  record_minmax::RecordMinMax rmm;
+  rmm.initialize(std::move(module), static_cast<uint32_t>(batch_size), num_threads);
+
+  if (arser["--input_data"])
+  {
+    auto input_data_path = arser.get<std::string>("--input_data");
+
+    if (input_data_format == "h5" || input_data_format == "hdf5")
+      rmm.profileData(mode, input_data_path, min_percentile, max_percentile);
+    else if (input_data_format == "list" || input_data_format == "filelist")
+      rmm.profileRawData(mode, input_data_path, min_percentile, max_percentile);
+    else if (input_data_format == "directory" || input_data_format == "dir")
+      rmm.profileRawDataDirectory(mode, input_data_path, min_percentile, max_percentile);
+    else if (input_data_format == "minmax")
+      rmm.profileMinMaxRecords(mode, input_data_path, min_percentile, max_percentile);
+    else
+    {
+      throw std::runtime_error(
+        "Unsupported input data format (supported formats: h5/hdf5 (default), list/filelist, "
+        "directory/dir, minmax)");
+    }
+  }
+  else
+  {
+    rmm.profileDataWithRandomInputs(mode, min_percentile, max_percentile);
+  }
+
+  return rmm.releaseModule();
+}
+
+} // namespace
+
+int entry(int argc, char **argv)
+{
+  luci::CircleOptimizer optimizer;
+
+  auto settings = luci::UserSettings::settings();
+
+  const std::string qwmm = "--quantize_with_minmax";
+  const std::string tf_maxpool = "--TF-style_maxpool";
+
+  arser::Arser arser("circle-pipeline optimizes and quantizes circle model in a single process, "
+                     "which keeps the model in memory between the steps");
+
+  arser::Helper::add_version(arser, print_version);
+  arser::Helper::add_verbose(arser);
+
+  // optimization arguments, same as circle2circle
+  circle2circle::add_optimize_arguments(arser);
+
+  arser.add_argument("--change_outputs")
+    .help("Experimental: Change first subgraph output nodes to CSV names");
+
+  // quantization arguments, same as the ones of one-quantize passed to
+  // circle-quantizer and record-minmax
+  arser.add_argument(qwmm)
+    .nargs(3)
+    .type(arser::DataType::STR_VEC)
+    .help("Quantize optimized model with min/max values recorded while running input data. "
+          "Three arguments required: input_model_dtype(float32) "
+          "output_model_dtype(uint8) granularity(layer, channel)");
+
+  arser.add_argument(tf_maxpool)
+    .nargs(0)
+    .default_value(false)
+    .help("Force MaxPool Op to have the same input/output quantparams. NOTE: This feature can "
+          "degrade accuracy of some models");
+
+  arser.add_argument("--input_type")
+    .help("Input type of quantized model (uint8, int16, or float32)");
+
+  arser.add_argument("--output_type")
+    .help("Output type of quantized model (uint8, int16, or float32)");
+
+  arser.add_argument("--input_data")
+    .help("Input data filepath to record min/max. If not given, randomly generated data is used.");
+
+  arser.add_argument("--input_data_format")
+    .help("Input data format. h5/hdf5 (default), list/filelist, directory/dir or minmax");
+
+  arser.add_argument("--min_percentile")
+    .type(arser::DataType::FLOAT)
+    .help("Record n'th percentile of min");
+
+  arser.add_argument("--max_percentile")
+    .type(arser::DataType::FLOAT)
+    .help("Record n'th percentile of max");
+
+  arser.add_argument("--mode").help("Record mode. percentile (default), moving_average or mse");
+
+  arser.add_argument("--batch_size")
+    .type(arser::DataType::INT32)
+    .help("Run the model with this many samples at once to record min/max (default: 1)");
+
+  arser.add_argument("--num_threads")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .default_value(1)
+    .help("Number of threads importing, optimizing, recording and exporting a model "
+          "concurrently (default: 1)");
+
+  arser.add_argument("--buffer_alignment")
+    .nargs(1)
+    .type(arser::DataType::INT32)
+    .default_value(16)
+    .help("Align buffers of constants not smaller than this to this many bytes (default: 16)");
+
+  arser.add_argument("input").help("Input circle model");
+  arser.add_argument("output").help("Output circle model");
+
+  try
+  {
+    arser.parse(argc, argv);
+  }
+  catch (const std::runtime_error &err)
+  {
+    std::cerr << err.what() << std::endl;
+    std::cout << arser;
+    return 255;
+  }
+
+  if (arser.get<bool>("--verbose"))
+  {
+    // The third parameter of setenv means REPLACE.
+    // If REPLACE is zero, it does not overwrite an existing value.
+    setenv("LUCI_LOG", "100", 0);
+  }
+
+  if (!circle2circle::set_optimize_options(arser, optimizer))
+    return 255;
+
+  std::string input_path = arser.get<std::string>("input");
+  std::string output_path = arser.get<std::string>("output");
+
+  std::vector<std::string> new_outputs;
+  if (arser["--change_outputs"])
+    csv_tokenize(arser.get<std::string>("--change_outputs"), new_outputs);
+
+  std::vector<std::string> quantize_values;
+  if (arser[qwmm])
+  {
+    quantize_values = arser.get<std::vector<std::string>>(qwmm);
+    if (quantize_values.size() != 3)
+    {
+      std::cerr << arser;
+      return 255;
+    }
+  }
+
+  const auto num_threads = arser.get<int>("--num_threads");
+  if (num_threads < 1)
+  {
+    std::cerr << "ERROR: --num_threads should be positive" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const auto buffer_alignment = arser.get<int>("--buffer_alignment");
+  if (buffer_alignment < 16 || (buffer_alignment & (buffer_alignment - 1)) != 0)
+  {
+    std::cerr << "ERROR: --buffer_alignment should be a power of 2 not less than 16" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Import from input Circle file, which is the only import of the pipeline
+  luci::ImporterEx importerex;
+  importerex.num_threads(static_cast<uint32_t>(num_threads));
+  auto module = importerex.importVerifyModule(input_path);
+  if (module.get() == nullptr)
+    return EXIT_FAILURE;
+
+  if (!new_outputs.empty())
+    luci::change_outputs(module->graph(0), new_outputs);
+
+  // Optimize like circle2circle
+  optimizer.optimize(module.get());
+  optimizer.optimize_graphs(module.get(), static_cast<uint32_t>(num_threads));
+
+  for (size_t idx = 0; idx < module->size(); ++idx)
+  {
+    auto graph = module->graph(idx);
+
+    optimizer.sparsify(graph);
+
+    if (!luci::validate(graph))
+    {
+      if (settings->get(luci::UserSettings::Key::DisableValidation))
+        std::cerr << "WARNING: Optimized graph is invalid" << std::endl;
+      else
+      {
+        std::cerr << "ERROR: Optimized graph is invalid" << std::endl;
+        return 255;
+      }
+    }
+  }
+
+  // Quantize like one-quantize, which runs circle-quantizer, record-minmax and circle-quantizer
+  if (!quantize_values.empty())
+  {
+    {
+      luci::CircleQuantizer quantizer;
+      auto options = quantizer.options();
+      options->enable(QuantizeAlgorithms::QuantizeDequantizeWeights);
+      options->param(QuantizeParameters::Quantize_input_model_dtype, quantize_values.at(0));
+      options->param(QuantizeParameters::Quantize_output_model_dtype, quantize_values.at(1));
+      options->param(QuantizeParameters::Quantize_granularity, quantize_values.at(2));
+
+      if (!quantize(quantizer, module.get()))
+        return 255;
+    }
+
+    module = record_minmax(arser, std::move(module), static_cast<uint32_t>(num_threads));
+
+    {
+      luci::CircleQuantizer quantizer;
+      auto options = quantizer.options();
+      options->enable(QuantizeAlgorithms::QuantizeWithMinMax);
+      options->param(QuantizeParameters::Quantize_input_model_dtype, quantize_values.at(0));
+      options->param(QuantizeParameters::Quantize_output_model_dtype, quantize_values.at(1));
+      options->param(QuantizeParameters::Quantize_granularity, quantize_values.at(2));
+
+      if (arser["--input_type"])
+        options->param(QuantizeParameters::Quantize_input_type,
+                       arser.get<std::string>("--input_type"));
+
+      if (arser["--output_type"])
+        options->param(QuantizeParameters::Quantize_output_type,
+                       arser.get<std::string>("--output_type"));
+
+      if (arser[tf_maxpool] and arser.get<bool>(tf_maxpool))
+        options->param(QuantizeParameters::Quantize_TF_style_maxpool, "True");
+
+      if (!quantize(quantizer, module.get()))
+        return 255;
+    }
+  }
+
+  // Export to output Circle file, which is the only export of the pipeline
+  luci::CircleExporter exporter;
+  exporter.num_threads(static_cast<uint32_t>(num_threads));
+  exporter.buffer_alignment(static_cast<uint32_t>(buffer_alignment));
+
+  luci::CircleFileExpContract contract(module.get(), output_path);
+
+  if (!exporter.invoke(&contract))
+  {
+    std::cerr << "ERROR: Failed to export '" << output_path << "'" << std::endl;
+    return 255;
+  }
+
+  return 0;
+}
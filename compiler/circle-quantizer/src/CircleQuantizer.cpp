@@ -93,6 +93,7 @@ void print_exclusive_options(void)
 {
   std::cout << "Use only one of the 3 options below." << std::endl;
   std::cout << "    --quantize_dequantize_weights" << std::endl;
+  std::cout << "    --quantize_weights" << std::endl;
   std::cout << "    --quantize_with_minmax" << std::endl;
   std::cout << "    --requantize" << std::endl;
   std::cout << "    --force_quantparam" << std::endl;
@@ -115,6 +116,7 @@ int entry(int argc, char **argv)
 
   const std::string qdqw = "--quantize_dequantize_weights";
   const std::string qwmm = "--quantize_with_minmax";
+  const std::string qw = "--quantize_weights";
   const std::string rq = "--requantize";
   const std::string fq = "--force_quantparam";
   const std::string cq = "--copy_quantparam";
@@ -137,6 +139,13 @@ int entry(int argc, char **argv)
           "Three arguments required: input_model_dtype(float32) "
           "output_model_dtype(uint8) granularity(layer, channel)");
 
+  arser.add_argument(qw)
+    .nargs(3)
+    .type(arser::DataType::STR_VEC)
+    .help("Quantize weight values only, while activations are kept in float. "
+          "Three arguments required: input_model_dtype(float32) "
+          "output_model_dtype(int8) granularity(layer, channel)");
+
   arser.add_argument(qwmm)
     .nargs(3)
     .type(arser::DataType::STR_VEC)
@@ -204,8 +213,9 @@ int entry(int argc, char **argv)
   }
 
   {
-    // only one of qdqw, qwmm, rq, fq, cq, fake_quant option can be used
+    // only one of qdqw, qw, qwmm, rq, fq, cq, fake_quant option can be used
     int32_t opt_used = arser[qdqw] ? 1 : 0;
+    opt_used += arser[qw] ? 1 : 0;
     opt_used += arser[qwmm] ? 1 : 0;
     opt_used += arser[rq] ? 1 : 0;
     opt_used += arser[fq] ? 1 : 0;
@@ -256,6 +266,21 @@ int entry(int argc, char **argv)
     }
   }
 
+  if (arser[qw])
+  {
+    auto values = arser.get<std::vector<std::string>>(qw);
+    if (values.size() != 3)
+    {
+      std::cerr << arser;
+      return 255;
+    }
+    options->enable(Algorithms::QuantizeWeights);
+
+    options->param(AlgorithmParameters::Quantize_input_model_dtype, values.at(0));
+    options->param(AlgorithmParameters::Quantize_output_model_dtype, values.at(1));
+    options->param(AlgorithmParameters::Quantize_granularity, values.at(2));
+  }
+
   if (arser[qwmm])
   {
     auto values = arser.get<std::vector<std::string>>(qwmm);
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE2CIRCLE_OPTIMIZE_OPTIONS_H__
+#define __CIRCLE2CIRCLE_OPTIMIZE_OPTIONS_H__
+
+#include <luci/CircleOptimizer.h>
+#include <arser/arser.h>
+
+namespace circle2circle
+{
+
+/**
+ * @brief Add arguments of circle2circle which select luci optimizations and user settings
+ */
+void add_optimize_arguments(arser::Arser &arser);
+
+/**
+ * @brief Enable optimizations of optimizer and set user settings by parsed arguments, which were
+ *        added by add_optimize_arguments
+ * @return false if the arguments are invalid, after printing the reason
+ */
+bool set_optimize_options(arser::Arser &arser, luci::CircleOptimizer &optimizer);
+
+} // namespace circle2circle
+
+#endif // __CIRCLE2CIRCLE_OPTIMIZE_OPTIONS_H__
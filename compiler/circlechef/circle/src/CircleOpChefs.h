@@ -21,6 +21,8 @@
 #include "Op/BatchMatMul.h"
 #include "Op/BCQFullyConnected.h"
 #include "Op/BCQGather.h"
+#include "Op/Gelu.h"
 #include "Op/InstanceNorm.h"
+#include "Op/LayerNorm.h"
 
 #endif // __CIRCLE_OP_CHEFS_H__
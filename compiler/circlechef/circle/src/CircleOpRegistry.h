@@ -58,7 +58,9 @@ private:
     REG_TFL_OP(BATCH_MATMUL, CircleOpBatchMatMul);
     REG_TFL_OP(BCQ_FULLY_CONNECTED, CircleOpBCQFullyConnected);
     REG_TFL_OP(BCQ_GATHER, CircleOpBCQGather);
+    REG_TFL_OP(GELU, CircleOpGelu);
     REG_TFL_OP(INSTANCE_NORM, CircleOpInstanceNorm);
+    REG_TFL_OP(LAYER_NORM, CircleOpLayerNorm);
 #undef REG_TFL_OP
   }
 
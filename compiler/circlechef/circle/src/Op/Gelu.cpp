@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Gelu.h"
+
+#include "Convert.h"
+
+namespace circlechef
+{
+
+void CircleOpGelu::filler(const circle::Operator *op, CircleImport *import,
+                          circlechef::ModelRecipe *model_recipe) const
+{
+  // Nothing to do with filler
+}
+
+circlechef::Operation *CircleOpGelu::build(const circle::Operator *op, CircleImport *import,
+                                           circlechef::ModelRecipe *model_recipe) const
+{
+  auto operation = model_recipe->add_operation();
+
+  operation->set_type("Gelu");
+
+  auto op_options = operation->mutable_gelu_options();
+
+  auto op_params = op->builtin_options_as_GeluOptions();
+  assert(op_params != nullptr);
+
+  op_options->set_approximate(op_params->approximate());
+
+  return operation;
+}
+
+} // namespace circlechef
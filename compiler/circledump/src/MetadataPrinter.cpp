@@ -110,10 +110,79 @@ public:
   }
 };
 
+class TensorOffsetTablePrinter : public MetadataPrinter
+{
+public:
+  /**
+   *  tensor offset table consists of following parts
+   *  - [ entry_number : uint32_t ]
+   *  - [ tensor_id : uint32_t ][ offset : uint32_t ] * entry_number
+   */
+  virtual void print(const uint8_t *buffer, std::ostream &os) const override
+  {
+    if (buffer)
+    {
+      os << "    [tensor_id : offset]" << std::endl;
+      auto cur = buffer;
+      // entry number
+      const uint32_t num = *reinterpret_cast<const uint32_t *>(cur);
+      cur += sizeof(uint32_t);
+      for (uint32_t entry = 0; entry < num; entry++)
+      {
+        // tensor_id
+        const uint32_t tensor_id = *reinterpret_cast<const uint32_t *>(cur);
+        cur += sizeof(uint32_t);
+        // offset
+        const uint32_t offset = *reinterpret_cast<const uint32_t *>(cur);
+        cur += sizeof(uint32_t);
+
+        // print
+        os << "    [" << tensor_id << " : " << offset << "]" << std::endl;
+      }
+    }
+  }
+};
+
+class ExecutionOrderTablePrinter : public MetadataPrinter
+{
+public:
+  /**
+   *  execution order table consists of following parts
+   *  - [ entry_number : uint32_t ]
+   *  - [ operator_id : uint32_t ] * entry_number, in order of execution
+   */
+  virtual void print(const uint8_t *buffer, std::ostream &os) const override
+  {
+    if (buffer)
+    {
+      os << "    [operator_ids]" << std::endl;
+      auto cur = buffer;
+      // entry number
+      const uint32_t num = *reinterpret_cast<const uint32_t *>(cur);
+      cur += sizeof(uint32_t);
+      os << "    [";
+      for (uint32_t entry = 0; entry < num; entry++)
+      {
+        // operator_id
+        const uint32_t operator_id = *reinterpret_cast<const uint32_t *>(cur);
+        cur += sizeof(uint32_t);
+
+        // print
+        if (entry)
+          os << ", ";
+        os << operator_id;
+      }
+      os << "]" << std::endl;
+    }
+  }
+};
+
 MetadataPrinterRegistry::MetadataPrinterRegistry()
 {
   _metadata_map["ONE_source_table"] = std::make_unique<SourceTablePrinter>();
   _metadata_map["ONE_op_table"] = std::make_unique<OpTablePrinter>();
+  _metadata_map["ONE_tensor_offset_table"] = std::make_unique<TensorOffsetTablePrinter>();
+  _metadata_map["ONE_execution_order_table"] = std::make_unique<ExecutionOrderTablePrinter>();
 }
 
 } // namespace circledump
@@ -179,7 +179,9 @@ int entry(int argc, char **argv)
   }
 
   // load luci module
-  std::unique_ptr<luci::Module> module = luci::Importer().importModule(circle_model);
+  luci::Importer importer;
+  importer.skip_profile(true);
+  std::unique_ptr<luci::Module> module = importer.importModule(circle_model);
   luci_interpreter::Interpreter interpreter(module.get());
 
   /**
@@ -21,6 +21,7 @@
 
 #include <loco.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,17 +39,21 @@ namespace hdf5
 // data_idx : index of the data (dataset file can contain multiple data)
 // input_idx : index of the input (DNN model can have multiple inputs)
 // Ex: the j'th input of the i'th data of group 'value' can be accessed by "/value/i/j"
+//
+// NOTE HDF5 library is not thread-safe, so calls to the library from all importers are serialized.
+//      Importers can be used from several threads, but their reads are not done in parallel.
 class HDF5Importer final
 {
 public:
   explicit HDF5Importer(const std::string &path);
+  ~HDF5Importer();
 
 public:
   /**
    * @note importGroup has to be called before readTensor is called
    *        Otherwise, readTensor will throw an exception
    */
-  void importGroup(const std::string &group) { _group = _file.openGroup(group); }
+  void importGroup(const std::string &group);
 
   /**
    * @brief Read tensor data from file and store it into buffer
@@ -65,15 +70,26 @@ public:
   // Read a raw tensor (no type/shape is specified)
   void readTensor(int32_t data_idx, int32_t input_idx, void *buffer);
 
-  bool isRawData() { return _group.attrExists("rawData"); }
+  /**
+   * @brief Read tensor data from file into buffer, which is resized to the tensor's byte size
+   * @note  Capacity of buffer is kept, so it can be reused for other tensors without allocation.
+   *        dtype of raw data is Unknown and its byte size is the number of its elements.
+   */
+  void readTensor(int32_t data_idx, int32_t input_idx, loco::DataType *dtype,
+                  std::vector<loco::Dimension> *shape, std::vector<char> *buffer);
 
-  int32_t numData() { return _group.getNumObjs(); }
+  bool isRawData();
+
+  int32_t numData();
 
   int32_t numInputs(int32_t data_idx);
 
 private:
-  H5::H5File _file;
-  H5::Group _group;
+  H5::Group &group();
+
+private:
+  std::unique_ptr<H5::H5File> _file;
+  std::unique_ptr<H5::Group> _group;
 };
 
 } // namespace hdf5
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIO_HDF5_PREFETCHER_H__
+#define __DIO_HDF5_PREFETCHER_H__
+
+#include "HDF5Importer.h"
+
+#include <loco.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dio
+{
+namespace hdf5
+{
+
+// HDF5Prefetcher reads records [begin, end) of an imported group in order on a background thread,
+// so that reading of the next records overlaps with processing of the current one.
+//
+// How to use?
+//
+// HDF5Prefetcher prefetcher(importer, 0, importer.numData(), 4);
+// while (auto record = prefetcher.next())
+// {
+//   DO_SOMETHING_WITH(record->tensors);
+//   prefetcher.recycle(std::move(record)); // optional, reuses the buffers of the record
+// }
+class HDF5Prefetcher final
+{
+public:
+  struct Tensor
+  {
+    loco::DataType dtype = loco::DataType::Unknown;
+    std::vector<loco::Dimension> shape;
+    std::vector<char> buffer;
+  };
+
+  struct Record
+  {
+    int32_t index = 0;
+    std::vector<Tensor> tensors;
+  };
+
+public:
+  /**
+   * @param importer : importer whose group is imported, which must outlive the prefetcher
+   * @param num_inflight : maximum number of records read ahead of next()
+   */
+  HDF5Prefetcher(HDF5Importer &importer, int32_t begin, int32_t end, uint32_t num_inflight);
+  ~HDF5Prefetcher();
+
+  HDF5Prefetcher(const HDF5Prefetcher &) = delete;
+  HDF5Prefetcher &operator=(const HDF5Prefetcher &) = delete;
+
+public:
+  /**
+   * @brief Return the next record, waiting until it is read
+   * @return nullptr after the last record
+   * @note  An error of reading a record is rethrown when the record is reached
+   */
+  std::unique_ptr<Record> next();
+
+  // Give back a record whose buffers can be reused for reading later records
+  void recycle(std::unique_ptr<Record> &&record);
+
+private:
+  void run();
+
+private:
+  HDF5Importer &_importer;
+  const int32_t _begin;
+  const int32_t _end;
+  const uint32_t _num_inflight;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<std::unique_ptr<Record>> _ready;
+  std::vector<std::unique_ptr<Record>> _pool;
+  std::exception_ptr _error;
+  bool _done = false;
+  bool _stop = false;
+
+  std::thread _thread;
+};
+
+} // namespace hdf5
+} // namespace dio
+
+#endif // __DIO_HDF5_PREFETCHER_H__
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <mutex>
 #include <stdexcept>
 
 using Shape = std::vector<loco::Dimension>;
@@ -29,6 +30,14 @@ using DataType = loco::DataType;
 namespace
 {
 
+// Lock of HDF5 library, which is shared by all importers
+// NOTE It is recursive, as a locked method may call others
+std::recursive_mutex &h5_mutex()
+{
+  static std::recursive_mutex mutex;
+  return mutex;
+}
+
 Shape toInternalShape(const H5::DataSpace &dataspace)
 {
   int rank = dataspace.getSimpleExtentNdims();
@@ -107,6 +116,23 @@ void readTensorData(H5::DataSet &tensor, int64_t *buffer)
   tensor.read(buffer, H5::PredType::NATIVE_LONG);
 }
 
+uint32_t byteSize(DataType dtype)
+{
+  switch (dtype)
+  {
+    case DataType::FLOAT32:
+      return sizeof(float);
+    case DataType::S32:
+      return sizeof(int32_t);
+    case DataType::S64:
+      return sizeof(int64_t);
+    case DataType::BOOL:
+      return sizeof(uint8_t);
+    default:
+      throw std::runtime_error{"Unsupported data type for input data (.h5)"};
+  }
+}
+
 } // namespace
 
 namespace dio
@@ -116,21 +142,65 @@ namespace hdf5
 
 HDF5Importer::HDF5Importer(const std::string &path)
 {
-  if (_file.isHdf5(path) == false)
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  if (H5::H5File::isHdf5(path) == false)
     throw std::runtime_error("Given data file is not HDF5");
 
-  _file = H5::H5File(path, H5F_ACC_RDONLY);
+  _file = std::make_unique<H5::H5File>(path, H5F_ACC_RDONLY);
+}
+
+HDF5Importer::~HDF5Importer()
+{
+  // Objects are closed with the library locked
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  _group.reset();
+  _file.reset();
+}
+
+void HDF5Importer::importGroup(const std::string &group)
+{
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  _group = std::make_unique<H5::Group>(_file->openGroup(group));
+}
+
+H5::Group &HDF5Importer::group()
+{
+  if (_group == nullptr)
+    throw std::runtime_error("Group is not imported");
+
+  return *_group;
+}
+
+bool HDF5Importer::isRawData()
+{
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  return group().attrExists("rawData");
+}
+
+int32_t HDF5Importer::numData()
+{
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  return group().getNumObjs();
 }
 
 int32_t HDF5Importer::numInputs(int32_t record_idx)
 {
-  auto records = _group.openGroup(std::to_string(record_idx));
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  auto records = group().openGroup(std::to_string(record_idx));
   return records.getNumObjs();
 }
 
 void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, void *buffer)
 {
-  auto record = _group.openGroup(std::to_string(record_idx));
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  auto record = group().openGroup(std::to_string(record_idx));
   auto tensor = record.openDataSet(std::to_string(input_idx));
 
   readTensorData(tensor, static_cast<uint8_t *>(buffer));
@@ -139,7 +209,9 @@ void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, void *buffe
 void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, DataType *dtype, Shape *shape,
                               void *buffer)
 {
-  auto record = _group.openGroup(std::to_string(record_idx));
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  auto record = group().openGroup(std::to_string(record_idx));
   auto tensor = record.openDataSet(std::to_string(input_idx));
 
   auto tensor_dtype = tensor.getDataType();
@@ -167,5 +239,47 @@ void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, DataType *d
   }
 }
 
+void HDF5Importer::readTensor(int32_t record_idx, int32_t input_idx, DataType *dtype, Shape *shape,
+                              std::vector<char> *buffer)
+{
+  std::lock_guard<std::recursive_mutex> lock(h5_mutex());
+
+  auto record = group().openGroup(std::to_string(record_idx));
+  auto tensor = record.openDataSet(std::to_string(input_idx));
+
+  auto tensor_shape = tensor.getSpace();
+  *shape = toInternalShape(tensor_shape);
+  const auto num_elements = static_cast<size_t>(tensor_shape.getSimpleExtentNpoints());
+
+  if (isRawData())
+  {
+    *dtype = DataType::Unknown;
+    buffer->resize(num_elements);
+    readTensorData(tensor, reinterpret_cast<uint8_t *>(buffer->data()));
+    return;
+  }
+
+  *dtype = toInternalDtype(tensor.getDataType());
+  buffer->resize(num_elements * byteSize(*dtype));
+
+  switch (*dtype)
+  {
+    case DataType::FLOAT32:
+      readTensorData(tensor, reinterpret_cast<float *>(buffer->data()));
+      break;
+    case DataType::S32:
+      readTensorData(tensor, reinterpret_cast<int32_t *>(buffer->data()));
+      break;
+    case DataType::S64:
+      readTensorData(tensor, reinterpret_cast<int64_t *>(buffer->data()));
+      break;
+    case DataType::BOOL:
+      readTensorData(tensor, reinterpret_cast<uint8_t *>(buffer->data()));
+      break;
+    default:
+      throw std::runtime_error{"Unsupported data type for input data (.h5)"};
+  }
+}
+
 } // namespace hdf5
 } // namespace dio
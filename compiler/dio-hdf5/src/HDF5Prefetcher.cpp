@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dio_hdf5/HDF5Prefetcher.h"
+
+#include <stdexcept>
+
+namespace dio
+{
+namespace hdf5
+{
+
+HDF5Prefetcher::HDF5Prefetcher(HDF5Importer &importer, int32_t begin, int32_t end,
+                               uint32_t num_inflight)
+  : _importer(importer), _begin(begin), _end(end), _num_inflight(num_inflight)
+{
+  if (num_inflight == 0)
+    throw std::runtime_error("Number of records in flight must be positive");
+
+  _thread = std::thread(&HDF5Prefetcher::run, this);
+}
+
+HDF5Prefetcher::~HDF5Prefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_all();
+  _thread.join();
+}
+
+std::unique_ptr<HDF5Prefetcher::Record> HDF5Prefetcher::next()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _cv.wait(lock, [this] { return not _ready.empty() or _done; });
+
+  if (_ready.empty())
+  {
+    if (_error)
+      std::rethrow_exception(_error);
+    return nullptr;
+  }
+
+  auto record = std::move(_ready.front());
+  _ready.pop_front();
+  lock.unlock();
+
+  _cv.notify_all();
+  return record;
+}
+
+void HDF5Prefetcher::recycle(std::unique_ptr<Record> &&record)
+{
+  if (record == nullptr)
+    return;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _pool.emplace_back(std::move(record));
+}
+
+void HDF5Prefetcher::run()
+{
+  try
+  {
+    for (int32_t record_idx = _begin; record_idx < _end; ++record_idx)
+    {
+      std::unique_ptr<Record> record;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _ready.size() < _num_inflight or _stop; });
+        if (_stop)
+          break;
+
+        if (not _pool.empty())
+        {
+          record = std::move(_pool.back());
+          _pool.pop_back();
+        }
+      }
+      if (record == nullptr)
+        record = std::make_unique<Record>();
+
+      // Reads are out of the lock, so that next() is not blocked by them
+      record->index = record_idx;
+      record->tensors.resize(_importer.numInputs(record_idx));
+      for (int32_t input_idx = 0; input_idx < static_cast<int32_t>(record->tensors.size());
+           ++input_idx)
+      {
+        auto &tensor = record->tensors.at(input_idx);
+        _importer.readTensor(record_idx, input_idx, &tensor.dtype, &tensor.shape, &tensor.buffer);
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _ready.emplace_back(std::move(record));
+      }
+      _cv.notify_all();
+    }
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _error = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _done = true;
+  }
+  _cv.notify_all();
+}
+
+} // namespace hdf5
+} // namespace dio
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dio_hdf5/HDF5Prefetcher.h"
+
+#include <loco.h>
+
+#include <H5Cpp.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+using HDF5Importer = dio::hdf5::HDF5Importer;
+using HDF5Prefetcher = dio::hdf5::HDF5Prefetcher;
+using DataType = loco::DataType;
+
+namespace
+{
+
+const std::string file_name("dio_hdf5_prefetcher_test.h5");
+const int32_t num_records = 5;
+
+// Record i has two inputs, float [2, 3] filled with i and int32 [1] of i
+void createFile()
+{
+  // File already exists. Remove it.
+  if (auto f = fopen(file_name.c_str(), "r"))
+  {
+    fclose(f);
+    if (remove(file_name.c_str()) != 0)
+      throw std::runtime_error("Error deleting file.");
+  }
+
+  hsize_t float_dim[2] = {2, 3};
+  H5::DataSpace float_space(2, float_dim);
+  hsize_t int_dim[1] = {1};
+  H5::DataSpace int_space(1, int_dim);
+
+  // Create test file in the current directory
+  H5::H5File file(file_name, H5F_ACC_TRUNC);
+  file.createGroup("/value");
+  for (int32_t i = 0; i < num_records; ++i)
+  {
+    const std::string record = "/value/" + std::to_string(i);
+    file.createGroup(record);
+
+    float float_data[6];
+    for (auto &value : float_data)
+      value = static_cast<float>(i);
+    H5::DataSet float_dataset(
+      file.createDataSet(record + "/0", H5::PredType::IEEE_F32LE, float_space));
+    float_dataset.write(float_data, H5::PredType::NATIVE_FLOAT);
+
+    int32_t int_data[1] = {i};
+    H5::DataSet int_dataset(file.createDataSet(record + "/1", H5::PredType::STD_I32LE, int_space));
+    int_dataset.write(int_data, H5::PredType::NATIVE_INT);
+  }
+}
+
+} // namespace
+
+TEST(dio_hdf5_prefetcher_test, read_in_order)
+{
+  createFile();
+
+  HDF5Importer h5(::file_name);
+  h5.importGroup("value");
+
+  HDF5Prefetcher prefetcher(h5, 1, num_records, 2);
+
+  int32_t expected = 1;
+  while (auto record = prefetcher.next())
+  {
+    EXPECT_EQ(expected, record->index);
+    ASSERT_EQ(2, record->tensors.size());
+
+    const auto &first = record->tensors.at(0);
+    EXPECT_EQ(DataType::FLOAT32, first.dtype);
+    ASSERT_EQ(2, first.shape.size());
+    EXPECT_EQ(2, first.shape[0]);
+    EXPECT_EQ(3, first.shape[1]);
+    ASSERT_EQ(6 * sizeof(float), first.buffer.size());
+    float value = 0;
+    std::memcpy(&value, first.buffer.data() + 5 * sizeof(float), sizeof(float));
+    EXPECT_EQ(static_cast<float>(expected), value);
+
+    const auto &second = record->tensors.at(1);
+    EXPECT_EQ(DataType::S32, second.dtype);
+    ASSERT_EQ(sizeof(int32_t), second.buffer.size());
+    int32_t index = 0;
+    std::memcpy(&index, second.buffer.data(), sizeof(int32_t));
+    EXPECT_EQ(expected, index);
+
+    prefetcher.recycle(std::move(record));
+    expected++;
+  }
+  EXPECT_EQ(num_records, expected);
+
+  // Prefetcher stays at the end
+  EXPECT_EQ(nullptr, prefetcher.next());
+}
+
+TEST(dio_hdf5_prefetcher_test, stop_early)
+{
+  createFile();
+
+  HDF5Importer h5(::file_name);
+  h5.importGroup("value");
+
+  // Destruction stops the background thread waiting for records to be consumed
+  HDF5Prefetcher prefetcher(h5, 0, num_records, 1);
+  auto record = prefetcher.next();
+  ASSERT_NE(nullptr, record);
+  EXPECT_EQ(0, record->index);
+}
+
+TEST(dio_hdf5_prefetcher_test, zero_inflight_NEG)
+{
+  createFile();
+
+  HDF5Importer h5(::file_name);
+  h5.importGroup("value");
+
+  EXPECT_ANY_THROW(HDF5Prefetcher(h5, 0, num_records, 0));
+}
+
+TEST(dio_hdf5_prefetcher_test, data_out_of_index_NEG)
+{
+  createFile();
+
+  HDF5Importer h5(::file_name);
+  h5.importGroup("value");
+
+  // Records after the last one do not exist
+  HDF5Prefetcher prefetcher(h5, num_records - 1, num_records + 1, 2);
+  auto record = prefetcher.next();
+  ASSERT_NE(nullptr, record);
+  EXPECT_EQ(num_records - 1, record->index);
+  EXPECT_ANY_THROW(prefetcher.next());
+}
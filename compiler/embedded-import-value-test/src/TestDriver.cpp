@@ -209,7 +209,9 @@ int entry(int argc, char **argv)
   std::vector<std::vector<uint8_t>> outputs_data_2;
   {
     const auto optimized_source = luci_interpreter::source_without_constant_copying();
-    const auto module = luci::Importer(optimized_source.get()).importModule(circle_model);
+    luci::Importer importer(optimized_source.get());
+    importer.skip_profile(true);
+    const auto module = importer.importModule(circle_model);
     if (not module)
     {
       std::cerr << "Fail to import model without constant copying." << std::endl;
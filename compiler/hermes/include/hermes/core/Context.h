@@ -23,6 +23,7 @@
 #include "hermes/core/MessageBus.h"
 
 #include <memory>
+#include <mutex>
 #include <set>
 
 namespace hermes
@@ -33,8 +34,8 @@ namespace hermes
  *
  * This "Context" serves as a controller for associated logging source/sink.
  *
- * WARNING This "Context" is not yet thread-safe.
- * TODO Support multi-threaded application logging
+ * NOTE Registration of sources/sinks and posting messages are serialized, so sources in
+ *      different threads may share a "Context".
  */
 class Context final : private MessageBus, private Source::Registry, private Sink::Registry
 {
@@ -68,6 +69,7 @@ private:
   void append(std::unique_ptr<Sink> &&sink) override;
 
 private:
+  std::mutex _mutex;
   std::unique_ptr<Config> _config;
   std::set<Source *> _sources;
   std::set<std::unique_ptr<Sink>> _sinks;
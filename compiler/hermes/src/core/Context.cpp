@@ -29,6 +29,8 @@ const Config *Context::config(void) const
 
 void Context::config(std::unique_ptr<Config> &&config)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   _config = std::move(config);
 
   // Apply updated configurations
@@ -48,6 +50,7 @@ void Context::post(std::unique_ptr<Message> &&msg)
   auto m = std::move(msg);
 
   // Notify appended sinks
+  std::lock_guard<std::mutex> lock{_mutex};
   for (const auto &sink : _sinks)
   {
     sink->notify(m.get());
@@ -58,6 +61,8 @@ void Context::post(std::unique_ptr<Message> &&msg)
 
 void Context::attach(Source *source)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   // Configure source first
   source->reload(config());
   // Insert source
@@ -66,12 +71,16 @@ void Context::attach(Source *source)
 
 void Context::detach(Source *source)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   // Remove source
   _sources.erase(source);
 }
 
 void Context::append(std::unique_ptr<Sink> &&sink)
 {
+  std::lock_guard<std::mutex> lock{_mutex};
+
   // Append sink
   _sinks.insert(std::move(sink));
 }
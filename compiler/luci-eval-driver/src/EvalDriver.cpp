@@ -79,7 +79,9 @@ int entry(int argc, char **argv)
   const char *output_file = argv[4];
 
   // Load model from the file
+  // The model is only executed, so profile information tracing nodes back to it is not needed
   luci::ImporterEx importer;
+  importer.skip_profile(true);
   std::unique_ptr<luci::Module> module = importer.importVerifyModule(filename);
   if (module == nullptr)
   {
@@ -60,16 +60,32 @@ public:
 
   void readOutputTensor(const luci::CircleOutput *output_node, void *data, size_t data_size);
 
+  void writeInputTensorByIndex(uint32_t input_index, const void *data, size_t data_size);
+
+  void readOutputTensorByIndex(uint32_t output_index, void *data, size_t data_size);
+
   void interpret();
 
   void attachObserver(ExecutionObserver *observer);
 
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
 
+  /**
+   * @brief Stop referring the module, so that it can be destroyed while the interpreter is used
+   *
+   * @note  Constants kept in the module are copied; constants referring the model, e.g. in flash,
+   *        keep referring it. Observers cannot be attached, since they need nodes of the module.
+   *        Inputs and outputs are accessed by index afterwards.
+   */
+  void detachModule();
+
 private:
   // _default_memory_manager should be before _runtime_module due to
   // the order of deletion in the destructor
   std::unique_ptr<IMemoryManager> _default_memory_manager = nullptr;
+  // Data of constants which is kept by the interpreter after the module is detached
+  std::vector<std::unique_ptr<uint8_t[]>> _constant_buffers;
+  std::vector<std::shared_ptr<const void>> _constant_sources;
   std::unique_ptr<class RuntimeModule> _runtime_module;
 
   // Observer functionality support.
@@ -77,6 +93,7 @@ private:
   std::unordered_map<const loco::Node *, Tensor *> _node_to_tensor;
   std::unique_ptr<class EventNotifier> _event_notifier;
   std::vector<ExecutionObserver *> _observers;
+  bool _module_detached = false;
 };
 
 } // namespace luci_interpreter
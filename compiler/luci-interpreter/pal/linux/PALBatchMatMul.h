@@ -29,6 +29,15 @@ inline void BatchMatMul(const tflite::RuntimeShape &lhs_shape, const float *lhs_
                                      output_data);
 }
 
+inline void BatchMatMul(const tflite::FullyConnectedParams &params,
+                        const tflite::RuntimeShape &lhs_shape, const int8_t *lhs_data,
+                        const tflite::RuntimeShape &rhs_shape, const int8_t *rhs_data,
+                        const tflite::RuntimeShape &output_shape, int8_t *output_data)
+{
+  tflite::reference_ops::BatchMatMul<int8_t, int32_t>(params, lhs_shape, lhs_data, rhs_shape,
+                                                      rhs_data, output_shape, output_data);
+}
+
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *lhs_scratchpad,
                                          luci_interpreter::Tensor *rhs_scratchpad,
                                          const tflite::RuntimeShape &lhs_shape,
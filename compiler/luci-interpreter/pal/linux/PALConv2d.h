@@ -20,16 +20,17 @@
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/conv.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
-static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
-                        const float *input_data, const tflite::RuntimeShape &filter_shape,
-                        const float *filter_data, const tflite::RuntimeShape &bias_shape,
-                        const float *bias_data, const tflite::RuntimeShape &output_shape,
-                        float *output_data, const tflite::RuntimeShape &scratchpad_shape,
-                        float *scratchpad_data)
+static inline void ConvSerial(const tflite::ConvParams &params,
+                              const tflite::RuntimeShape &input_shape, const float *input_data,
+                              const tflite::RuntimeShape &filter_shape, const float *filter_data,
+                              const tflite::RuntimeShape &bias_shape, const float *bias_data,
+                              const tflite::RuntimeShape &output_shape, float *output_data,
+                              float *scratchpad_data)
 {
-  (void)scratchpad_shape;
   if (scratchpad_data)
   {
     const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
@@ -51,6 +52,52 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                                 tflite::RuntimeShape(), nullptr);
 }
 
+static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
+                        const float *input_data, const tflite::RuntimeShape &filter_shape,
+                        const float *filter_data, const tflite::RuntimeShape &bias_shape,
+                        const float *bias_data, const tflite::RuntimeShape &output_shape,
+                        float *output_data, const tflite::RuntimeShape &scratchpad_shape,
+                        float *scratchpad_data)
+{
+  (void)scratchpad_shape;
+  std::vector<ConvRowSlice> slices;
+  if (!splitConvRows(input_shape, output_shape, filter_shape.Dims(1), params.stride_height,
+                     params.dilation_height_factor, params.padding_values.height, slices))
+  {
+    ConvSerial(params, input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
+               output_shape, output_data, scratchpad_data);
+    return;
+  }
+
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_row_size = input_shape.Dims(2) * input_shape.Dims(3);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+  // im2col buffer has one row of patches per output pixel
+  const int32_t im2col_row_size =
+    output_shape.Dims(2) * filter_shape.Dims(1) * filter_shape.Dims(2) * input_shape.Dims(3);
+
+  ThreadPool::instance().parallelFor(static_cast<int32_t>(slices.size()), [&](int32_t index) {
+    const ConvRowSlice &slice = slices[index];
+    tflite::ConvParams slice_params = params;
+    slice_params.padding_values.height = slice.padding_height;
+
+    const tflite::RuntimeShape slice_input_shape{1, slice.in_end - slice.in_begin,
+                                                 input_shape.Dims(2), input_shape.Dims(3)};
+    const tflite::RuntimeShape slice_output_shape{1, slice.out_end - slice.out_begin,
+                                                  output_shape.Dims(2), output_shape.Dims(3)};
+    const int32_t out_row = slice.batch * output_height + slice.out_begin;
+    const float *slice_input =
+      input_data + (int64_t(slice.batch) * input_height + slice.in_begin) * input_row_size;
+    float *slice_output = output_data + int64_t(out_row) * output_row_size;
+    float *slice_scratchpad =
+      scratchpad_data ? scratchpad_data + int64_t(out_row) * im2col_row_size : nullptr;
+
+    ConvSerial(slice_params, slice_input_shape, slice_input, filter_shape, filter_data, bias_shape,
+               bias_data, slice_output_shape, slice_output, slice_scratchpad);
+  });
+}
+
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
                         const uint8 *input_data, const tflite::RuntimeShape &filter_shape,
                         const uint8 *filter_data, const tflite::RuntimeShape &bias_shape,
@@ -21,8 +21,51 @@
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+static inline void DepthwiseConv(const tflite::DepthwiseParams &params,
+                                 const tflite::RuntimeShape &input_shape, const float *input_data,
+                                 const tflite::RuntimeShape &filter_shape, const float *filter_data,
+                                 const tflite::RuntimeShape &bias_shape, const float *bias_data,
+                                 const tflite::RuntimeShape &output_shape, float *output_data)
+{
+  std::vector<ConvRowSlice> slices;
+  if (!splitConvRows(input_shape, output_shape, filter_shape.Dims(1), params.stride_height,
+                     params.dilation_height_factor, params.padding_values.height, slices))
+  {
+    tflite::reference_ops::DepthwiseConv(params, input_shape, input_data, filter_shape,
+                                         filter_data, bias_shape, bias_data, output_shape,
+                                         output_data);
+    return;
+  }
+
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_row_size = input_shape.Dims(2) * input_shape.Dims(3);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t output_row_size = output_shape.Dims(2) * output_shape.Dims(3);
+
+  ThreadPool::instance().parallelFor(static_cast<int32_t>(slices.size()), [&](int32_t index) {
+    const ConvRowSlice &slice = slices[index];
+    tflite::DepthwiseParams slice_params = params;
+    slice_params.padding_values.height = slice.padding_height;
+
+    const tflite::RuntimeShape slice_input_shape{1, slice.in_end - slice.in_begin,
+                                                 input_shape.Dims(2), input_shape.Dims(3)};
+    const tflite::RuntimeShape slice_output_shape{1, slice.out_end - slice.out_begin,
+                                                  output_shape.Dims(2), output_shape.Dims(3)};
+    const float *slice_input =
+      input_data + (int64_t(slice.batch) * input_height + slice.in_begin) * input_row_size;
+    float *slice_output =
+      output_data + (int64_t(slice.batch) * output_height + slice.out_begin) * output_row_size;
+
+    tflite::reference_ops::DepthwiseConv(slice_params, slice_input_shape, slice_input,
+                                         filter_shape, filter_data, bias_shape, bias_data,
+                                         slice_output_shape, slice_output);
+  });
+}
+
 template <typename T>
 static inline void
 DepthwiseConvPerChannel(const tflite::DepthwiseParams &params, const int32_t *output_multiplier,
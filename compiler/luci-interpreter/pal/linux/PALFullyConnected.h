@@ -20,8 +20,43 @@
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+static inline void FullyConnected(const tflite::FullyConnectedParams &params,
+                                  const tflite::RuntimeShape &input_shape, const float *input_data,
+                                  const tflite::RuntimeShape &filter_shape,
+                                  const float *filter_data, const tflite::RuntimeShape &bias_shape,
+                                  const float *bias_data, const tflite::RuntimeShape &output_shape,
+                                  float *output_data)
+{
+  const int32_t output_depth = output_shape.Dims(output_shape.DimensionsCount() - 1);
+  const int32_t accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+  const int32_t batches = output_depth > 0 ? output_shape.FlatSize() / output_depth : 0;
+
+  const int32_t num_threads = ThreadPool::instance().numThreads();
+  const int32_t max_tasks = output_shape.FlatSize() / kMinOutputElementsPerTask;
+  const int32_t num_tasks = std::min({num_threads, max_tasks, batches});
+  if (num_tasks <= 1)
+  {
+    tflite::reference_ops::FullyConnected(params, input_shape, input_data, filter_shape,
+                                          filter_data, bias_shape, bias_data, output_shape,
+                                          output_data);
+    return;
+  }
+
+  // Rows of input and output are independent
+  ThreadPool::instance().parallelFor(num_tasks, [&](int32_t index) {
+    const int32_t begin = static_cast<int32_t>(int64_t(batches) * index / num_tasks);
+    const int32_t end = static_cast<int32_t>(int64_t(batches) * (index + 1) / num_tasks);
+    tflite::reference_ops::FullyConnected(
+      params, tflite::RuntimeShape{end - begin, accum_depth},
+      input_data + int64_t(begin) * accum_depth, filter_shape, filter_data, bias_shape, bias_data,
+      tflite::RuntimeShape{end - begin, output_depth}, output_data + int64_t(begin) * output_depth);
+  });
+}
+
 template <typename T>
 static inline void FullyConnected(const tflite::FullyConnectedParams &params,
                                   const tflite::RuntimeShape &input_shape, const T *input_data,
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_THREADPOOL_H
+#define LUCI_INTERPRETER_PAL_THREADPOOL_H
+
+#include <tensorflow/lite/kernels/internal/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace luci_interpreter_pal
+{
+
+/**
+ * @brief Thread pool for intra-op parallelism of heavy kernels
+ *
+ * @note  Number of threads is read from LUCI_INTERPRETER_NUM_THREADS environment variable. Kernels
+ *        run in the calling thread only when it is not set or is not greater than 1.
+ *        The pool is shared by all interpreters in the process and may be used from several
+ *        threads at once.
+ */
+class ThreadPool
+{
+public:
+  static ThreadPool &instance()
+  {
+    static ThreadPool pool(numThreadsFromEnv());
+    return pool;
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_all();
+    for (auto &worker : _workers)
+      worker.join();
+  }
+
+  int32_t numThreads() const { return static_cast<int32_t>(_workers.size()) + 1; }
+
+  /**
+   * @brief Run task(0) ... task(num_tasks - 1) and return when all of them are done
+   *
+   * @note  Calling thread runs tasks too, so nested calls do not dead-lock.
+   */
+  void parallelFor(int32_t num_tasks, const std::function<void(int32_t)> &task)
+  {
+    if (_workers.empty() || num_tasks <= 1)
+    {
+      for (int32_t i = 0; i < num_tasks; ++i)
+        task(i);
+      return;
+    }
+
+    auto job = std::make_shared<Job>(num_tasks, task);
+    const int32_t num_helpers = std::min(num_tasks, numThreads()) - 1;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (int32_t i = 0; i < num_helpers; ++i)
+        _queue.push_back(job);
+    }
+    _cv.notify_all();
+
+    job->run();
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->done_cv.wait(lock, [&job]() { return job->num_done == job->num_tasks; });
+  }
+
+private:
+  struct Job
+  {
+    Job(int32_t tasks, const std::function<void(int32_t)> &fn) : num_tasks(tasks), task(fn) {}
+
+    void run()
+    {
+      for (int32_t i = next.fetch_add(1); i < num_tasks; i = next.fetch_add(1))
+      {
+        task(i);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (++num_done == num_tasks)
+          done_cv.notify_all();
+      }
+    }
+
+    const int32_t num_tasks;
+    // Task is called only before parallelFor returns, so it may refer to the caller's stack
+    const std::function<void(int32_t)> task;
+    std::atomic<int32_t> next{0};
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    int32_t num_done = 0;
+  };
+
+  explicit ThreadPool(int32_t num_threads)
+  {
+    for (int32_t i = 1; i < num_threads; ++i)
+      _workers.emplace_back([this]() { workerLoop(); });
+  }
+
+  static int32_t numThreadsFromEnv()
+  {
+    const char *value = std::getenv("LUCI_INTERPRETER_NUM_THREADS");
+    if (value == nullptr)
+      return 1;
+    const int32_t num_threads = std::atoi(value);
+    const auto hw_threads = static_cast<int32_t>(std::thread::hardware_concurrency());
+    return std::max(1, hw_threads > 0 ? std::min(num_threads, hw_threads) : num_threads);
+  }
+
+  void workerLoop()
+  {
+    while (true)
+    {
+      std::shared_ptr<Job> job;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this]() { return _stop || !_queue.empty(); });
+        if (_stop)
+          return;
+        job = _queue.front();
+        _queue.pop_front();
+      }
+      job->run();
+    }
+  }
+
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<std::shared_ptr<Job>> _queue;
+  bool _stop = false;
+};
+
+// Rows of NHWC output are split between threads only if there is enough work for each of them
+constexpr int32_t kMinOutputElementsPerTask = 4096;
+
+/**
+ * @brief Part of a convolution-like operation which computes output rows [out_begin, out_end) of
+ *        one batch from input rows [in_begin, in_end)
+ */
+struct ConvRowSlice
+{
+  int32_t batch;
+  int32_t out_begin;
+  int32_t out_end;
+  int32_t in_begin;
+  int32_t in_end;
+  // Padding of the slice on top of its input rows
+  int32_t padding_height;
+};
+
+/**
+ * @brief Split NHWC convolution-like operation by batches and output rows
+ *
+ * @return false if the operation is to be computed by the calling thread as a whole
+ */
+inline bool splitConvRows(const tflite::RuntimeShape &input_shape,
+                          const tflite::RuntimeShape &output_shape, int32_t filter_height,
+                          int32_t stride_height, int32_t dilation_height, int32_t padding_height,
+                          std::vector<ConvRowSlice> &slices)
+{
+  const int32_t num_threads = ThreadPool::instance().numThreads();
+  if (num_threads <= 1 || output_shape.FlatSize() < 2 * kMinOutputElementsPerTask)
+    return false;
+
+  const int32_t batches = output_shape.Dims(0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t row_size = output_shape.Dims(2) * output_shape.Dims(3);
+
+  const int32_t max_tasks = output_shape.FlatSize() / kMinOutputElementsPerTask;
+  const int32_t num_tasks = std::min(max_tasks, num_threads);
+  const int32_t chunks = std::min(output_height, std::max(1, (num_tasks + batches - 1) / batches));
+  if (batches * chunks <= 1 || row_size == 0)
+    return false;
+
+  slices.clear();
+  for (int32_t b = 0; b < batches; ++b)
+  {
+    for (int32_t c = 0; c < chunks; ++c)
+    {
+      ConvRowSlice slice{};
+      slice.batch = b;
+      slice.out_begin = static_cast<int32_t>(int64_t(output_height) * c / chunks);
+      slice.out_end = static_cast<int32_t>(int64_t(output_height) * (c + 1) / chunks);
+      const int32_t in_begin = slice.out_begin * stride_height - padding_height;
+      const int32_t in_end = (slice.out_end - 1) * stride_height - padding_height +
+                             (filter_height - 1) * dilation_height + 1;
+      slice.in_begin = std::max(0, in_begin);
+      slice.in_end = std::min(input_height, in_end);
+      // Rows which are entirely in the padding are left to the serial path
+      if (slice.in_begin >= slice.in_end)
+        return false;
+      slice.padding_height = slice.in_begin - in_begin;
+      slices.push_back(slice);
+    }
+  }
+  return true;
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_THREADPOOL_H
@@ -19,6 +19,9 @@
 
 #include "loader/ModuleLoader.h"
 
+#include <luci/IR/Nodes/CircleConst.h>
+
+#include <cstring>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -81,6 +84,9 @@ Interpreter::Interpreter(const luci::Module *module)
   ModuleLoader loader(module, _runtime_module.get(), *_runtime_to_ir, _node_to_tensor,
                       _default_memory_manager.get());
   loader.load();
+
+  // Intermediate tensors are placed in an arena instead of being allocated on every run
+  _runtime_module->enableArenaAllocation();
 }
 
 Interpreter::Interpreter(const luci::Module *module,
@@ -125,10 +131,65 @@ void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *
     tensor->readData(data, data_size);
 }
 
+void Interpreter::writeInputTensorByIndex(uint32_t input_index, const void *data,
+                                          size_t data_size)
+{
+  const auto &input_tensors = _runtime_module->getInputTensors();
+  if (input_index >= input_tensors.size())
+    throw std::runtime_error("Cannot find tensor for input " + std::to_string(input_index) + ".");
+  if (data != nullptr)
+    input_tensors[input_index]->writeData(data, data_size);
+}
+
+void Interpreter::readOutputTensorByIndex(uint32_t output_index, void *data, size_t data_size)
+{
+  const auto &output_tensors = _runtime_module->getOutputTensors();
+  if (output_index >= output_tensors.size())
+    throw std::runtime_error("Cannot find tensor for output " + std::to_string(output_index) +
+                             ".");
+  if (data != nullptr)
+    output_tensors[output_index]->readData(data, data_size);
+}
+
 void Interpreter::interpret() { _runtime_module->execute(); }
 
+void Interpreter::detachModule()
+{
+  if (!_observers.empty())
+    throw std::runtime_error("Cannot detach module with attached observers.");
+
+  for (const auto &item : _runtime_to_ir->tensor_to_node)
+  {
+    const auto *const_node = dynamic_cast<const luci::CircleConst *>(item.second);
+    auto tensor = const_cast<Tensor *>(item.first);
+    if (const_node == nullptr || tensor->is_allocatable() || !tensor->is_data_allocated())
+      continue;
+
+    if (const_node->viewed())
+    {
+      // Data is not in the module, but in the buffer kept by the source
+      _constant_sources.push_back(const_node->view_source());
+      continue;
+    }
+
+    const size_t data_size =
+      getDataTypeSize(tensor->element_type()) * tensor->shape().num_elements();
+    auto buffer = std::make_unique<uint8_t[]>(data_size);
+    std::memcpy(buffer.get(), tensor->data<uint8_t>(), data_size);
+    tensor->set_data_buffer(buffer.get());
+    _constant_buffers.push_back(std::move(buffer));
+  }
+
+  _runtime_to_ir->tensor_to_node.clear();
+  _runtime_to_ir->kernel_to_node.clear();
+  _node_to_tensor.clear();
+  _module_detached = true;
+}
+
 void Interpreter::attachObserver(ExecutionObserver *observer)
 {
+  if (_module_detached)
+    throw std::runtime_error("Cannot attach observer after module is detached.");
   if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
     throw std::runtime_error("Observer is already attached.");
   _observers.push_back(observer);
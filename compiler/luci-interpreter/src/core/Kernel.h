@@ -47,10 +47,18 @@ public:
   // Executes the kernel.
   virtual void execute() const = 0;
 
+  // In-place kernel may write its first output to the memory of its first input, which is done
+  // if the input is not used by later kernels. Set by the loader for kernels which support it.
+  bool isInplace() const { return _inplace; }
+  void setInplace(bool inplace) { _inplace = inplace; }
+
 protected:
   // NOTE Prefer not to use these in derived classes.
   const std::vector<const Tensor *> _inputs;
   const std::vector<Tensor *> _outputs;
+
+private:
+  bool _inplace = false;
 };
 
 // Base class for kernels with parameters.
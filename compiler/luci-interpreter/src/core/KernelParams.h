@@ -98,6 +98,11 @@ struct GatherParams
   int32_t batch_dims;
 };
 
+struct GeluParams
+{
+  bool approximate;
+};
+
 struct InstanceNormParams
 {
   float epsilon;
@@ -109,6 +114,11 @@ struct L2NormParams
   Activation activation;
 };
 
+struct LayerNormParams
+{
+  float epsilon;
+};
+
 struct LeakyReluParams
 {
   float alpha;
@@ -20,26 +20,91 @@
 
 #include <algorithm>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace luci_interpreter
 {
 
 class RuntimeGraph::TensorAllocPlan
 {
+  // Place of a tensor in the arena, valid while the tensor is not bigger than `size`
+  struct ArenaSlot
+  {
+    size_t first = 0;
+    size_t last = 0;
+    size_t size = 0;
+    size_t offset = 0;
+    bool in_arena = false;
+  };
+
+  // First input and output of an in-place kernel, sharing one buffer if `shared`
+  struct InplacePair
+  {
+    Tensor *input = nullptr;
+    Tensor *output = nullptr;
+    bool shared = false;
+  };
+
   std::vector<std::vector<Tensor *>> _alloc_plan;
   std::vector<std::vector<Tensor *>> _dealloc_plan;
   bool _valid = false;
   IMemoryManager *_memory_manager;
 
+  bool _arena_enabled = false;
+  // Set when a tensor did not fit in its slot and offsets are to be computed again
+  bool _arena_dirty = false;
+  std::unique_ptr<uint8_t[]> _arena;
+  std::unordered_map<Tensor *, ArenaSlot> _arena_slots;
+
+  // Per kernel index, empty if the kernel is not executed in place
+  std::vector<InplacePair> _inplace_plan;
+
+  // Per kernel index, scratchpads which are placed one after another in the shared buffer
+  std::vector<std::vector<Tensor *>> _scratchpad_plan;
+  // Buffer shared by scratchpads of all kernels, as big as the biggest kernel needs
+  std::unique_ptr<Tensor> _scratchpad_buffer;
+
 public:
   explicit TensorAllocPlan(IMemoryManager *memory_manager);
   void invalidate() { _valid = false; }
   bool isValid() const { return _valid; }
   void build(const RuntimeGraph &graph);
-  void allocate(size_t kernel_index) const;
-  void deallocate(size_t kernel_index) const;
+  void allocate(size_t kernel_index);
+  void deallocate(size_t kernel_index);
+
+  void enableArena() { _arena_enabled = true; }
+  void prepareArena();
+  void releaseArena();
+  void excludeFromArena(Tensor *tensor);
+
+  void releaseScratchpads();
+
+private:
+  void buildInplacePlan(const RuntimeGraph &graph,
+                        const std::unordered_map<Tensor *, std::pair<size_t, size_t>> &lifetimes);
+  bool allocateInArena(Tensor &tensor);
+  bool shareInplace(InplacePair &pair);
+  void allocateScratchpads(size_t kernel_index);
+  void detachScratchpads(size_t kernel_index);
 };
 
+namespace
+{
+
+constexpr size_t kArenaAlignment = 16;
+
+size_t tensorByteSize(const Tensor &tensor)
+{
+  return getDataTypeSize(tensor.element_type()) * tensor.shape().num_elements();
+}
+
+size_t alignArenaOffset(size_t offset)
+{
+  return (offset + kArenaAlignment - 1) / kArenaAlignment * kArenaAlignment;
+}
+
+} // namespace
+
 RuntimeGraph::TensorAllocPlan::TensorAllocPlan(IMemoryManager *memory_manager)
   : _memory_manager(memory_manager)
 {
@@ -48,6 +113,8 @@ RuntimeGraph::TensorAllocPlan::TensorAllocPlan(IMemoryManager *memory_manager)
 void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
 {
   invalidate();
+  releaseArena();
+  releaseScratchpads();
   using Lifetime = std::pair<size_t, size_t>;
   std::unordered_map<Tensor *, Lifetime> lifetimes;
   const size_t num_kernels = graph._kernels.size();
@@ -74,43 +141,410 @@ void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
   }
   _alloc_plan.assign(num_kernels, std::vector<Tensor *>());
   _dealloc_plan.assign(num_kernels + 1, std::vector<Tensor *>());
+  _scratchpad_plan.assign(num_kernels, std::vector<Tensor *>());
+  _arena_slots.clear();
+
+  // Scratchpads with offsets of the static memory manager stay where they are planned
+  auto is_shared_scratchpad = [&graph](const Tensor *tensor) {
+    return graph._scratchpad_tensors.count(tensor) > 0 && tensor->get_offset() < 0;
+  };
+  for (size_t index = 0; index < num_kernels; ++index)
+  {
+    for (Tensor *tensor : graph._kernels[index]->getOutputTensors())
+    {
+      if (!is_shared_scratchpad(tensor) || lifetimes.at(tensor).second != index)
+        continue;
+      _scratchpad_plan[index].push_back(tensor);
+      lifetimes.erase(tensor);
+    }
+  }
+
   for (const auto &item : lifetimes)
   {
     _alloc_plan[item.second.first].push_back(item.first);
     _dealloc_plan[item.second.second].push_back(item.first);
+
+    // Shapes known at load time are the first guess of arena slot sizes
+    ArenaSlot &slot = _arena_slots[item.first];
+    slot.first = item.second.first;
+    slot.last = item.second.second;
+    slot.size = tensorByteSize(*item.first);
   }
+  buildInplacePlan(graph, lifetimes);
+  _arena_dirty = true;
   _valid = true;
 }
 
-void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index) const
+void RuntimeGraph::TensorAllocPlan::buildInplacePlan(
+  const RuntimeGraph &graph,
+  const std::unordered_map<Tensor *, std::pair<size_t, size_t>> &lifetimes)
+{
+  const size_t num_kernels = graph._kernels.size();
+  _inplace_plan.assign(num_kernels, InplacePair());
+
+  // Tensor which owns the arena slot of the buffer shared by a chain of in-place kernels
+  std::unordered_map<Tensor *, Tensor *> slot_owners;
+  for (size_t index = 0; index < num_kernels; ++index)
+  {
+    const auto &kernel = graph._kernels[index];
+    if (!kernel->isInplace() || kernel->getInputTensors().empty() ||
+        kernel->getOutputTensors().empty())
+      continue;
+
+    auto input = const_cast<Tensor *>(kernel->getInputTensors()[0]);
+    Tensor *output = kernel->getOutputTensors()[0];
+
+    // Input is to be produced by this graph and not to be used after the kernel. Graph inputs,
+    // constants and outputs of the graph are never overwritten this way.
+    auto it = lifetimes.find(input);
+    if (it == lifetimes.end() || it->second.second != index)
+      continue;
+    if (input->element_type() != output->element_type())
+      continue;
+    // Offsets of the static memory manager are planned without sharing
+    if (input->get_offset() >= 0 || output->get_offset() >= 0)
+      continue;
+
+    _inplace_plan[index].input = input;
+    _inplace_plan[index].output = output;
+
+    // The buffer stays in the slot of the first tensor of the chain while the output is alive
+    auto owner_it = slot_owners.find(input);
+    Tensor *owner = owner_it != slot_owners.end() ? owner_it->second : input;
+    slot_owners[output] = owner;
+    ArenaSlot &owner_slot = _arena_slots.at(owner);
+    ArenaSlot &output_slot = _arena_slots.at(output);
+    owner_slot.last = std::max(owner_slot.last, lifetimes.at(output).second);
+    owner_slot.size = std::max(owner_slot.size, output_slot.size);
+    output_slot.size = 0;
+  }
+}
+
+void RuntimeGraph::TensorAllocPlan::prepareArena()
+{
+  if (!_arena_enabled || !_arena_dirty)
+    return;
+
+  releaseArena();
+
+  std::vector<ArenaSlot *> slots;
+  for (auto &item : _arena_slots)
+  {
+    if (item.second.size > 0)
+      slots.push_back(&item.second);
+  }
+  std::stable_sort(slots.begin(), slots.end(), [](const ArenaSlot *a, const ArenaSlot *b) {
+    if (a->size != b->size)
+      return a->size > b->size;
+    return a->first < b->first;
+  });
+
+  // Greedy by size placement: each slot takes the lowest offset which does not overlap slots
+  // that are already placed and alive at the same time
+  size_t arena_size = 0;
+  std::vector<const ArenaSlot *> placed;
+  std::vector<const ArenaSlot *> conflicts;
+  for (ArenaSlot *slot : slots)
+  {
+    conflicts.clear();
+    for (const ArenaSlot *other : placed)
+    {
+      if (other->first <= slot->last && slot->first <= other->last)
+        conflicts.push_back(other);
+    }
+    std::sort(conflicts.begin(), conflicts.end(),
+              [](const ArenaSlot *a, const ArenaSlot *b) { return a->offset < b->offset; });
+
+    size_t offset = 0;
+    for (const ArenaSlot *other : conflicts)
+    {
+      if (offset + slot->size <= other->offset)
+        break;
+      offset = std::max(offset, alignArenaOffset(other->offset + other->size));
+    }
+    slot->offset = offset;
+    arena_size = std::max(arena_size, offset + slot->size);
+    placed.push_back(slot);
+  }
+
+  _arena = std::make_unique<uint8_t[]>(arena_size);
+  _arena_dirty = false;
+}
+
+void RuntimeGraph::TensorAllocPlan::releaseArena()
+{
+  for (auto &item : _arena_slots)
+  {
+    if (item.second.in_arena)
+    {
+      item.first->set_data_buffer(nullptr);
+      item.second.in_arena = false;
+    }
+  }
+}
+
+void RuntimeGraph::TensorAllocPlan::excludeFromArena(Tensor *tensor)
+{
+  auto it = _arena_slots.find(tensor);
+  if (it == _arena_slots.end())
+    return;
+
+  if (it->second.in_arena)
+    tensor->set_data_buffer(nullptr);
+  _arena_slots.erase(it);
+  _arena_dirty = true;
+}
+
+bool RuntimeGraph::TensorAllocPlan::allocateInArena(Tensor &tensor)
+{
+  auto it = _arena_slots.find(&tensor);
+  if (it == _arena_slots.end())
+    return false;
+
+  ArenaSlot &slot = it->second;
+  if (!tensor.is_allocatable())
+  {
+    if (slot.in_arena)
+      tensor.set_data_buffer(nullptr);
+    slot.in_arena = false;
+    return false;
+  }
+
+  const size_t size = tensorByteSize(tensor);
+  if (_arena == nullptr || _arena_dirty || size > slot.size)
+  {
+    // Shape is changed since offsets were computed; use the memory manager for this run
+    if (slot.in_arena)
+      tensor.set_data_buffer(nullptr);
+    slot.in_arena = false;
+    slot.size = std::max(slot.size, size);
+    _arena_dirty = true;
+    return false;
+  }
+
+  if (!slot.in_arena && tensor.is_data_allocated())
+    _memory_manager->release_memory(tensor);
+  tensor.set_data_buffer(_arena.get() + slot.offset);
+  slot.in_arena = true;
+  return true;
+}
+
+bool RuntimeGraph::TensorAllocPlan::shareInplace(InplacePair &pair)
+{
+  pair.shared = false;
+  if (pair.input == nullptr || !pair.input->is_data_allocated() ||
+      !pair.output->is_allocatable() || tensorByteSize(*pair.input) != tensorByteSize(*pair.output))
+    return false;
+
+  // Outputs of the graph keep their buffers from the previous run
+  auto input_slot = _arena_slots.find(pair.input);
+  auto output_slot = _arena_slots.find(pair.output);
+  if (output_slot != _arena_slots.end() && output_slot->second.in_arena)
+    output_slot->second.in_arena = false;
+  else if (pair.output->is_data_allocated())
+    _memory_manager->release_memory(*pair.output);
+
+  // Output takes over the buffer, wherever it is placed
+  pair.output->set_data_buffer(pair.input->data<uint8_t>());
+  const bool in_arena = input_slot != _arena_slots.end() && input_slot->second.in_arena;
+  if (output_slot != _arena_slots.end())
+    output_slot->second.in_arena = in_arena;
+  else if (in_arena)
+  {
+    // Output is not supposed to be freed by the memory manager; keep its own buffer instead
+    pair.output->set_data_buffer(nullptr);
+    return false;
+  }
+  pair.shared = true;
+  return true;
+}
+
+void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index)
 {
   assert(_valid && kernel_index < _alloc_plan.size());
+  InplacePair &pair = _inplace_plan[kernel_index];
+  const bool shared = shareInplace(pair);
   for (Tensor *tensor : _alloc_plan[kernel_index])
   {
+    if (shared && tensor == pair.output)
+      continue;
+    if (_arena_enabled && allocateInArena(*tensor))
+      continue;
     _memory_manager->allocate_memory(*tensor);
   }
+  allocateScratchpads(kernel_index);
 }
 
-void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index) const
+void RuntimeGraph::TensorAllocPlan::allocateScratchpads(size_t kernel_index)
+{
+  const auto &scratchpads = _scratchpad_plan[kernel_index];
+  size_t required_size = 0;
+  for (const Tensor *tensor : scratchpads)
+  {
+    if (tensor->is_allocatable())
+      required_size = alignArenaOffset(required_size) + tensorByteSize(*tensor);
+  }
+  if (required_size == 0)
+    return;
+
+  // Buffer grows to the biggest requirement seen, then it is reused by every kernel and run
+  if (_scratchpad_buffer == nullptr ||
+      static_cast<size_t>(_scratchpad_buffer->shape().num_elements()) < required_size)
+  {
+    if (_scratchpad_buffer == nullptr)
+      _scratchpad_buffer =
+        std::make_unique<Tensor>(DataType::U8, Shape({}), AffineQuantization{}, "");
+    else
+      _memory_manager->release_memory(*_scratchpad_buffer);
+    _scratchpad_buffer->resize(Shape({static_cast<int32_t>(required_size)}));
+    _memory_manager->allocate_memory(*_scratchpad_buffer);
+  }
+
+  size_t offset = 0;
+  for (Tensor *tensor : scratchpads)
+  {
+    if (!tensor->is_allocatable())
+      continue;
+    offset = alignArenaOffset(offset);
+    tensor->set_data_buffer(_scratchpad_buffer->data<uint8_t>() + offset);
+    offset += tensorByteSize(*tensor);
+  }
+}
+
+void RuntimeGraph::TensorAllocPlan::detachScratchpads(size_t kernel_index)
+{
+  for (Tensor *tensor : _scratchpad_plan[kernel_index])
+  {
+    if (tensor->is_allocatable())
+      tensor->set_data_buffer(nullptr);
+  }
+}
+
+void RuntimeGraph::TensorAllocPlan::releaseScratchpads()
+{
+  for (size_t index = 0; index < _scratchpad_plan.size(); ++index)
+    detachScratchpads(index);
+  if (_scratchpad_buffer != nullptr)
+    _memory_manager->release_memory(*_scratchpad_buffer);
+  _scratchpad_buffer.reset();
+}
+
+void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index)
 {
   assert(_valid && kernel_index < _dealloc_plan.size());
+  if (kernel_index < _scratchpad_plan.size())
+    detachScratchpads(kernel_index);
+  const InplacePair *pair =
+    kernel_index < _inplace_plan.size() ? &_inplace_plan[kernel_index] : nullptr;
   for (Tensor *tensor : _dealloc_plan[kernel_index])
   {
+    auto it = _arena_slots.find(tensor);
+    if (pair != nullptr && pair->shared && tensor == pair->input)
+    {
+      // The buffer belongs to the output of the in-place kernel now
+      tensor->set_data_buffer(nullptr);
+      if (it != _arena_slots.end())
+        it->second.in_arena = false;
+      continue;
+    }
+    if (it != _arena_slots.end() && it->second.in_arena)
+    {
+      tensor->set_data_buffer(nullptr);
+      it->second.in_arena = false;
+      continue;
+    }
     _memory_manager->release_memory(*tensor);
   }
 }
 
+// Kernel is configured again only if it may resize outputs, i.e. when shapes of its inputs are
+// changed or values of its inputs may decide shapes of outputs.
+class RuntimeGraph::KernelConfigCache
+{
+  std::vector<std::vector<Shape>> _input_shapes;
+  std::vector<bool> _configured;
+  // Kernels which read non-constant integer tensors, such as shapes, axes or paddings
+  std::vector<bool> _always_configure;
+  bool _valid = false;
+
+public:
+  void invalidate() { _valid = false; }
+  bool isValid() const { return _valid; }
+  void build(const RuntimeGraph &graph);
+  bool needConfigure(size_t kernel_index, const Kernel &kernel) const;
+  void update(size_t kernel_index, const Kernel &kernel);
+};
+
+void RuntimeGraph::KernelConfigCache::build(const RuntimeGraph &graph)
+{
+  std::unordered_set<const Tensor *> variable_tensors(graph.getInputTensors().cbegin(),
+                                                      graph.getInputTensors().cend());
+  for (const auto &kernel : graph._kernels)
+  {
+    for (const Tensor *tensor : kernel->getOutputTensors())
+      variable_tensors.insert(tensor);
+  }
+
+  const size_t num_kernels = graph._kernels.size();
+  _input_shapes.assign(num_kernels, std::vector<Shape>());
+  _configured.assign(num_kernels, false);
+  _always_configure.assign(num_kernels, false);
+  for (size_t index = 0; index < num_kernels; ++index)
+  {
+    for (const Tensor *tensor : graph._kernels[index]->getInputTensors())
+    {
+      if (tensor == nullptr || variable_tensors.count(tensor) == 0)
+        continue;
+      if (tensor->element_type() == DataType::S32 || tensor->element_type() == DataType::S64)
+        _always_configure[index] = true;
+    }
+  }
+  _valid = true;
+}
+
+bool RuntimeGraph::KernelConfigCache::needConfigure(size_t kernel_index,
+                                                    const Kernel &kernel) const
+{
+  assert(_valid && kernel_index < _configured.size());
+  if (!_configured[kernel_index] || _always_configure[kernel_index])
+    return true;
+
+  const auto &inputs = kernel.getInputTensors();
+  const auto &shapes = _input_shapes[kernel_index];
+  assert(inputs.size() == shapes.size());
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    if (inputs[i] != nullptr && inputs[i]->shape() != shapes[i])
+      return true;
+  }
+  return false;
+}
+
+void RuntimeGraph::KernelConfigCache::update(size_t kernel_index, const Kernel &kernel)
+{
+  assert(_valid && kernel_index < _configured.size());
+  auto &shapes = _input_shapes[kernel_index];
+  shapes.clear();
+  for (const Tensor *tensor : kernel.getInputTensors())
+    shapes.push_back(tensor != nullptr ? tensor->shape() : Shape(0));
+  _configured[kernel_index] = true;
+}
+
 RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_manager)
   : _owning_module(owning_module), _memory_manager(memory_manager),
-    _tensor_alloc_plan(std::make_unique<TensorAllocPlan>(memory_manager))
+    _tensor_alloc_plan(std::make_unique<TensorAllocPlan>(memory_manager)),
+    _kernel_config_cache(std::make_unique<KernelConfigCache>())
 {
 }
 
 RuntimeGraph::~RuntimeGraph()
 {
+  _tensor_alloc_plan->releaseArena();
+  _tensor_alloc_plan->releaseScratchpads();
   for (auto &tensor : _tensors)
   {
-    if (tensor->is_data_allocated())
+    // Data of not allocatable tensors is not owned by the memory manager, e.g. constants
+    if (tensor->is_data_allocated() && tensor->is_allocatable())
       _memory_manager->release_memory(*tensor);
   }
 }
@@ -122,6 +556,13 @@ Tensor *RuntimeGraph::addTensor(std::unique_ptr<Tensor> &&tensor)
   return _tensors.back().get();
 }
 
+Tensor *RuntimeGraph::addScratchpadTensor(std::unique_ptr<Tensor> &&tensor)
+{
+  Tensor *scratchpad = addTensor(std::move(tensor));
+  _scratchpad_tensors.insert(scratchpad);
+  return scratchpad;
+}
+
 void RuntimeGraph::setInputTensors(const std::vector<Tensor *> &input_tensors)
 {
   assert(std::all_of(input_tensors.cbegin(), input_tensors.cend(),
@@ -138,20 +579,34 @@ void RuntimeGraph::setOutputTensors(const std::vector<Tensor *> &output_tensors)
 
 void RuntimeGraph::configureAllocations(Tensor *tensor)
 {
+  // Tensor may belong to another graph, e.g. an output of If kernel; it is managed by the memory
+  // manager from now on
+  _owning_module->excludeFromArena(tensor);
   _memory_manager->allocate_memory(*tensor);
 }
 
+void RuntimeGraph::enableArenaAllocation() { _tensor_alloc_plan->enableArena(); }
+
+void RuntimeGraph::excludeFromArena(Tensor *tensor)
+{
+  _tensor_alloc_plan->excludeFromArena(tensor);
+}
+
 void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
 {
   assert(kernel != nullptr);
   _kernels.push_back(std::move(kernel));
   _tensor_alloc_plan->invalidate();
+  _kernel_config_cache->invalidate();
 }
 
 void RuntimeGraph::execute() const
 {
   if (!_tensor_alloc_plan->isValid())
     _tensor_alloc_plan->build(*this);
+  _tensor_alloc_plan->prepareArena();
+  if (!_kernel_config_cache->isValid())
+    _kernel_config_cache->build(*this);
 
   EventNotifier *event_notifier = _owning_module->getEventNotifier();
 
@@ -173,9 +628,12 @@ void RuntimeGraph::execute() const
       event_notifier->preOperatorExecute(kernel.get());
     }
 
-    // TODO The `configure` method should only be called if the outputs of an operator need to be
-    //  resized.
-    kernel->configure();
+    // Configure only if the outputs of an operator may need to be resized
+    if (_kernel_config_cache->needConfigure(index, *kernel))
+    {
+      kernel->configure();
+      _kernel_config_cache->update(index, *kernel);
+    }
 
     // Preallocate outputs in advance instead of relying on automatic allocation
     _tensor_alloc_plan->allocate(index);
@@ -22,6 +22,7 @@
 #include "core/Kernel.h"
 
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 namespace luci_interpreter
@@ -34,12 +35,17 @@ class RuntimeGraph
 private:
   class TensorAllocPlan;
   friend class TensorAllocPlan;
+  class KernelConfigCache;
+  friend class KernelConfigCache;
 
 public:
   explicit RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_manager);
   ~RuntimeGraph();
 
   Tensor *addTensor(std::unique_ptr<Tensor> &&tensor);
+  // Scratchpad is used by its kernel only during execution, so it shares one buffer with
+  // scratchpads of other kernels
+  Tensor *addScratchpadTensor(std::unique_ptr<Tensor> &&tensor);
 
   void setInputTensors(const std::vector<Tensor *> &input_tensors);
   void setOutputTensors(const std::vector<Tensor *> &output_tensors);
@@ -49,6 +55,12 @@ public:
   const std::vector<Tensor *> &getInputTensors() const { return _input_tensors; }
   const std::vector<Tensor *> &getOutputTensors() const { return _output_tensors; }
 
+  // Place intermediate tensors in one buffer reused across runs, at offsets computed from their
+  // lifetimes, instead of allocating them from the memory manager on every run.
+  void enableArenaAllocation();
+  // Stop placing the tensor in the arena, if it is there
+  void excludeFromArena(Tensor *tensor);
+
   void addKernel(std::unique_ptr<Kernel> &&kernel);
 
   void execute() const;
@@ -59,11 +71,14 @@ private:
   std::vector<std::unique_ptr<Tensor>> _tensors;
   std::vector<Tensor *> _input_tensors;
   std::vector<Tensor *> _output_tensors;
+  std::unordered_set<const Tensor *> _scratchpad_tensors;
 
   // Kernels in execution order.
   std::vector<std::unique_ptr<Kernel>> _kernels;
   // Tensors that are not used anymore after given op
   std::unique_ptr<TensorAllocPlan> _tensor_alloc_plan;
+  // Input shapes of kernels at their last configuration
+  std::unique_ptr<KernelConfigCache> _kernel_config_cache;
 };
 
 } // namespace luci_interpreter
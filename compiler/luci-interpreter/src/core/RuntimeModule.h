@@ -46,6 +46,18 @@ public:
     return getMainGraph()->getOutputTensors();
   }
 
+  void enableArenaAllocation()
+  {
+    for (auto &graph : _graphs)
+      graph->enableArenaAllocation();
+  }
+
+  void excludeFromArena(Tensor *tensor)
+  {
+    for (auto &graph : _graphs)
+      graph->excludeFromArena(tensor);
+  }
+
   void execute() const { getMainGraph()->execute(); }
 
 private:
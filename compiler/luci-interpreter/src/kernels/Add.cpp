@@ -20,6 +20,8 @@
 #include "kernels/BinaryOpCommon.h"
 #include "kernels/Utils.h"
 
+#include "PALAdd.h"
+
 #include <tensorflow/lite/kernels/internal/reference/add.h>
 #include <tensorflow/lite/kernels/internal/reference/process_broadcast_shapes.h>
 
@@ -30,6 +32,46 @@ namespace luci_interpreter
 namespace kernels
 {
 
+static tflite::ArithmeticParams getQuantizedParams(const Tensor *input1, const Tensor *input2,
+                                                   const Tensor *output, Activation activation)
+{
+  const auto input1_scale = static_cast<double>(input1->scale());
+  const auto input2_scale = static_cast<double>(input2->scale());
+  const auto output_scale = static_cast<double>(output->scale());
+
+  const int left_shift = 20;
+  const double twice_max_input_scale = 2 * std::max(input1_scale, input2_scale);
+  const double real_input1_multiplier = input1_scale / twice_max_input_scale;
+  const double real_input2_multiplier = input2_scale / twice_max_input_scale;
+  const double real_output_multiplier = twice_max_input_scale / ((1 << left_shift) * output_scale);
+
+  int32_t input1_multiplier{}, input2_multiplier{}, output_multiplier{};
+  int input1_shift{}, input2_shift{}, output_shift{};
+  quantizeMultiplierSmallerThanOneExp(real_input1_multiplier, &input1_multiplier, &input1_shift);
+  quantizeMultiplierSmallerThanOneExp(real_input2_multiplier, &input2_multiplier, &input2_shift);
+  quantizeMultiplierSmallerThanOneExp(real_output_multiplier, &output_multiplier, &output_shift);
+
+  int32_t activation_min{};
+  int32_t activation_max{};
+  calculateActivationRangeQuantized(activation, output, &activation_min, &activation_max);
+
+  tflite::ArithmeticParams params{};
+  params.left_shift = left_shift;
+  // The kernel expects inputs' zero points to be negated.
+  params.input1_offset = -input1->zero_point(); // Note the '-'.
+  params.input1_multiplier = input1_multiplier;
+  params.input1_shift = input1_shift;
+  params.input2_offset = -input2->zero_point(); // Note the '-'.
+  params.input2_multiplier = input2_multiplier;
+  params.input2_shift = input2_shift;
+  params.output_offset = output->zero_point();
+  params.output_multiplier = output_multiplier;
+  params.output_shift = output_shift;
+  params.quantized_activation_min = activation_min;
+  params.quantized_activation_max = activation_max;
+  return params;
+}
+
 Add::Add(const Tensor *input1, const Tensor *input2, Tensor *output, const AddParams &params)
   : KernelWithParams<AddParams>({input1, input2}, {output}, params)
 {
@@ -66,6 +108,9 @@ void Add::execute() const
     case DataType::U8:
       evalQuantized();
       break;
+    case DataType::S8:
+      evalQuantizedS8();
+      break;
     case DataType::S16:
       evalQuantizedS16();
       break;
@@ -120,40 +165,8 @@ template <typename T> void Add::evalInteger() const
 
 void Add::evalQuantized() const
 {
-  const auto input1_scale = static_cast<double>(input1()->scale());
-  const auto input2_scale = static_cast<double>(input2()->scale());
-  const auto output_scale = static_cast<double>(output()->scale());
-
-  const int left_shift = 20;
-  const double twice_max_input_scale = 2 * std::max(input1_scale, input2_scale);
-  const double real_input1_multiplier = input1_scale / twice_max_input_scale;
-  const double real_input2_multiplier = input2_scale / twice_max_input_scale;
-  const double real_output_multiplier = twice_max_input_scale / ((1 << left_shift) * output_scale);
-
-  int32_t input1_multiplier{}, input2_multiplier{}, output_multiplier{};
-  int input1_shift{}, input2_shift{}, output_shift{};
-  quantizeMultiplierSmallerThanOneExp(real_input1_multiplier, &input1_multiplier, &input1_shift);
-  quantizeMultiplierSmallerThanOneExp(real_input2_multiplier, &input2_multiplier, &input2_shift);
-  quantizeMultiplierSmallerThanOneExp(real_output_multiplier, &output_multiplier, &output_shift);
-
-  int32_t activation_min{};
-  int32_t activation_max{};
-  calculateActivationRangeQuantized(_params.activation, output(), &activation_min, &activation_max);
-
-  tflite::ArithmeticParams params{};
-  params.left_shift = left_shift;
-  // The kernel expects inputs' zero points to be negated.
-  params.input1_offset = -input1()->zero_point(); // Note the '-'.
-  params.input1_multiplier = input1_multiplier;
-  params.input1_shift = input1_shift;
-  params.input2_offset = -input2()->zero_point(); // Note the '-'.
-  params.input2_multiplier = input2_multiplier;
-  params.input2_shift = input2_shift;
-  params.output_offset = output()->zero_point();
-  params.output_multiplier = output_multiplier;
-  params.output_shift = output_shift;
-  params.quantized_activation_min = activation_min;
-  params.quantized_activation_max = activation_max;
+  tflite::ArithmeticParams params =
+    getQuantizedParams(input1(), input2(), output(), _params.activation);
 
   const bool need_broadcast = tflite::reference_ops::ProcessBroadcastShapes(
     getTensorShape(input1()), getTensorShape(input2()), &params);
@@ -172,6 +185,28 @@ void Add::evalQuantized() const
   }
 }
 
+void Add::evalQuantizedS8() const
+{
+  tflite::ArithmeticParams params =
+    getQuantizedParams(input1(), input2(), output(), _params.activation);
+
+  const bool need_broadcast = tflite::reference_ops::ProcessBroadcastShapes(
+    getTensorShape(input1()), getTensorShape(input2()), &params);
+
+  if (need_broadcast)
+  {
+    luci_interpreter_pal::BroadcastAdd4DSlow(
+      params, getTensorShape(input1()), getTensorData<int8_t>(input1()), getTensorShape(input2()),
+      getTensorData<int8_t>(input2()), getTensorShape(output()), getTensorData<int8_t>(output()));
+  }
+  else
+  {
+    luci_interpreter_pal::Add(params, getTensorShape(input1()), getTensorData<int8_t>(input1()),
+                              getTensorShape(input2()), getTensorData<int8_t>(input2()),
+                              getTensorShape(output()), getTensorData<int8_t>(output()));
+  }
+}
+
 void Add::evalQuantizedS16() const
 {
   const auto input1_scale = static_cast<double>(input1()->scale());
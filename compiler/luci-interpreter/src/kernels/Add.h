@@ -41,6 +41,7 @@ private:
   void evalFloat() const;
   template <typename T> void evalInteger() const;
   void evalQuantized() const;
+  void evalQuantizedS8() const;
   void evalQuantizedS16() const;
 };
 
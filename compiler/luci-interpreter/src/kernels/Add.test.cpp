@@ -109,6 +109,39 @@ TEST_F(AddTest, Uint8)
   }
 }
 
+TEST_F(AddTest, SInt8)
+{
+  std::initializer_list<int32_t> base_shape = {1, 3, 1, 2};
+  std::initializer_list<float> base_data = {-0.3f, 2.3f, 0.9f, 0.5f, 0.8f, -1.1f};
+  std::initializer_list<int32_t> test_shapes[] = {{1, 3, 1, 2}, {1}};
+  std::vector<float> test_data[] = {{0.2f, 0.3f, -0.4f, 0.5f, 1.0f, 0.9f}, {0.5f}};
+  std::vector<std::vector<float>> output_data = {{-0.1f, 2.6f, 0.5f, 1.0f, 1.8f, -0.2f},
+                                                 {0.2f, 2.8f, 1.4f, 1.0f, 1.3f, -0.6f}};
+  float kQuantizedTolerance = GetTolerance(-3.f, 3.f);
+  std::pair<float, int32_t> quant_param = quantizationParams<int8_t>(-3.f, 3.f);
+  for (int i = 0; i < output_data.size(); i++)
+  {
+    Tensor input1_tensor = makeInputTensor<DataType::S8>(
+      base_shape, quant_param.first, quant_param.second, base_data, _memory_manager.get());
+    Tensor input2_tensor = makeInputTensor<DataType::S8>(
+      test_shapes[i], quant_param.first, quant_param.second, test_data[i], _memory_manager.get());
+    Tensor output_tensor =
+      makeOutputTensor(getElementType<int8_t>(), quant_param.first, quant_param.second);
+
+    AddParams params{};
+    params.activation = Activation::NONE;
+
+    Add kernel(&input1_tensor, &input2_tensor, &output_tensor, params);
+    kernel.configure();
+    _memory_manager->allocate_memory(output_tensor);
+    kernel.execute();
+
+    EXPECT_THAT(dequantizeTensorData(output_tensor),
+                FloatArrayNear(output_data[i], kQuantizedTolerance));
+    EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(base_shape));
+  }
+}
+
 TEST_F(AddTest, Float)
 {
   Shape base_shape = {2, 3, 1, 2};
@@ -56,11 +56,12 @@ void BatchMatMul::configure()
   auto adj_x = params().adj_x;
   auto adj_y = params().adj_y;
 
-  // TODO Support non-float types
-  if (lhs->element_type() != DataType::FLOAT32 || rhs->element_type() != DataType::FLOAT32)
+  // TODO Support other quantized types
+  if (lhs->element_type() != DataType::FLOAT32 && lhs->element_type() != DataType::S8)
     throw std::runtime_error("Unsupported type.");
 
   LUCI_INTERPRETER_CHECK(lhs->element_type() == rhs->element_type());
+  LUCI_INTERPRETER_CHECK(lhs->element_type() == output()->element_type());
 
   auto lhs_rank = lhs->shape().num_dims();
   auto rhs_rank = rhs->shape().num_dims();
@@ -143,8 +144,12 @@ void TransposeRowsColumns(const Tensor *tensor_in, Tensor *tensor_out)
       tflite::reference_ops::Transpose(params, shape, getTensorData<float>(tensor_in),
                                        transposed_shape, getTensorData<float>(tensor_out));
       break;
+    case DataType::S8:
+      tflite::reference_ops::Transpose(params, shape, getTensorData<int8_t>(tensor_in),
+                                       transposed_shape, getTensorData<int8_t>(tensor_out));
+      break;
     default:
-      throw std::runtime_error("Only suppport fp32 BatchMatMul for now.");
+      throw std::runtime_error("Only suppport fp32 and int8 BatchMatMul for now.");
   }
 }
 
@@ -179,6 +184,31 @@ void BatchMatMul::execute() const
                                         getTensorData<float>(lhs_tensor), getTensorShape(output()),
                                         getTensorData<float>(output()));
       break;
+    case DataType::S8:
+    {
+      // Operands are swapped for the reference kernel, so offset of rhs goes to "weights"
+      tflite::FullyConnectedParams op_params{};
+      op_params.input_offset = -lhs->zero_point();
+      op_params.weights_offset = -rhs->zero_point();
+      op_params.output_offset = output()->zero_point();
+
+      const double real_multiplier = static_cast<double>(lhs->scale()) *
+                                     static_cast<double>(rhs->scale()) /
+                                     static_cast<double>(output()->scale());
+      quantizeMultiplier(real_multiplier, &op_params.output_multiplier, &op_params.output_shift);
+
+      int32_t activation_min{};
+      int32_t activation_max{};
+      calculateActivationRangeQuantized(Activation::NONE, output(), &activation_min,
+                                        &activation_max);
+      op_params.quantized_activation_min = activation_min;
+      op_params.quantized_activation_max = activation_max;
+
+      luci_interpreter_pal::BatchMatMul(op_params, rhs_shape, getTensorData<int8_t>(rhs_tensor),
+                                        lhs_shape, getTensorData<int8_t>(lhs_tensor),
+                                        getTensorShape(output()), getTensorData<int8_t>(output()));
+      break;
+    }
     default:
       throw std::runtime_error("Unsupported type.");
   }
@@ -63,6 +63,34 @@ TEST_F(BatchMatMulTest, Float)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 2, 4}));
 }
 
+TEST_F(BatchMatMulTest, SInt8)
+{
+  std::vector<float> lhs_data = {1, 2, 3, 4, 5, 6};
+  std::vector<float> rhs_data = {7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18};
+  Tensor lhs_tensor =
+    makeInputTensor<DataType::S8>({1, 2, 3}, 0.05, -20, lhs_data, _memory_manager.get());
+  Tensor rhs_tensor =
+    makeInputTensor<DataType::S8>({1, 3, 4}, 0.25, -10, rhs_data, _memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::S8, 2.0, -20);
+  Tensor lhs_scratch(DataType::S8, Shape({}), {}, "");
+  Tensor rhs_scratch(DataType::S8, Shape({}), {}, "");
+
+  BatchMatMulParams params;
+  params.adj_x = false;
+  params.adj_y = false;
+
+  BatchMatMul kernel(&lhs_tensor, &rhs_tensor, &output_tensor, &lhs_scratch, &rhs_scratch, params);
+  kernel.configure();
+  _memory_manager->allocate_memory(lhs_scratch);
+  _memory_manager->allocate_memory(rhs_scratch);
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+
+  EXPECT_THAT(dequantizeTensorData(output_tensor),
+              FloatArrayNear({74., 80., 86., 92., 173., 188., 203., 218.}, output_tensor.scale()));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 2, 4}));
+}
+
 TEST_F(BatchMatMulTest, Float_SimpleRHSAdjoint)
 {
   std::vector<float> lhs_data = {1, 2, 3, 4, 5, 6};
@@ -69,11 +69,12 @@ void Concatenation::configure()
   Shape output_shape = t0->shape();
   output_shape.dim(axis) = sum_axis;
 
-  // If input tensors are INT8 type then quantization parameters of all input tensors and the output
-  // should be the same
+  // If input tensors are INT8 or INT16 type then quantization parameters of all input tensors and
+  // the output should be the same
   for (auto current_tensor : _inputs)
   {
-    if (current_tensor->element_type() == DataType::S8)
+    if (current_tensor->element_type() == DataType::S8 ||
+        current_tensor->element_type() == DataType::S16)
     {
       LUCI_INTERPRETER_CHECK(current_tensor->quantized_dimension() ==
                              output()->quantized_dimension());
@@ -100,6 +101,9 @@ void Concatenation::execute() const
     case DataType::S8:
       evalGeneric<int8_t>();
       break;
+    case DataType::S16:
+      evalGeneric<int16_t>();
+      break;
     case DataType::S32:
       evalGeneric<int32_t>();
       break;
@@ -78,6 +78,9 @@ void ExpandDims::execute() const
   // Just copy input to output
   const auto *input_data = input()->data<void>();
   auto *output_data = output()->data<void>();
+  // Output shares the memory of input if the kernel is executed in place
+  if (output_data == input_data)
+    return;
 
   const size_t element_size = getDataTypeSize(input()->element_type());
   const int32_t num_elements = input()->shape().num_elements();
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "kernels/Gelu.h"
+#include "kernels/Utils.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+
+namespace kernels
+{
+
+Gelu::Gelu(const Tensor *input, Tensor *output, const GeluParams &params)
+  : KernelWithParams<GeluParams>({input}, {output}, params)
+{
+}
+
+void Gelu::configure()
+{
+  LUCI_INTERPRETER_CHECK(input()->element_type() == output()->element_type());
+  output()->resize(input()->shape());
+}
+
+void Gelu::execute() const
+{
+  switch (input()->element_type())
+  {
+    case DataType::FLOAT32:
+      evalFloat();
+      break;
+    default:
+      throw std::runtime_error("Unsupported type.");
+  }
+}
+
+void Gelu::evalFloat() const
+{
+  const auto *input_data = getTensorData<float>(input());
+  auto *output_data = getTensorData<float>(output());
+  const auto size = input()->shape().num_elements();
+
+  if (params().approximate)
+  {
+    // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+    const float sqrt_2_over_pi = std::sqrt(2.0f / static_cast<float>(M_PI));
+    for (int32_t i = 0; i < size; ++i)
+    {
+      const float x = input_data[i];
+      const float inner = sqrt_2_over_pi * (x + 0.044715f * x * x * x);
+      output_data[i] = 0.5f * x * (1.0f + std::tanh(inner));
+    }
+  }
+  else
+  {
+    // 0.5 * x * (1 + erf(x / sqrt(2)))
+    for (int32_t i = 0; i < size; ++i)
+    {
+      const float x = input_data[i];
+      output_data[i] = 0.5f * x * (1.0f + std::erf(x * static_cast<float>(M_SQRT1_2)));
+    }
+  }
+}
+
+} // namespace kernels
+} // namespace luci_interpreter
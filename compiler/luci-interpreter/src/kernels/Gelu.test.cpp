@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "kernels/Gelu.h"
+#include "kernels/TestUtils.h"
+#include "luci_interpreter/TestMemoryManager.h"
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+namespace
+{
+
+using namespace testing;
+
+void Check(std::initializer_list<int32_t> input_shape, std::initializer_list<int32_t> output_shape,
+           std::initializer_list<float> input_data, std::initializer_list<float> output_data,
+           bool approximate)
+{
+  std::unique_ptr<IMemoryManager> memory_manager = std::make_unique<TestMemoryManager>();
+  Tensor input_tensor =
+    makeInputTensor<DataType::FLOAT32>(input_shape, input_data, memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  GeluParams params{};
+  params.approximate = approximate;
+
+  Gelu kernel(&input_tensor, &output_tensor, params);
+  kernel.configure();
+  memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor), FloatArrayNear(output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(output_shape));
+}
+
+TEST(GeluTest, Erf)
+{
+  Check(/*input_shape=*/{2, 4}, /*output_shape=*/{2, 4},
+        /*input_data=*/
+        {
+          -3.0, -1.0, -0.5, 0.0, //
+          0.5, 1.0, 2.0, 3.0,    //
+        },
+        /*output_data=*/
+        {
+          -0.004050, -0.158655, -0.154269, 0.0,   //
+          0.345731, 0.841345, 1.954500, 2.995950, //
+        },
+        /*approximate=*/false);
+}
+
+TEST(GeluTest, Tanh)
+{
+  Check(/*input_shape=*/{2, 4}, /*output_shape=*/{2, 4},
+        /*input_data=*/
+        {
+          -3.0, -1.0, -0.5, 0.0, //
+          0.5, 1.0, 2.0, 3.0,    //
+        },
+        /*output_data=*/
+        {
+          -0.003637, -0.158808, -0.154286, 0.0,   //
+          0.345714, 0.841192, 1.954598, 2.996363, //
+        },
+        /*approximate=*/true);
+}
+
+TEST(GeluTest, InOutTypeMismatch_NEG)
+{
+  std::unique_ptr<IMemoryManager> memory_manager = std::make_unique<TestMemoryManager>();
+  Shape input_shape{2, 4};
+  std::vector<float> input_data{
+    -3.0, -1.0, -0.5, 0.0, //
+    0.5,  1.0,  2.0,  3.0, //
+  };
+  Tensor input_tensor =
+    makeInputTensor<DataType::FLOAT32>(input_shape, input_data, memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::U8);
+
+  GeluParams params{};
+  params.approximate = false;
+
+  Gelu kernel(&input_tensor, &output_tensor, params);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
+} // namespace
+} // namespace kernels
+} // namespace luci_interpreter
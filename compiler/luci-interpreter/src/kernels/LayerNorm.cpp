@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "kernels/LayerNorm.h"
+
+#include "kernels/Utils.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+
+LayerNorm::LayerNorm(const Tensor *input, const Tensor *gamma, const Tensor *beta, Tensor *output,
+                     const LayerNormParams &params)
+  : KernelWithParams<LayerNormParams>({input, gamma, beta}, {output}, params)
+{
+}
+
+void LayerNorm::configure()
+{
+  const int32_t num_dims = input()->shape().num_dims();
+  LUCI_INTERPRETER_CHECK(num_dims >= 1);
+  LUCI_INTERPRETER_CHECK(input()->element_type() == output()->element_type());
+  const int32_t depth = input()->shape().dim(num_dims - 1);
+  LUCI_INTERPRETER_CHECK(gamma()->element_type() == input()->element_type());
+  LUCI_INTERPRETER_CHECK(gamma()->shape().num_dims() == 1);
+  LUCI_INTERPRETER_CHECK(gamma()->shape().dim(0) == depth);
+  LUCI_INTERPRETER_CHECK(beta()->element_type() == input()->element_type());
+  LUCI_INTERPRETER_CHECK(beta()->shape().num_dims() == 1);
+  LUCI_INTERPRETER_CHECK(beta()->shape().dim(0) == depth);
+  output()->resize(input()->shape());
+}
+
+void LayerNorm::execute() const
+{
+  switch (input()->element_type())
+  {
+    case DataType::FLOAT32:
+      evalFloat();
+      break;
+    default:
+      throw std::runtime_error("Unsupported type.");
+  }
+}
+
+void LayerNorm::evalFloat() const
+{
+  const Shape &input_shape = input()->shape();
+  const int32_t depth = input_shape.dim(input_shape.num_dims() - 1);
+  const int32_t outer_size = depth == 0 ? 0 : input_shape.num_elements() / depth;
+  const float *input_data = getTensorData<float>(input());
+  const float *gamma_data = getTensorData<float>(gamma());
+  const float *beta_data = getTensorData<float>(beta());
+  float *output_data = getTensorData<float>(output());
+
+  for (int32_t outer = 0; outer < outer_size; ++outer)
+  {
+    const float *in = input_data + outer * depth;
+    float *out = output_data + outer * depth;
+
+    float sum = 0.0f;
+    for (int32_t i = 0; i < depth; ++i)
+      sum += in[i];
+    const float mean = sum / depth;
+
+    float square_sum = 0.0f;
+    for (int32_t i = 0; i < depth; ++i)
+      square_sum += (in[i] - mean) * (in[i] - mean);
+    const float variance = square_sum / depth;
+    const float inv_stddev = 1.0f / std::sqrt(variance + params().epsilon);
+
+    for (int32_t i = 0; i < depth; ++i)
+      out[i] = (in[i] - mean) * inv_stddev * gamma_data[i] + beta_data[i];
+  }
+}
+
+} // namespace kernels
+} // namespace luci_interpreter
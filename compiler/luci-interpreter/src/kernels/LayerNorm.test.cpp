@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "kernels/LayerNorm.h"
+#include "kernels/TestUtils.h"
+#include "luci_interpreter/TestMemoryManager.h"
+
+namespace luci_interpreter
+{
+namespace kernels
+{
+namespace
+{
+
+using namespace testing;
+
+class LayerNormTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _memory_manager = std::make_unique<TestMemoryManager>(); }
+
+  std::unique_ptr<IMemoryManager> _memory_manager;
+};
+
+TEST_F(LayerNormTest, Simple)
+{
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(
+    {2, 4}, {1, 2, 3, 4, -2, 0, 0, 6}, _memory_manager.get());
+  Tensor gamma_tensor =
+    makeInputTensor<DataType::FLOAT32>({4}, {1, 2, 1, 1}, _memory_manager.get());
+  Tensor beta_tensor =
+    makeInputTensor<DataType::FLOAT32>({4}, {0, 0, 1, -1}, _memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  LayerNormParams params{};
+  params.epsilon = 1e-5f;
+
+  LayerNorm kernel(&input_tensor, &gamma_tensor, &beta_tensor, &output_tensor, params);
+  kernel.configure();
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              FloatArrayNear({-1.341635f, -0.894424f, 1.447212f, 0.341635f, //
+                              -0.999999f, -0.666666f, 0.666667f, 0.666666f}));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 4}));
+}
+
+TEST_F(LayerNormTest, Wrong_gamma_depth_NEG)
+{
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(
+    {2, 4}, {1, 2, 3, 4, -2, 0, 0, 6}, _memory_manager.get());
+  Tensor gamma_tensor = makeInputTensor<DataType::FLOAT32>({2}, {1, 2}, _memory_manager.get());
+  Tensor beta_tensor =
+    makeInputTensor<DataType::FLOAT32>({4}, {0, 0, 1, -1}, _memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  LayerNormParams params{};
+  params.epsilon = 1e-5f;
+
+  LayerNorm kernel(&input_tensor, &gamma_tensor, &beta_tensor, &output_tensor, params);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
+TEST_F(LayerNormTest, InOutTypeMismatch_NEG)
+{
+  Tensor input_tensor = makeInputTensor<DataType::FLOAT32>(
+    {2, 4}, {1, 2, 3, 4, -2, 0, 0, 6}, _memory_manager.get());
+  Tensor gamma_tensor =
+    makeInputTensor<DataType::FLOAT32>({4}, {1, 2, 1, 1}, _memory_manager.get());
+  Tensor beta_tensor =
+    makeInputTensor<DataType::FLOAT32>({4}, {0, 0, 1, -1}, _memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::U8);
+
+  LayerNormParams params{};
+  params.epsilon = 1e-5f;
+
+  LayerNorm kernel(&input_tensor, &gamma_tensor, &beta_tensor, &output_tensor, params);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
+} // namespace
+} // namespace kernels
+} // namespace luci_interpreter
@@ -43,6 +43,7 @@ public:
 private:
   void evalFloat() const;
   void evalQuantized() const;
+  void evalQuantizedS8() const;
   void evalQuantizedS16() const;
 
 private:
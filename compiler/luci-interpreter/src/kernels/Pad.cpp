@@ -18,7 +18,7 @@
 
 #include "kernels/Utils.h"
 
-#include <tensorflow/lite/kernels/internal/reference/pad.h>
+#include "PALPad.h"
 
 namespace luci_interpreter
 {
@@ -78,9 +78,9 @@ void Pad::execute() const
     case DataType::FLOAT32:
     {
       const float pad_value = 0.0f;
-      tflite::reference_ops::Pad(params, getTensorShape(input()), getTensorData<float>(input()),
-                                 &pad_value, getTensorShape(output()),
-                                 getTensorData<float>(output()));
+      luci_interpreter_pal::Pad(params, getTensorShape(input()), getTensorData<float>(input()),
+                                &pad_value, getTensorShape(output()),
+                                getTensorData<float>(output()));
       break;
     }
     case DataType::U8:
@@ -88,9 +88,9 @@ void Pad::execute() const
       assert(output()->zero_point() >= std::numeric_limits<uint8_t>::min());
       assert(output()->zero_point() <= std::numeric_limits<uint8_t>::max());
       const auto pad_value = static_cast<uint8_t>(output()->zero_point());
-      tflite::reference_ops::Pad(params, getTensorShape(input()), getTensorData<uint8_t>(input()),
-                                 &pad_value, getTensorShape(output()),
-                                 getTensorData<uint8_t>(output()));
+      luci_interpreter_pal::Pad(params, getTensorShape(input()), getTensorData<uint8_t>(input()),
+                                &pad_value, getTensorShape(output()),
+                                getTensorData<uint8_t>(output()));
       break;
     }
     case DataType::S8:
@@ -98,9 +98,18 @@ void Pad::execute() const
       assert(output()->zero_point() >= std::numeric_limits<int8_t>::min());
       assert(output()->zero_point() <= std::numeric_limits<int8_t>::max());
       const auto pad_value = static_cast<int8_t>(output()->zero_point());
-      tflite::reference_ops::Pad(params, getTensorShape(input()), getTensorData<int8_t>(input()),
-                                 &pad_value, getTensorShape(output()),
-                                 getTensorData<int8_t>(output()));
+      luci_interpreter_pal::Pad(params, getTensorShape(input()), getTensorData<int8_t>(input()),
+                                &pad_value, getTensorShape(output()),
+                                getTensorData<int8_t>(output()));
+      break;
+    }
+    case DataType::S16:
+    {
+      assert(output()->zero_point() == 0);
+      const int16_t pad_value = 0;
+      luci_interpreter_pal::Pad(params, getTensorShape(input()), getTensorData<int16_t>(input()),
+                                &pad_value, getTensorShape(output()),
+                                getTensorData<int16_t>(output()));
       break;
     }
     default:
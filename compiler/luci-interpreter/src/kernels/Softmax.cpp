@@ -21,6 +21,7 @@
 #include <tensorflow/lite/kernels/internal/reference/softmax.h>
 #include "PALSoftmax.h"
 
+#include <cmath>
 #include <stdexcept>
 
 namespace luci_interpreter
@@ -47,6 +48,19 @@ void Softmax::configure()
     op_params.table = _table;
     luci_interpreter_pal::PopulateSoftmaxLookupTable(&op_params, input()->scale(), params().beta);
   }
+  else if (input()->element_type() == DataType::S16)
+  {
+    LUCI_INTERPRETER_CHECK(input()->zero_point() == 0 && output()->zero_point() == 0);
+    // The last element of each table is used only for the slope of interpolation
+    constexpr int lut_size = 513;
+    _exp_lut.resize(lut_size);
+    _one_over_one_plus_x_lut.resize(lut_size);
+    // exp(-10.0) is insignificant to accumulation, so exp table covers [-10.0, 0.0] only
+    tflite::gen_lut([](double value) { return std::exp(value); }, -10.0, 0.0, _exp_lut.data(),
+                    lut_size);
+    tflite::gen_lut([](double value) { return 1.0 / (1.0 + value); }, 0.0, 1.0,
+                    _one_over_one_plus_x_lut.data(), lut_size);
+  }
   output()->resize(input()->shape());
 }
 
@@ -63,6 +77,9 @@ void Softmax::execute() const
     case DataType::U8:
       evalQuantized<uint8_t>();
       break;
+    case DataType::S16:
+      evalQuantizedS16();
+      break;
     default:
       throw std::runtime_error("Unsupported type.");
   }
@@ -88,5 +105,23 @@ template <typename T> void Softmax::evalQuantized() const
                                 getTensorShape(output()), getTensorData<T>(output()));
 }
 
+void Softmax::evalQuantizedS16() const
+{
+  tflite::SoftmaxParams op_params{};
+  op_params.exp_lut = const_cast<int16_t *>(_exp_lut.data());
+  op_params.one_over_one_plus_x_lut = const_cast<int16_t *>(_one_over_one_plus_x_lut.data());
+  op_params.zero_point = output()->zero_point();
+  op_params.scale = output()->scale();
+  // Differences of inputs in [-65535, 0] correspond to [-10.0, 0.0] of exp table
+  const double input_scale_beta_rescale =
+    static_cast<double>(input()->scale()) * params().beta / (10.0 / 65535.0);
+  quantizeMultiplier(input_scale_beta_rescale, &op_params.input_multiplier,
+                     &op_params.input_left_shift);
+
+  tflite::reference_ops::SoftmaxInt16(op_params, getTensorShape(input()),
+                                      getTensorData<int16_t>(input()), getTensorShape(output()),
+                                      getTensorData<int16_t>(output()));
+}
+
 } // namespace kernels
 } // namespace luci_interpreter
@@ -20,6 +20,8 @@
 #include "core/Kernel.h"
 #include "core/KernelParams.h"
 
+#include <vector>
+
 namespace luci_interpreter
 {
 namespace kernels
@@ -39,8 +41,12 @@ public:
 private:
   void evalFloat() const;
   template <typename T> void evalQuantized() const;
+  void evalQuantizedS16() const;
 
   float _table[256];
+  // Lookup tables of int16 softmax, empty for other types
+  std::vector<int16_t> _exp_lut;
+  std::vector<int16_t> _one_over_one_plus_x_lut;
 };
 
 } // namespace kernels
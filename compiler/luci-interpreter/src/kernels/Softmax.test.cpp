@@ -112,6 +112,54 @@ TYPED_TEST(SoftmaxTest, Simple)
                    });
 }
 
+TEST(SoftmaxS16Test, Simple)
+{
+  std::unique_ptr<IMemoryManager> memory_manager = std::make_unique<TestMemoryManager>();
+
+  std::vector<float> input_data{
+    5,  -9, 8,  //
+    -7, 2,  -4, //
+    1,  -2, 9,  //
+    3,  -6, -1, //
+  };
+  std::vector<float> ref_output_data{
+    0.38514, 0.09497, 0.51989, //
+    0.20792, 0.51141, 0.28067, //
+    0.25212, 0.18678, 0.56110, //
+    0.48149, 0.19576, 0.32275, //
+  };
+  Tensor input_tensor = makeInputTensor<DataType::S16>({2, 1, 2, 3}, 10.0 / 32767, 0, input_data,
+                                                       memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::S16, 1.0 / 32768, 0);
+
+  SoftmaxParams params{};
+  params.beta = 0.1;
+
+  Softmax kernel(&input_tensor, &output_tensor, params);
+  kernel.configure();
+  memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 1, 2, 3}));
+  EXPECT_THAT(dequantizeTensorData(output_tensor), FloatArrayNear(ref_output_data, 1.0e-3f));
+}
+
+TEST(SoftmaxS16Test, ZeroPoint_NEG)
+{
+  std::unique_ptr<IMemoryManager> memory_manager = std::make_unique<TestMemoryManager>();
+
+  std::vector<float> input_data{1, 2, 3, 4};
+  Tensor input_tensor =
+    makeInputTensor<DataType::S16>({1, 4}, 0.1, 3, input_data, memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::S16, 1.0 / 32768, 0);
+
+  SoftmaxParams params{};
+  params.beta = 1.0;
+
+  Softmax kernel(&input_tensor, &output_tensor, params);
+  EXPECT_ANY_THROW(kernel.configure());
+}
+
 } // namespace
 } // namespace kernels
 } // namespace luci_interpreter
@@ -78,6 +78,10 @@ void Squeeze::execute() const
 
   const auto *input_data = input()->data<void>();
   auto *output_data = output()->data<void>();
+  // Output shares the memory of input if the kernel is executed in place
+  if (output_data == input_data)
+    return;
+
   std::memcpy(output_data, input_data,
               getDataTypeSize(input()->element_type()) * input()->shape().num_elements());
 }
@@ -157,6 +157,27 @@ bool isTensorProducingNode(const luci::CircleNode *node)
   }
 }
 
+// Kernels of these operators compute each output element from the input element at the same
+// position only, or just copy the input, so they may write the output over the input
+bool isInplaceOperator(const luci::CircleNode *node)
+{
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::ELU:
+    case luci::CircleOpcode::EXPAND_DIMS:
+    case luci::CircleOpcode::LEAKY_RELU:
+    case luci::CircleOpcode::LOGISTIC:
+    case luci::CircleOpcode::RELU:
+    case luci::CircleOpcode::RELU6:
+    case luci::CircleOpcode::RESHAPE:
+    case luci::CircleOpcode::SQUEEZE:
+    case luci::CircleOpcode::TANH:
+      return true;
+    default:
+      return false;
+  }
+}
+
 bool isSupportedCustomNode(const luci::CircleNode *node)
 {
   const auto custom_node = loco::must_cast<const luci::CircleCustom *>(node);
@@ -235,8 +256,10 @@ void GraphLoader::loadTensors()
       const void *const_data = getNodeData(const_node, &data_size);
       if (const_data != nullptr)
       {
-        _memory_manager->allocate_memory(*tensor);
-        tensor->writeData(const_data, data_size);
+        // Constant data is referred, not copied, so that interpreters of the same module share it.
+        // Kernels never write to constant tensors.
+        tensor->set_allocatable(false);
+        tensor->set_data_buffer(const_cast<uint8_t *>(static_cast<const uint8_t *>(const_data)));
       }
     }
     else if (const auto *custom_out_node = dynamic_cast<const luci::CircleCustomOut *>(node))
@@ -248,7 +271,14 @@ void GraphLoader::loadTensors()
       {
         size_t data_size{};
         const void *const_data = getNodeData(custom_node, &data_size);
-        if (const_data != nullptr)
+        // Data is executed in place from the model, e.g. in flash, if kernels can read it
+        const auto element_size = getDataTypeSize(tensor->element_type());
+        if (const_data != nullptr && reinterpret_cast<uintptr_t>(const_data) % element_size == 0)
+        {
+          tensor->set_allocatable(false);
+          tensor->set_data_buffer(const_cast<uint8_t *>(static_cast<const uint8_t *>(const_data)));
+        }
+        else if (const_data != nullptr)
         {
           _memory_manager->allocate_memory(*tensor);
           tensor->writeData(const_data, data_size);
@@ -319,6 +349,7 @@ void GraphLoader::loadOperators()
       if (isExecutableNode(node))
       {
         std::unique_ptr<Kernel> kernel = kernel_builder.build(node);
+        kernel->setInplace(isInplaceOperator(node));
         _runtime_to_ir.kernel_to_node.emplace(kernel.get(), node);
         _runtime_graph->addKernel(std::move(kernel));
       }
@@ -334,6 +365,7 @@ void GraphLoader::loadOperators()
       if (isExecutableNode(node))
       {
         std::unique_ptr<Kernel> kernel = kernel_builder.build(node);
+        kernel->setInplace(isInplaceOperator(node));
         _runtime_to_ir.kernel_to_node.emplace(kernel.get(), node);
         _runtime_graph->addKernel(std::move(kernel));
       }
@@ -34,11 +34,14 @@
 #include <kernels/FloorDiv.h>
 #include <kernels/Equal.h>
 #include <kernels/FullyConnected.h>
+#include <kernels/Gelu.h>
 #include <kernels/Greater.h>
 #include <kernels/GreaterEqual.h>
+#include <kernels/HardSwish.h>
 #include <kernels/InstanceNorm.h>
 #include <kernels/L2Normalize.h>
 #include <kernels/L2Pool2D.h>
+#include <kernels/LayerNorm.h>
 #include <kernels/LeakyRelu.h>
 #include <kernels/Less.h>
 #include <kernels/LessEqual.h>
@@ -470,6 +473,23 @@ TEST_F(KernelBuilderTest, FullyConnected)
   EXPECT_THAT(kernel->params().activation, Eq(op->fusedActivationFunction()));
 }
 
+TEST_F(KernelBuilderTest, Gelu)
+{
+  auto *input = createInputNode();
+
+  auto *op = createNode<luci::CircleGelu>();
+  op->features(input);
+
+  op->approximate(true);
+
+  auto kernel = buildKernel<kernels::Gelu>(op);
+  ASSERT_THAT(kernel, NotNull());
+
+  checkTensor(kernel->input(), input);
+  checkTensor(kernel->output(), op);
+  EXPECT_THAT(kernel->params().approximate, Eq(op->approximate()));
+}
+
 TEST_F(KernelBuilderTest, Greater)
 {
   auto *x_input = createInputNode();
@@ -504,6 +524,20 @@ TEST_F(KernelBuilderTest, GreaterEqual)
   checkTensor(kernel->output(), op);
 }
 
+TEST_F(KernelBuilderTest, HardSwish)
+{
+  auto *input = createInputNode();
+
+  auto *op = createNode<luci::CircleHardSwish>();
+  op->features(input);
+
+  auto kernel = buildKernel<kernels::HardSwish>(op);
+  ASSERT_THAT(kernel, NotNull());
+
+  checkTensor(kernel->input(), input);
+  checkTensor(kernel->output(), op);
+}
+
 TEST_F(KernelBuilderTest, InstanceNorm)
 {
   auto *input = createInputNode();
@@ -573,6 +607,29 @@ TEST_F(KernelBuilderTest, L2Pool2D)
   EXPECT_THAT(kernel->params().activation, Eq(op->fusedActivationFunction()));
 }
 
+TEST_F(KernelBuilderTest, LayerNorm)
+{
+  auto *input = createInputNode();
+  auto *gamma = createInputNode();
+  auto *beta = createInputNode();
+
+  auto *op = createNode<luci::CircleLayerNorm>();
+  op->input(input);
+  op->gamma(gamma);
+  op->beta(beta);
+
+  op->epsilon(1e-05);
+
+  auto kernel = buildKernel<kernels::LayerNorm>(op);
+  ASSERT_THAT(kernel, NotNull());
+
+  checkTensor(kernel->input(), input);
+  checkTensor(kernel->gamma(), gamma);
+  checkTensor(kernel->beta(), beta);
+  checkTensor(kernel->output(), op);
+  EXPECT_THAT(kernel->params().epsilon, Eq(op->epsilon()));
+}
+
 TEST_F(KernelBuilderTest, LeakyRelu)
 {
   auto *input = createInputNode();
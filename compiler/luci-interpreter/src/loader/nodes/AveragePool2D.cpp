@@ -56,7 +56,7 @@ std::unique_ptr<Kernel> build_kernel_CircleAveragePool2D(const luci::CircleNode
       // If this is true, then we keep this offset in scratchpad.
       scratchpad->set_offset(execution_plan.offsets().at(1));
   }
-  Tensor *tmp = helper.getRuntimeGraph(node->graph())->addTensor(std::move(scratchpad));
+  Tensor *tmp = helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(scratchpad));
 
   return std::make_unique<kernels::AveragePool2D>(input, output, tmp, params);
 }
@@ -57,8 +57,10 @@ std::unique_ptr<Kernel> build_kernel_CircleBatchMatMul(const luci::CircleNode *c
       rhs_scratchpad->set_offset(execution_plan.offsets().at(2));
     }
   }
-  Tensor *lhs_tmp = helper.getRuntimeGraph(node->graph())->addTensor(std::move(lhs_scratchpad));
-  Tensor *rhs_tmp = helper.getRuntimeGraph(node->graph())->addTensor(std::move(rhs_scratchpad));
+  Tensor *lhs_tmp =
+    helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(lhs_scratchpad));
+  Tensor *rhs_tmp =
+    helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(rhs_scratchpad));
 
   BatchMatMulParams params;
   params.adj_x = node->adj_x();
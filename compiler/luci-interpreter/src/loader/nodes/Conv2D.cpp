@@ -50,7 +50,7 @@ std::unique_ptr<Kernel> build_kernel_CircleConv2D(const luci::CircleNode *circle
       // If this is true, then we keep this offset in scratchpad.
       scratchpad->set_offset(execution_plan.offsets().at(1));
   }
-  Tensor *tmp = helper.getRuntimeGraph(node->graph())->addTensor(std::move(scratchpad));
+  Tensor *tmp = helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(scratchpad));
 
   Conv2DParams params{};
   params.padding = node->padding();
@@ -59,7 +59,7 @@ std::unique_ptr<Kernel> build_kernel_CircleDepthwiseConv2D(const luci::CircleNod
       // If this is true, then we keep this offset in scratchpad.
       scratchpad->set_offset(execution_plan.offsets().at(1));
   }
-  Tensor *tmp = helper.getRuntimeGraph(node->graph())->addTensor(std::move(scratchpad));
+  Tensor *tmp = helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(scratchpad));
 
   return std::make_unique<kernels::DepthwiseConv2D>(input, filter, bias, output, tmp, params);
 }
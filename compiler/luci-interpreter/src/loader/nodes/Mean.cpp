@@ -36,20 +36,23 @@ std::unique_ptr<Kernel> build_kernel_CircleMean(const luci::CircleNode *circle_n
   temp_index_unique->set_observable(false);
   temp_index_unique->set_data_buffer(nullptr);
   Tensor *temp_index =
-    helper.getRuntimeGraph(node->graph())->addTensor(std::move(temp_index_unique));
+    helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(temp_index_unique));
 
   auto resolved_axes_unique =
     std::make_unique<Tensor>(DataType::S32, Shape({}), AffineQuantization{}, "");
   resolved_axes_unique->set_observable(false);
   resolved_axes_unique->set_data_buffer(nullptr);
   Tensor *resolved_axes =
-    helper.getRuntimeGraph(node->graph())->addTensor(std::move(resolved_axes_unique));
+    helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(resolved_axes_unique));
 
-  auto temp_sum_unique =
-    std::make_unique<Tensor>(input->element_type(), Shape({}), AffineQuantization{}, "");
+  // Quantized values are summed up in 32 bit integers
+  const DataType sum_type =
+    input->element_type() == DataType::FLOAT32 ? DataType::FLOAT32 : DataType::S32;
+  auto temp_sum_unique = std::make_unique<Tensor>(sum_type, Shape({}), AffineQuantization{}, "");
   temp_sum_unique->set_observable(false);
   temp_sum_unique->set_data_buffer(nullptr);
-  Tensor *temp_sum = helper.getRuntimeGraph(node->graph())->addTensor(std::move(temp_sum_unique));
+  Tensor *temp_sum =
+    helper.getRuntimeGraph(node->graph())->addScratchpadTensor(std::move(temp_sum_unique));
 
   ReducerParams params{};
   params.keep_dims = node->keep_dims();
@@ -22,12 +22,23 @@
 #include <loco.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace luci
 {
 
 class CircleExporter
 {
+public:
+  // Values of a constant in the weight file, which are referred and not copied
+  struct WeightChunk
+  {
+    uint64_t offset;
+    const char *ptr;
+    size_t size;
+  };
+
 public:
   // This contract class describes the interaction between a exporter and its client.
   struct Contract
@@ -45,10 +56,20 @@ public:
     // TODO make this pure virtual
     virtual luci::Module *module(void) const;
 
+    // Name of the file to store values of constants in, instead of the model. It is recorded in
+    // "ONE_weight_file" metadata, where a relative name is from the directory of the model.
+    // Values are stored in the model if it is empty.
+    virtual std::string weight_file(void) const { return ""; }
+
   public: // Exporter -> Client
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Exporter calls store_weights before store if weight_file is not empty. chunks are in the
+    // order of their offsets in the weight file of 'size' bytes, and gaps between them are padding.
+    // Notice: Please DO NOT STORE ptr of chunks when implementing this in Client
+    virtual bool store_weights(const std::vector<WeightChunk> &chunks, const size_t size) const;
   };
 
 public:
@@ -57,6 +78,18 @@ public:
 public:
   // invoke(...) returns false on failure.
   bool invoke(Contract *) const;
+
+public:
+  // Number of threads serializing values of constants (default: 1)
+  void num_threads(uint32_t num_threads) { _num_threads = num_threads; }
+
+  // Align buffers of constants not smaller than alignment to it, instead of 16 bytes.
+  // alignment should be a power of 2 not less than 16, e.g. 64 for SIMD or 4096 for pages.
+  void buffer_alignment(uint32_t alignment);
+
+private:
+  uint32_t _num_threads = 1;
+  uint32_t _buffer_alignment = 16;
 };
 
 } // namespace luci
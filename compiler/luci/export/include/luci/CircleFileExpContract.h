@@ -22,9 +22,11 @@
 #include <luci/IR/Module.h>
 #include <oops/InternalExn.h>
 
+#include <algorithm>
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 namespace luci
 {
@@ -37,11 +39,22 @@ public:
   {
     // NOTHING TO DO
   }
+  /**
+   * @brief Contract storing values of constants in 'weight_filename', instead of the model
+   * @note  A relative 'weight_filename' is from the directory of 'filename'
+   */
+  CircleFileExpContract(luci::Module *module, const std::string &filename,
+                        const std::string &weight_filename)
+    : _module(module), _filepath(filename), _weight_filename(weight_filename)
+  {
+    // NOTHING TO DO
+  }
   virtual ~CircleFileExpContract() = default;
 
 public:
   loco::Graph *graph(void) const final { return nullptr; }
   luci::Module *module(void) const final { return _module; }
+  std::string weight_file(void) const final { return _weight_filename; }
 
 public:
   bool store(const char *ptr, const size_t size) const final
@@ -55,9 +68,42 @@ public:
     return fs.good();
   }
 
+  bool store_weights(const std::vector<CircleExporter::WeightChunk> &chunks,
+                     const size_t size) const final
+  {
+    std::string weight_path = _weight_filename;
+    const auto slash = _filepath.find_last_of('/');
+    if (weight_path.front() != '/' && slash != std::string::npos)
+      weight_path = _filepath.substr(0, slash + 1) + weight_path;
+
+    std::ofstream fs(weight_path, std::ofstream::binary);
+
+    // Values are written in place from constants, with zeros padding them to their offsets
+    static const char zeros[4096] = {};
+    uint64_t written = 0;
+    auto pad_to = [&](uint64_t offset) {
+      while (written < offset)
+      {
+        const auto count = std::min<uint64_t>(offset - written, sizeof(zeros));
+        fs.write(zeros, count);
+        written += count;
+      }
+    };
+    for (const auto &chunk : chunks)
+    {
+      pad_to(chunk.offset);
+      fs.write(chunk.ptr, chunk.size);
+      written += chunk.size;
+    }
+    pad_to(size);
+
+    return fs.good();
+  }
+
 private:
   luci::Module *_module;
   const std::string _filepath;
+  const std::string _weight_filename;
 };
 
 } // namespace luci
@@ -191,6 +191,10 @@ public:
   {
     return circle::CreateGreaterEqualOptions(_builder).Union();
   }
+  flatbuffers::Offset<void> visit(luci::CircleHardSwish *)
+  {
+    return circle::CreateHardSwishOptions(_builder).Union();
+  }
   flatbuffers::Offset<void> visit(luci::CircleIf *node)
   {
     return circle::CreateIfOptions(_builder, node->then_branch(), node->else_branch()).Union();
@@ -520,12 +524,20 @@ public:
     return circle::CreateBCQGatherOptions(_builder, node->input_hidden_size(), node->axis())
       .Union();
   }
+  flatbuffers::Offset<void> visit(luci::CircleGelu *node)
+  {
+    return circle::CreateGeluOptions(_builder, node->approximate()).Union();
+  }
   flatbuffers::Offset<void> visit(luci::CircleInstanceNorm *node)
   {
     return circle::CreateInstanceNormOptions(_builder, node->epsilon(),
                                              to_circle_actfunc(node->fusedActivationFunction()))
       .Union();
   }
+  flatbuffers::Offset<void> visit(luci::CircleLayerNorm *node)
+  {
+    return circle::CreateLayerNormOptions(_builder, node->epsilon()).Union();
+  }
 
 protected:
   flatbuffers::FlatBufferBuilder &_builder;
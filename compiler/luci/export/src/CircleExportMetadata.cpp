@@ -69,6 +69,37 @@ const std::vector<uint8_t> CircleExportMetadata::encoded_execution_plan_table()
   return data;
 }
 
+// 'tensor_offset_table' is encoded to binary format.
+const std::vector<uint8_t> CircleExportMetadata::encoded_tensor_offset_table(void)
+{
+  std::vector<uint8_t> data;
+
+  write_u32(data, _tensor_offset_table.size());
+
+  for (auto &kv : _tensor_offset_table)
+  {
+    write_u32(data, kv.first);
+    write_u32(data, kv.second);
+  }
+
+  return data;
+}
+
+// 'execution_order_table' is encoded to binary format, with operators in order of execution.
+const std::vector<uint8_t> CircleExportMetadata::encoded_execution_order_table(void)
+{
+  std::vector<uint8_t> data;
+
+  write_u32(data, _execution_order_table.size());
+
+  for (auto &kv : _execution_order_table)
+  {
+    write_u32(data, kv.second);
+  }
+
+  return data;
+}
+
 // 'source_table' is encoded to binary format.
 const std::vector<uint8_t> CircleExportMetadata::encoded_source_table(void)
 {
@@ -143,6 +174,17 @@ createCircleMetadataVector(flatbuffers::FlatBufferBuilder &builder, luci::Serial
   {
     metadata_vec.emplace_back(metadata_offset(
       builder, md, md._metadata.encoded_execution_plan_table(), "ONE_execution_plan_table"));
+
+    metadata_vec.emplace_back(metadata_offset(
+      builder, md, md._metadata.encoded_tensor_offset_table(), "ONE_tensor_offset_table"));
+
+    metadata_vec.emplace_back(metadata_offset(
+      builder, md, md._metadata.encoded_execution_order_table(), "ONE_execution_order_table"));
+  }
+  if (not md._weight_file.empty())
+  {
+    const std::vector<uint8_t> name(md._weight_file.begin(), md._weight_file.end());
+    metadata_vec.emplace_back(metadata_offset(builder, md, name, "ONE_weight_file"));
   }
   return metadata_vec;
 }
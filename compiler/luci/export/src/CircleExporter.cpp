@@ -29,36 +29,63 @@ namespace luci
 // TODO remove this
 Module *CircleExporter::Contract::module(void) const { return nullptr; }
 
+bool CircleExporter::Contract::store_weights(const std::vector<WeightChunk> &, const size_t) const
+{
+  // Client which names a weight file should store it
+  return false;
+}
+
 CircleExporter::CircleExporter()
 {
   // NOTHING TO DO
 }
 
+void CircleExporter::buffer_alignment(uint32_t alignment)
+{
+  if (alignment < 16 || (alignment & (alignment - 1)) != 0)
+    INTERNAL_EXN_V("Buffer alignment should be a power of 2 not less than 16", alignment);
+
+  _buffer_alignment = alignment;
+}
+
+namespace
+{
+
+bool store(const CircleExporter::Contract *contract, const CircleExporterImpl &impl)
+{
+  // NOTE Weights are stored first not to leave a model referring a weight file which is not there
+  if (not contract->weight_file().empty())
+  {
+    if (not contract->store_weights(impl.getWeightChunks(), impl.getWeightFileSize()))
+      return false;
+  }
+
+  const char *ptr = impl.getBufferPointer();
+  const size_t size = impl.getBufferSize();
+
+  // we just send one time
+  return contract->store(ptr, size);
+}
+
+} // namespace
+
 bool CircleExporter::invoke(Contract *contract) const
 {
+  const auto weight_file = contract->weight_file();
+
   auto module = contract->module();
   if (module != nullptr)
   {
-    CircleExporterImpl impl(module);
-
-    const char *ptr = impl.getBufferPointer();
-    const size_t size = impl.getBufferSize();
-
-    // we just send one time
-    return contract->store(ptr, size);
+    CircleExporterImpl impl(module, _num_threads, _buffer_alignment, weight_file);
+    return store(contract, impl);
   }
 
   auto graph = contract->graph();
   if (graph == nullptr)
     return false;
 
-  CircleExporterImpl impl(graph);
-
-  const char *ptr = impl.getBufferPointer();
-  const size_t size = impl.getBufferSize();
-
-  // we just send one time
-  return contract->store(ptr, size);
+  CircleExporterImpl impl(graph, _num_threads, _buffer_alignment, weight_file);
+  return store(contract, impl);
 }
 
 } // namespace luci
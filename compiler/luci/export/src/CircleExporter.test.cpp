@@ -17,6 +17,8 @@
 #include "luci/CircleExporter.h"
 
 #include <luci/Plan/CircleNodeExecutionPlan.h>
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
 #include <luci/IR/Nodes/CircleInput.h>
 #include <luci/IR/Nodes/CircleOutput.h>
 #include <luci/IR/Nodes/CircleRelu.h>
@@ -27,6 +29,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+
 class SampleGraphContract : public luci::CircleExporter::Contract
 {
 public:
@@ -81,6 +85,224 @@ private:
   std::unique_ptr<std::vector<char>> _buffer;
 };
 
+class ConstGraphContract : public luci::CircleExporter::Contract
+{
+public:
+  ConstGraphContract() : luci::CircleExporter::Contract()
+  {
+    _g = loco::make_graph();
+    auto graph_input = _g->inputs()->create();
+    auto graph_output = _g->outputs()->create();
+    input_node = _g->nodes()->create<luci::CircleInput>();
+    output_node = _g->nodes()->create<luci::CircleOutput>();
+    const_node = _g->nodes()->create<luci::CircleConst>();
+    add_node = _g->nodes()->create<luci::CircleAdd>();
+
+    add_node->x(input_node);
+    add_node->y(const_node);
+    add_node->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output_node->from(add_node);
+    input_node->index(graph_input->index());
+    output_node->index(graph_output->index());
+
+    input_node->name("input");
+    output_node->name("output");
+    const_node->name("const");
+    add_node->name("add");
+
+    input_node->dtype(loco::DataType::FLOAT32);
+    input_node->shape({1, 37});
+    const_node->dtype(loco::DataType::FLOAT32);
+    const_node->shape({1, 37});
+    const_node->size<loco::DataType::FLOAT32>(37);
+    for (uint32_t i = 0; i < 37; ++i)
+      const_node->at<loco::DataType::FLOAT32>(i) = static_cast<float>(i);
+    const_node->shape_status(luci::ShapeStatus::VALID);
+
+    graph_input->shape({1, 37});
+    graph_input->dtype(loco::DataType::FLOAT32);
+    graph_output->shape({1, 37});
+    graph_output->dtype(loco::DataType::FLOAT32);
+  }
+
+  loco::Graph *graph(void) const override { return _g.get(); }
+
+public:
+  bool store(const char *ptr, const size_t size) const override
+  {
+    _buffer.assign(ptr, ptr + size);
+    return true;
+  }
+
+  const std::vector<char> &get_buffer() { return _buffer; }
+
+public:
+  luci::CircleInput *input_node;
+  luci::CircleOutput *output_node;
+  luci::CircleConst *const_node;
+  luci::CircleAdd *add_node;
+
+private:
+  std::unique_ptr<loco::Graph> _g;
+  mutable std::vector<char> _buffer;
+};
+
+class WeightFileContract final : public ConstGraphContract
+{
+public:
+  std::string weight_file(void) const override { return "model.weights"; }
+
+  bool store_weights(const std::vector<luci::CircleExporter::WeightChunk> &chunks,
+                     const size_t size) const override
+  {
+    _weights.assign(size, 0);
+    for (const auto &chunk : chunks)
+      memcpy(_weights.data() + chunk.offset, chunk.ptr, chunk.size);
+    return true;
+  }
+
+  const std::vector<char> &get_weights() { return _weights; }
+
+private:
+  mutable std::vector<char> _weights;
+};
+
+TEST(CircleExport, export_const_buffer)
+{
+  ConstGraphContract contract;
+
+  luci::CircleExporter exporter;
+  exporter.num_threads(2);
+
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  const auto &data = contract.get_buffer();
+  ASSERT_FALSE(data.empty());
+  auto model = circle::GetModel(data.data());
+  ASSERT_NE(model, nullptr);
+
+  auto tensors = model->subgraphs()->Get(0)->tensors();
+  const circle::Buffer *buffer = nullptr;
+  for (uint32_t i = 0; i < tensors->size(); ++i)
+  {
+    if (tensors->Get(i)->name()->str() == "const")
+      buffer = model->buffers()->Get(tensors->Get(i)->buffer());
+  }
+  ASSERT_NE(buffer, nullptr);
+  ASSERT_EQ(37 * sizeof(float), buffer->data()->size());
+
+  // Values are aligned to 16 bytes from the beginning of the model
+  auto values = buffer->data()->data();
+  ASSERT_EQ(0, (values - reinterpret_cast<const uint8_t *>(data.data())) % 16);
+  for (uint32_t i = 0; i < 37; ++i)
+  {
+    float value;
+    memcpy(&value, values + i * sizeof(float), sizeof(float));
+    ASSERT_EQ(static_cast<float>(i), value);
+  }
+}
+
+TEST(CircleExport, export_buffer_alignment)
+{
+  for (uint32_t alignment : {64u, 4096u})
+  {
+    ConstGraphContract contract;
+
+    luci::CircleExporter exporter;
+    exporter.buffer_alignment(alignment);
+
+    ASSERT_TRUE(exporter.invoke(&contract));
+
+    const auto &data = contract.get_buffer();
+    auto model = circle::GetModel(data.data());
+    ASSERT_NE(model, nullptr);
+
+    // constant of 148 bytes is aligned only when it is not smaller than alignment
+    auto tensors = model->subgraphs()->Get(0)->tensors();
+    for (uint32_t i = 0; i < tensors->size(); ++i)
+    {
+      if (tensors->Get(i)->name()->str() != "const")
+        continue;
+      auto values = model->buffers()->Get(tensors->Get(i)->buffer())->data()->data();
+      auto offset = values - reinterpret_cast<const uint8_t *>(data.data());
+      ASSERT_EQ(0, offset % 16);
+      if (alignment == 64)
+        ASSERT_EQ(0, offset % alignment);
+    }
+  }
+}
+
+TEST(CircleExport, export_weight_file)
+{
+  WeightFileContract contract;
+
+  luci::CircleExporter exporter;
+  exporter.buffer_alignment(64);
+
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  const auto &data = contract.get_buffer();
+  auto model = circle::GetModel(data.data());
+  ASSERT_NE(model, nullptr);
+
+  // Name of the weight file is in metadata
+  const circle::Metadata *weight_file = nullptr;
+  for (uint32_t i = 0; i < model->metadata()->size(); ++i)
+  {
+    if (model->metadata()->Get(i)->name()->str() == "ONE_weight_file")
+      weight_file = model->metadata()->Get(i);
+  }
+  ASSERT_NE(weight_file, nullptr);
+  auto name = model->buffers()->Get(weight_file->buffer())->data();
+  ASSERT_EQ("model.weights", std::string(name->begin(), name->end()));
+
+  // Values of the constant are at an aligned, non-zero offset of the weight file
+  auto tensors = model->subgraphs()->Get(0)->tensors();
+  const circle::Buffer *buffer = nullptr;
+  for (uint32_t i = 0; i < tensors->size(); ++i)
+  {
+    if (tensors->Get(i)->name()->str() == "const")
+      buffer = model->buffers()->Get(tensors->Get(i)->buffer());
+  }
+  ASSERT_NE(buffer, nullptr);
+  ASSERT_EQ(nullptr, buffer->data());
+  ASSERT_EQ(64, buffer->offset());
+  ASSERT_EQ(37 * sizeof(float), buffer->size());
+
+  const auto &weights = contract.get_weights();
+  ASSERT_EQ(buffer->offset() + buffer->size(), weights.size());
+  for (uint32_t i = 0; i < 37; ++i)
+  {
+    float value;
+    memcpy(&value, weights.data() + buffer->offset() + i * sizeof(float), sizeof(float));
+    ASSERT_EQ(static_cast<float>(i), value);
+  }
+}
+
+TEST(CircleExport, export_weight_file_not_stored_NEG)
+{
+  // Contract names a weight file without storing it
+  class NoStoreContract final : public ConstGraphContract
+  {
+  public:
+    std::string weight_file(void) const override { return "model.weights"; }
+  };
+  NoStoreContract contract;
+
+  luci::CircleExporter exporter;
+
+  ASSERT_FALSE(exporter.invoke(&contract));
+  ASSERT_TRUE(contract.get_buffer().empty());
+}
+
+TEST(CircleExport, export_buffer_alignment_NEG)
+{
+  luci::CircleExporter exporter;
+
+  EXPECT_ANY_THROW(exporter.buffer_alignment(8));
+  EXPECT_ANY_THROW(exporter.buffer_alignment(48));
+}
+
 TEST(CircleExport, export_execution_plan)
 {
   SampleGraphContract contract;
@@ -117,6 +339,64 @@ TEST(CircleExport, export_execution_plan)
             reference_offset); // this value goes from CircleNodeExecutionPlan initialization
 }
 
+TEST(CircleExport, export_tensor_offset_table)
+{
+  SampleGraphContract contract;
+  uint32_t reference_offset = 100u;
+  luci::add_execution_plan(contract.relu_node,
+                           luci::CircleNodeExecutionPlan(1, {reference_offset}));
+
+  luci::UserSettings::settings()->set(luci::UserSettings::ExecutionPlanGen, true);
+  luci::CircleExporter exporter;
+
+  exporter.invoke(&contract);
+
+  ASSERT_FALSE(contract.get_buffer().empty());
+  std::unique_ptr<circle::ModelT> model(circle::GetModel(contract.get_buffer().data())->UnPack());
+  ASSERT_NE(model.get(), nullptr);
+  ASSERT_EQ(model->metadata.size(), 3);
+  ASSERT_EQ(model->metadata[1]->name, "ONE_tensor_offset_table");
+  auto metadata_buffer = model->metadata[1]->buffer;
+  auto &buffer = model->buffers[metadata_buffer]->data;
+  ASSERT_EQ(buffer.size(), 12);
+  uint32_t *raw_table_contents = reinterpret_cast<uint32_t *>(buffer.data());
+
+  auto num_entries = raw_table_contents[0];
+  ASSERT_EQ(num_entries, 1);
+  auto tensor_id = raw_table_contents[1];
+  auto &operators = model->subgraphs[0]->operators;
+  ASSERT_EQ(operators.size(), 1);
+  ASSERT_EQ(tensor_id, static_cast<uint32_t>(operators[0]->outputs[0])); // output of relu
+  auto tensor_offset = raw_table_contents[2];
+  ASSERT_EQ(tensor_offset, reference_offset);
+}
+
+TEST(CircleExport, export_execution_order_table)
+{
+  SampleGraphContract contract;
+  luci::add_execution_plan(contract.relu_node, luci::CircleNodeExecutionPlan(1, {100u}));
+
+  luci::UserSettings::settings()->set(luci::UserSettings::ExecutionPlanGen, true);
+  luci::CircleExporter exporter;
+
+  exporter.invoke(&contract);
+
+  ASSERT_FALSE(contract.get_buffer().empty());
+  std::unique_ptr<circle::ModelT> model(circle::GetModel(contract.get_buffer().data())->UnPack());
+  ASSERT_NE(model.get(), nullptr);
+  ASSERT_EQ(model->metadata.size(), 3);
+  ASSERT_EQ(model->metadata[2]->name, "ONE_execution_order_table");
+  auto metadata_buffer = model->metadata[2]->buffer;
+  auto &buffer = model->buffers[metadata_buffer]->data;
+  ASSERT_EQ(buffer.size(), 8);
+  uint32_t *raw_table_contents = reinterpret_cast<uint32_t *>(buffer.data());
+
+  auto num_entries = raw_table_contents[0];
+  ASSERT_EQ(num_entries, 1);
+  auto operator_id = raw_table_contents[1];
+  ASSERT_EQ(operator_id, 0); // relu is the only operator
+}
+
 TEST(CircleExport, export_execution_plan_nosetting_NEG)
 {
   SampleGraphContract contract;
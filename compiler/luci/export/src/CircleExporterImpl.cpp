@@ -27,6 +27,7 @@
 #include <mio/circle/schema_generated.h>
 #include <flatbuffers/flatbuffers.h>
 
+#include <algorithm>
 #include <cassert>
 #include <unordered_map>
 #include <string>
@@ -64,6 +65,30 @@ void registerGraphOutputTensors(loco::Graph *graph, luci::SubGraphContext &ctx)
   }
 }
 
+/**
+ * @brief Return estimated size of model to reserve the builder at once
+ * @note  Values of constants dominate the size of large models. Other parts of a node are
+ *        roughly estimated.
+ */
+size_t estimate_size(const std::vector<loco::Graph *> &graphs, uint32_t buffer_alignment,
+                     bool external_weights)
+{
+  size_t size = 1024;
+  for (auto graph : graphs)
+  {
+    auto nodes = graph->nodes();
+    for (uint32_t n = 0; n < nodes->size(); ++n)
+    {
+      size += 256;
+      if (external_weights)
+        continue;
+      if (auto const_node = dynamic_cast<luci::CircleConst *>(nodes->at(n)))
+        size += const_node->bytes() + std::max<uint32_t>(buffer_alignment, 16);
+    }
+  }
+  return size;
+}
+
 } // namespace
 
 namespace
@@ -106,8 +131,19 @@ namespace luci
 using namespace circle;
 using namespace flatbuffers;
 
-CircleExporterImpl::CircleExporterImpl(loco::Graph *graph) { exportGraph(graph); }
-CircleExporterImpl::CircleExporterImpl(Module *module) { exportModule(module); }
+CircleExporterImpl::CircleExporterImpl(loco::Graph *graph, uint32_t num_threads,
+                                       uint32_t buffer_alignment, const std::string &weight_file)
+  : _num_threads(num_threads), _buffer_alignment(buffer_alignment), _weight_file(weight_file)
+{
+  exportGraph(graph);
+}
+
+CircleExporterImpl::CircleExporterImpl(Module *module, uint32_t num_threads,
+                                       uint32_t buffer_alignment, const std::string &weight_file)
+  : _num_threads(num_threads), _buffer_alignment(buffer_alignment), _weight_file(weight_file)
+{
+  exportModule(module);
+}
 
 ::flatbuffers::Offset<::circle::SubGraph>
 CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
@@ -127,11 +163,15 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   // do graph optimization
   optimize(graph);
 
-  _builder.Clear();
+  // NOTE Growing the builder would copy the whole model and keep both copies for a while
+  _builder = FlatBufferBuilder(estimate_size({graph}, _buffer_alignment, !_weight_file.empty()));
 
   SerializedModelData md;
   SerializedGraphData gd;
 
+  md._buffer_alignment = _buffer_alignment;
+  md._weight_file = _weight_file;
+
   // This version is taken from comment in fbs
   constexpr uint32_t version = 0;
 
@@ -145,7 +185,7 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   prepareModelData(_builder, md);
 
   // parse graph into SerializedModelData structure
-  exportOpDefinedTensors(graph, _builder, md, gd);
+  exportOpDefinedTensors(graph, _builder, md, gd, _num_threads);
 
   // NOTE Invoke these register functions only after each node is annotated with its tensor_index
   registerGraphInputTensors(graph, gd);
@@ -175,16 +215,31 @@ void CircleExporterImpl::exportGraph(loco::Graph *graph)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, 0 /* metadata_buffer */, metadata);
   FinishModelBuffer(_builder, model_offset);
+
+  fillBuffers(_builder, md, _num_threads);
+
+  _weights = std::move(md._weights);
+  _weight_file_size = md._weight_file_size;
 }
 
 void CircleExporterImpl::exportModule(Module *module)
 {
   assert(module->size() > 0);
   // do graph optimization
+  std::vector<loco::Graph *> graphs;
+  for (size_t g = 0; g < module->size(); ++g)
+  {
+    graphs.push_back(module->graph(g));
+    optimize(graphs.back());
+  }
 
   SerializedModelData md;
 
-  _builder.Clear();
+  md._buffer_alignment = _buffer_alignment;
+  md._weight_file = _weight_file;
+
+  // NOTE Growing the builder would copy the whole model and keep both copies for a while
+  _builder = FlatBufferBuilder(estimate_size(graphs, _buffer_alignment, !_weight_file.empty()));
 
   // prepare model data
   prepareModelData(_builder, md);
@@ -193,9 +248,7 @@ void CircleExporterImpl::exportModule(Module *module)
 
   for (size_t g = 0; g < module->size(); ++g)
   {
-    auto graph = module->graph(g);
-
-    optimize(graph);
+    auto graph = graphs.at(g);
 
     SerializedGraphData gd;
 
@@ -206,7 +259,7 @@ void CircleExporterImpl::exportModule(Module *module)
     gd._data_format = circle::DataFormat::DataFormat_CHANNELS_LAST;
 
     // parse graph into SerializedModelData structure
-    exportOpDefinedTensors(graph, _builder, md, gd);
+    exportOpDefinedTensors(graph, _builder, md, gd, _num_threads);
 
     // NOTE Invoke these register functions only after each node is annotated with its tensor_index
     registerGraphInputTensors(graph, gd);
@@ -243,6 +296,11 @@ void CircleExporterImpl::exportModule(Module *module)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, 0 /* metadata_buffer */, metadata);
   FinishModelBuffer(_builder, model_offset);
+
+  fillBuffers(_builder, md, _num_threads);
+
+  _weights = std::move(md._weights);
+  _weight_file_size = md._weight_file_size;
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
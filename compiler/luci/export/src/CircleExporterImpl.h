@@ -26,6 +26,9 @@
 
 #include <loco.h>
 
+#include <string>
+#include <vector>
+
 namespace luci
 {
 
@@ -38,8 +41,10 @@ public:
   CircleExporterImpl() = delete;
   ~CircleExporterImpl() = default;
 
-  explicit CircleExporterImpl(loco::Graph *graph);
-  explicit CircleExporterImpl(Module *module);
+  explicit CircleExporterImpl(loco::Graph *graph, uint32_t num_threads = 1,
+                              uint32_t buffer_alignment = 16, const std::string &weight_file = "");
+  explicit CircleExporterImpl(Module *module, uint32_t num_threads = 1,
+                              uint32_t buffer_alignment = 16, const std::string &weight_file = "");
 
   /**
    * @return pointer to buffer with serialized graph
@@ -51,6 +56,16 @@ public:
    */
   size_t getBufferSize() const;
 
+  /**
+   * @return values of constants to be stored in the weight file, in the order of offsets
+   */
+  const std::vector<CircleExporter::WeightChunk> &getWeightChunks() const { return _weights; }
+
+  /**
+   * @return size of the weight file
+   */
+  uint64_t getWeightFileSize() const { return _weight_file_size; }
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -73,6 +88,12 @@ private:
 
 private:
   flatbuffers::FlatBufferBuilder _builder;
+  uint32_t _num_threads = 1;
+  uint32_t _buffer_alignment = 16;
+  // Values of constants are stored in this file, instead of the model, if it is not empty
+  std::string _weight_file;
+  std::vector<CircleExporter::WeightChunk> _weights;
+  uint64_t _weight_file_size = 0;
 };
 
 } // namespace luci
@@ -16,6 +16,7 @@
 
 #include "CircleOperationExporter.h"
 #include "CircleOperationExporterRule.h"
+#include "CircleExporterUtils.h"
 
 #include <luci/IR/CircleNode.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -35,6 +36,7 @@ void exportNodes(loco::Graph *g, flatbuffers::FlatBufferBuilder &builder, Serial
     OperationExporterRule exporter_rule{ctx};
 
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    const auto operator_id = gd._operators.size();
     circle_node->accept(&exporter_rule);
 
     const auto ops_size = gd._operators.size();
@@ -59,6 +61,19 @@ void exportNodes(loco::Graph *g, flatbuffers::FlatBufferBuilder &builder, Serial
         execution_plan_vector.push_back(offset);
       }
       md._metadata.add_execution_plan_table(node_position, execution_plan_vector);
+
+      // Add offset of output tensor with tensor index, which does not depend on node_position
+      const auto tensor_index = get_tensor_index(circle_node);
+      if (tensor_index >= 0 && !execution_plan.offsets().empty())
+      {
+        md._metadata.add_tensor_offset_table(tensor_index, execution_plan.offsets()[0]);
+      }
+
+      // Add operator of node with its order of execution
+      if (gd._operators.size() != operator_id)
+      {
+        md._metadata.add_execution_order_table(execution_plan.order_in_plan(), operator_id);
+      }
     }
 
     node_position++;
@@ -28,6 +28,11 @@
 #include <loco/IR/DataTypeTraits.h>
 #include <oops/InternalExn.h>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+
 #include <string.h>
 
 using namespace circle;
@@ -338,32 +343,57 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder)
 }
 
 template <typename NodeT>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, NodeT *)
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   SerializedModelData &, NodeT *)
 {
   return CreateBuffer(builder);
 }
 
 template <loco::DataType DT>
 flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+                                                          SerializedModelData &md,
+                                                          const luci::CircleConst *c)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
+  // NOTE Values are read by const accessors not to copy values which CircleConst only refers
   const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
+  const size_t raw_size = size * sizeof(NativeType);
+  const auto raw_data = size > 0 ? reinterpret_cast<const uint8_t *>(&c->at<DT>(0)) : nullptr;
+
+  if (not md._weight_file.empty())
   {
-    raw_data.push_back(c->at<DT>(i));
+    if (raw_size == 0)
+      return CreateBuffer(builder);
+
+    // Values are written to the weight file straight from the constant by the client
+    // NOTE Offset 0 is of buffers with values in data, so the weight file begins with padding
+    const uint64_t alignment = raw_size >= md._buffer_alignment ? md._buffer_alignment : 16;
+    const uint64_t begin = std::max<uint64_t>(md._weight_file_size, 1);
+    const uint64_t offset = (begin + alignment - 1) / alignment * alignment;
+    md._weights.push_back({offset, reinterpret_cast<const char *>(raw_data), raw_size});
+    md._weight_file_size = offset + raw_size;
+    return CreateBuffer(builder, 0, offset, raw_size);
   }
-  const size_t raw_size = size * sizeof(NativeType);
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
+
+  // Space for values is aligned as schema requires and values are copied by fillBuffers()
+  // NOTE Buffers not smaller than _buffer_alignment are aligned to it, so that runtimes can map
+  //      them to pages or use them with aligned SIMD loads in place
+  if (raw_size >= md._buffer_alignment)
+    builder.PreAlign(raw_size, md._buffer_alignment);
+  else
+    builder.ForceVectorAlignment(raw_size, sizeof(uint8_t), 16);
+  uint8_t *space = nullptr;
+  auto array_offset = builder.CreateUninitializedVector(raw_size, &space);
+  if (raw_size > 0)
+    md._deferred_buffers.push_back({array_offset.o, raw_data, raw_size});
   return CreateBuffer(builder, array_offset);
 }
 
 template <>
 flatbuffers::Offset<circle::Buffer>
-encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder, luci::CircleConst *c)
+encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder, SerializedModelData &,
+                                              const luci::CircleConst *c)
 {
   const uint32_t count = c->size<loco::DataType::STRING>();
   uint32_t raw_size = sizeof(int32_t) * (count + 2);
@@ -405,31 +435,33 @@ encodeOpBufferByDType<loco::DataType::STRING>(FlatBufferBuilder &builder, luci::
     data += length;
   }
 
+  builder.ForceVectorAlignment(raw_size, sizeof(uint8_t), 16);
   auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
 template <>
-flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
+flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
+                                                   SerializedModelData &md, luci::CircleConst *c)
 {
   switch (c->dtype())
   {
     case loco::DataType::FLOAT32:
-      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, md, c);
     case loco::DataType::S8:
-      return encodeOpBufferByDType<loco::DataType::S8>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S8>(builder, md, c);
     case loco::DataType::S16:
-      return encodeOpBufferByDType<loco::DataType::S16>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S16>(builder, md, c);
     case loco::DataType::S32:
-      return encodeOpBufferByDType<loco::DataType::S32>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S32>(builder, md, c);
     case loco::DataType::S64:
-      return encodeOpBufferByDType<loco::DataType::S64>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::S64>(builder, md, c);
     case loco::DataType::U8:
-      return encodeOpBufferByDType<loco::DataType::U8>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::U8>(builder, md, c);
     case loco::DataType::BOOL:
-      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, md, c);
     case loco::DataType::STRING:
-      return encodeOpBufferByDType<loco::DataType::STRING>(builder, c);
+      return encodeOpBufferByDType<loco::DataType::STRING>(builder, md, c);
     default:
       break;
   }
@@ -491,7 +523,8 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci::CircleConst *rhs)
+template <loco::DataType DT>
+bool has_same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   assert(lhs->dtype() == DT);
   assert(rhs->dtype() == DT);
@@ -503,7 +536,7 @@ template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci
   return true;
 }
 
-bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
+bool has_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   if (lhs->dtype() != rhs->dtype())
     return false;
@@ -545,25 +578,97 @@ bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
   return false;
 }
 
-uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md, luci::CircleConst *node)
+inline void hash_combine(size_t &seed, size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+template <loco::DataType DT> size_t hash_elements(const luci::CircleConst *node, size_t seed)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
+
+  for (uint32_t i = 0; i < node->size<DT>(); ++i)
+    hash_combine(seed, std::hash<T>{}(node->at<DT>(i)));
+  return seed;
+}
+
+size_t hash_values(const luci::CircleConst *node)
+{
+  size_t seed = std::hash<int>{}(static_cast<int>(node->dtype()));
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    hash_combine(seed, node->dim(i).known() ? node->dim(i).value() : 0);
+
+  switch (node->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      return hash_elements<loco::DataType::FLOAT32>(node, seed);
+    case loco::DataType::S8:
+      return hash_elements<loco::DataType::S8>(node, seed);
+    case loco::DataType::S16:
+      return hash_elements<loco::DataType::S16>(node, seed);
+    case loco::DataType::S32:
+      return hash_elements<loco::DataType::S32>(node, seed);
+    case loco::DataType::S64:
+      return hash_elements<loco::DataType::S64>(node, seed);
+    case loco::DataType::U8:
+      return hash_elements<loco::DataType::U8>(node, seed);
+    case loco::DataType::BOOL:
+      return hash_elements<loco::DataType::BOOL>(node, seed);
+    default:
+      break;
+  }
+
+  return seed;
+}
+
+/**
+ * @brief Call fn(idx) for each idx in [0, count) with up to num_threads threads
+ */
+void run_concurrently(size_t count, uint32_t num_threads, const std::function<void(size_t)> &fn)
+{
+  const auto num_workers = std::min<size_t>(std::max<uint32_t>(num_threads, 1), count);
+  if (num_workers <= 1)
+  {
+    for (size_t idx = 0; idx < count; ++idx)
+      fn(idx);
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  auto worker = [&]() {
+    for (auto idx = next++; idx < count; idx = next++)
+      fn(idx);
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t id = 0; id < num_workers; ++id)
+    threads.emplace_back(worker);
+  for (auto &thread : threads)
+    thread.join();
+}
+
+uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md, luci::CircleConst *node,
+                       size_t hash)
 {
   if (node != nullptr)
   {
     // When buffer with same values is found, use the buffer id.
-    for (auto key_value : md._cached_buffer_id)
+    // Only constants with the same hash can have the same values.
+    auto &candidates = md._cached_buffer_id[hash];
+    for (auto key_value : candidates)
     {
       if (has_same_values(key_value.first, node))
         return key_value.second;
     }
 
     // When buffer with same values is not found, generate new buffer
-    auto buffer = encodeOpBuffer(builder, node);
+    auto buffer = encodeOpBuffer(builder, md, node);
 
     auto buffer_id = static_cast<uint32_t>(md._buffers.size());
     md._buffers.push_back(buffer);
 
     // Cache the newly generated buffer id
-    md._cached_buffer_id.insert({node, buffer_id});
+    candidates.emplace_back(node, buffer_id);
 
     return buffer_id;
   }
@@ -580,7 +685,7 @@ uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md, luci
   }
 }
 
-void exportOpDefinedTensor(const CircleTensorInfo &info, FlatBufferBuilder &builder,
+void exportOpDefinedTensor(const CircleTensorInfo &info, size_t hash, FlatBufferBuilder &builder,
                            SerializedModelData &md, SerializedGraphData &gd)
 {
   // Create and register output tensor shape
@@ -596,7 +701,7 @@ void exportOpDefinedTensor(const CircleTensorInfo &info, FlatBufferBuilder &buil
 
   auto sparsityparam = encodeSparsityParameters(builder, info.sparsityparam());
 
-  auto buffer_id = get_buffer_id(builder, md, info.content());
+  auto buffer_id = get_buffer_id(builder, md, info.content(), hash);
 
   auto name_offset = builder.CreateString(info.name());
 
@@ -625,7 +730,7 @@ void prepareModelData(FlatBufferBuilder &builder, SerializedModelData &md)
 }
 
 void exportOpDefinedTensors(loco::Graph *g, FlatBufferBuilder &builder, SerializedModelData &md,
-                            SerializedGraphData &gd)
+                            SerializedGraphData &gd, uint32_t num_threads)
 {
   CircleTensorContext tensor_ctx;
 
@@ -647,10 +752,54 @@ void exportOpDefinedTensors(loco::Graph *g, FlatBufferBuilder &builder, Serializ
     allocateCircleTensor(circle_node, tensor_ctx);
   }
 
+  // Hashes to find constants with same values are computed concurrently as they read all values
+  std::vector<const CircleTensorInfo *> infos;
   for (const auto &tensor_info : tensor_ctx)
+    infos.push_back(&tensor_info);
+  std::vector<size_t> hashes(infos.size(), 0);
+  run_concurrently(infos.size(), num_threads, [&](size_t idx) {
+    if (auto content = infos.at(idx)->content())
+      hashes.at(idx) = hash_values(content);
+  });
+
+  for (size_t idx = 0; idx < infos.size(); ++idx)
   {
-    exportOpDefinedTensor(tensor_info, builder, md, gd);
+    exportOpDefinedTensor(*infos.at(idx), hashes.at(idx), builder, md, gd);
   }
 }
 
+void fillBuffers(FlatBufferBuilder &builder, SerializedModelData &md, uint32_t num_threads)
+{
+  // Copy in chunks not to wait for a thread copying the largest buffer
+  constexpr size_t chunk_size = 1 << 24;
+
+  struct Chunk
+  {
+    uint8_t *dst;
+    const uint8_t *src;
+    size_t size;
+  };
+
+  // NOTE Offset is from the end of the builder, which is not moved by Finish
+  //      Values follow the length of a vector
+  auto end = builder.GetBufferPointer() + builder.GetSize();
+  std::vector<Chunk> chunks;
+  for (const auto &deferred : md._deferred_buffers)
+  {
+    auto dst = end - deferred.offset + sizeof(flatbuffers::uoffset_t);
+    for (size_t begin = 0; begin < deferred.size; begin += chunk_size)
+    {
+      const auto size = std::min(chunk_size, deferred.size - begin);
+      chunks.push_back({dst + begin, deferred.data + begin, size});
+    }
+  }
+
+  run_concurrently(chunks.size(), num_threads, [&](size_t idx) {
+    const auto &chunk = chunks.at(idx);
+    memcpy(chunk.dst, chunk.src, chunk.size);
+  });
+
+  md._deferred_buffers.clear();
+}
+
 } // namespace luci
@@ -35,9 +35,18 @@ void prepareModelData(flatbuffers::FlatBufferBuilder &builder, SerializedModelDa
  * @brief create Tensors corresponding to results of all nodes in graph
  * @param computational graph
  * @param gd information about serialized parts of model
+ * @param num_threads number of threads hashing values of constants
  */
 void exportOpDefinedTensors(loco::Graph *g, flatbuffers::FlatBufferBuilder &builder,
-                            SerializedModelData &md, SerializedGraphData &gd);
+                            SerializedModelData &md, SerializedGraphData &gd,
+                            uint32_t num_threads);
+
+/**
+ * @brief copy values of constants to buffers of finished model
+ * @param num_threads number of threads copying values
+ */
+void fillBuffers(flatbuffers::FlatBufferBuilder &builder, SerializedModelData &md,
+                 uint32_t num_threads);
 
 } // namespace luci
 
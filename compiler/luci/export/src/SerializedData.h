@@ -19,6 +19,7 @@
 
 #include <mio/circle/schema_generated.h>
 
+#include <luci/CircleExporter.h>
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/ExecutionPlanTable.h>
 
@@ -70,10 +71,25 @@ public:
     _execution_plan_table[node_id] = execution_plan_inform;
   }
 
+  void add_tensor_offset_table(uint32_t tensor_id, uint32_t offset)
+  {
+    // Model with multiple subgraph may have duplicated tensor id.
+    // Main graph is exported first, so the offset of the main graph is kept.
+    _tensor_offset_table.emplace(tensor_id, offset);
+  }
+
+  void add_execution_order_table(uint32_t order, uint32_t operator_id)
+  {
+    // Same as tensor id, the operator of the main graph is kept
+    _execution_order_table.emplace(order, operator_id);
+  }
+
 public:
   const std::vector<uint8_t> encoded_source_table(void);
   const std::vector<uint8_t> encoded_op_table(void);
   const std::vector<uint8_t> encoded_execution_plan_table(void);
+  const std::vector<uint8_t> encoded_tensor_offset_table(void);
+  const std::vector<uint8_t> encoded_execution_order_table(void);
 
 private:
   std::map<uint32_t, std::string> _source_table;
@@ -81,6 +97,11 @@ private:
   // _exec_plan_table stores for node with node_id order of execution, and memory offsets:
   // first go execution order, then memory offsets for node output tensors.
   luci::ExecutionPlanTable _execution_plan_table;
+  // _tensor_offset_table stores memory offset of output tensor of node, with tensor index.
+  // Runtime can place tensors with this table without the execution order of luci.
+  std::map<uint32_t, uint32_t> _tensor_offset_table;
+  // _execution_order_table stores operator index with order of execution of its node.
+  std::map<uint32_t, uint32_t> _execution_order_table;
 };
 
 } // namespace luci
@@ -124,7 +145,28 @@ struct SerializedModelData final
   CircleExportMetadata _metadata;
 
   // This is used for removing buffers with same values
-  std::map<luci::CircleConst *, uint32_t> _cached_buffer_id;
+  // NOTE key is a hash of dtype, shape and values of CircleConst to find candidates quickly
+  std::unordered_map<size_t, std::vector<std::pair<luci::CircleConst *, uint32_t>>>
+    _cached_buffer_id;
+
+  // Values of constants to be copied to buffers after the model is finished
+  // NOTE offset is of uninitialized vector for the values
+  struct DeferredBuffer
+  {
+    flatbuffers::uoffset_t offset;
+    const uint8_t *data;
+    size_t size;
+  };
+  std::vector<DeferredBuffer> _deferred_buffers;
+
+  // Buffers of constants not smaller than this are aligned to this, instead of 16 bytes
+  uint32_t _buffer_alignment = 16;
+
+  // Values of constants are stored in this file, instead of buffers, if it is not empty
+  // NOTE Offsets in the file are aligned as buffers would be
+  std::string _weight_file;
+  std::vector<CircleExporter::WeightChunk> _weights;
+  uint64_t _weight_file_size = 0;
 
   /**
    * @brief if opcode is not registered in table of opcodes add it
@@ -116,10 +116,17 @@ public: // direct API
 
 public:
   bool parse(const circle::Model *model);
+  /// @brief Parse a model whose buffers are kept valid by 'model_data'
+  bool parse(const circle::Model *model, std::shared_ptr<const void> model_data);
   bool select_subgraph(uint32_t subgraph);
 
+public:
+  /// @brief Return the owner of model buffers, or nullptr if they may be released after import
+  const std::shared_ptr<const void> &model_data(void) const { return _model_data; }
+
 private:
   const circle::Model *_model{nullptr};
+  std::shared_ptr<const void> _model_data;
   const circle::SubGraph *_current_subgraph{nullptr};
 };
 
@@ -23,8 +23,10 @@
 
 #include <loco.h>
 
+#include <functional>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace luci
 {
@@ -86,11 +88,32 @@ public:
   IndexNodeFinder *nodefinder() { return _indexnodefinder; }
   IndexTensorOutputs *tensoroutputs() { return _indextensoroutputs; }
 
+public:
+  using Task = std::function<void(void)>;
+
+  /**
+   * @brief Collect tasks given to defer() to 'tasks' instead of running them at once
+   * @note  Owner of 'tasks' runs them, maybe concurrently, before the nodes are used
+   */
+  void deferred_tasks(std::vector<Task> *tasks) { _deferred_tasks = tasks; }
+
+  /**
+   * @brief Run 'task' which only fills a node it was given, e.g. values of CircleConst
+   */
+  void defer(Task &&task)
+  {
+    if (_deferred_tasks != nullptr)
+      _deferred_tasks->emplace_back(std::move(task));
+    else
+      task();
+  }
+
 private:
   loco::Graph *_g;
   CircleReader *_reader;
   IndexNodeFinder *_indexnodefinder;
   IndexTensorOutputs *_indextensoroutputs;
+  std::vector<Task> *_deferred_tasks = nullptr;
 };
 
 } // namespace luci
@@ -51,12 +51,15 @@
 #include "Nodes/CircleFullyConnected.h"
 #include "Nodes/CircleGather.h"
 #include "Nodes/CircleGatherNd.h"
+#include "Nodes/CircleGelu.h"
 #include "Nodes/CircleGreater.h"
 #include "Nodes/CircleGreaterEqual.h"
+#include "Nodes/CircleHardSwish.h"
 #include "Nodes/CircleIf.h"
 #include "Nodes/CircleInstanceNorm.h"
 #include "Nodes/CircleL2Normalize.h"
 #include "Nodes/CircleL2Pool2D.h"
+#include "Nodes/CircleLayerNorm.h"
 #include "Nodes/CircleLeakyRelu.h"
 #include "Nodes/CircleLess.h"
 #include "Nodes/CircleLessEqual.h"
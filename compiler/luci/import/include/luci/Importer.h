@@ -44,9 +44,34 @@ public:
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
+  /**
+   * @brief Import a module whose constants refer buffers of 'model' instead of copying them
+   *
+   * @note  'model_data' keeps buffers of 'model' valid while they are referred
+   */
+  std::unique_ptr<Module> importModule(const circle::Model *model,
+                                       std::shared_ptr<const void> model_data) const;
+
+public:
+  /**
+   * @brief Do not annotate nodes with ids and origins, nor make source table of the module
+   *
+   * @note  They trace nodes back to the source model through transformations and are not needed
+   *        to execute the model, e.g. with luci-interpreter. Skipping them saves time and memory.
+   */
+  void skip_profile(bool skip) { _skip_profile = skip; }
+
+  /**
+   * @brief Import subgraphs and copy values of constants with up to 'num_threads' threads
+   *
+   * @note  Nodes are created in the same order as they are with a thread
+   */
+  void num_threads(uint32_t num_threads) { _num_threads = num_threads; }
 
 private:
   const GraphBuilderSource *_source = nullptr;
+  bool _skip_profile = false;
+  uint32_t _num_threads = 1;
 };
 
 } // namespace luci
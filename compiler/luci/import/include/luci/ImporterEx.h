@@ -19,6 +19,7 @@
 
 #include "luci/IR/Module.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -32,6 +33,16 @@ public:
 
 public:
   std::unique_ptr<Module> importVerifyModule(const std::string &input_path) const;
+
+public:
+  // Number of threads importing the module (default: 1)
+  void num_threads(uint32_t num_threads) { _num_threads = num_threads; }
+  // Do not annotate nodes with ids and origins, which are not needed to execute (default: false)
+  void skip_profile(bool skip) { _skip_profile = skip; }
+
+private:
+  uint32_t _num_threads = 1;
+  bool _skip_profile = false;
 };
 
 } // namespace luci
@@ -327,6 +327,13 @@ bool CircleReader::parse(const circle::Model *model)
   return true;
 }
 
+bool CircleReader::parse(const circle::Model *model, std::shared_ptr<const void> model_data)
+{
+  _model_data = std::move(model_data);
+
+  return parse(model);
+}
+
 bool CircleReader::select_subgraph(uint32_t sgindex)
 {
   if (num_subgraph() <= sgindex)
@@ -36,13 +36,62 @@
 #include <oops/InternalExn.h>
 #include <oops/UserExn.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace
 {
 
+/**
+ * @brief Call fn(idx) for each idx in [0, count) with up to num_threads threads
+ * @note  The first exception from fn is thrown after all threads are finished
+ */
+void run_concurrently(size_t count, uint32_t num_threads, const std::function<void(size_t)> &fn)
+{
+  const auto num_workers = std::min<size_t>(std::max<uint32_t>(num_threads, 1), count);
+  if (num_workers <= 1)
+  {
+    for (size_t idx = 0; idx < count; ++idx)
+      fn(idx);
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  std::vector<std::exception_ptr> errors(num_workers);
+  auto worker = [&](size_t id) {
+    try
+    {
+      for (auto idx = next++; idx < count; idx = next++)
+        fn(idx);
+    }
+    catch (...)
+    {
+      errors.at(id) = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t id = 0; id < num_workers; ++id)
+    threads.emplace_back(worker, id);
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+// NOTE Nodes are not annotated with ids and origins if origin_table is nullptr
 void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &reader,
-                   loco::Graph *graph)
+                   loco::Graph *graph, const luci::OriginTable *origin_table,
+                   uint32_t num_threads)
 {
   LOGGER(l);
 
@@ -54,7 +103,6 @@ void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &r
   const auto operators = reader.operators();
   const auto tensors = reader.tensors();
   assert(!tensors.null());
-  auto circle_metadata = std::make_unique<luci::CircleImportMetadata>(reader);
 
   // build a cache to identify if a tensor is output of an operator
   // if this is set, we should not create a CircleConst for this tensor
@@ -128,12 +176,17 @@ void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &r
   if (not const_builder)
     throw oops::UserExn("Not supported", "tensor with buffer builder");
 
+  // NOTE Constants are created in order and their values are copied concurrently after then
+  std::vector<luci::GraphBuilderContext::Task> copy_tasks;
+  gb_context.deferred_tasks(&copy_tasks);
   for (uint32_t i = 0; i < tensors.size(); ++i)
   {
     auto *const_node = const_builder->build(i, &gb_context);
     if (const_node != nullptr)
       nodefinder->enroll(i, const_node);
   }
+  gb_context.deferred_tasks(nullptr);
+  run_concurrently(copy_tasks.size(), num_threads, [&](size_t idx) { copy_tasks.at(idx)(); });
 
   // Create CircleVariable nodes for variable tensors
   // TODO Add Origin if needed, skip for now
@@ -148,7 +201,6 @@ void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &r
   // Note that operators in model are stored in execution order. This means that when importing
   // an operator, its input operators have already been imported. We exploit this fact to set up
   // node's inputs right after creating the node.
-  auto origin_table = circle_metadata->origin_table();
   for (uint32_t i = 0; i < operators.size(); ++i)
   {
     const auto op = operators[i];
@@ -168,11 +220,14 @@ void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &r
       }
 
       auto built_op = builder->build(oper_t, &gb_context);
-      set_node_id(built_op, i);
-      if (origin_table.find(i) != origin_table.end())
-        add_origin(built_op, origin_table.at(i));
-      else
-        add_origin(built_op, luci::single_origin(i, built_op->name()));
+      if (origin_table != nullptr)
+      {
+        set_node_id(built_op, i);
+        if (origin_table->find(i) != origin_table->end())
+          add_origin(built_op, origin_table->at(i));
+        else
+          add_origin(built_op, luci::single_origin(i, built_op->name()));
+      }
     }
     else
     {
@@ -287,8 +342,13 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
   if (!reader.select_subgraph(0))
     return nullptr;
 
+  luci::OriginTable origin_table;
+  if (!_skip_profile)
+    origin_table = CircleImportMetadata(reader).origin_table();
+
   // Convert circle::Model to loco::Graph
-  convert_graph(*source_ptr, reader, graph.get());
+  convert_graph(*source_ptr, reader, graph.get(), _skip_profile ? nullptr : &origin_table,
+                _num_threads);
 
   LOGGER(l);
   VERBOSE(l, 3) << "--- graph dump begin -------------------------------------------";
@@ -302,6 +362,12 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
 }
 
 std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
+{
+  return importModule(model, nullptr);
+}
+
+std::unique_ptr<Module> Importer::importModule(const circle::Model *model,
+                                               std::shared_ptr<const void> model_data) const
 {
   auto module = make_module();
 
@@ -314,37 +380,65 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
   }
 
   CircleReader reader;
-  if (!reader.parse(model))
+  if (!reader.parse(model, std::move(model_data)))
     return nullptr;
 
-  for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
-  {
+  // Metadata belongs to the model, so it is decoded once for all subgraphs
+  auto circle_metadata = std::make_unique<luci::CircleImportMetadata>(reader);
+  luci::OriginTable origin_table;
+  if (!_skip_profile)
+    origin_table = circle_metadata->origin_table();
+
+  // Subgraphs are converted concurrently, each with its own reader, and added in order.
+  // Threads left from subgraphs copy values of constants.
+  const auto num_subgraphs = reader.num_subgraph();
+  const auto num_workers = std::max<uint32_t>(std::min(_num_threads, num_subgraphs), 1);
+  const auto num_copy_threads = std::max<uint32_t>(_num_threads / num_workers, 1);
+
+  std::vector<std::unique_ptr<loco::Graph>> graphs(num_subgraphs);
+  std::atomic<bool> selected{true};
+  run_concurrently(num_subgraphs, num_workers, [&](size_t g) {
+    CircleReader subgraph_reader;
+    subgraph_reader.parse(model, reader.model_data());
+    if (!subgraph_reader.select_subgraph(g))
+    {
+      selected = false;
+      return;
+    }
+
     auto graph = loco::make_graph();
+    graph->name(subgraph_reader.name());
 
-    if (!reader.select_subgraph(g))
-      return nullptr;
+    // Convert circle::Model to loco::Graph
+    convert_graph(*source_ptr, subgraph_reader, graph.get(),
+                  _skip_profile ? nullptr : &origin_table, num_copy_threads);
 
-    graph->name(reader.name());
+    assert(loco::valid(graph.get(), std::make_unique<ValidateCollector>()));
 
-    // Convert circle::Model to loco::Graph
-    convert_graph(*source_ptr, reader, graph.get());
+    graphs.at(g) = std::move(graph);
+  });
+  if (!selected)
+    return nullptr;
 
+  for (auto &graph : graphs)
+  {
     LOGGER(l);
     VERBOSE(l, 3) << "--- graph dump begin -------------------------------------------";
     VERBOSE(l, 3) << "Name: " << graph->name();
     VERBOSE(l, 3) << fmt(graph.get());
     VERBOSE(l, 3) << "--- graph dump end ---------------------------------------------";
 
-    assert(loco::valid(graph.get(), std::make_unique<ValidateCollector>()));
-
     module->add(std::move(graph));
   }
 
   post_import_graph(module.get(), reader);
 
-  // Initialize 'source_table'
-  auto circle_metadata = std::make_unique<luci::CircleImportMetadata>(reader);
-  if (circle_metadata->source_table().size() > 0)
+  // Initialize 'source_table', which is a part of profile information
+  if (_skip_profile)
+  {
+    // DO NOTHING
+  }
+  else if (circle_metadata->source_table().size() > 0)
   {
     // If there is 'source_table' metadata in circle model, copy the table.
     module->source_table(circle_metadata->source_table());
@@ -17,12 +17,17 @@
 #include "luci/Importer.h"
 
 #include <luci/IR/CircleNode.h>
+#include <luci/IR/Nodes/CircleConst.h>
 #include <luci/Plan/CircleNodeExecutionPlan.h>
+#include <luci/Profile/CircleNodeID.h>
+#include <luci/Profile/CircleNodeOrigin.h>
 
 #include <gtest/gtest.h>
 #include <mio/circle/schema_generated.h>
 #include <flatbuffers/flatbuffers.h>
 
+#include <string>
+
 TEST(CircleImport, Dummy)
 {
   luci::Importer import;
@@ -175,6 +180,37 @@ struct SimpleRELUModel : public BasicCircleModel
   }
 };
 
+// Each subgraph computes maximum of its input and a constant of 4 values from its index
+struct MultiMaximumModel : public BasicCircleModel
+{
+  explicit MultiMaximumModel(uint32_t num_subgraphs)
+  {
+    auto maximum_opcode_id = add_builtin_opcode(circle::BuiltinOperator_MAXIMUM);
+
+    for (uint32_t g = 0; g < num_subgraphs; ++g)
+    {
+      uint32_t subgraph_id = add_subgraph();
+      model->subgraphs[subgraph_id]->name = "graph_" + std::to_string(g);
+
+      auto const_buffer_id = add_buffer();
+      model->buffers[const_buffer_id]->data.resize(4 * sizeof(float));
+      auto values = reinterpret_cast<float *>(model->buffers[const_buffer_id]->data.data());
+      for (uint32_t i = 0; i < 4; ++i)
+        values[i] = static_cast<float>(g * 10 + i);
+
+      auto input_tensor_idx = add_float_tensor(subgraph_id, {1, 4}, add_buffer());
+      auto const_tensor_idx = add_float_tensor(subgraph_id, {1, 4}, const_buffer_id);
+      auto output_tensor_idx = add_float_tensor(subgraph_id, {1, 4}, add_buffer());
+
+      add_subgraph_inputs(subgraph_id, {input_tensor_idx});
+      add_subgraph_outputs(subgraph_id, {output_tensor_idx});
+
+      add_builtin_operator(subgraph_id, maximum_opcode_id, {input_tensor_idx, const_tensor_idx},
+                           {output_tensor_idx});
+    }
+  }
+};
+
 } // namespace
 
 /**
@@ -351,3 +387,73 @@ TEST(CircleImport, corrupted_plan_entry_NEG)
 
   ASSERT_ANY_THROW(import.importModule(model_ptr));
 }
+
+/**
+ * This test checks that nodes are not annotated with profile information if it is skipped
+ */
+TEST(CircleImport, skip_profile)
+{
+  SimpleRELUModel model;
+
+  flatbuffers::FlatBufferBuilder fbb;
+  auto model_offset = circle::Model::Pack(fbb, model.model.get(), nullptr);
+  circle::FinishModelBuffer(fbb, model_offset);
+
+  auto model_ptr = circle::GetModel(fbb.GetBufferPointer());
+  luci::Importer import;
+  import.skip_profile(true);
+
+  auto luci_module = import.importModule(model_ptr);
+  ASSERT_TRUE(luci_module->source_table().empty());
+
+  auto main_graph = luci_module->graph();
+  for (int i = 0; i < main_graph->nodes()->size(); ++i)
+  {
+    auto node = loco::must_cast<luci::CircleNode *>(main_graph->nodes()->at(i));
+    if (node->opcode() == luci::CircleOpcode::RELU)
+    {
+      ASSERT_FALSE(luci::has_node_id(node));
+      ASSERT_FALSE(luci::has_origin(node));
+    }
+  }
+}
+
+/**
+ * This test checks that subgraphs and constants imported with threads are same as without them
+ */
+TEST(CircleImport, num_threads)
+{
+  MultiMaximumModel model(5);
+
+  flatbuffers::FlatBufferBuilder fbb;
+  auto model_offset = circle::Model::Pack(fbb, model.model.get(), nullptr);
+  circle::FinishModelBuffer(fbb, model_offset);
+
+  auto model_ptr = circle::GetModel(fbb.GetBufferPointer());
+  luci::Importer import;
+  import.num_threads(3);
+
+  auto luci_module = import.importModule(model_ptr);
+  ASSERT_NE(nullptr, luci_module);
+  ASSERT_EQ(5, luci_module->size());
+
+  for (uint32_t g = 0; g < luci_module->size(); ++g)
+  {
+    auto graph = luci_module->graph(g);
+    ASSERT_EQ("graph_" + std::to_string(g), graph->name());
+
+    uint32_t num_consts = 0;
+    for (uint32_t n = 0; n < graph->nodes()->size(); ++n)
+    {
+      auto const_node = dynamic_cast<luci::CircleConst *>(graph->nodes()->at(n));
+      if (const_node == nullptr)
+        continue;
+
+      ++num_consts;
+      ASSERT_EQ(4, const_node->size<loco::DataType::FLOAT32>());
+      for (uint32_t i = 0; i < 4; ++i)
+        ASSERT_EQ(static_cast<float>(g * 10 + i), const_node->at<loco::DataType::FLOAT32>(i));
+    }
+    ASSERT_EQ(1, num_consts);
+  }
+}
@@ -19,35 +19,117 @@
 
 #include <foder/FileLoader.h>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
 #include <memory>
 #include <iostream>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Read-only memory mapping of a file, which is unmapped on destruction
+ */
+class MappedFile final
+{
+public:
+  MappedFile(void *data, size_t size) : _data{data}, _size{size}
+  {
+    // DO NOTHING
+  }
+
+  ~MappedFile() { munmap(_data, _size); }
+
+public:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+  const char *data(void) const { return reinterpret_cast<const char *>(_data); }
+  size_t size(void) const { return _size; }
+
+private:
+  void *_data = nullptr;
+  size_t _size = 0;
+};
+
+/**
+ * @brief Map a file to memory, or return nullptr on failure
+ */
+std::shared_ptr<MappedFile> map_file(const std::string &path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    return nullptr;
+
+  struct stat st;
+  if (fstat(fd, &st) == -1 or st.st_size == 0)
+  {
+    close(fd);
+    return nullptr;
+  }
+
+  const auto size = static_cast<size_t>(st.st_size);
+  auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // NOTE Mapping is kept after the file is closed
+  close(fd);
+
+  if (data == MAP_FAILED)
+    return nullptr;
+
+  return std::make_shared<MappedFile>(data, size);
+}
+
+} // namespace
 
 namespace luci
 {
 
 std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_path) const
 {
-  foder::FileLoader file_loader{input_path};
+  // Model file is mapped to memory and constants refer it instead of copying their values.
+  // When mapping fails, the model is loaded to memory which is released after import.
+  std::shared_ptr<const void> model_owner;
+  const char *model_ptr = nullptr;
+  size_t model_size = 0;
   std::vector<char> model_data;
 
-  try
+  if (auto mapped = map_file(input_path))
   {
-    model_data = file_loader.load();
+    model_ptr = mapped->data();
+    model_size = mapped->size();
+    model_owner = mapped;
   }
-  catch (const std::runtime_error &err)
+  else
   {
-    std::cerr << err.what() << std::endl;
-    return nullptr;
+    foder::FileLoader file_loader{input_path};
+
+    try
+    {
+      model_data = file_loader.load();
+    }
+    catch (const std::runtime_error &err)
+    {
+      std::cerr << err.what() << std::endl;
+      return nullptr;
+    }
+
+    model_ptr = model_data.data();
+    model_size = model_data.size();
   }
 
-  flatbuffers::Verifier verifier{reinterpret_cast<uint8_t *>(model_data.data()), model_data.size()};
+  flatbuffers::Verifier verifier{reinterpret_cast<const uint8_t *>(model_ptr), model_size};
   if (!circle::VerifyModelBuffer(verifier))
   {
     std::cerr << "ERROR: Invalid input file '" << input_path << "'" << std::endl;
     return nullptr;
   }
 
-  const circle::Model *circle_model = circle::GetModel(model_data.data());
+  const circle::Model *circle_model = circle::GetModel(model_ptr);
   if (circle_model == nullptr)
   {
     std::cerr << "ERROR: Failed to load circle '" << input_path << "'" << std::endl;
@@ -55,7 +137,9 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
   }
 
   Importer importer;
-  return importer.importModule(circle_model);
+  importer.num_threads(_num_threads);
+  importer.skip_profile(_skip_profile);
+  return importer.importModule(circle_model, model_owner);
 }
 
 } // namespace luci
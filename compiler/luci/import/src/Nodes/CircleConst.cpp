@@ -23,6 +23,8 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -102,6 +104,37 @@ void copy_data<loco::DataType::STRING>(const VectorWrapper<uint8_t> &raw_data,
   }
 }
 
+template <loco::DataType DT>
+void load_data(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
+               CircleConst *const_node, GraphBuilderContext *context)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
+
+  // Refer the buffer of the model if it outlives the node and is aligned for T
+  const auto &model_data = context->reader()->model_data();
+  const auto address = reinterpret_cast<uintptr_t>(raw_data.data());
+  if (model_data != nullptr && address % alignof(T) == 0)
+  {
+    assert(const_node->sparsityparam() || raw_data.size() == num_elements * sizeof(T));
+    const_node->view(raw_data.data(), raw_data.size(), model_data);
+    return;
+  }
+
+  // NOTE Copying values only touches const_node, so it may be run with other nodes concurrently
+  context->defer(
+    [raw_data, num_elements, const_node]() { copy_data<DT>(raw_data, num_elements, const_node); });
+}
+
+template <>
+void load_data<loco::DataType::STRING>(const VectorWrapper<uint8_t> &raw_data,
+                                       uint32_t num_elements, CircleConst *const_node,
+                                       GraphBuilderContext *context)
+{
+  context->defer([raw_data, num_elements, const_node]() {
+    copy_data<loco::DataType::STRING>(raw_data, num_elements, const_node);
+  });
+}
+
 } // namespace
 
 namespace luci
@@ -124,8 +157,13 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     return nullptr;
   }
 
-  assert(reader->buffers()[const_tensor->buffer()] != nullptr);
-  const auto buffer = wrap(reader->buffers()[const_tensor->buffer()]->data());
+  const auto circle_buffer = reader->buffers()[const_tensor->buffer()];
+  assert(circle_buffer != nullptr);
+  // NOTE Values in a weight file would be mistaken for an empty tensor
+  if (circle_buffer->data() == nullptr && circle_buffer->offset() != 0)
+    throw oops::UserExn("Values of constants out of the flatbuffer are not supported",
+                        tensor_name(const_tensor));
+  const auto buffer = wrap(circle_buffer->data());
   const auto const_dims = wrap(const_tensor->shape()); // in NHWC
   if (const_dims.size() == 0 && buffer.empty())
   {
@@ -163,35 +201,35 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     switch (luci_datatype(const_tensor->type()))
     {
       case loco::DataType::FLOAT32:
-        copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+        load_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node, context);
         break;
 
       case loco::DataType::U8:
-        copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+        load_data<loco::DataType::U8>(buffer, num_elements, const_node, context);
         break;
 
       case loco::DataType::S8:
-        copy_data<loco::DataType::S8>(buffer, num_elements, const_node);
+        load_data<loco::DataType::S8>(buffer, num_elements, const_node, context);
         break;
 
       case loco::DataType::S16:
-        copy_data<loco::DataType::S16>(buffer, num_elements, const_node);
+        load_data<loco::DataType::S16>(buffer, num_elements, const_node, context);
         break;
 
       case loco::DataType::S32:
-        copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+        load_data<loco::DataType::S32>(buffer, num_elements, const_node, context);
         break;
 
       case loco::DataType::S64:
-        copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+        load_data<loco::DataType::S64>(buffer, num_elements, const_node, context);
         break;
 
       case loco::DataType::BOOL:
-        copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+        load_data<loco::DataType::BOOL>(buffer, num_elements, const_node, context);
         break;
 
       case loco::DataType::STRING:
-        copy_data<loco::DataType::STRING>(buffer, num_elements, const_node);
+        load_data<loco::DataType::STRING>(buffer, num_elements, const_node, context);
         break;
 
       default:
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "luci/Import/Nodes/CircleLayerNorm.h"
+
+#include <luci/IR/Nodes/CircleLayerNorm.h>
+
+#include <loco.h>
+
+namespace luci
+{
+
+bool CircleLayerNormGraphBuilder::validate(const ValidateArgs &args) const
+{
+  if (!GraphBuilder::validate(args, 3))
+    return false;
+
+  const auto &inputs = args.op.inputs;
+  const auto &outputs = args.op.outputs;
+
+  const auto tensors = args.reader.tensors();
+  for (const auto input : inputs)
+  {
+    assert(tensors[input] != nullptr);
+    if (tensors[input]->type() != circle::TensorType_FLOAT32)
+      return false;
+  }
+
+  assert(tensors[outputs[0]] != nullptr);
+  if (tensors[outputs[0]]->type() != circle::TensorType_FLOAT32)
+    return false;
+
+  return true;
+}
+
+CircleNode *CircleLayerNormGraphBuilder::build_node(const circle::OperatorT &op,
+                                                    const std::vector<CircleNode *> &inputs,
+                                                    loco::Graph *graph) const
+{
+  auto *node = graph->nodes()->create<CircleLayerNorm>();
+  node->input(inputs.at(0));
+  node->gamma(inputs.at(1));
+  node->beta(inputs.at(2));
+
+  const auto *options = op.builtin_options.AsLayerNormOptions();
+  node->epsilon(options->epsilon);
+
+  return node;
+}
+
+} // namespace luci
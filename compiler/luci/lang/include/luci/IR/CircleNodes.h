@@ -50,6 +50,7 @@
 #include "Nodes/CircleGatherNd.h"
 #include "Nodes/CircleGreater.h"
 #include "Nodes/CircleGreaterEqual.h"
+#include "Nodes/CircleHardSwish.h"
 #include "Nodes/CircleIf.h"
 #include "Nodes/CircleL2Normalize.h"
 #include "Nodes/CircleL2Pool2D.h"
@@ -133,7 +134,9 @@
 // Circle only
 #include "Nodes/CircleBCQFullyConnected.h"
 #include "Nodes/CircleBCQGather.h"
+#include "Nodes/CircleGelu.h"
 #include "Nodes/CircleInstanceNorm.h"
+#include "Nodes/CircleLayerNorm.h"
 // Virtual nodes
 #include "Nodes/CircleConst.h"
 #include "Nodes/CircleInput.h"
@@ -24,6 +24,8 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <memory>
+
 namespace luci
 {
 
@@ -42,8 +44,31 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Refer 'num_bytes' bytes at 'ptr' as values instead of keeping a copy of them
+   *
+   * @note  'source' keeps 'ptr' valid while this node refers it. Values are copied into this
+   *        node when they are accessed by a non-const method, which may change them.
+   */
+  void view(const uint8_t *ptr, uint32_t num_bytes, std::shared_ptr<const void> source);
+
+  /// @brief Return true if values are referred, not copied yet
+  bool viewed(void) const { return _view != nullptr; }
+
+  /// @brief Return the owner which keeps referred values valid, if values are referred
+  const std::shared_ptr<const void> &view_source(void) const { return _view_source; }
+
+private:
+  const uint8_t *data(void) const { return _view != nullptr ? _view : _data.data(); }
+  uint32_t bytes(void) const { return _view != nullptr ? _view_size : _data.size(); }
+  void materialize(void);
+
 private:
   std::vector<uint8_t> _data;
+  const uint8_t *_view = nullptr;
+  uint32_t _view_size = 0;
+  std::shared_ptr<const void> _view_source;
   // TODO use _data for STRING and remove _strings
   std::vector<std::string> _strings; // for STRING type
 };
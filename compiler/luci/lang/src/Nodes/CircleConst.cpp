@@ -17,6 +17,7 @@
 #include "luci/IR/Nodes/CircleConst.h"
 
 #include <cassert>
+#include <cstring>
 
 namespace luci
 {
@@ -24,13 +25,14 @@ namespace luci
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(bytes() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return bytes() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  materialize();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +41,14 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,12 +56,13 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
@@ -124,4 +128,27 @@ template <> std::string &CircleConst::scalar<loco::DataType::STRING>(void)
   return _strings.at(0);
 }
 
+void CircleConst::view(const uint8_t *ptr, uint32_t num_bytes, std::shared_ptr<const void> source)
+{
+  assert(ptr != nullptr);
+  assert(source != nullptr);
+  _data.clear();
+  _data.shrink_to_fit();
+  _view = ptr;
+  _view_size = num_bytes;
+  _view_source = std::move(source);
+}
+
+void CircleConst::materialize(void)
+{
+  if (_view == nullptr)
+    return;
+
+  _data.resize(_view_size);
+  std::memcpy(_data.data(), _view, _view_size);
+  _view = nullptr;
+  _view_size = 0;
+  _view_source.reset();
+}
+
 } // namespace luci
@@ -64,3 +64,36 @@ TEST(CircleConstTest, string)
   ASSERT_EQ(1, const_node.size<loco::DataType::STRING>());
   EXPECT_TRUE(std::string("Hello") == const_node.at<loco::DataType::STRING>(0));
 }
+
+TEST(CircleConstTest, view)
+{
+  auto source = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.view(reinterpret_cast<const uint8_t *>(source->data()), 3 * sizeof(int32_t), source);
+
+  const luci::CircleConst &const_ref = const_node;
+  EXPECT_TRUE(const_node.viewed());
+  EXPECT_EQ(source, const_node.view_source());
+  ASSERT_EQ(3, const_ref.size<loco::DataType::S32>());
+  EXPECT_EQ(2, const_ref.at<loco::DataType::S32>(1));
+  EXPECT_EQ(&source->at(1), &const_ref.at<loco::DataType::S32>(1));
+}
+
+TEST(CircleConstTest, view_copy_on_write)
+{
+  auto source = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.view(reinterpret_cast<const uint8_t *>(source->data()), 3 * sizeof(int32_t), source);
+
+  const_node.at<loco::DataType::S32>(1) = 5;
+
+  EXPECT_FALSE(const_node.viewed());
+  EXPECT_EQ(nullptr, const_node.view_source());
+  EXPECT_EQ(5, const_node.at<loco::DataType::S32>(1));
+  EXPECT_EQ(3, const_node.at<loco::DataType::S32>(2));
+  EXPECT_EQ(2, source->at(1));
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/IR/Nodes/CircleLayerNorm.h"
+
+#include "luci/IR/CircleDialect.h"
+#include "luci/IR/CircleNodeVisitor.h"
+
+#include <gtest/gtest.h>
+
+TEST(CircleLayerNormTest, constructor)
+{
+  luci::CircleLayerNorm layer_norm;
+
+  ASSERT_EQ(luci::CircleDialect::get(), layer_norm.dialect());
+  ASSERT_EQ(luci::CircleOpcode::LAYER_NORM, layer_norm.opcode());
+
+  ASSERT_EQ(nullptr, layer_norm.input());
+  ASSERT_EQ(nullptr, layer_norm.gamma());
+  ASSERT_EQ(nullptr, layer_norm.beta());
+  ASSERT_FLOAT_EQ(layer_norm.epsilon(), 1e-05);
+}
+
+TEST(CircleLayerNormTest, epsilon)
+{
+  luci::CircleLayerNorm layer_norm;
+
+  layer_norm.epsilon(1e-12);
+  ASSERT_FLOAT_EQ(layer_norm.epsilon(), 1e-12);
+}
+
+TEST(CircleLayerNormTest, input_NEG)
+{
+  luci::CircleLayerNorm layer_norm;
+  luci::CircleLayerNorm node;
+
+  layer_norm.input(&node);
+  layer_norm.gamma(&node);
+  layer_norm.beta(&node);
+  ASSERT_NE(nullptr, layer_norm.input());
+  ASSERT_NE(nullptr, layer_norm.gamma());
+  ASSERT_NE(nullptr, layer_norm.beta());
+
+  layer_norm.input(nullptr);
+  layer_norm.gamma(nullptr);
+  layer_norm.beta(nullptr);
+  ASSERT_EQ(nullptr, layer_norm.input());
+  ASSERT_EQ(nullptr, layer_norm.gamma());
+  ASSERT_EQ(nullptr, layer_norm.beta());
+}
+
+TEST(CircleLayerNormTest, arity_NEG)
+{
+  luci::CircleLayerNorm layer_norm;
+
+  ASSERT_NO_THROW(layer_norm.arg(2));
+  ASSERT_THROW(layer_norm.arg(3), std::out_of_range);
+}
+
+TEST(CircleLayerNormTest, visit_mutable_NEG)
+{
+  struct TestVisitor final : public luci::CircleNodeMutableVisitor<void>
+  {
+  };
+
+  luci::CircleLayerNorm layer_norm;
+
+  TestVisitor tv;
+  ASSERT_THROW(layer_norm.accept(&tv), std::exception);
+}
+
+TEST(CircleLayerNormTest, visit_NEG)
+{
+  struct TestVisitor final : public luci::CircleNodeVisitor<void>
+  {
+  };
+
+  luci::CircleLayerNorm layer_norm;
+
+  TestVisitor tv;
+  ASSERT_THROW(layer_norm.accept(&tv), std::exception);
+}
@@ -70,9 +70,6 @@ private:
 #define WARN(name) HERMES_VERBOSE(name, 2)
 #define VERBOSE(name, lv) HERMES_VERBOSE(name, lv)
 
-// WARNING!
-//
-//   THE CURRENT IMPLEMENTATION IS NOT THREAD SAFE.
-//
+// NOTE Loggers in different threads share the logging context, which serializes messages.
 
 #endif // __LUCI_LOG_H__
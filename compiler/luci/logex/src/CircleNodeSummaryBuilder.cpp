@@ -153,12 +153,15 @@ CircleNodeSummaryBuilder::create_builder(const luci::CircleNode *node)
     CIRCLE_NODE(FULLY_CONNECTED, CircleFullyConnectedSummaryBuilder)
     CIRCLE_NODE(GATHER, CircleGatherSummaryBuilder)
     CIRCLE_NODE(GATHER_ND, CircleGatherNdSummaryBuilder)
+    CIRCLE_NODE(GELU, CircleGeluSummaryBuilder)
     CIRCLE_NODE(GREATER, CircleGreaterSummaryBuilder)
     CIRCLE_NODE(GREATER_EQUAL, CircleGreaterEqualSummaryBuilder)
+    CIRCLE_NODE(HARD_SWISH, CircleHardSwishSummaryBuilder)
     CIRCLE_NODE(IF, CircleIfSummaryBuilder)
     CIRCLE_NODE(INSTANCE_NORM, CircleInstanceNormSummaryBuilder)
     CIRCLE_NODE(L2_NORMALIZATION, CircleL2NormalizeSummaryBuilder)
     CIRCLE_NODE(L2_POOL_2D, CircleL2Pool2DSummaryBuilder)
+    CIRCLE_NODE(LAYER_NORM, CircleLayerNormSummaryBuilder)
     CIRCLE_NODE(LEAKY_RELU, CircleLeakyReluSummaryBuilder)
     CIRCLE_NODE(LESS, CircleLessSummaryBuilder)
     CIRCLE_NODE(LESS_EQUAL, CircleLessEqualSummaryBuilder)
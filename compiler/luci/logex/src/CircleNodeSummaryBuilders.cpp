@@ -519,6 +519,12 @@ std::vector<std::string> CircleGatherNdSummaryBuilder::get_input_names(const luc
   return {"params", "indices"};
 }
 
+void CircleGeluSummaryBuilder::build_attributes(const luci::CircleNode *node, locop::NodeSummary &s)
+{
+  auto gelu = loco::must_cast<const luci::CircleGelu *>(node);
+  s.args().append("approximate", to_str(gelu->approximate()));
+}
+
 std::vector<std::string> CircleIfSummaryBuilder::get_input_names(const luci::CircleNode *node)
 {
   auto circle_if = loco::must_cast<const luci::CircleIf *>(node);
@@ -615,6 +621,18 @@ void CircleL2Pool2DSummaryBuilder::build_attributes(const luci::CircleNode *node
   s.args().append("fused_activation_function", to_str(l2pool->fusedActivationFunction()));
 }
 
+std::vector<std::string> CircleLayerNormSummaryBuilder::get_input_names(const luci::CircleNode *)
+{
+  return {"input", "gamma", "beta"};
+}
+
+void CircleLayerNormSummaryBuilder::build_attributes(const luci::CircleNode *node,
+                                                     locop::NodeSummary &s)
+{
+  auto layernorm = loco::must_cast<const luci::CircleLayerNorm *>(node);
+  s.args().append("epsilon", std::to_string(layernorm->epsilon()));
+}
+
 void CircleLeakyReluSummaryBuilder::build_attributes(const luci::CircleNode *node,
                                                      locop::NodeSummary &s)
 {
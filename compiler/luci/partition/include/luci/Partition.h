@@ -19,6 +19,7 @@
 
 #include <luci/IR/Module.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -48,6 +49,9 @@ struct PartitionTable
 
   // assign by op name: OPNAME=group
   std::unordered_map<std::string /* OPNAME */, std::string /* group */> byopnames;
+
+  // memory in bytes for constants and activations of each partition, 0 for no limit
+  uint64_t memory_budget = 0;
 };
 
 /**
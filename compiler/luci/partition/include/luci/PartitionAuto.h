@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PARTITION_AUTO_H__
+#define __LUCI_PARTITION_AUTO_H__
+
+#include "luci/Partition.h"
+
+#include <luci/IR/Module.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace luci
+{
+
+/**
+ * @brief PartitionCost holds estimated costs to run Ops in each group
+ */
+struct PartitionCost
+{
+  enum class GOAL
+  {
+    // minimize sum of cost of all Ops and transfers between groups
+    LATENCY,
+    // run groups as pipeline stages and minimize cost of the slowest stage
+    THROUGHPUT,
+  };
+
+  GOAL goal = GOAL::LATENCY;
+
+  // cost of an Op in a group, looked up by OPNAME, OPCODENAME and then "_" for any other Op.
+  // Op without a cost in a group is not assigned to the group.
+  std::unordered_map<std::string /* group */,
+                     std::unordered_map<std::string /* OPNAME or OPCODENAME */, double>>
+    ops;
+
+  // cost to transfer a byte of a tensor from a group to another
+  double transfer = 0.0;
+};
+
+/**
+ * @brief Fill partition to assign each Op of the main graph to a group with minimum cost
+ * @note  Ops already assigned by partition with byopcodes or byopnames keep their group.
+ *        On return, partition complies with OPNAME and byopnames has all Ops.
+ */
+void auto_partition(const Module *module, const PartitionCost &cost, PartitionTable &partition);
+
+} // namespace luci
+
+#endif // __LUCI_PARTITION_AUTO_H__
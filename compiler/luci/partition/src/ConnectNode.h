@@ -95,6 +95,7 @@ public:
   void visit(const luci::CircleGatherNd *) final;
   void visit(const luci::CircleGreater *) final;
   void visit(const luci::CircleGreaterEqual *) final;
+  void visit(const luci::CircleHardSwish *) final;
   void visit(const luci::CircleIf *) final;
   void visit(const luci::CircleL2Normalize *) final;
   void visit(const luci::CircleL2Pool2D *) final;
@@ -179,7 +180,9 @@ public:
   // Circle Only
   void visit(const luci::CircleBCQFullyConnected *) final;
   void visit(const luci::CircleBCQGather *) final;
+  void visit(const luci::CircleGelu *) final;
   void visit(const luci::CircleInstanceNorm *) final;
+  void visit(const luci::CircleLayerNorm *) final;
 
   // NOTE CircleInput and CircleOutput are not handled here as these need
   //      link with graph I/O
@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/PartitionAuto.h"
+
+#include "PartitionPGroups.h"
+#include "PartitionMemory.h"
+#include "CircleOpCode.h"
+
+#include "luci/Log.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+// cost of Op not to be assigned to a group
+// NOTE this is not infinity so that sums of costs can still be compared
+constexpr double kInfCost = 1e15;
+
+bool is_inf(double cost) { return cost >= kInfCost; }
+
+/**
+ * @brief Returns the Op producing node, or nullptr if node is not from an Op
+ * @note  Output of multiple outputs Op is given by virtual node, like CircleSplitOut
+ */
+const luci::CircleNode *producer_of(const luci::CircleNode *node)
+{
+  while (node != nullptr && !luci::check_allocate_partition(node))
+  {
+    if (dynamic_cast<const luci::CircleConst *>(node) != nullptr)
+      return nullptr;
+    if (node->arity() != 1)
+      return nullptr;
+    node = dynamic_cast<const luci::CircleNode *>(node->arg(0));
+  }
+  return node;
+}
+
+// group given to node by partition, or empty if node follows default group
+std::string fixed_group(const luci::CircleNode *node, const luci::PartitionTable &partition)
+{
+  switch (partition.comply)
+  {
+    case luci::PartitionTable::COMPLY::OPCODE:
+    {
+      auto it = partition.byopcodes.find(luci::opcode_name(node));
+      if (it != partition.byopcodes.end())
+        return it->second;
+      break;
+    }
+    case luci::PartitionTable::COMPLY::OPNAME:
+    {
+      auto it = partition.byopnames.find(node->name());
+      if (it != partition.byopnames.end())
+        return it->second;
+      break;
+    }
+    default:
+      break;
+  }
+  return "";
+}
+
+double op_cost(const luci::CircleNode *node, const luci::PartitionCost &cost,
+               const std::string &group)
+{
+  auto git = cost.ops.find(group);
+  if (git == cost.ops.end())
+    return kInfCost;
+
+  const auto &ops = git->second;
+  for (const auto &key : {node->name(), luci::opcode_name(node), std::string("_")})
+  {
+    auto it = ops.find(key);
+    if (it != ops.end())
+      return it->second;
+  }
+  return kInfCost;
+}
+
+/**
+ * @brief Tensor produced by an Op and used by other Ops
+ */
+struct Tensor
+{
+  uint32_t producer = 0;
+  std::vector<uint32_t> consumers;
+  double cost = 0.0; // transfer cost to another group
+};
+
+/**
+ * @brief Ops of main graph in topological order with their costs
+ */
+struct OpGraph
+{
+  std::vector<const luci::CircleNode *> ops;
+  // costs[op][group]
+  std::vector<std::vector<double>> costs;
+  std::vector<Tensor> tensors;
+};
+
+OpGraph build_op_graph(const loco::Graph *graph, const luci::PartitionCost &cost,
+                       const luci::PartitionTable &partition)
+{
+  LOGGER(l);
+
+  OpGraph opg;
+  std::map<const luci::CircleNode *, uint32_t> op_index;
+
+  auto add_op = [&](loco::Node *node) {
+    auto cnode = loco::must_cast<luci::CircleNode *>(node);
+    if (!luci::check_allocate_partition(cnode) || op_index.find(cnode) != op_index.end())
+      return;
+    op_index[cnode] = opg.ops.size();
+    opg.ops.push_back(cnode);
+  };
+  auto outputs = loco::output_nodes(const_cast<loco::Graph *>(graph));
+  for (auto node : loco::postorder_traversal(outputs))
+    add_op(node);
+  // Ops not reachable from outputs are also partitioned
+  for (uint32_t n = 0; n < graph->nodes()->size(); ++n)
+    add_op(graph->nodes()->at(n));
+
+  const auto &groups = partition.groups;
+  auto default_it = std::find(groups.begin(), groups.end(), partition.default_group);
+  const auto default_index = static_cast<uint32_t>(default_it - groups.begin());
+
+  for (auto op : opg.ops)
+  {
+    std::vector<double> costs(groups.size());
+    for (uint32_t g = 0; g < groups.size(); ++g)
+      costs[g] = op_cost(op, cost, groups[g]);
+
+    auto fixed = fixed_group(op, partition);
+    if (!fixed.empty())
+    {
+      auto it = std::find(groups.begin(), groups.end(), fixed);
+      if (it == groups.end())
+        throw std::runtime_error("Unknown group '" + fixed + "' for " + op->name());
+      const auto index = static_cast<uint32_t>(it - groups.begin());
+      for (uint32_t g = 0; g < groups.size(); ++g)
+      {
+        if (g != index)
+          costs[g] = kInfCost;
+      }
+      if (is_inf(costs[index]))
+        costs[index] = 0.0;
+    }
+    else if (std::all_of(costs.begin(), costs.end(), is_inf) && default_index < groups.size())
+    {
+      INFO(l) << "PartitionAuto: no cost for " << op->name() << ", use default group"
+              << std::endl;
+      costs[default_index] = 0.0;
+    }
+    opg.costs.push_back(costs);
+  }
+
+  // Tensors are identified by node, which is Op itself or virtual output node of Op
+  std::map<const luci::CircleNode *, uint32_t> tensor_index;
+  for (uint32_t q = 0; q < opg.ops.size(); ++q)
+  {
+    auto op = opg.ops[q];
+    for (uint32_t a = 0; a < op->arity(); ++a)
+    {
+      auto arg = dynamic_cast<const luci::CircleNode *>(op->arg(a));
+      auto producer = producer_of(arg);
+      if (producer == nullptr)
+        continue;
+      auto pit = op_index.find(producer);
+      assert(pit != op_index.end());
+      if (pit->second == q)
+        continue;
+
+      auto it = tensor_index.find(arg);
+      if (it == tensor_index.end())
+      {
+        Tensor tensor;
+        tensor.producer = pit->second;
+        tensor.cost = static_cast<double>(luci::tensor_bytes(arg)) * cost.transfer;
+        it = tensor_index.emplace(arg, opg.tensors.size()).first;
+        opg.tensors.push_back(tensor);
+      }
+      auto &consumers = opg.tensors[it->second].consumers;
+      if (std::find(consumers.begin(), consumers.end(), q) == consumers.end())
+        consumers.push_back(q);
+    }
+  }
+
+  return opg;
+}
+
+/**
+ * @brief Min cut of a graph with Dinic's max flow
+ */
+class MinCut final
+{
+public:
+  MinCut(uint32_t size) : _adj(size), _level(size), _iter(size) {}
+
+public:
+  void add_edge(uint32_t from, uint32_t to, double cap)
+  {
+    if (cap <= 0.0)
+      return;
+    _adj[from].push_back(_edges.size());
+    _edges.push_back({to, cap});
+    _adj[to].push_back(_edges.size());
+    _edges.push_back({from, 0.0});
+  }
+
+  void run(uint32_t s, uint32_t t)
+  {
+    while (bfs(s, t))
+    {
+      std::fill(_iter.begin(), _iter.end(), 0);
+      while (dfs(s, t, std::numeric_limits<double>::max()) > 0.0)
+        ;
+    }
+  }
+
+  // true if node is in source side of the cut, valid after run()
+  bool source_side(uint32_t node) const { return _level[node] >= 0; }
+
+private:
+  bool bfs(uint32_t s, uint32_t t)
+  {
+    std::fill(_level.begin(), _level.end(), -1);
+    std::queue<uint32_t> queue;
+    _level[s] = 0;
+    queue.push(s);
+    while (!queue.empty())
+    {
+      auto u = queue.front();
+      queue.pop();
+      for (auto e : _adj[u])
+      {
+        const auto &edge = _edges[e];
+        if (edge.cap > kEps && _level[edge.to] < 0)
+        {
+          _level[edge.to] = _level[u] + 1;
+          queue.push(edge.to);
+        }
+      }
+    }
+    return _level[t] >= 0;
+  }
+
+  double dfs(uint32_t u, uint32_t t, double flow)
+  {
+    if (u == t)
+      return flow;
+    for (auto &i = _iter[u]; i < _adj[u].size(); ++i)
+    {
+      const auto e = _adj[u][i];
+      auto &edge = _edges[e];
+      if (edge.cap > kEps && _level[edge.to] == _level[u] + 1)
+      {
+        auto pushed = dfs(edge.to, t, std::min(flow, edge.cap));
+        if (pushed > 0.0)
+        {
+          edge.cap -= pushed;
+          _edges[e ^ 1].cap += pushed;
+          return pushed;
+        }
+      }
+    }
+    return 0.0;
+  }
+
+private:
+  static constexpr double kEps = 1e-9;
+
+  struct Edge
+  {
+    uint32_t to;
+    double cap;
+  };
+
+  std::vector<Edge> _edges;
+  std::vector<std::vector<uint32_t>> _adj;
+  std::vector<int32_t> _level;
+  std::vector<uint32_t> _iter;
+};
+
+double latency_of(const OpGraph &opg, const std::vector<uint32_t> &labels)
+{
+  double total = 0.0;
+  for (uint32_t i = 0; i < opg.ops.size(); ++i)
+    total += opg.costs[i][labels[i]];
+  // NOTE tensor used by multiple Ops in a group is sent to the group once
+  for (const auto &tensor : opg.tensors)
+  {
+    std::vector<uint32_t> sent;
+    for (auto c : tensor.consumers)
+    {
+      auto group = labels[c];
+      if (group != labels[tensor.producer] &&
+          std::find(sent.begin(), sent.end(), group) == sent.end())
+      {
+        sent.push_back(group);
+        total += tensor.cost;
+      }
+    }
+  }
+  return total;
+}
+
+/**
+ * @brief Assign groups to minimize latency with alpha-expansion
+ * @note  Each expansion solves whether Ops move to a group with a min cut, where transfer
+ *        cost is counted per pair of producer and consumer. The result is accepted only if
+ *        it reduces the actual latency, which counts a tensor once per group.
+ */
+std::vector<uint32_t> solve_latency(const OpGraph &opg, uint32_t num_groups)
+{
+  const auto num_ops = static_cast<uint32_t>(opg.ops.size());
+
+  std::vector<uint32_t> labels(num_ops);
+  for (uint32_t i = 0; i < num_ops; ++i)
+  {
+    const auto &costs = opg.costs[i];
+    labels[i] = std::min_element(costs.begin(), costs.end()) - costs.begin();
+  }
+  auto latency = latency_of(opg, labels);
+
+  const uint32_t kMaxSweeps = 16;
+  for (uint32_t sweep = 0; sweep < kMaxSweeps; ++sweep)
+  {
+    bool improved = false;
+    for (uint32_t alpha = 0; alpha < num_groups; ++alpha)
+    {
+      // x = 0(source side) keeps the group, x = 1(sink side) moves to alpha
+      const uint32_t s = num_ops;
+      const uint32_t t = num_ops + 1;
+      std::vector<double> keep(num_ops), move(num_ops);
+      for (uint32_t i = 0; i < num_ops; ++i)
+      {
+        keep[i] = opg.costs[i][labels[i]];
+        move[i] = opg.costs[i][alpha];
+      }
+
+      MinCut cut(num_ops + 2);
+      auto add_linear = [&](uint32_t i, double k) {
+        if (k > 0.0)
+          move[i] += k;
+        else
+          keep[i] -= k;
+      };
+      for (const auto &tensor : opg.tensors)
+      {
+        const auto p = tensor.producer;
+        for (auto q : tensor.consumers)
+        {
+          // E(xp, xq) = A + (C - A) xp + (D - C) xq + (B + C - A - D) (1 - xp) xq
+          const double w = tensor.cost;
+          const double A = labels[p] != labels[q] ? w : 0.0;
+          const double B = labels[p] != alpha ? w : 0.0;
+          const double C = alpha != labels[q] ? w : 0.0;
+          const double D = 0.0;
+          add_linear(p, C - A);
+          add_linear(q, D - C);
+          cut.add_edge(p, q, B + C - A - D);
+        }
+      }
+      for (uint32_t i = 0; i < num_ops; ++i)
+      {
+        cut.add_edge(s, i, move[i]);
+        cut.add_edge(i, t, keep[i]);
+      }
+      cut.run(s, t);
+
+      auto expanded = labels;
+      for (uint32_t i = 0; i < num_ops; ++i)
+      {
+        if (!cut.source_side(i))
+          expanded[i] = alpha;
+      }
+      auto expanded_latency = latency_of(opg, expanded);
+      if (expanded_latency < latency - 1e-9 * std::max(1.0, latency))
+      {
+        labels = expanded;
+        latency = expanded_latency;
+        improved = true;
+      }
+    }
+    if (!improved)
+      break;
+  }
+
+  return labels;
+}
+
+/**
+ * @brief Assign groups to Ops as pipeline stages to minimize cost of the slowest stage
+ * @note  Stages are contiguous ranges of Ops in topological order and each group runs one
+ *        stage. Orders of groups are all tried for up to 3 groups, and the order in the
+ *        partition is used otherwise.
+ * @return false if there is no pipeline with finite cost
+ */
+bool solve_throughput(const OpGraph &opg, uint32_t num_groups, std::vector<uint32_t> &labels)
+{
+  const auto num_ops = static_cast<uint32_t>(opg.ops.size());
+
+  // prefix[g][j]: sum of costs of Ops [0, j) in group g
+  std::vector<std::vector<double>> prefix(num_groups, std::vector<double>(num_ops + 1, 0.0));
+  for (uint32_t g = 0; g < num_groups; ++g)
+  {
+    for (uint32_t i = 0; i < num_ops; ++i)
+      prefix[g][i + 1] = prefix[g][i] + opg.costs[i][g];
+  }
+
+  // cross[b]: transfer cost of tensors crossing the boundary before Op b
+  std::vector<double> diff(num_ops + 1, 0.0);
+  for (const auto &tensor : opg.tensors)
+  {
+    auto last = *std::max_element(tensor.consumers.begin(), tensor.consumers.end());
+    if (last <= tensor.producer)
+      continue;
+    diff[tensor.producer + 1] += tensor.cost;
+    diff[last + 1] -= tensor.cost;
+  }
+  std::vector<double> cross(num_ops + 1, 0.0);
+  double running = 0.0;
+  for (uint32_t b = 0; b <= num_ops; ++b)
+  {
+    running += diff[b];
+    cross[b] = running;
+  }
+
+  auto stage_cost = [&](uint32_t begin, uint32_t end, uint32_t g) {
+    if (begin == end)
+      return 0.0;
+    return prefix[g][end] - prefix[g][begin] + (begin > 0 ? cross[begin] : 0.0);
+  };
+
+  std::vector<uint32_t> order(num_groups);
+  for (uint32_t g = 0; g < num_groups; ++g)
+    order[g] = g;
+
+  double best = kInfCost;
+  const uint32_t kMaxPermuteGroups = 3;
+  do
+  {
+    // dp[s][j]: cost of the slowest stage when first s stages run Ops [0, j)
+    std::vector<std::vector<double>> dp(num_groups + 1,
+                                        std::vector<double>(num_ops + 1, kInfCost * 2));
+    std::vector<std::vector<uint32_t>> from(num_groups + 1, std::vector<uint32_t>(num_ops + 1));
+    dp[0][0] = 0.0;
+    for (uint32_t s = 1; s <= num_groups; ++s)
+    {
+      for (uint32_t j = 0; j <= num_ops; ++j)
+      {
+        for (uint32_t i = 0; i <= j; ++i)
+        {
+          auto value = std::max(dp[s - 1][i], stage_cost(i, j, order[s - 1]));
+          if (value < dp[s][j])
+          {
+            dp[s][j] = value;
+            from[s][j] = i;
+          }
+        }
+      }
+    }
+
+    if (dp[num_groups][num_ops] < best)
+    {
+      best = dp[num_groups][num_ops];
+      uint32_t end = num_ops;
+      for (uint32_t s = num_groups; s > 0; --s)
+      {
+        auto begin = from[s][end];
+        for (uint32_t i = begin; i < end; ++i)
+          labels[i] = order[s - 1];
+        end = begin;
+      }
+    }
+  } while (num_groups <= kMaxPermuteGroups && std::next_permutation(order.begin(), order.end()));
+
+  return !is_inf(best);
+}
+
+} // namespace
+
+namespace luci
+{
+
+void auto_partition(const Module *module, const PartitionCost &cost, PartitionTable &partition)
+{
+  assert(module != nullptr);
+  // NOTE Only main graph (subgraph index 0) will be partitioned like produce_pgroups()
+
+  LOGGER(l);
+
+  if (partition.groups.empty())
+    throw std::runtime_error("PartitionAuto: no group to partition");
+
+  auto opg = build_op_graph(module->graph(), cost, partition);
+  const auto num_groups = static_cast<uint32_t>(partition.groups.size());
+
+  std::vector<uint32_t> labels(opg.ops.size(), 0);
+  bool solved = false;
+  if (cost.goal == PartitionCost::GOAL::THROUGHPUT)
+  {
+    solved = solve_throughput(opg, num_groups, labels);
+    if (!solved)
+      INFO(l) << "PartitionAuto: no pipeline is possible, fall back to latency" << std::endl;
+  }
+  if (!solved)
+    labels = solve_latency(opg, num_groups);
+
+  INFO(l) << "PartitionAuto: estimated latency " << latency_of(opg, labels) << std::endl;
+
+  std::unordered_map<std::string, std::string> byopnames;
+  for (uint32_t i = 0; i < opg.ops.size(); ++i)
+  {
+    auto op = opg.ops[i];
+    const auto &group = partition.groups[labels[i]];
+    // NOTE Ops with same name get the group of the first one
+    byopnames.emplace(op->name(), group);
+
+    INFO(l) << "PartitionAuto: " << op->name() << " -> " << group << std::endl;
+  }
+  partition.comply = PartitionTable::COMPLY::OPNAME;
+  partition.byopnames.swap(byopnames);
+}
+
+} // namespace luci
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/PartitionAuto.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleSqrt.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace luci::test;
+
+// input - sqrt_0 - sqrt_1 - sqrt_2 - sqrt_3 - output
+class SqrtChainGraph : public TestIOGraph
+{
+public:
+  SqrtChainGraph() = default;
+
+public:
+  void init(const ShapeU32 shape)
+  {
+    TestIOGraph::init(shape, shape);
+
+    loco::Node *prev = input();
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+      auto sqrt = g()->nodes()->create<luci::CircleSqrt>();
+      sqrt->dtype(loco::DataType::FLOAT32);
+      sqrt->shape(shape);
+      sqrt->name("sqrt_" + std::to_string(i));
+      sqrt->x(prev);
+      prev = sqrt;
+    }
+    output()->from(prev);
+  }
+};
+
+class PartitionAutoTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    SqrtChainGraph g;
+    g.init({1, 4});
+    g.transfer_to(&_module);
+
+    _pt.groups = {"cpu", "npu"};
+    _pt.default_group = "cpu";
+    _pt.comply = luci::PartitionTable::COMPLY::OPCODE;
+  }
+
+  std::vector<std::string> groups(void)
+  {
+    std::vector<std::string> result;
+    for (uint32_t i = 0; i < 4; ++i)
+      result.push_back(_pt.byopnames.at("sqrt_" + std::to_string(i)));
+    return result;
+  }
+
+protected:
+  luci::Module _module;
+  luci::PartitionTable _pt;
+  luci::PartitionCost _cost;
+};
+
+} // namespace
+
+TEST_F(PartitionAutoTest, latency_fastest)
+{
+  _cost.ops["cpu"]["_"] = 10.0;
+  _cost.ops["npu"]["SQRT"] = 1.0;
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  ASSERT_EQ(luci::PartitionTable::COMPLY::OPNAME, _pt.comply);
+  std::vector<std::string> expected{"npu", "npu", "npu", "npu"};
+  ASSERT_EQ(expected, groups());
+}
+
+TEST_F(PartitionAutoTest, latency_opname)
+{
+  _cost.ops["cpu"]["_"] = 10.0;
+  _cost.ops["npu"]["SQRT"] = 1.0;
+  _cost.ops["npu"]["sqrt_3"] = 100.0;
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  std::vector<std::string> expected{"npu", "npu", "npu", "cpu"};
+  ASSERT_EQ(expected, groups());
+}
+
+TEST_F(PartitionAutoTest, latency_transfer)
+{
+  // sqrt_1, sqrt_2 are a bit faster in cpu, but transfer of 16 bytes costs more
+  _cost.ops["cpu"]["_"] = 10.0;
+  _cost.ops["cpu"]["sqrt_1"] = 1.0;
+  _cost.ops["cpu"]["sqrt_2"] = 1.0;
+  _cost.ops["npu"]["_"] = 2.0;
+  _cost.transfer = 1.0;
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  std::vector<std::string> expected{"npu", "npu", "npu", "npu"};
+  ASSERT_EQ(expected, groups());
+
+  // without transfer cost, they are moved to cpu
+  _pt.comply = luci::PartitionTable::COMPLY::OPCODE;
+  _pt.byopnames.clear();
+  _cost.transfer = 0.0;
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  expected = {"npu", "cpu", "cpu", "npu"};
+  ASSERT_EQ(expected, groups());
+}
+
+TEST_F(PartitionAutoTest, latency_fixed)
+{
+  _cost.ops["cpu"]["_"] = 10.0;
+  _cost.ops["npu"]["_"] = 1.0;
+  _pt.comply = luci::PartitionTable::COMPLY::OPNAME;
+  _pt.byopnames["sqrt_0"] = "cpu";
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  std::vector<std::string> expected{"cpu", "npu", "npu", "npu"};
+  ASSERT_EQ(expected, groups());
+}
+
+TEST_F(PartitionAutoTest, latency_unsupported)
+{
+  // npu does not support sqrt_2 and nothing supports sqrt_3
+  _cost.ops["cpu"]["sqrt_2"] = 10.0;
+  _cost.ops["npu"]["sqrt_0"] = 1.0;
+  _cost.ops["npu"]["sqrt_1"] = 1.0;
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  std::vector<std::string> expected{"npu", "npu", "cpu", "cpu"};
+  ASSERT_EQ(expected, groups());
+}
+
+TEST_F(PartitionAutoTest, throughput)
+{
+  _cost.goal = luci::PartitionCost::GOAL::THROUGHPUT;
+  _cost.ops["cpu"]["_"] = 1.0;
+  _cost.ops["npu"]["_"] = 1.0;
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  auto result = groups();
+  ASSERT_EQ(result[0], result[1]);
+  ASSERT_NE(result[1], result[2]);
+  ASSERT_EQ(result[2], result[3]);
+}
+
+TEST_F(PartitionAutoTest, throughput_unbalanced)
+{
+  // npu is 3 times faster, so it runs 3 Ops
+  _cost.goal = luci::PartitionCost::GOAL::THROUGHPUT;
+  _cost.ops["cpu"]["_"] = 3.0;
+  _cost.ops["npu"]["_"] = 1.0;
+
+  luci::auto_partition(&_module, _cost, _pt);
+
+  auto result = groups();
+  auto npus = std::count(result.begin(), result.end(), "npu");
+  ASSERT_EQ(3, npus);
+}
+
+TEST_F(PartitionAutoTest, no_group_NEG)
+{
+  _pt.groups.clear();
+
+  EXPECT_ANY_THROW(luci::auto_partition(&_module, _cost, _pt));
+}
+
+TEST_F(PartitionAutoTest, unknown_fixed_group_NEG)
+{
+  _cost.ops["cpu"]["_"] = 1.0;
+  _pt.comply = luci::PartitionTable::COMPLY::OPNAME;
+  _pt.byopnames["sqrt_0"] = "gpu";
+
+  EXPECT_ANY_THROW(luci::auto_partition(&_module, _cost, _pt));
+}
@@ -37,6 +37,9 @@ void dump(std::ostream &os, const luci::PartitionTable &table)
   os << "Assign by OPNAME: " << std::endl;
   for (auto &item : table.byopnames)
     os << "  " << item.first << "=" << item.second << std::endl;
+
+  if (table.memory_budget > 0)
+    os << "Memory budget: " << table.memory_budget << std::endl;
 }
 
 } // namespace
@@ -30,6 +30,8 @@ std::unique_ptr<PGroups> PGroups::make_copy(void) const
 {
   auto d_pgroups = std::make_unique<luci::PGroups>();
 
+  d_pgroups->memory_budget = memory_budget;
+
   for (auto &s_pgroup : pgroups)
   {
     // make a copy of s_pgroup to d_pgroup
@@ -71,6 +71,9 @@ struct PGroups
   // default group key for reference
   GroupKey default_group;
 
+  // memory budget in bytes of a merged pgroup, 0 for no limit
+  uint64_t memory_budget = 0;
+
 public:
   /**
    * @brief return a copy of PGroups
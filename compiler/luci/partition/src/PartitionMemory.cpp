@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionMemory.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <loco/IR/DataTypeTraits.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <set>
+#include <utility>
+
+namespace
+{
+
+uint32_t element_size(loco::DataType dtype)
+{
+  switch (dtype)
+  {
+    case loco::DataType::FLOAT16:
+      return 2;
+    case loco::DataType::Unknown:
+    case loco::DataType::STRING:
+      return 0;
+    default:
+      return loco::size(dtype);
+  }
+}
+
+} // namespace
+
+namespace luci
+{
+
+uint64_t tensor_bytes(const luci::CircleNode *node)
+{
+  uint64_t bytes = element_size(node->dtype());
+  for (uint32_t r = 0; r < node->rank(); ++r)
+  {
+    if (node->dim(r).known())
+      bytes *= node->dim(r).value();
+  }
+  return bytes;
+}
+
+NodeOrder execution_order(const loco::Graph *graph)
+{
+  NodeOrder order;
+
+  auto add = [&order](loco::Node *node) {
+    auto cnode = loco::must_cast<luci::CircleNode *>(node);
+    if (order.find(cnode) == order.end())
+    {
+      auto pos = static_cast<uint32_t>(order.size());
+      order[cnode] = pos;
+    }
+  };
+  auto outputs = loco::output_nodes(const_cast<loco::Graph *>(graph));
+  for (auto node : loco::postorder_traversal(outputs))
+    add(node);
+  for (uint32_t n = 0; n < graph->nodes()->size(); ++n)
+    add(graph->nodes()->at(n));
+
+  return order;
+}
+
+uint64_t estimate_memory(const std::vector<const PGroup *> &pgroups, const NodeOrder &order)
+{
+  std::set<const luci::CircleNode *> members;
+  for (auto pgroup : pgroups)
+  {
+    for (auto &pnode : pgroup->pnodes)
+      members.insert(pnode->node);
+  }
+
+  // position 0 is for the tensors from other pgroups or graph inputs
+  auto pos_of = [&order](const luci::CircleNode *node) {
+    auto it = order.find(node);
+    assert(it != order.end());
+    return it == order.end() ? 0u : it->second + 1;
+  };
+  const uint32_t kEnd = std::numeric_limits<uint32_t>::max();
+
+  // lifetime [first, last] of tensors, by position
+  std::map<const luci::CircleNode *, std::pair<uint32_t, uint32_t>> lives;
+  for (auto node : members)
+  {
+    auto pos = pos_of(node);
+    lives[node] = std::make_pair(pos, pos);
+  }
+
+  std::set<const luci::CircleConst *> consts;
+  for (auto node : members)
+  {
+    for (uint32_t a = 0; a < node->arity(); ++a)
+    {
+      auto arg = loco::must_cast<const luci::CircleNode *>(node->arg(a));
+      if (auto cnst = dynamic_cast<const luci::CircleConst *>(arg))
+      {
+        consts.insert(cnst);
+        continue;
+      }
+      auto it = lives.find(arg);
+      if (it == lives.end())
+        it = lives.emplace(arg, std::make_pair(0u, 0u)).first;
+      it->second.second = std::max(it->second.second, pos_of(node));
+    }
+    // tensor used outside, including graph outputs, should be kept till the end
+    for (auto succ : loco::succs(node))
+    {
+      auto user = loco::must_cast<const luci::CircleNode *>(succ);
+      if (members.find(user) == members.end())
+        lives[node].second = kEnd;
+    }
+  }
+
+  uint64_t weights = 0;
+  for (auto cnst : consts)
+    weights += tensor_bytes(cnst);
+
+  // sweep positions, where tensors released at a position go before added ones
+  std::vector<std::pair<uint32_t, int64_t>> events;
+  for (auto &live : lives)
+  {
+    auto bytes = static_cast<int64_t>(tensor_bytes(live.first));
+    events.emplace_back(live.second.first, bytes);
+    if (live.second.second != kEnd)
+      events.emplace_back(live.second.second + 1, -bytes);
+  }
+  std::sort(events.begin(), events.end());
+
+  int64_t alive = 0;
+  int64_t peak = 0;
+  for (auto &event : events)
+  {
+    alive += event.second;
+    peak = std::max(peak, alive);
+  }
+
+  return weights + static_cast<uint64_t>(peak);
+}
+
+} // namespace luci
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PARTITON_MEMORY_H__
+#define __LUCI_PARTITON_MEMORY_H__
+
+#include "PartitionIR.h"
+
+#include <luci/IR/CircleNode.h>
+
+#include <loco.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace luci
+{
+
+// execution order of nodes in a graph
+using NodeOrder = std::map<const luci::CircleNode *, uint32_t>;
+
+/**
+ * @brief Returns size in bytes of the tensor of node
+ * @note  Unknown dimensions are regarded as 1
+ */
+uint64_t tensor_bytes(const luci::CircleNode *node);
+
+/**
+ * @brief Returns order of nodes in graph, topological from the outputs and then the rest
+ */
+NodeOrder execution_order(const loco::Graph *graph);
+
+/**
+ * @brief Returns estimated memory in bytes to run pgroups as a merged one
+ * @note  Memory is sum of CircleConst inputs and peak of tensors alive while running
+ *        nodes in order. Tensors used by other pgroups are kept alive till the end.
+ */
+uint64_t estimate_memory(const std::vector<const PGroup *> &pgroups, const NodeOrder &order);
+
+} // namespace luci
+
+#endif // __LUCI_PARTITON_MEMORY_H__
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionMemory.h"
+#include "PartitionPGroups.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace luci::test;
+
+// input - add_0 - add_1 - ... - output, where each add has a constant of same shape
+class AddChainGraph : public TestIOGraph
+{
+public:
+  AddChainGraph() = default;
+
+public:
+  void init(const ShapeU32 shape, uint32_t count)
+  {
+    TestIOGraph::init(shape, shape);
+
+    loco::Node *prev = input();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      auto add = g()->nodes()->create<luci::CircleAdd>();
+      add->dtype(loco::DataType::FLOAT32);
+      add->shape(shape);
+      add->fusedActivationFunction(luci::FusedActFunc::NONE);
+      add->name("add_" + std::to_string(i));
+
+      auto cnst = g()->nodes()->create<luci::CircleConst>();
+      cnst->dtype(loco::DataType::FLOAT32);
+      cnst->shape(shape);
+      cnst->size<loco::DataType::FLOAT32>(num_elements(shape));
+      cnst->name("const_" + std::to_string(i));
+
+      add->x(prev);
+      add->y(cnst);
+      prev = add;
+    }
+    output()->from(prev);
+  }
+};
+
+std::vector<const luci::PGroup *> to_vector(const luci::PGroups *pgroups)
+{
+  std::vector<const luci::PGroup *> result;
+  for (auto &pgroup : pgroups->pgroups)
+    result.push_back(pgroup.get());
+  return result;
+}
+
+} // namespace
+
+TEST(PartitionMemoryTest, tensor_bytes)
+{
+  AddChainGraph g;
+  g.init({2, 3}, 1);
+
+  ASSERT_EQ(24, luci::tensor_bytes(g.input()));
+
+  g.input()->dtype(loco::DataType::S16);
+  ASSERT_EQ(12, luci::tensor_bytes(g.input()));
+}
+
+TEST(PartitionMemoryTest, estimate_memory)
+{
+  luci::Module module;
+  AddChainGraph g;
+  g.init({1, 4}, 2);
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.default_group = "A";
+  pt.comply = luci::PartitionTable::COMPLY::OPCODE;
+
+  auto pgs = luci::produce_pgroups(&module, pt);
+  auto order = luci::execution_order(module.graph());
+  auto pgroups = to_vector(pgs.get());
+  ASSERT_EQ(2, pgroups.size());
+
+  // constant 16 + input 16 + output 16
+  ASSERT_EQ(48, luci::estimate_memory({pgroups[0]}, order));
+  // constants 32 + two of input, add_0 and add_1 alive at a time
+  ASSERT_EQ(64, luci::estimate_memory(pgroups, order));
+}
@@ -15,6 +15,7 @@
  */
 
 #include "PartitionMerge.h"
+#include "PartitionMemory.h"
 
 #include <algorithm>
 
@@ -207,6 +208,15 @@ std::unique_ptr<luci::PGroups> merge_pgroups(const luci::PGroups *s_pgroups)
   // - This is initial implementation that works for limited networks
   // - if A and B is same group -> if A is input of B -> ... -> merge B into A
   auto &pgroups = d_pgroups->pgroups;
+
+  // order of nodes to estimate memory of merged pgroups
+  luci::NodeOrder order;
+  if (d_pgroups->memory_budget > 0 && !pgroups.empty() && !pgroups.front()->pnodes.empty())
+  {
+    auto node = pgroups.front()->pnodes.front()->node;
+    order = luci::execution_order(node->graph());
+  }
+
   bool changed;
   do
   {
@@ -233,6 +243,10 @@ std::unique_ptr<luci::PGroups> merge_pgroups(const luci::PGroups *s_pgroups)
         // skip if pgroup has different group for other users of pgroup_i
         if (!is_output_same(pgroup_i.get(), d_pgroups.get()))
           continue;
+        // skip if merged pgroup would exceed the memory budget
+        if (!order.empty() &&
+            luci::estimate_memory({pgroup_i.get(), pgroup.get()}, order) > d_pgroups->memory_budget)
+          continue;
         // TODO add more condition may be needed
 
         merge_into(pgroup.get(), pgroup_i.get());
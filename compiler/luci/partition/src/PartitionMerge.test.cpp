@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionMerge.h"
+#include "PartitionPGroups.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleAdd.h>
+#include <luci/IR/Nodes/CircleConst.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+
+using namespace luci::test;
+
+// input - add_0 - add_1 - ... - output, where each add has a constant of same shape
+class AddChainGraph : public TestIOGraph
+{
+public:
+  AddChainGraph() = default;
+
+public:
+  void init(const ShapeU32 shape, uint32_t count)
+  {
+    TestIOGraph::init(shape, shape);
+
+    loco::Node *prev = input();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      auto add = g()->nodes()->create<luci::CircleAdd>();
+      add->dtype(loco::DataType::FLOAT32);
+      add->shape(shape);
+      add->fusedActivationFunction(luci::FusedActFunc::NONE);
+      add->name("add_" + std::to_string(i));
+
+      auto cnst = g()->nodes()->create<luci::CircleConst>();
+      cnst->dtype(loco::DataType::FLOAT32);
+      cnst->shape(shape);
+      cnst->size<loco::DataType::FLOAT32>(num_elements(shape));
+      cnst->name("const_" + std::to_string(i));
+
+      add->x(prev);
+      add->y(cnst);
+      prev = add;
+    }
+    output()->from(prev);
+  }
+};
+
+class PartitionMergeTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    AddChainGraph g;
+    g.init({1, 4}, 4);
+    g.transfer_to(&_module);
+
+    _pt.default_group = "A";
+    _pt.comply = luci::PartitionTable::COMPLY::OPCODE;
+  }
+
+protected:
+  luci::Module _module;
+  luci::PartitionTable _pt;
+};
+
+} // namespace
+
+TEST_F(PartitionMergeTest, merge_same_group)
+{
+  auto pgs = luci::produce_pgroups(&_module, _pt);
+  ASSERT_EQ(4, pgs->pgroups.size());
+
+  auto mpgs = luci::merge_pgroups(pgs.get());
+  ASSERT_EQ(1, mpgs->pgroups.size());
+}
+
+TEST_F(PartitionMergeTest, merge_memory_budget)
+{
+  // three constants of 16 bytes each with two activations of 16 bytes fit
+  _pt.memory_budget = 80;
+
+  auto pgs = luci::produce_pgroups(&_module, _pt);
+  auto mpgs = luci::merge_pgroups(pgs.get());
+  ASSERT_EQ(2, mpgs->pgroups.size());
+  ASSERT_EQ(3, mpgs->pgroups[0]->pnodes.size());
+  ASSERT_EQ(1, mpgs->pgroups[1]->pnodes.size());
+}
+
+TEST_F(PartitionMergeTest, merge_memory_budget_small_NEG)
+{
+  // pgroup exceeding the budget is kept as is
+  _pt.memory_budget = 1;
+
+  auto pgs = luci::produce_pgroups(&_module, _pt);
+  auto mpgs = luci::merge_pgroups(pgs.get());
+  ASSERT_EQ(4, mpgs->pgroups.size());
+}
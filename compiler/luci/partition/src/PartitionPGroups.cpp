@@ -55,6 +55,11 @@ public:
   bool visit(const luci::CircleNode *) final { return false; }
 };
 
+} // namespace
+
+namespace luci
+{
+
 bool check_allocate_partition(const luci::CircleNode *node)
 {
   IsVirtualNode query;
@@ -72,7 +77,7 @@ bool check_allocate_partition(const luci::CircleNode *node)
   return true;
 }
 
-} // namespace
+} // namespace luci
 
 namespace
 {
@@ -234,6 +239,7 @@ std::unique_ptr<luci::PGroups> produce_pgroups(const luci::Module *source,
   auto pgroups = std::make_unique<luci::PGroups>();
 
   pgroups->default_group = partition.default_group;
+  pgroups->memory_budget = partition.memory_budget;
 
   // Create a PGroup per CircleNode: each PGroup will have one CircleNode
   auto graph = source->graph();
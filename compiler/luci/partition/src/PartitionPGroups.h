@@ -26,6 +26,12 @@
 namespace luci
 {
 
+/**
+ * @brief Returns true if node is an Op to be allocated to a group.
+ * @note  Virtual nodes and CircleConst are not allocated as they follow their users.
+ */
+bool check_allocate_partition(const luci::CircleNode *node);
+
 /**
  * @brief This will produce a PGroups from Module and PartitionTable.
  * @note  Each PGroup will hold one CircleNode and partition key value as group.
@@ -34,14 +34,23 @@ public:
   {
     enum Algorithm
     {
+      FuseAddWithConv,
+      FuseAddWithDwConv,
       FuseAddWithFullyConnected,
       FuseAddWithTConv,
       FuseBatchNormWithConv,
       FuseBatchNormWithDwConv,
       FuseBatchNormWithTConv,
       FuseBCQ,
+      FuseGelu,
+      FuseHardSwish,
       FuseInstanceNorm,
+      FuseLayerNorm,
       FuseMeanWithMean,
+      FuseMulWithConv,
+      FuseMulWithDwConv,
+      FuseMulWithFullyConnected,
+      FuseParallelFCAndConv,
       FuseTransposeWithMean,
       ResolveCustomOpAdd,
       ResolveCustomOpBatchMatMul,
@@ -49,6 +58,7 @@ public:
       ResolveCustomOpMaxPoolWithArgmax,
       FoldAddV2,
       FoldCast,
+      FoldConstants,
       FoldDepthwiseConv2D,
       FoldDequantize,
       FoldGather,
@@ -59,6 +69,7 @@ public:
       MakeBatchNormGammaPositive,
       FuseActivationFunction,
       ShuffleWeightTo16x1Float32,
+      SinkTranspose,
       RemoveRedundantTranspose,
       ReplaceMulAddWithDepthwiseConv,
       ReplaceNonConstFCWithBatchMatMul,
@@ -81,6 +92,7 @@ public:
       RemoveRedundantReshape,
       RemoveFakeQuant,
       RemoveQuantDequantSeq,
+      CommonSubExpressionElimination,
     };
 
     enum AlgorithmParameters
@@ -95,6 +107,9 @@ public:
       // convert NCHW to NHWC
       NCHW_to_NHWC_input_shape,
       NCHW_to_NHWC_output_shape,
+
+      // fold constants
+      FoldConstants_max_size,
     };
 
     virtual ~Options() = default;
@@ -114,6 +129,15 @@ public:
 
   void optimize(loco::Graph *) const;
 
+  /**
+   * @brief Run optimize(loco::Graph *) for all graphs of a module with up to 'num_threads'
+   *        threads
+   *
+   * @note  Graphs with If or While are optimized one by one after others, as inference of
+   *        those operators reads the graphs they call
+   */
+  void optimize_graphs(luci::Module *, uint32_t num_threads) const;
+
   void sparsify(loco::Graph *) const;
 
 private:
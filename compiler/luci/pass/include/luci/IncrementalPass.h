@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_INCREMENTAL_PASS_H__
+#define __LUCI_INCREMENTAL_PASS_H__
+
+#include <loco.h>
+
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief Pass that can revisit only the nodes around changes, instead of the whole graph
+ *
+ * Running it on the nodes changed since its last run must be enough to reach what running it on
+ * the whole graph would, so that a phase runner can skip the rest of the graph.
+ */
+class IncrementalPass
+{
+public:
+  virtual ~IncrementalPass() = default;
+
+public:
+  // Run on the given nodes and return false if there was nothing changed
+  virtual bool run(loco::Graph *g, const std::vector<loco::Node *> &nodes) = 0;
+};
+
+} // namespace luci
+
+#endif // __LUCI_INCREMENTAL_PASS_H__
@@ -19,6 +19,7 @@
 
 #include <loco.h>
 
+#include <luci/IncrementalPass.h>
 #include <luci/ModulePass.h>
 
 namespace luci
@@ -27,7 +28,7 @@ namespace luci
 /**
  * @brief Pass to infer type of circle nodes
  */
-class CircleTypeInferencePass : public luci::Pass
+class CircleTypeInferencePass : public luci::Pass, public luci::IncrementalPass
 {
 public:
   virtual const char *name(void) const { return "luci::CircleTypeInferencePass"; }
@@ -35,6 +36,7 @@ public:
 public:
   bool run(luci::Module *m);
   bool run(loco::Graph *g);
+  bool run(loco::Graph *g, const std::vector<loco::Node *> &nodes);
 };
 
 } // namespace luci
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_FOLD_CONSTANTS_PASS_H__
+#define __LUCI_FOLD_CONSTANTS_PASS_H__
+
+#include <logo/Pass.h>
+
+#include <cstdint>
+
+namespace luci
+{
+
+/**
+ * @brief  Class to fold operators whose inputs are all constant, by evaluating them with
+ *         luci-interpreter kernels
+ *
+ * @note   A folded constant larger than 'max_size' bytes is kept only if the constants it
+ *         replaces are at least as large, so that folding does not grow the model
+ */
+struct FoldConstantsPass final : public logo::Pass
+{
+public:
+  static constexpr uint32_t default_max_size = 1024 * 1024;
+
+public:
+  FoldConstantsPass(uint32_t max_size = default_max_size) : _max_size{max_size}
+  {
+    // DO NOTHING
+  }
+
+public:
+  const char *name(void) const final { return "luci::FoldConstantsPass"; }
+
+  bool run(loco::Graph *g) final;
+
+private:
+  uint32_t _max_size;
+};
+
+} // namespace luci
+
+#endif // __LUCI_FOLD_CONSTANTS_PASS_H__
@@ -16,24 +16,35 @@
 
 #include "luci/CircleOptimizer.h"
 
+#include "luci/Pass/CommonSubExpressionEliminationPass.h"
 #include "luci/Pass/ConvertNCHWToNHWCPass.h"
 #include "luci/Pass/ExpandBroadcastConstPass.h"
 #include "luci/Pass/FoldAddV2Pass.h"
 #include "luci/Pass/FoldCastPass.h"
+#include "luci/Pass/FoldConstantsPass.h"
 #include "luci/Pass/FoldDepthwiseConv2DPass.h"
 #include "luci/Pass/FoldDequantizePass.h"
 #include "luci/Pass/FoldGatherPass.h"
 #include "luci/Pass/FoldSparseToDensePass.h"
 #include "luci/Pass/ForwardReshapeToUnaryOpPass.h"
 #include "luci/Pass/FuseActivationFunctionPass.h"
+#include "luci/Pass/FuseAddWithConvPass.h"
+#include "luci/Pass/FuseAddWithDwConvPass.h"
 #include "luci/Pass/FuseAddWithFullyConnectedPass.h"
 #include "luci/Pass/FuseAddWithTConvPass.h"
 #include "luci/Pass/FuseBatchNormWithConvPass.h"
 #include "luci/Pass/FuseBatchNormWithDwConvPass.h"
 #include "luci/Pass/FuseBatchNormWithTConvPass.h"
 #include "luci/Pass/FuseBCQPass.h"
+#include "luci/Pass/FuseGeluPass.h"
+#include "luci/Pass/FuseHardSwishPass.h"
 #include "luci/Pass/FuseInstanceNormPass.h"
+#include "luci/Pass/FuseLayerNormPass.h"
 #include "luci/Pass/FuseMeanWithMeanPass.h"
+#include "luci/Pass/FuseMulWithConvPass.h"
+#include "luci/Pass/FuseMulWithDwConvPass.h"
+#include "luci/Pass/FuseMulWithFullyConnectedPass.h"
+#include "luci/Pass/FuseParallelFCAndConvPass.h"
 #include "luci/Pass/FusePreActivationBatchNormPass.h"
 #include "luci/Pass/FuseTransposeWithMeanPass.h"
 #include "luci/Pass/MakeBatchNormGammaPositivePass.h"
@@ -55,6 +66,7 @@
 #include "luci/Pass/ResolveCustomOpMaxPoolWithArgmaxPass.h"
 #include "luci/Pass/SparsifyTensorPass.h"
 #include "luci/Pass/ShuffleWeightTo16x1Float32Pass.h"
+#include "luci/Pass/SinkTransposePass.h"
 #include "luci/Pass/SubstitutePackToReshapePass.h"
 #include "luci/Pass/SubstitutePadV2ToPadPass.h"
 #include "luci/Pass/SubstituteSplitVToSplitPass.h"
@@ -72,14 +84,19 @@
 #include <logo/RemoveDeadNodeWithQueryPass.h>
 
 #include "ModulePhase.h"
+#include "IncrementalPhase.h"
 #include "ProgressReporter.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <logo/Phase.h>
 #include <pepper/csv2vec.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <memory>
 #include <sstream>
+#include <thread>
 
 namespace
 {
@@ -143,6 +160,34 @@ void convert_nchw_to_nhwc(loco::Graph *g, bool preserve_input, bool preserve_out
   logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
+
+  // Conversion puts Transposes around each converted operator, which are cancelled here over the
+  // whole graph. This is a phase of its own, as ConvertNCHWToNHWCPass matches those Transposes.
+  logo::Phase layout_phase;
+
+  layout_phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+  layout_phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+  layout_phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+
+  layout_phase.emplace_back(std::make_unique<luci::SinkTransposePass>());
+  layout_phase.emplace_back(std::make_unique<luci::RemoveRedundantTransposePass>());
+
+  phase_runner.run(layout_phase);
+}
+
+/**
+ * @brief Return true if a graph has operators calling other graphs
+ */
+bool calls_graphs(loco::Graph *g)
+{
+  for (auto node : loco::all_nodes(g))
+  {
+    if (dynamic_cast<luci::CircleIf *>(node) != nullptr)
+      return true;
+    if (dynamic_cast<luci::CircleWhile *>(node) != nullptr)
+      return true;
+  }
+  return false;
 }
 
 } // namespace
@@ -225,6 +270,18 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<FuseInstanceNormPass>());
   }
+  if (_options->query(Options::Algorithm::FuseLayerNorm))
+  {
+    phase.emplace_back(std::make_unique<FuseLayerNormPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseGelu))
+  {
+    phase.emplace_back(std::make_unique<FuseGeluPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseHardSwish))
+  {
+    phase.emplace_back(std::make_unique<FuseHardSwishPass>());
+  }
   if (_options->query(Options::Algorithm::FuseBatchNormWithConv))
   {
     phase.emplace_back(std::make_unique<FuseBatchNormWithConvPass>());
@@ -237,6 +294,26 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<FuseBatchNormWithTConvPass>());
   }
+  if (_options->query(Options::Algorithm::FuseMulWithConv))
+  {
+    phase.emplace_back(std::make_unique<FuseMulWithConvPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseAddWithConv))
+  {
+    phase.emplace_back(std::make_unique<FuseAddWithConvPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseMulWithDwConv))
+  {
+    phase.emplace_back(std::make_unique<FuseMulWithDwConvPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseAddWithDwConv))
+  {
+    phase.emplace_back(std::make_unique<FuseAddWithDwConvPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseMulWithFullyConnected))
+  {
+    phase.emplace_back(std::make_unique<FuseMulWithFullyConnectedPass>());
+  }
   if (_options->query(Options::Algorithm::FuseAddWithFullyConnected))
   {
     phase.emplace_back(std::make_unique<FuseAddWithFullyConnectedPass>());
@@ -245,6 +322,10 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<FuseAddWithTConvPass>());
   }
+  if (_options->query(Options::Algorithm::FuseParallelFCAndConv))
+  {
+    phase.emplace_back(std::make_unique<FuseParallelFCAndConvPass>());
+  }
   if (_options->query(Options::Algorithm::FuseActivationFunction))
   {
     phase.emplace_back(std::make_unique<FuseActivationFunctionPass>());
@@ -261,6 +342,14 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<luci::FoldCastPass>());
   }
+  if (_options->query(Options::Algorithm::FoldConstants))
+  {
+    const auto max_size = _options->param(Options::AlgorithmParameters::FoldConstants_max_size);
+    if (max_size.empty())
+      phase.emplace_back(std::make_unique<luci::FoldConstantsPass>());
+    else
+      phase.emplace_back(std::make_unique<luci::FoldConstantsPass>(std::stoul(max_size)));
+  }
   if (_options->query(Options::Algorithm::FoldDepthwiseConv2D))
   {
     phase.emplace_back(std::make_unique<luci::FoldDepthwiseConv2DPass>());
@@ -277,6 +366,10 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<luci::FoldSparseToDensePass>());
   }
+  if (_options->query(Options::Algorithm::CommonSubExpressionElimination))
+  {
+    phase.emplace_back(std::make_unique<luci::CommonSubExpressionEliminationPass>());
+  }
   if (_options->query(Options::Algorithm::ForwardReshapeToUnaryOp))
   {
     phase.emplace_back(std::make_unique<luci::ForwardReshapeToUnaryOpPass>());
@@ -325,7 +418,12 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   {
     phase.emplace_back(std::make_unique<luci::RemoveRedundantReshapePass>());
   }
-  if (_options->query(Options::Algorithm::RemoveRedundantTranspose))
+  if (_options->query(Options::Algorithm::SinkTranspose))
+  {
+    phase.emplace_back(std::make_unique<luci::SinkTransposePass>());
+  }
+  if (_options->query(Options::Algorithm::RemoveRedundantTranspose) ||
+      _options->query(Options::Algorithm::SinkTranspose))
   {
     phase.emplace_back(std::make_unique<luci::RemoveRedundantTransposePass>());
   }
@@ -380,12 +478,67 @@ void CircleOptimizer::optimize(loco::Graph *g) const
 
   /* TRANSFORM DECLARATION END */
 
+  // Reaches what Restart does, but shape and type inferences after each change revisit only the
+  // changed nodes
   ProgressReporter prog(g, logo::PhaseStrategy::Restart);
-  logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
+  IncrementalPhaseRunner phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
 
+void CircleOptimizer::optimize_graphs(luci::Module *m, uint32_t num_threads) const
+{
+  std::vector<loco::Graph *> independent_graphs;
+  std::vector<loco::Graph *> calling_graphs;
+  for (size_t idx = 0; idx < m->size(); ++idx)
+  {
+    auto graph = m->graph(idx);
+    if (calls_graphs(graph))
+      calling_graphs.push_back(graph);
+    else
+      independent_graphs.push_back(graph);
+  }
+
+  const auto num_workers =
+    std::min<size_t>(std::max<uint32_t>(num_threads, 1), independent_graphs.size());
+  if (num_workers <= 1)
+  {
+    for (auto graph : independent_graphs)
+      optimize(graph);
+  }
+  else
+  {
+    std::atomic<size_t> next{0};
+    std::vector<std::exception_ptr> errors(num_workers);
+    auto worker = [&](size_t id) {
+      try
+      {
+        for (auto idx = next++; idx < independent_graphs.size(); idx = next++)
+          optimize(independent_graphs.at(idx));
+      }
+      catch (...)
+      {
+        errors.at(id) = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t id = 0; id < num_workers; ++id)
+      threads.emplace_back(worker, id);
+    for (auto &thread : threads)
+      thread.join();
+
+    for (auto &error : errors)
+    {
+      if (error)
+        std::rethrow_exception(error);
+    }
+  }
+
+  for (auto graph : calling_graphs)
+    optimize(graph);
+}
+
 void CircleOptimizer::sparsify(loco::Graph *g) const
 {
   if (_options->query(Options::Algorithm::SparsifyTensorPass))
@@ -45,6 +45,25 @@ bool is_same_shape(luci::CircleNode *node, loco::TensorShape shape)
   return true;
 }
 
+bool infer_shape(const luci::sinf::Rule &shape_infer_rule, loco::Node *node)
+{
+  loco::TensorShape shape;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+  if (shape_infer_rule.infer(circle_node, shape) && !is_same_shape(circle_node, shape))
+  {
+    circle_node->rank(shape.rank());
+    for (uint32_t i = 0; i < shape.rank(); ++i)
+      circle_node->dim(i) = shape.dim(i);
+
+    circle_node->shape_status(luci::ShapeStatus::VALID);
+
+    return true;
+  }
+
+  return false;
+}
+
 } // namespace
 
 namespace luci
@@ -70,22 +89,19 @@ bool CircleShapeInferencePass::run(loco::Graph *g)
 
   for (auto node : inference_candidates(g))
   {
-    loco::TensorShape shape;
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-
-    if (shape_infer_rule.infer(circle_node, shape) && !is_same_shape(circle_node, shape))
-    {
-      circle_node->rank(shape.rank());
-      for (uint32_t i = 0; i < shape.rank(); ++i)
-        circle_node->dim(i) = shape.dim(i);
-
-      circle_node->shape_status(luci::ShapeStatus::VALID);
-
+    if (infer_shape(shape_infer_rule, node))
       changed = true;
-    }
   }
 
   return changed;
 }
 
+bool CircleShapeInferencePass::run(loco::Graph *g, const std::vector<loco::Node *> &nodes)
+{
+  luci::sinf::Rule shape_infer_rule;
+
+  return infer_candidates_from(
+    g, nodes, [&](loco::Node *node) { return infer_shape(shape_infer_rule, node); });
+}
+
 } // namespace luci
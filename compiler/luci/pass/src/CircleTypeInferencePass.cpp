@@ -22,6 +22,25 @@
 
 #include <loco.h>
 
+namespace
+{
+
+bool infer_type(const luci::tinf::Rule &type_infer_rule, loco::Node *node)
+{
+  loco::DataType dtype;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+  if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
+  {
+    circle_node->dtype(dtype);
+    return true;
+  }
+
+  return false;
+}
+
+} // namespace
+
 namespace luci
 {
 
@@ -45,17 +64,19 @@ bool CircleTypeInferencePass::run(loco::Graph *g)
 
   for (auto node : inference_candidates(g))
   {
-    loco::DataType dtype;
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-
-    if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
-    {
-      circle_node->dtype(dtype);
+    if (infer_type(type_infer_rule, node))
       changed = true;
-    }
   }
 
   return changed;
 }
 
+bool CircleTypeInferencePass::run(loco::Graph *g, const std::vector<loco::Node *> &nodes)
+{
+  luci::tinf::Rule type_infer_rule;
+
+  return infer_candidates_from(
+    g, nodes, [&](loco::Node *node) { return infer_type(type_infer_rule, node); });
+}
+
 } // namespace luci
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/CommonSubExpressionEliminationPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+#include <loco/IR/DataTypeTraits.h>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+inline void hash_combine(size_t &seed, size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * @brief Return true if an input is a placeholder for a missing input
+ *
+ * @note  Placeholders are created per node, so they are compared by type, not identity
+ */
+bool is_placeholder(const loco::Node *node)
+{
+  return dynamic_cast<const luci::CircleOutputExclude *>(node) != nullptr or
+         dynamic_cast<const luci::CircleOutputDummy *>(node) != nullptr;
+}
+
+bool same_input(const loco::Node *lhs, const loco::Node *rhs)
+{
+  if (lhs == rhs)
+    return true;
+
+  if (is_placeholder(lhs) and is_placeholder(rhs))
+  {
+    auto lhs_circle = loco::must_cast<const luci::CircleNode *>(lhs);
+    auto rhs_circle = loco::must_cast<const luci::CircleNode *>(rhs);
+    return lhs_circle->opcode() == rhs_circle->opcode();
+  }
+
+  return false;
+}
+
+bool same_quantparam(const luci::CircleNode *lhs, const luci::CircleNode *rhs)
+{
+  auto lhs_qparam = lhs->quantparam();
+  auto rhs_qparam = rhs->quantparam();
+
+  if (lhs_qparam == nullptr or rhs_qparam == nullptr)
+    return lhs_qparam == rhs_qparam;
+
+  return lhs_qparam->min == rhs_qparam->min and lhs_qparam->max == rhs_qparam->max and
+         lhs_qparam->scale == rhs_qparam->scale and lhs_qparam->zerop == rhs_qparam->zerop and
+         lhs_qparam->quantized_dimension == rhs_qparam->quantized_dimension;
+}
+
+bool same_shape(const luci::CircleNode *lhs, const luci::CircleNode *rhs)
+{
+  if (lhs->rank() != rhs->rank())
+    return false;
+
+  for (uint32_t i = 0; i < lhs->rank(); ++i)
+  {
+    if (not(lhs->dim(i) == rhs->dim(i)))
+      return false;
+  }
+
+  return true;
+}
+
+template <loco::DataType DT>
+bool same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
+{
+  if (lhs->size<DT>() != rhs->size<DT>())
+    return false;
+
+  for (uint32_t i = 0; i < lhs->size<DT>(); ++i)
+  {
+    if (lhs->at<DT>(i) != rhs->at<DT>(i))
+      return false;
+  }
+
+  return true;
+}
+
+template <loco::DataType DT> size_t hash_elements(const luci::CircleConst *node, size_t seed)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
+
+  for (uint32_t i = 0; i < node->size<DT>(); ++i)
+    hash_combine(seed, std::hash<T>{}(node->at<DT>(i)));
+  return seed;
+}
+
+/**
+ * @brief Return true if two nodes of the same type have the same attributes
+ *
+ * @note  Only the operators listed here are merged. Others, including the operators with
+ *        multiple outputs or with states, are always regarded as different.
+ */
+class SameAttributes final : public luci::CircleNodeVisitor<bool>
+{
+public:
+  explicit SameAttributes(const luci::CircleNode *other) : _other(other) {}
+
+private:
+  template <class CIRCLENODE> const CIRCLENODE *other(const CIRCLENODE *)
+  {
+    return loco::must_cast<const CIRCLENODE *>(_other);
+  }
+
+public:
+  bool visit(const luci::CircleConst *node) final
+  {
+    auto rhs = other(node);
+    if (node->sparsityparam() != nullptr or rhs->sparsityparam() != nullptr)
+      return false;
+    if (not same_shape(node, rhs))
+      return false;
+
+    switch (node->dtype())
+    {
+      case loco::DataType::FLOAT32:
+        return same_elements<loco::DataType::FLOAT32>(node, rhs);
+      case loco::DataType::S8:
+        return same_elements<loco::DataType::S8>(node, rhs);
+      case loco::DataType::S16:
+        return same_elements<loco::DataType::S16>(node, rhs);
+      case loco::DataType::S32:
+        return same_elements<loco::DataType::S32>(node, rhs);
+      case loco::DataType::S64:
+        return same_elements<loco::DataType::S64>(node, rhs);
+      case loco::DataType::U8:
+        return same_elements<loco::DataType::U8>(node, rhs);
+      case loco::DataType::BOOL:
+        return same_elements<loco::DataType::BOOL>(node, rhs);
+      default:
+        break;
+    }
+    return false;
+  }
+
+  // Operators without attributes
+  bool visit(const luci::CircleAbs *) final { return true; }
+  bool visit(const luci::CircleDequantize *) final { return true; }
+  bool visit(const luci::CircleExp *) final { return true; }
+  bool visit(const luci::CircleExpandDims *) final { return true; }
+  bool visit(const luci::CircleHardSwish *) final { return true; }
+  bool visit(const luci::CircleLogistic *) final { return true; }
+  bool visit(const luci::CircleMaximum *) final { return true; }
+  bool visit(const luci::CircleMinimum *) final { return true; }
+  bool visit(const luci::CircleNeg *) final { return true; }
+  bool visit(const luci::CircleQuantize *) final { return true; }
+  bool visit(const luci::CircleRelu *) final { return true; }
+  bool visit(const luci::CircleRelu6 *) final { return true; }
+  bool visit(const luci::CircleRsqrt *) final { return true; }
+  bool visit(const luci::CircleSlice *) final { return true; }
+  bool visit(const luci::CircleSqrt *) final { return true; }
+  bool visit(const luci::CircleSquare *) final { return true; }
+  bool visit(const luci::CircleTanh *) final { return true; }
+  bool visit(const luci::CircleTranspose *) final { return true; }
+
+  // Operators with fused activation function
+  bool visit(const luci::CircleAdd *node) final { return same_act(node); }
+  bool visit(const luci::CircleDiv *node) final { return same_act(node); }
+  bool visit(const luci::CircleMul *node) final { return same_act(node); }
+  bool visit(const luci::CircleSub *node) final { return same_act(node); }
+
+  bool visit(const luci::CircleCast *node) final
+  {
+    auto rhs = other(node);
+    return node->in_data_type() == rhs->in_data_type() and
+           node->out_data_type() == rhs->out_data_type();
+  }
+
+  bool visit(const luci::CircleConcatenation *node) final
+  {
+    auto rhs = other(node);
+    return node->axis() == rhs->axis() and same_act(node);
+  }
+
+  bool visit(const luci::CircleFullyConnected *node) final
+  {
+    auto rhs = other(node);
+    return node->weights_format() == rhs->weights_format() and
+           node->keep_num_dims() == rhs->keep_num_dims() and same_act(node);
+  }
+
+  bool visit(const luci::CircleGather *node) final { return node->axis() == other(node)->axis(); }
+
+  bool visit(const luci::CircleGelu *node) final
+  {
+    return node->approximate() == other(node)->approximate();
+  }
+
+  bool visit(const luci::CircleMean *node) final
+  {
+    return node->keep_dims() == other(node)->keep_dims();
+  }
+
+  bool visit(const luci::CirclePack *node) final { return node->axis() == other(node)->axis(); }
+
+  bool visit(const luci::CircleReduceMax *node) final
+  {
+    return node->keep_dims() == other(node)->keep_dims();
+  }
+
+  bool visit(const luci::CircleReshape *node) final
+  {
+    auto lhs_shape = node->newShape();
+    auto rhs_shape = other(node)->newShape();
+    if (lhs_shape->rank() != rhs_shape->rank())
+      return false;
+    for (uint32_t i = 0; i < lhs_shape->rank(); ++i)
+    {
+      if (lhs_shape->dim(i) != rhs_shape->dim(i))
+        return false;
+    }
+    return true;
+  }
+
+  bool visit(const luci::CircleShape *node) final
+  {
+    return node->out_type() == other(node)->out_type();
+  }
+
+  bool visit(const luci::CircleSoftmax *node) final { return node->beta() == other(node)->beta(); }
+
+  bool visit(const luci::CircleSqueeze *node) final
+  {
+    return node->squeeze_dims() == other(node)->squeeze_dims();
+  }
+
+  bool visit(const luci::CircleStridedSlice *node) final
+  {
+    auto rhs = other(node);
+    return node->begin_mask() == rhs->begin_mask() and node->end_mask() == rhs->end_mask() and
+           node->ellipsis_mask() == rhs->ellipsis_mask() and
+           node->new_axis_mask() == rhs->new_axis_mask() and
+           node->shrink_axis_mask() == rhs->shrink_axis_mask();
+  }
+
+  bool visit(const luci::CircleSum *node) final
+  {
+    return node->keep_dims() == other(node)->keep_dims();
+  }
+
+  // Others are never merged
+  bool visit(const luci::CircleNode *) final { return false; }
+
+private:
+  template <class CIRCLENODE> bool same_act(const CIRCLENODE *node)
+  {
+    return node->fusedActivationFunction() == other(node)->fusedActivationFunction();
+  }
+
+private:
+  const luci::CircleNode *_other;
+};
+
+size_t hash_node(const luci::CircleNode *node)
+{
+  size_t seed = std::hash<uint32_t>{}(static_cast<uint32_t>(node->opcode()));
+  hash_combine(seed, std::hash<int>{}(static_cast<int>(node->dtype())));
+  hash_combine(seed, node->arity());
+
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    auto input = node->arg(i);
+    if (is_placeholder(input))
+      hash_combine(seed, static_cast<uint32_t>(loco::must_cast<luci::CircleNode *>(input)->opcode()));
+    else
+      hash_combine(seed, std::hash<const loco::Node *>{}(input));
+  }
+
+  if (auto const_node = dynamic_cast<const luci::CircleConst *>(node))
+  {
+    for (uint32_t i = 0; i < const_node->rank(); ++i)
+      hash_combine(seed, const_node->dim(i).known() ? const_node->dim(i).value() : 0);
+
+    switch (const_node->dtype())
+    {
+      case loco::DataType::FLOAT32:
+        return hash_elements<loco::DataType::FLOAT32>(const_node, seed);
+      case loco::DataType::S32:
+        return hash_elements<loco::DataType::S32>(const_node, seed);
+      case loco::DataType::S64:
+        return hash_elements<loco::DataType::S64>(const_node, seed);
+      default:
+        // Other types are compared only by shape here and fully compared later
+        break;
+    }
+  }
+
+  return seed;
+}
+
+bool equivalent(const luci::CircleNode *lhs, const luci::CircleNode *rhs)
+{
+  if (lhs->opcode() != rhs->opcode())
+    return false;
+  if (lhs->dtype() != rhs->dtype())
+    return false;
+  if (lhs->arity() != rhs->arity())
+    return false;
+
+  for (uint32_t i = 0; i < lhs->arity(); ++i)
+  {
+    if (not same_input(lhs->arg(i), rhs->arg(i)))
+      return false;
+  }
+
+  if (not same_quantparam(lhs, rhs))
+    return false;
+
+  SameAttributes same(rhs);
+  return lhs->accept(&same);
+}
+
+bool feeds_graph_output(const luci::CircleNode *node)
+{
+  for (auto succ : loco::succs(node))
+  {
+    if (dynamic_cast<luci::CircleOutput *>(succ) != nullptr)
+      return true;
+  }
+  return false;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool CommonSubExpressionEliminationPass::run(loco::Graph *g)
+{
+  bool changed = false;
+
+  // Nodes are visited in post-order so that inputs of a node are already merged
+  std::unordered_map<size_t, std::vector<luci::CircleNode *>> buckets;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+    // NOTE Each output of a graph should keep its own tensor
+    if (feeds_graph_output(circle_node))
+      continue;
+
+    auto &bucket = buckets[hash_node(circle_node)];
+
+    luci::CircleNode *found = nullptr;
+    for (auto candidate : bucket)
+    {
+      if (equivalent(candidate, circle_node))
+      {
+        found = candidate;
+        break;
+      }
+    }
+
+    if (found == nullptr)
+    {
+      bucket.push_back(circle_node);
+      continue;
+    }
+
+    luci::add_origin(found, luci::get_origin(circle_node));
+    replace(circle_node).with(found);
+    changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
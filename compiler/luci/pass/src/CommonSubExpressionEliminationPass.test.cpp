@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/CommonSubExpressionEliminationPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+luci::CircleConst *create_const(loco::Graph *g, float value)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape({1});
+  node->size<loco::DataType::FLOAT32>(1);
+  node->at<loco::DataType::FLOAT32>(0) = value;
+  node->name("const");
+  return node;
+}
+
+luci::CircleAdd *create_add(loco::Graph *g, loco::Node *x, loco::Node *y)
+{
+  auto node = g->nodes()->create<luci::CircleAdd>();
+  node->x(x);
+  node->y(y);
+  node->fusedActivationFunction(luci::FusedActFunc::NONE);
+  node->dtype(loco::DataType::FLOAT32);
+  node->name("add");
+  return node;
+}
+
+/**
+ *  Graph with duplicate subexpressions
+ *
+ *            [CircleInput]
+ *             |         |
+ *   [CircleAdd] (+1)   [CircleAdd] (+1)
+ *             |         |
+ *     [CircleRelu]   [CircleRelu]
+ *              \      /
+ *             [CircleMul]
+ *                  |
+ *            [CircleOutput]
+ */
+class DuplicateGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1, 4}, {1, 4});
+
+    _const_1 = create_const(g(), 1.0f);
+    _const_2 = create_const(g(), 1.0f);
+
+    _add_1 = create_add(g(), input(), _const_1);
+    _add_2 = create_add(g(), input(), _const_2);
+
+    _relu_1 = g()->nodes()->create<luci::CircleRelu>();
+    _relu_1->features(_add_1);
+    _relu_1->dtype(loco::DataType::FLOAT32);
+    _relu_1->name("relu_1");
+
+    _relu_2 = g()->nodes()->create<luci::CircleRelu>();
+    _relu_2->features(_add_2);
+    _relu_2->dtype(loco::DataType::FLOAT32);
+    _relu_2->name("relu_2");
+
+    _mul = g()->nodes()->create<luci::CircleMul>();
+    _mul->x(_relu_1);
+    _mul->y(_relu_2);
+    _mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _mul->dtype(loco::DataType::FLOAT32);
+    _mul->name("mul");
+
+    output()->from(_mul);
+  }
+
+protected:
+  luci::CircleConst *_const_1 = nullptr;
+  luci::CircleConst *_const_2 = nullptr;
+  luci::CircleAdd *_add_1 = nullptr;
+  luci::CircleAdd *_add_2 = nullptr;
+  luci::CircleRelu *_relu_1 = nullptr;
+  luci::CircleRelu *_relu_2 = nullptr;
+  luci::CircleMul *_mul = nullptr;
+};
+
+class CommonSubExpressionEliminationPassTest : public ::testing::Test, public DuplicateGraph
+{
+public:
+  luci::CommonSubExpressionEliminationPass pass;
+};
+
+} // namespace
+
+TEST(CommonSubExpressionEliminationPass, name)
+{
+  luci::CommonSubExpressionEliminationPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(CommonSubExpressionEliminationPassTest, merge_duplicates)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  EXPECT_EQ(_mul->x(), _mul->y());
+
+  auto relu = dynamic_cast<luci::CircleRelu *>(_mul->x());
+  ASSERT_NE(nullptr, relu);
+  auto add = dynamic_cast<luci::CircleAdd *>(relu->features());
+  ASSERT_NE(nullptr, add);
+  EXPECT_EQ(input(), add->x());
+}
+
+TEST_F(CommonSubExpressionEliminationPassTest, merge_consts_only)
+{
+  init();
+
+  // Adds still differ after the constants are merged
+  _add_2->fusedActivationFunction(luci::FusedActFunc::RELU);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  EXPECT_NE(_mul->x(), _mul->y());
+  EXPECT_EQ(_add_1->y(), _add_2->y());
+}
+
+TEST_F(CommonSubExpressionEliminationPassTest, different_const_NEG)
+{
+  init();
+
+  _const_2->at<loco::DataType::FLOAT32>(0) = 2.0f;
+
+  EXPECT_FALSE(pass.run(g()));
+
+  EXPECT_NE(_mul->x(), _mul->y());
+}
+
+TEST_F(CommonSubExpressionEliminationPassTest, different_attribute_NEG)
+{
+  init();
+
+  _add_2->y(_const_1);
+  _add_2->fusedActivationFunction(luci::FusedActFunc::RELU6);
+
+  EXPECT_FALSE(pass.run(g()));
+
+  EXPECT_NE(_mul->x(), _mul->y());
+}
@@ -820,6 +820,13 @@ class ConvertNCHWToNHWC final : public luci::CircleNodeMutableVisitor<bool>
 
   bool visit(luci::CircleElu *node) { return convert_unary_features<luci::CircleElu>(node); }
 
+  bool visit(luci::CircleGelu *node) { return convert_unary_features<luci::CircleGelu>(node); }
+
+  bool visit(luci::CircleHardSwish *node)
+  {
+    return convert_unary_features<luci::CircleHardSwish>(node);
+  }
+
   bool visit(luci::CircleLeakyRelu *node)
   {
     return convert_unary_features<luci::CircleLeakyRelu>(node);
@@ -1306,6 +1313,8 @@ bool ConvertNCHWToNHWCPass::run(loco::Graph *g)
       case luci::CircleOpcode::ADD:
       case luci::CircleOpcode::CONCATENATION:
       case luci::CircleOpcode::ELU:
+      case luci::CircleOpcode::GELU:
+      case luci::CircleOpcode::HARD_SWISH:
       case luci::CircleOpcode::LEAKY_RELU:
       case luci::CircleOpcode::LOGISTIC:
       case luci::CircleOpcode::MAXIMUM:
@@ -447,6 +447,38 @@ public:
   luci::CircleElu *elu = nullptr;
 };
 
+class GeluGraph final : public SimpleGraph
+{
+protected:
+  loco::Node *insertGraphBody(loco::Node *input) override
+  {
+    gelu = g.nodes()->create<luci::CircleGelu>();
+    gelu->features(input);
+    gelu->name("gelu");
+
+    return gelu;
+  }
+
+public:
+  luci::CircleGelu *gelu = nullptr;
+};
+
+class HardSwishGraph final : public SimpleGraph
+{
+protected:
+  loco::Node *insertGraphBody(loco::Node *input) override
+  {
+    hard_swish = g.nodes()->create<luci::CircleHardSwish>();
+    hard_swish->features(input);
+    hard_swish->name("hard_swish");
+
+    return hard_swish;
+  }
+
+public:
+  luci::CircleHardSwish *hard_swish = nullptr;
+};
+
 class LeakyReluGraph final : public SimpleGraph
 {
 protected:
@@ -1144,6 +1176,46 @@ TEST(ConvertNCHWToNHWC, Elu)
   EXPECT_EQ(16, g.elu->dim(3).value());
 }
 
+TEST(ConvertNCHWToNHWC, Gelu)
+{
+  GeluGraph g;
+  g.init();
+
+  run_phase(&g.g, true, true);
+
+  check_pre_trans(g.gelu->features());
+
+  auto gelu_succs = loco::succs(g.gelu);
+  EXPECT_EQ(1, gelu_succs.size());
+  check_post_trans(*gelu_succs.begin());
+
+  // Check gelu shape
+  EXPECT_EQ(1, g.gelu->dim(0).value());
+  EXPECT_EQ(4, g.gelu->dim(1).value());
+  EXPECT_EQ(4, g.gelu->dim(2).value());
+  EXPECT_EQ(16, g.gelu->dim(3).value());
+}
+
+TEST(ConvertNCHWToNHWC, HardSwish)
+{
+  HardSwishGraph g;
+  g.init();
+
+  run_phase(&g.g, true, true);
+
+  check_pre_trans(g.hard_swish->features());
+
+  auto hard_swish_succs = loco::succs(g.hard_swish);
+  EXPECT_EQ(1, hard_swish_succs.size());
+  check_post_trans(*hard_swish_succs.begin());
+
+  // Check hard_swish shape
+  EXPECT_EQ(1, g.hard_swish->dim(0).value());
+  EXPECT_EQ(4, g.hard_swish->dim(1).value());
+  EXPECT_EQ(4, g.hard_swish->dim(2).value());
+  EXPECT_EQ(16, g.hard_swish->dim(3).value());
+}
+
 TEST(ConvertNCHWToNHWC, LeakyRelu)
 {
   LeakyReluGraph g;
@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/IR/Module.h>
+#include <luci/Service/CircleNodeClone.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+#include <luci/Log.h>
+
+#include <luci_interpreter/Interpreter.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+namespace
+{
+
+using MapNode2Clone = std::map<const loco::Node *, luci::CircleNode *>;
+
+/**
+ * @brief Connect a clone of a node to the clones of the arguments of the node
+ * @note  Returns false for operators that are not folded
+ */
+class ConnectClone final : public luci::CircleNodeMutableVisitor<bool>
+{
+public:
+  ConnectClone(const luci::CircleNode *org, const MapNode2Clone &clones)
+    : _org{org}, _clones{clones}
+  {
+  }
+
+public:
+  bool visit(luci::CircleNode *) final { return false; }
+
+  // Elementwise binary
+  bool visit(luci::CircleAdd *node) final { return connect_xy(node); }
+  bool visit(luci::CircleSub *node) final { return connect_xy(node); }
+  bool visit(luci::CircleMul *node) final { return connect_xy(node); }
+  bool visit(luci::CircleDiv *node) final { return connect_xy(node); }
+  bool visit(luci::CircleFloorDiv *node) final { return connect_xy(node); }
+  bool visit(luci::CircleMaximum *node) final { return connect_xy(node); }
+  bool visit(luci::CircleMinimum *node) final { return connect_xy(node); }
+  bool visit(luci::CirclePow *node) final { return connect_xy(node); }
+  bool visit(luci::CircleSquaredDifference *node) final { return connect_xy(node); }
+  bool visit(luci::CircleEqual *node) final { return connect_xy(node); }
+  bool visit(luci::CircleNotEqual *node) final { return connect_xy(node); }
+  bool visit(luci::CircleGreater *node) final { return connect_xy(node); }
+  bool visit(luci::CircleGreaterEqual *node) final { return connect_xy(node); }
+  bool visit(luci::CircleLess *node) final { return connect_xy(node); }
+  bool visit(luci::CircleLessEqual *node) final { return connect_xy(node); }
+  bool visit(luci::CircleLogicalAnd *node) final { return connect_xy(node); }
+  bool visit(luci::CircleLogicalOr *node) final { return connect_xy(node); }
+
+  // Elementwise unary
+  bool visit(luci::CircleCast *node) final { return connect_x(node); }
+  bool visit(luci::CircleExp *node) final { return connect_x(node); }
+  bool visit(luci::CircleFloor *node) final { return connect_x(node); }
+  bool visit(luci::CircleLogicalNot *node) final { return connect_x(node); }
+  bool visit(luci::CircleLogistic *node) final { return connect_x(node); }
+  bool visit(luci::CircleNeg *node) final { return connect_x(node); }
+  bool visit(luci::CircleRsqrt *node) final { return connect_x(node); }
+  bool visit(luci::CircleSqrt *node) final { return connect_x(node); }
+  bool visit(luci::CircleSquare *node) final { return connect_x(node); }
+  bool visit(luci::CircleTanh *node) final { return connect_x(node); }
+
+  bool visit(luci::CircleRelu *node) final
+  {
+    node->features(clone_of(org_as(node)->features()));
+    return true;
+  }
+  bool visit(luci::CircleRelu6 *node) final
+  {
+    node->features(clone_of(org_as(node)->features()));
+    return true;
+  }
+  bool visit(luci::CircleDequantize *node) final
+  {
+    node->input(clone_of(org_as(node)->input()));
+    return true;
+  }
+
+  // Layout and shape math
+  bool visit(luci::CircleConcatenation *node) final
+  {
+    auto org = org_as(node);
+    for (uint32_t i = 0; i < org->numValues(); ++i)
+      node->values(i, clone_of(org->values(i)));
+    return true;
+  }
+  bool visit(luci::CircleExpandDims *node) final
+  {
+    auto org = org_as(node);
+    node->input(clone_of(org->input()));
+    node->axis(clone_of(org->axis()));
+    return true;
+  }
+  bool visit(luci::CircleGather *node) final
+  {
+    auto org = org_as(node);
+    node->params(clone_of(org->params()));
+    node->indices(clone_of(org->indices()));
+    return true;
+  }
+  bool visit(luci::CircleMean *node) final
+  {
+    auto org = org_as(node);
+    node->input(clone_of(org->input()));
+    node->reduction_indices(clone_of(org->reduction_indices()));
+    return true;
+  }
+  bool visit(luci::CircleMirrorPad *node) final
+  {
+    auto org = org_as(node);
+    node->input(clone_of(org->input()));
+    node->paddings(clone_of(org->paddings()));
+    return true;
+  }
+  bool visit(luci::CirclePack *node) final
+  {
+    auto org = org_as(node);
+    for (uint32_t i = 0; i < org->values_count(); ++i)
+      node->values(i, clone_of(org->values(i)));
+    return true;
+  }
+  bool visit(luci::CirclePad *node) final
+  {
+    auto org = org_as(node);
+    node->input(clone_of(org->input()));
+    node->paddings(clone_of(org->paddings()));
+    return true;
+  }
+  bool visit(luci::CirclePadV2 *node) final
+  {
+    auto org = org_as(node);
+    node->input(clone_of(org->input()));
+    node->paddings(clone_of(org->paddings()));
+    node->constant_values(clone_of(org->constant_values()));
+    return true;
+  }
+  bool visit(luci::CircleReshape *node) final
+  {
+    auto org = org_as(node);
+    node->tensor(clone_of(org->tensor()));
+    node->shape(clone_of(org->shape()));
+    return true;
+  }
+  bool visit(luci::CircleReverseV2 *node) final
+  {
+    auto org = org_as(node);
+    node->tensor(clone_of(org->tensor()));
+    node->axis(clone_of(org->axis()));
+    return true;
+  }
+  bool visit(luci::CircleSlice *node) final
+  {
+    auto org = org_as(node);
+    node->input(clone_of(org->input()));
+    node->begin(clone_of(org->begin()));
+    node->size(clone_of(org->size()));
+    return true;
+  }
+  bool visit(luci::CircleSqueeze *node) final
+  {
+    node->input(clone_of(org_as(node)->input()));
+    return true;
+  }
+  bool visit(luci::CircleStridedSlice *node) final
+  {
+    auto org = org_as(node);
+    node->input(clone_of(org->input()));
+    node->begin(clone_of(org->begin()));
+    node->end(clone_of(org->end()));
+    node->strides(clone_of(org->strides()));
+    return true;
+  }
+  bool visit(luci::CircleTranspose *node) final
+  {
+    auto org = org_as(node);
+    node->a(clone_of(org->a()));
+    node->perm(clone_of(org->perm()));
+    return true;
+  }
+
+private:
+  template <class T> const T *org_as(T *) const { return loco::must_cast<const T *>(_org); }
+
+  luci::CircleNode *clone_of(const loco::Node *node) const { return _clones.at(node); }
+
+  template <class T> bool connect_x(T *node)
+  {
+    node->x(clone_of(org_as(node)->x()));
+    return true;
+  }
+
+  template <class T> bool connect_xy(T *node)
+  {
+    auto org = org_as(node);
+    node->x(clone_of(org->x()));
+    node->y(clone_of(org->y()));
+    return true;
+  }
+
+private:
+  const luci::CircleNode *_org;
+  const MapNode2Clone &_clones;
+};
+
+uint32_t const_size(const luci::CircleNode *node)
+{
+  uint32_t size = loco::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    size *= node->dim(i).value();
+  return size;
+}
+
+bool has_static_shape(const luci::CircleNode *node)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID)
+    return false;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+  {
+    if (not node->dim(i).known())
+      return false;
+  }
+  return true;
+}
+
+bool is_supported_dtype(loco::DataType dtype)
+{
+  switch (dtype)
+  {
+    case loco::DataType::FLOAT32:
+    case loco::DataType::U8:
+    case loco::DataType::S8:
+    case loco::DataType::S16:
+    case loco::DataType::S32:
+    case loco::DataType::S64:
+    case loco::DataType::BOOL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <loco::DataType DT>
+void read_tensor(const luci_interpreter::Tensor *tensor, luci::CircleConst *constant)
+{
+  const auto num_elements = tensor->shape().num_elements();
+  constant->size<DT>(num_elements);
+  if (num_elements > 0)
+    tensor->readData(&constant->at<DT>(0), num_elements * loco::size(DT));
+}
+
+/**
+ * @brief Evaluate a node with constant arguments in a graph of its own
+ * @return A new constant of 'node->graph()', or nullptr if the node cannot be evaluated or the
+ *         result is larger than 'max_size' bytes
+ */
+luci::CircleConst *evaluate(luci::CircleNode *node, uint32_t max_size)
+{
+  auto module = luci::make_module();
+  auto graph = loco::make_graph();
+
+  MapNode2Clone clones;
+  for (uint32_t i = 0; i < node->arity(); ++i)
+  {
+    auto arg = loco::must_cast<luci::CircleNode *>(node->arg(i));
+    if (clones.find(arg) == clones.end())
+      clones.emplace(arg, luci::clone_node(arg, graph.get()));
+  }
+
+  auto cloned = luci::clone_node(node, graph.get());
+  if (cloned == nullptr)
+    return nullptr;
+  ConnectClone connect(node, clones);
+  if (not cloned->accept(&connect))
+    return nullptr;
+
+  auto output = graph->nodes()->create<luci::CircleOutput>();
+  output->from(cloned);
+  output->dtype(cloned->dtype());
+  output->index(graph->outputs()->create()->index());
+
+  module->add(std::move(graph));
+
+  const luci_interpreter::Tensor *tensor = nullptr;
+  std::unique_ptr<luci_interpreter::Interpreter> interpreter;
+  try
+  {
+    interpreter = std::make_unique<luci_interpreter::Interpreter>(module.get());
+    interpreter->interpret();
+    tensor = interpreter->getTensor(cloned);
+  }
+  catch (const std::exception &e)
+  {
+    LOGGER(l);
+    INFO(l) << "FoldConstantsPass: cannot evaluate " << node->name() << ": " << e.what()
+            << std::endl;
+    return nullptr;
+  }
+
+  if (tensor == nullptr or tensor->element_type() != node->dtype())
+    return nullptr;
+  const uint64_t num_elements = tensor->shape().num_elements();
+  if (num_elements * loco::size(node->dtype()) > max_size)
+    return nullptr;
+
+  auto constant = node->graph()->nodes()->create<luci::CircleConst>();
+  constant->dtype(node->dtype());
+  constant->rank(tensor->shape().num_dims());
+  for (int i = 0; i < tensor->shape().num_dims(); ++i)
+    constant->dim(i).set(tensor->shape().dim(i));
+  constant->shape_status(luci::ShapeStatus::VALID);
+
+  switch (node->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      read_tensor<loco::DataType::FLOAT32>(tensor, constant);
+      break;
+    case loco::DataType::U8:
+      read_tensor<loco::DataType::U8>(tensor, constant);
+      break;
+    case loco::DataType::S8:
+      read_tensor<loco::DataType::S8>(tensor, constant);
+      break;
+    case loco::DataType::S16:
+      read_tensor<loco::DataType::S16>(tensor, constant);
+      break;
+    case loco::DataType::S32:
+      read_tensor<loco::DataType::S32>(tensor, constant);
+      break;
+    case loco::DataType::S64:
+      read_tensor<loco::DataType::S64>(tensor, constant);
+      break;
+    case loco::DataType::BOOL:
+      read_tensor<loco::DataType::BOOL>(tensor, constant);
+      break;
+    default:
+      return nullptr;
+  }
+
+  return constant;
+}
+
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for operators with constant inputs
+ *
+ *    BEFORE
+ *
+ *    [CircleConst] [CircleConst]
+ *              |     |
+ *          [CircleNode]  ---> [CircleNode] ---> ...
+ *
+ *    AFTER
+ *
+ *           [CircleConst] ---> [CircleNode] ---> ...
+ *
+ * Nodes are visited in post-order, so a chain of such operators is folded in one run.
+ **/
+bool FoldConstantsPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (dynamic_cast<luci::CircleConst *>(node) or dynamic_cast<luci::CircleOutput *>(node))
+      continue;
+    if (node->arity() == 0 or not is_supported_dtype(circle_node->dtype()))
+      continue;
+
+    std::set<luci::CircleConst *> args;
+    bool all_const = true;
+    for (uint32_t i = 0; i < node->arity() and all_const; ++i)
+    {
+      auto arg = dynamic_cast<luci::CircleConst *>(node->arg(i));
+      all_const = arg != nullptr and is_supported_dtype(arg->dtype());
+      if (all_const)
+        args.insert(arg);
+    }
+    if (not all_const)
+      continue;
+
+    // Constants used by the node only are removed with it, which bounds the growth of the model
+    uint32_t freed = 0;
+    for (auto arg : args)
+    {
+      if (loco::succs(arg).size() == 1)
+        freed += const_size(arg);
+    }
+    const auto max_size = std::max(_max_size, freed);
+    if (has_static_shape(circle_node) and const_size(circle_node) > max_size)
+      continue;
+
+    auto folded = evaluate(circle_node, max_size);
+    if (folded == nullptr)
+      continue;
+
+    folded->name(circle_node->name());
+    luci::copy_quantparam(circle_node, folded);
+    luci::add_origin(folded, luci::get_origin(circle_node));
+    loco::replace(circle_node).with(folded);
+    changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+#include "PassTestGraphs.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_const(loco::Graph *g, std::initializer_list<float> values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape({static_cast<uint32_t>(values.size())});
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(values.size());
+  uint32_t i = 0;
+  for (auto value : values)
+    node->at<loco::DataType::FLOAT32>(i++) = value;
+  return node;
+}
+
+/**
+ *  Graph that has a chain of operators with constant inputs
+ *
+ *    BEFORE
+ *
+ *     [CircleConst] [CircleConst]
+ *                |   |
+ *               [Mul]
+ *                 |
+ *               [Neg]
+ *
+ *    AFTER
+ *
+ *            [CircleConst]
+ *
+ */
+class FoldConstantsChainTest : public luci::ConstantFoldingAddTestGraph, public ::testing::Test
+{
+public:
+  FoldConstantsChainTest() : luci::ConstantFoldingAddTestGraph({3}, loco::DataType::FLOAT32) {}
+
+  virtual void SetUp() { init(); }
+
+  loco::Node *createFoldedPattern() override
+  {
+    _x = create_const(&_g, {1, 2, 3});
+    _y = create_const(&_g, {4, 5, 6});
+
+    _mul = _g.nodes()->create<luci::CircleMul>();
+    _mul->dtype(loco::DataType::FLOAT32);
+    _mul->shape({3});
+    _mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _mul->x(_x);
+    _mul->y(_y);
+    _mul->name("mul");
+
+    _neg = _g.nodes()->create<luci::CircleNeg>();
+    _neg->dtype(loco::DataType::FLOAT32);
+    _neg->shape({3});
+    _neg->x(_mul);
+    _neg->name("neg");
+
+    return _neg;
+  }
+
+protected:
+  luci::CircleConst *_x = nullptr;
+  luci::CircleConst *_y = nullptr;
+  luci::CircleMul *_mul = nullptr;
+  luci::CircleNeg *_neg = nullptr;
+};
+
+/**
+ *  Graph that has Pack of a constant, whose result is twice as large as the constant
+ *
+ *     [CircleConst]
+ *         |   |
+ *         [Pack]
+ *
+ */
+class FoldConstantsPackTest : public luci::ConstantFoldingAddTestGraph, public ::testing::Test
+{
+public:
+  FoldConstantsPackTest() : luci::ConstantFoldingAddTestGraph({2, 3}, loco::DataType::FLOAT32) {}
+
+  virtual void SetUp() { init(); }
+
+  loco::Node *createFoldedPattern() override
+  {
+    _x = create_const(&_g, {1, 2, 3});
+
+    _pack = _g.nodes()->create<luci::CirclePack>(2);
+    _pack->dtype(loco::DataType::FLOAT32);
+    _pack->shape({2, 3});
+    _pack->axis(0);
+    _pack->values(0, _x);
+    _pack->values(1, _x);
+    _pack->name("pack");
+
+    return _pack;
+  }
+
+protected:
+  luci::CircleConst *_x = nullptr;
+  luci::CirclePack *_pack = nullptr;
+};
+
+} // namespace
+
+TEST(FoldConstantsPassTest, name)
+{
+  luci::FoldConstantsPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FoldConstantsChainTest, fold_chain)
+{
+  luci::FoldConstantsPass pass;
+  EXPECT_TRUE(pass.run(graph()));
+
+  auto folded_const = getFoldedPattern();
+  ASSERT_NE(nullptr, folded_const);
+
+  EXPECT_EQ(loco::DataType::FLOAT32, folded_const->dtype());
+  EXPECT_EQ(1, folded_const->rank());
+  EXPECT_EQ(3, folded_const->dim(0).value());
+  EXPECT_FLOAT_EQ(-4, folded_const->at<loco::DataType::FLOAT32>(0));
+  EXPECT_FLOAT_EQ(-10, folded_const->at<loco::DataType::FLOAT32>(1));
+  EXPECT_FLOAT_EQ(-18, folded_const->at<loco::DataType::FLOAT32>(2));
+  EXPECT_EQ("neg", folded_const->name());
+
+  EXPECT_FALSE(pass.run(graph()));
+}
+
+TEST_F(FoldConstantsPackTest, fold_pack)
+{
+  luci::FoldConstantsPass pass;
+  EXPECT_TRUE(pass.run(graph()));
+
+  auto folded_const = getFoldedPattern();
+  ASSERT_NE(nullptr, folded_const);
+
+  EXPECT_EQ(2, folded_const->rank());
+  EXPECT_EQ(2, folded_const->dim(0).value());
+  EXPECT_EQ(3, folded_const->dim(1).value());
+  EXPECT_FLOAT_EQ(1, folded_const->at<loco::DataType::FLOAT32>(3));
+  EXPECT_FLOAT_EQ(3, folded_const->at<loco::DataType::FLOAT32>(5));
+}
+
+TEST_F(FoldConstantsPackTest, exceed_max_size_NEG)
+{
+  // The Pack is larger than both the limit and the constant it replaces
+  luci::FoldConstantsPass pass(4);
+  EXPECT_FALSE(pass.run(graph()));
+
+  EXPECT_EQ(nullptr, getFoldedPattern());
+}
+
+TEST_F(FoldConstantsChainTest, non_const_input_NEG)
+{
+  _mul->y(_input);
+
+  luci::FoldConstantsPass pass;
+  EXPECT_FALSE(pass.run(graph()));
+
+  EXPECT_EQ(nullptr, getFoldedPattern());
+}
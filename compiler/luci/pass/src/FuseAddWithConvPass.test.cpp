@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseAddWithConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+// Values are 'start', 'start + step', 'start + 2 * step', ... in order
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape, float start,
+                                float step)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  uint32_t size = 1;
+  for (uint32_t i = 0; i < shape.size(); ++i)
+  {
+    node->dim(i) = shape.at(i);
+    size *= shape.at(i);
+  }
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = start + step * i;
+  node->name("const");
+  return node;
+}
+
+/**
+ *  Simple graph for test
+ *
+ *  BEFORE
+ *
+ *        [Conv]
+ *           |
+ *     [Add w/ Relu]
+ *
+ *  AFTER
+ *
+ *     [Conv w/ Relu] (bias updated)
+ *
+ */
+class ConvAddGraphlet
+{
+public:
+  ConvAddGraphlet() = default;
+
+  void init(loco::Graph *g)
+  {
+    _filter = create_const(g, {4, 1, 1, 2}, 1.0f, 0.5f);
+    _bias = create_const(g, {4}, 1.0f, 1.0f);
+
+    _conv = g->nodes()->create<luci::CircleConv2D>();
+    _conv->filter(_filter);
+    _conv->bias(_bias);
+    _conv->padding(luci::Padding::VALID);
+    _conv->stride()->h(1);
+    _conv->stride()->w(1);
+    _conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _conv->dtype(loco::DataType::FLOAT32);
+    _conv->shape({1, 2, 2, 4});
+    _conv->name("conv");
+
+    _const = create_const(g, {1, 1, 1, 4}, 0.5f, 0.25f);
+
+    _add = g->nodes()->create<luci::CircleAdd>();
+    _add->x(_conv);
+    _add->y(_const);
+    _add->fusedActivationFunction(luci::FusedActFunc::RELU);
+    _add->dtype(loco::DataType::FLOAT32);
+    _add->shape({1, 2, 2, 4});
+    _add->name("add");
+  }
+
+protected:
+  luci::CircleConv2D *_conv = nullptr;
+  luci::CircleAdd *_add = nullptr;
+  luci::CircleConst *_filter = nullptr;
+  luci::CircleConst *_bias = nullptr;
+  luci::CircleConst *_const = nullptr;
+};
+
+class ConvAddTestGraph : public TestIOGraph, public ConvAddGraphlet
+{
+public:
+  ConvAddTestGraph() = default;
+
+  void init(void)
+  {
+    TestIOGraph::init({1, 2, 2, 2}, {1, 2, 2, 4});
+    ConvAddGraphlet::init(g());
+
+    _conv->input(input());
+
+    output()->from(_add);
+  }
+};
+
+class FuseAddWithConvPassTest : public ::testing::Test, public ConvAddTestGraph
+{
+public:
+  luci::FuseAddWithConvPass pass;
+};
+
+} // namespace
+
+TEST(FuseAddWithConvPass, name)
+{
+  luci::FuseAddWithConvPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseAddWithConvPassTest, simple_test)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  EXPECT_EQ(_conv, output()->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU, _conv->fusedActivationFunction());
+
+  auto filter = loco::must_cast<luci::CircleConst *>(_conv->filter());
+  // Filter is not changed
+  const std::vector<float> expected_filter{1, 1.5, 2, 2.5, 3, 3.5, 4, 4.5};
+  ASSERT_EQ(expected_filter.size(), filter->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected_filter.size(); ++i)
+    EXPECT_FLOAT_EQ(expected_filter[i], filter->at<loco::DataType::FLOAT32>(i));
+
+  auto bias = loco::must_cast<luci::CircleConst *>(_conv->bias());
+  const std::vector<float> expected_bias{1.5, 2.75, 4, 5.25};
+  ASSERT_EQ(expected_bias.size(), bias->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected_bias.size(); ++i)
+    EXPECT_FLOAT_EQ(expected_bias[i], bias->at<loco::DataType::FLOAT32>(i));
+}
+
+TEST_F(FuseAddWithConvPassTest, not_channel_wise_NEG)
+{
+  init();
+
+  // Values differ along a non-channel dimension
+  _const->rank(2);
+  _const->dim(0) = 4;
+  _const->dim(1) = 1;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseAddWithConvPassTest, rank_NEG)
+{
+  init();
+
+  // Broadcasting to a higher rank changes the shape of the output
+  _const->rank(5);
+  _const->dim(0) = 1;
+  _const->dim(1) = 1;
+  _const->dim(2) = 1;
+  _const->dim(3) = 1;
+  _const->dim(4) = 4;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseAddWithConvPassTest, fused_activation_NEG)
+{
+  init();
+
+  _conv->fusedActivationFunction(luci::FusedActFunc::RELU6);
+
+  EXPECT_FALSE(pass.run(g()));
+}
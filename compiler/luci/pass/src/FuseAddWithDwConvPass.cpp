@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseAddWithDwConvPass.h"
+
+#include "helpers/ChannelWiseConst.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+namespace
+{
+
+/**
+ *  Fuse Add to DepthwiseConv2D if the addition is a channel(last dimension)-wise constant
+ *
+ *  BEFORE
+ *                |   [CircleConst]
+ *                |  / [CircleConst]
+ *                | / /
+ *         [CircleDepthwiseConv2D] [CircleConst]
+ *                |      /
+ *           [CircleAdd]
+ *                |
+ *
+ *  AFTER
+ *                |   [CircleConst]
+ *                |  / [CircleConst] (added)
+ *                | / /
+ *         [CircleDepthwiseConv2D]              [CircleAdd] (dead)
+ *                |
+ *
+ */
+bool fuse_add_with_dwconv(luci::CircleDepthwiseConv2D *conv)
+{
+  if (conv->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  if (conv->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  auto filter = dynamic_cast<luci::CircleConst *>(conv->filter());
+  if (filter == nullptr or filter->rank() != 4)
+    return false;
+
+  auto conv_output = loco::succs(conv);
+  if (conv_output.size() != 1)
+    return false;
+
+  auto add = dynamic_cast<luci::CircleAdd *>(*conv_output.begin());
+  if (add == nullptr or add->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  const auto out_channel = filter->dim(3).value();
+  const auto shift = luci::channel_wise_values(luci::const_operand(add, conv), conv, out_channel);
+  if (shift.empty())
+    return false;
+
+  std::vector<float> bias;
+  if (not luci::bias_values(conv->bias(), out_channel, bias))
+    return false;
+
+  for (uint32_t c = 0; c < out_channel; ++c)
+    bias[c] += shift[c];
+
+  auto name = add->name();
+  assert(name.length() > 0);
+
+  conv->bias(luci::create_bias(conv->graph(), bias, name + "/DepthwiseConv2D/bias"));
+  conv->fusedActivationFunction(add->fusedActivationFunction());
+
+  // set origin
+  luci::add_origin(conv, luci::get_origin(add));
+
+  replace(add).with(conv);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseAddWithDwConvPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto dwconv = dynamic_cast<luci::CircleDepthwiseConv2D *>(node);
+    if (not dwconv)
+      continue;
+
+    if (fuse_add_with_dwconv(dwconv))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseGeluPass.h"
+
+#include "helpers/NodeFiller.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+bool is_scalar_with_value(const luci::CircleConst *node, float val)
+{
+  if (node->dtype() != loco::DataType::FLOAT32)
+    return false;
+  if (node->size<loco::DataType::FLOAT32>() != 1)
+    return false;
+
+  return std::fabs(node->at<loco::DataType::FLOAT32>(0) - val) < 1e-6f;
+}
+
+template <class NODE> NODE *as_without_activation(loco::Node *node)
+{
+  auto casted = dynamic_cast<NODE *>(node);
+  if (casted == nullptr or casted->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return nullptr;
+  return casted;
+}
+
+/**
+ * @brief Collect the nodes of a matched pattern
+ */
+class GeluPattern final
+{
+public:
+  /**
+   * @brief Return true if 'node' is the last node of one of the patterns
+   *
+   *        Mul(Mul(x, 0.5), Add(f(x), 1))
+   *        Mul(x, Mul(Add(f(x), 1), 0.5))
+   *        Mul(Mul(x, Add(f(x), 1)), 0.5)
+   *
+   *        where f(x) is Erf(x / sqrt(2)) or Tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))
+   */
+  bool match(luci::CircleNode *node)
+  {
+    _nodes.clear();
+    _input = nullptr;
+
+    if (node->dtype() != loco::DataType::FLOAT32)
+      return false;
+
+    auto mul = as_without_activation<luci::CircleMul>(node);
+    if (mul == nullptr)
+      return false;
+
+    for (auto pair : {std::make_pair(mul->x(), mul->y()), std::make_pair(mul->y(), mul->x())})
+    {
+      auto inner = as_without_activation<luci::CircleMul>(pair.first);
+      if (inner == nullptr)
+        continue;
+      if (match_factors({inner->x(), inner->y(), pair.second}))
+      {
+        _nodes.push_back(inner);
+        _nodes.push_back(mul);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+private:
+  /**
+   * @brief Return true if 'factors' are 0.5, x and Add(f(x), 1) in any order, and set the input
+   */
+  bool match_factors(const std::vector<loco::Node *> &factors)
+  {
+    for (uint32_t half = 0; half < 3; ++half)
+    {
+      auto half_const = dynamic_cast<luci::CircleConst *>(factors[half]);
+      if (half_const == nullptr or not is_scalar_with_value(half_const, 0.5f))
+        continue;
+
+      for (uint32_t one_plus = 0; one_plus < 3; ++one_plus)
+      {
+        if (one_plus == half)
+          continue;
+        auto x = factors[3 - half - one_plus];
+        if (match_one_plus(factors[one_plus], x))
+        {
+          _input = x;
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Return true if 'node' is Add(f(x), 1)
+   */
+  bool match_one_plus(loco::Node *node, loco::Node *x)
+  {
+    auto add = as_without_activation<luci::CircleAdd>(node);
+    if (add == nullptr)
+      return false;
+
+    luci::CircleConst *one = nullptr;
+    loco::Node *f = nullptr;
+    if (not luci::fill(&one, &f).with_commutative_args_of(add))
+      return false;
+    if (not is_scalar_with_value(one, 1.0f))
+      return false;
+
+    const auto mark = _nodes.size();
+    if (match_erf(f, x))
+      _approximate = false;
+    else if (match_tanh(f, x))
+      _approximate = true;
+    else
+    {
+      _nodes.resize(mark);
+      return false;
+    }
+
+    _nodes.push_back(add);
+    return true;
+  }
+
+  /**
+   * @brief Return true if 'node' is Erf(x * (1 / sqrt(2))) or Erf(x / sqrt(2))
+   *
+   * @note  Erf is not a builtin operator, so it comes as a custom operator
+   */
+  bool match_erf(loco::Node *node, loco::Node *x)
+  {
+    auto erf_out = dynamic_cast<luci::CircleCustomOut *>(node);
+    if (erf_out == nullptr)
+      return false;
+    auto erf = dynamic_cast<luci::CircleCustom *>(erf_out->input());
+    if (erf == nullptr or erf->custom_code() != "Erf" or erf->numInputs() != 1)
+      return false;
+
+    if (auto mul = as_without_activation<luci::CircleMul>(erf->inputs(0)))
+    {
+      luci::CircleConst *scale = nullptr;
+      loco::Node *input = nullptr;
+      if (not luci::fill(&scale, &input).with_commutative_args_of(mul))
+        return false;
+      if (input != x or not is_scalar_with_value(scale, static_cast<float>(M_SQRT1_2)))
+        return false;
+      _nodes.push_back(mul);
+    }
+    else if (auto div = as_without_activation<luci::CircleDiv>(erf->inputs(0)))
+    {
+      auto divisor = dynamic_cast<luci::CircleConst *>(div->y());
+      if (div->x() != x or divisor == nullptr)
+        return false;
+      if (not is_scalar_with_value(divisor, static_cast<float>(M_SQRT2)))
+        return false;
+      _nodes.push_back(div);
+    }
+    else
+      return false;
+
+    _nodes.push_back(erf);
+    _nodes.push_back(erf_out);
+    return true;
+  }
+
+  /**
+   * @brief Return true if 'node' is Tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))
+   */
+  bool match_tanh(loco::Node *node, loco::Node *x)
+  {
+    auto tanh = dynamic_cast<luci::CircleTanh *>(node);
+    if (tanh == nullptr)
+      return false;
+
+    auto scale_mul = as_without_activation<luci::CircleMul>(tanh->x());
+    if (scale_mul == nullptr)
+      return false;
+    luci::CircleConst *scale = nullptr;
+    luci::CircleAdd *add = nullptr;
+    if (not luci::fill(&scale, &add).with_commutative_args_of(scale_mul))
+      return false;
+    if (not is_scalar_with_value(scale, static_cast<float>(std::sqrt(2.0 / M_PI))))
+      return false;
+    if (add->fusedActivationFunction() != luci::FusedActFunc::NONE)
+      return false;
+
+    // x may also be a Mul, so find the operand other than x
+    loco::Node *other = add->x() == x ? add->y() : (add->y() == x ? add->x() : nullptr);
+    auto cube_mul = as_without_activation<luci::CircleMul>(other);
+    if (cube_mul == nullptr)
+      return false;
+
+    luci::CircleConst *coeff = nullptr;
+    loco::Node *cube = nullptr;
+    if (not luci::fill(&coeff, &cube).with_commutative_args_of(cube_mul))
+      return false;
+    if (not is_scalar_with_value(coeff, 0.044715f) or not match_cube(cube, x))
+      return false;
+
+    _nodes.push_back(cube_mul);
+    _nodes.push_back(add);
+    _nodes.push_back(scale_mul);
+    _nodes.push_back(tanh);
+    return true;
+  }
+
+  /**
+   * @brief Return true if 'node' is Pow(x, 3), Mul(x, Mul(x, x)) or Mul(Mul(x, x), x)
+   */
+  bool match_cube(loco::Node *node, loco::Node *x)
+  {
+    if (auto pow = dynamic_cast<luci::CirclePow *>(node))
+    {
+      auto exponent = dynamic_cast<luci::CircleConst *>(pow->y());
+      if (pow->x() != x or exponent == nullptr or not is_scalar_with_value(exponent, 3.0f))
+        return false;
+      _nodes.push_back(pow);
+      return true;
+    }
+
+    auto mul = as_without_activation<luci::CircleMul>(node);
+    if (mul == nullptr)
+      return false;
+    loco::Node *other = mul->x() == x ? mul->y() : (mul->y() == x ? mul->x() : nullptr);
+    auto square = as_without_activation<luci::CircleMul>(other);
+    if (square == nullptr or square->x() != x or square->y() != x)
+      return false;
+
+    _nodes.push_back(square);
+    _nodes.push_back(mul);
+    return true;
+  }
+
+public:
+  loco::Node *input(void) const { return _input; }
+  bool approximate(void) const { return _approximate; }
+  const std::vector<luci::CircleNode *> &nodes(void) const { return _nodes; }
+
+private:
+  loco::Node *_input = nullptr;
+  bool _approximate = false;
+  std::vector<luci::CircleNode *> _nodes;
+};
+
+/**
+ *  BEFORE
+ *             [CircleNode]
+ *              |        |
+ *              |  [Erf or Tanh form]
+ *              |        |
+ *              |   [CircleAdd] (+1)
+ *              |        |
+ *            [CircleMul] (and x 0.5)
+ *                  |
+ *             [CircleNode]
+ *
+ *  AFTER
+ *             [CircleNode]
+ *                  |
+ *             [CircleGelu]
+ *                  |
+ *             [CircleNode]
+ *
+ *  NOTE The scaling by 0.5 may be applied to any factor of the multiplication
+ */
+bool fuse_gelu(luci::CircleNode *node)
+{
+  GeluPattern pattern;
+  if (not pattern.match(node))
+    return false;
+
+  auto name = node->name();
+  assert(name.length() > 0);
+
+  auto gelu = node->graph()->nodes()->create<luci::CircleGelu>();
+  gelu->features(pattern.input());
+  gelu->approximate(pattern.approximate());
+  gelu->dtype(node->dtype());
+  gelu->name(name + "/Gelu");
+
+  std::vector<std::shared_ptr<luci::CircleNodeOrigin>> origins;
+  for (auto matched : pattern.nodes())
+    origins.push_back(luci::get_origin(matched));
+  luci::add_origin(gelu, luci::composite_origin(origins));
+
+  replace(node).with(gelu);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseGeluPass::run(loco::Graph *g)
+{
+  bool changed = false;
+
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (fuse_gelu(circle_node))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
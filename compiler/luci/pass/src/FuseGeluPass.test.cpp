@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "luci/Pass/FuseGeluPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace
+{
+
+using namespace luci::test;
+
+luci::CircleConst *create_scalar(loco::Graph *g, float value)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape({});
+  node->size<loco::DataType::FLOAT32>(1);
+  node->at<loco::DataType::FLOAT32>(0) = value;
+  node->name("scalar");
+  return node;
+}
+
+template <class NODE> NODE *create_binary(loco::Graph *g, loco::Node *x, loco::Node *y)
+{
+  auto node = g->nodes()->create<NODE>();
+  node->x(x);
+  node->y(y);
+  node->fusedActivationFunction(luci::FusedActFunc::NONE);
+  node->dtype(loco::DataType::FLOAT32);
+  node->name("binary");
+  return node;
+}
+
+/**
+ *  Gelu pattern graph of erf form
+ *
+ *       [CircleInput]
+ *        |        |
+ *        |   [CircleMul] (x 1/sqrt(2))
+ *        |        |
+ *        |  [CircleCustom] (Erf)
+ *        |        |
+ *        | [CircleCustomOut]
+ *        |        |
+ *        |   [CircleAdd] (+1)
+ *        |        |
+ *      [CircleMul]
+ *            |
+ *      [CircleMul] (x 0.5)
+ *            |
+ *      [CircleOutput]
+ */
+class GeluErfTestGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1, 16}, {1, 16});
+
+    _sqrt1_2 = create_scalar(g(), static_cast<float>(M_SQRT1_2));
+    _scale = create_binary<luci::CircleMul>(g(), input(), _sqrt1_2);
+
+    _erf = g()->nodes()->create<luci::CircleCustom>(1, 1);
+    _erf->inputs(0, _scale);
+    _erf->custom_code("Erf");
+    _erf->dtype(loco::DataType::FLOAT32);
+    _erf->name("erf");
+
+    _erf_out = g()->nodes()->create<luci::CircleCustomOut>();
+    _erf_out->input(_erf);
+    _erf_out->index(0);
+    _erf_out->dtype(loco::DataType::FLOAT32);
+    _erf_out->name("erf_out");
+
+    _add = create_binary<luci::CircleAdd>(g(), _erf_out, create_scalar(g(), 1.0f));
+    _mul = create_binary<luci::CircleMul>(g(), input(), _add);
+    _half = create_binary<luci::CircleMul>(g(), _mul, create_scalar(g(), 0.5f));
+
+    output()->from(_half);
+  }
+
+protected:
+  luci::CircleConst *_sqrt1_2 = nullptr;
+  luci::CircleMul *_scale = nullptr;
+  luci::CircleCustom *_erf = nullptr;
+  luci::CircleCustomOut *_erf_out = nullptr;
+  luci::CircleAdd *_add = nullptr;
+  luci::CircleMul *_mul = nullptr;
+  luci::CircleMul *_half = nullptr;
+};
+
+/**
+ *  Gelu pattern graph of tanh form
+ *
+ *    Mul(Mul(x, 0.5), Add(1, Tanh(Mul(sqrt(2/pi), Add(x, Mul(0.044715, Pow(x, 3)))))))
+ */
+class GeluTanhTestGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1, 16}, {1, 16});
+
+    _pow = g()->nodes()->create<luci::CirclePow>();
+    _pow->x(input());
+    _pow->y(create_scalar(g(), 3.0f));
+    _pow->dtype(loco::DataType::FLOAT32);
+    _pow->name("pow");
+
+    _coeff = create_scalar(g(), 0.044715f);
+    _cube_mul = create_binary<luci::CircleMul>(g(), _coeff, _pow);
+    auto inner_add = create_binary<luci::CircleAdd>(g(), input(), _cube_mul);
+    auto scale = create_scalar(g(), static_cast<float>(std::sqrt(2.0 / M_PI)));
+    auto scale_mul = create_binary<luci::CircleMul>(g(), scale, inner_add);
+
+    _tanh = g()->nodes()->create<luci::CircleTanh>();
+    _tanh->x(scale_mul);
+    _tanh->dtype(loco::DataType::FLOAT32);
+    _tanh->name("tanh");
+
+    auto add = create_binary<luci::CircleAdd>(g(), create_scalar(g(), 1.0f), _tanh);
+    auto half = create_binary<luci::CircleMul>(g(), input(), create_scalar(g(), 0.5f));
+    _mul = create_binary<luci::CircleMul>(g(), half, add);
+
+    output()->from(_mul);
+  }
+
+protected:
+  luci::CirclePow *_pow = nullptr;
+  luci::CircleConst *_coeff = nullptr;
+  luci::CircleMul *_cube_mul = nullptr;
+  luci::CircleTanh *_tanh = nullptr;
+  luci::CircleMul *_mul = nullptr;
+};
+
+class FuseGeluErfPassTest : public ::testing::Test, public GeluErfTestGraph
+{
+public:
+  luci::FuseGeluPass pass;
+};
+
+class FuseGeluTanhPassTest : public ::testing::Test, public GeluTanhTestGraph
+{
+public:
+  luci::FuseGeluPass pass;
+};
+
+} // namespace
+
+TEST(FuseGeluPass, name)
+{
+  luci::FuseGeluPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseGeluErfPassTest, erf)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto gelu = dynamic_cast<luci::CircleGelu *>(output()->from());
+  ASSERT_NE(nullptr, gelu);
+  EXPECT_EQ(input(), gelu->features());
+  EXPECT_FALSE(gelu->approximate());
+}
+
+TEST_F(FuseGeluErfPassTest, erf_div_sqrt2)
+{
+  init();
+
+  auto div = create_binary<luci::CircleDiv>(g(), input(), create_scalar(g(), static_cast<float>(M_SQRT2)));
+  _erf->inputs(0, div);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto gelu = dynamic_cast<luci::CircleGelu *>(output()->from());
+  ASSERT_NE(nullptr, gelu);
+  EXPECT_EQ(input(), gelu->features());
+}
+
+TEST_F(FuseGeluErfPassTest, half_applied_to_add)
+{
+  init();
+
+  // x * ((Erf(x / sqrt(2)) + 1) * 0.5)
+  _half->x(_add);
+  _mul->y(_half);
+  output()->from(_mul);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto gelu = dynamic_cast<luci::CircleGelu *>(output()->from());
+  ASSERT_NE(nullptr, gelu);
+  EXPECT_EQ(input(), gelu->features());
+}
+
+TEST_F(FuseGeluErfPassTest, wrong_scale_NEG)
+{
+  init();
+
+  _sqrt1_2->at<loco::DataType::FLOAT32>(0) = 0.5f;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseGeluErfPassTest, wrong_custom_code_NEG)
+{
+  init();
+
+  _erf->custom_code("Erfc");
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseGeluErfPassTest, different_input_NEG)
+{
+  init();
+
+  auto other = create_binary<luci::CircleAdd>(g(), input(), create_scalar(g(), 1.0f));
+  _mul->x(other);
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseGeluTanhPassTest, tanh)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto gelu = dynamic_cast<luci::CircleGelu *>(output()->from());
+  ASSERT_NE(nullptr, gelu);
+  EXPECT_EQ(input(), gelu->features());
+  EXPECT_TRUE(gelu->approximate());
+}
+
+TEST_F(FuseGeluTanhPassTest, cube_by_mul)
+{
+  init();
+
+  auto square = create_binary<luci::CircleMul>(g(), input(), input());
+  auto cube = create_binary<luci::CircleMul>(g(), square, input());
+  _cube_mul->y(cube);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto gelu = dynamic_cast<luci::CircleGelu *>(output()->from());
+  ASSERT_NE(nullptr, gelu);
+  EXPECT_EQ(input(), gelu->features());
+  EXPECT_TRUE(gelu->approximate());
+}
+
+TEST_F(FuseGeluTanhPassTest, wrong_coeff_NEG)
+{
+  init();
+
+  _coeff->at<loco::DataType::FLOAT32>(0) = 0.05f;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseGeluTanhPassTest, wrong_exponent_NEG)
+{
+  init();
+
+  _pow->y(create_scalar(g(), 2.0f));
+
+  EXPECT_FALSE(pass.run(g()));
+}
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseHardSwishPass.h"
+
+#include "helpers/NodeFiller.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+bool is_scalar_with_value(const luci::CircleConst *node, float val)
+{
+  if (node->dtype() != loco::DataType::FLOAT32)
+    return false;
+  if (node->size<loco::DataType::FLOAT32>() != 1)
+    return false;
+
+  return std::fabs(node->at<loco::DataType::FLOAT32>(0) - val) < 1e-6f;
+}
+
+/**
+ * @brief Collect the nodes of a matched pattern
+ */
+class HardSwishPattern final
+{
+public:
+  /**
+   * @brief Return true if 'node' is Relu6(Add(x, 3)) and set 'x'
+   *
+   * @note  Relu6 may be already fused into Add by FuseActivationFunctionPass
+   */
+  bool match_relu6_add3(loco::Node *node, loco::Node **x)
+  {
+    auto relu6 = dynamic_cast<luci::CircleRelu6 *>(node);
+    auto add = dynamic_cast<luci::CircleAdd *>(relu6 ? relu6->features() : node);
+    if (add == nullptr)
+      return false;
+
+    const auto expected = relu6 ? luci::FusedActFunc::NONE : luci::FusedActFunc::RELU6;
+    if (add->fusedActivationFunction() != expected)
+      return false;
+
+    luci::CircleConst *three = nullptr;
+    loco::Node *input = nullptr;
+    if (not luci::fill(&three, &input).with_commutative_args_of(add))
+      return false;
+    if (not is_scalar_with_value(three, 3.0f))
+      return false;
+
+    if (relu6)
+      _nodes.push_back(relu6);
+    _nodes.push_back(add);
+    *x = input;
+    return true;
+  }
+
+  /**
+   * @brief Return true if 'node' is Relu6(Add(x, 3)) multiplied by 1/6 or divided by 6
+   */
+  bool match_hard_sigmoid(loco::Node *node, loco::Node **x)
+  {
+    if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+    {
+      if (mul->fusedActivationFunction() != luci::FusedActFunc::NONE)
+        return false;
+
+      luci::CircleConst *sixth = nullptr;
+      loco::Node *relu6 = nullptr;
+      if (not luci::fill(&sixth, &relu6).with_commutative_args_of(mul))
+        return false;
+      if (not is_scalar_with_value(sixth, 1.0f / 6.0f))
+        return false;
+      if (not match_relu6_add3(relu6, x))
+        return false;
+
+      _nodes.push_back(mul);
+      return true;
+    }
+
+    if (auto div = dynamic_cast<luci::CircleDiv *>(node))
+    {
+      if (div->fusedActivationFunction() != luci::FusedActFunc::NONE)
+        return false;
+
+      auto six = dynamic_cast<luci::CircleConst *>(div->y());
+      if (six == nullptr or not is_scalar_with_value(six, 6.0f))
+        return false;
+      if (not match_relu6_add3(div->x(), x))
+        return false;
+
+      _nodes.push_back(div);
+      return true;
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Return true if 'node' is Mul(x, Relu6(Add(x, 3))) and set 'x'
+   */
+  bool match_x_relu6_add3(loco::Node *node, loco::Node **x)
+  {
+    auto mul = dynamic_cast<luci::CircleMul *>(node);
+    if (mul == nullptr or mul->fusedActivationFunction() != luci::FusedActFunc::NONE)
+      return false;
+
+    loco::Node *input = nullptr;
+    if (not match_either(mul, &HardSwishPattern::match_relu6_add3, &input))
+      return false;
+
+    _nodes.push_back(mul);
+    *x = input;
+    return true;
+  }
+
+  /**
+   * @brief Return true if 'node' is the last node of one of the patterns
+   *
+   *        Mul(Mul(x, Relu6(Add(x, 3))), 1/6)
+   *        Div(Mul(x, Relu6(Add(x, 3))), 6)
+   *        Mul(x, Mul(Relu6(Add(x, 3)), 1/6))
+   *        Mul(x, Div(Relu6(Add(x, 3)), 6))
+   */
+  bool match(luci::CircleNode *node)
+  {
+    _nodes.clear();
+    _input = nullptr;
+
+    if (node->dtype() != loco::DataType::FLOAT32)
+      return false;
+
+    if (auto div = dynamic_cast<luci::CircleDiv *>(node))
+    {
+      if (div->fusedActivationFunction() != luci::FusedActFunc::NONE)
+        return false;
+
+      auto six = dynamic_cast<luci::CircleConst *>(div->y());
+      if (six == nullptr or not is_scalar_with_value(six, 6.0f))
+        return false;
+      if (not match_x_relu6_add3(div->x(), &_input))
+        return false;
+
+      _nodes.push_back(div);
+      return true;
+    }
+
+    auto mul = dynamic_cast<luci::CircleMul *>(node);
+    if (mul == nullptr or mul->fusedActivationFunction() != luci::FusedActFunc::NONE)
+      return false;
+
+    // Mul(Mul(x, Relu6(Add(x, 3))), 1/6)
+    {
+      luci::CircleConst *sixth = nullptr;
+      loco::Node *x_relu6 = nullptr;
+      if (luci::fill(&sixth, &x_relu6).with_commutative_args_of(mul) and
+          is_scalar_with_value(sixth, 1.0f / 6.0f) and match_x_relu6_add3(x_relu6, &_input))
+      {
+        _nodes.push_back(mul);
+        return true;
+      }
+    }
+
+    // Mul(x, HardSigmoid(x))
+    _nodes.clear();
+    loco::Node *input = nullptr;
+    if (not match_either(mul, &HardSwishPattern::match_hard_sigmoid, &input))
+      return false;
+
+    _nodes.push_back(mul);
+    _input = input;
+    return true;
+  }
+
+private:
+  using Matcher = bool (HardSwishPattern::*)(loco::Node *, loco::Node **);
+
+  /**
+   * @brief Return true if one argument of 'mul' matches 'matcher' with the other argument as
+   *        its input, and set 'x' to that input
+   */
+  bool match_either(luci::CircleMul *mul, Matcher matcher, loco::Node **x)
+  {
+    const auto mark = _nodes.size();
+    loco::Node *input = nullptr;
+
+    if ((this->*matcher)(mul->y(), &input) and input == mul->x())
+    {
+      *x = input;
+      return true;
+    }
+    _nodes.resize(mark);
+
+    if ((this->*matcher)(mul->x(), &input) and input == mul->y())
+    {
+      *x = input;
+      return true;
+    }
+    _nodes.resize(mark);
+
+    return false;
+  }
+
+public:
+  loco::Node *input(void) const { return _input; }
+  const std::vector<luci::CircleNode *> &nodes(void) const { return _nodes; }
+
+private:
+  loco::Node *_input = nullptr;
+  std::vector<luci::CircleNode *> _nodes;
+};
+
+/**
+ *  BEFORE
+ *             [CircleNode]
+ *              |        |
+ *              |   [CircleAdd] (+3)
+ *              |        |
+ *              |  [CircleRelu6]
+ *              |        |
+ *            [CircleMul]
+ *                  |
+ *            [CircleMul] (x 1/6) or [CircleDiv] (/ 6)
+ *                  |
+ *             [CircleNode]
+ *
+ *  AFTER
+ *             [CircleNode]
+ *                  |
+ *          [CircleHardSwish]
+ *                  |
+ *             [CircleNode]
+ *
+ *  NOTE The scaling by 1/6 may also be applied to Relu6 before the outer multiplication
+ */
+bool fuse_hard_swish(luci::CircleNode *node)
+{
+  HardSwishPattern pattern;
+  if (not pattern.match(node))
+    return false;
+
+  auto name = node->name();
+  assert(name.length() > 0);
+
+  auto hard_swish = node->graph()->nodes()->create<luci::CircleHardSwish>();
+  hard_swish->features(pattern.input());
+  hard_swish->dtype(node->dtype());
+  hard_swish->name(name + "/HardSwish");
+
+  std::vector<std::shared_ptr<luci::CircleNodeOrigin>> origins;
+  for (auto matched : pattern.nodes())
+    origins.push_back(luci::get_origin(matched));
+  luci::add_origin(hard_swish, luci::composite_origin(origins));
+
+  replace(node).with(hard_swish);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseHardSwishPass::run(loco::Graph *g)
+{
+  bool changed = false;
+
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (fuse_hard_swish(circle_node))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseHardSwishPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+luci::CircleConst *create_scalar(loco::Graph *g, float value)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape({});
+  node->size<loco::DataType::FLOAT32>(1);
+  node->at<loco::DataType::FLOAT32>(0) = value;
+  node->name("scalar");
+  return node;
+}
+
+/**
+ *  HardSwish pattern graph
+ *
+ *       [CircleInput]
+ *        |        |
+ *        |   [CircleAdd] (+3)
+ *        |        |
+ *        |  [CircleRelu6]
+ *        |        |
+ *      [CircleMul]
+ *            |
+ *      [CircleMul] (x 1/6)
+ *            |
+ *      [CircleOutput]
+ */
+class HardSwishGraphlet
+{
+public:
+  HardSwishGraphlet() = default;
+
+  void init(loco::Graph *g)
+  {
+    _three = create_scalar(g, 3.0f);
+    _sixth = create_scalar(g, 1.0f / 6.0f);
+
+    _add = g->nodes()->create<luci::CircleAdd>();
+    _add->y(_three);
+    _add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _add->dtype(loco::DataType::FLOAT32);
+    _add->name("add");
+
+    _relu6 = g->nodes()->create<luci::CircleRelu6>();
+    _relu6->features(_add);
+    _relu6->dtype(loco::DataType::FLOAT32);
+    _relu6->name("relu6");
+
+    _mul = g->nodes()->create<luci::CircleMul>();
+    _mul->y(_relu6);
+    _mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _mul->dtype(loco::DataType::FLOAT32);
+    _mul->name("mul");
+
+    _scale = g->nodes()->create<luci::CircleMul>();
+    _scale->x(_mul);
+    _scale->y(_sixth);
+    _scale->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _scale->dtype(loco::DataType::FLOAT32);
+    _scale->name("scale");
+  }
+
+protected:
+  luci::CircleConst *_three = nullptr;
+  luci::CircleConst *_sixth = nullptr;
+  luci::CircleAdd *_add = nullptr;
+  luci::CircleRelu6 *_relu6 = nullptr;
+  luci::CircleMul *_mul = nullptr;
+  luci::CircleMul *_scale = nullptr;
+};
+
+class HardSwishTestGraph : public TestIOGraph, public HardSwishGraphlet
+{
+public:
+  HardSwishTestGraph() = default;
+
+  void init(void)
+  {
+    TestIOGraph::init({1, 4, 4, 3}, {1, 4, 4, 3});
+    HardSwishGraphlet::init(g());
+
+    _add->x(input());
+    _mul->x(input());
+
+    output()->from(_scale);
+  }
+};
+
+class FuseHardSwishPassTest : public ::testing::Test, public HardSwishTestGraph
+{
+public:
+  luci::FuseHardSwishPass pass;
+};
+
+} // namespace
+
+TEST(FuseHardSwishPass, name)
+{
+  luci::FuseHardSwishPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseHardSwishPassTest, mul_sixth)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto hard_swish = dynamic_cast<luci::CircleHardSwish *>(output()->from());
+  ASSERT_NE(nullptr, hard_swish);
+  EXPECT_EQ(input(), hard_swish->features());
+}
+
+TEST_F(FuseHardSwishPassTest, hard_sigmoid_first)
+{
+  init();
+
+  // x * (Relu6(x + 3) * 1/6)
+  _scale->x(_relu6);
+  _mul->y(_scale);
+  output()->from(_mul);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto hard_swish = dynamic_cast<luci::CircleHardSwish *>(output()->from());
+  ASSERT_NE(nullptr, hard_swish);
+  EXPECT_EQ(input(), hard_swish->features());
+}
+
+TEST_F(FuseHardSwishPassTest, div_six)
+{
+  init();
+
+  auto div = g()->nodes()->create<luci::CircleDiv>();
+  div->x(_mul);
+  div->y(create_scalar(g(), 6.0f));
+  div->fusedActivationFunction(luci::FusedActFunc::NONE);
+  div->dtype(loco::DataType::FLOAT32);
+  div->name("div");
+  output()->from(div);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto hard_swish = dynamic_cast<luci::CircleHardSwish *>(output()->from());
+  ASSERT_NE(nullptr, hard_swish);
+  EXPECT_EQ(input(), hard_swish->features());
+}
+
+TEST_F(FuseHardSwishPassTest, relu6_fused_to_add)
+{
+  init();
+
+  _add->fusedActivationFunction(luci::FusedActFunc::RELU6);
+  _mul->y(_add);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto hard_swish = dynamic_cast<luci::CircleHardSwish *>(output()->from());
+  ASSERT_NE(nullptr, hard_swish);
+  EXPECT_EQ(input(), hard_swish->features());
+}
+
+TEST_F(FuseHardSwishPassTest, wrong_offset_NEG)
+{
+  init();
+
+  _three->at<loco::DataType::FLOAT32>(0) = 2.0f;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseHardSwishPassTest, different_input_NEG)
+{
+  init();
+
+  // Relu6(x + 3) does not multiply its own input
+  _mul->x(_three);
+
+  EXPECT_FALSE(pass.run(g()));
+}
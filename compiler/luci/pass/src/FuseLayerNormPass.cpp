@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseLayerNormPass.h"
+
+#include "helpers/NodeFiller.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+#include <vector>
+
+namespace
+{
+
+template <class NODE> NODE *as_without_activation(loco::Node *node)
+{
+  auto casted = dynamic_cast<NODE *>(node);
+  if (casted == nullptr or casted->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return nullptr;
+  return casted;
+}
+
+/// @return true  When node is a FLOAT32 scalar, regardless of its rank
+bool is_float32_scalar(const luci::CircleConst *node)
+{
+  return node->dtype() == loco::DataType::FLOAT32 and node->size<loco::DataType::FLOAT32>() == 1;
+}
+
+/// @return true  When node is a FLOAT32 constant of shape '1 x .. x 1 x depth' or 'depth'
+bool is_last_dim_float32_const(const luci::CircleConst *node, uint32_t depth)
+{
+  if (node->dtype() != loco::DataType::FLOAT32 or node->rank() == 0)
+    return false;
+
+  const auto rank = node->rank();
+  for (uint32_t axis = 0; axis < rank - 1; ++axis)
+  {
+    if (node->dim(axis).value() != 1)
+      return false;
+  }
+  return node->dim(rank - 1).value() == depth and
+         node->size<loco::DataType::FLOAT32>() == depth;
+}
+
+/// @return true  When mean reduces the last axis of a tensor of 'rank' with keep_dims
+bool is_last_axis_mean(const luci::CircleMean *mean, uint32_t rank)
+{
+  if (not mean->keep_dims())
+    return false;
+
+  auto red_indices = dynamic_cast<luci::CircleConst *>(mean->reduction_indices());
+  if (red_indices == nullptr or red_indices->dtype() != loco::DataType::S32)
+    return false;
+  if (red_indices->size<loco::DataType::S32>() != 1)
+    return false;
+
+  const auto axis = red_indices->at<loco::DataType::S32>(0);
+  return axis == -1 or axis == static_cast<int32_t>(rank) - 1;
+}
+
+/**
+ * @brief Collect the nodes of a matched pattern
+ */
+class LayerNormPattern final
+{
+public:
+  /**
+   * @brief Return true if 'add' is the last node of the pattern
+   *
+   *        mean = Mean(x, -1)
+   *        sub = Sub(x, mean)
+   *        variance = Mean(Square(sub), -1), Mean(Mul(sub, sub), -1)
+   *                   or Mean(SquaredDifference(x, mean), -1)
+   *        norm = Mul(sub, Rsqrt(Add(variance, epsilon))) or Div(sub, Sqrt(Add(variance, epsilon)))
+   *        add = Add(Mul(norm, gamma), beta)
+   *
+   *        where every Mean reduces the last axis with keep_dims
+   */
+  bool match(luci::CircleAdd *add)
+  {
+    _nodes.clear();
+
+    if (add->dtype() != loco::DataType::FLOAT32)
+      return false;
+    if (add->fusedActivationFunction() != luci::FusedActFunc::NONE)
+      return false;
+
+    luci::CircleMul *mul_gamma = nullptr;
+    if (not luci::fill(&mul_gamma, &_beta).with_commutative_args_of(add))
+      return false;
+    if (mul_gamma->fusedActivationFunction() != luci::FusedActFunc::NONE)
+      return false;
+
+    loco::Node *norm = nullptr;
+    if (not luci::fill(&_gamma, &norm).with_commutative_args_of(mul_gamma))
+      return false;
+
+    luci::CircleSub *sub = nullptr;
+    luci::CircleAdd *add_eps = nullptr;
+    if (auto mul_rsqrt = as_without_activation<luci::CircleMul>(norm))
+    {
+      luci::CircleRsqrt *rsqrt = nullptr;
+      if (not luci::fill(&sub, &rsqrt).with_commutative_args_of(mul_rsqrt))
+        return false;
+      add_eps = as_without_activation<luci::CircleAdd>(rsqrt->x());
+      _nodes.push_back(rsqrt);
+      _nodes.push_back(mul_rsqrt);
+    }
+    else if (auto div = as_without_activation<luci::CircleDiv>(norm))
+    {
+      auto sqrt = dynamic_cast<luci::CircleSqrt *>(div->y());
+      sub = as_without_activation<luci::CircleSub>(div->x());
+      if (sqrt == nullptr)
+        return false;
+      add_eps = as_without_activation<luci::CircleAdd>(sqrt->x());
+      _nodes.push_back(sqrt);
+      _nodes.push_back(div);
+    }
+    if (sub == nullptr or add_eps == nullptr)
+      return false;
+    if (sub->fusedActivationFunction() != luci::FusedActFunc::NONE)
+      return false;
+
+    luci::CircleMean *variance = nullptr;
+    if (not luci::fill(&_epsilon, &variance).with_commutative_args_of(add_eps))
+      return false;
+    if (not is_float32_scalar(_epsilon))
+      return false;
+
+    // sub = x - Mean(x, -1)
+    auto mean = dynamic_cast<luci::CircleMean *>(sub->y());
+    if (mean == nullptr or mean->input() != sub->x())
+      return false;
+    _input = loco::must_cast<luci::CircleNode *>(sub->x());
+    if (_input->shape_status() != luci::ShapeStatus::VALID or _input->rank() == 0)
+      return false;
+    const auto rank = _input->rank();
+    if (not is_last_axis_mean(mean, rank) or not is_last_axis_mean(variance, rank))
+      return false;
+    if (not match_square(variance->input(), sub, mean))
+      return false;
+
+    const auto depth = _input->dim(rank - 1).value();
+    if (not is_last_dim_float32_const(_gamma, depth) or not is_last_dim_float32_const(_beta, depth))
+      return false;
+
+    _nodes.push_back(mean);
+    _nodes.push_back(sub);
+    _nodes.push_back(variance);
+    _nodes.push_back(add_eps);
+    _nodes.push_back(mul_gamma);
+    _nodes.push_back(add);
+    return true;
+  }
+
+private:
+  /**
+   * @brief Return true if 'node' is Square(sub), Mul(sub, sub) or SquaredDifference(x, mean)
+   */
+  bool match_square(loco::Node *node, luci::CircleSub *sub, luci::CircleMean *mean)
+  {
+    if (auto square = dynamic_cast<luci::CircleSquare *>(node))
+    {
+      if (square->x() != sub)
+        return false;
+      _nodes.push_back(square);
+      return true;
+    }
+    if (auto mul = as_without_activation<luci::CircleMul>(node))
+    {
+      if (mul->x() != sub or mul->y() != sub)
+        return false;
+      _nodes.push_back(mul);
+      return true;
+    }
+    if (auto sqdiff = dynamic_cast<luci::CircleSquaredDifference *>(node))
+    {
+      if (sqdiff->x() != sub->x() or sqdiff->y() != mean)
+        return false;
+      _nodes.push_back(sqdiff);
+      return true;
+    }
+    return false;
+  }
+
+public:
+  luci::CircleNode *input(void) const { return _input; }
+  luci::CircleConst *gamma(void) const { return _gamma; }
+  luci::CircleConst *beta(void) const { return _beta; }
+  float epsilon(void) const { return _epsilon->at<loco::DataType::FLOAT32>(0); }
+  const std::vector<luci::CircleNode *> &nodes(void) const { return _nodes; }
+
+private:
+  luci::CircleNode *_input = nullptr;
+  luci::CircleConst *_gamma = nullptr;
+  luci::CircleConst *_beta = nullptr;
+  luci::CircleConst *_epsilon = nullptr;
+  std::vector<luci::CircleNode *> _nodes;
+};
+
+/// @brief Make 'node' of shape '1 x .. x 1 x depth' 1D, as LayerNorm takes gamma and beta
+void reshape_to_1D(luci::CircleConst *node)
+{
+  if (node->rank() == 1)
+    return;
+
+  node->rank(1);
+  node->dim(0).set(node->size<loco::DataType::FLOAT32>());
+  node->shape_status(luci::ShapeStatus::UNDEFINED);
+}
+
+/**
+ *  BEFORE
+ *             [CircleNode]
+ *              |        |
+ *              |   [CircleMean] (-1)
+ *              |        |
+ *            [CircleSub]
+ *              |        |
+ *              |  [Variance] (-1)
+ *              |        |
+ *              |   [CircleAdd] (+ epsilon)
+ *              |        |
+ *              |   [CircleRsqrt]
+ *              |        |
+ *            [CircleMul]
+ *                 |
+ *            [CircleMul] (x gamma)
+ *                 |
+ *            [CircleAdd] (+ beta)
+ *                 |
+ *            [CircleNode]
+ *
+ *  AFTER
+ *             [CircleNode]
+ *                 |
+ *           [CircleLayerNorm]
+ *                 |
+ *             [CircleNode]
+ *
+ *  NOTE Div by Sqrt may take the place of Mul by Rsqrt
+ */
+bool fuse_layer_norm(luci::CircleAdd *add)
+{
+  LayerNormPattern pattern;
+  if (not pattern.match(add))
+    return false;
+
+  auto name = add->name();
+  assert(name.length() > 0);
+
+  reshape_to_1D(pattern.gamma());
+  reshape_to_1D(pattern.beta());
+
+  auto layer_norm = add->graph()->nodes()->create<luci::CircleLayerNorm>();
+  layer_norm->input(pattern.input());
+  layer_norm->gamma(pattern.gamma());
+  layer_norm->beta(pattern.beta());
+  layer_norm->epsilon(pattern.epsilon());
+  layer_norm->dtype(add->dtype());
+  layer_norm->name(name + "/LayerNorm");
+
+  std::vector<std::shared_ptr<luci::CircleNodeOrigin>> origins;
+  for (auto matched : pattern.nodes())
+    origins.push_back(luci::get_origin(matched));
+  luci::add_origin(layer_norm, luci::composite_origin(origins));
+
+  replace(add).with(layer_norm);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseLayerNormPass::run(loco::Graph *g)
+{
+  bool changed = false;
+
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto add = dynamic_cast<luci::CircleAdd *>(node);
+    if (add == nullptr)
+      continue;
+
+    if (fuse_layer_norm(add))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
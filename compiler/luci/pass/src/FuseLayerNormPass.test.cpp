@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "luci/Pass/FuseLayerNormPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+luci::CircleConst *create_float32(loco::Graph *g, std::initializer_list<uint32_t> shape,
+                                  float value)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->shape(shape);
+  uint32_t size = 1;
+  for (auto dim : shape)
+    size *= dim;
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = value;
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->name("const");
+  return node;
+}
+
+luci::CircleConst *create_axis(loco::Graph *g, int32_t axis)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  node->shape({1});
+  node->size<loco::DataType::S32>(1);
+  node->at<loco::DataType::S32>(0) = axis;
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->name("axis");
+  return node;
+}
+
+luci::CircleMean *create_mean(loco::Graph *g, loco::Node *input, int32_t axis)
+{
+  auto node = g->nodes()->create<luci::CircleMean>();
+  node->input(input);
+  node->reduction_indices(create_axis(g, axis));
+  node->keep_dims(true);
+  node->dtype(loco::DataType::FLOAT32);
+  node->name("mean");
+  return node;
+}
+
+template <class NODE> NODE *create_binary(loco::Graph *g, loco::Node *x, loco::Node *y)
+{
+  auto node = g->nodes()->create<NODE>();
+  node->x(x);
+  node->y(y);
+  node->fusedActivationFunction(luci::FusedActFunc::NONE);
+  node->dtype(loco::DataType::FLOAT32);
+  node->name("binary");
+  return node;
+}
+
+/**
+ *  LayerNorm pattern graph
+ *
+ *    mean = Mean(x, -1)
+ *    sub = Sub(x, mean)
+ *    norm = Mul(sub, Rsqrt(Add(Mean(Square(sub), -1), epsilon)))
+ *    out = Add(Mul(norm, gamma), beta)
+ */
+class LayerNormTestGraph : public TestIOGraph
+{
+public:
+  void init(void)
+  {
+    TestIOGraph::init({1, 4, 8}, {1, 4, 8});
+
+    _mean = create_mean(g(), input(), -1);
+    _sub = create_binary<luci::CircleSub>(g(), input(), _mean);
+
+    _square = g()->nodes()->create<luci::CircleSquare>();
+    _square->x(_sub);
+    _square->dtype(loco::DataType::FLOAT32);
+    _square->name("square");
+
+    _variance = create_mean(g(), _square, 2);
+    _epsilon = create_float32(g(), {}, 1e-5f);
+    _add_eps = create_binary<luci::CircleAdd>(g(), _variance, _epsilon);
+
+    _rsqrt = g()->nodes()->create<luci::CircleRsqrt>();
+    _rsqrt->x(_add_eps);
+    _rsqrt->dtype(loco::DataType::FLOAT32);
+    _rsqrt->name("rsqrt");
+
+    _norm = create_binary<luci::CircleMul>(g(), _sub, _rsqrt);
+    _gamma = create_float32(g(), {1, 1, 8}, 2.0f);
+    _mul_gamma = create_binary<luci::CircleMul>(g(), _norm, _gamma);
+    _beta = create_float32(g(), {8}, 0.5f);
+    _add_beta = create_binary<luci::CircleAdd>(g(), _mul_gamma, _beta);
+
+    output()->from(_add_beta);
+  }
+
+protected:
+  luci::CircleMean *_mean = nullptr;
+  luci::CircleSub *_sub = nullptr;
+  luci::CircleSquare *_square = nullptr;
+  luci::CircleMean *_variance = nullptr;
+  luci::CircleConst *_epsilon = nullptr;
+  luci::CircleAdd *_add_eps = nullptr;
+  luci::CircleRsqrt *_rsqrt = nullptr;
+  luci::CircleMul *_norm = nullptr;
+  luci::CircleConst *_gamma = nullptr;
+  luci::CircleMul *_mul_gamma = nullptr;
+  luci::CircleConst *_beta = nullptr;
+  luci::CircleAdd *_add_beta = nullptr;
+};
+
+class FuseLayerNormPassTest : public ::testing::Test, public LayerNormTestGraph
+{
+public:
+  luci::FuseLayerNormPass pass;
+};
+
+} // namespace
+
+TEST(FuseLayerNormPass, name)
+{
+  luci::FuseLayerNormPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseLayerNormPassTest, rsqrt)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto layer_norm = dynamic_cast<luci::CircleLayerNorm *>(output()->from());
+  ASSERT_NE(nullptr, layer_norm);
+  EXPECT_EQ(input(), layer_norm->input());
+  EXPECT_EQ(_gamma, layer_norm->gamma());
+  EXPECT_EQ(_beta, layer_norm->beta());
+  EXPECT_FLOAT_EQ(1e-5f, layer_norm->epsilon());
+  // gamma of '1 x 1 x 8' is made 1D
+  EXPECT_EQ(1, _gamma->rank());
+  EXPECT_EQ(8, _gamma->dim(0).value());
+}
+
+TEST_F(FuseLayerNormPassTest, div_sqrt)
+{
+  init();
+
+  auto sqrt = g()->nodes()->create<luci::CircleSqrt>();
+  sqrt->x(_add_eps);
+  sqrt->dtype(loco::DataType::FLOAT32);
+  sqrt->name("sqrt");
+  auto div = create_binary<luci::CircleDiv>(g(), _sub, sqrt);
+  _mul_gamma->x(div);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto layer_norm = dynamic_cast<luci::CircleLayerNorm *>(output()->from());
+  ASSERT_NE(nullptr, layer_norm);
+  EXPECT_EQ(input(), layer_norm->input());
+}
+
+TEST_F(FuseLayerNormPassTest, squared_difference)
+{
+  init();
+
+  auto sqdiff = g()->nodes()->create<luci::CircleSquaredDifference>();
+  sqdiff->x(input());
+  sqdiff->y(_mean);
+  sqdiff->dtype(loco::DataType::FLOAT32);
+  sqdiff->name("sqdiff");
+  _variance->input(sqdiff);
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto layer_norm = dynamic_cast<luci::CircleLayerNorm *>(output()->from());
+  ASSERT_NE(nullptr, layer_norm);
+  EXPECT_EQ(input(), layer_norm->input());
+}
+
+TEST_F(FuseLayerNormPassTest, not_last_axis_NEG)
+{
+  init();
+
+  _mean->reduction_indices(create_axis(g(), 1));
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseLayerNormPassTest, wrong_gamma_depth_NEG)
+{
+  init();
+
+  _mul_gamma->y(create_float32(g(), {4, 8}, 2.0f));
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseLayerNormPassTest, different_input_NEG)
+{
+  init();
+
+  auto other = create_binary<luci::CircleAdd>(g(), input(), create_float32(g(), {}, 1.0f));
+  _sub->x(other);
+
+  EXPECT_FALSE(pass.run(g()));
+}
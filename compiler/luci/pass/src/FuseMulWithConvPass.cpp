@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseMulWithConvPass.h"
+
+#include "helpers/ChannelWiseConst.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Service/Nodes/CircleConst.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+namespace
+{
+
+/**
+ *  Fuse Mul to Conv2D if the multiplier is a channel(last dimension)-wise constant
+ *
+ *  BEFORE
+ *                |   [CircleConst]
+ *                |  / [CircleConst]
+ *                | / /
+ *         [CircleConv2D] [CircleConst]
+ *                |      /
+ *           [CircleMul]
+ *                |
+ *
+ *  AFTER
+ *                |   [CircleConst] (scaled)
+ *                |  / [CircleConst] (scaled)
+ *                | / /
+ *         [CircleConv2D]              [CircleMul] (dead)
+ *                |
+ *
+ */
+bool fuse_mul_with_conv(luci::CircleConv2D *conv)
+{
+  if (conv->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  // Scaling the output of an activation is not the same as scaling its input
+  if (conv->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  auto filter = dynamic_cast<luci::CircleConst *>(conv->filter());
+  if (filter == nullptr or filter->dtype() != loco::DataType::FLOAT32 or filter->rank() != 4)
+    return false;
+
+  auto conv_output = loco::succs(conv);
+  if (conv_output.size() != 1)
+    return false;
+
+  auto mul = dynamic_cast<luci::CircleMul *>(*conv_output.begin());
+  if (mul == nullptr or mul->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  const auto out_channel = filter->dim(0).value();
+  const auto scale = luci::channel_wise_values(luci::const_operand(mul, conv), conv, out_channel);
+  if (scale.empty())
+    return false;
+
+  std::vector<float> bias;
+  if (not luci::bias_values(conv->bias(), out_channel, bias))
+    return false;
+
+  // Filter may be shared with other nodes
+  auto fused_filter = luci::clone(filter);
+  const auto filter_size = fused_filter->size<loco::DataType::FLOAT32>();
+  const auto channel_size = filter_size / out_channel;
+  for (uint32_t i = 0; i < filter_size; ++i)
+    fused_filter->at<loco::DataType::FLOAT32>(i) *= scale[i / channel_size];
+
+  for (uint32_t c = 0; c < out_channel; ++c)
+    bias[c] *= scale[c];
+
+  auto name = mul->name();
+  assert(name.length() > 0);
+  fused_filter->name(name + "/Conv2D/filter");
+
+  conv->filter(fused_filter);
+  conv->bias(luci::create_bias(conv->graph(), bias, name + "/Conv2D/bias"));
+  conv->fusedActivationFunction(mul->fusedActivationFunction());
+
+  // set origin
+  luci::add_origin(conv, luci::get_origin(mul));
+
+  replace(mul).with(conv);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseMulWithConvPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto conv = dynamic_cast<luci::CircleConv2D *>(node);
+    if (not conv)
+      continue;
+
+    if (fuse_mul_with_conv(conv))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseMulWithDwConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+// Values are 'start', 'start + step', 'start + 2 * step', ... in order
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape, float start,
+                                float step)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  uint32_t size = 1;
+  for (uint32_t i = 0; i < shape.size(); ++i)
+  {
+    node->dim(i) = shape.at(i);
+    size *= shape.at(i);
+  }
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = start + step * i;
+  node->name("const");
+  return node;
+}
+
+/**
+ *  Simple graph for test
+ *
+ *  BEFORE
+ *
+ *        [DwConv]
+ *           |
+ *     [Mul w/ Relu]
+ *
+ *  AFTER
+ *
+ *     [DwConv w/ Relu] (filter and bias scaled)
+ *
+ */
+class DwConvMulGraphlet
+{
+public:
+  DwConvMulGraphlet() = default;
+
+  void init(loco::Graph *g)
+  {
+    _filter = create_const(g, {1, 2, 1, 4}, 1.0f, 0.5f);
+    _bias = create_const(g, {4}, 1.0f, 1.0f);
+
+    _dwconv = g->nodes()->create<luci::CircleDepthwiseConv2D>();
+    _dwconv->filter(_filter);
+    _dwconv->bias(_bias);
+    _dwconv->depthMultiplier(1);
+    _dwconv->padding(luci::Padding::VALID);
+    _dwconv->stride()->h(1);
+    _dwconv->stride()->w(1);
+    _dwconv->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _dwconv->dtype(loco::DataType::FLOAT32);
+    _dwconv->shape({1, 2, 2, 4});
+    _dwconv->name("dwconv");
+
+    _const = create_const(g, {1, 1, 1, 4}, 2.0f, 1.0f);
+
+    _mul = g->nodes()->create<luci::CircleMul>();
+    _mul->x(_dwconv);
+    _mul->y(_const);
+    _mul->fusedActivationFunction(luci::FusedActFunc::RELU);
+    _mul->dtype(loco::DataType::FLOAT32);
+    _mul->shape({1, 2, 2, 4});
+    _mul->name("mul");
+  }
+
+protected:
+  luci::CircleDepthwiseConv2D *_dwconv = nullptr;
+  luci::CircleMul *_mul = nullptr;
+  luci::CircleConst *_filter = nullptr;
+  luci::CircleConst *_bias = nullptr;
+  luci::CircleConst *_const = nullptr;
+};
+
+class DwConvMulTestGraph : public TestIOGraph, public DwConvMulGraphlet
+{
+public:
+  DwConvMulTestGraph() = default;
+
+  void init(void)
+  {
+    TestIOGraph::init({1, 3, 2, 4}, {1, 2, 2, 4});
+    DwConvMulGraphlet::init(g());
+
+    _dwconv->input(input());
+
+    output()->from(_mul);
+  }
+};
+
+class FuseMulWithDwConvPassTest : public ::testing::Test, public DwConvMulTestGraph
+{
+public:
+  luci::FuseMulWithDwConvPass pass;
+};
+
+} // namespace
+
+TEST(FuseMulWithDwConvPass, name)
+{
+  luci::FuseMulWithDwConvPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseMulWithDwConvPassTest, simple_test)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  EXPECT_EQ(_dwconv, output()->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU, _dwconv->fusedActivationFunction());
+
+  auto filter = loco::must_cast<luci::CircleConst *>(_dwconv->filter());
+  // 1HWC filter, scaled by channel i % 4
+  const std::vector<float> expected_filter{2, 4.5, 8, 12.5, 6, 10.5, 16, 22.5};
+  ASSERT_EQ(expected_filter.size(), filter->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected_filter.size(); ++i)
+    EXPECT_FLOAT_EQ(expected_filter[i], filter->at<loco::DataType::FLOAT32>(i));
+
+  auto bias = loco::must_cast<luci::CircleConst *>(_dwconv->bias());
+  const std::vector<float> expected_bias{2, 6, 12, 20};
+  ASSERT_EQ(expected_bias.size(), bias->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected_bias.size(); ++i)
+    EXPECT_FLOAT_EQ(expected_bias[i], bias->at<loco::DataType::FLOAT32>(i));
+}
+
+TEST_F(FuseMulWithDwConvPassTest, not_channel_wise_NEG)
+{
+  init();
+
+  // Values differ along a non-channel dimension
+  _const->rank(2);
+  _const->dim(0) = 4;
+  _const->dim(1) = 1;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseMulWithDwConvPassTest, rank_NEG)
+{
+  init();
+
+  // Broadcasting to a higher rank changes the shape of the output
+  _const->rank(5);
+  _const->dim(0) = 1;
+  _const->dim(1) = 1;
+  _const->dim(2) = 1;
+  _const->dim(3) = 1;
+  _const->dim(4) = 4;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseMulWithDwConvPassTest, fused_activation_NEG)
+{
+  init();
+
+  _dwconv->fusedActivationFunction(luci::FusedActFunc::RELU6);
+
+  EXPECT_FALSE(pass.run(g()));
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseMulWithFullyConnectedPass.h"
+
+#include "helpers/ChannelWiseConst.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Service/Nodes/CircleConst.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+namespace
+{
+
+/**
+ *  Fuse Mul to FullyConnected if the multiplier is a channel(last dimension)-wise constant
+ *
+ *  BEFORE
+ *                |   [CircleConst]
+ *                |  / [CircleConst]
+ *                | / /
+ *      [CircleFullyConnected] [CircleConst]
+ *                |           /
+ *           [CircleMul]
+ *                |
+ *
+ *  AFTER
+ *                |   [CircleConst] (scaled)
+ *                |  / [CircleConst] (scaled)
+ *                | / /
+ *      [CircleFullyConnected]     [CircleMul] (dead)
+ *                |
+ *
+ */
+bool fuse_mul_with_fc(luci::CircleFullyConnected *fc)
+{
+  if (fc->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  // Scaling the output of an activation is not the same as scaling its input
+  if (fc->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+
+  if (fc->weights_format() != luci::CircleFullyConnected::WeightsFormat::DEFAULT)
+    return false;
+
+  auto weights = dynamic_cast<luci::CircleConst *>(fc->weights());
+  if (weights == nullptr or weights->dtype() != loco::DataType::FLOAT32 or weights->rank() != 2)
+    return false;
+
+  auto fc_output = loco::succs(fc);
+  if (fc_output.size() != 1)
+    return false;
+
+  auto mul = dynamic_cast<luci::CircleMul *>(*fc_output.begin());
+  if (mul == nullptr or mul->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  const auto out_channel = weights->dim(0).value();
+  const auto scale = luci::channel_wise_values(luci::const_operand(mul, fc), fc, out_channel);
+  if (scale.empty())
+    return false;
+
+  std::vector<float> bias;
+  if (not luci::bias_values(fc->bias(), out_channel, bias))
+    return false;
+
+  // Weights may be shared with other nodes
+  auto fused_weights = luci::clone(weights);
+  const auto in_channel = weights->dim(1).value();
+  for (uint32_t o = 0; o < out_channel; ++o)
+    for (uint32_t i = 0; i < in_channel; ++i)
+      fused_weights->at<loco::DataType::FLOAT32>(o * in_channel + i) *= scale[o];
+
+  for (uint32_t c = 0; c < out_channel; ++c)
+    bias[c] *= scale[c];
+
+  auto name = mul->name();
+  assert(name.length() > 0);
+  fused_weights->name(name + "/FullyConnected/weights");
+
+  fc->weights(fused_weights);
+  fc->bias(luci::create_bias(fc->graph(), bias, name + "/FullyConnected/bias"));
+  fc->fusedActivationFunction(mul->fusedActivationFunction());
+
+  // set origin
+  luci::add_origin(fc, luci::get_origin(mul));
+
+  replace(mul).with(fc);
+
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseMulWithFullyConnectedPass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto fc = dynamic_cast<luci::CircleFullyConnected *>(node);
+    if (not fc)
+      continue;
+
+    if (fuse_mul_with_fc(fc))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
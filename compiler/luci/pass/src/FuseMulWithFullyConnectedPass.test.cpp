@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseMulWithFullyConnectedPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+// Values are 'start', 'start + step', 'start + 2 * step', ... in order
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape, float start,
+                                float step)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  uint32_t size = 1;
+  for (uint32_t i = 0; i < shape.size(); ++i)
+  {
+    node->dim(i) = shape.at(i);
+    size *= shape.at(i);
+  }
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = start + step * i;
+  node->name("const");
+  return node;
+}
+
+/**
+ *  Simple graph for test
+ *
+ *  BEFORE
+ *
+ *        [FC]
+ *           |
+ *     [Mul w/ Relu]
+ *
+ *  AFTER
+ *
+ *     [FC w/ Relu] (filter and bias scaled)
+ *
+ */
+class FCMulGraphlet
+{
+public:
+  FCMulGraphlet() = default;
+
+  void init(loco::Graph *g)
+  {
+    _filter = create_const(g, {4, 2}, 1.0f, 0.5f);
+    _bias = create_const(g, {4}, 1.0f, 1.0f);
+
+    _fc = g->nodes()->create<luci::CircleFullyConnected>();
+    _fc->weights(_filter);
+    _fc->bias(_bias);
+    _fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _fc->dtype(loco::DataType::FLOAT32);
+    _fc->shape({1, 4});
+    _fc->name("fc");
+
+    _const = create_const(g, {1, 4}, 2.0f, 1.0f);
+
+    _mul = g->nodes()->create<luci::CircleMul>();
+    _mul->x(_fc);
+    _mul->y(_const);
+    _mul->fusedActivationFunction(luci::FusedActFunc::RELU);
+    _mul->dtype(loco::DataType::FLOAT32);
+    _mul->shape({1, 4});
+    _mul->name("mul");
+  }
+
+protected:
+  luci::CircleFullyConnected *_fc = nullptr;
+  luci::CircleMul *_mul = nullptr;
+  luci::CircleConst *_filter = nullptr;
+  luci::CircleConst *_bias = nullptr;
+  luci::CircleConst *_const = nullptr;
+};
+
+class FCMulTestGraph : public TestIOGraph, public FCMulGraphlet
+{
+public:
+  FCMulTestGraph() = default;
+
+  void init(void)
+  {
+    TestIOGraph::init({1, 2}, {1, 4});
+    FCMulGraphlet::init(g());
+
+    _fc->input(input());
+
+    output()->from(_mul);
+  }
+};
+
+class FuseMulWithFullyConnectedPassTest : public ::testing::Test, public FCMulTestGraph
+{
+public:
+  luci::FuseMulWithFullyConnectedPass pass;
+};
+
+} // namespace
+
+TEST(FuseMulWithFullyConnectedPass, name)
+{
+  luci::FuseMulWithFullyConnectedPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseMulWithFullyConnectedPassTest, simple_test)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  EXPECT_EQ(_fc, output()->from());
+  EXPECT_EQ(luci::FusedActFunc::RELU, _fc->fusedActivationFunction());
+
+  auto filter = loco::must_cast<luci::CircleConst *>(_fc->weights());
+  // Weights of [out, in], scaled by channel o of o * 2 + i
+  const std::vector<float> expected_filter{2, 3, 6, 7.5, 12, 14, 20, 22.5};
+  ASSERT_EQ(expected_filter.size(), filter->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected_filter.size(); ++i)
+    EXPECT_FLOAT_EQ(expected_filter[i], filter->at<loco::DataType::FLOAT32>(i));
+
+  auto bias = loco::must_cast<luci::CircleConst *>(_fc->bias());
+  const std::vector<float> expected_bias{2, 6, 12, 20};
+  ASSERT_EQ(expected_bias.size(), bias->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected_bias.size(); ++i)
+    EXPECT_FLOAT_EQ(expected_bias[i], bias->at<loco::DataType::FLOAT32>(i));
+}
+
+TEST_F(FuseMulWithFullyConnectedPassTest, not_channel_wise_NEG)
+{
+  init();
+
+  // Values differ along a non-channel dimension
+  _const->rank(2);
+  _const->dim(0) = 4;
+  _const->dim(1) = 1;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseMulWithFullyConnectedPassTest, rank_NEG)
+{
+  init();
+
+  // Broadcasting to a higher rank changes the shape of the output
+  _const->rank(3);
+  _const->dim(0) = 1;
+  _const->dim(1) = 1;
+  _const->dim(2) = 4;
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseMulWithFullyConnectedPassTest, fused_activation_NEG)
+{
+  init();
+
+  _fc->fusedActivationFunction(luci::FusedActFunc::RELU6);
+
+  EXPECT_FALSE(pass.run(g()));
+}
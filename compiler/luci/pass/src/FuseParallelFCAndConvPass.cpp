@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseParallelFCAndConvPass.h"
+
+#include "helpers/ChannelWiseConst.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+luci::CircleConst *float_weights(loco::Node *node, uint32_t rank)
+{
+  auto weights = dynamic_cast<luci::CircleConst *>(node);
+  if (weights == nullptr or weights->dtype() != loco::DataType::FLOAT32)
+    return nullptr;
+  if (weights->rank() != rank or weights->quantparam() != nullptr)
+    return nullptr;
+  if (weights->sparsityparam() != nullptr)
+    return nullptr;
+  return weights;
+}
+
+luci::CircleConst *weights_of(const luci::CircleFullyConnected *fc)
+{
+  return float_weights(fc->weights(), 2);
+}
+
+luci::CircleConst *weights_of(const luci::CircleConv2D *conv)
+{
+  return float_weights(conv->filter(), 4);
+}
+
+void set_weights(luci::CircleFullyConnected *fc, luci::CircleConst *weights)
+{
+  fc->weights(weights);
+}
+
+void set_weights(luci::CircleConv2D *conv, luci::CircleConst *filter) { conv->filter(filter); }
+
+const char *op_name(const luci::CircleFullyConnected *) { return "FullyConnected"; }
+
+const char *op_name(const luci::CircleConv2D *) { return "Conv2D"; }
+
+template <class NODE> bool is_candidate(const NODE *node)
+{
+  if (node->dtype() != loco::DataType::FLOAT32 or node->quantparam() != nullptr)
+    return false;
+
+  auto weights = weights_of(node);
+  if (weights == nullptr)
+    return false;
+
+  std::vector<float> bias;
+  return luci::bias_values(node->bias(), weights->dim(0).value(), bias);
+}
+
+bool is_candidate(const luci::CircleFullyConnected *fc)
+{
+  if (fc->weights_format() != luci::CircleFullyConnected::WeightsFormat::DEFAULT)
+    return false;
+
+  return is_candidate<luci::CircleFullyConnected>(fc);
+}
+
+bool is_candidate(const luci::CircleConv2D *conv) { return is_candidate<luci::CircleConv2D>(conv); }
+
+bool can_fuse(const luci::CircleFullyConnected *lhs, const luci::CircleFullyConnected *rhs)
+{
+  if (lhs->fusedActivationFunction() != rhs->fusedActivationFunction())
+    return false;
+  if (lhs->keep_num_dims() != rhs->keep_num_dims())
+    return false;
+
+  return weights_of(lhs)->dim(1) == weights_of(rhs)->dim(1);
+}
+
+bool can_fuse(const luci::CircleConv2D *lhs, const luci::CircleConv2D *rhs)
+{
+  if (lhs->fusedActivationFunction() != rhs->fusedActivationFunction())
+    return false;
+  if (lhs->padding() != rhs->padding())
+    return false;
+  if (lhs->stride()->h() != rhs->stride()->h() or lhs->stride()->w() != rhs->stride()->w())
+    return false;
+  if (lhs->dilation()->h() != rhs->dilation()->h() or
+      lhs->dilation()->w() != rhs->dilation()->w())
+    return false;
+
+  auto lhs_filter = weights_of(lhs);
+  auto rhs_filter = weights_of(rhs);
+  for (uint32_t i = 1; i < 4; ++i)
+  {
+    if (not(lhs_filter->dim(i) == rhs_filter->dim(i)))
+      return false;
+  }
+  return true;
+}
+
+void copy_attributes(const luci::CircleFullyConnected *from, luci::CircleFullyConnected *to)
+{
+  to->fusedActivationFunction(from->fusedActivationFunction());
+  to->weights_format(from->weights_format());
+  to->keep_num_dims(from->keep_num_dims());
+}
+
+void copy_attributes(const luci::CircleConv2D *from, luci::CircleConv2D *to)
+{
+  to->fusedActivationFunction(from->fusedActivationFunction());
+  to->padding(from->padding());
+  to->stride()->h(from->stride()->h());
+  to->stride()->w(from->stride()->w());
+  to->dilation()->h(from->dilation()->h());
+  to->dilation()->w(from->dilation()->w());
+}
+
+luci::CircleConst *create_s32(loco::Graph *g, const std::vector<int32_t> &values, bool scalar,
+                              const std::string &name)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  if (scalar)
+    node->rank(0);
+  else
+  {
+    node->rank(1);
+    node->dim(0).set(values.size());
+  }
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::S32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::S32>(i) = values[i];
+  node->name(name);
+  return node;
+}
+
+/**
+ *  EXAMPLE (Two FullyConnected)
+ *
+ *  BEFORE
+ *                       [CircleNode]
+ *                        /        \
+ *   [CircleFullyConnected]        [CircleFullyConnected]
+ *                |                         |
+ *          [CircleNode]              [CircleNode]
+ *
+ *  AFTER
+ *                       [CircleNode]
+ *                            |
+ *               [CircleFullyConnected] (weights and bias concatenated)
+ *                            |
+ *                     [CircleSplitV] (split_dim = -1)
+ *                        /        \
+ *         [CircleSplitVOut]      [CircleSplitVOut]
+ *                |                         |
+ *          [CircleNode]              [CircleNode]
+ *
+ *  NOTE Weights of FullyConnected and filters of Conv2D have the output channel in the first
+ *       dimension, so concatenating them is appending their values
+ */
+template <class NODE> void fuse(const std::vector<NODE *> &nodes)
+{
+  auto first = nodes.front();
+  loco::Graph *g = first->graph();
+
+  std::string name = first->name();
+  assert(name.length() > 0);
+
+  std::vector<float> weight_values;
+  std::vector<float> bias_values;
+  std::vector<int32_t> size_splits;
+  std::vector<std::shared_ptr<luci::CircleNodeOrigin>> origins;
+  for (auto node : nodes)
+  {
+    luci::CircleConst *weights = weights_of(node);
+    const auto out_channel = weights->dim(0).value();
+    for (uint32_t i = 0; i < weights->size<loco::DataType::FLOAT32>(); ++i)
+      weight_values.push_back(weights->at<loco::DataType::FLOAT32>(i));
+
+    std::vector<float> bias;
+    luci::bias_values(node->bias(), out_channel, bias);
+    bias_values.insert(bias_values.end(), bias.begin(), bias.end());
+
+    size_splits.push_back(static_cast<int32_t>(out_channel));
+    origins.push_back(luci::get_origin(node));
+  }
+
+  luci::CircleConst *first_weights = weights_of(first);
+  auto fused_weights = g->nodes()->create<luci::CircleConst>();
+  fused_weights->dtype(loco::DataType::FLOAT32);
+  fused_weights->rank(first_weights->rank());
+  fused_weights->dim(0).set(bias_values.size());
+  for (uint32_t i = 1; i < first_weights->rank(); ++i)
+    fused_weights->dim(i) = first_weights->dim(i);
+  fused_weights->shape_status(luci::ShapeStatus::VALID);
+  fused_weights->size<loco::DataType::FLOAT32>(weight_values.size());
+  for (uint32_t i = 0; i < weight_values.size(); ++i)
+    fused_weights->at<loco::DataType::FLOAT32>(i) = weight_values[i];
+
+  const std::string prefix = name + "/" + op_name(first) + "_parallel";
+  fused_weights->name(prefix + "/weights");
+
+  auto fused = g->nodes()->create<NODE>();
+  fused->input(first->input());
+  set_weights(fused, fused_weights);
+  fused->bias(luci::create_bias(g, bias_values, prefix + "/bias"));
+  copy_attributes(first, fused);
+  fused->dtype(loco::DataType::FLOAT32);
+  fused->name(prefix);
+  luci::add_origin(fused, luci::composite_origin(origins));
+
+  auto split = g->nodes()->create<luci::CircleSplitV>();
+  split->input(fused);
+  split->size_splits(create_s32(g, size_splits, false, prefix + "/size_splits"));
+  split->split_dim(create_s32(g, {-1}, true, prefix + "/split_dim"));
+  split->num_split(static_cast<int32_t>(nodes.size()));
+  split->dtype(loco::DataType::FLOAT32);
+  split->name(prefix + "/SplitV");
+  luci::add_origin(split, luci::composite_origin(origins));
+
+  for (uint32_t i = 0; i < nodes.size(); ++i)
+  {
+    auto split_out = g->nodes()->create<luci::CircleSplitVOut>();
+    split_out->input(split);
+    split_out->index(static_cast<int32_t>(i));
+    split_out->dtype(loco::DataType::FLOAT32);
+    split_out->name(nodes.at(i)->name());
+    luci::add_origin(split_out, luci::get_origin(nodes.at(i)));
+
+    replace(nodes.at(i)).with(split_out);
+  }
+}
+
+/**
+ * @brief Fuse each group of nodes which can be fused to each other
+ */
+template <class NODE> bool fuse_groups(std::vector<NODE *> &nodes)
+{
+  // Sort by name so that the layout of fused weights does not depend on node addresses
+  std::sort(nodes.begin(), nodes.end(),
+            [](const NODE *lhs, const NODE *rhs) { return lhs->name() < rhs->name(); });
+
+  std::vector<std::vector<NODE *>> groups;
+  for (auto node : nodes)
+  {
+    auto it = std::find_if(groups.begin(), groups.end(), [node](const std::vector<NODE *> &group) {
+      return can_fuse(group.front(), node);
+    });
+    if (it == groups.end())
+      groups.push_back({node});
+    else
+      it->push_back(node);
+  }
+
+  bool changed = false;
+  for (auto &group : groups)
+  {
+    if (group.size() < 2)
+      continue;
+
+    fuse(group);
+    changed = true;
+  }
+  return changed;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseParallelFCAndConvPass::run(loco::Graph *g)
+{
+  bool changed = false;
+
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    std::vector<luci::CircleFullyConnected *> fcs;
+    std::vector<luci::CircleConv2D *> convs;
+    for (auto succ : loco::succs(node))
+    {
+      if (auto fc = dynamic_cast<luci::CircleFullyConnected *>(succ))
+      {
+        if (fc->input() == node and is_candidate(fc))
+          fcs.push_back(fc);
+      }
+      else if (auto conv = dynamic_cast<luci::CircleConv2D *>(succ))
+      {
+        if (conv->input() == node and is_candidate(conv))
+          convs.push_back(conv);
+      }
+    }
+
+    if (fuse_groups(fcs))
+      changed = true;
+    if (fuse_groups(convs))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
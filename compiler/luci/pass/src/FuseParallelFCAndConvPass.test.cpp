@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseParallelFCAndConvPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+luci::CircleConst *create_const(loco::Graph *g, const std::vector<uint32_t> &shape, float value)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(shape.size());
+  uint32_t size = 1;
+  for (uint32_t i = 0; i < shape.size(); ++i)
+  {
+    node->dim(i).set(shape.at(i));
+    size *= shape.at(i);
+  }
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->size<loco::DataType::FLOAT32>(size);
+  for (uint32_t i = 0; i < size; ++i)
+    node->at<loco::DataType::FLOAT32>(i) = value;
+  node->name("const");
+  return node;
+}
+
+/**
+ *  Graph with FullyConnected nodes sharing an input
+ *
+ *                    [CircleInput]
+ *                     /         \
+ *   [CircleFullyConnected]    [CircleFullyConnected]
+ *                |                    |
+ *         [CircleOutput]        [CircleOutput]
+ */
+class ParallelFCGraph : public TestIsGraphlet<1>, public TestOsGraphlet<2>
+{
+public:
+  void init(void)
+  {
+    TestIsGraphlet<1>::init(g(), {{1, 4}});
+    TestOsGraphlet<2>::init(g(), {{1, 3}, {1, 2}});
+
+    _fc_1 = create_fc(create_const(g(), {3, 4}, 1.0f), create_const(g(), {3}, 0.5f), "fc_1");
+    _fc_2 = create_fc(create_const(g(), {2, 4}, 2.0f),
+                      g()->nodes()->create<luci::CircleOutputExclude>(), "fc_2");
+
+    output(0)->from(_fc_1);
+    output(1)->from(_fc_2);
+  }
+
+private:
+  luci::CircleFullyConnected *create_fc(loco::Node *weights, loco::Node *bias, const char *name)
+  {
+    auto fc = g()->nodes()->create<luci::CircleFullyConnected>();
+    fc->input(input(0));
+    fc->weights(weights);
+    fc->bias(bias);
+    fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+    fc->dtype(loco::DataType::FLOAT32);
+    fc->name(name);
+    return fc;
+  }
+
+protected:
+  luci::CircleFullyConnected *_fc_1 = nullptr;
+  luci::CircleFullyConnected *_fc_2 = nullptr;
+};
+
+/**
+ *  Graph with 1x1 Conv2D nodes sharing an input
+ */
+class ParallelConvGraph : public TestIsGraphlet<1>, public TestOsGraphlet<2>
+{
+public:
+  void init(void)
+  {
+    TestIsGraphlet<1>::init(g(), {{1, 4, 4, 8}});
+    TestOsGraphlet<2>::init(g(), {{1, 4, 4, 16}, {1, 4, 4, 4}});
+
+    _conv_1 = create_conv(16, "conv_1");
+    _conv_2 = create_conv(4, "conv_2");
+
+    output(0)->from(_conv_1);
+    output(1)->from(_conv_2);
+  }
+
+private:
+  luci::CircleConv2D *create_conv(uint32_t out_channel, const char *name)
+  {
+    auto conv = g()->nodes()->create<luci::CircleConv2D>();
+    conv->input(input(0));
+    conv->filter(create_const(g(), {out_channel, 1, 1, 8}, 1.0f));
+    conv->bias(create_const(g(), {out_channel}, 0.0f));
+    conv->padding(luci::Padding::VALID);
+    conv->stride()->h(1);
+    conv->stride()->w(1);
+    conv->dilation()->h(1);
+    conv->dilation()->w(1);
+    conv->fusedActivationFunction(luci::FusedActFunc::RELU);
+    conv->dtype(loco::DataType::FLOAT32);
+    conv->name(name);
+    return conv;
+  }
+
+protected:
+  luci::CircleConv2D *_conv_1 = nullptr;
+  luci::CircleConv2D *_conv_2 = nullptr;
+};
+
+class FuseParallelFCTest : public ::testing::Test, public ParallelFCGraph
+{
+public:
+  luci::FuseParallelFCAndConvPass pass;
+};
+
+class FuseParallelConvTest : public ::testing::Test, public ParallelConvGraph
+{
+public:
+  luci::FuseParallelFCAndConvPass pass;
+};
+
+} // namespace
+
+TEST(FuseParallelFCAndConvPass, name)
+{
+  luci::FuseParallelFCAndConvPass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseParallelFCTest, fuse_fc)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto out_1 = dynamic_cast<luci::CircleSplitVOut *>(output(0)->from());
+  auto out_2 = dynamic_cast<luci::CircleSplitVOut *>(output(1)->from());
+  ASSERT_NE(nullptr, out_1);
+  ASSERT_NE(nullptr, out_2);
+  EXPECT_EQ(0, out_1->index());
+  EXPECT_EQ(1, out_2->index());
+  EXPECT_EQ(out_1->input(), out_2->input());
+
+  auto split = loco::must_cast<luci::CircleSplitV *>(out_1->input());
+  EXPECT_EQ(2, split->num_split());
+  auto size_splits = loco::must_cast<luci::CircleConst *>(split->size_splits());
+  EXPECT_EQ(3, size_splits->at<loco::DataType::S32>(0));
+  EXPECT_EQ(2, size_splits->at<loco::DataType::S32>(1));
+
+  auto fc = dynamic_cast<luci::CircleFullyConnected *>(split->input());
+  ASSERT_NE(nullptr, fc);
+  EXPECT_EQ(input(0), fc->input());
+
+  auto weights = loco::must_cast<luci::CircleConst *>(fc->weights());
+  EXPECT_EQ(5, weights->dim(0).value());
+  EXPECT_EQ(4, weights->dim(1).value());
+  EXPECT_FLOAT_EQ(1.0f, weights->at<loco::DataType::FLOAT32>(0));
+  EXPECT_FLOAT_EQ(2.0f, weights->at<loco::DataType::FLOAT32>(12));
+
+  auto bias = loco::must_cast<luci::CircleConst *>(fc->bias());
+  EXPECT_EQ(5, bias->size<loco::DataType::FLOAT32>());
+  EXPECT_FLOAT_EQ(0.5f, bias->at<loco::DataType::FLOAT32>(2));
+  EXPECT_FLOAT_EQ(0.0f, bias->at<loco::DataType::FLOAT32>(3));
+}
+
+TEST_F(FuseParallelFCTest, different_activation_NEG)
+{
+  init();
+
+  _fc_2->fusedActivationFunction(luci::FusedActFunc::RELU);
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseParallelFCTest, non_const_weights_NEG)
+{
+  init();
+
+  _fc_2->weights(input(0));
+
+  EXPECT_FALSE(pass.run(g()));
+}
+
+TEST_F(FuseParallelConvTest, fuse_conv)
+{
+  init();
+
+  EXPECT_TRUE(pass.run(g()));
+
+  auto out_1 = dynamic_cast<luci::CircleSplitVOut *>(output(0)->from());
+  ASSERT_NE(nullptr, out_1);
+  auto split = loco::must_cast<luci::CircleSplitV *>(out_1->input());
+  auto conv = dynamic_cast<luci::CircleConv2D *>(split->input());
+  ASSERT_NE(nullptr, conv);
+  EXPECT_EQ(luci::FusedActFunc::RELU, conv->fusedActivationFunction());
+  EXPECT_EQ(luci::Padding::VALID, conv->padding());
+
+  auto filter = loco::must_cast<luci::CircleConst *>(conv->filter());
+  EXPECT_EQ(20, filter->dim(0).value());
+  EXPECT_EQ(8, filter->dim(3).value());
+}
+
+TEST_F(FuseParallelConvTest, different_stride_NEG)
+{
+  init();
+
+  _conv_2->stride()->h(2);
+
+  EXPECT_FALSE(pass.run(g()));
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IncrementalPhase.h"
+
+#include <luci/IncrementalPass.h>
+#include <luci/IR/CircleNode.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+
+// What passes see of a node, which changes if the node is rewritten or inferred again
+struct NodeState
+{
+  uint32_t opnum = 0;
+  std::vector<loco::Node *> args;
+  loco::DataType dtype = loco::DataType::Unknown;
+  luci::ShapeStatus shape_status = luci::ShapeStatus::UNDEFINED;
+  std::vector<int64_t> dims;
+
+  bool operator==(const NodeState &other) const
+  {
+    return opnum == other.opnum && args == other.args && dtype == other.dtype &&
+           shape_status == other.shape_status && dims == other.dims;
+  }
+};
+
+using Snapshot = std::unordered_map<loco::Node *, NodeState>;
+
+Snapshot take_snapshot(loco::Graph *g)
+{
+  Snapshot snapshot;
+  for (uint32_t n = 0; n < g->nodes()->size(); ++n)
+  {
+    auto node = g->nodes()->at(n);
+    auto &state = snapshot[node];
+
+    state.opnum = node->opnum();
+    for (uint32_t i = 0; i < node->arity(); ++i)
+      state.args.emplace_back(node->arg(i));
+
+    if (auto circle_node = dynamic_cast<luci::CircleNode *>(node))
+    {
+      state.dtype = circle_node->dtype();
+      state.shape_status = circle_node->shape_status();
+      for (uint32_t i = 0; i < circle_node->rank(); ++i)
+      {
+        const auto &dim = circle_node->dim(i);
+        state.dims.emplace_back(dim.known() ? static_cast<int64_t>(dim.value()) : -1);
+      }
+    }
+  }
+  return snapshot;
+}
+
+// Changed nodes of the graph with their arguments and successors, which includes the nodes that
+// lost a successor
+std::unordered_set<loco::Node *> changed_nodes(const Snapshot &before, const Snapshot &after)
+{
+  std::unordered_set<loco::Node *> changed;
+  auto add = [&](loco::Node *node) {
+    if (node != nullptr && after.find(node) != after.end())
+      changed.insert(node);
+  };
+
+  for (const auto &it : after)
+  {
+    auto node = it.first;
+    auto found = before.find(node);
+    if (found != before.end() && found->second == it.second)
+      continue;
+
+    add(node);
+    for (auto arg : it.second.args)
+      add(arg);
+    for (auto succ : loco::succs(node))
+      add(succ);
+    if (found != before.end())
+    {
+      for (auto arg : found->second.args)
+        add(arg);
+    }
+  }
+
+  for (const auto &it : before)
+  {
+    // Nodes removed from the graph
+    if (after.find(it.first) == after.end())
+    {
+      for (auto arg : it.second.args)
+        add(arg);
+    }
+  }
+
+  return changed;
+}
+
+} // namespace
+
+namespace luci
+{
+
+void IncrementalPhaseRunner::run(const logo::Phase &phase) const
+{
+  notifyPhaseBegin();
+
+  const auto num_passes = phase.size();
+  std::vector<luci::IncrementalPass *> incremental(num_passes, nullptr);
+  for (size_t i = 0; i < num_passes; ++i)
+    incremental[i] = dynamic_cast<luci::IncrementalPass *>(phase[i].get());
+
+  // A pass is clean if it changed nothing on the graph as it is now
+  std::vector<bool> clean(num_passes, false);
+  // An incremental pass only has to revisit these nodes if it was run on the whole graph
+  std::vector<bool> ran_whole(num_passes, false);
+  std::vector<std::unordered_set<loco::Node *>> pending(num_passes);
+
+  auto snapshot = take_snapshot(_graph);
+
+  // Index of the next pass, and whether it runs on the pending nodes only
+  auto next = [&](bool &partial) -> size_t {
+    for (size_t i = 0; i < num_passes; ++i)
+    {
+      if (clean[i])
+        continue;
+      partial = false;
+      if (incremental[i] == nullptr || !ran_whole[i])
+        return i;
+      if (!pending[i].empty())
+      {
+        partial = true;
+        return i;
+      }
+    }
+    // Confirm the incremental passes on the whole graph
+    for (size_t i = 0; i < num_passes; ++i)
+    {
+      if (!clean[i])
+      {
+        partial = false;
+        return i;
+      }
+    }
+    return num_passes;
+  };
+
+  bool partial = false;
+  for (auto i = next(partial); i < num_passes; i = next(partial))
+  {
+    auto pass = phase[i].get();
+    notifyPassBegin(pass);
+
+    bool changed = false;
+    if (partial)
+    {
+      std::vector<loco::Node *> nodes(pending[i].begin(), pending[i].end());
+      pending[i].clear();
+      changed = incremental[i]->run(_graph, nodes);
+    }
+    else
+    {
+      pending[i].clear();
+      changed = pass->run(_graph);
+      ran_whole[i] = true;
+      clean[i] = !changed;
+    }
+
+    notifyPassEnd(pass, changed);
+
+    if (!changed)
+      continue;
+
+    auto after = take_snapshot(_graph);
+    const auto nodes = changed_nodes(snapshot, after);
+    for (size_t j = 0; j < num_passes; ++j)
+    {
+      clean[j] = false;
+      if (incremental[j] == nullptr)
+        continue;
+
+      // Forget the nodes removed from the graph
+      for (auto it = pending[j].begin(); it != pending[j].end();)
+      {
+        if (after.find(*it) == after.end())
+          it = pending[j].erase(it);
+        else
+          ++it;
+      }
+      pending[j].insert(nodes.begin(), nodes.end());
+    }
+    snapshot = std::move(after);
+  }
+
+  notifyPhaseEnd();
+}
+
+} // namespace luci
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_INCREMENTAL_PHASE_H__
+#define __LUCI_INCREMENTAL_PHASE_H__
+
+#include <logo/Phase.h>
+
+#include <loco.h>
+
+namespace luci
+{
+
+/**
+ * @brief Phase runner which ends up like logo::PhaseStrategy::Restart, but runs
+ *        luci::IncrementalPass(es) only on the nodes around the changes of the graph
+ *
+ * Like Restart, the first pass that has work goes next. A pass has work if the graph changed since
+ * it last ran without a change. An incremental pass, once run on the whole graph, revisits just
+ * the changed nodes with their arguments and successors. Before the phase ends, incremental
+ * passes run on the whole graph again to confirm that nothing is left.
+ */
+class IncrementalPhaseRunner final : public logo::PhaseRunnerMixinObservable
+{
+public:
+  IncrementalPhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const logo::Phase &) const;
+
+private:
+  loco::Graph *_graph;
+};
+
+} // namespace luci
+
+#endif // __LUCI_INCREMENTAL_PHASE_H__
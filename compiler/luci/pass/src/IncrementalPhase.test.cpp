@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IncrementalPhase.h"
+
+#include "luci/Pass/CircleShapeInferencePass.h"
+#include "luci/Pass/CircleTypeInferencePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace
+{
+
+/**
+ *  input ---> [relu1] ---> [relu2] ---> output
+ */
+class ReluChainGraph
+{
+public:
+  ReluChainGraph()
+  {
+    auto graph_input = g.inputs()->create();
+    input = g.nodes()->create<luci::CircleInput>();
+    input->index(graph_input->index());
+    input->dtype(loco::DataType::FLOAT32);
+    input->shape({1, 2});
+    input->shape_status(luci::ShapeStatus::VALID);
+
+    relu1 = g.nodes()->create<luci::CircleRelu>();
+    relu1->features(input);
+    relu2 = g.nodes()->create<luci::CircleRelu>();
+    relu2->features(relu1);
+
+    auto graph_output = g.outputs()->create();
+    output = g.nodes()->create<luci::CircleOutput>();
+    output->index(graph_output->index());
+    output->from(relu2);
+  }
+
+public:
+  loco::Graph g;
+  luci::CircleInput *input = nullptr;
+  luci::CircleRelu *relu1 = nullptr;
+  luci::CircleRelu *relu2 = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+// Record how an incremental pass is run, which changes nothing
+struct RecordingPass final : public luci::Pass, public luci::IncrementalPass
+{
+  const char *name(void) const final { return "RecordingPass"; }
+
+  bool run(luci::Module *) final { return false; }
+  bool run(loco::Graph *) final
+  {
+    whole_runs++;
+    return false;
+  }
+  bool run(loco::Graph *, const std::vector<loco::Node *> &nodes) final
+  {
+    partial_runs.emplace_back(nodes);
+    return false;
+  }
+
+  uint32_t whole_runs = 0;
+  std::vector<std::vector<loco::Node *>> partial_runs;
+};
+
+// Bypass relu1 once
+struct BypassPass final : public logo::Pass
+{
+  BypassPass(ReluChainGraph *graph) : graph{graph} {}
+
+  const char *name(void) const final { return "BypassPass"; }
+
+  bool run(loco::Graph *) final
+  {
+    if (graph->relu2->features() == graph->input)
+      return false;
+    graph->relu2->features(graph->input);
+    return true;
+  }
+
+  ReluChainGraph *graph;
+};
+
+bool contains(const std::vector<loco::Node *> &nodes, loco::Node *node)
+{
+  return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+}
+
+} // namespace
+
+TEST(IncrementalPhaseTest, infer)
+{
+  ReluChainGraph graph;
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+
+  luci::IncrementalPhaseRunner phase_runner{&graph.g};
+  phase_runner.run(phase);
+
+  ASSERT_EQ(luci::ShapeStatus::VALID, graph.relu2->shape_status());
+  ASSERT_EQ(2, graph.relu2->rank());
+  ASSERT_EQ(2, graph.relu2->dim(1).value());
+  ASSERT_EQ(loco::DataType::FLOAT32, graph.relu2->dtype());
+}
+
+TEST(IncrementalPhaseTest, revisit_changed_nodes)
+{
+  ReluChainGraph graph;
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<RecordingPass>());
+  phase.emplace_back(std::make_unique<BypassPass>(&graph));
+  auto recording = dynamic_cast<RecordingPass *>(phase.front().get());
+
+  luci::IncrementalPhaseRunner phase_runner{&graph.g};
+  phase_runner.run(phase);
+
+  // Once at the beginning, and once to confirm at the end
+  ASSERT_EQ(2, recording->whole_runs);
+  ASSERT_EQ(1, recording->partial_runs.size());
+
+  // The bypassed node, its new and old arguments and its user
+  const auto &nodes = recording->partial_runs.front();
+  ASSERT_EQ(4, nodes.size());
+  ASSERT_TRUE(contains(nodes, graph.relu2));
+  ASSERT_TRUE(contains(nodes, graph.input));
+  ASSERT_TRUE(contains(nodes, graph.relu1));
+  ASSERT_TRUE(contains(nodes, graph.output));
+}
+
+TEST(IncrementalPhaseTest, empty_phase)
+{
+  ReluChainGraph graph;
+
+  logo::Phase phase;
+  luci::IncrementalPhaseRunner phase_runner{&graph.g};
+  phase_runner.run(phase);
+
+  SUCCEED();
+}
@@ -22,7 +22,9 @@
 #include <logo/Phase.h>
 #include <logo/Pass.h>
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 namespace
 {
@@ -47,6 +49,34 @@ const char *to_str(logo::PhaseStrategy s)
 namespace luci
 {
 
+void PassTimer::end(const logo::Pass *pass, bool changed)
+{
+  auto &stat = _stats[logo::pass_name(pass)];
+  stat.runs++;
+  stat.changes += changed ? 1 : 0;
+  stat.time += std::chrono::steady_clock::now() - _begin;
+}
+
+void PassTimer::report(void) const
+{
+  LOGGER(prime);
+
+  // Slowest first
+  using NamedStat = std::pair<std::string, Stat>;
+  std::vector<NamedStat> stats(_stats.begin(), _stats.end());
+  std::stable_sort(stats.begin(), stats.end(), [](const NamedStat &a, const NamedStat &b) {
+    return a.second.time > b.second.time;
+  });
+
+  INFO(prime) << "Time of passes (ms, runs, changes)";
+  for (const auto &it : stats)
+  {
+    const auto ms = std::chrono::duration<double, std::milli>(it.second.time).count();
+    INFO(prime) << "  " << it.first << ": " << ms << ", " << it.second.runs << ", "
+                << it.second.changes;
+  }
+}
+
 void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PhaseBegin> *)
 {
   LOGGER(prime);
@@ -61,6 +91,7 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::Phase
 {
   LOGGER(prime);
 
+  _timer.report();
   INFO(prime) << "PhaseRunner<" << to_str(strategy()) << "> - done";
 }
 
@@ -70,12 +101,16 @@ void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassB
 
   INFO(prime) << "--------------------------------------------------------------";
   INFO(prime) << "Before " << logo::pass_name(info->pass());
+  _timer.begin();
 }
 
 void ProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassEnd> *info)
 {
   LOGGER(prime);
 
+  // Before dumping the graph, which is not the time of the pass
+  _timer.end(info->pass(), info->changed());
+
   INFO(prime) << "After " << logo::pass_name(info->pass())
               << " (changed: " << to_char(info->changed()) << ")";
   INFO(prime) << luci::fmt(graph());
@@ -99,6 +134,7 @@ void ModuleProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent:
 {
   LOGGER(prime);
 
+  _timer.report();
   INFO(prime) << "ModulePhaseRunner<" << to_str(strategy()) << "> - done";
 }
 
@@ -108,12 +144,16 @@ void ModuleProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent:
 
   INFO(prime) << "--------------------------------------------------------------";
   INFO(prime) << "Before " << logo::pass_name(info->pass());
+  _timer.begin();
 }
 
 void ModuleProgressReporter::notify(const logo::PhaseEventInfo<logo::PhaseEvent::PassEnd> *info)
 {
   LOGGER(prime);
 
+  // Before dumping the graph, which is not the time of the pass
+  _timer.end(info->pass(), info->changed());
+
   INFO(prime) << "After " << logo::pass_name(info->pass())
               << " (changed: " << to_char(info->changed()) << ")";
   for (size_t g = 0; g < module()->size(); ++g)
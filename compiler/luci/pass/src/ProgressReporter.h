@@ -23,9 +23,35 @@
 
 #include <luci/IR/Module.h>
 
+#include <chrono>
+#include <map>
+#include <string>
+
 namespace luci
 {
 
+/**
+ * @brief Time spent by each pass of a phase, which is reported at the end of the phase
+ */
+class PassTimer
+{
+public:
+  void begin(void) { _begin = std::chrono::steady_clock::now(); }
+  void end(const logo::Pass *pass, bool changed);
+  void report(void) const;
+
+private:
+  struct Stat
+  {
+    uint32_t runs = 0;
+    uint32_t changes = 0;
+    std::chrono::steady_clock::duration time{0};
+  };
+
+  std::chrono::steady_clock::time_point _begin;
+  std::map<std::string, Stat> _stats;
+};
+
 class ProgressReporter : public logo::PhaseEventListener
 {
 public:
@@ -48,6 +74,7 @@ public:
 private:
   loco::Graph *_graph;
   logo::PhaseStrategy _strategy;
+  PassTimer _timer;
 };
 
 class ModuleProgressReporter : public logo::PhaseEventListener
@@ -72,6 +99,7 @@ public:
 private:
   luci::Module *_module;
   logo::PhaseStrategy _strategy;
+  PassTimer _timer;
 };
 
 } // namespace luci
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWeightsOnlyPass.h"
+#include "QuantizationUtils.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/Service/Nodes/CircleConst.h>
+#include <luci/Log.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using namespace luci;
+
+constexpr int32_t kMaxQuantized = std::numeric_limits<int8_t>::max();
+
+// Compute symmetric int8 scale from the largest magnitude of values
+float compute_s8_scale(float max_abs)
+{
+  float scale = max_abs / kMaxQuantized;
+  // protect scale from being very low to avoid overflow/underflow
+  return scale < 1e-9 ? 1e-9 : scale;
+}
+
+/**
+ * @brief Quantize weights of [channels, ...] to int8 with a scale for each channel, or a scale
+ *        for the whole tensor if per_channel is false
+ * @note  in-place update of node data
+ */
+void symmetric_s8_wquant(CircleConst *node, bool per_channel)
+{
+  assert(node->dtype() == loco::DataType::FLOAT32);
+  assert(node->rank() > 0);
+
+  const uint32_t size = node->size<loco::DataType::FLOAT32>();
+  const uint32_t channels = per_channel ? node->dim(0).value() : 1;
+  assert(channels > 0 && size % channels == 0);
+  const uint32_t channel_size = size / channels;
+
+  std::vector<float> scaling_factor(channels);
+  std::vector<int8_t> quantized_values(size);
+  for (uint32_t c = 0; c < channels; ++c)
+  {
+    float max_abs = 0.0f;
+    for (uint32_t i = c * channel_size; i < (c + 1) * channel_size; ++i)
+      max_abs = std::max(max_abs, std::abs(node->at<loco::DataType::FLOAT32>(i)));
+
+    scaling_factor[c] = compute_s8_scale(max_abs);
+    const float scaling_factor_inv = 1.0f / scaling_factor[c];
+    for (uint32_t i = c * channel_size; i < (c + 1) * channel_size; ++i)
+    {
+      auto data = std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv);
+      data = std::min<float>(kMaxQuantized, std::max<float>(-kMaxQuantized, data));
+      quantized_values[i] = static_cast<int8_t>(data);
+    }
+  }
+
+  node->dtype(loco::DataType::S8);      // change the type of tensor
+  node->size<loco::DataType::S8>(size); // resize tensor
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    node->at<loco::DataType::S8>(i) = quantized_values[i];
+  }
+
+  auto quantparam = std::make_unique<CircleQuantParam>();
+  quantparam->scale = scaling_factor;
+  quantparam->zerop.assign(channels, 0);
+  quantparam->quantized_dimension = 0;
+  node->quantparam(std::move(quantparam));
+}
+
+/**
+ * @brief QuantizeWeightsOnly quantizes weights of Ops which a backend runs with float
+ *        activations and quantized weights
+ */
+struct QuantizeWeightsOnly final : public luci::CircleNodeMutableVisitor<void>
+{
+  QuantizeWeightsOnly(loco::DataType input, loco::DataType output,
+                      QuantizationGranularity granularity)
+    : input_type(input), output_type(output), granularity(granularity)
+  {
+  }
+
+  loco::DataType input_type;
+  loco::DataType output_type;
+  QuantizationGranularity granularity;
+
+private:
+  // Check if
+  // 1. node is float const
+  // 2. node was not quantized
+  bool is_quantizable(loco::Node *node)
+  {
+    auto const_node = dynamic_cast<luci::CircleConst *>(node);
+    if (not const_node)
+      return false;
+
+    if (const_node->dtype() != input_type)
+      return false;
+
+    // Skip if this is already quantized
+    if (is_quantized(const_node))
+      return false;
+
+    return true;
+  }
+
+  // Default behavior (Do nothing)
+  void visit(luci::CircleNode *) {}
+
+  void visit(luci::CircleFullyConnected *node)
+  {
+    LOGGER(l);
+    INFO(l) << "QuantizeWeightsOnly visit node: " << node->name() << std::endl;
+
+    if (not is_quantizable(node->weights()))
+      return;
+
+    assert(output_type == loco::DataType::S8); // FIX_CALLER_UNLESS
+
+    auto weights = loco::must_cast<luci::CircleConst *>(node->weights());
+    if (weights->rank() != 2)
+      return;
+
+    auto new_weights = luci::clone(weights);
+    node->weights(new_weights);
+    symmetric_s8_wquant(new_weights, granularity == QuantizationGranularity::ChannelWise);
+  }
+};
+
+} // namespace
+
+namespace luci
+{
+
+bool QuantizeWeightsOnlyPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+  INFO(l) << "QuantizeWeightsOnlyPass Start" << std::endl;
+
+  // Quantize weights
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    QuantizeWeightsOnly qw(_ctx->input_model_dtype, _ctx->output_model_dtype, _ctx->granularity);
+    circle_node->accept(&qw);
+  }
+
+  INFO(l) << "QuantizeWeightsOnlyPass End" << std::endl;
+  return false; // one time run
+}
+
+} // namespace luci
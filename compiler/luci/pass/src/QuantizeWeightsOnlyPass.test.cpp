@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/QuantizeWeightsOnlyPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+#include "test/TestFirstNode.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+class FCGraphlet
+{
+public:
+  FCGraphlet() = default;
+
+public:
+  void init(loco::Graph *g, const ShapeU32 wshape)
+  {
+    const uint32_t elements_num = num_elements(wshape);
+
+    // fc weights, whose rows have different ranges
+    _weights = g->nodes()->create<luci::CircleConst>();
+    _weights->dtype(loco::DataType::FLOAT32);
+    _weights->shape(wshape);
+    _weights->size<loco::DataType::FLOAT32>(elements_num);
+    const uint32_t cols = elements_num / *wshape.begin();
+    for (uint32_t idx = 0; idx < elements_num; idx++)
+    {
+      const float row = static_cast<float>(idx / cols + 1);
+      _weights->at<loco::DataType::FLOAT32>(idx) = (idx % 2 ? -row : row) * (idx % cols);
+    }
+    _weights->name("weights");
+
+    // fc
+    _fc = g->nodes()->create<luci::CircleFullyConnected>();
+    _fc->dtype(loco::DataType::FLOAT32);
+    _fc->name("fc");
+  }
+
+protected:
+  luci::CircleFullyConnected *_fc = nullptr;
+  luci::CircleConst *_weights = nullptr;
+};
+
+class FCGraph : public TestIGraphlet, public TestOGraphlet, public FCGraphlet
+{
+public:
+  FCGraph() = default;
+
+  void init(const ShapeU32 shape, const ShapeU32 wshape)
+  {
+    TestIGraphlet::init(g(), shape);
+    TestOGraphlet::init(g(), shape);
+    FCGraphlet::init(g(), wshape);
+
+    // connect graph
+    _fc->input(input());
+    _fc->weights(_weights);
+
+    output()->from(_fc);
+  }
+};
+
+} // namespace
+
+TEST(QuantizeWeightsOnlyPassTest, name)
+{
+  luci::QuantizeWeightsOnlyPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                     luci::QuantizationGranularity::ChannelWise);
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(QuantizeWeightsOnlyPassTest, name_ctx)
+{
+  auto ctx = std::make_unique<luci::QuantizeWeightsOnlyPass::Context>();
+  {
+    ctx->input_model_dtype = loco::DataType::FLOAT32;
+    ctx->output_model_dtype = loco::DataType::S8;
+    ctx->granularity = luci::QuantizationGranularity::ChannelWise;
+  }
+
+  luci::QuantizeWeightsOnlyPass pass(std::move(ctx));
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST(QuantizeWeightsOnlyPassTest, channel_wise)
+{
+  FCGraph g;
+  g.init({1, 4}, {3, 4});
+
+  luci::QuantizeWeightsOnlyPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                     luci::QuantizationGranularity::ChannelWise);
+  pass.run(g.g());
+
+  auto fc_node = luci::test::first_node<luci::CircleFullyConnected>(g.g());
+  ASSERT_NE(nullptr, fc_node);
+  auto weights = loco::must_cast<luci::CircleConst *>(fc_node->weights());
+  ASSERT_EQ(loco::DataType::S8, weights->dtype());
+  // Activation is not quantized
+  ASSERT_EQ(loco::DataType::FLOAT32, fc_node->dtype());
+
+  auto qparam = weights->quantparam();
+  ASSERT_NE(nullptr, qparam);
+  ASSERT_EQ(3, qparam->scale.size());
+  ASSERT_EQ(3, qparam->zerop.size());
+  ASSERT_EQ(0, qparam->quantized_dimension);
+  for (uint32_t c = 0; c < 3; ++c)
+  {
+    // Largest magnitude of row c is 3 * (c + 1)
+    EXPECT_FLOAT_EQ(3.0f * (c + 1) / 127.0f, qparam->scale[c]);
+    EXPECT_EQ(0, qparam->zerop[c]);
+    EXPECT_EQ(-127, weights->at<loco::DataType::S8>(c * 4 + 3));
+  }
+  EXPECT_EQ(0, weights->at<loco::DataType::S8>(0));
+}
+
+TEST(QuantizeWeightsOnlyPassTest, layer_wise)
+{
+  FCGraph g;
+  g.init({1, 4}, {3, 4});
+
+  luci::QuantizeWeightsOnlyPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                     luci::QuantizationGranularity::LayerWise);
+  pass.run(g.g());
+
+  auto fc_node = luci::test::first_node<luci::CircleFullyConnected>(g.g());
+  auto weights = loco::must_cast<luci::CircleConst *>(fc_node->weights());
+  ASSERT_EQ(loco::DataType::S8, weights->dtype());
+
+  auto qparam = weights->quantparam();
+  ASSERT_NE(nullptr, qparam);
+  ASSERT_EQ(1, qparam->scale.size());
+  EXPECT_FLOAT_EQ(9.0f / 127.0f, qparam->scale[0]);
+  EXPECT_EQ(-127, weights->at<loco::DataType::S8>(11));
+  EXPECT_EQ(-42, weights->at<loco::DataType::S8>(3));
+}
+
+TEST(QuantizeWeightsOnlyPassTest, non_const_weights_NEG)
+{
+  FCGraph g;
+  g.init({1, 4}, {3, 4});
+
+  auto fc_node = luci::test::first_node<luci::CircleFullyConnected>(g.g());
+  fc_node->weights(g.input());
+
+  luci::QuantizeWeightsOnlyPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                     luci::QuantizationGranularity::ChannelWise);
+  pass.run(g.g());
+
+  ASSERT_EQ(g.input(), fc_node->weights());
+  ASSERT_EQ(loco::DataType::FLOAT32, g.input()->dtype());
+}
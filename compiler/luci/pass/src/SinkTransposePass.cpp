@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/SinkTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+#include <set>
+#include <vector>
+
+namespace
+{
+
+using Perm = std::vector<int32_t>;
+
+/// @brief Return the permutation of a Transpose with constant perm, empty for other nodes
+Perm transpose_perm(loco::Node *node)
+{
+  auto transpose = dynamic_cast<luci::CircleTranspose *>(node);
+  if (transpose == nullptr)
+    return Perm{};
+
+  auto perm = dynamic_cast<luci::CircleConst *>(transpose->perm());
+  if (perm == nullptr or perm->dtype() != loco::DataType::S32 or perm->rank() != 1)
+    return Perm{};
+
+  Perm result;
+  for (uint32_t i = 0; i < perm->size<loco::DataType::S32>(); ++i)
+    result.push_back(perm->at<loco::DataType::S32>(i));
+  return result;
+}
+
+uint32_t num_elements(const luci::CircleConst *node)
+{
+  uint32_t num = 1;
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    num *= node->dim(i).value();
+  return num;
+}
+
+/**
+ * @brief Return a constant C' such that Transpose(C', perm) is 'node'
+ */
+template <loco::DataType DT>
+luci::CircleConst *untranspose_const(luci::CircleConst *node, const Perm &perm)
+{
+  const auto rank = node->rank();
+  assert(rank == perm.size());
+
+  auto constant = node->graph()->nodes()->create<luci::CircleConst>();
+  constant->dtype(DT);
+  constant->rank(rank);
+  for (uint32_t k = 0; k < rank; ++k)
+    constant->dim(perm[k]).set(node->dim(k).value());
+  constant->shape_status(luci::ShapeStatus::VALID);
+  constant->name(node->name() + "/Untransposed");
+  luci::add_origin(constant, luci::get_origin(node));
+
+  std::vector<uint32_t> strides(rank, 1);
+  for (int32_t k = static_cast<int32_t>(rank) - 2; k >= 0; --k)
+    strides[k] = strides[k + 1] * node->dim(k + 1).value();
+
+  const auto num = num_elements(node);
+  constant->size<DT>(num);
+  std::vector<uint32_t> index(rank, 0);
+  for (uint32_t o = 0; o < num; ++o)
+  {
+    // 'index' is the index of 'o' in 'constant', whose dim P[k] is dim k of 'node'
+    uint32_t offset = 0;
+    for (uint32_t k = 0; k < rank; ++k)
+      offset += index[perm[k]] * strides[k];
+    constant->at<DT>(o) = node->at<DT>(offset);
+
+    for (int32_t d = static_cast<int32_t>(rank) - 1; d >= 0; --d)
+    {
+      if (++index[d] < constant->dim(d).value())
+        break;
+      index[d] = 0;
+    }
+  }
+  return constant;
+}
+
+/**
+ * @brief Transposes with the same permutation that feed a layout agnostic node
+ */
+class SinkContext
+{
+public:
+  /**
+   * @brief Collect the Transposes of the data inputs of a node
+   * @return false if some input is neither a Transpose of the same permutation nor a constant
+   *         that can be untransposed, or if no Transpose would be removed
+   */
+  bool collect(const std::vector<loco::Node *> &inputs)
+  {
+    for (auto input : inputs)
+    {
+      const auto perm = transpose_perm(input);
+      if (not perm.empty())
+      {
+        if (not _perm.empty() and perm != _perm)
+          return false;
+        _perm = perm;
+        _transposes.insert(loco::must_cast<luci::CircleTranspose *>(input));
+      }
+      else if (dynamic_cast<luci::CircleConst *>(input) == nullptr)
+        return false;
+    }
+    if (_transposes.empty())
+      return false;
+
+    for (auto input : inputs)
+    {
+      auto constant = dynamic_cast<luci::CircleConst *>(input);
+      if (constant == nullptr or num_elements(constant) == 1)
+        continue;
+      if (constant->rank() != _perm.size())
+        return false;
+      if (constant->dtype() != loco::DataType::FLOAT32 and
+          constant->dtype() != loco::DataType::S32)
+        return false;
+    }
+
+    // Sinking adds a Transpose below the node, so at least one above must die
+    for (auto transpose : _transposes)
+    {
+      if (loco::succs(transpose).size() == 1)
+        return true;
+    }
+    return false;
+  }
+
+  const Perm &perm() const { return _perm; }
+
+  /// @brief Return the axis of the input of Transposes for 'axis' of their output
+  int32_t axis(int32_t axis) const
+  {
+    const auto rank = static_cast<int32_t>(_perm.size());
+    return _perm.at(axis < 0 ? axis + rank : axis);
+  }
+
+  /// @brief Return the node to connect instead of an input collected before
+  loco::Node *untranspose(loco::Node *input) const
+  {
+    if (auto transpose = dynamic_cast<luci::CircleTranspose *>(input))
+      return transpose->a();
+
+    auto constant = loco::must_cast<luci::CircleConst *>(input);
+    if (num_elements(constant) == 1)
+      return constant;
+    if (constant->dtype() == loco::DataType::FLOAT32)
+      return untranspose_const<loco::DataType::FLOAT32>(constant, _perm);
+    return untranspose_const<loco::DataType::S32>(constant, _perm);
+  }
+
+  /**
+   *  BEFORE
+   *              |
+   *          [CircleNode]
+   *              |
+   *
+   *  AFTER
+   *              |
+   *          [CircleNode]
+   *              |
+   *        [CircleTranspose]
+   *              |
+   */
+  void insert_transpose(luci::CircleNode *node) const
+  {
+    auto transpose = node->graph()->nodes()->create<luci::CircleTranspose>();
+    transpose->dtype(node->dtype());
+    transpose->rank(node->rank());
+    for (uint32_t i = 0; i < node->rank(); ++i)
+      transpose->dim(i) = node->dim(i);
+    transpose->shape_status(node->shape_status());
+    transpose->name(node->name() + "/Transpose");
+    luci::add_origin(transpose, luci::get_origin(node));
+
+    loco::replace(node).with(transpose);
+    transpose->a(node);
+    transpose->perm((*_transposes.begin())->perm());
+
+    // The node now produces the input layout of the Transposes
+    if (node->rank() == _perm.size())
+    {
+      for (uint32_t k = 0; k < _perm.size(); ++k)
+        node->dim(_perm[k]) = transpose->dim(k);
+    }
+  }
+
+private:
+  Perm _perm;
+  std::set<luci::CircleTranspose *> _transposes;
+};
+
+luci::CircleConst *remap_paddings(luci::CircleConst *paddings, const SinkContext &ctx)
+{
+  auto constant = paddings->graph()->nodes()->create<luci::CircleConst>();
+  constant->dtype(loco::DataType::S32);
+  constant->shape({paddings->dim(0).value(), 2});
+  constant->shape_status(luci::ShapeStatus::VALID);
+  constant->size<loco::DataType::S32>(paddings->size<loco::DataType::S32>());
+  for (uint32_t i = 0; i < paddings->dim(0).value(); ++i)
+  {
+    const auto axis = ctx.axis(i);
+    constant->at<loco::DataType::S32>(axis * 2) = paddings->at<loco::DataType::S32>(i * 2);
+    constant->at<loco::DataType::S32>(axis * 2 + 1) = paddings->at<loco::DataType::S32>(i * 2 + 1);
+  }
+  constant->name(paddings->name() + "/Untransposed");
+  luci::add_origin(constant, luci::get_origin(paddings));
+  return constant;
+}
+
+luci::CircleConst *remap_axes(luci::CircleConst *axes, const SinkContext &ctx)
+{
+  auto constant = axes->graph()->nodes()->create<luci::CircleConst>();
+  constant->dtype(loco::DataType::S32);
+  constant->rank(axes->rank());
+  for (uint32_t i = 0; i < axes->rank(); ++i)
+    constant->dim(i) = axes->dim(i);
+  constant->shape_status(luci::ShapeStatus::VALID);
+  constant->size<loco::DataType::S32>(axes->size<loco::DataType::S32>());
+  for (uint32_t i = 0; i < axes->size<loco::DataType::S32>(); ++i)
+    constant->at<loco::DataType::S32>(i) = ctx.axis(axes->at<loco::DataType::S32>(i));
+  constant->name(axes->name() + "/Untransposed");
+  luci::add_origin(constant, luci::get_origin(axes));
+  return constant;
+}
+
+bool is_paddings(const loco::Node *node, uint32_t rank)
+{
+  auto paddings = dynamic_cast<const luci::CircleConst *>(node);
+  return paddings != nullptr and paddings->dtype() == loco::DataType::S32 and
+         paddings->rank() == 2 and paddings->dim(0).value() == rank and
+         paddings->dim(1).value() == 2;
+}
+
+class SinkTranspose final : public luci::CircleNodeMutableVisitor<bool>
+{
+public:
+  bool visit(luci::CircleNode *) final { return false; }
+
+  // Elementwise unary
+  bool visit(luci::CircleAbs *node) final { return sink_x(node); }
+  bool visit(luci::CircleCast *node) final { return sink_x(node); }
+  bool visit(luci::CircleExp *node) final { return sink_x(node); }
+  bool visit(luci::CircleFloor *node) final { return sink_x(node); }
+  bool visit(luci::CircleLog *node) final { return sink_x(node); }
+  bool visit(luci::CircleLogistic *node) final { return sink_x(node); }
+  bool visit(luci::CircleNeg *node) final { return sink_x(node); }
+  bool visit(luci::CircleRsqrt *node) final { return sink_x(node); }
+  bool visit(luci::CircleSqrt *node) final { return sink_x(node); }
+  bool visit(luci::CircleSquare *node) final { return sink_x(node); }
+  bool visit(luci::CircleTanh *node) final { return sink_x(node); }
+
+  bool visit(luci::CircleElu *node) final { return sink_features(node); }
+  bool visit(luci::CircleGelu *node) final { return sink_features(node); }
+  bool visit(luci::CircleHardSwish *node) final { return sink_features(node); }
+  bool visit(luci::CircleLeakyRelu *node) final { return sink_features(node); }
+  bool visit(luci::CircleRelu *node) final { return sink_features(node); }
+  bool visit(luci::CircleRelu6 *node) final { return sink_features(node); }
+  bool visit(luci::CircleReluN1To1 *node) final { return sink_features(node); }
+
+  // Elementwise binary
+  bool visit(luci::CircleAdd *node) final { return sink_xy(node); }
+  bool visit(luci::CircleDiv *node) final { return sink_xy(node); }
+  bool visit(luci::CircleMaximum *node) final { return sink_xy(node); }
+  bool visit(luci::CircleMinimum *node) final { return sink_xy(node); }
+  bool visit(luci::CircleMul *node) final { return sink_xy(node); }
+  bool visit(luci::CirclePow *node) final { return sink_xy(node); }
+  bool visit(luci::CircleSquaredDifference *node) final { return sink_xy(node); }
+  bool visit(luci::CircleSub *node) final { return sink_xy(node); }
+
+  bool visit(luci::CircleConcatenation *node) final
+  {
+    std::vector<loco::Node *> inputs;
+    for (uint32_t i = 0; i < node->numValues(); ++i)
+      inputs.push_back(node->values(i));
+
+    SinkContext ctx;
+    if (not ctx.collect(inputs))
+      return false;
+
+    for (uint32_t i = 0; i < node->numValues(); ++i)
+      node->values(i, ctx.untranspose(node->values(i)));
+    node->axis(ctx.axis(node->axis()));
+    ctx.insert_transpose(node);
+    return true;
+  }
+
+  // Pad
+  bool visit(luci::CircleMirrorPad *node) final { return sink_pad(node); }
+  bool visit(luci::CirclePad *node) final { return sink_pad(node); }
+  bool visit(luci::CirclePadV2 *node) final { return sink_pad(node); }
+
+  // Reduce
+  bool visit(luci::CircleMean *node) final { return sink_reduce(node); }
+  bool visit(luci::CircleReduceMax *node) final { return sink_reduce(node); }
+  bool visit(luci::CircleReduceMin *node) final { return sink_reduce(node); }
+  bool visit(luci::CircleReduceProd *node) final { return sink_reduce(node); }
+  bool visit(luci::CircleSum *node) final { return sink_reduce(node); }
+
+private:
+  template <class T> bool sink_x(T *node)
+  {
+    SinkContext ctx;
+    if (not ctx.collect({node->x()}))
+      return false;
+
+    node->x(ctx.untranspose(node->x()));
+    ctx.insert_transpose(node);
+    return true;
+  }
+
+  template <class T> bool sink_features(T *node)
+  {
+    SinkContext ctx;
+    if (not ctx.collect({node->features()}))
+      return false;
+
+    node->features(ctx.untranspose(node->features()));
+    ctx.insert_transpose(node);
+    return true;
+  }
+
+  template <class T> bool sink_xy(T *node)
+  {
+    SinkContext ctx;
+    if (not ctx.collect({node->x(), node->y()}))
+      return false;
+
+    node->x(ctx.untranspose(node->x()));
+    node->y(ctx.untranspose(node->y()));
+    ctx.insert_transpose(node);
+    return true;
+  }
+
+  template <class T> bool sink_pad(T *node)
+  {
+    SinkContext ctx;
+    if (not ctx.collect({node->input()}))
+      return false;
+    if (not is_paddings(node->paddings(), ctx.perm().size()))
+      return false;
+
+    node->input(ctx.untranspose(node->input()));
+    node->paddings(remap_paddings(loco::must_cast<luci::CircleConst *>(node->paddings()), ctx));
+    ctx.insert_transpose(node);
+    return true;
+  }
+
+  template <class T> bool sink_reduce(T *node)
+  {
+    // Reduced axes are removed without keep_dims, which changes the permutation
+    if (not node->keep_dims())
+      return false;
+
+    auto axes = dynamic_cast<luci::CircleConst *>(node->reduction_indices());
+    if (axes == nullptr or axes->dtype() != loco::DataType::S32)
+      return false;
+
+    SinkContext ctx;
+    if (not ctx.collect({node->input()}))
+      return false;
+
+    node->input(ctx.untranspose(node->input()));
+    node->reduction_indices(remap_axes(axes, ctx));
+    ctx.insert_transpose(node);
+    return true;
+  }
+};
+
+} // namespace
+
+namespace luci
+{
+
+/**
+ *  BEFORE
+ *
+ *       [CircleNode]     [CircleConst]
+ *             |               |
+ *      [CircleTranspose] [CircleConst]
+ *                 \        /
+ *                 [CircleAdd]
+ *                     |
+ *      [CircleTranspose](inverse)
+ *                     |
+ *
+ *  AFTER
+ *
+ *       [CircleNode] [CircleConst](untransposed)
+ *                 \        /
+ *                 [CircleAdd]
+ *                     |
+ *             [CircleTranspose]
+ *                     |
+ *      [CircleTranspose](inverse)
+ *                     |
+ *
+ *  Moving Transposes down through layout agnostic operators one at a time propagates layouts
+ *  over the graph, until a Transpose meets its inverse or an operator that depends on layout.
+ */
+bool SinkTransposePass::run(loco::Graph *g)
+{
+  bool changed = false;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    SinkTranspose sink;
+    if (circle_node->accept(&sink))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
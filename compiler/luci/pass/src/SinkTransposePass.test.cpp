@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/SinkTransposePass.h"
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::CircleConst *create_perm(loco::Graph *g, const std::vector<int32_t> &perm)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::S32);
+  node->shape({static_cast<uint32_t>(perm.size())});
+  node->size<loco::DataType::S32>(perm.size());
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    node->at<loco::DataType::S32>(i) = perm[i];
+  node->name("perm");
+  return node;
+}
+
+luci::CircleTranspose *create_transpose(loco::Graph *g, loco::Node *a,
+                                        const std::vector<int32_t> &perm)
+{
+  auto node = g->nodes()->create<luci::CircleTranspose>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->a(a);
+  node->perm(create_perm(g, perm));
+  node->name("transpose");
+  return node;
+}
+
+/**
+ *  Graph with an NCHW input converted to NHWC around a layout agnostic operator
+ *
+ *        [CircleInput] (NCHW)
+ *              |
+ *      [CircleTranspose] (0, 2, 3, 1)
+ *              |
+ *         [CircleXXX]
+ *              |
+ *      [CircleTranspose] (0, 3, 1, 2)
+ *              |
+ *        [CircleOutput]
+ */
+class SinkTransposeGraph
+{
+public:
+  SinkTransposeGraph()
+  {
+    _input = _g.nodes()->create<luci::CircleInput>();
+    _input->dtype(loco::DataType::FLOAT32);
+    _input->shape({1, 3, 2, 2});
+    _input->index(_g.inputs()->create()->index());
+    _input->name("input");
+
+    _pre = create_transpose(&_g, _input, {0, 2, 3, 1});
+    _pre->shape({1, 2, 2, 3});
+
+    _output = _g.nodes()->create<luci::CircleOutput>();
+    _output->dtype(loco::DataType::FLOAT32);
+    _output->index(_g.outputs()->create()->index());
+    _output->name("output");
+  }
+
+  void connect(luci::CircleNode *node)
+  {
+    _post = create_transpose(&_g, node, {0, 3, 1, 2});
+    _output->from(_post);
+  }
+
+  void run()
+  {
+    luci::SinkTransposePass sink;
+    luci::RemoveRedundantTransposePass remove;
+    while (sink.run(&_g) or remove.run(&_g))
+      ;
+  }
+
+protected:
+  loco::Graph _g;
+  luci::CircleInput *_input = nullptr;
+  luci::CircleTranspose *_pre = nullptr;
+  luci::CircleTranspose *_post = nullptr;
+  luci::CircleOutput *_output = nullptr;
+};
+
+class SinkTransposePassTest : public SinkTransposeGraph, public ::testing::Test
+{
+};
+
+} // namespace
+
+TEST(SinkTransposePass, name)
+{
+  luci::SinkTransposePass pass;
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(SinkTransposePassTest, unary)
+{
+  auto relu = _g.nodes()->create<luci::CircleRelu>();
+  relu->dtype(loco::DataType::FLOAT32);
+  relu->shape({1, 2, 2, 3});
+  relu->features(_pre);
+  relu->name("relu");
+  connect(relu);
+
+  run();
+
+  ASSERT_EQ(relu, _output->from());
+  ASSERT_EQ(_input, relu->features());
+  ASSERT_EQ(3, relu->dim(1).value());
+}
+
+TEST_F(SinkTransposePassTest, binary_with_const)
+{
+  // Per-channel constant of NHWC
+  auto bias = _g.nodes()->create<luci::CircleConst>();
+  bias->dtype(loco::DataType::FLOAT32);
+  bias->shape({1, 1, 1, 3});
+  bias->size<loco::DataType::FLOAT32>(3);
+  for (uint32_t i = 0; i < 3; ++i)
+    bias->at<loco::DataType::FLOAT32>(i) = i;
+  bias->name("bias");
+
+  auto add = _g.nodes()->create<luci::CircleAdd>();
+  add->dtype(loco::DataType::FLOAT32);
+  add->shape({1, 2, 2, 3});
+  add->x(_pre);
+  add->y(bias);
+  add->name("add");
+  connect(add);
+
+  run();
+
+  ASSERT_EQ(add, _output->from());
+  ASSERT_EQ(_input, add->x());
+  auto nchw_bias = dynamic_cast<luci::CircleConst *>(add->y());
+  ASSERT_NE(nullptr, nchw_bias);
+  ASSERT_EQ(3, nchw_bias->dim(1).value());
+  ASSERT_EQ(1, nchw_bias->dim(3).value());
+  ASSERT_FLOAT_EQ(2, nchw_bias->at<loco::DataType::FLOAT32>(2));
+}
+
+TEST_F(SinkTransposePassTest, concat_axis)
+{
+  auto concat = _g.nodes()->create<luci::CircleConcatenation>(2);
+  concat->dtype(loco::DataType::FLOAT32);
+  concat->shape({1, 2, 2, 6});
+  concat->values(0, _pre);
+  concat->values(1, _pre);
+  concat->axis(-1);
+  concat->fusedActivationFunction(luci::FusedActFunc::NONE);
+  concat->name("concat");
+  connect(concat);
+
+  run();
+
+  ASSERT_EQ(concat, _output->from());
+  ASSERT_EQ(_input, concat->values(0));
+  ASSERT_EQ(1, concat->axis());
+}
+
+TEST_F(SinkTransposePassTest, shared_transpose_NEG)
+{
+  // The Transpose is still needed by the other user
+  auto relu = _g.nodes()->create<luci::CircleRelu>();
+  relu->dtype(loco::DataType::FLOAT32);
+  relu->features(_pre);
+  relu->name("relu");
+  connect(relu);
+
+  auto output = _g.nodes()->create<luci::CircleOutput>();
+  output->from(_pre);
+  output->index(_g.outputs()->create()->index());
+  output->name("output2");
+
+  luci::SinkTransposePass pass;
+  ASSERT_FALSE(pass.run(&_g));
+}
+
+TEST_F(SinkTransposePassTest, reduce_without_keep_dims_NEG)
+{
+  auto axes = create_perm(&_g, {1, 2});
+  auto mean = _g.nodes()->create<luci::CircleMean>();
+  mean->dtype(loco::DataType::FLOAT32);
+  mean->input(_pre);
+  mean->reduction_indices(axes);
+  mean->keep_dims(false);
+  mean->name("mean");
+  _output->from(mean);
+
+  luci::SinkTransposePass pass;
+  ASSERT_FALSE(pass.run(&_g));
+}
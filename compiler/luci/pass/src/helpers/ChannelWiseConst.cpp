@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ChannelWiseConst.h"
+
+namespace luci
+{
+
+std::vector<float> channel_wise_values(const luci::CircleConst *node,
+                                       const luci::CircleNode *producer, uint32_t channels)
+{
+  if (node == nullptr or node->dtype() != loco::DataType::FLOAT32)
+    return {};
+  if (node->rank() > producer->rank())
+    return {};
+
+  const auto size = node->size<loco::DataType::FLOAT32>();
+  if (size == 1)
+    return std::vector<float>(channels, node->at<loco::DataType::FLOAT32>(0));
+
+  const auto rank = node->rank();
+  if (rank == 0 or node->dim(rank - 1).value() != channels)
+    return {};
+  for (uint32_t i = 0; i + 1 < rank; ++i)
+  {
+    if (node->dim(i).value() != 1)
+      return {};
+  }
+
+  std::vector<float> values(channels);
+  for (uint32_t c = 0; c < channels; ++c)
+    values[c] = node->at<loco::DataType::FLOAT32>(c);
+  return values;
+}
+
+bool bias_values(const loco::Node *bias, uint32_t channels, std::vector<float> &values)
+{
+  if (dynamic_cast<const luci::CircleOutputExclude *>(bias) != nullptr)
+  {
+    values.assign(channels, 0.0f);
+    return true;
+  }
+
+  auto const_bias = dynamic_cast<const luci::CircleConst *>(bias);
+  if (const_bias == nullptr or const_bias->dtype() != loco::DataType::FLOAT32)
+    return false;
+  if (const_bias->size<loco::DataType::FLOAT32>() != channels)
+    return false;
+
+  values.resize(channels);
+  for (uint32_t c = 0; c < channels; ++c)
+    values[c] = const_bias->at<loco::DataType::FLOAT32>(c);
+  return true;
+}
+
+luci::CircleConst *create_bias(loco::Graph *g, const std::vector<float> &values,
+                               const std::string &name)
+{
+  auto bias = g->nodes()->create<luci::CircleConst>();
+  bias->dtype(loco::DataType::FLOAT32);
+  bias->rank(1);
+  bias->dim(0).set(values.size());
+  bias->shape_status(luci::ShapeStatus::VALID);
+  bias->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t c = 0; c < values.size(); ++c)
+    bias->at<loco::DataType::FLOAT32>(c) = values[c];
+  bias->name(name);
+  return bias;
+}
+
+} // namespace luci
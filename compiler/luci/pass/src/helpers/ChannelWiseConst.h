@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PASS_HELPERS_CHANNEL_WISE_CONST_H__
+#define __LUCI_PASS_HELPERS_CHANNEL_WISE_CONST_H__
+
+#include <luci/IR/CircleNodes.h>
+
+#include <string>
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief Return the constant operand of a binary node whose other operand is 'pred'
+ */
+template <class BINARY> luci::CircleConst *const_operand(BINARY *node, const loco::Node *pred)
+{
+  if (node->x() == pred)
+    return dynamic_cast<luci::CircleConst *>(node->y());
+  if (node->y() == pred)
+    return dynamic_cast<luci::CircleConst *>(node->x());
+  return nullptr;
+}
+
+/**
+ * @brief Return the values of a constant for each of 'channels' channels of the last dimension,
+ *        or an empty vector if the constant is not channel-wise to 'producer'
+ *
+ * @note  A constant is channel-wise if it is a FLOAT32 scalar, or if its last dimension is
+ *        'channels' and others are 1. Its rank must not exceed the rank of 'producer', as
+ *        broadcasting would then change the shape of the output.
+ */
+std::vector<float> channel_wise_values(const luci::CircleConst *node,
+                                       const luci::CircleNode *producer, uint32_t channels);
+
+/**
+ * @brief Get the values of a bias of 'channels' channels, which are 0 for CircleOutputExclude
+ * @return false if the bias is neither a FLOAT32 constant of 'channels' nor CircleOutputExclude
+ */
+bool bias_values(const loco::Node *bias, uint32_t channels, std::vector<float> &values);
+
+/**
+ * @brief Create a FLOAT32 constant of rank 1 in 'g'
+ */
+luci::CircleConst *create_bias(loco::Graph *g, const std::vector<float> &values,
+                               const std::string &name);
+
+} // namespace luci
+
+#endif // __LUCI_PASS_HELPERS_CHANNEL_WISE_CONST_H__
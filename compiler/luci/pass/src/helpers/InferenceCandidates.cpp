@@ -18,17 +18,22 @@
 
 #include <luci/IR/DeadNodeQueryService.h>
 
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace luci
 {
 
 std::vector<loco::Node *> inference_candidates(loco::Graph *g)
 {
   auto candidates = loco::postorder_traversal(loco::output_nodes(g));
+  const std::unordered_set<loco::Node *> reachable(candidates.begin(), candidates.end());
 
   for (auto node : loco::all_nodes(g))
   {
     // already included as candidate
-    if (std::find(candidates.begin(), candidates.end(), node) != candidates.end())
+    if (reachable.find(node) != reachable.end())
       continue;
 
     // As the node is not used for both graph output and multiple output operation,
@@ -42,4 +47,40 @@ std::vector<loco::Node *> inference_candidates(loco::Graph *g)
   return candidates;
 }
 
+bool infer_candidates_from(loco::Graph *g, const std::vector<loco::Node *> &nodes,
+                           const std::function<bool(loco::Node *)> &infer)
+{
+  const auto candidates = inference_candidates(g);
+  std::unordered_map<loco::Node *, size_t> order;
+  for (size_t i = 0; i < candidates.size(); ++i)
+    order.emplace(candidates[i], i);
+
+  // Nodes to infer by their order, where inputs of a node come before it
+  std::set<size_t> worklist;
+  auto enqueue = [&](loco::Node *node) {
+    auto found = order.find(node);
+    if (found != order.end())
+      worklist.insert(found->second);
+  };
+
+  for (auto node : nodes)
+    enqueue(node);
+
+  bool changed = false;
+  while (!worklist.empty())
+  {
+    auto node = candidates[*worklist.begin()];
+    worklist.erase(worklist.begin());
+
+    if (infer(node))
+    {
+      changed = true;
+      for (auto succ : loco::succs(node))
+        enqueue(succ);
+    }
+  }
+
+  return changed;
+}
+
 } // namespace luci
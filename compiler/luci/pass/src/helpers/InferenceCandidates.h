@@ -19,6 +19,7 @@
 
 #include <loco.h>
 
+#include <functional>
 #include <vector>
 
 namespace luci
@@ -29,6 +30,16 @@ namespace luci
  */
 std::vector<loco::Node *> inference_candidates(loco::Graph *g);
 
+/**
+ * @brief Infer the given candidates, and the successors of the nodes whose inference changed them,
+ *        in the order of inference_candidates()
+ *
+ * @param infer Function to infer a node, which returns true if the node is changed
+ * @return true if any node is changed
+ */
+bool infer_candidates_from(loco::Graph *g, const std::vector<loco::Node *> &nodes,
+                           const std::function<bool(loco::Node *)> &infer);
+
 } // namespace luci
 
 #endif // __LUCI_INFERENCE_CANDIDATES_H__
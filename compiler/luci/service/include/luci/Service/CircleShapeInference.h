@@ -79,6 +79,7 @@ public:
   // loco::TensorShape visit(const luci::CircleGatherNd *node) final;
   // loco::TensorShape visit(const luci::CircleGreater *node) final;
   // loco::TensorShape visit(const luci::CircleGreaterEqual *node) final;
+  // loco::TensorShape visit(const luci::CircleHardSwish *node) final;
   // loco::TensorShape visit(const luci::CircleIf *node) final;
   // loco::TensorShape visit(const luci::CircleL2Normalize *node) final;
   // loco::TensorShape visit(const luci::CircleL2Pool2D *node) final;
@@ -162,7 +163,9 @@ public:
   // Circle Only
   // loco::TensorShape visit(const luci::CircleBCQFullyConnected *node) final;
   // loco::TensorShape visit(const luci::CircleBCQGather *node) final;
+  // loco::TensorShape visit(const luci::CircleGelu *node) final;
   // loco::TensorShape visit(const luci::CircleInstanceNorm *node) final;
+  // loco::TensorShape visit(const luci::CircleLayerNorm *node) final;
 
   // Virtual
   // loco::TensorShape visit(const luci::CircleCustomOut *node) final;
@@ -78,6 +78,7 @@ public:
   // loco::DataType visit(const luci::CircleGatherNd *node) final;
   // loco::DataType visit(const luci::CircleGreater *node) final;
   // loco::DataType visit(const luci::CircleGreaterEqual *node) final;
+  // loco::DataType visit(const luci::CircleHardSwish *node) final;
   // loco::DataType visit(const luci::CircleIf *node) final;
   // loco::DataType visit(const luci::CircleL2Normalize *node) final;
   // loco::DataType visit(const luci::CircleL2Pool2D *node) final;
@@ -161,7 +162,9 @@ public:
   // Circle Only
   // loco::DataType visit(const luci::CircleBCQFullyConnected *node) final;
   // loco::DataType visit(const luci::CircleBCQGather *node) final;
+  // loco::DataType visit(const luci::CircleGelu *node) final;
   // loco::DataType visit(const luci::CircleInstanceNorm *node) final;
+  // loco::DataType visit(const luci::CircleLayerNorm *node) final;
 
   // Virtual
   // loco::DataType visit(const luci::CircleInput *node) final;
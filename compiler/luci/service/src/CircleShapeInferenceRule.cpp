@@ -2109,6 +2109,13 @@ public:
 
   loco::NodeShape visit(const luci::CircleGreaterEqual *node) final { return broadcast_xy(node); }
 
+  loco::NodeShape visit(const luci::CircleHardSwish *node) final
+  {
+    auto input_shape = luci::shape_get(node->features()).as<loco::TensorShape>();
+
+    return loco::NodeShape{input_shape};
+  }
+
   loco::NodeShape visit(const luci::CircleIf *node) final
   {
     // Shape of CircleIf is not used. Just use input 0
@@ -2436,6 +2443,13 @@ public:
 
   loco::NodeShape visit(const luci::CircleBCQGather *node) final { return infer_bcq_gather(node); }
 
+  loco::NodeShape visit(const luci::CircleGelu *node) final
+  {
+    auto input_shape = luci::shape_get(node->features()).as<loco::TensorShape>();
+
+    return loco::NodeShape{input_shape};
+  }
+
   loco::NodeShape visit(const luci::CircleInstanceNorm *node) final
   {
     auto input_shape = luci::shape_get(node->input()).as<loco::TensorShape>();
@@ -2443,6 +2457,13 @@ public:
     return loco::NodeShape{input_shape};
   }
 
+  loco::NodeShape visit(const luci::CircleLayerNorm *node) final
+  {
+    auto input_shape = luci::shape_get(node->input()).as<loco::TensorShape>();
+
+    return loco::NodeShape{input_shape};
+  }
+
   // Virtual
   loco::NodeShape visit(const luci::CircleInput *node) final { return infer_input(node); }
 
@@ -171,6 +171,11 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
 
   loco::DataType visit(const luci::CircleGreaterEqual *) final { return loco::DataType::BOOL; }
 
+  loco::DataType visit(const luci::CircleHardSwish *node) final
+  {
+    return luci::dtype_get(node->features());
+  }
+
   loco::DataType visit(const luci::CircleIf *node) final
   {
     // Type of If is not used. Just use input 0
@@ -542,11 +547,21 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
 
   loco::DataType visit(const luci::CircleBCQGather *) final { return loco::DataType::FLOAT32; }
 
+  loco::DataType visit(const luci::CircleGelu *node) final
+  {
+    return luci::dtype_get(node->features());
+  }
+
   loco::DataType visit(const luci::CircleInstanceNorm *node) final
   {
     return luci::dtype_get(node->input());
   }
 
+  loco::DataType visit(const luci::CircleLayerNorm *node) final
+  {
+    return luci::dtype_get(node->input());
+  }
+
   // Virtual
   loco::DataType visit(const luci::CircleInput *node) final { return node->dtype(); }
 
@@ -21,6 +21,8 @@
 #include "mir/ShapeRange.h"
 #include "mir/Tensor.h"
 
+#include <algorithm>
+
 namespace mir_interpreter
 {
 
@@ -52,42 +54,62 @@ void AvgPool2DImpl<T>::run(const ops::AvgPool2DOp &op, const TensorVariant &inpu
   assert(padding_before.size() == num_spatial_dims);
   assert(padding_after.size() == num_spatial_dims);
 
-  Tensor<T> res_accessor(output);
-  Tensor<T> input(input_var);
-
-  ShapeRange in_range(input_shape);
-  Index in_index(input_shape.rank());
-
-  for (const auto &out_index : ShapeRange(output_shape))
-  {
-    T result = 0;
-    size_t num_elements = 0;
+  const int32_t input_height = input_shape.dim(1);
+  const int32_t input_width = input_shape.dim(2);
+  const int32_t num_channels = input_shape.dim(3);
+  const int32_t output_height = output_shape.dim(1);
+  const int32_t output_width = output_shape.dim(2);
+  const int32_t window_height = window_size[0];
+  const int32_t window_width = window_size[1];
 
-    // Assuming NHWC format.
-    in_index.at(0) = out_index.at(0);
-    in_index.at(3) = out_index.at(3);
+  const auto *input_data = reinterpret_cast<const T *>(input_var.atOffset(0));
+  auto *output_data = reinterpret_cast<T *>(output.atOffset(0));
 
-    for (const auto &window_index : ShapeRange(Shape(window_size)))
+  // Each thread computes rows of output, over all channels of a pixel at once
+  auto run_rows = [&](int32_t begin, int32_t end) {
+    for (int32_t row = begin; row < end; ++row)
     {
       // Assuming NHWC format.
-      for (int i = 0; i < num_spatial_dims; ++i)
-        in_index.at(1 + i) =
-          out_index.at(1 + i) * strides[i] + window_index.at(i) - padding_before[i];
+      const int32_t batch = row / output_height;
+      const int32_t out_y = row % output_height;
+      const int32_t in_y_origin = out_y * strides[0] - padding_before[0];
+      const int32_t window_y_begin = std::max(0, -in_y_origin);
+      const int32_t window_y_end = std::min(window_height, input_height - in_y_origin);
 
-      if (in_range.contains(in_index))
+      for (int32_t out_x = 0; out_x < output_width; ++out_x)
       {
-        num_elements++;
-        result += input.at(in_index);
-      }
-      else if (op.getIncludePad())
-      {
-        num_elements++;
+        const int32_t in_x_origin = out_x * strides[1] - padding_before[1];
+        const int32_t window_x_begin = std::max(0, -in_x_origin);
+        const int32_t window_x_end = std::min(window_width, input_width - in_x_origin);
+        T *out =
+          output_data + ((batch * output_height + out_y) * output_width + out_x) * num_channels;
+        std::fill(out, out + num_channels, T{0});
+
+        size_t num_elements = 0;
+        for (int32_t window_y = window_y_begin; window_y < window_y_end; ++window_y)
+        {
+          for (int32_t window_x = window_x_begin; window_x < window_x_end; ++window_x)
+          {
+            const int32_t in_y = in_y_origin + window_y;
+            const int32_t in_x = in_x_origin + window_x;
+            const T *in =
+              input_data + ((batch * input_height + in_y) * input_width + in_x) * num_channels;
+            for (int32_t c = 0; c < num_channels; ++c)
+              out[c] += in[c];
+            num_elements++;
+          }
+        }
+        if (op.getIncludePad())
+          num_elements = static_cast<size_t>(window_height) * window_width;
+
+        for (int32_t c = 0; c < num_channels; ++c)
+          out[c] /= num_elements;
       }
     }
-
-    result /= num_elements;
-    res_accessor.at(out_index) = result;
-  }
+  };
+  parallelFor(output_shape.dim(0) * output_height,
+              static_cast<int64_t>(output_width) * num_channels * window_height * window_width,
+              run_rows);
 }
 
 template <> struct AvgPool2DImpl<uint8_t>
@@ -18,6 +18,11 @@
 
 #include "Common.h"
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
 namespace mir_interpreter
 {
 
@@ -34,4 +39,48 @@ Index shift(const Index &in_index, const Shape &shift_from)
   return index;
 }
 
+void parallelFor(int32_t size, int64_t cost_per_item,
+                 const std::function<void(int32_t, int32_t)> &fn)
+{
+  // Work of a thread at least, so that starting it costs much less than the work
+  constexpr int64_t min_cost_per_thread = 1 << 16;
+
+  const int64_t total_cost = static_cast<int64_t>(size) * std::max<int64_t>(cost_per_item, 1);
+  const auto max_threads = static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency()));
+  const auto num_threads = static_cast<int32_t>(
+    std::min({max_threads, total_cost / min_cost_per_thread, static_cast<int64_t>(size)}));
+  if (num_threads <= 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  std::vector<std::exception_ptr> errors(num_threads);
+  threads.reserve(num_threads - 1);
+  auto run_range = [&](int32_t t) {
+    const auto begin = static_cast<int32_t>(static_cast<int64_t>(size) * t / num_threads);
+    const auto end = static_cast<int32_t>(static_cast<int64_t>(size) * (t + 1) / num_threads);
+    try
+    {
+      fn(begin, end);
+    }
+    catch (...)
+    {
+      errors[t] = std::current_exception();
+    }
+  };
+  for (int32_t t = 1; t < num_threads; ++t)
+    threads.emplace_back(run_range, t);
+  run_range(0);
+  for (auto &thread : threads)
+    thread.join();
+
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
 } // namespace mir_interpreter
@@ -23,6 +23,9 @@
 #include "mir/Shape.h"
 #include "mir/Index.h"
 
+#include <cstdint>
+#include <functional>
+
 namespace mir_interpreter
 {
 
@@ -60,6 +63,15 @@ template <typename T> void erase(mir::TensorVariant &tv)
 
 mir::Index shift(const mir::Index &in_index, const mir::Shape &shift_from);
 
+/**
+ * @brief Splits [0, size) into contiguous ranges and runs fn(begin, end) of them on threads
+ * @param cost_per_item Estimated number of multiply-adds per item, so that small ops stay on the
+ *                      calling thread
+ * @note  fn must write disjoint parts of output for different items
+ */
+void parallelFor(int32_t size, int64_t cost_per_item,
+                 const std::function<void(int32_t, int32_t)> &fn);
+
 } // namespace mir_interpreter
 
 #endif // _NNC_CORE_BACKEND_INTERPRETER_COMMON_
@@ -21,6 +21,7 @@
 
 #include "mir/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace mir_interpreter
@@ -79,55 +80,77 @@ void Conv2DImpl<T>::run(const TensorVariant &input, const TensorVariant &kernel,
   assert(kernel_shape.dim(3) == in_group_size);
   assert(kernel_shape.dim(0) == num_out_channels);
 
-  for (std::int32_t batch = 0; batch < batch_size; ++batch)
-  {
-    for (std::int32_t out_y = 0; out_y < output_height; ++out_y)
+  // Output channels computed together from the same loads of input
+  constexpr std::int32_t channel_block = 4;
+  const std::int32_t kernel_size = kernel_height * kernel_width * in_group_size;
+
+  // Each thread computes rows of output, channels of an output pixel are computed in blocks
+  auto run_rows = [&](std::int32_t begin, std::int32_t end) {
+    for (std::int32_t row = begin; row < end; ++row)
     {
+      const std::int32_t batch = row / output_height;
+      const std::int32_t out_y = row % output_height;
+      const std::int32_t in_y_origin = (out_y * strides[0]) - padding_before[0];
+      // kernel rows over the input
+      const std::int32_t kernel_y_begin = std::max(0, -in_y_origin);
+      const std::int32_t kernel_y_end = std::min(kernel_height, input_height - in_y_origin);
+
       for (std::int32_t out_x = 0; out_x < output_width; ++out_x)
       {
+        const std::int32_t in_x_origin = (out_x * strides[1]) - padding_before[1];
+        const std::int32_t kernel_x_begin = std::max(0, -in_x_origin);
+        const std::int32_t kernel_x_end = std::min(kernel_width, input_width - in_x_origin);
+        T *out = result_data + calcOffset(output_shape, batch, out_y, out_x, 0);
+
         for (std::int32_t group = 0; group < num_groups; ++group)
         {
           const std::int32_t out_group_offset = group * out_group_size;
           const std::int32_t in_group_offset = group * in_group_size;
 
-          for (std::int32_t out_c = 0; out_c < out_group_size; ++out_c)
+          for (std::int32_t out_c = 0; out_c < out_group_size; out_c += channel_block)
           {
-            const std::int32_t in_y_origin = (out_y * strides[0]) - padding_before[0];
-            const std::int32_t in_x_origin = (out_x * strides[1]) - padding_before[1];
-
-            T sum = 0.0f;
+            const std::int32_t block = std::min(channel_block, out_group_size - out_c);
+            T sum[channel_block] = {};
 
-            for (std::int32_t kernel_y = 0; kernel_y < kernel_height; ++kernel_y)
+            for (std::int32_t kernel_y = kernel_y_begin; kernel_y < kernel_y_end; ++kernel_y)
             {
-              for (std::int32_t kernel_x = 0; kernel_x < kernel_width; ++kernel_x)
+              for (std::int32_t kernel_x = kernel_x_begin; kernel_x < kernel_x_end; ++kernel_x)
               {
-                for (std::int32_t in_c = 0; in_c < in_group_size; ++in_c)
+                const T *in = input_data + calcOffset(input_shape, batch, in_y_origin + kernel_y,
+                                                      in_x_origin + kernel_x, in_group_offset);
+                const T *ker = kernel_data + calcOffset(kernel_shape, out_group_offset + out_c,
+                                                        kernel_y, kernel_x, 0);
+                if (block == channel_block)
                 {
-                  const std::int32_t in_y = in_y_origin + kernel_y;
-                  const std::int32_t in_x = in_x_origin + kernel_x;
-
-                  if ((in_y >= 0 && in_y < input_height) && (in_x >= 0 && in_x < input_width))
+                  for (std::int32_t in_c = 0; in_c < in_group_size; ++in_c)
                   {
-                    const std::int32_t in_offset =
-                      calcOffset(input_shape, batch, in_y, in_x, in_group_offset + in_c);
-                    const std::int32_t kernel_offset =
-                      calcOffset(kernel_shape, out_group_offset + out_c, kernel_y, kernel_x, in_c);
-                    const T input_val = input_data[in_offset];
-                    const T kernel_val = kernel_data[kernel_offset];
-                    sum += kernel_val * input_val;
+                    const T input_val = in[in_c];
+                    sum[0] += ker[in_c] * input_val;
+                    sum[1] += ker[kernel_size + in_c] * input_val;
+                    sum[2] += ker[2 * kernel_size + in_c] * input_val;
+                    sum[3] += ker[3 * kernel_size + in_c] * input_val;
+                  }
+                }
+                else
+                {
+                  for (std::int32_t b = 0; b < block; ++b)
+                  {
+                    for (std::int32_t in_c = 0; in_c < in_group_size; ++in_c)
+                      sum[b] += ker[b * kernel_size + in_c] * in[in_c];
                   }
                 }
               }
             }
 
-            const std::int32_t out_offset =
-              calcOffset(output_shape, batch, out_y, out_x, out_group_offset + out_c);
-            result_data[out_offset] = sum;
+            for (std::int32_t b = 0; b < block; ++b)
+              out[out_group_offset + out_c + b] = sum[b];
           }
         }
       }
     }
-  }
+  };
+  parallelFor(batch_size * output_height,
+              static_cast<std::int64_t>(output_width) * num_out_channels * kernel_size, run_rows);
 }
 
 template <> struct Conv2DImpl<uint8_t>
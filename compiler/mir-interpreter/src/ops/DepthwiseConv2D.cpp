@@ -22,6 +22,7 @@
 #include "mir/ShapeRange.h"
 #include "mir/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace mir_interpreter
@@ -55,39 +56,66 @@ void DepthwiseConv2DImpl<T>::run(const mir::ops::DepthwiseConv2DOp &op,
   assert(strides.size() == 2);
   assert(pads.size() == 2);
 
-  int32_t channel_multiplier = kernel_shape.dim(3);
-
-  Tensor<T> res_accessor(output);
-  Tensor<T> input(inputv);
-  Tensor<T> bias(*biasv);
-  Tensor<T> kernel(kernelv);
-
-  ShapeRange in_range(in_shape);
-  ShapeRange kernel_range(kernel_shape);
-  ShapeRange out_range(Shape{out_shape.dim(0), out_shape.dim(1), out_shape.dim(2), 1});
-
-  Index in_index;
-  in_index.resize(4);
-
-  erase<T>(output);
-
-  for (const auto &out_index : out_range)
-  {
-    Index out_index_k = out_index;
-    for (const auto &kernel_index : kernel_range)
+  const int32_t channel_multiplier = kernel_shape.dim(3);
+  const int32_t num_in_channels = in_shape.dim(3);
+  const int32_t num_out_channels = out_shape.dim(3);
+  const int32_t input_height = in_shape.dim(1);
+  const int32_t input_width = in_shape.dim(2);
+  const int32_t kernel_height = kernel_shape.dim(0);
+  const int32_t kernel_width = kernel_shape.dim(1);
+  const int32_t output_height = out_shape.dim(1);
+  const int32_t output_width = out_shape.dim(2);
+
+  const auto *input_data = reinterpret_cast<const T *>(inputv.atOffset(0));
+  const auto *kernel_data = reinterpret_cast<const T *>(kernelv.atOffset(0));
+  auto *output_data = reinterpret_cast<T *>(output.atOffset(0));
+
+  // Each thread computes rows of output. Elements of kernel are applied in the same order as
+  // accumulating output over kernel positions, whose channels are contiguous in input and kernel.
+  auto run_rows = [&](int32_t begin, int32_t end) {
+    for (int32_t row = begin; row < end; ++row)
     {
-      in_index.at(0) = out_index.at(0);
-      for (int i = 0; i < 2; ++i)
-        in_index.at(1 + i) = out_index.at(1 + i) * strides[i] + kernel_index.at(i) - pads[i];
-      in_index.at(3) = kernel_index.at(2);
+      const int32_t batch = row / output_height;
+      const int32_t out_y = row % output_height;
+      const int32_t in_y_origin = out_y * strides[0] - pads[0];
+      const int32_t kernel_y_begin = std::max(0, -in_y_origin);
+      const int32_t kernel_y_end = std::min(kernel_height, input_height - in_y_origin);
 
-      if (in_range.contains(in_index))
+      for (int32_t out_x = 0; out_x < output_width; ++out_x)
       {
-        out_index_k.at(3) = kernel_index.at(2) * channel_multiplier + kernel_index.at(3);
-        res_accessor.at(out_index_k) += input.at(in_index) * kernel.at(kernel_index);
+        const int32_t in_x_origin = out_x * strides[1] - pads[1];
+        const int32_t kernel_x_begin = std::max(0, -in_x_origin);
+        const int32_t kernel_x_end = std::min(kernel_width, input_width - in_x_origin);
+        T *out = output_data + ((batch * output_height + out_y) * output_width + out_x) *
+                                 num_out_channels;
+        std::fill(out, out + num_out_channels, T{0});
+
+        for (int32_t kernel_y = kernel_y_begin; kernel_y < kernel_y_end; ++kernel_y)
+        {
+          for (int32_t kernel_x = kernel_x_begin; kernel_x < kernel_x_end; ++kernel_x)
+          {
+            const int32_t in_y = in_y_origin + kernel_y;
+            const int32_t in_x = in_x_origin + kernel_x;
+            const T *in =
+              input_data + ((batch * input_height + in_y) * input_width + in_x) * num_in_channels;
+            const T *ker = kernel_data + (kernel_y * kernel_width + kernel_x) * num_out_channels;
+            for (int32_t in_c = 0; in_c < num_in_channels; ++in_c)
+            {
+              const T input_val = in[in_c];
+              for (int32_t m = 0; m < channel_multiplier; ++m)
+              {
+                const int32_t out_c = in_c * channel_multiplier + m;
+                out[out_c] += input_val * ker[out_c];
+              }
+            }
+          }
+        }
       }
     }
-  }
+  };
+  parallelFor(out_shape.dim(0) * output_height,
+              static_cast<int64_t>(output_width) * num_out_channels * kernel_height * kernel_width,
+              run_rows);
 }
 
 template <> struct DepthwiseConv2DImpl<uint8_t>
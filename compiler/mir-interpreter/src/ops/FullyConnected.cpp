@@ -42,18 +42,23 @@ static void fullyConnected2D(const mir::TensorVariant &input, const mir::TensorV
   auto N = input.getShape().dim(1);
   auto wcols = weights.getShape().dim(1);
 
-  for (int32_t r = 0; r < rows; ++r)
-  {
-    for (int32_t k = 0; k < N; ++k)
+  // Each thread computes a range of columns of all rows, so batches of one row are split too
+  parallelFor(cols, static_cast<int64_t>(rows) * N, [&](int32_t begin, int32_t end) {
+    for (int32_t r = 0; r < rows; ++r)
     {
-      auto in = in_raw[r * N + k];
-
-      for (int32_t c = 0; c < cols; ++c)
+      T *out = output_raw + r * cols;
+      for (int32_t k = 0; k < N; ++k)
       {
-        output_raw[r * cols + c] += in * weight_raw[k * wcols + c];
+        const T in = in_raw[r * N + k];
+        const T *weight = weight_raw + k * wcols;
+
+        for (int32_t c = begin; c < end; ++c)
+        {
+          out[c] += in * weight[c];
+        }
       }
     }
-  }
+  });
 }
 
 template <typename T> struct FullyConnectedImpl
@@ -26,6 +26,7 @@
 #include "cpp_operations.generated.h"
 #include "CommonData.generated.h"
 #include "eigen.generated.h"
+#include "cpp_parallel.generated.h"
 #include "cpp_common_funcs.generated.h"
 #include "cpp_capped_relu.generated.h"
 #include "cpp_concat.generated.h"
@@ -79,9 +80,13 @@ static unique_ptr<ofstream> getStream(const string &path)
   return ofs;
 }
 
-CPPCodeGenerator::CPPCodeGenerator(std::string output_dir, std::string artifact_name)
-  : _output_dir(std::move(output_dir)), _artifact_name(std::move(artifact_name))
+CPPCodeGenerator::CPPCodeGenerator(std::string output_dir, std::string artifact_name,
+                                   const CPPCodeGeneratorOptions &options)
+  : _output_dir(std::move(output_dir)), _artifact_name(std::move(artifact_name)),
+    _options(options)
 {
+  if (_options.num_threads == 0)
+    throw runtime_error("Number of threads of generated code must be positive");
 }
 
 void CPPCodeGenerator::materializeModelParams(ostream &out, const Serializer &s)
@@ -141,6 +146,14 @@ void CPPCodeGenerator::run(mir::Graph *graph)
   auto model_stream = getStream(params_path);
   materializeModelParams(*model_stream, serializer);
   model_stream.reset();
+
+  // Print benchmark
+  if (_options.benchmark)
+  {
+    auto benchmark_stream = getStream(base_path + "_benchmark.cpp");
+    materializeBenchmark(*benchmark_stream, ma);
+    benchmark_stream.reset();
+  }
 }
 
 /**
@@ -238,6 +251,8 @@ void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
   // pointer to NN parameters
   out << "  char* _parameters;\n";
   out << "  size_t _paramSize;\n";
+  // data of temporary tensors
+  out << "  float* _arena;\n";
   out << "};\n";
 }
 
@@ -350,9 +365,18 @@ void CPPCodeGenerator::materializeConstructor(ostream &out, const ModelAnalyzer
   assert(constructor != nullptr);
   const TensorDescriptor &td = ma.getTensors()[constructor->tensorId];
   assert(td.type == sir::TensorDescriptor::Type::temporary);
-  (void)td;
   const string &t_name = _formattedTensors[constructor->tensorId];
-  out << "  Tensor " << t_name << ";\n";
+  const auto &offsets = ma.getArenaOffsets();
+  auto offset = offsets.find(constructor->tensorId);
+  if (offset == offsets.end())
+  {
+    out << "  Tensor " << t_name << ";\n";
+    return;
+  }
+  out << "  Tensor " << t_name << "(Shape{";
+  for (int i = 0; i < td.shape.rank(); ++i)
+    out << (i == 0 ? "" : ", ") << td.shape.dim(i);
+  out << "}, _arena + " << offset->second << ");\n";
 }
 
 void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &ma,
@@ -369,9 +393,14 @@ void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &
 void CPPCodeGenerator::materializeInferenceSequence(ostream &out, const ModelAnalyzer &ma)
 {
 
-  // Allocate temporary(im2col) tensor
+  // Allocate temporary(im2col) tensor, in arena if convolutions use it
   out << "  Tensor " << _formattedTensors[ma.getTempTID()] << "(Shape{" << ma.getMaxTemporarySize()
-      << "});\n";
+      << "}";
+  const auto &offsets = ma.getArenaOffsets();
+  auto temp_offset = offsets.find(ma.getTempTID());
+  if (temp_offset != offsets.end())
+    out << ", _arena + " << temp_offset->second;
+  out << ");\n";
 
   for (const unique_ptr<Action> &action : ma.getInferenceSequence())
   {
@@ -404,6 +433,16 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
 {
   string class_name = ma.getModelName() + "Model";
 
+  if (_options.num_threads > 1)
+    out << "#define NNC_NUM_THREADS " << _options.num_threads << "\n";
+  if (_options.use_neon)
+  {
+    out << "#if defined(__ARM_NEON) || defined(__ARM_NEON__)\n"
+           "#define USE_NEON\n"
+           "#include <arm_neon.h>\n"
+           "#endif\n";
+  }
+
   out << "#include \"" << _artifact_name << ".h\"\n";
 
   // put operations from tflite
@@ -411,6 +450,7 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
 
   out.write(CommonData, sizeof(CommonData));
 
+  out.write(cpp_parallel, sizeof(cpp_parallel));
   out.write(cpp_common_funcs, sizeof(cpp_common_funcs));
   out.write(cpp_capped_relu, sizeof(cpp_capped_relu));
   out.write(cpp_concat, sizeof(cpp_concat));
@@ -445,12 +485,16 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
          "  readParameters(_parameters, _paramSize, parametersPath, "
       << s.getFormatVersion() << ", " << s.getModelHash()
       << ");\n"
+         "  _arena = new float["
+      << ma.getArenaSize()
+      << "];\n"
          "}\n\n";
   // gen NN destructor
   out << class_name << "::~" << class_name
       << "()\n"
          "{\n"
          "  releaseParameters(_parameters, _paramSize);\n"
+         "  delete [] _arena;\n"
          "}\n\n";
   // generate input setters
   // generate main setter if network has only one
@@ -497,4 +541,60 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   out << "}";
 }
 
+void CPPCodeGenerator::materializeBenchmark(ostream &out, const ModelAnalyzer &ma)
+{
+  string class_name = ma.getModelName() + "Model";
+
+  out << "#include \"" << _artifact_name
+      << ".h\"\n\n"
+         "#include <chrono>\n"
+         "#include <cstdlib>\n"
+         "#include <iostream>\n\n"
+         "// Usage: "
+      << _artifact_name
+      << "_benchmark <parameters file> [number of runs]\n"
+         "int main(int argc, char **argv)\n"
+         "{\n"
+         "  if (argc < 2)\n"
+         "  {\n"
+         "    std::cerr << \"Usage: \" << argv[0] << \" <parameters file> [runs]\" << std::endl;\n"
+         "    return 1;\n"
+         "  }\n"
+         "  const int runs = argc > 2 ? std::atoi(argv[2]) : 10;\n"
+         "  "
+      << class_name << " model(argv[1]);\n";
+
+  // fill inputs with constant values, as inference time does not depend on them
+  for (size_t input_id : ma.getInputs())
+  {
+    const TensorDescriptor &td = ma.getTensors()[input_id];
+    const string &tensor_name = _formattedTensors[input_id];
+    out << "  {\n"
+           "    Tensor t(Shape{";
+    for (int i = 0; i < td.shape.rank(); ++i)
+      out << (i == 0 ? "" : ", ") << td.shape.dim(i);
+    out << "});\n"
+           "    for (index_t i = 0; i < t.getShape().getNumElems(); ++i)\n"
+           "      t.getData()[i] = 0.5f;\n"
+           "    model.set"
+        << tensor_name
+        << "(t);\n"
+           "  }\n";
+  }
+
+  out << "  // warm up, which also starts threads of the artifact\n"
+         "  model.doInference();\n"
+         "  const auto begin = std::chrono::steady_clock::now();\n"
+         "  for (int i = 0; i < runs; ++i)\n"
+         "    model.doInference();\n"
+         "  const auto end = std::chrono::steady_clock::now();\n"
+         "  const std::chrono::duration<double, std::milli> total = end - begin;\n"
+         "  const double average_ms = total.count() / (runs > 0 ? runs : 1);\n"
+         "  std::cout << \"Average inference time: \" << average_ms << \" ms ("
+      << _options.num_threads
+      << " threads)\" << std::endl;\n"
+         "  return 0;\n"
+         "}\n";
+}
+
 } // namespace nnc
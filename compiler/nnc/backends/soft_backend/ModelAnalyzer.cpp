@@ -20,8 +20,10 @@
 #include "mir/Graph.h"
 #include "mir/OpDefs.h"
 
+#include <algorithm>
 #include <stack>
 #include <map>
+#include <set>
 
 using namespace std;
 
@@ -31,6 +33,34 @@ namespace nnc
 using namespace mir;
 using namespace sir;
 
+namespace
+{
+
+/**
+ * @brief Returns true if function computes each element of output only from the same element
+ * of its first input, so the output can be written over the input of the same size
+ */
+bool isInPlaceFunction(const string &func_name)
+{
+  static const set<string> in_place_funcs{"absFN",
+                                          "cappedRelu",
+                                          "elu",
+                                          "leakyRelu",
+                                          "relu",
+                                          "reshape",
+                                          "sigmoid",
+                                          "sqrtFN",
+                                          "tanhActivation",
+                                          "ElementWise<Add>",
+                                          "ElementWise<Div>",
+                                          "ElementWise<Max>",
+                                          "ElementWise<Mul>",
+                                          "ElementWise<Sub>"};
+  return in_place_funcs.count(func_name) != 0;
+}
+
+} // namespace
+
 void ModelAnalyzer::appendOperationToInference(Operation *op, const string &function_name,
                                                std::vector<size_t> aux_args)
 {
@@ -61,8 +91,8 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
     for (const auto &output : op->getOutputs())
     {
       const auto &tensor_name = output.getName();
-      const auto tensor_id =
-        tensor_name.empty() ? declareTemporaryTensor() : declarePersistentTensor(tensor_name);
+      const auto tensor_id = tensor_name.empty() ? declareTemporaryTensor(output.getShape())
+                                                 : declarePersistentTensor(tensor_name);
       node_output_tensors.push_back(tensor_id);
     }
   }
@@ -110,10 +140,10 @@ size_t ModelAnalyzer::declarePersistentTensor(const std::string &name)
   return id;
 }
 
-size_t ModelAnalyzer::declareTemporaryTensor()
+size_t ModelAnalyzer::declareTemporaryTensor(const mir::Shape &shape)
 {
   size_t id = _allocatedTensors++;
-  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", {}});
+  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", shape});
   return id;
 }
 
@@ -150,6 +180,103 @@ void ModelAnalyzer::gatherDefUseInfo(const vector<unique_ptr<Action>> &post_orde
   }
 }
 
+void ModelAnalyzer::planArena(const map<size_t, size_t> &first_def,
+                              const map<size_t, size_t> &last_use)
+{
+  // Buffer is a range of arena used by tensors from begin to end position in inference sequence
+  struct Buffer
+  {
+    size_t size;
+    size_t begin;
+    size_t end;
+    size_t offset;
+  };
+  vector<Buffer> buffers;
+  // maps tensor id to index of its buffer
+  map<size_t, size_t> tensor_buffer;
+
+  // im2col buffer is allocated before inference and used by any convolution
+  auto temp_use = last_use.find(_temp_tensor_id);
+  if (_max_temp_size > 0 && temp_use != last_use.end())
+  {
+    tensor_buffer[_temp_tensor_id] = buffers.size();
+    buffers.push_back({_max_temp_size, 0, temp_use->second, 0});
+  }
+
+  for (size_t pos = 0; pos < _inferenceSequence.size(); ++pos)
+  {
+    const CallFunction *call = dynamic_cast<CallFunction *>(_inferenceSequence[pos].get());
+    assert(call);
+
+    for (size_t output_tensor_id : call->outputs)
+    {
+      const TensorDescriptor &td = _tensors[output_tensor_id];
+      // data of constants is in parameters, and shape of other tensors is not known
+      if (td.type != TensorDescriptor::Type::temporary || td.shape.rank() == 0 ||
+          first_def.at(output_tensor_id) != pos)
+        continue;
+
+      const auto size = static_cast<size_t>(td.shape.numElements());
+      auto use = last_use.find(output_tensor_id);
+      const size_t end = use == last_use.end() ? pos : use->second;
+
+      // reuse buffer of the input which dies here
+      if (isInPlaceFunction(call->funcName) && call->outputs.size() == 1)
+      {
+        const size_t input_tensor_id = call->inputs[0];
+        auto input_buffer = tensor_buffer.find(input_tensor_id);
+        if (input_buffer != tensor_buffer.end() && last_use.at(input_tensor_id) == pos &&
+            buffers[input_buffer->second].size == size)
+        {
+          Buffer &buffer = buffers[input_buffer->second];
+          buffer.end = std::max(buffer.end, end);
+          tensor_buffer[output_tensor_id] = input_buffer->second;
+          continue;
+        }
+      }
+
+      tensor_buffer[output_tensor_id] = buffers.size();
+      buffers.push_back({size, pos, end, 0});
+    }
+  }
+
+  // Place larger buffers first, each at the lowest offset not overlapping buffers alive with it
+  vector<size_t> order(buffers.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&](size_t a, size_t b) { return buffers[a].size > buffers[b].size; });
+
+  vector<size_t> placed;
+  for (size_t idx : order)
+  {
+    Buffer &buffer = buffers[idx];
+    vector<const Buffer *> alive;
+    for (size_t other_idx : placed)
+    {
+      const Buffer &other = buffers[other_idx];
+      if (other.begin <= buffer.end && buffer.begin <= other.end)
+        alive.push_back(&other);
+    }
+    std::sort(alive.begin(), alive.end(),
+              [](const Buffer *a, const Buffer *b) { return a->offset < b->offset; });
+
+    size_t offset = 0;
+    for (const Buffer *other : alive)
+    {
+      if (offset + buffer.size <= other->offset)
+        break;
+      offset = std::max(offset, other->offset + other->size);
+    }
+    buffer.offset = offset;
+    _arena_size = std::max(_arena_size, offset + buffer.size);
+    placed.push_back(idx);
+  }
+
+  for (const auto &tb : tensor_buffer)
+    _arena_offsets[tb.first] = buffers[tb.second].offset;
+}
+
 void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_order)
 {
   // Run inference sequence construction over constructed list of operations
@@ -167,6 +294,8 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
   // prepare use-def info
   gatherDefUseInfo(_inferenceSequence, first_def, last_use);
 
+  planArena(first_def, last_use);
+
   // insert memory operations
   // Every iteration of loop contains three steps:
   // 1) insert constructors of temporary tensors used in current operations
@@ -123,6 +123,16 @@ public:
 
   size_t getTempTID() const { return _temp_tensor_id; }
 
+  /**
+   * @return Number of floats in arena which holds data of planned temporary tensors
+   */
+  size_t getArenaSize() const { return _arena_size; }
+
+  /**
+   * @return Maps id of planned temporary tensor to offset of its data in arena
+   */
+  const std::map<size_t, size_t> &getArenaOffsets() const { return _arena_offsets; }
+
 protected:
   void visit_fallback(mir::Operation &op) override;
 
@@ -163,9 +173,10 @@ private:
 
   /**
    * @brief Declares temporary tensor in artifact
+   * @param shape Shape of tensor, if known on compilation
    * @return Id of created tensor
    */
-  size_t declareTemporaryTensor();
+  size_t declareTemporaryTensor(const mir::Shape &shape = {});
 
   /**
    * @brief Gathers info where tensors were defined and used in inference sequence
@@ -176,6 +187,17 @@ private:
   void gatherDefUseInfo(const std::vector<std::unique_ptr<sir::Action>> &post_order,
                         std::map<size_t, size_t> &first_def, std::map<size_t, size_t> &last_use);
 
+  /**
+   * @brief Assigns offsets in arena to temporary tensors of known shape
+   * @param first_def Maps tensor id to position in inf sequence where it was defined first time.
+   * @param last_use Maps tensor id to position in inf sequence where it was used last time.
+   *
+   * Tensors alive at the same time do not overlap in arena. Output of elementwise operation
+   * shares data of the input which is not used after the operation.
+   */
+  void planArena(const std::map<size_t, size_t> &first_def,
+                 const std::map<size_t, size_t> &last_use);
+
   /**
    * @brief constructs inference sequence from vector of mir::Operations, constructed
    * @param post_order vector representing layout of operations in inference
@@ -198,6 +220,8 @@ private:
   std::vector<size_t> _outputs;
   size_t _max_temp_size = 0;
   size_t _temp_tensor_id = 0;
+  size_t _arena_size = 0;
+  std::map<size_t, size_t> _arena_offsets;
   std::vector<sir::TensorDescriptor> _tensors;
   std::map<const mir::Operation *, const sir::Action *> _opToDescr;
 };
@@ -117,7 +117,11 @@ static void backend(mir::Graph *graph)
 {
   if (cli::target == NNC_TARGET_ARM_CPP || cli::target == NNC_TARGET_X86_CPP)
   {
-    CPPCodeGenerator(cli::artifactDir, cli::artifactName).run(graph);
+    CPPCodeGeneratorOptions options;
+    options.num_threads = cli::numThreads;
+    options.use_neon = cli::target == NNC_TARGET_ARM_CPP;
+    options.benchmark = cli::genBenchmark;
+    CPPCodeGenerator(cli::artifactDir, cli::artifactName, options).run(graph);
   }
   else if (cli::target == NNC_TARGET_ARM_GPU_CPP)
   {
@@ -122,6 +122,12 @@ Option<std::string> artifactDir(optname("--output-dir, -d"),
                                 overview("specify directory for output files"),
                                 ".", // default is current directory
                                 optional(true), optvalues(""), checkOutDir, separators("="));
+Option<uint32_t> numThreads(optname("--num-threads"),
+                            overview("number of threads running operations of generated code"), 1,
+                            optional(true), optvalues(""), nullptr, separators("="));
+Option<bool> genBenchmark(optname("--benchmark"),
+                          overview("generate program measuring inference time of artifact"), false,
+                          optional(true), optvalues(""), nullptr, separators(""), showopt(true));
 
 /**
  * Options for *interpreter*
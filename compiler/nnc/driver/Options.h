@@ -56,6 +56,8 @@ extern Option<std::string> inputFile; // files contains model of specific AI fra
  */
 extern Option<std::string> artifactDir;  // output directory for artifact
 extern Option<std::string> artifactName; // name of artifact
+extern Option<uint32_t> numThreads;      // number of threads of generated code
+extern Option<bool> genBenchmark;        // generate benchmark of artifact
 
 /**
  * Options for interpreter
@@ -19,6 +19,7 @@
 
 #include "mir/Graph.h"
 
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -39,6 +40,19 @@ struct CreateTmp;
 struct DestroyTmp;
 } // namespace sir
 
+/**
+ * @brief Options of code generated by CPPCodeGenerator
+ */
+struct CPPCodeGeneratorOptions
+{
+  // threads running convolution, matrix multiplication and elementwise operations of artifact
+  uint32_t num_threads = 1;
+  // define USE_NEON for snippets with NEON intrinsics, if artifact is built with NEON
+  bool use_neon = false;
+  // generate program measuring inference time of artifact
+  bool benchmark = false;
+};
+
 /**
  * @brief CPPCodeGenerator implements interfaces that provides BaseCodeGenerator for C++ language
  * This includes header file generation, code file generation and variable renaming according to C++
@@ -47,7 +61,8 @@ struct DestroyTmp;
 class CPPCodeGenerator final
 {
 public:
-  CPPCodeGenerator(std::string output_dir, std::string artifact_name);
+  CPPCodeGenerator(std::string output_dir, std::string artifact_name,
+                   const CPPCodeGeneratorOptions &options = CPPCodeGeneratorOptions());
 
   /**
    * @brief Method represents base generation sequence: analysis, serialization, header/code
@@ -151,9 +166,17 @@ private:
    * + array of serialized network parameters
    */
   void materializeModelParams(std::ostream &out, const Serializer &s);
+  /**
+   * @brief Writes program which runs inference of artifact with constant inputs repeatedly
+   * and prints average time of inference
+   * @param out Stream to write program text
+   * @param ma Intermediate artifact information
+   */
+  void materializeBenchmark(std::ostream &out, const ModelAnalyzer &ma);
 
   std::string _output_dir;
   std::string _artifact_name;
+  CPPCodeGeneratorOptions _options;
   std::vector<std::string> _formattedTensors;
 };
 
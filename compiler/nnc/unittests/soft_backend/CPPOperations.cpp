@@ -24,6 +24,7 @@
 #include "code_snippets/eigen.def"
 
 #include "code_snippets/cpp_header_types.def"
+#include "code_snippets/cpp_parallel.def"
 #include "code_snippets/cpp_common_funcs.def"
 
 #include "code_snippets/cpp_broadcast.def"
@@ -110,3 +110,41 @@ TEST(Generator, check_generator_call)
 
   deleteDir(TEST_DIR);
 }
+
+TEST(Generator, check_generator_benchmark)
+{
+#define BENCH_DIR "output_bench_dir"
+#define BENCH_NAME "someName"
+#define BENCH_BASE_NAME BENCH_DIR "/" BENCH_NAME
+
+  mir::Graph g;
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3, 4}};
+  Operation::Output *input = g.create<ops::InputOp>(input_type)->getOutput(0);
+  input->setName("input");
+  g.create<ops::ReluOp>(input);
+
+  if (isFileExists(BENCH_DIR))
+    deleteDir(BENCH_DIR);
+
+  CPPCodeGeneratorOptions options;
+  options.num_threads = 4;
+  options.benchmark = true;
+  CPPCodeGenerator cpp_code_generator(BENCH_DIR, BENCH_NAME, options);
+  cpp_code_generator.run(&g);
+  checkOutputExists(BENCH_BASE_NAME);
+  ASSERT_TRUE(isFileExists(BENCH_BASE_NAME "_benchmark.cpp"));
+
+  ifstream code(BENCH_BASE_NAME ".cpp");
+  string line;
+  getline(code, line);
+  ASSERT_EQ("#define NNC_NUM_THREADS 4", line);
+
+  deleteDir(BENCH_DIR);
+}
+
+TEST(Generator, zero_threads_NEG)
+{
+  CPPCodeGeneratorOptions options;
+  options.num_threads = 0;
+  EXPECT_ANY_THROW(CPPCodeGenerator("output_dir", "someName", options));
+}
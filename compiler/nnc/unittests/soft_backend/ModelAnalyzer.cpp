@@ -83,3 +83,48 @@ TEST(ModelAnalyzer, linearization)
   vector<Operation *> valid_seq2{input, head2, tail2, head1, tail1, join};
   ASSERT_TRUE(op_seq == valid_seq1 || op_seq == valid_seq2);
 }
+
+TEST(ModelAnalyzer, arena_in_place)
+{
+  mir::Graph g;
+  // [input] -> [relu1] -> [relu2] -> [out]
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *relu1 = g.create<ops::ReluOp>(input->getOutput(0));
+  Operation *relu2 = g.create<ops::ReluOp>(relu1->getOutput(0));
+  Operation *out = g.create<ops::ReluOp>(relu2->getOutput(0));
+  input->getOutput(0)->setName("input");
+  out->getOutput(0)->setName("out");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  // relu2 writes over output of relu1
+  const auto &offsets = ma.getArenaOffsets();
+  ASSERT_EQ(2u, offsets.size());
+  ASSERT_EQ(offsets.begin()->second, offsets.rbegin()->second);
+  ASSERT_EQ(6u, ma.getArenaSize());
+}
+
+TEST(ModelAnalyzer, arena_alive_together)
+{
+  mir::Graph g;
+  // [input] -> [head1], [head2] -> [join]
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *head1 = g.create<ops::ReluOp>(input->getOutput(0));
+  Operation *head2 = g.create<ops::ReluOp>(input->getOutput(0));
+  vector<mir::Operation::Output *> concat_inputs{head1->getOutput(0), head2->getOutput(0)};
+  Operation *join = g.create<ops::ConcatOp>(concat_inputs, 0);
+  input->getOutput(0)->setName("input");
+  join->getOutput(0)->setName("join");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  // outputs of heads are used by join together
+  const auto &offsets = ma.getArenaOffsets();
+  ASSERT_EQ(2u, offsets.size());
+  ASSERT_NE(offsets.begin()->second, offsets.rbegin()->second);
+  ASSERT_EQ(12u, ma.getArenaSize());
+}
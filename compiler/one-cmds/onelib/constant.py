@@ -23,18 +23,23 @@ class CONSTANT:
          'Experimental: This will convert NCHW operators to NHWC under the assumption that input model is NCHW.'
          ),
         ('expand_broadcast_const', 'expand broadcastable constant node inputs'),
+        ('common_subexpression_elimination',
+         'merge operators which compute the same value from the same inputs'),
         ('nchw_to_nhwc_input_shape',
          'convert the input shape of the model (argument for convert_nchw_to_nhwc)'),
         ('nchw_to_nhwc_output_shape',
          'convert the output shape of the model (argument for convert_nchw_to_nhwc)'),
         ('fold_add_v2', 'fold AddV2 op with constant inputs'),
         ('fold_cast', 'fold Cast op with constant input'),
+        ('fold_constants', 'fold operators with constant inputs'),
         ('fold_dequantize', 'fold Dequantize op'),
         ('fold_dwconv', 'fold Depthwise Convolution op with constant inputs'),
         ('fold_gather', 'fold Gather op'),
         ('fold_sparse_to_dense', 'fold SparseToDense op'),
         ('forward_reshape_to_unaryop', 'Forward Reshape op'),
         ('fuse_add_with_tconv', 'fuse Add op to Transposed'),
+        ('fuse_add_with_conv', 'fuse Add op to Convolution op'),
+        ('fuse_add_with_dwconv', 'fuse Add op to Depthwise Convolution op'),
         ('fuse_add_with_fully_connected', 'fuse Add op to FullyConnected op'),
         ('fuse_batchnorm_with_conv', 'fuse BatchNorm op to Convolution op'),
         ('fuse_batchnorm_with_dwconv', 'fuse BatchNorm op to Depthwise Convolution op'),
@@ -43,6 +48,11 @@ class CONSTANT:
         ('fuse_preactivation_batchnorm',
          'fuse BatchNorm operators of pre-activations to Convolution op'),
         ('fuse_mean_with_mean', 'fuse two consecutive Mean ops'),
+        ('fuse_mul_with_conv', 'fuse Mul op to Convolution op'),
+        ('fuse_mul_with_dwconv', 'fuse Mul op to Depthwise Convolution op'),
+        ('fuse_mul_with_fully_connected', 'fuse Mul op to FullyConnected op'),
+        ('fuse_parallel_fc_and_conv',
+         'fuse FullyConnected or Conv2D ops sharing an input into one op and SplitV'),
         ('fuse_transpose_with_mean',
          'fuse Mean with a preceding Transpose under certain conditions'),
         ('make_batchnorm_gamma_positive',
@@ -50,7 +60,10 @@ class CONSTANT:
          ' Note that this pass can change the execution result of the model.'
          ' So, use it only when the impact is known to be acceptable.'),
         ('fuse_activation_function', 'fuse Activation function to a preceding operator'),
+        ('fuse_gelu', 'fuse ops to Gelu operator'),
+        ('fuse_hard_swish', 'fuse ops to HardSwish operator'),
         ('fuse_instnorm', 'fuse ops to InstanceNorm operator'),
+        ('fuse_layernorm', 'fuse ops to LayerNorm operator'),
         ('replace_cw_mul_add_with_depthwise_conv',
          'replace channel-wise Mul/Add with DepthwiseConv2D'),
         ('remove_fakequant', 'remove FakeQuant ops'),
@@ -72,6 +85,7 @@ class CONSTANT:
         ('shuffle_weight_to_16x1float32',
          'convert weight format of FullyConnected op to SHUFFLED16x1FLOAT32.'
          ' Note that it only converts weights whose row is a multiple of 16'),
+        ('sink_transpose', 'move Transpose ops down to remove them with their inverses'),
         ('substitute_pack_to_reshape', 'convert single input Pack op to Reshape op'),
         ('substitute_padv2_to_pad', 'convert certain condition PadV2 to Pad'),
         ('substitute_splitv_to_split', 'convert certain condition SplitV to Split'),
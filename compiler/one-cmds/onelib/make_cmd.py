@@ -98,3 +98,36 @@ def make_circle2circle_cmd(args, driver_path, input_path, output_path):
                 cmd.append('--' + opt[0])
 
     return cmd
+
+
+def make_circle_pipeline_cmd(optimize_args, quantize_args, driver_path, input_path,
+                             output_path):
+    """make a command for running circle-pipeline, which optimizes and quantizes a model
+       like circle2circle, circle-quantizer and record-minmax in a single process"""
+    cmd = make_circle2circle_cmd(optimize_args, driver_path, input_path, output_path)
+    # quantization with the default values of one-quantize
+    if _is_valid_attr(quantize_args, 'input_model_dtype'):
+        input_model_dtype = getattr(quantize_args, 'input_model_dtype')
+    elif _is_valid_attr(quantize_args, 'input_dtype'):
+        input_model_dtype = getattr(quantize_args, 'input_dtype')
+    else:
+        input_model_dtype = 'float32'
+    quantized_dtype = getattr(quantize_args, 'quantized_dtype', None) or 'uint8'
+    granularity = getattr(quantize_args, 'granularity', None) or 'layer'
+    cmd += ['--quantize_with_minmax', input_model_dtype, quantized_dtype, granularity]
+    if _is_valid_attr(quantize_args, 'TF-style_maxpool') and not getattr(
+            quantize_args, 'TF-style_maxpool').lower() in ['false', '0', 'n']:
+        cmd.append('--TF-style_maxpool')
+    for opt in [
+            'input_type', 'output_type', 'input_data', 'input_data_format', 'mode',
+            'min_percentile', 'max_percentile'
+    ]:
+        if _is_valid_attr(quantize_args, opt):
+            cmd.append('--' + opt)
+            cmd.append(getattr(quantize_args, opt))
+    # profiling
+    if _is_valid_attr(quantize_args, 'generate_profile_data'):
+        if not '--generate_profile_data' in cmd:
+            cmd.append('--generate_profile_data')
+
+    return cmd
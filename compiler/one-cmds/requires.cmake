@@ -2,8 +2,10 @@ require("tf2tfliteV2")
 require("tflite2circle")
 require("circle2circle")
 require("circle-eval-diff")
+require("circle-operator")
 require("circle-quantizer")
 require("record-minmax")
+require("circle-pipeline")
 require("vconone")
 require("bcq-tools")
 require("rawdata2hdf5")
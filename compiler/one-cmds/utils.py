@@ -17,11 +17,14 @@
 import argparse
 import configparser
 import glob
+import hashlib
 import importlib
 import ntpath
 import os
+import shutil
 import subprocess
 import sys
+import tempfile
 
 import onelib.constant as _constant
 
@@ -214,6 +217,112 @@ def _run(cmd, err_prefix=None, logfile=None):
         sys.exit(p.returncode)
 
 
+def _hash_path(path, h):
+    """update hash h with the contents of the file or the directory at path"""
+    if os.path.isdir(path):
+        for root, dirs, files in os.walk(path):
+            dirs.sort()
+            for name in sorted(files):
+                file_path = os.path.join(root, name)
+                h.update(os.path.relpath(file_path, path).encode())
+                _hash_path(file_path, h)
+        return
+    with open(path, 'rb') as f:
+        for chunk in iter(lambda: f.read(1 << 20), b''):
+            h.update(chunk)
+
+
+def _get_cache_key(items, input_paths):
+    """get a key of a step run with given items, like options, and contents of input_paths
+
+    Args:
+        items: list of values which change the outputs of the step
+        input_paths: list of files or directories read by the step
+    """
+    h = hashlib.sha256()
+    for item in items:
+        h.update(str(item).encode() + b'\0')
+    for path in input_paths:
+        _hash_path(os.path.expanduser(path), h)
+        h.update(b'\0')
+    return h.hexdigest()
+
+
+def _get_driver_stamp(driver_path):
+    """get a value which changes when the driver is rebuilt or updated"""
+    stat = os.stat(driver_path)
+    return f'{os.path.realpath(driver_path)}:{stat.st_size}:{stat.st_mtime_ns}'
+
+
+def _get_cmd_cache_key(cmd, input_paths, output_paths):
+    """get a key of cmd, whose arguments in input_paths are hashed by their contents
+
+    Paths of output_paths are replaced by their order in the key, so that outputs written to
+    temporary files have the same key.
+    """
+    items = [_get_driver_stamp(cmd[0])]
+    for arg in cmd[1:]:
+        if arg in output_paths:
+            items.append('output:' + str(output_paths.index(arg)))
+        elif arg in input_paths:
+            items.append('input:' + str(input_paths.index(arg)))
+        else:
+            items.append(arg)
+    return _get_cache_key(items, input_paths)
+
+
+def _get_input_data_paths(input_data, input_data_format):
+    """get files and directories read by record-minmax as its input data"""
+    if not input_data:
+        return []
+    paths = [input_data]
+    if input_data_format in ['list', 'filelist']:
+        with open(os.path.expanduser(input_data)) as f:
+            paths += [line.strip() for line in f if line.strip()]
+    return paths
+
+
+def _copy_path(src, dst):
+    if os.path.isdir(src):
+        if os.path.isdir(dst):
+            shutil.rmtree(dst)
+        shutil.copytree(src, dst)
+    else:
+        shutil.copyfile(src, dst)
+
+
+def _run_cached(cmd, cache_dir, key, output_paths, err_prefix=None, logfile=None):
+    """Execute command like _run, unless its outputs with the same key are in cache_dir
+
+    Outputs are copied from cache_dir if they are cached. Otherwise, they are copied into
+    cache_dir after cmd is executed.
+    """
+    cache_dir = os.path.expanduser(cache_dir)
+    cache_path = os.path.join(cache_dir, key)
+    cached_paths = [os.path.join(cache_path, str(i)) for i in range(len(output_paths))]
+    if os.path.isdir(cache_path) and all(os.path.exists(c) for c in cached_paths):
+        for cached, output in zip(cached_paths, output_paths):
+            _copy_path(cached, os.path.expanduser(output))
+        if logfile != None:
+            logfile.write(('cached: ' + ' '.join(cmd) + '\n').encode())
+        return
+
+    _run(cmd, err_prefix=err_prefix, logfile=logfile)
+
+    # outputs are moved into the cache at once, so that a broken run does not leave a part of them
+    if os.path.isdir(cache_path):
+        shutil.rmtree(cache_path)
+    os.makedirs(cache_dir, exist_ok=True)
+    tmp_path = tempfile.mkdtemp(dir=cache_dir)
+    for i, output in enumerate(output_paths):
+        _copy_path(os.path.expanduser(output), os.path.join(tmp_path, str(i)))
+    try:
+        os.rename(tmp_path, cache_path)
+    except OSError:
+        # cached by another run at the same time
+        shutil.rmtree(tmp_path)
+
+
 def _remove_prefix(str, prefix):
     if str.startswith(prefix):
         return str[len(prefix):]
@@ -54,10 +54,23 @@ int entry(const int argc, char **argv)
     .type(arser::DataType::FLOAT)
     .help("Record n'th percentile of max");
 
-  arser.add_argument("--mode").help("Record mode. percentile (default) or moving_average");
+  arser.add_argument("--mode").help(
+    "Record mode. percentile (default), moving_average or mse. mse records histograms of "
+    "tensors and chooses the range with the least squared error of 8-bit quantization");
 
   arser.add_argument("--input_data_format")
-    .help("Input data format. h5/hdf5 (default) or list/filelist");
+    .help("Input data format. h5/hdf5 (default), list/filelist, directory/dir or minmax. minmax "
+          "is a file of min/max recorded by onert with MINMAX_FILEPATH config");
+
+  arser.add_argument("--batch_size")
+    .type(arser::DataType::INT32)
+    .help("Run the model with this many samples at once. Inputs of the model must have batch 1. "
+          "Tensors with the batch dimension are still recorded per sample (default: 1)");
+
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .help("Split input data between this many interpreters, each run in its own thread. "
+          "Each of them needs its own memory for activations (default: 1)");
 
   arser.add_argument("--generate_profile_data")
     .nargs(0)
@@ -92,6 +105,8 @@ int entry(const int argc, char **argv)
   float min_percentile = 1.0;
   float max_percentile = 99.0;
   std::string input_data_format("h5");
+  int32_t batch_size = 1;
+  int32_t num_threads = 1;
 
   if (arser["--min_percentile"])
     min_percentile = arser.get<float>("--min_percentile");
@@ -102,7 +117,7 @@ int entry(const int argc, char **argv)
   if (arser["--mode"])
     mode = arser.get<std::string>("--mode");
 
-  if (mode != "percentile" && mode != "moving_average")
+  if (mode != "percentile" && mode != "moving_average" && mode != "mse")
     throw std::runtime_error("Unsupported mode");
 
   if (arser["--generate_profile_data"])
@@ -111,10 +126,23 @@ int entry(const int argc, char **argv)
   if (arser["--input_data_format"])
     input_data_format = arser.get<std::string>("--input_data_format");
 
+  if (arser["--batch_size"])
+    batch_size = arser.get<int32_t>("--batch_size");
+
+  if (batch_size < 1)
+    throw std::runtime_error("Batch size must be positive");
+
+  if (arser["--num_threads"])
+    num_threads = arser.get<int32_t>("--num_threads");
+
+  if (num_threads < 1)
+    throw std::runtime_error("Number of threads must be positive");
+
   RecordMinMax rmm;
 
   // Initialize interpreter and observer
-  rmm.initialize(input_model_path);
+  rmm.initialize(input_model_path, static_cast<uint32_t>(batch_size),
+                 static_cast<uint32_t>(num_threads));
 
   if (arser["--input_data"])
   {
@@ -144,10 +172,16 @@ int entry(const int argc, char **argv)
       // The contents of each file is same as the raw data in the 'list' type
       rmm.profileRawDataDirectory(mode, input_data_path, min_percentile, max_percentile);
     }
+    else if (input_data_format == "minmax")
+    {
+      // Use min/max recorded while running the model with another runtime, like onert
+      rmm.profileMinMaxRecords(mode, input_data_path, min_percentile, max_percentile);
+    }
     else
     {
       throw std::runtime_error(
-        "Unsupported input data format (supported formats: h5/hdf5 (default), list/filelist)");
+        "Unsupported input data format (supported formats: h5/hdf5 (default), list/filelist, "
+        "directory/dir, minmax)");
     }
   }
   else
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_HISTOGRAM_H__
+#define __RECORD_MINMAX_HISTOGRAM_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Histogram of values with a fixed number of bins, whose range grows with the data
+ *
+ * @note  When a value is out of the range, the width of bins is doubled by merging pairs of
+ *        adjacent bins, so the counts are kept exactly and the memory does not depend on the
+ *        number of added values.
+ */
+class Histogram
+{
+public:
+  static constexpr uint32_t kNumBins = 2048;
+
+  /**
+   * @brief Add values of data to the histogram
+   *
+   * @note  NaN, infinity and the lowest float number are not added, like they are not recorded
+   *        as min/max.
+   *
+   * @return false if data has no value to add
+   */
+  bool add(const float *data, uint32_t num_elements);
+
+  /**
+   * @brief Add counts of other to the histogram
+   *
+   * @note  Bins of the finer histogram are added to the bins of the coarser one by their centers
+   */
+  void merge(const Histogram &other);
+
+  bool empty() const { return _counts.empty(); }
+
+  // Lower bound of the first bin
+  double lower() const { return _lower; }
+  double binWidth() const { return _width; }
+  const std::vector<uint64_t> &counts() const { return _counts; }
+
+private:
+  double upper() const { return _lower + _width * kNumBins; }
+  void expandLower();
+  void expandUpper();
+
+private:
+  // Range is kept in double, so that doubling bins does not lose precision of float values
+  double _lower = 0.0;
+  double _width = 0.0;
+  std::vector<uint64_t> _counts;
+};
+
+/**
+ * @brief Find [min, max] which minimizes the mean squared error of quantizing the values of
+ *        histogram to num_levels levels
+ *
+ * @note  Range always contains 0 like quantization parameters computed from it
+ */
+void getMSERange(const Histogram &histogram, uint32_t num_levels, float &min, float &max);
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_HISTOGRAM_H__
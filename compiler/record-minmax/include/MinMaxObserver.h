@@ -20,6 +20,9 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
+#include "Histogram.h"
+
+#include <cassert>
 #include <vector>
 #include <unordered_map>
 
@@ -43,6 +46,19 @@ public:
     vectors.max_vector.push_back(max);
   }
 
+  // Append min/max recorded in other after the ones recorded in this
+  void append(const MinMaxMap &other)
+  {
+    for (const auto &item : other._minmax_map)
+    {
+      MinMaxVectors &vectors = _minmax_map[item.first];
+      vectors.min_vector.insert(vectors.min_vector.end(), item.second.min_vector.begin(),
+                                item.second.min_vector.end());
+      vectors.max_vector.insert(vectors.max_vector.end(), item.second.max_vector.begin(),
+                                item.second.max_vector.end());
+    }
+  }
+
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
   {
     return &_minmax_map;
@@ -52,6 +68,31 @@ private:
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
 };
 
+class HistogramMap
+{
+public:
+  // Add values of node to its histogram, return false if there is no value to add
+  bool record(const luci::CircleNode *node, const float *data, uint32_t num_elements)
+  {
+    return _histogram_map[node].add(data, num_elements);
+  }
+
+  // Merge histograms of other to the histograms of the same nodes
+  void append(const HistogramMap &other)
+  {
+    for (const auto &item : other._histogram_map)
+      _histogram_map[item.first].merge(item.second);
+  }
+
+  const std::unordered_map<const luci::CircleNode *, Histogram> *getMap() const
+  {
+    return &_histogram_map;
+  }
+
+private:
+  std::unordered_map<const luci::CircleNode *, Histogram> _histogram_map;
+};
+
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
 {
 public:
@@ -65,8 +106,34 @@ public:
 
   const MinMaxMap *minMaxData() { return &_minmax_data; }
 
+  /**
+   * @brief Record histograms of tensors instead of min/max of every sample
+   *
+   * @note  Memory of a histogram does not depend on the number of recorded samples
+   */
+  void recordHistogram(bool record) { _record_histogram = record; }
+
+  const HistogramMap *histogramData() { return &_histogram_data; }
+
+  /**
+   * @brief Set the batch of the interpreted model and how many of its samples are valid data
+   *
+   * @note  Tensors whose first dimension is the batch are recorded per valid sample. The other
+   *        tensors are recorded as a whole, so invalid samples must be copies of valid ones.
+   */
+  void batch(uint32_t batch_size, uint32_t num_valid_samples)
+  {
+    assert(num_valid_samples > 0 && num_valid_samples <= batch_size);
+    _batch_size = batch_size;
+    _num_valid_samples = num_valid_samples;
+  }
+
 private:
   MinMaxMap _minmax_data;
+  HistogramMap _histogram_data;
+  bool _record_histogram = false;
+  uint32_t _batch_size = 1;
+  uint32_t _num_valid_samples = 1;
 };
 
 } // namespace record_minmax
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __RECORD_MINMAX_MODULE_BATCH_H__
+#define __RECORD_MINMAX_MODULE_BATCH_H__
+
+#include <luci/IR/Module.h>
+
+#include <cstdint>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Change batch dimension of the main graph from 1 to batch_size
+ *
+ * @note  Inputs of the graph must have 1 as the first dimension. Shapes of the graph are inferred
+ *        again and Reshape operators fed by a tensor of the new batch get batch_size as the first
+ *        dimension of their target shape instead of 1.
+ *        This throws an exception if the graph cannot be batched.
+ */
+void setBatchSize(luci::Module *module, uint32_t batch_size);
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MODULE_BATCH_H__
@@ -19,10 +19,15 @@
 
 #include <luci/IR/Module.h>
 #include <luci_interpreter/Interpreter.h>
+#include <mio/circle/schema_generated.h>
 
 #include "MinMaxObserver.h"
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace record_minmax
 {
@@ -34,7 +39,22 @@ public:
 
   ~RecordMinMax() = default;
 
-  void initialize(const std::string &input_model_path);
+  /**
+   * @brief Load model, which is run with batch_size samples at once if batch_size > 1
+   *
+   * @note  If num_threads > 1, records are split into as many contiguous shards, each of which is
+   *        run by its own interpreter in its own thread
+   */
+  void initialize(const std::string &input_model_path, uint32_t batch_size,
+                  uint32_t num_threads = 1);
+
+  /**
+   * @brief Take module already in memory, like initialize with the path of its model
+   *
+   * @note  If batch_size > 1, module is serialized once to import the module with changed batch
+   */
+  void initialize(std::unique_ptr<luci::Module> &&module, uint32_t batch_size,
+                  uint32_t num_threads = 1);
 
   void profileData(const std::string &mode, const std::string &input_data_path,
                    float min_percentile, float max_percentile);
@@ -48,12 +68,72 @@ public:
   void profileDataWithRandomInputs(const std::string &mode, float min_percentile,
                                    float max_percentile);
 
+  /**
+   * @brief Use min/max recorded by another runtime instead of running the interpreter
+   *
+   * @note  Each line of input_data_path is "<run> <min> <max> <tensor name>", like the file
+   *        written by onert with MINMAX_FILEPATH config. Min/max of runs are reduced by mode like
+   *        the ones recorded by the interpreter, so histogram modes are not supported.
+   */
+  void profileMinMaxRecords(const std::string &mode, const std::string &input_data_path,
+                            float min_percentile, float max_percentile);
+
   void saveModel(const std::string &output_model_path);
 
+  /**
+   * @brief Give up the module with recorded min/max, instead of saving it
+   */
+  std::unique_ptr<luci::Module> releaseModule(void);
+
+private:
+  // Import _module and, if batch_size > 1, _batched_module from circle_model
+  void importModules(const circle::Model *circle_model, uint32_t batch_size,
+                     const std::string &model_name);
+  // Create workers interpreting the imported modules
+  void initializeWorkers(uint32_t batch_size, uint32_t num_threads);
+
+private:
+  /**
+   * @brief Interpreter with its own observer and batch, which is used by one thread at a time
+   */
+  struct Worker
+  {
+    std::unique_ptr<luci_interpreter::Interpreter> interpreter;
+    std::unique_ptr<MinMaxObserver> observer;
+    // Input data of the collected samples per input index
+    std::vector<std::vector<char>> batch_data;
+    uint32_t num_samples = 0;
+  };
+
+  // Write one sample of input_node to the batch being collected by worker
+  void writeSample(Worker &worker, const luci::CircleInput *input_node, const void *data,
+                   size_t data_size);
+  // Finish the sample, and run the batch if it is full
+  void commitSample(Worker &worker);
+  // Run the interpreter of worker for the collected samples
+  void runBatch(Worker &worker);
+
+  /**
+   * @brief Record min/max (or histograms, by mode) of records [0, num_records) on all workers
+   *
+   * @note  write_record(worker, record_idx) writes every input of the record with writeSample.
+   *        It is called from the threads of the workers at the same time.
+   */
+  void profileRecords(const std::string &mode, uint32_t num_records,
+                      const std::function<void(Worker &, uint32_t)> &write_record);
+  // Save min/max recorded by all workers to the nodes of _module
+  void updateQuantParam(const std::string &mode, float min_percentile, float max_percentile);
+
 private:
   std::unique_ptr<luci::Module> _module;
-  std::unique_ptr<luci_interpreter::Interpreter> _interpreter;
-  std::unique_ptr<MinMaxObserver> _observer;
+  // Module with changed batch run by the interpreter, if batch size is greater than 1
+  std::unique_ptr<luci::Module> _batched_module;
+  // Workers in the order of their shards
+  std::vector<std::unique_ptr<Worker>> _workers;
+
+  uint32_t _batch_size = 1;
+  // Nodes of _batched_module to the nodes of _module
+  std::unordered_map<const luci::CircleNode *, const luci::CircleNode *> _origin_nodes;
 };
 
 } // namespace record_minmax
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+
+using record_minmax::Histogram;
+
+constexpr uint32_t kNumBins = Histogram::kNumBins;
+
+double binCenter(const Histogram &histogram, uint32_t bin)
+{
+  return histogram.lower() + (bin + 0.5) * histogram.binWidth();
+}
+
+double binEdge(const Histogram &histogram, uint32_t bin)
+{
+  return histogram.lower() + static_cast<double>(bin) * histogram.binWidth();
+}
+
+/**
+ * @brief Non-empty bins [first, last] of histogram, and the bin of 0 clamped to them
+ */
+struct DataBins
+{
+  uint32_t first = 0;
+  uint32_t last = 0;
+  uint32_t zero = 0;
+};
+
+DataBins dataBins(const Histogram &histogram)
+{
+  if (histogram.empty())
+    throw std::runtime_error("Range cannot be computed from an empty histogram");
+
+  const auto &counts = histogram.counts();
+  DataBins bins;
+  while (counts[bins.first] == 0)
+    bins.first++;
+  bins.last = kNumBins - 1;
+  while (counts[bins.last] == 0)
+    bins.last--;
+
+  const double zero = std::floor(-histogram.lower() / histogram.binWidth());
+  const double first = bins.first;
+  const double last = bins.last;
+  bins.zero = static_cast<uint32_t>(std::min(std::max(zero, first), last));
+  return bins;
+}
+
+/**
+ * @brief Prefix sums of counts, count * center and count * center^2 of bins
+ */
+struct PrefixSums
+{
+  explicit PrefixSums(const Histogram &histogram)
+    : count(kNumBins + 1, 0.0), first(kNumBins + 1, 0.0), second(kNumBins + 1, 0.0)
+  {
+    const auto &counts = histogram.counts();
+    for (uint32_t bin = 0; bin < kNumBins; ++bin)
+    {
+      const double n = static_cast<double>(counts[bin]);
+      const double center = binCenter(histogram, bin);
+      count[bin + 1] = count[bin] + n;
+      first[bin + 1] = first[bin] + n * center;
+      second[bin + 1] = second[bin] + n * center * center;
+    }
+  }
+
+  // Sum of squared distances from value of the values in bins [begin, end)
+  double squaredError(uint32_t begin, uint32_t end, double value) const
+  {
+    const double n = count[end] - count[begin];
+    const double s1 = first[end] - first[begin];
+    const double s2 = second[end] - second[begin];
+    return std::max(0.0, s2 - 2.0 * value * s1 + value * value * n);
+  }
+
+  std::vector<double> count;
+  std::vector<double> first;
+  std::vector<double> second;
+};
+
+} // namespace
+
+namespace record_minmax
+{
+
+constexpr uint32_t Histogram::kNumBins;
+
+bool Histogram::add(const float *data, uint32_t num_elements)
+{
+  const float excluded = std::numeric_limits<float>::lowest();
+
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+  bool has_value = false;
+  for (uint32_t i = 0; i < num_elements; ++i)
+  {
+    const float number = data[i];
+    if (!std::isfinite(number) || number == excluded)
+      continue;
+
+    has_value = true;
+    min = std::min(min, number);
+    max = std::max(max, number);
+  }
+
+  if (!has_value)
+    return false;
+
+  if (empty())
+  {
+    _counts.assign(kNumBins, 0);
+    _lower = min;
+    _width = (static_cast<double>(max) - min) / kNumBins;
+    if (_width == 0.0)
+      _width = std::max(std::abs(static_cast<double>(min)), 1.0) / kNumBins;
+    // Rounding must not leave max out of the range
+    while (upper() < max)
+      _width *= 1.0 + 1e-9;
+  }
+
+  while (min < _lower)
+    expandLower();
+  while (max > upper())
+    expandUpper();
+
+  const double scale = 1.0 / _width;
+  for (uint32_t i = 0; i < num_elements; ++i)
+  {
+    const float number = data[i];
+    if (!std::isfinite(number) || number == excluded)
+      continue;
+
+    const auto bin = static_cast<int64_t>((number - _lower) * scale);
+    _counts[std::min<int64_t>(std::max<int64_t>(bin, 0), kNumBins - 1)]++;
+  }
+
+  return true;
+}
+
+void Histogram::merge(const Histogram &other)
+{
+  if (other.empty())
+    return;
+
+  if (empty())
+  {
+    *this = other;
+    return;
+  }
+
+  if (other._width > _width)
+  {
+    Histogram merged = other;
+    merged.merge(*this);
+    *this = std::move(merged);
+    return;
+  }
+
+  const auto bins = dataBins(other);
+  while (binEdge(other, bins.first) < _lower)
+    expandLower();
+  while (binEdge(other, bins.last + 1) > upper())
+    expandUpper();
+
+  for (uint32_t bin = bins.first; bin <= bins.last; ++bin)
+  {
+    const auto to = static_cast<int64_t>((binCenter(other, bin) - _lower) / _width);
+    _counts[std::min<int64_t>(std::max<int64_t>(to, 0), kNumBins - 1)] += other._counts[bin];
+  }
+}
+
+void Histogram::expandLower()
+{
+  // Old bins become the upper half of the new bins
+  std::vector<uint64_t> counts(kNumBins, 0);
+  for (uint32_t bin = 0; bin < kNumBins; ++bin)
+    counts[kNumBins / 2 + bin / 2] += _counts[bin];
+
+  _counts.swap(counts);
+  _lower -= _width * kNumBins;
+  _width *= 2.0;
+}
+
+void Histogram::expandUpper()
+{
+  // Old bins become the lower half of the new bins
+  for (uint32_t bin = 0; bin < kNumBins / 2; ++bin)
+    _counts[bin] = _counts[2 * bin] + _counts[2 * bin + 1];
+  std::fill(_counts.begin() + kNumBins / 2, _counts.end(), 0);
+
+  _width *= 2.0;
+}
+
+void getMSERange(const Histogram &histogram, uint32_t num_levels, float &min, float &max)
+{
+  if (num_levels < 2)
+    throw std::runtime_error("Number of quantization levels must be at least 2");
+
+  const auto bins = dataBins(histogram);
+  const PrefixSums sums(histogram);
+
+  // Values in [lo, hi] have rounding error of uniform distribution, others are clipped
+  double best_error = std::numeric_limits<double>::max();
+  for (uint32_t begin = bins.first; begin <= bins.zero; ++begin)
+  {
+    const double lo = std::min(binEdge(histogram, begin), 0.0);
+    const double below = sums.squaredError(0, begin, lo);
+    for (uint32_t end = bins.zero + 1; end <= bins.last + 1; ++end)
+    {
+      const double hi = std::max(binEdge(histogram, end), 0.0);
+      const double step = (hi - lo) / (num_levels - 1);
+      const double inside = (sums.count[end] - sums.count[begin]) * step * step / 12.0;
+      const double error = below + inside + sums.squaredError(end, kNumBins, hi);
+      if (error < best_error)
+      {
+        best_error = error;
+        min = static_cast<float>(lo);
+        max = static_cast<float>(hi);
+      }
+    }
+  }
+}
+
+} // namespace record_minmax
@@ -18,10 +18,65 @@
 
 #include <luci/IR/CircleOpcode.h>
 
-#include <math.h>
+#include <algorithm>
+#include <limits>
 
 using DataType = luci_interpreter::DataType;
 
+namespace
+{
+
+// Number of independent min/max kept while scanning, so the loop is vectorized without SIMD
+// intrinsics of each target
+constexpr uint32_t kNumLanes = 16;
+
+// Update min/max of a lane with number unless it is NaN or excluded, without branches
+inline void updateLane(float number, float excluded, float &lane_min, float &lane_max)
+{
+  const bool valid = (number == number) & (number != excluded);
+  const float for_min = valid ? number : std::numeric_limits<float>::max();
+  const float for_max = valid ? number : std::numeric_limits<float>::lowest();
+  lane_min = for_min < lane_min ? for_min : lane_min;
+  lane_max = for_max > lane_max ? for_max : lane_max;
+}
+
+// Return false if all numbers are NaN
+bool computeMinMax(const float *data, uint32_t num_elements, float &min, float &max)
+{
+  // TODO use metadata hints to detect such cases
+  const float excluded = std::numeric_limits<float>::lowest();
+
+  float lane_min[kNumLanes];
+  float lane_max[kNumLanes];
+  for (uint32_t l = 0; l < kNumLanes; ++l)
+  {
+    lane_min[l] = std::numeric_limits<float>::max();
+    lane_max[l] = std::numeric_limits<float>::lowest();
+  }
+
+  uint32_t i = 0;
+  for (; i + kNumLanes <= num_elements; i += kNumLanes)
+  {
+    for (uint32_t l = 0; l < kNumLanes; ++l)
+      updateLane(data[i + l], excluded, lane_min[l], lane_max[l]);
+  }
+  for (uint32_t l = 0; i < num_elements; ++i, ++l)
+    updateLane(data[i], excluded, lane_min[l], lane_max[l]);
+
+  min = lane_min[0];
+  max = lane_max[0];
+  for (uint32_t l = 1; l < kNumLanes; ++l)
+  {
+    min = std::min(min, lane_min[l]);
+    max = std::max(max, lane_max[l]);
+  }
+
+  // min and max are not changed if there is no valid number
+  return min <= max;
+}
+
+} // namespace
+
 namespace record_minmax
 {
 
@@ -80,33 +135,39 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   }
 
   const auto data = tensor->data<float>();
-  const auto num_elements = tensor->shape().num_elements();
-
-  std::vector<float> buf(data, data + num_elements);
+  const auto num_elements = static_cast<uint32_t>(tensor->shape().num_elements());
 
-  float max = std::numeric_limits<float>::lowest();
-  float min = std::numeric_limits<float>::max();
+  const auto &shape = tensor->shape();
+  const bool has_batch = _batch_size > 1 && shape.num_dims() > 0 &&
+                         static_cast<uint32_t>(shape.dim(0)) == _batch_size;
 
-  bool all_nan = true;
-  for (auto number : buf)
+  if (_record_histogram)
   {
-    if (isnan(number))
-      continue;
-
-    // TODO use metadata hints to detect such cases
-    if (number == std::numeric_limits<float>::lowest())
-      continue;
-
-    all_nan = false;
+    // Samples after the valid ones are copies of them
+    const uint32_t num_valid_elements =
+      has_batch ? num_elements / _batch_size * _num_valid_samples : num_elements;
+    if (!_histogram_data.record(node, data, num_valid_elements))
+      throw std::runtime_error("All values are NaN(Not a Number)");
+    return;
+  }
 
-    if (number > max)
-      max = number;
+  if (has_batch)
+  {
+    // Record each sample as if it were run alone
+    const uint32_t sample_size = num_elements / _batch_size;
+    for (uint32_t sample = 0; sample < _num_valid_samples; ++sample)
+    {
+      float min{}, max{};
+      if (!computeMinMax(data + sample * sample_size, sample_size, min, max))
+        throw std::runtime_error("All values are NaN(Not a Number)");
 
-    if (number < min)
-      min = number;
+      _minmax_data.recordMinMax(node, min, max);
+    }
+    return;
   }
 
-  if (all_nan)
+  float min{}, max{};
+  if (!computeMinMax(data, num_elements, min, max))
     throw std::runtime_error("All values are NaN(Not a Number)");
 
   _minmax_data.recordMinMax(node, min, max);
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ModuleBatch.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Service/CircleShapeInference.h>
+
+#include <loco.h>
+
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+
+luci::CircleConst *batched_shape(loco::Graph *graph, const luci::CircleConst *shape,
+                                 uint32_t batch_size)
+{
+  auto batched = graph->nodes()->create<luci::CircleConst>();
+  batched->dtype(loco::DataType::S32);
+  batched->rank(1);
+  batched->dim(0).set(shape->size<loco::DataType::S32>());
+  batched->shape_status(luci::ShapeStatus::VALID);
+  batched->size<loco::DataType::S32>(shape->size<loco::DataType::S32>());
+  for (uint32_t i = 0; i < shape->size<loco::DataType::S32>(); ++i)
+    batched->at<loco::DataType::S32>(i) = shape->at<loco::DataType::S32>(i);
+  batched->at<loco::DataType::S32>(0) = static_cast<int32_t>(batch_size);
+  batched->name(shape->name() + "_batched");
+  return batched;
+}
+
+// Target shape of Reshape keeps the batch if it is fed by a tensor of the new batch
+void batch_reshape(luci::CircleReshape *reshape, uint32_t batch_size)
+{
+  auto input = loco::must_cast<luci::CircleNode *>(reshape->tensor());
+  if (input->rank() == 0 || !input->dim(0).known() || input->dim(0).value() != batch_size)
+    return;
+
+  auto new_shape = reshape->newShape();
+  if (new_shape->rank() > 0 && new_shape->dim(0) == 1)
+    new_shape->dim(0) = static_cast<int32_t>(batch_size);
+
+  auto shape = dynamic_cast<luci::CircleConst *>(reshape->shape());
+  if (shape != nullptr && shape->dtype() == loco::DataType::S32 &&
+      shape->size<loco::DataType::S32>() > 0 && shape->at<loco::DataType::S32>(0) == 1)
+  {
+    reshape->shape(batched_shape(reshape->graph(), shape, batch_size));
+  }
+}
+
+void infer_shape(luci::CircleNode *node)
+{
+  loco::TensorShape shape;
+  if (!luci::sinf::Rule().infer(node, shape))
+    throw std::runtime_error("Cannot infer shape of " + node->name() + " with the new batch");
+
+  node->rank(shape.rank());
+  for (uint32_t i = 0; i < shape.rank(); ++i)
+    node->dim(i) = shape.dim(i);
+  node->shape_status(luci::ShapeStatus::VALID);
+}
+
+std::unique_ptr<loco::TensorShape> tensor_shape(const luci::CircleNode *node)
+{
+  auto shape = std::make_unique<loco::TensorShape>();
+  shape->rank(node->rank());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    shape->dim(i) = node->dim(i);
+  return shape;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+void setBatchSize(luci::Module *module, uint32_t batch_size)
+{
+  if (batch_size == 0)
+    throw std::runtime_error("Batch size must be positive");
+
+  auto graph = module->graph();
+  for (auto node : loco::input_nodes(graph))
+  {
+    auto input = loco::must_cast<luci::CircleInput *>(node);
+    if (input->rank() == 0 || !input->dim(0).known() || input->dim(0).value() != 1)
+      throw std::runtime_error("Batch dimension of " + input->name() + " is not 1");
+
+    input->dim(0).set(batch_size);
+    graph->inputs()->at(input->index())->shape(tensor_shape(input));
+  }
+
+  // Inputs are visited before their users, so shapes are inferred again in the order of the flow
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    switch (circle_node->opcode())
+    {
+      case luci::CircleOpcode::CIRCLEINPUT:
+      case luci::CircleOpcode::CIRCLECONST:
+        continue;
+      case luci::CircleOpcode::CIRCLEOUTPUT:
+      {
+        // Shape of output is taken from the graph output, which still has the old batch
+        auto output = loco::must_cast<luci::CircleOutput *>(circle_node);
+        auto from = loco::must_cast<luci::CircleNode *>(output->from());
+        graph->outputs()->at(output->index())->shape(tensor_shape(from));
+        break;
+      }
+      case luci::CircleOpcode::RESHAPE:
+        batch_reshape(loco::must_cast<luci::CircleReshape *>(circle_node), batch_size);
+        break;
+      default:
+        break;
+    }
+    infer_shape(circle_node);
+  }
+}
+
+} // namespace record_minmax
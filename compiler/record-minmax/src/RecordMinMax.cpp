@@ -17,21 +17,32 @@
 #include "RecordMinMax.h"
 #include "RecordFunction.h"
 #include "MinMaxObserver.h"
+#include "ModuleBatch.h"
 
 #include <luci/Importer.h>
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
 #include <luci/IR/CircleQuantParam.h>
 #include <dio_hdf5/HDF5Importer.h>
+#include <dio_hdf5/HDF5Prefetcher.h>
 
 #include <dirent.h>
 #include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <cmath>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <numeric>
 #include <stdexcept>
 #include <iostream>
 #include <random>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 using Shape = std::vector<loco::Dimension>;
 using DataType = loco::DataType;
@@ -39,6 +50,14 @@ using DataType = loco::DataType;
 namespace
 {
 
+// Records [begin, end) of the w'th of num_workers contiguous shards
+std::pair<uint32_t, uint32_t> shardRange(uint32_t num_records, uint32_t w, uint32_t num_workers)
+{
+  const uint32_t begin = static_cast<uint64_t>(num_records) * w / num_workers;
+  const uint32_t end = static_cast<uint64_t>(num_records) * (w + 1) / num_workers;
+  return {begin, end};
+}
+
 uint32_t numElements(const luci::CircleNode *node)
 {
   uint32_t num_elements = 1;
@@ -130,13 +149,58 @@ void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype,
   }
 }
 
-void update_quantparam(record_minmax::MinMaxObserver *observer, const std::string &mode,
-                       float min_percentile, float max_percentile)
+// Number of levels of 8-bit quantization, for which ranges are chosen from histograms
+constexpr uint32_t kNumQuantLevels = 256;
+
+bool isHistogramMode(const std::string &mode) { return mode == "mse"; }
+
+// Return true if node is an output of multi_output_node, like CircleSplitOut of CircleSplit
+bool isVirtualOutputOf(const luci::CircleNode *node, const luci::CircleNode *multi_output_node)
+{
+  return node->arity() == 1 && node->arg(0) == multi_output_node &&
+         node->name() == multi_output_node->name();
+}
+
+void set_minmax(
+  const luci::CircleNode *node,
+  const std::unordered_map<const luci::CircleNode *, const luci::CircleNode *> &origin_nodes,
+  float min, float max)
 {
-  auto minmax_map = observer->minMaxData()->getMap();
+  if (!origin_nodes.empty())
+    node = origin_nodes.at(node);
+
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+
+  assert(node->quantparam() == nullptr);
+
+  auto mutable_node = const_cast<luci::CircleNode *>(node);
+  mutable_node->quantparam(std::move(quantparam));
+}
+
+void update_quantparam(
+  const record_minmax::HistogramMap &histogram_data,
+  const std::unordered_map<const luci::CircleNode *, const luci::CircleNode *> &origin_nodes,
+  const std::string &mode)
+{
+  assert(mode == "mse");
+  for (const auto &item : *histogram_data.getMap())
+  {
+    float min{0.0f}, max{0.0f};
+    record_minmax::getMSERange(item.second, kNumQuantLevels, min, max);
+    set_minmax(item.first, origin_nodes, min, max);
+  }
+}
+
+void update_quantparam(
+  const record_minmax::MinMaxMap &minmax_data,
+  const std::unordered_map<const luci::CircleNode *, const luci::CircleNode *> &origin_nodes,
+  const std::string &mode, float min_percentile, float max_percentile)
+{
+  auto minmax_map = minmax_data.getMap();
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
-    auto node = iter->first;
     auto minmax = iter->second;
 
     float min{0.0f}, max{0.0f};
@@ -151,23 +215,41 @@ void update_quantparam(record_minmax::MinMaxObserver *observer, const std::strin
       max = record_minmax::getMovingAverage(minmax.max_vector, 0.9, 16, false);
     }
     assert(mode == "percentile" || mode == "moving_average");
-    auto quantparam = std::make_unique<luci::CircleQuantParam>();
-    quantparam->min.push_back(min);
-    quantparam->max.push_back(max);
+    set_minmax(iter->first, origin_nodes, min, max);
+  }
+}
+
+// Contract to serialize a module to memory
+class BufferExpContract : public luci::CircleExporter::Contract
+{
+public:
+  explicit BufferExpContract(luci::Module *module) : _module(module) {}
 
-    assert(node->quantparam() == nullptr);
+public:
+  loco::Graph *graph(void) const final { return nullptr; }
+  luci::Module *module(void) const final { return _module; }
 
-    auto mutable_node = const_cast<luci::CircleNode *>(node);
-    mutable_node->quantparam(std::move(quantparam));
+  bool store(const char *ptr, const size_t size) const final
+  {
+    _data.assign(ptr, ptr + size);
+    return true;
   }
-}
+
+public:
+  const std::vector<char> &data(void) const { return _data; }
+
+private:
+  luci::Module *_module;
+  mutable std::vector<char> _data;
+};
 
 } // namespace
 
 namespace record_minmax
 {
 
-void RecordMinMax::initialize(const std::string &input_model_path)
+void RecordMinMax::initialize(const std::string &input_model_path, uint32_t batch_size,
+                              uint32_t num_threads)
 {
   // Load model from the file
   std::ifstream fs(input_model_path, std::ifstream::binary);
@@ -192,19 +274,254 @@ void RecordMinMax::initialize(const std::string &input_model_path)
     throw std::runtime_error("Failed to load '" + input_model_path + "'");
   }
 
+  importModules(circle_model, batch_size, input_model_path);
+  initializeWorkers(batch_size, num_threads);
+}
+
+void RecordMinMax::initialize(std::unique_ptr<luci::Module> &&module, uint32_t batch_size,
+                              uint32_t num_threads)
+{
+  if (module == nullptr)
+    throw std::runtime_error("Module to record is null");
+
+  if (batch_size > 1)
+  {
+    // Nodes of the batched module are matched with the ones of the saved module by the order they
+    // are created in, so both are imported from the same serialized model
+    luci::CircleExporter exporter;
+    BufferExpContract contract(module.get());
+    if (!exporter.invoke(&contract))
+      throw std::runtime_error("Failed to serialize module to record");
+
+    const auto &model_data = contract.data();
+    importModules(circle::GetModel(model_data.data()), batch_size, "module to record");
+  }
+  else
+  {
+    _workers.clear();
+    _module = std::move(module);
+    _batched_module.reset();
+    _origin_nodes.clear();
+  }
+
+  initializeWorkers(batch_size, num_threads);
+}
+
+std::unique_ptr<luci::Module> RecordMinMax::releaseModule(void)
+{
+  // Interpreters refer to the nodes of the modules
+  _workers.clear();
+  _batched_module.reset();
+  _origin_nodes.clear();
+  return std::move(_module);
+}
+
+void RecordMinMax::importModules(const circle::Model *circle_model, uint32_t batch_size,
+                                 const std::string &model_name)
+{
+  // Interpreters of the previous modules are not used any more
+  _workers.clear();
+
   _module = luci::Importer().importModule(circle_model);
 
   if (_module == nullptr)
   {
-    throw std::runtime_error("Failed to load '" + input_model_path + "'");
+    throw std::runtime_error("Failed to load '" + model_name + "'");
   }
 
-  // Initialize interpreter
-  _interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
+  _batched_module.reset();
+  _origin_nodes.clear();
+  if (batch_size > 1)
+  {
+    // The saved model keeps its batch, so the model with changed batch is imported separately.
+    // Nodes of both are created in the same order from the same circle model.
+    _batched_module = luci::Importer().importModule(circle_model);
+    if (_batched_module == nullptr)
+    {
+      throw std::runtime_error("Failed to load '" + model_name + "'");
+    }
+
+    for (size_t g = 0; g < _module->size(); ++g)
+    {
+      auto nodes = _module->graph(g)->nodes();
+      auto batched_nodes = _batched_module->graph(g)->nodes();
+      assert(nodes->size() == batched_nodes->size());
+      for (uint32_t i = 0; i < nodes->size(); ++i)
+      {
+        _origin_nodes[loco::must_cast<const luci::CircleNode *>(batched_nodes->at(i))] =
+          loco::must_cast<const luci::CircleNode *>(nodes->at(i));
+      }
+    }
+  }
+}
+
+void RecordMinMax::initializeWorkers(uint32_t batch_size, uint32_t num_threads)
+{
+  if (batch_size == 0)
+    throw std::runtime_error("Batch size must be positive");
+
+  if (num_threads == 0)
+    throw std::runtime_error("Number of threads must be positive");
 
-  _observer = std::make_unique<MinMaxObserver>();
+  _batch_size = batch_size;
+  const luci::Module *interpreted_module = _module.get();
+  if (_batched_module != nullptr)
+  {
+    setBatchSize(_batched_module.get(), batch_size);
+    interpreted_module = _batched_module.get();
+  }
+
+  const auto input_nodes = loco::input_nodes(_module->graph());
+
+  // Interpreters of the same module share its constants, so each worker has only its activations
+  _workers.clear();
+  for (uint32_t i = 0; i < num_threads; ++i)
+  {
+    auto worker = std::make_unique<Worker>();
+
+    worker->batch_data.assign(input_nodes.size(), std::vector<char>());
+    for (auto input : input_nodes)
+    {
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input);
+      worker->batch_data.at(input_node->index()).resize(getTensorSize(input_node) * batch_size);
+    }
+
+    // Initialize interpreter
+    worker->interpreter = std::make_unique<luci_interpreter::Interpreter>(interpreted_module);
+
+    worker->observer = std::make_unique<MinMaxObserver>();
+
+    worker->interpreter->attachObserver(worker->observer.get());
+
+    _workers.push_back(std::move(worker));
+  }
+}
+
+void RecordMinMax::writeSample(Worker &worker, const luci::CircleInput *input_node,
+                               const void *data, size_t data_size)
+{
+  assert(worker.num_samples < _batch_size);
+  auto &batch_data = worker.batch_data.at(input_node->index());
+  if (data_size * _batch_size != batch_data.size())
+    throw std::runtime_error("Wrong input size of " + input_node->name());
+
+  std::memcpy(batch_data.data() + worker.num_samples * data_size, data, data_size);
+}
+
+void RecordMinMax::commitSample(Worker &worker)
+{
+  worker.num_samples++;
+  if (worker.num_samples == _batch_size)
+    runBatch(worker);
+}
+
+void RecordMinMax::runBatch(Worker &worker)
+{
+  if (worker.num_samples == 0)
+    return;
+
+  // Interpreter knows the nodes of the module it was created from
+  const auto module = _batched_module != nullptr ? _batched_module.get() : _module.get();
+  const auto input_nodes = loco::input_nodes(module->graph());
+  for (auto input : input_nodes)
+  {
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(input);
+    auto &batch_data = worker.batch_data.at(input_node->index());
+
+    // Unused samples repeat the first one, so min/max of the whole batch is not changed
+    const size_t sample_size = batch_data.size() / _batch_size;
+    for (uint32_t sample = worker.num_samples; sample < _batch_size; ++sample)
+      std::memcpy(batch_data.data() + sample * sample_size, batch_data.data(), sample_size);
+
+    worker.interpreter->writeInputTensor(input_node, batch_data.data(), batch_data.size());
+  }
 
-  _interpreter->attachObserver(_observer.get());
+  worker.observer->batch(_batch_size, worker.num_samples);
+  worker.interpreter->interpret();
+  worker.num_samples = 0;
+}
+
+void RecordMinMax::profileRecords(const std::string &mode, uint32_t num_records,
+                                  const std::function<void(Worker &, uint32_t)> &write_record)
+{
+  const auto num_workers = static_cast<uint32_t>(_workers.size());
+  assert(num_workers > 0);
+
+  for (auto &worker : _workers)
+    worker->observer->recordHistogram(isHistogramMode(mode));
+
+  std::mutex cout_mutex;
+  std::vector<std::exception_ptr> errors(num_workers);
+  // Other workers stop at their next record once one of them fails
+  std::atomic<bool> failed{false};
+
+  // Shards are contiguous and merged in their order, so min/max keep the order of records
+  auto run_shard = [&](uint32_t w) {
+    auto &worker = *_workers.at(w);
+    const auto range = shardRange(num_records, w, num_workers);
+    const uint32_t begin = range.first;
+    const uint32_t end = range.second;
+    try
+    {
+      for (uint32_t record_idx = begin; record_idx < end && !failed; ++record_idx)
+      {
+        {
+          std::lock_guard<std::mutex> lock(cout_mutex);
+          std::cout << "Recording " << record_idx << "'th data" << std::endl;
+        }
+
+        write_record(worker, record_idx);
+        commitSample(worker);
+      }
+      runBatch(worker);
+    }
+    catch (...)
+    {
+      errors.at(w) = std::current_exception();
+      failed = true;
+    }
+  };
+
+  // The calling thread runs the first shard
+  std::vector<std::thread> threads;
+  for (uint32_t w = 1; w < num_workers; ++w)
+    threads.emplace_back(run_shard, w);
+  run_shard(0);
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+void RecordMinMax::updateQuantParam(const std::string &mode, float min_percentile,
+                                    float max_percentile)
+{
+  if (isHistogramMode(mode))
+  {
+    HistogramMap histogram_data;
+    for (auto &worker : _workers)
+      histogram_data.append(*worker->observer->histogramData());
+
+    update_quantparam(histogram_data, _origin_nodes, mode);
+    return;
+  }
+
+  if (_workers.size() == 1)
+  {
+    update_quantparam(*_workers.at(0)->observer->minMaxData(), _origin_nodes, mode,
+                      min_percentile, max_percentile);
+    return;
+  }
+
+  MinMaxMap minmax_data;
+  for (auto &worker : _workers)
+    minmax_data.append(*worker->observer->minMaxData());
+
+  update_quantparam(minmax_data, _origin_nodes, mode, min_percentile, max_percentile);
 }
 
 // input_data_path is a path to the directory
@@ -223,7 +540,6 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
     throw std::runtime_error("Cannot open directory. Please check \"" + input_data_path +
                              "\" is a directory.\n");
 
-  uint32_t num_records = 0;
   const auto input_nodes = loco::input_nodes(_module->graph());
 
   // Get total input size
@@ -235,20 +551,29 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
     total_input_size += getTensorSize(input_node);
   }
 
+  // Files are listed first to be split between workers
+  std::vector<std::string> records;
   while (entry = readdir(dp))
   {
     // Skip if the entry is not a regular file
     if (entry->d_type != DT_REG)
       continue;
 
-    const std::string filename = entry->d_name;
-    std::cout << "Recording " << num_records << "'th data" << std::endl;
+    records.emplace_back(input_data_path + "/" + entry->d_name);
+  }
 
+  closedir(dp);
+
+  const auto num_records = static_cast<uint32_t>(records.size());
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  profileRecords(mode, num_records, [&](Worker &worker, uint32_t record_idx) {
     // Read data from file to buffer
     // Assumption: For a multi-input model, the binary file should have inputs concatenated in the
     // same order with the input index.
     std::vector<char> input_data(total_input_size);
-    readDataFromFile(input_data_path + "/" + filename, input_data, total_input_size);
+    readDataFromFile(records.at(record_idx), input_data, total_input_size);
 
     // Write data from buffer to interpreter
     uint32_t offset = 0;
@@ -256,24 +581,15 @@ void RecordMinMax::profileRawDataDirectory(const std::string &mode,
     {
       const auto *input_node = loco::must_cast<const luci::CircleInput *>(input);
       const auto input_size = getTensorSize(input_node);
-      _interpreter->writeInputTensor(input_node, input_data.data() + offset, input_size);
+      writeSample(worker, input_node, input_data.data() + offset, input_size);
 
       offset += input_size;
     }
-
-    _interpreter->interpret();
-
-    num_records++;
-  }
-
-  closedir(dp);
-
-  if (num_records == 0)
-    throw std::runtime_error("The input data file does not contain any record.");
+  });
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  updateQuantParam(mode, min_percentile, max_percentile);
 }
 
 // input_data_path is a text file which specifies the representative data
@@ -289,8 +605,6 @@ void RecordMinMax::profileRawData(const std::string &mode, const std::string &in
   if (input_file.fail())
     throw std::runtime_error("Cannot open file \"" + input_data_path + "\".\n");
 
-  std::string record;
-  uint32_t num_records = 0;
   const auto input_nodes = loco::input_nodes(_module->graph());
 
   // Get total input size
@@ -302,15 +616,22 @@ void RecordMinMax::profileRawData(const std::string &mode, const std::string &in
     total_input_size += getTensorSize(input_node);
   }
 
+  // Paths are read first to be split between workers
+  std::vector<std::string> records;
+  std::string record;
   while (getline(input_file, record))
-  {
-    std::cout << "Recording " << num_records << "'th data" << std::endl;
+    records.push_back(record);
+
+  const auto num_records = static_cast<uint32_t>(records.size());
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
 
+  profileRecords(mode, num_records, [&](Worker &worker, uint32_t record_idx) {
     // Read data from file to buffer
     // Assumption: For a multi-input model, the binary file should have inputs concatenated in the
     // same order with the input index.
     std::vector<char> input_data(total_input_size);
-    readDataFromFile(record, input_data, total_input_size);
+    readDataFromFile(records.at(record_idx), input_data, total_input_size);
 
     // Write data from buffer to interpreter
     uint32_t offset = 0;
@@ -318,22 +639,15 @@ void RecordMinMax::profileRawData(const std::string &mode, const std::string &in
     {
       const auto *input_node = loco::must_cast<const luci::CircleInput *>(input);
       const auto input_size = getTensorSize(input_node);
-      _interpreter->writeInputTensor(input_node, input_data.data() + offset, input_size);
+      writeSample(worker, input_node, input_data.data() + offset, input_size);
 
       offset += input_size;
     }
-
-    _interpreter->interpret();
-
-    num_records++;
-  }
-
-  if (num_records == 0)
-    throw std::runtime_error("The input data file does not contain any record.");
+  });
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  updateQuantParam(mode, min_percentile, max_percentile);
 }
 
 void RecordMinMax::profileData(const std::string &mode, const std::string &input_data_path,
@@ -353,42 +667,49 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
     const auto input_nodes = loco::input_nodes(_module->graph());
     const auto num_inputs = input_nodes.size();
 
-    for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
+    for (auto input : input_nodes)
+      checkInputDimension(loco::must_cast<const luci::CircleInput *>(input));
+
+    // Each worker reads its shard ahead on its own thread, at most a batch of records
+    // NOTE Reads of all threads are serialized by dio_hdf5, as HDF5 library is not thread-safe
+    using dio::hdf5::HDF5Prefetcher;
+    const auto num_workers = static_cast<uint32_t>(_workers.size());
+    const uint32_t num_inflight = std::max<uint32_t>(_batch_size, 2);
+    std::unordered_map<const Worker *, std::unique_ptr<HDF5Prefetcher>> prefetchers;
+    for (uint32_t w = 0; w < num_workers; ++w)
     {
-      if (num_inputs != importer.numInputs(record_idx))
-        throw std::runtime_error("Wrong number of inputs.");
+      const auto range = shardRange(num_records, w, num_workers);
+      prefetchers[_workers.at(w).get()] = std::make_unique<HDF5Prefetcher>(
+        importer, range.first, range.second, num_inflight);
+    }
 
-      std::cout << "Recording " << record_idx << "'th data" << std::endl;
+    profileRecords(mode, num_records, [&](Worker &worker, uint32_t record_idx) {
+      auto &prefetcher = *prefetchers.at(&worker);
+      auto record = prefetcher.next();
+      assert(record != nullptr && record->index == static_cast<int32_t>(record_idx));
+      (void)record_idx;
+
+      if (num_inputs != record->tensors.size())
+        throw std::runtime_error("Wrong number of inputs.");
 
       for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
       {
         const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
         assert(input_node->index() == input_idx);
-        checkInputDimension(input_node);
-        std::vector<char> input_data(getTensorSize(input_node));
+        const auto &tensor = record->tensors.at(input_idx);
 
+        // Skip type/shape check for raw data
         if (!is_raw_data)
         {
-          DataType dtype;
-          Shape shape;
-          importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data());
-
           // Check the type and the shape of the input data is valid
-          verifyTypeShape(input_node, dtype, shape);
-        }
-        else
-        {
-          // Skip type/shape check for raw data
-          importer.readTensor(record_idx, input_idx, input_data.data());
+          verifyTypeShape(input_node, tensor.dtype, tensor.shape);
         }
 
-        // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
-        //       We can redcue the copy by directly writing data from file to interpreter inputs
-        _interpreter->writeInputTensor(input_node, input_data.data(), input_data.size());
+        writeSample(worker, input_node, tensor.buffer.data(), tensor.buffer.size());
       }
 
-      _interpreter->interpret();
-    }
+      prefetcher.recycle(std::move(record));
+    });
 
     std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
   }
@@ -398,7 +719,7 @@ void RecordMinMax::profileData(const std::string &mode, const std::string &input
     throw std::runtime_error("HDF5 error occurred.");
   }
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  updateQuantParam(mode, min_percentile, max_percentile);
 }
 
 void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float min_percentile,
@@ -413,10 +734,11 @@ void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float mi
   std::random_device rd;
   std::mt19937 gen(rd());
   std::uniform_real_distribution<> dist(-5, 5);
+  // Generator is shared by the workers
+  std::mutex gen_mutex;
 
-  for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
-  {
-    std::cout << "Recording " << record_idx << "'th data" << std::endl;
+  profileRecords(mode, num_records, [&](Worker &worker, uint32_t) {
+    std::lock_guard<std::mutex> lock(gen_mutex);
 
     for (int32_t input_idx = 0; input_idx < num_inputs; input_idx++)
     {
@@ -442,35 +764,104 @@ void RecordMinMax::profileDataWithRandomInputs(const std::string &mode, float mi
 
         // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
         //       We can redcue the copy by directly writing data from file to interpreter inputs
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(float));
+        writeSample(worker, input_node, input_data.data(), input_data.size() * sizeof(float));
       }
       else if (input_node->dtype() == DataType::BOOL)
       {
         auto input_data = genRandomBoolData(gen, num_elements);
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(uint8_t));
+        writeSample(worker, input_node, input_data.data(), input_data.size() * sizeof(uint8_t));
       }
       else if (input_node->dtype() == DataType::S32)
       {
         auto input_data = genRandomIntData<int32_t>(gen, num_elements, 0, 100);
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(int32_t));
+        writeSample(worker, input_node, input_data.data(), input_data.size() * sizeof(int32_t));
       }
       else if (input_node->dtype() == DataType::S64)
       {
         auto input_data = genRandomIntData<int64_t>(gen, num_elements, 0, 100);
-        _interpreter->writeInputTensor(input_node, input_data.data(),
-                                       input_data.size() * sizeof(int64_t));
+        writeSample(worker, input_node, input_data.data(), input_data.size() * sizeof(int64_t));
       }
     }
+  });
 
-    _interpreter->interpret();
+  std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
+
+  updateQuantParam(mode, min_percentile, max_percentile);
+}
+
+void RecordMinMax::profileMinMaxRecords(const std::string &mode,
+                                        const std::string &input_data_path, float min_percentile,
+                                        float max_percentile)
+{
+  if (isHistogramMode(mode))
+    throw std::runtime_error("Min/max records cannot be used in " + mode + " mode");
+
+  std::ifstream input_file(input_data_path);
+  if (input_file.fail())
+    throw std::runtime_error("Cannot open file \"" + input_data_path + "\".\n");
+
+  // Activations of all graphs by their names, nullptr if the name is not unique
+  // NOTE Operators with multiple outputs have the name of their first virtual output, whose tensor
+  //      is the one recorded
+  std::unordered_map<std::string, const luci::CircleNode *> nodes;
+  for (size_t g = 0; g < _module->size(); ++g)
+  {
+    for (auto node : loco::all_nodes(_module->graph(g)))
+    {
+      const auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+      if (circle_node->opcode() == luci::CircleOpcode::CIRCLECONST ||
+          circle_node->opcode() == luci::CircleOpcode::CIRCLEOUTPUT ||
+          circle_node->dtype() != DataType::FLOAT32 || circle_node->name().empty())
+        continue;
+
+      auto result = nodes.emplace(circle_node->name(), circle_node);
+      if (result.second)
+        continue;
+
+      auto &named = result.first->second;
+      if (named == nullptr)
+        continue;
+      if (isVirtualOutputOf(circle_node, named))
+        named = circle_node;
+      else if (!isVirtualOutputOf(named, circle_node))
+        named = nullptr;
+    }
   }
 
-  std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
+  MinMaxMap minmax_data;
+  std::string line;
+  uint64_t num_lines = 0;
+  uint64_t num_runs = 0;
+  while (std::getline(input_file, line))
+  {
+    if (line.empty())
+      continue;
+
+    std::istringstream record(line);
+    uint64_t run = 0;
+    float min = 0.0f, max = 0.0f;
+    if (!(record >> run >> min >> max) || record.get() != ' ')
+      throw std::runtime_error("Invalid min/max record \"" + line + "\"");
+    std::string name;
+    std::getline(record, name);
+
+    num_lines++;
+    num_runs = std::max(num_runs, run + 1);
+
+    auto node = nodes.find(name);
+    if (node == nodes.end() || node->second == nullptr)
+      continue;
+
+    minmax_data.recordMinMax(node->second, min, max);
+  }
+
+  if (num_lines == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
+
+  std::cout << "Recording finished. Number of recorded data: " << num_runs << std::endl;
 
-  update_quantparam(_observer.get(), mode, min_percentile, max_percentile);
+  // Nodes are the ones of _module, not of the batched module
+  update_quantparam(minmax_data, {}, mode, min_percentile, max_percentile);
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Histogram.h"
+
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+namespace
+{
+
+uint64_t totalCount(const Histogram &histogram)
+{
+  const auto &counts = histogram.counts();
+  return std::accumulate(counts.begin(), counts.end(), uint64_t(0));
+}
+
+std::vector<float> normalData(uint32_t size, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  std::normal_distribution<float> dist(0.0f, 1.0f);
+  std::vector<float> data(size);
+  for (auto &value : data)
+    value = dist(gen);
+  return data;
+}
+
+} // namespace
+
+TEST(HistogramTest, Add)
+{
+  std::vector<float> data{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+
+  Histogram histogram;
+  EXPECT_TRUE(histogram.empty());
+  EXPECT_TRUE(histogram.add(data.data(), data.size()));
+
+  EXPECT_FALSE(histogram.empty());
+  EXPECT_EQ(Histogram::kNumBins, histogram.counts().size());
+  EXPECT_EQ(5, totalCount(histogram));
+  EXPECT_DOUBLE_EQ(0.0, histogram.lower());
+  EXPECT_EQ(1, histogram.counts().front());
+  EXPECT_EQ(1, histogram.counts().back());
+}
+
+TEST(HistogramTest, Expand)
+{
+  std::vector<float> first{0.0f, 1.0f};
+  std::vector<float> second{-3.0f, 5.0f};
+
+  Histogram histogram;
+  histogram.add(first.data(), first.size());
+  const double width = histogram.binWidth();
+  histogram.add(second.data(), second.size());
+
+  // Range is doubled until it covers new values, and no count is lost
+  EXPECT_EQ(4, totalCount(histogram));
+  EXPECT_LE(histogram.lower(), -3.0);
+  EXPECT_GE(histogram.lower() + histogram.binWidth() * Histogram::kNumBins, 5.0);
+  EXPECT_DOUBLE_EQ(std::round(std::log2(histogram.binWidth() / width)),
+                   std::log2(histogram.binWidth() / width));
+}
+
+TEST(HistogramTest, SkipInvalid)
+{
+  std::vector<float> data{std::numeric_limits<float>::quiet_NaN(),
+                          std::numeric_limits<float>::infinity(),
+                          std::numeric_limits<float>::lowest(), 1.0f};
+
+  Histogram histogram;
+  EXPECT_TRUE(histogram.add(data.data(), data.size()));
+  EXPECT_EQ(1, totalCount(histogram));
+}
+
+TEST(HistogramTest, SkipInvalid_NEG)
+{
+  std::vector<float> data{std::numeric_limits<float>::quiet_NaN()};
+
+  Histogram histogram;
+  EXPECT_FALSE(histogram.add(data.data(), data.size()));
+  EXPECT_TRUE(histogram.empty());
+}
+
+TEST(HistogramTest, Merge)
+{
+  const auto data = normalData(1000, 1);
+  const auto other_data = normalData(1000, 2);
+
+  Histogram histogram;
+  histogram.add(data.data(), data.size());
+  Histogram other;
+  other.add(other_data.data(), other_data.size());
+  Histogram empty;
+
+  histogram.merge(other);
+  histogram.merge(empty);
+  EXPECT_EQ(2000, totalCount(histogram));
+
+  empty.merge(other);
+  EXPECT_EQ(1000, totalCount(empty));
+}
+
+TEST(HistogramTest, MSERange)
+{
+  // Outliers are clipped
+  auto data = normalData(100000, 3);
+  data.push_back(100.0f);
+  data.push_back(-100.0f);
+
+  Histogram histogram;
+  histogram.add(data.data(), data.size());
+
+  float min = 0.0f, max = 0.0f;
+  getMSERange(histogram, 256, min, max);
+  EXPECT_LT(-100.0f, min);
+  EXPECT_GT(-2.0f, min);
+  EXPECT_GT(100.0f, max);
+  EXPECT_LT(2.0f, max);
+}
+
+TEST(HistogramTest, MSERange_Positive)
+{
+  std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f};
+
+  Histogram histogram;
+  histogram.add(data.data(), data.size());
+
+  // Range contains 0
+  float min = -1.0f, max = 0.0f;
+  getMSERange(histogram, 256, min, max);
+  EXPECT_FLOAT_EQ(0.0f, min);
+  EXPECT_NEAR(4.0f, max, 0.01f);
+}
+
+TEST(HistogramTest, MSERange_NEG)
+{
+  Histogram histogram;
+  float min = 0.0f, max = 0.0f;
+
+  EXPECT_ANY_THROW(getMSERange(histogram, 256, min, max));
+  EXPECT_ANY_THROW(getMSERange(histogram, 1, min, max));
+}
+
+} // namespace record_minmax
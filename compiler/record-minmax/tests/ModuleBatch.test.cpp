@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "ModuleBatch.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+namespace
+{
+
+/**
+ *  Graph with Reshape keeping the batch
+ *
+ *     [Input]  [Const]
+ *   [1, 2, 3]    [1, 6]
+ *         \      /
+ *        [Reshape]
+ *            |
+ *        [Relu]
+ *            |
+ *        [Output]
+ */
+class ReshapeGraph
+{
+public:
+  ReshapeGraph(uint32_t input_batch)
+  {
+    _module = std::make_unique<luci::Module>();
+    auto graph = loco::make_graph();
+    auto g = graph.get();
+
+    _input = g->nodes()->create<luci::CircleInput>();
+    auto graph_input = g->inputs()->create();
+    _input->index(graph_input->index());
+    _input->dtype(loco::DataType::FLOAT32);
+    _input->shape({input_batch, 2, 3});
+    _input->shape_status(luci::ShapeStatus::VALID);
+    _input->name("input");
+
+    _shape = g->nodes()->create<luci::CircleConst>();
+    _shape->dtype(loco::DataType::S32);
+    _shape->shape({2});
+    _shape->shape_status(luci::ShapeStatus::VALID);
+    _shape->size<loco::DataType::S32>(2);
+    _shape->at<loco::DataType::S32>(0) = 1;
+    _shape->at<loco::DataType::S32>(1) = 6;
+    _shape->name("shape");
+
+    _reshape = g->nodes()->create<luci::CircleReshape>();
+    _reshape->tensor(_input);
+    _reshape->shape(_shape);
+    _reshape->newShape()->rank(2);
+    _reshape->newShape()->dim(0) = 1;
+    _reshape->newShape()->dim(1) = 6;
+    _reshape->dtype(loco::DataType::FLOAT32);
+    _reshape->rank(2);
+    _reshape->dim(0).set(1);
+    _reshape->dim(1).set(6);
+    _reshape->shape_status(luci::ShapeStatus::VALID);
+    _reshape->name("reshape");
+
+    _relu = g->nodes()->create<luci::CircleRelu>();
+    _relu->features(_reshape);
+    _relu->dtype(loco::DataType::FLOAT32);
+    _relu->shape({1, 6});
+    _relu->shape_status(luci::ShapeStatus::VALID);
+    _relu->name("relu");
+
+    _output = g->nodes()->create<luci::CircleOutput>();
+    auto graph_output = g->outputs()->create();
+    _output->index(graph_output->index());
+    _output->from(_relu);
+    _output->dtype(loco::DataType::FLOAT32);
+    _output->shape({1, 6});
+    _output->shape_status(luci::ShapeStatus::VALID);
+    _output->name("output");
+
+    _module->add(std::move(graph));
+  }
+
+public:
+  std::unique_ptr<luci::Module> _module;
+  luci::CircleInput *_input = nullptr;
+  luci::CircleConst *_shape = nullptr;
+  luci::CircleReshape *_reshape = nullptr;
+  luci::CircleRelu *_relu = nullptr;
+  luci::CircleOutput *_output = nullptr;
+};
+
+} // namespace
+
+TEST(ModuleBatchTest, reshape)
+{
+  ReshapeGraph g(1);
+
+  setBatchSize(g._module.get(), 4);
+
+  EXPECT_EQ(4, g._input->dim(0).value());
+  EXPECT_EQ(4, g._reshape->newShape()->dim(0));
+  auto shape = dynamic_cast<luci::CircleConst *>(g._reshape->shape());
+  ASSERT_NE(nullptr, shape);
+  EXPECT_EQ(4, shape->at<loco::DataType::S32>(0));
+  EXPECT_EQ(6, shape->at<loco::DataType::S32>(1));
+  // Original shape is not changed
+  EXPECT_EQ(1, g._shape->at<loco::DataType::S32>(0));
+
+  ASSERT_EQ(2, g._relu->rank());
+  EXPECT_EQ(4, g._relu->dim(0).value());
+  EXPECT_EQ(6, g._relu->dim(1).value());
+  EXPECT_EQ(4, g._output->dim(0).value());
+
+  auto graph = g._module->graph();
+  EXPECT_EQ(4, graph->inputs()->at(0)->shape()->dim(0).value());
+  EXPECT_EQ(4, graph->outputs()->at(0)->shape()->dim(0).value());
+}
+
+TEST(ModuleBatchTest, input_batch_not_1_NEG)
+{
+  ReshapeGraph g(2);
+
+  EXPECT_ANY_THROW(setBatchSize(g._module.get(), 4));
+}
+
+TEST(ModuleBatchTest, zero_batch_NEG)
+{
+  ReshapeGraph g(1);
+
+  EXPECT_ANY_THROW(setBatchSize(g._module.get(), 0));
+}
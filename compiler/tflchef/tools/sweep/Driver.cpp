@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Template.h"
+
+#include "tflchef/ModelChef.h"
+
+#include <google/protobuf/text_format.h>
+
+#include <arser/arser.h>
+
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::string base_name(const std::string &path)
+{
+  auto name = path.substr(path.find_last_of('/') + 1);
+  for (const std::string ext : {".template", ".recipe"})
+  {
+    if (name.size() > ext.size() && name.compare(name.size() - ext.size(), ext.size(), ext) == 0)
+      name.resize(name.size() - ext.size());
+  }
+  return name;
+}
+
+// Create a directory, which may exist already
+bool make_dir(const std::string &path)
+{
+  return ::mkdir(path.c_str(), 0775) == 0 || errno == EEXIST;
+}
+
+void write_file(const std::string &path, const char *data, size_t size)
+{
+  std::ofstream os{path, std::ios::binary};
+  os.write(data, size);
+  if (!os)
+    throw std::runtime_error("Failed to write '" + path + "'");
+}
+
+// MANIFEST of an nnpackage with a model, like model2nnpkg.sh writes
+std::string manifest(const std::string &model_file)
+{
+  std::ostringstream os;
+  os << "{" << std::endl;
+  os << "  \"major-version\" : \"1\"," << std::endl;
+  os << "  \"minor-version\" : \"2\"," << std::endl;
+  os << "  \"patch-version\" : \"0\"," << std::endl;
+  os << "  \"configs\"     : [ ]," << std::endl;
+  os << "  \"models\"      : [ \"" << model_file << "\" ]," << std::endl;
+  os << "  \"model-types\" : [ \"tflite\" ]" << std::endl;
+  os << "}" << std::endl;
+  return os.str();
+}
+
+} // namespace
+
+int entry(int argc, char **argv)
+{
+  arser::Arser arser{"tflchef-sweep cooks a tflite model for every combination of parameters "
+                     "of a recipe template, where ${expression} of parameters is replaced"};
+  arser.add_argument("template").help("Source recipe template file path");
+  arser.add_argument("output").help("Target directory path to write models");
+  arser.add_argument("--param")
+    .nargs(1)
+    .type(arser::DataType::STR_VEC)
+    .accumulated(true)
+    .help("Values of a parameter to sweep as NAME=V1,V2,... (can be repeated)");
+  arser.add_argument("--nnpackage")
+    .nargs(0)
+    .help("Write each model as an nnpackage, which nnpackage_run runs");
+  arser.add_argument("--save_recipe").nargs(0).help("Write each recipe next to its model");
+
+  try
+  {
+    arser.parse(argc, argv);
+  }
+  catch (const std::runtime_error &err)
+  {
+    std::cout << err.what() << std::endl;
+    std::cout << arser;
+    return 255;
+  }
+
+  const auto template_path = arser.get<std::string>("template");
+  const auto output_dir = arser.get<std::string>("output");
+  const bool nnpackage = arser["--nnpackage"];
+  const bool save_recipe = arser["--save_recipe"];
+
+  std::string text;
+  {
+    std::ifstream is{template_path};
+    if (!is)
+    {
+      std::cerr << "ERROR: Failed to open recipe template '" << template_path << "'" << std::endl;
+      return 255;
+    }
+    std::ostringstream ss;
+    ss << is.rdbuf();
+    text = ss.str();
+  }
+
+  try
+  {
+    std::vector<tflchef::sweep::Axis> axes;
+    if (arser["--param"])
+    {
+      for (const auto &values : arser.get<std::vector<std::vector<std::string>>>("--param"))
+        axes.push_back(tflchef::sweep::parse_axis(values.at(0)));
+    }
+
+    if (!make_dir(output_dir))
+      throw std::runtime_error("Failed to create '" + output_dir + "'");
+
+    for (const auto &params : tflchef::sweep::combinations(axes))
+    {
+      // e.g. Conv2D_H32_W32_C16
+      auto name = base_name(template_path);
+      for (const auto &axis : axes)
+        name += "_" + axis.name + std::to_string(params.at(axis.name));
+
+      const auto recipe = tflchef::sweep::expand(text, params);
+
+      ::tflchef::ModelRecipe model_recipe;
+      if (!google::protobuf::TextFormat::ParseFromString(recipe, &model_recipe))
+        throw std::runtime_error("Failed to parse recipe '" + name + "'");
+
+      auto generated_model = tflchef::cook(model_recipe);
+
+      auto dir = output_dir;
+      if (nnpackage)
+      {
+        dir += "/" + name;
+        if (!make_dir(dir) || !make_dir(dir + "/metadata"))
+          throw std::runtime_error("Failed to create '" + dir + "'");
+        const auto content = manifest(name + ".tflite");
+        write_file(dir + "/metadata/MANIFEST", content.data(), content.size());
+      }
+      write_file(dir + "/" + name + ".tflite", generated_model.base(), generated_model.size());
+      if (save_recipe)
+        write_file(dir + "/" + name + ".recipe", recipe.data(), recipe.size());
+
+      std::cout << dir << "/" << name << (nnpackage ? "" : ".tflite") << std::endl;
+    }
+  }
+  catch (const std::exception &err)
+  {
+    std::cerr << "ERROR: " << err.what() << std::endl;
+    return 255;
+  }
+
+  return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Template.h"
+
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+
+using tflchef::sweep::Params;
+
+/**
+ * @brief Recursive descent parser of expression := term (('+' | '-') term)*
+ *                                    term := factor (('*' | '/' | '%') factor)*
+ *                                    factor := ('-' factor) | '(' expression ')' | number | name
+ */
+class Evaluator
+{
+public:
+  Evaluator(const std::string &text, const Params &params) : _text(text), _params(params) {}
+
+public:
+  int64_t run(void)
+  {
+    auto value = expression();
+    skip_spaces();
+    if (_pos != _text.size())
+      error("unexpected '" + _text.substr(_pos, 1) + "'");
+    return value;
+  }
+
+private:
+  int64_t expression(void)
+  {
+    auto value = term();
+    while (true)
+    {
+      if (consume('+'))
+        value += term();
+      else if (consume('-'))
+        value -= term();
+      else
+        return value;
+    }
+  }
+
+  int64_t term(void)
+  {
+    auto value = factor();
+    while (true)
+    {
+      if (consume('*'))
+        value *= factor();
+      else if (consume('/'))
+        value /= nonzero(factor());
+      else if (consume('%'))
+        value %= nonzero(factor());
+      else
+        return value;
+    }
+  }
+
+  int64_t factor(void)
+  {
+    if (consume('-'))
+      return -factor();
+    if (consume('('))
+    {
+      auto value = expression();
+      if (!consume(')'))
+        error("missing ')'");
+      return value;
+    }
+
+    skip_spaces();
+    const auto begin = _pos;
+    if (_pos < _text.size() && std::isdigit(static_cast<unsigned char>(_text[_pos])))
+    {
+      while (_pos < _text.size() && std::isdigit(static_cast<unsigned char>(_text[_pos])))
+        ++_pos;
+      return std::stoll(_text.substr(begin, _pos - begin));
+    }
+    while (_pos < _text.size() &&
+           (std::isalnum(static_cast<unsigned char>(_text[_pos])) || _text[_pos] == '_'))
+      ++_pos;
+    if (begin == _pos)
+      error("missing a value");
+
+    const auto name = _text.substr(begin, _pos - begin);
+    auto it = _params.find(name);
+    if (it == _params.end())
+      error("unknown parameter '" + name + "'");
+    return it->second;
+  }
+
+  bool consume(char c)
+  {
+    skip_spaces();
+    if (_pos < _text.size() && _text[_pos] == c)
+    {
+      ++_pos;
+      return true;
+    }
+    return false;
+  }
+
+  void skip_spaces(void)
+  {
+    while (_pos < _text.size() && std::isspace(static_cast<unsigned char>(_text[_pos])))
+      ++_pos;
+  }
+
+  int64_t nonzero(int64_t value)
+  {
+    if (value == 0)
+      error("division by zero");
+    return value;
+  }
+
+  [[noreturn]] void error(const std::string &message)
+  {
+    throw std::runtime_error("Invalid expression '" + _text + "': " + message);
+  }
+
+private:
+  const std::string &_text;
+  const Params &_params;
+  size_t _pos = 0;
+};
+
+} // namespace
+
+namespace tflchef
+{
+namespace sweep
+{
+
+int64_t evaluate(const std::string &expression, const Params &params)
+{
+  return Evaluator(expression, params).run();
+}
+
+std::string expand(const std::string &text, const Params &params)
+{
+  std::string result;
+  size_t pos = 0;
+  while (true)
+  {
+    const auto begin = text.find("${", pos);
+    if (begin == std::string::npos)
+      break;
+    const auto end = text.find('}', begin);
+    if (end == std::string::npos)
+      throw std::runtime_error("Unterminated '${' in recipe template");
+
+    result += text.substr(pos, begin - pos);
+    result += std::to_string(evaluate(text.substr(begin + 2, end - begin - 2), params));
+    pos = end + 1;
+  }
+  result += text.substr(pos);
+  return result;
+}
+
+Axis parse_axis(const std::string &spec)
+{
+  const auto assign = spec.find('=');
+  if (assign == std::string::npos || assign == 0)
+    throw std::runtime_error("Invalid parameter '" + spec + "', which must be NAME=V1,V2,...");
+
+  Axis axis;
+  axis.name = spec.substr(0, assign);
+  std::istringstream values{spec.substr(assign + 1)};
+  std::string value;
+  while (std::getline(values, value, ','))
+    axis.values.push_back(evaluate(value, Params{}));
+  if (axis.values.empty())
+    throw std::runtime_error("Parameter '" + axis.name + "' has no value");
+  return axis;
+}
+
+std::vector<Params> combinations(const std::vector<Axis> &axes)
+{
+  std::vector<Params> result{Params{}};
+  for (const auto &axis : axes)
+  {
+    std::vector<Params> next;
+    for (const auto &params : result)
+    {
+      for (auto value : axis.values)
+      {
+        auto extended = params;
+        extended[axis.name] = value;
+        next.push_back(extended);
+      }
+    }
+    result.swap(next);
+  }
+  return result;
+}
+
+} // namespace sweep
+} // namespace tflchef
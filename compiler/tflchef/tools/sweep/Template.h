@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __TFLCHEF_SWEEP_TEMPLATE_H__
+#define __TFLCHEF_SWEEP_TEMPLATE_H__
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tflchef
+{
+namespace sweep
+{
+
+using Params = std::map<std::string, int64_t>;
+
+/**
+ * @brief Evaluate an integer expression of parameters with +, -, *, /, % and parentheses
+ * @note  / and % are those of C++, which truncate toward zero
+ */
+int64_t evaluate(const std::string &expression, const Params &params);
+
+/**
+ * @brief Replace every ${expression} of a recipe template with its value
+ */
+std::string expand(const std::string &text, const Params &params);
+
+/**
+ * @brief Values of a parameter to sweep
+ */
+struct Axis
+{
+  std::string name;
+  std::vector<int64_t> values;
+};
+
+/**
+ * @brief Parse an Axis from "NAME=V1,V2,..."
+ */
+Axis parse_axis(const std::string &spec);
+
+/**
+ * @brief Every combination of values of axes, where the last axis changes the fastest
+ */
+std::vector<Params> combinations(const std::vector<Axis> &axes);
+
+} // namespace sweep
+} // namespace tflchef
+
+#endif // __TFLCHEF_SWEEP_TEMPLATE_H__
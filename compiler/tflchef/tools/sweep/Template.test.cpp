@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Template.h"
+
+#include <gtest/gtest.h>
+
+using namespace tflchef::sweep;
+
+TEST(TFlChefSweepTest, evaluate)
+{
+  const Params params{{"H", 32}, {"K", 3}, {"S", 2}};
+
+  ASSERT_EQ(15, evaluate("(H - K) / S + 1", params));
+  ASSERT_EQ(16, evaluate("(H + S - 1) / S", params));
+  ASSERT_EQ(-1, evaluate("-K % S", params));
+  ASSERT_EQ(96, evaluate("H*K", params));
+}
+
+TEST(TFlChefSweepTest, evaluate_NEG)
+{
+  const Params params{{"H", 32}};
+
+  EXPECT_ANY_THROW(evaluate("W", params));
+  EXPECT_ANY_THROW(evaluate("H / 0", params));
+  EXPECT_ANY_THROW(evaluate("(H", params));
+  EXPECT_ANY_THROW(evaluate("H H", params));
+}
+
+TEST(TFlChefSweepTest, expand)
+{
+  const Params params{{"H", 8}, {"C", 4}};
+
+  ASSERT_EQ("shape { dim: 1 dim: 8 dim: 8 dim: 4 }",
+            expand("shape { dim: 1 dim: ${H} dim: ${H} dim: ${C} }", params));
+  ASSERT_EQ("no parameter", expand("no parameter", params));
+  EXPECT_ANY_THROW(expand("dim: ${H", params));
+}
+
+TEST(TFlChefSweepTest, combinations)
+{
+  const std::vector<Axis> axes{parse_axis("H=8,16"), parse_axis("C=1,2,3")};
+
+  const auto result = combinations(axes);
+
+  ASSERT_EQ(6, result.size());
+  ASSERT_EQ(8, result[0].at("H"));
+  ASSERT_EQ(1, result[0].at("C"));
+  ASSERT_EQ(8, result[2].at("H"));
+  ASSERT_EQ(3, result[2].at("C"));
+  ASSERT_EQ(16, result[3].at("H"));
+  ASSERT_EQ(1, result[3].at("C"));
+}
+
+TEST(TFlChefSweepTest, parse_axis_NEG)
+{
+  EXPECT_ANY_THROW(parse_axis("H"));
+  EXPECT_ANY_THROW(parse_axis("=1,2"));
+  EXPECT_ANY_THROW(parse_axis("H=a"));
+  EXPECT_ANY_THROW(parse_axis("H="));
+}
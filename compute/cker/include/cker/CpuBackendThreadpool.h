@@ -21,6 +21,11 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -37,6 +42,70 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+struct RangeTask : Task
+{
+  RangeTask(const std::function<void(int, int)> &fn, int start, int end)
+    : _fn{fn}, _start{start}, _end{end}
+  {
+  }
+
+  void Run() override { _fn(_start, _end); }
+
+private:
+  const std::function<void(int, int)> &_fn;
+  int _start;
+  int _end;
+};
+
+/**
+ * @brief Split [0, size) among the threads of @p ruy_context and run @p fn(start, end) for each
+ *
+ * Each thread takes @p min_range_size items at least, so small sizes run on the caller only.
+ */
+inline void ParallelFor(int size, int min_range_size, ruy::Context *ruy_context,
+                        const std::function<void(int, int)> &fn)
+{
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = std::max(1, std::min(max_threads, size / std::max(1, min_range_size)));
+  if (thread_count == 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  std::vector<RangeTask> tasks;
+  tasks.reserve(thread_count);
+  int start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int end = start + (size - start) / (thread_count - i);
+    tasks.emplace_back(fn, start, end);
+    start = end;
+  }
+  Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+// Threads take at least this many elements of elementwise work, below which waking them costs
+// more than it saves
+constexpr int kMinElementsPerThread = 16384;
+
+/**
+ * @brief Return the min_range_size of ParallelFor() over items of @p elements_per_item elements
+ */
+inline int MinRangeForElements(int elements_per_item)
+{
+  return std::max(1, kMinElementsPerThread / std::max(1, elements_per_item));
+}
+
+/**
+ * @brief ParallelFor() over @p size elements, each of which costs about as much as a copy
+ */
+inline void ParallelForElements(int size, ruy::Context *ruy_context,
+                                const std::function<void(int, int)> &fn)
+{
+  ParallelFor(size, kMinElementsPerThread, ruy_context, fn);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
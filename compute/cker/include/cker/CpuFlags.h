@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_CPU_FLAGS_H__
+#define __NNFW_CKER_CPU_FLAGS_H__
+
+#if defined __linux__ && defined __aarch64__
+#include <sys/auxv.h>
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Optional instructions of the CPU that kernels choose variants by at run time
+ *
+ * Kernels are built for the baseline of the target, so that a binary runs on older cores too,
+ * and take a variant for these instructions only if the CPU running them has them.
+ */
+struct CpuFlags
+{
+  // SDOT/UDOT of ARMv8.2
+  bool neon_dotprod = false;
+  // SMMLA/UMMLA/USMMLA of ARMv8.6
+  bool neon_i8mm = false;
+  bool sve = false;
+};
+
+/**
+ * @brief Detects the optional instructions of the CPU
+ *
+ * At the moment it's only implemented on Linux ARM64, through the hardware capabilities the
+ * kernel reports, as ruy does. Other platforms have none of them.
+ */
+inline void GetCpuFlags(CpuFlags *cpu_flags)
+{
+  *cpu_flags = CpuFlags();
+#if defined __linux__ && defined __aarch64__
+  // These are the values of HWCAP_ASIMDDP, HWCAP_SVE, AT_HWCAP2 and HWCAP2_I8MM in sufficiently
+  // recent Linux headers, however we need to support building against older headers.
+  const unsigned long kLocalHwcapAsimddp = 1UL << 20;
+  const unsigned long kLocalHwcapSve = 1UL << 22;
+  const unsigned long kLocalAtHwcap2 = 26;
+  const unsigned long kLocalHwcap2I8mm = 1UL << 13;
+  const unsigned long hwcap = getauxval(AT_HWCAP);
+  const unsigned long hwcap2 = getauxval(kLocalAtHwcap2);
+  cpu_flags->neon_dotprod = (hwcap & kLocalHwcapAsimddp) != 0;
+  cpu_flags->sve = (hwcap & kLocalHwcapSve) != 0;
+  cpu_flags->neon_i8mm = (hwcap2 & kLocalHwcap2I8mm) != 0;
+#endif
+}
+
+/**
+ * @brief Returns the flags of the CPU, which are detected once for the process
+ */
+inline const CpuFlags &CachedCpuFlags()
+{
+  static const CpuFlags cpu_flags = [] {
+    CpuFlags flags;
+    GetCpuFlags(&flags);
+    return flags;
+  }();
+  return cpu_flags;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_CPU_FLAGS_H__
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FAST_EXP_H__
+#define __NNFW_CKER_FAST_EXP_H__
+
+#include "cker/neon/neon_check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace fast_exp_detail
+{
+
+// exp() is clamped to the range of normal floats
+constexpr float kExpMin = -87.3f;
+constexpr float kExpMax = 88.3f;
+constexpr float kLog2e = 1.44269504088896341f;
+// ln(2) split in two so that n * kLn2Hi is exact
+constexpr float kLn2Hi = 0.693359375f;
+constexpr float kLn2Lo = -2.12194440e-4f;
+// Minimax polynomial of (exp(r) - 1 - r) / r^2 over [-ln(2)/2, ln(2)/2]
+constexpr float kExpP0 = 1.9875691500E-4f;
+constexpr float kExpP1 = 1.3981999507E-3f;
+constexpr float kExpP2 = 8.3334519073E-3f;
+constexpr float kExpP3 = 4.1665795894E-2f;
+constexpr float kExpP4 = 1.6666665459E-1f;
+constexpr float kExpP5 = 5.0000001201E-1f;
+
+} // namespace fast_exp_detail
+
+/**
+ * @brief exp() of @p x within 2 ulp, from 2^n x exp(r) with x = n x ln(2) + r
+ *
+ * It has no branch, so loops of it vectorize. Values under -87.3 give about 1e-38 instead of
+ * underflowing to 0.
+ */
+inline float FastExp(float x)
+{
+  using namespace fast_exp_detail;
+  x = std::min(std::max(x, kExpMin), kExpMax);
+  const float n = std::floor(x * kLog2e + 0.5f);
+  const float r = x - n * kLn2Hi - n * kLn2Lo;
+  float p = kExpP0;
+  p = p * r + kExpP1;
+  p = p * r + kExpP2;
+  p = p * r + kExpP3;
+  p = p * r + kExpP4;
+  p = p * r + kExpP5;
+  const float y = p * r * r + r + 1.f;
+  const uint32_t bits = static_cast<uint32_t>(static_cast<int32_t>(n) + 127) << 23;
+  float scale;
+  std::memcpy(&scale, &bits, sizeof(scale));
+  return y * scale;
+}
+
+#ifdef USE_NEON
+/**
+ * @brief FastExp() of 4 floats
+ */
+inline float32x4_t FastExp(float32x4_t x)
+{
+  using namespace fast_exp_detail;
+  x = vminq_f32(vmaxq_f32(x, vdupq_n_f32(kExpMin)), vdupq_n_f32(kExpMax));
+  const float32x4_t fx = vmlaq_n_f32(vdupq_n_f32(0.5f), x, kLog2e);
+  // Conversion truncates toward zero, which is floor() but for negative non-integers
+  float32x4_t n = vcvtq_f32_s32(vcvtq_s32_f32(fx));
+  const uint32x4_t over = vcgtq_f32(n, fx);
+  n = vsubq_f32(n, vreinterpretq_f32_u32(vandq_u32(over, vreinterpretq_u32_f32(vdupq_n_f32(1.f)))));
+  float32x4_t r = vmlsq_n_f32(x, n, kLn2Hi);
+  r = vmlsq_n_f32(r, n, kLn2Lo);
+  float32x4_t p = vdupq_n_f32(kExpP0);
+  p = vmlaq_f32(vdupq_n_f32(kExpP1), p, r);
+  p = vmlaq_f32(vdupq_n_f32(kExpP2), p, r);
+  p = vmlaq_f32(vdupq_n_f32(kExpP3), p, r);
+  p = vmlaq_f32(vdupq_n_f32(kExpP4), p, r);
+  p = vmlaq_f32(vdupq_n_f32(kExpP5), p, r);
+  const float32x4_t y = vaddq_f32(vmlaq_f32(r, p, vmulq_f32(r, r)), vdupq_n_f32(1.f));
+  const int32x4_t bits = vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(n), vdupq_n_s32(127)), 23);
+  return vmulq_f32(y, vreinterpretq_f32_s32(bits));
+}
+#endif // USE_NEON
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FAST_EXP_H__
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FP16_H__
+#define __NNFW_CKER_FP16_H__
+
+#include "cker/neon/neon_check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Half-precision arithmetic of ARMv8.2, which needs e.g. -march=armv8.2-a+fp16
+#if defined(USE_NEON) && defined(__aarch64__) && defined(__ARM_FP16_FORMAT_IEEE) && \
+  defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+#define CKER_FP16_NEON
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+#if defined(__ARM_FP16_FORMAT_IEEE)
+
+using float16 = __fp16;
+
+inline float Fp16ToFloat(float16 value) { return static_cast<float>(value); }
+inline float16 FloatToFp16(float value) { return static_cast<float16>(value); }
+
+#else
+
+/**
+ * @brief IEEE 754 half-precision number for storage, which is converted to float for arithmetic
+ */
+struct float16
+{
+  uint16_t bits;
+};
+
+inline float Fp16ToFloat(float16 value)
+{
+  auto bitsToFloat = [](uint32_t bits) {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+  };
+
+  const uint32_t w = static_cast<uint32_t>(value.bits) << 16;
+  const uint32_t sign = w & 0x80000000u;
+  const uint32_t two_w = w + w;
+
+  // Normal numbers, infinities and NaNs have their exponents rebiased by a multiplication
+  constexpr uint32_t kExpOffset = 0xE0u << 23;
+  constexpr float kExpScale = 1.925929944387235853055977942584927e-34f; // 2^-112
+  const float normalized = bitsToFloat((two_w >> 4) + kExpOffset) * kExpScale;
+
+  // Subnormal numbers are the mantissa put under the exponent of 0.5, minus 0.5
+  constexpr uint32_t kMagicMask = 126u << 23;
+  const float denormalized = bitsToFloat((two_w >> 17) | kMagicMask) - 0.5f;
+
+  float result = (two_w < (1u << 27)) ? denormalized : normalized;
+  uint32_t bits;
+  std::memcpy(&bits, &result, sizeof(bits));
+  return bitsToFloat(sign | bits);
+}
+
+inline float16 FloatToFp16(float value)
+{
+  auto floatToBits = [](float f) {
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+  };
+  auto bitsToFloat = [](uint32_t bits) {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+  };
+
+  // Rounding to nearest even is done by float addition at the exponent of the result
+  constexpr float kScaleToInf = 5.192296858534827628530496329220096e+33f;  // 2^112
+  constexpr float kScaleToZero = 7.703719777548943412223911770339728e-34f; // 2^-110
+  float base = (std::abs(value) * kScaleToInf) * kScaleToZero;
+
+  const uint32_t w = floatToBits(value);
+  const uint32_t shl1_w = w + w;
+  const uint32_t sign = w & 0x80000000u;
+  uint32_t bias = shl1_w & 0xFF000000u;
+  if (bias < 0x71000000u)
+    bias = 0x71000000u;
+
+  base = bitsToFloat((bias >> 1) + 0x07800000u) + base;
+  const uint32_t bits = floatToBits(base);
+  const uint32_t exp_bits = (bits >> 13) & 0x00007C00u;
+  const uint32_t mantissa_bits = bits & 0x00000FFFu;
+  const uint32_t nonsign = exp_bits + mantissa_bits;
+  return float16{static_cast<uint16_t>((sign >> 16) | (shl1_w > 0xFF000000u ? 0x7E00u : nonsign))};
+}
+
+#endif // defined(__ARM_FP16_FORMAT_IEEE)
+
+static_assert(sizeof(float16) == 2, "float16 must be 2 bytes");
+
+inline void ConvertFloatToFp16(const float *input, float16 *output, int size)
+{
+  int i = 0;
+#ifdef CKER_FP16_NEON
+  for (; i + 4 <= size; i += 4)
+    vst1_f16(output + i, vcvt_f16_f32(vld1q_f32(input + i)));
+#endif
+  for (; i < size; ++i)
+    output[i] = FloatToFp16(input[i]);
+}
+
+inline void ConvertFp16ToFloat(const float16 *input, float *output, int size)
+{
+  int i = 0;
+#ifdef CKER_FP16_NEON
+  for (; i + 4 <= size; i += 4)
+    vst1q_f32(output + i, vcvt_f32_f16(vld1_f16(input + i)));
+#endif
+  for (; i < size; ++i)
+    output[i] = Fp16ToFloat(input[i]);
+}
+
+/**
+ * @brief Sum of a[i] * b[i]
+ *
+ * With half-precision arithmetic, products are summed up in half precision for chunks of
+ * elements and the chunks are summed up in float, so that long sums do not lose precision.
+ */
+inline float Fp16Dot(const float16 *a, const float16 *b, int size)
+{
+  float sum = 0.f;
+  int i = 0;
+#ifdef CKER_FP16_NEON
+  constexpr int kChunk = 128;
+  const int vector_end = size - size % 8;
+  while (i < vector_end)
+  {
+    const int chunk_end = std::min(i + kChunk, vector_end);
+    float16x8_t acc = vdupq_n_f16(0);
+    for (; i < chunk_end; i += 8)
+      acc = vfmaq_f16(acc, vld1q_f16(a + i), vld1q_f16(b + i));
+    sum += vaddvq_f32(
+      vaddq_f32(vcvt_f32_f16(vget_low_f16(acc)), vcvt_f32_f16(vget_high_f16(acc))));
+  }
+#endif
+  for (; i < size; ++i)
+    sum += Fp16ToFloat(a[i]) * Fp16ToFloat(b[i]);
+  return sum;
+}
+
+/**
+ * @brief acc[i] += a[i] * b[i], where acc is in half precision too
+ */
+inline void Fp16MulAdd(const float16 *a, const float16 *b, float16 *acc, int size)
+{
+  int i = 0;
+#ifdef CKER_FP16_NEON
+  for (; i + 8 <= size; i += 8)
+    vst1q_f16(acc + i, vfmaq_f16(vld1q_f16(acc + i), vld1q_f16(a + i), vld1q_f16(b + i)));
+#endif
+  for (; i < size; ++i)
+    acc[i] = FloatToFp16(Fp16ToFloat(acc[i]) + Fp16ToFloat(a[i]) * Fp16ToFloat(b[i]));
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FP16_H__
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_INT16_H__
+#define __NNFW_CKER_INT16_H__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Multiply a 64-bit accumulator by a quantized multiplier, as 16x8 kernels requantize
+ *
+ * The multiplier is rounded to 16 bits so that the product fits in 64 bits.
+ */
+inline int32_t MultiplyByQuantizedMultiplier(int64_t x, int32_t quantized_multiplier, int shift)
+{
+  assert(quantized_multiplier >= 0);
+  assert(shift >= -31 && shift < 8);
+
+  const int32_t reduced_multiplier =
+    (quantized_multiplier < 0x7FFF0000) ? ((quantized_multiplier + (1 << 15)) >> 16) : 0x7FFF;
+  const int total_shift = 15 - shift;
+  const int64_t round = static_cast<int64_t>(1) << (total_shift - 1);
+  return static_cast<int32_t>((x * reduced_multiplier + round) >> total_shift);
+}
+
+/**
+ * @brief Dot product of int16 activations and int8 weights
+ *
+ * Products take 23 bits, so blocks of them are summed in 32 bits, which vectorizes like int8
+ * kernels do, and the blocks in 64 bits.
+ */
+inline int64_t Int16x8Dot(const int16_t *a, const int8_t *b, int size)
+{
+  constexpr int kBlockSize = 256;
+  int64_t acc = 0;
+  for (int start = 0; start < size; start += kBlockSize)
+  {
+    const int end = std::min(size, start + kBlockSize);
+    int32_t block_acc = 0;
+    for (int i = start; i < end; ++i)
+      block_acc += static_cast<int32_t>(a[i]) * b[i];
+    acc += block_acc;
+  }
+  return acc;
+}
+
+/**
+ * @brief Requantize a 64-bit accumulator of 16x8 kernels into int16 output in [act_min, act_max]
+ */
+inline int16_t RequantizeInt16(int64_t acc, int32_t multiplier, int shift, int32_t output_offset,
+                               int32_t act_min, int32_t act_max)
+{
+  int32_t value = MultiplyByQuantizedMultiplier(acc, multiplier, shift) + output_offset;
+  value = std::max(value, act_min);
+  value = std::min(value, act_max);
+  return static_cast<int16_t>(value);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_INT16_H__
@@ -20,13 +20,11 @@
 
 #include <ruy/path.h>
 #include <ruy/ruy.h>
+#include "cker/CpuFlags.h"
 #include "cker/Types.h"
 #include "cker/neon/neon_check.h"
 #include "cker/ruy/RuySupport.h"
 #include "util/logging.h"
-#if defined __linux__ && defined __aarch64__
-#include <sys/auxv.h>
-#endif
 
 #include <cassert>
 #include <cmath>
@@ -82,35 +80,7 @@ inline int32_t AccumulateNeonLane(const int32x4_t lane)
 
 } // namespace
 
-// The implementation of dotprod detection is copied from ruy's internal
-// function DetectDotprod().
-// At the moment it's only implemented on Linux ARM64. Consider syncing again
-// with ruy in the future to share improvements.
-#if defined __linux__ && defined __aarch64__
-inline bool DetectDotprodByLinuxAuxvMethod()
-{
-  // This is the value of HWCAP_ASIMDDP in sufficiently recent Linux headers,
-  // however we need to support building against older headers for the time
-  // being.
-  const int kLocalHwcapAsimddp = 1 << 20;
-  return getauxval(AT_HWCAP) & kLocalHwcapAsimddp;
-}
-#endif
-
-inline bool DetectArmNeonDotprod()
-{
-#if defined __linux__ && defined __aarch64__
-  return DetectDotprodByLinuxAuxvMethod();
-#endif
-
-  return false;
-}
-
-inline bool HasSdotInstruction()
-{
-  static const bool has_dotprod = DetectArmNeonDotprod();
-  return has_dotprod;
-}
+inline bool HasSdotInstruction() { return CachedCpuFlags().neon_dotprod; }
 
 #ifdef __aarch64__
 // We interleave vector data to make the dot product logic more efficient.
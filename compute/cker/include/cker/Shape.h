@@ -347,6 +347,19 @@ inline int MatchingElementsSize(const Shape &shape, const Shape &check_shape_0,
   return size_1;
 }
 
+// Strides of a shape extended to 4D against a 4D output shape, which are 0 for broadcast dimensions
+inline void BroadcastStrides(const Shape &shape, const Shape &output_shape, int *strides)
+{
+  const Shape extended = Shape::ExtendedShape(4, shape);
+  int stride = 1;
+  for (int i = 3; i >= 0; --i)
+  {
+    strides[i] = (extended.Dims(i) == output_shape.Dims(i)) ? stride : 0;
+    assert(strides[i] != 0 || extended.Dims(i) == 1);
+    stride *= extended.Dims(i);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -109,6 +109,8 @@ struct SoftmaxParams
   int32_t zero_point;
   float scale;
   float *table;
+  // Entries of table, which int16 kernels size by the range of exp() they need
+  int table_size;
   uint8_t *uint8_table1;
   uint8_t *uint8_table2;
 };
@@ -154,6 +156,8 @@ struct ConvParams
   float float_activation_min;
   float float_activation_max;
   bool is_replaced_weights{false};
+  // Whether the filter is constant, so that ruy can cache its packing
+  bool lhs_cacheable{false};
 };
 
 struct ComparisonParams
@@ -252,18 +256,39 @@ struct FullyConnectedParams
   int32_t input_offset;
   int32_t weights_offset;
   float weights_scale;
+  // Per-channel scales of int8 weights for hybrid inference, which override weights_scale if set
+  const float *weights_scales{nullptr};
   int32_t output_offset;
   int32_t output_multiplier;
   int output_shift;
   // uint8, etc, activation params.
   int32_t quantized_activation_min;
   int32_t quantized_activation_max;
-  // float activation params - no one use this params, but ruy might use them later.
-  // float float_activation_min;
-  // float float_activation_max;
+  // float activation params, which float16 and block sparse inference use only.
+  float float_activation_min;
+  float float_activation_max;
+  // Whether the weights are constant, so that ruy can cache their packing
+  bool lhs_cacheable{false};
   // FullyConnectedWeightsFormat weights_format;
 };
 
+struct AttentionParams
+{
+  float scale;
+};
+
+struct BatchMatMulParams
+{
+  // int8 inference params.
+  int32_t lhs_zero_point;
+  int32_t rhs_zero_point;
+  int32_t output_zero_point;
+  int32_t output_multiplier;
+  int output_shift;
+  int32_t quantized_activation_min;
+  int32_t quantized_activation_max;
+};
+
 struct L2NormParams
 {
   // uint8 inference params.
@@ -303,6 +328,11 @@ struct InstanceNormParams
   float float_activation_max;
 };
 
+struct LayerNormParams
+{
+  float epsilon;
+};
+
 struct ResizeBilinearParams
 {
   int32_t output_height;
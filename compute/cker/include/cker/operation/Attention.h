@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ATTENTION_H__
+#define __NNFW_CKER_ATTENTION_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <Eigen/Core>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Scores of a tile of query rows against a tile of key rows stay in L1 cache
+constexpr int kAttentionRowTile = 32;
+constexpr int kAttentionColTile = 64;
+
+/**
+ * @brief Sizes of Attention and where the mask of each batch is
+ *
+ * All dimensions but the last two are batches, which query, key and value share. The mask is
+ * broadcast to [batches..., query_len, key_len] by strides of 0.
+ */
+struct AttentionGeometry
+{
+  AttentionGeometry(const Shape &query_shape, const Shape &key_shape, const Shape &value_shape,
+                    const Shape &mask_shape, bool has_mask)
+  {
+    const int rank = query_shape.DimensionsCount();
+    assert(rank >= 2 && key_shape.DimensionsCount() == rank &&
+           value_shape.DimensionsCount() == rank);
+
+    query_len = query_shape.Dims(rank - 2);
+    depth = query_shape.Dims(rank - 1);
+    key_len = key_shape.Dims(rank - 2);
+    value_depth = value_shape.Dims(rank - 1);
+    assert(key_shape.Dims(rank - 1) == depth && value_shape.Dims(rank - 2) == key_len);
+
+    batches = 1;
+    for (int i = 0; i < rank - 2; ++i)
+      batches *= query_shape.Dims(i);
+    row_tiles = (query_len + kAttentionRowTile - 1) / kAttentionRowTile;
+
+    if (!has_mask)
+      return;
+
+    const Shape mask = Shape::ExtendedShape(rank, mask_shape);
+    mask_col_stride = (mask.Dims(rank - 1) == 1) ? 0 : 1;
+    mask_row_stride = (mask.Dims(rank - 2) == 1) ? 0 : mask.Dims(rank - 1);
+    int stride = mask.Dims(rank - 2) * mask.Dims(rank - 1);
+    batch_dims.resize(rank - 2);
+    mask_strides.resize(rank - 2);
+    for (int i = rank - 3; i >= 0; --i)
+    {
+      assert(mask.Dims(i) == 1 || mask.Dims(i) == query_shape.Dims(i));
+      batch_dims[i] = query_shape.Dims(i);
+      mask_strides[i] = (mask.Dims(i) == 1) ? 0 : stride;
+      stride *= mask.Dims(i);
+    }
+  }
+
+  int maskOffset(int batch) const
+  {
+    int offset = 0;
+    for (int i = static_cast<int>(batch_dims.size()) - 1; i >= 0; --i)
+    {
+      offset += (batch % batch_dims[i]) * mask_strides[i];
+      batch /= batch_dims[i];
+    }
+    return offset;
+  }
+
+  int batches;
+  int query_len;
+  int key_len;
+  int depth;
+  int value_depth;
+  int row_tiles;
+  int mask_row_stride = 0;
+  int mask_col_stride = 0;
+  std::vector<int> batch_dims;
+  std::vector<int> mask_strides;
+};
+
+/**
+ * @brief Run Attention for tiles of query rows in [unit_start, unit_end)
+ *
+ * This is the online softmax of FlashAttention. Each tile of query rows walks over tiles of key
+ * rows, keeping the running maximum and sum of each row, and rescales what it has accumulated
+ * whenever the maximum grows. Only one tile of scores exists at a time.
+ */
+inline void AttentionRange(const AttentionParams &params, const AttentionGeometry &geometry,
+                           const float *query_data, const float *key_data,
+                           const float *value_data, const float *mask_data, float *output_data,
+                           int unit_start, int unit_end)
+{
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ConstMatrixMap = Eigen::Map<const RowMajorMatrix>;
+  constexpr float kNegInf = -std::numeric_limits<float>::infinity();
+
+  const int depth = geometry.depth;
+  const int value_depth = geometry.value_depth;
+  RowMajorMatrix scores(kAttentionRowTile, kAttentionColTile);
+  RowMajorMatrix acc(kAttentionRowTile, value_depth);
+  std::vector<float> row_max(kAttentionRowTile);
+  std::vector<float> row_sum(kAttentionRowTile);
+
+  for (int unit = unit_start; unit < unit_end; ++unit)
+  {
+    const int batch = unit / geometry.row_tiles;
+    const int row_start = (unit % geometry.row_tiles) * kAttentionRowTile;
+    const int rows = std::min(kAttentionRowTile, geometry.query_len - row_start);
+
+    ConstMatrixMap query(query_data + (batch * geometry.query_len + row_start) * depth, rows,
+                         depth);
+    ConstMatrixMap key(key_data + batch * geometry.key_len * depth, geometry.key_len, depth);
+    ConstMatrixMap value(value_data + batch * geometry.key_len * value_depth, geometry.key_len,
+                         value_depth);
+    const float *mask =
+      (mask_data == nullptr)
+        ? nullptr
+        : mask_data + geometry.maskOffset(batch) + row_start * geometry.mask_row_stride;
+
+    auto acc_rows = acc.topRows(rows);
+    acc_rows.setZero();
+    std::fill(row_max.begin(), row_max.end(), kNegInf);
+    std::fill(row_sum.begin(), row_sum.end(), 0.f);
+
+    for (int col_start = 0; col_start < geometry.key_len; col_start += kAttentionColTile)
+    {
+      const int cols = std::min(kAttentionColTile, geometry.key_len - col_start);
+      auto tile = scores.topLeftCorner(rows, cols);
+      tile.noalias() = query * key.middleRows(col_start, cols).transpose();
+      tile *= params.scale;
+
+      for (int r = 0; r < rows; ++r)
+      {
+        if (mask != nullptr)
+        {
+          const float *mask_row =
+            mask + r * geometry.mask_row_stride + col_start * geometry.mask_col_stride;
+          for (int c = 0; c < cols; ++c)
+            tile(r, c) += mask_row[c * geometry.mask_col_stride];
+        }
+
+        const float new_max = std::max(row_max[r], tile.row(r).maxCoeff());
+        // A row masked out entirely so far has nothing to subtract and sums up to 0
+        const float base = (new_max == kNegInf) ? 0.f : new_max;
+        const float rescale = std::exp(row_max[r] - base);
+        tile.row(r).array() = (tile.row(r).array() - base).exp();
+        row_sum[r] = row_sum[r] * rescale + tile.row(r).sum();
+        acc_rows.row(r) *= rescale;
+        row_max[r] = new_max;
+      }
+
+      acc_rows.noalias() += tile * value.middleRows(col_start, cols);
+    }
+
+    Eigen::Map<RowMajorMatrix> output(
+      output_data + (batch * geometry.query_len + row_start) * value_depth, rows, value_depth);
+    for (int r = 0; r < rows; ++r)
+    {
+      if (row_sum[r] > 0.f)
+        output.row(r) = acc_rows.row(r) / row_sum[r];
+      else
+        output.row(r).setZero();
+    }
+  }
+}
+
+struct AttentionTask : cpu_backend_threadpool::Task
+{
+  AttentionTask(const AttentionParams &params, const AttentionGeometry &geometry,
+                const float *query_data, const float *key_data, const float *value_data,
+                const float *mask_data, float *output_data, int unit_start, int unit_end)
+    : _params{params}, _geometry{geometry}, _query_data{query_data}, _key_data{key_data},
+      _value_data{value_data}, _mask_data{mask_data}, _output_data{output_data},
+      _unit_start{unit_start}, _unit_end{unit_end}
+  {
+  }
+
+  void Run() override
+  {
+    AttentionRange(_params, _geometry, _query_data, _key_data, _value_data, _mask_data,
+                   _output_data, _unit_start, _unit_end);
+  }
+
+private:
+  const AttentionParams &_params;
+  const AttentionGeometry &_geometry;
+  const float *_query_data;
+  const float *_key_data;
+  const float *_value_data;
+  const float *_mask_data;
+  float *_output_data;
+  int _unit_start;
+  int _unit_end;
+};
+
+/**
+ * @brief softmax(query x key^T x scale + mask) x value, which does not store the whole scores
+ *
+ * @p mask_data can be nullptr if there is no mask. Tiles of query rows of all batches are split
+ * among the threads of @p ruy_context.
+ */
+inline void Attention(const AttentionParams &params, const Shape &query_shape,
+                      const float *query_data, const Shape &key_shape, const float *key_data,
+                      const Shape &value_shape, const float *value_data, const Shape &mask_shape,
+                      const float *mask_data, const Shape &output_shape, float *output_data,
+                      ruy::Context *ruy_context)
+{
+  const AttentionGeometry geometry{query_shape, key_shape, value_shape, mask_shape,
+                                   mask_data != nullptr};
+  assert(output_shape.FlatSize() == geometry.batches * geometry.query_len * geometry.value_depth);
+
+  const int units = geometry.batches * geometry.row_tiles;
+  if (units == 0 || geometry.key_len == 0)
+  {
+    std::fill(output_data, output_data + output_shape.FlatSize(), 0.f);
+    return;
+  }
+
+  // Each thread takes enough multiply-adds to be worth waking it up
+  constexpr int64_t kMinMacsPerThread = 64 * 1024;
+  const int64_t macs = static_cast<int64_t>(geometry.batches) * geometry.query_len *
+                       geometry.key_len * (geometry.depth + geometry.value_depth);
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = static_cast<int>(
+    std::max<int64_t>(1, std::min<int64_t>({max_threads, units, macs / kMinMacsPerThread})));
+
+  if (thread_count == 1)
+  {
+    AttentionRange(params, geometry, query_data, key_data, value_data, mask_data, output_data, 0,
+                   units);
+    return;
+  }
+
+  std::vector<AttentionTask> tasks;
+  tasks.reserve(thread_count);
+  int unit_start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int unit_end = unit_start + (units - unit_start) / (thread_count - i);
+    tasks.emplace_back(params, geometry, query_data, key_data, value_data, mask_data, output_data,
+                       unit_start, unit_end);
+    unit_start = unit_end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ATTENTION_H__
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BCQ_H__
+#define __NNFW_CKER_BCQ_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+#include "cker/neon/neon_check.h"
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+// Kernels of weights quantized by binary-coding quantization (BCQ)
+//
+// A weight row r is approximated as sum_k(alpha[r][k] * b[r][k]) over its q bits, where each
+// b[r][k] is a vector of +1/-1. Rows are grouped into clusters of (qbits, size) pairs, and
+// scales and binary codes are stored cluster by cluster, q of them for each row of a cluster:
+//  - scales are [sum(qbits * size)]
+//  - binary codes are [sum(qbits * size), ceil(hidden / 32)] of int32, where bit (h % 32) of
+//    word (h / 32) is 1 for +1 and 0 for -1 of element h
+namespace nnfw
+{
+namespace cker
+{
+namespace bcq
+{
+
+// Elements of a hidden vector decoded at once by a byte of binary code
+constexpr int kGroupBits = 8;
+constexpr int kGroupEntries = 1 << kGroupBits;
+
+/**
+ * @brief First scale and binary code row, and qbits of each weight row
+ */
+struct RowCode
+{
+  int code_row;
+  int qbits;
+};
+
+inline std::vector<RowCode> decodeClusters(const int32_t *clusters_data, int num_clusters)
+{
+  std::vector<RowCode> rows;
+  int code_row = 0;
+  for (int c = 0; c < num_clusters; ++c)
+  {
+    const int qbits = clusters_data[c * 2];
+    const int size = clusters_data[c * 2 + 1];
+    for (int r = 0; r < size; ++r)
+    {
+      rows.push_back({code_row, qbits});
+      code_row += qbits;
+    }
+  }
+  return rows;
+}
+
+inline uint32_t codeByte(const int32_t *code, int group)
+{
+  return (static_cast<uint32_t>(code[group / 4]) >> ((group % 4) * kGroupBits)) & 0xff;
+}
+
+inline bool codeBit(const int32_t *code, int h)
+{
+  return (static_cast<uint32_t>(code[h / 32]) >> (h % 32)) & 1;
+}
+
+/**
+ * @brief Fill table[m] with sum_j(bit j of m ? x[j] : -x[j]) for the 8 values of x
+ */
+inline void buildLookupTable(const float *x, float *table)
+{
+  float sum = 0.f;
+  for (int j = 0; j < kGroupBits; ++j)
+    sum += x[j];
+  table[0] = -sum;
+
+  // Entries with the bit j set are those without it, where -x[j] becomes +x[j]
+  int j = 0;
+  for (; j < kGroupBits && (1 << j) < 4; ++j)
+  {
+    const int step = 1 << j;
+    for (int m = 0; m < step; ++m)
+      table[m + step] = table[m] + 2.f * x[j];
+  }
+  for (; j < kGroupBits; ++j)
+  {
+    const int step = 1 << j;
+#ifdef USE_NEON
+    const float32x4_t twice_x = vdupq_n_f32(2.f * x[j]);
+    for (int m = 0; m < step; m += 4)
+      vst1q_f32(table + m + step, vaddq_f32(vld1q_f32(table + m), twice_x));
+#else
+    for (int m = 0; m < step; ++m)
+      table[m + step] = table[m] + 2.f * x[j];
+#endif
+  }
+}
+
+/**
+ * @brief Sum of the table entries looked up by the bytes of a binary code row
+ */
+inline float lookupSum(const float *tables, const int32_t *code, int num_groups)
+{
+  // Independent partial sums not to wait for each addition
+  float sums[4] = {0.f, 0.f, 0.f, 0.f};
+  int g = 0;
+  for (; g + 4 <= num_groups; g += 4)
+  {
+    const auto word = static_cast<uint32_t>(code[g / 4]);
+    sums[0] += tables[(g + 0) * kGroupEntries + (word & 0xff)];
+    sums[1] += tables[(g + 1) * kGroupEntries + ((word >> 8) & 0xff)];
+    sums[2] += tables[(g + 2) * kGroupEntries + ((word >> 16) & 0xff)];
+    sums[3] += tables[(g + 3) * kGroupEntries + (word >> 24)];
+  }
+  for (; g < num_groups; ++g)
+    sums[0] += tables[g * kGroupEntries + codeByte(code, g)];
+  return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+} // namespace bcq
+
+/**
+ * @brief FullyConnected of BCQ weights, output[r][b] = sum_h(W[r][h] * input[h][b]) + bias[r]
+ * @note  input is [hidden, batch] and output is [rows, batch], like BCQFullyConnected of circle.
+ *        Sums of every 8 input values with all the signs are computed once into lookup tables
+ *        of lookup_tables, so that a byte of binary code costs a lookup instead of 8 additions.
+ */
+inline void BCQFullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
+                              const float *input_data, const float *scales_data,
+                              const Shape &binary_shape, const int32_t *binary_data,
+                              const Shape &clusters_shape, const int32_t *clusters_data,
+                              const float *bias_data, const Shape &output_shape,
+                              float *output_data, std::vector<float> &lookup_tables)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  assert(clusters_shape.DimensionsCount() == 2 && clusters_shape.Dims(1) == 2);
+  const int hidden = input_shape.Dims(0);
+  const int batch = input_shape.Dims(1);
+  const int words = binary_shape.Dims(1);
+  assert(words * 32 >= hidden);
+  const int num_groups = (hidden + bcq::kGroupBits - 1) / bcq::kGroupBits;
+
+  const auto rows = bcq::decodeClusters(clusters_data, clusters_shape.Dims(0));
+  assert(static_cast<int>(rows.size()) == output_shape.Dims(0));
+  UNUSED_RELEASE(output_shape);
+
+  lookup_tables.resize(static_cast<size_t>(num_groups) * bcq::kGroupEntries);
+  float x[bcq::kGroupBits];
+  for (int b = 0; b < batch; ++b)
+  {
+    for (int g = 0; g < num_groups; ++g)
+    {
+      // Padding bits of the last code word are multiplied by zeros
+      for (int j = 0; j < bcq::kGroupBits; ++j)
+      {
+        const int h = g * bcq::kGroupBits + j;
+        x[j] = h < hidden ? input_data[h * batch + b] : 0.f;
+      }
+      bcq::buildLookupTable(x, lookup_tables.data() + g * bcq::kGroupEntries);
+    }
+
+    for (size_t r = 0; r < rows.size(); ++r)
+    {
+      float acc = bias_data ? bias_data[r] : 0.f;
+      for (int k = 0; k < rows[r].qbits; ++k)
+      {
+        const int code_row = rows[r].code_row + k;
+        acc += scales_data[code_row] * bcq::lookupSum(lookup_tables.data(),
+                                                      binary_data + code_row * words, num_groups);
+      }
+      output_data[r * batch + b] = acc;
+    }
+  }
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    ApplyActivationToVector(output_data, static_cast<int>(rows.size()) * batch, params.activation,
+                            output_data);
+  }
+}
+
+/**
+ * @brief Gather of rows or columns of BCQ weights [rows, hidden], which are decoded on the fly
+ * @note  Rows along axis 0 are decoded 4 elements at once, by a table of signs of a nibble.
+ */
+template <typename IndicesType>
+inline void BCQGather(const float *scales_data, const Shape &binary_shape,
+                      const int32_t *binary_data, const Shape &clusters_shape,
+                      const int32_t *clusters_data, int hidden, int axis,
+                      const Shape &indices_shape, const IndicesType *indices_data,
+                      const Shape &output_shape, float *output_data)
+{
+  assert(clusters_shape.DimensionsCount() == 2 && clusters_shape.Dims(1) == 2);
+  assert(axis == 0 || axis == 1);
+  const int words = binary_shape.Dims(1);
+  assert(words * 32 >= hidden);
+  const int coords_count = indices_shape.FlatSize();
+  UNUSED_RELEASE(output_shape);
+
+  const auto rows = bcq::decodeClusters(clusters_data, clusters_shape.Dims(0));
+
+  if (axis == 0)
+  {
+    assert(output_shape.FlatSize() == coords_count * hidden);
+    // kSigns[n] are the signs of the 4 elements by the bits of a nibble n
+    static const auto kSigns = []() {
+      std::vector<float> signs(16 * 4);
+      for (int n = 0; n < 16; ++n)
+        for (int j = 0; j < 4; ++j)
+          signs[n * 4 + j] = ((n >> j) & 1) ? 1.f : -1.f;
+      return signs;
+    }();
+
+    for (int i = 0; i < coords_count; ++i)
+    {
+      const auto row = static_cast<int>(indices_data[i]);
+      assert(row >= 0 && row < static_cast<int>(rows.size()));
+      float *out = output_data + static_cast<size_t>(i) * hidden;
+      ZeroVector(out, hidden);
+      for (int k = 0; k < rows[row].qbits; ++k)
+      {
+        const int code_row = rows[row].code_row + k;
+        const float alpha = scales_data[code_row];
+        const int32_t *code = binary_data + code_row * words;
+        int h = 0;
+        for (; h + 4 <= hidden; h += 4)
+        {
+          const uint32_t nibble = (static_cast<uint32_t>(code[h / 32]) >> (h % 32)) & 0xf;
+          const float *signs = kSigns.data() + nibble * 4;
+#ifdef USE_NEON
+          vst1q_f32(out + h, vmlaq_n_f32(vld1q_f32(out + h), vld1q_f32(signs), alpha));
+#else
+          for (int j = 0; j < 4; ++j)
+            out[h + j] += alpha * signs[j];
+#endif
+        }
+        for (; h < hidden; ++h)
+        {
+          out[h] += bcq::codeBit(code, h) ? alpha : -alpha;
+        }
+      }
+    }
+    return;
+  }
+
+  // Columns of every row along axis 1
+  assert(output_shape.FlatSize() == static_cast<int>(rows.size()) * coords_count);
+  for (size_t r = 0; r < rows.size(); ++r)
+  {
+    float *out = output_data + r * coords_count;
+    for (int i = 0; i < coords_count; ++i)
+    {
+      const auto h = static_cast<int>(indices_data[i]);
+      assert(h >= 0 && h < hidden);
+      float value = 0.f;
+      for (int k = 0; k < rows[r].qbits; ++k)
+      {
+        const int code_row = rows[r].code_row + k;
+        const float alpha = scales_data[code_row];
+        value += bcq::codeBit(binary_data + code_row * words, h) ? alpha : -alpha;
+      }
+      out[i] = value;
+    }
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BCQ_H__
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BINARY_ARITHMETIC_FP16_H__
+#define __NNFW_CKER_BINARY_ARITHMETIC_FP16_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace fp16_detail
+{
+
+inline float BinaryOp(BinaryArithmeticOpType type, float lhs, float rhs)
+{
+  switch (type)
+  {
+    case BinaryArithmeticOpType::ADD:
+      return lhs + rhs;
+    case BinaryArithmeticOpType::SUB:
+      return lhs - rhs;
+    case BinaryArithmeticOpType::MUL:
+      return lhs * rhs;
+    case BinaryArithmeticOpType::DIV:
+      return lhs / rhs;
+    case BinaryArithmeticOpType::POW:
+      return std::pow(lhs, rhs);
+    default:
+      throw std::runtime_error{"BinaryArithmeticFp16: Unsupported operation type"};
+  }
+}
+
+} // namespace fp16_detail
+
+/**
+ * @brief Elementwise binary arithmetic in half precision, with broadcast up to 4D
+ *
+ * Elements are computed in float and stored in half precision, which moves half the bytes of
+ * float kernels for the same work.
+ */
+inline void BinaryArithmeticFp16(BinaryArithmeticOpType type, const BinaryArithmeticOpParam &params,
+                                 const Shape &input1_shape, const float16 *input1_data,
+                                 const Shape &input2_shape, const float16 *input2_data,
+                                 const Shape &output_shape, float16 *output_data,
+                                 ruy::Context *ruy_context)
+{
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+  auto compute = [&](float lhs, float rhs) {
+    return FloatToFp16(std::min(std::max(fp16_detail::BinaryOp(type, lhs, rhs), activation_min),
+                                activation_max));
+  };
+
+  if (input1_shape == input2_shape)
+  {
+    const int size = MatchingFlatSize(input1_shape, output_shape);
+    cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+      for (int i = start; i < end; ++i)
+        output_data[i] = compute(Fp16ToFloat(input1_data[i]), Fp16ToFloat(input2_data[i]));
+    });
+    return;
+  }
+
+  if (output_shape.DimensionsCount() > 4)
+    throw std::runtime_error{"BinaryArithmeticFp16: Broadcast over 4D is not supported"};
+
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+  int input1_strides[4];
+  int input2_strides[4];
+  BroadcastStrides(input1_shape, extended_output_shape, input1_strides);
+  BroadcastStrides(input2_shape, extended_output_shape, input2_strides);
+
+  const int dim1 = extended_output_shape.Dims(1);
+  const int dim2 = extended_output_shape.Dims(2);
+  const int dim3 = extended_output_shape.Dims(3);
+  const int rows = extended_output_shape.Dims(0) * dim1 * dim2;
+  const int min_rows = cpu_backend_threadpool::MinRangeForElements(dim3);
+  cpu_backend_threadpool::ParallelFor(rows, min_rows, ruy_context, [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const int i2 = row % dim2;
+      const int i1 = (row / dim2) % dim1;
+      const int i0 = row / dim2 / dim1;
+      const float16 *lhs = input1_data + i0 * input1_strides[0] + i1 * input1_strides[1] +
+                           i2 * input1_strides[2];
+      const float16 *rhs = input2_data + i0 * input2_strides[0] + i1 * input2_strides[1] +
+                           i2 * input2_strides[2];
+      float16 *out = output_data + row * dim3;
+      for (int i3 = 0; i3 < dim3; ++i3)
+        out[i3] = compute(Fp16ToFloat(lhs[i3 * input1_strides[3]]),
+                          Fp16ToFloat(rhs[i3 * input2_strides[3]]));
+    }
+  });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BINARY_ARITHMETIC_FP16_H__
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BINARY_ARITHMETIC_INT16_H__
+#define __NNFW_CKER_BINARY_ARITHMETIC_INT16_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Int16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace int16_detail
+{
+
+inline int32_t BinaryOp(BinaryArithmeticOpType type, const BinaryArithmeticOpParam &params,
+                        int32_t lhs, int32_t rhs)
+{
+  const int64_t input1_val = lhs + params.input1_offset;
+  const int64_t input2_val = rhs + params.input2_offset;
+  switch (type)
+  {
+    case BinaryArithmeticOpType::ADD:
+    case BinaryArithmeticOpType::SUB:
+    {
+      const int32_t scaled_input1_val = MultiplyByQuantizedMultiplier(
+        input1_val * (1 << params.left_shift), params.input1_multiplier, params.input1_shift);
+      const int32_t scaled_input2_val = MultiplyByQuantizedMultiplier(
+        input2_val * (1 << params.left_shift), params.input2_multiplier, params.input2_shift);
+      const int64_t raw_sum = (type == BinaryArithmeticOpType::ADD)
+                                ? scaled_input1_val + static_cast<int64_t>(scaled_input2_val)
+                                : scaled_input1_val - static_cast<int64_t>(scaled_input2_val);
+      return MultiplyByQuantizedMultiplier(raw_sum, params.output_multiplier, params.output_shift) +
+             params.output_offset;
+    }
+    case BinaryArithmeticOpType::MUL:
+      return MultiplyByQuantizedMultiplier(input1_val * input2_val, params.output_multiplier,
+                                           params.output_shift) +
+             params.output_offset;
+    default:
+      throw std::runtime_error{"BinaryArithmeticInt16: Unsupported operation type"};
+  }
+}
+
+} // namespace int16_detail
+
+/**
+ * @brief Elementwise quantized Add, Sub or Mul on int16, with broadcast up to 4D
+ *
+ * Parameters are those of int8 kernels, except that Sub takes the multiplier of the second input
+ * as Add does since the multipliers of 16-bit requantization must be positive.
+ */
+inline void BinaryArithmeticInt16(BinaryArithmeticOpType type,
+                                  const BinaryArithmeticOpParam &params,
+                                  const Shape &input1_shape, const int16_t *input1_data,
+                                  const Shape &input2_shape, const int16_t *input2_data,
+                                  const Shape &output_shape, int16_t *output_data,
+                                  ruy::Context *ruy_context)
+{
+  const int32_t activation_min = params.quantized_activation_min;
+  const int32_t activation_max = params.quantized_activation_max;
+  auto compute = [&](int32_t lhs, int32_t rhs) {
+    return static_cast<int16_t>(std::min(
+      std::max(int16_detail::BinaryOp(type, params, lhs, rhs), activation_min), activation_max));
+  };
+
+  if (input1_shape == input2_shape)
+  {
+    const int size = MatchingFlatSize(input1_shape, output_shape);
+    cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+      for (int i = start; i < end; ++i)
+        output_data[i] = compute(input1_data[i], input2_data[i]);
+    });
+    return;
+  }
+
+  if (output_shape.DimensionsCount() > 4)
+    throw std::runtime_error{"BinaryArithmeticInt16: Broadcast over 4D is not supported"};
+
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+  int input1_strides[4];
+  int input2_strides[4];
+  BroadcastStrides(input1_shape, extended_output_shape, input1_strides);
+  BroadcastStrides(input2_shape, extended_output_shape, input2_strides);
+
+  const int dim1 = extended_output_shape.Dims(1);
+  const int dim2 = extended_output_shape.Dims(2);
+  const int dim3 = extended_output_shape.Dims(3);
+  const int rows = extended_output_shape.Dims(0) * dim1 * dim2;
+  const int min_rows = cpu_backend_threadpool::MinRangeForElements(dim3);
+  cpu_backend_threadpool::ParallelFor(rows, min_rows, ruy_context, [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const int i2 = row % dim2;
+      const int i1 = (row / dim2) % dim1;
+      const int i0 = row / dim2 / dim1;
+      const int16_t *lhs = input1_data + i0 * input1_strides[0] + i1 * input1_strides[1] +
+                           i2 * input1_strides[2];
+      const int16_t *rhs = input2_data + i0 * input2_strides[0] + i1 * input2_strides[1] +
+                           i2 * input2_strides[2];
+      int16_t *out = output_data + row * dim3;
+      for (int i3 = 0; i3 < dim3; ++i3)
+        out[i3] = compute(lhs[i3 * input1_strides[3]], rhs[i3 * input2_strides[3]]);
+    }
+  });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BINARY_ARITHMETIC_INT16_H__
@@ -18,7 +18,10 @@
 #ifndef __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 #define __NNFW_CKER_BINARY_ARITHMETIC_OPS_H__
 
+#include <algorithm>
 #include <functional>
+#include <stdexcept>
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
@@ -189,32 +192,132 @@ inline bool ProcessBroadcastShapes(const Shape &shape0, const Shape &shape1,
   return true;
 }
 
+namespace binary_arithmetic_detail
+{
+
+// Run fn(shape, input1, input2, output) on ranges of the elements on the threads of the context
+template <typename T, typename ElementwiseFn>
+inline void ParallelElementwise(const Shape &output_shape, const T *input1_data,
+                                const T *input2_data, T *output_data, ruy::Context *ruy_context,
+                                const ElementwiseFn &fn)
+{
+  cpu_backend_threadpool::ParallelForElements(
+    output_shape.FlatSize(), ruy_context, [&](int start, int end) {
+      const Shape shape{end - start};
+      fn(shape, input1_data + start, input2_data + start, output_data + start);
+    });
+}
+
+// Run fn(params, input1, input2, output) of the fivefold broadcast of params on ranges of one of
+// y0 to y3 on the threads of the context
+template <typename T, typename BroadcastFn>
+inline void ParallelBroadcastFiveFold(const BinaryArithmeticOpParam &params, const T *input1_data,
+                                      const T *input2_data, T *output_data,
+                                      ruy::Context *ruy_context, const BroadcastFn &fn)
+{
+  // Other broadcasts leave broadcast_shape unset
+  if (ruy_context == nullptr ||
+      (params.broadcast_category != BroadcastableOpCategory::kFirstInputBroadcastsFast &&
+       params.broadcast_category != BroadcastableOpCategory::kSecondInputBroadcastsFast))
+  {
+    fn(params, input1_data, input2_data, output_data);
+    return;
+  }
+
+  const int *y = params.broadcast_shape;
+  // Strides along y0 to y3 of the input broadcast along y3, of the other one broadcast along y1
+  // and of the output
+  const int a_strides[4] = {y[1] * y[2] * y[4], y[2] * y[4], y[4], 0};
+  const int b_strides[4] = {y[2] * y[3] * y[4], 0, y[3] * y[4], y[4]};
+  const int out_strides[4] = {y[1] * y[2] * y[3] * y[4], y[2] * y[3] * y[4], y[3] * y[4], y[4]};
+  const bool a_is_input1 =
+    params.broadcast_category == BroadcastableOpCategory::kFirstInputBroadcastsFast;
+
+  // Split the outermost dimension that has a range for each thread, or else the largest one
+  const int max_threads = ruy_context->max_num_threads();
+  int axis = 0;
+  while (axis < 3 && y[axis] < max_threads)
+    ++axis;
+  if (y[axis] < max_threads)
+    axis = std::max_element(y, y + 4) - y;
+
+  int outer_size = 1;
+  for (int i = 0; i < axis; ++i)
+    outer_size *= y[i];
+
+  auto run_ranges = [&](int start, int end) {
+    BinaryArithmeticOpParam range_params = params;
+    for (int i = 0; i < axis; ++i)
+      range_params.broadcast_shape[i] = 1;
+    range_params.broadcast_shape[axis] = end - start;
+    for (int outer = 0; outer < outer_size; ++outer)
+    {
+      int a_offset = start * a_strides[axis];
+      int b_offset = start * b_strides[axis];
+      int out_offset = start * out_strides[axis];
+      for (int i = axis - 1, index = outer; i >= 0; --i)
+      {
+        a_offset += (index % y[i]) * a_strides[i];
+        b_offset += (index % y[i]) * b_strides[i];
+        out_offset += (index % y[i]) * out_strides[i];
+        index /= y[i];
+      }
+      fn(range_params, input1_data + (a_is_input1 ? a_offset : b_offset),
+         input2_data + (a_is_input1 ? b_offset : a_offset), output_data + out_offset);
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    y[axis], cpu_backend_threadpool::MinRangeForElements(outer_size * out_strides[axis]),
+    ruy_context, run_ranges);
+}
+
+} // namespace binary_arithmetic_detail
+
 template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<!is_quant8<T>::value>
 BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                    const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
-  reference::BinaryArithmeticOp(params, input1_shape, input1_data, input2_shape, input2_data,
-                                output_shape, output_data, GetBinaryArtithmeticFn<op_type, T>());
+  UNUSED_RELEASE(input1_shape);
+  UNUSED_RELEASE(input2_shape);
+  assert(MatchingElementsSize(input1_shape, input2_shape, output_shape) == output_shape.FlatSize());
+  // Integer division throws on zero, which must happen on the caller
+  if (op_type == BinaryArithmeticOpType::DIV)
+    ruy_context = nullptr;
+  const auto fn = GetBinaryArtithmeticFn<op_type, T>();
+  binary_arithmetic_detail::ParallelElementwise(
+    output_shape, input1_data, input2_data, output_data, ruy_context,
+    [&](const Shape &shape, const T *input1, const T *input2, T *output) {
+      reference::BinaryArithmeticOp(params, shape, input1, shape, input2, shape, output, fn);
+    });
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<is_quant8<T>::value>
 BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                    const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
+  UNUSED_RELEASE(input1_shape);
+  UNUSED_RELEASE(input2_shape);
+  assert(MatchingElementsSize(input1_shape, input2_shape, output_shape) == output_shape.FlatSize());
   switch (op_type)
   {
     case nnfw::cker::BinaryArithmeticOpType::ADD:
     case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::Add(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
+      binary_arithmetic_detail::ParallelElementwise(
+        output_shape, input1_data, input2_data, output_data, ruy_context,
+        [&](const Shape &shape, const T *input1, const T *input2, T *output) {
+          optimized::Add(params, shape, input1, shape, input2, shape, output);
+        });
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::Mul(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
+      binary_arithmetic_detail::ParallelElementwise(
+        output_shape, input1_data, input2_data, output_data, ruy_context,
+        [&](const Shape &shape, const T *input1, const T *input2, T *output) {
+          optimized::Mul(params, shape, input1, shape, input2, shape, output);
+        });
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
       throw std::runtime_error{"Quant8 Asymm NYI"};
@@ -228,38 +331,42 @@ template <BinaryArithmeticOpType op_type>
 inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                const float *input1_data, const Shape &input2_shape,
                                const float *input2_data, const Shape &output_shape,
-                               float *output_data)
+                               float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  // Supported type is only float now
-  switch (op_type)
-  {
-    case nnfw::cker::BinaryArithmeticOpType::ADD:
-      optimized::Add(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::Mul(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::Sub(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    case nnfw::cker::BinaryArithmeticOpType::DIV:
-      optimized::Div(params, input1_shape, input1_data, input2_shape, input2_data, output_shape,
-                     output_data);
-      break;
-    default:
-      assert(false);
-      break;
-  }
+  UNUSED_RELEASE(input1_shape);
+  UNUSED_RELEASE(input2_shape);
+  assert(MatchingElementsSize(input1_shape, input2_shape, output_shape) == output_shape.FlatSize());
+  binary_arithmetic_detail::ParallelElementwise(
+    output_shape, input1_data, input2_data, output_data, ruy_context,
+    [&](const Shape &shape, const float *input1, const float *input2, float *output) {
+      // Supported type is only float now
+      switch (op_type)
+      {
+        case nnfw::cker::BinaryArithmeticOpType::ADD:
+          optimized::Add(params, shape, input1, shape, input2, shape, output);
+          break;
+        case nnfw::cker::BinaryArithmeticOpType::MUL:
+          optimized::Mul(params, shape, input1, shape, input2, shape, output);
+          break;
+        case nnfw::cker::BinaryArithmeticOpType::SUB:
+          optimized::Sub(params, shape, input1, shape, input2, shape, output);
+          break;
+        case nnfw::cker::BinaryArithmeticOpType::DIV:
+          optimized::Div(params, shape, input1, shape, input2, shape, output);
+          break;
+        default:
+          assert(false);
+          break;
+      }
+    });
 }
 
 template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<!is_quant8<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                            const Shape &output_shape, T *output_data)
+                            const Shape &output_shape, T *output_data,
+                            ruy::Context * /* ruy_context */ = nullptr)
 {
   reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
                                              input2_data, output_shape, output_data,
@@ -270,18 +377,29 @@ template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<is_quant8<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                            const Shape &output_shape, T *output_data)
+                            const Shape &output_shape, T *output_data,
+                            ruy::Context *ruy_context = nullptr)
 {
   switch (op_type)
   {
     case nnfw::cker::BinaryArithmeticOpType::ADD:
     case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::BroadcastAddDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      binary_arithmetic_detail::ParallelBroadcastFiveFold(
+        params, input1_data, input2_data, output_data, ruy_context,
+        [&](const BinaryArithmeticOpParam &range_params, const T *input1, const T *input2,
+            T *output) {
+          optimized::BroadcastAddDispatch(range_params, input1_shape, input1, input2_shape, input2,
+                                          output_shape, output);
+        });
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::BroadcastMulDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      binary_arithmetic_detail::ParallelBroadcastFiveFold(
+        params, input1_data, input2_data, output_data, ruy_context,
+        [&](const BinaryArithmeticOpParam &range_params, const T *input1, const T *input2,
+            T *output) {
+          optimized::BroadcastMulDispatch(range_params, input1_shape, input1, input2_shape, input2,
+                                          output_shape, output);
+        });
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
     case nnfw::cker::BinaryArithmeticOpType::POW:
@@ -296,22 +414,37 @@ template <BinaryArithmeticOpType op_type>
 inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                         const float *input1_data, const Shape &input2_shape,
                                         const float *input2_data, const Shape &output_shape,
-                                        float *output_data)
+                                        float *output_data, ruy::Context *ruy_context = nullptr)
 {
   // Supported type is only float now
   switch (op_type)
   {
     case nnfw::cker::BinaryArithmeticOpType::ADD:
-      optimized::BroadcastAddDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      binary_arithmetic_detail::ParallelBroadcastFiveFold(
+        params, input1_data, input2_data, output_data, ruy_context,
+        [&](const BinaryArithmeticOpParam &range_params, const float *input1, const float *input2,
+            float *output) {
+          optimized::BroadcastAddDispatch(range_params, input1_shape, input1, input2_shape, input2,
+                                          output_shape, output);
+        });
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
-      optimized::BroadcastMulDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      binary_arithmetic_detail::ParallelBroadcastFiveFold(
+        params, input1_data, input2_data, output_data, ruy_context,
+        [&](const BinaryArithmeticOpParam &range_params, const float *input1, const float *input2,
+            float *output) {
+          optimized::BroadcastMulDispatch(range_params, input1_shape, input1, input2_shape, input2,
+                                          output_shape, output);
+        });
       break;
     case nnfw::cker::BinaryArithmeticOpType::SUB:
-      optimized::BroadcastSubDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+      binary_arithmetic_detail::ParallelBroadcastFiveFold(
+        params, input1_data, input2_data, output_data, ruy_context,
+        [&](const BinaryArithmeticOpParam &range_params, const float *input1, const float *input2,
+            float *output) {
+          optimized::BroadcastSubDispatch(range_params, input1_shape, input1, input2_shape, input2,
+                                          output_shape, output);
+        });
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
       optimized::BroadcastDivDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
@@ -23,6 +23,9 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/DirectConv.h"
+#include "cker/operation/optimized/WinogradConv.h"
+#include "cker/operation/optimized/integer_ops/ConvInt8.h"
 #include <iostream>
 #include <vector>
 
@@ -52,10 +55,57 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 }
 } // namespace
 
+/**
+ * @brief Kernels of float convolution
+ */
+enum class ConvAlgorithm
+{
+  // Chosen by the heuristics of Conv
+  kDefault,
+  kWinograd,
+  kDirect,
+  kMultithreaded,
+  kReference,
+};
+
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  Conv()
+    : _modified_filter_data(), _transposed_filter_data(nullptr), _winograd_filter(),
+      _winograd_filter_data(nullptr), _im2col_shape(4), _need_im2col(false), _prepared(false),
+      _algorithm(ConvAlgorithm::kDefault)
+  {
+  }
+
+  /**
+   * @brief Use a float kernel instead of the one chosen by heuristics, e.g. the fastest one
+   *        measured on the actual shapes
+   * @note  It must be called before prepare() and prepareWinograd(), and the kernel must be one
+   *        of usableAlgorithms()
+   */
+  void setAlgorithm(ConvAlgorithm algorithm) { _algorithm = algorithm; }
+
+  ConvAlgorithm algorithm() const { return _algorithm; }
+
+  /**
+   * @brief Get optimized float kernels which can run a convolution of the given parameters
+   */
+  std::vector<ConvAlgorithm> usableAlgorithms(const Shape &filter_shape, PaddingType padding_type,
+                                              uint32_t stride_width, uint32_t stride_height,
+                                              uint32_t dilation_width_factor,
+                                              uint32_t dilation_height_factor) const
+  {
+    std::vector<ConvAlgorithm> algorithms;
+    if (optimized::IsWinogradProfitable(filter_shape, stride_width, stride_height,
+                                        dilation_width_factor, dilation_height_factor))
+      algorithms.push_back(ConvAlgorithm::kWinograd);
+    algorithms.push_back(ConvAlgorithm::kDirect);
+    if (padding_type != PaddingType::kNone && dilation_width_factor == 1 &&
+        dilation_height_factor == 1)
+      algorithms.push_back(ConvAlgorithm::kMultithreaded);
+    return algorithms;
+  }
 
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                bool &is_replaced_weights, uint32_t dilationWidthFactor,
@@ -63,7 +113,7 @@ public:
   {
     if (!_prepared)
     {
-      if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+      if (transposesFilter(filter_shape, padding_type, dilationWidthFactor, dilationHeightFactor))
       {
         transposeFilter(filter_shape, filter_data, is_replaced_weights);
       }
@@ -71,6 +121,86 @@ public:
     }
   }
 
+  /**
+   * @brief Return true if prepare() transposes the filter for the given parameters
+   */
+  bool transposesFilter(const Shape &filter_shape, PaddingType padding_type,
+                        uint32_t dilationWidthFactor, uint32_t dilationHeightFactor) const
+  {
+    return usesDirectConv(filter_shape) ||
+           usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor);
+  }
+
+  /**
+   * @brief Return true if the float kernel convolves a filter of the given shape directly, which
+   *        takes the transposed filter as well
+   */
+  bool usesDirectConv(const Shape &filter_shape) const
+  {
+    if (_algorithm != ConvAlgorithm::kDefault)
+      return _algorithm == ConvAlgorithm::kDirect;
+    return optimized::IsDirectConvProfitable(filter_shape);
+  }
+
+  /**
+   * @brief Get the filter transposed by prepare()
+   */
+  const std::vector<float> &transposedFilter() const { return _modified_filter_data; }
+
+  /**
+   * @brief Use a filter transposed in advance, e.g. mapped from a file, instead of the one
+   *        transposed by prepare()
+   * @note  The data must be alive while this kernel runs
+   */
+  void setTransposedFilter(const float *transposed_filter_data)
+  {
+    std::vector<float>().swap(_modified_filter_data);
+    _transposed_filter_data = transposed_filter_data;
+    _prepared = true;
+  }
+
+  /**
+   * @brief Return true if prepareWinograd() applies to a filter of the given parameters
+   */
+  bool usesWinograd(const Shape &filter_shape, uint32_t stride_width, uint32_t stride_height,
+                    uint32_t dilation_width_factor, uint32_t dilation_height_factor) const
+  {
+    if (_algorithm != ConvAlgorithm::kDefault)
+      return _algorithm == ConvAlgorithm::kWinograd;
+    return optimized::IsWinogradProfitable(filter_shape, stride_width, stride_height,
+                                           dilation_width_factor, dilation_height_factor);
+  }
+
+  /**
+   * @brief Transform a constant 3x3 filter for Winograd convolution, which the float kernel uses
+   *        from then on
+   */
+  void prepareWinograd(const Shape &filter_shape, const float *filter_data)
+  {
+    optimized::WinogradTransformFilter(filter_shape, filter_data, _winograd_filter);
+    _winograd_filter_data = _winograd_filter.data();
+    _prepared = true;
+  }
+
+  /**
+   * @brief Get the filter transformed by prepareWinograd()
+   */
+  const std::vector<float> &winogradFilter() const { return _winograd_filter; }
+
+  /**
+   * @brief Use a filter transformed in advance, e.g. mapped from a file, instead of the one
+   *        transformed by prepareWinograd()
+   * @note  The data must be alive while this kernel runs
+   */
+  void setWinogradFilter(const float *winograd_filter_data)
+  {
+    std::vector<float>().swap(_winograd_filter);
+    _winograd_filter_data = winograd_filter_data;
+    _prepared = true;
+  }
+
+  bool hasWinogradFilter() const { return _winograd_filter_data != nullptr; }
+
   void prepareQuant(const Shape &input_shape, const Shape &kernel_shape, const Shape &output_shape,
                     uint32_t stride_width, uint32_t stride_height, uint32_t dilation_width_factor,
                     uint32_t dilation_height_factor)
@@ -85,10 +215,27 @@ public:
 
   void operator()(const ConvParams &params, const Shape &input_shape, const float *input_data,
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
-                  const float *bias_data, const Shape &output_shape, float *output_data)
+                  const float *bias_data, const Shape &output_shape, float *output_data,
+                  ruy::Context *ruy_context = nullptr)
   {
-    if (usableMultiThreaded(params.padding_type, params.dilation_width_factor,
-                            params.dilation_height_factor))
+    if (_winograd_filter_data != nullptr)
+    {
+      optimized::WinogradConv(params, input_shape, input_data, filter_shape, _winograd_filter_data,
+                              bias_shape, bias_data, output_shape, output_data, ruy_context);
+    }
+    else if (usesDirectConv(filter_shape))
+    {
+      // Small filters skip the im2col buffer, which is many times larger than the input
+      bool transposed_in_execution = false;
+      if (!_prepared)
+        transposeFilter(filter_shape, filter_data, transposed_in_execution);
+      const float *transposed_filter_data =
+        _transposed_filter_data ? _transposed_filter_data : &_modified_filter_data[0];
+      optimized::DirectConv(params, input_shape, input_data, filter_shape, transposed_filter_data,
+                            bias_shape, bias_data, output_shape, output_data, ruy_context);
+    }
+    else if (usableMultiThreaded(params.padding_type, params.dilation_width_factor,
+                                 params.dilation_height_factor))
     {
       bool transposed_in_execution = false;
       if (!_prepared)
@@ -98,7 +245,9 @@ public:
         // transposing filter data
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
+      const float *transposed_filter_data =
+        _transposed_filter_data ? _transposed_filter_data : &_modified_filter_data[0];
+      multithreaded::Conv(params, input_shape, input_data, filter_shape, transposed_filter_data,
                           bias_shape, bias_data, output_shape, output_data);
     }
     else
@@ -146,15 +295,31 @@ public:
                     input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
                     output_shape, output_data);
   }
+
+  void operator()(const ConvParams &params, const Shape &input_shape, const int8_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data,
+                  ruy::Context *ruy_context)
+  {
+    optimized_integer_ops::ConvPerChannel(
+      params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(), input_shape,
+      input_data, filter_shape, filter_data, bias_shape, bias_data, output_shape, output_data,
+      _im2col_int8_data, ruy_context);
+  }
   std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
   std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
 
 private:
   bool usableMultiThreaded(PaddingType padding_type, uint32_t dilation_width_factor,
-                           int32_t dilation_height_factor)
+                           int32_t dilation_height_factor) const
   {
-    return padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1 &&
-           dilation_width_factor == 1 && dilation_height_factor == 1;
+    if (_algorithm == ConvAlgorithm::kReference)
+      return false;
+    if (_algorithm != ConvAlgorithm::kMultithreaded &&
+        std::thread::hardware_concurrency() <= 1)
+      return false;
+    return padding_type != PaddingType::kNone && dilation_width_factor == 1 &&
+           dilation_height_factor == 1;
   }
 
   void transposeFilter(const Shape &filter_shape, const float *filter_data,
@@ -188,12 +353,18 @@ private:
 
 private:
   std::vector<float> _modified_filter_data;
+  const float *_transposed_filter_data;
+  std::vector<float> _winograd_filter;
+  const float *_winograd_filter_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  ConvAlgorithm _algorithm;
   // Per channel output multiplier and shift.
   std::vector<int32_t> _per_channel_output_multiplier;
   std::vector<int> _per_channel_output_shift;
+  // Im2col buffer of int8 convolution, which is reused over runs
+  std::vector<int8_t> _im2col_int8_data;
 };
 } // namespace cker
 } // namespace nnfw
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_CONV_INT16_H__
+#define __NNFW_CKER_CONV_INT16_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Int16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Convolution of int16 NHWC input with int8 OHWI filter and per-channel multipliers
+ *
+ * Input and filter are symmetric, so each filter tap is a dot product over the input channels.
+ * Bias is int64 as 16x8 quantized models have it, and rows of the output are split among threads.
+ */
+inline void ConvInt16(const ConvParams &params, const int32_t *output_multiplier,
+                      const int32_t *output_shift, const Shape &input_shape,
+                      const int16_t *input_data, const Shape &filter_shape,
+                      const int8_t *filter_data, const Shape &bias_shape, const int64_t *bias_data,
+                      const Shape &output_shape, int16_t *output_data, ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.input_offset == 0);
+  (void)bias_shape;
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  auto conv_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const int batch = row / output_height;
+      const int out_y = row % output_height;
+      const int in_y_origin = out_y * stride_height - pad_height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = out_x * stride_width - pad_width;
+        int16_t *output_ptr = output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+        {
+          int64_t acc = 0;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          {
+            const int in_y = in_y_origin + dilation_height_factor * filter_y;
+            if (in_y < 0 || in_y >= input_height)
+              continue;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            {
+              const int in_x = in_x_origin + dilation_width_factor * filter_x;
+              if (in_x < 0 || in_x >= input_width)
+                continue;
+              const int16_t *input_ptr = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+              const int8_t *filter_ptr =
+                filter_data + Offset(filter_shape, out_channel, filter_y, filter_x, 0);
+              acc += Int16x8Dot(input_ptr, filter_ptr, input_depth);
+            }
+          }
+          if (bias_data != nullptr)
+            acc += bias_data[out_channel];
+          output_ptr[out_channel] =
+            RequantizeInt16(acc, output_multiplier[out_channel], output_shift[out_channel],
+                            output_offset, output_activation_min, output_activation_max);
+        }
+      }
+    }
+  };
+
+  const int macs_per_row = output_width * output_depth * filter_height * filter_width * input_depth;
+  const int min_rows = std::max(1, 65536 / std::max(1, macs_per_row));
+  cpu_backend_threadpool::ParallelFor(batches * output_height, min_rows, ruy_context, conv_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_CONV_INT16_H__
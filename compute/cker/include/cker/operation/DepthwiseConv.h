@@ -74,17 +74,21 @@ private:
   int thread_dim_;
 };
 
-inline int HowManyConvThreads(const Shape &output_shape, const Shape &filter_shape)
+// How many scalar multiplications are needed to make it worth using one more thread
+constexpr int kMinMulPerThread = 1 << 13; // 8k
+// Float kernels take a few cycles per multiplication, so that more of them are needed to make up
+// for waking a thread
+constexpr int kMinFloatMulPerThread = 1 << 15; // 32k
+
+inline int HowManyConvThreads(const Shape &output_shape, const Shape &filter_shape,
+                              int min_muls_per_thread = kMinMulPerThread)
 {
-  // How many scalar multiplications are needed to make it worth using one
-  // more thread
-  static constexpr int kMinMulPerThread = 1 << 13; // 8k
   const int filter_height = filter_shape.Dims(1);
   const int filter_width = filter_shape.Dims(2);
   const int num_muls = output_shape.FlatSize() * filter_height * filter_width;
   // Try to avoid real runtime divisions if possible by dividing by a
   // compile-time constant.
-  int thread_count = std::max(1, num_muls / kMinMulPerThread);
+  int thread_count = std::max(1, num_muls / min_muls_per_thread);
   return thread_count;
 }
 
@@ -126,23 +130,23 @@ inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_
   assert(filter_shape.DimensionsCount() == 4);
   assert(output_shape.DimensionsCount() == 4);
 
-  int thread_count = HowManyConvThreads(output_shape, filter_shape);
+  // Float layers used to be capped at 2 threads for small layers not to regress (b/132294857).
+  // They take more work per thread instead, so that large layers use all the threads leased.
+  int thread_count = HowManyConvThreads(
+    output_shape, filter_shape,
+    std::is_floating_point<T>::value ? kMinFloatMulPerThread : kMinMulPerThread);
 
   // NOTE Borrow RuyContext to get max_num_threads setting
   // TODO Define and use max_num_threads for CPU backend
   const auto max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
 
-  thread_count = std::max(1, std::min(thread_count, max_threads));
-  // Cap the number of threads to 2 for float path to avoid regression in
-  // performance (b/132294857).
-  if (std::is_floating_point<T>::value)
-  {
-    thread_count = std::min(thread_count, 2);
-  }
-
   const int output_batches = output_shape.Dims(0);
   const int output_height = output_shape.Dims(1);
 
+  // Threads more than the output rows would have nothing to do
+  thread_count = std::max(1, std::min(thread_count, max_threads));
+  thread_count = std::min(thread_count, std::max(output_height, output_batches));
+
   if (thread_count == 1)
   {
     optimized::DepthwiseConvImpl(params, input_shape, input_data, filter_shape, filter_data,
@@ -161,6 +165,7 @@ inline void DepthwiseConv(const DepthwiseConvParams &params, const Shape &input_
   {
     thread_dim = 1;
     thread_dim_size = output_height;
+    thread_count = std::min(thread_count, output_height);
   }
 
   std::vector<DepthwiseConvWorkerTask<T, TS>> tasks;
@@ -17,6 +17,7 @@
 #ifndef __NNFW_CKER_DEQUANTIZE_H__
 #define __NNFW_CKER_DEQUANTIZE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/neon/neon_check.h"
@@ -41,35 +42,14 @@ inline void ScaleWithNewZeroPoint(const int32x4_t input, const float32x4_t scale
 } // namespace
 #endif // USE_NEON
 
-inline void Dequantize(const Shape &input_shape, const uint8_t *input_data,
-                       const Shape &output_shape, float *output_data, const float scale,
-                       const int32_t zero_point)
+namespace
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
 
-  int i = 0;
-#ifdef USE_NEON
-  const float32x4_t scale_dup = vdupq_n_f32(static_cast<float>(scale));
-  const float32x4_t zero_times_scale_dup = vdupq_n_f32(static_cast<float>(-zero_point * scale));
-  for (; i <= flat_size - 8; i += 8)
-  {
-    const uint8x8_t input_u8 = vld1_u8(input_data + i);
-    const uint16x8_t input_u16 = vmovl_u8(input_u8);
-    const int16x8_t input_s16 = vreinterpretq_s16_u16(input_u16);
-    const int16x4_t input_s16_low = vget_low_s16(input_s16);
-    const int16x4_t input_s16_high = vget_high_s16(input_s16);
-    const int32x4_t val_low = vmovl_s16(input_s16_low);
-    const int32x4_t val_high = vmovl_s16(input_s16_high);
-
-    float32x4_t result_low, result_high;
-    ScaleWithNewZeroPoint(val_low, scale_dup, zero_times_scale_dup, &result_low);
-    ScaleWithNewZeroPoint(val_high, scale_dup, zero_times_scale_dup, &result_high);
-
-    vst1q_f32(output_data + i, result_low);
-    vst1q_f32(output_data + i + 4, result_high);
-  }
-#endif // NEON
-  for (; i < flat_size; ++i)
+template <typename InputT>
+inline void DequantizeTail(const InputT *input_data, int start, int end, float *output_data,
+                           const float scale, const int32_t zero_point)
+{
+  for (int i = start; i < end; ++i)
   {
     const int32_t val = input_data[i];
     const float result = static_cast<float>(scale * (val - zero_point));
@@ -77,39 +57,78 @@ inline void Dequantize(const Shape &input_shape, const uint8_t *input_data,
   }
 }
 
-inline void Dequantize(const Shape &input_shape, const int8_t *input_data,
-                       const Shape &output_shape, float *output_data, const float scale,
-                       const int32_t zero_point)
+#ifdef USE_NEON
+inline void DequantizeVector(const int16x8_t input_s16, const float32x4_t scale_dup,
+                             const float32x4_t zero_times_scale_dup, float *output)
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  const int32x4_t val_low = vmovl_s16(vget_low_s16(input_s16));
+  const int32x4_t val_high = vmovl_s16(vget_high_s16(input_s16));
+
+  float32x4_t result_low, result_high;
+  ScaleWithNewZeroPoint(val_low, scale_dup, zero_times_scale_dup, &result_low);
+  ScaleWithNewZeroPoint(val_high, scale_dup, zero_times_scale_dup, &result_high);
+
+  vst1q_f32(output, result_low);
+  vst1q_f32(output + 4, result_high);
+}
 
-  int i = 0;
+inline int16x8_t LoadAsInt16(const uint8_t *input)
+{
+  return vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input)));
+}
+inline int16x8_t LoadAsInt16(const int8_t *input) { return vmovl_s8(vld1_s8(input)); }
+inline int16x8_t LoadAsInt16(const int16_t *input) { return vld1q_s16(input); }
+#endif // USE_NEON
+
+template <typename InputT>
+inline void DequantizeRange(const InputT *input_data, int start, int end, float *output_data,
+                            const float scale, const int32_t zero_point)
+{
+  int i = start;
 #ifdef USE_NEON
   const float32x4_t scale_dup = vdupq_n_f32(static_cast<float>(scale));
   const float32x4_t zero_times_scale_dup = vdupq_n_f32(static_cast<float>(-zero_point * scale));
-  for (; i <= flat_size - 8; i += 8)
+  for (; i <= end - 8; i += 8)
   {
-    const int8x8_t input_s8 = vld1_s8(input_data + i);
-    const int16x8_t input_s16 = vmovl_s8(input_s8);
-    const int16x4_t input_s16_low = vget_low_s16(input_s16);
-    const int16x4_t input_s16_high = vget_high_s16(input_s16);
-    const int32x4_t val_low = vmovl_s16(input_s16_low);
-    const int32x4_t val_high = vmovl_s16(input_s16_high);
-
-    float32x4_t result_low, result_high;
-    ScaleWithNewZeroPoint(val_low, scale_dup, zero_times_scale_dup, &result_low);
-    ScaleWithNewZeroPoint(val_high, scale_dup, zero_times_scale_dup, &result_high);
-
-    vst1q_f32(output_data + i, result_low);
-    vst1q_f32(output_data + i + 4, result_high);
+    DequantizeVector(LoadAsInt16(input_data + i), scale_dup, zero_times_scale_dup,
+                     output_data + i);
   }
 #endif // NEON
-  for (; i < flat_size; ++i)
-  {
-    const int32_t val = input_data[i];
-    const float result = static_cast<float>(scale * (val - zero_point));
-    output_data[i] = result;
-  }
+  DequantizeTail(input_data, i, end, output_data, scale, zero_point);
+}
+
+template <typename InputT>
+inline void DequantizeTo(const Shape &input_shape, const InputT *input_data,
+                         const Shape &output_shape, float *output_data, const float scale,
+                         const int32_t zero_point, ruy::Context *ruy_context)
+{
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  cpu_backend_threadpool::ParallelForElements(flat_size, ruy_context, [&](int start, int end) {
+    DequantizeRange(input_data, start, end, output_data, scale, zero_point);
+  });
+}
+
+} // namespace
+
+inline void Dequantize(const Shape &input_shape, const uint8_t *input_data,
+                       const Shape &output_shape, float *output_data, const float scale,
+                       const int32_t zero_point, ruy::Context *ruy_context = nullptr)
+{
+  DequantizeTo(input_shape, input_data, output_shape, output_data, scale, zero_point, ruy_context);
+}
+
+inline void Dequantize(const Shape &input_shape, const int8_t *input_data,
+                       const Shape &output_shape, float *output_data, const float scale,
+                       const int32_t zero_point, ruy::Context *ruy_context = nullptr)
+{
+  DequantizeTo(input_shape, input_data, output_shape, output_data, scale, zero_point, ruy_context);
+}
+
+inline void Dequantize(const Shape &input_shape, const int16_t *input_data,
+                       const Shape &output_shape, float *output_data, const float scale,
+                       const int32_t zero_point, ruy::Context *ruy_context = nullptr)
+{
+  DequantizeTo(input_shape, input_data, output_shape, output_data, scale, zero_point, ruy_context);
 }
 
 } // namespace cker
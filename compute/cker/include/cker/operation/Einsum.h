@@ -18,15 +18,15 @@
 #ifndef __NNFW_CKER_EINSUM_H__
 #define __NNFW_CKER_EINSUM_H__
 
-#include "cker/Types.h"
 #include "cker/Shape.h"
+#include "cker/Types.h"
 #include "cker/Utils.h"
 
 #include "cker/operation/Helper/Tensor.h"
 #include "cker/operation/Helper/MatmulBCast.h"
 
 #include "Transpose.h"
-#include "BatchMatMul.h"
+#include "optimized/BatchMatMul.h"
 
 #include <string>
 #include <vector>
@@ -201,13 +201,19 @@ public:
 
   void operator()(std::string &equation, const std::vector<Shape> &input_shapes,
                   const std::vector<const float *> &input_data, const Shape &output_shape,
-                  float *output_data)
+                  float *output_data, ruy::Context *ruy_context = nullptr)
   {
     if (!_prepared)
     {
       prepare(equation);
     }
 
+    if (_matmul_plan.enabled &&
+        matMulDirect(input_shapes, input_data, output_shape, output_data, ruy_context))
+    {
+      return;
+    }
+
     const int num_inputs = input_shapes.size();
     std::vector<InputTensor<float>> inputs(num_inputs);
     for (int i = 0; i < num_inputs; i++)
@@ -247,7 +253,8 @@ public:
     // contraction. If num_inputs is 1, the reduced input is simply forwarded to
     // the output.
     Tensor contraction_output_reshaped;
-    contractOperands(inputs_reduced, swap_free_and_contract, &contraction_output_reshaped);
+    contractOperands(inputs_reduced, swap_free_and_contract, &contraction_output_reshaped,
+                     ruy_context);
 
     // Copy the batch labels from the contraction output. Recover the batch
     // shape, which may have been broadcasted.
@@ -398,6 +405,171 @@ private:
         num_inputs == 1 || _input_label_counts[0][label] == 0 || _input_label_counts[1][label] == 0;
       _label_types[label] = getDimensionType(removed, unique);
     }
+
+    planMatMul();
+  }
+
+  // Finds out whether the equation is a BatchMatMul of the operands as they are, i.e. each
+  // operand is [batch] + [free, contract] in either order and the output is [batch] + [free of
+  // one operand, free of the other], e.g. 'bij,bjk->bik' and 'bhqd,bhkd->bhqk'.
+  void planMatMul()
+  {
+    _matmul_plan = MatMulPlan();
+
+    if (_input_labels.size() != 2 || _output_has_ellipsis)
+      return;
+    for (size_t i = 0; i < _input_labels.size(); ++i)
+    {
+      if (_input_has_ellipsis[i])
+        return;
+    }
+
+    auto has_repeated = [](const LabelCounts &counts) {
+      return std::any_of(counts.begin(), counts.end(), [](int c) { return c > 1; });
+    };
+    if (has_repeated(_input_label_counts[0]) || has_repeated(_input_label_counts[1]) ||
+        has_repeated(_output_label_counts))
+      return;
+    if (std::find(_label_types.begin(), _label_types.end(), kReduce) != _label_types.end())
+      return;
+
+    // Batch labels lead every operand and the output in the same order
+    const int num_batch = std::count(_label_types.begin(), _label_types.end(), kBatch);
+    const Labels batch_labels(_output_labels.begin(), _output_labels.begin() + num_batch);
+    for (const Labels *labels : {&_input_labels[0], &_input_labels[1], &_output_labels})
+    {
+      if (static_cast<int>(labels->size()) < num_batch ||
+          !std::equal(batch_labels.begin(), batch_labels.end(), labels->begin()))
+        return;
+    }
+    for (int label : batch_labels)
+    {
+      if (_label_types[label] != kBatch)
+        return;
+    }
+
+    // The rest of each operand is a group of free labels and a group of contract labels
+    Labels free[2];
+    Labels contract[2];
+    bool contract_first[2];
+    for (int i = 0; i < 2; ++i)
+    {
+      const Labels &labels = _input_labels[i];
+      bool seen_free = false;
+      bool seen_contract = false;
+      int groups = 0;
+      DimensionType prev = kBatch;
+      for (size_t j = num_batch; j < labels.size(); ++j)
+      {
+        const DimensionType type = _label_types[labels[j]];
+        if (type == kFree)
+        {
+          free[i].push_back(labels[j]);
+          seen_free = true;
+        }
+        else
+        {
+          contract[i].push_back(labels[j]);
+          seen_contract = true;
+        }
+        if (type != prev)
+          ++groups;
+        prev = type;
+        if (j == static_cast<size_t>(num_batch))
+          contract_first[i] = (type == kContract);
+      }
+      if (groups > 2)
+        return;
+      if (!(seen_free && seen_contract))
+        contract_first[i] = false;
+    }
+    if (contract[0] != contract[1])
+      return;
+
+    // The output takes the free labels of lhs and then those of rhs
+    Labels out_free(_output_labels.begin() + num_batch, _output_labels.end());
+    Labels free_01(free[0]);
+    free_01.insert(free_01.end(), free[1].begin(), free[1].end());
+    Labels free_10(free[1]);
+    free_10.insert(free_10.end(), free[0].begin(), free[0].end());
+    if (out_free == free_01)
+      _matmul_plan.lhs = 0;
+    else if (out_free == free_10)
+      _matmul_plan.lhs = 1;
+    else
+      return;
+
+    const int lhs = _matmul_plan.lhs;
+    const int rhs = 1 - lhs;
+    _matmul_plan.enabled = true;
+    _matmul_plan.num_batch = num_batch;
+    _matmul_plan.num_contract = contract[0].size();
+    // lhs is [rows, depth] and rhs is [depth, cols] unless they are adjoint
+    _matmul_plan.adj_x = contract_first[lhs];
+    _matmul_plan.adj_y = !contract_first[rhs] && !free[rhs].empty() && !contract[rhs].empty();
+  }
+
+  // Runs the contraction planned by planMatMul() into the output without any copy of operands.
+  // Returns false when the shapes do not allow it, e.g. a batch dimension is broadcast.
+  bool matMulDirect(const std::vector<Shape> &input_shapes,
+                    const std::vector<const float *> &input_data, const Shape &output_shape,
+                    float *output_data, ruy::Context *ruy_context)
+  {
+    const MatMulPlan &plan = _matmul_plan;
+    const Shape &lhs = input_shapes[plan.lhs];
+    const Shape &rhs = input_shapes[1 - plan.lhs];
+    const int num_batch = plan.num_batch;
+    const int lhs_rank = lhs.DimensionsCount();
+    const int rhs_rank = rhs.DimensionsCount();
+    if (lhs_rank != static_cast<int>(_input_labels[plan.lhs].size()) ||
+        rhs_rank != static_cast<int>(_input_labels[1 - plan.lhs].size()))
+      return false;
+
+    auto product = [](const Shape &shape, int begin, int end) {
+      int32_t size = 1;
+      for (int i = begin; i < end; ++i)
+        size *= shape.Dims(i);
+      return size;
+    };
+
+    for (int i = 0; i < num_batch; ++i)
+    {
+      if (lhs.Dims(i) != rhs.Dims(i))
+        return false;
+    }
+    // Contract labels are in the same order in both operands
+    const int lhs_contract = plan.adj_x ? num_batch : lhs_rank - plan.num_contract;
+    const int rhs_contract = plan.adj_y ? rhs_rank - plan.num_contract : num_batch;
+    for (int i = 0; i < plan.num_contract; ++i)
+    {
+      if (lhs.Dims(lhs_contract + i) != rhs.Dims(rhs_contract + i))
+        return false;
+    }
+
+    const int32_t batch = product(lhs, 0, num_batch);
+    const int32_t depth = product(lhs, lhs_contract, lhs_contract + plan.num_contract);
+    const int32_t rows = plan.adj_x ? product(lhs, num_batch + plan.num_contract, lhs_rank)
+                                    : product(lhs, num_batch, lhs_contract);
+    const int32_t cols = plan.adj_y ? product(rhs, num_batch, rhs_contract)
+                                    : product(rhs, num_batch + plan.num_contract, rhs_rank);
+    if (output_shape.FlatSize() != batch * rows * cols)
+      return false;
+    if (output_shape.FlatSize() == 0)
+      return true;
+    if (depth == 0)
+    {
+      std::fill(output_data, output_data + output_shape.FlatSize(), 0.f);
+      return true;
+    }
+
+    const Shape lhs_shape =
+      plan.adj_x ? Shape({batch, depth, rows}) : Shape({batch, rows, depth});
+    const Shape rhs_shape =
+      plan.adj_y ? Shape({batch, cols, depth}) : Shape({batch, depth, cols});
+    optimized::BatchMatMul(lhs_shape, input_data[plan.lhs], rhs_shape, input_data[1 - plan.lhs],
+                           plan.adj_x, plan.adj_y, Shape({batch, rows, cols}), output_data,
+                           ruy_context);
+    return true;
   }
 
   void parseEinsumEquation(const std::string &equation, std::vector<std::string> &input_subscripts,
@@ -854,7 +1026,7 @@ private:
   // very inefficient. The functor should detect if this is the case and perform
   // componentwise multiplication functor instead.
   void contractOperands(std::vector<Tensor> &inputs, std::vector<bool> &swap_free_and_contract,
-                        Tensor *output)
+                        Tensor *output, ruy::Context *ruy_context)
   {
     if (inputs.size() == 1)
       return copyFrom(inputs[0], inputs[0].shape, output);
@@ -900,11 +1072,10 @@ private:
     Tensor output_reshaped;
     reshapeToRank3(*output, bcast.output_batch_size(), &output_reshaped);
 
-    // LaunchBatchMatMul::Launch(lhs, rhs, adj_x, adj_y, bcast, &output_reshaped);
-    BatchMatMul batchMatMul;
-    batchMatMul.prepare(lhs.shape, rhs.shape, adj_x, adj_y);
-    batchMatMul(lhs.shape, lhs.base<float>(), rhs.shape, rhs.base<float>(), adj_x, adj_y,
-                output_reshaped.shape, output_reshaped.base<float>());
+    // Adjoint operands are read in place, without transposing them first
+    optimized::BatchMatMul(lhs.shape, lhs.base<float>(), rhs.shape, rhs.base<float>(), adj_x,
+                           adj_y, output_reshaped.shape, output_reshaped.base<float>(),
+                           ruy_context);
   }
 
   void reshapeToRank3(const Tensor &input, int batch_size, Tensor *output)
@@ -914,8 +1085,22 @@ private:
     copyFrom(input, output_shape, output);
   }
 
+private:
+  // Contraction which BatchMatMul computes on the operands as they are, see planMatMul()
+  struct MatMulPlan
+  {
+    bool enabled = false;
+    // Input taken as lhs, whose free labels come first in the output
+    int lhs = 0;
+    bool adj_x = false;
+    bool adj_y = false;
+    int num_batch = 0;
+    int num_contract = 0;
+  };
+
 private:
   bool _prepared;
+  MatMulPlan _matmul_plan;
 
   OperandLabels _input_labels;
   Labels _output_labels;
@@ -35,7 +35,8 @@ namespace cker
 class FCTempArena
 {
 public:
-  FCTempArena(void) : prepared(false), input_quantized(), scaling_factors(), accum_scratch()
+  FCTempArena(void)
+    : prepared(false), input_quantized(), scaling_factors(), accum_scratch(), channel_accum()
   {
     // DO NOTHING
   }
@@ -56,6 +57,8 @@ public:
   std::vector<int8_t> input_quantized;
   std::vector<float> scaling_factors;
   std::vector<int32_t> accum_scratch;
+  // Accumulator of per-channel quantized weights, which are scaled after multiplication
+  std::vector<float> channel_accum;
 };
 
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
@@ -183,7 +186,17 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
     SymmetricQuantizeFloats(input_data + offset, input_size, quant_data + offset, &unused_min,
                             &unused_max, &scaling_factors_ptr[b]);
     // Incorporate scaling of the filter.
-    scaling_factors_ptr[b] *= params.weights_scale;
+    // Per-channel scales differ by output unit, so they are applied after accumulation
+    if (params.weights_scales == nullptr)
+      scaling_factors_ptr[b] *= params.weights_scale;
+  }
+
+  float *accum_data = output_data;
+  if (params.weights_scales != nullptr)
+  {
+    temp_arena.channel_accum.resize(batch_size * num_units);
+    accum_data = temp_arena.channel_accum.data();
+    ZeroVector(accum_data, batch_size * num_units);
   }
 
 // Compute output += weight * quantized_input
@@ -192,16 +205,28 @@ inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape
   temp_arena.accum_scratch.resize(output_size);
   int32_t *scratch = temp_arena.accum_scratch.data();
   MatrixBatchVectorMultiplyAccumulate(filter_data, num_units, input_size, quant_data,
-                                      scaling_factors_ptr, batch_size, scratch, output_data,
+                                      scaling_factors_ptr, batch_size, scratch, accum_data,
                                       /*result_stride=*/1, ruy_context);
 #else
   MatrixBatchVectorMultiplyAccumulate(filter_data, num_units, input_size, quant_data,
-                                      scaling_factors_ptr, batch_size, output_data,
+                                      scaling_factors_ptr, batch_size, accum_data,
                                       /*result_stride=*/1);
   UNUSED_RELEASE(ruy_context);
   UNUSED_RELEASE(output_shape);
 #endif
 
+  // Dequantize the accumulators of each output unit with its own weights scale
+  if (params.weights_scales != nullptr)
+  {
+    for (int b = 0; b < batch_size; ++b)
+    {
+      const float *accum = accum_data + b * num_units;
+      float *output = output_data + b * num_units;
+      for (int u = 0; u < num_units; ++u)
+        output[u] += accum[u] * params.weights_scales[u];
+    }
+  }
+
   // Apply activation function to floats.
   if (params.activation != FusedActivationFunctionType::kNone)
   {
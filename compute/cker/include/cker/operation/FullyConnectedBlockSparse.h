@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FULLY_CONNECTED_BLOCK_SPARSE_H__
+#define __NNFW_CKER_FULLY_CONNECTED_BLOCK_SPARSE_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Weights with more nonzero blocks than this fraction run faster in the dense kernels
+constexpr float kBlockSparseMaxDensity = 0.3f;
+
+/**
+ * @brief Weights of [rows, cols] in blocks of [block_rows, block_cols], keeping only the blocks
+ *        which have a nonzero value
+ *
+ * The blocks of block row r are segments[r] to segments[r + 1] - 1, each of which is at block
+ * column indices[k] with values in row-major order. It is the layout of the sparsity of models.
+ */
+template <typename T> struct BlockSparseMatrix
+{
+  int rows = 0;
+  int cols = 0;
+  int block_rows = 1;
+  int block_cols = 1;
+  std::vector<int32_t> segments;
+  std::vector<int32_t> indices;
+  std::vector<T> values;
+
+  void build(const T *dense, int rows_, int cols_, int block_rows_, int block_cols_)
+  {
+    assert(rows_ % block_rows_ == 0 && cols_ % block_cols_ == 0);
+    rows = rows_;
+    cols = cols_;
+    block_rows = block_rows_;
+    block_cols = block_cols_;
+    segments.assign(1, 0);
+    indices.clear();
+    values.clear();
+    for (int r = 0; r < rows; r += block_rows)
+    {
+      for (int c = 0; c < cols; c += block_cols)
+      {
+        bool nonzero = false;
+        for (int i = 0; i < block_rows && !nonzero; ++i)
+          for (int j = 0; j < block_cols && !nonzero; ++j)
+            nonzero = dense[(r + i) * cols + c + j] != 0;
+        if (!nonzero)
+          continue;
+        indices.push_back(c / block_cols);
+        for (int i = 0; i < block_rows; ++i)
+          for (int j = 0; j < block_cols; ++j)
+            values.push_back(dense[(r + i) * cols + c + j]);
+      }
+      segments.push_back(indices.size());
+    }
+  }
+};
+
+/**
+ * @brief Return the fraction of the blocks of [block_rows, block_cols] which have a nonzero value
+ */
+template <typename T>
+float BlockDensity(const T *dense, int rows, int cols, int block_rows, int block_cols)
+{
+  assert(rows % block_rows == 0 && cols % block_cols == 0);
+  int nonzero_blocks = 0;
+  for (int r = 0; r < rows; r += block_rows)
+  {
+    for (int c = 0; c < cols; c += block_cols)
+    {
+      bool nonzero = false;
+      for (int i = 0; i < block_rows && !nonzero; ++i)
+        for (int j = 0; j < block_cols && !nonzero; ++j)
+          nonzero = dense[(r + i) * cols + c + j] != 0;
+      nonzero_blocks += nonzero ? 1 : 0;
+    }
+  }
+  const int blocks = (rows / block_rows) * (cols / block_cols);
+  return blocks == 0 ? 1.f : static_cast<float>(nonzero_blocks) / blocks;
+}
+
+/**
+ * @brief Choose the block shape of the least density among the ones the kernels are unrolled for
+ * @return false if the weights are too dense to run faster in any of them
+ * @note   Larger blocks are preferred on a tie since they take fewer indices
+ */
+template <typename T>
+bool ChooseSparseBlock(const T *dense, int rows, int cols, int *block_rows, int *block_cols)
+{
+  static const int kBlockShapes[][2] = {{4, 4}, {16, 1}, {8, 1}, {1, 4}};
+  float best_density = kBlockSparseMaxDensity;
+  bool found = false;
+  for (const auto &shape : kBlockShapes)
+  {
+    if (rows % shape[0] != 0 || cols % shape[1] != 0)
+      continue;
+    const float density = BlockDensity(dense, rows, cols, shape[0], shape[1]);
+    if (density < best_density || (!found && density == best_density))
+    {
+      best_density = density;
+      *block_rows = shape[0];
+      *block_cols = shape[1];
+      found = true;
+    }
+  }
+  return found;
+}
+
+namespace block_sparse_detail
+{
+
+// acc[i] += sum of the blocks from begin to end of a block row with input, for i in block_rows
+template <int R, int C, typename T, typename Acc, typename Index>
+inline void AccumulateBlocks(const Index *indices, const T *values, int begin, int end,
+                             const T *input, Acc input_offset, Acc *acc)
+{
+  for (int k = begin; k < end; ++k)
+  {
+    const T *x = input + indices[k] * C;
+    const T *w = values + k * R * C;
+    Acc xs[C];
+    for (int j = 0; j < C; ++j)
+      xs[j] = static_cast<Acc>(x[j]) + input_offset;
+    for (int i = 0; i < R; ++i)
+      for (int j = 0; j < C; ++j)
+        acc[i] += static_cast<Acc>(w[i * C + j]) * xs[j];
+  }
+}
+
+template <typename T, typename Acc, typename Index>
+inline void AccumulateBlocks(int block_rows, int block_cols, const Index *indices, const T *values,
+                             int begin, int end, const T *input, Acc input_offset, Acc *acc)
+{
+  // Unrolled for the block shapes ChooseSparseBlock() gives, and for ones of models
+  if (block_rows == 4 && block_cols == 4)
+    return AccumulateBlocks<4, 4>(indices, values, begin, end, input, input_offset, acc);
+  if (block_rows == 16 && block_cols == 1)
+    return AccumulateBlocks<16, 1>(indices, values, begin, end, input, input_offset, acc);
+  if (block_rows == 8 && block_cols == 1)
+    return AccumulateBlocks<8, 1>(indices, values, begin, end, input, input_offset, acc);
+  if (block_rows == 1 && block_cols == 4)
+    return AccumulateBlocks<1, 4>(indices, values, begin, end, input, input_offset, acc);
+
+  const int block_size = block_rows * block_cols;
+  for (int k = begin; k < end; ++k)
+  {
+    const T *x = input + indices[k] * block_cols;
+    const T *w = values + k * block_size;
+    for (int i = 0; i < block_rows; ++i)
+      for (int j = 0; j < block_cols; ++j)
+        acc[i] += static_cast<Acc>(w[i * block_cols + j]) * (static_cast<Acc>(x[j]) + input_offset);
+  }
+}
+
+// Run fn(batch, block_row, acc) over the block rows split among the threads, once acc of each
+// block row has the sum of the products with the input of batch
+template <typename T, typename Acc, typename Index, typename Fn>
+inline void ForEachBlockRow(const Shape &input_shape, const T *input_data,
+                            const Shape &weights_shape, int block_rows, int block_cols,
+                            const Index *segments, const Index *indices, const T *values,
+                            const Shape &output_shape, Acc input_offset,
+                            ruy::Context *ruy_context, const Fn &fn)
+{
+  UNUSED_RELEASE(input_shape);
+  assert(weights_shape.DimensionsCount() == 2);
+
+  const int output_dims_count = output_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int output_depth = MatchingDim(weights_shape, 0, output_shape, output_dims_count - 1);
+  const int accum_depth = weights_shape.Dims(1);
+  assert(output_depth % block_rows == 0 && accum_depth % block_cols == 0);
+  assert(input_shape.FlatSize() == batches * accum_depth);
+
+  // Each thread takes the block rows of about the same number of blocks, and takes all the
+  // batches of them so that their weights are read once
+  const int block_row_count = output_depth / block_rows;
+  const int blocks = static_cast<int>(segments[block_row_count]);
+  const int blocks_per_block_row = block_row_count == 0 ? 1 : blocks / block_row_count;
+  const int elements_per_block_row =
+    std::max(1, blocks_per_block_row) * block_rows * block_cols * batches;
+  cpu_backend_threadpool::ParallelFor(
+    block_row_count, cpu_backend_threadpool::MinRangeForElements(elements_per_block_row),
+    ruy_context, [&](int start, int end) {
+      std::vector<Acc> acc(block_rows);
+      for (int b = 0; b < batches; ++b)
+      {
+        const T *input = input_data + b * accum_depth;
+        for (int r = start; r < end; ++r)
+        {
+          std::fill(acc.begin(), acc.end(), Acc{0});
+          AccumulateBlocks(block_rows, block_cols, indices, values, segments[r], segments[r + 1],
+                           input, input_offset, acc.data());
+          fn(b, r, acc.data());
+        }
+      }
+    });
+}
+
+} // namespace block_sparse_detail
+
+/**
+ * @brief FullyConnected of float weights in blocks, clamping the output to the float activation
+ *        range of @p params
+ */
+template <typename Index>
+inline void FullyConnectedBlockSparse(const FullyConnectedParams &params, const Shape &input_shape,
+                                      const float *input_data, const Shape &weights_shape,
+                                      int block_rows, int block_cols, const Index *segments,
+                                      const Index *indices, const float *values,
+                                      const float *bias_data, const Shape &output_shape,
+                                      float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int output_depth = weights_shape.Dims(0);
+  block_sparse_detail::ForEachBlockRow(
+    input_shape, input_data, weights_shape, block_rows, block_cols, segments, indices, values,
+    output_shape, 0.f, ruy_context, [&](int b, int r, const float *acc) {
+      float *output = output_data + b * output_depth + r * block_rows;
+      for (int i = 0; i < block_rows; ++i)
+      {
+        const float bias = bias_data ? bias_data[r * block_rows + i] : 0.f;
+        output[i] = ActivationFunctionWithMinMax(acc[i] + bias, params.float_activation_min,
+                                                 params.float_activation_max);
+      }
+    });
+}
+
+inline void FullyConnectedBlockSparse(const FullyConnectedParams &params, const Shape &input_shape,
+                                      const float *input_data,
+                                      const BlockSparseMatrix<float> &weights,
+                                      const float *bias_data, const Shape &output_shape,
+                                      float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  FullyConnectedBlockSparse(params, input_shape, input_data, Shape{weights.rows, weights.cols},
+                            weights.block_rows, weights.block_cols, weights.segments.data(),
+                            weights.indices.data(), weights.values.data(), bias_data,
+                            output_shape, output_data, ruy_context);
+}
+
+/**
+ * @brief FullyConnected of int8 input and int8 weights in blocks of zero point 0, with an output
+ *        multiplier and shift per output channel
+ */
+inline void FullyConnectedBlockSparse(const FullyConnectedParams &params,
+                                      const int32_t *output_multiplier, const int *output_shift,
+                                      const Shape &input_shape, const int8_t *input_data,
+                                      const BlockSparseMatrix<int8_t> &weights,
+                                      const int32_t *bias_data, const Shape &output_shape,
+                                      int8_t *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int output_depth = weights.rows;
+  block_sparse_detail::ForEachBlockRow(
+    input_shape, input_data, Shape{weights.rows, weights.cols}, weights.block_rows,
+    weights.block_cols, weights.segments.data(), weights.indices.data(), weights.values.data(),
+    output_shape, params.input_offset, ruy_context, [&](int b, int r, const int32_t *acc) {
+      int8_t *output = output_data + b * output_depth + r * weights.block_rows;
+      for (int i = 0; i < weights.block_rows; ++i)
+      {
+        const int channel = r * weights.block_rows + i;
+        int32_t value = acc[i] + (bias_data ? bias_data[channel] : 0);
+        value = MultiplyByQuantizedMultiplier(value, output_multiplier[channel],
+                                              output_shift[channel]);
+        value += params.output_offset;
+        value = std::max(value, params.quantized_activation_min);
+        value = std::min(value, params.quantized_activation_max);
+        output[i] = static_cast<int8_t>(value);
+      }
+    });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FULLY_CONNECTED_BLOCK_SPARSE_H__
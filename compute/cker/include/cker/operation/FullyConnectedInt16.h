@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FULLY_CONNECTED_INT16_H__
+#define __NNFW_CKER_FULLY_CONNECTED_INT16_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Int16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Fully connected layer of int16 input and int8 weights with per-channel multipliers
+ *
+ * Input and weights are symmetric and the bias is int64. Output units are split among threads,
+ * so each thread reads its own rows of the weights once for all batches.
+ */
+inline void FullyConnectedInt16(const FullyConnectedParams &params,
+                                const int32_t *output_multiplier, const int32_t *output_shift,
+                                const Shape &input_shape, const int16_t *input_data,
+                                const Shape &weights_shape, const int8_t *weights_data,
+                                const Shape &bias_shape, const int64_t *bias_data,
+                                const Shape &output_shape, int16_t *output_data,
+                                ruy::Context *ruy_context)
+{
+  assert(params.input_offset == 0 && params.weights_offset == 0);
+  (void)bias_shape;
+  const int dims_count = weights_shape.DimensionsCount();
+  const int input_depth = weights_shape.Dims(dims_count - 1);
+  const int output_depth = weights_shape.Dims(dims_count - 2);
+  const int batches = input_shape.FlatSize() / input_depth;
+  assert(output_shape.FlatSize() == batches * output_depth);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  (void)output_shape;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  auto fc_units = [&](int start, int end) {
+    for (int b = 0; b < batches; ++b)
+    {
+      const int16_t *input_ptr = input_data + b * input_depth;
+      int16_t *output_ptr = output_data + b * output_depth;
+      for (int out_c = start; out_c < end; ++out_c)
+      {
+        int64_t acc = Int16x8Dot(input_ptr, weights_data + out_c * input_depth, input_depth);
+        if (bias_data != nullptr)
+          acc += bias_data[out_c];
+        output_ptr[out_c] =
+          RequantizeInt16(acc, output_multiplier[out_c], output_shift[out_c], output_offset,
+                          output_activation_min, output_activation_max);
+      }
+    }
+  };
+
+  const int macs_per_unit = batches * input_depth;
+  const int min_units = std::max(1, 65536 / std::max(1, macs_per_unit));
+  cpu_backend_threadpool::ParallelFor(output_depth, min_units, ruy_context, fc_units);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FULLY_CONNECTED_INT16_H__
@@ -18,19 +18,29 @@
 #ifndef __NNFW_CKER_GATHER_H__
 #define __NNFW_CKER_GATHER_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace nnfw
 {
 namespace cker
 {
 
+/**
+ * @brief Gather slices of @p input_data along the axis at @p coords_data
+ *
+ * Slices of consecutive coordinates are copied at once, and single elements are assigned instead
+ * of copied. Slices are split among the threads of @p ruy_context.
+ */
 template <typename T, typename CoordsT = int32_t>
 inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
                    const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
-                   T *output_data)
+                   T *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = op_params.axis;
   if (axis < 0)
@@ -54,19 +64,136 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
     inner_size *= input_shape.Dims(i);
   }
 
-  for (int outer = 0; outer < outer_size; ++outer)
-  {
-    for (int i = 0; i < coords_count; ++i)
+  auto gather_slices = [&](int start, int end) {
+    int slice = start;
+    while (slice < end)
     {
+      const int outer = slice / coords_count;
+      const T *input_ptr = input_data + outer * axis_size * inner_size;
+      T *output_ptr = output_data + slice * inner_size;
+      const int i = slice % coords_count;
       assert(coords_data[i] >= 0);
       assert(coords_data[i] < axis_size);
-      std::memcpy(output_data + (outer * coords_count + i) * inner_size,
-                  input_data + (outer * axis_size + coords_data[i]) * inner_size,
-                  sizeof(T) * inner_size);
+
+      // Find the run of consecutive coordinates in this outer slice
+      int run = 1;
+      const int run_limit = std::min(end - slice, coords_count - i);
+      while (run < run_limit && coords_data[i + run] == coords_data[i] + run)
+      {
+        ++run;
+      }
+      assert(coords_data[i] + run <= axis_size);
+
+      const T *run_ptr = input_ptr + coords_data[i] * inner_size;
+      if (inner_size == 1 && run == 1)
+      {
+        *output_ptr = *run_ptr;
+      }
+      else
+      {
+        std::memcpy(output_ptr, run_ptr, sizeof(T) * inner_size * run);
+      }
+      slice += run;
     }
+  };
+
+  const int slices = outer_size * coords_count;
+  const int min_slices = cpu_backend_threadpool::MinRangeForElements(inner_size);
+  cpu_backend_threadpool::ParallelFor(slices, min_slices, ruy_context, gather_slices);
+}
+
+namespace gather_detail
+{
+
+// Rows of this many coordinates ahead are prefetched while the current one is copied
+constexpr int kPrefetchRows = 4;
+// Prefetching stops at this many bytes of a row, which hardware prefetchers carry on from
+constexpr size_t kMaxPrefetchBytes = 2048;
+constexpr size_t kCacheLineSize = 64;
+
+inline void PrefetchRow(const void *row, size_t row_bytes)
+{
+  const char *ptr = static_cast<const char *>(row);
+  const size_t bytes = std::min(row_bytes, kMaxPrefetchBytes);
+  for (size_t offset = 0; offset < bytes; offset += kCacheLineSize)
+  {
+    __builtin_prefetch(ptr + offset);
   }
 }
 
+// Run fn(i) for each of the coordinates split among threads, prefetching the upcoming rows
+template <typename T, typename CoordsT, typename Fn>
+inline void ForEachRow(const T *table, int row_size, const CoordsT *coords_data, int coords_count,
+                       ruy::Context *ruy_context, const Fn &fn)
+{
+  const size_t row_bytes = sizeof(T) * row_size;
+  auto gather_rows = [&](int start, int end) {
+    for (int i = start; i < std::min(end, start + kPrefetchRows); ++i)
+    {
+      PrefetchRow(table + static_cast<size_t>(coords_data[i]) * row_size, row_bytes);
+    }
+    for (int i = start; i < end; ++i)
+    {
+      if (i + kPrefetchRows < end)
+      {
+        const auto row = static_cast<size_t>(coords_data[i + kPrefetchRows]);
+        PrefetchRow(table + row * row_size, row_bytes);
+      }
+      fn(i);
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    coords_count, cpu_backend_threadpool::MinRangeForElements(row_size), ruy_context, gather_rows);
+}
+
+} // namespace gather_detail
+
+/**
+ * @brief Gather rows of @p table (e.g. an embedding table) along axis 0 at @p coords_data
+ *
+ * Rows of upcoming coordinates are prefetched, which hides the misses of lookups into tables too
+ * large for the cache. Only the rows looked up are touched, so a mmap'd table is not faulted in
+ * as a whole.
+ */
+template <typename T, typename CoordsT = int32_t>
+inline void GatherRows(const T *table, int rows, int row_size, const CoordsT *coords_data,
+                       int coords_count, T *output_data, ruy::Context *ruy_context = nullptr)
+{
+  UNUSED_RELEASE(rows);
+  gather_detail::ForEachRow(table, row_size, coords_data, coords_count, ruy_context, [&](int i) {
+    assert(coords_data[i] >= 0 && coords_data[i] < rows);
+    std::memcpy(output_data + static_cast<size_t>(i) * row_size,
+                table + static_cast<size_t>(coords_data[i]) * row_size, sizeof(T) * row_size);
+  });
+}
+
+/**
+ * @brief GatherRows() of a quantized table, dequantizing the rows looked up into float
+ *
+ * @param scales       Scale of the whole table if @p per_row is false, or of each row
+ * @param zero_points  Zero point of the whole table if @p per_row is false, or of each row
+ */
+template <typename T, typename CoordsT = int32_t>
+inline void GatherRowsDequantize(const T *table, int rows, int row_size, const float *scales,
+                                 const int32_t *zero_points, bool per_row,
+                                 const CoordsT *coords_data, int coords_count, float *output_data,
+                                 ruy::Context *ruy_context = nullptr)
+{
+  UNUSED_RELEASE(rows);
+  gather_detail::ForEachRow(table, row_size, coords_data, coords_count, ruy_context, [&](int i) {
+    const auto row = coords_data[i];
+    assert(row >= 0 && row < rows);
+    const float scale = per_row ? scales[row] : scales[0];
+    const int32_t zero_point = per_row ? zero_points[row] : zero_points[0];
+    const T *input_ptr = table + static_cast<size_t>(row) * row_size;
+    float *output_ptr = output_data + static_cast<size_t>(i) * row_size;
+    for (int j = 0; j < row_size; ++j)
+    {
+      output_ptr[j] = static_cast<float>(static_cast<int32_t>(input_ptr[j]) - zero_point) * scale;
+    }
+  });
+}
+
 } // namespace cker
 } // namespace nnfw
 
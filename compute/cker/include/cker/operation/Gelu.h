@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_GELU_H__
+#define __NNFW_CKER_GELU_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+
+#include <cmath>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Gelu(x) = 0.5 * x * (1 + erf(x / sqrt(2))), or with approximate,
+ *        0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+ */
+inline void Gelu(bool approximate, const Shape &input_shape, const float *input_data,
+                 const Shape &output_shape, float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+
+  if (approximate)
+  {
+    const float sqrt_2_over_pi = static_cast<float>(std::sqrt(2.0 / M_PI));
+    cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+      for (int i = start; i < end; ++i)
+      {
+        const float x = input_data[i];
+        const float inner = sqrt_2_over_pi * (x + 0.044715f * x * x * x);
+        output_data[i] = 0.5f * x * (1.0f + std::tanh(inner));
+      }
+    });
+  }
+  else
+  {
+    const float sqrt1_2 = static_cast<float>(M_SQRT1_2);
+    cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+      for (int i = start; i < end; ++i)
+      {
+        const float x = input_data[i];
+        output_data[i] = 0.5f * x * (1.0f + std::erf(x * sqrt1_2));
+      }
+    });
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_GELU_H__
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_HARD_SWISH_H__
+#define __NNFW_CKER_HARD_SWISH_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief HardSwish(x) = x * ReLU6(x + 3) / 6
+ */
+inline void HardSwish(const Shape &input_shape, const float *input_data, const Shape &output_shape,
+                      float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+
+  cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+    for (int i = start; i < end; ++i)
+    {
+      const float x = input_data[i];
+      output_data[i] = x * std::min(std::max(x + 3.0f, 0.0f), 6.0f) * (1.0f / 6.0f);
+    }
+  });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_HARD_SWISH_H__
@@ -132,8 +132,9 @@ inline void CalculateLstmGateFloat(const float *input, const float *input_to_gat
 //  - cell_gate: input vector, size n_batch*n_cell.
 //  - use_cifg: use 1-forget_gate instead of input_gate.
 //  - clip: if > 0, clip the resulting cell state to [-clip, +clip].
-void UpdateLstmCellFloat(int n_batch, int n_cell, float *cell_state, const float *input_gate,
-                         float *forget_gate, const float *cell_gate, bool use_cifg, float clip)
+inline void UpdateLstmCellFloat(int n_batch, int n_cell, float *cell_state,
+                                const float *input_gate, float *forget_gate,
+                                const float *cell_gate, bool use_cifg, float clip)
 {
   // Define variable for 4th argument to avoid warning
   // Compiler warning: passing argument 4 to restrict-qualified parameter aliases with argument 2
@@ -180,10 +181,12 @@ void UpdateLstmCellFloat(int n_batch, int n_cell, float *cell_state, const float
 //  - proj_clip: if > 0, clip the output of the projection.
 //  - output_state: output vector, size n_batch*n_output. Must be contigous.
 //  - scratch: scratch area, size n_batch*n_cell.
-void CalculateLstmOutputFloat(int n_batch, int n_cell, int n_output, const float *cell_state,
-                              const float *output_gate, FusedActivationFunctionType activation,
-                              const float *projection_weights, const float *projection_bias,
-                              const float proj_clip, float *output_state, float *scratch)
+inline void CalculateLstmOutputFloat(int n_batch, int n_cell, int n_output,
+                                     const float *cell_state, const float *output_gate,
+                                     FusedActivationFunctionType activation,
+                                     const float *projection_weights,
+                                     const float *projection_bias, const float proj_clip,
+                                     float *output_state, float *scratch)
 {
   ApplyActivationToVector(cell_state, n_batch * n_cell, activation, scratch);
 
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __NNFW_CKER_LAYER_NORM_H__
+#define __NNFW_CKER_LAYER_NORM_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <cmath>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Normalize each row along the last axis, then scale it by gamma and shift it by beta.
+ *        Rows are independent, so they are split among the threads of @p ruy_context
+ */
+inline void LayerNorm(const LayerNormParams &params, const Shape &input_shape,
+                      const float *input_data, const Shape &gamma_shape, const float *gamma_data,
+                      const Shape &beta_shape, const float *beta_data, const Shape &output_shape,
+                      float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int last_dim = input_shape.DimensionsCount() - 1;
+  const int depth = MatchingDim(input_shape, last_dim, output_shape, last_dim);
+  const int rows = MatchingFlatSizeSkipDim(input_shape, last_dim, output_shape);
+  assert(gamma_shape.FlatSize() == depth);
+  assert(beta_shape.FlatSize() == depth);
+  UNUSED_RELEASE(gamma_shape);
+  UNUSED_RELEASE(beta_shape);
+
+  const int min_rows = cpu_backend_threadpool::MinRangeForElements(depth);
+  cpu_backend_threadpool::ParallelFor(rows, min_rows, ruy_context, [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const float *input = input_data + row * depth;
+      float *output = output_data + row * depth;
+
+      // Two passes keep the variance non-negative, unlike E[x^2] - E[x]^2
+      double sum = 0.0;
+      for (int i = 0; i < depth; ++i)
+        sum += input[i];
+      const float mean = static_cast<float>(sum / depth);
+
+      double sum_sq = 0.0;
+      for (int i = 0; i < depth; ++i)
+      {
+        const float diff = input[i] - mean;
+        sum_sq += diff * diff;
+      }
+      const float variance = static_cast<float>(sum_sq / depth);
+      const float inv_stddev = 1.0f / std::sqrt(variance + params.epsilon);
+
+      for (int i = 0; i < depth; ++i)
+        output[i] = (input[i] - mean) * inv_stddev * gamma_data[i] + beta_data[i];
+    }
+  });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LAYER_NORM_H__
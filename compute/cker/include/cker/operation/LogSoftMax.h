@@ -17,10 +17,12 @@
 #ifndef __NNFW_CKER_LOGSOFTMAX_H__
 #define __NNFW_CKER_LOGSOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
 #include "cker/eigen/Utils.h"
+#include "cker/operation/SoftMax.h"
 
 #include <Eigen/Core>
 #include <fixedpoint/fixedpoint.h>
@@ -31,8 +33,34 @@ namespace nnfw
 namespace cker
 {
 
+namespace log_softmax_detail
+{
+
+// output[i] = (data[i] - max) * beta - log_sum
+inline void Shift(const float *data, int size, float max, float beta, float log_sum,
+                  float *output)
+{
+  int i = 0;
+#ifdef USE_NEON
+  const float32x4_t max4 = vdupq_n_f32(max);
+  const float32x4_t log_sum4 = vdupq_n_f32(log_sum);
+  for (; i <= size - 4; i += 4)
+  {
+    const float32x4_t shifted = vmulq_n_f32(vsubq_f32(vld1q_f32(data + i), max4), beta);
+    vst1q_f32(output + i, vsubq_f32(shifted, log_sum4));
+  }
+#endif // USE_NEON
+  for (; i < size; ++i)
+  {
+    output[i] = (data[i] - max) * beta - log_sum;
+  }
+}
+
+} // namespace log_softmax_detail
+
 inline void LogSoftmax(const SoftmaxParams &params, const Shape &input_shape,
-                       const float *input_data, const Shape &output_shape, float *output_data)
+                       const float *input_data, const Shape &output_shape, float *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const int rank = input_shape.DimensionsCount();
   const int axis = (params.axis < 0) ? params.axis + rank : params.axis;
@@ -51,6 +79,28 @@ inline void LogSoftmax(const SoftmaxParams &params, const Shape &input_shape,
     inner_size *= input_shape.Dims(i);
   }
 
+  // Over the last axis, a row takes one pass for its max and sum of exponentials, and a pass
+  // without exp() for the output
+  if (inner_size == 1)
+  {
+    const float float_beta = static_cast<float>(beta);
+    auto log_softmax_rows = [&](int start, int end) {
+      for (int i = start; i < end; ++i)
+      {
+        const float *input_ptr = input_data + i * depth;
+        float max;
+        float sum;
+        softmax_detail::OnlineMaxSumExp(input_ptr, depth, float_beta, &max, &sum);
+        log_softmax_detail::Shift(input_ptr, depth, max, float_beta, std::log(sum),
+                                  output_data + i * depth);
+      }
+    };
+    cpu_backend_threadpool::ParallelFor(outer_size,
+                                        cpu_backend_threadpool::MinRangeForElements(depth),
+                                        ruy_context, log_softmax_rows);
+    return;
+  }
+
   for (int i = 0; i < outer_size; ++i)
   {
     for (int j = 0; j < inner_size; ++j)
@@ -58,7 +108,7 @@ inline void LogSoftmax(const SoftmaxParams &params, const Shape &input_shape,
       float max = std::numeric_limits<float>::lowest();
       for (int c = 0; c < depth; ++c)
       {
-        max = std::max(max, input_data[(i * depth + c) * inner_size]);
+        max = std::max(max, input_data[(i * depth + c) * inner_size + j]);
       }
 
       float sum = 0.f;
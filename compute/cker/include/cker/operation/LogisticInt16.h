@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LOGISTIC_INT16_H__
+#define __NNFW_CKER_LOGISTIC_INT16_H__
+
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Fill @p table with the quantized logistic of every int16 value, indexed by value + 32768
+ */
+inline void PopulateLogisticInt16LookupTable(std::vector<int16_t> &table, float input_scale,
+                                             int32_t input_zero_point, float output_scale,
+                                             int32_t output_zero_point)
+{
+  const int32_t minval = std::numeric_limits<int16_t>::min();
+  const int32_t maxval = std::numeric_limits<int16_t>::max();
+  table.resize(maxval - minval + 1);
+  for (int32_t val = minval; val <= maxval; ++val)
+  {
+    const double dequantized = static_cast<double>(input_scale) * (val - input_zero_point);
+    const double transformed = 1.0 / (1.0 + std::exp(-dequantized));
+    const int32_t quantized =
+      static_cast<int32_t>(std::round(transformed / output_scale)) + output_zero_point;
+    table[val - minval] = static_cast<int16_t>(std::max(std::min(maxval, quantized), minval));
+  }
+}
+
+/**
+ * @brief Logistic of int16 input by the table of PopulateLogisticInt16LookupTable()
+ */
+inline void LogisticInt16(const int16_t *table, const Shape &input_shape, const int16_t *input_data,
+                          const Shape &output_shape, int16_t *output_data)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  const int32_t offset = -std::numeric_limits<int16_t>::min();
+  for (int i = 0; i < size; ++i)
+    output_data[i] = table[input_data[i] + offset];
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LOGISTIC_INT16_H__
@@ -18,10 +18,12 @@
 #ifndef __NNFW_CKER_QUANTIZE_H__
 #define __NNFW_CKER_QUANTIZE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include <cassert>
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
 
@@ -29,20 +31,109 @@ namespace nnfw
 {
 namespace cker
 {
+namespace
+{
+
 template <typename InputT, typename OutputT>
-inline void Quantize(const Shape &input_shape, const InputT *input_data, const Shape &output_shape,
-                     OutputT *output_data, const float output_scale, const int32_t output_offset)
+inline void QuantizeRange(const InputT *input_data, int start, int end, OutputT *output_data,
+                          const float reciprocal_scale, const int32_t output_offset)
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
-  int min_val = std::numeric_limits<OutputT>::min();
-  int max_val = std::numeric_limits<OutputT>::max();
+  const int32_t min_val = std::numeric_limits<OutputT>::min();
+  const int32_t max_val = std::numeric_limits<OutputT>::max();
+
+  for (int i = start; i < end; i++)
+  {
+    const int32_t unclamped =
+      static_cast<int32_t>(std::round(input_data[i] * reciprocal_scale)) + output_offset;
+    const int32_t clamped = std::min(std::max(unclamped, min_val), max_val);
+    output_data[i] = static_cast<OutputT>(clamped);
+  }
+}
+
+#ifdef USE_NEON
+// Round to the nearest integer with ties away from zero as std::round does
+inline int32x4_t RoundAwayFromZero(const float32x4_t value)
+{
+#ifdef __aarch64__
+  return vcvtaq_s32_f32(value);
+#else
+  const uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(value), vdupq_n_u32(0x80000000u));
+  const float32x4_t half =
+    vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(vdupq_n_f32(0.5f)), sign));
+  return vcvtq_s32_f32(vaddq_f32(value, half));
+#endif
+}
+
+// Store 8 values already clamped to the range of the output type
+inline void StoreClamped(const int16x8_t value, uint8_t *output)
+{
+  vst1_u8(output, vqmovun_s16(value));
+}
+inline void StoreClamped(const int16x8_t value, int8_t *output)
+{
+  vst1_s8(output, vqmovn_s16(value));
+}
+inline void StoreClamped(const int16x8_t value, int16_t *output) { vst1q_s16(output, value); }
+
+template <typename OutputT>
+inline void QuantizeFloatRange(const float *input_data, int start, int end, OutputT *output_data,
+                               const float reciprocal_scale, const int32_t output_offset)
+{
+  const float32x4_t scale_dup = vdupq_n_f32(reciprocal_scale);
+  const int32x4_t offset_dup = vdupq_n_s32(output_offset);
+  const int32x4_t min_dup = vdupq_n_s32(std::numeric_limits<OutputT>::min());
+  const int32x4_t max_dup = vdupq_n_s32(std::numeric_limits<OutputT>::max());
 
-  for (int i = 0; i < flat_size; i++)
+  int i = start;
+  for (; i <= end - 8; i += 8)
   {
-    int32_t unclamped = static_cast<int32_t>(round(input_data[i] / output_scale)) + output_offset;
-    int32_t clamped = std::min(std::max(unclamped, min_val), max_val);
-    output_data[i] = clamped;
+    int32x4_t low = RoundAwayFromZero(vmulq_f32(vld1q_f32(input_data + i), scale_dup));
+    int32x4_t high = RoundAwayFromZero(vmulq_f32(vld1q_f32(input_data + i + 4), scale_dup));
+    low = vminq_s32(vmaxq_s32(vaddq_s32(low, offset_dup), min_dup), max_dup);
+    high = vminq_s32(vmaxq_s32(vaddq_s32(high, offset_dup), min_dup), max_dup);
+    StoreClamped(vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)), output_data + i);
   }
+  QuantizeRange<float, OutputT>(input_data, i, end, output_data, reciprocal_scale, output_offset);
+}
+
+inline void QuantizeRange(const float *input_data, int start, int end, uint8_t *output_data,
+                          const float reciprocal_scale, const int32_t output_offset)
+{
+  QuantizeFloatRange(input_data, start, end, output_data, reciprocal_scale, output_offset);
+}
+
+inline void QuantizeRange(const float *input_data, int start, int end, int8_t *output_data,
+                          const float reciprocal_scale, const int32_t output_offset)
+{
+  QuantizeFloatRange(input_data, start, end, output_data, reciprocal_scale, output_offset);
+}
+
+inline void QuantizeRange(const float *input_data, int start, int end, int16_t *output_data,
+                          const float reciprocal_scale, const int32_t output_offset)
+{
+  QuantizeFloatRange(input_data, start, end, output_data, reciprocal_scale, output_offset);
+}
+#endif // USE_NEON
+
+} // namespace
+
+/**
+ * @brief Quantize @p input_data with the scale and the offset of the output
+ *
+ * Values are multiplied by the reciprocal of @p output_scale and rounded half away from zero.
+ * Elements are split among the threads of @p ruy_context.
+ */
+template <typename InputT, typename OutputT>
+inline void Quantize(const Shape &input_shape, const InputT *input_data, const Shape &output_shape,
+                     OutputT *output_data, const float output_scale, const int32_t output_offset,
+                     ruy::Context *ruy_context = nullptr)
+{
+  const int flat_size = MatchingFlatSize(input_shape, output_shape);
+  const float reciprocal_scale = 1.f / output_scale;
+
+  cpu_backend_threadpool::ParallelForElements(flat_size, ruy_context, [&](int start, int end) {
+    QuantizeRange(input_data, start, end, output_data, reciprocal_scale, output_offset);
+  });
 }
 
 inline void Quantize(const int32_t *multiplier, const int32_t *shift, int32_t channel_size,
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RELU_H__
 #define __NNFW_CKER_RELU_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
@@ -30,11 +31,15 @@ namespace cker
 {
 
 inline void ReLU(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                 float *output_data)
+                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-  output_map = input_map.cwiseMax(0.0f);
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+    const Shape range_shape{end - start};
+    const auto input_map = MapAsVector(input_data + start, range_shape);
+    auto output_map = MapAsVector(output_data + start, range_shape);
+    output_map = input_map.cwiseMax(0.0f);
+  });
 }
 
 } // namespace cker
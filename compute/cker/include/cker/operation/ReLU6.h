@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RELU6_H__
 #define __NNFW_CKER_RELU6_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
@@ -29,25 +30,28 @@ namespace nnfw
 namespace cker
 {
 
-inline void ReLU6(const Shape &input_shape, const float *input_data, float *output_data)
+inline void ReLU6(const Shape &input_shape, const float *input_data, float *output_data,
+                  ruy::Context *ruy_context = nullptr)
 {
   int size = input_shape.FlatSize();
 
-  for (int i = 0; i < size; ++i)
-  {
-    if (input_data[i] <= 0)
+  cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+    for (int i = start; i < end; ++i)
     {
-      output_data[i] = 0;
+      if (input_data[i] <= 0)
+      {
+        output_data[i] = 0;
+      }
+      else if (input_data[i] > 6.0)
+      {
+        output_data[i] = 6.0;
+      }
+      else
+      {
+        output_data[i] = input_data[i];
+      }
     }
-    else if (input_data[i] > 6.0)
-    {
-      output_data[i] = 6.0;
-    }
-    else
-    {
-      output_data[i] = input_data[i];
-    }
-  }
+  });
 }
 
 } // namespace cker
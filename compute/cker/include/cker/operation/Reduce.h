@@ -18,101 +18,217 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
 
+#include <algorithm>
+
 namespace nnfw
 {
 namespace cker
 {
 
-// A generic reduce method that can be used for reduce_sum, reduce_mean, etc.
-// This method iterates through input data and reduce elements along the
-// dimensions given in axis.
+namespace reduce_detail
+{
+
+// Sum of the size floats from data
+inline float SumRow(const float *data, int size)
+{
+  int idx = 0;
+#ifdef USE_NEON
+  float32x4_t acc0 = vdupq_n_f32(0.f);
+  float32x4_t acc1 = vdupq_n_f32(0.f);
+  float32x4_t acc2 = vdupq_n_f32(0.f);
+  float32x4_t acc3 = vdupq_n_f32(0.f);
+  for (; idx <= size - 16; idx += 16)
+  {
+    acc0 = vaddq_f32(acc0, vld1q_f32(data + idx));
+    acc1 = vaddq_f32(acc1, vld1q_f32(data + idx + 4));
+    acc2 = vaddq_f32(acc2, vld1q_f32(data + idx + 8));
+    acc3 = vaddq_f32(acc3, vld1q_f32(data + idx + 12));
+  }
+  for (; idx <= size - 4; idx += 4)
+  {
+    acc0 = vaddq_f32(acc0, vld1q_f32(data + idx));
+  }
+  const float32x4_t acc = vaddq_f32(vaddq_f32(acc0, acc1), vaddq_f32(acc2, acc3));
+  float sum = vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1) + vgetq_lane_f32(acc, 2) +
+              vgetq_lane_f32(acc, 3);
+#else
+  // Independent partial sums let the adds overlap
+  float partial[4] = {0.f, 0.f, 0.f, 0.f};
+  for (; idx <= size - 4; idx += 4)
+  {
+    partial[0] += data[idx];
+    partial[1] += data[idx + 1];
+    partial[2] += data[idx + 2];
+    partial[3] += data[idx + 3];
+  }
+  float sum = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+#endif // USE_NEON
+  for (; idx < size; ++idx)
+  {
+    sum += data[idx];
+  }
+  return sum;
+}
 
+// output[i] += data[i] for the size floats
+inline void AccumulateRow(const float *data, int size, float *output)
+{
+  int idx = 0;
 #ifdef USE_NEON
-inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape,
-                               float *output_data)
+  for (; idx <= size - 4; idx += 4)
+  {
+    vst1q_f32(output + idx, vaddq_f32(vld1q_f32(output + idx), vld1q_f32(data + idx)));
+  }
+#endif // USE_NEON
+  for (; idx < size; ++idx)
+  {
+    output[idx] += data[idx];
+  }
+}
+
+} // namespace reduce_detail
+
+/**
+ * @brief Input of a reduction seen as [outer, reduce, inner], with the reduced axes in the middle
+ */
+struct ReduceDims
+{
+  int outer = 1;
+  int reduce = 1;
+  int inner = 1;
+};
+
+/**
+ * @brief Collapse the axes of @p input_shape around the reduced ones given in @p axis
+ *
+ * Axes of size 1 are ignored, so reductions over the inner axis, the outer axis or H and W of
+ * NHWC (global pooling) all collapse. It fails if the reduced axes are not contiguous.
+ */
+inline bool CollapseReduceDims(const Shape &input_shape, const int *axis, const int num_axis,
+                               ReduceDims *dims)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
 
-  int input_size = 1;
-  int reduce_size = 0;
-  for (int idx = 0; idx < input_num_dims - 1; idx++)
-  {
-    input_size *= input_dims[idx];
-  }
-  reduce_size = input_dims[input_num_dims - 1];
-  int offset = 0;
-  for (int idx = 0; idx < input_size; idx++)
+  *dims = ReduceDims{};
+  bool reducing = false;
+  bool reduced = false;
+  for (int idx = 0; idx < input_num_dims; ++idx)
   {
-    int r_idx = 0;
-    float tmp_data[4] = {
-      0,
-    };
-    float32x4_t tmp_data_32x4 = vld1q_f32(tmp_data);
-    for (; r_idx <= reduce_size - 32; r_idx += 32)
+    if (input_dims[idx] == 1)
+      continue;
+
+    if (std::find(axis, axis + num_axis, idx) != axis + num_axis)
     {
-      float32x4_t a10 = vld1q_f32(input_data + offset + r_idx);
-      float32x4_t a11 = vld1q_f32(input_data + offset + r_idx + 4);
-      float32x4_t a12 = vld1q_f32(input_data + offset + r_idx + 8);
-      float32x4_t a13 = vld1q_f32(input_data + offset + r_idx + 12);
-      float32x4_t a20 = vld1q_f32(input_data + offset + r_idx + 16);
-      float32x4_t a21 = vld1q_f32(input_data + offset + r_idx + 20);
-      float32x4_t a22 = vld1q_f32(input_data + offset + r_idx + 24);
-      float32x4_t a23 = vld1q_f32(input_data + offset + r_idx + 28);
-
-      float32x4_t x0 = vaddq_f32(a10, a20);
-      float32x4_t x1 = vaddq_f32(a11, a21);
-      float32x4_t x2 = vaddq_f32(a12, a22);
-      float32x4_t x3 = vaddq_f32(a13, a23);
-
-      float32x4_t y0 = vaddq_f32(x0, x1);
-      float32x4_t y1 = vaddq_f32(x2, x3);
-      float32x4_t y2 = vaddq_f32(y0, y1);
-      tmp_data_32x4 = vaddq_f32(tmp_data_32x4, y2);
+      if (reduced)
+        return false;
+      reducing = true;
+      dims->reduce *= input_dims[idx];
     }
-    for (; r_idx <= reduce_size - 16; r_idx += 16)
+    else if (reducing || reduced)
     {
-      float32x4_t a10 = vld1q_f32(input_data + offset + r_idx);
-      float32x4_t a11 = vld1q_f32(input_data + offset + r_idx + 4);
-      float32x4_t a12 = vld1q_f32(input_data + offset + r_idx + 8);
-      float32x4_t a13 = vld1q_f32(input_data + offset + r_idx + 12);
-
-      float32x4_t x0 = vaddq_f32(a10, a11);
-      float32x4_t x1 = vaddq_f32(a12, a13);
-
-      float32x4_t y0 = vaddq_f32(x0, x1);
-      tmp_data_32x4 = vaddq_f32(tmp_data_32x4, y0);
+      reducing = false;
+      reduced = true;
+      dims->inner *= input_dims[idx];
     }
-    for (; r_idx <= reduce_size - 8; r_idx += 8)
+    else
     {
-      float32x4_t a1 = vld1q_f32(input_data + offset + r_idx);
-      float32x4_t a2 = vld1q_f32(input_data + offset + r_idx + 4);
-      float32x4_t x = vaddq_f32(a1, a2);
-      tmp_data_32x4 = vaddq_f32(tmp_data_32x4, x);
+      dims->outer *= input_dims[idx];
     }
-    vst1q_f32(tmp_data, tmp_data_32x4);
-    output_data[idx] = tmp_data[0] + tmp_data[1] + tmp_data[2] + tmp_data[3];
+  }
+  return true;
+}
 
-    for (; r_idx < reduce_size; r_idx++)
-    {
-      if (r_idx == 0)
+namespace reduce_detail
+{
+
+// Run fn(outer_index, begin, end) for the inner ranges of the outputs split among threads.
+// Every output costs dims.reduce elements.
+template <typename Fn>
+inline void ForEachOutputRange(const ReduceDims &dims, ruy::Context *ruy_context, const Fn &fn)
+{
+  const int inner = dims.inner;
+  cpu_backend_threadpool::ParallelFor(
+    dims.outer * inner, cpu_backend_threadpool::MinRangeForElements(dims.reduce), ruy_context,
+    [&](int start, int end) {
+      for (int outer = start / inner; outer * inner < end; ++outer)
       {
-        output_data[idx] = input_data[offset];
+        const int begin = std::max(start - outer * inner, 0);
+        const int stop = std::min(end - outer * inner, inner);
+        fn(outer, begin, stop);
       }
-      else
+    });
+}
+
+} // namespace reduce_detail
+
+/**
+ * @brief Reduce collapsed @p dims of @p input_data into @p output_data, which holds the initial
+ *        value of the reduction
+ */
+template <typename In, typename Out, typename Reducer>
+inline void ReduceCollapsed(const In *input_data, const ReduceDims &dims, const Reducer &reducer,
+                            Out *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int reduce = dims.reduce;
+  const int inner = dims.inner;
+  reduce_detail::ForEachOutputRange(dims, ruy_context, [&](int outer, int begin, int end) {
+    Out *output = output_data + outer * inner;
+    const In *input = input_data + outer * reduce * inner;
+    // Rows of the inner axis are contiguous, so this loop vectorizes
+    for (int r = 0; r < reduce; ++r, input += inner)
+    {
+      for (int i = begin; i < end; ++i)
       {
-        output_data[idx] += input_data[offset + r_idx];
+        output[i] = reducer(output[i], input[i]);
       }
     }
-    offset += reduce_size;
-  }
+  });
+}
+
+/**
+ * @brief Sum collapsed @p dims of @p input_data into @p output_data
+ */
+template <typename In, typename Out>
+inline void ReduceSumCollapsed(const In *input_data, const ReduceDims &dims, Out *output_data,
+                               ruy::Context *ruy_context = nullptr)
+{
+  std::fill_n(output_data, dims.outer * dims.inner, Out());
+  ReduceCollapsed(
+    input_data, dims, [](const Out current, const In in) { return current + static_cast<Out>(in); },
+    output_data, ruy_context);
+}
+
+inline void ReduceSumCollapsed(const float *input_data, const ReduceDims &dims,
+                               float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const int reduce = dims.reduce;
+  const int inner = dims.inner;
+  reduce_detail::ForEachOutputRange(dims, ruy_context, [&](int outer, int begin, int end) {
+    float *output = output_data + outer * inner;
+    const float *input = input_data + outer * reduce * inner;
+    if (inner == 1)
+    {
+      output[0] = reduce_detail::SumRow(input, reduce);
+      return;
+    }
+    std::fill(output + begin, output + end, 0.f);
+    for (int r = 0; r < reduce; ++r, input += inner)
+    {
+      reduce_detail::AccumulateRow(input + begin, end - begin, output + begin);
+    }
+  });
 }
-#endif // NEON
+
+// A generic reduce method that can be used for reduce_sum, reduce_mean, etc.
+// This method iterates through input data and reduce elements along the
+// dimensions given in axis.
 
 template <typename In, typename Out>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
@@ -250,7 +366,8 @@ public:
   template <typename T>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, T reducer(const T current, const T in),
+                            ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -265,10 +382,42 @@ public:
       return false;
     }
 
+    ReduceDims dims;
+    if (CollapseReduceDims(input_shape, resolved_axis_data(), num_resolved_axis, &dims))
+    {
+      ReduceCollapsed(input_data, dims, reducer, output_data, ruy_context);
+      return true;
+    }
+
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
                             num_resolved_axis, temp_index_data(), reducer, output_data);
   }
 
+  // Computes the sum of elements across dimensions given in axis, which takes the vectorized
+  // ReduceSumCollapsed() if the axes collapse.
+  template <typename T>
+  inline bool ReduceSum(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                        T *output_data, const std::vector<int> &axes, bool keep_dims,
+                        ruy::Context *ruy_context = nullptr)
+  {
+    int num_resolved_axis = 0;
+    if (!ResolveAxis(input_shape.DimensionsCount(), axes, resolved_axis_data(), &num_resolved_axis))
+    {
+      return false;
+    }
+
+    ReduceDims dims;
+    if (CollapseReduceDims(input_shape, resolved_axis_data(), num_resolved_axis, &dims))
+    {
+      ReduceSumCollapsed(input_data, dims, output_data, ruy_context);
+      return true;
+    }
+
+    return ReduceGeneric<T>(
+      input_shape, input_data, output_shape, output_data, axes, keep_dims, T(),
+      [](const T current, const T in) -> T { return in + current; }, ruy_context);
+  }
+
   // Computes the mean of elements across dimensions given in axis.
   // It does so in two stages, first calculates the sum of elements along the axis
   // then divides it by the number of element in axis for quantized values.
@@ -278,7 +427,8 @@ public:
                                  int32_t output_zero_point, float output_scale,
                                  const Shape &output_shape, const std::vector<int> &axes,
                                  bool /*keep_dims*/, U *temp_sum, bool compute_sum,
-                                 U reducer(const U current, const T in))
+                                 U reducer(const U current, const T in),
+                                 ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     size_t num_outputs = 1;
@@ -305,8 +455,13 @@ public:
       return false;
     }
 
-    if (!ReduceImpl<T, U>(input_data, input_shape, output_shape, resolved_axis_data(),
-                          num_resolved_axis, temp_index_data(), reducer, temp_sum))
+    ReduceDims dims;
+    if (CollapseReduceDims(input_shape, resolved_axis_data(), num_resolved_axis, &dims))
+    {
+      ReduceCollapsed(input_data, dims, reducer, temp_sum, ruy_context);
+    }
+    else if (!ReduceImpl<T, U>(input_data, input_shape, output_shape, resolved_axis_data(),
+                               num_resolved_axis, temp_index_data(), reducer, temp_sum))
     {
       return false;
     }
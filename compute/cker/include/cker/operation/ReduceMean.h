@@ -151,7 +151,8 @@ public:
   template <typename In, typename Out>
   inline bool ReduceOp(const Shape &input_shape, const In *input_data, const Shape &output_shape,
                        Out *output_data, const std::vector<int> &axes, bool, Out init_value,
-                       Out reducer(const Out current, const Out in, int normalizer))
+                       Out reducer(const Out current, const Out in, int normalizer),
+                       ruy::Context *ruy_context = nullptr)
   {
     int num_resolved_axis;
     num_resolved_axis = PrepareforReduce(input_shape, output_shape, axes, output_data, init_value);
@@ -159,6 +160,22 @@ public:
     {
       return false;
     }
+
+    ReduceDims dims;
+    if (CollapseReduceDims(input_shape, resolved_axis_data(), num_resolved_axis, &dims))
+    {
+      // Sum first and divide once, which the threads share with ReduceSum
+      ReduceSumCollapsed(input_data, dims, output_data, ruy_context);
+      if (dims.reduce > 0)
+      {
+        const int num_outputs = dims.outer * dims.inner;
+        for (int idx = 0; idx < num_outputs; ++idx)
+        {
+          output_data[idx] = output_data[idx] / dims.reduce;
+        }
+      }
+      return true;
+    }
     return ReduceMeanImpl<In, Out>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
                                    temp_index_data(), reducer, output_data);
   }
@@ -167,7 +184,8 @@ public:
   inline bool ReduceOp(const Shape &input_shape, const In *input_data, float input_scale,
                        int32_t input_offset, const Shape &output_shape, Out *output_data,
                        float output_scale, int32_t output_offset, const std::vector<int> &axes,
-                       bool, Out init_value, int reducer(const int current, const In in))
+                       bool, Out init_value, int reducer(const int current, const In in),
+                       ruy::Context *ruy_context = nullptr)
   {
     size_t num_outputs = 1;
     auto output_dims = output_shape.DimsData();
@@ -184,9 +202,19 @@ public:
       return false;
     }
 
-    size_t normalizer =
-      ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
-                             temp_index_data(), reducer, _temp_sum.data());
+    size_t normalizer;
+    ReduceDims dims;
+    if (CollapseReduceDims(input_shape, resolved_axis_data(), num_resolved_axis, &dims))
+    {
+      ReduceCollapsed(input_data, dims, reducer, _temp_sum.data(), ruy_context);
+      normalizer = dims.reduce;
+    }
+    else
+    {
+      normalizer =
+        ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
+                               temp_index_data(), reducer, _temp_sum.data());
+    }
     if (num_outputs > 0)
     {
       float scale = input_scale / output_scale;
@@ -209,56 +237,47 @@ private:
 
 template <typename In, typename Out>
 void Mean(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-          Out *output_data, const std::vector<int> &axes)
+          Out *output_data, const std::vector<int> &axes, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() > 0);
   ReduceMean m_obj;
   m_obj.ReduceOp<In, Out>(input_shape, input_data, output_shape, output_data, axes, true, (Out)0,
-                          mean_reducer);
+                          mean_reducer, ruy_context);
 }
 
 template <typename In, typename Out>
 void MeanQ8Asymm(const Shape &input_shape, const In *input_data, float input_scale,
                  int32_t input_offset, const Shape &output_shape, Out *output_data,
-                 float output_scale, int32_t output_offset, const std::vector<int> &axes)
+                 float output_scale, int32_t output_offset, const std::vector<int> &axes,
+                 ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() > 0);
   ReduceMean m_obj;
   m_obj.ReduceOp<In, Out>(input_shape, input_data, input_scale, input_offset, output_shape,
                           output_data, output_scale, output_offset, axes, true, (Out)0,
-                          sum_reducer);
+                          sum_reducer, ruy_context);
 }
 
 template <typename In, typename Out>
 void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-                   Out *output_data)
+                   Out *output_data, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() == 4);
   assert(output_shape.DimensionsCount() == 4);
 
-  const int output_batch = output_shape.Dims(0);
-  const int output_depth = output_shape.Dims(3);
-
-  const int input_height = input_shape.Dims(1);
-  const int input_width = input_shape.Dims(2);
+  ReduceDims dims;
+  dims.outer = input_shape.Dims(0);
+  dims.reduce = input_shape.Dims(1) * input_shape.Dims(2);
+  dims.inner = input_shape.Dims(3);
+  ReduceSumCollapsed(input_data, dims, output_data, ruy_context);
 
-  for (int out_b = 0; out_b < output_batch; ++out_b)
+  const int num_outputs = dims.outer * dims.inner;
+  for (int idx = 0; idx < num_outputs; ++idx)
   {
-    for (int out_d = 0; out_d < output_depth; ++out_d)
-    {
-      float value = 0;
-      for (int in_h = 0; in_h < input_height; ++in_h)
-      {
-        for (int in_w = 0; in_w < input_width; ++in_w)
-        {
-          value += input_data[Offset(input_shape, out_b, in_h, in_w, out_d)];
-        }
-      }
-      output_data[Offset(output_shape, out_b, 0, 0, out_d)] = value / (input_width * input_height);
-    }
+    output_data[idx] = output_data[idx] / dims.reduce;
   }
 }
 
@@ -18,85 +18,20 @@
 #ifndef __NNFW_CKER_RESIZEBILINEAR_H__
 #define __NNFW_CKER_RESIZEBILINEAR_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/neon/neon_check.h"
+
 #include <cmath>
+#include <vector>
 
 namespace nnfw
 {
 namespace cker
 {
 
-inline void ResizeBilinearKernel2x2(int32_t x0, int32_t x1, int32_t y0, int32_t y1, int32_t x,
-                                    int32_t y, int32_t depth, int32_t batch,
-                                    const Shape &input_shape, const float *input_data,
-                                    const Shape &output_shape, float *output_data)
-{
-  const int32_t input_width = input_shape.Dims(2);
-  const int32_t output_width = output_shape.Dims(2);
-
-  const int32_t input_x_offset = (x1 - x0) * depth;
-  const int32_t input_y_offset = (y1 - y0) * depth * input_width;
-  const int32_t output_x_offset = depth;
-  const int32_t output_y_offset = depth * output_width;
-
-  for (int ch = 0; ch < depth; ch++)
-  {
-    const int32_t input_offset = Offset(input_shape, batch, y0, x0, ch);
-
-    float x0y0 = input_data[input_offset];
-    float x1y0 = input_data[input_offset + input_x_offset];
-    float x0y1 = input_data[input_offset + input_y_offset];
-    float x1y1 = input_data[input_offset + input_x_offset + input_y_offset];
-
-    // Top left corner.
-    const int32_t output_offset = Offset(output_shape, batch, y, x, ch);
-    output_data[output_offset] = x0y0;
-
-    // Top right corner.
-    output_data[output_offset + output_x_offset] = (x0y0 + x1y0) / 2;
-
-    // Bottom left corner.
-    float output = (x0y0 + x0y1) / 2;
-    output_data[output_offset + output_y_offset] = output;
-
-    // Bottom right corner.
-    output_data[output_offset + output_x_offset + output_y_offset] =
-      (output + ((x1y0 + x1y1) / 2)) / 2;
-  }
-}
-
-inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t input_width,
-                              int32_t depth, int32_t output_height, int32_t output_width,
-                              const Shape &input_shape, const float *input_data,
-                              const Shape &output_shape, float *output_data)
-{
-  for (int b = 0; b < batches; b++)
-  {
-    for (int y0 = 0, y = 0; y <= output_height - 2; y += 2, y0++)
-    {
-      for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
-      {
-        int32_t x1 = std::min(x0 + 1, input_width - 1);
-        int32_t y1 = std::min(y0 + 1, input_height - 1);
-        ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
-                                output_shape, output_data);
-      }
-    }
-  }
-}
-
-inline void ResizeBilinearKernel(const float *input_ptr, int32_t depth, float scale,
-                                 float *output_ptr)
-{
-  for (int32_t i = 0; i < depth; i++)
-  {
-    *output_ptr += *input_ptr * scale;
-    output_ptr++;
-    input_ptr++;
-  }
-}
-
 inline void ComputeInterpolationValues(const float value, const float scale,
                                        const bool half_pixel_centers, int32_t input_size,
                                        float *scaled_value, int32_t *lower_bound,
@@ -115,154 +50,215 @@ inline void ComputeInterpolationValues(const float value, const float scale,
   *upper_bound = std::min(static_cast<int32_t>(std::ceil(*scaled_value)), input_size - 1);
 }
 
-inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t input_width,
-                                  int32_t depth, int32_t output_height, int32_t output_width,
-                                  float height_scale, float width_scale, const Shape &input_shape,
-                                  const float *input_data, float *output_data,
-                                  const bool half_pixel_centers)
+/**
+ * @brief Source rows and columns of each output row and column of a resize, and their weights
+ *
+ * They only depend on the sizes and the params, so a layer computes them once for all runs.
+ */
+struct ResizeBilinearTables
 {
-  memset(output_data, 0, batches * output_height * output_width * depth * sizeof(float));
-
-  int32_t output_offset = 0;
-  for (int b = 0; b < batches; ++b)
+  int32_t input_height = 0;
+  int32_t input_width = 0;
+  int32_t output_height = 0;
+  int32_t output_width = 0;
+  bool align_corners = false;
+  bool half_pixel_centers = false;
+
+  // Lower and upper source rows, and the weight of the upper one
+  std::vector<int32_t> y0;
+  std::vector<int32_t> y1;
+  std::vector<float> y_lerp;
+  // Lower and upper source columns, and the weight of the upper one
+  std::vector<int32_t> x0;
+  std::vector<int32_t> x1;
+  std::vector<float> x_lerp;
+
+  bool matches(const ResizeBilinearParams &params, int32_t in_height, int32_t in_width) const
   {
-    for (int y = 0; y < output_height; ++y)
-    {
-      float input_y;
-      int32_t y0, y1;
-      ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
-                                 &y1);
-      for (int x = 0; x < output_width; ++x)
-      {
-        float input_x;
-        int32_t x0, x1;
-        ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x, &x0,
-                                   &x1);
-        float *output_ptr = &output_data[output_offset];
-
-        // Run kernel on the 4 corners of the bilinear resize algorithm.
-        int32_t input_offset = Offset(input_shape, b, y0, x0, 0);
-        float scale = (1 - (input_y - y0)) * (1 - (input_x - x0));
-        const float *input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y0, x1, 0);
-        scale = (1 - (input_y - y0)) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y1, x0, 0);
-        scale = (input_y - y0) * (1 - (input_x - x0));
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+    return input_height == in_height && input_width == in_width &&
+           output_height == params.output_height && output_width == params.output_width &&
+           align_corners == params.align_corners && half_pixel_centers == params.half_pixel_centers;
+  }
+};
 
-        input_offset = Offset(input_shape, b, y1, x1, 0);
-        scale = (input_y - y0) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+namespace resize_bilinear_detail
+{
 
-        output_offset += depth;
-      }
-    }
+inline void ComputeInterpolationTable(int32_t output_size, float scale, bool half_pixel_centers,
+                                      int32_t input_size, std::vector<int32_t> *lower,
+                                      std::vector<int32_t> *upper, std::vector<float> *lerp)
+{
+  lower->resize(output_size);
+  upper->resize(output_size);
+  lerp->resize(output_size);
+  for (int32_t i = 0; i < output_size; ++i)
+  {
+    float scaled_value;
+    ComputeInterpolationValues(static_cast<float>(i), scale, half_pixel_centers, input_size,
+                               &scaled_value, &(*lower)[i], &(*upper)[i]);
+    (*lerp)[i] = scaled_value - (*lower)[i];
   }
 }
 
-template <typename T>
-inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_height,
-                                              int32_t input_width, int32_t depth,
-                                              int32_t output_height, int32_t output_width,
-                                              float height_scale, float width_scale,
-                                              const Shape &input_shape, const T *input_data,
-                                              T *output_data, const bool half_pixel_centers)
+// output = tl * scale[0] + tr * scale[1] + bl * scale[2] + br * scale[3] for depth channels
+inline void InterpolatePixel(const float *tl, const float *tr, const float *bl, const float *br,
+                             const float *scale, int32_t depth, float *output)
 {
-  T *output_ptr = &output_data[0];
-  for (int b = 0; b < batches; ++b)
+  int32_t c = 0;
+#ifdef USE_NEON
+  for (; c <= depth - 4; c += 4)
   {
-    for (int y = 0; y < output_height; ++y)
-    {
-      float input_y;
-      int32_t y0, y1;
-      ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
-                                 &y1);
-      for (int x = 0; x < output_width; ++x)
-      {
-        float input_x;
-        int32_t x0, x1;
-        ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x, &x0,
-                                   &x1);
-
-        int32_t input_offset[4] = {
-          Offset(input_shape, b, y0, x0, 0), Offset(input_shape, b, y0, x1, 0),
-          Offset(input_shape, b, y1, x0, 0), Offset(input_shape, b, y1, x1, 0)};
-        float scale[4] = {(1 - (input_y - y0)) * (1 - (input_x - x0)),
-                          (1 - (input_y - y0)) * (input_x - x0),
-                          (input_y - y0) * (1 - (input_x - x0)), (input_y - y0) * (input_x - x0)};
-
-        for (int d = 0; d < depth; d++)
-        {
-          const T *input_ptr = &input_data[d];
-          *output_ptr++ = static_cast<T>(
-            input_ptr[input_offset[0]] * scale[0] + input_ptr[input_offset[1]] * scale[1] +
-            input_ptr[input_offset[2]] * scale[2] + input_ptr[input_offset[3]] * scale[3]);
-        }
-      }
-    }
+    float32x4_t acc = vmulq_n_f32(vld1q_f32(tl + c), scale[0]);
+    acc = vmlaq_n_f32(acc, vld1q_f32(tr + c), scale[1]);
+    acc = vmlaq_n_f32(acc, vld1q_f32(bl + c), scale[2]);
+    acc = vmlaq_n_f32(acc, vld1q_f32(br + c), scale[3]);
+    vst1q_f32(output + c, acc);
+  }
+#endif // USE_NEON
+  for (; c < depth; ++c)
+  {
+    output[c] = tl[c] * scale[0] + tr[c] * scale[1] + bl[c] * scale[2] + br[c] * scale[3];
   }
 }
 
-void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+#ifdef USE_NEON
+inline float32x4_t WeightedSum(uint16x4_t tl, uint16x4_t tr, uint16x4_t bl, uint16x4_t br,
+                               const float *scale)
 {
-  int32_t batches = static_cast<int32_t>(MatchingDim(input_shape, 0, output_shape, 0));
-  int32_t input_height = input_shape.Dims(1);
-  int32_t input_width = input_shape.Dims(2);
-  int32_t depth = static_cast<int32_t>(MatchingDim(input_shape, 3, output_shape, 3));
+  float32x4_t acc = vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(tl)), scale[0]);
+  acc = vmlaq_n_f32(acc, vcvtq_f32_u32(vmovl_u16(tr)), scale[1]);
+  acc = vmlaq_n_f32(acc, vcvtq_f32_u32(vmovl_u16(bl)), scale[2]);
+  acc = vmlaq_n_f32(acc, vcvtq_f32_u32(vmovl_u16(br)), scale[3]);
+  return acc;
+}
+#endif // USE_NEON
 
-  // Specialize for 2x2 upsample.
-  if (!params.align_corners && !params.half_pixel_centers &&
-      params.output_height == 2 * input_height && params.output_width == 2 * input_width)
+// Same as the float one, truncating the results like a static_cast
+inline void InterpolatePixel(const uint8_t *tl, const uint8_t *tr, const uint8_t *bl,
+                             const uint8_t *br, const float *scale, int32_t depth,
+                             uint8_t *output)
+{
+  int32_t c = 0;
+#ifdef USE_NEON
+  for (; c <= depth - 8; c += 8)
   {
-    ResizeBilinear2x2(batches, input_height, input_width, depth, params.output_height,
-                      params.output_width, input_shape, input_data, output_shape, output_data);
+    const uint16x8_t tl_16 = vmovl_u8(vld1_u8(tl + c));
+    const uint16x8_t tr_16 = vmovl_u8(vld1_u8(tr + c));
+    const uint16x8_t bl_16 = vmovl_u8(vld1_u8(bl + c));
+    const uint16x8_t br_16 = vmovl_u8(vld1_u8(br + c));
+    const float32x4_t low = WeightedSum(vget_low_u16(tl_16), vget_low_u16(tr_16),
+                                        vget_low_u16(bl_16), vget_low_u16(br_16), scale);
+    const float32x4_t high = WeightedSum(vget_high_u16(tl_16), vget_high_u16(tr_16),
+                                         vget_high_u16(bl_16), vget_high_u16(br_16), scale);
+    const uint16x8_t result =
+      vcombine_u16(vmovn_u32(vcvtq_u32_f32(low)), vmovn_u32(vcvtq_u32_f32(high)));
+    vst1_u8(output + c, vmovn_u16(result));
   }
-  else
+#endif // USE_NEON
+  for (; c < depth; ++c)
   {
-    float height_scale = static_cast<float>(input_height) / params.output_height;
-    float width_scale = static_cast<float>(input_width) / params.output_width;
-    if (params.align_corners && params.output_height > 1)
-    {
-      height_scale = static_cast<float>(input_height - 1) / (params.output_height - 1);
-    }
-    if (params.align_corners && params.output_width > 1)
-    {
-      width_scale = static_cast<float>(input_width - 1) / (params.output_width - 1);
-    }
+    output[c] = static_cast<uint8_t>(tl[c] * scale[0] + tr[c] * scale[1] + bl[c] * scale[2] +
+                                     br[c] * scale[3]);
+  }
+}
 
-    ResizeBilinearGeneric(batches, input_height, input_width, depth, params.output_height,
-                          params.output_width, height_scale, width_scale, input_shape, input_data,
-                          output_data, params.half_pixel_centers);
+} // namespace resize_bilinear_detail
+
+/**
+ * @brief Compute @p tables of a resize of an input of @p input_height x @p input_width
+ */
+inline void PrepareResizeBilinearTables(const ResizeBilinearParams &params, int32_t input_height,
+                                        int32_t input_width, ResizeBilinearTables *tables)
+{
+  float height_scale = static_cast<float>(input_height) / params.output_height;
+  float width_scale = static_cast<float>(input_width) / params.output_width;
+  if (params.align_corners && params.output_height > 1)
+  {
+    height_scale = static_cast<float>(input_height - 1) / (params.output_height - 1);
+  }
+  if (params.align_corners && params.output_width > 1)
+  {
+    width_scale = static_cast<float>(input_width - 1) / (params.output_width - 1);
   }
+
+  tables->input_height = input_height;
+  tables->input_width = input_width;
+  tables->output_height = params.output_height;
+  tables->output_width = params.output_width;
+  tables->align_corners = params.align_corners;
+  tables->half_pixel_centers = params.half_pixel_centers;
+  resize_bilinear_detail::ComputeInterpolationTable(params.output_height, height_scale,
+                                                    params.half_pixel_centers, input_height,
+                                                    &tables->y0, &tables->y1, &tables->y_lerp);
+  resize_bilinear_detail::ComputeInterpolationTable(params.output_width, width_scale,
+                                                    params.half_pixel_centers, input_width,
+                                                    &tables->x0, &tables->x1, &tables->x_lerp);
 }
 
-void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
-                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+/**
+ * @brief Resize with @p tables prepared for these params and input, splitting output rows
+ *        among the threads of @p ruy_context
+ */
+template <typename T>
+inline void ResizeBilinear(const ResizeBilinearParams &params, const ResizeBilinearTables &tables,
+                           const Shape &input_shape, const T *input_data,
+                           const Shape &output_shape, T *output_data,
+                           ruy::Context *ruy_context = nullptr)
 {
-  int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
-  int32_t input_height = input_shape.Dims(1);
-  int32_t input_width = input_shape.Dims(2);
-  int32_t depth = MatchingDim(input_shape, 3, output_shape, 3);
+  UNUSED_RELEASE(params);
+  const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t output_width = output_shape.Dims(2);
+  assert(tables.matches(params, input_height, input_width));
+  assert(output_height == params.output_height && output_width == params.output_width);
 
-  float height_scale = (params.align_corners && params.output_height > 1)
-                         ? (static_cast<float>(input_height - 1) / (params.output_height - 1))
-                         : (static_cast<float>(input_height) / params.output_height);
+  const int32_t input_row_size = input_width * depth;
+  const int32_t output_row_size = output_width * depth;
+  auto resize_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const int32_t b = row / output_height;
+      const int32_t y = row % output_height;
+      const T *input_batch = input_data + b * input_height * input_row_size;
+      const T *top = input_batch + tables.y0[y] * input_row_size;
+      const T *bottom = input_batch + tables.y1[y] * input_row_size;
+      const float y_lerp = tables.y_lerp[y];
+      T *output_ptr = output_data + row * output_row_size;
+      for (int32_t x = 0; x < output_width; ++x, output_ptr += depth)
+      {
+        const float x_lerp = tables.x_lerp[x];
+        const float scale[4] = {(1 - y_lerp) * (1 - x_lerp), (1 - y_lerp) * x_lerp,
+                                y_lerp * (1 - x_lerp), y_lerp * x_lerp};
+        const int32_t left = tables.x0[x] * depth;
+        const int32_t right = tables.x1[x] * depth;
+        resize_bilinear_detail::InterpolatePixel(top + left, top + right, bottom + left,
+                                                 bottom + right, scale, depth, output_ptr);
+      }
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(batches * output_height,
+                                      cpu_backend_threadpool::MinRangeForElements(output_row_size),
+                                      ruy_context, resize_rows);
+}
 
-  float width_scale = (params.align_corners && params.output_width > 1)
-                        ? (static_cast<float>(input_width - 1) / (params.output_width - 1))
-                        : (static_cast<float>(input_width) / params.output_width);
+inline void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
+                           const float *input_data, const Shape &output_shape, float *output_data)
+{
+  ResizeBilinearTables tables;
+  PrepareResizeBilinearTables(params, input_shape.Dims(1), input_shape.Dims(2), &tables);
+  ResizeBilinear(params, tables, input_shape, input_data, output_shape, output_data);
+}
 
-  ResizeBilinearGenericSmallChannel<uint8_t>(
-    batches, input_height, input_width, depth, params.output_height, params.output_width,
-    height_scale, width_scale, input_shape, input_data, output_data, params.half_pixel_centers);
+inline void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
+                           const uint8_t *input_data, const Shape &output_shape,
+                           uint8_t *output_data)
+{
+  ResizeBilinearTables tables;
+  PrepareResizeBilinearTables(params, input_shape.Dims(1), input_shape.Dims(2), &tables);
+  ResizeBilinear(params, tables, input_shape, input_data, output_shape, output_data);
 }
 
 inline void ComputeInterpolationValues(const int32_t value, const int32_t scale_10,
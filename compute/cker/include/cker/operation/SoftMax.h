@@ -18,6 +18,8 @@
 #ifndef __NNFW_CKER_SOFTMAX_H__
 #define __NNFW_CKER_SOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/FastExp.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
@@ -75,42 +77,122 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
 }
 } // namespace reference
 
-// Performs softmax along the input of size (input_size * batch_size).
-inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
-                    float *out)
+namespace softmax_detail
 {
-  assert(input_size > 0);
 
-  // For each batch
-  for (int b = 0; b < batch_size; b++)
+// Rows are read by chunks which stay in L1 between their max and their sum of exponentials
+constexpr int kOnlineSoftmaxChunkSize = 256;
+
+inline float MaxOf(const float *data, int size)
+{
+  int i = 0;
+  float max = std::numeric_limits<float>::lowest();
+#ifdef USE_NEON
+  float32x4_t max4 = vdupq_n_f32(max);
+  for (; i <= size - 4; i += 4)
   {
-    // Find the max coeff.
-    float max_coeff = in[0];
-    for (int i = 1; i < input_size; i++)
-    {
-      if (in[i] > max_coeff)
-        max_coeff = in[i];
-    }
+    max4 = vmaxq_f32(max4, vld1q_f32(data + i));
+  }
+  max = std::max(std::max(vgetq_lane_f32(max4, 0), vgetq_lane_f32(max4, 1)),
+                 std::max(vgetq_lane_f32(max4, 2), vgetq_lane_f32(max4, 3)));
+#endif // USE_NEON
+  for (; i < size; ++i)
+  {
+    max = std::max(max, data[i]);
+  }
+  return max;
+}
+
+// Sum of exp((data[i] - max) * beta)
+inline float SumExp(const float *data, int size, float max, float beta)
+{
+  int i = 0;
+  float sum = 0.f;
+#ifdef USE_NEON
+  const float32x4_t max4 = vdupq_n_f32(max);
+  float32x4_t sum4 = vdupq_n_f32(0.f);
+  for (; i <= size - 4; i += 4)
+  {
+    sum4 = vaddq_f32(sum4, FastExp(vmulq_n_f32(vsubq_f32(vld1q_f32(data + i), max4), beta)));
+  }
+  sum = vgetq_lane_f32(sum4, 0) + vgetq_lane_f32(sum4, 1) + vgetq_lane_f32(sum4, 2) +
+        vgetq_lane_f32(sum4, 3);
+#endif // USE_NEON
+  for (; i < size; ++i)
+  {
+    sum += FastExp((data[i] - max) * beta);
+  }
+  return sum;
+}
+
+// output[i] = exp((data[i] - max) * beta) * scale
+inline void ScaledExp(const float *data, int size, float max, float beta, float scale,
+                      float *output)
+{
+  int i = 0;
+#ifdef USE_NEON
+  const float32x4_t max4 = vdupq_n_f32(max);
+  for (; i <= size - 4; i += 4)
+  {
+    const float32x4_t exp4 = FastExp(vmulq_n_f32(vsubq_f32(vld1q_f32(data + i), max4), beta));
+    vst1q_f32(output + i, vmulq_n_f32(exp4, scale));
+  }
+#endif // USE_NEON
+  for (; i < size; ++i)
+  {
+    output[i] = FastExp((data[i] - max) * beta) * scale;
+  }
+}
 
-    // Compute the normalized sum of exps.
-    float exp_sum = 0.0;
-    for (int i = 0; i < input_size; i++)
+/**
+ * @brief Max of a row and the sum of exp((x - max) * beta) in a single pass over it
+ *
+ * The sum is rescaled whenever a chunk raises the max, which is what online softmax does one
+ * element at a time.
+ */
+inline void OnlineMaxSumExp(const float *data, int size, float beta, float *max, float *sum)
+{
+  float row_max = std::numeric_limits<float>::lowest();
+  float row_sum = 0.f;
+  for (int start = 0; start < size; start += kOnlineSoftmaxChunkSize)
+  {
+    const int chunk_size = std::min(kOnlineSoftmaxChunkSize, size - start);
+    const float chunk_max = MaxOf(data + start, chunk_size);
+    if (chunk_max > row_max)
     {
-      out[i] = std::exp((in[i] - max_coeff) * beta);
-      exp_sum += out[i];
+      row_sum *= FastExp((row_max - chunk_max) * beta);
+      row_max = chunk_max;
     }
+    row_sum += SumExp(data + start, chunk_size, row_max, beta);
+  }
+  *max = row_max;
+  *sum = row_sum;
+}
+
+} // namespace softmax_detail
+
+// Performs softmax along the input of size (input_size * batch_size), splitting the batches
+// among the threads of ruy_context. Each row is read twice: once for its max and the sum of
+// exponentials, and once for the output.
+inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
+                    float *out, ruy::Context *ruy_context = nullptr)
+{
+  assert(input_size > 0);
 
-    // Divide by the sum of exps.
-    float reciprocal_sum_exp = 1.f / exp_sum;
-    for (int i = 0; i < input_size; i++)
+  auto softmax_rows = [&](int start, int end) {
+    for (int b = start; b < end; ++b)
     {
-      out[i] *= reciprocal_sum_exp;
+      const float *input_ptr = in + b * input_size;
+      float max;
+      float sum;
+      softmax_detail::OnlineMaxSumExp(input_ptr, input_size, beta, &max, &sum);
+      softmax_detail::ScaledExp(input_ptr, input_size, max, beta, 1.f / sum,
+                                out + b * input_size);
     }
-
-    // Advance in and out pointers for the next batch.
-    in += input_size;
-    out += input_size;
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(batch_size,
+                                      cpu_backend_threadpool::MinRangeForElements(input_size),
+                                      ruy_context, softmax_rows);
 }
 
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_SOFTMAX_FP16_H__
+#define __NNFW_CKER_SOFTMAX_FP16_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Fp16.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Softmax over the last dimension in half precision
+ *
+ * Maximum, exponentials and their sum are computed in float, as half precision overflows for
+ * exponentials of values over 11.
+ */
+inline void SoftmaxFp16(const SoftmaxParams &params, const Shape &input_shape,
+                        const float16 *input_data, const Shape &output_shape,
+                        float16 *output_data, ruy::Context *ruy_context)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const float beta = static_cast<float>(params.beta);
+
+  auto softmax_rows = [&](int start, int end) {
+    for (int i = start; i < end; ++i)
+    {
+      const float16 *input_ptr = input_data + i * depth;
+      float16 *output_ptr = output_data + i * depth;
+      float max = std::numeric_limits<float>::lowest();
+      for (int c = 0; c < depth; ++c)
+        max = std::max(max, Fp16ToFloat(input_ptr[c]));
+
+      float sum = 0.f;
+      for (int c = 0; c < depth; ++c)
+        sum += std::exp((Fp16ToFloat(input_ptr[c]) - max) * beta);
+
+      const float reciprocal = 1.f / sum;
+      for (int c = 0; c < depth; ++c)
+      {
+        const float value = std::exp((Fp16ToFloat(input_ptr[c]) - max) * beta) * reciprocal;
+        output_ptr[c] = FloatToFp16(value);
+      }
+    }
+  };
+
+  const int min_rows = std::max(1, 16384 / std::max(1, depth));
+  cpu_backend_threadpool::ParallelFor(outer_size, min_rows, ruy_context, softmax_rows);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_SOFTMAX_FP16_H__
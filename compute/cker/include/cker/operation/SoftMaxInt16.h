@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_SOFTMAX_INT16_H__
+#define __NNFW_CKER_SOFTMAX_INT16_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Fill @p table with exp() of the distances of int16 inputs from their row maximum
+ *
+ * Distances whose exp() is below e^-30 add nothing to a probability, so the table only covers
+ * those under it rather than all 65536 of them.
+ */
+inline void PopulateSoftmaxInt16LookupTable(std::vector<float> &table, float input_scale,
+                                            float beta)
+{
+  constexpr double kMaxExponent = 30.0;
+  const double scale = static_cast<double>(input_scale) * beta;
+  const double needed = std::ceil(kMaxExponent / scale) + 1;
+  const int size = static_cast<int>(std::min(needed, 65536.0));
+  table.resize(size);
+  for (int distance = 0; distance < size; ++distance)
+    table[distance] = static_cast<float>(std::exp(-scale * distance));
+}
+
+/**
+ * @brief Softmax over the last dimension of int16 input, looking up exp() in params.table
+ *
+ * params.table and params.table_size come from PopulateSoftmaxInt16LookupTable().
+ */
+inline void SoftmaxInt16(const SoftmaxParams &params, const Shape &input_shape,
+                         const int16_t *input_data, const Shape &output_shape,
+                         int16_t *output_data)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int excluding_last_dim = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int last_dim = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+
+  const int32_t clamp_max = std::numeric_limits<int16_t>::max();
+  const int32_t clamp_min = std::numeric_limits<int16_t>::min();
+  const float *table = params.table;
+  const int table_size = params.table_size;
+  auto lookup = [table, table_size](int32_t distance) {
+    return distance < table_size ? table[distance] : 0.f;
+  };
+
+  for (int i = 0; i < excluding_last_dim; ++i)
+  {
+    int32_t max_val = std::numeric_limits<int16_t>::min();
+    for (int j = 0; j < last_dim; ++j)
+      max_val = std::max(max_val, static_cast<int32_t>(input_data[j]));
+
+    float sum_exp = 0.0f;
+    for (int j = 0; j < last_dim; ++j)
+      sum_exp += lookup(max_val - input_data[j]);
+
+    const float inv_sum_exp = 1.0f / (sum_exp * params.scale);
+    for (int j = 0; j < last_dim; ++j)
+    {
+      const float prob_rescaled = lookup(max_val - input_data[j]) * inv_sum_exp;
+      const int32_t prob_quantized =
+        static_cast<int32_t>(std::round(prob_rescaled)) + params.zero_point;
+      output_data[j] =
+        static_cast<int16_t>(std::max(std::min(clamp_max, prob_quantized), clamp_min));
+    }
+    input_data += last_dim;
+    output_data += last_dim;
+  }
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_SOFTMAX_INT16_H__
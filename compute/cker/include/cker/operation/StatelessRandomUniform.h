@@ -28,13 +28,14 @@
 #include "cker/operation/Helper/PhiloxRandom.h"
 #include "cker/operation/Helper/RandomOpCpu.h"
 #include "cker/operation/Helper/RandomDistributions.h"
+#include "cker/operation/optimized/PhiloxRandom.h"
 
 namespace nnfw
 {
 namespace cker
 {
 
-void GenerateKey(Tensor seed, random::PhiloxRandom::Key *out_key,
+inline void GenerateKey(Tensor seed, random::PhiloxRandom::Key *out_key,
                  random::PhiloxRandom::ResultType *out_counter)
 {
   // Grab the two seeds
@@ -74,7 +75,8 @@ void Fill(random::PhiloxRandom random, Tensor *output)
 
 inline void StatelessRandomUniform(const Shape &shape_shape, const int32_t *shape_data,
                                    const Shape &seed_shape, const int32_t *seed_data,
-                                   const Shape &output_shape, float *output_data)
+                                   const Shape &output_shape, float *output_data,
+                                   ruy::Context *ruy_context = nullptr)
 {
   Tensor shape_t;
   Tensor seed_t;
@@ -85,17 +87,14 @@ inline void StatelessRandomUniform(const Shape &shape_shape, const int32_t *shap
   seed_t.shape.ReplaceWith(seed_shape.DimensionsCount(), seed_shape.DimsData());
   seed_t.buffer = (void *)seed_data;
 
-  Tensor output_t;
-  output_t.shape.ReplaceWith(output_shape.DimensionsCount(), output_shape.DimsData());
-  output_t.buffer = output_data;
-
   random::PhiloxRandom::Key key;
   random::PhiloxRandom::ResultType counter;
 
   GenerateKey(seed_t, &key, &counter);
 
-  Fill<Eigen::ThreadPoolDevice, random::UniformDistribution<random::PhiloxRandom, float>>(
-    random::PhiloxRandom(counter, key), &output_t);
+  // The same values as Fill() of UniformDistribution, computed in vectors on the threads
+  optimized::PhiloxUniformFloat(random::PhiloxRandom(counter, key), output_data,
+                                output_shape.FlatSize(), ruy_context);
 }
 } // namespace cker
 } // namespace nnfw
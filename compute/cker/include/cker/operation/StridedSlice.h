@@ -18,11 +18,14 @@
 #ifndef __NNFW_CKER_STRIDEDSLICE_H__
 #define __NNFW_CKER_STRIDEDSLICE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace nnfw
 {
@@ -256,79 +259,73 @@ void checkOutputSize(const StridedSliceParams &op_params, const Shape &input_sha
   assert(output_shape.DimensionsCount() == shape_size);
 }
 
+// Return the number of elements taken along an axis from start to stop by stride
+inline int SliceCountForAxis(int start, int stop, int stride)
+{
+  if (stride > 0)
+    return stop > start ? (stop - start + stride - 1) / stride : 0;
+  return start > stop ? (start - stop - stride - 1) / -stride : 0;
+}
+
 template <typename T>
 inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unextended_input_shape,
-                         const T *input_data, const Shape &unextended_output_shape, T *output_data)
+                         const T *input_data, const Shape &unextended_output_shape, T *output_data,
+                         ruy::Context *ruy_context = nullptr)
 {
   assert(unextended_input_shape.DimensionsCount() <= 4);
   assert(unextended_output_shape.DimensionsCount() <= 4);
-
-  bool optimize = true;
-  int st_count = op_params.strides_count;
-  for (int idx = 0; idx < st_count - 1; idx++)
-  {
-    const int axis_size = unextended_input_shape.Dims(idx);
-    const int start = StartForAxis(op_params, unextended_input_shape, idx);
-    const int stop = StopForAxis(op_params, unextended_input_shape, idx, start);
-    if ((axis_size != 1) && (start != 0 || stop != 0))
-    {
-      optimize = false;
-      break;
-    }
-  }
-
-  if (optimize)
-  {
-    if (op_params.strides[st_count - 1] == 1)
-    {
-      const int start = StartForAxis(op_params, unextended_input_shape, st_count - 1);
-      const int end = StopForAxis(op_params, unextended_input_shape, st_count - 1, start);
-
-      for (int idx = 0; idx < end - start; idx++)
-      {
-        output_data[idx] = input_data[idx + start];
-      }
-      return;
-    }
-  }
+  UNUSED_RELEASE(unextended_output_shape);
 
   // Note that the output_shape is not used herein.
   StridedSliceParams params_copy = op_params;
 
   const Shape input_shape = Shape::ExtendedShape(4, unextended_input_shape);
-  const Shape output_shape = Shape::ExtendedShape(4, unextended_output_shape);
 
   // Reverse and pad to 4 dimensions because that is what the runtime code
   // requires (ie. all shapes must be 4D and are given backwards).
   StridedSlicePadIndices(&params_copy, 4);
 
-  const int start_b = StartForAxis(params_copy, input_shape, 0);
-  const int stop_b = StopForAxis(params_copy, input_shape, 0, start_b);
-  const int start_h = StartForAxis(params_copy, input_shape, 1);
-  const int stop_h = StopForAxis(params_copy, input_shape, 1, start_h);
-  const int start_w = StartForAxis(params_copy, input_shape, 2);
-  const int stop_w = StopForAxis(params_copy, input_shape, 2, start_w);
-  const int start_d = StartForAxis(params_copy, input_shape, 3);
-  const int stop_d = StopForAxis(params_copy, input_shape, 3, start_d);
-
-  T *out_ptr = output_data;
-  for (int in_b = start_b; !LoopCondition(in_b, stop_b, params_copy.strides[0]);
-       in_b += params_copy.strides[0])
+  int starts[4], counts[4];
+  for (int axis = 0; axis < 4; ++axis)
   {
-    for (int in_h = start_h; !LoopCondition(in_h, stop_h, params_copy.strides[1]);
-         in_h += params_copy.strides[1])
+    starts[axis] = StartForAxis(params_copy, input_shape, axis);
+    const int stop = StopForAxis(params_copy, input_shape, axis, starts[axis]);
+    counts[axis] = SliceCountForAxis(starts[axis], stop, params_copy.strides[axis]);
+  }
+  const int16_t *strides = params_copy.strides;
+
+  // Each row of the output is a slice of the innermost axis, which is copied at once if it is
+  // contiguous
+  const int row_size = counts[3];
+  auto slice_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
     {
-      for (int in_w = start_w; !LoopCondition(in_w, stop_w, params_copy.strides[2]);
-           in_w += params_copy.strides[2])
+      const int out_w = row % counts[2];
+      const int out_h = (row / counts[2]) % counts[1];
+      const int out_b = row / (counts[2] * counts[1]);
+      const T *in_ptr = input_data + Offset(input_shape, starts[0] + out_b * strides[0],
+                                            starts[1] + out_h * strides[1],
+                                            starts[2] + out_w * strides[2], starts[3]);
+      T *out_ptr = output_data + row * row_size;
+      if (strides[3] == 1)
+      {
+        memcpy(out_ptr, in_ptr, row_size * sizeof(T));
+      }
+      else
       {
-        for (int in_d = start_d; !LoopCondition(in_d, stop_d, params_copy.strides[3]);
-             in_d += params_copy.strides[3])
+        for (int out_d = 0; out_d < row_size; ++out_d)
         {
-          *out_ptr++ = input_data[Offset(input_shape, in_b, in_h, in_w, in_d)];
+          out_ptr[out_d] = in_ptr[out_d * strides[3]];
         }
       }
     }
-  }
+  };
+
+  if (row_size == 0)
+    return;
+  const int rows = counts[0] * counts[1] * counts[2];
+  const int min_rows = cpu_backend_threadpool::MinRangeForElements(row_size);
+  cpu_backend_threadpool::ParallelFor(rows, min_rows, ruy_context, slice_rows);
 }
 
 } // namespace cker
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_TANH_H__
 
 #include "cker/eigen/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <Eigen/Core>
@@ -29,11 +30,15 @@ namespace cker
 {
 
 inline void Tanh(const Shape &input_shape, const float *input_data, const Shape &output_shape,
-                 float *output_data)
+                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
-  auto input_map = MapAsVector(input_data, input_shape);
-  auto output_map = MapAsVector(output_data, output_shape);
-  output_map.array() = input_map.array().tanh();
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  cpu_backend_threadpool::ParallelForElements(size, ruy_context, [&](int start, int end) {
+    const Shape range_shape{end - start};
+    const auto input_map = MapAsVector(input_data + start, range_shape);
+    auto output_map = MapAsVector(output_data + start, range_shape);
+    output_map.array() = input_map.array().tanh();
+  });
 }
 
 } // namespace cker
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TOPK_V2_H__
+#define __NNFW_CKER_TOPK_V2_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace topk_v2
+{
+
+// Rows of k or less in this many values keep a heap of k, or else indices of the row are sorted
+constexpr int kHeapRatio = 16;
+
+/**
+ * @brief Write indices of the k largest values of @p row to @p indices, the largest first and the
+ *        lower index first of equal values
+ *
+ * @param buffer Indices of k for a heap, or of the row for std::partial_sort
+ */
+template <typename T>
+void TopKRow(const T *row, int size, int k, std::vector<int32_t> &buffer, int32_t *indices)
+{
+  // Whether index a comes before index b in the output
+  auto precedes = [row](int32_t a, int32_t b) {
+    return row[a] > row[b] || (row[a] == row[b] && a < b);
+  };
+
+  if (static_cast<int64_t>(k) * kHeapRatio <= size)
+  {
+    // The top of the heap is the last of the k so far, which is replaced with a larger value.
+    // Values later in the row are never before equal ones, so only larger ones are compared.
+    buffer.resize(k);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    std::make_heap(buffer.begin(), buffer.end(), precedes);
+    for (int i = k; i < size; ++i)
+    {
+      if (row[i] > row[buffer.front()])
+      {
+        std::pop_heap(buffer.begin(), buffer.end(), precedes);
+        buffer.back() = i;
+        std::push_heap(buffer.begin(), buffer.end(), precedes);
+      }
+    }
+    std::sort_heap(buffer.begin(), buffer.end(), precedes);
+  }
+  else
+  {
+    buffer.resize(size);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    std::partial_sort(buffer.begin(), buffer.begin() + k, buffer.end(), precedes);
+  }
+  std::copy(buffer.begin(), buffer.begin() + k, indices);
+}
+
+} // namespace topk_v2
+
+/**
+ * @brief Find the @p k largest values of the last axis and their indices, like tf.math.top_k
+ *        of sorted=True
+ *
+ * Rows are split among the threads of @p ruy_context.
+ *
+ * @note  NaN values do not have an order, so rows of NaN may give any of the values.
+ */
+template <typename T>
+void TopKV2(const Shape &input_shape, const T *input_data, int32_t k, const Shape &values_shape,
+            T *values_data, const Shape &indices_shape, int32_t *indices_data,
+            ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(values_shape);
+  UNUSED_RELEASE(indices_shape);
+  const int dims_count = input_shape.DimensionsCount();
+  assert(dims_count > 0);
+  const int row_size = input_shape.Dims(dims_count - 1);
+  assert(k >= 0 && k <= row_size);
+  assert(values_shape.Dims(dims_count - 1) == k);
+  assert(indices_shape.Dims(dims_count - 1) == k);
+  const int rows = row_size == 0 ? 0 : input_shape.FlatSize() / row_size;
+  if (k == 0 || rows == 0)
+    return;
+
+  // Most values are compared with the top of the heap only, so a row costs about a scan of it
+  cpu_backend_threadpool::ParallelFor(
+    rows, cpu_backend_threadpool::MinRangeForElements(row_size), ruy_context,
+    [&](int begin, int end) {
+      std::vector<int32_t> buffer;
+      for (int r = begin; r < end; ++r)
+      {
+        const T *row = input_data + static_cast<int64_t>(r) * row_size;
+        int32_t *indices = indices_data + static_cast<int64_t>(r) * k;
+        T *values = values_data + static_cast<int64_t>(r) * k;
+        topk_v2::TopKRow(row, row_size, k, buffer, indices);
+        for (int i = 0; i < k; ++i)
+          values[i] = row[indices[i]];
+      }
+    });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TOPK_V2_H__
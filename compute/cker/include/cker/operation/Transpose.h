@@ -18,9 +18,14 @@
 #ifndef __NNFW_CKER_TRANSPOSE_H__
 #define __NNFW_CKER_TRANSPOSE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/neon/neon_check.h"
+
+#include <algorithm>
+#include <cstring>
 
 namespace nnfw
 {
@@ -290,12 +295,56 @@ size_t Flatten(const Shape &input_shape, const Shape &output_shape, const Transp
 
 } // namespace
 
+namespace transpose_detail
+{
+
+// Transpose a 4x4 block from rows of in_stride to rows of out_stride
+template <typename T>
+inline void Transpose4x4(const T *input, int in_stride, T *output, int out_stride)
+{
+  for (int p = 0; p < 4; ++p)
+  {
+    for (int q = 0; q < 4; ++q)
+    {
+      output[q * out_stride + p] = input[p * in_stride + q];
+    }
+  }
+}
+
+#ifdef USE_NEON
+template <>
+inline void Transpose4x4<float>(const float *input, int in_stride, float *output, int out_stride)
+{
+  // t01 = {a00 a10 a02 a12}, {a01 a11 a03 a13} and t23 likewise for the rows 2 and 3
+  const float32x4x2_t t01 = vtrnq_f32(vld1q_f32(input), vld1q_f32(input + in_stride));
+  const float32x4x2_t t23 =
+    vtrnq_f32(vld1q_f32(input + 2 * in_stride), vld1q_f32(input + 3 * in_stride));
+  vst1q_f32(output, vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])));
+  vst1q_f32(output + out_stride, vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])));
+  vst1q_f32(output + 2 * out_stride,
+            vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])));
+  vst1q_f32(output + 3 * out_stride,
+            vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])));
+}
+
+// Other 32-bit values are only moved, so they go through the float registers as they are
+template <>
+inline void Transpose4x4<int32_t>(const int32_t *input, int in_stride, int32_t *output,
+                                  int out_stride)
+{
+  Transpose4x4<float>(reinterpret_cast<const float *>(input), in_stride,
+                      reinterpret_cast<float *>(output), out_stride);
+}
+#endif // USE_NEON
+
+} // namespace transpose_detail
+
 // Transpose2D only deals with typical 2D matrix transpose ops.
-// Perform transpose by transposing 4x4 blocks of the input, proceeding from
-// left to right (down the rows) of the input, and then from top to bottom.
+// Perform transpose by tiles whose rows read and written stay in cache, transposing 4x4 blocks
+// of each tile. Rows of tiles are split among the threads of the context.
 template <typename T>
 inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                        T *output_data)
+                        T *output_data, ruy::Context *ruy_context = nullptr)
 {
   assert(input_shape.DimensionsCount() == 2);
   assert(output_shape.DimensionsCount() == 2);
@@ -304,211 +353,124 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
   const int d0 = input_shape.DimsData()[0];
   const int d1 = input_shape.DimsData()[1];
   const int kLines = 4;
-  const int kSkipSize = (kLines - 1) * d1;
+  const int kTile = 32;
 
-  const T *input = input_data;
-
-  int i = 0;
-  for (; i <= d0 - kLines; i += kLines)
-  {
-    T *output = output_data + i;
-
-    const T *input_ptr = input;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-
-    int j = 0;
-    for (; j <= d1 - kLines; j += kLines)
+  auto transpose_tiles = [&](int start, int end) {
+    for (int i0 = start * kTile; i0 < std::min(d0, end * kTile); i0 += kTile)
     {
-      input_ptr = input;
-      const T a00 = input_ptr[0];
-      const T a01 = input_ptr[1];
-      const T a02 = input_ptr[2];
-      const T a03 = input_ptr[3];
-      input_ptr += d1;
-      const T a10 = input_ptr[0];
-      const T a11 = input_ptr[1];
-      const T a12 = input_ptr[2];
-      const T a13 = input_ptr[3];
-      input_ptr += d1;
-      const T a20 = input_ptr[0];
-      const T a21 = input_ptr[1];
-      const T a22 = input_ptr[2];
-      const T a23 = input_ptr[3];
-      input_ptr += d1;
-      const T a30 = input_ptr[0];
-      const T a31 = input_ptr[1];
-      const T a32 = input_ptr[2];
-      const T a33 = input_ptr[3];
-
-      output[0] = a00;
-      output[1] = a10;
-      output[2] = a20;
-      output[3] = a30;
-      output += d0;
-
-      output[0] = a01;
-      output[1] = a11;
-      output[2] = a21;
-      output[3] = a31;
-      output += d0;
-
-      output[0] = a02;
-      output[1] = a12;
-      output[2] = a22;
-      output[3] = a32;
-      output += d0;
-
-      output[0] = a03;
-      output[1] = a13;
-      output[2] = a23;
-      output[3] = a33;
-      output += d0;
-
-      input += kLines;
-    }
-    if (j == d1)
-    {
-      input += kSkipSize;
-    }
-    else
-    {
-      for (int p = 0; p < kLines; ++p)
+      const int i_end = std::min(i0 + kTile, d0);
+      for (int j0 = 0; j0 < d1; j0 += kTile)
       {
-        for (int q = 0; q < d1 - j; ++q)
+        const int j_end = std::min(j0 + kTile, d1);
+        int i = i0;
+        for (; i <= i_end - kLines; i += kLines)
+        {
+          int j = j0;
+          for (; j <= j_end - kLines; j += kLines)
+          {
+            transpose_detail::Transpose4x4(input_data + i * d1 + j, d1, output_data + j * d0 + i,
+                                           d0);
+          }
+          for (; j < j_end; ++j)
+          {
+            for (int p = 0; p < kLines; ++p)
+            {
+              output_data[j * d0 + i + p] = input_data[(i + p) * d1 + j];
+            }
+          }
+        }
+        for (; i < i_end; ++i)
         {
-          *(output + q * d0 + p) = *(input + p * d1 + q);
+          for (int j = j0; j < j_end; ++j)
+          {
+            output_data[j * d0 + i] = input_data[i * d1 + j];
+          }
         }
       }
-      input += (d1 - j) + kSkipSize;
     }
-  }
-  for (; i < d0; ++i)
-  {
-    T *output = output_data + i;
-    for (int j = 0; j < d1; ++j)
-    {
-      *output = *input;
-      output += d0;
-      ++input;
-    }
-  }
+  };
+
+  const int tile_rows = (d0 + kTile - 1) / kTile;
+  const int min_tile_rows = cpu_backend_threadpool::MinRangeForElements(kTile * d1);
+  cpu_backend_threadpool::ParallelFor(tile_rows, min_tile_rows, ruy_context, transpose_tiles);
 }
 
-// TODO(alanchiao): see if we can reduce the number
-// of lines of code in branching without affecting latency.
+// Transpose up to 4D by walking the output in order with the strides of the input, which copies
+// whole rows when the innermost dimension stays in place. Rows are split among the threads of the
+// context.
 template <typename T>
-inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
-                        const T *input_data, const Shape &, T *output_data)
+inline void TransposeStrided(const TransposeParams &params, const Shape &input_shape,
+                             const T *input_data, const Shape &, T *output_data,
+                             ruy::Context *ruy_context)
 {
-  int s2, s3;
-  s2 = input_shape.Dims(1);
-  s3 = input_shape.Dims(2);
-
-  int p1 = 0;
-  int p2 = 0;
-  int p3 = 0;
-
-  if (params.perm[0] == 2)
-  {
-    p1 = 1;
-  }
-  else if (params.perm[1] == 2)
-  {
-    p2 = 1;
-  }
-  else
-  {
-    p3 = 1;
-  }
+  const int dims_cnt = input_shape.DimensionsCount();
+  assert(dims_cnt <= 4);
 
-  if (params.perm[0] == 1)
-  {
-    p1 = s3;
-  }
-  else if (params.perm[1] == 1)
-  {
-    p2 = s3;
-  }
-  else
+  int input_strides[4];
+  int stride = 1;
+  for (int i = dims_cnt - 1; i >= 0; --i)
   {
-    p3 = s3;
+    input_strides[i] = stride;
+    stride *= input_shape.Dims(i);
   }
 
-  if (params.perm[0] == 0)
-  {
-    p1 = s2 * s3;
-  }
-  else if (params.perm[1] == 0)
-  {
-    p2 = s2 * s3;
-  }
-  else
+  // Output dimensions and the strides of the input along them, extended to 4D in front
+  int out_dims[4] = {1, 1, 1, 1};
+  int strides[4] = {0, 0, 0, 0};
+  const int ext_size = 4 - dims_cnt;
+  for (int i = 0; i < dims_cnt; ++i)
   {
-    p3 = s2 * s3;
+    out_dims[ext_size + i] = input_shape.Dims(params.perm[i]);
+    strides[ext_size + i] = input_strides[params.perm[i]];
   }
 
-  int o_s[3];
-  o_s[0] = input_shape.Dims(params.perm[0]);
-  o_s[1] = input_shape.Dims(params.perm[1]);
-  o_s[2] = input_shape.Dims(params.perm[2]);
-
-  for (int i1 = 0; i1 < o_s[0]; ++i1)
-  {
-    for (int i2 = 0; i2 < o_s[1]; ++i2)
+  const int row_size = out_dims[3];
+  const int row_stride = strides[3];
+  auto transpose_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
     {
-      for (int i3 = 0; i3 < o_s[2]; ++i3)
+      const int o2 = row % out_dims[2];
+      const int o1 = (row / out_dims[2]) % out_dims[1];
+      const int o0 = row / (out_dims[2] * out_dims[1]);
+      const T *input = input_data + o0 * strides[0] + o1 * strides[1] + o2 * strides[2];
+      T *output = output_data + row * row_size;
+      if (row_stride == 1)
       {
-        const int i = i1 * p1 + i2 * p2 + i3 * p3;
-        const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
-        output_data[o] = input_data[i];
+        memcpy(output, input, row_size * sizeof(T));
+      }
+      else
+      {
+        for (int o3 = 0; o3 < row_size; ++o3)
+        {
+          output[o3] = input[o3 * row_stride];
+        }
       }
     }
-  }
+  };
+
+  const int rows = out_dims[0] * out_dims[1] * out_dims[2];
+  const int min_rows = cpu_backend_threadpool::MinRangeForElements(row_size);
+  cpu_backend_threadpool::ParallelFor(rows, min_rows, ruy_context, transpose_rows);
 }
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &input_shape, const T *input_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context)
 {
-  const int dims_cnt = input_shape.DimensionsCount();
-
   int dim0, dim1;
   if (IsTranspose2DApplicable(params, input_shape, &dim0, &dim1))
   {
-    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data);
+    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data, ruy_context);
     return;
   }
 
-  // TODO(b/141217325): notably Eigen is better suited for
-  // larger inputs whereas Transpose3D is generally
-  // better for smaller ones.
-  //
-  // E.g. on Nexus 5, Eigen is better for size 96^3 and up
-  // and Transpose3D is better for 72^3 and down.
-  //
-  // 96^3 is not mobile-friendly for certain usecases
-  // (e.g. model used in beam search for seq2seq) but is in others.
-  // Consider tradeoffs.
-  if (dims_cnt == 3)
-  {
-    Transpose3D(params, input_shape, input_data, output_shape, output_data);
-    return;
-  }
-
-  // Reroute to the reference version if an optimized method for the given data
-  // is not available.
-  reference::Transpose(params, input_shape, input_data, output_shape, output_data);
+  TransposeStrided(params, input_shape, input_data, output_shape, output_data, ruy_context);
 }
 
 template <typename T>
 void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_input_shape,
-               const T *input_data, const Shape &unshrunk_output_shape, T *output_data)
+               const T *input_data, const Shape &unshrunk_output_shape, T *output_data,
+               ruy::Context *ruy_context = nullptr)
 {
   const int output_size = unshrunk_output_shape.DimensionsCount();
   assert(unshrunk_input_shape.DimensionsCount() <= 4);
@@ -560,18 +522,32 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
               &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
     assert(non_flatten_params.perm[0] != 0);
 
-    for (int i = 0; i < total_size; i += non_flatten_size)
+    // Small transposes are split among the threads as a whole
+    const int outer_size = total_size / non_flatten_size;
+    const bool split_outer = non_flatten_size < cpu_backend_threadpool::kMinElementsPerThread;
+    auto transpose_outer = [&](int start, int end) {
+      for (int i = start; i < end; ++i)
+      {
+        TransposeImpl(non_flatten_params, non_flatten_input_shape,
+                      input_data + i * non_flatten_size, non_flatten_output_shape,
+                      output_data + i * non_flatten_size, split_outer ? nullptr : ruy_context);
+      }
+    };
+    if (split_outer)
     {
-      TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
-                    non_flatten_output_shape, output_data + i);
+      const int min_outer = cpu_backend_threadpool::MinRangeForElements(non_flatten_size);
+      cpu_backend_threadpool::ParallelFor(outer_size, min_outer, ruy_context, transpose_outer);
+    }
+    else
+    {
+      transpose_outer(0, outer_size);
     }
     return;
   }
 
   // Call non-flattened case.
-  TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape,
-
-                output_data);
+  TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape, output_data,
+                ruy_context);
 }
 
 } // namespace cker
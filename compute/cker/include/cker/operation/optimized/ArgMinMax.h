@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_ARGMINMAX_H__
+#define __NNFW_CKER_OPTIMIZED_ARGMINMAX_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/neon/neon_check.h"
+
+#include <cassert>
+#include <cstdint>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+namespace argminmax
+{
+
+/**
+ * @brief Index of the first max (or min) of @p size contiguous values of @p row
+ *
+ * A value replaces the current one only if it is strictly greater (or less), as cker::ArgMinMax
+ * does with std::greater (or std::less), so NaN at the 0th value wins and other NaNs never do.
+ */
+template <typename T> int PortableArgMinMaxRow(const T *row, int size, bool is_arg_max)
+{
+  T value = row[0];
+  int index = 0;
+  if (is_arg_max)
+  {
+    for (int i = 1; i < size; ++i)
+    {
+      if (row[i] > value)
+      {
+        value = row[i];
+        index = i;
+      }
+    }
+  }
+  else
+  {
+    for (int i = 1; i < size; ++i)
+    {
+      if (row[i] < value)
+      {
+        value = row[i];
+        index = i;
+      }
+    }
+  }
+  return index;
+}
+
+#ifdef USE_NEON
+
+template <typename T> struct NeonTraits;
+
+template <> struct NeonTraits<float>
+{
+  using Vector = float32x4_t;
+  static constexpr int kLanes = 4;
+  static Vector Load(const float *p) { return vld1q_f32(p); }
+  static void Store(float *p, Vector v) { vst1q_f32(p, v); }
+  static Vector Max(Vector a, Vector b) { return vmaxq_f32(a, b); }
+  static Vector Min(Vector a, Vector b) { return vminq_f32(a, b); }
+};
+
+template <> struct NeonTraits<uint8_t>
+{
+  using Vector = uint8x16_t;
+  static constexpr int kLanes = 16;
+  static Vector Load(const uint8_t *p) { return vld1q_u8(p); }
+  static void Store(uint8_t *p, Vector v) { vst1q_u8(p, v); }
+  static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+  static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+};
+
+template <> struct NeonTraits<int8_t>
+{
+  using Vector = int8x16_t;
+  static constexpr int kLanes = 16;
+  static Vector Load(const int8_t *p) { return vld1q_s8(p); }
+  static void Store(int8_t *p, Vector v) { vst1q_s8(p, v); }
+  static Vector Max(Vector a, Vector b) { return vmaxq_s8(a, b); }
+  static Vector Min(Vector a, Vector b) { return vminq_s8(a, b); }
+};
+
+template <> struct NeonTraits<int32_t>
+{
+  using Vector = int32x4_t;
+  static constexpr int kLanes = 4;
+  static Vector Load(const int32_t *p) { return vld1q_s32(p); }
+  static void Store(int32_t *p, Vector v) { vst1q_s32(p, v); }
+  static Vector Max(Vector a, Vector b) { return vmaxq_s32(a, b); }
+  static Vector Min(Vector a, Vector b) { return vminq_s32(a, b); }
+};
+
+/**
+ * @brief The same as PortableArgMinMaxRow, which finds the max (or min) in vectors and then
+ *        the first index of it
+ *
+ * @note  vmaxq_f32 and vminq_f32 give NaN of any NaN, so rows of NaN in vectors are left to
+ *        PortableArgMinMaxRow to get the same index
+ */
+template <typename T> int NeonArgMinMaxRow(const T *row, int size, bool is_arg_max)
+{
+  using Traits = NeonTraits<T>;
+  constexpr int kLanes = Traits::kLanes;
+  if (size < 2 * kLanes)
+    return PortableArgMinMaxRow(row, size, is_arg_max);
+
+  auto acc = Traits::Load(row);
+  int i = kLanes;
+  if (is_arg_max)
+  {
+    for (; i + kLanes <= size; i += kLanes)
+      acc = Traits::Max(acc, Traits::Load(row + i));
+  }
+  else
+  {
+    for (; i + kLanes <= size; i += kLanes)
+      acc = Traits::Min(acc, Traits::Load(row + i));
+  }
+
+  T lanes[kLanes];
+  Traits::Store(lanes, acc);
+  T value = lanes[0];
+  for (int lane = 0; lane < kLanes; ++lane)
+  {
+    // Only NaN is not equal to itself
+    if (lanes[lane] != lanes[lane])
+      return PortableArgMinMaxRow(row, size, is_arg_max);
+    if (is_arg_max ? lanes[lane] > value : lanes[lane] < value)
+      value = lanes[lane];
+  }
+  for (; i < size; ++i)
+  {
+    if (is_arg_max ? row[i] > value : row[i] < value)
+      value = row[i];
+  }
+
+  for (int j = 0; j < size; ++j)
+  {
+    if (row[j] == value)
+      return j;
+  }
+  assert(false);
+  return 0;
+}
+
+#endif // USE_NEON
+
+template <typename T> int ArgMinMaxRow(const T *row, int size, bool is_arg_max)
+{
+#ifdef USE_NEON
+  return NeonArgMinMaxRow(row, size, is_arg_max);
+#else
+  return PortableArgMinMaxRow(row, size, is_arg_max);
+#endif
+}
+
+/**
+ * @brief ArgMinMax of the outer indices [@p begin, @p end), where each of them has @p axis_size
+ *        values of @p inner_size stride
+ */
+template <typename T1, typename T2>
+void ArgMinMaxOuterRange(const T1 *input_data, T2 *output_data, int axis_size, int inner_size,
+                         bool is_arg_max, int begin, int end)
+{
+  for (int outer = begin; outer < end; ++outer)
+  {
+    const T1 *outer_data = input_data + outer * axis_size * inner_size;
+    T2 *outer_output = output_data + outer * inner_size;
+    if (inner_size == 1)
+    {
+      // The axis is the innermost, e.g. logits of classes, whose values are contiguous
+      *outer_output = static_cast<T2>(ArgMinMaxRow(outer_data, axis_size, is_arg_max));
+      continue;
+    }
+
+    for (int inner = 0; inner < inner_size; ++inner)
+    {
+      T1 value = outer_data[inner];
+      T2 index = 0;
+      for (int i = 1; i < axis_size; ++i)
+      {
+        const T1 curr_value = outer_data[i * inner_size + inner];
+        if (is_arg_max ? curr_value > value : curr_value < value)
+        {
+          value = curr_value;
+          index = static_cast<T2>(i);
+        }
+      }
+      outer_output[inner] = index;
+    }
+  }
+}
+
+} // namespace argminmax
+
+/**
+ * @brief The same as cker::ArgMinMax with std::greater (@p is_arg_max) or std::less, whose outer
+ *        indices are split among the threads of @p ruy_context
+ */
+template <typename T1, typename T2>
+void ArgMinMax(const Shape &input1_shape, const T1 *input1_data, const Shape &output_shape,
+               T2 *output_data, int32_t axis, bool is_arg_max, ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(output_shape);
+  assert(input1_shape.DimensionsCount() > 0);
+  assert(input1_shape.DimensionsCount() - 1 == output_shape.DimensionsCount());
+  if (axis < 0)
+  {
+    axis += input1_shape.DimensionsCount();
+  }
+  const int axis_size = input1_shape.Dims(axis);
+
+  int outer_size = 1;
+  for (int i = 0; i < axis; ++i)
+  {
+    assert(input1_shape.Dims(i) == output_shape.Dims(i));
+    outer_size *= input1_shape.Dims(i);
+  }
+
+  int inner_size = 1;
+  const int dims_count = input1_shape.DimensionsCount();
+  for (int i = axis + 1; i < dims_count; ++i)
+  {
+    assert(input1_shape.Dims(i) == output_shape.Dims(i - 1));
+    inner_size *= input1_shape.Dims(i);
+  }
+
+  cpu_backend_threadpool::ParallelFor(
+    outer_size, cpu_backend_threadpool::MinRangeForElements(axis_size * inner_size), ruy_context,
+    [&](int begin, int end) {
+      argminmax::ArgMinMaxOuterRange(input1_data, output_data, axis_size, inner_size, is_arg_max,
+                                     begin, end);
+    });
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_ARGMINMAX_H__
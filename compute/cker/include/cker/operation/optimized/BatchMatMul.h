@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+#define __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <Eigen/Core>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <type_traits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Sizes of the matrices of BatchMatMul and where each batch of them is
+ *
+ * Batch dimensions of size 1 are broadcast by a stride of 0, so that no input is copied.
+ */
+struct BatchMatMulGeometry
+{
+  BatchMatMulGeometry(const Shape &lhs_shape, const Shape &rhs_shape, bool adj_x, bool adj_y)
+  {
+    const Shape lhs = Shape::ExtendedShape(5, lhs_shape);
+    const Shape rhs = Shape::ExtendedShape(5, rhs_shape);
+
+    rows = adj_x ? lhs.Dims(4) : lhs.Dims(3);
+    depth = adj_x ? lhs.Dims(3) : lhs.Dims(4);
+    cols = adj_y ? rhs.Dims(3) : rhs.Dims(4);
+    assert(depth == (adj_y ? rhs.Dims(4) : rhs.Dims(3)));
+
+    int lhs_stride = rows * depth;
+    int rhs_stride = depth * cols;
+    for (int i = 2; i >= 0; --i)
+    {
+      assert(lhs.Dims(i) == rhs.Dims(i) || lhs.Dims(i) == 1 || rhs.Dims(i) == 1);
+      batch_dims[i] = std::max(lhs.Dims(i), rhs.Dims(i));
+      lhs_strides[i] = (lhs.Dims(i) == 1) ? 0 : lhs_stride;
+      rhs_strides[i] = (rhs.Dims(i) == 1) ? 0 : rhs_stride;
+      lhs_stride *= lhs.Dims(i);
+      rhs_stride *= rhs.Dims(i);
+    }
+  }
+
+  int batches() const { return batch_dims[0] * batch_dims[1] * batch_dims[2]; }
+  int lhsOffset(int batch) const { return offset(batch, lhs_strides); }
+  int rhsOffset(int batch) const { return offset(batch, rhs_strides); }
+  int outputOffset(int batch) const { return batch * rows * cols; }
+
+  int rows;
+  int cols;
+  int depth;
+  int batch_dims[3];
+  int lhs_strides[3];
+  int rhs_strides[3];
+
+private:
+  int offset(int batch, const int *strides) const
+  {
+    const int b2 = batch % batch_dims[2];
+    const int b1 = (batch / batch_dims[2]) % batch_dims[1];
+    const int b0 = batch / (batch_dims[2] * batch_dims[1]);
+    return b0 * strides[0] + b1 * strides[1] + b2 * strides[2];
+  }
+};
+
+template <bool adj_x, bool adj_y>
+void BatchMatMulFloatRange(const BatchMatMulGeometry &geometry, const float *lhs_data,
+                           const float *rhs_data, float *output_data, int batch_start,
+                           int batch_end)
+{
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ColMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+  // An adjoint operand is a row-major matrix of the transposed shape, i.e. a column-major one
+  using LhsMatrix = typename std::conditional<adj_x, ColMajorMatrix, RowMajorMatrix>::type;
+  using RhsMatrix = typename std::conditional<adj_y, ColMajorMatrix, RowMajorMatrix>::type;
+
+  for (int b = batch_start; b < batch_end; ++b)
+  {
+    Eigen::Map<const LhsMatrix> lhs(lhs_data + geometry.lhsOffset(b), geometry.rows,
+                                    geometry.depth);
+    Eigen::Map<const RhsMatrix> rhs(rhs_data + geometry.rhsOffset(b), geometry.depth,
+                                    geometry.cols);
+    Eigen::Map<RowMajorMatrix> output(output_data + geometry.outputOffset(b), geometry.rows,
+                                      geometry.cols);
+    output.noalias() = lhs * rhs;
+  }
+}
+
+struct BatchMatMulFloatTask : cpu_backend_threadpool::Task
+{
+  using RangeFn = void (*)(const BatchMatMulGeometry &, const float *, const float *, float *,
+                           int, int);
+
+  BatchMatMulFloatTask(RangeFn fn, const BatchMatMulGeometry &geometry, const float *lhs_data,
+                       const float *rhs_data, float *output_data, int batch_start, int batch_end)
+    : _fn{fn}, _geometry{geometry}, _lhs_data{lhs_data}, _rhs_data{rhs_data},
+      _output_data{output_data}, _batch_start{batch_start}, _batch_end{batch_end}
+  {
+  }
+
+  void Run() override
+  {
+    _fn(_geometry, _lhs_data, _rhs_data, _output_data, _batch_start, _batch_end);
+  }
+
+private:
+  RangeFn _fn;
+  const BatchMatMulGeometry &_geometry;
+  const float *_lhs_data;
+  const float *_rhs_data;
+  float *_output_data;
+  int _batch_start;
+  int _batch_end;
+};
+
+/**
+ * @brief BatchMatMul of float tensors, which runs a GEMM of Eigen for each batch
+ *
+ * Batches are split among the threads of @p ruy_context, since matrices of a batch are often
+ * too small to multithread, e.g. heads of attention. Adjoint operands are read in place.
+ */
+inline void BatchMatMul(const Shape &lhs_shape, const float *lhs_data, const Shape &rhs_shape,
+                        const float *rhs_data, bool adj_x, bool adj_y, const Shape &output_shape,
+                        float *output_data, ruy::Context *ruy_context)
+{
+  const BatchMatMulGeometry geometry{lhs_shape, rhs_shape, adj_x, adj_y};
+  const int batches = geometry.batches();
+  assert(output_shape.FlatSize() == batches * geometry.rows * geometry.cols);
+  UNUSED_RELEASE(output_shape);
+
+  BatchMatMulFloatTask::RangeFn fn = adj_x ? (adj_y ? BatchMatMulFloatRange<true, true>
+                                                    : BatchMatMulFloatRange<true, false>)
+                                           : (adj_y ? BatchMatMulFloatRange<false, true>
+                                                    : BatchMatMulFloatRange<false, false>);
+
+  // Each thread takes enough multiply-adds to be worth waking it up
+  constexpr int64_t kMinMacsPerThread = 64 * 1024;
+  const int64_t macs =
+    static_cast<int64_t>(batches) * geometry.rows * geometry.cols * geometry.depth;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = static_cast<int>(
+    std::max<int64_t>(1, std::min<int64_t>({max_threads, batches, macs / kMinMacsPerThread})));
+
+  if (thread_count == 1)
+  {
+    fn(geometry, lhs_data, rhs_data, output_data, 0, batches);
+    return;
+  }
+
+  std::vector<BatchMatMulFloatTask> tasks;
+  tasks.reserve(thread_count);
+  int batch_start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int batch_end = batch_start + (batches - batch_start) / (thread_count - i);
+    tasks.emplace_back(fn, geometry, lhs_data, rhs_data, output_data, batch_start, batch_end);
+    batch_start = batch_end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+/**
+ * @brief BatchMatMul of int8 tensors quantized per tensor, which runs a GEMM of ruy for each batch
+ *
+ * Batches run one after another since ruy multithreads each GEMM on @p ruy_context.
+ */
+inline void BatchMatMul(const BatchMatMulParams &params, const Shape &lhs_shape,
+                        const int8_t *lhs_data, const Shape &rhs_shape, const int8_t *rhs_data,
+                        bool adj_x, bool adj_y, const Shape &output_shape, int8_t *output_data,
+                        ruy::Context *ruy_context)
+{
+  const BatchMatMulGeometry geometry{lhs_shape, rhs_shape, adj_x, adj_y};
+  assert(output_shape.FlatSize() == geometry.batches() * geometry.rows * geometry.cols);
+  UNUSED_RELEASE(output_shape);
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = adj_x ? Order::kColMajor : Order::kRowMajor;
+  lhs_params.rows = geometry.rows;
+  lhs_params.cols = geometry.depth;
+  lhs_params.zero_point = params.lhs_zero_point;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = adj_y ? Order::kColMajor : Order::kRowMajor;
+  rhs_params.rows = geometry.depth;
+  rhs_params.cols = geometry.cols;
+  rhs_params.zero_point = params.rhs_zero_point;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kRowMajor;
+  dst_params.rows = geometry.rows;
+  dst_params.cols = geometry.cols;
+  dst_params.zero_point = params.output_zero_point;
+
+  GemmParams<int32_t, int8_t> gemm_params;
+  gemm_params.multiplier_fixedpoint = params.output_multiplier;
+  gemm_params.multiplier_exponent = params.output_shift;
+  gemm_params.clamp_min = params.quantized_activation_min;
+  gemm_params.clamp_max = params.quantized_activation_max;
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  for (int b = 0; b < geometry.batches(); ++b)
+  {
+    ruy::Matrix<int8_t> ruy_lhs;
+    ruy::Matrix<int8_t> ruy_rhs;
+    ruy::Matrix<int8_t> ruy_dst;
+    ruy_support::MakeRuyMatrix(lhs_params, lhs_data + geometry.lhsOffset(b), &ruy_lhs);
+    ruy_support::MakeRuyMatrix(rhs_params, rhs_data + geometry.rhsOffset(b), &ruy_rhs);
+    ruy_support::MakeRuyMatrix(dst_params, output_data + geometry.outputOffset(b), &ruy_dst);
+
+    ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_BATCH_MATMUL_H__
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_DIRECT_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_DIRECT_CONV_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/neon/neon_check.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Filters of at most this many input channels and this size run directly on the input, whose
+// im2col buffer would be many times larger than the input
+constexpr int kDirectConvMaxInputDepth = 16;
+constexpr int kDirectConvMaxFilterSize = 7;
+
+/**
+ * @brief Whether DirectConv() applies to a filter, e.g. of the first layers of vision models
+ */
+inline bool IsDirectConvProfitable(const Shape &filter_shape)
+{
+  return filter_shape.DimensionsCount() == 4 && filter_shape.Dims(3) <= kDirectConvMaxInputDepth &&
+         filter_shape.Dims(1) <= kDirectConvMaxFilterSize &&
+         filter_shape.Dims(2) <= kDirectConvMaxFilterSize;
+}
+
+namespace direct_conv
+{
+
+// output[o] += value * filter[o] for all output channels
+inline void MultiplyAccumulate(float value, const float *filter, float *output, int output_depth)
+{
+  int o = 0;
+#ifdef USE_NEON
+  const float32x4_t value_vec = vdupq_n_f32(value);
+  for (; o <= output_depth - 4; o += 4)
+    vst1q_f32(output + o, vmlaq_f32(vld1q_f32(output + o), value_vec, vld1q_f32(filter + o)));
+#endif
+  for (; o < output_depth; ++o)
+    output[o] += value * filter[o];
+}
+
+} // namespace direct_conv
+
+/**
+ * @brief Convolution of NHWC input with a HWIO filter that accumulates into the output directly
+ *
+ * Each input value of a tap scales a row of output channels of the filter, so no im2col buffer
+ * is needed. Rows of the output are split among threads.
+ */
+inline void DirectConv(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                       const Shape &filter_shape, const float *hwio_filter_data,
+                       const Shape &bias_shape, const float *bias_data, const Shape &output_shape,
+                       float *output_data, ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  (void)bias_shape;
+
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const float output_activation_min = params.float_activation_min;
+  const float output_activation_max = params.float_activation_max;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  auto conv_rows = [&](int start, int end) {
+    for (int row = start; row < end; ++row)
+    {
+      const int batch = row / output_height;
+      const int out_y = row % output_height;
+      const int in_y_origin = out_y * stride_height - pad_height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = out_x * stride_width - pad_width;
+        float *output_ptr = output_data + Offset(output_shape, batch, out_y, out_x, 0);
+        if (bias_data != nullptr)
+          std::copy(bias_data, bias_data + output_depth, output_ptr);
+        else
+          std::fill(output_ptr, output_ptr + output_depth, 0.f);
+
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + dilation_height_factor * filter_y;
+          if (in_y < 0 || in_y >= input_height)
+            continue;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + dilation_width_factor * filter_x;
+            if (in_x < 0 || in_x >= input_width)
+              continue;
+            const float *input_ptr = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+            const float *filter_ptr =
+              hwio_filter_data + (filter_y * filter_width + filter_x) * input_depth * output_depth;
+            for (int ic = 0; ic < input_depth; ++ic)
+              direct_conv::MultiplyAccumulate(input_ptr[ic], filter_ptr + ic * output_depth,
+                                              output_ptr, output_depth);
+          }
+        }
+
+        for (int o = 0; o < output_depth; ++o)
+          output_ptr[o] =
+            std::min(std::max(output_ptr[o], output_activation_min), output_activation_max);
+      }
+    }
+  };
+
+  const int macs_per_row = output_width * output_depth * filter_height * filter_width * input_depth;
+  const int min_rows = std::max(1, 65536 / std::max(1, macs_per_row));
+  cpu_backend_threadpool::ParallelFor(batches * output_height, min_rows, ruy_context, conv_rows);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_DIRECT_CONV_H__
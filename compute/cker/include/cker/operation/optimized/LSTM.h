@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_LSTM_H__
+#define __NNFW_CKER_OPTIMIZED_LSTM_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/TensorUtils.h"
+#include "cker/Types.h"
+#include "cker/operation/LSTM.h"
+
+#include <Eigen/Core>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Gates of an LSTM, in the order their rows are packed
+constexpr int kLstmInputGate = 0;
+constexpr int kLstmForgetGate = 1;
+constexpr int kLstmCellGate = 2;
+constexpr int kLstmOutputGate = 3;
+constexpr int kLstmGates = 4;
+
+/**
+ * @brief Unidirectional sequence LSTM whose gates are computed together
+ *
+ * The input-to-gate weights of all gates are packed into one matrix, so the input contribution
+ * to the gates of the whole sequence is one matrix multiplication ahead of the recurrence.
+ * The recurrent weights are packed the same way, for one multiplication per step.
+ * Hybrid execution keeps both packed matrices in int8 and quantizes the inputs and output
+ * states on the fly, as FullyConnectedHybrid does.
+ */
+class SequenceLstm
+{
+public:
+  SequenceLstm() = default;
+
+  bool prepared() const { return _prepared; }
+
+  /**
+   * @brief Packs the weights and biases of the gates, indexed by kLstm*Gate
+   *
+   * The input gate is absent with CIFG, i.e. its weights are nullptr.
+   */
+  void prepare(const float *const input_to_gate_weights[kLstmGates],
+               const float *const recurrent_to_gate_weights[kLstmGates],
+               const float *const gate_bias[kLstmGates], int n_cell, int n_input, int n_output,
+               bool hybrid)
+  {
+    _use_cifg = (input_to_gate_weights[kLstmInputGate] == nullptr);
+    _n_gates = _use_cifg ? kLstmGates - 1 : kLstmGates;
+    _n_cell = n_cell;
+    _n_input = n_input;
+    _n_output = n_output;
+    _hybrid = hybrid;
+
+    const int gate_size = _n_gates * n_cell;
+    std::vector<float> input_weights(gate_size * n_input);
+    std::vector<float> recurrent_weights(gate_size * n_output);
+    _bias.assign(gate_size, 0.f);
+    for (int gate = _use_cifg ? kLstmForgetGate : kLstmInputGate, row = 0; gate < kLstmGates;
+         ++gate, row += n_cell)
+    {
+      std::copy_n(input_to_gate_weights[gate], n_cell * n_input,
+                  input_weights.begin() + row * n_input);
+      std::copy_n(recurrent_to_gate_weights[gate], n_cell * n_output,
+                  recurrent_weights.begin() + row * n_output);
+      if (gate_bias[gate] != nullptr)
+        std::copy_n(gate_bias[gate], n_cell, _bias.begin() + row);
+    }
+
+    if (hybrid)
+    {
+      float unused_min, unused_max;
+      _quantized_input_weights.resize(input_weights.size());
+      SymmetricQuantizeFloats(input_weights.data(), input_weights.size(),
+                              _quantized_input_weights.data(), &unused_min, &unused_max,
+                              &_input_weights_scale);
+      _quantized_recurrent_weights.resize(recurrent_weights.size());
+      SymmetricQuantizeFloats(recurrent_weights.data(), recurrent_weights.size(),
+                              _quantized_recurrent_weights.data(), &unused_min, &unused_max,
+                              &_recurrent_weights_scale);
+      _input_weights.clear();
+      _recurrent_weights.clear();
+    }
+    else
+    {
+      _input_weights = std::move(input_weights);
+      _recurrent_weights = std::move(recurrent_weights);
+    }
+    _prepared = true;
+  }
+
+  /**
+   * @brief Runs the whole sequence, updating the output and cell states in place
+   *
+   * Peephole weights and layer norm coefficients are indexed by kLstm*Gate as well, with nullptr
+   * for the ones not given. Batch-major input runs the sequence of each batch on its own.
+   * Rows of the output are output_batch_leading_dim apart.
+   */
+  void operator()(const LSTMParams &params, const float *input_data, int max_time, int n_batch,
+                  bool time_major, bool forward_sequence,
+                  const float *const cell_to_gate_weights[kLstmGates],
+                  const float *const layer_norm_coefficients[kLstmGates],
+                  const float *projection_weights, const float *projection_bias,
+                  int output_batch_leading_dim, float *output_state, float *cell_state,
+                  float *output_data, ruy::Context *ruy_context = nullptr)
+  {
+    assert(_prepared);
+    const int gate_size = _n_gates * _n_cell;
+    const int rows = max_time * n_batch;
+    // Layer norm adds the bias after normalization, so it can not be in the first product
+    const bool use_layer_norm = (layer_norm_coefficients[kLstmForgetGate] != nullptr);
+    _gates.resize(static_cast<size_t>(rows) * gate_size);
+    _hidden.resize(_n_cell);
+    computeInputGates(input_data, rows, !use_layer_norm, ruy_context);
+
+    if (time_major)
+    {
+      for (int t = 0; t < max_time; ++t)
+      {
+        const int t_rel = forward_sequence ? t : max_time - t - 1;
+        step(params, _gates.data() + t_rel * n_batch * gate_size, n_batch, cell_to_gate_weights,
+             layer_norm_coefficients, projection_weights, projection_bias, output_state,
+             cell_state);
+        for (int b = 0; b < n_batch; ++b)
+          std::copy_n(output_state + b * _n_output, _n_output,
+                      output_data + (t_rel * n_batch + b) * output_batch_leading_dim);
+      }
+    }
+    else
+    {
+      for (int b = 0; b < n_batch; ++b)
+      {
+        for (int t = 0; t < max_time; ++t)
+        {
+          const int t_rel = forward_sequence ? t : max_time - t - 1;
+          const int row = b * max_time + t_rel;
+          step(params, _gates.data() + row * gate_size, 1, cell_to_gate_weights,
+               layer_norm_coefficients, projection_weights, projection_bias,
+               output_state + b * _n_output, cell_state + b * _n_cell);
+          std::copy_n(output_state + b * _n_output, _n_output,
+                      output_data + row * output_batch_leading_dim);
+        }
+      }
+    }
+  }
+
+private:
+  // gates = W_input * input (+ bias) for every row of the input, split among threads by rows
+  void computeInputGates(const float *input_data, int rows, bool add_bias,
+                         ruy::Context *ruy_context)
+  {
+    using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    const int gate_size = _n_gates * _n_cell;
+    if (_hybrid)
+    {
+      _quantized_input.resize(static_cast<size_t>(rows) * _n_input);
+      _scaling_factors.resize(rows);
+    }
+
+    cpu_backend_threadpool::ParallelFor(
+      rows, cpu_backend_threadpool::MinRangeForElements(gate_size * _n_input), ruy_context,
+      [&](int start, int end) {
+        float *gates = _gates.data() + start * gate_size;
+        if (add_bias)
+          VectorBatchVectorAssign(_bias.data(), gate_size, end - start, gates);
+        else
+          std::fill_n(gates, (end - start) * gate_size, 0.f);
+
+        if (_hybrid)
+        {
+          float unused_min, unused_max;
+          for (int row = start; row < end; ++row)
+          {
+            SymmetricQuantizeFloats(input_data + row * _n_input, _n_input,
+                                    _quantized_input.data() + row * _n_input, &unused_min,
+                                    &unused_max, &_scaling_factors[row]);
+            _scaling_factors[row] *= _input_weights_scale;
+          }
+          MatrixBatchVectorMultiplyAccumulate(
+            _quantized_input_weights.data(), gate_size, _n_input,
+            _quantized_input.data() + start * _n_input, _scaling_factors.data() + start,
+            end - start, gates, /*result_stride=*/1);
+        }
+        else
+        {
+          Eigen::Map<const RowMajorMatrix> input(input_data + start * _n_input, end - start,
+                                                 _n_input);
+          Eigen::Map<const RowMajorMatrix> weights(_input_weights.data(), gate_size, _n_input);
+          Eigen::Map<RowMajorMatrix> output(gates, end - start, gate_size);
+          output.noalias() += input * weights.transpose();
+        }
+      });
+  }
+
+  // Finishes the gates of n_batch rows, which hold their input contribution, and updates the
+  // cell and output states of the rows
+  void step(const LSTMParams &params, float *gates, int n_batch,
+            const float *const cell_to_gate_weights[kLstmGates],
+            const float *const layer_norm_coefficients[kLstmGates],
+            const float *projection_weights, const float *projection_bias, float *output_state,
+            float *cell_state)
+  {
+    const int gate_size = _n_gates * _n_cell;
+    if (_hybrid)
+    {
+      _quantized_state.resize(n_batch * _n_output);
+      _state_scaling_factors.resize(n_batch);
+      float unused_min, unused_max;
+      for (int b = 0; b < n_batch; ++b)
+      {
+        SymmetricQuantizeFloats(output_state + b * _n_output, _n_output,
+                                _quantized_state.data() + b * _n_output, &unused_min,
+                                &unused_max, &_state_scaling_factors[b]);
+        _state_scaling_factors[b] *= _recurrent_weights_scale;
+      }
+      MatrixBatchVectorMultiplyAccumulate(_quantized_recurrent_weights.data(), gate_size,
+                                          _n_output, _quantized_state.data(),
+                                          _state_scaling_factors.data(), n_batch, gates,
+                                          /*result_stride=*/1);
+    }
+    else
+    {
+      MatrixBatchVectorMultiplyAccumulate(_recurrent_weights.data(), gate_size, _n_output,
+                                          output_state, n_batch, gates, /*result_stride=*/1);
+    }
+
+    float *gate[kLstmGates];
+    for (int b = 0; b < n_batch; ++b)
+    {
+      float *cell = cell_state + b * _n_cell;
+      float *row = gates + b * gate_size;
+      gate[kLstmInputGate] = nullptr;
+      for (int g = _use_cifg ? kLstmForgetGate : kLstmInputGate; g < kLstmGates; ++g)
+      {
+        gate[g] = row;
+        row += _n_cell;
+      }
+
+      // The output gate looks at the updated cell state
+      for (int g = _use_cifg ? kLstmForgetGate : kLstmInputGate; g < kLstmOutputGate; ++g)
+      {
+        finishGate(gate[g], g, g == kLstmCellGate ? nullptr : cell, cell_to_gate_weights[g],
+                   layer_norm_coefficients[g],
+                   g == kLstmCellGate ? params.activation : FusedActivationFunctionType::kSigmoid);
+      }
+      UpdateLstmCellFloat(1, _n_cell, cell, gate[kLstmInputGate], gate[kLstmForgetGate],
+                          gate[kLstmCellGate], _use_cifg, params.cell_clip);
+      finishGate(gate[kLstmOutputGate], kLstmOutputGate, cell,
+                 cell_to_gate_weights[kLstmOutputGate], layer_norm_coefficients[kLstmOutputGate],
+                 FusedActivationFunctionType::kSigmoid);
+
+      CalculateLstmOutputFloat(1, _n_cell, _n_output, cell, gate[kLstmOutputGate],
+                               params.activation, projection_weights, projection_bias,
+                               params.proj_clip, output_state + b * _n_output, _hidden.data());
+    }
+  }
+
+  // Adds the peephole and applies layer norm and activation to a gate of a row
+  void finishGate(float *gate, int gate_index, const float *cell,
+                  const float *cell_to_gate_weights, const float *layer_norm_coefficients,
+                  FusedActivationFunctionType activation)
+  {
+    if (cell_to_gate_weights != nullptr)
+      VectorVectorCwiseProductAccumulate(cell_to_gate_weights, cell, _n_cell, gate);
+    if (layer_norm_coefficients != nullptr)
+    {
+      MeanStddevNormalization(gate, gate, _n_cell, 1);
+      VectorBatchVectorCwiseProduct(layer_norm_coefficients, _n_cell, gate, 1, gate);
+      const int gate_row = gate_index - (_use_cifg ? kLstmForgetGate : kLstmInputGate);
+      VectorBatchVectorAdd(_bias.data() + gate_row * _n_cell, _n_cell, 1, gate);
+    }
+    ApplyActivationToVector(gate, _n_cell, activation, gate);
+  }
+
+private:
+  bool _prepared{false};
+  bool _use_cifg{false};
+  bool _hybrid{false};
+  int _n_gates{0};
+  int _n_cell{0};
+  int _n_input{0};
+  int _n_output{0};
+
+  // Packed [gates * n_cell, n_input] and [gates * n_cell, n_output] weights, in float or int8
+  std::vector<float> _input_weights;
+  std::vector<float> _recurrent_weights;
+  std::vector<int8_t> _quantized_input_weights;
+  std::vector<int8_t> _quantized_recurrent_weights;
+  float _input_weights_scale{1.f};
+  float _recurrent_weights_scale{1.f};
+  std::vector<float> _bias;
+
+  // Gates of every row of the sequence, and the gated cell state of a row
+  std::vector<float> _gates;
+  std::vector<float> _hidden;
+
+  // Inputs and output states quantized for hybrid execution, with their scaling factors
+  std::vector<int8_t> _quantized_input;
+  std::vector<float> _scaling_factors;
+  std::vector<int8_t> _quantized_state;
+  std::vector<float> _state_scaling_factors;
+};
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_LSTM_H__
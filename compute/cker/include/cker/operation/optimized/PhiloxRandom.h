@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_PHILOX_RANDOM_H__
+#define __NNFW_CKER_OPTIMIZED_PHILOX_RANDOM_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/neon/neon_check.h"
+#include "cker/operation/Helper/PhiloxRandom.h"
+#include "cker/operation/Helper/RandomDistributions.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+namespace philox
+{
+
+// Philox4x32-10 generates a group of 4 values for each counter, and the counter of the i-th group
+// is the counter of the generator skipped by i. So any range of groups is computed on its own,
+// and the values do not depend on how the range is split among lanes and threads.
+constexpr int kGroupSize = random::PhiloxRandom::kResultElementCount;
+// Groups computed together in the lanes of vectors
+constexpr int kLanes = 4;
+
+/**
+ * @brief Write kLanes groups of uniform floats of [0, 1) to @p data one after another
+ *
+ * @note  Compilers do not vectorize Philox well on targets without NEON, where the 64-bit products
+ *        of a round are not in vectors, so groups are computed as they are in the TF port.
+ */
+inline void PortableUniformFloatLanes(random::PhiloxRandom *gen, float *data)
+{
+  random::UniformDistribution<random::PhiloxRandom, float> dist;
+  for (int lane = 0; lane < kLanes; ++lane)
+  {
+    const auto samples = dist(gen);
+    std::copy(&samples[0], &samples[0] + kGroupSize, data + lane * kGroupSize);
+  }
+}
+
+#ifdef USE_NEON
+
+// The same constants as random::PhiloxRandom
+constexpr uint32_t kW32A = 0x9E3779B9;
+constexpr uint32_t kW32B = 0xBB67AE85;
+constexpr uint32_t kM4x32A = 0xD2511F53;
+constexpr uint32_t kM4x32B = 0xCD9E8D57;
+constexpr int kRounds = 10;
+
+/**
+ * @brief Counters of kLanes consecutive groups from @p gen, word by word
+ */
+inline void LoadCounters(random::PhiloxRandom *gen, uint32_t counters[kGroupSize][kLanes])
+{
+  for (int lane = 0; lane < kLanes; ++lane)
+  {
+    const auto &counter = gen->counter();
+    for (int w = 0; w < kGroupSize; ++w)
+      counters[w][lane] = counter[w];
+    gen->Skip(1);
+  }
+}
+
+inline void NeonMultiplyHighLow(uint32x4_t a, uint32_t b, uint32x4_t *low, uint32x4_t *high)
+{
+  const uint32x2_t vb = vdup_n_u32(b);
+  const uint64x2_t p_low = vmull_u32(vget_low_u32(a), vb);
+  const uint64x2_t p_high = vmull_u32(vget_high_u32(a), vb);
+  *low = vcombine_u32(vmovn_u64(p_low), vmovn_u64(p_high));
+  *high = vcombine_u32(vshrn_n_u64(p_low, 32), vshrn_n_u64(p_high, 32));
+}
+
+inline float32x4_t NeonUint32ToFloat(uint32x4_t x)
+{
+  // The same as random::Uint32ToFloat, 23 random bits of mantissa with the exponent of 1.0
+  const uint32x4_t bits = vorrq_u32(vandq_u32(x, vdupq_n_u32(0x7fffffu)), vdupq_n_u32(127u << 23));
+  return vsubq_f32(vreinterpretq_f32_u32(bits), vdupq_n_f32(1.0f));
+}
+
+inline void NeonUniformFloatLanes(random::PhiloxRandom *gen, float *data)
+{
+  uint32_t counters[kGroupSize][kLanes];
+  LoadCounters(gen, counters);
+
+  uint32x4_t c0 = vld1q_u32(counters[0]);
+  uint32x4_t c1 = vld1q_u32(counters[1]);
+  uint32x4_t c2 = vld1q_u32(counters[2]);
+  uint32x4_t c3 = vld1q_u32(counters[3]);
+
+  uint32_t k0 = gen->key()[0];
+  uint32_t k1 = gen->key()[1];
+  for (int round = 0; round < kRounds; ++round)
+  {
+    uint32x4_t lo0, hi0, lo1, hi1;
+    NeonMultiplyHighLow(c0, kM4x32A, &lo0, &hi0);
+    NeonMultiplyHighLow(c2, kM4x32B, &lo1, &hi1);
+    c0 = veorq_u32(veorq_u32(hi1, c1), vdupq_n_u32(k0));
+    c1 = lo1;
+    c2 = veorq_u32(veorq_u32(hi0, c3), vdupq_n_u32(k1));
+    c3 = lo0;
+    k0 += kW32A;
+    k1 += kW32B;
+  }
+
+  // Lane i of each word makes the i-th group, which vst4q interleaves
+  float32x4x4_t values;
+  values.val[0] = NeonUint32ToFloat(c0);
+  values.val[1] = NeonUint32ToFloat(c1);
+  values.val[2] = NeonUint32ToFloat(c2);
+  values.val[3] = NeonUint32ToFloat(c3);
+  vst4q_f32(data, values);
+}
+
+#endif // USE_NEON
+
+/**
+ * @brief Write the groups [@p begin, @p end) of uniform floats of [0, 1) from @p gen to @p data,
+ *        where @p data is of the 0th group
+ */
+inline void UniformFloatGroups(const random::PhiloxRandom &gen, int64_t begin, int64_t end,
+                               float *data)
+{
+  random::PhiloxRandom lanes_gen = gen;
+  lanes_gen.Skip(static_cast<uint64_t>(begin));
+
+  float *out = data + begin * kGroupSize;
+  int64_t groups = end - begin;
+  for (; groups >= kLanes; groups -= kLanes, out += kLanes * kGroupSize)
+    NEON_OR_PORTABLE(UniformFloatLanes, &lanes_gen, out);
+
+  random::UniformDistribution<random::PhiloxRandom, float> dist;
+  for (; groups > 0; --groups, out += kGroupSize)
+  {
+    const auto samples = dist(&lanes_gen);
+    std::copy(&samples[0], &samples[0] + kGroupSize, out);
+  }
+}
+
+} // namespace philox
+
+/**
+ * @brief Fill @p size floats of [0, 1) uniformly from @p gen on the threads of @p ruy_context
+ *
+ * The values are the same as ones of random::UniformDistribution drawn from @p gen one after
+ * another, however many threads there are.
+ */
+inline void PhiloxUniformFloat(const random::PhiloxRandom &gen, float *data, int64_t size,
+                               ruy::Context *ruy_context)
+{
+  using namespace philox;
+
+  const int64_t full_groups = size / kGroupSize;
+  const int64_t remaining = size - full_groups * kGroupSize;
+
+  if (full_groups > std::numeric_limits<int>::max())
+  {
+    UniformFloatGroups(gen, 0, full_groups, data);
+  }
+  else
+  {
+    const int min_groups = cpu_backend_threadpool::MinRangeForElements(
+      kGroupSize * random::PhiloxRandom::kElementCost);
+    cpu_backend_threadpool::ParallelFor(
+      static_cast<int>(full_groups), min_groups, ruy_context,
+      [&](int begin, int end) { UniformFloatGroups(gen, begin, end, data); });
+  }
+
+  if (remaining > 0)
+  {
+    random::PhiloxRandom tail_gen = gen;
+    tail_gen.Skip(static_cast<uint64_t>(full_groups));
+    const auto samples = random::UniformDistribution<random::PhiloxRandom, float>()(&tail_gen);
+    std::copy(&samples[0], &samples[0] + remaining, data + full_groups * kGroupSize);
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_PHILOX_RANDOM_H__
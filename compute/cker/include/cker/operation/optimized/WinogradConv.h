@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <Eigen/Core>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// F(2x2, 3x3) computes 2x2 outputs from 4x4 inputs, with 4x4 products per filter instead of 9x4
+constexpr int kWinogradTileSize = 4;
+constexpr int kWinogradOutputTileSize = 2;
+constexpr int kWinogradTileElements = kWinogradTileSize * kWinogradTileSize;
+// Transforms are paid per channel and tile, so narrow convolutions gain nothing from them
+constexpr int kWinogradMinChannels = 16;
+// Tiles transformed and multiplied together, whose buffers stay in cache
+constexpr int kWinogradTileBlock = 32;
+
+/**
+ * @brief Whether a convolution is 3x3 of stride 1 and wide enough for WinogradConv() to be faster
+ */
+inline bool IsWinogradProfitable(const Shape &filter_shape, int stride_width, int stride_height,
+                                 int dilation_width_factor, int dilation_height_factor)
+{
+  return filter_shape.DimensionsCount() == 4 && filter_shape.Dims(1) == 3 &&
+         filter_shape.Dims(2) == 3 && stride_width == 1 && stride_height == 1 &&
+         dilation_width_factor == 1 && dilation_height_factor == 1 &&
+         filter_shape.Dims(0) >= kWinogradMinChannels &&
+         filter_shape.Dims(3) >= kWinogradMinChannels;
+}
+
+/**
+ * @brief Transform an OHWI 3x3 filter into G x g x G^T per channel pair
+ *
+ * The result is 16 row-major [input depth x output depth] matrices, one per tile element.
+ */
+inline void WinogradTransformFilter(const Shape &filter_shape, const float *filter_data,
+                                    std::vector<float> &transformed)
+{
+  assert(filter_shape.Dims(1) == 3 && filter_shape.Dims(2) == 3);
+  const int output_depth = filter_shape.Dims(0);
+  const int input_depth = filter_shape.Dims(3);
+  transformed.resize(kWinogradTileElements * input_depth * output_depth);
+
+  for (int o = 0; o < output_depth; ++o)
+  {
+    for (int i = 0; i < input_depth; ++i)
+    {
+      float g[3][3];
+      for (int y = 0; y < 3; ++y)
+        for (int x = 0; x < 3; ++x)
+          g[y][x] = filter_data[Offset(filter_shape, o, y, x, i)];
+
+      // G x g, where G = [1 0 0; .5 .5 .5; .5 -.5 .5; 0 0 1]
+      float gg[4][3];
+      for (int x = 0; x < 3; ++x)
+      {
+        gg[0][x] = g[0][x];
+        gg[1][x] = 0.5f * (g[0][x] + g[1][x] + g[2][x]);
+        gg[2][x] = 0.5f * (g[0][x] - g[1][x] + g[2][x]);
+        gg[3][x] = g[2][x];
+      }
+      // (G x g) x G^T
+      for (int y = 0; y < 4; ++y)
+      {
+        const float u[4] = {gg[y][0], 0.5f * (gg[y][0] + gg[y][1] + gg[y][2]),
+                            0.5f * (gg[y][0] - gg[y][1] + gg[y][2]), gg[y][2]};
+        for (int x = 0; x < 4; ++x)
+          transformed[((y * 4 + x) * input_depth + i) * output_depth + o] = u[x];
+      }
+    }
+  }
+}
+
+namespace winograd
+{
+
+inline void TransformInputTile(const Shape &input_shape, const float *input_data, int batch,
+                               int y0, int x0, int input_depth, int tile_stride, float *v)
+{
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const float *rows[4][4];
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x)
+    {
+      const int in_y = y0 + y;
+      const int in_x = x0 + x;
+      const bool inside = in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width;
+      rows[y][x] = inside ? input_data + Offset(input_shape, batch, in_y, in_x, 0) : nullptr;
+    }
+
+  for (int c = 0; c < input_depth; ++c)
+  {
+    float d[4][4];
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x)
+        d[y][x] = rows[y][x] ? rows[y][x][c] : 0.f;
+
+    // B^T x d, where B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1]
+    float t[4][4];
+    for (int x = 0; x < 4; ++x)
+    {
+      t[0][x] = d[0][x] - d[2][x];
+      t[1][x] = d[1][x] + d[2][x];
+      t[2][x] = d[2][x] - d[1][x];
+      t[3][x] = d[1][x] - d[3][x];
+    }
+    // (B^T x d) x B
+    for (int y = 0; y < 4; ++y)
+    {
+      v[(y * 4 + 0) * tile_stride + c] = t[y][0] - t[y][2];
+      v[(y * 4 + 1) * tile_stride + c] = t[y][1] + t[y][2];
+      v[(y * 4 + 2) * tile_stride + c] = t[y][2] - t[y][1];
+      v[(y * 4 + 3) * tile_stride + c] = t[y][1] - t[y][3];
+    }
+  }
+}
+
+inline void TransformOutputTile(const float *m, int tile_stride, const float *bias_data,
+                                float activation_min, float activation_max, int output_depth,
+                                int out_rows, int out_cols, float *out[2][2])
+{
+  for (int o = 0; o < output_depth; ++o)
+  {
+    // A^T x m, where A^T = [1 1 1 0; 0 1 -1 -1]
+    float t[2][4];
+    for (int x = 0; x < 4; ++x)
+    {
+      const float m0 = m[(0 * 4 + x) * tile_stride + o];
+      const float m1 = m[(1 * 4 + x) * tile_stride + o];
+      const float m2 = m[(2 * 4 + x) * tile_stride + o];
+      const float m3 = m[(3 * 4 + x) * tile_stride + o];
+      t[0][x] = m0 + m1 + m2;
+      t[1][x] = m1 - m2 - m3;
+    }
+    const float bias = bias_data ? bias_data[o] : 0.f;
+    // (A^T x m) x A
+    for (int y = 0; y < out_rows; ++y)
+    {
+      const float y0 = t[y][0] + t[y][1] + t[y][2] + bias;
+      const float y1 = t[y][1] - t[y][2] - t[y][3] + bias;
+      out[y][0][o] = std::min(std::max(y0, activation_min), activation_max);
+      if (out_cols > 1)
+        out[y][1][o] = std::min(std::max(y1, activation_min), activation_max);
+    }
+  }
+}
+
+} // namespace winograd
+
+/**
+ * @brief Convolution of NHWC input with a filter of WinogradTransformFilter()
+ *
+ * Blocks of 2x2 output tiles are split among threads. Each block transforms its input tiles,
+ * multiplies them by the transformed filter as 16 matrix products and transforms them back.
+ */
+inline void WinogradConv(const ConvParams &params, const Shape &input_shape,
+                         const float *input_data, const Shape &filter_shape,
+                         const float *transformed_filter_data, const Shape &bias_shape,
+                         const float *bias_data, const Shape &output_shape, float *output_data,
+                         ruy::Context *ruy_context)
+{
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  (void)bias_shape;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int pad_height = params.padding_values.height;
+  const int pad_width = params.padding_values.width;
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+
+  const int tiles_y = (output_height + kWinogradOutputTileSize - 1) / kWinogradOutputTileSize;
+  const int tiles_x = (output_width + kWinogradOutputTileSize - 1) / kWinogradOutputTileSize;
+  const int tiles = batches * tiles_y * tiles_x;
+  const int blocks = (tiles + kWinogradTileBlock - 1) / kWinogradTileBlock;
+
+  auto run_blocks = [&](int start, int end) {
+    // Per tile element, [tiles x input depth] and [tiles x output depth] matrices
+    std::vector<float> v(kWinogradTileElements * kWinogradTileBlock * input_depth);
+    std::vector<float> m(kWinogradTileElements * kWinogradTileBlock * output_depth);
+    const int v_stride = kWinogradTileBlock * input_depth;
+    const int m_stride = kWinogradTileBlock * output_depth;
+
+    for (int block = start; block < end; ++block)
+    {
+      const int first_tile = block * kWinogradTileBlock;
+      const int block_tiles = std::min(kWinogradTileBlock, tiles - first_tile);
+      for (int t = 0; t < block_tiles; ++t)
+      {
+        const int tile = first_tile + t;
+        const int batch = tile / (tiles_y * tiles_x);
+        const int ty = (tile / tiles_x) % tiles_y;
+        const int tx = tile % tiles_x;
+        winograd::TransformInputTile(input_shape, input_data, batch,
+                                     ty * kWinogradOutputTileSize - pad_height,
+                                     tx * kWinogradOutputTileSize - pad_width, input_depth,
+                                     v_stride, v.data() + t * input_depth);
+      }
+
+      for (int e = 0; e < kWinogradTileElements; ++e)
+      {
+        Eigen::Map<const RowMajorMatrix> lhs(v.data() + e * v_stride, block_tiles, input_depth);
+        Eigen::Map<const RowMajorMatrix> rhs(
+          transformed_filter_data + e * input_depth * output_depth, input_depth, output_depth);
+        Eigen::Map<RowMajorMatrix> product(m.data() + e * m_stride, block_tiles, output_depth);
+        product.noalias() = lhs * rhs;
+      }
+
+      for (int t = 0; t < block_tiles; ++t)
+      {
+        const int tile = first_tile + t;
+        const int batch = tile / (tiles_y * tiles_x);
+        const int out_y = ((tile / tiles_x) % tiles_y) * kWinogradOutputTileSize;
+        const int out_x = (tile % tiles_x) * kWinogradOutputTileSize;
+        const int out_rows = std::min(kWinogradOutputTileSize, output_height - out_y);
+        const int out_cols = std::min(kWinogradOutputTileSize, output_width - out_x);
+        float *out[2][2];
+        for (int y = 0; y < 2; ++y)
+          for (int x = 0; x < 2; ++x)
+            out[y][x] = (y < out_rows && x < out_cols)
+                          ? output_data + Offset(output_shape, batch, out_y + y, out_x + x, 0)
+                          : nullptr;
+        winograd::TransformOutputTile(m.data() + t * output_depth, m_stride, bias_data,
+                                      activation_min, activation_max, output_depth, out_rows,
+                                      out_cols, out);
+      }
+    }
+  };
+
+  cpu_backend_threadpool::ParallelFor(blocks, 1, ruy_context, run_blocks);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_CONV_INT8_H__
+#define __NNFW_CKER_OPTIMIZED_CONV_INT8_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+/**
+ * @brief Whether ConvPerChannel can use the input as the im2col matrix as it is
+ */
+inline bool IsPointwiseConv(const ConvParams &params, const Shape &filter_shape)
+{
+  return filter_shape.Dims(1) == 1 && filter_shape.Dims(2) == 1 && params.stride_width == 1 &&
+         params.stride_height == 1 && params.dilation_width_factor == 1 &&
+         params.dilation_height_factor == 1 && params.padding_values.width == 0 &&
+         params.padding_values.height == 0;
+}
+
+/**
+ * @brief Gather NHWC input patches into columns of a [filter size x output pixels] matrix
+ *
+ * Out of the input, values are the input zero point, which means zero.
+ */
+inline void Im2colInt8(const ConvParams &params, const Shape &input_shape, const int8_t *input_data,
+                       const Shape &filter_shape, const Shape &output_shape, int8_t zero_point,
+                       int8_t *im2col_data)
+{
+  const int batches = input_shape.Dims(0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  int8_t *column = im2col_data;
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      const int in_y_origin = out_y * params.stride_height - params.padding_values.height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = out_x * params.stride_width - params.padding_values.width;
+        for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+        {
+          const int in_y = in_y_origin + params.dilation_height_factor * filter_y;
+          for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+          {
+            const int in_x = in_x_origin + params.dilation_width_factor * filter_x;
+            if (in_y < 0 || in_y >= input_height || in_x < 0 || in_x >= input_width)
+              std::memset(column, zero_point, input_depth);
+            else
+              std::memcpy(column, input_data + Offset(input_shape, b, in_y, in_x, 0), input_depth);
+            column += input_depth;
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Convolution of int8 with per-channel quantized filter as a GEMM on ruy
+ *
+ * [output depth x filter size] filter times [filter size x output pixels] im2col matrix gives
+ * NHWC output, requantized per output channel by ruy. Pointwise convolution skips im2col.
+ *
+ * @param im2col_data Buffer for im2col matrix, which is kept among calls to save allocations
+ */
+inline void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                           const int32_t *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           const int8_t *filter_data, const Shape &bias_shape,
+                           const int32_t *bias_data, const Shape &output_shape,
+                           int8_t *output_data, std::vector<int8_t> &im2col_data,
+                           ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_shape.Dims(3));
+  (void)bias_shape;
+
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int filter_size = filter_shape.FlatSize() / output_depth;
+  const int output_pixels = output_shape.FlatSize() / output_depth;
+  assert(filter_size == filter_shape.Dims(1) * filter_shape.Dims(2) * input_shape.Dims(3));
+  // Input offset is negative input zero point, which is in int8
+  const int8_t input_zero_point = static_cast<int8_t>(-params.input_offset);
+
+  const int8_t *gemm_input_data = input_data;
+  if (!IsPointwiseConv(params, filter_shape))
+  {
+    im2col_data.resize(static_cast<size_t>(filter_size) * output_pixels);
+    Im2colInt8(params, input_shape, input_data, filter_shape, output_shape, input_zero_point,
+               im2col_data.data());
+    gemm_input_data = im2col_data.data();
+  }
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = filter_size;
+  lhs_params.zero_point = 0;
+  lhs_params.cache_policy =
+    params.lhs_cacheable ? CachePolicy::kCacheIfLargeSpeedup : CachePolicy::kNeverCache;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = filter_size;
+  rhs_params.cols = output_pixels;
+  rhs_params.zero_point = input_zero_point;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = output_pixels;
+  dst_params.zero_point = static_cast<int8_t>(params.output_offset);
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<int8_t>(params.quantized_activation_min);
+  gemm_params.clamp_max = static_cast<int8_t>(params.quantized_activation_max);
+
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs, params.lhs_cacheable);
+  ruy_support::MakeRuyMatrix(rhs_params, gemm_input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_CONV_INT8_H__
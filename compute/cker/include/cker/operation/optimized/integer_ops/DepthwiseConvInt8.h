@@ -19,6 +19,7 @@
 #define __NNFW_CKER_OPTIMIZED_DEPTHWISE_CONV_INT8_H__
 
 #include "cker/CpuBackendThreadpool.h"
+#include "cker/CpuFlags.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -1645,6 +1646,157 @@ inline void QuantizedDepthwiseConvAccumRowGeneric(int stride, int dilation_facto
   }
 }
 
+#if defined(USE_NEON) && defined(__aarch64__)
+// Accumulates 16 channels of the output pixels from 4 taps of a filter row by SDOT, which the
+// CPU may lack. SDOT is encoded by .word, so that no compiler flag for ARMv8.2 is required.
+// Taps of each channel are interleaved in the filter, i.e. f[t0][c] f[t1][c] f[t2][c] f[t3][c]
+// for channels c = 0..15, and in the input the same way by zipping the 4 taps loaded.
+inline void QuantizedDepthwiseConvDotprodBlock(int num_output_pixels, const int8_t *input_ptr,
+                                               int64_t tap1_offset, int64_t tap2_offset,
+                                               int64_t tap3_offset, int64_t input_ptr_increment,
+                                               const int8_t *filter_ptr, int64_t acc_increment,
+                                               int32_t *acc_buffer_ptr)
+{
+  asm volatile(
+    "ld1 {v20.16b, v21.16b, v22.16b, v23.16b}, [%[filter_ptr]]\n"
+
+    "1:\n"
+    "ldr q0, [%[input_ptr]]\n"
+    "ldr q1, [%[input_ptr], %[tap1_offset]]\n"
+    "ldr q2, [%[input_ptr], %[tap2_offset]]\n"
+    "ldr q3, [%[input_ptr], %[tap3_offset]]\n"
+    "ld1 {v16.4s, v17.4s, v18.4s, v19.4s}, [%[acc_buffer_ptr]]\n"
+    "add %[input_ptr], %[input_ptr], %[input_ptr_increment]\n"
+
+    // Interleave the taps of each channel
+    "zip1 v4.16b, v0.16b, v1.16b\n"
+    "zip2 v5.16b, v0.16b, v1.16b\n"
+    "zip1 v6.16b, v2.16b, v3.16b\n"
+    "zip2 v7.16b, v2.16b, v3.16b\n"
+    "zip1 v0.8h, v4.8h, v6.8h\n"
+    "zip2 v1.8h, v4.8h, v6.8h\n"
+    "zip1 v2.8h, v5.8h, v7.8h\n"
+    "zip2 v3.8h, v5.8h, v7.8h\n"
+
+    ".word 0x4e949410  // sdot v16.4s, v0.16b, v20.16b\n"
+    ".word 0x4e959431  // sdot v17.4s, v1.16b, v21.16b\n"
+    ".word 0x4e969452  // sdot v18.4s, v2.16b, v22.16b\n"
+    ".word 0x4e979473  // sdot v19.4s, v3.16b, v23.16b\n"
+
+    "st1 {v16.4s, v17.4s, v18.4s, v19.4s}, [%[acc_buffer_ptr]], %[acc_increment]\n"
+    "subs %w[num_output_pixels], %w[num_output_pixels], #1\n"
+    "bne 1b\n"
+    : [ num_output_pixels ] "+r"(num_output_pixels), [ input_ptr ] "+r"(input_ptr),
+      [ acc_buffer_ptr ] "+r"(acc_buffer_ptr)
+    : [ tap1_offset ] "r"(tap1_offset), [ tap2_offset ] "r"(tap2_offset),
+      [ tap3_offset ] "r"(tap3_offset), [ input_ptr_increment ] "r"(input_ptr_increment),
+      [ filter_ptr ] "r"(filter_ptr), [ acc_increment ] "r"(acc_increment)
+    : "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v16", "v17", "v18", "v19", "v20", "v21",
+      "v22", "v23", "cc", "memory");
+}
+
+// DepthwiseConvAccumRow for depth multiplier 1 and filters up to 4 wide by SDOT, which takes
+// the taps of a filter row at once. The input offset is added as the offset times the sum of
+// the taps of each channel. Output pixels some of whose taps are in the padding take the
+// generic fallback, so do channels past a multiple of 16.
+inline void QuantizedDepthwiseConvAccumRowDotprod(int stride, int dilation_factor, int input_depth,
+                                                  int input_width, const int8_t *input_data,
+                                                  int16_t input_offset, int pad_width,
+                                                  int depth_multiplier, int filter_width,
+                                                  const int8_t *filter_data, int out_x_buffer_start,
+                                                  int out_x_buffer_end, int output_depth,
+                                                  int32_t *acc_buffer)
+{
+  constexpr int kTaps = 4;
+  constexpr int kBlockDepth = 16;
+  static const int kMaxDepth = 2048;
+  assert(depth_multiplier == 1);
+  assert(filter_width <= kTaps);
+  assert(output_depth == input_depth && input_depth <= kMaxDepth);
+  UNUSED_RELEASE(depth_multiplier);
+
+  // Output pixels all of whose taps are in the input
+  const int last_tap = dilation_factor * (filter_width - 1);
+  const int inner_start = std::max(out_x_buffer_start, (pad_width + stride - 1) / stride);
+  const int inner_last = input_width - 1 + pad_width - last_tap;
+  const int inner_end = (inner_last < 0) ? inner_start
+                                         : std::min(out_x_buffer_end, inner_last / stride + 1);
+  if (inner_end <= inner_start)
+  {
+    QuantizedDepthwiseConvAccumRowGeneric(stride, dilation_factor, input_depth, input_width,
+                                          input_data, input_offset, pad_width, depth_multiplier,
+                                          filter_width, filter_data, out_x_buffer_start,
+                                          out_x_buffer_end, output_depth, acc_buffer);
+    return;
+  }
+  if (out_x_buffer_start < inner_start)
+  {
+    QuantizedDepthwiseConvAccumRowGeneric(stride, dilation_factor, input_depth, input_width,
+                                          input_data, input_offset, pad_width, depth_multiplier,
+                                          filter_width, filter_data, out_x_buffer_start,
+                                          inner_start, output_depth, acc_buffer);
+  }
+  if (inner_end < out_x_buffer_end)
+  {
+    QuantizedDepthwiseConvAccumRowGeneric(
+      stride, dilation_factor, input_depth, input_width, input_data, input_offset, pad_width,
+      depth_multiplier, filter_width, filter_data, inner_end, out_x_buffer_end, output_depth,
+      acc_buffer + (inner_end - out_x_buffer_start) * output_depth);
+  }
+
+  // Interleave the taps of the filter for SDOT, where missing taps are 0, and sum them up
+  const int block_depth = input_depth - input_depth % kBlockDepth;
+  int8_t filter_interleaved[kTaps * kMaxDepth];
+  int32_t filter_sums[kMaxDepth];
+  for (int c = 0; c < input_depth; ++c)
+  {
+    int32_t sum = 0;
+    for (int t = 0; t < kTaps; ++t)
+    {
+      const int8_t value = (t < filter_width) ? filter_data[t * output_depth + c] : 0;
+      filter_interleaved[c * kTaps + t] = value;
+      sum += value;
+    }
+    filter_sums[c] = sum;
+  }
+
+  const int num_output_pixels = inner_end - inner_start;
+  int32_t *acc_buffer_ptr = acc_buffer + (inner_start - out_x_buffer_start) * output_depth;
+  const int8_t *input_ptr = input_data + (inner_start * stride - pad_width) * input_depth;
+  const int64_t input_ptr_increment = stride * input_depth;
+  const int64_t tap_offset = dilation_factor * input_depth;
+  // Missing taps read the first one again, whose filter values are 0
+  const int64_t tap1_offset = (filter_width > 1) ? tap_offset : 0;
+  const int64_t tap2_offset = (filter_width > 2) ? 2 * tap_offset : 0;
+  const int64_t tap3_offset = (filter_width > 3) ? 3 * tap_offset : 0;
+  for (int c = 0; c < block_depth; c += kBlockDepth)
+  {
+    QuantizedDepthwiseConvDotprodBlock(num_output_pixels, input_ptr + c, tap1_offset, tap2_offset,
+                                       tap3_offset, input_ptr_increment,
+                                       filter_interleaved + c * kTaps,
+                                       output_depth * sizeof(int32_t), acc_buffer_ptr + c);
+  }
+
+  for (int out_x = 0; out_x < num_output_pixels; ++out_x)
+  {
+    int32_t *acc = acc_buffer_ptr + out_x * output_depth;
+    for (int c = 0; c < block_depth; ++c)
+    {
+      acc[c] += input_offset * filter_sums[c];
+    }
+    const int8_t *input = input_ptr + out_x * input_ptr_increment;
+    for (int c = block_depth; c < input_depth; ++c)
+    {
+      for (int t = 0; t < filter_width; ++t)
+      {
+        const int16_t input_val = input[t * tap_offset + c] + input_offset;
+        acc[c] += static_cast<int32_t>(filter_interleaved[c * kTaps + t]) * input_val;
+      }
+    }
+  }
+}
+#endif
+
 // Initializes the accumulator buffer with bias values.
 inline void DepthwiseConvInitAccBuffer(int num_output_pixels, int output_depth,
                                        const int32_t *bias_data, int32_t *acc_buffer)
@@ -1790,6 +1942,15 @@ inline void DepthwiseConvGeneral(const DepthwiseConvParams &params,
       QuantizedDepthwiseConvAccumRow<ALLOW_STRIDED, FIXED_INPUT_DEPTH, FIXED_DEPTH_MULTIPLIER>;   \
   }
 
+#if defined(USE_NEON) && defined(__aarch64__)
+  // SDOT takes a filter row at once, if the CPU running us has it
+  if (CachedCpuFlags().neon_dotprod && depth_multiplier == 1 && filter_width >= 2 &&
+      filter_width <= 4 && input_depth >= 16)
+  {
+    row_accum_func = QuantizedDepthwiseConvAccumRowDotprod;
+  }
+#endif
+
 #ifdef USE_NEON
   // We go over our list of kernels by decreasing order of preference
   // for the cases where multiple kernels could apply.
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_FULLY_CONNECTED_INT8_H__
+#define __NNFW_CKER_OPTIMIZED_FULLY_CONNECTED_INT8_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <ruy/context.h>
+
+#include <cassert>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized_integer_ops
+{
+
+/**
+ * @brief Fully connected layer of int8 with per-channel quantized weights as a GEMM on ruy
+ *
+ * [output depth x input depth] weights times [input depth x batches] input gives the output,
+ * requantized per output channel. Per-tensor weights take the same multiplier for all channels.
+ */
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int32_t *output_shift,
+                                     const Shape &input_shape, const int8_t *input_data,
+                                     const Shape &filter_shape, const int8_t *filter_data,
+                                     const Shape &bias_shape, const int32_t *bias_data,
+                                     const Shape &output_shape, int8_t *output_data,
+                                     ruy::Context *ruy_context)
+{
+  const int filter_dims_count = filter_shape.DimensionsCount();
+  const int output_depth = filter_shape.Dims(filter_dims_count - 2);
+  const int accum_depth = filter_shape.Dims(filter_dims_count - 1);
+  const int batches = input_shape.FlatSize() / accum_depth;
+  assert(output_shape.FlatSize() == batches * output_depth);
+  assert(bias_data == nullptr || bias_shape.FlatSize() == output_depth);
+  (void)output_shape;
+  (void)bias_shape;
+
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = accum_depth;
+  lhs_params.zero_point = static_cast<int8_t>(-params.weights_offset);
+  lhs_params.cache_policy =
+    params.lhs_cacheable ? CachePolicy::kCacheIfLargeSpeedup : CachePolicy::kNeverCache;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = batches;
+  rhs_params.zero_point = static_cast<int8_t>(-params.input_offset);
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = batches;
+  dst_params.zero_point = static_cast<int8_t>(params.output_offset);
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<int8_t>(params.quantized_activation_min);
+  gemm_params.clamp_max = static_cast<int8_t>(params.quantized_activation_max);
+
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs, params.lhs_cacheable);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+} // namespace optimized_integer_ops
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_FULLY_CONNECTED_INT8_H__
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/ArgMinMax.h>
+#include <cker/operation/optimized/ArgMinMax.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+template <typename T> std::vector<T> randomValues(int size, int range, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  // A small range of values makes a lot of ties, of which the first index must be found
+  std::uniform_int_distribution<int> dist(-range, range);
+  std::vector<T> values(size);
+  for (auto &v : values)
+    v = static_cast<T>(dist(gen));
+  return values;
+}
+
+template <typename T>
+void expectSameAsReference(const std::vector<T> &input, const Shape &input_shape,
+                           const Shape &output_shape, int axis)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  for (bool is_arg_max : {true, false})
+  {
+    std::vector<int32_t> expected(output_shape.FlatSize());
+    if (is_arg_max)
+      ArgMinMax(input_shape, input.data(), output_shape, expected.data(), axis, std::greater<T>());
+    else
+      ArgMinMax(input_shape, input.data(), output_shape, expected.data(), axis, std::less<T>());
+
+    for (auto *context : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+    {
+      std::vector<int32_t> actual(output_shape.FlatSize(), -1);
+      optimized::ArgMinMax(input_shape, input.data(), output_shape, actual.data(), axis,
+                           is_arg_max, context);
+      EXPECT_EQ(actual, expected);
+    }
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, ArgMinMaxLastAxis)
+{
+  // Rows of a vocabulary, and rows shorter than vectors
+  for (int row_size : {1, 7, 31, 1000, 32000})
+  {
+    const int rows = 5;
+    const Shape input_shape{rows, row_size};
+    const Shape output_shape{rows};
+    expectSameAsReference(randomValues<float>(rows * row_size, 100, row_size), input_shape,
+                          output_shape, 1);
+    expectSameAsReference(randomValues<uint8_t>(rows * row_size, 100, row_size), input_shape,
+                          output_shape, -1);
+    expectSameAsReference(randomValues<int8_t>(rows * row_size, 100, row_size), input_shape,
+                          output_shape, 1);
+    expectSameAsReference(randomValues<int32_t>(rows * row_size, 1000, row_size), input_shape,
+                          output_shape, 1);
+  }
+}
+
+TEST(CKer_Operation, ArgMinMaxInnerAxis)
+{
+  const Shape input_shape{3, 17, 4, 5};
+  const auto input = randomValues<float>(input_shape.FlatSize(), 10, 1);
+  expectSameAsReference(input, input_shape, Shape{17, 4, 5}, 0);
+  expectSameAsReference(input, input_shape, Shape{3, 4, 5}, 1);
+  expectSameAsReference(input, input_shape, Shape{3, 17, 5}, 2);
+  expectSameAsReference(input, input_shape, Shape{3, 17, 4}, 3);
+}
+
+TEST(CKer_Operation, ArgMinMaxNaN)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  auto input = randomValues<float>(4 * 64, 100, 3);
+  input[0] = nan;       // NaN at the 0th value is kept
+  input[64 + 10] = nan; // Other NaNs are skipped
+  input[128 + 63] = nan;
+  expectSameAsReference(input, Shape{4, 64}, Shape{4}, 1);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Attention.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(const Shape &shape, int seed)
+{
+  std::vector<float> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (static_cast<float>((i * 7 + seed) % 11) - 5.f) / 4.f;
+  return data;
+}
+
+// softmax(Q x K^T x scale + mask) x V with the whole scores, with a mask of the shape of scores
+std::vector<float> reference(float scale, int batches, int query_len, int key_len, int depth,
+                             int value_depth, const std::vector<float> &query,
+                             const std::vector<float> &key, const std::vector<float> &value,
+                             const std::vector<float> &mask)
+{
+  std::vector<float> output(batches * query_len * value_depth);
+  std::vector<float> scores(key_len);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int i = 0; i < query_len; ++i)
+    {
+      for (int j = 0; j < key_len; ++j)
+      {
+        float sum = 0.f;
+        for (int k = 0; k < depth; ++k)
+          sum += query[(b * query_len + i) * depth + k] * key[(b * key_len + j) * depth + k];
+        scores[j] = sum * scale;
+        if (!mask.empty())
+          scores[j] += mask[(b * query_len + i) * key_len + j];
+      }
+      const float max = *std::max_element(scores.begin(), scores.end());
+      float sum = 0.f;
+      for (auto &score : scores)
+      {
+        score = std::exp(score - max);
+        sum += score;
+      }
+      for (int k = 0; k < value_depth; ++k)
+      {
+        float out = 0.f;
+        for (int j = 0; j < key_len; ++j)
+          out += scores[j] * value[(b * key_len + j) * value_depth + k];
+        output[(b * query_len + i) * value_depth + k] = out / sum;
+      }
+    }
+  }
+  return output;
+}
+
+void compareWithReference(int heads, int query_len, int key_len, int depth, int value_depth,
+                          bool causal, int threads)
+{
+  const Shape query_shape{1, heads, query_len, depth};
+  const Shape key_shape{1, heads, key_len, depth};
+  const Shape value_shape{1, heads, key_len, value_depth};
+  const Shape output_shape{1, heads, query_len, value_depth};
+  const auto query = makeData(query_shape, 1);
+  const auto key = makeData(key_shape, 2);
+  const auto value = makeData(value_shape, 3);
+
+  // Causal mask is shared by all heads, which the reference takes expanded
+  const Shape mask_shape{1, 1, query_len, key_len};
+  std::vector<float> mask;
+  std::vector<float> expanded_mask;
+  if (causal)
+  {
+    for (int i = 0; i < query_len; ++i)
+      for (int j = 0; j < key_len; ++j)
+        mask.push_back(j <= i ? 0.f : -1e9f);
+    for (int h = 0; h < heads; ++h)
+      expanded_mask.insert(expanded_mask.end(), mask.begin(), mask.end());
+  }
+
+  const float scale = 1.f / std::sqrt(static_cast<float>(depth));
+  const auto expected = reference(scale, heads, query_len, key_len, depth, value_depth, query, key,
+                                  value, expanded_mask);
+
+  std::vector<float> actual(output_shape.FlatSize());
+  nnfw::cker::AttentionParams params;
+  params.scale = scale;
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  nnfw::cker::Attention(params, query_shape, query.data(), key_shape, key.data(), value_shape,
+                        value.data(), mask_shape, causal ? mask.data() : nullptr, output_shape,
+                        actual.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-5f);
+}
+
+} // namespace
+
+TEST(CKer_Operation, Attention)
+{
+  // Sequences shorter than a tile
+  compareWithReference(2, 5, 7, 8, 8, false, 1);
+  compareWithReference(2, 5, 5, 8, 4, true, 1);
+
+  // Sequences over several tiles of query and key rows, split among threads
+  compareWithReference(4, 100, 150, 16, 16, false, 4);
+  compareWithReference(4, 130, 130, 16, 24, true, 4);
+}
+
+TEST(CKer_Operation, AttentionMaskedOut)
+{
+  const Shape shape{1, 2, 2};
+  const std::vector<float> query = {1.f, 0.f, 0.f, 1.f};
+  const std::vector<float> key = {1.f, 0.f, 0.f, 1.f};
+  const std::vector<float> value = {1.f, 2.f, 3.f, 4.f};
+  // The first row attends to the second key only, and the second row to no key
+  const Shape mask_shape{2, 2};
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> mask = {-inf, 0.f, -inf, -inf};
+  std::vector<float> output(4);
+
+  nnfw::cker::AttentionParams params;
+  params.scale = 1.f;
+  ruy::Context ruy_context;
+  nnfw::cker::Attention(params, shape, query.data(), shape, key.data(), shape, value.data(),
+                        mask_shape, mask.data(), shape, output.data(), &ruy_context);
+
+  const std::vector<float> expected = {3.f, 4.f, 0.f, 0.f};
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_FLOAT_EQ(output[i], expected[i]);
+}
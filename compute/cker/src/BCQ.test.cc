@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BCQ.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+
+// Weights of 2 clusters, 3 rows of 1 bit and 2 rows of 2 bits, over 37 hidden elements
+struct BCQWeights
+{
+  static constexpr int kHidden = 37;
+  static constexpr int kWords = 2;
+
+  BCQWeights()
+  {
+    int code_row = 0;
+    for (int c = 0; c < 2; ++c)
+    {
+      for (int r = 0; r < clusters[c * 2 + 1]; ++r)
+      {
+        std::vector<float> row(kHidden, 0.f);
+        for (int k = 0; k < clusters[c * 2]; ++k, ++code_row)
+        {
+          const float alpha = 0.5f + 0.25f * code_row;
+          scales.push_back(alpha);
+          for (int w = 0; w < kWords; ++w)
+            binary.push_back(static_cast<int32_t>(0x9e3779b9u * (code_row * kWords + w + 1)));
+          for (int h = 0; h < kHidden; ++h)
+          {
+            const auto word = static_cast<uint32_t>(binary[code_row * kWords + h / 32]);
+            const bool bit = (word >> (h % 32)) & 1;
+            row[h] += bit ? alpha : -alpha;
+          }
+        }
+        dequantized.push_back(row);
+      }
+    }
+  }
+
+  int rows() const { return static_cast<int>(dequantized.size()); }
+
+  std::vector<int32_t> clusters = {1, 3, 2, 2};
+  std::vector<float> scales;
+  std::vector<int32_t> binary;
+  std::vector<std::vector<float>> dequantized;
+};
+
+} // namespace
+
+TEST(CKer_Operation, BCQFullyConnected)
+{
+  BCQWeights weights;
+  const int batch = 2;
+  const int hidden = BCQWeights::kHidden;
+
+  std::vector<float> input(hidden * batch);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 7) - 3.f;
+  const std::vector<float> bias = {1.f, -2.f, 0.5f, 0.f, 3.f};
+
+  const nnfw::cker::Shape input_shape{hidden, batch};
+  const nnfw::cker::Shape binary_shape{static_cast<int>(weights.scales.size()),
+                                       BCQWeights::kWords};
+  const nnfw::cker::Shape clusters_shape{2, 2};
+  const nnfw::cker::Shape output_shape{weights.rows(), batch};
+  std::vector<float> output(output_shape.FlatSize());
+  std::vector<float> lookup_tables;
+
+  nnfw::cker::FullyConnectedParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
+  nnfw::cker::BCQFullyConnected(params, input_shape, input.data(), weights.scales.data(),
+                                binary_shape, weights.binary.data(), clusters_shape,
+                                weights.clusters.data(), bias.data(), output_shape, output.data(),
+                                lookup_tables);
+
+  for (int r = 0; r < weights.rows(); ++r)
+  {
+    for (int b = 0; b < batch; ++b)
+    {
+      float expected = bias[r];
+      for (int h = 0; h < hidden; ++h)
+        expected += weights.dequantized[r][h] * input[h * batch + b];
+      EXPECT_NEAR(expected, output[r * batch + b], 1e-4f);
+    }
+  }
+
+  // ReLU is applied after bias
+  params.activation = nnfw::cker::FusedActivationFunctionType::kRelu;
+  nnfw::cker::BCQFullyConnected(params, input_shape, input.data(), weights.scales.data(),
+                                binary_shape, weights.binary.data(), clusters_shape,
+                                weights.clusters.data(), bias.data(), output_shape, output.data(),
+                                lookup_tables);
+  for (auto value : output)
+    EXPECT_GE(value, 0.f);
+}
+
+TEST(CKer_Operation, BCQGather)
+{
+  BCQWeights weights;
+  const int hidden = BCQWeights::kHidden;
+  const nnfw::cker::Shape binary_shape{static_cast<int>(weights.scales.size()),
+                                       BCQWeights::kWords};
+  const nnfw::cker::Shape clusters_shape{2, 2};
+
+  // Rows along axis 0
+  {
+    const std::vector<int32_t> indices = {4, 0, 3};
+    const nnfw::cker::Shape indices_shape{3};
+    const nnfw::cker::Shape output_shape{3, hidden};
+    std::vector<float> output(output_shape.FlatSize());
+
+    nnfw::cker::BCQGather(weights.scales.data(), binary_shape, weights.binary.data(),
+                          clusters_shape, weights.clusters.data(), hidden, 0, indices_shape,
+                          indices.data(), output_shape, output.data());
+
+    for (size_t i = 0; i < indices.size(); ++i)
+      for (int h = 0; h < hidden; ++h)
+        EXPECT_FLOAT_EQ(weights.dequantized[indices[i]][h], output[i * hidden + h]);
+  }
+
+  // Columns along axis 1
+  {
+    const std::vector<int64_t> indices = {36, 1};
+    const nnfw::cker::Shape indices_shape{2};
+    const nnfw::cker::Shape output_shape{weights.rows(), 2};
+    std::vector<float> output(output_shape.FlatSize());
+
+    nnfw::cker::BCQGather(weights.scales.data(), binary_shape, weights.binary.data(),
+                          clusters_shape, weights.clusters.data(), hidden, 1, indices_shape,
+                          indices.data(), output_shape, output.data());
+
+    for (int r = 0; r < weights.rows(); ++r)
+      for (size_t i = 0; i < indices.size(); ++i)
+        EXPECT_FLOAT_EQ(weights.dequantized[r][indices[i]], output[r * 2 + i]);
+  }
+}
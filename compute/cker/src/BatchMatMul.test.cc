@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BatchMatMul.h>
+#include <cker/operation/optimized/BatchMatMul.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(const Shape &shape)
+{
+  std::vector<float> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<float>((i * 7) % 11) - 5.f;
+  return data;
+}
+
+void compareWithReference(const Shape &lhs_shape, const Shape &rhs_shape, bool adj_x, bool adj_y,
+                          const Shape &output_shape, int threads)
+{
+  const auto lhs = makeData(lhs_shape);
+  const auto rhs = makeData(rhs_shape);
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> actual(output_shape.FlatSize());
+
+  nnfw::cker::BatchMatMul reference;
+  reference.prepare(lhs_shape, rhs_shape, adj_x, adj_y);
+  reference(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+            expected.data());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  nnfw::cker::optimized::BatchMatMul(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y,
+                                     output_shape, actual.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_FLOAT_EQ(actual[i], expected[i]);
+}
+
+} // namespace
+
+TEST(CKer_Operation, BatchMatMul)
+{
+  // Attention-like batches, which are split among threads
+  compareWithReference({2, 8, 16, 32}, {2, 8, 32, 16}, false, false, {2, 8, 16, 16}, 4);
+  compareWithReference({2, 8, 32, 16}, {2, 8, 32, 16}, true, false, {2, 8, 16, 16}, 4);
+  compareWithReference({2, 8, 16, 32}, {2, 8, 16, 32}, false, true, {2, 8, 16, 16}, 4);
+  compareWithReference({2, 8, 32, 16}, {2, 8, 16, 32}, true, true, {2, 8, 16, 16}, 4);
+
+  // Batch dimensions are broadcast
+  compareWithReference({3, 1, 4, 5}, {1, 2, 5, 6}, false, false, {3, 2, 4, 6}, 1);
+  compareWithReference({4, 5}, {3, 5, 6}, false, false, {3, 4, 6}, 2);
+  compareWithReference({2, 3, 5, 4}, {5, 6}, true, false, {2, 3, 4, 6}, 2);
+}
+
+TEST(CKer_Operation, BatchMatMulInt8)
+{
+  // [[1, 2], [3, 4]] x [[5, 6], [7, 8]] for two batches, the second of which is negated
+  const std::vector<int8_t> lhs = {1, 2, 3, 4, -1, -2, -3, -4};
+  // rhs is given transposed with a zero point of 1
+  const std::vector<int8_t> rhs = {6, 8, 7, 9};
+  std::vector<int8_t> output(8);
+
+  nnfw::cker::BatchMatMulParams params;
+  params.lhs_zero_point = 0;
+  params.rhs_zero_point = 1;
+  params.output_zero_point = 10;
+  // Multiplier of 1.0, 0.5 in Q31 shifted left by 1
+  params.output_multiplier = 1 << 30;
+  params.output_shift = 1;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  ruy::Context ruy_context;
+  nnfw::cker::optimized::BatchMatMul(params, {2, 2, 2}, lhs.data(), {2, 2}, rhs.data(), false,
+                                     true, {2, 2, 2}, output.data(), &ruy_context);
+
+  const std::vector<int8_t> expected = {29, 32, 53, 60, -9, -12, -33, -40};
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(output[i], expected[i]);
+}
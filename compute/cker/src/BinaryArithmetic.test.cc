@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Elementwise.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::BinaryArithmeticOpParam;
+using nnfw::cker::BinaryArithmeticOpType;
+using nnfw::cker::Shape;
+
+template <typename T> std::vector<T> makeData(const Shape &shape, int seed)
+{
+  std::vector<T> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<T>((i * 7 + seed) % 13);
+  return data;
+}
+
+// Runs the op on a single thread and on four, which must give the same output
+template <BinaryArithmeticOpType op_type, typename T>
+void compareWithSingleThread(BinaryArithmeticOpParam params, const Shape &lhs_shape,
+                             const Shape &rhs_shape, const Shape &output_shape)
+{
+  const auto lhs = makeData<T>(lhs_shape, 1);
+  const auto rhs = makeData<T>(rhs_shape, 2);
+  std::vector<T> expected(output_shape.FlatSize());
+  std::vector<T> actual(output_shape.FlatSize());
+
+  const bool broadcast = nnfw::cker::ProcessBroadcastShapes(lhs_shape, rhs_shape, &params);
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  if (broadcast)
+  {
+    nnfw::cker::BroadcastBinaryArithmeticOp<op_type>(params, lhs_shape, lhs.data(), rhs_shape,
+                                                     rhs.data(), output_shape, expected.data());
+    nnfw::cker::BroadcastBinaryArithmeticOp<op_type>(params, lhs_shape, lhs.data(), rhs_shape,
+                                                     rhs.data(), output_shape, actual.data(),
+                                                     &ruy_context);
+  }
+  else
+  {
+    nnfw::cker::BinaryArithmeticOp<op_type>(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(),
+                                            output_shape, expected.data());
+    nnfw::cker::BinaryArithmeticOp<op_type>(params, lhs_shape, lhs.data(), rhs_shape, rhs.data(),
+                                            output_shape, actual.data(), &ruy_context);
+  }
+  ASSERT_EQ(actual, expected);
+}
+
+BinaryArithmeticOpParam floatParams()
+{
+  BinaryArithmeticOpParam params;
+  params.float_activation_min = -100.f;
+  params.float_activation_max = 100.f;
+  return params;
+}
+
+} // namespace
+
+TEST(CKer_Operation, BinaryArithmeticParallel)
+{
+  const auto params = floatParams();
+  compareWithSingleThread<BinaryArithmeticOpType::ADD, float>(params, Shape{1, 64, 64, 32},
+                                                              Shape{1, 64, 64, 32},
+                                                              Shape{1, 64, 64, 32});
+  compareWithSingleThread<BinaryArithmeticOpType::DIV, float>(params, Shape{4, 128, 64},
+                                                              Shape{4, 128, 64}, Shape{4, 128, 64});
+  // Too small to split
+  compareWithSingleThread<BinaryArithmeticOpType::SUB, float>(params, Shape{3, 5}, Shape{3, 5},
+                                                              Shape{3, 5});
+}
+
+TEST(CKer_Operation, BroadcastBinaryArithmeticParallel)
+{
+  const auto params = floatParams();
+  compareWithSingleThread<BinaryArithmeticOpType::ADD, float>(
+    params, Shape{1, 64, 64, 32}, Shape{32}, Shape{1, 64, 64, 32});
+  compareWithSingleThread<BinaryArithmeticOpType::MUL, float>(
+    params, Shape{2, 1, 256, 8}, Shape{2, 64, 1, 8}, Shape{2, 64, 256, 8});
+  compareWithSingleThread<BinaryArithmeticOpType::SUB, float>(params, Shape{64, 1}, Shape{1, 512},
+                                                              Shape{64, 512});
+
+  // Quantized add with a scale of 1/2 for both inputs
+  BinaryArithmeticOpParam quant_params;
+  quant_params.left_shift = 20;
+  quant_params.input1_offset = -3;
+  quant_params.input2_offset = -5;
+  quant_params.output_offset = 1;
+  quant_params.input1_multiplier = 1 << 30;
+  quant_params.input1_shift = 0;
+  quant_params.input2_multiplier = 1 << 30;
+  quant_params.input2_shift = 0;
+  quant_params.output_multiplier = 1 << 30;
+  quant_params.output_shift = -18;
+  quant_params.quantized_activation_min = 0;
+  quant_params.quantized_activation_max = 255;
+  compareWithSingleThread<BinaryArithmeticOpType::ADD, uint8_t>(
+    quant_params, Shape{1, 64, 64, 32}, Shape{1, 64, 64, 32}, Shape{1, 64, 64, 32});
+  compareWithSingleThread<BinaryArithmeticOpType::ADD, uint8_t>(
+    quant_params, Shape{1, 64, 64, 32}, Shape{1, 1, 64, 32}, Shape{1, 64, 64, 32});
+}
+
+TEST(CKer_Operation, ElementwiseParallel)
+{
+  const Shape shape{8, 128, 64};
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 97) / 8.f + 0.5f;
+  std::vector<float> output(shape.FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  nnfw::cker::Sqrt(shape, input.data(), shape, output.data(), &ruy_context);
+  for (size_t i = 0; i < input.size(); ++i)
+    ASSERT_FLOAT_EQ(output[i], std::sqrt(input[i]));
+
+  nnfw::cker::Neg(shape, input.data(), shape, output.data(), &ruy_context);
+  for (size_t i = 0; i < input.size(); ++i)
+    ASSERT_EQ(output[i], -input[i]);
+}
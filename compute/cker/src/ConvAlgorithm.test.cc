@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Conv.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::ConvAlgorithm;
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(const Shape &shape, int seed)
+{
+  std::vector<float> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (static_cast<float>((i * 13 + seed) % 17) - 8.f) / 8.f;
+  return data;
+}
+
+struct ConvCase
+{
+  Shape input_shape;
+  Shape filter_shape;
+  Shape output_shape;
+  nnfw::cker::ConvParams params;
+};
+
+// SAME convolution of a 3x3 filter, which every kernel supports
+ConvCase makeCase()
+{
+  ConvCase c{Shape{1, 8, 8, 16}, Shape{16, 3, 3, 16}, Shape{1, 8, 8, 16}, {}};
+  c.params.padding_type = nnfw::cker::PaddingType::kSame;
+  c.params.padding_values.width = 1;
+  c.params.padding_values.height = 1;
+  c.params.stride_width = 1;
+  c.params.stride_height = 1;
+  c.params.dilation_width_factor = 1;
+  c.params.dilation_height_factor = 1;
+  c.params.float_activation_min = -4.f;
+  c.params.float_activation_max = 4.f;
+  return c;
+}
+
+std::vector<float> runConv(const ConvCase &c, ConvAlgorithm algorithm)
+{
+  const auto input = makeData(c.input_shape, 1);
+  const auto filter = makeData(c.filter_shape, 2);
+  const Shape bias_shape{c.output_shape.Dims(3)};
+  const auto bias = makeData(bias_shape, 3);
+
+  nnfw::cker::Conv conv;
+  conv.setAlgorithm(algorithm);
+  if (algorithm == ConvAlgorithm::kWinograd)
+  {
+    conv.prepareWinograd(c.filter_shape, filter.data());
+  }
+  else
+  {
+    bool is_transposed = false;
+    conv.prepare(c.filter_shape, filter.data(), c.params.padding_type, is_transposed, 1, 1);
+  }
+
+  ruy::Context ruy_context;
+  std::vector<float> output(c.output_shape.FlatSize());
+  conv(c.params, c.input_shape, input.data(), c.filter_shape, filter.data(), bias_shape,
+       bias.data(), c.output_shape, output.data(), &ruy_context);
+  return output;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ConvAlgorithm)
+{
+  const auto c = makeCase();
+  const auto expected = runConv(c, ConvAlgorithm::kReference);
+
+  nnfw::cker::Conv conv;
+  const auto algorithms =
+    conv.usableAlgorithms(c.filter_shape, c.params.padding_type, 1, 1, 1, 1);
+  ASSERT_EQ(algorithms.size(), 3u);
+  for (const auto algorithm : algorithms)
+  {
+    const auto output = runConv(c, algorithm);
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_NEAR(output[i], expected[i], 1e-4f)
+        << "at " << i << " of algorithm " << static_cast<int>(algorithm);
+  }
+}
+
+TEST(CKer_Operation, neg_ConvAlgorithm_unusable)
+{
+  nnfw::cker::Conv conv;
+
+  // Winograd is only for 3x3 filters of stride 1, and Eigen does not dilate
+  auto algorithms =
+    conv.usableAlgorithms(Shape{16, 5, 5, 16}, nnfw::cker::PaddingType::kSame, 1, 1, 2, 2);
+  ASSERT_EQ(algorithms, std::vector<ConvAlgorithm>{ConvAlgorithm::kDirect});
+}
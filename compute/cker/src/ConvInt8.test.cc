@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/optimized/integer_ops/ConvInt8.h>
+#include <cker/operation/optimized/integer_ops/FullyConnectedInt8.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<int8_t> makeData(int size, int seed)
+{
+  std::vector<int8_t> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<int8_t>((i * 37 + seed * 11) % 255 - 127);
+  return data;
+}
+
+int8_t requantize(int64_t acc, int32_t multiplier, int shift, int32_t output_offset)
+{
+  const double value =
+    std::round(acc * (static_cast<double>(multiplier) / (1ll << 31)) * std::ldexp(1.0, shift));
+  return static_cast<int8_t>(std::min(127.0, std::max(-128.0, value + output_offset)));
+}
+
+// Per-channel multipliers of scales about 1 / 2^10
+void makeMultipliers(int channels, std::vector<int32_t> &multipliers, std::vector<int32_t> &shifts)
+{
+  for (int c = 0; c < channels; ++c)
+  {
+    multipliers.emplace_back(1073741824 + c * 12345678);
+    shifts.emplace_back(-9 - c % 3);
+  }
+}
+
+void expectNear(const std::vector<int8_t> &expected, const std::vector<int8_t> &actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  // Fixed-point requantization of ruy can round differently by one
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_LE(std::abs(expected[i] - actual[i]), 1) << "at " << i;
+}
+
+std::vector<int8_t> referenceConv(const nnfw::cker::ConvParams &params,
+                                  const std::vector<int32_t> &multipliers,
+                                  const std::vector<int32_t> &shifts, const Shape &input_shape,
+                                  const std::vector<int8_t> &input, const Shape &filter_shape,
+                                  const std::vector<int8_t> &filter,
+                                  const std::vector<int32_t> &bias, const Shape &output_shape)
+{
+  std::vector<int8_t> output(output_shape.FlatSize());
+  const int input_depth = input_shape.Dims(3);
+  for (int b = 0; b < output_shape.Dims(0); ++b)
+    for (int y = 0; y < output_shape.Dims(1); ++y)
+      for (int x = 0; x < output_shape.Dims(2); ++x)
+        for (int oc = 0; oc < output_shape.Dims(3); ++oc)
+        {
+          int64_t acc = bias[oc];
+          for (int fy = 0; fy < filter_shape.Dims(1); ++fy)
+            for (int fx = 0; fx < filter_shape.Dims(2); ++fx)
+            {
+              const int in_y = y * params.stride_height - params.padding_values.height +
+                               fy * params.dilation_height_factor;
+              const int in_x = x * params.stride_width - params.padding_values.width +
+                               fx * params.dilation_width_factor;
+              if (in_y < 0 || in_y >= input_shape.Dims(1) || in_x < 0 ||
+                  in_x >= input_shape.Dims(2))
+                continue;
+              for (int ic = 0; ic < input_depth; ++ic)
+                acc += (input[Offset(input_shape, b, in_y, in_x, ic)] + params.input_offset) *
+                       filter[Offset(filter_shape, oc, fy, fx, ic)];
+            }
+          output[Offset(output_shape, b, y, x, oc)] =
+            requantize(acc, multipliers[oc], shifts[oc], params.output_offset);
+        }
+  return output;
+}
+
+nnfw::cker::ConvParams makeConvParams(int stride, int padding)
+{
+  nnfw::cker::ConvParams params{};
+  params.stride_width = stride;
+  params.stride_height = stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = padding;
+  params.padding_values.height = padding;
+  params.input_offset = 5;
+  params.output_offset = -3;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+  params.lhs_cacheable = true;
+  return params;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ConvInt8PerChannel)
+{
+  ruy::Context ruy_context;
+  const Shape input_shape{2, 7, 6, 5};
+  const Shape filter_shape{4, 3, 3, 5};
+  const Shape output_shape{2, 4, 3, 4};
+  const auto params = makeConvParams(2, 1);
+
+  const auto input = makeData(input_shape.FlatSize(), 1);
+  const auto filter = makeData(filter_shape.FlatSize(), 2);
+  const std::vector<int32_t> bias{100, -200, 300, 0};
+  std::vector<int32_t> multipliers, shifts;
+  makeMultipliers(4, multipliers, shifts);
+
+  std::vector<int8_t> output(output_shape.FlatSize());
+  std::vector<int8_t> im2col;
+  nnfw::cker::optimized_integer_ops::ConvPerChannel(
+    params, multipliers.data(), shifts.data(), input_shape, input.data(), filter_shape,
+    filter.data(), Shape{4}, bias.data(), output_shape, output.data(), im2col, &ruy_context);
+  EXPECT_EQ(im2col.size(), 3 * 3 * 5 * 2 * 4 * 3);
+
+  expectNear(referenceConv(params, multipliers, shifts, input_shape, input, filter_shape, filter,
+                           bias, output_shape),
+             output);
+}
+
+TEST(CKer_Operation, ConvInt8Pointwise)
+{
+  ruy::Context ruy_context;
+  const Shape input_shape{1, 3, 4, 8};
+  const Shape filter_shape{6, 1, 1, 8};
+  const Shape output_shape{1, 3, 4, 6};
+  const auto params = makeConvParams(1, 0);
+
+  const auto input = makeData(input_shape.FlatSize(), 3);
+  const auto filter = makeData(filter_shape.FlatSize(), 4);
+  const std::vector<int32_t> bias{1, 2, 3, 4, 5, 6};
+  std::vector<int32_t> multipliers, shifts;
+  makeMultipliers(6, multipliers, shifts);
+
+  std::vector<int8_t> output(output_shape.FlatSize());
+  std::vector<int8_t> im2col;
+  nnfw::cker::optimized_integer_ops::ConvPerChannel(
+    params, multipliers.data(), shifts.data(), input_shape, input.data(), filter_shape,
+    filter.data(), Shape{6}, bias.data(), output_shape, output.data(), im2col, &ruy_context);
+  // Input is multiplied as it is
+  EXPECT_TRUE(im2col.empty());
+
+  expectNear(referenceConv(params, multipliers, shifts, input_shape, input, filter_shape, filter,
+                           bias, output_shape),
+             output);
+}
+
+TEST(CKer_Operation, FullyConnectedInt8PerChannel)
+{
+  ruy::Context ruy_context;
+  const Shape input_shape{3, 20};
+  const Shape filter_shape{5, 20};
+  const Shape output_shape{3, 5};
+
+  nnfw::cker::FullyConnectedParams params{};
+  params.input_offset = -7;
+  params.weights_offset = 0;
+  params.output_offset = 10;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 127;
+
+  const auto input = makeData(input_shape.FlatSize(), 5);
+  const auto filter = makeData(filter_shape.FlatSize(), 6);
+  std::vector<int32_t> multipliers, shifts;
+  makeMultipliers(5, multipliers, shifts);
+
+  std::vector<int8_t> expected(output_shape.FlatSize());
+  for (int b = 0; b < 3; ++b)
+    for (int o = 0; o < 5; ++o)
+    {
+      int64_t acc = 0;
+      for (int i = 0; i < 20; ++i)
+        acc += (input[b * 20 + i] + params.input_offset) * filter[o * 20 + i];
+      expected[b * 5 + o] =
+        std::max<int8_t>(0, requantize(acc, multipliers[o], shifts[o], params.output_offset));
+    }
+
+  std::vector<int8_t> output(output_shape.FlatSize());
+  nnfw::cker::optimized_integer_ops::FullyConnectedPerChannel(
+    params, multipliers.data(), shifts.data(), input_shape, input.data(), filter_shape,
+    filter.data(), Shape{}, nullptr, output_shape, output.data(), &ruy_context);
+  expectNear(expected, output);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/DepthwiseConv.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+nnfw::cker::DepthwiseConvParams makeParams(int stride, int pad)
+{
+  nnfw::cker::DepthwiseConvParams params;
+  params.padding_type = nnfw::cker::PaddingType::kSame;
+  params.padding_values.width = pad;
+  params.padding_values.height = pad;
+  params.stride_width = stride;
+  params.stride_height = stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.depth_multiplier = 1;
+  params.float_activation_min = -100.f;
+  params.float_activation_max = 100.f;
+  return params;
+}
+
+// 3x3 depthwise convolution of the given stride with padding of 1 on the top and the left
+std::vector<float> reference(const Shape &input_shape, const std::vector<float> &input,
+                             const std::vector<float> &filter, const std::vector<float> &bias,
+                             const Shape &output_shape, int stride)
+{
+  const int batches = input_shape.Dims(0);
+  const int in_h = input_shape.Dims(1), in_w = input_shape.Dims(2), depth = input_shape.Dims(3);
+  const int out_h = output_shape.Dims(1), out_w = output_shape.Dims(2);
+  std::vector<float> output(output_shape.FlatSize());
+  for (int b = 0; b < batches; ++b)
+    for (int oy = 0; oy < out_h; ++oy)
+      for (int ox = 0; ox < out_w; ++ox)
+        for (int c = 0; c < depth; ++c)
+        {
+          float sum = bias[c];
+          for (int fy = 0; fy < 3; ++fy)
+            for (int fx = 0; fx < 3; ++fx)
+            {
+              const int iy = oy * stride - 1 + fy, ix = ox * stride - 1 + fx;
+              if (iy < 0 || iy >= in_h || ix < 0 || ix >= in_w)
+                continue;
+              sum += input[((b * in_h + iy) * in_w + ix) * depth + c] *
+                     filter[(fy * 3 + fx) * depth + c];
+            }
+          output[((b * out_h + oy) * out_w + ox) * depth + c] = sum;
+        }
+  return output;
+}
+
+void compareFloat(int batches, int size, int depth, int stride, int threads)
+{
+  const Shape input_shape{batches, size, size, depth};
+  const Shape filter_shape{1, 3, 3, depth};
+  const Shape bias_shape{depth};
+  const int out_size = (size + stride - 1) / stride;
+  const Shape output_shape{batches, out_size, out_size, depth};
+
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 13) / 4.f - 1.5f;
+  std::vector<float> filter(filter_shape.FlatSize());
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter[i] = static_cast<float>(i % 7) / 8.f - 0.4f;
+  std::vector<float> bias(depth);
+  for (int c = 0; c < depth; ++c)
+    bias[c] = static_cast<float>(c % 3);
+
+  const auto expected = reference(input_shape, input, filter, bias, output_shape, stride);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::DepthwiseConv<float, float>(makeParams(stride, 1), input_shape, input.data(),
+                                          filter_shape, filter.data(), bias_shape, bias.data(),
+                                          output_shape, output.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-4f);
+}
+
+} // namespace
+
+TEST(CKer_Operation, DepthwiseConv)
+{
+  compareFloat(1, 8, 8, 1, 1);
+  compareFloat(2, 9, 16, 2, 1);
+
+  // Rows of a large layer split among the threads, and fewer rows than the threads
+  compareFloat(1, 56, 64, 1, 4);
+  compareFloat(1, 3, 1024, 1, 8);
+  // Batches split among the threads
+  compareFloat(8, 28, 32, 2, 4);
+}
+
+TEST(CKer_Operation, DepthwiseConvUint8)
+{
+  const Shape input_shape{1, 40, 40, 32};
+  const Shape filter_shape{1, 3, 3, 32};
+  const Shape bias_shape{32};
+  const Shape output_shape{1, 40, 40, 32};
+
+  std::vector<uint8_t> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>(i * 7 % 251);
+  std::vector<uint8_t> filter(filter_shape.FlatSize());
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter[i] = static_cast<uint8_t>(i * 5 % 253);
+  std::vector<int32_t> bias(32, 100);
+
+  auto params = makeParams(1, 1);
+  params.input_offset = -128;
+  params.weights_offset = -128;
+  params.output_offset = 128;
+  params.output_multiplier = 1 << 30;
+  params.output_shift = -8;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 255;
+
+  // Threads give the same output as a single thread
+  std::vector<uint8_t> expected(output_shape.FlatSize());
+  nnfw::cker::DepthwiseConv<uint8_t, int32_t>(params, input_shape, input.data(), filter_shape,
+                                              filter.data(), bias_shape, bias.data(), output_shape,
+                                              expected.data(), nullptr);
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  std::vector<uint8_t> output(output_shape.FlatSize());
+  nnfw::cker::DepthwiseConv<uint8_t, int32_t>(params, input_shape, input.data(), filter_shape,
+                                              filter.data(), bias_shape, bias.data(), output_shape,
+                                              output.data(), &ruy_context);
+  ASSERT_EQ(output, expected);
+}
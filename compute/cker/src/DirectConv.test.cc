@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/optimized/DirectConv.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(const Shape &shape, int seed)
+{
+  std::vector<float> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (static_cast<float>((i * 13 + seed) % 17) - 8.f) / 8.f;
+  return data;
+}
+
+struct ConvCase
+{
+  int batches, height, width, input_depth, output_depth;
+  int filter_height, filter_width, stride, dilation, padding;
+  bool with_bias;
+  int threads;
+};
+
+void compareWithReference(const ConvCase &c)
+{
+  const int effective_filter_height = (c.filter_height - 1) * c.dilation + 1;
+  const int effective_filter_width = (c.filter_width - 1) * c.dilation + 1;
+  const int output_height = (c.height + 2 * c.padding - effective_filter_height) / c.stride + 1;
+  const int output_width = (c.width + 2 * c.padding - effective_filter_width) / c.stride + 1;
+  const Shape input_shape{c.batches, c.height, c.width, c.input_depth};
+  const Shape filter_shape{c.output_depth, c.filter_height, c.filter_width, c.input_depth};
+  const Shape output_shape{c.batches, output_height, output_width, c.output_depth};
+  const auto input = makeData(input_shape, 1);
+  const auto filter = makeData(filter_shape, 2);
+  const auto bias = makeData(Shape{c.output_depth}, 3);
+
+  nnfw::cker::ConvParams params{};
+  params.stride_height = c.stride;
+  params.stride_width = c.stride;
+  params.dilation_height_factor = c.dilation;
+  params.dilation_width_factor = c.dilation;
+  params.padding_values.height = c.padding;
+  params.padding_values.width = c.padding;
+  params.float_activation_min = -2.f;
+  params.float_activation_max = 2.f;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  for (int b = 0; b < c.batches; ++b)
+    for (int y = 0; y < output_height; ++y)
+      for (int x = 0; x < output_width; ++x)
+        for (int o = 0; o < c.output_depth; ++o)
+        {
+          float sum = c.with_bias ? bias[o] : 0.f;
+          for (int fy = 0; fy < c.filter_height; ++fy)
+            for (int fx = 0; fx < c.filter_width; ++fx)
+            {
+              const int in_y = y * c.stride - c.padding + fy * c.dilation;
+              const int in_x = x * c.stride - c.padding + fx * c.dilation;
+              if (in_y < 0 || in_y >= c.height || in_x < 0 || in_x >= c.width)
+                continue;
+              const float *in = &input[((b * c.height + in_y) * c.width + in_x) * c.input_depth];
+              const float *f = &filter[((o * c.filter_height + fy) * c.filter_width + fx) *
+                                       c.input_depth];
+              for (int i = 0; i < c.input_depth; ++i)
+                sum += in[i] * f[i];
+            }
+          expected[((b * output_height + y) * output_width + x) * c.output_depth + o] =
+            std::min(std::max(sum, -2.f), 2.f);
+        }
+
+  // The kernel takes the filter as [H * W * I, O]
+  const int filter_rows = c.filter_height * c.filter_width * c.input_depth;
+  std::vector<float> hwio_filter(filter.size());
+  for (int o = 0; o < c.output_depth; ++o)
+    for (int r = 0; r < filter_rows; ++r)
+      hwio_filter[r * c.output_depth + o] = filter[o * filter_rows + r];
+
+  std::vector<float> actual(output_shape.FlatSize());
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(c.threads);
+  nnfw::cker::optimized::DirectConv(params, input_shape, input.data(), filter_shape,
+                                    hwio_filter.data(), Shape{c.output_depth},
+                                    c.with_bias ? bias.data() : nullptr, output_shape,
+                                    actual.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-4f);
+}
+
+} // namespace
+
+TEST(CKer_Operation, DirectConv)
+{
+  // RGB input with a strided 7x7 filter and 3x3 ones, with output channels over vector lanes
+  compareWithReference({1, 23, 21, 3, 16, 7, 7, 2, 1, 3, true, 1});
+  compareWithReference({2, 9, 10, 3, 6, 3, 3, 1, 1, 1, false, 1});
+  compareWithReference({1, 17, 17, 16, 19, 3, 3, 2, 1, 0, true, 4});
+
+  // Dilated and pointwise filters
+  compareWithReference({1, 12, 11, 8, 8, 3, 3, 1, 2, 2, true, 2});
+  compareWithReference({1, 5, 6, 4, 5, 1, 1, 1, 1, 0, true, 1});
+}
+
+TEST(CKer_Operation, DirectConvProfitable)
+{
+  EXPECT_TRUE(nnfw::cker::optimized::IsDirectConvProfitable(Shape{32, 3, 3, 3}));
+  EXPECT_TRUE(nnfw::cker::optimized::IsDirectConvProfitable(Shape{64, 7, 7, 16}));
+  EXPECT_FALSE(nnfw::cker::optimized::IsDirectConvProfitable(Shape{64, 3, 3, 32}));
+  EXPECT_FALSE(nnfw::cker::optimized::IsDirectConvProfitable(Shape{8, 9, 9, 3}));
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Einsum.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 5 + seed) % 9) - 4.f;
+  return data;
+}
+
+// Sums the products of the two inputs over the labels not in the output
+std::vector<float> reference(const std::string &lhs, const std::string &rhs,
+                             const std::string &out, const std::map<char, int> &sizes,
+                             const std::vector<float> &lhs_data,
+                             const std::vector<float> &rhs_data)
+{
+  std::string labels;
+  for (char c : lhs + rhs)
+  {
+    if (labels.find(c) == std::string::npos)
+      labels.push_back(c);
+  }
+
+  auto offset = [&](const std::string &subscript, const std::map<char, int> &index) {
+    int offset = 0;
+    for (char c : subscript)
+      offset = offset * sizes.at(c) + index.at(c);
+    return offset;
+  };
+
+  int out_size = 1;
+  for (char c : out)
+    out_size *= sizes.at(c);
+  std::vector<float> output(out_size, 0.f);
+
+  std::map<char, int> index;
+  for (char c : labels)
+    index[c] = 0;
+  while (true)
+  {
+    output[offset(out, index)] += lhs_data[offset(lhs, index)] * rhs_data[offset(rhs, index)];
+    size_t i = 0;
+    for (; i < labels.size(); ++i)
+    {
+      if (++index[labels[i]] < sizes.at(labels[i]))
+        break;
+      index[labels[i]] = 0;
+    }
+    if (i == labels.size())
+      break;
+  }
+  return output;
+}
+
+Shape shapeOf(const std::string &subscript, const std::map<char, int> &sizes)
+{
+  std::vector<int32_t> dims;
+  for (char c : subscript)
+    dims.push_back(sizes.at(c));
+  return dims.empty() ? Shape() : Shape(dims.size(), dims.data());
+}
+
+void compareWithReference(const std::string &lhs, const std::string &rhs, const std::string &out,
+                          const std::map<char, int> &sizes)
+{
+  const Shape lhs_shape = shapeOf(lhs, sizes);
+  const Shape rhs_shape = shapeOf(rhs, sizes);
+  const Shape out_shape = shapeOf(out, sizes);
+  const auto lhs_data = makeData(lhs_shape.FlatSize(), 1);
+  const auto rhs_data = makeData(rhs_shape.FlatSize(), 2);
+  const auto expected = reference(lhs, rhs, out, sizes, lhs_data, rhs_data);
+
+  std::string equation = lhs + "," + rhs + "->" + out;
+  std::vector<float> actual(out_shape.FlatSize());
+  nnfw::cker::Einsum einsum;
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  einsum.prepare(equation);
+  // Twice to run with the prepared equation again
+  for (int run = 0; run < 2; ++run)
+  {
+    einsum(equation, {lhs_shape, rhs_shape}, {lhs_data.data(), rhs_data.data()}, out_shape,
+           actual.data(), &ruy_context);
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_FLOAT_EQ(actual[i], expected[i]) << equation;
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, EinsumMatMul)
+{
+  const std::map<char, int> sizes = {{'b', 3}, {'h', 2}, {'i', 5}, {'j', 7}, {'k', 4},
+                                     {'q', 6}, {'d', 8}, {'l', 3}};
+
+  // Operands are multiplied as they are
+  compareWithReference("bij", "bjk", "bik", sizes);
+  compareWithReference("bhqd", "bhkd", "bhqk", sizes);
+  compareWithReference("bji", "bjk", "bik", sizes);
+  compareWithReference("ij", "jk", "ik", sizes);
+  compareWithReference("bij", "bjk", "bki", sizes);
+  compareWithReference("bhij", "bhjkl", "bhikl", sizes);
+  compareWithReference("bj", "bjk", "bk", sizes);
+  compareWithReference("ij", "ij", "", sizes);
+
+  // Operands are transposed or reduced first
+  compareWithReference("bij", "jbk", "bik", sizes);
+  compareWithReference("ijk", "jl", "il", sizes);
+  compareWithReference("bij", "bjk", "kbi", sizes);
+}
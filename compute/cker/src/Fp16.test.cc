@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BinaryArithmeticFp16.h>
+#include <cker/operation/ConvFp16.h>
+#include <cker/operation/DepthwiseConvFp16.h>
+#include <cker/operation/FullyConnectedFp16.h>
+#include <cker/operation/SoftMaxFp16.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::float16;
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = (static_cast<float>((i * 7 + seed) % 13) - 6.f) / 8.f;
+  return data;
+}
+
+std::vector<float16> toFp16(const std::vector<float> &data)
+{
+  std::vector<float16> result(data.size());
+  nnfw::cker::ConvertFloatToFp16(data.data(), result.data(), data.size());
+  return result;
+}
+
+std::vector<float> toFloat(const std::vector<float16> &data)
+{
+  std::vector<float> result(data.size());
+  nnfw::cker::ConvertFp16ToFloat(data.data(), result.data(), data.size());
+  return result;
+}
+
+void expectNear(const std::vector<float> &expected, const std::vector<float> &actual,
+                float tolerance)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(expected[i], actual[i], tolerance * std::max(1.f, std::fabs(expected[i])))
+      << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, Fp16Conversion)
+{
+  const std::vector<float> values{0.f,     1.f,    -2.5f,   65504.f, 6.103515625e-05f,
+                                  1.e-07f, 1.e+06f, 0.333f, -0.f};
+  const std::vector<float> expected{0.f,         1.f,   -2.5f,  65504.f, 6.103515625e-05f,
+                                    1.1920929e-07f, INFINITY, 0.33300781f, -0.f};
+  const auto converted = toFloat(toFp16(values));
+  for (size_t i = 0; i < values.size(); ++i)
+    EXPECT_EQ(expected[i], converted[i]) << "at " << i;
+
+  // NaN stays NaN
+  const std::vector<float> nan{std::numeric_limits<float>::quiet_NaN()};
+  EXPECT_TRUE(std::isnan(toFloat(toFp16(nan))[0]));
+}
+
+TEST(CKer_Operation, ConvFp16)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const Shape input_shape{2, 5, 6, 20};
+  const Shape filter_shape{8, 3, 3, 20};
+  const Shape bias_shape{8};
+  const Shape output_shape{2, 3, 3, 8};
+  nnfw::cker::ConvParams params{};
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 2;
+  params.stride_height = 2;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = -1.f;
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  const auto input = toFloat(toFp16(makeData(input_shape.FlatSize(), 1)));
+  const auto filter = toFloat(toFp16(makeData(filter_shape.FlatSize(), 2)));
+  const auto bias = toFloat(toFp16(makeData(bias_shape.FlatSize(), 3)));
+
+  std::vector<float> expected(output_shape.FlatSize());
+  for (int b = 0; b < 2; ++b)
+    for (int y = 0; y < 3; ++y)
+      for (int x = 0; x < 3; ++x)
+        for (int oc = 0; oc < 8; ++oc)
+        {
+          float sum = bias[oc];
+          for (int fy = 0; fy < 3; ++fy)
+            for (int fx = 0; fx < 3; ++fx)
+            {
+              const int in_y = y * 2 - 1 + fy;
+              const int in_x = x * 2 - 1 + fx;
+              if (in_y < 0 || in_y >= 5 || in_x < 0 || in_x >= 6)
+                continue;
+              for (int ic = 0; ic < 20; ++ic)
+                sum += input[((b * 5 + in_y) * 6 + in_x) * 20 + ic] *
+                       filter[((oc * 3 + fy) * 3 + fx) * 20 + ic];
+            }
+          expected[((b * 3 + y) * 3 + x) * 8 + oc] = std::max(sum, -1.f);
+        }
+
+  const auto input16 = toFp16(input);
+  const auto filter16 = toFp16(filter);
+  const auto bias16 = toFp16(bias);
+  std::vector<float16> output16(output_shape.FlatSize());
+  nnfw::cker::ConvFp16(params, input_shape, input16.data(), filter_shape, filter16.data(),
+                       bias_shape, bias16.data(), output_shape, output16.data(), &ruy_context);
+  expectNear(expected, toFloat(output16), 1.e-2f);
+}
+
+TEST(CKer_Operation, DepthwiseConvFp16)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+
+  for (int multiplier : {1, 2})
+  {
+    const int input_depth = 12;
+    const int output_depth = input_depth * multiplier;
+    const Shape input_shape{1, 4, 4, input_depth};
+    const Shape filter_shape{1, 3, 3, output_depth};
+    const Shape bias_shape{output_depth};
+    const Shape output_shape{1, 4, 4, output_depth};
+    nnfw::cker::DepthwiseConvParams params{};
+    params.padding_values.width = 1;
+    params.padding_values.height = 1;
+    params.stride_width = 1;
+    params.stride_height = 1;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+    params.depth_multiplier = multiplier;
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+
+    const auto input = toFloat(toFp16(makeData(input_shape.FlatSize(), 4)));
+    const auto filter = toFloat(toFp16(makeData(filter_shape.FlatSize(), 5)));
+    const auto bias = toFloat(toFp16(makeData(bias_shape.FlatSize(), 6)));
+
+    std::vector<float> expected(output_shape.FlatSize());
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x)
+        for (int oc = 0; oc < output_depth; ++oc)
+        {
+          float sum = bias[oc];
+          for (int fy = 0; fy < 3; ++fy)
+            for (int fx = 0; fx < 3; ++fx)
+            {
+              const int in_y = y - 1 + fy;
+              const int in_x = x - 1 + fx;
+              if (in_y < 0 || in_y >= 4 || in_x < 0 || in_x >= 4)
+                continue;
+              sum += input[(in_y * 4 + in_x) * input_depth + oc / multiplier] *
+                     filter[(fy * 3 + fx) * output_depth + oc];
+            }
+          expected[(y * 4 + x) * output_depth + oc] = sum;
+        }
+
+    const auto input16 = toFp16(input);
+    const auto filter16 = toFp16(filter);
+    const auto bias16 = toFp16(bias);
+    std::vector<float16> output16(output_shape.FlatSize());
+    nnfw::cker::DepthwiseConvFp16(params, input_shape, input16.data(), filter_shape,
+                                  filter16.data(), bias_shape, bias16.data(), output_shape,
+                                  output16.data(), &ruy_context);
+    expectNear(expected, toFloat(output16), 1.e-2f);
+  }
+}
+
+TEST(CKer_Operation, FullyConnectedFp16)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const Shape input_shape{3, 200};
+  const Shape weights_shape{40, 200};
+  const Shape output_shape{3, 40};
+  nnfw::cker::FullyConnectedParams params{};
+  params.float_activation_min = 0.f;
+  params.float_activation_max = 6.f;
+
+  const auto input = toFloat(toFp16(makeData(input_shape.FlatSize(), 7)));
+  const auto weights = toFloat(toFp16(makeData(weights_shape.FlatSize(), 8)));
+
+  std::vector<float> expected(output_shape.FlatSize());
+  for (int b = 0; b < 3; ++b)
+    for (int o = 0; o < 40; ++o)
+    {
+      float sum = 0.f;
+      for (int i = 0; i < 200; ++i)
+        sum += input[b * 200 + i] * weights[o * 200 + i];
+      expected[b * 40 + o] = std::min(std::max(sum, 0.f), 6.f);
+    }
+
+  const auto input16 = toFp16(input);
+  const auto weights16 = toFp16(weights);
+  std::vector<float16> output16(output_shape.FlatSize());
+  nnfw::cker::FullyConnectedFp16(params, input_shape, input16.data(), weights_shape,
+                                 weights16.data(), Shape{}, nullptr, output_shape,
+                                 output16.data(), &ruy_context);
+  expectNear(expected, toFloat(output16), 1.e-2f);
+}
+
+TEST(CKer_Operation, BinaryArithmeticFp16Broadcast)
+{
+  const Shape lhs_shape{2, 3, 4};
+  const Shape rhs_shape{3, 1};
+  const Shape output_shape{2, 3, 4};
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  const auto lhs = toFloat(toFp16(makeData(lhs_shape.FlatSize(), 9)));
+  const auto rhs = toFloat(toFp16(makeData(rhs_shape.FlatSize(), 10)));
+  std::vector<float> expected(output_shape.FlatSize());
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 4; ++k)
+        expected[(i * 3 + j) * 4 + k] = lhs[(i * 3 + j) * 4 + k] * rhs[j];
+
+  const auto lhs16 = toFp16(lhs);
+  const auto rhs16 = toFp16(rhs);
+  std::vector<float16> output16(output_shape.FlatSize());
+  nnfw::cker::BinaryArithmeticFp16(nnfw::cker::BinaryArithmeticOpType::MUL, params, lhs_shape,
+                                   lhs16.data(), rhs_shape, rhs16.data(), output_shape,
+                                   output16.data(), nullptr);
+  expectNear(expected, toFloat(output16), 1.e-3f);
+}
+
+TEST(CKer_Operation, SoftmaxFp16)
+{
+  const Shape shape{3, 10};
+  nnfw::cker::SoftmaxParams params{};
+  params.beta = 1.0;
+
+  // Values whose exponentials overflow half precision
+  std::vector<float> input = makeData(shape.FlatSize(), 11);
+  for (auto &value : input)
+    value *= 40.f;
+  input = toFloat(toFp16(input));
+
+  std::vector<float> expected(shape.FlatSize());
+  for (int i = 0; i < 3; ++i)
+  {
+    float max = std::numeric_limits<float>::lowest();
+    for (int c = 0; c < 10; ++c)
+      max = std::max(max, input[i * 10 + c]);
+    float sum = 0.f;
+    for (int c = 0; c < 10; ++c)
+      sum += std::exp(input[i * 10 + c] - max);
+    for (int c = 0; c < 10; ++c)
+      expected[i * 10 + c] = std::exp(input[i * 10 + c] - max) / sum;
+  }
+
+  const auto input16 = toFp16(input);
+  std::vector<float16> output16(shape.FlatSize());
+  nnfw::cker::SoftmaxFp16(params, shape, input16.data(), shape, output16.data(), nullptr);
+  expectNear(expected, toFloat(output16), 1.e-3f);
+}
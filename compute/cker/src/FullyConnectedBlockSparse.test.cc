@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnectedBlockSparse.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+// Weights of [rows, cols] whose blocks of [block_rows, block_cols] are zero except every fourth
+template <typename T>
+std::vector<T> makeSparseWeights(int rows, int cols, int block_rows, int block_cols)
+{
+  std::vector<T> weights(rows * cols);
+  for (int r = 0; r < rows; ++r)
+  {
+    for (int c = 0; c < cols; ++c)
+    {
+      const int block = (r / block_rows) * (cols / block_cols) + c / block_cols;
+      if (block % 4 == 0)
+        weights[r * cols + c] = static_cast<T>((r * 5 + c * 3) % 7 - 3);
+    }
+  }
+  return weights;
+}
+
+void compareFloat(int batches, int rows, int cols, int block_rows, int block_cols, int threads)
+{
+  const auto weights = makeSparseWeights<float>(rows, cols, block_rows, block_cols);
+  std::vector<float> input(batches * cols);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 5) / 2.f - 1.f;
+  std::vector<float> bias(rows);
+  for (int r = 0; r < rows; ++r)
+    bias[r] = static_cast<float>(r % 3) - 1.f;
+
+  nnfw::cker::FullyConnectedParams params;
+  params.float_activation_min = -6.f;
+  params.float_activation_max = 6.f;
+
+  std::vector<float> expected(batches * rows);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int r = 0; r < rows; ++r)
+    {
+      float sum = bias[r];
+      for (int c = 0; c < cols; ++c)
+        sum += weights[r * cols + c] * input[b * cols + c];
+      expected[b * rows + r] = std::min(std::max(sum, -6.f), 6.f);
+    }
+  }
+
+  nnfw::cker::BlockSparseMatrix<float> matrix;
+  matrix.build(weights.data(), rows, cols, block_rows, block_cols);
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  std::vector<float> output(batches * rows);
+  nnfw::cker::FullyConnectedBlockSparse(params, nnfw::cker::Shape{batches, cols}, input.data(),
+                                        matrix, bias.data(), nnfw::cker::Shape{batches, rows},
+                                        output.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_FLOAT_EQ(output[i], expected[i]);
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedBlockSparse)
+{
+  compareFloat(2, 16, 8, 4, 4, 1);
+  compareFloat(3, 32, 12, 16, 1, 1);
+  compareFloat(1, 8, 20, 1, 4, 1);
+  // Shapes the kernel is not unrolled for
+  compareFloat(2, 6, 6, 2, 3, 1);
+
+  // Block rows split among threads
+  compareFloat(4, 512, 256, 8, 1, 4);
+  compareFloat(4, 512, 256, 4, 4, 4);
+}
+
+TEST(CKer_Operation, FullyConnectedBlockSparseInt8)
+{
+  const int batches = 2, rows = 8, cols = 8;
+  const auto weights = makeSparseWeights<int8_t>(rows, cols, 4, 4);
+  std::vector<int8_t> input(batches * cols);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int8_t>(i * 7 % 31 - 15);
+  std::vector<int32_t> bias(rows, 10);
+  // Multiplier of 0.5 for every channel
+  std::vector<int32_t> multiplier(rows, 1 << 30);
+  std::vector<int> shift(rows, 0);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.input_offset = 3;
+  params.output_offset = -2;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  nnfw::cker::BlockSparseMatrix<int8_t> matrix;
+  matrix.build(weights.data(), rows, cols, 4, 4);
+  ASSERT_EQ(matrix.values.size(), 16u);
+
+  std::vector<int8_t> output(batches * rows);
+  nnfw::cker::FullyConnectedBlockSparse(params, multiplier.data(), shift.data(),
+                                        nnfw::cker::Shape{batches, cols}, input.data(), matrix,
+                                        bias.data(), nnfw::cker::Shape{batches, rows},
+                                        output.data());
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int r = 0; r < rows; ++r)
+    {
+      int32_t sum = bias[r];
+      for (int c = 0; c < cols; ++c)
+        sum += weights[r * cols + c] * (input[b * cols + c] + params.input_offset);
+      const int32_t expected = nnfw::cker::MultiplyByQuantizedMultiplier(sum, 1 << 30, 0) - 2;
+      ASSERT_EQ(output[b * rows + r], std::min(std::max(expected, -128), 127));
+    }
+  }
+}
+
+TEST(CKer_Operation, ChooseSparseBlock)
+{
+  int block_rows = 0, block_cols = 0;
+
+  // Every fourth block of 8x1 is nonzero, which leaves every 4x4 block nonzero, and 16x1 blocks
+  // as sparse as them
+  const auto weights = makeSparseWeights<float>(16, 16, 8, 1);
+  ASSERT_FLOAT_EQ(nnfw::cker::BlockDensity(weights.data(), 16, 16, 4, 4), 1.f);
+  ASSERT_TRUE(nnfw::cker::ChooseSparseBlock(weights.data(), 16, 16, &block_rows, &block_cols));
+  ASSERT_EQ(block_rows, 16);
+  ASSERT_EQ(block_cols, 1);
+  ASSERT_FLOAT_EQ(nnfw::cker::BlockDensity(weights.data(), 16, 16, 16, 1), 0.25f);
+
+  // Dense weights
+  const std::vector<float> dense(16 * 16, 1.f);
+  ASSERT_FALSE(nnfw::cker::ChooseSparseBlock(dense.data(), 16, 16, &block_rows, &block_cols));
+}
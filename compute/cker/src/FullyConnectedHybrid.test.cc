@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+// Reference of output = input * transpose(weights * scales) + bias with float weights
+std::vector<float> reference(const std::vector<float> &input, const std::vector<int8_t> &weights,
+                             const std::vector<float> &scales, const std::vector<float> &bias,
+                             int batches, int rows, int cols)
+{
+  std::vector<float> output(batches * rows);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int r = 0; r < rows; ++r)
+    {
+      const float scale = scales.size() == 1 ? scales[0] : scales[r];
+      float sum = bias[r];
+      for (int c = 0; c < cols; ++c)
+        sum += weights[r * cols + c] * scale * input[b * cols + c];
+      output[b * rows + r] = sum;
+    }
+  }
+  return output;
+}
+
+void compareHybrid(const std::vector<float> &scales, int batches, int rows, int cols)
+{
+  std::vector<int8_t> weights(rows * cols);
+  for (size_t i = 0; i < weights.size(); ++i)
+    weights[i] = static_cast<int8_t>(static_cast<int>(i * 37 % 255) - 127);
+  std::vector<float> input(batches * cols);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 7) / 3.f - 1.f;
+  std::vector<float> bias(rows);
+  for (int r = 0; r < rows; ++r)
+    bias[r] = static_cast<float>(r % 3) - 1.f;
+
+  const auto expected = reference(input, weights, scales, bias, batches, rows, cols);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.weights_scale = scales[0];
+  if (scales.size() > 1)
+    params.weights_scales = scales.data();
+
+  const nnfw::cker::Shape input_shape{batches, cols};
+  const nnfw::cker::Shape weights_shape{rows, cols};
+  const nnfw::cker::Shape output_shape{batches, rows};
+  nnfw::cker::FCTempArena temp_arena;
+  temp_arena.prepare(input_shape, weights_shape);
+  ruy::Context ruy_context;
+  std::vector<float> output(batches * rows);
+  nnfw::cker::FullyConnectedHybrid(params, input_shape, input.data(), weights_shape,
+                                   weights.data(), nnfw::cker::Shape{rows}, bias.data(),
+                                   output_shape, output.data(), temp_arena, &ruy_context);
+
+  // Input is quantized to int8 symmetrically, so the error is relative to the magnitude of sums
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(expected[i], output[i], 0.01f * cols * scales[i % rows % scales.size()] * 127.f)
+      << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedHybrid)
+{
+  compareHybrid({0.01f}, 2, 4, 16);
+}
+
+TEST(CKer_Operation, FullyConnectedHybrid_PerChannel)
+{
+  // Scales differ by orders of magnitude, so a single scale cannot represent them
+  compareHybrid({0.001f, 0.01f, 0.1f, 1.f}, 3, 4, 16);
+
+  std::vector<float> scales(8);
+  for (size_t i = 0; i < scales.size(); ++i)
+    scales[i] = 0.005f * (i + 1);
+  compareHybrid(scales, 1, 8, 32);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Gather.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+TEST(CKer_Operation, Gather)
+{
+  // [2, 5, 3] gathered along the middle axis, with a run of consecutive coordinates
+  const nnfw::cker::Shape input_shape{2, 5, 3};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i);
+  const nnfw::cker::Shape coords_shape{4};
+  const std::vector<int32_t> coords = {1, 2, 3, 0};
+  const nnfw::cker::Shape output_shape{2, 4, 3};
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::GatherParams params;
+  params.axis = 1;
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+  nnfw::cker::Gather(params, input_shape, input.data(), coords_shape, coords.data(), output_shape,
+                     output.data(), &ruy_context);
+
+  std::vector<float> expected;
+  for (int b = 0; b < 2; ++b)
+    for (int c : coords)
+      for (int k = 0; k < 3; ++k)
+        expected.push_back(input[(b * 5 + c) * 3 + k]);
+  ASSERT_EQ(output, expected);
+}
+
+TEST(CKer_Operation, GatherLastAxis)
+{
+  // Single elements over enough slices to split among threads
+  const int rows = 4096;
+  const nnfw::cker::Shape input_shape{rows, 8};
+  std::vector<int32_t> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int32_t>(i);
+  const nnfw::cker::Shape coords_shape{5};
+  const std::vector<int64_t> coords = {7, 0, 0, 3, 4};
+  const nnfw::cker::Shape output_shape{rows, 5};
+  std::vector<int32_t> output(output_shape.FlatSize());
+
+  nnfw::cker::GatherParams params;
+  params.axis = -1;
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  nnfw::cker::Gather(params, input_shape, input.data(), coords_shape, coords.data(), output_shape,
+                     output.data(), &ruy_context);
+
+  for (int r = 0; r < rows; ++r)
+    for (int i = 0; i < 5; ++i)
+      ASSERT_EQ(output[r * 5 + i], input[r * 8 + coords[i]]);
+}
+
+TEST(CKer_Operation, GatherRows)
+{
+  // Embedding lookups over enough coordinates to split among threads and prefetch ahead
+  const int rows = 1000;
+  const int row_size = 64;
+  std::vector<float> table(rows * row_size);
+  for (size_t i = 0; i < table.size(); ++i)
+    table[i] = static_cast<float>(i);
+  std::vector<int32_t> coords(512);
+  for (size_t i = 0; i < coords.size(); ++i)
+    coords[i] = static_cast<int32_t>((i * 617) % rows);
+  std::vector<float> output(coords.size() * row_size);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  nnfw::cker::GatherRows(table.data(), rows, row_size, coords.data(), coords.size(), output.data(),
+                         &ruy_context);
+
+  for (size_t i = 0; i < coords.size(); ++i)
+    for (int k = 0; k < row_size; ++k)
+      ASSERT_EQ(output[i * row_size + k], table[coords[i] * row_size + k]);
+}
+
+TEST(CKer_Operation, GatherRowsDequantize)
+{
+  const int rows = 3;
+  const int row_size = 4;
+  const std::vector<int8_t> table = {-128, -1, 0, 127, 1, 2, 3, 4, -4, -3, -2, -1};
+  const std::vector<int64_t> coords = {2, 0, 2};
+  std::vector<float> output(coords.size() * row_size);
+
+  // Per tensor
+  const float scale = 0.5f;
+  const int32_t zero_point = -1;
+  nnfw::cker::GatherRowsDequantize(table.data(), rows, row_size, &scale, &zero_point, false,
+                                   coords.data(), coords.size(), output.data());
+  for (size_t i = 0; i < coords.size(); ++i)
+    for (int k = 0; k < row_size; ++k)
+      ASSERT_FLOAT_EQ(output[i * row_size + k], (table[coords[i] * row_size + k] + 1) * 0.5f);
+
+  // Per row
+  const std::vector<float> scales = {0.1f, 0.2f, 0.3f};
+  const std::vector<int32_t> zero_points = {0, 0, 2};
+  nnfw::cker::GatherRowsDequantize(table.data(), rows, row_size, scales.data(), zero_points.data(),
+                                   true, coords.data(), coords.size(), output.data());
+  for (size_t i = 0; i < coords.size(); ++i)
+  {
+    const auto row = coords[i];
+    for (int k = 0; k < row_size; ++k)
+    {
+      const float expected = (table[row * row_size + k] - zero_points[row]) * scales[row];
+      ASSERT_FLOAT_EQ(output[i * row_size + k], expected);
+    }
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cker/operation/Gelu.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+TEST(CKer_Operation, Gelu)
+{
+  const nnfw::cker::Shape shape{1, 2, 4};
+  const std::vector<float> input = {-3.0f, -1.0f, -0.5f, 0.0f, 0.5f, 1.0f, 2.0f, 3.0f};
+  const std::vector<float> expected = {-0.004050f, -0.158655f, -0.154269f, 0.0f,
+                                       0.345731f,  0.841345f,  1.954500f,  2.995950f};
+  std::vector<float> output(shape.FlatSize());
+
+  nnfw::cker::Gelu(false, shape, input.data(), shape, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(expected[i], output[i], 1e-5f);
+}
+
+TEST(CKer_Operation, GeluApproximate)
+{
+  const nnfw::cker::Shape shape{1, 2, 4};
+  const std::vector<float> input = {-3.0f, -1.0f, -0.5f, 0.0f, 0.5f, 1.0f, 2.0f, 3.0f};
+  const std::vector<float> expected = {-0.003637f, -0.158808f, -0.154286f, 0.0f,
+                                       0.345714f,  0.841192f,  1.954598f,  2.996363f};
+  std::vector<float> output(shape.FlatSize());
+
+  nnfw::cker::Gelu(true, shape, input.data(), shape, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(expected[i], output[i], 1e-5f);
+}
+
+TEST(CKer_Operation, GeluThreads)
+{
+  // Enough elements to split among threads
+  const nnfw::cker::Shape shape{64, 1024};
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 17) * 0.5f - 4.0f;
+  std::vector<float> expected(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  nnfw::cker::Gelu(false, shape, input.data(), shape, expected.data());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  nnfw::cker::Gelu(false, shape, input.data(), shape, output.data(), &ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(expected[i], output[i]);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cker/operation/HardSwish.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+TEST(CKer_Operation, HardSwish)
+{
+  const nnfw::cker::Shape shape{1, 2, 4};
+  const std::vector<float> input = {-4.0f, -3.0f, -1.0f, 0.0f, 1.0f, 3.0f, 4.0f, 0.5f};
+  const std::vector<float> expected = {0.0f,        0.0f, -1.0f / 3.0f, 0.0f,
+                                       2.0f / 3.0f, 3.0f, 4.0f,         0.5f * 3.5f / 6.0f};
+  std::vector<float> output(shape.FlatSize());
+
+  nnfw::cker::HardSwish(shape, input.data(), shape, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(expected[i], output[i]);
+}
+
+TEST(CKer_Operation, HardSwishThreads)
+{
+  // Enough elements to split among threads
+  const nnfw::cker::Shape shape{64, 1024};
+  std::vector<float> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 17) - 8.0f;
+  std::vector<float> output(shape.FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  nnfw::cker::HardSwish(shape, input.data(), shape, output.data(), &ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+  {
+    const float x = input[i];
+    const float relu6 = x + 3.0f < 0.0f ? 0.0f : (x + 3.0f > 6.0f ? 6.0f : x + 3.0f);
+    EXPECT_FLOAT_EQ(x * relu6 / 6.0f, output[i]);
+  }
+}
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/BinaryArithmeticInt16.h>
+#include <cker/operation/ConvInt16.h>
+#include <cker/operation/DepthwiseConvInt16.h>
+#include <cker/operation/FullyConnectedInt16.h>
+#include <cker/operation/LogisticInt16.h>
+#include <cker/operation/SoftMaxInt16.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+template <typename T> std::vector<T> makeData(int size, int seed, int range)
+{
+  std::vector<T> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<T>((i * 7919 + seed * 104729) % (2 * range + 1) - range);
+  return data;
+}
+
+// Real multiplier of a quantized multiplier and shift
+double realMultiplier(int32_t multiplier, int32_t shift)
+{
+  return static_cast<double>(multiplier) / (1ll << 31) * std::ldexp(1.0, shift);
+}
+
+int16_t quantize(double value, int32_t zero_point)
+{
+  return static_cast<int16_t>(
+    std::min(32767.0, std::max(-32768.0, std::round(value) + zero_point)));
+}
+
+void expectNear(const std::vector<int16_t> &expected, const std::vector<int16_t> &actual,
+                int tolerance)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_LE(std::abs(expected[i] - actual[i]), tolerance) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, MultiplyByQuantizedMultiplierInt64)
+{
+  // 0.75 of values that do not fit in 32 bits
+  EXPECT_EQ(nnfw::cker::MultiplyByQuantizedMultiplier(int64_t{1} << 40, 1610612736, -20),
+            786432);
+  EXPECT_EQ(nnfw::cker::MultiplyByQuantizedMultiplier(-(int64_t{1} << 40), 1610612736, -20),
+            -786432);
+  EXPECT_EQ(nnfw::cker::MultiplyByQuantizedMultiplier(int64_t{3}, 1073741824, 1), 3);
+}
+
+TEST(CKer_Operation, ConvInt16)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+  const Shape input_shape{1, 9, 8, 300};
+  const Shape filter_shape{3, 3, 3, 300};
+  const Shape output_shape{1, 5, 4, 3};
+
+  nnfw::cker::ConvParams params{};
+  params.stride_width = 2;
+  params.stride_height = 2;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.output_offset = 0;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+
+  // Large values over many input channels need more than 32 bits
+  const auto input = makeData<int16_t>(input_shape.FlatSize(), 1, 32767);
+  const auto filter = makeData<int8_t>(filter_shape.FlatSize(), 2, 127);
+  const std::vector<int64_t> bias{int64_t{1} << 33, -1000, 0};
+  const std::vector<int32_t> multipliers{1073741824, 1300000000, 2000000000};
+  const std::vector<int32_t> shifts{-20, -21, -22};
+
+  std::vector<int16_t> expected(output_shape.FlatSize());
+  for (int y = 0; y < 5; ++y)
+    for (int x = 0; x < 4; ++x)
+      for (int oc = 0; oc < 3; ++oc)
+      {
+        int64_t acc = bias[oc];
+        for (int fy = 0; fy < 3; ++fy)
+          for (int fx = 0; fx < 3; ++fx)
+          {
+            const int in_y = y * 2 - 1 + fy;
+            const int in_x = x * 2 - 1 + fx;
+            if (in_y < 0 || in_y >= 9 || in_x < 0 || in_x >= 8)
+              continue;
+            for (int ic = 0; ic < 300; ++ic)
+              acc += input[Offset(input_shape, 0, in_y, in_x, ic)] *
+                     filter[Offset(filter_shape, oc, fy, fx, ic)];
+          }
+        expected[Offset(output_shape, 0, y, x, oc)] =
+          quantize(acc * realMultiplier(multipliers[oc], shifts[oc]), 0);
+      }
+
+  std::vector<int16_t> output(output_shape.FlatSize());
+  nnfw::cker::ConvInt16(params, multipliers.data(), shifts.data(), input_shape, input.data(),
+                        filter_shape, filter.data(), Shape{3}, bias.data(), output_shape,
+                        output.data(), &ruy_context);
+  expectNear(expected, output, 1);
+}
+
+TEST(CKer_Operation, DepthwiseConvInt16)
+{
+  const Shape input_shape{1, 4, 4, 2};
+  const Shape filter_shape{1, 3, 3, 4};
+  const Shape output_shape{1, 4, 4, 4};
+
+  nnfw::cker::DepthwiseConvParams params{};
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.depth_multiplier = 2;
+  params.output_offset = 3;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 32767;
+
+  const auto input = makeData<int16_t>(input_shape.FlatSize(), 3, 30000);
+  const auto filter = makeData<int8_t>(filter_shape.FlatSize(), 4, 127);
+  const std::vector<int32_t> multipliers(4, 1073741824);
+  const std::vector<int32_t> shifts{-4, -5, -6, -7};
+
+  std::vector<int16_t> expected(output_shape.FlatSize());
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x)
+      for (int oc = 0; oc < 4; ++oc)
+      {
+        int64_t acc = 0;
+        for (int fy = 0; fy < 3; ++fy)
+          for (int fx = 0; fx < 3; ++fx)
+          {
+            const int in_y = y - 1 + fy;
+            const int in_x = x - 1 + fx;
+            if (in_y < 0 || in_y >= 4 || in_x < 0 || in_x >= 4)
+              continue;
+            acc += input[Offset(input_shape, 0, in_y, in_x, oc / 2)] *
+                   filter[Offset(filter_shape, 0, fy, fx, oc)];
+          }
+        const auto value = quantize(acc * realMultiplier(multipliers[oc], shifts[oc]), 3);
+        expected[Offset(output_shape, 0, y, x, oc)] = std::max<int16_t>(0, value);
+      }
+
+  std::vector<int16_t> output(output_shape.FlatSize());
+  nnfw::cker::DepthwiseConvInt16(params, multipliers.data(), shifts.data(), input_shape,
+                                 input.data(), filter_shape, filter.data(), Shape{}, nullptr,
+                                 output_shape, output.data(), nullptr);
+  expectNear(expected, output, 1);
+}
+
+TEST(CKer_Operation, FullyConnectedInt16)
+{
+  const Shape input_shape{2, 1000};
+  const Shape weights_shape{4, 1000};
+  const Shape output_shape{2, 4};
+
+  nnfw::cker::FullyConnectedParams params{};
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+
+  const auto input = makeData<int16_t>(input_shape.FlatSize(), 5, 32767);
+  const auto weights = makeData<int8_t>(weights_shape.FlatSize(), 6, 127);
+  const std::vector<int64_t> bias{10, 20, 30, 40};
+  const std::vector<int32_t> multipliers(4, 1500000000);
+  const std::vector<int32_t> shifts(4, -22);
+
+  std::vector<int16_t> expected(output_shape.FlatSize());
+  for (int b = 0; b < 2; ++b)
+    for (int o = 0; o < 4; ++o)
+    {
+      int64_t acc = bias[o];
+      for (int i = 0; i < 1000; ++i)
+        acc += input[b * 1000 + i] * weights[o * 1000 + i];
+      expected[b * 4 + o] = quantize(acc * realMultiplier(multipliers[o], shifts[o]), 0);
+    }
+
+  std::vector<int16_t> output(output_shape.FlatSize());
+  nnfw::cker::FullyConnectedInt16(params, multipliers.data(), shifts.data(), input_shape,
+                                  input.data(), weights_shape, weights.data(), Shape{4},
+                                  bias.data(), output_shape, output.data(), nullptr);
+  expectNear(expected, output, 1);
+}
+
+TEST(CKer_Operation, BinaryArithmeticInt16)
+{
+  const Shape lhs_shape{2, 3, 4};
+  const Shape rhs_shape{1, 3, 1};
+  const auto lhs = makeData<int16_t>(lhs_shape.FlatSize(), 7, 20000);
+  const auto rhs = makeData<int16_t>(rhs_shape.FlatSize(), 8, 20000);
+
+  // Real values are q * 1/1024 for the inputs and q * 1/512 for the output
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.left_shift = 15;
+  params.input1_multiplier = 1073741824;
+  params.input1_shift = 0;
+  params.input2_multiplier = 1073741824;
+  params.input2_shift = 0;
+  params.output_multiplier = 1073741824;
+  params.output_shift = -15;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+
+  std::vector<int16_t> expected_add(lhs_shape.FlatSize());
+  std::vector<int16_t> expected_sub(lhs_shape.FlatSize());
+  std::vector<int16_t> expected_mul(lhs_shape.FlatSize());
+  for (int i = 0; i < lhs_shape.FlatSize(); ++i)
+  {
+    const int r = rhs[(i / 4) % 3];
+    expected_add[i] = quantize((lhs[i] + r) / 4.0, 0);
+    expected_sub[i] = quantize((lhs[i] - r) / 4.0, 0);
+    expected_mul[i] = quantize(static_cast<double>(lhs[i]) * r / 2048.0, 0);
+  }
+
+  std::vector<int16_t> output(lhs_shape.FlatSize());
+  nnfw::cker::BinaryArithmeticInt16(nnfw::cker::BinaryArithmeticOpType::ADD, params, lhs_shape,
+                                    lhs.data(), rhs_shape, rhs.data(), lhs_shape, output.data(),
+                                    nullptr);
+  expectNear(expected_add, output, 1);
+  nnfw::cker::BinaryArithmeticInt16(nnfw::cker::BinaryArithmeticOpType::SUB, params, lhs_shape,
+                                    lhs.data(), rhs_shape, rhs.data(), lhs_shape, output.data(),
+                                    nullptr);
+  expectNear(expected_sub, output, 1);
+
+  params.output_multiplier = 1073741824;
+  params.output_shift = -10;
+  nnfw::cker::BinaryArithmeticInt16(nnfw::cker::BinaryArithmeticOpType::MUL, params, lhs_shape,
+                                    lhs.data(), rhs_shape, rhs.data(), lhs_shape, output.data(),
+                                    nullptr);
+  expectNear(expected_mul, output, 1);
+}
+
+TEST(CKer_Operation, SoftmaxInt16)
+{
+  const Shape shape{3, 10};
+  const float input_scale = 1.f / 2048;
+  const auto input = makeData<int16_t>(shape.FlatSize(), 9, 32767);
+
+  std::vector<float> table;
+  nnfw::cker::PopulateSoftmaxInt16LookupTable(table, input_scale, 1.f);
+  EXPECT_LT(table.size(), 65536u);
+
+  nnfw::cker::SoftmaxParams params;
+  params.scale = 1.f / 32768;
+  params.zero_point = 0;
+  params.table = table.data();
+  params.table_size = table.size();
+  std::vector<int16_t> output(shape.FlatSize());
+  nnfw::cker::SoftmaxInt16(params, shape, input.data(), shape, output.data());
+
+  std::vector<int16_t> expected(shape.FlatSize());
+  for (int b = 0; b < 3; ++b)
+  {
+    double sum = 0;
+    for (int i = 0; i < 10; ++i)
+      sum += std::exp(input[b * 10 + i] * input_scale);
+    for (int i = 0; i < 10; ++i)
+      expected[b * 10 + i] = quantize(std::exp(input[b * 10 + i] * input_scale) / sum * 32768, 0);
+  }
+  expectNear(expected, output, 1);
+}
+
+TEST(CKer_Operation, LogisticInt16)
+{
+  const Shape shape{5};
+  const std::vector<int16_t> input{-32768, -4096, 0, 4096, 32767};
+
+  std::vector<int16_t> table;
+  nnfw::cker::PopulateLogisticInt16LookupTable(table, 1.f / 4096, 0, 1.f / 32768, 0);
+  std::vector<int16_t> output(shape.FlatSize());
+  nnfw::cker::LogisticInt16(table.data(), shape, input.data(), shape, output.data());
+
+  std::vector<int16_t> expected;
+  for (const auto value : input)
+    expected.push_back(quantize(32768 / (1 + std::exp(-value / 4096.0)), 0));
+  expectNear(expected, output, 0);
+}
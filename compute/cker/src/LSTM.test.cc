@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LSTM.h>
+#include <cker/operation/optimized/LSTM.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::optimized::kLstmGates;
+
+std::vector<float> makeData(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = (static_cast<float>((i * 7 + seed) % 11) - 5.f) / 10.f;
+  return data;
+}
+
+struct LstmOptions
+{
+  bool cifg;
+  bool peephole;
+  bool layer_norm;
+  bool projection;
+  bool time_major;
+  bool hybrid;
+};
+
+// Runs the sequence with SequenceLstm and with LstmStepFloat at each step
+void compareWithStep(const LstmOptions &options)
+{
+  const int max_time = 5, n_batch = 3, n_input = 6, n_cell = 8;
+  const int n_output = options.projection ? 4 : n_cell;
+
+  std::vector<float> input_weights[kLstmGates], recurrent_weights[kLstmGates], bias[kLstmGates];
+  std::vector<float> peephole[kLstmGates], layer_norm[kLstmGates];
+  const float *input_weights_ptr[kLstmGates] = {}, *recurrent_weights_ptr[kLstmGates] = {};
+  const float *bias_ptr[kLstmGates] = {}, *peephole_ptr[kLstmGates] = {};
+  const float *layer_norm_ptr[kLstmGates] = {};
+  for (int g = options.cifg ? 1 : 0; g < kLstmGates; ++g)
+  {
+    input_weights[g] = makeData(n_cell * n_input, g + 1);
+    recurrent_weights[g] = makeData(n_cell * n_output, g + 5);
+    bias[g] = makeData(n_cell, g + 9);
+    input_weights_ptr[g] = input_weights[g].data();
+    recurrent_weights_ptr[g] = recurrent_weights[g].data();
+    bias_ptr[g] = bias[g].data();
+    if (options.peephole && g != nnfw::cker::optimized::kLstmCellGate)
+    {
+      peephole[g] = makeData(n_cell, g + 3);
+      peephole_ptr[g] = peephole[g].data();
+    }
+    if (options.layer_norm)
+    {
+      layer_norm[g] = makeData(n_cell, g + 4);
+      layer_norm_ptr[g] = layer_norm[g].data();
+    }
+  }
+  const auto projection_weights = makeData(n_output * n_cell, 13);
+  const auto projection_bias = makeData(n_output, 14);
+  const float *projection_weights_ptr = options.projection ? projection_weights.data() : nullptr;
+  const float *projection_bias_ptr = options.projection ? projection_bias.data() : nullptr;
+
+  const auto input = makeData(max_time * n_batch * n_input, 15);
+  nnfw::cker::LSTMParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.f;
+  params.proj_clip = 0.f;
+
+  // Reference, with the loops of LSTMLayer before it packed the gates
+  std::vector<float> expected(max_time * n_batch * n_output);
+  std::vector<float> output_state(n_batch * n_output, 0.f), cell_state(n_batch * n_cell, 0.f);
+  std::vector<float> scratch(4 * n_batch * n_cell);
+  auto run_step = [&](const float *step_input, int batches, float *step_output_state,
+                      float *step_cell_state, float *step_output) {
+    nnfw::cker::LstmStepFloat(
+      step_input, input_weights_ptr[0], input_weights_ptr[1], input_weights_ptr[2],
+      input_weights_ptr[3], nullptr, nullptr, nullptr, nullptr, nullptr, recurrent_weights_ptr[0],
+      recurrent_weights_ptr[1], recurrent_weights_ptr[2], recurrent_weights_ptr[3],
+      peephole_ptr[0], peephole_ptr[1], peephole_ptr[3], layer_norm_ptr[0], layer_norm_ptr[1],
+      layer_norm_ptr[2], layer_norm_ptr[3], bias_ptr[0], bias_ptr[1], bias_ptr[2], bias_ptr[3],
+      projection_weights_ptr, projection_bias_ptr, &params, batches, n_cell, n_input, 0, n_output,
+      n_output, step_output_state, step_cell_state, scratch.data(),
+      scratch.data() + n_batch * n_cell, scratch.data() + 2 * n_batch * n_cell,
+      scratch.data() + 3 * n_batch * n_cell, step_output);
+  };
+  if (options.time_major)
+  {
+    for (int t = 0; t < max_time; ++t)
+      run_step(input.data() + t * n_batch * n_input, n_batch, output_state.data(),
+               cell_state.data(), expected.data() + t * n_batch * n_output);
+  }
+  else
+  {
+    for (int b = 0; b < n_batch; ++b)
+      for (int t = 0; t < max_time; ++t)
+        run_step(input.data() + (b * max_time + t) * n_input, 1,
+                 output_state.data() + b * n_output, cell_state.data() + b * n_cell,
+                 expected.data() + (b * max_time + t) * n_output);
+  }
+
+  nnfw::cker::optimized::SequenceLstm lstm;
+  lstm.prepare(input_weights_ptr, recurrent_weights_ptr, bias_ptr, n_cell, n_input, n_output,
+               options.hybrid);
+  std::vector<float> actual(expected.size());
+  std::fill(output_state.begin(), output_state.end(), 0.f);
+  std::fill(cell_state.begin(), cell_state.end(), 0.f);
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+  lstm(params, input.data(), max_time, n_batch, options.time_major, /*forward_sequence=*/true,
+       peephole_ptr, layer_norm_ptr, projection_weights_ptr, projection_bias_ptr, n_output,
+       output_state.data(), cell_state.data(), actual.data(), &ruy_context);
+
+  // Hybrid execution rounds the weights and inputs to 8 bits
+  const float tolerance = options.hybrid ? 1e-2f : 1e-5f;
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], tolerance) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, SequenceLstm)
+{
+  compareWithStep({false, false, false, false, true, false});
+  compareWithStep({true, false, false, false, true, false});
+  compareWithStep({false, true, false, true, true, false});
+  compareWithStep({false, true, true, false, false, false});
+  compareWithStep({true, true, true, true, false, false});
+}
+
+TEST(CKer_Operation, SequenceLstmHybrid)
+{
+  compareWithStep({false, false, false, false, true, true});
+  compareWithStep({true, true, false, true, false, true});
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cker/operation/LayerNorm.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+TEST(CKer_Operation, LayerNorm)
+{
+  nnfw::cker::LayerNormParams params;
+  params.epsilon = 1e-5f;
+
+  const nnfw::cker::Shape input_shape{2, 4};
+  const nnfw::cker::Shape param_shape{4};
+  const std::vector<float> input = {1.0f, 2.0f, 3.0f, 4.0f, -2.0f, 0.0f, 0.0f, 6.0f};
+  const std::vector<float> gamma = {1.0f, 2.0f, 1.0f, 1.0f};
+  const std::vector<float> beta = {0.0f, 0.0f, 1.0f, -1.0f};
+  const std::vector<float> expected = {-1.341635f, -0.894424f, 1.447212f,  0.341635f,
+                                       -0.999999f, -0.666666f, 0.666667f, 0.666666f};
+  std::vector<float> output(input_shape.FlatSize());
+
+  nnfw::cker::LayerNorm(params, input_shape, input.data(), param_shape, gamma.data(), param_shape,
+                        beta.data(), input_shape, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(expected[i], output[i], 1e-5f);
+}
+
+TEST(CKer_Operation, LayerNormConstantRow)
+{
+  nnfw::cker::LayerNormParams params;
+  params.epsilon = 1e-5f;
+
+  // Zero variance leaves only beta
+  const nnfw::cker::Shape input_shape{1, 3};
+  const nnfw::cker::Shape param_shape{3};
+  const std::vector<float> input = {7.0f, 7.0f, 7.0f};
+  const std::vector<float> gamma = {2.0f, 2.0f, 2.0f};
+  const std::vector<float> beta = {0.5f, -0.5f, 0.0f};
+  std::vector<float> output(input_shape.FlatSize());
+
+  nnfw::cker::LayerNorm(params, input_shape, input.data(), param_shape, gamma.data(), param_shape,
+                        beta.data(), input_shape, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(beta[i], output[i]);
+}
+
+TEST(CKer_Operation, LayerNormThreads)
+{
+  nnfw::cker::LayerNormParams params;
+  params.epsilon = 1e-5f;
+
+  // Enough rows to split among threads
+  const nnfw::cker::Shape input_shape{256, 4, 128};
+  const nnfw::cker::Shape param_shape{128};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 13) * 0.25f - 1.0f;
+  std::vector<float> gamma(param_shape.FlatSize());
+  std::vector<float> beta(param_shape.FlatSize());
+  for (size_t i = 0; i < gamma.size(); ++i)
+  {
+    gamma[i] = 1.0f + static_cast<float>(i % 3);
+    beta[i] = static_cast<float>(i % 5) * 0.1f;
+  }
+  std::vector<float> expected(input_shape.FlatSize());
+  std::vector<float> output(input_shape.FlatSize());
+
+  nnfw::cker::LayerNorm(params, input_shape, input.data(), param_shape, gamma.data(), param_shape,
+                        beta.data(), input_shape, expected.data());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  nnfw::cker::LayerNorm(params, input_shape, input.data(), param_shape, gamma.data(), param_shape,
+                        beta.data(), input_shape, output.data(), &ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(expected[i], output[i]);
+}
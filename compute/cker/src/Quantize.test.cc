@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/Quantize.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// Values over several vectors and a tail, with ties and values out of range of every type
+std::vector<float> makeData(int size)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 37) % 211 - 105) * 0.25f * ((i % 7 == 0) ? 5000.f : 1.f);
+  return data;
+}
+
+template <typename T> void quantizeAndDequantize(float scale, int32_t zero_point, int threads)
+{
+  const int size = 1000;
+  const Shape shape{size};
+  const auto input = makeData(size);
+  std::vector<T> quantized(size);
+  std::vector<float> dequantized(size);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  nnfw::cker::Quantize(shape, input.data(), shape, quantized.data(), scale, zero_point,
+                       &ruy_context);
+  nnfw::cker::Dequantize(shape, quantized.data(), shape, dequantized.data(), scale, zero_point,
+                         &ruy_context);
+
+  const int32_t min = std::numeric_limits<T>::min();
+  const int32_t max = std::numeric_limits<T>::max();
+  for (int i = 0; i < size; ++i)
+  {
+    const float scaled = input[i] * (1.f / scale);
+    int32_t expected = static_cast<int32_t>(std::max(std::min(std::round(scaled), 1e9f), -1e9f));
+    expected = std::min(std::max(expected + zero_point, min), max);
+    ASSERT_EQ(quantized[i], expected);
+    ASSERT_FLOAT_EQ(dequantized[i], scale * (expected - zero_point));
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, QuantizeDequantize)
+{
+  quantizeAndDequantize<uint8_t>(0.5f, 128, 1);
+  quantizeAndDequantize<int8_t>(0.25f, -3, 1);
+  quantizeAndDequantize<int16_t>(0.125f, 0, 1);
+
+  // Elements split among threads
+  quantizeAndDequantize<uint8_t>(0.5f, 10, 4);
+  quantizeAndDequantize<int16_t>(0.125f, 0, 4);
+}
+
+TEST(CKer_Operation, QuantizeRoundsHalfAwayFromZero)
+{
+  const Shape shape{4};
+  const std::vector<float> input = {-2.5f, -1.5f, 1.5f, 2.5f};
+  std::vector<int8_t> output(4);
+
+  nnfw::cker::Quantize(shape, input.data(), shape, output.data(), 1.f, 0);
+
+  const std::vector<int8_t> expected = {-3, -2, 2, 3};
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(output[i], expected[i]);
+}
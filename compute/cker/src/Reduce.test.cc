@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+template <typename T> std::vector<T> makeData(const Shape &shape)
+{
+  std::vector<T> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<T>((i * 7 + 3) % 13) - static_cast<T>(4);
+  return data;
+}
+
+// Reduced shape with the reduced axes kept as 1
+Shape reducedShape(const Shape &shape, const std::vector<int> &axes)
+{
+  Shape reduced(shape);
+  for (auto axis : axes)
+    reduced.SetDim(axis, 1);
+  return reduced;
+}
+
+// Reduction through the generic index walk of ReduceImpl
+template <typename T>
+std::vector<T> reference(const Shape &shape, const std::vector<T> &input,
+                         const std::vector<int> &axes, T init_value,
+                         T reducer(const T current, const T in))
+{
+  std::vector<T> output(reducedShape(shape, axes).FlatSize(), init_value);
+  std::vector<int> iter(shape.DimensionsCount());
+  nnfw::cker::ReduceImpl<T, T>(input.data(), shape, Shape{}, axes.data(), axes.size(), iter.data(),
+                               reducer, output.data());
+  return output;
+}
+
+float sum(const float current, const float in) { return current + in; }
+int32_t max(const int32_t current, const int32_t in) { return std::max(current, in); }
+
+void compareSum(const Shape &shape, const std::vector<int> &axes, int threads)
+{
+  const auto input = makeData<float>(shape);
+  const auto expected = reference<float>(shape, input, axes, 0.f, sum);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  std::vector<float> actual(expected.size());
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(shape.DimensionsCount(), axes.size());
+  ASSERT_TRUE(reduce.ReduceSum(shape, input.data(), reducedShape(shape, axes), actual.data(), axes,
+                               true, &ruy_context));
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-3f);
+}
+
+void compareMean(const Shape &shape, const std::vector<int> &axes, int threads)
+{
+  const auto input = makeData<float>(shape);
+  auto expected = reference<float>(shape, input, axes, 0.f, sum);
+  int count = 1;
+  for (auto axis : axes)
+    count *= shape.Dims(axis);
+  for (auto &value : expected)
+    value /= count;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  std::vector<float> actual(expected.size());
+  nnfw::cker::Mean(shape, input.data(), reducedShape(shape, axes), actual.data(), axes,
+                   &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-4f);
+}
+
+} // namespace
+
+TEST(CKer_Operation, CollapseReduceDims)
+{
+  nnfw::cker::ReduceDims dims;
+
+  // H and W of NHWC
+  const std::vector<int> spatial = {1, 2};
+  ASSERT_TRUE(nnfw::cker::CollapseReduceDims(Shape{2, 3, 4, 5}, spatial.data(), 2, &dims));
+  EXPECT_EQ(dims.outer, 2);
+  EXPECT_EQ(dims.reduce, 12);
+  EXPECT_EQ(dims.inner, 5);
+
+  // Axes of size 1 between the reduced ones do not matter
+  const std::vector<int> split = {0, 2};
+  ASSERT_TRUE(nnfw::cker::CollapseReduceDims(Shape{3, 1, 4, 5}, split.data(), 2, &dims));
+  EXPECT_EQ(dims.outer, 1);
+  EXPECT_EQ(dims.reduce, 12);
+  EXPECT_EQ(dims.inner, 5);
+
+  ASSERT_FALSE(nnfw::cker::CollapseReduceDims(Shape{3, 2, 4, 5}, split.data(), 2, &dims));
+}
+
+TEST(CKer_Operation, ReduceSum)
+{
+  // Inner, outer and spatial axes, split among threads or not
+  for (int threads : {1, 4})
+  {
+    compareSum(Shape{4, 3, 37}, {2}, threads);
+    compareSum(Shape{64, 3, 1000}, {2}, threads);
+    compareSum(Shape{300, 3, 5}, {0}, threads);
+    compareSum(Shape{2, 40, 40, 67}, {1, 2}, threads);
+    compareSum(Shape{1, 100, 100, 3}, {1, 2}, threads);
+    // Axes which do not collapse
+    compareSum(Shape{3, 4, 5, 6}, {0, 2}, threads);
+  }
+}
+
+TEST(CKer_Operation, ReduceMax)
+{
+  const Shape shape{2, 30, 30, 17};
+  const std::vector<int> axes = {1, 2};
+  const auto input = makeData<int32_t>(shape);
+  const auto expected =
+    reference<int32_t>(shape, input, axes, std::numeric_limits<int32_t>::lowest(), max);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  std::vector<int32_t> actual(expected.size());
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(shape.DimensionsCount(), axes.size());
+  ASSERT_TRUE(reduce.ReduceGeneric<int32_t>(shape, input.data(), reducedShape(shape, axes),
+                                            actual.data(), axes, true,
+                                            std::numeric_limits<int32_t>::lowest(), max,
+                                            &ruy_context));
+  EXPECT_EQ(actual, expected);
+}
+
+TEST(CKer_Operation, ReduceMean)
+{
+  for (int threads : {1, 4})
+  {
+    compareMean(Shape{2, 7, 7, 33}, {1, 2}, threads);
+    compareMean(Shape{1, 64, 64, 128}, {1, 2}, threads);
+    compareMean(Shape{100, 300}, {1}, threads);
+    compareMean(Shape{300, 100}, {0}, threads);
+    compareMean(Shape{3, 4, 5, 6}, {1, 3}, threads);
+  }
+}
+
+TEST(CKer_Operation, ReduceMeanQuant8)
+{
+  const Shape shape{1, 20, 20, 24};
+  const std::vector<int> axes = {1, 2};
+  std::vector<uint8_t> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>((i * 7) % 251);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  std::vector<uint8_t> actual(shape.Dims(3));
+  nnfw::cker::MeanQ8Asymm(shape, input.data(), 0.5f, 10, reducedShape(shape, axes), actual.data(),
+                          0.25f, 3, axes, &ruy_context);
+
+  for (int c = 0; c < shape.Dims(3); ++c)
+  {
+    int sum = 0;
+    for (int i = 0; i < 400; ++i)
+      sum += input[i * 24 + c];
+    const float mean = static_cast<float>(sum) / 400 * 2.f - 20.f + 3.f;
+    EXPECT_NEAR(actual[c], std::min(255.f, std::max(0.f, mean)), 1.f);
+  }
+}
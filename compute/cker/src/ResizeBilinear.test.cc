@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/ResizeBilinear.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// Bilinear interpolation of each output pixel, with its source coordinates computed on the spot
+template <typename T>
+std::vector<T> reference(const nnfw::cker::ResizeBilinearParams &params, const Shape &input_shape,
+                         const std::vector<T> &input)
+{
+  const int batches = input_shape.Dims(0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int depth = input_shape.Dims(3);
+  const Shape output_shape{batches, params.output_height, params.output_width, depth};
+
+  float height_scale = static_cast<float>(input_height) / params.output_height;
+  float width_scale = static_cast<float>(input_width) / params.output_width;
+  if (params.align_corners && params.output_height > 1)
+    height_scale = static_cast<float>(input_height - 1) / (params.output_height - 1);
+  if (params.align_corners && params.output_width > 1)
+    width_scale = static_cast<float>(input_width - 1) / (params.output_width - 1);
+
+  std::vector<T> output(output_shape.FlatSize());
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int y = 0; y < params.output_height; ++y)
+    {
+      float input_y;
+      int32_t y0, y1;
+      nnfw::cker::ComputeInterpolationValues(static_cast<float>(y), height_scale,
+                                             params.half_pixel_centers, input_height, &input_y,
+                                             &y0, &y1);
+      for (int x = 0; x < params.output_width; ++x)
+      {
+        float input_x;
+        int32_t x0, x1;
+        nnfw::cker::ComputeInterpolationValues(static_cast<float>(x), width_scale,
+                                               params.half_pixel_centers, input_width, &input_x,
+                                               &x0, &x1);
+        for (int c = 0; c < depth; ++c)
+        {
+          const float value = input[Offset(input_shape, b, y0, x0, c)] * (1 - (input_y - y0)) *
+                                (1 - (input_x - x0)) +
+                              input[Offset(input_shape, b, y0, x1, c)] * (1 - (input_y - y0)) *
+                                (input_x - x0) +
+                              input[Offset(input_shape, b, y1, x0, c)] * (input_y - y0) *
+                                (1 - (input_x - x0)) +
+                              input[Offset(input_shape, b, y1, x1, c)] * (input_y - y0) *
+                                (input_x - x0);
+          output[Offset(output_shape, b, y, x, c)] = static_cast<T>(value);
+        }
+      }
+    }
+  }
+  return output;
+}
+
+template <typename T>
+void compareWithReference(const Shape &input_shape, int output_height, int output_width,
+                          bool align_corners, bool half_pixel_centers, T tolerance)
+{
+  std::vector<T> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<T>((i * 37 + 11) % 256);
+
+  nnfw::cker::ResizeBilinearParams params;
+  params.output_height = output_height;
+  params.output_width = output_width;
+  params.align_corners = align_corners;
+  params.half_pixel_centers = half_pixel_centers;
+  const auto expected = reference(params, input_shape, input);
+
+  nnfw::cker::ResizeBilinearTables tables;
+  nnfw::cker::PrepareResizeBilinearTables(params, input_shape.Dims(1), input_shape.Dims(2),
+                                          &tables);
+  ASSERT_TRUE(tables.matches(params, input_shape.Dims(1), input_shape.Dims(2)));
+
+  const Shape output_shape{input_shape.Dims(0), output_height, output_width, input_shape.Dims(3)};
+  std::vector<T> actual(output_shape.FlatSize());
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  nnfw::cker::ResizeBilinear(params, tables, input_shape, input.data(), output_shape,
+                             actual.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], tolerance) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ResizeBilinear)
+{
+  // 2x upsample, which had its own path, and others with all the params
+  compareWithReference<float>(Shape{1, 8, 8, 5}, 16, 16, false, false, 1e-3f);
+  compareWithReference<float>(Shape{2, 13, 7, 19}, 40, 33, false, false, 1e-3f);
+  compareWithReference<float>(Shape{2, 13, 7, 19}, 40, 33, true, false, 1e-3f);
+  compareWithReference<float>(Shape{1, 64, 64, 32}, 128, 128, false, true, 1e-3f);
+  compareWithReference<float>(Shape{1, 20, 20, 3}, 7, 9, false, true, 1e-3f);
+}
+
+TEST(CKer_Operation, ResizeBilinearUint8)
+{
+  // Truncating may differ by one from the reference where the weights round differently
+  compareWithReference<uint8_t>(Shape{1, 8, 8, 21}, 16, 16, false, false, 1);
+  compareWithReference<uint8_t>(Shape{2, 13, 7, 16}, 40, 33, true, false, 1);
+  compareWithReference<uint8_t>(Shape{1, 64, 64, 32}, 128, 128, false, true, 1);
+}
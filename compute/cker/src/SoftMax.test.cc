@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LogSoftMax.h>
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeLogits(int size)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 7919) % 2003) / 100.f - 10.f;
+  return data;
+}
+
+} // namespace
+
+TEST(CKer_Operation, FastExp)
+{
+  for (float x = -87.f; x < 88.f; x += 0.0137f)
+  {
+    const float expected = std::exp(x);
+    ASSERT_NEAR(nnfw::cker::FastExp(x), expected, expected * 2e-7f) << "at " << x;
+  }
+  EXPECT_GE(nnfw::cker::FastExp(-1e9f), 0.f);
+  EXPECT_LT(nnfw::cker::FastExp(-1e9f), 1e-37f);
+}
+
+TEST(CKer_Operation, Softmax)
+{
+  // Rows over several chunks, whose max rises across them
+  for (int size : {7, 256, 1000, 30522})
+  {
+    const int batches = 5;
+    auto input = makeLogits(batches * size);
+    input[batches * size - 1] = 25.f;
+    std::vector<float> output(input.size());
+
+    ruy::Context ruy_context;
+    ruy_context.set_max_num_threads(4);
+    const float beta = 0.9f;
+    nnfw::cker::Softmax(input.data(), size, batches, beta, output.data(), &ruy_context);
+
+    for (int b = 0; b < batches; ++b)
+    {
+      const float *row = input.data() + b * size;
+      double max = row[0];
+      for (int i = 0; i < size; ++i)
+        max = std::max(max, static_cast<double>(row[i]));
+      double sum = 0;
+      for (int i = 0; i < size; ++i)
+        sum += std::exp((row[i] - max) * beta);
+      for (int i = 0; i < size; ++i)
+      {
+        const double expected = std::exp((row[i] - max) * beta) / sum;
+        ASSERT_NEAR(output[b * size + i], expected, expected * 1e-5 + 1e-12);
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, LogSoftmax)
+{
+  // Over the last axis, and over a middle one
+  const Shape shape{2, 300, 37};
+  const auto input = makeLogits(shape.FlatSize());
+  for (int axis : {2, 1})
+  {
+    nnfw::cker::SoftmaxParams params;
+    params.beta = 1.5f;
+    params.axis = axis;
+    std::vector<float> output(input.size());
+    ruy::Context ruy_context;
+    ruy_context.set_max_num_threads(4);
+    nnfw::cker::LogSoftmax(params, shape, input.data(), shape, output.data(), &ruy_context);
+
+    const int outer = axis == 2 ? 600 : 2;
+    const int depth = shape.Dims(axis);
+    const int inner = axis == 2 ? 1 : 37;
+    for (int o = 0; o < outer; ++o)
+    {
+      for (int j = 0; j < inner; ++j)
+      {
+        auto at = [&](int c) { return (o * depth + c) * inner + j; };
+        double max = input[at(0)];
+        for (int c = 0; c < depth; ++c)
+          max = std::max(max, static_cast<double>(input[at(c)]));
+        double sum = 0;
+        for (int c = 0; c < depth; ++c)
+          sum += std::exp((input[at(c)] - max) * params.beta);
+        for (int c = 0; c < depth; ++c)
+          ASSERT_NEAR(output[at(c)], (input[at(c)] - max) * params.beta - std::log(sum), 1e-4);
+      }
+    }
+  }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/StatelessRandomUniform.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+// Values drawn from the generator one after another, as Fill() of the TF port does
+std::vector<float> serialUniform(const random::PhiloxRandom &gen, int size)
+{
+  std::vector<float> expected(size);
+  functor::FillPhiloxRandomTask<random::UniformDistribution<random::PhiloxRandom, float>,
+                                false>::Run(gen, expected.data(), size,
+                                            random::UniformDistribution<random::PhiloxRandom,
+                                                                        float>());
+  return expected;
+}
+
+} // namespace
+
+TEST(CKer_Operation, PhiloxUniformFloat)
+{
+  random::PhiloxRandom::ResultType counter;
+  counter[0] = 0xffffffff; // Groups carry into the next word of the counter
+  counter[2] = 7;
+  random::PhiloxRandom::Key key;
+  key[0] = 0x3ec8f720;
+  key[1] = 0x02461e29;
+  const random::PhiloxRandom gen{counter, key};
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  for (int size : {1, 3, 4, 17, 30, 1003, 100003})
+  {
+    const auto expected = serialUniform(gen, size);
+    for (auto *context : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+    {
+      std::vector<float> actual(size);
+      optimized::PhiloxUniformFloat(gen, actual.data(), size, context);
+      for (int i = 0; i < size; ++i)
+      {
+        ASSERT_EQ(actual[i], expected[i]) << "size " << size << ", index " << i;
+        ASSERT_GE(actual[i], 0.f);
+        ASSERT_LT(actual[i], 1.f);
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, StatelessRandomUniform)
+{
+  const int32_t shape_data[] = {3, 5};
+  const int32_t seed_data[] = {1, 2};
+  const Shape shape_shape{2};
+  const Shape seed_shape{2};
+  const Shape output_shape{3, 5};
+
+  std::vector<float> output(15);
+  StatelessRandomUniform(shape_shape, shape_data, seed_shape, seed_data, output_shape,
+                         output.data());
+
+  // The same seed gives the same values, and another seed gives others
+  std::vector<float> again(15);
+  StatelessRandomUniform(shape_shape, shape_data, seed_shape, seed_data, output_shape,
+                         again.data());
+  ASSERT_EQ(output, again);
+
+  const int32_t other_seed[] = {2, 1};
+  StatelessRandomUniform(shape_shape, shape_data, seed_shape, other_seed, output_shape,
+                         again.data());
+  ASSERT_NE(output, again);
+}
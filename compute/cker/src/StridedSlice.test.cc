@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/StridedSlice.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// Slice input of [b, h, w, d] element by element along each axis, with stride 1 for omitted axes
+std::vector<int> reference(const Shape &shape, const std::vector<int> &input, const int *begin,
+                           const int *count, const int *stride)
+{
+  std::vector<int> output;
+  for (int b = 0; b < count[0]; ++b)
+    for (int h = 0; h < count[1]; ++h)
+      for (int w = 0; w < count[2]; ++w)
+        for (int d = 0; d < count[3]; ++d)
+          output.push_back(input[nnfw::cker::Offset(shape, begin[0] + b * stride[0],
+                                                    begin[1] + h * stride[1],
+                                                    begin[2] + w * stride[2],
+                                                    begin[3] + d * stride[3])]);
+  return output;
+}
+
+} // namespace
+
+TEST(CKer_Operation, StridedSlice)
+{
+  const Shape input_shape{2, 6, 7, 9};
+  std::vector<int> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int>(i);
+
+  // Contiguous innermost slices, strided ones and backward ones
+  const int begins[][4] = {{0, 1, 0, 2}, {1, 0, 6, 1}, {1, 5, 1, 8}};
+  const int ends[][4] = {{2, 6, 7, 7}, {2, 6, 0, 9}, {-3, 0, 7, -10}};
+  const int strides[][4] = {{1, 2, 1, 1}, {1, 1, -2, 3}, {-1, -2, 3, -1}};
+  const int counts[][4] = {{2, 3, 7, 5}, {1, 6, 3, 3}, {2, 3, 2, 9}};
+  for (int t = 0; t < 3; ++t)
+  {
+    auto params = nnfw::cker::buildStridedSliceParams(begins[t], ends[t], strides[t], 0, 0, 0, 4);
+    if (t == 2)
+    {
+      // Backward slices up to the first element of the axes
+      params.end_mask = 1 | 8;
+    }
+    const Shape output_shape{counts[t][0], counts[t][1], counts[t][2], counts[t][3]};
+    std::vector<int> output(output_shape.FlatSize());
+    ruy::Context ruy_context;
+    ruy_context.set_max_num_threads(2);
+    nnfw::cker::StridedSlice(params, input_shape, input.data(), output_shape, output.data(),
+                             &ruy_context);
+
+    ASSERT_EQ(output, reference(input_shape, input, begins[t], counts[t], strides[t]));
+  }
+}
+
+TEST(CKer_Operation, StridedSliceShrinkAxis)
+{
+  // input[1, :, 2] of [3, 4, 5]
+  const Shape input_shape{3, 4, 5};
+  std::vector<float> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i);
+  const int begin[] = {1, 0, 2};
+  const int end[] = {2, 4, 3};
+  const int stride[] = {1, 1, 1};
+  const auto params = nnfw::cker::buildStridedSliceParams(begin, end, stride, 0, 0, 1 | 4, 3);
+  const Shape output_shape{4};
+  std::vector<float> output(4);
+  nnfw::cker::StridedSlice(params, input_shape, input.data(), output_shape, output.data());
+
+  const std::vector<float> expected = {22.f, 27.f, 32.f, 37.f};
+  ASSERT_EQ(output, expected);
+}
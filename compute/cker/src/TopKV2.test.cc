@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TopKV2.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace nnfw::cker;
+
+namespace
+{
+
+// Indices of a row by a stable sort of values in descending order
+template <typename T> std::vector<int32_t> sortedIndices(const T *row, int size, int k)
+{
+  std::vector<int32_t> indices(size);
+  std::iota(indices.begin(), indices.end(), 0);
+  std::stable_sort(indices.begin(), indices.end(),
+                   [row](int32_t a, int32_t b) { return row[a] > row[b]; });
+  indices.resize(k);
+  return indices;
+}
+
+template <typename T> void expectSortedTopK(int rows, int row_size, int k, int range)
+{
+  std::mt19937 gen(row_size + k);
+  // A small range of values makes ties, which must be in the order of indices
+  std::uniform_int_distribution<int> dist(-range, range);
+  std::vector<T> input(rows * row_size);
+  for (auto &v : input)
+    v = static_cast<T>(dist(gen));
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const Shape input_shape{rows, row_size};
+  const Shape output_shape{rows, k};
+  for (auto *context : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+  {
+    std::vector<T> values(rows * k);
+    std::vector<int32_t> indices(rows * k, -1);
+    TopKV2(input_shape, input.data(), k, output_shape, values.data(), output_shape,
+           indices.data(), context);
+
+    for (int r = 0; r < rows; ++r)
+    {
+      const T *row = input.data() + r * row_size;
+      const auto expected = sortedIndices(row, row_size, k);
+      for (int i = 0; i < k; ++i)
+      {
+        ASSERT_EQ(indices[r * k + i], expected[i]) << "row " << r << ", " << i << "th of " << k;
+        ASSERT_EQ(values[r * k + i], row[expected[i]]);
+      }
+    }
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, TopKV2)
+{
+  {
+    const Shape shape{1, 6};
+    const float input[] = {1.f, 5.f, 3.f, 5.f, -2.f, 4.f};
+    float values[3];
+    int32_t indices[3];
+    TopKV2(shape, input, 3, Shape{1, 3}, values, Shape{1, 3}, indices, nullptr);
+
+    EXPECT_FLOAT_EQ(values[0], 5.f);
+    EXPECT_FLOAT_EQ(values[1], 5.f);
+    EXPECT_FLOAT_EQ(values[2], 4.f);
+    EXPECT_EQ(indices[0], 1);
+    EXPECT_EQ(indices[1], 3);
+    EXPECT_EQ(indices[2], 5);
+  }
+
+  // Beam search over a vocabulary keeps a heap, and large k sorts rows
+  expectSortedTopK<float>(8, 32000, 5, 1000);
+  expectSortedTopK<float>(8, 32000, 5, 3);
+  expectSortedTopK<float>(3, 100, 100, 10);
+  expectSortedTopK<float>(3, 100, 50, 10);
+  expectSortedTopK<int32_t>(4, 1000, 1, 100);
+  expectSortedTopK<uint8_t>(4, 1000, 10, 100);
+}
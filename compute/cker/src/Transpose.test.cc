@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+template <typename T>
+void compareWithReference(const Shape &input_shape, const std::vector<int> &perm, int threads)
+{
+  const int rank = input_shape.DimensionsCount();
+  nnfw::cker::TransposeParams params;
+  params.perm_count = rank;
+  Shape output_shape(rank);
+  for (int i = 0; i < rank; ++i)
+  {
+    params.perm[i] = perm[i];
+    output_shape.SetDim(i, input_shape.Dims(perm[i]));
+  }
+
+  std::vector<T> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<T>(i % 251);
+
+  std::vector<T> expected(input.size());
+  nnfw::cker::reference::Transpose(params, input_shape, input.data(), output_shape,
+                                   expected.data());
+
+  std::vector<T> actual(input.size());
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, actual.data(),
+                        &ruy_context);
+
+  ASSERT_EQ(actual, expected);
+}
+
+} // namespace
+
+TEST(CKer_Operation, Transpose2D)
+{
+  // Matrices of whole tiles, of partial tiles and of partial 4x4 blocks
+  compareWithReference<float>(Shape{64, 96}, {1, 0}, 1);
+  compareWithReference<float>(Shape{37, 53}, {1, 0}, 1);
+  compareWithReference<int32_t>(Shape{129, 257}, {1, 0}, 4);
+  compareWithReference<uint8_t>(Shape{3, 301}, {1, 0}, 1);
+
+  // NHWC to NCHW and back, which rotate the dimensions
+  compareWithReference<float>(Shape{2, 17, 19, 24}, {0, 3, 1, 2}, 4);
+  compareWithReference<float>(Shape{2, 24, 17, 19}, {0, 2, 3, 1}, 4);
+}
+
+TEST(CKer_Operation, TransposeStrided)
+{
+  // Innermost dimensions moved and kept in place
+  compareWithReference<float>(Shape{5, 7, 9}, {2, 0, 1}, 1);
+  compareWithReference<float>(Shape{5, 7, 9}, {1, 0, 2}, 1);
+  compareWithReference<int32_t>(Shape{3, 4, 5, 6}, {3, 1, 2, 0}, 2);
+  compareWithReference<uint8_t>(Shape{3, 4, 5, 6}, {1, 3, 0, 2}, 2);
+
+  // Leading dimensions flattened, small and large enough to split
+  compareWithReference<float>(Shape{4, 3, 5, 7}, {0, 2, 1, 3}, 4);
+  compareWithReference<float>(Shape{2, 64, 48, 12}, {0, 2, 1, 3}, 4);
+}
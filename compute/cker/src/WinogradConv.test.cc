@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/optimized/WinogradConv.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeData(const Shape &shape, int seed)
+{
+  std::vector<float> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = (static_cast<float>((i * 13 + seed) % 17) - 8.f) / 8.f;
+  return data;
+}
+
+void compareWithReference(int batches, int height, int width, int input_depth, int output_depth,
+                          int padding, bool with_bias, int threads)
+{
+  const int output_height = height + 2 * padding - 2;
+  const int output_width = width + 2 * padding - 2;
+  const Shape input_shape{batches, height, width, input_depth};
+  const Shape filter_shape{output_depth, 3, 3, input_depth};
+  const Shape output_shape{batches, output_height, output_width, output_depth};
+  const auto input = makeData(input_shape, 1);
+  const auto filter = makeData(filter_shape, 2);
+  const auto bias = makeData(Shape{output_depth}, 3);
+
+  nnfw::cker::ConvParams params{};
+  params.padding_values.height = padding;
+  params.padding_values.width = padding;
+  params.float_activation_min = -2.f;
+  params.float_activation_max = 2.f;
+
+  std::vector<float> expected(output_shape.FlatSize());
+  for (int b = 0; b < batches; ++b)
+    for (int y = 0; y < output_height; ++y)
+      for (int x = 0; x < output_width; ++x)
+        for (int o = 0; o < output_depth; ++o)
+        {
+          float sum = with_bias ? bias[o] : 0.f;
+          for (int fy = 0; fy < 3; ++fy)
+            for (int fx = 0; fx < 3; ++fx)
+            {
+              const int in_y = y - padding + fy;
+              const int in_x = x - padding + fx;
+              if (in_y < 0 || in_y >= height || in_x < 0 || in_x >= width)
+                continue;
+              for (int i = 0; i < input_depth; ++i)
+                sum += input[Offset(input_shape, b, in_y, in_x, i)] *
+                       filter[Offset(filter_shape, o, fy, fx, i)];
+            }
+          expected[Offset(output_shape, b, y, x, o)] = std::min(std::max(sum, -2.f), 2.f);
+        }
+
+  std::vector<float> transformed;
+  nnfw::cker::optimized::WinogradTransformFilter(filter_shape, filter.data(), transformed);
+  ASSERT_EQ(transformed.size(), 16u * input_depth * output_depth);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(threads);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::optimized::WinogradConv(params, input_shape, input.data(), filter_shape,
+                                      transformed.data(), Shape{output_depth},
+                                      with_bias ? bias.data() : nullptr, output_shape,
+                                      output.data(), &ruy_context);
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, WinogradConv)
+{
+  // Even and odd output sizes, with and without padding
+  compareWithReference(1, 8, 8, 16, 16, 1, true, 1);
+  compareWithReference(2, 7, 9, 20, 24, 1, false, 1);
+  compareWithReference(1, 10, 5, 16, 32, 0, true, 1);
+
+  // More tiles than a block, split among threads
+  compareWithReference(2, 17, 23, 16, 16, 1, true, 4);
+}
+
+TEST(CKer_Operation, WinogradProfitable)
+{
+  EXPECT_TRUE(nnfw::cker::optimized::IsWinogradProfitable(Shape{32, 3, 3, 32}, 1, 1, 1, 1));
+  EXPECT_FALSE(nnfw::cker::optimized::IsWinogradProfitable(Shape{32, 3, 3, 32}, 2, 2, 1, 1));
+  EXPECT_FALSE(nnfw::cker::optimized::IsWinogradProfitable(Shape{32, 3, 3, 32}, 1, 1, 2, 2));
+  EXPECT_FALSE(nnfw::cker::optimized::IsWinogradProfitable(Shape{32, 5, 5, 32}, 1, 1, 1, 1));
+  EXPECT_FALSE(nnfw::cker::optimized::IsWinogradProfitable(Shape{32, 3, 3, 3}, 1, 1, 1, 1));
+}
@@ -76,6 +76,8 @@ struct ConvParams
   float float_activation_min;
   float float_activation_max;
   bool is_replaced_weights{false};
+  // Mark the filter as cacheable if it is unchanging
+  bool lhs_cacheable{false};
 };
 
 struct FullyConnectedParams
@@ -101,6 +103,13 @@ struct FullyConnectedParams
   // FullyConnectedWeightsFormat weights_format;
 };
 
+struct BatchMatMulParams
+{
+  // Mark the operands as cacheable if they are unchanging, e.g. weights.
+  bool lhs_cacheable{false};
+  bool rhs_cacheable{false};
+};
+
 enum class Order
 {
   kColMajor,
@@ -269,6 +278,12 @@ inline CachePolicy DefaultCachePolicy(bool is_constant_data)
   return is_constant_data ? CachePolicy::kCacheIfLargeSpeedup : CachePolicy::kNeverCache;
 }
 
+// Constant weights are packed on the first run and the packed ones are reused by the others
+inline CachePolicy WeightsCachePolicy(bool is_constant_data)
+{
+  return is_constant_data ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+}
+
 } // namespace ruy
 } // namespace nnfw
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_RUY_BATCH_MATMUL_H__
+#define __NNFW_RUY_BATCH_MATMUL_H__
+
+#include "ruy/Shape.h"
+#include "ruy/Types.h"
+#include "ruy/RuySupport.h"
+
+#include <ruy/ruy.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+
+namespace nnfw
+{
+namespace ruy
+{
+
+/**
+ * @brief BatchMatMul of float tensors, which runs a GEMM of ruy for each batch
+ *
+ * Batch dimensions of size 1 are broadcast and adjoint operands are read in place through the
+ * order of their matrices. Batches run one after another as ruy multithreads each GEMM.
+ */
+inline void BatchMatMul(const BatchMatMulParams &params, const Shape &lhs_shape,
+                        const float *lhs_data, const Shape &rhs_shape, const float *rhs_data,
+                        bool adj_x, bool adj_y, const Shape &output_shape, float *output_data,
+                        ::ruy::Context *ruy_context)
+{
+  const Shape lhs = Shape::ExtendedShape(5, lhs_shape);
+  const Shape rhs = Shape::ExtendedShape(5, rhs_shape);
+
+  const int rows = adj_x ? lhs.Dims(4) : lhs.Dims(3);
+  const int depth = adj_x ? lhs.Dims(3) : lhs.Dims(4);
+  const int cols = adj_y ? rhs.Dims(3) : rhs.Dims(4);
+  assert(depth == (adj_y ? rhs.Dims(4) : rhs.Dims(3)));
+
+  // Strides of the batch dimensions, which are 0 for broadcast ones
+  int batch_dims[3];
+  int lhs_strides[3];
+  int rhs_strides[3];
+  int lhs_stride = rows * depth;
+  int rhs_stride = depth * cols;
+  for (int i = 2; i >= 0; --i)
+  {
+    assert(lhs.Dims(i) == rhs.Dims(i) || lhs.Dims(i) == 1 || rhs.Dims(i) == 1);
+    batch_dims[i] = std::max(lhs.Dims(i), rhs.Dims(i));
+    lhs_strides[i] = (lhs.Dims(i) == 1) ? 0 : lhs_stride;
+    rhs_strides[i] = (rhs.Dims(i) == 1) ? 0 : rhs_stride;
+    lhs_stride *= lhs.Dims(i);
+    rhs_stride *= rhs.Dims(i);
+  }
+  assert(output_shape.FlatSize() == batch_dims[0] * batch_dims[1] * batch_dims[2] * rows * cols);
+  UNUSED_RELEASE(output_shape);
+
+  // An adjoint operand is a row-major matrix of the transposed shape, i.e. a column-major one
+  MatrixParams<float> lhs_params;
+  lhs_params.order = adj_x ? Order::kColMajor : Order::kRowMajor;
+  lhs_params.rows = rows;
+  lhs_params.cols = depth;
+  lhs_params.cache_policy = WeightsCachePolicy(params.lhs_cacheable);
+  MatrixParams<float> rhs_params;
+  rhs_params.order = adj_y ? Order::kColMajor : Order::kRowMajor;
+  rhs_params.rows = depth;
+  rhs_params.cols = cols;
+  rhs_params.cache_policy = WeightsCachePolicy(params.rhs_cacheable);
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kRowMajor;
+  dst_params.rows = rows;
+  dst_params.cols = cols;
+  GemmParams<float, float> gemm_params;
+  ::ruy::BasicSpec<float, float> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  int batch = 0;
+  for (int b0 = 0; b0 < batch_dims[0]; ++b0)
+  {
+    for (int b1 = 0; b1 < batch_dims[1]; ++b1)
+    {
+      for (int b2 = 0; b2 < batch_dims[2]; ++b2, ++batch)
+      {
+        const int lhs_offset = b0 * lhs_strides[0] + b1 * lhs_strides[1] + b2 * lhs_strides[2];
+        const int rhs_offset = b0 * rhs_strides[0] + b1 * rhs_strides[1] + b2 * rhs_strides[2];
+
+        ::ruy::Matrix<float> ruy_lhs;
+        ::ruy::Matrix<float> ruy_rhs;
+        ::ruy::Matrix<float> ruy_dst;
+        ruy_support::MakeRuyMatrix(lhs_params, lhs_data + lhs_offset, &ruy_lhs, true);
+        ruy_support::MakeRuyMatrix(rhs_params, rhs_data + rhs_offset, &ruy_rhs, true);
+        ruy_support::MakeRuyMatrix(dst_params, output_data + batch * rows * cols, &ruy_dst);
+
+        ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+      }
+    }
+  }
+}
+
+} // namespace ruy
+} // namespace nnfw
+
+#endif // __NNFW_RUY_BATCH_MATMUL_H__
@@ -86,6 +86,39 @@ public:
     }
   }
 
+  /**
+   * @brief Conv of int8 tensors whose filter is quantized symmetrically per output channel
+   *
+   * @param output_multiplier Fixed-point multiplier of each output channel
+   * @param output_shift Exponent of the multiplier of each output channel
+   */
+  void operator()(const ConvParams &params, const int32_t *output_multiplier,
+                  const int *output_shift, const Shape &input_shape, const int8_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data,
+                  ::ruy::Context *ruy_context)
+  {
+    if (!_prepared)
+    {
+      // This means that input or output are dynamic or filter is not constant
+      IsRequiredIm2col(input_shape, filter_shape, output_shape, params.stride_width,
+                       params.stride_height, params.dilation_width_factor,
+                       params.dilation_height_factor);
+      _prepared = true;
+    }
+
+    // The buffer is kept over runs as quantized models are usually run on smaller devices
+    int8_t *im2col_data = nullptr;
+    if (_need_im2col)
+    {
+      _im2col_int8.resize(_im2col_shape.FlatSize());
+      im2col_data = _im2col_int8.data();
+    }
+    ConvInt8PerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                       filter_shape, filter_data, bias_shape, bias_data, output_shape, output_data,
+                       _im2col_shape, im2col_data, ruy_context);
+  }
+
 private:
   void ConvFloat(const ConvParams &params, const Shape &input_shape, const float *input_data,
                  const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
@@ -147,6 +180,7 @@ private:
     lhs_params.order = Order::kRowMajor;
     lhs_params.rows = n;
     lhs_params.cols = k;
+    lhs_params.cache_policy = WeightsCachePolicy(params.lhs_cacheable);
     MatrixParams<float> rhs_params;
     rhs_params.order = Order::kColMajor;
     rhs_params.rows = k;
@@ -175,6 +209,91 @@ private:
     ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
   }
 
+  void ConvInt8PerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                          const int *output_shift, const Shape &input_shape,
+                          const int8_t *input_data, const Shape &filter_shape,
+                          const int8_t *filter_data, const Shape &bias_shape,
+                          const int32_t *bias_data, const Shape &output_shape, int8_t *output_data,
+                          const Shape &im2col_shape, int8_t *im2col_data,
+                          ::ruy::Context *ruy_context)
+  {
+    UNUSED_RELEASE(bias_shape);
+    assert(input_shape.DimensionsCount() == 4);
+    assert(filter_shape.DimensionsCount() == 4);
+    assert(output_shape.DimensionsCount() == 4);
+
+    // Padded input pixels are the zero point of the input
+    const uint8_t zero_byte = static_cast<uint8_t>(static_cast<int8_t>(-params.input_offset));
+    const int8_t *gemm_input_data = nullptr;
+    const Shape *gemm_input_shape = nullptr;
+    const int filter_width = filter_shape.Dims(2);
+    const int filter_height = filter_shape.Dims(1);
+    const bool need_dilated_im2col =
+      params.dilation_width_factor != 1 || params.dilation_height_factor != 1;
+    const bool need_im2col = params.stride_width != 1 || params.stride_height != 1 ||
+                             filter_width != 1 || filter_height != 1;
+    if (need_dilated_im2col)
+    {
+      DilatedIm2col(params, zero_byte, input_shape, input_data, filter_shape, output_shape,
+                    im2col_data);
+      gemm_input_data = im2col_data;
+      gemm_input_shape = &im2col_shape;
+    }
+    else if (need_im2col)
+    {
+      assert(im2col_data);
+      Im2col(params, filter_height, filter_width, zero_byte, input_shape, input_data,
+             im2col_shape, im2col_data);
+      gemm_input_data = im2col_data;
+      gemm_input_shape = &im2col_shape;
+    }
+    else
+    {
+      gemm_input_data = input_data;
+      gemm_input_shape = &input_shape;
+    }
+
+    const int gemm_input_dims = gemm_input_shape->DimensionsCount();
+    int m = FlatSizeSkipDim(*gemm_input_shape, gemm_input_dims - 1);
+    int n = output_shape.Dims(3);
+    int k = gemm_input_shape->Dims(gemm_input_dims - 1);
+
+    MatrixParams<int8_t> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = n;
+    lhs_params.cols = k;
+    lhs_params.zero_point = -params.weights_offset;
+    lhs_params.cache_policy = WeightsCachePolicy(params.lhs_cacheable);
+    MatrixParams<int8_t> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = k;
+    rhs_params.cols = m;
+    rhs_params.zero_point = -params.input_offset;
+    MatrixParams<int8_t> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = n;
+    dst_params.cols = m;
+    dst_params.zero_point = params.output_offset;
+    GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+    gemm_params.bias = bias_data;
+    gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+    gemm_params.multiplier_exponent_perchannel = output_shift;
+    gemm_params.clamp_min = static_cast<int8_t>(params.quantized_activation_min);
+    gemm_params.clamp_max = static_cast<int8_t>(params.quantized_activation_max);
+
+    ::ruy::Matrix<int8_t> ruy_lhs;
+    ::ruy::Matrix<int8_t> ruy_rhs;
+    ::ruy::Matrix<int8_t> ruy_dst;
+    ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs, true);
+    ruy_support::MakeRuyMatrix(rhs_params, gemm_input_data, &ruy_rhs, true);
+    ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+    ::ruy::BasicSpec<int32_t, int8_t> ruy_mul_params;
+    ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+    ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+  }
+
   void IsRequiredIm2col(const Shape &input_shape, const Shape &kernel_shape,
                         const Shape &output_shape, uint32_t stride_width, uint32_t stride_height,
                         uint32_t dilation_width_factor, uint32_t dilation_height_factor)
@@ -198,6 +317,7 @@ private:
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
+  std::vector<int8_t> _im2col_int8;
 };
 } // namespace ruy
 } // namespace nnfw
@@ -49,7 +49,7 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   lhs_params.order = Order::kRowMajor;
   lhs_params.cols = weights_shape.Dims(dims_count - 1);
   lhs_params.rows = FlatSizeSkipDim(weights_shape, dims_count - 1);
-  lhs_params.cache_policy = DefaultCachePolicy(params.lhs_cacheable);
+  lhs_params.cache_policy = WeightsCachePolicy(params.lhs_cacheable);
   MatrixParams<float> dst_params;
   dst_params.order = Order::kColMajor;
   dst_params.rows = output_shape.Dims(output_shape.DimensionsCount() - 1);
@@ -74,6 +74,60 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
 }
 
+/**
+ * @brief FullyConnected of int8 tensors whose weights are quantized symmetrically per channel
+ *
+ * @param output_multiplier Fixed-point multiplier of each output channel
+ * @param output_shift Exponent of the multiplier of each output channel
+ */
+inline void FullyConnected(const FullyConnectedParams &params, const int32_t *output_multiplier,
+                           const int *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &weights_shape,
+                           const int8_t *weights_data, const Shape &,
+                           const int32_t *optional_bias_data, const Shape &output_shape,
+                           int8_t *output_data, ::ruy::Context *ruy_context)
+{
+  const int dims_count = weights_shape.DimensionsCount();
+  const int input_rows = weights_shape.Dims(dims_count - 1);
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = input_rows;
+  rhs_params.cols = input_shape.FlatSize() / input_rows;
+  rhs_params.zero_point = -params.input_offset;
+  rhs_params.cache_policy = DefaultCachePolicy(params.rhs_cacheable);
+  assert(input_shape.FlatSize() == (rhs_params.rows * rhs_params.cols));
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.cols = input_rows;
+  lhs_params.rows = FlatSizeSkipDim(weights_shape, dims_count - 1);
+  lhs_params.zero_point = -params.weights_offset;
+  lhs_params.cache_policy = WeightsCachePolicy(params.lhs_cacheable);
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_shape.Dims(output_shape.DimensionsCount() - 1);
+  dst_params.cols = FlatSizeSkipDim(output_shape, output_shape.DimensionsCount() - 1);
+  dst_params.zero_point = params.output_offset;
+  assert(dst_params.rows == lhs_params.rows);
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = optional_bias_data;
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+  gemm_params.clamp_min = static_cast<int8_t>(params.quantized_activation_min);
+  gemm_params.clamp_max = static_cast<int8_t>(params.quantized_activation_max);
+
+  ::ruy::Matrix<int8_t> ruy_lhs;
+  ::ruy::Matrix<int8_t> ruy_rhs;
+  ::ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, weights_data, &ruy_lhs, true);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs, true);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ::ruy::BasicSpec<int32_t, int8_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  ::ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
 } // namespace ruy
 } // namespace nnfw
 
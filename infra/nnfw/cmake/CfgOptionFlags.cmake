@@ -78,6 +78,7 @@ option(BUILD_ARMCOMPUTE "Build ARM Compute from the downloaded source" ON)
 option(BUILD_RUY "Build ruy library from the downloaded source" ON)
 option(BUILD_CPUINFO "Build cpuinfo library from the downloaded source" ON)
 option(PROFILE_RUY "Enable ruy library profiling" OFF)
+option(BUILD_CKER_FP16_ARITHMETIC "Build cker with ARMv8.2 half-precision arithmetic" OFF)
 option(DOWNLOAD_XNNPACK "Download xnnpack source" ON)
 option(BUILD_XNNPACK "Build xnnpack library from the downloaded source" ON)
 option(DOWNLOAD_PTHREADPOOL "Download pthreadpool source" ON)
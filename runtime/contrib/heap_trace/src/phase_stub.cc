@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trace.h"
+
+#include <memory>
+
+extern std::unique_ptr<Trace> GlobalTrace;
+
+// Hooks for traced programs, which find them only when this library is preloaded
+extern "C" {
+
+void heap_trace_enter_phase(const char *phase)
+{
+  if (phase && !Trace::Guard{}.isActive())
+  {
+    GlobalTrace->enterPhase(phase);
+  }
+}
+
+void heap_trace_leave_phase()
+{
+  if (!Trace::Guard{}.isActive())
+  {
+    GlobalTrace->leavePhase();
+  }
+}
+}
@@ -48,6 +48,11 @@ void Trace::logAllocationEvent(void *memory_ptr, size_t size_of_allocated_space_
     _peak_heap_usage_on_cpu = _total_allocated_bytes_on_cpu - _total_deallocated_bytes_on_cpu;
   }
   _memory_in_use_on_cpu[memory_ptr] = size_of_allocated_space_in_bytes;
+  if (auto phase = findStatisticsOfCurrentPhase())
+  {
+    ++phase->allocations_on_cpu;
+    phase->allocated_bytes_on_cpu += size_of_allocated_space_in_bytes;
+  }
   Guard{}.signalizeThatDangerOfRecursionHasPassed();
 }
 
@@ -78,6 +83,11 @@ void Trace::logAllocationEvent(cl_mem memory_ptr, size_t size_of_allocated_space
     {
       _peak_heap_usage_on_gpu = _total_allocated_bytes_on_gpu - _total_deallocated_bytes_on_gpu;
     }
+    if (auto phase = findStatisticsOfCurrentPhase())
+    {
+      ++phase->allocations_on_gpu;
+      phase->allocated_bytes_on_gpu += size_of_allocated_space_in_bytes;
+    }
   }
   else
   {
@@ -102,6 +112,43 @@ void Trace::logDeallocationEvent(cl_mem memory_ptr)
   Guard{}.signalizeThatDangerOfRecursionHasPassed();
 }
 
+void Trace::enterPhase(const char *phase)
+{
+  Guard{}.signalizeAboutPossibleRecursion();
+  std::lock_guard<std::mutex> guard(_lock);
+  if (_phase_stack.empty())
+  {
+    _phase_stack.emplace_back(phase);
+  }
+  else
+  {
+    _phase_stack.emplace_back(_phase_stack.back() + "/" + phase);
+  }
+  ++_phases[_phase_stack.back()].entries;
+  Guard{}.signalizeThatDangerOfRecursionHasPassed();
+}
+
+void Trace::leavePhase()
+{
+  Guard{}.signalizeAboutPossibleRecursion();
+  std::lock_guard<std::mutex> guard(_lock);
+  if (!_phase_stack.empty())
+  {
+    _phase_stack.pop_back();
+  }
+  Guard{}.signalizeThatDangerOfRecursionHasPassed();
+}
+
+Trace::PhaseStatistics *Trace::findStatisticsOfCurrentPhase()
+{
+  if (_phase_stack.empty())
+  {
+    return nullptr;
+  }
+  auto found_phase = _phases.find(_phase_stack.back());
+  return found_phase != _phases.end() ? &found_phase->second : nullptr;
+}
+
 Trace::~Trace()
 {
   Guard{}.markTraceAsNotReady();
@@ -112,4 +159,18 @@ Trace::~Trace()
   _out << "On GPU - Peak mem usage: " << _peak_heap_usage_on_gpu
        << " B, Total allocated: " << _total_allocated_bytes_on_gpu
        << " B, Total deallocated: " << _total_deallocated_bytes_on_gpu << " B\n";
+  // Allocations per entry of a phase that runs repeatedly, e.g. an inference in steady state,
+  // should be zero
+  for (const auto &phase : _phases)
+  {
+    const auto &statistics = phase.second;
+    _out << "Phase " << phase.first << " - Entries: " << statistics.entries
+         << ", Allocations on CPU: " << statistics.allocations_on_cpu << " ("
+         << statistics.allocated_bytes_on_cpu
+         << " B), Allocations on GPU: " << statistics.allocations_on_gpu << " ("
+         << statistics.allocated_bytes_on_gpu << " B), Allocations per entry: "
+         << static_cast<double>(statistics.allocations_on_cpu + statistics.allocations_on_gpu) /
+              statistics.entries
+         << "\n";
+  }
 }
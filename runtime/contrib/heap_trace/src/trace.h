@@ -19,7 +19,10 @@
 
 #include <CL/cl.h>
 
+#include <map>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include <fstream>
 #include <mutex>
 
@@ -36,6 +39,15 @@ class Trace
     }
   };
 
+  struct PhaseStatistics
+  {
+    size_t entries = 0;
+    size_t allocations_on_cpu = 0;
+    size_t allocated_bytes_on_cpu = 0;
+    size_t allocations_on_gpu = 0;
+    size_t allocated_bytes_on_gpu = 0;
+  };
+
 public:
   class Guard
   {
@@ -64,11 +76,16 @@ public:
   void logAllocationEvent(cl_mem memory_ptr, size_t size_of_allocated_space_in_bytes);
   void logDeallocationEvent(void *memory_ptr);
   void logDeallocationEvent(cl_mem memory_ptr);
+  // Attribute allocations to a phase of the traced program until it is left. Phases nest, and the
+  // inner one is named after the outer one like "outer/inner".
+  void enterPhase(const char *phase);
+  void leavePhase();
 
   ~Trace();
 
 private:
   const char *getLogFileNameFromEnvVariable(const char *env_variable_name);
+  PhaseStatistics *findStatisticsOfCurrentPhase();
 
 private:
   std::mutex _lock;
@@ -81,6 +98,8 @@ private:
   size_t _peak_heap_usage_on_gpu = 0;
   std::unordered_map<void *, size_t> _memory_in_use_on_cpu;
   std::unordered_map<cl_mem, MemoryTraits> _memory_in_use_on_gpu;
+  std::vector<std::string> _phase_stack;
+  std::map<std::string, PhaseStatistics> _phases;
 };
 
 #endif // !TRACE_H
@@ -172,4 +172,24 @@ TEST_F(Trace, must_log_allocation_and_deallocation_events)
   ASSERT_STREQ(getContentOfFile("./trace_test.log").c_str(), shouldBeInLogFile.c_str());
 }
 
+TEST_F(Trace, must_attribute_allocations_to_nested_phases)
+{
+  GlobalTrace->enterPhase("run");
+  GlobalTrace->logAllocationEvent((void *)1, 16);
+  GlobalTrace->enterPhase("kernel");
+  GlobalTrace->logAllocationEvent((cl_mem)2, 32);
+  GlobalTrace->leavePhase();
+  GlobalTrace->leavePhase();
+  GlobalTrace->enterPhase("run");
+  GlobalTrace->leavePhase();
+  GlobalTrace->logAllocationEvent((void *)3, 64);
+  GlobalTrace.reset();
+
+  string log = getContentOfFile("./trace_test.log");
+  ASSERT_TRUE(log.find("Phase run - Entries: 2, Allocations on CPU: 1 (16 B), Allocations on GPU: "
+                       "0 (0 B), Allocations per entry: 0.5\n") != string::npos);
+  ASSERT_TRUE(log.find("Phase run/kernel - Entries: 1, Allocations on CPU: 0 (0 B), Allocations "
+                       "on GPU: 1 (32 B), Allocations per entry: 1\n") != string::npos);
+}
+
 } // namespace backstage
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  Per-operator benchmark of cker kernels
+ * @note  Each kernel runs over the shapes that the listed models actually feed it, so that a
+ *        change to a kernel can be measured where it matters. Run with "-p THREADS:<n>" to set
+ *        the number of threads the kernels may use.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/AveragePool.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Conv.h>
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/Quantize.h>
+#include <cker/operation/SoftMax.h>
+
+#include <ruy/context.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(THREADS, 1);
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+/**
+ * @brief Shape of a convolution taken from a model, in NHWC
+ */
+struct ConvCase
+{
+  const char *model;
+  int height;
+  int width;
+  int in_depth;
+  int out_depth; // Depth multiplier for depthwise convolutions
+  int kernel;
+  int stride;
+};
+
+/**
+ * @brief Shape of a fully connected layer taken from a model
+ */
+struct FCCase
+{
+  const char *model;
+  int batches;
+  int input_size;
+  int num_units;
+};
+
+/**
+ * @brief Shape of a global pooling taken from a model, in NHWC
+ */
+struct PoolCase
+{
+  const char *model;
+  int size;
+  int depth;
+};
+
+/**
+ * @brief Flat shape of an elementwise operator taken from a model
+ */
+struct FlatCase
+{
+  const char *model;
+  int rows;
+  int cols;
+};
+
+const ConvCase conv_cases[] = {
+  {"mobilenet_v2", 224, 224, 3, 32, 3, 2},  {"mobilenet_v2", 112, 112, 32, 16, 1, 1},
+  {"mobilenet_v2", 56, 56, 24, 144, 1, 1},  {"mobilenet_v2", 14, 14, 96, 576, 1, 1},
+  {"mobilenet_v2", 7, 7, 320, 1280, 1, 1},  {"inception_v3", 147, 147, 32, 64, 3, 1},
+  {"inception_v3", 35, 35, 64, 96, 3, 1},   {"inception_v3", 17, 17, 192, 192, 1, 1},
+  {"inception_v3", 8, 8, 384, 384, 3, 1},
+};
+
+const ConvCase depthwise_cases[] = {
+  {"mobilenet_v2", 112, 112, 32, 1, 3, 1}, {"mobilenet_v2", 112, 112, 96, 1, 3, 2},
+  {"mobilenet_v2", 56, 56, 144, 1, 3, 1},  {"mobilenet_v2", 28, 28, 192, 1, 3, 1},
+  {"mobilenet_v2", 14, 14, 576, 1, 3, 1},  {"mobilenet_v2", 7, 7, 960, 1, 3, 1},
+};
+
+const FCCase fc_cases[] = {
+  {"mobilenet_v2", 1, 1280, 1001}, {"inception_v3", 1, 2048, 1001}, {"bert_base", 128, 768, 768},
+  {"bert_base", 128, 768, 3072},   {"bert_base", 128, 3072, 768},
+};
+
+const FlatCase flat_cases[] = {
+  {"mobilenet_v2", 56 * 56, 24},   {"mobilenet_v2", 14 * 14, 96}, {"bert_base", 128, 768},
+  {"bert_base_attention", 12 * 128, 128}, {"classifier", 1, 1001},
+};
+
+const PoolCase pool_cases[] = {
+  {"mobilenet_v2", 7, 1280},
+  {"inception_v3", 8, 2048},
+};
+
+std::string caseName(const char *op, const char *type, const char *model, const Shape &shape)
+{
+  std::string name = std::string{"cker::"} + op + "(" + type + ") " + model + " [";
+  for (int i = 0; i < shape.DimensionsCount(); ++i)
+    name += (i == 0 ? "" : "x") + std::to_string(shape.Dims(i));
+  return name + "]";
+}
+
+template <typename T> std::vector<T> makeData(const Shape &shape)
+{
+  std::vector<T> data(shape.FlatSize());
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<T>(i % 13);
+  return data;
+}
+
+int outputSize(int size, int kernel, int stride) { return (size - kernel) / stride + 1; }
+
+void registerConv(const ConvCase &c)
+{
+  const Shape input_shape{1, c.height, c.width, c.in_depth};
+  const Shape filter_shape{c.out_depth, c.kernel, c.kernel, c.in_depth};
+  const Shape bias_shape{c.out_depth};
+  const Shape output_shape{1, outputSize(c.height, c.kernel, c.stride),
+                           outputSize(c.width, c.kernel, c.stride), c.out_depth};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("Conv", "float", c.model, input_shape),
+    [=](nonius::chronometer meter) {
+      auto input = makeData<float>(input_shape);
+      auto filter = makeData<float>(filter_shape);
+      auto bias = makeData<float>(bias_shape);
+      std::vector<float> output(output_shape.FlatSize());
+
+      nnfw::cker::ConvParams params{};
+      params.padding_type = nnfw::cker::PaddingType::kValid;
+      params.stride_width = params.stride_height = c.stride;
+      params.dilation_width_factor = params.dilation_height_factor = 1;
+      params.float_activation_min = std::numeric_limits<float>::lowest();
+      params.float_activation_max = std::numeric_limits<float>::max();
+      params.lhs_cacheable = true;
+
+      // Prepare the constant filter as the cpu backend does
+      nnfw::cker::Conv conv;
+      if (conv.usesWinograd(filter_shape, c.stride, c.stride, 1, 1))
+        conv.prepareWinograd(filter_shape, filter.data());
+      else
+        conv.prepare(filter_shape, filter.data(), params.padding_type, params.is_replaced_weights,
+                     1, 1);
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(meter.param<THREADS>());
+      meter.measure([&](int) {
+        conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+             bias.data(), output_shape, output.data(), &ruy_context);
+      });
+    }};
+}
+
+void registerDepthwiseConv(const ConvCase &c)
+{
+  const int out_depth = c.in_depth * c.out_depth;
+  const Shape input_shape{1, c.height, c.width, c.in_depth};
+  const Shape filter_shape{1, c.kernel, c.kernel, out_depth};
+  const Shape bias_shape{out_depth};
+  const Shape output_shape{1, outputSize(c.height, c.kernel, c.stride),
+                           outputSize(c.width, c.kernel, c.stride), out_depth};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("DepthwiseConv", "float", c.model, input_shape),
+    [=](nonius::chronometer meter) {
+      auto input = makeData<float>(input_shape);
+      auto filter = makeData<float>(filter_shape);
+      auto bias = makeData<float>(bias_shape);
+      std::vector<float> output(output_shape.FlatSize());
+
+      nnfw::cker::DepthwiseConvParams params{};
+      params.padding_type = nnfw::cker::PaddingType::kValid;
+      params.stride_width = params.stride_height = c.stride;
+      params.dilation_width_factor = params.dilation_height_factor = 1;
+      params.depth_multiplier = c.out_depth;
+      params.float_activation_min = std::numeric_limits<float>::lowest();
+      params.float_activation_max = std::numeric_limits<float>::max();
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(meter.param<THREADS>());
+      meter.measure([&](int) {
+        nnfw::cker::DepthwiseConv<float, float>(params, input_shape, input.data(), filter_shape,
+                                                filter.data(), bias_shape, bias.data(),
+                                                output_shape, output.data(), &ruy_context);
+      });
+    }};
+}
+
+void registerFullyConnected(const FCCase &c)
+{
+  const Shape input_shape{c.batches, c.input_size};
+  const Shape weights_shape{c.num_units, c.input_size};
+  const Shape bias_shape{c.num_units};
+  const Shape output_shape{c.batches, c.num_units};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("FullyConnected", "float", c.model, input_shape),
+    [=](nonius::chronometer meter) {
+      auto input = makeData<float>(input_shape);
+      auto weights = makeData<float>(weights_shape);
+      auto bias = makeData<float>(bias_shape);
+      std::vector<float> output(output_shape.FlatSize());
+
+      nnfw::cker::FullyConnectedParams params{};
+      meter.measure([&](int) {
+        nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape,
+                                   weights.data(), bias_shape, bias.data(), output_shape,
+                                   output.data());
+      });
+    }};
+}
+
+void registerAdd(const FlatCase &c)
+{
+  const Shape shape{c.rows, c.cols};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("Add", "float", c.model, shape),
+    [=](nonius::chronometer meter) {
+      auto lhs = makeData<float>(shape);
+      auto rhs = makeData<float>(shape);
+      std::vector<float> output(shape.FlatSize());
+
+      nnfw::cker::BinaryArithmeticOpParam params{};
+      params.float_activation_min = std::numeric_limits<float>::lowest();
+      params.float_activation_max = std::numeric_limits<float>::max();
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(meter.param<THREADS>());
+      meter.measure([&](int) {
+        nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::ADD>(
+          params, shape, lhs.data(), shape, rhs.data(), shape, output.data(), &ruy_context);
+      });
+    }};
+}
+
+void registerSoftmax(const FlatCase &c)
+{
+  const Shape shape{c.rows, c.cols};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("Softmax", "float", c.model, shape),
+    [=](nonius::chronometer meter) {
+      auto input = makeData<float>(shape);
+      std::vector<float> output(shape.FlatSize());
+
+      nnfw::cker::SoftmaxParams params{};
+      params.beta = 1.0;
+      meter.measure([&](int) {
+        nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+      });
+    }};
+}
+
+void registerAveragePool(const PoolCase &c)
+{
+  const Shape input_shape{1, c.size, c.size, c.depth};
+  const Shape output_shape{1, 1, 1, c.depth};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("AveragePool", "float", c.model, input_shape),
+    [=](nonius::chronometer meter) {
+      auto input = makeData<float>(input_shape);
+      std::vector<float> output(output_shape.FlatSize());
+
+      nnfw::cker::PoolParams params{};
+      params.stride_height = params.stride_width = c.size;
+      params.filter_height = params.filter_width = c.size;
+      params.float_activation_min = std::numeric_limits<float>::lowest();
+      params.float_activation_max = std::numeric_limits<float>::max();
+      meter.measure([&](int) {
+        nnfw::cker::AveragePool<float>(params, input_shape, input.data(), output_shape,
+                                       output.data());
+      });
+    }};
+}
+
+template <typename T> void registerQuantize(const char *type, const FlatCase &c)
+{
+  const Shape shape{c.rows, c.cols};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("Quantize", type, c.model, shape),
+    [=](nonius::chronometer meter) {
+      auto input = makeData<float>(shape);
+      std::vector<T> output(shape.FlatSize());
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(meter.param<THREADS>());
+      meter.measure([&](int) {
+        nnfw::cker::Quantize(shape, input.data(), shape, output.data(), 0.1f, 0, &ruy_context);
+      });
+    }};
+
+  nonius::benchmark_registrar{
+    nonius::global_benchmark_registry(), caseName("Dequantize", type, c.model, shape),
+    [=](nonius::chronometer meter) {
+      auto input = makeData<T>(shape);
+      std::vector<float> output(shape.FlatSize());
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(meter.param<THREADS>());
+      meter.measure([&](int) {
+        nnfw::cker::Dequantize(shape, input.data(), shape, output.data(), 0.1f, 0, &ruy_context);
+      });
+    }};
+}
+
+/**
+ * @brief Register the benchmarks of all cases before the runner starts
+ */
+struct Registration
+{
+  Registration()
+  {
+    for (const auto &c : conv_cases)
+      registerConv(c);
+    for (const auto &c : depthwise_cases)
+      registerDepthwiseConv(c);
+    for (const auto &c : fc_cases)
+      registerFullyConnected(c);
+    for (const auto &c : flat_cases)
+    {
+      registerAdd(c);
+      registerSoftmax(c);
+      registerQuantize<uint8_t>("uint8", c);
+      registerQuantize<int8_t>("int8", c);
+      registerQuantize<int16_t>("int16", c);
+    }
+    for (const auto &c : pool_cases)
+      registerAveragePool(c);
+  }
+} registration;
+
+} // namespace
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_LOAD_RESULT_H__
+#define __NNFW_BENCHMARK_LOAD_RESULT_H__
+
+#include "Types.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+
+// Data class of a load test, where runners serve requests with sessions running concurrently
+class LoadResult
+{
+public:
+  /**
+   * @param latencies_us Time from arrival to completion of each request in microseconds
+   * @param duration_us  Time from the first arrival to the last completion in microseconds
+   * @param sessions     Number of sessions serving requests
+   * @param target_qps   Rate requests arrive at, 0 if each session takes the next one at once
+   */
+  LoadResult(std::vector<uint64_t> latencies_us, uint64_t duration_us, uint32_t sessions,
+             double target_qps);
+
+  uint32_t sessions;
+  uint32_t requests;
+  double target_qps;
+  double achieved_qps;
+  // Figures of latencies in milliseconds
+  double latency[FigureType::END_OF_FIG_TYPE];
+};
+
+void printLoadResult(const LoadResult &result);
+
+// Write to "{exec}-{model}-{backend}-load.csv"
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend);
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_LOAD_RESULT_H__
@@ -36,6 +36,11 @@ public:
   bool print_memory = false;
   uint32_t init_memory = 0;
   uint32_t peak_memory = 0;
+  uint32_t warmup_runs = 0;
+  // Number of warm-up runs after which runs take as long as in EXECUTE, -1 if they never do
+  int warmup_converged = -1;
+  // Time of the first run after PREPARE in ms, which is the first of WARMUP if there is any
+  double first_run_time = 0;
 };
 
 // TODO Support not only stdout but also ostream
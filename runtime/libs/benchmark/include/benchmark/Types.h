@@ -103,6 +103,11 @@ enum FigureType
   MAX,
   MIN,
   GEOMEAN,
+  STDDEV,
+  P50,
+  P90,
+  P99,
+  P999,
   END_OF_FIG_TYPE
 };
 
@@ -118,6 +123,16 @@ inline std::string getFigureTypeString(FigureType type)
       return "MIN";
     case GEOMEAN:
       return "GEOMEAN";
+    case STDDEV:
+      return "STDDEV";
+    case P50:
+      return "P50";
+    case P90:
+      return "P90";
+    case P99:
+      return "P99";
+    case P999:
+      return "P99.9";
     default:
       return "END_OF_FIG_TYPE";
   }
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Figures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+
+double percentileMs(const std::vector<uint64_t> &sorted_us, double p)
+{
+  const auto rank = static_cast<size_t>(std::ceil(p * sorted_us.size()));
+  return sorted_us[std::max<size_t>(rank, 1) - 1] / 1e3;
+}
+
+} // namespace
+
+namespace benchmark
+{
+
+void computeFigures(std::vector<uint64_t> times_us, double figures[FigureType::END_OF_FIG_TYPE])
+{
+  std::fill(figures, figures + FigureType::END_OF_FIG_TYPE, 0.0);
+  if (times_us.empty())
+    return;
+
+  std::sort(times_us.begin(), times_us.end());
+  const double num = static_cast<double>(times_us.size());
+
+  const auto sum_us = std::accumulate(times_us.begin(), times_us.end(), uint64_t{0});
+  const double mean = sum_us / num / 1e3;
+  figures[MEAN] = mean;
+  figures[MIN] = times_us.front() / 1e3;
+  figures[MAX] = times_us.back() / 1e3;
+
+  double log_sum = 0.0;
+  double square_sum = 0.0;
+  for (auto t_us : times_us)
+  {
+    const double t = t_us / 1e3;
+    log_sum += std::log(t);
+    square_sum += (t - mean) * (t - mean);
+  }
+
+  // Calculating geometric mean with logs
+  //   "Geometric Mean of (V1, V2, ... Vn)"
+  // = (V1*V2*...*Vn)^(1/n)
+  // = exp(log((V1*V2*...*Vn)^(1/n)))
+  // = exp(log((V1*V2*...*Vn)/n)))
+  // = exp((log(V1) + log(V2) + ... + log(Vn))/n)
+  // = exp(_log_sum/num)
+  figures[GEOMEAN] = std::exp(log_sum / num);
+  figures[STDDEV] = std::sqrt(square_sum / num);
+
+  figures[P50] = percentileMs(times_us, 0.5);
+  figures[P90] = percentileMs(times_us, 0.9);
+  figures[P99] = percentileMs(times_us, 0.99);
+  figures[P999] = percentileMs(times_us, 0.999);
+}
+
+} // namespace benchmark
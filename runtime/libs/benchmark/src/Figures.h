@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_FIGURES_H__
+#define __NNFW_BENCHMARK_FIGURES_H__
+
+#include "benchmark/Types.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace benchmark
+{
+
+/**
+ * @brief Compute all the figures of times
+ *
+ * @param[in]  times_us Times in microseconds
+ * @param[out] figures  Figures of the times in milliseconds, all 0 if there is no time
+ * @note Percentiles are the nearest-rank ones
+ */
+void computeFigures(std::vector<uint64_t> times_us, double figures[FigureType::END_OF_FIG_TYPE]);
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_FIGURES_H__
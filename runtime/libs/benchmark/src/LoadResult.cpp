@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/LoadResult.h"
+#include "benchmark/CsvWriter.h"
+#include "Figures.h"
+
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+
+const std::vector<std::string> csv_header{
+  "Model",       "Backend",     "Sessions",    "Requests",      "Target_QPS",   "Achieved_QPS",
+  "Latency_P50", "Latency_P90", "Latency_P99", "Latency_P99.9", "Latency_Mean", "Latency_Max"};
+
+const benchmark::FigureType latency_figures[] = {benchmark::P50, benchmark::P90, benchmark::P99,
+                                                 benchmark::P999, benchmark::MEAN, benchmark::MAX};
+
+} // namespace
+
+namespace benchmark
+{
+
+LoadResult::LoadResult(std::vector<uint64_t> latencies_us, uint64_t duration_us,
+                       uint32_t sessions, double target_qps)
+  : sessions{sessions}, requests{static_cast<uint32_t>(latencies_us.size())},
+    target_qps{target_qps}, achieved_qps{0}
+{
+  if (duration_us > 0)
+    achieved_qps = latencies_us.size() / (duration_us / 1e6);
+  computeFigures(std::move(latencies_us), latency);
+}
+
+void printLoadResult(const LoadResult &result)
+{
+  std::cout << "===================================" << std::endl;
+
+  std::streamsize ss_precision = std::cout.precision();
+  std::cout << std::setprecision(3);
+  std::cout << std::fixed;
+
+  std::cout << result.requests << " requests served by " << result.sessions << " sessions"
+            << std::endl;
+  if (result.target_qps > 0)
+    std::cout << "- TARGET   :  " << result.target_qps << " qps" << std::endl;
+  std::cout << "- ACHIEVED :  " << result.achieved_qps << " qps" << std::endl;
+  std::cout << "Latency" << std::endl;
+  for (auto figure : latency_figures)
+  {
+    std::cout << "- " << std::setw(9) << std::left << getFigureTypeString(figure) << ":  "
+              << result.latency[figure] << " ms" << std::endl;
+  }
+
+  std::cout << std::setprecision(ss_precision);
+  std::cout << std::defaultfloat;
+
+  std::cout << "===================================" << std::endl;
+}
+
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend)
+{
+  std::string csv_filename = exec + "-" + model + "-" + backend + "-load.csv";
+
+  CsvWriter writer(csv_filename, csv_header);
+  writer << model << backend << result.sessions << result.requests << result.target_qps
+         << result.achieved_qps;
+  for (auto figure : latency_figures)
+    writer << result.latency[figure];
+
+  if (!writer.done())
+  {
+    std::cerr << "Writing to " << csv_filename << " is failed" << std::endl;
+  }
+}
+
+} // namespace benchmark
@@ -17,6 +17,7 @@
 #include "benchmark/Result.h"
 #include "benchmark/Phases.h"
 #include "benchmark/CsvWriter.h"
+#include "Figures.h"
 
 #include <string>
 #include <numeric>
@@ -42,34 +43,19 @@ double averageTimeMs(const benchmark::Phase &phase)
   return avg_us / 1e3;
 }
 
-double maxTimeMs(const benchmark::Phase &phase)
+// Number of warm-up runs after which every run takes within 10% of the median of EXECUTE
+int warmupConvergedRuns(const benchmark::Phase &warmup, double median_ms)
 {
-  auto it = max_element(std::begin(phase.time), std::end(phase.time));
-  return *it / 1e3;
-}
-
-double minTimeMs(const benchmark::Phase &phase)
-{
-  auto it = min_element(std::begin(phase.time), std::end(phase.time));
-  return *it / 1e3;
-}
-
-double geomeanTimeMs(const benchmark::Phase &phase)
-{
-  double log_sum = 0.0;
-  for (auto t_us : phase.time)
+  int converged = -1;
+  for (size_t i = 0; i < warmup.time.size(); ++i)
   {
-    log_sum += std::log(t_us / 1e3);
+    const bool stable = std::abs(warmup.time[i] / 1e3 - median_ms) <= median_ms * 0.1;
+    if (!stable)
+      converged = -1;
+    else if (converged < 0)
+      converged = static_cast<int>(i);
   }
-
-  // Calculating geometric mean with logs
-  //   "Geometric Mean of (V1, V2, ... Vn)"
-  // = (V1*V2*...*Vn)^(1/n)
-  // = exp(log((V1*V2*...*Vn)^(1/n)))
-  // = exp(log((V1*V2*...*Vn)/n)))
-  // = exp((log(V1) + log(V2) + ... + log(Vn))/n)
-  // = exp(_log_sum/num)
-  return std::exp(log_sum / static_cast<double>(phase.time.size()));
+  return converged;
 }
 
 uint32_t averageMemoryKb(const benchmark::Phase &phase, int type)
@@ -88,7 +74,8 @@ uint32_t peakMemory(
 }
 
 void printResultTime(
-  const double time[benchmark::PhaseEnum::END_OF_PHASE][benchmark::FigureType::END_OF_FIG_TYPE])
+  const double time[benchmark::PhaseEnum::END_OF_PHASE][benchmark::FigureType::END_OF_FIG_TYPE],
+  double first_run_time, uint32_t warmup_runs, int warmup_converged)
 {
   using namespace benchmark;
 
@@ -100,19 +87,31 @@ void printResultTime(
 
   for (int i = PhaseEnum::MODEL_LOAD; i <= PhaseEnum::EXECUTE; ++i)
   {
-    // Note. Tricky. Ignore WARMUP
+    // Note. Tricky. Print the first run for WARMUP
     if (i == PhaseEnum::WARMUP)
+    {
+      std::cout << std::setw(12) << std::left << "FIRST_RUN"
+                << " takes " << first_run_time << " ms" << std::endl;
       continue;
+    }
     std::cout << std::setw(12) << std::left << getPhaseString(i) << " takes "
               << time[i][FigureType::MEAN] << " ms" << std::endl;
   }
 
-  for (int j = FigureType::MEAN; j <= FigureType::GEOMEAN; ++j)
+  for (int j = FigureType::MEAN; j < FigureType::END_OF_FIG_TYPE; ++j)
   {
     std::cout << "- " << std::setw(9) << std::left << getFigureTypeString(j) << ":  "
               << time[PhaseEnum::EXECUTE][j] << " ms" << std::endl;
   }
 
+  if (warmup_runs > 0)
+  {
+    if (warmup_converged < 0)
+      std::cout << "WARMUP does not converge in " << warmup_runs << " runs" << std::endl;
+    else
+      std::cout << "WARMUP converges after " << warmup_converged << " runs" << std::endl;
+  }
+
   std::cout << std::setprecision(ss_precision);
   std::cout << std::defaultfloat;
 
@@ -167,10 +166,14 @@ Result::Result(const Phases &phases)
 
     int i = PhaseEnum::EXECUTE;
     auto exec_phase = phases.at(gPhaseStrings[i]);
-    time[i][FigureType::MEAN] = averageTimeMs(exec_phase);
-    time[i][FigureType::MAX] = maxTimeMs(exec_phase);
-    time[i][FigureType::MIN] = minTimeMs(exec_phase);
-    time[i][FigureType::GEOMEAN] = geomeanTimeMs(exec_phase);
+    computeFigures(exec_phase.time, time[i]);
+
+    const auto &warmup_phase = phases.at(gPhaseStrings[PhaseEnum::WARMUP]);
+    warmup_runs = warmup_phase.time.size();
+    warmup_converged = warmupConvergedRuns(warmup_phase, time[i][FigureType::P50]);
+    const auto &first_phase = warmup_phase.time.empty() ? exec_phase : warmup_phase;
+    if (!first_phase.time.empty())
+      first_run_time = first_phase.time.front() / 1e3;
   }
   if (option.memory)
   {
@@ -190,7 +193,8 @@ Result::Result(const Phases &phases)
 
 void printResult(const Result &result)
 {
-  printResultTime(result.time);
+  printResultTime(result.time, result.first_run_time, result.warmup_runs,
+                  result.warmup_converged);
 
   if (result.print_memory == false)
     return;
@@ -216,6 +220,9 @@ void writeResult(const Result &result, const std::string &exec, const std::strin
   writer << time[PhaseEnum::MODEL_LOAD][FigureType::MEAN]
          << time[PhaseEnum::PREPARE][FigureType::MEAN] << time[PhaseEnum::EXECUTE][FigureType::MIN]
          << time[PhaseEnum::EXECUTE][FigureType::MAX] << time[PhaseEnum::EXECUTE][FigureType::MEAN];
+  for (int j = FigureType::STDDEV; j <= FigureType::P999; ++j)
+    writer << time[PhaseEnum::EXECUTE][j];
+  writer << std::to_string(result.warmup_converged);
 
   // memory
   auto memory = result.memory;
@@ -229,6 +236,8 @@ void writeResult(const Result &result, const std::string &exec, const std::strin
     writer << peakMemory(memory, j);
   }
 
+  writer << result.first_run_time;
+
   bool done = writer.done();
 
   if (!done)
@@ -330,6 +330,9 @@ NNFW_STATUS nnfw_await(nnfw_session *session);
  * specify an optional input, you can either not call this for that input or call this with \p
  * buffer of NULL and \p length of 0.
  *
+ * A quantized input can be given in {@link NNFW_TYPE_TENSOR_FLOAT32}, which is quantized by the
+ * runtime when each inference starts. Otherwise \p type is not used.
+ *
  * @param[in] session Session to the input is to be set
  * @param[in] index   Index of input to be set (0-indexed)
  * @param[in] type    Type of the input
@@ -349,6 +352,9 @@ NNFW_STATUS nnfw_set_input(nnfw_session *session, uint32_t index, NNFW_TYPE type
  * output operand can have unspecified shape and deduced dynamically during the execution. You must
  * provide \p buffer large enough.
  *
+ * A quantized output can be taken in {@link NNFW_TYPE_TENSOR_FLOAT32}, which is dequantized by the
+ * runtime when each inference ends. Otherwise \p type is not used.
+ *
  * @param[in]   session Session from inference output is to be extracted
  * @param[in]   index   Index of output to be set (0-indexed)
  * @param[in]   type    Type of the output
@@ -62,6 +62,118 @@ typedef struct
 NNFW_STATUS nnfw_register_custom_op_info(nnfw_session *session, const char *id,
                                          custom_kernel_registration_info *info);
 
+/**
+ * @brief Context of a custom kernel given to its callbacks
+ *
+ * It keeps the state of the kernel between callbacks, and gives the scratch memory and the threads
+ * of the runtime to the kernel.
+ */
+typedef struct nnfw_custom_context nnfw_custom_context;
+
+/**
+ * @brief One-time preparation of a custom kernel
+ *
+ * It is called once before the first run, when constant inputs are available. It may set the
+ * state of the kernel by {@link nnfw_custom_set_state} and request scratch memory by
+ * {@link nnfw_custom_request_scratch}. Buffers of non-constant inputs and outputs are not valid.
+ *
+ * @param[in] context       the context of the kernel
+ * @param[in] params        inputs and outputs of the kernel
+ * @param[in] userdata      the custom options of the operation in the model
+ * @param[in] userdata_size the size of \p userdata
+ * @return    @c NNFW_STATUS_NO_ERROR if successful, otherwise the session fails to run
+ */
+typedef NNFW_STATUS (*nnfw_custom_prepare)(nnfw_custom_context *context,
+                                           const nnfw_custom_kernel_params *params,
+                                           const char *userdata, size_t userdata_size);
+
+/**
+ * @brief Run of a custom kernel
+ *
+ * Allocations of \p params are the buffers of the tensors themselves, which are read and written
+ * in place.
+ *
+ * @param[in] context the context of the kernel
+ * @param[in] params  inputs and outputs of the kernel with their current shapes
+ * @return    @c NNFW_STATUS_NO_ERROR if successful, otherwise the run fails
+ */
+typedef NNFW_STATUS (*nnfw_custom_run)(nnfw_custom_context *context,
+                                       nnfw_custom_kernel_params *params);
+
+/**
+ * @brief Release of the state set by a custom kernel, called when the kernel is destroyed
+ */
+typedef void (*nnfw_custom_release)(void *state);
+
+/**
+ * @brief Callbacks of a custom kernel, where only @c run is mandatory
+ */
+typedef struct
+{
+  nnfw_custom_prepare prepare;
+  nnfw_custom_run run;
+  nnfw_custom_release release;
+} nnfw_custom_kernel_info;
+
+/**
+ * @brief Register a custom kernel with the prepare and run callbacks
+ *
+ * It works like {@link nnfw_register_custom_op_info}, and the kernel prepared once keeps its
+ * state, scratch memory of the session and the threads of the runtime over runs.
+ * It must be called before {@link nnfw_prepare}.
+ *
+ * @param[in] session the session to register the kernel
+ * @param[in] id      the custom code of the operation in the model
+ * @param[in] info    the callbacks of the kernel, which are copied
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_register_custom_kernel(nnfw_session *session, const char *id,
+                                        const nnfw_custom_kernel_info *info);
+
+/**
+ * @brief Set the state of a custom kernel, which is given to the release callback at last
+ */
+void nnfw_custom_set_state(nnfw_custom_context *context, void *state);
+
+/**
+ * @brief Get the state of a custom kernel, or null if it is not set
+ */
+void *nnfw_custom_get_state(nnfw_custom_context *context);
+
+/**
+ * @brief Request scratch memory for each run of a custom kernel, in its prepare callback
+ *
+ * The memory is taken from the memory of the session only while the kernel runs, so it is reused
+ * by other kernels. Its contents are not kept between runs.
+ *
+ * @param[in] context the context of the kernel
+ * @param[in] size    the size in bytes, which replaces the size requested before
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_custom_request_scratch(nnfw_custom_context *context, size_t size);
+
+/**
+ * @brief Get the scratch memory of a custom kernel in its run callback, or null if none is
+ *        requested
+ */
+void *nnfw_custom_scratch(nnfw_custom_context *context);
+
+/**
+ * @brief Run \p fn over ranges splitting [0, \p size) on the threads of the runtime, and return
+ *        when all of them are done
+ *
+ * It shares the threads with the kernels of the runtime by the thread budget, so it may run on the
+ * calling thread alone.
+ *
+ * @param[in] context the context of the kernel
+ * @param[in] size    the number of items
+ * @param[in] cost    the estimated cost of all the items, e.g. the number of elements to compute
+ * @param[in] fn      the function called with the range [\p begin, \p end) and \p data
+ * @param[in] data    the data given to \p fn
+ */
+void nnfw_custom_parallel_for(nnfw_custom_context *context, uint32_t size, uint64_t cost,
+                              void (*fn)(uint32_t begin, uint32_t end, void *data), void *data);
+
 /**
  * @brief Get the input tensor index by name
  *
@@ -112,6 +224,190 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
  */
 NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *backend_settings);
 
+/**
+ * @brief Register buffers of all inputs and outputs to be bound at once for later runs
+ *
+ * A ring of persistent buffers can be registered once in different slots, and each run binds one
+ * of them by {@link nnfw_use_io_buffers} instead of setting every input and output. The lengths are
+ * validated here against the shapes the session is prepared for, so binding costs nothing.
+ * Registering a slot again replaces its buffers. Buffers are in NHWC layout.
+ *
+ * @note Memory of other devices, e.g. dma-buf, can be registered after mapping it to the process
+ *       with mmap. Synchronizing it with the device is up to the application.
+ *
+ * @param[in] session        the prepared session
+ * @param[in] slot           the index of the set of buffers
+ * @param[in] inputs         the buffer of each input, in the order of the inputs
+ * @param[in] input_lengths  the length in bytes of each input buffer
+ * @param[in] outputs        the buffer of each output, in the order of the outputs
+ * @param[in] output_lengths the length in bytes of each output buffer
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_register_io_buffers(nnfw_session *session, uint32_t slot, const void **inputs,
+                                     const size_t *input_lengths, void **outputs,
+                                     const size_t *output_lengths);
+
+/**
+ * @brief Bind the buffers registered in a slot for next runs
+ *
+ * They are bound until {@link nnfw_set_input}, {@link nnfw_set_output}, their layouts or
+ * {@link nnfw_set_input_tensorinfo} are set again.
+ *
+ * @param[in] session the session
+ * @param[in] slot    the index of the set of buffers registered by
+ *                    {@link nnfw_register_io_buffers}
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_use_io_buffers(nnfw_session *session, uint32_t slot);
+
+/**
+ * @brief Callback called when a run started by {@link nnfw_run_async_with_callback} finishes
+ *
+ * @param[in] session   the session that finished running
+ * @param[in] status    @c NNFW_STATUS_NO_ERROR if the run succeeded
+ * @param[in] user_data the data given with the callback
+ */
+typedef void (*nnfw_completion_callback)(nnfw_session *session, NNFW_STATUS status,
+                                         void *user_data);
+
+/**
+ * @brief Run inference asynchronously and call a callback when it finishes
+ *
+ * It works like {@link nnfw_run_async}, and calls \p callback on a worker thread when the run
+ * finishes. {@link nnfw_await} still must be called before the next run, and it does not block
+ * once the callback is called. It may be called from the callback too.
+ * Asynchronous runs of all sessions share a pool of workers, whose size is ASYNC_THREADS
+ * (the number of cores by default), so runs of different sessions can be in flight together.
+ *
+ * @param[in] session   the session to run
+ * @param[in] callback  the function to call when the run finishes
+ * @param[in] user_data the data given to \p callback
+ * @return    @c NNFW_STATUS_NO_ERROR if the run is started
+ */
+NNFW_STATUS nnfw_run_async_with_callback(nnfw_session *session, nnfw_completion_callback callback,
+                                         void *user_data);
+
+/**
+ * @brief Warm up a prepared session to take the costs of the first run in advance
+ *
+ * The first run is slower than the others because it faults in pages of memory and mmap'd
+ * weights, and backends compile GPU kernels or pack weights on it. This runs inference
+ * \p runs times with zero-filled inputs of the shapes set so far, so that later runs do not pay
+ * for them. Inputs and outputs set to the session are neither read nor written.
+ *
+ * @param[in] session the prepared session
+ * @param[in] runs    the number of runs, which must be positive
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_warmup(nnfw_session *session, uint32_t runs);
+
+/**
+ * @brief Set priority of runs of a prepared session over other sessions in the process
+ *
+ * While a session runs, runs of sessions with lower priority wait between operations until it
+ * finishes, so that a latency-critical model gets the cores shared with background models.
+ * An operation already started is not interrupted. Sessions of the same priority do not wait for
+ * each other, and the priority of all sessions is 0 by default.
+ *
+ * @param[in] session  the prepared session
+ * @param[in] priority the priority, where higher runs first
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_priority(nnfw_session *session, int32_t priority);
+
+/**
+ * @brief Release memory of a prepared session while it is idle
+ *
+ * Memory of non-constant tensors and memory kept for dynamic tensors are freed, and weights
+ * packed by backends as well if \p packed_weights is non-zero. The session stays prepared, and
+ * the next run acquires memory again before it starts, which costs the allocation, rebinding of
+ * tensors and page faults of the first run, and packing weights again if they are released.
+ * Values of non-constant tensors are not kept over it, except states kept for
+ * {@link nnfw_reset_states}. Backends other than cpu and ruy keep their memory.
+ *
+ * @param[in]  session        the prepared session, which must not be running
+ * @param[in]  packed_weights non-zero if weights packed by backends are released as well
+ * @param[out] released_bytes bytes of tensor memory released, which may be null. It is an upper
+ *                            bound when arenas are shared with other sessions.
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_release_idle_memory(nnfw_session *session, int32_t packed_weights,
+                                     uint64_t *released_bytes);
+
+/**
+ * @brief Reset states of a prepared session to start a new stream
+ *
+ * Variable tensors of the model, e.g. states of LSTM which TensorFlow Lite models keep as variable
+ * tensors, stay in the session between runs, so a run of a streaming model takes only its new
+ * frame by {@link nnfw_set_input}, without states fed back by inputs and outputs. The states are
+ * zeros after prepare and after this call. Backends other than cpu and ruy do not keep them.
+ *
+ * @param[in] session the prepared session, which must not be running
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_reset_states(nnfw_session *session);
+
+/**
+ * @brief Create a session prepared for the same model as a prepared session
+ *
+ * The clone shares constant data of the model with \p session, but it has its own compiled kernels
+ * and memory for other tensors. Thus the sessions can run at the same time on different threads
+ * while weights are loaded only once. Options set to \p session before prepare are applied to the
+ * clone too. The clone should be closed by {@link nnfw_close_session}, before or after \p session.
+ *
+ * @param[in]  session the prepared session to clone
+ * @param[out] clone   the prepared clone
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_clone_session(nnfw_session *session, nnfw_session **clone);
+
+/**
+ * @brief Batcher to run single-sample requests in batches on a session
+ */
+typedef struct nnfw_batcher nnfw_batcher;
+
+/**
+ * @brief Create a batcher running requests in batches on a prepared session
+ *
+ * Requests given by {@link nnfw_batcher_run} are collected until there are \p max_batch ones or the
+ * first one has waited for \p timeout_us, which bounds the latency added by batching. Then inputs
+ * of the requests are concatenated along the first axis and the batch runs once with
+ * {@link nnfw_run_async} and {@link nnfw_await}. Every input and output of the session must have
+ * batch 1 on the first axis.
+ *
+ * @note The session must not be used directly until the batcher is closed. Executors compiled for
+ *       each batch size can be cached with SHAPE_CACHE_SIZE, and SHAPE_BUCKET_AXIS=0 pads batches
+ *       up to powers of two to bound the number of them.
+ *
+ * @param[in]  session    the prepared session
+ * @param[in]  max_batch  the maximum number of requests in a batch
+ * @param[in]  timeout_us the maximum time in microseconds for a request to wait for others
+ * @param[out] batcher    the batcher created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_batcher(nnfw_session *session, uint32_t max_batch, uint32_t timeout_us,
+                                nnfw_batcher **batcher);
+
+/**
+ * @brief Run a request in a batch and wait for it to finish
+ *
+ * This function can be called on many threads at the same time.
+ *
+ * @param[in] batcher the batcher
+ * @param[in] inputs  buffers of a sample for each input, in the order of the inputs
+ * @param[in] outputs buffers of a sample for each output, in the order of the outputs
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_batcher_run(nnfw_batcher *batcher, const void **inputs, void **outputs);
+
+/**
+ * @brief Close a batcher after running the requests given before
+ *
+ * @param[in] batcher the batcher to close
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_close_batcher(nnfw_batcher *batcher);
+
 /*
  * Prepare session to be ready for inference
  * This phase may finalize model compilation, scheduling, and additional settings.
@@ -121,6 +417,21 @@ NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *b
  */
 NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path = nullptr);
 
+/**
+ * @brief Prepare session to stream inferences through stages split by backend
+ *
+ * It works like {@link nnfw_prepare_pipeline} with a partition map made from the model. The model
+ * is split where operations move between the host and an accelerator, e.g. into preprocessing on
+ * cpu, a Bulk operation on trix and postprocessing on cpu. Every stage runs on its own thread, so
+ * preprocessing of an inference and postprocessing of the previous one overlap the accelerator
+ * running another one. Inputs and outputs are given by {@link nnfw_push_pipeline_input} and
+ * {@link nnfw_pop_pipeline_output}.
+ *
+ * @param session the session to be prepared
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_prepare_streaming(nnfw_session *session);
+
 /**
  * @brief     Set input buffer
  *
@@ -152,4 +463,96 @@ NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *
  */
 NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs);
 
+/**
+ * @brief       Get the average time a stage of the pipeline takes to run an inference
+ *
+ * The slowest stage bounds the throughput of the pipeline, so stage times show how to balance
+ * partitions of the model. Time each stage waits for other stages is not counted. If the
+ * PIPELINE_BALANCE_RUNS config is set, the session also warns once that number of outputs are
+ * popped if stage times differ more than the PIPELINE_BALANCE_TOL config in percent.
+ *
+ * @param[in]   session Session prepared by {@link nnfw_prepare_pipeline}
+ * @param[in]   stage   Index of the stage, i.e. the partition
+ * @param[out]  time_us Average time in microseconds, or 0 if the stage has not run
+ *
+ * @return      @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_pipeline_stage_time(nnfw_session *session, uint32_t stage, uint64_t *time_us);
+
+/**
+ * @brief Maximum number of backends whose times are reported by {@link nnfw_query_run_stats}
+ */
+#define NNFW_MAX_RUN_STATS_BACKENDS (8)
+
+/**
+ * @brief Maximum length of backend ids in {@link nnfw_run_stats}, including the terminating null
+ */
+#define NNFW_MAX_BACKEND_ID_LENGTH (32)
+
+/**
+ * @brief Time of operations on a backend in a run
+ */
+typedef struct nnfw_backend_time
+{
+  /** The backend id, e.g. "cpu" */
+  char backend[NNFW_MAX_BACKEND_ID_LENGTH];
+  /** The time in microseconds */
+  uint64_t time_us;
+} nnfw_backend_time;
+
+/**
+ * @brief Breakdown of the time and memory of a run
+ *
+ * <p>Times of operations are measured on the host, so backends running asynchronously such as
+ * GPU backends are counted for the time to enqueue their work.
+ */
+typedef struct nnfw_run_stats
+{
+  /** The time of the whole run in microseconds */
+  uint64_t total_us;
+  /** The time of permutations between backends and layouts in microseconds */
+  uint64_t permute_us;
+  /** The time of operations with dynamic tensors in microseconds, counted in backends as well */
+  uint64_t dynamic_shape_us;
+  /** The peak bytes of memory for tensors of backends which track it, e.g. cpu */
+  uint64_t peak_memory;
+  /** The number of backends in 'backends' */
+  uint32_t num_backends;
+  /** The time of operations on each backend except permutations */
+  nnfw_backend_time backends[NNFW_MAX_RUN_STATS_BACKENDS];
+} nnfw_run_stats;
+
+/**
+ * @brief Get the breakdown of the time and memory of the last run
+ *
+ * Stats are collected only if the RUN_STATS config is set to the session before prepare. Each
+ * operation is timed by the host clock, which costs little enough to keep it in production, but
+ * kernels of a run are no longer fused into a single plan while it is set.
+ *
+ * @param[in]  session the session prepared with the RUN_STATS config
+ * @param[out] stats   the stats of the last run finished
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_query_run_stats(nnfw_session *session, nnfw_run_stats *stats);
+
+/**
+ * @brief Set the service level objective of a session, which prepare chooses configs to meet
+ *
+ * At {@link nnfw_prepare}, the model is compiled and warmed up with the configs of the session
+ * first. If the objective is not met, memory planners of the cpu backend are tried for the memory
+ * cap, and then more threads of ruy and backends for all operations for the latency target, one
+ * at a time while keeping the best. The first configs which meet the objective are used for the
+ * session and its clones, and prepare fails with an error message about the closest one if none
+ * meets it, leaving the session as it was loaded.
+ *
+ * Memory is the peak of tensors of backends which track it as in {@link nnfw_run_stats}, and the
+ * latency is the average of runs of zero inputs, so models with dynamic inputs are not supported.
+ *
+ * @param[in] session     the session with a model loaded, before prepare
+ * @param[in] peak_memory the cap of the peak memory of tensors in bytes, 0 if none
+ * @param[in] latency_us  the target of the time of a run in microseconds, 0 if none
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_slo(nnfw_session *session, uint64_t peak_memory, uint64_t latency_us);
+
 #endif // __NNFW_EXPERIMENTAL_H__
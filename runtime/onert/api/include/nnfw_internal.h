@@ -35,6 +35,36 @@ NNFW_STATUS nnfw_get_config(nnfw_session *session, const char *key, char *value,
  */
 NNFW_STATUS nnfw_load_circle_from_buffer(nnfw_session *session, uint8_t *buffer, size_t size);
 
+/**
+ * @brief Function reading the next bytes of a model stream
+ *
+ * @param[in] user_data User data given with the function
+ * @param[in] dst       Destination of the bytes
+ * @param[in] size      Maximum number of bytes to read
+ * @return    Number of bytes read, 0 at the end of the stream or negative value on error
+ */
+typedef int64_t (*nnfw_stream_read)(void *user_data, uint8_t *dst, size_t size);
+
+/**
+ * @brief Load a circle model from a non-seekable stream.
+ *
+ * It returns once the graph structure arrives, and the stream is read on another thread until
+ * its end. Constants stored after the flatbuffer with @c offset and @c size of circle Buffer
+ * are waited for when backends initialize them, so that model preparation overlaps with their
+ * arrival. A model with constants only in the flatbuffer is waited for as a whole.
+ *
+ * @c read is called with @c user_data until the whole model is read, so @c user_data must
+ * be valid until then.
+ *
+ * @param[in] session   session
+ * @param[in] size      Size of the whole model
+ * @param[in] read      Function reading the stream
+ * @param[in] user_data User data given to @c read
+ * @return NNFW_STATUS
+ */
+NNFW_STATUS nnfw_load_circle_from_stream(nnfw_session *session, size_t size,
+                                         nnfw_stream_read read, void *user_data);
+
 /**
  * @brief Load a tflite/circle model from file.
  *
@@ -16,6 +16,9 @@
 
 #include "CustomKernel.h"
 
+#include <cassert>
+#include <stdexcept>
+
 namespace onert
 {
 namespace api
@@ -63,8 +66,22 @@ public:
 };
 
 CustomKernel::CustomKernel(const nnfw_custom_eval evalFunction)
-  : _in_params(), _userdata(nullptr), _userdata_size(0), _evalFunction(evalFunction)
+  : _in_params(), _userdata(nullptr), _userdata_size(0), _evalFunction(evalFunction), _info(),
+    _context(), _params()
+{
+}
+
+CustomKernel::CustomKernel(const std::string &id, const nnfw_custom_kernel_info &info)
+  : _in_params(), _userdata(nullptr), _userdata_size(0), _evalFunction(nullptr), _id(id),
+    _info(info), _context(), _params()
+{
+  assert(_info.run != nullptr);
+}
+
+CustomKernel::~CustomKernel()
 {
+  if (_info.release && _context.state)
+    _info.release(_context.state);
 }
 
 void CustomKernel::configure(CustomKernelConfigParams &&inParams)
@@ -73,38 +90,79 @@ void CustomKernel::configure(CustomKernelConfigParams &&inParams)
   _userdata_size = inParams.userdata_size;
 
   _in_params = std::move(inParams);
+  _context.params = &_in_params;
+
+  _inputs.resize(_in_params.input_tensors.size());
+  _outputs.resize(_in_params.output_tensors.size());
+  _params.ninputs = _inputs.size();
+  _params.inputs = _inputs.data();
+  _params.noutputs = _outputs.size();
+  _params.outputs = _outputs.data();
 }
 
-void CustomKernel::run()
+void CustomKernel::updateParams()
 {
-  nnfw_custom_kernel_params params;
+  // Tensors may be moved to other buffers or get other shapes between runs
+  auto convert = [](backend::IPortableTensor *tensor) {
+    return APIConverter::convertOperand(tensor->buffer(),
+                                        TypeInfo{tensor->getShape(), tensor->data_type()});
+  };
+  for (size_t i = 0; i < _inputs.size(); ++i)
+    _inputs[i] = convert(_in_params.input_tensors[i]);
+  for (size_t i = 0; i < _outputs.size(); ++i)
+    _outputs[i] = convert(_in_params.output_tensors[i]);
+}
 
-  // set input tensor buffer and types
-  params.ninputs = _in_params.input_tensors.size();
-  params.inputs = new nnfw_operand[params.ninputs];
+void CustomKernel::prepare()
+{
+  if (_prepared)
+    return;
+  _prepared = true;
 
-  for (size_t i = 0; i < params.ninputs; ++i)
+  if (_info.prepare == nullptr)
+    return;
+
+  updateParams();
+  if (_info.prepare(&_context, &_params, _userdata, _userdata_size) != NNFW_STATUS_NO_ERROR)
+    throw std::runtime_error("Failed to prepare custom kernel " + _id);
+}
+
+void CustomKernel::run()
+{
+  updateParams();
+
+  if (_evalFunction)
   {
-    auto *buf = _in_params.input_tensors[i]->buffer();
-    assert(buf);
-    params.inputs[i] = APIConverter::convertOperand(buf, _in_params.input_types[i]);
+    for (size_t i = 0; i < _inputs.size(); ++i)
+      assert(_inputs[i].allocation);
+    for (size_t i = 0; i < _outputs.size(); ++i)
+      assert(_outputs[i].allocation);
+    _evalFunction(&_params, _userdata, _userdata_size);
+    return;
   }
 
-  // set output tensor buffer and types
-  params.noutputs = _in_params.output_tensors.size();
-  params.outputs = new nnfw_operand[params.noutputs];
+  // Backends may not prepare functions before the first run
+  prepare();
 
-  for (size_t i = 0; i < params.noutputs; ++i)
+  auto &scratch = _in_params.scratch;
+  if (_context.scratch_size > 0)
   {
-    auto *buf = _in_params.output_tensors[i]->buffer();
-    assert(buf);
-    params.outputs[i] = APIConverter::convertOperand(buf, _in_params.output_types[i]);
+    if (scratch == nullptr)
+      throw std::runtime_error("Backend does not support scratch memory of custom kernel " + _id);
+    scratch->applyShape(ir::Shape{static_cast<int32_t>(_context.scratch_size)});
+    _context.scratch = scratch->buffer();
   }
 
-  _evalFunction(&params, _userdata, _userdata_size);
+  const auto status = _info.run(&_context, &_params);
+
+  if (_context.scratch)
+  {
+    scratch->deallocBuffer();
+    _context.scratch = nullptr;
+  }
 
-  delete[] params.inputs;
-  delete[] params.outputs;
+  if (status != NNFW_STATUS_NO_ERROR)
+    throw std::runtime_error("Failed to run custom kernel " + _id);
 }
 
 } // namespace api
@@ -22,8 +22,20 @@
 #include "backend/CustomKernelBuilder.h"
 #include "exec/IFunction.h"
 
+#include <string>
 #include <vector>
 
+/**
+ * @brief Context of a kernel registered by nnfw_register_custom_kernel, given to its callbacks
+ */
+struct nnfw_custom_context
+{
+  void *state = nullptr;
+  size_t scratch_size = 0;
+  void *scratch = nullptr;
+  const onert::backend::custom::CustomKernelConfigParams *params = nullptr;
+};
+
 namespace onert
 {
 namespace api
@@ -33,6 +45,8 @@ class CustomKernel : public ::onert::exec::IFunction
 {
 public:
   explicit CustomKernel(nnfw_custom_eval evalFunction);
+  CustomKernel(const std::string &id, const nnfw_custom_kernel_info &info);
+  ~CustomKernel() override;
 
   backend::custom::CustomKernelConfigParams _in_params;
 
@@ -42,13 +56,35 @@ public:
   nnfw_custom_eval _evalFunction;
   // nnfw_custom_type_infer _type_infer_function; //Unused for now
 
+  // Kernel registered by nnfw_register_custom_kernel, whose run is not null
+  std::string _id;
+  nnfw_custom_kernel_info _info;
+  nnfw_custom_context _context;
+
   /**
    * Fills _params field used later by user specified eval function
    * @param inParams custom kernel parameters
    */
   virtual void configure(backend::custom::CustomKernelConfigParams &&inParams);
 
+  /**
+   * Calls the prepare callback of the kernel once, after constants are initialized
+   */
+  void prepare() override;
+
   void run() override;
+
+private:
+  /**
+   * Updates _params with the current buffers and shapes of the tensors
+   */
+  void updateParams();
+
+private:
+  nnfw_custom_kernel_params _params;
+  std::vector<nnfw_operand> _inputs;
+  std::vector<nnfw_operand> _outputs;
+  bool _prepared = false;
 };
 
 } // namespace api
@@ -47,6 +47,12 @@ void CustomKernelRegistry::registerKernel(const std::string &id, nnfw_custom_eva
   _storage.emplace(id, evalFunction);
 }
 
+void CustomKernelRegistry::registerKernel(const std::string &id,
+                                          const nnfw_custom_kernel_info &info)
+{
+  _kernel_infos[id] = info;
+}
+
 std::shared_ptr<backend::custom::IKernelBuilder> CustomKernelRegistry::getBuilder()
 {
   return std::make_unique<KernelBuilder>(this);
@@ -54,6 +60,10 @@ std::shared_ptr<backend::custom::IKernelBuilder> CustomKernelRegistry::getBuilde
 
 std::unique_ptr<CustomKernel> CustomKernelRegistry::buildKernelForOp(const std::string &id)
 {
+  auto info = _kernel_infos.find(id);
+  if (info != _kernel_infos.end())
+    return std::make_unique<CustomKernel>(id, info->second);
+
   auto it = _storage.find(id);
   if (it == _storage.end())
   {
@@ -34,12 +34,14 @@ class CustomKernelRegistry
 {
 public:
   void registerKernel(const std::string &id, nnfw_custom_eval evalFunction);
+  void registerKernel(const std::string &id, const nnfw_custom_kernel_info &info);
 
   std::shared_ptr<backend::custom::IKernelBuilder> getBuilder();
   std::unique_ptr<CustomKernel> buildKernelForOp(const std::string &id);
 
 private:
   std::unordered_map<std::string, nnfw_custom_eval> _storage;
+  std::unordered_map<std::string, nnfw_custom_kernel_info> _kernel_infos;
 };
 
 } // namespace api
@@ -15,7 +15,11 @@
  */
 
 #include "nnfw_api_internal.h"
+#include "nnfw_batcher.h"
 #include "nnfw_version.h"
+#include "CustomKernel.h"
+
+#include <limits>
 
 // Double-check enum value changes
 
@@ -276,6 +280,59 @@ NNFW_STATUS nnfw_register_custom_op_info(nnfw_session *session, const char *id,
   return session->register_custom_operation(id, info->eval_function);
 }
 
+NNFW_STATUS nnfw_register_custom_kernel(nnfw_session *session, const char *id,
+                                        const nnfw_custom_kernel_info *info)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  NNFW_RETURN_ERROR_IF_NULL(id);
+  NNFW_RETURN_ERROR_IF_NULL(info);
+  return session->register_custom_kernel(id, *info);
+}
+
+void nnfw_custom_set_state(nnfw_custom_context *context, void *state)
+{
+  if (context)
+    context->state = state;
+}
+
+void *nnfw_custom_get_state(nnfw_custom_context *context)
+{
+  return context ? context->state : nullptr;
+}
+
+NNFW_STATUS nnfw_custom_request_scratch(nnfw_custom_context *context, size_t size)
+{
+  NNFW_RETURN_ERROR_IF_NULL(context);
+  // The scratch tensor is of a 1-D shape, whose dimension is int32_t
+  if (size > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  context->scratch_size = size;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+void *nnfw_custom_scratch(nnfw_custom_context *context)
+{
+  return context ? context->scratch : nullptr;
+}
+
+void nnfw_custom_parallel_for(nnfw_custom_context *context, uint32_t size, uint64_t cost,
+                              void (*fn)(uint32_t begin, uint32_t end, void *data), void *data)
+{
+  if (fn == nullptr || size == 0)
+    return;
+
+  const auto *params = context ? context->params : nullptr;
+  if (params == nullptr || !params->parallel_for ||
+      size > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+  {
+    fn(0, size, data);
+    return;
+  }
+  params->parallel_for(static_cast<int>(size), cost, [&](int begin, int end) {
+    fn(static_cast<uint32_t>(begin), static_cast<uint32_t>(end), data);
+  });
+}
+
 NNFW_STATUS nnfw_apply_tensorinfo(nnfw_session *session, uint32_t index,
                                   nnfw_tensorinfo tensor_info)
 {
@@ -351,6 +408,13 @@ NNFW_STATUS nnfw_load_circle_from_buffer(nnfw_session *session, uint8_t *buffer,
   return session->load_circle_from_buffer(buffer, size);
 }
 
+NNFW_STATUS nnfw_load_circle_from_stream(nnfw_session *session, size_t size,
+                                         nnfw_stream_read read, void *user_data)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->load_circle_from_stream(size, read, user_data);
+}
+
 NNFW_STATUS nnfw_load_model_from_modelfile(nnfw_session *session, const char *file_path)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
@@ -375,12 +439,121 @@ NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *b
   return session->set_backends_per_operation(backend_settings);
 }
 
+NNFW_STATUS nnfw_register_io_buffers(nnfw_session *session, uint32_t slot, const void **inputs,
+                                     const size_t *input_lengths, void **outputs,
+                                     const size_t *output_lengths)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  NNFW_RETURN_ERROR_IF_NULL(inputs);
+  NNFW_RETURN_ERROR_IF_NULL(input_lengths);
+  NNFW_RETURN_ERROR_IF_NULL(outputs);
+  NNFW_RETURN_ERROR_IF_NULL(output_lengths);
+  return session->register_io_buffers(slot, inputs, input_lengths, outputs, output_lengths);
+}
+
+NNFW_STATUS nnfw_use_io_buffers(nnfw_session *session, uint32_t slot)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->use_io_buffers(slot);
+}
+
+NNFW_STATUS nnfw_run_async_with_callback(nnfw_session *session, nnfw_completion_callback callback,
+                                         void *user_data)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  NNFW_RETURN_ERROR_IF_NULL(callback);
+  return session->run_async(callback, user_data);
+}
+
+NNFW_STATUS nnfw_warmup(nnfw_session *session, uint32_t runs)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->warmup(runs);
+}
+
+NNFW_STATUS nnfw_query_run_stats(nnfw_session *session, nnfw_run_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->query_run_stats(stats);
+}
+
+NNFW_STATUS nnfw_set_slo(nnfw_session *session, uint64_t peak_memory, uint64_t latency_us)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_slo(peak_memory, latency_us);
+}
+
+NNFW_STATUS nnfw_set_priority(nnfw_session *session, int32_t priority)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_priority(priority);
+}
+
+NNFW_STATUS nnfw_release_idle_memory(nnfw_session *session, int32_t packed_weights,
+                                     uint64_t *released_bytes)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->release_idle_memory(packed_weights != 0, released_bytes);
+}
+
+NNFW_STATUS nnfw_reset_states(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->reset_states();
+}
+
+NNFW_STATUS nnfw_clone_session(nnfw_session *session, nnfw_session **clone)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  NNFW_RETURN_ERROR_IF_NULL(clone);
+  return session->clone(clone);
+}
+
+NNFW_STATUS nnfw_create_batcher(nnfw_session *session, uint32_t max_batch, uint32_t timeout_us,
+                                nnfw_batcher **batcher)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  NNFW_RETURN_ERROR_IF_NULL(batcher);
+
+  auto created = new (std::nothrow) nnfw_batcher(session, max_batch, timeout_us);
+  if (created == nullptr)
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  auto status = created->prepare();
+  if (status != NNFW_STATUS_NO_ERROR)
+  {
+    delete created;
+    return status;
+  }
+  *batcher = created;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_batcher_run(nnfw_batcher *batcher, const void **inputs, void **outputs)
+{
+  NNFW_RETURN_ERROR_IF_NULL(batcher);
+  NNFW_RETURN_ERROR_IF_NULL(inputs);
+  NNFW_RETURN_ERROR_IF_NULL(outputs);
+  return batcher->run(inputs, outputs);
+}
+
+NNFW_STATUS nnfw_close_batcher(nnfw_batcher *batcher)
+{
+  delete batcher;
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->prepare_pipeline(map_file_path);
 }
 
+NNFW_STATUS nnfw_prepare_streaming(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->prepare_streaming();
+}
+
 NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
@@ -393,3 +566,9 @@ NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
   NNFW_RETURN_ERROR_IF_NULL(session);
   return session->pop_pipeline_output((std::vector<void *> *)outputs);
 }
+
+NNFW_STATUS nnfw_pipeline_stage_time(nnfw_session *session, uint32_t stage, uint64_t *time_us)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->pipeline_stage_time(stage, time_us);
+}
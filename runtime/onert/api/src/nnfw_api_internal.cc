@@ -20,17 +20,28 @@
 #include "util/ConfigSource.h"
 #include "util/Exceptions.h"
 #include "util/logging.h"
+#include "exec/DriftMonitor.h"
 #include "exec/Execution.h"
+#include "exec/MinMaxRecords.h"
+#include "exec/RunStats.h"
 #include "circle_loader.h"
+#include "stream_buffer.h"
 #include "tflite_loader.h"
 #include "trix_loader.h"
 #include "json/json.h"
 #include "ir/OpCode.h"
+#include "ir/SharedBackbone.h"
 #include "util/TracingCtx.h"
+#include "backend/basic/SharedArena.h"
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 #include <dirent.h>
 #include <misc/string_helpers.h>
@@ -184,6 +195,13 @@ NNFW_TYPE datatype_to_nnfw_dtype(onert::ir::DataType dt)
   }
 }
 
+bool isQuantized(onert::ir::DataType dt)
+{
+  using onert::ir::DataType;
+  return dt == DataType::QUANT_UINT8_ASYMM || dt == DataType::QUANT_INT8_ASYMM ||
+         dt == DataType::QUANT_INT16_SYMM;
+}
+
 void fillTensorInfo(nnfw_tensorinfo *ti, const onert::ir::Shape &shape,
                     const onert::ir::DataType &dtype)
 {
@@ -195,6 +213,68 @@ void fillTensorInfo(nnfw_tensorinfo *ti, const onert::ir::Shape &shape,
   ti->dtype = datatype_to_nnfw_dtype(dtype);
 }
 
+std::shared_ptr<onert::ir::Subgraphs> cloneSubgraphs(const onert::ir::Subgraphs &subgraphs)
+{
+  auto cloned = std::make_shared<onert::ir::Subgraphs>();
+  subgraphs.iterate([&](const onert::ir::SubgraphIndex &index, const onert::ir::Graph &subg) {
+    auto graph = std::make_shared<onert::ir::Graph>(subg);
+    graph->setSubgraphs(cloned);
+    cloned->push(index, graph);
+  });
+  return cloned;
+}
+
+std::vector<onert::ir::Shape> getInputShapes(const onert::exec::Execution &execution)
+{
+  std::vector<onert::ir::Shape> shapes;
+  const auto num_inputs = execution.primary_subgraph().getInputs().size();
+  for (uint32_t i = 0; i < num_inputs; ++i)
+    shapes.push_back(execution.getInputShape(onert::ir::IOIndex{i}));
+  return shapes;
+}
+
+int32_t roundUpToBucket(int32_t len, const std::vector<int32_t> &buckets)
+{
+  if (buckets.empty())
+  {
+    int32_t bucket = 1;
+    while (bucket < len && bucket <= std::numeric_limits<int32_t>::max() / 2)
+      bucket *= 2;
+    return std::max(bucket, len);
+  }
+  auto it = std::lower_bound(buckets.begin(), buckets.end(), len);
+  return it == buckets.end() ? len : *it;
+}
+
+// Return the scope of configs, or nullptr if there is none to override
+std::unique_ptr<onert::util::ScopedConfig>
+scopeConfigs(const std::unordered_map<std::string, std::string> &configs)
+{
+  if (configs.empty())
+    return nullptr;
+  return std::make_unique<onert::util::ScopedConfig>(configs);
+}
+
+NNFW_STATUS toStatus(std::exception_ptr error)
+{
+  if (!error)
+    return NNFW_STATUS_NO_ERROR;
+
+  try
+  {
+    std::rethrow_exception(error);
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    // Currently insufficient buffer always means output buffer.
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (...)
+  {
+    return NNFW_STATUS_ERROR;
+  }
+}
+
 } // namespace
 
 nnfw_session::nnfw_session()
@@ -235,6 +315,38 @@ NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::load_circle_from_stream(size_t size, nnfw_stream_read read,
+                                                 void *user_data)
+{
+  if (!isStateInitialized())
+    return NNFW_STATUS_INVALID_STATE;
+
+  if (!read)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (size == 0)
+    return NNFW_STATUS_ERROR;
+
+  try
+  {
+    auto stream = std::make_shared<onert::base_loader::StreamBuffer>(
+      size, [read, user_data](uint8_t *dst, size_t size) { return read(user_data, dst, size); });
+    _subgraphs = onert::circle_loader::loadModel(stream);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during model loading : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _tracing_ctx = std::make_unique<onert::util::TracingCtx>(_subgraphs.get());
+
+  _compiler = std::make_unique<onert::compiler::Compiler>(_subgraphs, _tracing_ctx.get());
+
+  _state = State::MODEL_LOADED;
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::load_model_from_modelfile(const char *model_file_path)
 {
   if (!isStateInitialized())
@@ -337,29 +449,41 @@ NNFW_STATUS nnfw_session::load_model_from_nnpackage(const char *package_dir)
       CfgKeyValues keyValues;
       if (loadConfigure(filepath, keyValues))
       {
+        // Packed weights can be shipped in the package, e.g. by the ahead-of-time plan
+        auto weight_dir = keyValues.find(onert::util::config::CPU_PACKED_WEIGHT_DIR);
+        if (weight_dir != keyValues.end() && !weight_dir->second.empty() &&
+            weight_dir->second[0] != '/')
+          weight_dir->second = package_path + "/" + weight_dir->second;
         setConfigKeyValues(keyValues);
       }
     }
 
-    auto model_file_path = package_path + std::string("/") + models[0].asString(); // first model
-    auto model_type = model_types[0].asString(); // first model's type
-    if (model_type == "tflite")
-    {
-      _subgraphs = onert::tflite_loader::loadModel(model_file_path);
-    }
-    else if (model_type == "circle")
-    {
-      _subgraphs = onert::circle_loader::loadModel(model_file_path);
-    }
-    else if (model_type == "tvn")
-    {
-      _subgraphs = onert::trix_loader::loadModel(model_file_path);
-    }
-    else
+    auto loadModel = [&](Json::ArrayIndex index) -> std::shared_ptr<onert::ir::Subgraphs> {
+      auto model_file_path = package_path + std::string("/") + models[index].asString();
+      auto model_type = model_types[index].asString();
+      if (model_type == "tflite")
+        return onert::tflite_loader::loadModel(model_file_path);
+      if (model_type == "circle")
+        return onert::circle_loader::loadModel(model_file_path);
+      if (model_type == "tvn")
+        return onert::trix_loader::loadModel(model_file_path);
+      return nullptr;
+    };
+
+    // Heads of a backbone run as a model, whose outputs are ones of the models one after another
+    const auto num_models = root["shared-backbone"].asBool() ? models.size() : 1;
+    std::vector<std::shared_ptr<onert::ir::Subgraphs>> loaded;
+    for (Json::ArrayIndex i = 0; i < num_models; ++i)
     {
-      std::cerr << "Unsupported model type in MANIFEST" << std::endl;
-      return NNFW_STATUS_ERROR;
+      loaded.emplace_back(loadModel(i));
+      if (loaded.back() == nullptr)
+      {
+        std::cerr << "Unsupported model type in MANIFEST" << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
     }
+    _subgraphs = loaded.size() == 1 ? loaded.front()
+                                    : onert::ir::mergeSharedBackbone(loaded).subgraphs;
     _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
   }
   catch (const std::exception &e)
@@ -394,11 +518,51 @@ NNFW_STATUS nnfw_session::prepare()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  if ((_slo_peak_memory > 0 || _slo_latency_us > 0) && !chooseSloConfigs())
+    return NNFW_STATUS_ERROR;
+  // Configs chosen are read by the compilation below and ones for other shapes or drifts
+  const auto slo_scope = scopeConfigs(_slo_configs);
+
   try
   {
+    // Constants are not copied, so they are shared with clones
+    _model_subgraphs = cloneSubgraphs(*_subgraphs);
+    _model_options = std::make_unique<onert::compiler::CompilerOptions>(_compiler->options());
+
+    // Stats are not in the options of the model, so that clones collect their own
+    if (onert::util::getConfigBool(onert::util::config::RUN_STATS))
+    {
+      _run_stats = std::make_unique<onert::exec::RunStats>();
+      _compiler->options().run_stats = _run_stats.get();
+    }
+    const auto minmax_filepath = onert::util::getConfigString(onert::util::config::MINMAX_FILEPATH);
+    if (!minmax_filepath.empty())
+    {
+      _minmax_records = std::make_unique<onert::exec::MinMaxRecords>(minmax_filepath);
+      _compiler->options().minmax_records = _minmax_records.get();
+    }
+
+    const auto &options = _compiler->options();
+    if (options.he_scheduler && (options.he_online_runs > 0 || options.reschedule_interval > 0))
+    {
+      if (options.he_online_runs > 0)
+        startOnlineProfiling();
+      if (options.reschedule_interval > 0)
+        startDriftMonitor();
+    }
+    else if (onert::util::getConfigInt(onert::util::config::SHAPE_CACHE_SIZE) > 0)
+      startShapeCache();
+
     _subgraphs.reset();
     std::shared_ptr<onert::exec::ExecutorMap> executors = _compiler->compile();
     _execution = std::make_unique<onert::exec::Execution>(executors);
+    _execution->setRunStats(_run_stats.get());
+    _execution->setMinMaxRecords(_minmax_records.get());
+    if (_shape_cache_size > 0)
+    {
+      // The compiler and tracing context of the first executors are kept by this session
+      _shape_executors.push_front({getInputShapes(*_execution), nullptr, nullptr, executors});
+    }
   }
   catch (const std::exception &e)
   {
@@ -410,7 +574,71 @@ NNFW_STATUS nnfw_session::prepare()
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::clone(nnfw_session **clone)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::clone : "
+              << "clone should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::clone : not supported for pipeline run" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  std::unique_ptr<nnfw_session> session{new (std::nothrow) nnfw_session()};
+  if (session == nullptr)
+    return NNFW_STATUS_OUT_OF_MEMORY;
+
+  try
+  {
+    session->_subgraphs = cloneSubgraphs(*_model_subgraphs);
+    session->_kernel_registry = _kernel_registry;
+    session->_package_file_path = _package_file_path;
+    session->_slo_configs = _slo_configs;
+    session->_tracing_ctx = std::make_unique<onert::util::TracingCtx>(session->_subgraphs.get());
+    session->_compiler = std::make_unique<onert::compiler::Compiler>(session->_subgraphs,
+                                                                     session->_tracing_ctx.get());
+    auto &options = session->_compiler->options();
+    options = *_model_options;
+    options.tracing_ctx = session->_tracing_ctx.get();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::clone : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  session->_state = State::MODEL_LOADED;
+
+  // The clone runs at the same time as this session, so it must not share the memory of
+  // non-constant tensors even if they are in the shared arena(CPU_SHARED_ARENA)
+  auto arena = std::make_shared<onert::backend::basic::SharedArena>();
+  onert::backend::basic::SharedArena::WorkerScope arena_scope{
+    arena, onert::backend::basic::SharedArena::group()};
+  auto status = session->prepare();
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  *clone = session.release();
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::prepare_pipeline(const char *map_file_path)
+{
+  return preparePipeline(
+    [&]() { return _compiler->compile(_package_file_path.c_str(), map_file_path); });
+}
+
+NNFW_STATUS nnfw_session::prepare_streaming()
+{
+  return preparePipeline([&]() { return _compiler->compileStreaming(); });
+}
+
+NNFW_STATUS nnfw_session::preparePipeline(
+  const std::function<std::vector<std::shared_ptr<onert::exec::ExecutorMap>>()> &compile)
 {
   // NOTE. If users want to run prepare_pipeline() more than one time, this could be removed.
   if (!isStateModelLoaded())
@@ -431,14 +659,19 @@ NNFW_STATUS nnfw_session::prepare_pipeline(const char *map_file_path)
   try
   {
     _subgraphs.reset();
-    std::vector<std::shared_ptr<onert::exec::ExecutorMap>> executor_maps =
-      _compiler->compile(_package_file_path.c_str(), map_file_path);
+    std::vector<std::shared_ptr<onert::exec::ExecutorMap>> executor_maps = compile();
 
     for (auto it = executor_maps.begin(); it != executor_maps.end(); ++it)
     {
       _executions.push_back(std::make_shared<onert::exec::Execution>(*it));
     }
     make_dependency();
+    const auto depth = onert::util::getConfigInt(onert::util::config::PIPELINE_DEPTH);
+    for (auto &execution : _executions)
+      execution->preparePipeline(depth > 0 ? depth : 1);
+    _pipeline_balance_runs = std::max(
+      onert::util::getConfigInt(onert::util::config::PIPELINE_BALANCE_RUNS), 0);
+    _pipeline_popped = 0;
     _threads.resize(_executions.size());
     for (uint32_t i = 0; i < _threads.size(); i++)
     {
@@ -472,7 +705,15 @@ NNFW_STATUS nnfw_session::run()
 
   try
   {
+    if (_shape_cache_size > 0)
+      specializeInputShapes();
+
     _execution->execute();
+
+    if (_online_profiling && _online_profiling->needReschedule())
+      reschedule();
+    else if (_drift_monitor && !_online_profiling)
+      checkDrift();
   }
   catch (const onert::InsufficientBufferSizeException &e)
   {
@@ -490,7 +731,342 @@ NNFW_STATUS nnfw_session::run()
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::run_async()
+NNFW_STATUS nnfw_session::warmup(uint32_t runs)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::warmup : "
+              << "warmup should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::warmup : not supported for pipeline run" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (runs == 0)
+  {
+    std::cerr << "Error during nnfw_session::warmup : runs must be positive" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    // Warm up the executors which the next run will use
+    if (_shape_cache_size > 0)
+      specializeInputShapes();
+
+    _execution->warmup(runs);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::warmup : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::query_run_stats(nnfw_run_stats *stats)
+{
+  if (stats == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::query_run_stats : stats is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::query_run_stats : "
+              << "query_run_stats should be called after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_run_stats)
+  {
+    std::cerr << "Error during nnfw_session::query_run_stats : "
+              << "RUN_STATS config was not set before prepare" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  const auto last = _run_stats->last();
+  *stats = nnfw_run_stats{};
+  stats->total_us = last.total_us;
+  stats->permute_us = last.permute_us;
+  stats->dynamic_shape_us = last.dynamic_shape_us;
+  stats->peak_memory = last.peak_memory;
+  const auto num_backends = std::min<size_t>(last.backend_us.size(), NNFW_MAX_RUN_STATS_BACKENDS);
+  for (size_t i = 0; i < num_backends; ++i)
+  {
+    auto &backend = stats->backends[i];
+    strncpy(backend.backend, last.backend_us[i].first.c_str(), NNFW_MAX_BACKEND_ID_LENGTH - 1);
+    backend.time_us = last.backend_us[i].second;
+  }
+  stats->num_backends = num_backends;
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::set_slo(uint64_t peak_memory, uint64_t latency_us)
+{
+  if (!isStateModelLoaded())
+  {
+    std::cerr << "Error during nnfw_session::set_slo : "
+              << "set_slo should be called after loading a model and before prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  _slo_peak_memory = peak_memory;
+  _slo_latency_us = latency_us;
+  _slo_configs.clear();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+bool nnfw_session::chooseSloConfigs()
+{
+  using namespace onert::util;
+
+  struct Candidate
+  {
+    std::unordered_map<std::string, std::string> configs;
+    uint64_t peak_memory;
+    uint64_t latency_us;
+  };
+  // Ratio of the metric furthest from the objective to it, which is at most 1 if it is met
+  const auto excess = [&](const Candidate &candidate) {
+    double ratio = 0;
+    if (_slo_peak_memory > 0)
+      ratio = std::max(ratio, static_cast<double>(candidate.peak_memory) / _slo_peak_memory);
+    if (_slo_latency_us > 0)
+      ratio = std::max(ratio, static_cast<double>(candidate.latency_us) / _slo_latency_us);
+    return ratio;
+  };
+  const auto current = [&](const Candidate &candidate, const std::string &key) {
+    auto it = candidate.configs.find(key);
+    return it != candidate.configs.end() ? it->second : getConfigString(key);
+  };
+
+  // Each attempt changes a config of the best so far, which is kept if it gets closer
+  std::unique_ptr<Candidate> best;
+  const auto attempt = [&](const std::string &key, const std::string &value) {
+    Candidate candidate{best ? best->configs : std::unordered_map<std::string, std::string>{}, 0,
+                        0};
+    if (!key.empty())
+      candidate.configs[key] = value;
+    try
+    {
+      std::tie(candidate.peak_memory, candidate.latency_us) = measureSlo(candidate.configs);
+    }
+    catch (const std::exception &e)
+    {
+      VERBOSE(nnfw_session) << "SLO: " << key << "=" << value << " failed : " << e.what()
+                            << std::endl;
+      return false;
+    }
+    VERBOSE(nnfw_session) << "SLO: " << (key.empty() ? "default" : key + "=" + value)
+                          << " peaks at " << candidate.peak_memory << " bytes and runs in "
+                          << candidate.latency_us << " us" << std::endl;
+    if (!best || excess(candidate) < excess(*best))
+      best = std::make_unique<Candidate>(std::move(candidate));
+    return excess(*best) <= 1;
+  };
+
+  bool met = attempt("", "");
+  if (!best)
+  {
+    std::cerr << "Error during model prepare : the model failed to run for the SLO" << std::endl;
+    return false;
+  }
+
+  // Memory planners place tensors of the same lifetimes differently
+  if (!met && _slo_peak_memory > 0 && best->peak_memory > _slo_peak_memory)
+  {
+    const auto planner = current(*best, config::CPU_MEMORY_PLANNER);
+    for (const auto candidate : {"WIC", "Offset", "FirstFit"})
+    {
+      if (candidate != planner && (met = attempt(config::CPU_MEMORY_PLANNER, candidate)))
+        break;
+    }
+  }
+
+  // More threads of kernels, and then other backends for all operations
+  if (!met && _slo_latency_us > 0 && best->latency_us > _slo_latency_us)
+  {
+    const auto cores = std::max(std::thread::hardware_concurrency(), 1u);
+    for (const auto threads : {cores / 2, cores})
+    {
+      const auto value = std::to_string(threads);
+      if (threads > 1 && value != current(*best, config::RUY_THREADS) &&
+          (met = attempt(config::RUY_THREADS, value)))
+        break;
+    }
+  }
+  if (!met && _slo_latency_us > 0 && best->latency_us > _slo_latency_us)
+  {
+    const auto &options = _compiler->options();
+    auto backend = best->configs.count(config::OP_BACKEND_ALLOPS)
+                     ? best->configs.at(config::OP_BACKEND_ALLOPS)
+                     : options.manual_scheduler_options.backend_for_all;
+    if (backend.empty() && !options.backend_list.empty())
+      backend = options.backend_list.front();
+    for (const auto &candidate : options.backend_list)
+    {
+      if (candidate != backend && (met = attempt(config::OP_BACKEND_ALLOPS, candidate)))
+        break;
+    }
+  }
+
+  if (!met)
+  {
+    std::cerr << "Error during model prepare : SLO of " << _slo_peak_memory << " bytes and "
+              << _slo_latency_us << " us cannot be met, the closest configs";
+    for (const auto &config : best->configs)
+      std::cerr << " " << config.first << "=" << config.second;
+    std::cerr << " peak at " << best->peak_memory << " bytes and run in " << best->latency_us
+              << " us" << std::endl;
+    return false;
+  }
+
+  _slo_configs = std::move(best->configs);
+  auto backend = _slo_configs.find(config::OP_BACKEND_ALLOPS);
+  if (backend != _slo_configs.end())
+    _compiler->options().manual_scheduler_options.backend_for_all = backend->second;
+  return true;
+}
+
+std::pair<uint64_t, uint64_t>
+nnfw_session::measureSlo(const std::unordered_map<std::string, std::string> &configs)
+{
+  // Runs timed after the first one, which allocates memory and packs weights
+  constexpr uint32_t kSloRuns = 3;
+
+  const auto slo_scope = scopeConfigs(configs);
+  auto subgraphs = cloneSubgraphs(*_subgraphs);
+  auto tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgraphs.get());
+  onert::compiler::Compiler compiler{subgraphs, tracing_ctx.get()};
+  subgraphs.reset();
+
+  onert::exec::RunStats stats;
+  auto &options = compiler.options();
+  options = _compiler->options();
+  options.tracing_ctx = tracing_ctx.get();
+  options.online_profiling = nullptr;
+  options.drift_monitor = nullptr;
+  options.run_stats = &stats;
+  options.minmax_records = nullptr;
+  auto backend = configs.find(onert::util::config::OP_BACKEND_ALLOPS);
+  if (backend != configs.end())
+    options.manual_scheduler_options.backend_for_all = backend->second;
+
+  onert::exec::Execution execution{compiler.compile()};
+  execution.setRunStats(&stats);
+  execution.warmup();
+
+  // Warm-up runs executors directly, so stats of the runs are collected here
+  stats.beginRun();
+  const auto begin = std::chrono::steady_clock::now();
+  execution.warmup(kSloRuns);
+  const auto end = std::chrono::steady_clock::now();
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+  stats.endRun(us);
+
+  return {stats.last().peak_memory, static_cast<uint64_t>(us) / kSloRuns};
+}
+
+NNFW_STATUS nnfw_session::set_priority(int32_t priority)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::set_priority : "
+              << "set_priority should be called after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (_execution)
+    _execution->setPriority(priority);
+  for (auto &execution : _executions)
+    execution->setPriority(priority);
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::release_idle_memory(bool packed_weights, uint64_t *released_bytes)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::release_idle_memory : "
+              << "release_idle_memory should be called after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::release_idle_memory : not supported for pipeline run"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    uint64_t bytes = _execution->releaseMemory(packed_weights);
+    // Executors specialized for other input shapes are idle as well
+    for (auto &shape_executors : _shape_executors)
+    {
+      for (auto &pair : *shape_executors.executors)
+        bytes += pair.second->releaseMemory(packed_weights);
+    }
+    if (released_bytes)
+      *released_bytes = bytes;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::release_idle_memory : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_states()
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::reset_states : "
+              << "reset_states should be called after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::reset_states : not supported for pipeline run"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->resetStates();
+    // Executors specialized for other input shapes have states of their own
+    for (auto &shape_executors : _shape_executors)
+    {
+      for (auto &pair : *shape_executors.executors)
+        pair.second->resetStates();
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::reset_states : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::run_async() { return run_async(nullptr, nullptr); }
+
+NNFW_STATUS nnfw_session::run_async(nnfw_completion_callback callback, void *user_data)
 {
   if (!isStatePreparedOrFinishedRun())
   {
@@ -506,9 +1082,35 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->startExecute();
+  try
+  {
+    if (_shape_cache_size > 0)
+      specializeInputShapes();
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
 
+  // Set before the callback can be called
   _state = State::RUNNING;
+  if (callback)
+  {
+    _execution->startExecute([this, callback, user_data](std::exception_ptr error) {
+      callback(this, toStatus(error), user_data);
+    });
+  }
+  else
+  {
+    _execution->startExecute();
+  }
+
   return NNFW_STATUS_NO_ERROR;
 }
 
@@ -527,13 +1129,21 @@ NNFW_STATUS nnfw_session::await()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->waitFinish();
-
   _state = State::FINISHED_RUN;
+  try
+  {
+    _execution->waitFinish();
+  }
+  catch (...)
+  {
+    auto status = toStatus(std::current_exception());
+    std::cerr << "Error during nnfw_session::await : run_async failed" << std::endl;
+    return status;
+  }
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const void *buffer,
+NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE type, const void *buffer,
                                     size_t length)
 {
   if (!isStatePreparedOrFinishedRun())
@@ -559,7 +1169,14 @@ NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const vo
 
   try
   {
-    _execution->setInput(onert::ir::IOIndex(index), buffer, length);
+    // Quantized inputs given in float are quantized by the execution
+    const onert::ir::IOIndex io_index{index};
+    const auto &subg = _execution->primary_subgraph();
+    const auto &info = subg.operands().at(subg.getInputs().at(io_index)).info();
+    if (type == NNFW_TYPE_TENSOR_FLOAT32 && isQuantized(info.typeInfo().type()))
+      _execution->setInput(io_index, onert::ir::DataType::FLOAT32, buffer, length);
+    else
+      _execution->setInput(io_index, buffer, length);
   }
   catch (const std::exception &e)
   {
@@ -569,7 +1186,7 @@ NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const vo
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *buffer,
+NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE type, void *buffer,
                                      size_t length)
 {
   if (!isStatePreparedOrFinishedRun())
@@ -595,7 +1212,14 @@ NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *b
 
   try
   {
-    _execution->setOutput(onert::ir::IOIndex(index), buffer, length);
+    // Quantized outputs taken in float are dequantized by the execution
+    const onert::ir::IOIndex io_index{index};
+    const auto &subg = _execution->primary_subgraph();
+    const auto &info = subg.operands().at(subg.getOutputs().at(io_index)).info();
+    if (type == NNFW_TYPE_TENSOR_FLOAT32 && isQuantized(info.typeInfo().type()))
+      _execution->setOutput(io_index, onert::ir::DataType::FLOAT32, buffer, length);
+    else
+      _execution->setOutput(io_index, buffer, length);
   }
   catch (const std::exception &e)
   {
@@ -605,6 +1229,69 @@ NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *b
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::register_io_buffers(uint32_t slot, const void **inputs,
+                                              const size_t *input_lengths, void **outputs,
+                                              const size_t *output_lengths)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::register_io_buffers : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::register_io_buffers : not supported for pipeline run"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    const auto &subg = _execution->primary_subgraph();
+    std::vector<std::pair<const void *, size_t>> input_buffers;
+    for (uint32_t i = 0; i < subg.getInputs().size(); ++i)
+      input_buffers.emplace_back(inputs[i], input_lengths[i]);
+    std::vector<std::pair<void *, size_t>> output_buffers;
+    for (uint32_t i = 0; i < subg.getOutputs().size(); ++i)
+      output_buffers.emplace_back(outputs[i], output_lengths[i]);
+    _execution->registerIOBuffers(slot, input_buffers, output_buffers);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::register_io_buffers : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::use_io_buffers(uint32_t slot)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::use_io_buffers : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (!_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::use_io_buffers : not supported for pipeline run"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->useIOBuffers(slot);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::use_io_buffers : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::input_size(uint32_t *number)
 {
   if (isStateInitialized()) // Model is not loaded
@@ -893,42 +1580,80 @@ void nnfw_session::make_dependency()
 NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *inputs,
                                               std::vector<uint32_t> *lengths)
 {
-  static uint32_t count = 0;
-  if (inputs->empty())
+  try
   {
-    _executions[0]->setFinish();
-    for (uint32_t i = 0; i < _threads.size(); i++)
+    if (inputs->empty())
     {
-      _threads[i].join();
+      _executions[0]->pushPipelineInput({}, {});
+      for (uint32_t i = 0; i < _threads.size(); i++)
+      {
+        _threads[i].join();
+      }
+      return NNFW_STATUS_NO_ERROR;
     }
-    return NNFW_STATUS_NO_ERROR;
+    _executions[0]->pushPipelineInput(*inputs, *lengths);
   }
-  _executions[0]->asyncIoDescSemWait();
-  _executions[0]->createNewAsyncDesc(count++);
-  for (uint32_t i = 0; i < inputs->size(); i++)
+  catch (const std::exception &e)
   {
-    _executions[0]->executeAsyncInput(onert::ir::IOIndex(i), inputs->at(i), lengths->at(i));
+    std::cerr << "Error during nnfw_session::push_pipeline_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
   }
-  _executions[0]->asyncIoDescSemPost();
   return NNFW_STATUS_NO_ERROR;
 }
 
 NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *outputs)
 {
-  auto results = _executions[_executions.size() - 1]->getAsyncResults();
-  while (results->empty())
+  if (!_executions.back()->popPipelineOutput(*outputs))
+    return NNFW_STATUS_ERROR;
+  if (++_pipeline_popped == _pipeline_balance_runs)
+    reportPipelineBalance();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::pipeline_stage_time(uint32_t stage, uint64_t *time_us)
+{
+  if (time_us == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (stage >= _executions.size())
   {
-    if (_executions[_executions.size() - 1]->stopWait())
-      return NNFW_STATUS_ERROR;
+    std::cerr << "Error during nnfw_session::pipeline_stage_time : invalid stage index"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
   }
 
-  auto result = results->front();
-  results->pop_front();
-  for (uint32_t i = 0; i < result.size(); i++)
-    outputs->push_back(result[i]);
+  *time_us = _executions[stage]->pipelineStageTime();
   return NNFW_STATUS_NO_ERROR;
 }
 
+void nnfw_session::reportPipelineBalance()
+{
+  std::vector<uint64_t> times;
+  for (const auto &execution : _executions)
+    times.push_back(execution->pipelineStageTime());
+  const auto slowest = std::max_element(times.begin(), times.end());
+  const auto fastest = std::min_element(times.begin(), times.end());
+
+  // Throughput of the pipeline is that of the slowest stage
+  const auto tolerance = onert::util::getConfigInt(onert::util::config::PIPELINE_BALANCE_TOL);
+  if (*slowest * 100 <= *fastest * (100 + tolerance))
+  {
+    VERBOSE(nnfw_session) << "Pipeline stages are balanced within " << tolerance << "%"
+                          << std::endl;
+    return;
+  }
+
+  std::cerr << "Pipeline stages are imbalanced over " << tolerance << "% after "
+            << _pipeline_popped << " runs. Stage times (us) :";
+  for (const auto &time : times)
+    std::cerr << " " << time;
+  std::cerr << std::endl
+            << "Throughput is bound by stage " << std::distance(times.begin(), slowest)
+            << ". Consider partitioning the model again to move operations of the stage to "
+            << "stage " << std::distance(times.begin(), fastest) << " or its neighbours."
+            << std::endl;
+}
+
 NNFW_STATUS nnfw_session::register_custom_operation(const std::string &id,
                                                     nnfw_custom_eval eval_func)
 {
@@ -936,6 +1661,26 @@ NNFW_STATUS nnfw_session::register_custom_operation(const std::string &id,
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::register_custom_kernel(const std::string &id,
+                                                 const nnfw_custom_kernel_info &info)
+{
+  if (info.run == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::register_custom_kernel : run is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  if (isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::register_custom_kernel : "
+              << "register_custom_kernel should be called before prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  _kernel_registry->registerKernel(id, info);
+  return NNFW_STATUS_NO_ERROR;
+}
+
 static std::string get_op_backend_string(std::string op)
 {
 #define MAP_MACRO(CircleName, OneRTName) {#CircleName, #OneRTName},
@@ -1211,6 +1956,220 @@ bool nnfw_session::isStatePreparedOrFinishedRun()
   return isStatePrepared() || isStateFinishedRun();
 }
 
+void nnfw_session::startOnlineProfiling()
+{
+  auto &options = _compiler->options();
+
+  // Keep the model and options as they are before compilation to compile again later
+  _online_subgraphs = cloneSubgraphs(*_subgraphs);
+  _online_options = std::make_unique<onert::compiler::CompilerOptions>(options);
+  _online_profiling = std::make_unique<onert::exec::OnlineProfiling>(options.he_online_runs);
+
+  // Profiling requires Dataflow executor. The given executor is used after profiling finishes.
+  options.executor = "Dataflow";
+  options.online_profiling = _online_profiling.get();
+}
+
+void nnfw_session::reschedule()
+{
+  const bool finished = _online_profiling->finished();
+  VERBOSE(nnfw_session) << "Reschedule after " << _online_profiling->runs() << " profiled runs"
+                        << (finished ? " (profiling finished)" : "") << std::endl;
+
+  // The model and options are kept for drifts after profiling finishes if they are monitored
+  const bool keep_model = !finished || _drift_monitor;
+  auto subgraphs = keep_model ? cloneSubgraphs(*_online_subgraphs) : std::move(_online_subgraphs);
+  auto tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgraphs.get());
+  auto compiler = std::make_unique<onert::compiler::Compiler>(subgraphs, tracing_ctx.get());
+  subgraphs.reset();
+
+  auto &options = compiler->options();
+  options = *_online_options;
+  options.tracing_ctx = tracing_ctx.get();
+  if (!finished)
+  {
+    options.executor = "Dataflow";
+    options.online_profiling = _online_profiling.get();
+  }
+
+  // HEScheduler of the new compiler reads exec times stored by the profiled runs
+  const auto slo_scope = scopeConfigs(_slo_configs);
+  _execution->replaceExecutors(compiler->compile());
+  _compiler = std::move(compiler);
+  _tracing_ctx = std::move(tracing_ctx);
+
+  if (finished)
+  {
+    _online_profiling.reset();
+    if (!keep_model)
+      _online_options.reset();
+  }
+}
+
+void nnfw_session::startDriftMonitor()
+{
+  auto &options = _compiler->options();
+
+  // Online profiling keeps the model and options already, or else they are kept here
+  if (!_online_options)
+  {
+    _online_subgraphs = cloneSubgraphs(*_subgraphs);
+    _online_options = std::make_unique<onert::compiler::CompilerOptions>(options);
+  }
+  _drift_monitor = std::make_unique<onert::exec::DriftMonitor>(
+    options.reschedule_interval, static_cast<double>(options.reschedule_drift) / 100);
+
+  // Executors profiled online are not monitored, which record exec times of all runs anyway
+  _online_options->drift_monitor = _drift_monitor.get();
+  options.drift_monitor = _drift_monitor.get();
+}
+
+void nnfw_session::checkDrift()
+{
+  if (_drift_executors.valid())
+  {
+    if (_drift_executors.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+      return;
+
+    try
+    {
+      _execution->replaceExecutors(_drift_executors.get());
+      _compiler = std::move(_drift_compiler);
+      _tracing_ctx = std::move(_drift_tracing_ctx);
+    }
+    catch (const std::exception &e)
+    {
+      // The executors in use keep running, and they are monitored again
+      std::cerr << "Error during nnfw_session::run : failed to reschedule, " << e.what()
+                << std::endl;
+      _drift_compiler.reset();
+      _drift_tracing_ctx.reset();
+    }
+    _drift_monitor->reset();
+    return;
+  }
+
+  if (!_drift_monitor->drifted())
+    return;
+
+  VERBOSE(nnfw_session) << "Reschedule after " << _drift_monitor->runs() << " runs by drift "
+                        << _drift_monitor->maxDrift() << std::endl;
+
+  auto subgraphs = cloneSubgraphs(*_online_subgraphs);
+  _drift_tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgraphs.get());
+  _drift_compiler =
+    std::make_unique<onert::compiler::Compiler>(subgraphs, _drift_tracing_ctx.get());
+  subgraphs.reset();
+
+  auto &options = _drift_compiler->options();
+  options = *_online_options;
+  options.tracing_ctx = _drift_tracing_ctx.get();
+
+  // HEScheduler of the new compiler reads exec times stored by the sampled runs. Tensors in the
+  // shared arena are allocated in the arena of the thread, so they are compiled on this thread.
+  auto compiler = _drift_compiler.get();
+  auto compile = [compiler, configs = _slo_configs]() {
+    const auto slo_scope = scopeConfigs(configs);
+    return compiler->compile();
+  };
+  if (onert::util::getConfigBool(onert::util::config::CPU_SHARED_ARENA))
+  {
+    std::packaged_task<std::shared_ptr<onert::exec::ExecutorMap>()> task{compile};
+    _drift_executors = task.get_future();
+    task();
+    checkDrift();
+    return;
+  }
+  _drift_executors = std::async(std::launch::async, compile);
+}
+
+void nnfw_session::startShapeCache()
+{
+  // Keep the model and options as they are before compilation to compile for other input shapes
+  _shape_cache_size = onert::util::getConfigInt(onert::util::config::SHAPE_CACHE_SIZE);
+  _shape_bucket_axis = onert::util::getConfigInt(onert::util::config::SHAPE_BUCKET_AXIS);
+  _shape_buckets.clear();
+  for (const auto &bucket :
+       nnfw::misc::split(onert::util::getConfigString(onert::util::config::SHAPE_BUCKETS), ';'))
+    _shape_buckets.push_back(std::stoi(bucket));
+  std::sort(_shape_buckets.begin(), _shape_buckets.end());
+  _shape_subgraphs = cloneSubgraphs(*_subgraphs);
+  _shape_options = std::make_unique<onert::compiler::CompilerOptions>(_compiler->options());
+}
+
+void nnfw_session::specializeInputShapes()
+{
+  const auto real_shapes = getInputShapes(*_execution);
+  auto input_shapes = real_shapes;
+  if (_shape_bucket_axis >= 0)
+  {
+    for (auto &shape : input_shapes)
+    {
+      if (shape.rank() > _shape_bucket_axis)
+        shape.dim(_shape_bucket_axis) =
+          roundUpToBucket(shape.dim(_shape_bucket_axis), _shape_buckets);
+    }
+  }
+
+  auto it = std::find_if(
+    _shape_executors.begin(), _shape_executors.end(),
+    [&](const ShapeExecutors &entry) { return entry.input_shapes == input_shapes; });
+  if (it != _shape_executors.end())
+  {
+    _shape_executors.splice(_shape_executors.begin(), _shape_executors, it);
+  }
+  else
+  {
+    VERBOSE(nnfw_session) << "Compile for new input shapes" << std::endl;
+
+    auto subgraphs = cloneSubgraphs(*_shape_subgraphs);
+    auto primary_subgraph = subgraphs->primary();
+    for (uint32_t i = 0; i < input_shapes.size(); ++i)
+    {
+      auto ind = primary_subgraph->getInputs().at(i);
+      primary_subgraph->operands().at(ind).info().shape(input_shapes[i]);
+    }
+
+    ShapeExecutors entry;
+    entry.input_shapes = input_shapes;
+    entry.tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgraphs.get());
+    entry.compiler =
+      std::make_unique<onert::compiler::Compiler>(subgraphs, entry.tracing_ctx.get());
+    primary_subgraph.reset();
+    subgraphs.reset();
+
+    auto &options = entry.compiler->options();
+    options = *_shape_options;
+    options.tracing_ctx = entry.tracing_ctx.get();
+    try
+    {
+      const auto slo_scope = scopeConfigs(_slo_configs);
+      entry.executors = entry.compiler->compile();
+    }
+    catch (const std::exception &e)
+    {
+      // Run on the dynamic path from now on
+      VERBOSE(nnfw_session) << "Stop caching executors for input shapes as compilation failed : "
+                            << e.what() << std::endl;
+      _shape_cache_size = 0;
+      _shape_subgraphs.reset();
+      _shape_options.reset();
+      _execution->replaceExecutors(_shape_executors.front().executors);
+      return;
+    }
+    _shape_executors.push_front(std::move(entry));
+  }
+
+  if (input_shapes == real_shapes)
+    _execution->specializeExecutors(_shape_executors.front().executors);
+  else
+    _execution->padExecutors(_shape_executors.front().executors, _shape_bucket_axis);
+
+  // Evict the least recently used ones, which are not in use
+  while (_shape_executors.size() > _shape_cache_size)
+    _shape_executors.pop_back();
+}
+
 NNFW_STATUS nnfw_session::input_tensorindex(const char *tensorname, uint32_t *index)
 {
   return getTensorIndexImpl(*primary_subgraph(), tensorname, index, true);
@@ -19,13 +19,19 @@
 
 #include "nnfw.h"
 #include "nnfw_experimental.h"
+#include "nnfw_internal.h"
 
+#include <exec/IExecutor.h>
 #include <util/GeneralConfigSource.h>
 #include <util/TracingCtx.h>
 
+#include <functional>
+#include <future>
+#include <list>
 #include <string>
 #include <memory>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace onert
@@ -36,7 +42,11 @@ class CustomKernelRegistry;
 } // namespace api
 namespace exec
 {
+class DriftMonitor;
 class Execution;
+class MinMaxRecords;
+class OnlineProfiling;
+class RunStats;
 } // namespace exec
 namespace ir
 {
@@ -46,6 +56,7 @@ class Subgraphs;
 namespace compiler
 {
 class Compiler;
+struct CompilerOptions;
 } // namespace compiler
 } // namespace onert
 
@@ -103,13 +114,23 @@ public:
   NNFW_STATUS load_model_from_nnpackage(const char *package_file_path);
   NNFW_STATUS prepare();
   NNFW_STATUS prepare_pipeline(const char *map_file_path);
+  NNFW_STATUS prepare_streaming();
+  NNFW_STATUS clone(nnfw_session **clone);
   NNFW_STATUS run();
 
   NNFW_STATUS run_async();
+  NNFW_STATUS run_async(nnfw_completion_callback callback, void *user_data);
   NNFW_STATUS await();
+  NNFW_STATUS warmup(uint32_t runs);
+  NNFW_STATUS set_priority(int32_t priority);
+  NNFW_STATUS release_idle_memory(bool packed_weights, uint64_t *released_bytes);
+  NNFW_STATUS reset_states();
 
   NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
   NNFW_STATUS set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
+  NNFW_STATUS register_io_buffers(uint32_t slot, const void **inputs, const size_t *input_lengths,
+                                  void **outputs, const size_t *output_lengths);
+  NNFW_STATUS use_io_buffers(uint32_t slot);
 
   NNFW_STATUS input_size(uint32_t *number);
   NNFW_STATUS output_size(uint32_t *number);
@@ -136,6 +157,7 @@ public:
   NNFW_STATUS set_config(const char *key, const char *value);
   NNFW_STATUS get_config(const char *key, char *value, size_t value_size);
   NNFW_STATUS load_circle_from_buffer(uint8_t *buffer, size_t size);
+  NNFW_STATUS load_circle_from_stream(size_t size, nnfw_stream_read read, void *user_data);
   NNFW_STATUS load_model_from_modelfile(const char *file_path);
 
   //
@@ -144,8 +166,12 @@ public:
   void make_dependency();
   NNFW_STATUS push_pipeline_input(std::vector<void *> *inputs, std::vector<uint32_t> *lengths);
   NNFW_STATUS pop_pipeline_output(std::vector<void *> *outputs);
+  NNFW_STATUS pipeline_stage_time(uint32_t stage, uint64_t *time_us);
+  NNFW_STATUS query_run_stats(nnfw_run_stats *stats);
+  NNFW_STATUS set_slo(uint64_t peak_memory, uint64_t latency_us);
 
   NNFW_STATUS register_custom_operation(const std::string &id, nnfw_custom_eval eval_func);
+  NNFW_STATUS register_custom_kernel(const std::string &id, const nnfw_custom_kernel_info &info);
   NNFW_STATUS input_tensorindex(const char *tensorname, uint32_t *index);
   NNFW_STATUS output_tensorindex(const char *tensorname, uint32_t *index);
   NNFW_STATUS set_backends_per_operation(const char *backend_settings);
@@ -158,18 +184,84 @@ private:
   bool isStateRunning();
   bool isStateFinishedRun();
   bool isStatePreparedOrFinishedRun();
+  void startOnlineProfiling();
+  void reschedule();
+  void startDriftMonitor();
+  void checkDrift();
+  void startShapeCache();
+  void specializeInputShapes();
+  void reportPipelineBalance();
+  /**
+   * @brief Choose configs of compilations to meet the service level objective
+   * @return false if no configs tried meet it
+   */
+  bool chooseSloConfigs();
+  /**
+   * @brief Compile the model with configs and measure the peak memory and latency of its runs
+   */
+  std::pair<uint64_t, uint64_t>
+  measureSlo(const std::unordered_map<std::string, std::string> &configs);
+  NNFW_STATUS preparePipeline(
+    const std::function<std::vector<std::shared_ptr<onert::exec::ExecutorMap>>()> &compile);
 
 private:
   State _state{State::INITIALIZED};
   std::shared_ptr<onert::ir::Subgraphs> _subgraphs;
   std::unique_ptr<onert::compiler::Compiler> _compiler;
+
+  // Executors compiled for each set of input shapes, the most recently used first.
+  // They are declared before _execution so that they outlive the executor in use.
+  struct ShapeExecutors
+  {
+    std::vector<onert::ir::Shape> input_shapes;
+    std::unique_ptr<onert::util::TracingCtx> tracing_ctx;
+    std::unique_ptr<onert::compiler::Compiler> compiler;
+    std::shared_ptr<onert::exec::ExecutorMap> executors;
+  };
+  std::list<ShapeExecutors> _shape_executors;
+  uint32_t _shape_cache_size{0};
+  // Inputs are padded along the axis up to one of the buckets, powers of two if none is given
+  int32_t _shape_bucket_axis{-1};
+  std::vector<int32_t> _shape_buckets;
+  std::shared_ptr<onert::ir::Subgraphs> _shape_subgraphs;
+  std::unique_ptr<onert::compiler::CompilerOptions> _shape_options;
+
+  // Stats of runs, which observers of the executors record into if RUN_STATS is set
+  std::unique_ptr<onert::exec::RunStats> _run_stats;
+  // Min/max of tensors of runs, which are written to MINMAX_FILEPATH if it is set
+  std::unique_ptr<onert::exec::MinMaxRecords> _minmax_records;
   std::unique_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
   std::vector<std::thread> _threads;
   std::vector<std::shared_ptr<onert::exec::Execution>> _executions;
+  // Stage times are reported once this number of pipeline outputs are popped, if it is not 0
+  uint32_t _pipeline_balance_runs{0};
+  uint32_t _pipeline_popped{0};
   std::string _package_file_path;
 
   std::unique_ptr<onert::util::TracingCtx> _tracing_ctx;
+
+  // Model and options as they are before compilation, which clones compile again
+  std::shared_ptr<onert::ir::Subgraphs> _model_subgraphs;
+  std::unique_ptr<onert::compiler::CompilerOptions> _model_options;
+
+  // Online profiling for HEScheduler, which compiles the model again at the end of each round
+  std::unique_ptr<onert::exec::OnlineProfiling> _online_profiling;
+  std::shared_ptr<onert::ir::Subgraphs> _online_subgraphs;
+  std::unique_ptr<onert::compiler::CompilerOptions> _online_options;
+
+  // Monitor of drifts of exec times, by which the model is compiled again in the background.
+  // The compiler is declared before the future so that the compilation ends before it is freed.
+  std::unique_ptr<onert::exec::DriftMonitor> _drift_monitor;
+  std::unique_ptr<onert::util::TracingCtx> _drift_tracing_ctx;
+  std::unique_ptr<onert::compiler::Compiler> _drift_compiler;
+  std::future<std::shared_ptr<onert::exec::ExecutorMap>> _drift_executors;
+
+  // Service level objective of prepare, where 0 is no limit
+  uint64_t _slo_peak_memory{0};
+  uint64_t _slo_latency_us{0};
+  // Configs chosen for the objective, which every compilation of the model is scoped with
+  std::unordered_map<std::string, std::string> _slo_configs;
 };
 
 #endif // __API_NNFW_API_INTERNAL_H__
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnfw_batcher.h"
+#include "nnfw_api_internal.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+
+size_t sizeOfType(NNFW_TYPE type)
+{
+  switch (type)
+  {
+    case NNFW_TYPE_TENSOR_FLOAT32:
+    case NNFW_TYPE_TENSOR_INT32:
+      return 4;
+    case NNFW_TYPE_TENSOR_INT64:
+      return 8;
+    case NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED:
+      return 2;
+    case NNFW_TYPE_TENSOR_QUANT8_ASYMM:
+    case NNFW_TYPE_TENSOR_BOOL:
+    case NNFW_TYPE_TENSOR_UINT8:
+    case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
+      return 1;
+    default:
+      throw std::runtime_error{"Unsupported tensor type"};
+  }
+}
+
+// Size of a sample of a tensor whose first axis is the batch of 1
+size_t sampleSize(const nnfw_tensorinfo &ti)
+{
+  if (ti.rank < 1 || ti.dims[0] != 1)
+    throw std::runtime_error{"Batch of tensors must be 1"};
+
+  size_t size = sizeOfType(ti.dtype);
+  for (int32_t i = 1; i < ti.rank; ++i)
+    size *= ti.dims[i];
+  return size;
+}
+
+} // namespace
+
+nnfw_batcher::nnfw_batcher(nnfw_session *session, uint32_t max_batch, uint32_t timeout_us)
+  : _session{session}, _max_batch{std::max(max_batch, 1u)}, _timeout{timeout_us}
+{
+  // DO NOTHING
+}
+
+nnfw_batcher::~nnfw_batcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+  _queue_cv.notify_all();
+  if (_worker.joinable())
+    _worker.join();
+}
+
+NNFW_STATUS nnfw_batcher::prepare()
+{
+  uint32_t num_inputs = 0;
+  uint32_t num_outputs = 0;
+  NNFW_STATUS status = _session->input_size(&num_inputs);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+  status = _session->output_size(&num_outputs);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  try
+  {
+    _input_infos.resize(num_inputs);
+    for (uint32_t i = 0; i < num_inputs; ++i)
+    {
+      status = _session->input_tensorinfo(i, &_input_infos[i]);
+      if (status != NNFW_STATUS_NO_ERROR)
+        return status;
+      _input_sizes.push_back(sampleSize(_input_infos[i]));
+    }
+    for (uint32_t i = 0; i < num_outputs; ++i)
+    {
+      nnfw_tensorinfo ti;
+      status = _session->output_tensorinfo(i, &ti);
+      if (status != NNFW_STATUS_NO_ERROR)
+        return status;
+      _output_sizes.push_back(sampleSize(ti));
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_batcher::prepare : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _input_buffers.resize(num_inputs);
+  _output_buffers.resize(num_outputs);
+  _worker = std::thread{&nnfw_batcher::work, this};
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_batcher::run(const void **inputs, void **outputs)
+{
+  Request request{inputs, outputs, std::chrono::steady_clock::now(), NNFW_STATUS_NO_ERROR, false};
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  if (_stop)
+    return NNFW_STATUS_INVALID_STATE;
+  _queue.push_back(&request);
+  _queue_cv.notify_all();
+  _done_cv.wait(lock, [&]() { return request.done; });
+  return request.status;
+}
+
+void nnfw_batcher::work()
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  while (true)
+  {
+    _queue_cv.wait(lock, [&]() { return _stop || !_queue.empty(); });
+    if (_queue.empty())
+      break;
+
+    // Wait for more requests within the timeout of the first one
+    const auto deadline = _queue.front()->arrival + _timeout;
+    _queue_cv.wait_until(lock, deadline, [&]() { return _stop || _queue.size() >= _max_batch; });
+
+    const auto batch_size = std::min<size_t>(_queue.size(), _max_batch);
+    std::vector<Request *> batch(_queue.begin(), _queue.begin() + batch_size);
+    _queue.erase(_queue.begin(), _queue.begin() + batch_size);
+
+    // Requests arriving meanwhile are queued for the next batch
+    lock.unlock();
+    const auto status = runBatch(batch);
+    lock.lock();
+
+    for (auto request : batch)
+    {
+      request->status = status;
+      request->done = true;
+    }
+    _done_cv.notify_all();
+  }
+}
+
+NNFW_STATUS nnfw_batcher::runBatch(const std::vector<Request *> &batch)
+{
+  const auto batch_size = static_cast<uint32_t>(batch.size());
+  VERBOSE(nnfw_batcher) << "Run a batch of " << batch_size << " requests" << std::endl;
+
+  // Gather inputs along the batch axis
+  for (uint32_t i = 0; i < _input_infos.size(); ++i)
+  {
+    auto ti = _input_infos[i];
+    ti.dims[0] = batch_size;
+    NNFW_STATUS status = _session->set_input_tensorinfo(i, &ti);
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+
+    auto &buffer = _input_buffers[i];
+    buffer.resize(_input_sizes[i] * batch_size);
+    for (uint32_t b = 0; b < batch_size; ++b)
+      std::memcpy(buffer.data() + b * _input_sizes[i], batch[b]->inputs[i], _input_sizes[i]);
+    status = _session->set_input(i, ti.dtype, buffer.data(), buffer.size());
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+  }
+
+  for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+  {
+    nnfw_tensorinfo ti;
+    NNFW_STATUS status = _session->output_tensorinfo(i, &ti);
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+
+    auto &buffer = _output_buffers[i];
+    buffer.resize(_output_sizes[i] * batch_size);
+    status = _session->set_output(i, ti.dtype, buffer.data(), buffer.size());
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+  }
+
+  NNFW_STATUS status = _session->run_async();
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+  status = _session->await();
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  // Scatter outputs to the requests
+  for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+  {
+    const auto &buffer = _output_buffers[i];
+    for (uint32_t b = 0; b < batch_size; ++b)
+      std::memcpy(batch[b]->outputs[i], buffer.data() + b * _output_sizes[i], _output_sizes[i]);
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
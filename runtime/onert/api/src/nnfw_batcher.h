@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __API_NNFW_BATCHER_H__
+#define __API_NNFW_BATCHER_H__
+
+#include "nnfw.h"
+#include "nnfw_experimental.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Front-end to run single-sample requests of threads in batches on a session
+ *
+ * Requests are collected until there are as many as the maximum batch or the first one has waited
+ * for the timeout. Inputs of the requests are concatenated along the first axis, the batch runs
+ * once on the session, and outputs are scattered back to the requests.
+ */
+struct nnfw_batcher
+{
+public:
+  nnfw_batcher(nnfw_session *session, uint32_t max_batch, uint32_t timeout_us);
+  ~nnfw_batcher();
+
+  /**
+   * @brief Prepare to run batches of the session
+   * @return @c NNFW_STATUS_NO_ERROR if every input and output of the session has batch 1
+   */
+  NNFW_STATUS prepare();
+  /**
+   * @brief     Run a request in one of batches and wait for it to finish
+   * @param[in] inputs  Buffers of a sample for each input
+   * @param[in] outputs Buffers of a sample for each output
+   * @return    Status of running the batch
+   * @note      It is thread-safe
+   */
+  NNFW_STATUS run(const void **inputs, void **outputs);
+
+private:
+  struct Request
+  {
+    const void **inputs;
+    void **outputs;
+    std::chrono::steady_clock::time_point arrival;
+    NNFW_STATUS status;
+    bool done;
+  };
+
+  void work();
+  NNFW_STATUS runBatch(const std::vector<Request *> &batch);
+
+private:
+  nnfw_session *_session;
+  const uint32_t _max_batch;
+  const std::chrono::microseconds _timeout;
+
+  std::vector<nnfw_tensorinfo> _input_infos;
+  std::vector<size_t> _input_sizes;
+  std::vector<size_t> _output_sizes;
+  std::vector<std::vector<uint8_t>> _input_buffers;
+  std::vector<std::vector<uint8_t>> _output_buffers;
+
+  std::mutex _mutex;
+  std::condition_variable _queue_cv;
+  std::condition_variable _done_cv;
+  std::deque<Request *> _queue;
+  bool _stop{false};
+  std::thread _worker;
+};
+
+#endif // __API_NNFW_BATCHER_H__
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BackendContext.h"
+
+#include "KernelTuner.h"
+#include "ProgramCache.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_cl
+{
+
+BackendContext::~BackendContext()
+{
+  // Kernels were tuned when they ran first
+  storeTuningResults();
+}
+
+FunctionMap BackendContext::genKernels()
+{
+  auto ret = acl_common::AclBackendContext<TensorBuilder, ConstantInitializer, KernelGenerator,
+                                           Optimizer>::genKernels();
+
+  // Kernels are configured, so every program the graph needs is built
+  storePrograms();
+
+  return ret;
+}
+
+} // namespace acl_cl
+} // namespace backend
+} // namespace onert
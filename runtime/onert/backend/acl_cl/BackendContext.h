@@ -32,8 +32,17 @@ namespace acl_cl
 
 class Optimizer;
 
-using BackendContext =
-  acl_common::AclBackendContext<TensorBuilder, ConstantInitializer, KernelGenerator, Optimizer>;
+class BackendContext
+  : public acl_common::AclBackendContext<TensorBuilder, ConstantInitializer, KernelGenerator,
+                                         Optimizer>
+{
+public:
+  using acl_common::AclBackendContext<TensorBuilder, ConstantInitializer, KernelGenerator,
+                                      Optimizer>::AclBackendContext;
+  ~BackendContext() override;
+
+  FunctionMap genKernels() override;
+};
 
 } // namespace acl_cl
 } // namespace backend
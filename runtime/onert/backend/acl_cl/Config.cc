@@ -24,6 +24,8 @@
 #include <arm_compute/runtime/CL/CLScheduler.h>
 
 #include "Config.h"
+#include "KernelTuner.h"
+#include "ProgramCache.h"
 
 namespace onert
 {
@@ -38,12 +40,14 @@ bool Config::initialize()
   {
     return false;
   }
-  arm_compute::CLScheduler::get().default_init();
+  arm_compute::CLScheduler::get().default_init(kernelTuner());
   // NOTE CLKernelLibraryEx must use the same context as CLScheduler
   // It did not check whether another device is available.
   arm_compute::CLKernelLibraryEx::get().init(
     "./cl_kernels/", arm_compute::CLScheduler::get().context(), cl::Device::getDefault());
 
+  restorePrograms();
+
   return true;
 }
 
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KernelTuner.h"
+
+#include <arm_compute/core/CL/OpenCL.h>
+#include <arm_compute/runtime/CL/CLTuner.h>
+#include <cl_common/ProgramBinaryCache.h>
+#include <util/ConfigSource.h>
+#include <util/logging.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+using namespace onert;
+
+struct TunerState
+{
+  std::unique_ptr<arm_compute::CLTuner> tuner;
+  std::string file;
+  size_t loaded_size = 0;
+};
+
+TunerState createTuner()
+{
+  TunerState state;
+
+  const auto mode_str = util::getConfigString(util::config::ACL_CL_TUNER_MODE);
+  if (mode_str.empty())
+    return state;
+
+  arm_compute::CLTunerMode mode;
+  if (mode_str == "RAPID")
+    mode = arm_compute::CLTunerMode::RAPID;
+  else if (mode_str == "NORMAL")
+    mode = arm_compute::CLTunerMode::NORMAL;
+  else if (mode_str == "EXHAUSTIVE")
+    mode = arm_compute::CLTunerMode::EXHAUSTIVE;
+  else
+  {
+    VERBOSE(acl_cl) << "Ignore unknown ACL_CL_TUNER_MODE " << mode_str << std::endl;
+    return state;
+  }
+
+  state.tuner = std::make_unique<arm_compute::CLTuner>(true /* tune_new_kernels */);
+  state.tuner->set_tuner_mode(mode);
+
+  const auto device = cl::Device::getDefault();
+  const cl::Platform platform{device.getInfo<CL_DEVICE_PLATFORM>()};
+  state.file = backend::cl_common::deviceCacheFile(
+    "cltuner", "acl_cl", device.getInfo<CL_DEVICE_NAME>(), device.getInfo<CL_DRIVER_VERSION>(),
+    platform.getInfo<CL_PLATFORM_VERSION>(), ".csv");
+
+  // Parameters of kernels are keyed by their configurations, so one file serves every model
+  if (!state.file.empty() && std::ifstream{state.file}.good())
+  {
+    try
+    {
+      state.tuner->load_from_file(state.file);
+      state.loaded_size = state.tuner->tuning_params_table().size();
+      VERBOSE(acl_cl) << "Loaded " << state.loaded_size << " tuned kernels from " << state.file
+                      << std::endl;
+    }
+    catch (const std::exception &e)
+    {
+      VERBOSE(acl_cl) << "Ignore tuning file " << state.file << ": " << e.what() << std::endl;
+    }
+  }
+
+  return state;
+}
+
+TunerState &tunerState()
+{
+  static TunerState state = createTuner();
+  return state;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_cl
+{
+
+arm_compute::ICLTuner *kernelTuner() { return tunerState().tuner.get(); }
+
+void storeTuningResults()
+{
+  auto &state = tunerState();
+  if (!state.tuner || state.file.empty())
+    return;
+
+  // Sessions tuning no new kernel do not write again what they loaded
+  const auto size = state.tuner->tuning_params_table().size();
+  if (size == state.loaded_size)
+    return;
+
+  if (state.tuner->save_to_file(state.file))
+    state.loaded_size = size;
+  else
+    VERBOSE(acl_cl) << "Failed to write tuning file " << state.file << std::endl;
+}
+
+} // namespace acl_cl
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_ACL_CL_KERNEL_TUNER_H__
+#define __ONERT_BACKEND_ACL_CL_KERNEL_TUNER_H__
+
+#include <arm_compute/runtime/CL/ICLTuner.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_cl
+{
+
+/**
+ * @brief Return the CLTuner of ACL_CL_TUNER_MODE(RAPID, NORMAL or EXHAUSTIVE) for CLScheduler
+ *
+ * Kernels are tuned when they run first, so the first run is slower. Tuned parameters are loaded
+ * from and stored to "<COMPILE_CACHE_DIR>/cltuner_acl_cl_<key>.csv" of the device, so that later
+ * sessions do not tune the kernels again.
+ *
+ * @return nullptr unless ACL_CL_TUNER_MODE is set
+ */
+arm_compute::ICLTuner *kernelTuner();
+
+/**
+ * @brief Store the parameters tuned after they were loaded
+ */
+void storeTuningResults();
+
+} // namespace acl_cl
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_ACL_CL_KERNEL_TUNER_H__
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_ACL_CL_PLANNED_BUFFER_H__
+#define __ONERT_BACKEND_ACL_CL_PLANNED_BUFFER_H__
+
+#include <arm_compute/core/CL/CLKernelLibrary.h>
+#include <arm_compute/runtime/CL/CLScheduler.h>
+#include <arm_compute/runtime/CL/CLTensorAllocator.h>
+
+#include <stdexcept>
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_cl
+{
+
+/**
+ * @brief OpenCL buffer of all the tensors planned, where each tensor takes a sub-buffer
+ */
+class PlannedBuffer
+{
+public:
+  PlannedBuffer(size_t capacity)
+  {
+    if (capacity > 0)
+    {
+      _buffer = cl::Buffer(arm_compute::CLScheduler::get().context(),
+                           CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, capacity);
+    }
+  }
+
+  /**
+   * @brief Get the alignment of sub-buffer origins in bytes
+   */
+  static size_t alignment()
+  {
+    const auto &device = arm_compute::CLKernelLibrary::get().get_device();
+    return device.getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>() / 8;
+  }
+
+  void import(arm_compute::CLTensorAllocator *allocator, size_t offset, size_t size)
+  {
+    if (size == 0)
+    {
+      allocator->allocate();
+      return;
+    }
+
+    cl_buffer_region region{offset, size};
+    cl_int err = CL_SUCCESS;
+    cl::Buffer sub_buffer =
+      _buffer.createSubBuffer(CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region, &err);
+    if (err != CL_SUCCESS || !bool(allocator->import_memory(sub_buffer)))
+      throw std::runtime_error("acl_cl: Failed to place a tensor in the planned buffer");
+  }
+
+private:
+  cl::Buffer _buffer;
+};
+
+} // namespace acl_cl
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_ACL_CL_PLANNED_BUFFER_H__
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ProgramCache.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/CLKernelLibraryEx.h"
+
+#include <cl_common/ProgramBinaryCache.h>
+#include <util/logging.h>
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace onert::backend;
+
+cl_common::ProgramBinaryCache &binaryCache()
+{
+  static cl_common::ProgramBinaryCache cache = [] {
+    auto &device = arm_compute::CLKernelLibrary::get().get_device();
+    const cl::Platform platform{device.getInfo<CL_DEVICE_PLATFORM>()};
+    return cl_common::ProgramBinaryCache{"acl_cl", device.getInfo<CL_DEVICE_NAME>(),
+                                         device.getInfo<CL_DRIVER_VERSION>(),
+                                         platform.getInfo<CL_PLATFORM_VERSION>()};
+  }();
+  return cache;
+}
+
+// Programs are serialized as their count, then the name and the binary of each program
+void append(std::vector<uint8_t> &data, const void *bytes, uint64_t size)
+{
+  const auto size_bytes = reinterpret_cast<const uint8_t *>(&size);
+  data.insert(data.end(), size_bytes, size_bytes + sizeof(size));
+  data.insert(data.end(), static_cast<const uint8_t *>(bytes),
+              static_cast<const uint8_t *>(bytes) + size);
+}
+
+void appendPrograms(std::vector<uint8_t> &data, const std::map<std::string, cl::Program> &programs)
+{
+  std::vector<std::pair<const std::string *, std::vector<unsigned char>>> binaries;
+  for (const auto &pair : programs)
+  {
+    // Programs are built for the only device of the context
+    auto program_binaries = pair.second.getInfo<CL_PROGRAM_BINARIES>();
+    if (program_binaries.size() == 1 && !program_binaries[0].empty())
+      binaries.emplace_back(&pair.first, std::move(program_binaries[0]));
+  }
+
+  const uint64_t count = binaries.size();
+  const auto count_bytes = reinterpret_cast<const uint8_t *>(&count);
+  data.insert(data.end(), count_bytes, count_bytes + sizeof(count));
+  for (const auto &binary : binaries)
+  {
+    append(data, binary.first->data(), binary.first->size());
+    append(data, binary.second.data(), binary.second.size());
+  }
+}
+
+class Reader
+{
+public:
+  Reader(const std::vector<uint8_t> &data) : _data{data} {}
+
+  bool read(uint64_t &value)
+  {
+    if (_data.size() - _pos < sizeof(value))
+      return false;
+    std::memcpy(&value, _data.data() + _pos, sizeof(value));
+    _pos += sizeof(value);
+    return true;
+  }
+
+  template <typename Container> bool read(Container &container)
+  {
+    uint64_t size = 0;
+    if (!read(size) || _data.size() - _pos < size)
+      return false;
+    container.assign(_data.begin() + _pos, _data.begin() + _pos + size);
+    _pos += size;
+    return true;
+  }
+
+private:
+  const std::vector<uint8_t> &_data;
+  size_t _pos = 0;
+};
+
+template <typename Library> bool restoreProgramsTo(Reader &reader, Library &library)
+{
+  uint64_t count = 0;
+  if (!reader.read(count))
+    return false;
+
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    std::string name;
+    std::vector<unsigned char> binary;
+    if (!reader.read(name) || !reader.read(binary))
+      return false;
+
+    cl_int err = CL_SUCCESS;
+    cl::Program program{library.context(), {library.get_device()}, {binary}, nullptr, &err};
+    if (err != CL_SUCCESS || program.build() != CL_SUCCESS)
+      return false;
+    library.add_built_program(name, program);
+  }
+  return true;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_cl
+{
+
+void restorePrograms()
+{
+  auto &cache = binaryCache();
+  std::vector<uint8_t> data;
+  if (!cache.load(data))
+    return;
+
+  // A binary the driver refuses leaves the rest of programs to be built from source
+  Reader reader{data};
+  try
+  {
+    if (restoreProgramsTo(reader, arm_compute::CLKernelLibrary::get()) &&
+        restoreProgramsTo(reader, arm_compute::CLKernelLibraryEx::get()))
+      return;
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(acl_cl) << e.what() << std::endl;
+  }
+  VERBOSE(acl_cl) << "Ignore cached programs not matching the device" << std::endl;
+}
+
+void storePrograms()
+{
+  auto &cache = binaryCache();
+  if (!cache.enabled())
+    return;
+
+  std::vector<uint8_t> data;
+  appendPrograms(data, arm_compute::CLKernelLibrary::get().get_built_programs());
+  appendPrograms(data, arm_compute::CLKernelLibraryEx::get().get_built_programs());
+  cache.store(data);
+}
+
+} // namespace acl_cl
+} // namespace backend
+} // namespace onert
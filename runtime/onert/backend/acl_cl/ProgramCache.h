@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_ACL_CL_PROGRAM_CACHE_H__
+#define __ONERT_BACKEND_ACL_CL_PROGRAM_CACHE_H__
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_cl
+{
+
+/**
+ * @brief Add the programs kept by storePrograms() to CLKernelLibrary and CLKernelLibraryEx, so
+ *        that kernels are created without building their programs from source
+ * @note  It does nothing unless COMPILE_CACHE_DIR is set
+ */
+void restorePrograms();
+
+/**
+ * @brief Keep the programs built by CLKernelLibrary and CLKernelLibraryEx in COMPILE_CACHE_DIR
+ */
+void storePrograms();
+
+} // namespace acl_cl
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_ACL_CL_PROGRAM_CACHE_H__
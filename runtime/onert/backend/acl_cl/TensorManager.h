@@ -25,12 +25,16 @@
 
 #include <AclMemoryManager.h>
 #include <AclLinearMemoryManager.h>
+#include <AclPlannedMemoryManager.h>
 #include <AclInternalBufferManager.h>
 #include <AclTensorManager.h>
 
 #include "operand/CLTensor.h"
 #include "operand/CLSubTensor.h"
 
+#include "PlannedBuffer.h"
+
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
 namespace onert
@@ -49,6 +53,10 @@ using LinearMemoryManager =
                                      ::arm_compute::PoolManager, ::arm_compute::BlobLifetimeManager,
                                      ::arm_compute::CLBufferAllocator, ::arm_compute::MemoryGroup>;
 
+using PlannedMemoryManager =
+  acl_common::AclPlannedMemoryManager<operand::ICLTensor, operand::CLTensor, operand::CLSubTensor,
+                                      PlannedBuffer>;
+
 using InternalBufferManager = acl_common::AclInternalBufferManager<
   ::arm_compute::MemoryManagerOnDemand, ::arm_compute::PoolManager,
   ::arm_compute::BlobLifetimeManager, ::arm_compute::CLBufferAllocator>;
@@ -58,6 +66,16 @@ using TensorManager =
 
 inline TensorManager *createTensorManager(bool is_linear_executor)
 {
+  // Offsets planned by onert in one buffer take less memory than pools of ACL
+  const auto planner_id = util::getConfigString(util::config::ACL_MEMORY_PLANNER);
+  if (!planner_id.empty())
+  {
+    VERBOSE(acl_cl_createTensorManager) << "AclTensorManager with " << planner_id << " planner"
+                                        << std::endl;
+    return new TensorManager(new MemoryManager(), new PlannedMemoryManager(planner_id),
+                             new InternalBufferManager());
+  }
+
   if (is_linear_executor)
   {
     VERBOSE(acl_cl_createTensorManager) << "AclTensorManager as Linear" << std::endl;
@@ -16,6 +16,7 @@
 
 #include "CLTensor.h"
 
+#include <arm_compute/core/CL/CLKernelLibrary.h>
 #include <arm_compute/runtime/CL/CLScheduler.h>
 #include <arm_compute/runtime/CL/CLMemory.h>
 #include <arm_compute/runtime/CL/CLMemoryRegion.h>
@@ -52,6 +53,53 @@ void CLTensor::setBuffer(void *host_ptr)
   allocator()->import_memory(buffer);
 }
 
+bool CLTensor::importHostBuffer(const void *ptr)
+{
+  const auto size = info()->total_size();
+  auto &queue = arm_compute::CLScheduler::get().queue();
+
+  // The device reads host memory in place only if it is aligned as the device requires
+  const auto &device = arm_compute::CLKernelLibrary::get().get_device();
+  const auto align_bits = device.getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>();
+  if (align_bits == 0 || reinterpret_cast<uintptr_t>(ptr) % (align_bits / 8) != 0)
+  {
+    restoreBuffer();
+    return false;
+  }
+
+  if (ptr != _imported_ptr)
+  {
+    cl_int err = CL_SUCCESS;
+    cl::Buffer buffer{arm_compute::CLScheduler::get().context(),
+                      CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY, size, const_cast<void *>(ptr), &err};
+    // The buffer of the tensor is kept alive while it is not used
+    auto own_buffer = _imported_ptr ? _own_buffer : handle()->cl_buffer();
+    if (err != CL_SUCCESS || !bool(allocator()->import_memory(buffer)))
+    {
+      restoreBuffer();
+      return false;
+    }
+    _own_buffer = own_buffer;
+    _imported_ptr = ptr;
+  }
+
+  // Host may have written the memory since the buffer was created, which unmapping makes visible
+  // to the device. It costs nothing with memory shared with the device.
+  auto mapped = queue.enqueueMapBuffer(handle()->cl_buffer(), CL_TRUE, CL_MAP_WRITE, 0, size);
+  queue.enqueueUnmapMemObject(handle()->cl_buffer(), mapped);
+  return true;
+}
+
+void CLTensor::restoreBuffer()
+{
+  if (_imported_ptr == nullptr)
+    return;
+
+  allocator()->import_memory(_own_buffer);
+  _own_buffer = cl::Buffer{};
+  _imported_ptr = nullptr;
+}
+
 } // namespace operand
 } // namespace acl_cl
 } // namespace backend
@@ -55,10 +55,21 @@ public:
    * @param[in] host_ptr Storage to be used.
    */
   void setBuffer(void *host_ptr);
+  /**
+   * @brief Import host memory with CL_MEM_USE_HOST_PTR, so that kernels read it in place
+   * @note  The memory allocated for the tensor is imported back if the next one cannot be
+   */
+  bool importHostBuffer(const void *ptr) override;
+
+private:
+  void restoreBuffer();
 
 private:
   std::shared_ptr<arm_compute::CLTensor> _cl_tensor;
   size_t _num_uses;
+  // Memory of the tensor while host memory is imported
+  cl::Buffer _own_buffer;
+  const void *_imported_ptr = nullptr;
 };
 
 } // namespace operand
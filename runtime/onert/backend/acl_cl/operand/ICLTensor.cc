@@ -52,8 +52,30 @@ void ICLTensor::enqueueReadBuffer(void *ptr, bool blocking)
 {
   auto &queue = ::arm_compute::CLScheduler::get().queue();
   queue.enqueueReadBuffer(handle()->cl_buffer(), blocking ? CL_TRUE : CL_FALSE, 0,
-                          info()->total_size(), ptr);
+                          info()->total_size(), ptr, nullptr, blocking ? nullptr : &_read_event);
+  _read_pending = !blocking;
 }
+
+bool ICLTensor::isTransferDone()
+{
+  if (!_read_pending)
+    return true;
+
+  auto status = _read_event.getInfo<CL_EVENT_COMMAND_EXECUTION_STATUS>();
+  // Negative status means an error, which is reported by waitTransfer()
+  return status == CL_COMPLETE || status < 0;
+}
+
+void ICLTensor::waitTransfer()
+{
+  if (!_read_pending)
+    return;
+
+  _read_pending = false;
+  if (_read_event.wait() != CL_SUCCESS)
+    throw std::runtime_error("ICLTensor: Failed to read buffer");
+}
+
 } // namespace operand
 } // namespace acl_cl
 } // namespace backend
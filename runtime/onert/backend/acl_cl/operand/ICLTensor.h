@@ -42,10 +42,17 @@ public:
   bool needMemoryMap() const final { return true; }
   void enqueueWriteBuffer(const void *ptr, bool blocking = true) final;
   void enqueueReadBuffer(void *ptr, bool blocking = true) final;
+  bool isTransferDone() final;
+  void waitTransfer() final;
 
 private:
   void map(cl::CommandQueue &q, bool blocking = true) { return handle()->map(q, blocking); }
   void unmap(cl::CommandQueue &q) { return handle()->unmap(q); }
+
+private:
+  // Event of the last read enqueued without blocking
+  cl::Event _read_event;
+  bool _read_pending = false;
 };
 
 } // namespace operand
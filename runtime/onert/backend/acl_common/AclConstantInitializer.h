@@ -185,6 +185,9 @@ public:
       auto tensor_obj = _tensor_reg->getNativeITensor(ind);
       assert(tensor_obj != nullptr);
       fn(model_obj, *tensor_obj);
+      // The tensor has its own copy, so pages of a lazily loaded constant can be dropped
+      if (model_obj.data())
+        model_obj.data()->release();
       VERBOSE(FillOperandData) << "Fill data for operand " << ind << std::endl;
     }
     _init_map.clear();
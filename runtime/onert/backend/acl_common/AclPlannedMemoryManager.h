@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_ACL_COMMON_PLANNED_MEMORY_MANAGER_H__
+#define __ONERT_BACKEND_ACL_COMMON_PLANNED_MEMORY_MANAGER_H__
+
+#include <cassert>
+#include <memory>
+#include <string>
+
+#include "AclMemoryManager.h"
+#include "backend/basic/MemoryPlannerFactory.h"
+#include "ir/OperandIndexMap.h"
+#include "util/logging.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_common
+{
+
+/**
+ * @brief Memory manager placing tensors at offsets planned by onert's memory planner
+ *
+ * Lifetimes claim and release memory in the planner, then all the tensors are imported from one
+ * buffer of the planned capacity. @c T_Buffer is the buffer of the device, which provides
+ * @c alignment() of offsets, a constructor taking the capacity and @c import(allocator, offset,
+ * size) to place a tensor in it.
+ */
+template <typename T_ITensor, typename T_Tensor, typename T_SubTensor, typename T_Buffer>
+class AclPlannedMemoryManager : public AclMemoryManager<T_ITensor, T_Tensor, T_SubTensor>
+{
+public:
+  AclPlannedMemoryManager(const std::string &planner_id)
+    : _planner{basic::MemoryPlannerFactory::get().create(planner_id)}
+  {
+    // DO NOTHING
+  }
+
+  virtual ~AclPlannedMemoryManager() = default;
+
+  void allocate(void) override
+  {
+    _buffer = std::make_unique<T_Buffer>(_planner->capacity());
+    VERBOSE(AclPlannedMemoryManager) << "Capacity " << _planner->capacity() << std::endl;
+
+    const auto &plans = _planner->memory_plans();
+    for (const auto &tensor_entry : this->tensors())
+    {
+      auto tensor = tensor_entry.second;
+      auto it = plans.find(tensor_entry.first);
+      if (it == plans.end())
+        tensor->allocator()->allocate();
+      else
+        _buffer->import(tensor->allocator(), it->second.offset, it->second.size);
+    }
+  }
+
+  void deallocate(void) override
+  {
+    AclMemoryManager<T_ITensor, T_Tensor, T_SubTensor>::deallocate();
+    _buffer.reset();
+  }
+
+  void startLifetime(const ir::OperandIndex &ind) override
+  {
+    auto &tensors = this->tensors();
+    assert(tensors.find(ind) != tensors.end());
+
+    // Sizes are rounded up to the alignment, so that all the offsets are aligned
+    const size_t alignment = T_Buffer::alignment();
+    const size_t size = tensors[ind]->total_size();
+    _planner->claim(ind, (size + alignment - 1) / alignment * alignment);
+  }
+
+  void finishLifetime(const ir::OperandIndex &ind) override { _planner->release(ind); }
+
+private:
+  std::unique_ptr<basic::IMemoryPlanner> _planner;
+  std::unique_ptr<T_Buffer> _buffer;
+};
+
+} // namespace acl_common
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_ACL_COMMON_PLANNED_MEMORY_MANAGER_H__
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_ACL_NEON_PLANNED_BUFFER_H__
+#define __ONERT_BACKEND_ACL_NEON_PLANNED_BUFFER_H__
+
+#include <arm_compute/runtime/TensorAllocator.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+namespace onert
+{
+namespace backend
+{
+namespace acl_neon
+{
+
+/**
+ * @brief Host memory of all the tensors planned, where each tensor takes a range
+ */
+class PlannedBuffer
+{
+public:
+  PlannedBuffer(size_t capacity) : _base{new uint8_t[capacity + alignment()]}
+  {
+    const auto addr = reinterpret_cast<uintptr_t>(_base.get());
+    _aligned = _base.get() + (alignment() - addr % alignment()) % alignment();
+  }
+
+  /**
+   * @brief Get the alignment of tensor memory in bytes, which fits vector loads of NEON kernels
+   */
+  static size_t alignment() { return 64; }
+
+  void import(arm_compute::TensorAllocator *allocator, size_t offset, size_t)
+  {
+    if (!bool(allocator->import_memory(_aligned + offset)))
+      throw std::runtime_error("acl_neon: Failed to place a tensor in the planned buffer");
+  }
+
+private:
+  std::unique_ptr<uint8_t[]> _base;
+  uint8_t *_aligned;
+};
+
+} // namespace acl_neon
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_ACL_NEON_PLANNED_BUFFER_H__
@@ -25,12 +25,16 @@
 
 #include <AclMemoryManager.h>
 #include <AclLinearMemoryManager.h>
+#include <AclPlannedMemoryManager.h>
 #include <AclInternalBufferManager.h>
 #include <AclTensorManager.h>
 
 #include "operand/NETensor.h"
 #include "operand/NESubTensor.h"
 
+#include "PlannedBuffer.h"
+
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
 namespace onert
@@ -48,6 +52,10 @@ using LinearMemoryManager = acl_common::AclLinearMemoryManager<
   ::arm_compute::PoolManager, ::arm_compute::OffsetLifetimeManager, ::arm_compute::Allocator,
   ::arm_compute::MemoryGroup>;
 
+using PlannedMemoryManager =
+  acl_common::AclPlannedMemoryManager<operand::INETensor, operand::NETensor, operand::NESubTensor,
+                                      PlannedBuffer>;
+
 using InternalBufferManager = acl_common::AclInternalBufferManager<
   ::arm_compute::MemoryManagerOnDemand, ::arm_compute::PoolManager,
   ::arm_compute::OffsetLifetimeManager, ::arm_compute::Allocator>;
@@ -57,6 +65,16 @@ using TensorManager = acl_common::AclTensorManager<acl_neon::operand::INETensor,
 
 inline TensorManager *createTensorManager(bool is_linear_executor)
 {
+  // Offsets planned by onert in one buffer take less memory than pools of ACL
+  const auto planner_id = util::getConfigString(util::config::ACL_MEMORY_PLANNER);
+  if (!planner_id.empty())
+  {
+    VERBOSE(acl_neon_createTensorManager) << "AclTensorManager with " << planner_id << " planner"
+                                          << std::endl;
+    return new TensorManager(new MemoryManager(), new PlannedMemoryManager(planner_id),
+                             new InternalBufferManager());
+  }
+
   if (is_linear_executor)
   {
     VERBOSE(acl_neon_createTensorManager) << "AclTensorManager as Linear" << std::endl;
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CL_COMMON_PROGRAM_BINARY_CACHE_H__
+#define __ONERT_BACKEND_CL_COMMON_PROGRAM_BINARY_CACHE_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cl_common
+{
+
+/**
+ * @brief Return "<COMPILE_CACHE_DIR>/<prefix>_<backend>_<key><extension>" of data valid for one
+ *        device and driver only, where the key is a hash of the device name and the driver and
+ *        platform versions
+ * @return Empty string if COMPILE_CACHE_DIR is not set
+ */
+std::string deviceCacheFile(const std::string &prefix, const std::string &backend_id,
+                            const std::string &device_name, const std::string &driver_version,
+                            const std::string &platform_version, const std::string &extension);
+
+/**
+ * @brief Compiled OpenCL programs of a backend kept on disk across sessions
+ *
+ * Building OpenCL programs from source takes seconds on some devices. A backend serializes its
+ * program binaries (CL_PROGRAM_BINARIES) in "<COMPILE_CACHE_DIR>/clprogram_<backend>_<key>.bin"
+ * of deviceCacheFile(), as binaries are valid for one device and driver only.
+ */
+class ProgramBinaryCache
+{
+public:
+  ProgramBinaryCache(const std::string &backend_id, const std::string &device_name,
+                     const std::string &driver_version, const std::string &platform_version);
+
+public:
+  /**
+   * @brief Return true if the cache is used, which needs a cache directory
+   */
+  bool enabled() const { return !_file.empty(); }
+  /**
+   * @brief Load the serialized programs
+   * @return false if nothing is cached
+   */
+  bool load(std::vector<uint8_t> &data);
+  /**
+   * @brief Store the serialized programs, unless those are what was loaded
+   */
+  void store(const std::vector<uint8_t> &data);
+
+private:
+  std::string _file;
+  uint64_t _loaded_hash = 0;
+};
+
+} // namespace cl_common
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CL_COMMON_PROGRAM_BINARY_CACHE_H__
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cl_common/ProgramBinaryCache.h"
+
+#include <util/AtomicFile.h>
+#include <util/ConfigSource.h>
+#include <util/logging.h>
+
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+
+namespace
+{
+
+// FNV-1a hash
+uint64_t hash(const void *data, size_t size, uint64_t value = 14695981039346656037ull)
+{
+  const auto bytes = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < size; ++i)
+  {
+    value ^= bytes[i];
+    value *= 1099511628211ull;
+  }
+  return value;
+}
+
+uint64_t hash(const std::string &str, uint64_t value)
+{
+  const auto size = str.size();
+  return hash(str.data(), size, hash(&size, sizeof(size), value));
+}
+
+} // namespace
+
+namespace onert
+{
+namespace backend
+{
+namespace cl_common
+{
+
+std::string deviceCacheFile(const std::string &prefix, const std::string &backend_id,
+                            const std::string &device_name, const std::string &driver_version,
+                            const std::string &platform_version, const std::string &extension)
+{
+  const auto dir = util::getConfigString(util::config::COMPILE_CACHE_DIR);
+  if (dir.empty())
+    return "";
+
+  uint64_t key = hash(nullptr, 0);
+  key = hash(device_name, key);
+  key = hash(driver_version, key);
+  key = hash(platform_version, key);
+
+  std::stringstream file;
+  file << dir << "/" << prefix << "_" << backend_id << "_" << std::hex << std::setw(16)
+       << std::setfill('0') << key << extension;
+  return file.str();
+}
+
+ProgramBinaryCache::ProgramBinaryCache(const std::string &backend_id,
+                                       const std::string &device_name,
+                                       const std::string &driver_version,
+                                       const std::string &platform_version)
+  : _file{deviceCacheFile("clprogram", backend_id, device_name, driver_version, platform_version,
+                          ".bin")}
+{
+}
+
+bool ProgramBinaryCache::load(std::vector<uint8_t> &data)
+{
+  if (!enabled())
+    return false;
+
+  std::ifstream stream(_file, std::ios::binary);
+  if (!stream.is_open())
+    return false;
+
+  data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  _loaded_hash = hash(data.data(), data.size());
+  VERBOSE(ProgramBinaryCache) << "Loaded programs from " << _file << std::endl;
+  return !data.empty();
+}
+
+void ProgramBinaryCache::store(const std::vector<uint8_t> &data)
+{
+  // Sessions building no new program do not write again what they loaded
+  if (!enabled() || data.empty() || hash(data.data(), data.size()) == _loaded_hash)
+    return;
+
+  if (!util::writeFileAtomically(_file, data.data(), data.size()))
+  {
+    VERBOSE(ProgramBinaryCache) << "Failed to write cache file " << _file << std::endl;
+    return;
+  }
+  _loaded_hash = hash(data.data(), data.size());
+}
+
+} // namespace cl_common
+} // namespace backend
+} // namespace onert
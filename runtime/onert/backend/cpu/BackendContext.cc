@@ -23,6 +23,13 @@
 #include "ir/OperandIndexMap.h"
 #include "ir/OperandIndexSequence.h"
 #include "backend/basic/BackendContextHelpers.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Concat.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/ElementwiseUnary.h"
+#include "ir/operation/Split.h"
+#include "ir/operation/SplitV.h"
+#include "ir/operation/Unpack.h"
 
 namespace onert
 {
@@ -31,12 +38,175 @@ namespace backend
 namespace cpu
 {
 
-ITensorRegistry *BackendContext::genTensors() { return basic::genTensors(*this); }
+namespace
+{
+
+// Operations which go with a kernel in ops/ that is safe to run with its output aliasing the input
+bool canRunInPlace(const ir::Graph &graph, const ir::Operation &op, const ir::OperandIndex &input)
+{
+  using ir::operation::ElementwiseUnary;
+
+  const auto &output_shape = graph.operands().at(op.getOutputs().at(0)).shape();
+  switch (op.opcode())
+  {
+    case ir::OpCode::ElementwiseActivation:
+      return true;
+    case ir::OpCode::Reshape:
+    case ir::OpCode::Squeeze:
+    case ir::OpCode::ExpandDims:
+      // Only the data input, not the shape or axis input
+      return op.getInputs().at(0) == input;
+    case ir::OpCode::ElementwiseUnary:
+    {
+      switch (static_cast<const ElementwiseUnary &>(op).param().op_type)
+      {
+        case ElementwiseUnary::Type::ABS:
+        case ElementwiseUnary::Type::CAST:
+        case ElementwiseUnary::Type::COS:
+        case ElementwiseUnary::Type::EXP:
+        case ElementwiseUnary::Type::FLOOR:
+        case ElementwiseUnary::Type::LOG:
+        case ElementwiseUnary::Type::LOGICAL_NOT:
+        case ElementwiseUnary::Type::NEG:
+        case ElementwiseUnary::Type::ROUND:
+        case ElementwiseUnary::Type::RSQRT:
+        case ElementwiseUnary::Type::SIN:
+        case ElementwiseUnary::Type::SQRT:
+        case ElementwiseUnary::Type::SQUARE:
+          return graph.operands().at(input).shape() == output_shape;
+        default:
+          return false;
+      }
+    }
+    case ir::OpCode::BinaryArithmetic:
+    {
+      // Broadcasting kernels may read an element of the input after writing the output there
+      const auto &inputs = op.getInputs();
+      return graph.operands().at(inputs.at(0)).shape() == output_shape &&
+             graph.operands().at(inputs.at(1)).shape() == output_shape;
+    }
+    default:
+      return false;
+  }
+}
+
+// Place the parts of a tensor in its memory, if they lie one after another along the axis.
+// It is the case only when all the dimensions before the axis are 1, since kernels in ops/ take
+// dense buffers, e.g. concatenation of NHWC feature maps along the channel cannot be placed.
+void placeParts(const ir::Graph &graph, const ir::OperandIndex &whole,
+                const ir::OperandIndexSequence &parts, int32_t axis, basic::SubTensorViews &views,
+                ir::OperandIndexMap<bool> &placed)
+{
+  const auto &whole_info = graph.operands().at(whole).info();
+  const auto &shape = whole_info.shape();
+  if (axis < 0)
+    axis += shape.rank();
+  if (whole_info.isDynamic() || axis < 0 || axis >= shape.rank())
+    return;
+  for (int i = 0; i < axis; ++i)
+  {
+    if (shape.dim(i) != 1)
+      return;
+  }
+
+  // A tensor can be a member of one whole only, and the parts must be copied without conversion
+  auto same_type = [&](const ir::TypeInfo &type) {
+    return type.type() == whole_info.typeInfo().type() &&
+           type.scales() == whole_info.typeInfo().scales() &&
+           type.zero_points() == whole_info.typeInfo().zero_points();
+  };
+  if (placed[whole])
+    return;
+  uint32_t offset = 0;
+  for (const auto &part : parts)
+  {
+    if (!part.valid() || part == whole || placed[part])
+      return;
+    const auto &part_info = graph.operands().at(part).info();
+    if (part_info.isDynamic() || !same_type(part_info.typeInfo()))
+      return;
+    offset += part_info.total_size();
+  }
+  if (offset != whole_info.total_size() || (parts | ir::Remove::DUPLICATED).size() != parts.size())
+    return;
+
+  offset = 0;
+  placed[whole] = true;
+  for (const auto &part : parts)
+  {
+    views[part] = basic::SubTensorView{whole, offset};
+    placed[part] = true;
+    offset += graph.operands().at(part).info().total_size();
+  }
+}
+
+// Views for the operations whose kernel in ops/ skips copying the parts which are in place
+basic::SubTensorViews findSubTensorViews(const ir::Graph &graph,
+                                         const std::vector<ir::OperationIndex> &order)
+{
+  basic::SubTensorViews views;
+  ir::OperandIndexMap<bool> placed;
+  for (const auto &op_ind : order)
+  {
+    const auto &op = graph.operations().at(op_ind);
+    switch (op.opcode())
+    {
+      case ir::OpCode::Concat:
+      {
+        const auto axis = static_cast<const ir::operation::Concat &>(op).param().axis;
+        placeParts(graph, op.getOutputs().at(0), op.getInputs(), axis, views, placed);
+        break;
+      }
+      case ir::OpCode::Split:
+      {
+        const auto &axis = graph.operands().at(op.getInputs().at(ir::operation::Split::AXIS));
+        if (axis.isConstant())
+          placeParts(graph, op.getInputs().at(ir::operation::Split::INPUT), op.getOutputs(),
+                     axis.asScalar<int32_t>(), views, placed);
+        break;
+      }
+      case ir::OpCode::SplitV:
+      {
+        const auto &axis = graph.operands().at(op.getInputs().at(ir::operation::SplitV::SPLIT_DIM));
+        if (axis.isConstant())
+          placeParts(graph, op.getInputs().at(ir::operation::SplitV::INPUT), op.getOutputs(),
+                     axis.asScalar<int32_t>(), views, placed);
+        break;
+      }
+      case ir::OpCode::Unpack:
+      {
+        const auto axis = static_cast<const ir::operation::Unpack &>(op).param().axis;
+        placeParts(graph, op.getInputs().at(ir::operation::Unpack::INPUT), op.getOutputs(), axis,
+                   views, placed);
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  return views;
+}
+
+} // namespace
+
+ITensorRegistry *BackendContext::genTensors()
+{
+  const auto &graph = *this->graph();
+  return basic::genTensors(
+    *this,
+    [&](const ir::Operation &op, const ir::OperandIndex &input) {
+      return canRunInPlace(graph, op, input);
+    },
+    findSubTensorViews(graph, _data.op_order), true);
+}
 
 FunctionMap BackendContext::genKernels()
 {
   FunctionMap ret;
 
+  // Migrant tensors are registered after genTensors, so the tensors placed in them are bound here
+  tensor_builder->bindAliases();
+
   for (auto op_ind : _data.op_order)
   {
     auto fn_seq = kernel_gen->generate(op_ind);
@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_EXTERNAL_CONTEXT_H__
 #define __ONERT_BACKEND_CPU_EXTERNAL_CONTEXT_H__
 
+#include <exec/SharedRuyContext.h>
+#include <exec/ThreadBudget.h>
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
 
@@ -35,20 +37,63 @@ private:
 public:
   ExternalContext() : _ruy_context(new ruy::Context)
   {
+    // It runs operations which do not get the shared context on the calling thread
+    _ruy_context->set_max_num_threads(1);
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
   }
 
+  ~ExternalContext()
+  {
+    // The shared context may have cached the weights of this context's kernels
+    exec::SharedRuyContext::get().clearCache();
+  }
+
+  /**
+   * @brief Drop the weights packed and cached by ruy, which are packed again on their next use
+   */
+  void clearPackedWeights()
+  {
+    _ruy_context->ClearPrepackedCache();
+    exec::SharedRuyContext::get().clearCache();
+  }
+
   void setMaxNumThreads(int max_num_threads)
   {
-    const int target_num_threads =
-      max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    // Operations may use up to the whole thread budget by default if it is enabled
+    const auto &budget = exec::ThreadBudget::get();
+    const int default_num_threads =
+      budget.enabled() ? static_cast<int>(budget.capacity()) : kDefaultNumThreadpoolThreads;
+    _max_num_threads = max_num_threads > -1 ? max_num_threads : default_num_threads;
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  int maxNumThreads() const { return _max_num_threads; }
+
+  /**
+   * @brief Lease threads from the thread budget with the ruy context shared by the backends
+   *
+   * @param cost Estimated cost of the operation to run with ruy
+   * @return Lease of the threads, which must be kept while the operation runs. While it is kept,
+   *         @c ruy_context() is the leased context on the calling thread.
+   */
+  exec::SharedRuyContext::Lease leaseThreads(uint64_t cost)
+  {
+    return exec::SharedRuyContext::get().lease(cost, static_cast<uint32_t>(_max_num_threads),
+                                               _ruy_context.get());
+  }
+
+  /**
+   * @brief Get the ruy context leased by the calling thread, or the single-threaded one of this
+   *        context if the thread has no lease
+   */
+  ruy::Context *ruy_context() const
+  {
+    auto context = exec::SharedRuyContext::current();
+    return context ? context : _ruy_context.get();
+  }
 
 private:
   const std::unique_ptr<ruy::Context> _ruy_context;
+  int _max_num_threads = kDefaultNumThreadpoolThreads;
 };
 
 } // namespace cpu
@@ -18,10 +18,14 @@
 
 #include "ops/AddNLayer.h"
 #include "ops/ArgMinMaxLayer.h"
+#include "ops/AttentionLayer.h"
+#include "ops/BCQFullyConnectedLayer.h"
+#include "ops/BCQGatherLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
 #include "ops/ConcatLayer.h"
+#include "ops/ConvertFp16Layer.h"
 #include "ops/ConvolutionLayer.h"
 #include "ops/DepthToSpaceLayer.h"
 #include "ops/DepthwiseConvolutionLayer.h"
@@ -59,10 +63,12 @@
 #include "ops/SplitLayer.h"
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
+#include "ops/TopKV2Layer.h"
 #include "ops/TransposeLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/L2NormLayer.h"
+#include "ops/LayerNormLayer.h"
 #include "ops/MatrixBandPartLayer.h"
 #include "ops/BatchMatMulLayer.h"
 #include "ops/BroadcastToLayer.h"
@@ -75,6 +81,7 @@
 #include <memory>
 #include <util/Utils.h>
 #include <util/logging.h>
+#include <cker/CpuBackendThreadpool.h>
 #include <exec/DynamicShapeInferer.h>
 
 #include <stdexcept>
@@ -121,6 +128,10 @@ convertElementwiseActivationType(ir::operation::ElementwiseActivation::Type type
       return ops::ElementwiseActivationType::kTanh;
     case ir::operation::ElementwiseActivation::Type::LEAKY_RELU:
       return ops::ElementwiseActivationType::kLeakyReLU;
+    case ir::operation::ElementwiseActivation::Type::HARD_SWISH:
+      return ops::ElementwiseActivationType::kHardSwish;
+    case ir::operation::ElementwiseActivation::Type::GELU:
+      return ops::ElementwiseActivationType::kGelu;
     default:
       throw std::runtime_error("cpu KernelGenerator : Not supported operation yet");
   }
@@ -320,7 +331,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
                   stride.horizontal, stride.vertical, dilation.width_factor, dilation.height_factor,
-                  activation, ofm_tensor);
+                  activation, ofm_tensor, _external_context);
 
     _return_fn = std::move(fn);
     return;
@@ -338,7 +349,38 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
 
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
-                dilation.width_factor, dilation.height_factor, activation, ofm_tensor);
+                dilation.width_factor, dilation.height_factor, activation, ofm_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::ConvertFp16ToFp32 &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(ir::operation::ConvertFp16ToFp32::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+
+  auto fn = std::make_unique<ops::ConvertFp16Layer>();
+
+  fn->configure(ifm_tensor, ofm_tensor);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::ConvertFp32ToFp16 &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(ir::operation::ConvertFp32ToFp16::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+
+  auto fn = std::make_unique<ops::ConvertFp16Layer>();
+
+  fn->configure(ifm_tensor, ofm_tensor);
 
   _return_fn = std::move(fn);
 }
@@ -466,6 +508,32 @@ void KernelGenerator::visit(const ir::operation::FullyConnected &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::BCQFullyConnected &node)
+{
+  using ir::operation::BCQFullyConnected;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(BCQFullyConnected::Input::INPUT)};
+  const auto scales_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_SCALES)};
+  const auto binary_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_BINARY)};
+  const auto bias_index{node.getInputs().at(BCQFullyConnected::Input::BIAS)};
+  const auto clusters_index{node.getInputs().at(BCQFullyConnected::Input::WEIGHTS_CLUSTERS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto scales_tensor = _tensor_reg->getPortableTensor(scales_index);
+  auto binary_tensor = _tensor_reg->getPortableTensor(binary_index);
+  auto bias_tensor = bias_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(bias_index);
+  auto clusters_tensor = _tensor_reg->getPortableTensor(clusters_index);
+
+  auto fn = std::make_unique<ops::BCQFullyConnectedLayer>();
+
+  fn->configure(input_tensor, scales_tensor, binary_tensor, bias_tensor, clusters_tensor,
+                node.param().weights_hidden_size, node.param().activation, output_tensor);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Reshape &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -517,7 +585,7 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -537,7 +605,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -593,7 +661,32 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
 
   auto fn = std::make_unique<ops::GatherLayer>();
 
-  fn->configure(input_tensor, indices_tensor, output_tensor, axis_value);
+  fn->configure(input_tensor, indices_tensor, output_tensor, axis_value, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::BCQGather &node)
+{
+  using ir::operation::BCQGather;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto scales_index{node.getInputs().at(BCQGather::Input::INPUT_SCALES)};
+  const auto binary_index{node.getInputs().at(BCQGather::Input::INPUT_BINARY)};
+  const auto indices_index{node.getInputs().at(BCQGather::Input::INDICES)};
+  const auto clusters_index{node.getInputs().at(BCQGather::Input::INPUT_CLUSTERS)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto scales_tensor = _tensor_reg->getPortableTensor(scales_index);
+  auto binary_tensor = _tensor_reg->getPortableTensor(binary_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto clusters_tensor = _tensor_reg->getPortableTensor(clusters_index);
+
+  auto fn = std::make_unique<ops::BCQGatherLayer>();
+
+  fn->configure(scales_tensor, binary_tensor, indices_tensor, clusters_tensor,
+                node.param().input_hidden_size, static_cast<int32_t>(node.param().axis),
+                output_tensor);
 
   _return_fn = std::move(fn);
 }
@@ -637,7 +730,7 @@ void KernelGenerator::visit(const ir::operation::Einsum &node)
 
   auto fn = std::make_unique<ops::EinsumLayer>();
 
-  fn->configure(input_tensors, equation, output_tensor);
+  fn->configure(input_tensors, equation, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -665,6 +758,17 @@ void KernelGenerator::visit(const ir::operation::Custom &node)
   params.userdata = node.userdata().data;
   params.userdata_size = node.userdata().size;
 
+  // Scratch memory is taken from the pool of dynamic tensors only while the kernel runs
+  ir::OperandInfo scratch_info{ir::Shape{0}, ir::TypeInfo{ir::DataType::UINT8},
+                               ir::MemAllocType::DYNAMIC, false};
+  params.scratch = std::make_shared<basic::Tensor>(
+    scratch_info, _current_layout, _tensor_builder->dynamicTensorManager()->dynamic_mem_mgr().get());
+  params.parallel_for = [external_context = _external_context](
+                          int size, uint64_t cost, const std::function<void(int, int)> &fn) {
+    const auto lease = external_context->leaseThreads(cost);
+    nnfw::cker::cpu_backend_threadpool::ParallelFor(size, 1, external_context->ruy_context(), fn);
+  };
+
   auto fn = _kernel_builder->buildKernel(node.id(), std::move(params));
 
   _return_fn = std::move(fn);
@@ -681,7 +785,7 @@ void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
   auto fn = std::make_unique<ops::ElementwiseActivationLayer>();
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                convertElementwiseActivationType(node.param().op_type));
+                convertElementwiseActivationType(node.param().op_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -715,13 +819,14 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
   if (node.param().op_type == ir::operation::ElementwiseUnary::Type::QUANTIZE)
   {
     auto fn = std::make_unique<ops::QuantizeLayer>();
-    fn->configure(input_tensor, output_tensor);
+    fn->configure(input_tensor, output_tensor, _external_context);
     _return_fn = std::move(fn);
   }
   else
   {
     auto fn = std::make_unique<ops::ElementwiseUnaryLayer>();
-    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type));
+    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type),
+                  _external_context);
     _return_fn = std::move(fn);
   }
 }
@@ -827,7 +932,7 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -847,7 +952,7 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
   {
     auto fn = std::make_unique<ops::MeanLayer>();
 
-    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims, _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -856,7 +961,8 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
     auto fn = std::make_unique<ops::ReduceLayer>();
 
     const auto reduce_type = convertReduceType(node.param().reduce_type);
-    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims,
+                  _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -921,7 +1027,7 @@ void KernelGenerator::visit(const ir::operation::StridedSlice &node)
   auto fn = std::make_unique<ops::StridedSliceLayer>();
 
   fn->configure(input_tensor, starts_tensor, ends_tensor, strides_tensor, output_tensor, begin_mask,
-                end_mask, shrink_axis_mask);
+                end_mask, shrink_axis_mask, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -979,7 +1085,7 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   if (node.getInputs().size() == 1)
   {
     fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
-                  align_corners, half_pixel_centers);
+                  align_corners, half_pixel_centers, _external_context);
   }
   else
   {
@@ -992,11 +1098,12 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
       const auto height_out = size_vec[0];
       const auto width_out = size_vec[1];
       fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
-                    half_pixel_centers);
+                    half_pixel_centers, _external_context);
     }
     else
     {
-      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers,
+                    _external_context);
     }
   }
 
@@ -1032,7 +1139,8 @@ void KernelGenerator::visit(const ir::operation::ArgMinMax &node)
 
   auto fn = std::make_unique<ops::ArgMinMaxLayer>();
 
-  fn->configure(input_tensor, output_tensor, axis_tensor, node.param().is_arg_max);
+  fn->configure(input_tensor, output_tensor, axis_tensor, node.param().is_arg_max,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1095,6 +1203,26 @@ void KernelGenerator::visit(const ir::operation::L2Normalization &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::LayerNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::LayerNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::LayerNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::LayerNorm::Input::BETA)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+  auto gamma_tensor = _tensor_reg->getPortableTensor(gamma_index);
+  auto beta_tensor = _tensor_reg->getPortableTensor(beta_index);
+
+  auto fn = std::make_unique<ops::LayerNormLayer>();
+
+  fn->configure(input_tensor, gamma_tensor, beta_tensor, node.param().epsilon, output_tensor,
+                _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::Range &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1160,6 +1288,22 @@ void KernelGenerator::visit(const ir::operation::Tile &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::TopKV2 &node)
+{
+  const auto values_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES)};
+  const auto indices_index{node.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES)};
+  const auto input_index{node.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+
+  auto values_tensor = _tensor_reg->getPortableTensor(values_index);
+  auto indices_tensor = _tensor_reg->getPortableTensor(indices_index);
+  auto input_tensor = _tensor_reg->getPortableTensor(input_index);
+
+  auto fn = std::make_unique<ops::TopKV2Layer>();
+
+  fn->configure(input_tensor, node.param().k, values_tensor, indices_tensor, _external_context);
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::MatrixBandPart &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1194,6 +1338,7 @@ void KernelGenerator::visit(const ir::operation::DetectionPostProcess &node)
   parameters.max_detections = node.param().max_detections;
   parameters.num_classes = node.param().num_classes;
   parameters.center_box_format = node.param().center_size_boxes;
+  parameters.use_regular_nms = !node.param().do_fast_eval;
   parameters.max_classes_per_detection = node.param().max_classes_per_detection;
 
   auto boxes_index = node.getInputs().at(NMS::Input::BOXES);
@@ -1223,6 +1368,30 @@ void KernelGenerator::visit(const ir::operation::DetectionPostProcess &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::Attention &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto query_index{node.getInputs().at(ir::operation::Attention::QUERY)};
+  const auto key_index{node.getInputs().at(ir::operation::Attention::KEY)};
+  const auto value_index{node.getInputs().at(ir::operation::Attention::VALUE)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto query_tensor = _tensor_reg->getPortableTensor(query_index);
+  auto key_tensor = _tensor_reg->getPortableTensor(key_index);
+  auto value_tensor = _tensor_reg->getPortableTensor(value_index);
+  // Mask is optional
+  const IPortableTensor *mask_tensor = nullptr;
+  if (node.getInputs().size() > ir::operation::Attention::MASK)
+    mask_tensor =
+      _tensor_reg->getPortableTensor(node.getInputs().at(ir::operation::Attention::MASK));
+
+  auto fn = std::make_unique<ops::AttentionLayer>();
+
+  fn->configure(query_tensor, key_tensor, value_tensor, mask_tensor, node.param().scale,
+                output_tensor, _external_context);
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1238,7 +1407,7 @@ void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 
   auto fn = std::make_unique<ops::BatchMatMulLayer>();
 
-  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor);
+  fn->configure(lhs_tensor, rhs_tensor, adj_x, adj_y, output_tensor, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -1292,7 +1461,7 @@ void KernelGenerator::visit(const ir::operation::LogSoftmax &node)
 
   auto fn = std::make_unique<ops::LogSoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, axis, output_tensor);
+  fn->configure(input_tensor, beta, axis, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1358,7 +1527,7 @@ void KernelGenerator::visit(const ir::operation::StatelessRandomUniform &node)
 
   auto fn = std::make_unique<ops::StatelessRandomUniformLayer>();
 
-  fn->configure(shape_alloc, seed_alloc, output_alloc);
+  fn->configure(shape_alloc, seed_alloc, output_alloc, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -1564,8 +1733,8 @@ void KernelGenerator::visit(const ir::operation::LSTM &node)
     /*forward_sequence=*/true, time_major,
     /*output_offset=*/0, scratch_buffer_tensor, output_state_out_tensor, cell_state_out_tensor,
     output_tensor,
-    !_ctx.at(output_state_in_index).info().isVariable() /* means empty buffer on frontend now */,
-    !_ctx.at(cell_state_in_index).info().isVariable());
+    _ctx.at(output_state_in_index).info().isVariable(),
+    _ctx.at(cell_state_in_index).info().isVariable(), _external_context);
 
   _return_fn = std::move(fn);
 }
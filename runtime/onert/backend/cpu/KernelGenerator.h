@@ -46,6 +46,9 @@ public:
 
   void visit(const ir::operation::AddN &) override;
   void visit(const ir::operation::ArgMinMax &) override;
+  void visit(const ir::operation::Attention &) override;
+  void visit(const ir::operation::BCQFullyConnected &) override;
+  void visit(const ir::operation::BCQGather &) override;
   void visit(const ir::operation::BatchMatMul &) override;
   void visit(const ir::operation::BatchToSpaceND &) override;
   void visit(const ir::operation::BinaryArithmetic &) override;
@@ -53,6 +56,8 @@ public:
   void visit(const ir::operation::Comparison &) override;
   void visit(const ir::operation::Concat &) override;
   void visit(const ir::operation::Conv2D &) override;
+  void visit(const ir::operation::ConvertFp16ToFp32 &) override;
+  void visit(const ir::operation::ConvertFp32ToFp16 &) override;
   void visit(const ir::operation::Custom &node) override;
   void visit(const ir::operation::DepthToSpace &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
@@ -66,6 +71,7 @@ public:
   void visit(const ir::operation::FusedBatchNorm &) override;
   void visit(const ir::operation::Gather &) override;
   void visit(const ir::operation::L2Normalization &) override;
+  void visit(const ir::operation::LayerNorm &) override;
   void visit(const ir::operation::LogSoftmax &) override;
   void visit(const ir::operation::LSTM &) override;
   void visit(const ir::operation::MatrixBandPart &) override;
@@ -94,6 +100,7 @@ public:
   void visit(const ir::operation::StatelessRandomUniform &) override;
   void visit(const ir::operation::StridedSlice &) override;
   void visit(const ir::operation::Tile &) override;
+  void visit(const ir::operation::TopKV2 &) override;
   void visit(const ir::operation::Transpose &) override;
   void visit(const ir::operation::Unpack &) override;
 
@@ -18,7 +18,7 @@
 
 #include "OperationUtils.h"
 
-#include <cker/operation/ArgMinMax.h>
+#include <cker/operation/optimized/ArgMinMax.h>
 #include <assert.h>
 
 namespace onert
@@ -29,28 +29,26 @@ namespace cpu
 {
 namespace ops
 {
-namespace
-{
-template <typename T> std::function<bool(T, T)> GetComparefunction(bool is_arg_max)
-{
-  if (is_arg_max)
-  {
-    return std::greater<T>();
-  }
-  else
-  {
-    return std::less<T>();
-  }
-}
-} // namespace
 
 void ArgMinMaxLayer::configure(const IPortableTensor *input, IPortableTensor *output,
-                               const IPortableTensor *axis, bool is_arg_max)
+                               const IPortableTensor *axis, bool is_arg_max,
+                               const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _axis = axis;
   _is_arg_max = is_arg_max;
+  _external_context = external_context;
+}
+
+template <typename T1, typename T2> void ArgMinMaxLayer::argMinMax(int32_t axis)
+{
+  // Each value is compared once
+  const auto lease =
+    _external_context->leaseThreads(static_cast<uint64_t>(_input->getShape().num_elements()));
+  nnfw::cker::optimized::ArgMinMax(getShape(_input), getBuffer<T1>(_input), getShape(_output),
+                                   getBuffer<T2>(_output), axis, _is_arg_max,
+                                   _external_context->ruy_context());
 }
 
 void ArgMinMaxLayer::run()
@@ -64,25 +62,22 @@ void ArgMinMaxLayer::run()
   {
     axis += _input->getShape().rank();
   }
-#define TF_LITE_ARG_MIN_MAX(input_type, axis_type, output_type)                 \
-  ArgMinMax(getShape(_input), getBuffer<input_type>(_input), getShape(_output), \
-            getBuffer<output_type>(_output), axis, GetComparefunction<input_type>(_is_arg_max));
   if (_output->data_type() == ir::DataType::INT32)
   {
     switch (_input->data_type())
     {
       case ir::DataType::FLOAT32:
-        TF_LITE_ARG_MIN_MAX(float, int32_t, int32_t);
+        argMinMax<float, int32_t>(axis);
         break;
       case ir::DataType::QUANT_UINT8_ASYMM:
       case ir::DataType::UINT8:
-        TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int32_t);
+        argMinMax<uint8_t, int32_t>(axis);
         break;
       case ir::DataType::QUANT_INT8_ASYMM:
-        TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int32_t);
+        argMinMax<int8_t, int32_t>(axis);
         break;
       case ir::DataType::INT32:
-        TF_LITE_ARG_MIN_MAX(int32_t, int32_t, int32_t);
+        argMinMax<int32_t, int32_t>(axis);
         break;
       default:
         throw std::runtime_error("ArgMinMax: unsupported data type");
@@ -93,17 +88,17 @@ void ArgMinMaxLayer::run()
     switch (_input->data_type())
     {
       case ir::DataType::FLOAT32:
-        TF_LITE_ARG_MIN_MAX(float, int32_t, int64_t);
+        argMinMax<float, int64_t>(axis);
         break;
       case ir::DataType::QUANT_UINT8_ASYMM:
       case ir::DataType::UINT8:
-        TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int64_t);
+        argMinMax<uint8_t, int64_t>(axis);
         break;
       case ir::DataType::QUANT_INT8_ASYMM:
-        TF_LITE_ARG_MIN_MAX(uint8_t, int32_t, int64_t);
+        argMinMax<int8_t, int64_t>(axis);
         break;
       case ir::DataType::INT32:
-        TF_LITE_ARG_MIN_MAX(int32_t, int32_t, int64_t);
+        argMinMax<int32_t, int64_t>(axis);
         break;
       default:
         throw std::runtime_error("ArgMinMax: unsupported data type");
@@ -113,8 +108,6 @@ void ArgMinMaxLayer::run()
   {
     throw std::runtime_error("ArgMinMax: unsupported data type");
   }
-
-#undef TF_LITE_ARG_MIN_MAX
 }
 
 } // namespace ops
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_ARGMINMAXLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -37,15 +38,20 @@ public:
 
 public:
   void configure(const IPortableTensor *indices, IPortableTensor *output,
-                 const IPortableTensor *axis, bool is_arg_max);
+                 const IPortableTensor *axis, bool is_arg_max,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
+private:
+  template <typename T1, typename T2> void argMinMax(int32_t axis);
+
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
   const IPortableTensor *_axis;
   bool _is_arg_max;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
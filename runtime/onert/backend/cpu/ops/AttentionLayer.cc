@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AttentionLayer.h"
+
+#include <cker/operation/Attention.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+AttentionLayer::AttentionLayer()
+  : _query(nullptr), _key(nullptr), _value(nullptr), _mask(nullptr), _output(nullptr),
+    _scale(1.f), _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+void AttentionLayer::attentionFloat32()
+{
+  nnfw::cker::AttentionParams op_params;
+  op_params.scale = _scale;
+
+  const float *mask_data = (_mask == nullptr) ? nullptr : getBuffer<float>(_mask);
+  nnfw::cker::Attention(op_params, getShape(_query), getBuffer<float>(_query), getShape(_key),
+                        getBuffer<float>(_key), getShape(_value), getBuffer<float>(_value),
+                        getShape(_mask), mask_data, getShape(_output), getBuffer<float>(_output),
+                        _external_context->ruy_context());
+}
+
+void AttentionLayer::configure(const IPortableTensor *query, const IPortableTensor *key,
+                               const IPortableTensor *value, const IPortableTensor *mask,
+                               float scale, IPortableTensor *output,
+                               const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(query != nullptr);
+  assert(key != nullptr);
+  assert(value != nullptr);
+  assert(output != nullptr);
+
+  _query = query;
+  _key = key;
+  _value = value;
+  _mask = mask;
+  _scale = scale;
+  _output = output;
+  _external_context = external_context;
+}
+
+void AttentionLayer::run()
+{
+  // Each score and each output element take a multiply-accumulate per key
+  const auto &key_shape = _key->getShape();
+  const auto key_len = key_shape.dim(key_shape.rank() - 2);
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_query->getShape().num_elements() + _output->getShape().num_elements()) *
+    key_len);
+  if (_query->data_type() == OperandType::FLOAT32)
+  {
+    attentionFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"Attention: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
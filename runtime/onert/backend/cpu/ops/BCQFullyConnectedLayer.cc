@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQFullyConnectedLayer.h"
+
+#include <cker/operation/BCQ.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQFullyConnectedLayer::BCQFullyConnectedLayer()
+  : _input(nullptr), _weights_scales(nullptr), _weights_binary(nullptr), _bias(nullptr),
+    _weights_clusters(nullptr), _output(nullptr), _weights_hidden_size(0),
+    _activation(ir::Activation::NONE)
+{
+  // DO NOTHING
+}
+
+void BCQFullyConnectedLayer::configure(const IPortableTensor *input,
+                                       const IPortableTensor *weights_scales,
+                                       const IPortableTensor *weights_binary,
+                                       const IPortableTensor *bias,
+                                       const IPortableTensor *weights_clusters,
+                                       uint32_t weights_hidden_size, ir::Activation activation,
+                                       IPortableTensor *output)
+{
+  _input = input;
+  _weights_scales = weights_scales;
+  _weights_binary = weights_binary;
+  _bias = bias;
+  _weights_clusters = weights_clusters;
+  _weights_hidden_size = weights_hidden_size;
+  _activation = activation;
+  _output = output;
+}
+
+void BCQFullyConnectedLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32 || _output->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"BCQFullyConnected: only float32 input is supported"};
+
+  const auto input_shape = getShape(_input);
+  if (input_shape.DimensionsCount() != 2 ||
+      input_shape.Dims(0) != static_cast<int>(_weights_hidden_size))
+    throw std::runtime_error{"BCQFullyConnected: input must be [weights_hidden_size, batch]"};
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  nnfw::cker::BCQFullyConnected(
+    op_params, input_shape, getBuffer<float>(_input), getBuffer<float>(_weights_scales),
+    getShape(_weights_binary), getBuffer<int32_t>(_weights_binary), getShape(_weights_clusters),
+    getBuffer<int32_t>(_weights_clusters), _bias ? getBuffer<float>(_bias) : nullptr,
+    getShape(_output), getBuffer<float>(_output), _lookup_tables);
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BCQGatherLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/BCQ.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+BCQGatherLayer::BCQGatherLayer()
+  : _input_scales(nullptr), _input_binary(nullptr), _indices(nullptr), _input_clusters(nullptr),
+    _output(nullptr), _input_hidden_size(0), _axis(0)
+{
+  // DO NOTHING
+}
+
+void BCQGatherLayer::configure(const IPortableTensor *input_scales,
+                               const IPortableTensor *input_binary, const IPortableTensor *indices,
+                               const IPortableTensor *input_clusters, uint32_t input_hidden_size,
+                               int32_t axis, IPortableTensor *output)
+{
+  _input_scales = input_scales;
+  _input_binary = input_binary;
+  _indices = indices;
+  _input_clusters = input_clusters;
+  _input_hidden_size = input_hidden_size;
+  _axis = axis;
+  _output = output;
+}
+
+void BCQGatherLayer::run()
+{
+  if (_output->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"BCQGather: only float32 output is supported"};
+  if (_axis != 0 && _axis != 1)
+    throw std::runtime_error{"BCQGather: axis must be 0 or 1"};
+
+  const int hidden = static_cast<int>(_input_hidden_size);
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      nnfw::cker::BCQGather(getBuffer<float>(_input_scales), getShape(_input_binary),
+                            getBuffer<int32_t>(_input_binary), getShape(_input_clusters),
+                            getBuffer<int32_t>(_input_clusters), hidden, _axis, getShape(_indices),
+                            getBuffer<int32_t>(_indices), getShape(_output),
+                            getBuffer<float>(_output));
+      break;
+    case OperandType::INT64:
+      nnfw::cker::BCQGather(getBuffer<float>(_input_scales), getShape(_input_binary),
+                            getBuffer<int32_t>(_input_binary), getShape(_input_clusters),
+                            getBuffer<int32_t>(_input_clusters), hidden, _axis, getShape(_indices),
+                            getBuffer<int64_t>(_indices), getShape(_output),
+                            getBuffer<float>(_output));
+      break;
+    default:
+      throw std::runtime_error{"BCQGather: unsupported indices data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
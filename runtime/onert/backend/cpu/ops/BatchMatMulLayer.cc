@@ -16,7 +16,7 @@
 
 #include "BatchMatMulLayer.h"
 
-#include <cker/operation/BatchMatMul.h>
+#include <cker/operation/optimized/BatchMatMul.h>
 
 namespace onert
 {
@@ -29,7 +29,7 @@ namespace ops
 
 BatchMatMulLayer::BatchMatMulLayer()
   : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
-    _kernel(new nnfw::cker::BatchMatMul())
+    _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -38,20 +38,44 @@ BatchMatMulLayer::~BatchMatMulLayer() = default;
 
 void BatchMatMulLayer::batchMatMulFloat32()
 {
-  nnfw::cker::BatchMatMul &batchmatmul_kernel = *_kernel;
-  nnfw::cker::Shape lhs_shape = getShape(_lhs);
-  nnfw::cker::Shape rhs_shape = getShape(_rhs);
-  nnfw::cker::Shape output_shape = getShape(_output);
-
   // TODO implement for constant input
 
-  batchmatmul_kernel.prepare(lhs_shape, rhs_shape, _adj_x, _adj_y);
-  batchmatmul_kernel(lhs_shape, getBuffer<float>(_lhs), rhs_shape, getBuffer<float>(_rhs), _adj_x,
-                     _adj_y, output_shape, getBuffer<float>(_output));
+  // Adjoint operands are read in place, so no temporary buffer is needed
+  nnfw::cker::optimized::BatchMatMul(getShape(_lhs), getBuffer<float>(_lhs), getShape(_rhs),
+                                     getBuffer<float>(_rhs), _adj_x, _adj_y, getShape(_output),
+                                     getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+void BatchMatMulLayer::batchMatMulQuant8()
+{
+  const double real_multiplier =
+    static_cast<double>(_lhs->data_scale()) * _rhs->data_scale() / _output->data_scale();
+  int32_t output_multiplier = 0;
+  int32_t output_shift = 0;
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+  CalculateActivationRangeQuantized(ir::Activation::NONE, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::BatchMatMulParams op_params;
+  op_params.lhs_zero_point = _lhs->data_zero_point();
+  op_params.rhs_zero_point = _rhs->data_zero_point();
+  op_params.output_zero_point = _output->data_zero_point();
+  op_params.output_multiplier = output_multiplier;
+  op_params.output_shift = output_shift;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::optimized::BatchMatMul(op_params, getShape(_lhs), getBuffer<int8_t>(_lhs),
+                                     getShape(_rhs), getBuffer<int8_t>(_rhs), _adj_x, _adj_y,
+                                     getShape(_output), getBuffer<int8_t>(_output),
+                                     _external_context->ruy_context());
 }
 
 void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x,
-                                 bool adj_y, IPortableTensor *output)
+                                 bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -62,14 +86,25 @@ void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTens
   _adj_x = adj_x;
   _adj_y = adj_y;
   _output = output;
+  _external_context = external_context;
 }
 
 void BatchMatMulLayer::run()
 {
+  // Each output element takes a multiply-accumulate per element of the contracted dimension
+  const auto &lhs_shape = _lhs->getShape();
+  const auto depth = lhs_shape.dim(lhs_shape.rank() - (_adj_x ? 2 : 1));
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * depth);
   if ((_lhs->data_type() == OperandType::FLOAT32) && (_rhs->data_type() == OperandType::FLOAT32))
   {
     batchMatMulFloat32();
   }
+  else if ((_lhs->data_type() == OperandType::QUANT_INT8_ASYMM) &&
+           (_rhs->data_type() == OperandType::QUANT_INT8_ASYMM))
+  {
+    batchMatMulQuant8();
+  }
   else
   {
     throw std::runtime_error{"BatchMatMul: unsupported data type"};
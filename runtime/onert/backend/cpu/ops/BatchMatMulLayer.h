@@ -19,17 +19,10 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
-namespace nnfw
-{
-namespace cker
-{
-class BatchMatMul;
-}
-} // namespace nnfw
-
 namespace onert
 {
 namespace backend
@@ -47,9 +40,10 @@ public:
 
 public:
   void batchMatMulFloat32();
+  void batchMatMulQuant8();
 
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, bool adj_x, bool adj_y,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -61,7 +55,7 @@ private:
   bool _adj_x;
   bool _adj_y;
 
-  std::unique_ptr<nnfw::cker::BatchMatMul> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
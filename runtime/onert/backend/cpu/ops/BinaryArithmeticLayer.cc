@@ -17,6 +17,8 @@
 #include "BinaryArithmeticLayer.h"
 
 #include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/BinaryArithmeticFp16.h>
+#include <cker/operation/BinaryArithmeticInt16.h>
 
 namespace onert
 {
@@ -54,7 +56,8 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     _need_broadcast = nnfw::cker::ProcessBroadcastShapes(_lhs_shape, _rhs_shape, &_op_params);
   }
 
-  void operator()(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output)
+  void operator()(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
+                  ruy::Context *ruy_context)
   {
     // Assume dynamic tensors never become static and static ones never change shape since
     // configure()
@@ -69,18 +72,49 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     if (_need_broadcast)
     {
       nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        ruy_context);
     }
     else
     {
       nnfw::cker::BinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        ruy_context);
     }
   }
 };
 
+template <nnfw::cker::BinaryArithmeticOpType arithmetic_type> struct EvalFp16
+{
+  nnfw::cker::BinaryArithmeticOpParam _op_params;
+
+  void operator()(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
+                  ruy::Context *ruy_context)
+  {
+    nnfw::cker::BinaryArithmeticFp16(
+      arithmetic_type, _op_params, getShape(lhs), getBuffer<nnfw::cker::float16>(lhs),
+      getShape(rhs), getBuffer<nnfw::cker::float16>(rhs), getShape(output),
+      getBuffer<nnfw::cker::float16>(output), ruy_context);
+  }
+};
+
+template <nnfw::cker::BinaryArithmeticOpType arithmetic_type> struct EvalInt16
+{
+  nnfw::cker::BinaryArithmeticOpParam _op_params;
+
+  void operator()(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
+                  ruy::Context *ruy_context)
+  {
+    nnfw::cker::BinaryArithmeticInt16(arithmetic_type, _op_params, getShape(lhs),
+                                      getBuffer<int16_t>(lhs), getShape(rhs),
+                                      getBuffer<int16_t>(rhs), getShape(output),
+                                      getBuffer<int16_t>(output), ruy_context);
+  }
+};
+
 template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
-std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
+std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *,
+                   ruy::Context *)>
 generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
                       IPortableTensor *output, const ir::Activation activation,
                       nnfw::cker::BinaryArithmeticOpParam &op_params)
@@ -96,6 +130,15 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
       break;
     }
+    case OperandType::FLOAT16:
+    {
+      float output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
+      op_params.float_activation_max = output_activation_max;
+      op_params.float_activation_min = output_activation_min;
+      return EvalFp16<arithmetic_type>{op_params};
+      break;
+    }
     case OperandType::INT32:
     {
       int32_t output_activation_min = 0, output_activation_max = 0;
@@ -110,9 +153,10 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
   }
 }
 
+// int16 inputs take a smaller left shift so that the shifted values still fit in 32 bits
 void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
                              IPortableTensor *output, ir::Activation activation,
-                             nnfw::cker::BinaryArithmeticOpParam *params)
+                             nnfw::cker::BinaryArithmeticOpParam *params, int32_t left_shift = 20)
 {
   int32_t output_activation_min, output_activation_max;
   CalculateActivationRangeQuantized(activation, output, &output_activation_min,
@@ -121,7 +165,7 @@ void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *
   op_params.quantized_activation_max = output_activation_max;
   op_params.quantized_activation_min = output_activation_min;
   // Parameters for scaled quantized computation
-  op_params.left_shift = 20;
+  op_params.left_shift = left_shift;
   // Zero-points of input and output tensors
   op_params.input1_offset = -lhs->data_zero_point();
   op_params.input2_offset = -rhs->data_zero_point();
@@ -165,7 +209,8 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                                       IPortableTensor *output, const ir::Activation activation,
-                                      const ArithmeticType arithmetic_type)
+                                      const ArithmeticType arithmetic_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -174,6 +219,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
   _lhs = lhs;
   _rhs = rhs;
   _output = output;
+  _external_context = external_context;
 
   nnfw::cker::BinaryArithmeticOpParam op_params;
   switch (arithmetic_type)
@@ -191,6 +237,11 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
         _kernel =
           Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output, op_params);
       }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params, 15);
+        _kernel = EvalInt16<nnfw::cker::BinaryArithmeticOpType::ADD>{op_params};
+      }
 
       else
       {
@@ -213,6 +264,12 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
         _kernel =
           Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output, op_params);
       }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        // The kernel subtracts, as its multipliers must be positive
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params, 15);
+        _kernel = EvalInt16<nnfw::cker::BinaryArithmeticOpType::SUB>{op_params};
+      }
 
       else
       {
@@ -235,6 +292,11 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
         _kernel =
           Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output, op_params);
       }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = EvalInt16<nnfw::cker::BinaryArithmeticOpType::MUL>{op_params};
+      }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(
@@ -262,7 +324,11 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
   }
 }
 
-void BinaryArithmeticLayer::run() { _kernel(_lhs, _rhs, _output); }
+void BinaryArithmeticLayer::run()
+{
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+  _kernel(_lhs, _rhs, _output, _external_context->ruy_context());
+}
 
 } // namespace ops
 } // namespace cpu
@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -42,14 +43,16 @@ enum class ArithmeticType
 class BinaryArithmeticLayer : public ::onert::exec::IFunction
 {
 public:
-  BinaryArithmeticLayer() : _lhs(nullptr), _rhs(nullptr), _output(nullptr)
+  BinaryArithmeticLayer()
+    : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _external_context(nullptr)
   {
     // DO NOTHING
   }
 
 public:
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-                 const ir::Activation activation, const ArithmeticType arithmetic_type);
+                 const ir::Activation activation, const ArithmeticType arithmetic_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -58,7 +61,11 @@ private:
   const IPortableTensor *_rhs;
   IPortableTensor *_output;
 
-  std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
+
+  std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *,
+                     ruy::Context *)>
+    _kernel;
 };
 
 } // namespace ops
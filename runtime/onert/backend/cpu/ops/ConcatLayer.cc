@@ -116,6 +116,9 @@ void ConcatLayer::configure(const std::vector<const IPortableTensor *> &inputs,
 
 void ConcatLayer::run()
 {
+  if (isPlacedInWhole(_output, _inputs))
+    return;
+
   switch (_output->data_type())
   {
     case OperandType::FLOAT32:
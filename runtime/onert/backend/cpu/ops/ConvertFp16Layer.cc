@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ConvertFp16Layer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/Fp16.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+ConvertFp16Layer::ConvertFp16Layer() : _input(nullptr), _output(nullptr)
+{
+  // DO NOTHING
+}
+
+void ConvertFp16Layer::configure(const IPortableTensor *input, IPortableTensor *output)
+{
+  _input = input;
+  _output = output;
+}
+
+void ConvertFp16Layer::run()
+{
+  const int size = getNumberOfElements(_input);
+  if (_input->data_type() == OperandType::FLOAT32 && _output->data_type() == OperandType::FLOAT16)
+  {
+    nnfw::cker::ConvertFloatToFp16(getBuffer<float>(_input),
+                                   getBuffer<nnfw::cker::float16>(_output), size);
+  }
+  else if (_input->data_type() == OperandType::FLOAT16 &&
+           _output->data_type() == OperandType::FLOAT32)
+  {
+    nnfw::cker::ConvertFp16ToFloat(getBuffer<nnfw::cker::float16>(_input),
+                                   getBuffer<float>(_output), size);
+  }
+  else
+  {
+    throw std::runtime_error{"ConvertFp16: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -19,7 +19,20 @@
 
 #include "../Tensor.h"
 #include "ir/Padding.h"
+#include "util/ConfigSource.h"
+#include "util/TuningCache.h"
+#include "util/WeightStore.h"
+#include "util/logging.h"
 #include <cker/operation/Conv.h>
+#include <cker/operation/ConvFp16.h>
+#include <cker/operation/ConvInt16.h>
+#include <cker/operation/FullyConnectedBlockSparse.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <sstream>
+#include <vector>
 
 namespace onert
 {
@@ -41,7 +54,38 @@ ConvolutionLayer::ConvolutionLayer()
 
 ConvolutionLayer::~ConvolutionLayer() = default;
 
+namespace
+{
+
+// Timed runs of each kernel in autotuning, after a run to warm up
+constexpr int kAutotuneRuns = 3;
+
+const char *getAlgorithmName(nnfw::cker::ConvAlgorithm algorithm)
+{
+  switch (algorithm)
+  {
+    case nnfw::cker::ConvAlgorithm::kWinograd:
+      return "winograd";
+    case nnfw::cker::ConvAlgorithm::kDirect:
+      return "direct";
+    case nnfw::cker::ConvAlgorithm::kMultithreaded:
+      return "multithreaded";
+    case nnfw::cker::ConvAlgorithm::kReference:
+      return "reference";
+    default:
+      return "default";
+  }
+}
+
+} // namespace
+
 void ConvolutionLayer::convFloat32()
+{
+  convFloat32(*_conv_kernel, getBuffer<float>(_input), getBuffer<float>(_output));
+}
+
+void ConvolutionLayer::convFloat32(nnfw::cker::Conv &kernel, const float *input_data,
+                                   float *output_data)
 {
   float output_activation_min = 0, output_activation_max = 0;
   CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
@@ -57,10 +101,50 @@ void ConvolutionLayer::convFloat32()
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
 
-  nnfw::cker::Conv &kernel = *_conv_kernel;
-  kernel(op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
-         getBuffer<float>(_kernel), getShape(_bias), getBuffer<float>(_bias), getShape(_output),
-         getBuffer<float>(_output));
+  if (kernel.hasWinogradFilter() || kernel.usesDirectConv(getShape(_kernel)))
+  {
+    // Only the Winograd and direct kernels run on the threads of the context
+    const auto &kernel_shape = _kernel->getShape();
+    const auto lease = _external_context->leaseThreads(
+      static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+      kernel_shape.dim(2) * kernel_shape.dim(3));
+    kernel(op_params, getShape(_input), input_data, getShape(_kernel), getBuffer<float>(_kernel),
+           getShape(_bias), getBuffer<float>(_bias), getShape(_output), output_data,
+           _external_context->ruy_context());
+    return;
+  }
+
+  kernel(op_params, getShape(_input), input_data, getShape(_kernel), getBuffer<float>(_kernel),
+         getShape(_bias), getBuffer<float>(_bias), getShape(_output), output_data);
+}
+
+void ConvolutionLayer::convFloat16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  // Each output element takes a multiply-accumulate per kernel element
+  const auto &kernel_shape = _kernel->getShape();
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+    kernel_shape.dim(2) * kernel_shape.dim(3));
+
+  const auto *bias = _bias ? getBuffer<nnfw::cker::float16>(_bias) : nullptr;
+  nnfw::cker::ConvFp16(op_params, getShape(_input), getBuffer<nnfw::cker::float16>(_input),
+                       getShape(_kernel), getBuffer<nnfw::cker::float16>(_kernel), getShape(_bias),
+                       bias, getShape(_output), getBuffer<nnfw::cker::float16>(_output),
+                       _external_context->ruy_context());
 }
 
 void ConvolutionLayer::convQuant8()
@@ -117,12 +201,91 @@ void ConvolutionLayer::convQuant8PerChannel()
   op_params.padding_values.width = _paddingLeft;
   op_params.quantized_activation_min = output_activation_min;
   op_params.quantized_activation_max = output_activation_max;
+  // Constant filter can be packed once by ruy and reused over runs
+  op_params.lhs_cacheable = _kernel->is_constant();
+
+  // Each output element takes a multiply-accumulate per kernel element
+  const auto &kernel_shape = _kernel->getShape();
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+    kernel_shape.dim(2) * kernel_shape.dim(3));
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
   kernel(op_params, getShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
          getShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()), getShape(_bias),
          reinterpret_cast<const int32_t *>(_bias->buffer()), getShape(_output),
-         reinterpret_cast<int8_t *>(_output->buffer()));
+         reinterpret_cast<int8_t *>(_output->buffer()), _external_context->ruy_context());
+}
+
+void ConvolutionLayer::convQuant16()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.stride_height = _strideHeight;
+  op_params.stride_width = _strideWidth;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.padding_values.height = _paddingTop;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  // Each output element takes a multiply-accumulate per kernel element
+  const auto &kernel_shape = _kernel->getShape();
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+    kernel_shape.dim(2) * kernel_shape.dim(3));
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  nnfw::cker::ConvInt16(op_params, kernel.per_channel_output_multiplier().data(),
+                        kernel.per_channel_output_shift().data(), getShape(_input),
+                        getBuffer<int16_t>(_input), getShape(_kernel), getBuffer<int8_t>(_kernel),
+                        getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr,
+                        getShape(_output), getBuffer<int16_t>(_output),
+                        _external_context->ruy_context());
+}
+
+void ConvolutionLayer::convBlockSparse()
+{
+  // Pixels of a 1x1 stride-1 convolution without padding are the batches of FullyConnected
+  const auto &input_shape = _input->getShape();
+  const auto &kernel_shape = _kernel->getShape();
+  const int pixels = input_shape.num_elements() / input_shape.dim(3);
+  const auto fc_input_shape = nnfw::cker::Shape{pixels, input_shape.dim(3)};
+  const auto fc_output_shape = nnfw::cker::Shape{pixels, kernel_shape.dim(0)};
+
+  const auto values = _block_sparse_float ? _block_sparse_float->values.size()
+                                          : _block_sparse_int8->values.size();
+  const auto lease = _external_context->leaseThreads(static_cast<uint64_t>(pixels) * values);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  if (_block_sparse_float)
+  {
+    CalculateActivationRange(_activation, &op_params.float_activation_min,
+                             &op_params.float_activation_max);
+    nnfw::cker::FullyConnectedBlockSparse(
+      op_params, fc_input_shape, getBuffer<float>(_input), *_block_sparse_float,
+      _bias ? getBuffer<float>(_bias) : nullptr, fc_output_shape, getBuffer<float>(_output),
+      _external_context->ruy_context());
+    return;
+  }
+
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  CalculateActivationRangeQuantized(_activation, _output, &op_params.quantized_activation_min,
+                                    &op_params.quantized_activation_max);
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  nnfw::cker::FullyConnectedBlockSparse(
+    op_params, kernel.per_channel_output_multiplier().data(),
+    kernel.per_channel_output_shift().data(), fc_input_shape, getBuffer<int8_t>(_input),
+    *_block_sparse_int8, _bias ? getBuffer<int32_t>(_bias) : nullptr, fc_output_shape,
+    getBuffer<int8_t>(_output), _external_context->ruy_context());
 }
 
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
@@ -132,7 +295,8 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
                                  const uint32_t strideWidth, const uint32_t strideHeight,
                                  const uint32_t dilationWidthFactor,
                                  const uint32_t dilationHeightFactor,
-                                 const ir::Activation activation, IPortableTensor *output)
+                                 const ir::Activation activation, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _kernel = kernel;
@@ -148,6 +312,7 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _dilationHeightFactor = dilationHeightFactor;
   _activation = activation;
   _output = output;
+  _external_context = external_context;
 }
 
 void ConvolutionLayer::run()
@@ -183,10 +348,18 @@ void ConvolutionLayer::run()
     _paddingTop = padding.top;
     _paddingBottom = padding.bottom;
   }
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (_block_sparse_float || _block_sparse_int8)
+  {
+    convBlockSparse();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    convFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     convQuant8();
@@ -195,6 +368,10 @@ void ConvolutionLayer::run()
   {
     convQuant8PerChannel();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    convQuant16();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -207,11 +384,84 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  const bool is_block_sparse = prepareBlockSparse();
+  if (!is_block_sparse && _input->data_type() == OperandType::FLOAT32 && _kernel->is_constant() &&
+      !_input->is_dynamic() && !_output->is_dynamic() &&
+      util::getConfigBool(util::config::CPU_AUTOTUNE))
+    autotuneFloat32();
+
+  if (is_block_sparse)
+  {
+    // The filter itself is not read anymore
+    auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
+    if (kernel_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant() &&
+           kernel.usesWinograd(getShape(_kernel), _strideWidth, _strideHeight, _dilationWidthFactor,
+                          _dilationHeightFactor))
   {
+    // The transformed filter takes 16 values per 9 of the filter, and sessions with the same
+    // weights share it through the store as the transposed one
+    const auto store = util::WeightStore::get(util::config::CPU_PACKED_WEIGHT_DIR);
+    const auto filter_size = _kernel->total_size() / 9 * 16;
+    uint64_t key = 0;
+    if (store)
+    {
+      key = util::WeightStore::key("conv_winograd", _kernel->buffer(), _kernel->total_size());
+      _packed_kernel = store->load(key, filter_size);
+    }
+    if (!_packed_kernel)
+    {
+      kernel.prepareWinograd(getShape(_kernel), getBuffer<float>(_kernel));
+      if (store)
+        _packed_kernel = store->store(
+          key, reinterpret_cast<const uint8_t *>(kernel.winogradFilter().data()), filter_size);
+    }
+    if (_packed_kernel)
+      kernel.setWinogradFilter(reinterpret_cast<const float *>(_packed_kernel->base()));
+
+    // The filter itself is not read anymore
+    auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
+    if (kernel_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  {
+    // Sessions with the same weights map the transposed filter from the store instead of keeping
+    // their own copies
+    const auto store = util::WeightStore::get(util::config::CPU_PACKED_WEIGHT_DIR);
+    const bool use_store = store && kernel.transposesFilter(getShape(_kernel),
+                                                            getPaddingType(_paddingType),
+                                                            _dilationWidthFactor,
+                                                            _dilationHeightFactor);
+    const auto kernel_size = _kernel->total_size();
+    uint64_t key = 0;
+    if (use_store)
+    {
+      key = util::WeightStore::key("conv_hwcn", _kernel->buffer(), kernel_size);
+      _packed_kernel = store->load(key, kernel_size);
+    }
+
     bool is_transposed = false;
-    kernel.prepare(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
-                   is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+    if (!_packed_kernel)
+    {
+      kernel.prepare(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
+                     is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+      if (use_store && is_transposed)
+      {
+        const auto &transposed = kernel.transposedFilter();
+        _packed_kernel =
+          store->store(key, reinterpret_cast<const uint8_t *>(transposed.data()), kernel_size);
+      }
+    }
+    if (_packed_kernel)
+    {
+      kernel.setTransposedFilter(reinterpret_cast<const float *>(_packed_kernel->base()));
+      is_transposed = true;
+    }
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
@@ -242,9 +492,147 @@ void ConvolutionLayer::prepare()
       throw std::runtime_error{"Conv2D: Int8 dynamic weight is not supported"};
     }
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    // Scales are known even for dynamic tensors
+    if (!IsQuant16x8(_input, _kernel))
+      throw std::runtime_error{"Conv2D: Int16 input needs zero point 0 and int8 weights"};
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+      _kernel->data_scales().size(), getShape(_kernel).Dims(0),
+      kernel.per_channel_output_multiplier(), kernel.per_channel_output_shift());
+  }
   _prepare = true;
 }
 
+void ConvolutionLayer::autotuneFloat32()
+{
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  const auto padding_type = getPaddingType(_paddingType);
+  const auto algorithms =
+    kernel.usableAlgorithms(getShape(_kernel), padding_type, _strideWidth, _strideHeight,
+                            _dilationWidthFactor, _dilationHeightFactor);
+
+  // Timings depend on the shapes and the number of threads, but not on the values
+  std::stringstream key;
+  key << "conv2d_float32";
+  const std::vector<const IPortableTensor *> tensors{_input, _kernel, _output};
+  for (const auto tensor : tensors)
+  {
+    const auto &shape = tensor->getShape();
+    key << "_";
+    for (int i = 0; i < shape.rank(); ++i)
+      key << (i == 0 ? "" : "x") << shape.dim(i);
+  }
+  key << "_s" << _strideWidth << "x" << _strideHeight << "_d" << _dilationWidthFactor << "x"
+      << _dilationHeightFactor << "_p" << _paddingLeft << "x" << _paddingTop << "_t"
+      << _external_context->maxNumThreads();
+
+  const auto cache = util::TuningCache::get(util::config::CPU_AUTOTUNE_CACHE);
+  if (cache)
+  {
+    const auto name = cache->lookup(key.str());
+    for (const auto algorithm : algorithms)
+    {
+      if (name == getAlgorithmName(algorithm))
+      {
+        kernel.setAlgorithm(algorithm);
+        return;
+      }
+    }
+  }
+
+  // Small values not to measure denormals, and buffers of its own not to touch the tensors
+  std::vector<float> input(getShape(_input).FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+  std::vector<float> output(getShape(_output).FlatSize());
+
+  auto best = nnfw::cker::ConvAlgorithm::kDefault;
+  double best_time = std::numeric_limits<double>::max();
+  for (const auto algorithm : algorithms)
+  {
+    nnfw::cker::Conv candidate;
+    candidate.setAlgorithm(algorithm);
+    if (algorithm == nnfw::cker::ConvAlgorithm::kWinograd)
+    {
+      candidate.prepareWinograd(getShape(_kernel), getBuffer<float>(_kernel));
+    }
+    else
+    {
+      bool is_transposed = false;
+      candidate.prepare(getShape(_kernel), getBuffer<float>(_kernel), padding_type, is_transposed,
+                        _dilationWidthFactor, _dilationHeightFactor);
+    }
+
+    double time = std::numeric_limits<double>::max();
+    for (int i = 0; i <= kAutotuneRuns; ++i)
+    {
+      const auto begin = std::chrono::steady_clock::now();
+      convFloat32(candidate, input.data(), output.data());
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+      if (i > 0)
+        time = std::min(time, elapsed.count());
+    }
+    VERBOSE(ConvolutionLayer) << key.str() << " " << getAlgorithmName(algorithm) << ": "
+                              << time * 1e6 << " us" << std::endl;
+    if (time < best_time)
+    {
+      best = algorithm;
+      best_time = time;
+    }
+  }
+
+  kernel.setAlgorithm(best);
+  if (cache)
+    cache->store(key.str(), getAlgorithmName(best));
+}
+
+bool ConvolutionLayer::prepareBlockSparse()
+{
+  const auto &kernel_shape = _kernel->getShape();
+  if (!_kernel->is_constant() || kernel_shape.dim(1) != 1 || kernel_shape.dim(2) != 1 ||
+      _strideWidth != 1 || _strideHeight != 1 || _paddingLeft != 0 || _paddingRight != 0 ||
+      _paddingTop != 0 || _paddingBottom != 0)
+    return false;
+
+  // Int8 filters are sparse only if their zero is 0
+  const auto &zero_points = _kernel->data_zero_points();
+  const bool is_float = _input->data_type() == OperandType::FLOAT32 &&
+                        _kernel->data_type() == OperandType::FLOAT32;
+  const bool is_int8 =
+    _input->data_type() == OperandType::QUANT_INT8_ASYMM &&
+    std::all_of(zero_points.begin(), zero_points.end(), [](int32_t zp) { return zp == 0; });
+  if (!is_float && !is_int8)
+    return false;
+
+  // The filter of [depth_out, 1, 1, depth_in] is the weights of FullyConnected
+  const int rows = kernel_shape.dim(0);
+  const int cols = kernel_shape.dim(3);
+  int block_rows = 0, block_cols = 0;
+  if (is_float)
+  {
+    const auto filter = getBuffer<float>(_kernel);
+    if (!nnfw::cker::ChooseSparseBlock(filter, rows, cols, &block_rows, &block_cols))
+      return false;
+    _block_sparse_float = std::make_unique<nnfw::cker::BlockSparseMatrix<float>>();
+    _block_sparse_float->build(filter, rows, cols, block_rows, block_cols);
+    return true;
+  }
+
+  const auto filter = getBuffer<int8_t>(_kernel);
+  if (!nnfw::cker::ChooseSparseBlock(filter, rows, cols, &block_rows, &block_cols))
+    return false;
+  _block_sparse_int8 = std::make_unique<nnfw::cker::BlockSparseMatrix<int8_t>>();
+  _block_sparse_int8->build(filter, rows, cols, block_rows, block_cols);
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  GetQuantizedConvolutionMultipliersAndShifts(
+    _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+    _kernel->data_scales().size(), rows, kernel.per_channel_output_multiplier(),
+    kernel.per_channel_output_shift());
+  return true;
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
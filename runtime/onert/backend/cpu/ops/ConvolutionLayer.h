@@ -19,8 +19,10 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
+#include <ir/Data.h>
 #include <functional>
 #include <memory>
 
@@ -29,6 +31,7 @@ namespace nnfw
 namespace cker
 {
 class Conv;
+template <typename T> struct BlockSparseMatrix;
 }
 } // namespace nnfw
 
@@ -50,22 +53,37 @@ public:
 public:
   void convFloat32();
 
+  void convFloat16();
+
   void convQuant8();
 
   void convQuant8PerChannel();
 
+  void convQuant16();
+
+  void convBlockSparse();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, ir::PaddingType _paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t dilationWidthFactor,
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
   void prepare() override;
 
+private:
+  void convFloat32(nnfw::cker::Conv &kernel, const float *input_data, float *output_data);
+  bool prepareBlockSparse();
+  /**
+   * @brief Choose the fastest float kernel on the shapes by running each of them, or by the
+   *        choice cached in CPU_AUTOTUNE_CACHE
+   */
+  void autotuneFloat32();
+
 private:
   const IPortableTensor *_input;
   const IPortableTensor *_kernel;
@@ -86,6 +104,13 @@ private:
   ir::Activation _activation;
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
+  // Transposed kernel mapped from util::WeightStore, nullptr if not used
+  std::shared_ptr<const ir::Data> _packed_kernel;
+  // Pruned constant 1x1 filter in blocks, which runs as FullyConnected over the pixels if set
+  std::unique_ptr<nnfw::cker::BlockSparseMatrix<float>> _block_sparse_float;
+  std::unique_ptr<nnfw::cker::BlockSparseMatrix<int8_t>> _block_sparse_int8;
+
+  std::shared_ptr<ExternalContext> _external_context;
 
   bool _prepare;
 };
@@ -17,6 +17,8 @@
 #include "DepthwiseConvolutionLayer.h"
 
 #include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/DepthwiseConvFp16.h>
+#include <cker/operation/DepthwiseConvInt16.h>
 
 namespace onert
 {
@@ -49,6 +51,29 @@ void DepthwiseConvolutionLayer::convFloat32()
     getBuffer<float>(_output), _external_context->ruy_context());
 }
 
+void DepthwiseConvolutionLayer::convFloat16()
+{
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidth;
+  op_params.dilation_height_factor = _dilationHeight;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  const auto *bias = _bias ? getBuffer<nnfw::cker::float16>(_bias) : nullptr;
+  nnfw::cker::DepthwiseConvFp16(
+    op_params, getShape(_input), getBuffer<nnfw::cker::float16>(_input), getShape(_kernel),
+    getBuffer<nnfw::cker::float16>(_kernel), getShape(_bias), bias, getShape(_output),
+    getBuffer<nnfw::cker::float16>(_output), _external_context->ruy_context());
+}
+
 void DepthwiseConvolutionLayer::convQuant8()
 {
   int32_t output_activation_min = 0;
@@ -119,6 +144,41 @@ void DepthwiseConvolutionLayer::convQuant8PerChannel()
     _external_context->ruy_context());
 }
 
+void DepthwiseConvolutionLayer::convQuant16()
+{
+  if (!_prepared)
+  {
+    prepareQuant8PerChannel();
+    _prepared = true;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.padding_type = nnfw::cker::PaddingType::kSame;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidth;
+  op_params.dilation_height_factor = _dilationHeight;
+  op_params.input_offset = 0;
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::DepthwiseConvInt16(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel), getBuffer<int8_t>(_kernel),
+    getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+    getBuffer<int16_t>(_output), _external_context->ruy_context());
+}
+
 void DepthwiseConvolutionLayer::prepareQuant8PerChannel()
 {
   GetQuantizedConvolutionMultipliersAndShifts(
@@ -159,14 +219,29 @@ void DepthwiseConvolutionLayer::configure(
       _prepared = true;
     }
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    if (!IsQuant16x8(_input, _kernel))
+      throw std::runtime_error{"DepthwiseConv: Int16 input needs zero point 0 and int8 weights"};
+  }
 }
 
 void DepthwiseConvolutionLayer::run()
 {
+  // Each output element takes a multiply-accumulate per kernel element of its channel
+  const auto &kernel_shape = _kernel->getShape();
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+    kernel_shape.dim(2));
+
   if (_input->data_type() == OperandType::FLOAT32)
   {
     convFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    convFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     convQuant8();
@@ -175,6 +250,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8PerChannel();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    convQuant16();
+  }
   else
   {
     throw std::runtime_error{"DepthwiseConv: unsupported data type"};
@@ -40,10 +40,14 @@ public:
 public:
   void convFloat32();
 
+  void convFloat16();
+
   void convQuant8();
 
   void convQuant8PerChannel();
 
+  void convQuant16();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
@@ -16,11 +16,12 @@
 
 #include "DetectionPostProcessLayer.h"
 
-#include "ndarray/Array.h"
+#include "cker/neon/neon_check.h"
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 #include <utility>
-#include <cmath>
 
 namespace onert
 {
@@ -34,104 +35,107 @@ namespace ops
 namespace
 {
 
-using namespace ndarray;
-
 using CenterSizeBox = DetectionPostProcessLayer::CenterSizeBox;
 using CornerBox = DetectionPostProcessLayer::CornerBox;
 
 using NonMaxSuppressionParam = DetectionPostProcessLayer::DetectionPostProcessParameters;
 using Allocations = DetectionPostProcessLayer::Allocations;
 
-struct OutputArrays
+struct Detection
 {
-  OutputArrays(CornerBox *coords_buf, float *scores_buf, float *classes_buf,
-               int *num_selections_buf, size_t max_detections)
-    : coords(coords_buf, {max_detections}), scores(scores_buf, {max_detections}),
-      classes(classes_buf, {max_detections}), num_selections(num_selections_buf, {1})
-  {
-  }
-
-  Array<CornerBox> coords;
-  Array<float> scores;
-  Array<float> classes;
-  Array<int> num_selections;
+  float score;
+  int box;
+  int class_index;
 };
 
-struct TemporaryArrays
+// Scores of boxes in rows, with the background class first if there is one
+struct ScoreMatrix
 {
-  TemporaryArrays(int *selections_buffer, int max_detections)
-    : selections(selections_buffer, {static_cast<unsigned long>(max_detections)})
-  {
-  }
+  const float *data;
+  int num_classes;
+  int stride;
+  int label_offset;
 
-  Array<int> selections;
+  const float *row(int box) const { return data + box * stride + label_offset; }
 };
 
-// sort indices in decreasing order of first `k` scores
-void PartialArgSort(const ContiguousSpan<float, true> &scores,
-                    const ContiguousSpan<int, false> &indices, int k)
-{
-  std::iota(indices.begin(), indices.begin() + k, 0);
-  std::partial_sort(indices.begin(), indices.begin() + k, indices.begin() + scores.size(),
-                    [&scores](const int i, const int j) { return scores[i] > scores[j]; });
-}
-
-template <typename T> ContiguousSpan<T, false> static vecToSpan(std::vector<T> &v)
+void decodeCenterSizeBoxes(const CenterSizeBox *boxes, const CenterSizeBox *anchors,
+                           int num_boxes, const CenterSizeBox &scales, CornerBox *decoded)
 {
-  return ContiguousSpan<T, false>{v.begin(), v.end()};
+  const float inv_y = 1.f / scales.y;
+  const float inv_x = 1.f / scales.x;
+  const float inv_h = 1.f / scales.h;
+  const float inv_w = 1.f / scales.w;
+
+  int i = 0;
+#ifdef USE_NEON
+  // Deinterleave 4 boxes and anchors into lanes of y, x, h and w
+  const float32x4_t half = vdupq_n_f32(0.5f);
+  for (; i + 4 <= num_boxes; i += 4)
+  {
+    const float32x4x4_t box = vld4q_f32(reinterpret_cast<const float *>(boxes + i));
+    const float32x4x4_t anchor = vld4q_f32(reinterpret_cast<const float *>(anchors + i));
+    const float32x4_t yc =
+      vmlaq_f32(anchor.val[0], vmulq_n_f32(box.val[0], inv_y), anchor.val[2]);
+    const float32x4_t xc =
+      vmlaq_f32(anchor.val[1], vmulq_n_f32(box.val[1], inv_x), anchor.val[3]);
+    float h[4], w[4];
+    vst1q_f32(h, vmulq_n_f32(box.val[2], inv_h));
+    vst1q_f32(w, vmulq_n_f32(box.val[3], inv_w));
+    for (int j = 0; j < 4; ++j)
+    {
+      h[j] = std::exp(h[j]);
+      w[j] = std::exp(w[j]);
+    }
+    const float32x4_t half_h = vmulq_f32(vmulq_f32(vld1q_f32(h), anchor.val[2]), half);
+    const float32x4_t half_w = vmulq_f32(vmulq_f32(vld1q_f32(w), anchor.val[3]), half);
+    float32x4x4_t corner;
+    corner.val[0] = vsubq_f32(yc, half_h);
+    corner.val[1] = vsubq_f32(xc, half_w);
+    corner.val[2] = vaddq_f32(yc, half_h);
+    corner.val[3] = vaddq_f32(xc, half_w);
+    vst4q_f32(reinterpret_cast<float *>(decoded + i), corner);
+  }
+#endif
+  for (; i < num_boxes; ++i)
+  {
+    const auto &anchor = anchors[i];
+    const auto &box = boxes[i];
+    const float yc = box.y * inv_y * anchor.h + anchor.y;
+    const float xc = box.x * inv_x * anchor.w + anchor.x;
+    const float halfh = 0.5f * std::exp(box.h * inv_h) * anchor.h;
+    const float halfw = 0.5f * std::exp(box.w * inv_w) * anchor.w;
+    auto &out = decoded[i];
+    out.y1 = yc - halfh;
+    out.x1 = xc - halfw;
+    out.y2 = yc + halfh;
+    out.x2 = xc + halfw;
+  }
 }
 
-Array<const CornerBox> decodeBoxes(const Array<float> &raw_boxes, const Array<float> &raw_anchors,
-                                   bool center_box_format, const CenterSizeBox &scales)
+const CornerBox *decodeBoxes(const float *raw_boxes, const float *raw_anchors, int num_boxes,
+                             const NonMaxSuppressionParam &param, Allocations &allocations)
 {
-  auto nbatches = raw_boxes.shape().dim(0);
-  auto num_boxes = raw_boxes.shape().dim(1);
-
-  auto anchors = array_cast<const CenterSizeBox>(raw_anchors, {num_boxes});
-
-  if (!center_box_format)
+  const CornerBox *boxes = reinterpret_cast<const CornerBox *>(raw_boxes);
+  if (param.center_box_format)
   {
-    auto boxes_p = reinterpret_cast<const CornerBox *>(raw_boxes.flat().data());
-    return {boxes_p, {num_boxes}};
+    allocations.decoded_boxes.resize(num_boxes);
+    decodeCenterSizeBoxes(reinterpret_cast<const CenterSizeBox *>(raw_boxes),
+                          reinterpret_cast<const CenterSizeBox *>(raw_anchors), num_boxes,
+                          param.scales, allocations.decoded_boxes.data());
+    boxes = allocations.decoded_boxes.data();
   }
-  else
-  {
-    // TODO support box center-width encoding correctly
-    // i.e anchors
-    auto boxes_p = reinterpret_cast<const CenterSizeBox *>(raw_boxes.flat().data());
-    Array<const CenterSizeBox> in_boxes{boxes_p, {num_boxes}};
 
-    auto decoded_boxes_p = new CornerBox[nbatches * num_boxes];
-    Array<CornerBox> decoded_boxes_a{decoded_boxes_p, {num_boxes}};
-
-    for (size_t i = 0; i < num_boxes; ++i)
-    {
-      auto anchor = anchors.at(i);
-      auto &box = decoded_boxes_a.at(i);
-      float yc = in_boxes.at(i).y / scales.y * anchor.h + anchor.y;
-      float xc = in_boxes.at(i).x / scales.x * anchor.w + anchor.x;
-      float halfh = 0.5f * std::exp(in_boxes.at(i).h / scales.h) * anchor.h;
-      float halfw = 0.5f * std::exp(in_boxes.at(i).w / scales.w) * anchor.w;
-      box.x1 = xc - halfw;
-      box.x2 = xc + halfw;
-      box.y1 = yc - halfh;
-      box.y2 = yc + halfh;
-
-      assert(box.x2 > box.x1);
-      assert(box.y2 > box.y1);
-    }
-
-    auto decoded_boxes_a_shape = decoded_boxes_a.shape();
-
-    return array_cast<const CornerBox>(std::move(decoded_boxes_a), decoded_boxes_a_shape);
-  }
+  // Areas are computed once for all the IOUs of a box
+  allocations.areas.resize(num_boxes);
+  for (int i = 0; i < num_boxes; ++i)
+    allocations.areas[i] = (boxes[i].y2 - boxes[i].y1) * (boxes[i].x2 - boxes[i].x1);
+  return boxes;
 }
 
-float computeIOU(const CornerBox &box1, const CornerBox &box2)
+float computeIOU(const CornerBox &box1, float area1, const CornerBox &box2, float area2)
 {
-  float area_i = (box1.y2 - box1.y1) * (box1.x2 - box1.x1);
-  float area_j = (box2.y2 - box2.y1) * (box2.x2 - box2.x1);
-  if (area_i <= 0 || area_j <= 0)
+  if (area1 <= 0 || area2 <= 0)
   {
     return 0.0;
   }
@@ -141,141 +145,127 @@ float computeIOU(const CornerBox &box1, const CornerBox &box2)
   float in_xmax = std::min<float>(box1.x2, box2.x2);
   float in_area = std::max<float>(in_ymax - in_ymin, 0.0) * std::max<float>(in_xmax - in_xmin, 0.0);
 
-  return in_area / (area_i + area_j - in_area);
+  return in_area / (area1 + area2 - in_area);
 }
 
-int doSingleClass(const Array<const CornerBox> &boxes, const std::vector<float> &scores,
-                  const NonMaxSuppressionParam &param, TemporaryArrays &temps,
-                  size_t max_detections)
+// Select candidates in decreasing order of the scores, suppressing the ones whose IOU with a
+// selected box is over the threshold. Candidates are sorted here.
+template <typename ScoreFn>
+int selectBoxes(const CornerBox *boxes, const std::vector<float> &areas, const ScoreFn &score_of,
+                float iou_threshold, int max_selections, Allocations &allocations)
 {
-  auto num_boxes = boxes.shape().dim(0);
-
-  std::vector<int> sorted_box_indices(num_boxes);
-  PartialArgSort(ContiguousSpan<float, true>(scores.data(), num_boxes),
-                 vecToSpan(sorted_box_indices), num_boxes);
-
-  // TODO move to temp allocations
-  std::vector<int> process_box(num_boxes, 1);
-
-  size_t selected_count = 0;
-  for (size_t i = 0; i < num_boxes; ++i)
+  auto &candidates = allocations.candidates;
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [&](int i, int j) { return score_of(i) > score_of(j); });
+
+  auto &suppressed = allocations.suppressed;
+  suppressed.assign(candidates.size(), 0);
+  int selected_count = 0;
+  for (size_t i = 0; i < candidates.size() && selected_count < max_selections; ++i)
   {
-    auto box_index = sorted_box_indices[i];
-
-    if (!process_box[box_index] || scores[box_index] < param.score_threshold)
-    {
+    if (suppressed[i])
       continue;
-    }
-
-    temps.selections.at(selected_count) = box_index;
-    selected_count++;
-
-    if (selected_count >= max_detections)
-    {
-      break;
-    }
 
-    for (size_t j = i + 1; j < num_boxes; ++j)
+    const int box = candidates[i];
+    allocations.selections[selected_count++] = box;
+    for (size_t j = i + 1; j < candidates.size(); ++j)
     {
-      if (!process_box[sorted_box_indices[j]])
-      {
-        continue;
-      }
-
-      float IOU = computeIOU(boxes.at(box_index), boxes.at(sorted_box_indices[j]));
-      if (IOU > param.iou_threshold)
-      {
-        process_box[sorted_box_indices[j]] = 0;
-      }
+      const int other = candidates[j];
+      if (!suppressed[j] &&
+          computeIOU(boxes[box], areas[box], boxes[other], areas[other]) > iou_threshold)
+        suppressed[j] = 1;
     }
   }
-
   return selected_count;
 }
 
-void collectBoxes(TemporaryArrays &temporary, const Array<const CornerBox> &decoded_boxes,
-                  std::vector<float> &scores, int num_selected, OutputArrays &output,
-                  const Array<int> &sorted_classes, int detections_per_box)
+// Suppress the boxes by the score of their best class, and detect each of them with its best
+// classes up to max_classes_per_detection
+void fastNMS(const CornerBox *boxes, const ScoreMatrix &scores, int num_boxes,
+             const NonMaxSuppressionParam &param, Allocations &allocations,
+             std::vector<Detection> &detections)
 {
-  auto &selections = temporary.selections;
+  const int classes_per_box = std::min(scores.num_classes, param.max_classes_per_detection);
+  auto &max_scores = allocations.max_scores;
+  auto &candidates = allocations.candidates;
+  max_scores.resize(num_boxes);
+  candidates.clear();
+  for (int box = 0; box < num_boxes; ++box)
+  {
+    const float *row = scores.row(box);
+    max_scores[box] = *std::max_element(row, row + scores.num_classes);
+    if (max_scores[box] >= param.score_threshold)
+      candidates.push_back(box);
+  }
 
-  size_t output_box_count = 0;
+  const int selected_count = selectBoxes(
+    boxes, allocations.areas, [&](int box) { return max_scores[box]; }, param.iou_threshold,
+    param.max_detections, allocations);
 
-  for (int i = 0; i < num_selected; ++i)
+  // Classes are sorted only for the selected boxes
+  auto &order = allocations.class_order;
+  order.resize(scores.num_classes);
+  for (int i = 0; i < selected_count; ++i)
   {
-    int selected_box = selections.at(output_box_count);
-
-    for (int c = 0; c < detections_per_box; ++c)
-    {
-      output.classes.at(output_box_count) = sorted_classes.at(selected_box, c);
-      output.scores.at(output_box_count) = scores[selected_box];
-      output.coords.at(output_box_count) = decoded_boxes.at(selected_box);
-      output_box_count++;
-    }
+    const int box = allocations.selections[i];
+    const float *row = scores.row(box);
+    std::iota(order.begin(), order.end(), 0);
+    std::partial_sort(order.begin(), order.begin() + classes_per_box, order.end(),
+                      [&](int a, int b) { return row[a] > row[b]; });
+    for (int c = 0; c < classes_per_box; ++c)
+      detections.push_back(Detection{row[order[c]], box, order[c]});
   }
 }
 
-void DetectionPostProcess(const Array<float> &boxes_a, const Array<float> &scores_a,
-                          Array<float> &num_selected_a, const NonMaxSuppressionParam &param,
-                          const Allocations &allocations, OutputArrays &outputs)
+// Suppress the boxes of each class separately, and detect the best ones over all the classes
+void regularNMS(const CornerBox *boxes, const ScoreMatrix &scores, int num_boxes,
+                const NonMaxSuppressionParam &param, Allocations &allocations,
+                std::vector<Detection> &detections)
 {
-  TemporaryArrays temporary(allocations.selections_buffer, param.max_detections);
-
-  // Only batch of 1 is supported atm
-  auto num_boxes = boxes_a.shape().dim(1);
-  size_t num_classes = param.num_classes;
-  size_t num_classes_with_background = scores_a.shape().dim(2);
-  bool have_background = num_classes_with_background != num_classes;
-
-  size_t max_classes_per_box = std::min<size_t>(num_classes, param.max_classes_per_detection);
-
-  // TODO move this to allocations
-  std::vector<int> sorted_class_indices(num_boxes * num_classes);
-
-  Array<int> class_indices(sorted_class_indices.data(), {num_boxes, num_classes});
-
-  // TODO move to allocations
-  std::vector<float> max_scores(num_boxes);
-
-  for (size_t row = 0; row < num_boxes; row++)
+  // Scores are scanned once in rows for the candidates of all the classes
+  auto &class_candidates = allocations.class_candidates;
+  class_candidates.resize(scores.num_classes);
+  for (auto &candidates : class_candidates)
+    candidates.clear();
+  for (int box = 0; box < num_boxes; ++box)
   {
-    auto box_scores = scores_a.slice(0, row).offset(have_background ? 1 : 0);
-    auto indices = class_indices.slice(row);
-
-    PartialArgSort(box_scores, indices, num_classes);
-
-    max_scores[row] = box_scores[indices[0]];
+    const float *row = scores.row(box);
+    for (int c = 0; c < scores.num_classes; ++c)
+    {
+      if (row[c] >= param.score_threshold)
+        class_candidates[c].push_back(box);
+    }
   }
 
-  auto anchors_a =
-    Array<float>(reinterpret_cast<float *>(param.anchors_input->buffer()), {num_boxes, 4});
-  auto decoded_boxes = decodeBoxes(boxes_a, anchors_a, param.center_box_format, param.scales);
-
-  int num_selected =
-    doSingleClass(decoded_boxes, max_scores, param, temporary, param.max_detections);
-
-  collectBoxes(temporary, decoded_boxes, max_scores, num_selected, outputs, class_indices,
-               max_classes_per_box);
-
-  num_selected_a.at(0) = num_selected;
-}
-} // namespace
-
-template <typename T> Array<T> toArray(uint8_t *ptr, std::vector<int32_t> &descr)
-{
-  ndarray::Shape shape(descr.size());
-  for (size_t i = 0; i < descr.size(); ++i)
+  for (int c = 0; c < scores.num_classes; ++c)
   {
-    shape.dim(i) = descr[i];
+    if (class_candidates[c].empty())
+      continue;
+    std::swap(allocations.candidates, class_candidates[c]);
+    const int selected_count = selectBoxes(
+      boxes, allocations.areas, [&](int box) { return scores.row(box)[c]; }, param.iou_threshold,
+      param.max_boxes_per_class, allocations);
+    std::swap(allocations.candidates, class_candidates[c]);
+    for (int i = 0; i < selected_count; ++i)
+    {
+      const int box = allocations.selections[i];
+      detections.push_back(Detection{scores.row(box)[c], box, c});
+    }
   }
 
-  return Array<T>{reinterpret_cast<T *>(ptr), shape};
+  const auto count = std::min<size_t>(detections.size(), param.max_detections);
+  std::stable_sort(detections.begin(), detections.end(),
+                   [](const Detection &a, const Detection &b) { return a.score > b.score; });
+  detections.resize(count);
 }
 
+} // namespace
+
 void DetectionPostProcessLayer::configure(DetectionPostProcessParameters parameters)
 {
   _parameters = std::move(parameters);
-  _allocations.selections_buffer = new int[_parameters.max_detections * 2];
+  _allocations.selections.resize(
+    std::max(_parameters.max_detections, _parameters.max_boxes_per_class));
 }
 
 void DetectionPostProcessLayer::run()
@@ -284,23 +274,45 @@ void DetectionPostProcessLayer::run()
   // no suport for batch other than 1( it's fine since tflite does not support
   // batch for postprocess either )
   assert(nbatches == 1);
-
-  auto boxes_a = toArray<float>(_parameters.boxes_input->buffer(), _parameters.boxes_descr);
-  auto scores_a = toArray<float>(_parameters.scores_input->buffer(), _parameters.scrores_descr);
-
-  auto num_selected_a = ndarray::Array<float>(
-    reinterpret_cast<float *>(_parameters.num_selections_output->buffer()), {nbatches});
-
-  OutputArrays outputArrays(reinterpret_cast<CornerBox *>(_parameters.box_coords_output->buffer()),
-                            reinterpret_cast<float *>(_parameters.box_scores_output->buffer()),
-                            reinterpret_cast<float *>(_parameters.box_classes_output->buffer()),
-                            reinterpret_cast<int *>(_parameters.num_selections_output->buffer()),
-                            _parameters.max_detections);
-
-  DetectionPostProcess(boxes_a, scores_a, num_selected_a, _parameters, _allocations, outputArrays);
+  UNUSED_RELEASE(nbatches);
+
+  const int num_boxes = _parameters.boxes_descr[1];
+  const int num_classes_with_background = _parameters.scrores_descr[2];
+  const bool have_background = num_classes_with_background != _parameters.num_classes;
+  const ScoreMatrix scores{reinterpret_cast<const float *>(_parameters.scores_input->buffer()),
+                           _parameters.num_classes, num_classes_with_background,
+                           have_background ? 1 : 0};
+
+  const auto boxes =
+    decodeBoxes(reinterpret_cast<const float *>(_parameters.boxes_input->buffer()),
+                reinterpret_cast<const float *>(_parameters.anchors_input->buffer()), num_boxes,
+                _parameters, _allocations);
+
+  std::vector<Detection> detections;
+  if (_parameters.use_regular_nms)
+    regularNMS(boxes, scores, num_boxes, _parameters, _allocations, detections);
+  else
+    fastNMS(boxes, scores, num_boxes, _parameters, _allocations, detections);
+
+  // Entries after the detections are zero
+  auto coords_out = reinterpret_cast<CornerBox *>(_parameters.box_coords_output->buffer());
+  auto classes_out = reinterpret_cast<float *>(_parameters.box_classes_output->buffer());
+  auto scores_out = reinterpret_cast<float *>(_parameters.box_scores_output->buffer());
+  const auto max_entries = _parameters.box_scores_output->getShape().num_elements();
+  assert(detections.size() <= static_cast<size_t>(max_entries));
+  std::fill(coords_out, coords_out + max_entries, CornerBox{0.f, 0.f, 0.f, 0.f});
+  std::fill(classes_out, classes_out + max_entries, 0.f);
+  std::fill(scores_out, scores_out + max_entries, 0.f);
+  for (size_t i = 0; i < detections.size(); ++i)
+  {
+    coords_out[i] = boxes[detections[i].box];
+    classes_out[i] = detections[i].class_index;
+    scores_out[i] = detections[i].score;
+  }
+  *reinterpret_cast<float *>(_parameters.num_selections_output->buffer()) = detections.size();
 }
 
-DetectionPostProcessLayer::~DetectionPostProcessLayer() { delete[] _allocations.selections_buffer; }
+DetectionPostProcessLayer::~DetectionPostProcessLayer() = default;
 
 } // namespace ops
 } // namespace cpu
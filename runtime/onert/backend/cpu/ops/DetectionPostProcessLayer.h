@@ -21,6 +21,8 @@
 
 #include "OperationUtils.h"
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -62,6 +64,8 @@ public:
     float iou_threshold; // intersection-over-union
     uint32_t max_boxes_per_class;
     bool center_box_format = false;
+    // Suppress boxes of each class separately instead of the boxes by their best class only
+    bool use_regular_nms = false;
     int32_t num_classes;
     int32_t max_classes_per_detection;
     CenterSizeBox scales;
@@ -75,8 +79,17 @@ public:
 
   struct Allocations
   {
-    int *selections_buffer = nullptr;
-    // TODO move all dynamic allocations here, and into configure phase
+    std::vector<int> selections;
+    std::vector<CornerBox> decoded_boxes;
+    std::vector<float> areas;
+    std::vector<int> candidates;
+    std::vector<uint8_t> suppressed;
+    // Best classes of each box, and its score of the best one, for the fast NMS
+    std::vector<int> box_classes;
+    std::vector<float> max_scores;
+    std::vector<int> class_order;
+    // Boxes over the score threshold of each class, for the regular NMS
+    std::vector<std::vector<int>> class_candidates;
   };
 
   DetectionPostProcessLayer() : _parameters{}
@@ -40,8 +40,6 @@ void EinsumLayer::einsumFloat32()
   uint32_t num_inputs = _inputs.size();
   nnfw::cker::Einsum &kernel = *_einsum_kernel;
 
-  kernel.prepare(_equation);
-
   std::vector<nnfw::cker::Shape> inputShapes;
   std::vector<const float *> inputFloatPtrs;
 
@@ -51,11 +49,19 @@ void EinsumLayer::einsumFloat32()
     inputFloatPtrs.emplace_back(getBuffer<float>(_inputs[i]));
   }
 
-  kernel(_equation, inputShapes, inputFloatPtrs, getShape(_output), getBuffer<float>(_output));
+  kernel(_equation, inputShapes, inputFloatPtrs, getShape(_output), getBuffer<float>(_output),
+         _external_context->ruy_context());
+}
+
+void EinsumLayer::prepare()
+{
+  // Parse the equation and plan the contraction once, instead of on the first run
+  _einsum_kernel->prepare(_equation);
 }
 
 void EinsumLayer::run()
 {
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
   if (_output->data_type() == OperandType::FLOAT32)
   {
     einsumFloat32();
@@ -67,7 +73,8 @@ void EinsumLayer::run()
 }
 
 void EinsumLayer::configure(const std::vector<const IPortableTensor *> &inputs,
-                            std::string equation, IPortableTensor *output)
+                            std::string equation, IPortableTensor *output,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(inputs.size() > 0);
   assert(output != nullptr);
@@ -75,6 +82,7 @@ void EinsumLayer::configure(const std::vector<const IPortableTensor *> &inputs,
   _inputs = inputs;
   _equation = equation;
   _output = output;
+  _external_context = external_context;
 }
 
 } // namespace ops
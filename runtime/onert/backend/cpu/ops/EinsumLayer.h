@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 #include <functional>
@@ -51,7 +52,9 @@ public:
   void einsumFloat32();
 
   void configure(const std::vector<const IPortableTensor *> &inputs, std::string equation,
-                 IPortableTensor *output);
+                 IPortableTensor *output, const std::shared_ptr<ExternalContext> &external_context);
+
+  void prepare() override;
 
   void run() override;
 
@@ -62,6 +65,8 @@ private:
   std::string _equation;
 
   std::unique_ptr<nnfw::cker::Einsum> _einsum_kernel;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
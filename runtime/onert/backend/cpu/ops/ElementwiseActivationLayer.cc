@@ -19,8 +19,11 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/ELU.h>
+#include <cker/operation/Gelu.h>
+#include <cker/operation/HardSwish.h>
 #include <cker/operation/LeakyReLU.h>
 #include <cker/operation/Logistic.h>
+#include <cker/operation/LogisticInt16.h>
 #include <cker/operation/ReLU.h>
 #include <cker/operation/ReLU6.h>
 #include <cker/operation/Tanh.h>
@@ -35,7 +38,7 @@ namespace ops
 {
 
 ElementwiseActivationLayer::ElementwiseActivationLayer()
-  : _input(nullptr), _output(nullptr), _kernel()
+  : _input(nullptr), _output(nullptr), _kernel(), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -86,10 +89,12 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
 
 void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                            float alpha, float beta,
-                                           ElementwiseActivationType op_type)
+                                           ElementwiseActivationType op_type,
+                                           const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   switch (op_type)
   {
@@ -113,11 +118,22 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
                             std::placeholders::_1, std::placeholders::_2);
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        nnfw::cker::PopulateLogisticInt16LookupTable(_table16, _input->data_scale(),
+                                                     _input->data_zero_point(),
+                                                     _output->data_scale(),
+                                                     _output->data_zero_point());
+        _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
+          nnfw::cker::LogisticInt16(_table16.data(), getShape(input), getBuffer<int16_t>(input),
+                                    getShape(output), getBuffer<int16_t>(output));
+        };
+      }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::Logistic(getShape(input), getBuffer<float>(input), getShape(output),
-                               getBuffer<float>(output));
+                               getBuffer<float>(output), _external_context->ruy_context());
         };
       }
       else
@@ -130,15 +146,16 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       {
         if (alpha == std::numeric_limits<float>::infinity() && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+          _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
             nnfw::cker::ReLU(getShape(input), getBuffer<float>(input), getShape(output),
-                             getBuffer<float>(output));
+                             getBuffer<float>(output), _external_context->ruy_context());
           };
         }
         else if (alpha == 6.f && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-            nnfw::cker::ReLU6(getShape(input), getBuffer<float>(input), getBuffer<float>(output));
+          _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
+            nnfw::cker::ReLU6(getShape(input), getBuffer<float>(input), getBuffer<float>(output),
+                              _external_context->ruy_context());
           };
         }
         else
@@ -161,9 +178,9 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::Tanh(getShape(input), getBuffer<float>(input), getShape(output),
-                           getBuffer<float>(output));
+                           getBuffer<float>(output), _external_context->ruy_context());
         };
       }
       else
@@ -185,12 +202,43 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         throw std::runtime_error{"ElementwiseActivationLayer(LeakyReLU): unsupported data type"};
       }
       break;
+    case ElementwiseActivationType::kHardSwish:
+      if (_input->data_type() == OperandType::FLOAT32)
+      {
+        _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
+          nnfw::cker::HardSwish(getShape(input), getBuffer<float>(input), getShape(output),
+                                getBuffer<float>(output), _external_context->ruy_context());
+        };
+      }
+      else
+      {
+        throw std::runtime_error{"ElementwiseActivationLayer(HardSwish): unsupported data type"};
+      }
+      break;
+    case ElementwiseActivationType::kGelu:
+      if (_input->data_type() == OperandType::FLOAT32)
+      {
+        const bool approximate = alpha != 0.f;
+        _kernel = [this, approximate](const IPortableTensor *input, IPortableTensor *output) {
+          nnfw::cker::Gelu(approximate, getShape(input), getBuffer<float>(input), getShape(output),
+                           getBuffer<float>(output), _external_context->ruy_context());
+        };
+      }
+      else
+      {
+        throw std::runtime_error{"ElementwiseActivationLayer(Gelu): unsupported data type"};
+      }
+      break;
     default:
       throw std::runtime_error("ElementwiseActivationLayer: unsupported op type");
   }
 }
 
-void ElementwiseActivationLayer::run() { _kernel(_input, _output); }
+void ElementwiseActivationLayer::run()
+{
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+  _kernel(_input, _output);
+}
 
 } // namespace ops
 } // namespace cpu
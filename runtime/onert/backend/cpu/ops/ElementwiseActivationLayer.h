@@ -18,9 +18,12 @@
 #define __ONERT_BACKEND_CPU_OPS_ElementwiseActivationLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -36,7 +39,9 @@ enum class ElementwiseActivationType
   kLogistic,
   kReLU,
   kTanh,
-  kLeakyReLU
+  kLeakyReLU,
+  kHardSwish,
+  kGelu
 };
 
 class ElementwiseActivationLayer : public ::onert::exec::IFunction
@@ -46,7 +51,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output, float alpha, float beta,
-                 const ElementwiseActivationType op_type);
+                 const ElementwiseActivationType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -58,7 +64,11 @@ private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
   uint8_t _table[256];
+  // Table of every int16 value, which int16 input looks up instead
+  std::vector<int16_t> _table16;
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
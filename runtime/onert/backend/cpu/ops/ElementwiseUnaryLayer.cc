@@ -36,10 +36,10 @@ namespace ops
 
 namespace
 {
-void absFloat32(const IPortableTensor *input, IPortableTensor *output)
+void absFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Abs(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
 template <typename FromT>
@@ -75,7 +75,7 @@ void castPtr(const FromT *in, DataPtr out, int num_elements, ir::DataType data_t
   }
 }
 
-void cast(const IPortableTensor *input, IPortableTensor *output)
+void cast(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   auto input_buf = input->buffer();
   auto output_buf = output->buffer();
@@ -112,90 +112,89 @@ void cast(const IPortableTensor *input, IPortableTensor *output)
   }
 }
 
-void cosFloat32(const IPortableTensor *input, IPortableTensor *output)
+void cosFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Cos(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
-void dequantizeInt8(const IPortableTensor *input, IPortableTensor *output)
+template <typename T>
+void dequantize(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Dequantize(getShape(input), getBuffer<int8_t>(input), getShape(output),
-                         getBuffer<float>(output), input->data_scale(), input->data_zero_point());
+  nnfw::cker::Dequantize(getShape(input), getBuffer<T>(input), getShape(output),
+                         getBuffer<float>(output), input->data_scale(), input->data_zero_point(),
+                         ruy_context);
 }
 
-void dequantizeUint8(const IPortableTensor *input, IPortableTensor *output)
-{
-  nnfw::cker::Dequantize(getShape(input), getBuffer<uint8_t>(input), getShape(output),
-                         getBuffer<float>(output), input->data_scale(), input->data_zero_point());
-}
-
-void expFloat32(const IPortableTensor *input, IPortableTensor *output)
+void expFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   nnfw::cker::Exp(getShape(input), getBuffer<float>(input), getShape(output),
                   getBuffer<float>(output));
 }
 
-void erfFloat32(const IPortableTensor *input, IPortableTensor *output)
+void erfFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   nnfw::cker::Erf(getShape(input), getBuffer<float>(input), getShape(output),
                   getBuffer<float>(output));
 }
 
-void floorFloat32(const IPortableTensor *input, IPortableTensor *output)
+void floorFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Floor(getShape(input), getBuffer<float>(input), getShape(output),
-                    getBuffer<float>(output));
+                    getBuffer<float>(output), ruy_context);
 }
 
-void logFloat32(const IPortableTensor *input, IPortableTensor *output)
+void logFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Log(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
-void logicalNot(const IPortableTensor *input, IPortableTensor *output)
+void logicalNot(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   nnfw::cker::LogicalNot(getShape(input), getBuffer<bool>(input), getShape(output),
                          getBuffer<bool>(output));
 }
 
-template <typename T> void neg(const IPortableTensor *input, IPortableTensor *output)
+template <typename T>
+void neg(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
-  nnfw::cker::Neg<T>(getShape(input), getBuffer<T>(input), getShape(output), getBuffer<T>(output));
+  nnfw::cker::Neg<T>(getShape(input), getBuffer<T>(input), getShape(output), getBuffer<T>(output),
+                     ruy_context);
 }
 
-void roundFloat32(const IPortableTensor *input, IPortableTensor *output)
+void roundFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   nnfw::cker::Round(getShape(input), getBuffer<float>(input), getShape(output),
                     getBuffer<float>(output));
 }
 
-void rsqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
+void rsqrtFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Rsqrt(getShape(input), getBuffer<float>(input), getShape(output),
-                    getBuffer<float>(output));
+                    getBuffer<float>(output), ruy_context);
 }
 
-void sinFloat32(const IPortableTensor *input, IPortableTensor *output)
+void sinFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Sin(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
-void sqrtFloat32(const IPortableTensor *input, IPortableTensor *output)
+void sqrtFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Sqrt(getShape(input), getBuffer<float>(input), getShape(output),
-                   getBuffer<float>(output));
+                   getBuffer<float>(output), ruy_context);
 }
 
-void squareFloat32(const IPortableTensor *input, IPortableTensor *output)
+void squareFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Square(getShape(input), getBuffer<float>(input), getShape(output),
-                     getBuffer<float>(output));
+                     getBuffer<float>(output), ruy_context);
 }
 
-template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPortableTensor *output)
+template <typename T>
+void zerosLikeFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *)
 {
   if (!HaveSameShapes(input, output))
     throw std::runtime_error{"ZerosLike: input and output shape don't match."};
@@ -207,13 +206,15 @@ template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPorta
 } // namespace
 
 void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTensor *output,
-                                      const ElementwiseUnaryType op_type)
+                                      const ElementwiseUnaryType op_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(input != nullptr);
   assert(output != nullptr);
 
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   switch (op_type)
   {
@@ -243,12 +244,16 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kDequantize:
       if ((input->data_type() == OperandType::QUANT_UINT8_ASYMM))
       {
-        _kernel = dequantizeUint8;
+        _kernel = dequantize<uint8_t>;
       }
       else if ((input->data_type() == OperandType::QUANT_INT8_ASYMM) ||
                (input->data_type() == OperandType::QUANT_INT8_SYMM))
       {
-        _kernel = dequantizeInt8;
+        _kernel = dequantize<int8_t>;
+      }
+      else if (input->data_type() == OperandType::QUANT_INT16_SYMM)
+      {
+        _kernel = dequantize<int16_t>;
       }
       else
       {
@@ -392,7 +397,11 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
   }
 }
 
-void ElementwiseUnaryLayer::run() { _kernel(_input, _output); }
+void ElementwiseUnaryLayer::run()
+{
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+  _kernel(_input, _output, _external_context->ruy_context());
+}
 
 } // namespace ops
 } // namespace cpu
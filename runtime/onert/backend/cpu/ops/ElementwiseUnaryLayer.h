@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_ELEMENTWISEUNARYLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -54,21 +55,24 @@ enum class ElementwiseUnaryType
 class ElementwiseUnaryLayer : public ::onert::exec::IFunction
 {
 public:
-  ElementwiseUnaryLayer() : _input(nullptr), _output(nullptr), _kernel()
+  ElementwiseUnaryLayer()
+    : _input(nullptr), _output(nullptr), _kernel(), _external_context(nullptr)
   {
     // DO NOTHING
   }
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output,
-                 const ElementwiseUnaryType op_type);
+                 const ElementwiseUnaryType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
-  std::function<void(const IPortableTensor *, IPortableTensor *)> _kernel;
+  std::function<void(const IPortableTensor *, IPortableTensor *, ruy::Context *)> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
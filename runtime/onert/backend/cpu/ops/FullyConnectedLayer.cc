@@ -18,9 +18,15 @@
 
 #include "../Tensor.h"
 #include <cker/operation/FullyConnected.h>
+#include <cker/operation/FullyConnectedBlockSparse.h>
+#include <cker/operation/FullyConnectedFp16.h>
+#include <cker/operation/FullyConnectedInt16.h>
+#include <cker/operation/optimized/integer_ops/FullyConnectedInt8.h>
 #include <cker/TensorUtils.h>
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
+
 namespace onert
 {
 namespace backend
@@ -51,6 +57,26 @@ void FullyConnectedLayer::fullyConnectedFloat32()
                              getBuffer<float>(_output));
 }
 
+void FullyConnectedLayer::fullyConnectedFloat16()
+{
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * _weights->getShape().dim(1));
+
+  float output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnectedFp16(
+    op_params, getShape(_input), getBuffer<nnfw::cker::float16>(_input), getShape(_weights),
+    getBuffer<nnfw::cker::float16>(_weights), getShape(_bias),
+    _bias ? getBuffer<nnfw::cker::float16>(_bias) : nullptr, getShape(_output),
+    getBuffer<nnfw::cker::float16>(_output), _external_context->ruy_context());
+}
+
 // executionMutex is used to protect concurrent access of non-threadsafe resources
 // like gemmlowp::GemmContext.
 void FullyConnectedLayer::fullyConnectedQuant8()
@@ -80,8 +106,61 @@ void FullyConnectedLayer::fullyConnectedQuant8()
                              getBuffer<uint8_t>(_output));
 }
 
+void FullyConnectedLayer::fullyConnectedQuant8PerChannel()
+{
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * _weights->getShape().dim(1));
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.weights_offset = -_weights->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  // Constant weights can be packed once by ruy and reused over runs
+  op_params.lhs_cacheable = _weights->is_constant();
+
+  nnfw::cker::optimized_integer_ops::FullyConnectedPerChannel(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getShape(_input), getBuffer<int8_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+    getShape(_bias), _bias ? getBuffer<int32_t>(_bias) : nullptr, getShape(_output),
+    getBuffer<int8_t>(_output), _external_context->ruy_context());
+}
+
+void FullyConnectedLayer::fullyConnectedQuant16()
+{
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * _weights->getShape().dim(1));
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = 0;
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnectedInt16(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getShape(_input), getBuffer<int16_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+    getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+    getBuffer<int16_t>(_output), _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * _weights->getShape().dim(1));
+
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
   if (!temp_arena.prepared)
   {
@@ -91,6 +170,13 @@ void FullyConnectedLayer::fullyConnectedHybrid()
   nnfw::cker::FullyConnectedParams op_params;
   op_params.activation = convertActivationType(_activation);
   op_params.weights_scale = _weights->data_scale();
+  // Channel-wise quantized weights have a scale for each output unit
+  const auto &weights_scales = _weights->data_scales();
+  if (weights_scales.size() > 1)
+  {
+    assert(weights_scales.size() == static_cast<size_t>(_weights->getShape().dim(0)));
+    op_params.weights_scales = weights_scales.data();
+  }
 
 #ifndef USE_RUY_GEMV
   nnfw::cker::FullyConnectedHybrid(
@@ -164,10 +250,55 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
       getBuffer<float>(_weights), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
       getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices);
   }
+  else if (block_size.size() == 2 && getShape(_weights).Dims(0) % block_size[0] == 0 &&
+           getShape(_weights).Dims(1) % block_size[1] == 0)
+  {
+    const auto lease = _external_context->leaseThreads(
+      static_cast<uint64_t>(_output->getShape().num_elements()) * _weights->getShape().dim(1));
+
+    CalculateActivationRange(_activation, &op_params.float_activation_min,
+                             &op_params.float_activation_max);
+    nnfw::cker::FullyConnectedBlockSparse(
+      op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights), block_size[0],
+      block_size[1], w1_segments, w1_indices, getBuffer<float>(_weights),
+      _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output), getBuffer<float>(_output),
+      _external_context->ruy_context());
+  }
   else
     throw std::runtime_error{"FullyConnected: unsupported sparsity"};
 }
 
+void FullyConnectedLayer::fullyConnectedBlockSparse()
+{
+  // Threads are leased for the multiply-adds of the nonzero blocks only
+  const auto batches = _output->getShape().num_elements() / _weights->getShape().dim(0);
+  const auto values = _block_sparse_float ? _block_sparse_float->values.size()
+                                          : _block_sparse_int8->values.size();
+  const auto lease = _external_context->leaseThreads(static_cast<uint64_t>(batches) * values);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  if (_block_sparse_float)
+  {
+    CalculateActivationRange(_activation, &op_params.float_activation_min,
+                             &op_params.float_activation_max);
+    nnfw::cker::FullyConnectedBlockSparse(
+      op_params, getShape(_input), getBuffer<float>(_input), *_block_sparse_float,
+      _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output), getBuffer<float>(_output),
+      _external_context->ruy_context());
+    return;
+  }
+
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  CalculateActivationRangeQuantized(_activation, _output, &op_params.quantized_activation_min,
+                                    &op_params.quantized_activation_max);
+  nnfw::cker::FullyConnectedBlockSparse(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getShape(_input), getBuffer<int8_t>(_input), *_block_sparse_int8,
+    _bias ? getBuffer<int32_t>(_bias) : nullptr, getShape(_output), getBuffer<int8_t>(_output),
+    _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::fullyConnected16x1Float32()
 {
 #if defined(__aarch64__) && defined(USE_NEON)
@@ -220,14 +351,30 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedSparseWeight();
   }
+  else if (_block_sparse_float || _block_sparse_int8)
+  {
+    fullyConnectedBlockSparse();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     _is_shuffled16x1float32 ? fullyConnected16x1Float32() : fullyConnectedFloat32();
   }
+  else if (_input->data_type() == OperandType::FLOAT16)
+  {
+    fullyConnectedFloat16();
+  }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    fullyConnectedQuant8PerChannel();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    fullyConnectedQuant16();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -236,15 +383,30 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  // Zero check reads the bias as float words, which a half-precision bias may not fill
+  if (_bias && _bias->is_constant() && _bias->data_type() != OperandType::FLOAT16)
   {
-    const int bias_size = getShape(_bias).FlatSize();
+    const int bias_size = _bias->total_size() / sizeof(float);
     if (nnfw::cker::IsZeroVector(getBuffer<float>(_bias), bias_size))
     {
       _bias = nullptr;
     }
   }
 
+  // Scales are known even if the weights are not constant, and a per-tensor scale applies to all
+  if (_input->data_type() == OperandType::QUANT_INT16_ASYMM && !IsQuant16x8(_input, _weights))
+    throw std::runtime_error{"FullyConnected: Int16 input needs zero point 0 and int8 weights"};
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM ||
+      _input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _weights->data_scales().data(),
+      _weights->data_scales().size(), getShape(_weights).Dims(0), _per_channel_output_multiplier,
+      _per_channel_output_shift);
+  }
+
+  prepareBlockSparse();
+
 #if (defined(__ARM_NEON__) || defined(__ARM_NEON)) && defined(USE_RUY_GEMV)
   // TODO This is workaround
   // The only fc hybrid will use ruy kernel
@@ -273,6 +435,53 @@ void FullyConnectedLayer::prepare()
 #endif
 }
 
+void FullyConnectedLayer::prepareBlockSparse()
+{
+  if (!_weights->is_constant() || _weights->sparsity() || _is_hybrid || _is_shuffled16x1float32 ||
+      _weights->getShape().rank() != 2)
+    return;
+
+  // Int8 weights are sparse only if their zero is 0
+  const auto &zero_points = _weights->data_zero_points();
+  const bool is_float = _input->data_type() == OperandType::FLOAT32 &&
+                        _weights->data_type() == OperandType::FLOAT32;
+  const bool is_int8 =
+    _input->data_type() == OperandType::QUANT_INT8_ASYMM &&
+    (_weights->data_type() == OperandType::QUANT_INT8_SYMM ||
+     _weights->data_type() == OperandType::QUANT_INT8_ASYMM) &&
+    std::all_of(zero_points.begin(), zero_points.end(), [](int32_t zp) { return zp == 0; });
+  if (!is_float && !is_int8)
+    return;
+
+  // The block shape is chosen by the density of the weights, which are dense to the kernels if
+  // too many blocks have a nonzero value
+  const int rows = _weights->getShape().dim(0);
+  const int cols = _weights->getShape().dim(1);
+  int block_rows = 0, block_cols = 0;
+  if (is_float)
+  {
+    const auto weights = getBuffer<float>(_weights);
+    if (!nnfw::cker::ChooseSparseBlock(weights, rows, cols, &block_rows, &block_cols))
+      return;
+    _block_sparse_float = std::make_unique<nnfw::cker::BlockSparseMatrix<float>>();
+    _block_sparse_float->build(weights, rows, cols, block_rows, block_cols);
+  }
+  else
+  {
+    const auto weights = getBuffer<int8_t>(_weights);
+    if (!nnfw::cker::ChooseSparseBlock(weights, rows, cols, &block_rows, &block_cols))
+      return;
+    _block_sparse_int8 = std::make_unique<nnfw::cker::BlockSparseMatrix<int8_t>>();
+    _block_sparse_int8->build(weights, rows, cols, block_rows, block_cols);
+  }
+
+  // The dense weights are not read anymore
+  auto weights_tensor = dynamic_cast<const Tensor *>(_weights);
+  if (weights_tensor)
+    // TODO Remove const_cast
+    const_cast<Tensor *>(weights_tensor)->decrease_ref();
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -23,11 +23,14 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
 {
 class FCTempArena;
+template <typename T> struct BlockSparseMatrix;
 }
 } // namespace nnfw
 
@@ -49,12 +52,20 @@ public:
 public:
   void fullyConnectedFloat32();
 
+  void fullyConnectedFloat16();
+
   void fullyConnectedQuant8();
 
+  void fullyConnectedQuant8PerChannel();
+
+  void fullyConnectedQuant16();
+
   void fullyConnectedHybrid();
 
   void fullyConnectedSparseWeight();
 
+  void fullyConnectedBlockSparse();
+
   void fullyConnected16x1Float32();
 
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
@@ -66,6 +77,9 @@ public:
 
   void prepare() override;
 
+private:
+  void prepareBlockSparse();
+
 private:
   const IPortableTensor *_input;
   const IPortableTensor *_weights;
@@ -77,6 +91,14 @@ private:
 
   std::shared_ptr<ExternalContext> _external_context;
 
+  // Per channel output multiplier and shift of int8 weights, with int8 or int16 input
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
+  // Pruned constant weights in blocks, which replace the dense ones if they are set
+  std::unique_ptr<nnfw::cker::BlockSparseMatrix<float>> _block_sparse_float;
+  std::unique_ptr<nnfw::cker::BlockSparseMatrix<int8_t>> _block_sparse_int8;
+
   bool _is_hybrid : 1;
   bool _is_shuffled16x1float32 : 1;
 
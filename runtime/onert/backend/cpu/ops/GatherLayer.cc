@@ -20,6 +20,9 @@
 
 #include <cker/operation/Gather.h>
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 namespace onert
 {
 namespace backend
@@ -29,13 +32,46 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// Constant tables at least this large are advised for random access
+constexpr size_t kMinRandomAccessBytes = 1 << 20;
+
+// Tell the kernel that rows of the table are read at random, so that it does not read ahead
+// around the rows looked up. Pages of a mmap'd table are then only faulted in as they are used.
+void adviseRandomAccess(const IPortableTensor *table)
+{
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto begin = reinterpret_cast<uintptr_t>(table->buffer()) / page_size * page_size;
+  const auto end = reinterpret_cast<uintptr_t>(table->buffer()) + table->total_size();
+  // It is only advice, which fails harmlessly for memory that is not mapped from a file
+  madvise(reinterpret_cast<void *>(begin), end - begin, MADV_RANDOM);
+}
+
+} // namespace
+
 void GatherLayer::configure(const IPortableTensor *input, const IPortableTensor *indices,
-                            IPortableTensor *output, int32_t axis)
+                            IPortableTensor *output, int32_t axis,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _indices = indices;
   _axis = axis;
   _output = output;
+  _external_context = external_context;
+
+  const auto rank = static_cast<int32_t>(_input->getShape().rank());
+  _row_lookup = _input->is_constant() && (_axis == 0 || _axis == -rank);
+}
+
+void GatherLayer::prepare()
+{
+  // Constants are bound after configure()
+  if (_row_lookup && _input->buffer() != nullptr && _input->total_size() >= kMinRandomAccessBytes)
+  {
+    adviseRandomAccess(_input);
+  }
 }
 
 template <typename InputType> void GatherLayer::runByInputType()
@@ -44,6 +80,30 @@ template <typename InputType> void GatherLayer::runByInputType()
   nnfw::cker::GatherParams op_params;
   op_params.axis = _axis;
 
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+
+  if (_row_lookup)
+  {
+    const auto input_shape = getShape(_input);
+    const int rows = input_shape.Dims(0);
+    const int row_size = rows == 0 ? 0 : input_shape.FlatSize() / rows;
+    const int coords_count = getShape(_indices).FlatSize();
+    if (_indices->data_type() == OperandType::INT32)
+    {
+      nnfw::cker::GatherRows(getBuffer<InputType>(_input), rows, row_size,
+                             getBuffer<int32_t>(_indices), coords_count,
+                             getBuffer<OutputType>(_output), _external_context->ruy_context());
+      return;
+    }
+    if (_indices->data_type() == OperandType::INT64)
+    {
+      nnfw::cker::GatherRows(getBuffer<InputType>(_input), rows, row_size,
+                             getBuffer<int64_t>(_indices), coords_count,
+                             getBuffer<OutputType>(_output), _external_context->ruy_context());
+      return;
+    }
+  }
+
   switch (_indices->data_type())
   {
     case OperandType::INT32:
@@ -52,7 +112,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _external_context->ruy_context());
       break;
     }
     case OperandType::INT64:
@@ -61,7 +122,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _external_context->ruy_context());
       break;
     }
     default:
@@ -69,8 +131,64 @@ template <typename InputType> void GatherLayer::runByInputType()
   }
 }
 
+template <typename InputType> void GatherLayer::runDequantize()
+{
+  if (!_row_lookup)
+    throw std::runtime_error("Gather: only constant tables on axis 0 can be dequantized");
+
+  const auto input_shape = getShape(_input);
+  const int rows = input_shape.Dims(0);
+  const int row_size = rows == 0 ? 0 : input_shape.FlatSize() / rows;
+  const int coords_count = getShape(_indices).FlatSize();
+
+  // Quantization is per tensor, or per row along axis 0
+  const auto &scales = _input->data_scales();
+  const bool per_row = scales.size() > 1;
+  if (per_row && scales.size() != static_cast<size_t>(rows))
+    throw std::runtime_error("Gather: table must be quantized per tensor or per row");
+  std::vector<int32_t> zero_points = _input->data_zero_points();
+  zero_points.resize(scales.size(), 0);
+
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      nnfw::cker::GatherRowsDequantize(getBuffer<InputType>(_input), rows, row_size, scales.data(),
+                                       zero_points.data(), per_row, getBuffer<int32_t>(_indices),
+                                       coords_count, getBuffer<float>(_output),
+                                       _external_context->ruy_context());
+      break;
+    case OperandType::INT64:
+      nnfw::cker::GatherRowsDequantize(getBuffer<InputType>(_input), rows, row_size, scales.data(),
+                                       zero_points.data(), per_row, getBuffer<int64_t>(_indices),
+                                       coords_count, getBuffer<float>(_output),
+                                       _external_context->ruy_context());
+      break;
+    default:
+      throw std::runtime_error("Gather: unsupported indices data type");
+  }
+}
+
 void GatherLayer::run()
 {
+  // Quantized tables looked up into float, which are dequantized on the fly
+  if (_output->data_type() == OperandType::FLOAT32 && _input->data_type() != OperandType::FLOAT32)
+  {
+    switch (_input->data_type())
+    {
+      case OperandType::QUANT_UINT8_ASYMM:
+        runDequantize<uint8_t>();
+        return;
+      case OperandType::QUANT_INT8_ASYMM:
+      case OperandType::QUANT_INT8_SYMM:
+        runDequantize<int8_t>();
+        return;
+      default:
+        throw std::runtime_error("Gather: unsupported input data type to dequantize");
+    }
+  }
+
   switch (_input->data_type())
   {
     case OperandType::FLOAT32:
@@ -79,6 +197,9 @@ void GatherLayer::run()
     case OperandType::QUANT_UINT8_ASYMM:
       runByInputType<uint8_t>();
       break;
+    case OperandType::QUANT_INT8_ASYMM:
+      runByInputType<int8_t>();
+      break;
     case OperandType::INT32:
       runByInputType<int32_t>();
       break;
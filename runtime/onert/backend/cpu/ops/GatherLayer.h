@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_GATHERLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -33,19 +34,25 @@ namespace ops
 class GatherLayer : public ::onert::exec::IFunction
 {
 public:
-  GatherLayer() : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}
+  GatherLayer()
+    : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}, _row_lookup{false},
+      _external_context{nullptr}
   {
     // DO NOTHING
   }
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *indices,
-                 IPortableTensor *output, int32_t axis);
+                 IPortableTensor *output, int32_t axis,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void prepare() override;
 
   void run() override;
 
 private:
   template <typename OpType> void runByInputType();
+  template <typename InputType> void runDequantize();
 
 private:
   const IPortableTensor *_input;
@@ -53,6 +60,10 @@ private:
   IPortableTensor *_output;
 
   int32_t _axis;
+  // Whether rows of a constant input are looked up along axis 0, like an embedding table
+  bool _row_lookup;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
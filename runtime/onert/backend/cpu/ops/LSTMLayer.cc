@@ -19,7 +19,7 @@
 
 #include "OperationUtils.h"
 
-#include <cker/operation/LSTM.h>
+#include <cker/operation/optimized/LSTM.h>
 
 namespace onert
 {
@@ -48,18 +48,84 @@ T *getOptionalOutputBuffer(onert::backend::IPortableTensor *tensor, std::vector<
   }
 }
 
-inline void initializeStateBuffer(const onert::backend::IPortableTensor *tensor_in, void *buffer,
-                                  bool needs_memcpy)
+// Buffer of an optional float tensor, or its values dequantized into a vector if it is int8
+const float *floatWeights(const IPortableTensor *tensor, std::vector<float> *dequantized)
 {
-  assert(tensor_in != nullptr);
+  // If tensor is not given or the tensor size is 0, consider it was not given
+  if (tensor == nullptr || tensor->total_size() == 0)
+    return nullptr;
+  if (tensor->data_type() != OperandType::QUANT_INT8_SYMM)
+    return getBuffer<float>(tensor);
+
+  assert(dequantized != nullptr);
+  const auto size = tensor->getShape().num_elements();
+  const int8_t *data = getBuffer<int8_t>(tensor);
+  const float scale = tensor->data_scale();
+  dequantized->resize(size);
+  for (size_t i = 0; i < size; ++i)
+    (*dequantized)[i] = data[i] * scale;
+  return dequantized->data();
+}
+
+// Buffer of a state to be updated, which is the variable state itself so that it is kept for the
+// next run, or else the optional output filled with the state given
+float *stateBuffer(const IPortableTensor *state_in, IPortableTensor *state_out,
+                   std::vector<uint8_t> *temp_vec, bool variable)
+{
+  assert(state_in != nullptr);
+  if (variable)
+    return reinterpret_cast<float *>(state_in->buffer());
+
+  float *buffer = getOptionalOutputBuffer<float>(state_out, temp_vec, state_in->total_size());
   assert(buffer != nullptr);
-  if (needs_memcpy)
-    memcpy(buffer, tensor_in->buffer(), tensor_in->total_size());
-  else
-    memset(buffer, 0, tensor_in->total_size());
+  memcpy(buffer, state_in->buffer(), state_in->total_size());
+  return buffer;
 }
 } // namespace
 
+LSTMLayer::LSTMLayer() = default;
+
+LSTMLayer::~LSTMLayer() = default;
+
+void LSTMLayer::prepareWeights()
+{
+  static_assert(kGates == nnfw::cker::optimized::kLstmGates, "Gates of LSTM differ");
+
+  // Int8 weights are dequantized for packing, which quantizes them again as one matrix
+  std::vector<float> dequantized[2 * kGates];
+  const IPortableTensor *input_to_gate_weights[kGates] = {
+    _input_to_input_weights, _input_to_forget_weights, _input_to_cell_weights,
+    _input_to_output_weights};
+  const IPortableTensor *recurrent_to_gate_weights[kGates] = {
+    _recurrent_to_input_weights, _recurrent_to_forget_weights, _recurrent_to_cell_weights,
+    _recurrent_to_output_weights};
+  const IPortableTensor *gate_bias[kGates] = {_input_gate_bias, _forget_gate_bias, _cell_gate_bias,
+                                              _output_gate_bias};
+  const float *input_to_gate_weights_ptr[kGates];
+  const float *recurrent_to_gate_weights_ptr[kGates];
+  const float *gate_bias_ptr[kGates];
+  for (int g = 0; g < kGates; ++g)
+  {
+    input_to_gate_weights_ptr[g] = floatWeights(input_to_gate_weights[g], &dequantized[g]);
+    recurrent_to_gate_weights_ptr[g] =
+      floatWeights(recurrent_to_gate_weights[g], &dequantized[kGates + g]);
+    gate_bias_ptr[g] = floatWeights(gate_bias[g], nullptr);
+  }
+
+  // Peephole and projection stay in float, dequantized once if they are int8
+  const IPortableTensor *cell_to_gate_weights[kGates] = {
+    _cell_to_input_weights, _cell_to_forget_weights, nullptr, _cell_to_output_weights};
+  for (int g = 0; g < kGates; ++g)
+    _cell_to_gate_weights_ptr[g] = floatWeights(cell_to_gate_weights[g], &_cell_to_gate_vec[g]);
+  _projection_weights_ptr = floatWeights(_projection_weights, &_projection_weights_vec);
+
+  const int n_input = _input->getShape().dim(_input->getShape().rank() - 1);
+  const int n_cell = _input_to_output_weights->getShape().dim(0);
+  const int n_output = _recurrent_to_output_weights->getShape().dim(1);
+  _lstm->prepare(input_to_gate_weights_ptr, recurrent_to_gate_weights_ptr, gate_bias_ptr, n_cell,
+                 n_input, n_output, _is_hybrid);
+}
+
 void LSTMLayer::LSTMFloat()
 {
   auto in_shape = _input->getShape();
@@ -76,67 +142,25 @@ void LSTMLayer::LSTMFloat()
     n_batch = in_shape.dim(0);
   }
   const int n_input = in_shape.dim(_input->getShape().rank() - 1);
-  const int aux_input_size = 0;
-
-  // n_cell and n_output will be the same size when there is no projection.
   const int n_cell = _input_to_output_weights->getShape().dim(0);
-  const int n_output = _recurrent_to_output_weights->getShape().dim(1);
-
-  // Since we have already checked that weights are all there or none, we can
-  // check the existence of only one to the get the condition.
-  const bool use_cifg = (_input_to_input_weights == nullptr);
 
-  // Optional outputs
-  float *output_state_buf = getOptionalOutputBuffer<float>(_output_state, &_output_state_vec,
-                                                           _output_state_in->total_size());
-  float *cell_state_buf =
-    getOptionalOutputBuffer<float>(_cell_state, &_cell_state_vec, _cell_state_in->total_size());
+  if (_aux_input)
+    throw std::runtime_error{"LSTMLayer: auxiliary input is not supported"};
 
-  initializeStateBuffer(_output_state_in, output_state_buf, _has_output_state_data);
-  initializeStateBuffer(_cell_state_in, cell_state_buf, _has_cell_state_data);
+  // Weights that are not constant may change between runs
+  if (!_lstm->prepared() || !_weights_constant)
+    prepareWeights();
 
-  // Index the scratch buffers pointers to the global scratch buffer.
-  float *scratch_buffer_buf = getOptionalOutputBuffer<float>(
-    _scratch_buffer, &_scratch_vec, n_batch * n_cell * (use_cifg ? 3 : 4) * sizeof(float));
-  float *input_gate_scratch = nullptr;
-  float *cell_gate_scratch = nullptr;
-  float *forget_gate_scratch = nullptr;
-  float *output_gate_scratch = nullptr;
-  if (use_cifg)
-  {
-    cell_gate_scratch = scratch_buffer_buf;
-    forget_gate_scratch = scratch_buffer_buf + n_cell * n_batch;
-    output_gate_scratch = scratch_buffer_buf + 2 * n_cell * n_batch;
-  }
-  else
-  {
-    input_gate_scratch = scratch_buffer_buf;
-    cell_gate_scratch = scratch_buffer_buf + n_cell * n_batch;
-    forget_gate_scratch = scratch_buffer_buf + 2 * n_cell * n_batch;
-    output_gate_scratch = scratch_buffer_buf + 3 * n_cell * n_batch;
-  }
+  float *output_state_buf =
+    stateBuffer(_output_state_in, _output_state, &_output_state_vec, _output_state_variable);
+  float *cell_state_buf =
+    stateBuffer(_cell_state_in, _cell_state, &_cell_state_vec, _cell_state_variable);
 
-  auto optional_tensor_ptr = [](const IPortableTensor *tensor) {
-    // If tensor is not given or the tensor size is 0, consider it was not given
-    return (tensor && tensor->total_size() > 0) ? getBuffer<float>(tensor) : nullptr;
-  };
-  // Optional inputs
-  const float *input_to_input_weights_ptr = optional_tensor_ptr(_input_to_input_weights);
-  const float *recurrent_to_input_weights_ptr = optional_tensor_ptr(_recurrent_to_input_weights);
-  const float *cell_to_input_weights_ptr = optional_tensor_ptr(_cell_to_input_weights);
-  const float *cell_to_forget_weights_ptr = optional_tensor_ptr(_cell_to_forget_weights);
-  const float *cell_to_output_weights_ptr = optional_tensor_ptr(_cell_to_output_weights);
-  const float *input_gate_bias_ptr = optional_tensor_ptr(_input_gate_bias);
-  const float *projection_weights_ptr = optional_tensor_ptr(_projection_weights);
-  const float *projection_bias_ptr = optional_tensor_ptr(_projection_bias);
-  const float *input_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_input_layer_norm_coefficients);
-  const float *forget_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_forget_layer_norm_coefficients);
-  const float *cell_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_cell_layer_norm_coefficients);
-  const float *output_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_output_layer_norm_coefficients);
+  const float *layer_norm_coefficients_ptr[kGates] = {
+    floatWeights(_input_layer_norm_coefficients, nullptr),
+    floatWeights(_forget_layer_norm_coefficients, nullptr),
+    floatWeights(_cell_layer_norm_coefficients, nullptr),
+    floatWeights(_output_layer_norm_coefficients, nullptr)};
 
   // Copy out the LSTM specific params so they can be passed in the function.
   nnfw::cker::LSTMParams lstm_params;
@@ -146,97 +170,19 @@ void LSTMLayer::LSTMFloat()
 
   auto out_shape = _output->getShape();
   const int output_batch_leading_dim = out_shape.dim(out_shape.rank() - 1);
-  if (_time_major)
-  {
-    // Loop through the sequence.
-    const int input_step = n_batch * n_input;
-    const int output_step = n_batch * output_batch_leading_dim;
-    for (int t = 0; t < max_time; t++)
-    {
-      // If this is the forward_sequence, step forward, otherwise step
-      // backwards.
-      const int t_rel = _forward_sequence ? t : max_time - t - 1;
-      const float *input_ptr = getBuffer<float>(_input) + t_rel * input_step;
-      const float *aux_input_ptr = nullptr;
-      if (_aux_input)
-      {
-        aux_input_ptr = getBuffer<float>(_aux_input) + t_rel * input_step;
-      }
-      float *output_ptr = getBuffer<float>(_output) + t_rel * output_step + _output_offset;
+  const auto lease = _external_context->leaseThreads(static_cast<uint64_t>(max_time) * n_batch *
+                                                     n_input * n_cell);
+  (*_lstm)(lstm_params, getBuffer<float>(_input), max_time, n_batch, _time_major,
+           _forward_sequence, _cell_to_gate_weights_ptr, layer_norm_coefficients_ptr,
+           _projection_weights_ptr, floatWeights(_projection_bias, nullptr),
+           output_batch_leading_dim, output_state_buf, cell_state_buf,
+           getBuffer<float>(_output) + _output_offset, _external_context->ruy_context());
 
-      LstmStepFloat(
-        input_ptr, input_to_input_weights_ptr, getBuffer<float>(_input_to_forget_weights),
-        getBuffer<float>(_input_to_cell_weights), getBuffer<float>(_input_to_output_weights),
-        aux_input_ptr,
-        /*aux_input_to_input_weights=*/nullptr,
-        /*aux_input_to_forget_weights=*/nullptr,
-        /*aux_input_to_cell_weights=*/nullptr,
-        /*aux_input_to_output_weights=*/nullptr, recurrent_to_input_weights_ptr,
-        getBuffer<float>(_recurrent_to_forget_weights),
-        getBuffer<float>(_recurrent_to_cell_weights),
-        getBuffer<float>(_recurrent_to_output_weights), cell_to_input_weights_ptr,
-        cell_to_forget_weights_ptr, cell_to_output_weights_ptr, input_layer_norm_coefficients_ptr,
-        forget_layer_norm_coefficients_ptr, cell_layer_norm_coefficients_ptr,
-        output_layer_norm_coefficients_ptr, input_gate_bias_ptr,
-        getBuffer<float>(_forget_gate_bias), getBuffer<float>(_cell_gate_bias),
-        getBuffer<float>(_output_gate_bias), projection_weights_ptr, projection_bias_ptr,
-        &lstm_params, n_batch, n_cell, n_input, aux_input_size, n_output, output_batch_leading_dim,
-        output_state_buf, cell_state_buf, input_gate_scratch, forget_gate_scratch,
-        cell_gate_scratch, output_gate_scratch, output_ptr);
-    }
-  }
-  else
-  {
-    for (int b = 0; b < n_batch; b++)
-    {
-      const int input_step = n_input;
-      const int output_step = output_batch_leading_dim;
-      for (int t = 0; t < max_time; t++)
-      {
-        // If this is the forward_sequence, step forward, otherwise step
-        // backwards.
-        const int t_rel = _forward_sequence ? t : max_time - t - 1;
-        const int time_offset = b * max_time + t_rel;
-        const float *input_ptr = getBuffer<float>(_input) + time_offset * input_step;
-        const float *aux_input_ptr = nullptr;
-        if (_aux_input)
-        {
-          aux_input_ptr = getBuffer<float>(_aux_input) + time_offset * input_step;
-        }
-        float *output_ptr = getBuffer<float>(_output) + time_offset * output_step + _output_offset;
-
-        // Offset the {output,cell}_state pointers to the right batch.
-        float *output_state_ptr = output_state_buf + b * output_batch_leading_dim;
-        float *cell_state_ptr = cell_state_buf + b * n_cell;
-        // Offset the scratch pointers to the right batch.
-        float *input_gate_scratch_ptr =
-          input_gate_scratch ? input_gate_scratch + b * n_cell : nullptr;
-        float *forget_gate_scratch_ptr = forget_gate_scratch + b * n_cell;
-        float *cell_gate_scratch_ptr = cell_gate_scratch + b * n_cell;
-        float *output_gate_scratch_ptr = output_gate_scratch + b * n_cell;
-
-        LstmStepFloat(
-          input_ptr, input_to_input_weights_ptr, getBuffer<float>(_input_to_forget_weights),
-          getBuffer<float>(_input_to_cell_weights), getBuffer<float>(_input_to_output_weights),
-          aux_input_ptr,
-          /*aux_input_to_input_weights=*/nullptr,
-          /*aux_input_to_forget_weights=*/nullptr,
-          /*aux_input_to_cell_weights=*/nullptr,
-          /*aux_input_to_output_weights=*/nullptr, recurrent_to_input_weights_ptr,
-          getBuffer<float>(_recurrent_to_forget_weights),
-          getBuffer<float>(_recurrent_to_cell_weights),
-          getBuffer<float>(_recurrent_to_output_weights), cell_to_input_weights_ptr,
-          cell_to_forget_weights_ptr, cell_to_output_weights_ptr, input_layer_norm_coefficients_ptr,
-          forget_layer_norm_coefficients_ptr, cell_layer_norm_coefficients_ptr,
-          output_layer_norm_coefficients_ptr, input_gate_bias_ptr,
-          getBuffer<float>(_forget_gate_bias), getBuffer<float>(_cell_gate_bias),
-          getBuffer<float>(_output_gate_bias), projection_weights_ptr, projection_bias_ptr,
-          &lstm_params, /*n_batch=*/1, n_cell, n_input, aux_input_size, n_output,
-          output_batch_leading_dim, output_state_ptr, cell_state_ptr, input_gate_scratch_ptr,
-          forget_gate_scratch_ptr, cell_gate_scratch_ptr, output_gate_scratch_ptr, output_ptr);
-      }
-    }
-  }
+  // Optional outputs of variable states
+  if (_output_state_variable && _output_state != nullptr)
+    memcpy(_output_state->buffer(), output_state_buf, _output_state_in->total_size());
+  if (_cell_state_variable && _cell_state != nullptr)
+    memcpy(_cell_state->buffer(), cell_state_buf, _cell_state_in->total_size());
 }
 
 void LSTMLayer::configure(
@@ -259,7 +205,8 @@ void LSTMLayer::configure(
   const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
   bool forward_sequence, bool time_major, int output_offset, IPortableTensor *scratch_buffer,
   IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-  bool has_output_state_data, bool has_cell_state_data)
+  bool output_state_variable, bool cell_state_variable,
+  const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _input_to_input_weights = input_to_input_weights;
@@ -296,8 +243,25 @@ void LSTMLayer::configure(
   _output_state = output_state;
   _cell_state = cell_state;
   _output = output;
-  _has_output_state_data = has_output_state_data;
-  _has_cell_state_data = has_cell_state_data;
+  _output_state_variable = output_state_variable;
+  _cell_state_variable = cell_state_variable;
+  _external_context = external_context;
+
+  // Like FullyConnected, int8 weights with float input run in hybrid mode
+  _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
+               input_to_forget_weights->data_type() == OperandType::QUANT_INT8_SYMM;
+  _weights_constant = true;
+  for (const auto tensor :
+       {input_to_input_weights, input_to_forget_weights, input_to_cell_weights,
+        input_to_output_weights, recurrent_to_input_weights, recurrent_to_forget_weights,
+        recurrent_to_cell_weights, recurrent_to_output_weights, input_gate_bias, forget_gate_bias,
+        cell_gate_bias, output_gate_bias, cell_to_input_weights, cell_to_forget_weights,
+        cell_to_output_weights, projection_weights})
+  {
+    if (tensor && !tensor->is_constant())
+      _weights_constant = false;
+  }
+  _lstm = std::make_unique<nnfw::cker::optimized::SequenceLstm>();
 }
 
 void LSTMLayer::run()
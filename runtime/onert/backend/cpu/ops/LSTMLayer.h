@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 #include <ir/InternalType.h>
 #include <ir/operation/LSTM.h>
 #include <exec/IFunction.h>
@@ -28,6 +29,10 @@ namespace nnfw
 namespace cker
 {
 class FCTempArena;
+namespace optimized
+{
+class SequenceLstm;
+} // namespace optimized
 }
 } // namespace nnfw
 
@@ -44,7 +49,8 @@ namespace ops
 class LSTMLayer : public ::onert::exec::IFunction
 {
 public:
-  LSTMLayer() = default;
+  LSTMLayer();
+  ~LSTMLayer();
 
 public:
   void LSTMFloat();
@@ -72,11 +78,18 @@ public:
     const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
     bool forward_sequence, bool time_major, int32_t output_offset, IPortableTensor *scratch_buffer,
     IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-    bool has_output_state_data, bool has_cell_state_data);
+    bool output_state_variable, bool cell_state_variable,
+    const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 private:
+  void prepareWeights();
+
+private:
+  // Input, forget, cell and output gates
+  static constexpr int kGates = 4;
+
   const IPortableTensor *_input{nullptr};
   const IPortableTensor *_input_to_input_weights{nullptr};
   const IPortableTensor *_input_to_forget_weights{nullptr};
@@ -110,15 +123,24 @@ private:
   IPortableTensor *_output_state{nullptr};
   IPortableTensor *_cell_state{nullptr};
   IPortableTensor *_output{nullptr};
-  std::vector<uint8_t> _scratch_vec{};
   std::vector<uint8_t> _output_state_vec{};
   std::vector<uint8_t> _cell_state_vec{};
   ir::operation::LSTM::Param _params{};
   bool _forward_sequence{true};
   bool _time_major{true};
   int32_t _output_offset{0};
-  bool _has_output_state_data{false};
-  bool _has_cell_state_data{false};
+  // Variable states are updated in place and kept for the next run
+  bool _output_state_variable{false};
+  bool _cell_state_variable{false};
+  std::shared_ptr<ExternalContext> _external_context{nullptr};
+
+  std::unique_ptr<nnfw::cker::optimized::SequenceLstm> _lstm;
+  bool _is_hybrid{false};
+  bool _weights_constant{false};
+  const float *_cell_to_gate_weights_ptr[kGates]{};
+  std::vector<float> _cell_to_gate_vec[kGates];
+  const float *_projection_weights_ptr{nullptr};
+  std::vector<float> _projection_weights_vec;
 };
 
 } // namespace ops
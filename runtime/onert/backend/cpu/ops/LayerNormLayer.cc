@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "LayerNormLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/LayerNorm.h>
+#include <cker/Types.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void LayerNormLayer::configure(const IPortableTensor *input, const IPortableTensor *gamma,
+                               const IPortableTensor *beta, float epsilon,
+                               IPortableTensor *output,
+                               const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(input != nullptr);
+  assert(gamma != nullptr);
+  assert(beta != nullptr);
+  assert(output != nullptr);
+
+  _input = input;
+  _gamma = gamma;
+  _beta = beta;
+  _epsilon = epsilon;
+  _output = output;
+  _external_context = external_context;
+}
+
+void LayerNormLayer::run()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"LayerNorm: Unsupported data type"};
+
+  nnfw::cker::LayerNormParams params;
+  params.epsilon = _epsilon;
+
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+  nnfw::cker::LayerNorm(params, getShape(_input), getBuffer<float>(_input), getShape(_gamma),
+                        getBuffer<float>(_gamma), getShape(_beta), getBuffer<float>(_beta),
+                        getShape(_output), getBuffer<float>(_output),
+                        _external_context->ruy_context());
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -29,7 +29,8 @@ namespace cpu
 namespace ops
 {
 
-LogSoftMaxLayer::LogSoftMaxLayer() : _input(nullptr), _output(nullptr), _beta(0.0), _axis(0)
+LogSoftMaxLayer::LogSoftMaxLayer()
+  : _input(nullptr), _output(nullptr), _beta(0.0), _axis(0), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -50,7 +51,7 @@ void LogSoftMaxLayer::logsoftmaxFloat32()
   op_params.beta = _beta;
   op_params.axis = _axis;
   nnfw::cker::LogSoftmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                         getBuffer<float>(_output));
+                         getBuffer<float>(_output), _external_context->ruy_context());
 }
 
 void LogSoftMaxLayer::logsoftmaxQuant8()
@@ -67,12 +68,14 @@ void LogSoftMaxLayer::logsoftmaxQuant8()
 }
 
 void LogSoftMaxLayer::configure(const IPortableTensor *input, const float beta, const int axis,
-                                IPortableTensor *output)
+                                IPortableTensor *output,
+                                const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _beta = beta;
   _axis = axis;
+  _external_context = external_context;
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
     PopulateLookupTable(_beta);
@@ -83,6 +86,7 @@ void LogSoftMaxLayer::run()
 {
   if (_input->data_type() == OperandType::FLOAT32)
   {
+    const auto lease = _external_context->leaseThreads(_input->getShape().num_elements());
     logsoftmaxFloat32();
   }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
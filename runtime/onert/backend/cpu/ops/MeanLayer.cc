@@ -29,60 +29,58 @@ namespace cpu
 namespace ops
 {
 
-MeanLayer::MeanLayer() : _input(nullptr), _axes(nullptr), _output(nullptr), _keep_dims(false)
+MeanLayer::MeanLayer()
+  : _input(nullptr), _axes(nullptr), _output(nullptr), _keep_dims(false), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void MeanLayer::MeanFloat32()
 {
-  const auto inputShape = getShape(_input);
-  const auto axisVec = getReducerAxes(_axes);
-  bool axis_is_1_and_2 =
-    _keep_dims && inputShape.DimensionsCount() == 4 && axisVec.size() == 2 &&
-    ((axisVec[0] == 1 && axisVec[1] == 2) || (axisVec[0] == 2 && axisVec[1] == 1));
-
-  if (axis_is_1_and_2)
-  {
-    nnfw::cker::MeanAxis1And2(inputShape, getBuffer<float>(_input), getShape(_output),
-                              getBuffer<float>(_output));
-  }
-  else
-  {
-    nnfw::cker::Mean(inputShape, getBuffer<float>(_input), getShape(_output),
-                     getBuffer<float>(_output), axisVec);
-  }
+  // Mean over H and W and over the inner or outer axes take a vectorized path in cker
+  nnfw::cker::Mean(getShape(_input), getBuffer<float>(_input), getShape(_output),
+                   getBuffer<float>(_output), getReducerAxes(_axes),
+                   _external_context->ruy_context());
 }
 
-void MeanLayer::MeanQuant8()
+template <typename T> void MeanLayer::MeanQuant8()
 {
-  nnfw::cker::MeanQ8Asymm(getShape(_input), getBuffer<uint8_t>(_input), _input->data_scale(),
-                          _input->data_zero_point(), getShape(_output), getBuffer<uint8_t>(_output),
-                          _output->data_scale(), _output->data_zero_point(), getReducerAxes(_axes));
+  nnfw::cker::MeanQ8Asymm(getShape(_input), getBuffer<T>(_input), _input->data_scale(),
+                          _input->data_zero_point(), getShape(_output), getBuffer<T>(_output),
+                          _output->data_scale(), _output->data_zero_point(), getReducerAxes(_axes),
+                          _external_context->ruy_context());
 }
 
 void MeanLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                          IPortableTensor *output, bool keep_dims)
+                          IPortableTensor *output, bool keep_dims,
+                          const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _keep_dims = keep_dims;
+  _external_context = external_context;
 
   if (_input->data_type() != OperandType::FLOAT32 &&
-      _input->data_type() != OperandType::QUANT_UINT8_ASYMM)
+      _input->data_type() != OperandType::QUANT_UINT8_ASYMM &&
+      _input->data_type() != OperandType::QUANT_INT8_ASYMM)
     throw std::runtime_error{"Mean: unsupported data type"};
 }
 
 void MeanLayer::run()
 {
+  const auto lease = _external_context->leaseThreads(_input->getShape().num_elements());
   if (_input->data_type() == OperandType::FLOAT32)
   {
     MeanFloat32();
   }
   else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    MeanQuant8();
+    MeanQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    MeanQuant8<int8_t>();
   }
   else
   {
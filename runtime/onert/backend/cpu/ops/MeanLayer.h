@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_MEANLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -38,10 +39,10 @@ public:
 public:
   void MeanFloat32();
 
-  void MeanQuant8();
+  template <typename T> void MeanQuant8();
 
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 bool keep_dims);
+                 bool keep_dims, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -50,6 +51,8 @@ private:
   const IPortableTensor *_axes;
   IPortableTensor *_output;
   bool _keep_dims;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
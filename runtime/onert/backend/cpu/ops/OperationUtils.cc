@@ -158,6 +158,11 @@ void CalculateActivationRangeQuantized(ir::Activation activation, const IPortabl
       qmin = std::numeric_limits<int8_t>::min();
       qmax = std::numeric_limits<int8_t>::max();
       break;
+    case OperandType::QUANT_INT16_ASYMM:
+    case OperandType::QUANT_INT16_SYMM:
+      qmin = std::numeric_limits<int16_t>::min();
+      qmax = std::numeric_limits<int16_t>::max();
+      break;
     default:
       throw std::runtime_error("CalculateActivationRangeQuantized: Not supported operand type.");
   }
@@ -222,6 +227,13 @@ bool HaveSameShapes(const IPortableTensor *input1, const IPortableTensor *input2
   return true;
 }
 
+bool IsQuant16x8(const IPortableTensor *input, const IPortableTensor *weights)
+{
+  return input->data_type() == OperandType::QUANT_INT16_ASYMM && input->data_zero_point() == 0 &&
+         (weights->data_type() == OperandType::QUANT_INT8_ASYMM ||
+          weights->data_type() == OperandType::QUANT_INT8_SYMM);
+}
+
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift)
 {
   const double max_input_rescaled = 1.0 * ((1 << input_integer_bits) - 1) *
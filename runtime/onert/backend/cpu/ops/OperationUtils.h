@@ -171,6 +171,9 @@ void CalculateActivationRangeQuantized(ir::Activation activation, const IPortabl
 
 bool HaveSameShapes(const IPortableTensor *input1, const IPortableTensor *input2);
 
+// Whether 16x8 kernels can take the tensors, which needs symmetric int16 input and int8 weights
+bool IsQuant16x8(const IPortableTensor *input, const IPortableTensor *weights);
+
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
 
 uint32_t sizeOfData(OperandType type, const std::vector<int32_t> &dimensions);
@@ -189,6 +192,27 @@ template <typename T> T *getBuffer(IPortableTensor *tensor)
   return reinterpret_cast<T *>(tensor->buffer());
 }
 
+/**
+ * @brief Check if the parts of a tensor are already placed one after another in its buffer
+ *
+ * The memory planner may place the inputs of Concat and the outputs of Split in the buffer of the
+ * whole tensor, and then the kernel does not need to copy anything.
+ */
+template <typename T_Tensor>
+bool isPlacedInWhole(const IPortableTensor *whole, const std::vector<T_Tensor *> &parts)
+{
+  const uint8_t *buffer = whole->buffer();
+  if (buffer == nullptr)
+    return false;
+  for (const auto part : parts)
+  {
+    if (part->buffer() != buffer)
+      return false;
+    buffer += part->total_size();
+  }
+  return buffer == whole->buffer() + whole->total_size();
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
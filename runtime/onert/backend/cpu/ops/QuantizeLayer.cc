@@ -33,23 +33,30 @@ namespace cpu
 namespace ops
 {
 template <typename InputT, typename OutputT>
-void affineQuantize(const IPortableTensor *input, IPortableTensor *output)
+void affineQuantize(const IPortableTensor *input, IPortableTensor *output,
+                    ruy::Context *ruy_context)
 {
   nnfw::cker::Quantize(getShape(input), getBuffer<InputT>(input), getShape(output),
-                       getBuffer<OutputT>(output), output->data_scale(), output->data_zero_point());
+                       getBuffer<OutputT>(output), output->data_scale(), output->data_zero_point(),
+                       ruy_context);
 }
 
-void QuantizeLayer::configure(const IPortableTensor *input, IPortableTensor *output)
+void QuantizeLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                              const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(input != nullptr);
   assert(output != nullptr);
 
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   if ((_input->data_type() == OperandType::FLOAT32))
   {
-    // DO NOTHING
+    if ((output->data_type() != OperandType::QUANT_UINT8_ASYMM) &&
+        (output->data_type() != OperandType::QUANT_INT8_ASYMM) &&
+        (output->data_type() != OperandType::QUANT_INT16_SYMM))
+      throw std::runtime_error{"Quantize: Unsupported  data type"};
   }
   else if (((input->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
             (output->data_type() == OperandType::QUANT_INT8_ASYMM)) ||
@@ -70,7 +77,14 @@ void QuantizeLayer::run()
 {
   if ((_input->data_type() == OperandType::FLOAT32))
   {
-    affineQuantize<float, uint8_t>(_input, _output);
+    const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+    const auto ruy_context = _external_context->ruy_context();
+    if (_output->data_type() == OperandType::QUANT_UINT8_ASYMM)
+      affineQuantize<float, uint8_t>(_input, _output, ruy_context);
+    else if (_output->data_type() == OperandType::QUANT_INT8_ASYMM)
+      affineQuantize<float, int8_t>(_input, _output, ruy_context);
+    else
+      affineQuantize<float, int16_t>(_input, _output, ruy_context);
   }
   else if ((_input->data_type() == OperandType::QUANT_UINT8_ASYMM) &&
            (_output->data_type() == OperandType::QUANT_INT8_ASYMM))
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_QUANTIZELAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -38,7 +39,8 @@ public:
   }
 
 public:
-  void configure(const IPortableTensor *input, IPortableTensor *output);
+  void configure(const IPortableTensor *input, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
   void run() override;
 
 private:
@@ -46,6 +48,7 @@ private:
   IPortableTensor *_output;
   int32_t _output_multiplier;
   int _output_shift;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 } // namespace ops
 } // namespace cpu
@@ -18,7 +18,6 @@
 
 #include "OperationUtils.h"
 
-#include "cker/neon/neon_check.h"
 #include <cker/operation/Reduce.h>
 
 namespace onert
@@ -35,13 +34,14 @@ namespace
 
 template <typename T>
 void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std::vector<int> &axes,
-               bool keep_dims, T init_value, nnfw::cker::Reduce &reduce_kernel,
-               T reducer(const T current, const T in))
+               ruy::Context *ruy_context, bool keep_dims, T init_value,
+               nnfw::cker::Reduce &reduce_kernel, T reducer(const T current, const T in))
 {
   reduce_kernel.prepare(input->getShape().rank(), axes.size());
   bool result =
     reduce_kernel.ReduceGeneric<T>(getShape(input), getBuffer<T>(input), getShape(output),
-                                   getBuffer<T>(output), axes, keep_dims, init_value, reducer);
+                                   getBuffer<T>(output), axes, keep_dims, init_value, reducer,
+                                   ruy_context);
 
   if (!result)
   {
@@ -50,31 +50,46 @@ void evalLogic(const IPortableTensor *input, IPortableTensor *output, const std:
 }
 
 template <typename T>
-std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
+void evalSum(const IPortableTensor *input, IPortableTensor *output, const std::vector<int> &axes,
+             ruy::Context *ruy_context, bool keep_dims, nnfw::cker::Reduce &reduce_kernel)
+{
+  reduce_kernel.prepare(input->getShape().rank(), axes.size());
+  bool result = reduce_kernel.ReduceSum<T>(getShape(input), getBuffer<T>(input), getShape(output),
+                                           getBuffer<T>(output), axes, keep_dims, ruy_context);
+
+  if (!result)
+  {
+    throw std::runtime_error{"Reduce: Fail to run"};
+  }
+}
+
+template <typename T>
+std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &,
+                   ruy::Context *)>
 evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
 {
   switch (reduce_type)
   {
     case ReduceType::kSum:
-      return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, static_cast<T>(0), reduce_kernel,
-                       [](const T current, const T in) -> T { return in + current; });
+      return std::bind(&evalSum<T>, std::placeholders::_1, std::placeholders::_2,
+                       std::placeholders::_3, std::placeholders::_4, keep_dims, reduce_kernel);
       break;
     case ReduceType::kProd:
-      return std::bind(&evalLogic<T>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, static_cast<T>(1), reduce_kernel,
-                       [](const T current, const T in) -> T { return in * current; });
+      return std::bind(
+        &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+        std::placeholders::_4, keep_dims, static_cast<T>(1), reduce_kernel,
+        [](const T current, const T in) -> T { return in * current; });
       break;
     case ReduceType::kMax:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel,
+        std::placeholders::_4, keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel,
         [](const T current, const T in) -> T { return (in > current) ? in : current; });
       break;
     case ReduceType::kMin:
       return std::bind(
         &evalLogic<T>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
-        keep_dims, std::numeric_limits<T>::max(), reduce_kernel,
+        std::placeholders::_4, keep_dims, std::numeric_limits<T>::max(), reduce_kernel,
         [](const T current, const T in) -> T { return (in < current) ? in : current; });
       break;
     default:
@@ -84,27 +99,31 @@ evalType(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_ty
 
 // Template specialization for bool type
 template <>
-std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
+std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &,
+                   ruy::Context *)>
 evalType<bool>(bool keep_dims, nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
 {
   switch (reduce_type)
   {
     case ReduceType::kAny:
-      return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, false, reduce_kernel,
-                       [](const bool current, const bool in) -> bool { return in || current; });
+      return std::bind(
+        &evalLogic<bool>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+        std::placeholders::_4, keep_dims, false, reduce_kernel,
+        [](const bool current, const bool in) -> bool { return in || current; });
       break;
     case ReduceType::kAll:
-      return std::bind(&evalLogic<bool>, std::placeholders::_1, std::placeholders::_2,
-                       std::placeholders::_3, keep_dims, true, reduce_kernel,
-                       [](const bool current, const bool in) -> bool { return in && current; });
+      return std::bind(
+        &evalLogic<bool>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+        std::placeholders::_4, keep_dims, true, reduce_kernel,
+        [](const bool current, const bool in) -> bool { return in && current; });
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
   }
 }
 
-std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &)>
+std::function<void(const IPortableTensor *, IPortableTensor *, const std::vector<int> &,
+                   ruy::Context *)>
 generateKernelGeneric(const IPortableTensor *input, bool keep_dims,
                       nnfw::cker::Reduce &reduce_kernel, ReduceType reduce_type)
 {
@@ -123,7 +142,7 @@ generateKernelGeneric(const IPortableTensor *input, bool keep_dims,
 
 // TODO Refine this function
 void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
-                      const std::vector<int> &axes, bool keep_dims,
+                      const std::vector<int> &axes, ruy::Context *ruy_context, bool keep_dims,
                       nnfw::cker::Reduce &reduce_kernel)
 {
   const bool same_scale = (input->data_scale() == output->data_scale() &&
@@ -141,7 +160,8 @@ void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
       [](const int32_t current, const uint8_t in) -> int32_t {
         const int32_t actual_in = static_cast<int32_t>(in);
         return current + actual_in;
-      });
+      },
+      ruy_context);
 
     if (!result)
     {
@@ -152,14 +172,14 @@ void evalSumQuantized(const IPortableTensor *input, IPortableTensor *output,
   }
 
   const auto kernel = generateKernelGeneric(input, keep_dims, reduce_kernel, ReduceType::kSum);
-  kernel(input, output, axes);
+  kernel(input, output, axes, ruy_context);
 }
 
 } // namespace
 
 ReduceLayer::ReduceLayer()
   : _input(nullptr), _axes(nullptr), _output(nullptr), _reduce_kernel(new nnfw::cker::Reduce()),
-    _kernel(), _reduceType(ReduceType::kInvalid)
+    _kernel(), _reduceType(ReduceType::kInvalid), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -167,12 +187,14 @@ ReduceLayer::ReduceLayer()
 ReduceLayer::~ReduceLayer() = default;
 
 void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                            IPortableTensor *output, ReduceType reduceType, bool keep_dims)
+                            IPortableTensor *output, ReduceType reduceType, bool keep_dims,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _reduceType = reduceType;
+  _external_context = external_context;
 
   switch (_reduceType)
   {
@@ -180,7 +202,8 @@ void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor
       if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         _kernel = std::bind(&evalSumQuantized, std::placeholders::_1, std::placeholders::_2,
-                            std::placeholders::_3, keep_dims, *_reduce_kernel);
+                            std::placeholders::_3, std::placeholders::_4, keep_dims,
+                            *_reduce_kernel);
         return;
       }
       _kernel = generateKernelGeneric(_input, keep_dims, *_reduce_kernel, ReduceType::kSum);
@@ -208,16 +231,8 @@ void ReduceLayer::configure(const IPortableTensor *input, const IPortableTensor
 void ReduceLayer::run()
 {
   const auto axes = getReducerAxes(_axes);
-#ifdef USE_NEON
-  int32_t rank = _input->getShape().rank();
-  if (_input->data_type() == ir::DataType::FLOAT32 && _reduceType == ReduceType::kSum &&
-      axes.size() == 1 && (axes[0] == -1 || axes[0] == rank - 1))
-  {
-    OptimizedReduceSum(getBuffer<float>(_input), getShape(_input), getBuffer<float>(_output));
-    return;
-  }
-#endif // NEON
-  _kernel(_input, _output, axes);
+  const auto lease = _external_context->leaseThreads(_input->getShape().num_elements());
+  _kernel(_input, _output, axes, _external_context->ruy_context());
 }
 
 } // namespace ops
@@ -20,6 +20,7 @@
 #include "cker/neon/neon_check.h"
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 #include <memory>
@@ -60,7 +61,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 ReduceType reduceType, bool keep_dims);
+                 ReduceType reduceType, bool keep_dims,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -71,10 +73,12 @@ private:
 
   std::unique_ptr<nnfw::cker::Reduce> _reduce_kernel;
   std::function<void(const IPortableTensor *input, IPortableTensor *output,
-                     const std::vector<int> &axes)>
+                     const std::vector<int> &axes, ruy::Context *ruy_context)>
     _kernel;
 
   ReduceType _reduceType;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -15,8 +15,6 @@
  */
 #include "OperationUtils.h"
 #include "ResizeBilinearLayer.h"
-#include "cker/operation/ResizeBilinear.h"
-#include <cker/Types.h>
 
 namespace onert
 {
@@ -29,14 +27,15 @@ namespace ops
 
 ResizeBilinearLayer::ResizeBilinearLayer()
   : _input(nullptr), _output(nullptr), _size(nullptr), _output_height(0), _output_width(0),
-    _align_corners(false), _half_pixel_centers(false)
+    _align_corners(false), _half_pixel_centers(false), _tables(), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                     const IPortableTensor *size, bool align_corners,
-                                    bool half_pixel_centers)
+                                    bool half_pixel_centers,
+                                    const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(!size->is_constant());
   _input = input;
@@ -44,11 +43,13 @@ void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTenso
   _size = size;
   _align_corners = align_corners;
   _half_pixel_centers = half_pixel_centers;
+  _external_context = external_context;
 }
 
 void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                     int32_t output_height, int32_t output_width, bool align_corners,
-                                    bool half_pixel_centers)
+                                    bool half_pixel_centers,
+                                    const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(_size == nullptr);
   if (output_height < 0)
@@ -67,9 +68,10 @@ void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTenso
   _output_width = output_width;
   _align_corners = align_corners;
   _half_pixel_centers = half_pixel_centers;
+  _external_context = external_context;
 }
 
-void ResizeBilinearLayer::run()
+nnfw::cker::ResizeBilinearParams ResizeBilinearLayer::params() const
 {
   nnfw::cker::ResizeBilinearParams params;
   if (_size == nullptr)
@@ -85,21 +87,47 @@ void ResizeBilinearLayer::run()
   }
   params.align_corners = _align_corners;
   params.half_pixel_centers = _half_pixel_centers;
+  return params;
+}
+
+void ResizeBilinearLayer::prepare()
+{
+  if (_size != nullptr || _input->is_dynamic())
+    return;
+
+  const auto input_shape = getShape(_input);
+  nnfw::cker::PrepareResizeBilinearTables(params(), input_shape.Dims(1), input_shape.Dims(2),
+                                          &_tables);
+}
+
+void ResizeBilinearLayer::run()
+{
+  const auto params = this->params();
+  const auto input_shape = getShape(_input);
+  if (_input->data_type() != OperandType::QUANT_INT8_ASYMM &&
+      !_tables.matches(params, input_shape.Dims(1), input_shape.Dims(2)))
+  {
+    nnfw::cker::PrepareResizeBilinearTables(params, input_shape.Dims(1), input_shape.Dims(2),
+                                            &_tables);
+  }
+  const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
 
   switch (_input->data_type())
   {
     case OperandType::FLOAT32:
-      nnfw::cker::ResizeBilinear(params, getShape(_input), getBuffer<float>(_input),
-                                 getShape(_output), getBuffer<float>(_output));
+      nnfw::cker::ResizeBilinear(params, _tables, input_shape, getBuffer<float>(_input),
+                                 getShape(_output), getBuffer<float>(_output),
+                                 _external_context->ruy_context());
       break;
 
     case OperandType::QUANT_UINT8_ASYMM:
-      nnfw::cker::ResizeBilinear(params, getShape(_input), getBuffer<uint8_t>(_input),
-                                 getShape(_output), getBuffer<uint8_t>(_output));
+      nnfw::cker::ResizeBilinear(params, _tables, input_shape, getBuffer<uint8_t>(_input),
+                                 getShape(_output), getBuffer<uint8_t>(_output),
+                                 _external_context->ruy_context());
       break;
 
     case OperandType::QUANT_INT8_ASYMM:
-      nnfw::cker::ResizeBilinear(params, getShape(_input), getBuffer<int8_t>(_input),
+      nnfw::cker::ResizeBilinear(params, input_shape, getBuffer<int8_t>(_input),
                                  getShape(_output), getBuffer<int8_t>(_output));
       break;
 
@@ -18,6 +18,9 @@
 #define __ONERT_BACKEND_CPU_OPS_RESIZEBILINEAR_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
+
+#include <cker/operation/ResizeBilinear.h>
 
 #include <exec/IFunction.h>
 
@@ -37,13 +40,20 @@ public:
 
 public:
   void configure(const IPortableTensor *input1, IPortableTensor *output,
-                 const IPortableTensor *size, bool align_corners, bool half_pixel_centers);
+                 const IPortableTensor *size, bool align_corners, bool half_pixel_centers,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void configure(const IPortableTensor *input, IPortableTensor *output, int32_t output_height,
-                 int32_t output_width, bool align_corners, bool half_pixel_centers);
+                 int32_t output_width, bool align_corners, bool half_pixel_centers,
+                 const std::shared_ptr<ExternalContext> &external_context);
+
+  void prepare() override;
 
   void run() override;
 
+private:
+  nnfw::cker::ResizeBilinearParams params() const;
+
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
@@ -52,6 +62,12 @@ private:
   int32_t _output_width;
   bool _align_corners;
   bool _half_pixel_centers;
+
+  // Interpolation tables, computed in prepare() for a constant size and a static input, and
+  // again in run() whenever they do not match
+  nnfw::cker::ResizeBilinearTables _tables;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -19,6 +19,8 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/SoftMax.h>
+#include <cker/operation/SoftMaxFp16.h>
+#include <cker/operation/SoftMaxInt16.h>
 
 namespace onert
 {
@@ -29,42 +31,31 @@ namespace cpu
 namespace ops
 {
 
-SoftMaxLayer::SoftMaxLayer() : _input(nullptr), _output(nullptr), _beta(0.0)
+SoftMaxLayer::SoftMaxLayer()
+  : _input(nullptr), _output(nullptr), _beta(0.0), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void SoftMaxLayer::softmaxFloat32()
 {
-  if (getNumberOfDimensions(_input) == 1)
-  {
-    uint32_t input_size = getNumberOfElements(_input);
-    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, 1, _beta, getBuffer<float>(_output));
-  }
-  else if (getNumberOfDimensions(_input) == 2)
-  {
-    uint32_t batch_size = getSizeOfDimension(_input, 0);
-    if (batch_size == 0)
-      throw std::runtime_error("batch_size should not be 0");
+  // Softmax is over the last dimension of any rank, whose rows are split among threads
+  const auto input_shape = getShape(_input);
+  const int input_size = input_shape.Dims(input_shape.DimensionsCount() - 1);
+  if (input_size == 0)
+    throw std::runtime_error("input_size should not be 0");
+  const int batch_size = input_shape.FlatSize() / input_size;
+  nnfw::cker::Softmax(getBuffer<float>(_input), input_size, batch_size, _beta,
+                      getBuffer<float>(_output), _external_context->ruy_context());
+}
 
-    uint32_t input_size = getNumberOfElements(_input) / batch_size;
-    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, batch_size, _beta,
-                        getBuffer<float>(_output));
-  }
-  else if (getNumberOfDimensions(_input) == 4)
-  {
-    nnfw::cker::SoftmaxParams op_params;
-    op_params.beta = _beta;
-    nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                        getBuffer<float>(_output));
-  }
-  else
-  {
-    nnfw::cker::SoftmaxParams op_params;
-    op_params.beta = _beta;
-    nnfw::cker::reference::Softmax(op_params, getShape(_input), getBuffer<float>(_input),
-                                   getShape(_output), getBuffer<float>(_output));
-  }
+void SoftMaxLayer::softmaxFloat16()
+{
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.beta = _beta;
+  nnfw::cker::SoftmaxFp16(op_params, getShape(_input), getBuffer<nnfw::cker::float16>(_input),
+                          getShape(_output), getBuffer<nnfw::cker::float16>(_output),
+                          _external_context->ruy_context());
 }
 
 template <typename T> void SoftMaxLayer::softmaxQuant8()
@@ -85,12 +76,25 @@ template <typename T> void SoftMaxLayer::softmaxQuant8()
 #endif
 }
 
+void SoftMaxLayer::softmaxQuant16()
+{
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.scale = _output->data_scale();
+  op_params.zero_point = _output->data_zero_point();
+  op_params.table = _table16.data();
+  op_params.table_size = _table16.size();
+  nnfw::cker::SoftmaxInt16(op_params, getShape(_input), getBuffer<int16_t>(_input),
+                           getShape(_output), getBuffer<int16_t>(_output));
+}
+
 void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
-                             IPortableTensor *output)
+                             IPortableTensor *output,
+                             const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _beta = beta;
+  _external_context = external_context;
 
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
       _input->data_type() == OperandType::QUANT_INT8_ASYMM)
@@ -104,21 +108,32 @@ void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
     nnfw::cker::PopulateSoftmaxLookupTable(_table, _input->data_scale(), _beta);
 #endif
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    nnfw::cker::PopulateSoftmaxInt16LookupTable(_table16, _input->data_scale(), _beta);
+  }
 }
 
 void SoftMaxLayer::run()
 {
+  const auto lease = _external_context->leaseThreads(_input->getShape().num_elements());
   switch (_input->data_type())
   {
     case OperandType::FLOAT32:
       softmaxFloat32();
       break;
+    case OperandType::FLOAT16:
+      softmaxFloat16();
+      break;
     case OperandType::QUANT_UINT8_ASYMM:
       softmaxQuant8<uint8_t>();
       break;
     case OperandType::QUANT_INT8_ASYMM:
       softmaxQuant8<int8_t>();
       break;
+    case OperandType::QUANT_INT16_ASYMM:
+      softmaxQuant16();
+      break;
     default:
       throw std::runtime_error{"SoftMax: unsupported data type"};
   }
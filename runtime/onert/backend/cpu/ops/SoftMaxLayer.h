@@ -18,9 +18,12 @@
 #define __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -38,9 +41,14 @@ public:
 public:
   void softmaxFloat32();
 
+  void softmaxFloat16();
+
   template <typename T> void softmaxQuant8();
 
-  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
+  void softmaxQuant16();
+
+  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -53,6 +61,10 @@ private:
   float _table[256];
   uint8_t _uint8_table1[256];
   uint8_t _uint8_table2[256];
+  // Table of exp() for int16 input, sized by its scale
+  std::vector<float> _table16;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -75,6 +75,9 @@ void SplitLayer::configure(const IPortableTensor *input, const IPortableTensor *
 
 void SplitLayer::run()
 {
+  if (isPlacedInWhole(_input, _outputs))
+    return;
+
   if (_input->data_type() == OperandType::FLOAT32)
   {
     split<float>();
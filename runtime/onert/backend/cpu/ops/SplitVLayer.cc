@@ -71,6 +71,9 @@ void SplitVLayer::configure(const IPortableTensor *input, const IPortableTensor
 
 void SplitVLayer::run()
 {
+  if (isPlacedInWhole(_input, _outputs))
+    return;
+
   if (_input->data_type() == OperandType::FLOAT32)
   {
     splitV<float>();
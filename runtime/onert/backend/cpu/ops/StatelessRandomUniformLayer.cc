@@ -33,19 +33,24 @@ StatelessRandomUniformLayer::StatelessRandomUniformLayer()
   // DO NOTHING
 }
 
-void StatelessRandomUniformLayer::configure(const IPortableTensor *shape,
-                                            const IPortableTensor *seed, IPortableTensor *output)
+void StatelessRandomUniformLayer::configure(
+  const IPortableTensor *shape, const IPortableTensor *seed, IPortableTensor *output,
+  const std::shared_ptr<ExternalContext> &external_context)
 {
   _shape = shape;
   _seed = seed;
   _output = output;
+  _external_context = external_context;
 }
 
 void StatelessRandomUniformLayer::StatelessRandomUniformFloat32()
 {
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) *
+    nnfw::cker::random::PhiloxRandom::kElementCost);
   nnfw::cker::StatelessRandomUniform(getShape(_shape), getBuffer<int32_t>(_shape), getShape(_seed),
                                      getBuffer<int32_t>(_seed), getShape(_output),
-                                     getBuffer<float>(_output));
+                                     getBuffer<float>(_output), _external_context->ruy_context());
 }
 
 void StatelessRandomUniformLayer::run()
@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -37,8 +38,8 @@ public:
   StatelessRandomUniformLayer();
 
 public:
-  void configure(const IPortableTensor *shape, const IPortableTensor *seed,
-                 IPortableTensor *output);
+  void configure(const IPortableTensor *shape, const IPortableTensor *seed, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void StatelessRandomUniformFloat32();
 
@@ -49,6 +50,8 @@ private:
   const IPortableTensor *_seed;
 
   IPortableTensor *_output;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -77,6 +77,9 @@ void UnpackLayer::configure(const IPortableTensor *input, uint32_t axis, int32_t
 
 void UnpackLayer::run()
 {
+  if (isPlacedInWhole(_input, _outputs))
+    return;
+
   if (_input->data_type() == OperandType::FLOAT32)
     unpackImpl<float>();
   else if (_input->data_type() == OperandType::INT32)
@@ -18,15 +18,22 @@
 #define __ONERT_BACKEND_GPU_CL_BACKEND_H__
 
 #include <backend/Backend.h>
+#include <cl_common/ProgramBinaryCache.h>
+#include <util/ConfigSource.h>
+#include <util/logging.h>
+
 #include <memory>
+#include <vector>
 
 #include "BackendContext.h"
 #include "Config.h"
 #include "TensorRegistry.h"
 #include "KernelGenerator.h"
+#include "KernelTuner.h"
 #include "TensorManager.h"
 #include "TensorBuilder.h"
 
+#include "tensorflow/lite/delegates/gpu/cl/cl_device.h"
 #include "tensorflow/lite/delegates/gpu/cl/environment.h"
 #include "tensorflow/lite/delegates/gpu/common/status.h"
 
@@ -55,12 +62,49 @@ public:
     {
       return nullptr;
     }
+
+    // Programs built by an earlier session, which the program cache of tflite refuses if the
+    // driver has changed since
+    const auto device_id = environment->device().id();
+    auto program_cache = std::make_shared<cl_common::ProgramBinaryCache>(
+      "gpu_cl", tflite::gpu::cl::GetDeviceInfo<std::string>(device_id, CL_DEVICE_NAME),
+      tflite::gpu::cl::GetDeviceInfo<std::string>(device_id, CL_DRIVER_VERSION),
+      environment->device().GetPlatformVersion());
+    std::vector<uint8_t> binaries;
+    if (program_cache->load(binaries) &&
+        !environment->program_cache()
+           ->AddSerializedCache(environment->context(), environment->device(), binaries)
+           .ok())
+    {
+      VERBOSE(gpu_cl) << "Ignore cached programs not matching the device" << std::endl;
+    }
+
+    std::shared_ptr<KernelTuner> kernel_tuner;
+    const auto tuning = util::getConfigString(util::config::GPU_CL_TUNING);
+    if (tuning == "FAST" || tuning == "EXHAUSTIVE")
+    {
+      kernel_tuner = std::make_shared<KernelTuner>(
+        environment.get(),
+        tuning == "FAST" ? tflite::gpu::cl::TuningType::FAST
+                         : tflite::gpu::cl::TuningType::EXHAUSTIVE,
+        cl_common::deviceCacheFile(
+          "clworkgroup", "gpu_cl",
+          tflite::gpu::cl::GetDeviceInfo<std::string>(device_id, CL_DEVICE_NAME),
+          tflite::gpu::cl::GetDeviceInfo<std::string>(device_id, CL_DRIVER_VERSION),
+          environment->device().GetPlatformVersion(), ".txt"));
+    }
+
     auto tm = createTensorManager(&environment->context());
 
     auto tr = std::make_shared<TensorRegistry>(tm);
 
     tflite::gpu::cl::InferenceContext::CreateInferenceInfo create_info;
-    create_info.precision = tflite::gpu::cl::CalculationsPrecision::F32;
+    // FP16_ENABLE stores tensors in float16, which halves the bandwidth, and still accumulates
+    // in float32
+    create_info.precision = util::getConfigBool(util::config::FP16_ENABLE)
+                              ? tflite::gpu::cl::CalculationsPrecision::F32_F16
+                              : tflite::gpu::cl::CalculationsPrecision::F32;
+    // Default of tensors, which BackendContext chooses for each tensor from its consumers
     create_info.storage_type =
       tflite::gpu::cl::GetStorageTypeWithMinimalMemoryConsumption(environment->device().GetInfo());
     create_info.hints.Add(tflite::gpu::cl::ModelHints::kFastestInference);
@@ -74,8 +118,12 @@ public:
     auto tb = std::make_shared<TensorBuilder>(operands, tm, create_info, environment);
     context->tensor_registry = tr;
     context->tensor_builder = tb;
+    context->environment = environment;
+    context->program_cache = program_cache;
+    context->kernel_tuner = kernel_tuner;
 
-    context->kernel_gen = std::make_shared<KernelGenerator>(graph, tb, tr, cc);
+    context->kernel_gen =
+      std::make_shared<KernelGenerator>(graph, tb, tr, cc, create_info.precision, kernel_tuner);
     context->constant_initializer = std::make_shared<ConstantInitializer>(operands, tr);
     return context;
   }
@@ -37,7 +37,31 @@ void BackendContext::registerTensorInfo(const ir::OperandIndex &ind, const ir::O
                                         ir::Layout backend_layout)
 {
   TensorType type = TensorType::TENSOR_TYPE_VALID;
-  tensor_builder->registerTensorInfo(ind, info, backend_layout, type);
+  tensor_builder->registerTensorInfo(ind, info, backend_layout, type, selectStorageType(ind));
+}
+
+tflite::gpu::cl::TensorStorageType
+BackendContext::selectStorageType(const ir::OperandIndex &ind) const
+{
+  // Windowed operations read 2D neighbourhoods of their inputs, which the fastest storage of each
+  // vendor is chosen for, mostly textures. Other operations read each element once, so their
+  // inputs take the storage using the least memory.
+  const auto &device_info = environment->device().GetInfo();
+  for (const auto &use : graph()->operands().at(ind).getUses())
+  {
+    switch (graph()->operations().at(use).opcode())
+    {
+      case ir::OpCode::Conv2D:
+      case ir::OpCode::DepthwiseConv2D:
+      case ir::OpCode::Pool2D:
+      case ir::OpCode::ResizeBilinear:
+      case ir::OpCode::ResizeNearestNeighbor:
+        return tflite::gpu::cl::GetFastestStorageType(device_info);
+      default:
+        break;
+    }
+  }
+  return tflite::gpu::cl::GetStorageTypeWithMinimalMemoryConsumption(device_info);
 }
 
 ITensorRegistry *BackendContext::genTensors()
@@ -65,7 +89,8 @@ ITensorRegistry *BackendContext::genTensors()
     {
       type_map[ind] = TensorType::TENSOR_TYPE_INPUT;
     }
-    tensor_builder->registerTensorInfo(ind, backend_info, backend_layout, type_map[ind]);
+    tensor_builder->registerTensorInfo(ind, backend_info, backend_layout, type_map[ind],
+                                       selectStorageType(ind));
   });
 
   // TODO Get compiler options from compiler, and use it rather than getting it from Env
@@ -86,6 +111,30 @@ ITensorRegistry *BackendContext::genTensors()
   return tensor_registry.get();
 }
 
+FunctionMap BackendContext::genKernels()
+{
+  auto ret = cl_common::BackendContext<TensorBuilder, ConstantInitializer,
+                                       KernelGenerator>::genKernels();
+
+  // Functions have built their programs in prepare, which the next session loads instead
+  if (program_cache && program_cache->enabled())
+  {
+    std::vector<uint8_t> binaries;
+    if (environment->program_cache()->GetSerializedCache(environment->device(), &binaries).ok())
+    {
+      program_cache->store(binaries);
+    }
+  }
+
+  // Work groups are tuned in prepare as well
+  if (kernel_tuner)
+  {
+    kernel_tuner->store();
+  }
+
+  return ret;
+}
+
 } // namespace gpu_cl
 } // namespace backend
 } // namespace onert
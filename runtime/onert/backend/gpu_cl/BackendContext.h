@@ -21,10 +21,13 @@
 #include <util/ConfigSource.h>
 
 #include <cl_common/BackendContext.h>
+#include <cl_common/ProgramBinaryCache.h>
 
 #include "ConstantInitializer.h"
 #include "KernelGenerator.h"
+#include "KernelTuner.h"
 #include "TensorBuilder.h"
+#include "tensorflow/lite/delegates/gpu/cl/environment.h"
 #include "tensorflow/lite/delegates/gpu/cl/inference_context.h"
 
 namespace onert
@@ -52,10 +55,23 @@ public:
   }
 
   ITensorRegistry *genTensors() override;
+  FunctionMap genKernels() override;
 
 protected:
   void registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
                           ir::Layout backend_layout) override;
+
+private:
+  /**
+   * @brief Get the storage of a tensor, depending on the operations reading it
+   */
+  tflite::gpu::cl::TensorStorageType selectStorageType(const ir::OperandIndex &ind) const;
+
+public:
+  // TODO Make it private
+  std::shared_ptr<tflite::gpu::cl::Environment> environment;
+  std::shared_ptr<cl_common::ProgramBinaryCache> program_cache;
+  std::shared_ptr<KernelTuner> kernel_tuner;
 };
 
 } // namespace gpu_cl
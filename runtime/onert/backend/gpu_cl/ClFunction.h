@@ -21,6 +21,9 @@
 
 #include <vector>
 #include <memory>
+#include <string>
+
+#include "KernelTuner.h"
 
 #include "tensorflow/lite/delegates/gpu/cl/kernels/gpu_operation.h"
 #include "tensorflow/lite/delegates/gpu/cl/cl_command_queue.h"
@@ -43,6 +46,16 @@ public:
     _creation_context = creation_context;
   }
 
+  /**
+   * @brief Tune work groups of the operations in prepare
+   * @param key Key of the output shape, which the operations write
+   */
+  void tuner(std::shared_ptr<KernelTuner> tuner, const std::string &key)
+  {
+    _tuner = tuner;
+    _tuning_key = key;
+  }
+
   void add_operation(std::unique_ptr<tflite::gpu::cl::GPUOperation> gpu_operation)
   {
     _gpu_operations.push_back(std::move(gpu_operation));
@@ -76,12 +89,19 @@ public:
       {
         throw std::runtime_error("Failed to UpdateParams.");
       }
+
+      if (_tuner && !_tuner->tune(_tuning_key, *gpu_operation).ok())
+      {
+        throw std::runtime_error("Failed to Tune.");
+      }
     }
   }
 
 private:
   std::vector<std::unique_ptr<tflite::gpu::cl::GPUOperation>> _gpu_operations;
   std::shared_ptr<tflite::gpu::cl::CreationContext> _creation_context;
+  std::shared_ptr<KernelTuner> _tuner;
+  std::string _tuning_key;
 };
 
 } // namespace gpu_cl
@@ -22,10 +22,13 @@
 #include "ClFunction.h"
 #include "TensorManager.h"
 
+#include "tensorflow/lite/delegates/gpu/common/operations.h"
 #include "tensorflow/lite/delegates/gpu/common/shape.h"
 #include "tensorflow/lite/delegates/gpu/cl/tensor.h"
+#include "tensorflow/lite/delegates/gpu/cl/kernels/elementwise.h"
 #include "tensorflow/lite/delegates/gpu/cl/selectors/convolution_selector.h"
 #include "tensorflow/lite/delegates/gpu/cl/selectors/dw_convolution_selector.h"
+#include "tensorflow/lite/delegates/gpu/cl/selectors/fully_connected_selector.h"
 #include "tensorflow/lite/delegates/gpu/cl/selectors/simple_selectors.h"
 
 #include "ir/Operations.h"
@@ -77,13 +80,76 @@ PoolingType convertPoolType(ir::operation::Pool2D::PoolType type_ir)
   }
 }
 
+// Slot of an axis in BHWC, the way MemoryManager lays out a tensor of each rank
+int ToBHWCSlot(int32_t rank, int32_t axis)
+{
+  static const int slots[4][4] = {{0}, {0, 3}, {0, 2, 3}, {0, 1, 2, 3}};
+  if (axis < 0)
+    axis += rank;
+  if (rank < 1 || rank > 4 || axis < 0 || axis >= rank)
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported axis");
+  return slots[rank - 1][axis];
+}
+
+Axis ToAxis(int32_t rank, int32_t axis)
+{
+  static const Axis axes[4] = {Axis::BATCH, Axis::HEIGHT, Axis::WIDTH, Axis::CHANNELS};
+  return axes[ToBHWCSlot(rank, axis)];
+}
+
+// Link the activation into gpu_op, so that it runs on the result before it leaves the kernel
+void FuseActivation(ir::Activation activation, const TensorDescriptor &descriptor,
+                    GPUOperation *gpu_op)
+{
+  OperationDef op_def;
+  op_def.precision = gpu_op->GetDefinition().precision;
+  op_def.src_tensors.push_back(descriptor);
+  op_def.dst_tensors.push_back(descriptor);
+
+  std::unique_ptr<GPUOperation> act_op;
+  switch (activation)
+  {
+    case ir::Activation::NONE:
+      return;
+    case ir::Activation::RELU:
+    case ir::Activation::RELU6:
+    {
+      //   - ReLU: clip = 0, alpha = 0
+      //   - ReLU6: clip = 6, alpha = 0
+      ReLUAttributes attr;
+      attr.clip = activation == ir::Activation::RELU6 ? 6 : 0;
+      attr.alpha = 0;
+      act_op = SelectReLU(attr, op_def);
+      break;
+    }
+    case ir::Activation::TANH:
+      act_op =
+        std::make_unique<GPUOperation>(CreateElementwiseOneInput(op_def, OperationType::TANH));
+      break;
+    case ir::Activation::SIGMOID:
+      act_op =
+        std::make_unique<GPUOperation>(CreateElementwiseOneInput(op_def, OperationType::SIGMOID));
+      break;
+    default:
+      throw std::runtime_error("gpu_cl KernelGenerator : Not supported activation yet");
+  }
+
+  if (!gpu_op->AddOperation(act_op.get()).ok())
+  {
+    throw std::runtime_error("Failed to AddOperation.");
+  }
+}
+
 KernelGenerator::KernelGenerator(const ir::Graph &graph,
                                  const std::shared_ptr<TensorBuilder> &tensor_builder,
                                  const std::shared_ptr<TensorRegistry> &tensor_reg,
-                                 const std::shared_ptr<CreationContext> &creation_context)
+                                 const std::shared_ptr<CreationContext> &creation_context,
+                                 CalculationsPrecision precision,
+                                 const std::shared_ptr<KernelTuner> &tuner)
   : basic::KernelGeneratorBase{graph}, _ctx(graph.operands()),
     _operations_ctx(graph.operations()), _current_layout{graph.layout()},
-    _tensor_builder(tensor_builder), _tensor_reg(tensor_reg), _creation_context(creation_context)
+    _tensor_builder(tensor_builder), _tensor_reg(tensor_reg), _creation_context(creation_context),
+    _precision(precision), _tuner(tuner)
 {
 }
 
@@ -98,70 +164,173 @@ std::unique_ptr<exec::FunctionSequence> KernelGenerator::generate(ir::OperationI
   return ret;
 }
 
-void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
+void KernelGenerator::returnOperation(const ir::OperandIndex &output,
+                                      std::unique_ptr<GPUOperation> gpu_op)
 {
-  const auto ofm_index{node.getOutputs().at(0)};
-  const auto lhs_index{node.getInputs().at(ir::operation::BinaryArithmetic::Input::LHS)};
-  const auto rhs_index{node.getInputs().at(ir::operation::BinaryArithmetic::Input::RHS)};
+  gpu_op->SetDst(_tensor_reg->getClTensor(output)->handle(), 0);
+  _producers[output] = gpu_op.get();
 
-  // const auto activation = node.param().activation;
+  auto fn = std::make_unique<ClFunction>();
+  fn->configure(_creation_context);
+  fn->add_operation(std::move(gpu_op));
+  if (_tuner)
+  {
+    // Operations linked later write the output in the same shape
+    const auto &shape = _tensor_reg->getClTensorReserver(output)->shape;
+    fn->tuner(_tuner, std::to_string(shape.b) + "x" + std::to_string(shape.h) + "x" +
+                        std::to_string(shape.w) + "x" + std::to_string(shape.c));
+  }
+  _return_fn = std::move(fn);
+}
 
-  OperationDef op_def;
-  op_def.precision = CalculationsPrecision::F32;
+GPUOperation *KernelGenerator::linkToProducer(const ir::OperandIndex &input,
+                                              const ir::OperandIndex &output,
+                                              GPUOperation *gpu_op, const ir::OperandIndex &second)
+{
+  auto it = _producers.find(input);
+  if (it == _producers.end())
+    return nullptr;
 
-  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(lhs_index)->descriptor);
-  auto lhs_shape = _tensor_reg->getClTensorReserver(lhs_index)->shape;
+  // The input is never written once linked, so nothing else may read it
+  if (_ctx.at(input).getUses().size() != 1 || _graph.getOutputs().contains(input))
+    return nullptr;
 
-  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(rhs_index)->descriptor);
-  auto rhs_shape = _tensor_reg->getClTensorReserver(rhs_index)->shape;
+  // The producer runs before this operation would, when only constants are sure to be ready
+  if (second.valid() && !_ctx.at(second).isConstant())
+    return nullptr;
 
-  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(ofm_index)->descriptor);
-  auto out_shape = _tensor_reg->getClTensorReserver(ofm_index)->shape;
+  // The producer writes the output in place of the input, which requires the same tensor layout
+  if (!(*_tensor_reg->getClTensorReserver(input) == *_tensor_reg->getClTensorReserver(output)))
+    return nullptr;
 
-  auto fn = std::make_unique<ClFunction>();
+  auto producer = it->second;
+  if (!producer->AddOperation(gpu_op).ok())
+  {
+    throw std::runtime_error("Failed to AddOperation.");
+  }
+  if (second.valid())
+  {
+    producer->SetSrc(_tensor_reg->getClTensor(second)->handle(),
+                     producer->GetDefinition().src_tensors.size() - 1);
+  }
+  producer->SetDst(_tensor_reg->getClTensor(output)->handle(), 0);
 
-  std::unique_ptr<GPUOperation> gpu_op;
+  _producers.erase(it);
+  _producers[output] = producer;
+  return producer;
+}
+
+void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  auto lhs_index{node.getInputs().at(ir::operation::BinaryArithmetic::Input::LHS)};
+  auto rhs_index{node.getInputs().at(ir::operation::BinaryArithmetic::Input::RHS)};
+
+  auto lhs_shape = _tensor_reg->getClTensorReserver(lhs_index)->shape;
+  auto rhs_shape = _tensor_reg->getClTensorReserver(rhs_index)->shape;
+  auto out_shape = _tensor_reg->getClTensorReserver(ofm_index)->shape;
+
+  OperationType op_type;
   switch (node.param().arithmetic_type)
   {
     case ir::operation::BinaryArithmetic::ArithmeticType::ADD:
-    {
-      std::vector<int> channels(2);
-      channels[0] = lhs_shape.c;
-      channels[1] = rhs_shape.c;
-      SelectAdd(op_def, channels, out_shape.c, &gpu_op);
-
-      auto ofm_tensor = _tensor_reg->getClTensor(ofm_index);
-      auto lhs_tensor = _tensor_reg->getClTensor(lhs_index);
-      auto rhs_tensor = _tensor_reg->getClTensor(rhs_index);
-      gpu_op->SetSrc(lhs_tensor->handle(), ir::operation::BinaryArithmetic::Input::LHS);
-      gpu_op->SetSrc(rhs_tensor->handle(), ir::operation::BinaryArithmetic::Input::RHS);
-      gpu_op->SetDst(ofm_tensor->handle(), 0);
-
-      fn->configure(_creation_context);
-      fn->add_operation(std::move(gpu_op));
+      op_type = OperationType::ADD;
       break;
-    }
     case ir::operation::BinaryArithmetic::ArithmeticType::SUB:
-    {
-      // NYI
+      op_type = OperationType::SUB;
       break;
-    }
     case ir::operation::BinaryArithmetic::ArithmeticType::MUL:
-    {
-      // NYI
+      op_type = OperationType::MUL;
       break;
-    }
     case ir::operation::BinaryArithmetic::ArithmeticType::DIV:
-    {
-      // NYI
+      op_type = OperationType::DIV;
       break;
-    }
     default:
-      assert(false && "The BinaryArithmetic operation supports only binary arithmetic operations");
-      break;
+      throw std::runtime_error("gpu_cl KernelGenerator : Not supported operation yet");
   }
 
-  _return_fn = std::move(fn);
+  // Only the second input broadcasts, which a commutative operation gets by swapping its inputs
+  const bool commutative = op_type == OperationType::ADD || op_type == OperationType::MUL;
+  if (lhs_shape != out_shape && commutative)
+  {
+    std::swap(lhs_index, rhs_index);
+    std::swap(lhs_shape, rhs_shape);
+  }
+  if (lhs_shape != out_shape)
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported broadcast of the first input");
+  }
+
+  OperationDef op_def;
+  op_def.precision = _precision;
+
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(lhs_index)->descriptor);
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(rhs_index)->descriptor);
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(ofm_index)->descriptor);
+
+  std::unique_ptr<GPUOperation> gpu_op;
+  if (op_type == OperationType::ADD && rhs_shape == out_shape)
+  {
+    std::vector<int> channels(2);
+    channels[0] = lhs_shape.c;
+    channels[1] = rhs_shape.c;
+    SelectAdd(op_def, channels, out_shape.c, &gpu_op);
+  }
+  else
+  {
+    gpu_op = std::make_unique<GPUOperation>(CreateElementwiseTwoInput(op_def, op_type, rhs_shape));
+  }
+
+  const auto &ofm_descriptor = _tensor_reg->getClTensorReserver(ofm_index)->descriptor;
+  if (auto producer = linkToProducer(lhs_index, ofm_index, gpu_op.get(), rhs_index))
+  {
+    FuseActivation(node.param().activation, ofm_descriptor, producer);
+    _return_fn = std::make_unique<exec::NopFunction>();
+    return;
+  }
+
+  auto lhs_tensor = _tensor_reg->getClTensor(lhs_index);
+  auto rhs_tensor = _tensor_reg->getClTensor(rhs_index);
+  gpu_op->SetSrc(lhs_tensor->handle(), ir::operation::BinaryArithmetic::Input::LHS);
+  gpu_op->SetSrc(rhs_tensor->handle(), ir::operation::BinaryArithmetic::Input::RHS);
+  FuseActivation(node.param().activation, ofm_descriptor, gpu_op.get());
+
+  returnOperation(ofm_index, std::move(gpu_op));
+}
+
+void KernelGenerator::visit(const ir::operation::Concat &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto rank = _ctx.at(output_index).shape().rank();
+
+  OperationDef op_def;
+  op_def.precision = _precision;
+
+  std::vector<int> channels;
+  for (const auto &input_index : node.getInputs())
+  {
+    const auto reserver = _tensor_reg->getClTensorReserver(input_index);
+    op_def.src_tensors.push_back(reserver->descriptor);
+    channels.push_back(reserver->shape.c);
+  }
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
+
+  ConcatAttributes attr;
+  attr.axis = ToAxis(rank, node.param().axis);
+
+  std::unique_ptr<GPUOperation> gpu_op;
+  if (!SelectConcat(attr, channels, op_def, _creation_context->GetDeviceInfo(), &gpu_op).ok())
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported Concat");
+  }
+
+  for (uint32_t i = 0; i < node.getInputs().size(); ++i)
+  {
+    auto input_tensor = _tensor_reg->getClTensor(node.getInputs().at(i));
+    gpu_op->SetSrc(input_tensor->handle(), i);
+  }
+
+  returnOperation(output_index, std::move(gpu_op));
 }
 
 void KernelGenerator::visit(const ir::operation::Conv2D &node)
@@ -175,7 +344,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   const auto param = node.param();
 
   OperationDef op_def;
-  op_def.precision = CalculationsPrecision::F32;
+  op_def.precision = _precision;
 
   op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input)->descriptor);
 
@@ -192,7 +361,6 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   auto input_tensor = _tensor_reg->getClTensor(input);
   auto kernel_tensor = _tensor_reg->getClTensor(kernel);
   auto bias_tensor = _tensor_reg->getClTensor(bias);
-  auto output_tensor = _tensor_reg->getClTensor(output);
 
   Convolution2DAttributes attr;
   attr.strides = ToHW(param.stride.vertical, param.stride.horizontal);
@@ -223,58 +391,10 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   gpu_op = SelectConvolution(attr, output_shape, _creation_context->GetDeviceInfo(), op_def, hints);
   gpu_op->SetSrc(input_tensor->handle(), ir::operation::Conv2D::INPUT);
 
-  auto fn = std::make_unique<ClFunction>();
-
-  fn->configure(_creation_context);
-
-  const auto activation = node.param().activation;
-
-  switch (activation)
-  {
-    case ir::Activation::NONE:
-    {
-      gpu_op->SetDst(output_tensor->handle(), 0);
-      fn->add_operation(std::move(gpu_op));
-      break;
-    }
-    case ir::Activation::RELU6:
-    {
-      std::unique_ptr<GPUOperation> gpu_op_1;
-      OperationDef op_def_1;
-      std::shared_ptr<cl::Tensor> new_tensor = std::make_shared<cl::Tensor>();
-
-      _new_tensors[output] = new_tensor;
-      if (!CreateTensor(*_creation_context->context, output_shape,
-                        _tensor_reg->getClTensorReserver(output)->descriptor, new_tensor.get())
-             .ok())
-      {
-        throw std::runtime_error("Error CreateTensor.");
-      }
-
-      gpu_op->SetDst(new_tensor.get(), 0);
-      fn->add_operation(std::move(gpu_op));
-      op_def_1.precision = CalculationsPrecision::F32;
-      op_def_1.src_tensors.push_back(_tensor_reg->getClTensorReserver(output)->descriptor);
-      op_def_1.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output)->descriptor);
-
-      //   - ReLU6: clip = 6, alpha = 0
-      ReLUAttributes attr_1;
-      attr_1.clip = 6;
-      attr_1.alpha = 0;
-      gpu_op_1 = SelectReLU(attr_1, op_def_1);
-
-      gpu_op_1->SetSrc(new_tensor.get(), 0);
-      gpu_op_1->SetDst(output_tensor->handle(), 0);
-      fn->add_operation(std::move(gpu_op_1));
-      break;
-    }
-    default:
-    {
-      throw std::runtime_error("gpu_cl KernelGenerator : Not supported operation yet");
-    }
-  }
+  FuseActivation(param.activation, _tensor_reg->getClTensorReserver(output)->descriptor,
+                 gpu_op.get());
 
-  _return_fn = std::move(fn);
+  returnOperation(output, std::move(gpu_op));
 }
 
 void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
@@ -292,14 +412,13 @@ void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
 
   const auto multiplier = node.param().multiplier;
 
-  auto ofm_tensor = _tensor_reg->getClTensor(ofm_index);
   auto ifm_tensor = _tensor_reg->getClTensor(ifm_index);
   auto ker_tensor = _tensor_reg->getClTensor(ker_index);
   auto bias_tensor = _tensor_reg->getClTensor(bias_index);
 
   bool is_weight = (_ctx.at(ker_index).isConstant() ? true : false);
   OperationDef op_def;
-  op_def.precision = CalculationsPrecision::F32;
+  op_def.precision = _precision;
 
   op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(ifm_index)->descriptor);
   auto input_shape = _tensor_reg->getClTensorReserver(ifm_index)->shape;
@@ -356,7 +475,6 @@ void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
     attr.weights = std::move(weights);
   }
 
-  auto fn = std::make_unique<ClFunction>();
   std::unique_ptr<GPUOperation> gpu_op;
 
   if (is_weight)
@@ -375,79 +493,28 @@ void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
 
   gpu_op->SetSrc(ifm_tensor->handle(), ir::operation::DepthwiseConv2D::Input::INPUT);
 
-  fn->configure(_creation_context);
-
-  const auto activation = node.param().activation;
-
-  switch (activation)
-  {
-    case ir::Activation::NONE:
-    {
-      gpu_op->SetDst(ofm_tensor->handle(), 0);
-      fn->add_operation(std::move(gpu_op));
-      break;
-    }
-    case ir::Activation::RELU6:
-    {
-      std::unique_ptr<GPUOperation> gpu_op_1;
-      OperationDef op_def_1;
-      std::shared_ptr<cl::Tensor> new_tensor = std::make_shared<cl::Tensor>();
-
-      _new_tensors[ofm_index] = new_tensor;
-      if (!CreateTensor(*_creation_context->context, out_shape,
-                        _tensor_reg->getClTensorReserver(ofm_index)->descriptor, new_tensor.get())
-             .ok())
-      {
-        throw std::runtime_error("Error CreateTensor.");
-      }
-
-      gpu_op->SetDst(new_tensor.get(), 0);
-      fn->add_operation(std::move(gpu_op));
-      op_def_1.precision = CalculationsPrecision::F32;
-      op_def_1.src_tensors.push_back(_tensor_reg->getClTensorReserver(ofm_index)->descriptor);
-      op_def_1.dst_tensors.push_back(_tensor_reg->getClTensorReserver(ofm_index)->descriptor);
-
-      //   - ReLU6: clip = 6, alpha = 0
-      ReLUAttributes attr_1;
-      attr_1.clip = 6;
-      attr_1.alpha = 0;
-      gpu_op_1 = SelectReLU(attr_1, op_def_1);
-
-      gpu_op_1->SetSrc(new_tensor.get(), 0);
-      gpu_op_1->SetDst(ofm_tensor->handle(), 0);
-      fn->add_operation(std::move(gpu_op_1));
-      break;
-    }
-    default:
-    {
-      throw std::runtime_error("gpu_cl KernelGenerator : Not supported operation yet");
-    }
-  }
+  FuseActivation(node.param().activation,
+                 _tensor_reg->getClTensorReserver(ofm_index)->descriptor, gpu_op.get());
 
-  _return_fn = std::move(fn);
+  returnOperation(ofm_index, std::move(gpu_op));
 }
 
 void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
 {
-  std::unique_ptr<GPUOperation> gpu_op;
-  auto fn = std::make_unique<ClFunction>();
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::ElementwiseActivation::Input::INPUT)};
 
+  OperationDef op_def;
+  op_def.precision = _precision;
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
+
+  std::unique_ptr<GPUOperation> gpu_op;
   switch (node.param().op_type)
   {
     case ir::operation::ElementwiseActivation::Type::LEAKY_RELU:
     case ir::operation::ElementwiseActivation::Type::RELU:
     {
-      const auto output_index{node.getOutputs().at(0)};
-      const auto input_index{
-        node.getInputs().at(ir::operation::ElementwiseActivation::Input::INPUT)};
-
-      OperationDef op_def;
-      op_def.precision = CalculationsPrecision::F32;
-      auto output_tensor = _tensor_reg->getClTensor(output_index);
-      auto input_tensor = _tensor_reg->getClTensor(input_index);
-      op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
-      op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
-
       ReLUAttributes attr;
       if (ir::operation::ElementwiseActivation::Type::LEAKY_RELU == node.param().op_type)
       {
@@ -460,17 +527,135 @@ void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
         attr.clip = node.param().alpha;
       }
       gpu_op = SelectReLU(attr, op_def);
-      gpu_op->SetSrc(input_tensor->handle(), ir::operation::ElementwiseActivation::Input::INPUT);
-      gpu_op->SetDst(output_tensor->handle(), 0);
-      fn->configure(_creation_context);
-      fn->add_operation(std::move(gpu_op));
-
-      _return_fn = std::move(fn);
       break;
     }
+    case ir::operation::ElementwiseActivation::Type::LOGISTIC:
+      gpu_op =
+        std::make_unique<GPUOperation>(CreateElementwiseOneInput(op_def, OperationType::SIGMOID));
+      break;
+    case ir::operation::ElementwiseActivation::Type::TANH:
+      gpu_op =
+        std::make_unique<GPUOperation>(CreateElementwiseOneInput(op_def, OperationType::TANH));
+      break;
     default:
       throw std::runtime_error("gpu_cl KernelGenerator : Not supported operation yet");
   }
+
+  if (linkToProducer(input_index, output_index, gpu_op.get()))
+  {
+    _return_fn = std::make_unique<exec::NopFunction>();
+    return;
+  }
+
+  auto input_tensor = _tensor_reg->getClTensor(input_index);
+  gpu_op->SetSrc(input_tensor->handle(), ir::operation::ElementwiseActivation::Input::INPUT);
+
+  returnOperation(output_index, std::move(gpu_op));
+}
+
+void KernelGenerator::visit(const ir::operation::FullyConnected &node)
+{
+  using ir::operation::FullyConnected;
+
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(FullyConnected::Input::INPUT)};
+  const auto weight_index{node.getInputs().at(FullyConnected::Input::WEIGHT)};
+  const auto bias_index{node.getInputs().at(FullyConnected::Input::BIAS)};
+
+  const auto &weight = _ctx.at(weight_index);
+  if (!weight.isConstant() || weight.typeInfo().type() != ir::DataType::FLOAT32 ||
+      (bias_index.valid() && !_ctx.at(bias_index).isConstant()))
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported FullyConnected weights");
+  }
+
+  // Weights are [num_units, input_size], and the kernel takes a row of the input per batch
+  const auto num_units = weight.shape().dim(0);
+  const auto input_size = weight.shape().dim(1);
+  const auto input_shape = _tensor_reg->getClTensorReserver(input_index)->shape;
+  if (input_shape.h != 1 || input_shape.w != 1 || input_shape.c != input_size)
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported FullyConnected input shape");
+  }
+
+  FullyConnectedAttributes attr;
+  attr.weights.id = weight_index.value();
+  attr.weights.shape = OHWI(num_units, 1, 1, input_size);
+  attr.weights.data.resize(attr.weights.shape.DimensionsProduct());
+  memcpy(attr.weights.data.data(), weight.data()->base(), attr.weights.data.size() * sizeof(float));
+
+  attr.bias.shape = Linear(num_units);
+  attr.bias.data.resize(num_units, 0.f);
+  if (bias_index.valid())
+  {
+    attr.bias.id = bias_index.value();
+    memcpy(attr.bias.data.data(), _ctx.at(bias_index).data()->base(),
+           attr.bias.data.size() * sizeof(float));
+  }
+
+  OperationDef op_def;
+  op_def.precision = _precision;
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
+
+  auto gpu_op =
+    SelectFullyConnected(attr, _creation_context->GetDeviceInfo(), op_def, input_shape.b);
+
+  auto input_tensor = _tensor_reg->getClTensor(input_index);
+  gpu_op->SetSrc(input_tensor->handle(), FullyConnected::Input::INPUT);
+  FuseActivation(node.param().activation,
+                 _tensor_reg->getClTensorReserver(output_index)->descriptor, gpu_op.get());
+
+  returnOperation(output_index, std::move(gpu_op));
+}
+
+void KernelGenerator::visit(const ir::operation::Pad &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::Pad::Input::INPUT)};
+  const auto pad_index{node.getInputs().at(ir::operation::Pad::Input::PAD)};
+
+  // The kernel pads with zeros only
+  if (node.getInputs().size() > ir::operation::Pad::Input::VALUE)
+  {
+    const auto &value = _ctx.at(node.getInputs().at(ir::operation::Pad::Input::VALUE));
+    if (!value.isConstant() || value.asScalar<float>() != 0.f)
+    {
+      throw std::runtime_error("gpu_cl KernelGenerator : Not supported Pad value");
+    }
+  }
+  if (!_ctx.at(pad_index).isConstant())
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported non-constant paddings");
+  }
+
+  const auto rank = _ctx.at(input_index).shape().rank();
+  const auto pads = _ctx.at(pad_index).asVector<int32_t>();
+  assert(pads.size() == static_cast<size_t>(rank) * 2);
+
+  PadAttributes attr;
+  attr.type = PaddingContentType::ZEROS;
+  attr.prepended = BHWC(0, 0, 0, 0);
+  attr.appended = BHWC(0, 0, 0, 0);
+  for (int32_t i = 0; i < rank; ++i)
+  {
+    const auto axis = ToAxis(rank, i);
+    attr.prepended.set(axis, pads[i * 2]);
+    attr.appended.set(axis, pads[i * 2 + 1]);
+  }
+
+  OperationDef op_def;
+  op_def.precision = _precision;
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
+
+  std::unique_ptr<GPUOperation> gpu_op;
+  SelectPadding(attr, op_def, &gpu_op);
+
+  auto input_tensor = _tensor_reg->getClTensor(input_index);
+  gpu_op->SetSrc(input_tensor->handle(), ir::operation::Pad::Input::INPUT);
+
+  returnOperation(output_index, std::move(gpu_op));
 }
 
 void KernelGenerator::visit(const ir::operation::Pool2D &node)
@@ -479,7 +664,7 @@ void KernelGenerator::visit(const ir::operation::Pool2D &node)
   const auto input_index{node.getInputs().at(ir::operation::Pool2D::Input::INPUT)};
 
   OperationDef op_def;
-  op_def.precision = CalculationsPrecision::F32;
+  op_def.precision = _precision;
 
   op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
   auto input_shape = _tensor_reg->getClTensorReserver(input_index)->shape;
@@ -507,20 +692,52 @@ void KernelGenerator::visit(const ir::operation::Pool2D &node)
     attributes.padding.appended = HW(0, 0);
   }
 
-  auto fn = std::make_unique<ClFunction>();
   std::unique_ptr<GPUOperation> gpu_op;
   gpu_op = SelectPooling(attributes, op_def);
 
   auto input_tensor = _tensor_reg->getClTensor(input_index);
-  auto output_tensor = _tensor_reg->getClTensor(output_index);
 
   gpu_op->SetSrc(input_tensor->handle(), ir::operation::Pool2D::Input::INPUT);
-  gpu_op->SetDst(output_tensor->handle(), 0);
+  FuseActivation(node.param().activation,
+                 _tensor_reg->getClTensorReserver(output_index)->descriptor, gpu_op.get());
 
-  fn->configure(_creation_context);
-  fn->add_operation(std::move(gpu_op));
+  returnOperation(output_index, std::move(gpu_op));
+}
 
-  _return_fn = std::move(fn);
+void KernelGenerator::visit(const ir::operation::Reduce &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::Reduce::Input::INPUT)};
+  const auto axes_index{node.getInputs().at(ir::operation::Reduce::Input::AXES)};
+
+  if (node.param().reduce_type != ir::operation::Reduce::ReduceType::MEAN ||
+      !_ctx.at(axes_index).isConstant())
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported Reduce");
+  }
+
+  const auto rank = _ctx.at(input_index).shape().rank();
+  MeanAttributes attr;
+  for (const auto axis : _ctx.at(axes_index).asVector<int32_t>())
+  {
+    attr.dims.insert(ToAxis(rank, axis));
+  }
+
+  OperationDef op_def;
+  op_def.precision = _precision;
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
+
+  std::unique_ptr<GPUOperation> gpu_op;
+  if (!SelectMean(attr, op_def, _creation_context->GetDeviceInfo(), &gpu_op).ok())
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported Mean axes");
+  }
+
+  auto input_tensor = _tensor_reg->getClTensor(input_index);
+  gpu_op->SetSrc(input_tensor->handle(), ir::operation::Reduce::Input::INPUT);
+
+  returnOperation(output_index, std::move(gpu_op));
 }
 
 void KernelGenerator::visit(const ir::operation::Reshape &node)
@@ -529,7 +746,7 @@ void KernelGenerator::visit(const ir::operation::Reshape &node)
   const auto input_index{node.getInputs().at(ir::operation::Reshape::Input::INPUT)};
 
   OperationDef op_def;
-  op_def.precision = CalculationsPrecision::F32;
+  op_def.precision = _precision;
 
   op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
   auto input_shape = _tensor_reg->getClTensorReserver(input_index)->shape;
@@ -540,20 +757,57 @@ void KernelGenerator::visit(const ir::operation::Reshape &node)
   ReshapeAttributes attr;
   attr.new_shape = output_shape;
 
-  auto fn = std::make_unique<ClFunction>();
   std::unique_ptr<GPUOperation> gpu_op;
   const int src_channels = input_shape.c;
   SelectReshape(src_channels, attr.new_shape.c, op_def, &gpu_op);
 
   auto input_tensor = _tensor_reg->getClTensor(input_index);
-  auto output_tensor = _tensor_reg->getClTensor(output_index);
   gpu_op->SetSrc(input_tensor->handle(), ir::operation::Reshape::Input::INPUT);
-  gpu_op->SetDst(output_tensor->handle(), 0);
 
-  fn->configure(_creation_context);
-  fn->add_operation(std::move(gpu_op));
+  returnOperation(output_index, std::move(gpu_op));
+}
 
-  _return_fn = std::move(fn);
+void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
+{
+  genResize(node.getInputs().at(ir::operation::ResizeBilinear::Input::INPUT),
+            node.getOutputs().at(0), SamplingType::BILINEAR, node.param().align_corners,
+            node.param().half_pixel_centers);
+}
+
+void KernelGenerator::visit(const ir::operation::ResizeNearestNeighbor &node)
+{
+  genResize(node.getInputs().at(ir::operation::ResizeNearestNeighbor::Input::INPUT),
+            node.getOutputs().at(0), SamplingType::NEAREST, node.param().align_corners, false);
+}
+
+void KernelGenerator::genResize(const ir::OperandIndex &input_index,
+                                const ir::OperandIndex &output_index, SamplingType type,
+                                bool align_corners, bool half_pixel_centers)
+{
+  // The output is sized already, whether from the parameters or from the SIZE input
+  const auto output_shape = _tensor_reg->getClTensorReserver(output_index)->shape;
+
+  Resize2DAttributes attr;
+  attr.new_shape = HW(output_shape.h, output_shape.w);
+  attr.type = type;
+  attr.align_corners = align_corners;
+  attr.half_pixel_centers = half_pixel_centers;
+
+  OperationDef op_def;
+  op_def.precision = _precision;
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
+
+  std::unique_ptr<GPUOperation> gpu_op;
+  if (!SelectResize(attr, op_def, &gpu_op).ok())
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported Resize");
+  }
+
+  auto input_tensor = _tensor_reg->getClTensor(input_index);
+  gpu_op->SetSrc(input_tensor->handle(), 0);
+
+  returnOperation(output_index, std::move(gpu_op));
 }
 
 void KernelGenerator::visit(const ir::operation::Softmax &node)
@@ -569,27 +823,62 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
   }
 
   OperationDef op_def;
-  op_def.precision = CalculationsPrecision::F32;
+  op_def.precision = _precision;
 
   op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
 
   op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
   auto input_shape = _tensor_reg->getClTensorReserver(input_index)->shape;
 
-  auto fn = std::make_unique<ClFunction>();
-
   std::unique_ptr<GPUOperation> gpu_op;
   SelectSoftmax(input_shape, op_def, &gpu_op);
-  auto output_tensor = _tensor_reg->getClTensor(output_index);
   auto input_tensor = _tensor_reg->getClTensor(input_index);
 
   gpu_op->SetSrc(input_tensor->handle(), ir::operation::Softmax::Input::INPUT);
-  gpu_op->SetDst(output_tensor->handle(), 0);
 
-  fn->configure(_creation_context);
-  fn->add_operation(std::move(gpu_op));
+  returnOperation(output_index, std::move(gpu_op));
+}
 
-  _return_fn = std::move(fn);
+void KernelGenerator::visit(const ir::operation::Transpose &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(ir::operation::Transpose::Input::INPUT)};
+  const auto perm_index{node.getInputs().at(ir::operation::Transpose::Input::PERMUTATION)};
+
+  if (!_ctx.at(perm_index).isConstant())
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported non-constant permutation");
+  }
+
+  const auto rank = _ctx.at(input_index).shape().rank();
+  const auto perm = _ctx.at(perm_index).asVector<int32_t>();
+  if (perm.size() != static_cast<size_t>(rank))
+  {
+    throw std::runtime_error("gpu_cl KernelGenerator : Not supported permutation");
+  }
+
+  // Slots of BHWC a lower rank leaves out keep their place, as they are 1 on both sides
+  int32_t src_slots[4] = {0, 1, 2, 3};
+  for (int32_t i = 0; i < rank; ++i)
+  {
+    src_slots[ToBHWCSlot(rank, i)] = ToBHWCSlot(rank, perm[i]);
+  }
+
+  TransposeAttributes attr;
+  attr.perm = BHWC(src_slots[0], src_slots[1], src_slots[2], src_slots[3]);
+
+  OperationDef op_def;
+  op_def.precision = _precision;
+  op_def.src_tensors.push_back(_tensor_reg->getClTensorReserver(input_index)->descriptor);
+  op_def.dst_tensors.push_back(_tensor_reg->getClTensorReserver(output_index)->descriptor);
+
+  std::unique_ptr<GPUOperation> gpu_op;
+  SelectTranspose(attr, op_def, &gpu_op);
+
+  auto input_tensor = _tensor_reg->getClTensor(input_index);
+  gpu_op->SetSrc(input_tensor->handle(), ir::operation::Transpose::Input::INPUT);
+
+  returnOperation(output_index, std::move(gpu_op));
 }
 
 } // namespace gpu_cl
@@ -21,8 +21,11 @@
 #include "backend/basic/TensorRegistry.h"
 #include "TensorBuilder.h"
 #include "TensorManager.h"
+#include "KernelTuner.h"
 
 #include "tensorflow/lite/delegates/gpu/api.h"
+#include "tensorflow/lite/delegates/gpu/cl/kernels/gpu_operation.h"
+#include "tensorflow/lite/delegates/gpu/common/operations.h"
 
 #include <backend/CustomKernelBuilder.h>
 #include <backend/basic/KernelGeneratorBase.h>
@@ -42,18 +45,49 @@ class KernelGenerator : public basic::KernelGeneratorBase
 public:
   KernelGenerator(const ir::Graph &graph, const std::shared_ptr<TensorBuilder> &tensor_builder,
                   const std::shared_ptr<TensorRegistry> &tensor_reg,
-                  const std::shared_ptr<tflite::gpu::cl::CreationContext> &creation_context);
+                  const std::shared_ptr<tflite::gpu::cl::CreationContext> &creation_context,
+                  tflite::gpu::cl::CalculationsPrecision precision,
+                  const std::shared_ptr<KernelTuner> &tuner = nullptr);
 
   std::unique_ptr<exec::FunctionSequence> generate(ir::OperationIndex ind) override;
 
 private:
   void visit(const ir::operation::BinaryArithmetic &) override;
+  void visit(const ir::operation::Concat &) override;
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
   void visit(const ir::operation::ElementwiseActivation &) override;
+  void visit(const ir::operation::FullyConnected &) override;
+  void visit(const ir::operation::Pad &) override;
   void visit(const ir::operation::Pool2D &) override;
+  void visit(const ir::operation::Reduce &) override;
   void visit(const ir::operation::Reshape &) override;
+  void visit(const ir::operation::ResizeBilinear &) override;
+  void visit(const ir::operation::ResizeNearestNeighbor &) override;
   void visit(const ir::operation::Softmax &) override;
+  void visit(const ir::operation::Transpose &) override;
+
+private:
+  void genResize(const ir::OperandIndex &input_index, const ir::OperandIndex &output_index,
+                 tflite::gpu::SamplingType type, bool align_corners, bool half_pixel_centers);
+
+  /**
+   * @brief Return a function running @c gpu_op, which writes @c output
+   */
+  void returnOperation(const ir::OperandIndex &output,
+                       std::unique_ptr<tflite::gpu::cl::GPUOperation> gpu_op);
+
+  /**
+   * @brief Link the element-wise @c gpu_op into the operation producing @c input, which then
+   *        writes @c output instead, saving a kernel launch and a round trip through memory.
+   *        This is what tflite::gpu::cl::InferenceContext does merging linkable nodes.
+   * @param[in] second The second input of @c gpu_op, if any
+   * @return The operation @c gpu_op is linked into, or nullptr if it has to run by itself
+   */
+  tflite::gpu::cl::GPUOperation *
+  linkToProducer(const ir::OperandIndex &input, const ir::OperandIndex &output,
+                 tflite::gpu::cl::GPUOperation *gpu_op,
+                 const ir::OperandIndex &second = ir::OperandIndex{});
 
 private:
   const ir::Operands &_ctx;
@@ -62,7 +96,10 @@ private:
   std::shared_ptr<TensorBuilder> _tensor_builder;
   std::shared_ptr<TensorRegistry> _tensor_reg;
   std::shared_ptr<tflite::gpu::cl::CreationContext> _creation_context;
-  ir::OperandIndexMap<std::shared_ptr<tflite::gpu::cl::Tensor>> _new_tensors;
+  tflite::gpu::cl::CalculationsPrecision _precision;
+  std::shared_ptr<KernelTuner> _tuner;
+  // Last operation writing each tensor, where a following element-wise operation can link
+  ir::OperandIndexMap<tflite::gpu::cl::GPUOperation *> _producers;
 };
 
 } // namespace gpu_cl
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KernelTuner.h"
+
+#include <util/AtomicFile.h>
+#include <util/logging.h>
+
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+namespace onert
+{
+namespace backend
+{
+namespace gpu_cl
+{
+
+KernelTuner::KernelTuner(tflite::gpu::cl::Environment *environment,
+                         tflite::gpu::cl::TuningType type, const std::string &file)
+  : _file{file}
+{
+  _params.queue = environment->profiling_queue();
+  _params.info = &environment->device().GetInfo();
+  _params.tuning_type = type;
+
+  if (_file.empty())
+    return;
+
+  // Each line is "<key> <x> <y> <z>"
+  std::ifstream stream(_file);
+  std::string key;
+  tflite::gpu::int3 work_group;
+  while (stream >> key >> work_group.x >> work_group.y >> work_group.z)
+    _work_groups[key] = work_group;
+  VERBOSE(KernelTuner) << "Loaded " << _work_groups.size() << " work groups from " << _file
+                       << std::endl;
+}
+
+absl::Status KernelTuner::tune(const std::string &key, tflite::gpu::cl::GPUOperation &gpu_op)
+{
+  // Sources are fixed once compiled, with everything linked into the operation
+  std::stringstream full_key;
+  full_key << key << "_" << std::hex << std::hash<std::string>{}(gpu_op.code_);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _work_groups.find(full_key.str());
+    if (it != _work_groups.end())
+    {
+      gpu_op.work_group_size_ = it->second;
+      // Work groups count follows the work group size
+      return gpu_op.UpdateParams();
+    }
+  }
+
+  RETURN_IF_ERROR(gpu_op.Tune(_params));
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _work_groups[full_key.str()] = gpu_op.work_group_size_;
+  _changed = true;
+  return absl::OkStatus();
+}
+
+void KernelTuner::store()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_file.empty() || !_changed)
+    return;
+
+  std::ostringstream stream;
+  for (const auto &pair : _work_groups)
+    stream << pair.first << " " << pair.second.x << " " << pair.second.y << " " << pair.second.z
+           << "\n";
+  if (!util::writeFileAtomically(_file, stream.str()))
+  {
+    VERBOSE(KernelTuner) << "Failed to write tuning file " << _file << std::endl;
+    return;
+  }
+  _changed = false;
+}
+
+} // namespace gpu_cl
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_GPU_CL_KERNEL_TUNER_H__
+#define __ONERT_BACKEND_GPU_CL_KERNEL_TUNER_H__
+
+#include "tensorflow/lite/delegates/gpu/cl/environment.h"
+#include "tensorflow/lite/delegates/gpu/cl/kernels/gpu_operation.h"
+#include "tensorflow/lite/delegates/gpu/cl/kernels/tuning_parameters.h"
+#include "tensorflow/lite/delegates/gpu/common/status.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace backend
+{
+namespace gpu_cl
+{
+
+/**
+ * @brief Work group sizes of kernels tuned with GPU_CL_TUNING(FAST or EXHAUSTIVE)
+ *
+ * Tuning runs every candidate work group of a kernel, so it is done once per device. Sizes are
+ * kept in "<COMPILE_CACHE_DIR>/clworkgroup_gpu_cl_<key>.txt" next to the program binaries, keyed
+ * by the kernel source and the output shape, which decide the work groups to choose from.
+ */
+class KernelTuner
+{
+public:
+  KernelTuner(tflite::gpu::cl::Environment *environment, tflite::gpu::cl::TuningType type,
+              const std::string &file);
+
+public:
+  /**
+   * @brief Set the work group size of @c gpu_op tuned before, or tune it
+   * @param key Key of the output shape of @c gpu_op
+   * @note  @c gpu_op must be compiled and its parameters updated
+   */
+  absl::Status tune(const std::string &key, tflite::gpu::cl::GPUOperation &gpu_op);
+  /**
+   * @brief Store the work group sizes if any kernel is tuned since they were loaded
+   */
+  void store();
+
+private:
+  tflite::gpu::cl::TuningParameters _params;
+  std::string _file;
+  std::mutex _mutex;
+  std::unordered_map<std::string, tflite::gpu::int3> _work_groups;
+  bool _changed = false;
+};
+
+} // namespace gpu_cl
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_GPU_CL_KERNEL_TUNER_H__
@@ -55,7 +55,8 @@ TensorBuilder::TensorBuilder(const ir::Operands &operands, TensorManager *tensor
 }
 
 void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
-                                       ir::Layout backend_layout, TensorType type)
+                                       ir::Layout backend_layout, TensorType type,
+                                       tflite::gpu::cl::TensorStorageType storage_type)
 {
   assert(_tensor_mgr->constTensors().size() == 0);
   assert(_tensor_mgr->nonconstTensors().size() == 0);
@@ -64,6 +65,7 @@ void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::Op
 
   _tensor_info_map.emplace(ind, info);
   _tensor_type_map.emplace(ind, type);
+  _tensor_storage_map.emplace(ind, storage_type);
 
   _tensor_layout_map.insert({ind, backend_layout});
 }
@@ -125,7 +127,9 @@ void TensorBuilder::buildTensors(void)
       continue;
     auto type = _tensor_type_map.at(ind);
     const auto &info = entry.second;
-    _tensor_mgr->buildTensor(ind, info, _create_info, _environment, _environment->device().info_,
+    auto create_info = _create_info;
+    create_info.storage_type = _tensor_storage_map.at(ind);
+    _tensor_mgr->buildTensor(ind, info, create_info, _environment, _environment->device().info_,
                              type);
   }
 }
@@ -43,9 +43,12 @@ public:
    * @param[in] ind    Operand index
    * @param[in] info   Tensor information
    * @param[in] layout Tensor data layout
+   * @param[in] storage_type Storage preferred for the tensor, which falls back to another one if
+   *                         the device cannot hold the tensor in it
    */
   void registerTensorInfo(const ir::OperandIndex &ind, const ir::OperandInfo &info,
-                          ir::Layout backend_layout, TensorType type);
+                          ir::Layout backend_layout, TensorType type,
+                          tflite::gpu::cl::TensorStorageType storage_type);
 
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
@@ -89,6 +92,7 @@ private:
   ir::OperandIndexMap<ir::OperandInfo> _tensor_info_map;
   ir::OperandIndexMap<ir::Layout> _tensor_layout_map;
   ir::OperandIndexMap<TensorType> _tensor_type_map;
+  ir::OperandIndexMap<tflite::gpu::cl::TensorStorageType> _tensor_storage_map;
   ir::OperandIndexMap<size_t> _uses_count_map;
 
   std::unique_ptr<TensorManager> _tensor_mgr;
@@ -128,12 +128,28 @@ void ICLTensor::readConvertInit()
   }
 }
 
+TensorObject ICLTensor::deviceObject()
+{
+  if (handle()->GetStorageType() == TensorStorageType::BUFFER)
+  {
+    return OpenClBuffer{handle()->GetMemoryPtr()};
+  }
+  else if (handle()->GetStorageType() == TensorStorageType::IMAGE_BUFFER)
+  {
+    return OpenClBuffer{handle()->GetMemoryPtrForWriting()};
+  }
+  else
+  {
+    return OpenClTexture{handle()->GetMemoryPtr()};
+  }
+}
+
 void ICLTensor::enqueueWriteBuffer(const void *ptr, bool)
 {
   TensorObject input_obj =
     MakeReadableCpuMemory(absl::MakeSpan(static_cast<const float *>(ptr), _shape.num_elements()));
 
-  TensorObject output_obj;
+  TensorObject output_obj = deviceObject();
 
   TensorObject permute_obj;
   if (ToObjectType(handle()->GetStorageType()) == ObjectType::OPENCL_TEXTURE)
@@ -145,19 +161,6 @@ void ICLTensor::enqueueWriteBuffer(const void *ptr, bool)
     permute_obj = OpenClBuffer{_cl_memory.memory()};
   }
 
-  if (handle()->GetStorageType() == TensorStorageType::BUFFER)
-  {
-    output_obj = OpenClBuffer{handle()->GetMemoryPtr()};
-  }
-  else if (handle()->GetStorageType() == TensorStorageType::IMAGE_BUFFER)
-  {
-    output_obj = OpenClBuffer{handle()->GetMemoryPtrForWriting()};
-  }
-  else
-  {
-    output_obj = OpenClTexture{handle()->GetMemoryPtr()};
-  }
-
   if (!_converter_to->Convert(input_obj, permute_obj).ok())
   {
     throw std::runtime_error("Failed to write cl buffer from cpu memory");
@@ -168,22 +171,31 @@ void ICLTensor::enqueueWriteBuffer(const void *ptr, bool)
   }
 }
 
-void ICLTensor::enqueueReadBuffer(void *ptr, bool)
+bool ICLTensor::importHostBuffer(const void *ptr)
 {
-  TensorObject input_obj;
+  // Host memory can take the place of the BHWC buffer of enqueueWriteBuffer, not of a texture
+  if (ToObjectType(handle()->GetStorageType()) != ObjectType::OPENCL_BUFFER)
+    return false;
 
-  if (handle()->GetStorageType() == TensorStorageType::BUFFER)
-  {
-    input_obj = OpenClBuffer{handle()->GetMemoryPtr()};
-  }
-  else if (handle()->GetStorageType() == TensorStorageType::IMAGE_BUFFER)
-  {
-    input_obj = OpenClBuffer{handle()->GetMemoryPtrForWriting()};
-  }
-  else
+  cl_int error = CL_SUCCESS;
+  cl_mem memory = clCreateBuffer(_environment->context().context(),
+                                 CL_MEM_USE_HOST_PTR | CL_MEM_READ_ONLY, total_size(),
+                                 const_cast<void *>(ptr), &error);
+  if (error != CL_SUCCESS)
+    return false;
+  // OpenCL keeps the memory until the conversion enqueued is done
+  CLMemory host_memory{memory, true};
+
+  if (!_converter_from->Convert(OpenClBuffer{memory}, deviceObject()).ok())
   {
-    input_obj = OpenClTexture{handle()->GetMemoryPtr()};
+    throw std::runtime_error("Failed to change layout");
   }
+  return true;
+}
+
+void ICLTensor::enqueueReadBuffer(void *ptr, bool)
+{
+  TensorObject input_obj = deviceObject();
 
   TensorObject permute_obj;
   if (ToObjectType(handle()->GetStorageType()) == ObjectType::OPENCL_TEXTURE)
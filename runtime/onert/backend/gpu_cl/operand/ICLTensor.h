@@ -84,6 +84,7 @@ public:
   bool needMemoryMap() const final { return true; }
   void enqueueWriteBuffer(const void *ptr, bool blocking = true) final;
   void enqueueReadBuffer(void *ptr, bool blocking = true) final;
+  bool importHostBuffer(const void *ptr) final;
 
   void writeConvertInit();
   void readConvertInit();
@@ -94,6 +95,11 @@ public:
   virtual tflite::gpu::cl::Tensor *handle() = 0;
 
 private:
+  /**
+   * @brief Get the object of the device memory of the tensor for converters
+   */
+  tflite::gpu::TensorObject deviceObject();
+
 protected:
   size_t _rank; // Actual rank (reflects extended rank)
   ir::Shape _shape;
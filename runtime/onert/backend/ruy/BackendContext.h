@@ -44,6 +44,15 @@ public:
   ITensorRegistry *genTensors() override;
 
   FunctionMap genKernels() override;
+  uint64_t takeMemoryPeak() override { return tensor_builder->takeMemoryPeak(); }
+  uint64_t releaseMemory(bool weights) override
+  {
+    if (weights)
+      _external_context->clearPackedWeights();
+    return tensor_builder->releaseMemory();
+  }
+  void reacquireMemory() override { tensor_builder->reacquireMemory(); }
+  void resetStates() override { tensor_builder->resetVariables(); }
 
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BatchMatMulLayer.h"
+
+#include <ruy/operation/BatchMatMul.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace ruy
+{
+namespace ops
+{
+
+BatchMatMulLayer::BatchMatMulLayer()
+  : _lhs(nullptr), _rhs(nullptr), _output(nullptr), _adj_x(false), _adj_y(false),
+    _external_context(nullptr)
+{
+  // DO NOTHING
+}
+
+BatchMatMulLayer::~BatchMatMulLayer() = default;
+
+void BatchMatMulLayer::batchMatMulFloat32()
+{
+  nnfw::ruy::BatchMatMulParams op_params;
+  // Constant operands, e.g. weights of a projection, are packed once by ruy and reused over runs
+  op_params.lhs_cacheable = _lhs->is_constant();
+  op_params.rhs_cacheable = _rhs->is_constant();
+
+  // Each output element takes a multiply-accumulate per element of the contracted dimension
+  const auto &lhs_shape = _lhs->getShape();
+  const auto depth = lhs_shape.dim(lhs_shape.rank() - (_adj_x ? 2 : 1));
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * depth);
+
+  nnfw::ruy::BatchMatMul(op_params, getTensorShape(_lhs),
+                         reinterpret_cast<const float *>(_lhs->buffer()), getTensorShape(_rhs),
+                         reinterpret_cast<const float *>(_rhs->buffer()), _adj_x, _adj_y,
+                         getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()),
+                         _external_context->ruy_context());
+}
+
+void BatchMatMulLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
+                                 bool adj_x, bool adj_y, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
+{
+  assert(lhs != nullptr);
+  assert(rhs != nullptr);
+  assert(output != nullptr);
+
+  _lhs = lhs;
+  _rhs = rhs;
+  _adj_x = adj_x;
+  _adj_y = adj_y;
+  _output = output;
+  _external_context = external_context;
+}
+
+void BatchMatMulLayer::run()
+{
+  if (_lhs->data_type() == OperandType::FLOAT32 && _rhs->data_type() == OperandType::FLOAT32)
+  {
+    batchMatMulFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"BatchMatMul: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace ruy
+} // namespace backend
+} // namespace onert
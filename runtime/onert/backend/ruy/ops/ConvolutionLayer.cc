@@ -54,6 +54,13 @@ void ConvolutionLayer::convFloat32()
   op_params.dilation_height_factor = _dilationHeightFactor;
   op_params.float_activation_min = output_activation_min;
   op_params.float_activation_max = output_activation_max;
+  // Constant kernels are packed once by ruy and reused over runs
+  op_params.lhs_cacheable = _kernel->is_constant();
+
+  const auto &kernel_shape = _kernel->getShape();
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+    kernel_shape.dim(2) * kernel_shape.dim(3));
 
   nnfw::ruy::Conv &kernel = *_conv_kernel;
   kernel(op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
@@ -63,6 +70,42 @@ void ConvolutionLayer::convFloat32()
          _external_context->ruy_context());
 }
 
+void ConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::ruy::ConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.input_offset = -_input->data_zero_point();
+  // int8 kernels are quantized symmetrically
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  op_params.lhs_cacheable = _kernel->is_constant();
+
+  const auto &kernel_shape = _kernel->getShape();
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+    kernel_shape.dim(2) * kernel_shape.dim(3));
+
+  nnfw::ruy::Conv &kernel = *_conv_kernel;
+  kernel(op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+         getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+         getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+         getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()),
+         _external_context->ruy_context());
+}
+
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
                                  const IPortableTensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -127,6 +170,10 @@ void ConvolutionLayer::run()
   {
     convFloat32();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convQuant8PerChannel();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -139,11 +186,21 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::ruy::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  if ((_input->data_type() == OperandType::FLOAT32 ||
+       _input->data_type() == OperandType::QUANT_INT8_ASYMM) &&
+      _kernel->is_constant())
   {
     kernel.prepare(getTensorShape(_input), getTensorShape(_kernel), getTensorShape(_output),
                    _strideWidth, _strideHeight, _dilationWidthFactor, _dilationHeightFactor);
   }
+  // Scales are known even if the kernel is not constant, and a per-tensor scale applies to all
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+      _kernel->data_scales().size(), getTensorShape(_kernel).Dims(0),
+      _per_channel_output_multiplier, _per_channel_output_shift);
+  }
   _prepare = true;
 }
 
@@ -44,6 +44,8 @@ public:
 public:
   void convFloat32();
 
+  void convQuant8PerChannel();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, ir::PaddingType _paddingType,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
@@ -77,6 +79,10 @@ private:
 
   std::unique_ptr<nnfw::ruy::Conv> _conv_kernel;
 
+  // Requantization of each output channel of int8 kernels
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
   bool _prepare;
 
   std::shared_ptr<ExternalContext> _external_context;
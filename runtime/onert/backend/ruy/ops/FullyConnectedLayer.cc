@@ -50,6 +50,8 @@ void FullyConnectedLayer::fullyConnectedFloat32()
   op_params.lhs_cacheable = _weights->is_constant();
   op_params.rhs_cacheable = _input->is_constant();
 
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * _weights->getShape().dim(1));
   nnfw::ruy::FullyConnected(
     op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
     getTensorShape(_weights), reinterpret_cast<const float *>(_weights->buffer()),
@@ -58,6 +60,34 @@ void FullyConnectedLayer::fullyConnectedFloat32()
     _external_context->ruy_context());
 }
 
+void FullyConnectedLayer::fullyConnectedQuant8PerChannel()
+{
+  int32_t output_activation_min = 0, output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+  nnfw::ruy::FullyConnectedParams op_params;
+
+  op_params.input_offset = -_input->data_zero_point();
+  // int8 weights are quantized symmetrically
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+  op_params.activation = convertActivationType(_activation);
+  op_params.lhs_cacheable = _weights->is_constant();
+  op_params.rhs_cacheable = _input->is_constant();
+
+  const auto lease = _external_context->leaseThreads(
+    static_cast<uint64_t>(_output->getShape().num_elements()) * _weights->getShape().dim(1));
+  nnfw::ruy::FullyConnected(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+    getTensorShape(_weights), reinterpret_cast<const int8_t *>(_weights->buffer()),
+    getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias ? _bias->buffer() : nullptr),
+    getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()),
+    _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
@@ -79,6 +109,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedFloat32();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    fullyConnectedQuant8PerChannel();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -87,7 +121,7 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  if (_bias && _bias->is_constant() && _bias->data_type() == OperandType::FLOAT32)
   {
     const int bias_size = getTensorShape(_bias).FlatSize();
     if (nnfw::ruy::IsZeroVector(reinterpret_cast<float *>(_bias->buffer()), bias_size))
@@ -95,6 +129,15 @@ void FullyConnectedLayer::prepare()
       _bias = nullptr;
     }
   }
+
+  // Scales are known even if the weights are not constant, and a per-tensor scale applies to all
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _weights->data_scales().data(),
+      _weights->data_scales().size(), getTensorShape(_weights).Dims(0),
+      _per_channel_output_multiplier, _per_channel_output_shift);
+  }
 }
 
 } // namespace ops
@@ -41,6 +41,8 @@ public:
 public:
   void fullyConnectedFloat32();
 
+  void fullyConnectedQuant8PerChannel();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation,
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
@@ -58,6 +60,10 @@ private:
 
   ir::Activation _activation;
 
+  // Requantization of each output channel of int8 weights
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
   std::shared_ptr<ExternalContext> _external_context;
 };
 
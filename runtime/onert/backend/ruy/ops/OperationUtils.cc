@@ -16,6 +16,9 @@
 
 #include "OperationUtils.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace onert
 {
 namespace backend
@@ -41,6 +44,86 @@ nnfw::ruy::PaddingType getPaddingType(ir::PaddingType ir_padding_type)
   }
 }
 
+void QuantizeMultiplier(double double_multiplier, int32_t *quantized_multiplier, int *shift)
+{
+  if (double_multiplier == 0.)
+  {
+    *quantized_multiplier = 0;
+    *shift = 0;
+    return;
+  }
+  const double q = std::frexp(double_multiplier, shift);
+  auto q_fixed = static_cast<int64_t>(std::round(q * (1ll << 31)));
+
+  assert(q_fixed <= (1ll << 31));
+  if (q_fixed == (1ll << 31))
+  {
+    q_fixed /= 2;
+    ++*shift;
+  }
+  assert(q_fixed <= std::numeric_limits<int32_t>::max());
+  *quantized_multiplier = static_cast<int32_t>(q_fixed);
+}
+
+void GetQuantizedConvolutionMultipliersAndShifts(
+  float input_scale, float output_scale, const float *filter_scales, size_t filter_scales_size,
+  int num_channels, std::vector<int32_t> &per_channel_output_multiplier,
+  std::vector<int> &per_channel_output_shift)
+{
+  // Originates from tflite's PopulateConvolutionQuantizationParams()
+  per_channel_output_multiplier.resize(num_channels);
+  per_channel_output_shift.resize(num_channels);
+
+  // If per-tensor quantization parameter is specified, broadcast it along the
+  // quantization dimension (channels_out).
+  const bool is_per_channel = filter_scales_size > 1;
+  for (int i = 0; i < num_channels; ++i)
+  {
+    const float scale = is_per_channel ? filter_scales[i] : filter_scales[0];
+    const double filter_scale = static_cast<double>(scale);
+    const double effective_output_scale =
+      static_cast<double>(input_scale) * filter_scale / static_cast<double>(output_scale);
+    QuantizeMultiplier(effective_output_scale, &per_channel_output_multiplier[i],
+                       &per_channel_output_shift[i]);
+  }
+}
+
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       int32_t *act_min, int32_t *act_max)
+{
+  if (output->data_type() != OperandType::QUANT_INT8_ASYMM)
+    throw std::runtime_error("CalculateActivationRangeQuantized: Not supported operand type.");
+  const int32_t qmin = std::numeric_limits<int8_t>::min();
+  const int32_t qmax = std::numeric_limits<int8_t>::max();
+
+  const auto scale = output->data_scale();
+  const auto zero_point = output->data_zero_point();
+  auto quantize = [scale, zero_point](float f) {
+    return zero_point + static_cast<int32_t>(std::round(f / scale));
+  };
+  switch (activation)
+  {
+    case ir::Activation::NONE:
+      *act_min = qmin;
+      *act_max = qmax;
+      break;
+    case ir::Activation::RELU:
+      *act_min = std::max(qmin, quantize(0.0));
+      *act_max = qmax;
+      break;
+    case ir::Activation::RELU6:
+      *act_min = std::max(qmin, quantize(0.0));
+      *act_max = std::min(qmax, quantize(6.0));
+      break;
+    case ir::Activation::RELU1:
+      *act_min = std::max(qmin, quantize(-1.0));
+      *act_max = std::min(qmax, quantize(1.0));
+      break;
+    default:
+      throw std::runtime_error{"Unsupported fused activation function."};
+  }
+}
+
 } // namespace ops
 } // namespace ruy
 } // namespace backend
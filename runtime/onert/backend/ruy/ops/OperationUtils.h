@@ -26,6 +26,7 @@
 #include <ruy/Types.h>
 
 #include <limits>
+#include <vector>
 
 using OperandType = onert::ir::DataType;
 using namespace onert::util;
@@ -81,6 +82,16 @@ inline nnfw::ruy::FusedActivationFunctionType convertActivationType(const ir::Ac
 
 nnfw::ruy::PaddingType getPaddingType(ir::PaddingType ir_padding_type);
 
+void QuantizeMultiplier(double double_multiplier, int32_t *quantized_multiplier, int *shift);
+
+void GetQuantizedConvolutionMultipliersAndShifts(
+  float input_scale, float output_scale, const float *filter_scales, size_t filter_scales_size,
+  int num_channels, std::vector<int32_t> &per_channel_output_multiplier,
+  std::vector<int> &per_channel_output_shift);
+
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       int32_t *act_min, int32_t *act_max);
+
 } // namespace ops
 } // namespace ruy
 } // namespace backend
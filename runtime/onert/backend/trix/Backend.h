@@ -24,6 +24,7 @@
 #include <backend/Backend.h>
 
 #include <memory>
+#include <mutex>
 
 namespace onert
 {
@@ -42,7 +43,7 @@ public:
   std::unique_ptr<onert::backend::BackendContext> newContext(ContextData &&data) const override
   {
     auto &graph = *data.graph;
-    auto context = std::make_unique<BackendContext>(this, std::move(data));
+    auto context = std::make_unique<BackendContext>(this, std::move(data), devContext());
     auto tr = std::make_shared<basic::TensorRegistry>();
     auto tb = std::make_shared<TensorBuilder>(tr);
     context->tensor_registry = tr;
@@ -51,8 +52,20 @@ public:
     return context;
   }
 
+private:
+  // The device and the models registered to it are shared by all the sessions
+  std::shared_ptr<DevContext> devContext() const
+  {
+    std::lock_guard<std::mutex> lock{_dev_context_mutex};
+    if (_dev_context == nullptr)
+      _dev_context = std::make_shared<DevContext>();
+    return _dev_context;
+  }
+
 private:
   std::shared_ptr<IConfig> _config;
+  mutable std::shared_ptr<DevContext> _dev_context;
+  mutable std::mutex _dev_context_mutex;
 };
 
 } // namespace trix
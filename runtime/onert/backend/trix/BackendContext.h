@@ -33,16 +33,18 @@ class BackendContext : public onert::backend::BackendContext
 {
 public:
   BackendContext(const Backend *backend, ContextData &&data,
+                 const std::shared_ptr<DevContext> &dev_context,
                  std::shared_ptr<ITensorRegistry> tensor_registry = nullptr,
                  std::shared_ptr<TensorBuilder> tensor_builder = nullptr,
                  std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
     : onert::backend::BackendContext(backend, std::move(data), tensor_registry),
-      tensor_builder{tensor_builder}, kernel_gen{kernel_gen}, _dev_context(new DevContext)
+      tensor_builder{tensor_builder}, kernel_gen{kernel_gen}, _dev_context(dev_context)
   {
   }
 
   ITensorRegistry *genTensors() override;
   FunctionMap genKernels() override;
+  uint64_t takeMemoryPeak() override { return tensor_builder->takeMemoryPeak(); }
 
   std::shared_ptr<DevContext> dev_context() { return _dev_context; }
 
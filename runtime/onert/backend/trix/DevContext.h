@@ -19,6 +19,10 @@
 
 #include <libnpuhost.h>
 
+#include <map>
+#include <mutex>
+#include <string>
+
 namespace onert
 {
 namespace backend
@@ -51,10 +55,51 @@ public:
       unregisterNPUmodel_all(_dev_handle);
       putNPUdevice(_dev_handle);
     }
+    for (auto &model : _models)
+      free(model.second.meta);
   }
 
   npudev_h getDev() { return _dev_handle; }
 
+  struct Model
+  {
+    uint32_t id;
+    npubin_meta *meta;
+  };
+
+  /**
+   * @brief Register the model binary to the device, once for all the sessions sharing the device
+   * @param binary_path Path of the model binary
+   * @return Registered model, valid while this context lives
+   */
+  const Model &registerModel(const std::string &binary_path)
+  {
+    std::lock_guard<std::mutex> lock{_models_mutex};
+    auto it = _models.find(binary_path);
+    if (it != _models.end())
+      return it->second;
+
+    Model model;
+    model.meta = getNPUmodel_metadata(binary_path.c_str(), false);
+    if (model.meta == nullptr)
+    {
+      throw std::runtime_error("Unable to extract the model metadata");
+    }
+
+    generic_buffer model_file;
+    model_file.type = BUFFER_FILE;
+    model_file.filepath = binary_path.c_str();
+    model_file.size = model.meta->size;
+
+    if (registerNPUmodel(_dev_handle, &model_file, &model.id) < 0)
+    {
+      free(model.meta);
+      throw std::runtime_error("Failed to register npu model");
+    }
+
+    return _models.emplace(binary_path, model).first->second;
+  }
+
   template <typename T> void setDataInfo(tensors_data_info *info, std::vector<T *> &tensors)
   {
     info->num_info = static_cast<uint32_t>(tensors.size());
@@ -66,14 +111,22 @@ public:
     }
   }
 
-  template <typename T> void setBuffer(generic_buffers *buf, std::vector<T *> &tensors)
+  /**
+   * @brief Set buffers to the slice of tensors for a batch
+   * @param batch Index of the batch
+   * @param num_batches Number of batches that the tensors are evenly split into
+   */
+  template <typename T>
+  void setBuffer(generic_buffers *buf, std::vector<T *> &tensors, uint32_t batch = 0,
+                 uint32_t num_batches = 1)
   {
     buf->num_buffers = static_cast<uint32_t>(tensors.size());
 
     for (uint32_t idx = 0; idx < buf->num_buffers; ++idx)
     {
-      buf->bufs[idx].addr = tensors[idx]->buffer();
-      buf->bufs[idx].size = static_cast<uint64_t>(tensors[idx]->total_size());
+      const auto size = tensors[idx]->total_size() / num_batches;
+      buf->bufs[idx].addr = tensors[idx]->buffer() + size * batch;
+      buf->bufs[idx].size = static_cast<uint64_t>(size);
       buf->bufs[idx].type = BUFFER_MAPPED;
     }
   }
@@ -109,6 +162,9 @@ private:
   // NPU device handle
   // TODO Support multicore npu device
   npudev_h _dev_handle;
+  // Registered models by the path of binary
+  std::map<std::string, Model> _models;
+  std::mutex _models_mutex;
 };
 
 } // namespace trix
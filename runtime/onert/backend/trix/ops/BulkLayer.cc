@@ -15,10 +15,14 @@
  */
 
 #include "BulkLayer.h"
+#include <exec/AsyncTransfers.h>
 #include <util/logging.h>
 
 #include <libnpuhost.h>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace onert
 {
 namespace backend
@@ -28,12 +32,100 @@ namespace trix
 namespace ops
 {
 
+/**
+ * @brief NPU request submitted without blocking, which is done when the device calls back
+ */
+class BulkLayer::Request : public exec::AsyncTransfers::IPending
+{
+public:
+  Request(npudev_h dev, uint32_t model_id) : _dev{dev}
+  {
+    if (createNPU_request(_dev, model_id, &_req_id))
+    {
+      throw std::runtime_error("Unable to create NPU request with model id (" +
+                               std::to_string(model_id) + ")");
+    }
+
+    if (setNPU_requestMode(_dev, _req_id, NPU_INFER_NON_BLOCKING) ||
+        setNPU_requestCallback(_dev, _req_id, &Request::notify, this))
+    {
+      removeNPU_request(_dev, _req_id);
+      throw std::runtime_error("Unable to set NPU request with req id (" +
+                               std::to_string(_req_id) + ") non-blocking");
+    }
+  }
+
+  ~Request()
+  {
+    wait();
+    removeNPU_request(_dev, _req_id);
+  }
+
+public:
+  // Buffers and infos stay with the request since the device reads them after submission
+  tensors_data_info in_info;
+  tensors_data_info out_info;
+  input_buffers input_buf;
+  output_buffers output_buf;
+
+  void submit()
+  {
+    if (setNPU_requestData(_dev, _req_id, &input_buf, &in_info, &output_buf, &out_info))
+    {
+      throw std::runtime_error("Unable to set data of NPU request with req id (" +
+                               std::to_string(_req_id) + ")");
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _pending = true;
+    }
+    if (submitNPU_request(_dev, _req_id))
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      _pending = false;
+      throw std::runtime_error("Unable to submit NPU request with req id (" +
+                               std::to_string(_req_id) + ")");
+    }
+  }
+
+  bool done() override
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return !_pending;
+  }
+
+  void wait() override
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cond.wait(lock, [this] { return !_pending; });
+  }
+
+private:
+  static void notify(output_buffers *, int, void *data)
+  {
+    auto request = static_cast<Request *>(data);
+    {
+      std::lock_guard<std::mutex> lock{request->_mutex};
+      request->_pending = false;
+    }
+    request->_cond.notify_all();
+  }
+
+private:
+  npudev_h _dev;
+  int _req_id = 0;
+  std::mutex _mutex;
+  std::condition_variable _cond;
+  bool _pending = false;
+};
+
 BulkLayer::BulkLayer() : _inputs(), _outputs(), _model_id(0), _meta(nullptr), _dev_context(nullptr)
 {
   // DO NOTHING
 }
 
-BulkLayer::~BulkLayer() { free(_meta); }
+BulkLayer::~BulkLayer() = default;
 
 void BulkLayer::configure(const std::vector<const IPortableTensor *> &inputs,
                           std::vector<IPortableTensor *> &outputs, std::string binary_path,
@@ -43,31 +135,42 @@ void BulkLayer::configure(const std::vector<const IPortableTensor *> &inputs,
   _outputs = outputs;
   _dev_context = dev_context;
 
-  _meta = getNPUmodel_metadata(binary_path.c_str(), false);
-  if (_meta == nullptr)
+  // Sessions of the same binary share the registration
+  const auto &model = _dev_context->registerModel(binary_path);
+  _model_id = model.id;
+  _meta = model.meta;
+}
+
+void BulkLayer::run()
+{
+  if (_requests.empty())
+    prepare();
+
+  for (uint32_t batch = 0; batch < _requests.size(); ++batch)
   {
-    throw std::runtime_error("Unable to extract the model metadata");
+    auto &request = *_requests[batch];
+    // The previous run may still be in flight without an executor to wait for it
+    request.wait();
+
+    const auto num_batches = static_cast<uint32_t>(_requests.size());
+    _dev_context->setBuffer<const IPortableTensor>(&request.input_buf, _inputs, batch,
+                                                   num_batches);
+    _dev_context->setBuffer<IPortableTensor>(&request.output_buf, _outputs, batch, num_batches);
+    request.submit();
   }
 
-  generic_buffer model_file;
-  model_file.type = BUFFER_FILE;
-  model_file.filepath = binary_path.c_str();
-  model_file.size = _meta->size;
-
-  if (registerNPUmodel(dev_context->getDev(), &model_file, &_model_id) < 0)
+  // All the batches are in flight. Let the executor run other jobs until they are done.
+  for (auto &request : _requests)
   {
-    throw std::runtime_error("Failed to register npu model");
+    if (!exec::AsyncTransfers::defer(request.get()))
+      request->wait();
   }
 }
 
-void BulkLayer::run()
+void BulkLayer::prepare()
 {
-  int req_id;
-  if (createNPU_request(_dev_context->getDev(), _model_id, &req_id))
-  {
-    throw std::runtime_error("Unable to create NPU request with model id (" +
-                             std::to_string(_model_id) + ")");
-  }
+  if (!_requests.empty())
+    return;
 
   if (_meta->input_seg_num != _inputs.size())
   {
@@ -79,41 +182,39 @@ void BulkLayer::run()
     throw std::runtime_error("output size does not match to model output seg num");
   }
 
-  tensors_data_info in_info;
-  tensors_data_info out_info;
-  _dev_context->setDataInfo<const IPortableTensor>(&in_info, _inputs);
-  _dev_context->setDataInfo<IPortableTensor>(&out_info, _outputs);
-
-  input_buffers input_buf;
-  output_buffers output_buf;
-  _dev_context->setBuffer<const IPortableTensor>(&input_buf, _inputs);
-  _dev_context->setBuffer<IPortableTensor>(&output_buf, _outputs);
-
-  if (setNPU_requestData(_dev_context->getDev(), req_id, &input_buf, &in_info, &output_buf,
-                         &out_info))
-  {
-    throw std::runtime_error("Unable to create NPU request for model id (" +
-                             std::to_string(_model_id) + ")");
-  }
-
-  if (submitNPU_request(_dev_context->getDev(), req_id))
+  // Inputs batched over the batch of the model run as one request per batch of the model
+  uint32_t num_batches = 1;
+  const auto model_batch = _meta->input_seg_dims[0][0];
+  if (!_inputs.empty() && model_batch > 0)
   {
-    throw std::runtime_error("Unable to submit NPU request with req id (" + std::to_string(req_id) +
-                             ")");
+    const auto batch = static_cast<uint32_t>(_inputs[0]->getShape().dim(0));
+    if (batch == 0 || batch % model_batch != 0)
+    {
+      throw std::runtime_error("input batch is not a multiple of the model batch");
+    }
+    num_batches = batch / model_batch;
   }
 
-  if (removeNPU_request(_dev_context->getDev(), req_id))
+  auto check_divisible = [num_batches](const IPortableTensor *tensor) {
+    if (tensor->total_size() % num_batches != 0)
+    {
+      throw std::runtime_error("tensor size is not divisible by the number of batches");
+    }
+  };
+  for (auto input : _inputs)
+    check_divisible(input);
+  for (auto output : _outputs)
+    check_divisible(output);
+
+  for (uint32_t batch = 0; batch < num_batches; ++batch)
   {
-    throw std::runtime_error("Unable to remove NPU request with req id (" + std::to_string(req_id) +
-                             ")");
+    auto request = std::make_unique<Request>(_dev_context->getDev(), _model_id);
+    _dev_context->setDataInfo<const IPortableTensor>(&request->in_info, _inputs);
+    _dev_context->setDataInfo<IPortableTensor>(&request->out_info, _outputs);
+    _requests.emplace_back(std::move(request));
   }
 }
 
-void BulkLayer::prepare()
-{
-  // DO NOTHING
-}
-
 } // namespace ops
 } // namespace trix
 } // namespace backend
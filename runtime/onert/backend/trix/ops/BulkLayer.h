@@ -22,6 +22,9 @@
 
 #include <exec/IFunction.h>
 
+#include <memory>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -46,13 +49,18 @@ public:
 
   void prepare() override;
 
+private:
+  class Request;
+
 private:
   std::vector<const IPortableTensor *> _inputs;
   std::vector<IPortableTensor *> _outputs;
 
   uint32_t _model_id;
-  npubin_meta *_meta;
+  const npubin_meta *_meta;
   std::shared_ptr<DevContext> _dev_context;
+  // Requests created once and reused, one per batch of the model in the inputs
+  std::vector<std::unique_ptr<Request>> _requests;
 };
 
 } // namespace ops
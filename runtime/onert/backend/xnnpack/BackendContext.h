@@ -44,12 +44,18 @@ public:
   {
     int num_threads = util::getConfigInt(util::config::XNNPACK_THREADS);
     if (num_threads < 1)
-      num_threads = kDefaultNumThreadpoolThreads; // default num of threads
+    {
+      // Operations may use up to the whole thread budget by default if it is enabled
+      const auto &budget = exec::ThreadBudget::get();
+      num_threads = budget.enabled() ? static_cast<int>(budget.capacity())
+                                     : kDefaultNumThreadpoolThreads; // default num of threads
+    }
     _external_context.reset(new ExternalContext(static_cast<size_t>(num_threads)));
   }
 
   ITensorRegistry *genTensors() override;
   FunctionMap genKernels() override;
+  uint64_t takeMemoryPeak() override { return tensor_builder->takeMemoryPeak(); }
 
   std::shared_ptr<ExternalContext> external_context() { return _external_context; }
 
@@ -25,12 +25,61 @@ namespace backend
 namespace xnnpack
 {
 
+namespace
+{
+
+/**
+ * @brief Get the thread pool of the process with the given number of threads
+ *
+ * The pool is destroyed when no context uses it. pthreadpool runs the operators of the contexts
+ * calling it at the same time one by one.
+ */
+std::shared_ptr<pthreadpool> getSharedThreadPool(size_t num_threads)
+{
+  static std::mutex mutex;
+  static std::map<size_t, std::weak_ptr<pthreadpool>> threadpools;
+
+  std::lock_guard<std::mutex> lock{mutex};
+  auto threadpool = threadpools[num_threads].lock();
+  if (!threadpool)
+  {
+    threadpool.reset(pthreadpool_create(num_threads), pthreadpool_destroy);
+    threadpools[num_threads] = threadpool;
+  }
+  return threadpool;
+}
+
+} // namespace
+
 ExternalContext::ExternalContext(size_t num_threads)
-  : _threadpool(pthreadpool_create(num_threads), pthreadpool_destroy)
+  : _threadpool(getSharedThreadPool(num_threads)), _num_threads{static_cast<uint32_t>(num_threads)}
 {
   assert(_threadpool);
 }
 
+exec::ThreadBudget::Lease ExternalContext::leaseThreads(uint64_t cost)
+{
+  return exec::ThreadBudget::get().lease(cost, _num_threads);
+}
+
+pthreadpool *ExternalContext::getThreadPool(uint32_t num_threads)
+{
+  if (num_threads >= _num_threads)
+    return _threadpool.get();
+  if (num_threads <= 1)
+    return nullptr;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto it = _small_threadpools.find(num_threads);
+  if (it == _small_threadpools.end())
+  {
+    auto threadpool = getSharedThreadPool(num_threads);
+    assert(threadpool);
+    it = _small_threadpools.emplace(num_threads, std::move(threadpool)).first;
+  }
+  return it->second.get();
+}
+
 } // namespace xnnpack
 } // namespace backend
 } // namespace onert
@@ -17,7 +17,11 @@
 #ifndef __ONERT_BACKEND_XNNPACK_EXTERNAL_CONTEXT_H__
 #define __ONERT_BACKEND_XNNPACK_EXTERNAL_CONTEXT_H__
 
+#include <exec/ThreadBudget.h>
+
+#include <map>
 #include <memory>
+#include <mutex>
 #include <xnnpack.h>
 
 namespace onert
@@ -27,6 +31,12 @@ namespace backend
 namespace xnnpack
 {
 
+/**
+ * @brief Context of the xnnpack backend, whose thread pools are shared by all sessions
+ *
+ * A pthreadpool keeps its workers until it is destroyed, so the contexts of all sessions share a
+ * pool of each number of threads instead of creating their own.
+ */
 class ExternalContext
 {
 public:
@@ -34,9 +44,28 @@ public:
 
 public:
   pthreadpool *getThreadPool() { return _threadpool.get(); }
+  /**
+   * @brief Lease threads from the thread budget
+   *
+   * @param cost Estimated cost of the operation to run
+   * @return Lease of the threads, which must be kept while the operation runs
+   */
+  exec::ThreadBudget::Lease leaseThreads(uint64_t cost);
+  /**
+   * @brief Get a thread pool with the given number of threads
+   *
+   * @return Thread pool to run an operator with, nullptr to run it on the calling thread
+   */
+  pthreadpool *getThreadPool(uint32_t num_threads);
 
 private:
-  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> _threadpool;
+  using ThreadPoolPtr = std::shared_ptr<pthreadpool>;
+
+  ThreadPoolPtr _threadpool;
+  uint32_t _num_threads;
+  // Thread pools with less threads, which are taken on demand
+  std::map<uint32_t, ThreadPoolPtr> _small_threadpools;
+  std::mutex _mutex;
 };
 
 } // namespace xnnpack
@@ -45,9 +45,15 @@ public:
   std::unique_ptr<exec::FunctionSequence> generate(ir::OperationIndex ind) override;
 
 private:
+  void visit(const ir::operation::BinaryArithmetic &) override;
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
+  void visit(const ir::operation::ElementwiseActivation &) override;
   void visit(const ir::operation::FullyConnected &) override;
+  void visit(const ir::operation::Pad &) override;
+  void visit(const ir::operation::Pool2D &) override;
+  void visit(const ir::operation::ResizeBilinear &) override;
+  void visit(const ir::operation::Softmax &) override;
 
 private:
   const ir::Operands &_ctx;
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BinaryArithmeticLayer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+BinaryArithmeticLayer::BinaryArithmeticLayer(
+  const std::shared_ptr<ExternalContext> external_context)
+  : Layer(external_context), _lhs(nullptr), _rhs(nullptr), _output(nullptr),
+    _activation(ir::Activation::NONE), _arithmetic_type(ArithmeticType::kAdd)
+{
+  // DO NOTHING
+}
+
+void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
+                                      IPortableTensor *output, const ir::Activation activation,
+                                      const ArithmeticType arithmetic_type)
+{
+  _lhs = lhs;
+  _rhs = rhs;
+  _output = output;
+  _activation = activation;
+  _arithmetic_type = arithmetic_type;
+
+  assert(_activation == ir::Activation::NONE || _activation == ir::Activation::RELU ||
+         _activation == ir::Activation::RELU1 || _activation == ir::Activation::RELU6);
+}
+
+void BinaryArithmeticLayer::run()
+{
+  assert(_external_context && _external_context->getThreadPool());
+  if (!_setup)
+  {
+    _setup = setup();
+    assert(_setup);
+  }
+
+  if (_lhs->data_type() == OperandType::FLOAT32)
+  {
+    const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
+    if (status != xnn_status_success)
+    {
+      throw std::runtime_error{"failed to run FP32 BinaryArithmetic operator"};
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"XNNPACK BinaryArithmetic: unsupported data type"};
+  }
+}
+
+bool BinaryArithmeticLayer::create()
+{
+  float output_activation_min = 0.f, output_activation_max = 0.f;
+  CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
+
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_arithmetic_type)
+  {
+    case ArithmeticType::kAdd:
+      status =
+        xnn_create_add_nd_f32(output_activation_min, output_activation_max, 0, &_kernel_op);
+      break;
+    case ArithmeticType::kSub:
+      status =
+        xnn_create_subtract_nd_f32(output_activation_min, output_activation_max, 0, &_kernel_op);
+      break;
+    case ArithmeticType::kMul:
+      status =
+        xnn_create_multiply_nd_f32(output_activation_min, output_activation_max, 0, &_kernel_op);
+      break;
+  }
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 BinaryArithmetic operator"};
+  }
+  assert(_kernel_op != nullptr);
+  return true;
+}
+
+bool BinaryArithmeticLayer::setup()
+{
+  if (_lhs->buffer() == nullptr || _rhs->buffer() == nullptr || _output->buffer() == nullptr)
+  {
+    // it could be models's input or output
+    return false;
+  }
+
+  // Inputs are broadcast to each other as in numpy
+  const auto lhs_dims = getDims(_lhs);
+  const auto rhs_dims = getDims(_rhs);
+  const float *lhs_buffer = reinterpret_cast<const float *>(_lhs->buffer());
+  const float *rhs_buffer = reinterpret_cast<const float *>(_rhs->buffer());
+  float *output_buffer = reinterpret_cast<float *>(_output->buffer());
+
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_arithmetic_type)
+  {
+    case ArithmeticType::kAdd:
+      status = xnn_setup_add_nd_f32(_kernel_op, lhs_dims.size(), lhs_dims.data(), rhs_dims.size(),
+                                    rhs_dims.data(), lhs_buffer, rhs_buffer, output_buffer,
+                                    _external_context->getThreadPool());
+      break;
+    case ArithmeticType::kSub:
+      status = xnn_setup_subtract_nd_f32(_kernel_op, lhs_dims.size(), lhs_dims.data(),
+                                         rhs_dims.size(), rhs_dims.data(), lhs_buffer, rhs_buffer,
+                                         output_buffer, _external_context->getThreadPool());
+      break;
+    case ArithmeticType::kMul:
+      status = xnn_setup_multiply_nd_f32(_kernel_op, lhs_dims.size(), lhs_dims.data(),
+                                         rhs_dims.size(), rhs_dims.data(), lhs_buffer, rhs_buffer,
+                                         output_buffer, _external_context->getThreadPool());
+      break;
+  }
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 BinaryArithmetic operator"};
+  }
+  return true;
+}
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
@@ -75,12 +75,18 @@ void ConvolutionLayer::run()
     assert(_setup);
   }
 
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (isSupportedDataType(_input->data_type()))
   {
-    enum xnn_status status = xnn_run_operator(_kernel_op, _external_context->getThreadPool());
+    // Each output element takes a multiply-accumulate per kernel element of its filter
+    const auto &kernel_shape = _kernel->getShape();
+    const auto lease = _external_context->leaseThreads(
+      static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+      kernel_shape.dim(2) * kernel_shape.dim(3));
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
     if (status != xnn_status_success)
     {
-      throw std::runtime_error{"failed to run FP32 Convolution operator"};
+      throw std::runtime_error{"failed to run Convolution operator"};
     }
   }
   else
@@ -91,9 +97,6 @@ void ConvolutionLayer::run()
 
 bool ConvolutionLayer::create()
 {
-  float output_activation_min = 0.f, output_activation_max = 0.f;
-  CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
-
   // NHWC
   // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
   const auto &kernel_shape = _kernel->getShape();
@@ -104,17 +107,75 @@ bool ConvolutionLayer::create()
   assert(static_cast<uint32_t>(_input->getShape().dim(3)) == input_channels);
   assert(static_cast<uint32_t>(_output->getShape().dim(3)) == output_channels);
 
-  enum xnn_status status = xnn_create_convolution2d_nhwc_f32(
-    _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
-    _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor, 1 /* groups */,
-    input_channels /* group_input_channels */, output_channels /* group_output_channels */,
-    input_channels /* input_channel_stride */, output_channels /* output_channel_stride */,
-    reinterpret_cast<const float *>(_kernel->buffer()),
-    reinterpret_cast<const float *>(_bias->buffer()), output_activation_min, output_activation_max,
-    0, &_kernel_op);
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+    {
+      float output_activation_min = 0.f, output_activation_max = 0.f;
+      CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
+      status = xnn_create_convolution2d_nhwc_f32(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
+        _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor,
+        1 /* groups */, input_channels /* group_input_channels */,
+        output_channels /* group_output_channels */, input_channels /* input_channel_stride */,
+        output_channels /* output_channel_stride */,
+        reinterpret_cast<const float *>(_kernel->buffer()),
+        reinterpret_cast<const float *>(_bias->buffer()), output_activation_min,
+        output_activation_max, 0, &_kernel_op);
+      break;
+    }
+    case OperandType::QUANT_UINT8_ASYMM:
+    {
+      uint8_t output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      float kernel_scale = 0.f;
+      int32_t kernel_zero_point = 0;
+      getKernelQuantization(_kernel, &kernel_scale, &kernel_zero_point);
+      status = xnn_create_convolution2d_nhwc_qu8(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
+        _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor,
+        1 /* groups */, input_channels /* group_input_channels */,
+        output_channels /* group_output_channels */, input_channels /* input_channel_stride */,
+        output_channels /* output_channel_stride */,
+        static_cast<uint8_t>(_input->data_zero_point()), _input->data_scale(),
+        static_cast<uint8_t>(kernel_zero_point), kernel_scale,
+        reinterpret_cast<const uint8_t *>(_kernel->buffer()),
+        reinterpret_cast<const int32_t *>(_bias->buffer()),
+        static_cast<uint8_t>(_output->data_zero_point()), _output->data_scale(),
+        output_activation_min, output_activation_max, 0, &_kernel_op);
+      break;
+    }
+    case OperandType::QUANT_INT8_ASYMM:
+    {
+      int8_t output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      float kernel_scale = 0.f;
+      int32_t kernel_zero_point = 0;
+      getKernelQuantization(_kernel, &kernel_scale, &kernel_zero_point);
+      if (kernel_zero_point != 0)
+        throw std::runtime_error{"XNNPACK Convolution: int8 kernel must be symmetric"};
+      status = xnn_create_convolution2d_nhwc_qs8(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
+        _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor,
+        1 /* groups */, input_channels /* group_input_channels */,
+        output_channels /* group_output_channels */, input_channels /* input_channel_stride */,
+        output_channels /* output_channel_stride */,
+        static_cast<int8_t>(_input->data_zero_point()), _input->data_scale(), kernel_scale,
+        reinterpret_cast<const int8_t *>(_kernel->buffer()),
+        reinterpret_cast<const int32_t *>(_bias->buffer()),
+        static_cast<int8_t>(_output->data_zero_point()), _output->data_scale(),
+        output_activation_min, output_activation_max, 0, &_kernel_op);
+      break;
+    }
+    default:
+      throw std::runtime_error{"XNNPACK Conv: unsupported data type"};
+  }
   if (status != xnn_status_success)
   {
-    throw std::runtime_error{"failed to create FP32 Convolution operator"};
+    throw std::runtime_error{"failed to create Convolution operator"};
   }
   assert(_kernel_op != nullptr);
   return true;
@@ -131,13 +192,33 @@ bool ConvolutionLayer::setup()
   uint32_t input_width = _input->getShape().dim(2);
   uint32_t input_height = _input->getShape().dim(1);
   uint32_t batch_size = _input->getShape().dim(0);
-  enum xnn_status status = xnn_setup_convolution2d_nhwc_f32(
-    _kernel_op, batch_size, input_height, input_width,
-    reinterpret_cast<const float *>(_input->buffer()), reinterpret_cast<float *>(_output->buffer()),
-    _external_context->getThreadPool());
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      status = xnn_setup_convolution2d_nhwc_f32(
+        _kernel_op, batch_size, input_height, input_width,
+        reinterpret_cast<const float *>(_input->buffer()),
+        reinterpret_cast<float *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      status = xnn_setup_convolution2d_nhwc_qu8(
+        _kernel_op, batch_size, input_height, input_width,
+        reinterpret_cast<const uint8_t *>(_input->buffer()),
+        reinterpret_cast<uint8_t *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      status = xnn_setup_convolution2d_nhwc_qs8(
+        _kernel_op, batch_size, input_height, input_width,
+        reinterpret_cast<const int8_t *>(_input->buffer()),
+        reinterpret_cast<int8_t *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    default:
+      throw std::runtime_error{"XNNPACK Conv: unsupported data type"};
+  }
   if (status != xnn_status_success)
   {
-    throw std::runtime_error{"failed to create FP32 Convolution operator"};
+    throw std::runtime_error{"failed to setup Convolution operator"};
   }
   return true;
 }
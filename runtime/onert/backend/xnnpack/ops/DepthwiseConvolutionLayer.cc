@@ -76,12 +76,18 @@ void DepthwiseConvolutionLayer::run()
     assert(_setup);
   }
 
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (isSupportedDataType(_input->data_type()))
   {
-    enum xnn_status status = xnn_run_operator(_kernel_op, _external_context->getThreadPool());
+    // Each output element takes a multiply-accumulate per kernel element of its channel
+    const auto &kernel_shape = _kernel->getShape();
+    const auto lease = _external_context->leaseThreads(
+      static_cast<uint64_t>(_output->getShape().num_elements()) * kernel_shape.dim(1) *
+      kernel_shape.dim(2));
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
     if (status != xnn_status_success)
     {
-      throw std::runtime_error{"failed to run FP32 DepthwiseConvolution operator"};
+      throw std::runtime_error{"failed to run DepthwiseConvolution operator"};
     }
   }
   else
@@ -92,9 +98,6 @@ void DepthwiseConvolutionLayer::run()
 
 bool DepthwiseConvolutionLayer::create()
 {
-  float output_activation_min = 0.f, output_activation_max = 0.f;
-  CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
-
   // NHWC
   // Kernel format is [1, kernel_height, kernel_width, depth_out].
   const auto &kernel_shape = _kernel->getShape();
@@ -105,17 +108,75 @@ bool DepthwiseConvolutionLayer::create()
   assert(static_cast<uint32_t>(_output->getShape().dim(3)) == output_channels);
   assert(output_channels == input_channels * _multiplier);
 
-  enum xnn_status status = xnn_create_convolution2d_nhwc_f32(
-    _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
-    _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor,
-    input_channels /* groups */, 1 /* group_input_channels */,
-    _multiplier /* group_output_channels */, input_channels /* input_channel_stride */,
-    output_channels /* output_channel_stride */, reinterpret_cast<const float *>(_kernel->buffer()),
-    reinterpret_cast<const float *>(_bias->buffer()), output_activation_min, output_activation_max,
-    XNN_FLAG_DEPTHWISE_CONVOLUTION, &_kernel_op);
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+    {
+      float output_activation_min = 0.f, output_activation_max = 0.f;
+      CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
+      status = xnn_create_convolution2d_nhwc_f32(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
+        _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor,
+        input_channels /* groups */, 1 /* group_input_channels */,
+        _multiplier /* group_output_channels */, input_channels /* input_channel_stride */,
+        output_channels /* output_channel_stride */,
+        reinterpret_cast<const float *>(_kernel->buffer()),
+        reinterpret_cast<const float *>(_bias->buffer()), output_activation_min,
+        output_activation_max, XNN_FLAG_DEPTHWISE_CONVOLUTION, &_kernel_op);
+      break;
+    }
+    case OperandType::QUANT_UINT8_ASYMM:
+    {
+      uint8_t output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      float kernel_scale = 0.f;
+      int32_t kernel_zero_point = 0;
+      getKernelQuantization(_kernel, &kernel_scale, &kernel_zero_point);
+      status = xnn_create_convolution2d_nhwc_qu8(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
+        _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor,
+        input_channels /* groups */, 1 /* group_input_channels */,
+        _multiplier /* group_output_channels */, input_channels /* input_channel_stride */,
+        output_channels /* output_channel_stride */,
+        static_cast<uint8_t>(_input->data_zero_point()), _input->data_scale(),
+        static_cast<uint8_t>(kernel_zero_point), kernel_scale,
+        reinterpret_cast<const uint8_t *>(_kernel->buffer()),
+        reinterpret_cast<const int32_t *>(_bias->buffer()),
+        static_cast<uint8_t>(_output->data_zero_point()), _output->data_scale(),
+        output_activation_min, output_activation_max, XNN_FLAG_DEPTHWISE_CONVOLUTION, &_kernel_op);
+      break;
+    }
+    case OperandType::QUANT_INT8_ASYMM:
+    {
+      int8_t output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      float kernel_scale = 0.f;
+      int32_t kernel_zero_point = 0;
+      getKernelQuantization(_kernel, &kernel_scale, &kernel_zero_point);
+      if (kernel_zero_point != 0)
+        throw std::runtime_error{"XNNPACK DepthwiseConvolution: int8 kernel must be symmetric"};
+      status = xnn_create_convolution2d_nhwc_qs8(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, kernel_height, kernel_width,
+        _stride_height, _stride_width, _dilation_height_factor, _dilation_width_factor,
+        input_channels /* groups */, 1 /* group_input_channels */,
+        _multiplier /* group_output_channels */, input_channels /* input_channel_stride */,
+        output_channels /* output_channel_stride */,
+        static_cast<int8_t>(_input->data_zero_point()), _input->data_scale(), kernel_scale,
+        reinterpret_cast<const int8_t *>(_kernel->buffer()),
+        reinterpret_cast<const int32_t *>(_bias->buffer()),
+        static_cast<int8_t>(_output->data_zero_point()), _output->data_scale(),
+        output_activation_min, output_activation_max, XNN_FLAG_DEPTHWISE_CONVOLUTION, &_kernel_op);
+      break;
+    }
+    default:
+      throw std::runtime_error{"XNNPACK DepthwiseConv: unsupported data type"};
+  }
   if (status != xnn_status_success)
   {
-    throw std::runtime_error{"failed to create FP32 DepthwiseConvolution operator"};
+    throw std::runtime_error{"failed to create DepthwiseConvolution operator"};
   }
   assert(_kernel_op != nullptr);
   return true;
@@ -132,13 +193,33 @@ bool DepthwiseConvolutionLayer::setup()
   uint32_t input_width = _input->getShape().dim(2);
   uint32_t input_height = _input->getShape().dim(1);
   uint32_t batch_size = _input->getShape().dim(0);
-  enum xnn_status status = xnn_setup_convolution2d_nhwc_f32(
-    _kernel_op, batch_size, input_height, input_width,
-    reinterpret_cast<const float *>(_input->buffer()), reinterpret_cast<float *>(_output->buffer()),
-    _external_context->getThreadPool());
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      status = xnn_setup_convolution2d_nhwc_f32(
+        _kernel_op, batch_size, input_height, input_width,
+        reinterpret_cast<const float *>(_input->buffer()),
+        reinterpret_cast<float *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      status = xnn_setup_convolution2d_nhwc_qu8(
+        _kernel_op, batch_size, input_height, input_width,
+        reinterpret_cast<const uint8_t *>(_input->buffer()),
+        reinterpret_cast<uint8_t *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      status = xnn_setup_convolution2d_nhwc_qs8(
+        _kernel_op, batch_size, input_height, input_width,
+        reinterpret_cast<const int8_t *>(_input->buffer()),
+        reinterpret_cast<int8_t *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    default:
+      throw std::runtime_error{"XNNPACK DepthwiseConv: unsupported data type"};
+  }
   if (status != xnn_status_success)
   {
-    throw std::runtime_error{"failed to create FP32 DepthwiseConvolution operator"};
+    throw std::runtime_error{"failed to setup DepthwiseConvolution operator"};
   }
   return true;
 }
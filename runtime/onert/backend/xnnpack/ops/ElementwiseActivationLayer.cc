@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ElementwiseActivationLayer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+ElementwiseActivationLayer::ElementwiseActivationLayer(
+  const std::shared_ptr<ExternalContext> external_context)
+  : Layer(external_context), _input(nullptr), _output(nullptr), _alpha(0.f), _beta(0.f),
+    _op_type(ElementwiseActivationType::kReLU)
+{
+  // DO NOTHING
+}
+
+void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                                           float alpha, float beta,
+                                           const ElementwiseActivationType op_type)
+{
+  _input = input;
+  _output = output;
+  _alpha = alpha;
+  _beta = beta;
+  _op_type = op_type;
+}
+
+void ElementwiseActivationLayer::run()
+{
+  assert(_external_context && _external_context->getThreadPool());
+  if (!_setup)
+  {
+    _setup = setup();
+    assert(_setup);
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
+    if (status != xnn_status_success)
+    {
+      throw std::runtime_error{"failed to run FP32 ElementwiseActivation operator"};
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"XNNPACK ElementwiseActivation: unsupported data type"};
+  }
+}
+
+bool ElementwiseActivationLayer::create()
+{
+  // Elements are taken as a batch of rows of the last dimension
+  const auto &input_shape = _input->getShape();
+  const uint32_t channels = (input_shape.rank() == 0) ? 1 : input_shape.dim(input_shape.rank() - 1);
+
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_op_type)
+  {
+    case ElementwiseActivationType::kLogistic:
+      status = xnn_create_sigmoid_nc_f32(channels, channels /* input_stride */,
+                                         channels /* output_stride */, 0, &_kernel_op);
+      break;
+    case ElementwiseActivationType::kReLU:
+      status = xnn_create_clamp_nc_f32(channels, channels /* input_stride */,
+                                       channels /* output_stride */, _beta, _alpha, 0, &_kernel_op);
+      break;
+    case ElementwiseActivationType::kLeakyReLU:
+      status =
+        xnn_create_leaky_relu_nc_f32(channels, channels /* input_stride */,
+                                     channels /* output_stride */, _alpha, 0, &_kernel_op);
+      break;
+  }
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 ElementwiseActivation operator"};
+  }
+  assert(_kernel_op != nullptr);
+  return true;
+}
+
+bool ElementwiseActivationLayer::setup()
+{
+  if (_input->buffer() == nullptr || _output->buffer() == nullptr)
+  {
+    // it could be models's input or output
+    return false;
+  }
+
+  const auto &input_shape = _input->getShape();
+  const uint32_t channels = (input_shape.rank() == 0) ? 1 : input_shape.dim(input_shape.rank() - 1);
+  const size_t batch_size = (channels == 0) ? 0 : input_shape.num_elements() / channels;
+  const float *input_buffer = reinterpret_cast<const float *>(_input->buffer());
+  float *output_buffer = reinterpret_cast<float *>(_output->buffer());
+
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_op_type)
+  {
+    case ElementwiseActivationType::kLogistic:
+      status = xnn_setup_sigmoid_nc_f32(_kernel_op, batch_size, input_buffer, output_buffer,
+                                        _external_context->getThreadPool());
+      break;
+    case ElementwiseActivationType::kReLU:
+      status = xnn_setup_clamp_nc_f32(_kernel_op, batch_size, input_buffer, output_buffer,
+                                      _external_context->getThreadPool());
+      break;
+    case ElementwiseActivationType::kLeakyReLU:
+      status = xnn_setup_leaky_relu_nc_f32(_kernel_op, batch_size, input_buffer, output_buffer,
+                                           _external_context->getThreadPool());
+      break;
+  }
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 ElementwiseActivation operator"};
+  }
+  return true;
+}
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
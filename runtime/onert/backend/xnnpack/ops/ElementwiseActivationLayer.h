@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_XNNPACK_OPS_ELEMENTWISE_ACTIVATION_LAYER_H__
+#define __ONERT_BACKEND_XNNPACK_OPS_ELEMENTWISE_ACTIVATION_LAYER_H__
+
+#include "Layer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+enum class ElementwiseActivationType
+{
+  kLogistic,
+  kReLU,
+  kLeakyReLU
+};
+
+class ElementwiseActivationLayer : public Layer
+{
+public:
+  ElementwiseActivationLayer(const std::shared_ptr<ExternalContext> external_context);
+
+public:
+  /**
+   * @brief Configure the activation
+   *
+   * @param alpha Upper bound of ReLU, or slope of LeakyReLU for negative inputs
+   * @param beta  Lower bound of ReLU
+   */
+  void configure(const IPortableTensor *input, IPortableTensor *output, float alpha, float beta,
+                 const ElementwiseActivationType op_type);
+
+  void run() override;
+
+  bool create() override;
+  bool setup() override;
+
+private:
+  const IPortableTensor *_input;
+  IPortableTensor *_output;
+
+  float _alpha;
+  float _beta;
+  ElementwiseActivationType _op_type;
+};
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_XNNPACK_OPS_ELEMENTWISE_ACTIVATION_LAYER_H__
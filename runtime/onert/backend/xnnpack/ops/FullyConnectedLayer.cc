@@ -60,12 +60,15 @@ void FullyConnectedLayer::run()
     assert(_setup);
   }
 
-  if (_input->data_type() == OperandType::FLOAT32)
+  if (isSupportedDataType(_input->data_type()))
   {
-    enum xnn_status status = xnn_run_operator(_kernel_op, _external_context->getThreadPool());
+    const auto lease = _external_context->leaseThreads(
+      static_cast<uint64_t>(_output->getShape().num_elements()) * _kernel->getShape().dim(1));
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
     if (status != xnn_status_success)
     {
-      throw std::runtime_error{"failed to run FP32 FullyConnected operator"};
+      throw std::runtime_error{"failed to run FullyConnected operator"};
     }
   }
   else
@@ -76,9 +79,6 @@ void FullyConnectedLayer::run()
 
 bool FullyConnectedLayer::create()
 {
-  float output_activation_min = 0.f, output_activation_max = 0.f;
-  CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
-
   const auto &kernel_shape = _kernel->getShape();
   assert(kernel_shape.rank() == 2);
   uint32_t output_channels = kernel_shape.dim(0);
@@ -98,16 +98,65 @@ bool FullyConnectedLayer::create()
   }
 
   assert(_kernel && _kernel->buffer());
-  const float *kernel_buffer = reinterpret_cast<const float *>(_kernel->buffer());
-  const float *bias_buffer = (_bias) ? reinterpret_cast<const float *>(_bias->buffer()) : nullptr;
+  const void *bias_buffer = (_bias) ? _bias->buffer() : nullptr;
 
-  enum xnn_status status = xnn_create_fully_connected_nc_f32(
-    input_channels, output_channels, input_channels /* input stride */,
-    output_channels /* output stride */, kernel_buffer, bias_buffer, output_activation_min,
-    output_activation_max, flag, &_kernel_op);
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+    {
+      float output_activation_min = 0.f, output_activation_max = 0.f;
+      CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
+      status = xnn_create_fully_connected_nc_f32(
+        input_channels, output_channels, input_channels /* input stride */,
+        output_channels /* output stride */, reinterpret_cast<const float *>(_kernel->buffer()),
+        reinterpret_cast<const float *>(bias_buffer), output_activation_min,
+        output_activation_max, flag, &_kernel_op);
+      break;
+    }
+    case OperandType::QUANT_UINT8_ASYMM:
+    {
+      uint8_t output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      float kernel_scale = 0.f;
+      int32_t kernel_zero_point = 0;
+      getKernelQuantization(_kernel, &kernel_scale, &kernel_zero_point);
+      status = xnn_create_fully_connected_nc_qu8(
+        input_channels, output_channels, input_channels /* input stride */,
+        output_channels /* output stride */, static_cast<uint8_t>(_input->data_zero_point()),
+        _input->data_scale(), static_cast<uint8_t>(kernel_zero_point), kernel_scale,
+        reinterpret_cast<const uint8_t *>(_kernel->buffer()),
+        reinterpret_cast<const int32_t *>(bias_buffer),
+        static_cast<uint8_t>(_output->data_zero_point()), _output->data_scale(),
+        output_activation_min, output_activation_max, flag, &_kernel_op);
+      break;
+    }
+    case OperandType::QUANT_INT8_ASYMM:
+    {
+      int8_t output_activation_min = 0, output_activation_max = 0;
+      CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      float kernel_scale = 0.f;
+      int32_t kernel_zero_point = 0;
+      getKernelQuantization(_kernel, &kernel_scale, &kernel_zero_point);
+      if (kernel_zero_point != 0)
+        throw std::runtime_error{"XNNPACK FullyConnected: int8 kernel must be symmetric"};
+      status = xnn_create_fully_connected_nc_qs8(
+        input_channels, output_channels, input_channels /* input stride */,
+        output_channels /* output stride */, static_cast<int8_t>(_input->data_zero_point()),
+        _input->data_scale(), kernel_scale, reinterpret_cast<const int8_t *>(_kernel->buffer()),
+        reinterpret_cast<const int32_t *>(bias_buffer),
+        static_cast<int8_t>(_output->data_zero_point()), _output->data_scale(),
+        output_activation_min, output_activation_max, flag, &_kernel_op);
+      break;
+    }
+    default:
+      throw std::runtime_error{"XNNPACK FC: unsupported data type"};
+  }
   if (status != xnn_status_success)
   {
-    throw std::runtime_error{"failed to create FP32 FullyConnected operator"};
+    throw std::runtime_error{"failed to create FullyConnected operator"};
   }
   assert(_kernel_op != nullptr);
   return true;
@@ -122,12 +171,30 @@ bool FullyConnectedLayer::setup()
   }
 
   uint32_t batch_size = _input->getShape().num_elements() / _kernel->getShape().dim(1);
-  enum xnn_status status = xnn_setup_fully_connected_nc_f32(
-    _kernel_op, batch_size, reinterpret_cast<const float *>(_input->buffer()),
-    reinterpret_cast<float *>(_output->buffer()), _external_context->getThreadPool());
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      status = xnn_setup_fully_connected_nc_f32(
+        _kernel_op, batch_size, reinterpret_cast<const float *>(_input->buffer()),
+        reinterpret_cast<float *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      status = xnn_setup_fully_connected_nc_qu8(
+        _kernel_op, batch_size, reinterpret_cast<const uint8_t *>(_input->buffer()),
+        reinterpret_cast<uint8_t *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+      status = xnn_setup_fully_connected_nc_qs8(
+        _kernel_op, batch_size, reinterpret_cast<const int8_t *>(_input->buffer()),
+        reinterpret_cast<int8_t *>(_output->buffer()), _external_context->getThreadPool());
+      break;
+    default:
+      throw std::runtime_error{"XNNPACK FC: unsupported data type"};
+  }
   if (status != xnn_status_success)
   {
-    throw std::runtime_error{"failed to create FP32 FullyConnected operator"};
+    throw std::runtime_error{"failed to setup FullyConnected operator"};
   }
   return true;
 }
@@ -17,11 +17,18 @@
 #ifndef __ONERT_BACKEND_XNNPACK_OPS_OPERATION_UTILS_H__
 #define __ONERT_BACKEND_XNNPACK_OPS_OPERATION_UTILS_H__
 
+#include <backend/IPortableTensor.h>
 #include <ir/DataType.h>
 #include <ir/InternalType.h>
 #include <ir/Padding.h>
 #include <util/CalculateActivationRange.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -34,6 +41,73 @@ namespace ops
 using OperandType = ir::DataType;
 using namespace onert::util; // CalculateActivationRange
 
+/**
+ * @brief Check whether operators of XNNPACK take the data type, i.e. FP32 or 8-bit asymmetric
+ *        quantized ones of XNNPACK's qu8 and qs8
+ */
+inline bool isSupportedDataType(OperandType type)
+{
+  return type == OperandType::FLOAT32 || type == OperandType::QUANT_UINT8_ASYMM ||
+         type == OperandType::QUANT_INT8_ASYMM;
+}
+
+/**
+ * @brief Calculate the range of a quantized output, which the fused activation narrows
+ */
+template <typename T>
+void CalculateActivationRangeQuantized(ir::Activation activation, const IPortableTensor *output,
+                                       T *act_min, T *act_max)
+{
+  const int32_t qmin = std::numeric_limits<T>::min();
+  const int32_t qmax = std::numeric_limits<T>::max();
+  const auto scale = output->data_scale();
+  const auto zero_point = output->data_zero_point();
+  auto quantize = [scale, zero_point](float f) {
+    return zero_point + static_cast<int32_t>(std::round(f / scale));
+  };
+
+  float float_min = 0.f, float_max = 0.f;
+  CalculateActivationRange<float>(activation, &float_min, &float_max);
+  const int32_t min = (activation == ir::Activation::NONE) ? qmin : quantize(float_min);
+  const bool unbounded = activation == ir::Activation::NONE || activation == ir::Activation::RELU;
+  const int32_t max = unbounded ? qmax : quantize(float_max);
+  *act_min = static_cast<T>(std::max(qmin, min));
+  *act_max = static_cast<T>(std::min(qmax, max));
+}
+
+/**
+ * @brief Get the quantization of a kernel, which XNNPACK takes per tensor
+ *
+ * A kernel quantized per channel is taken if all the channels have the same quantization.
+ */
+inline void getKernelQuantization(const IPortableTensor *kernel, float *scale,
+                                  int32_t *zero_point)
+{
+  const auto &scales = kernel->data_scales();
+  const auto &zero_points = kernel->data_zero_points();
+  if (scales.empty() ||
+      std::any_of(scales.begin(), scales.end(), [&](float s) { return s != scales[0]; }) ||
+      std::any_of(zero_points.begin(), zero_points.end(),
+                  [&](int32_t z) { return z != zero_points[0]; }))
+  {
+    throw std::runtime_error{"XNNPACK: kernels quantized per channel are not supported"};
+  }
+  *scale = scales[0];
+  *zero_point = zero_points.empty() ? 0 : zero_points[0];
+}
+
+/**
+ * @brief Get the dimensions of a tensor as XNNPACK takes them for N-dimensional operators
+ */
+inline std::vector<size_t> getDims(const IPortableTensor *tensor)
+{
+  const auto &shape = tensor->getShape();
+  std::vector<size_t> dims(shape.rank());
+  for (int i = 0; i < shape.rank(); ++i)
+    dims[i] = shape.dim(i);
+  return dims;
+}
+
 } // namespace ops
 } // namespace xnnpack
 } // namespace backend
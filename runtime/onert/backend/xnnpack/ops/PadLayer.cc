@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PadLayer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+PadLayer::PadLayer(const std::shared_ptr<ExternalContext> external_context)
+  : Layer(external_context), _input(nullptr), _pad(nullptr), _value(nullptr), _output(nullptr),
+    _padding_value(0.f), _pre_paddings(), _post_paddings()
+{
+  // DO NOTHING
+}
+
+void PadLayer::configure(const IPortableTensor *input, const IPortableTensor *pad,
+                         const IPortableTensor *value, IPortableTensor *output)
+{
+  _input = input;
+  _pad = pad;
+  _value = value;
+  _output = output;
+
+  assert(_pad->is_constant() && (_value == nullptr || _value->is_constant()));
+}
+
+void PadLayer::run()
+{
+  assert(_external_context && _external_context->getThreadPool());
+  if (!_setup)
+  {
+    _setup = setup();
+    assert(_setup);
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
+    if (status != xnn_status_success)
+    {
+      throw std::runtime_error{"failed to run FP32 Pad operator"};
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"XNNPACK Pad: unsupported data type"};
+  }
+}
+
+bool PadLayer::create()
+{
+  // Paddings are [rank, 2] of the elements before and after each dimension
+  const auto rank = _input->getShape().rank();
+  assert(_pad->getShape().num_elements() == static_cast<uint64_t>(rank) * 2);
+  const int32_t *pad_buffer = reinterpret_cast<const int32_t *>(_pad->buffer());
+  _pre_paddings.resize(rank);
+  _post_paddings.resize(rank);
+  for (int i = 0; i < rank; ++i)
+  {
+    _pre_paddings[i] = pad_buffer[i * 2];
+    _post_paddings[i] = pad_buffer[i * 2 + 1];
+  }
+  if (_value)
+    _padding_value = *reinterpret_cast<const float *>(_value->buffer());
+
+  // The value is copied into the operator, which pads 32-bit elements of any type
+  enum xnn_status status = xnn_create_constant_pad_nd_x32(&_padding_value, 0, &_kernel_op);
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 Pad operator"};
+  }
+  assert(_kernel_op != nullptr);
+  return true;
+}
+
+bool PadLayer::setup()
+{
+  if (_input->buffer() == nullptr || _output->buffer() == nullptr)
+  {
+    // it could be models's input or output
+    return false;
+  }
+
+  const auto input_dims = getDims(_input);
+  enum xnn_status status = xnn_setup_constant_pad_nd_x32(
+    _kernel_op, input_dims.size(), input_dims.data(), _pre_paddings.data(), _post_paddings.data(),
+    _input->buffer(), _output->buffer(), _external_context->getThreadPool());
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 Pad operator"};
+  }
+  return true;
+}
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PoolLayer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+PoolLayer::PoolLayer(const std::shared_ptr<ExternalContext> external_context)
+  : Layer(external_context), _input(nullptr), _output(nullptr), _padding_left(0), _padding_top(0),
+    _padding_right(0), _padding_bottom(0), _stride_width(0), _stride_height(0), _kernel_width(0),
+    _kernel_height(0), _activation(ir::Activation::NONE), _op_type(PoolType::kMax)
+{
+  // DO NOTHING
+}
+
+void PoolLayer::configure(const IPortableTensor *input, const uint32_t padding_left,
+                          const uint32_t padding_right, const uint32_t padding_top,
+                          const uint32_t padding_bottom, const uint32_t stride_width,
+                          const uint32_t stride_height, const uint32_t kernel_width,
+                          const uint32_t kernel_height, const ir::Activation activation,
+                          IPortableTensor *output, const PoolType op_type)
+{
+  _input = input;
+  _padding_left = padding_left;
+  _padding_right = padding_right;
+  _padding_top = padding_top;
+  _padding_bottom = padding_bottom;
+  _stride_width = stride_width;
+  _stride_height = stride_height;
+  _kernel_width = kernel_width;
+  _kernel_height = kernel_height;
+  _activation = activation;
+  _output = output;
+  _op_type = op_type;
+
+  // TODO Support not nhwc layer
+  assert(_input->layout() == ir::Layout::NHWC);
+
+  assert(_activation == ir::Activation::NONE || _activation == ir::Activation::RELU ||
+         _activation == ir::Activation::RELU1 || _activation == ir::Activation::RELU6);
+}
+
+void PoolLayer::run()
+{
+  assert(_external_context && _external_context->getThreadPool());
+  if (!_setup)
+  {
+    _setup = setup();
+    assert(_setup);
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    // Each output element takes an element of the input per kernel element
+    const auto lease = _external_context->leaseThreads(
+      static_cast<uint64_t>(_output->getShape().num_elements()) * _kernel_height * _kernel_width);
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
+    if (status != xnn_status_success)
+    {
+      throw std::runtime_error{"failed to run FP32 Pool operator"};
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"XNNPACK Pool: unsupported data type"};
+  }
+}
+
+bool PoolLayer::create()
+{
+  float output_activation_min = 0.f, output_activation_max = 0.f;
+  CalculateActivationRange<float>(_activation, &output_activation_min, &output_activation_max);
+
+  // NHWC
+  const uint32_t channels = _input->getShape().dim(3);
+  assert(static_cast<uint32_t>(_output->getShape().dim(3)) == channels);
+
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_op_type)
+  {
+    case PoolType::kMax:
+      status = xnn_create_max_pooling2d_nhwc_f32(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, _kernel_height,
+        _kernel_width, _stride_height, _stride_width, 1 /* dilation_height */,
+        1 /* dilation_width */, channels, channels /* input_pixel_stride */,
+        channels /* output_pixel_stride */, output_activation_min, output_activation_max, 0,
+        &_kernel_op);
+      break;
+    case PoolType::kAvg:
+      // Padded elements are not counted in averages, as in TensorFlow Lite
+      status = xnn_create_average_pooling2d_nhwc_f32(
+        _padding_top, _padding_right, _padding_bottom, _padding_left, _kernel_height,
+        _kernel_width, _stride_height, _stride_width, channels, channels /* input_pixel_stride */,
+        channels /* output_pixel_stride */, output_activation_min, output_activation_max, 0,
+        &_kernel_op);
+      break;
+  }
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 Pool operator"};
+  }
+  assert(_kernel_op != nullptr);
+  return true;
+}
+
+bool PoolLayer::setup()
+{
+  if (_input->buffer() == nullptr || _output->buffer() == nullptr)
+  {
+    // it could be models's input or output
+    return false;
+  }
+
+  uint32_t input_width = _input->getShape().dim(2);
+  uint32_t input_height = _input->getShape().dim(1);
+  uint32_t batch_size = _input->getShape().dim(0);
+  const float *input_buffer = reinterpret_cast<const float *>(_input->buffer());
+  float *output_buffer = reinterpret_cast<float *>(_output->buffer());
+
+  enum xnn_status status = xnn_status_unsupported_parameter;
+  switch (_op_type)
+  {
+    case PoolType::kMax:
+      status = xnn_setup_max_pooling2d_nhwc_f32(_kernel_op, batch_size, input_height, input_width,
+                                                input_buffer, output_buffer,
+                                                _external_context->getThreadPool());
+      break;
+    case PoolType::kAvg:
+      status = xnn_setup_average_pooling2d_nhwc_f32(_kernel_op, batch_size, input_height,
+                                                    input_width, input_buffer, output_buffer,
+                                                    _external_context->getThreadPool());
+      break;
+  }
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 Pool operator"};
+  }
+  return true;
+}
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
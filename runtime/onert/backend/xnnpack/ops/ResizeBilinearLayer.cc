@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ResizeBilinearLayer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+ResizeBilinearLayer::ResizeBilinearLayer(const std::shared_ptr<ExternalContext> external_context)
+  : Layer(external_context), _input(nullptr), _output(nullptr), _align_corners(false),
+    _half_pixel_centers(false)
+{
+  // DO NOTHING
+}
+
+void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
+                                    bool align_corners, bool half_pixel_centers)
+{
+  _input = input;
+  _output = output;
+  _align_corners = align_corners;
+  _half_pixel_centers = half_pixel_centers;
+
+  // TODO Support not nhwc layer
+  assert(_input->layout() == ir::Layout::NHWC);
+
+  // XNNPACK aligns corners only with the coordinates of TensorFlow 2
+  assert(!(_align_corners && _half_pixel_centers));
+}
+
+void ResizeBilinearLayer::run()
+{
+  assert(_external_context && _external_context->getThreadPool());
+  if (!_setup)
+  {
+    _setup = setup();
+    assert(_setup);
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    // Each output element interpolates 4 input elements
+    const auto lease = _external_context->leaseThreads(
+      static_cast<uint64_t>(_output->getShape().num_elements()) * 4);
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
+    if (status != xnn_status_success)
+    {
+      throw std::runtime_error{"failed to run FP32 ResizeBilinear operator"};
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"XNNPACK ResizeBilinear: unsupported data type"};
+  }
+}
+
+bool ResizeBilinearLayer::create()
+{
+  // NHWC
+  const uint32_t channels = _input->getShape().dim(3);
+  assert(static_cast<uint32_t>(_output->getShape().dim(3)) == channels);
+
+  // Pixel centers are at integer coordinates without half_pixel_centers, as in TensorFlow 1
+  uint32_t flags = 0;
+  if (_align_corners)
+    flags |= XNN_FLAG_ALIGN_CORNERS;
+  else if (!_half_pixel_centers)
+    flags |= XNN_FLAG_TENSORFLOW_LEGACY_MODE;
+
+  enum xnn_status status = xnn_create_resize_bilinear2d_nhwc_f32(
+    channels, channels /* input_pixel_stride */, channels /* output_pixel_stride */, flags,
+    &_kernel_op);
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 ResizeBilinear operator"};
+  }
+  assert(_kernel_op != nullptr);
+  return true;
+}
+
+bool ResizeBilinearLayer::setup()
+{
+  if (_input->buffer() == nullptr || _output->buffer() == nullptr)
+  {
+    // it could be models's input or output
+    return false;
+  }
+
+  const auto &input_shape = _input->getShape();
+  const auto &output_shape = _output->getShape();
+  enum xnn_status status = xnn_setup_resize_bilinear2d_nhwc_f32(
+    _kernel_op, input_shape.dim(0), input_shape.dim(1), input_shape.dim(2), output_shape.dim(1),
+    output_shape.dim(2), reinterpret_cast<const float *>(_input->buffer()),
+    reinterpret_cast<float *>(_output->buffer()), _external_context->getThreadPool());
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 ResizeBilinear operator"};
+  }
+  return true;
+}
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
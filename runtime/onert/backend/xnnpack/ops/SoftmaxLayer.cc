@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SoftmaxLayer.h"
+
+namespace onert
+{
+namespace backend
+{
+namespace xnnpack
+{
+namespace ops
+{
+
+SoftmaxLayer::SoftmaxLayer(const std::shared_ptr<ExternalContext> external_context)
+  : Layer(external_context), _input(nullptr), _output(nullptr)
+{
+  // DO NOTHING
+}
+
+void SoftmaxLayer::configure(const IPortableTensor *input, IPortableTensor *output)
+{
+  _input = input;
+  _output = output;
+}
+
+void SoftmaxLayer::run()
+{
+  assert(_external_context && _external_context->getThreadPool());
+  if (!_setup)
+  {
+    _setup = setup();
+    assert(_setup);
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    const auto lease = _external_context->leaseThreads(_output->getShape().num_elements());
+    enum xnn_status status =
+      xnn_run_operator(_kernel_op, _external_context->getThreadPool(lease.threads()));
+    if (status != xnn_status_success)
+    {
+      throw std::runtime_error{"failed to run FP32 Softmax operator"};
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"XNNPACK Softmax: unsupported data type"};
+  }
+}
+
+bool SoftmaxLayer::create()
+{
+  const auto &input_shape = _input->getShape();
+  const uint32_t channels = input_shape.dim(input_shape.rank() - 1);
+
+  enum xnn_status status = xnn_create_softmax_nc_f32(
+    channels, channels /* input_stride */, channels /* output_stride */, 0, &_kernel_op);
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 Softmax operator"};
+  }
+  assert(_kernel_op != nullptr);
+  return true;
+}
+
+bool SoftmaxLayer::setup()
+{
+  if (_input->buffer() == nullptr || _output->buffer() == nullptr)
+  {
+    // it could be models's input or output
+    return false;
+  }
+
+  const auto &input_shape = _input->getShape();
+  const uint32_t batch_size =
+    input_shape.num_elements() / input_shape.dim(input_shape.rank() - 1);
+  enum xnn_status status = xnn_setup_softmax_nc_f32(
+    _kernel_op, batch_size, reinterpret_cast<const float *>(_input->buffer()),
+    reinterpret_cast<float *>(_output->buffer()), _external_context->getThreadPool());
+  if (status != xnn_status_success)
+  {
+    throw std::runtime_error{"failed to create FP32 Softmax operator"};
+  }
+  return true;
+}
+
+} // namespace ops
+} // namespace xnnpack
+} // namespace backend
+} // namespace onert
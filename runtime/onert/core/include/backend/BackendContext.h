@@ -70,6 +70,27 @@ public:
 
   virtual ITensorRegistry *genTensors() = 0;
   virtual FunctionMap genKernels() = 0;
+  /**
+   * @brief  Get the peak memory use of tensors since the last call
+   * @return Bytes of memory, or 0 if the backend does not track it
+   */
+  virtual uint64_t takeMemoryPeak() { return 0; }
+  /**
+   * @brief  Free memory of non-constant tensors and caches while the executor is idle
+   * @param  weights Whether caches of packed weights are dropped as well
+   * @return Bytes of memory freed, or 0 if the backend does not support it
+   * @note   Values of non-constant tensors other than variable tensors are lost. The memory must be acquired again by
+   *         @c reacquireMemory before the next run.
+   */
+  virtual uint64_t releaseMemory(bool /* weights */) { return 0; }
+  /**
+   * @brief Acquire memory freed by @c releaseMemory again, and bind tensors to it
+   */
+  virtual void reacquireMemory() {}
+  /**
+   * @brief Reset variable tensors, e.g. states of LSTM kept between runs, to their initial values
+   */
+  virtual void resetStates() {}
 
 protected:
   const Backend *_backend{nullptr};
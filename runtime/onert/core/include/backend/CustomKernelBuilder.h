@@ -21,6 +21,7 @@
 #include "ir/Shape.h"
 #include "ir/DataType.h"
 
+#include <functional>
 #include <vector>
 #include <memory>
 
@@ -57,6 +58,14 @@ struct CustomKernelConfigParams
 
   char *userdata;
   size_t userdata_size;
+
+  // Tensor of the backend for scratch memory, which is taken by applyShape() and given back by
+  // deallocBuffer(). It may be null if the backend does not have one.
+  std::shared_ptr<backend::ITensor> scratch;
+  // Run fn(start, end) over ranges splitting [0, size) on threads of the backend, where cost is
+  // the estimated cost of all. It may be empty if the backend runs kernels on the caller only.
+  std::function<void(int size, uint64_t cost, const std::function<void(int, int)> &fn)>
+    parallel_for;
 };
 
 class IKernelBuilder
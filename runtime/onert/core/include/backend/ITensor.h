@@ -118,6 +118,22 @@ public:
   {
     throw std::runtime_error("This backend does not support enqueueReadBuffer");
   }
+  /**
+   * @brief Write host memory of @c ptr to the tensor without copying it to a staging buffer,
+   *        like enqueueWriteBuffer
+   * @note  The memory may be read in place until the end of the run, so it must not be written
+   *        meanwhile
+   * @return false if the memory cannot be used in place, then enqueueWriteBuffer has to be used
+   */
+  virtual bool importHostBuffer(const void *) { return false; }
+  /**
+   * @brief Return true if the transfer enqueued without blocking is done
+   */
+  virtual bool isTransferDone() { return true; }
+  /**
+   * @brief Wait until the transfer enqueued without blocking is done
+   */
+  virtual void waitTransfer() {}
 };
 
 } // namespace backend
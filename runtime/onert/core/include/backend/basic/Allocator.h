@@ -22,6 +22,8 @@
 #ifndef __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 #define __ONERT_BACKEND_BASIC_ALLOCATOR_H__
 
+#include "util/HugePages.h"
+
 #include <memory>
 
 namespace onert
@@ -37,16 +39,30 @@ namespace basic
 class Allocator
 {
 public:
-  Allocator(uint32_t capacity);
+  /**
+   * @brief Construct with memory of capacity bytes
+   * @param[in] what Label of the memory in reports of huge pages
+   */
+  Allocator(uint32_t capacity, const char *what = "tensor");
+  /**
+   * @brief Construct with memory allocated before
+   * @param[in] base Memory to own
+   */
+  Allocator(util::PageMemory &&base) : _base{std::move(base)} {}
   /**
    * @brief Get memory base pointer
    * @return base pointer
    */
   uint8_t *base() const { return _base.get(); }
   void release() { _base.reset(); }
+  /**
+   * @brief Give up the ownership of memory without freeing it
+   * @return Memory owned so far
+   */
+  util::PageMemory detach() { return std::move(_base); }
 
 private:
-  std::unique_ptr<uint8_t[]> _base;
+  util::PageMemory _base;
 };
 
 } // namespace basic
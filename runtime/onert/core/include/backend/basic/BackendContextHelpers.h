@@ -17,13 +17,17 @@
 #ifndef __ONERT_BACKEND_BASIC_BACKEND_CONTEXT_HELPERS_H__
 #define __ONERT_BACKEND_BASIC_BACKEND_CONTEXT_HELPERS_H__
 
+#include <functional>
 #include <vector>
 
 #include "ir/Index.h"
+#include "ir/OperandIndexMap.h"
 #include "compiler/GraphLowerInfo.h"
 #include "util/logging.h"
+#include "backend/Backend.h"
 #include "backend/ITensorRegistry.h"
 #include "backend/BackendContext.h"
+#include "MemoryTimeline.h"
 #include "Tensor.h"
 
 namespace onert
@@ -33,13 +37,57 @@ namespace backend
 namespace basic
 {
 
+/**
+ * @brief Predicate of a backend telling if the kernel for an operation can write its output to the
+ *        buffer of the given input
+ *
+ * Only the operations whose kernel reads each input element before writing the output element at
+ * the same offset can be accepted, e.g. elementwise operations with inputs of the output shape.
+ */
+using InPlaceChecker = std::function<bool(const ir::Operation &, const ir::OperandIndex &input)>;
+
+/**
+ * @brief Placement of a tensor in a contiguous part of the memory of another tensor
+ *
+ * A backend gives these for the operations whose kernel only copies its parts, e.g. Concat whose
+ * inputs can be written by their producers right into the output, so that it copies nothing.
+ */
+struct SubTensorView
+{
+  ir::OperandIndex parent;
+  uint32_t offset; //< Offset in bytes in the memory of the parent
+};
+using SubTensorViews = ir::OperandIndexMap<SubTensorView>;
+
 // TODO Remove the template param BackendContext once unification of cpu backend context is done
-template <typename T_BackendContext> void planTensors(const T_BackendContext &ctx)
+template <typename T_BackendContext>
+void planTensors(const T_BackendContext &ctx, const InPlaceChecker &in_place = nullptr,
+                 const SubTensorViews &views = SubTensorViews{},
+                 MemoryTimeline *timeline = nullptr)
 {
   const ir::Graph &graph = *ctx.graph();
   const auto &order = ctx.data().op_order;
   auto tensor_builder = ctx.tensor_builder;
 
+  // Notify uses to the timeline as well, at the step of the operation being scanned
+  int32_t step = -1;
+  auto notify_first_use = [&](const ir::OperandIndex &ind) {
+    tensor_builder->notifyFirstUse(ind);
+    if (timeline)
+    {
+      timeline->setStep(step);
+      timeline->notifyFirstUse(ind);
+    }
+  };
+  auto notify_last_use = [&](const ir::OperandIndex &ind) {
+    tensor_builder->notifyLastUse(ind);
+    if (timeline)
+    {
+      timeline->setStep(step);
+      timeline->notifyLastUse(ind);
+    }
+  };
+
   ir::OperandIndexMap<uint32_t> uses_map;
   ir::OperandIndexMap<uint32_t> def_map;
   ir::OperandIndexSequence constants;
@@ -81,13 +129,13 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
   for (const auto &ind : constants)
   {
     uses_map[ind]++;
-    tensor_builder->notifyFirstUse(ind);
+    notify_first_use(ind);
   }
 
   for (auto &pair : def_map)
   {
     if (pair.second == 0)
-      tensor_builder->notifyFirstUse(pair.first);
+      notify_first_use(pair.first);
   }
 
   // This is a workaround to keep the operands over the execution
@@ -99,16 +147,148 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
       operands_last_until_end.push_back(pair.first);
   }
 
+  // A static tensor which is neither constant, variable nor model I/O can share its memory
+  // with others, if the tensor is owned by this backend
+  auto is_reusable = [&](const ir::OperandIndex &ind) {
+    if (ctx.external_operands().contains(ind) || !tensor_builder->isRegistered(ind))
+      return false;
+    const auto &operand = graph.operands().at(ind);
+    return !operand.isConstant() && !operand.info().isVariable() &&
+           !operand.info().isDynamic() && !model_io.contains(ind);
+  };
+
+  // Accept the views whose parent and children are all reusable tensors defined and used here.
+  // A tensor can be a member of one parent only, and the views of a parent are accepted or
+  // rejected together since the kernel copies nothing only if all of its parts are in place.
+  // The number of members of each parent which are alive is kept, for the parent to outlive them.
+  SubTensorViews sub_tensors;
+  ir::OperandIndexMap<uint32_t> view_members;
+  {
+    auto is_member = [&](const ir::OperandIndex &ind) {
+      const auto &operand = graph.operands().at(ind);
+      return is_reusable(ind) && operand.getDef().valid() && operand.getUses().size() > 0;
+    };
+    ir::OperandIndexMap<std::vector<ir::OperandIndex>> children;
+    for (const auto &it : views)
+      children[it.second.parent].push_back(it.first);
+    for (const auto &it : children)
+    {
+      const auto &parent = it.first;
+      const auto parent_size = graph.operands().at(parent).info().total_size();
+      bool accepted = is_member(parent) && views.find(parent) == views.end();
+      for (const auto &child : it.second)
+      {
+        const auto &view = views.at(child);
+        accepted = accepted && is_member(child) && children.find(child) == children.end() &&
+                   view.offset + graph.operands().at(child).info().total_size() <= parent_size;
+      }
+      if (!accepted)
+        continue;
+      for (const auto &child : it.second)
+        sub_tensors.emplace(child, views.at(child));
+      view_members[parent] = it.second.size() + 1;
+    }
+  }
+  auto is_view_member = [&](const ir::OperandIndex &ind) {
+    return sub_tensors.find(ind) != sub_tensors.end() ||
+           view_members.find(ind) != view_members.end();
+  };
+
+  // Notify the last use of a tensor, or of its parent when the last member of it dies
+  auto release = [&](const ir::OperandIndex &ind) {
+    auto sub = sub_tensors.find(ind);
+    const auto parent = sub == sub_tensors.end() ? ind : sub->second.parent;
+    auto members = view_members.find(parent);
+    if (members == view_members.end())
+    {
+      notify_last_use(ind);
+      return;
+    }
+    assert(members->second > 0);
+    if (--members->second == 0)
+      notify_last_use(parent);
+  };
+
+  // Find inputs which can be placed in the model output buffer directly, so that the last
+  // operation does not need to copy them into the output
+  // e.g. [Conv2D] -> ((#1)) -> [Reshape] -> ((#2, model output)) lets Conv2D write #1 into #2
+  ir::OperandIndexMap<ir::OperandIndex> output_aliases;
+  if (in_place)
+  {
+    for (const auto &op_ind : order)
+    {
+      const auto &op = graph.operations().at(op_ind);
+      if (op.getOutputs().size() != 1)
+        continue;
+      const auto &output = op.getOutputs().at(0);
+      if (!output.valid() || !ctx.external_operands().contains(output) ||
+          !graph.getOutputs().contains(output) || graph.getInputs().contains(output))
+        continue;
+      const auto &output_info = graph.operands().at(output).info();
+      if (output_info.isDynamic())
+        continue;
+      for (const auto &ind : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      {
+        const auto &operand = graph.operands().at(ind);
+        if (!is_reusable(ind) || is_view_member(ind) || operand.getUses().size() != 1 ||
+            !operand.getDef().valid())
+          continue;
+        if (operand.info().total_size() != output_info.total_size())
+          continue;
+        if (in_place(op, ind))
+        {
+          output_aliases[ind] = output;
+          break;
+        }
+      }
+    }
+  }
+
+  // Find an input whose memory can be given to the only output of the operation
+  // The input must die at this operation, so that nobody can read it after the output is written
+  auto find_in_place_input = [&](const ir::Operation &op) {
+    ir::OperandIndex found;
+    if (!in_place || op.getOutputs().size() != 1)
+      return found;
+    const auto &output = op.getOutputs().at(0);
+    if (!output.valid() || !is_reusable(output) || def_map[output] == 0 ||
+        output_aliases.find(output) != output_aliases.end() || is_view_member(output))
+      return found;
+    const auto output_size = graph.operands().at(output).info().total_size();
+    for (const auto &ind : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (ind == output || !is_reusable(ind) || is_view_member(ind) || uses_map[ind] != 1 ||
+          def_map[ind] != 0)
+        continue;
+      if (graph.operands().at(ind).info().total_size() != output_size)
+        continue;
+      if (in_place(op, ind))
+      {
+        found = ind;
+        break;
+      }
+    }
+    return found;
+  };
+
   // At each operation,
   // 1. Scan DEF of outputs. If the DEF, allocate it
+  //    (If the output reuses memory of a dying input, do not allocate)
+  //    (If the output is placed in the model output, do not allocate)
+  //    (If the output is a part of another tensor, allocate that tensor instead)
   // 2. Scan DEF of inputs. If variable tensor, allocate it
   // 3. Scan USE of inputs. Decrease the USE and deallocate if the USE is 0
+  //    (The input whose memory is reused is deallocated with the output)
+  //    (The parent of tensors is deallocated when all of them and the parent are dead)
   for (const auto &op_ind : order)
   {
+    ++step;
     const auto &op = graph.operations().at(op_ind);
     auto op_inputs = op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
     auto op_outputs = op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
 
+    const auto in_place_input = find_in_place_input(op);
+
     // Define outputs
     for (const auto &ind : op_outputs)
     {
@@ -120,7 +300,39 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
       if (def_map[ind])
       {
         def_map[ind] = 0;
-        tensor_builder->notifyFirstUse(ind);
+        auto alias = output_aliases.find(ind);
+        auto sub = sub_tensors.find(ind);
+        if (sub != sub_tensors.end())
+        {
+          // The parent comes to life with the first of its members
+          const auto &parent = sub->second.parent;
+          if (def_map[parent])
+          {
+            def_map[parent] = 0;
+            notify_first_use(parent);
+          }
+          VERBOSE(planTensors) << "Operand " << ind << " is placed in " << parent << " at offset "
+                               << sub->second.offset << std::endl;
+          tensor_builder->claimSubTensor(ind, parent, sub->second.offset);
+        }
+        else if (alias != output_aliases.end())
+        {
+          VERBOSE(planTensors) << "Operand " << ind << " is placed in model output "
+                               << alias->second << std::endl;
+          tensor_builder->claimAlias(ind, alias->second);
+        }
+        else if (in_place_input.valid())
+        {
+          VERBOSE(planTensors) << "Operand " << ind << " reuses memory of " << in_place_input
+                               << std::endl;
+          tensor_builder->claimInPlace(ind, in_place_input);
+          if (timeline)
+            timeline->notifyShare(ind, in_place_input);
+        }
+        else
+        {
+          notify_first_use(ind);
+        }
       }
     }
 
@@ -140,7 +352,7 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
         assert(operand.data() == nullptr);
         assert(operand.getUses().size() == 1 && !operand.getDef().valid());
         assert(uses_map[ind] == 1 && def_map[ind] == 0);
-        tensor_builder->notifyFirstUse(ind);
+        notify_first_use(ind);
       }
     }
 
@@ -153,17 +365,19 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
       assert(uses_map.find(ind) != uses_map.end());
       assert(uses_map[ind] > 0);
       uses_map[ind]--;
-      if (uses_map[ind] == 0)
+      if (uses_map[ind] == 0 && ind != in_place_input &&
+          output_aliases.find(ind) == output_aliases.end())
       {
         // plan for deallocation of static tensornode
-        tensor_builder->notifyLastUse(ind);
+        release(ind);
       }
     }
   }
 
+  step = static_cast<int32_t>(order.size());
   for (auto &ind : operands_last_until_end)
   {
-    tensor_builder->notifyLastUse(ind);
+    notify_last_use(ind);
   }
 
   // Dispose and validate
@@ -172,7 +386,7 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
     --uses_map[ind];
     if (uses_map[ind] == 0) // To prevent notifyLastUse from being called twice
     {
-      tensor_builder->notifyLastUse(ind);
+      notify_last_use(ind);
     }
   }
 
@@ -185,7 +399,15 @@ template <typename T_BackendContext> void planTensors(const T_BackendContext &ct
                 [](std::pair<const ir::OperandIndex, uint32_t> it) { return it.second == 0; }));
 }
 
-template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContext &ctx)
+/**
+ * @brief Generate tensors of a backend and plan their memory
+ * @param[in] planned_offsets Whether tensors keep the offsets planned ahead by the model, which
+ *                            pays off when the backend runs the whole model
+ */
+template <typename T_BackendContext>
+ITensorRegistry *genTensors(T_BackendContext &ctx, const InPlaceChecker &in_place = nullptr,
+                            const SubTensorViews &views = SubTensorViews{},
+                            bool planned_offsets = false)
 {
   const ir::Graph &graph = *ctx.graph();
   auto tensor_builder = ctx.tensor_builder;
@@ -199,13 +421,20 @@ template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContex
     assert(graph.layout() != ir::Layout::NCHW);
     ir::OperandInfo backend_info{obj.shape(), obj.typeInfo(), obj.info().memAllocType(),
                                  obj.isConstant()};
+    if (planned_offsets && obj.info().hasPlannedOffset())
+      backend_info.plannedOffset(obj.info().plannedOffset());
     tensor_builder->registerTensorInfo(ind, backend_info, ir::Layout::NHWC);
   });
 
+  const auto timeline_filepath = util::getConfigString(util::config::MEMORY_TIMELINE_FILEPATH);
+  std::unique_ptr<MemoryTimeline> timeline;
+  if (!timeline_filepath.empty())
+    timeline = std::make_unique<MemoryTimeline>(ctx.data().op_order);
+
   // TODO Get compiler options from compiler, and use it rather than getting it from Env
   if (util::getConfigString(util::config::EXECUTOR) == "Linear")
   {
-    basic::planTensors(ctx);
+    basic::planTensors(ctx, in_place, views, timeline.get());
   }
   else
   {
@@ -219,6 +448,13 @@ template <typename T_BackendContext> ITensorRegistry *genTensors(T_BackendContex
 
   tensor_builder->allocate();
 
+  if (timeline)
+  {
+    const auto &static_tensor_mgr = *tensor_builder->staticTensorManager();
+    timeline->dump(timeline_filepath, ctx.backend()->config()->id(), graph,
+                   static_tensor_mgr.memoryPlans(), static_tensor_mgr.capacity());
+  }
+
   return ctx.tensor_registry.get();
 }
 
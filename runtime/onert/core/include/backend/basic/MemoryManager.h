@@ -19,6 +19,11 @@
 
 #include "Allocator.h"
 #include "IMemoryPlanner.h"
+#include "SharedArena.h"
+
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace onert
 {
@@ -35,37 +40,104 @@ class MemoryManager
 public:
   MemoryManager();
   MemoryManager(const std::string);
-  virtual ~MemoryManager() = default;
+  virtual ~MemoryManager();
 
   void allocate(void);
   uint8_t *getBuffer(const ir::OperandIndex &ind) const;
-  void deallocate(void) { _mem_alloc->release(); }
+  void deallocate(void);
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  /**
+   * @brief Plan memory with offsets planned ahead instead of the planner given by config
+   * @param[in] offsets Planned offsets of tensors
+   * @note  It must be called before any plan is claimed
+   */
+  void usePlannedOffsets(const ir::OperandIndexMap<uint32_t> &offsets);
+  /**
+   * @brief Get the size of memory planned for all tensors
+   */
+  uint32_t capacity() const { return _mem_planner->capacity(); }
+  /**
+   * @brief Get the memory planned for each tensor
+   */
+  const IMemoryPlanner::MemoryPlans &memoryPlans() const { return _mem_planner->memory_plans(); }
+
+  /**
+   * @brief Set the handler called when buffers from getBuffer are moved
+   * @note  Buffers can be moved only if the memory is in the shared arena(CPU_SHARED_ARENA)
+   */
+  void setRebindHandler(const SharedArena::RebindHandler &rebind) { _rebind = rebind; }
 
 private:
   IMemoryPlanner *createMemoryPlanner();
   IMemoryPlanner *createMemoryPlanner(const std::string);
+  void initSharedArena();
 
 private:
   ir::OperandIndexMap<Block> _tensor_mem_map;
   std::shared_ptr<IMemoryPlanner> _mem_planner;
   std::shared_ptr<Allocator> _mem_alloc;
+  std::shared_ptr<SharedArena> _shared_arena;
+  uint64_t _arena_group = 0;
+  SharedArena::RebindHandler _rebind;
 };
 
+/**
+ * @brief Memory manager for dynamic tensors
+ *
+ * Memory of deallocated tensors is kept in pools of size classes and reused by later allocations,
+ * so that running a dynamic model again does not allocate memory from the system.
+ */
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
-  virtual ~DynamicMemoryManager() = default;
+  /**
+   * @param pool_limit Bytes of free memory the pool may keep for later allocations
+   */
+  DynamicMemoryManager(uint64_t pool_limit = DEFAULT_POOL_LIMIT) : _pool_limit{pool_limit} {}
+  virtual ~DynamicMemoryManager();
 
   std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
   void deallocate(const ITensor *tensor);
   void deallocate(void);
 
+  /**
+   * @brief  Free memory kept in the pools for later allocations
+   * @return Bytes of memory freed
+   */
+  uint64_t releasePool();
+
+  uint64_t pool_hits() const { return _pool_hits; }
+  uint64_t pool_misses() const { return _pool_misses; }
+  uint64_t pool_bytes() const { return _pool_bytes; }
+  /**
+   * @brief Get the largest size of memory allocated at once since the last @c resetPeak
+   */
+  uint64_t peak() const { return _peak; }
+  void resetPeak() { _peak = _in_use; }
+
+  static constexpr uint64_t DEFAULT_POOL_LIMIT = 64 * 1024 * 1024;
+
 private:
-  std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  void trimPool();
+
+private:
+  struct Allocation
+  {
+    std::shared_ptr<Allocator> alloc;
+    uint32_t size_class;
+  };
+
+  std::unordered_map<const ITensor *, Allocation> _mem_alloc_map;
+  // Free memory for each size class, ordered to find the next larger class
+  std::map<uint32_t, std::vector<util::PageMemory>> _pool;
+  uint64_t _pool_limit;
+  uint64_t _pool_bytes = 0;
+  uint64_t _pool_hits = 0;
+  uint64_t _pool_misses = 0;
+  uint64_t _in_use = 0;
+  uint64_t _peak = 0;
 };
 
 } // namespace basic
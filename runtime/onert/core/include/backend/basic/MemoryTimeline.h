@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_BASIC_MEMORY_TIMELINE_H__
+#define __ONERT_BACKEND_BASIC_MEMORY_TIMELINE_H__
+
+#include "IMemoryPlanner.h"
+
+#include "ir/Graph.h"
+#include "ir/Index.h"
+#include "ir/OperandIndexMap.h"
+
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+/**
+ * @brief Lifetimes of tensors in the order of operations, which are dumped with their memory plans
+ *        for visualization(MEMORY_TIMELINE_FILEPATH)
+ *
+ * A lifetime is a closed interval of steps, where step @c i is the @c i th operation of the order.
+ * Step -1 is before the first operation and step @c order.size() is after the last one.
+ */
+class MemoryTimeline
+{
+public:
+  struct Lifetime
+  {
+    int32_t first;
+    int32_t last;
+  };
+
+public:
+  MemoryTimeline(const std::vector<ir::OperationIndex> &order) : _order{order} {}
+
+public:
+  /**
+   * @brief Set the step of the uses notified from now
+   */
+  void setStep(int32_t step) { _step = step; }
+  void notifyFirstUse(const ir::OperandIndex &ind);
+  void notifyLastUse(const ir::OperandIndex &ind);
+  /**
+   * @brief Let the last use of @c ind end the lifetime of @c root, whose memory @c ind reuses
+   */
+  void notifyShare(const ir::OperandIndex &ind, const ir::OperandIndex &root);
+
+  /**
+   * @brief Get the lifetime of a tensor, which is the whole run if its uses are not notified
+   */
+  Lifetime lifetime(const ir::OperandIndex &ind) const;
+
+  /**
+   * @brief Add the plans of a backend with their lifetimes to the dump file
+   * @note  The file has the plans of all backends added in this process so far
+   */
+  void dump(const std::string &filepath, const std::string &backend_id, const ir::Graph &graph,
+            const IMemoryPlanner::MemoryPlans &plans, uint32_t capacity) const;
+
+private:
+  std::vector<ir::OperationIndex> _order;
+  int32_t _step = -1;
+  ir::OperandIndexMap<Lifetime> _lifetimes;
+  ir::OperandIndexMap<ir::OperandIndex> _roots;
+};
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_BASIC_MEMORY_TIMELINE_H__
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_BASIC_SHARED_ARENA_H__
+#define __ONERT_BACKEND_BASIC_SHARED_ARENA_H__
+
+#include "Allocator.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+/**
+ * @brief Class to share static memory for non-constant tensors among sessions
+ *
+ * Users of the arena are grouped. The users in a group, e.g. memory managers of all backends and
+ * subgraphs in a session, are alive at the same time so that they get separate regions. Users in
+ * different groups share the same region, so the groups must not run at the same time.
+ *
+ * The arena grows to the largest group. When the region of a user is moved, its rebind handler is
+ * called to update the buffers given out before, so growing must not happen while others run.
+ */
+class SharedArena
+{
+public:
+  using RebindHandler = std::function<void()>;
+
+  /**
+   * @brief RAII object to put users that reserve memory within its lifetime in the same group
+   * @note  Scopes can be nested on a thread, and the outermost one decides the group
+   */
+  class GroupScope
+  {
+  public:
+    GroupScope();
+    ~GroupScope();
+
+  private:
+    bool _outermost;
+  };
+
+  /**
+   * @brief RAII object to make a worker thread use the arena and the group of another thread
+   * @note  Workers compiling parts of a session need it to reserve memory in the session's group
+   */
+  class WorkerScope
+  {
+  public:
+    WorkerScope(const std::shared_ptr<SharedArena> &arena, uint64_t group);
+    ~WorkerScope();
+
+  private:
+    std::weak_ptr<SharedArena> _prev_arena;
+    uint64_t _prev_group;
+  };
+
+public:
+  /**
+   * @brief Get the arena for the current thread
+   * @return The arena, live while there are users holding it
+   */
+  static std::shared_ptr<SharedArena> get();
+  /**
+   * @brief Get the group of the current scope, or a new group if there is no scope
+   * @return Group id
+   */
+  static uint64_t group();
+
+public:
+  /**
+   * @brief     Reserve memory for a user, which replaces the previous reservation of the user
+   * @param[in] user     Key of the user
+   * @param[in] group    Group of the user
+   * @param[in] capacity Size of memory to reserve
+   * @param[in] rebind   Handler called when the region of the user is moved by others
+   */
+  void reserve(const void *user, uint64_t group, uint32_t capacity, const RebindHandler &rebind);
+  /**
+   * @brief     Release the memory reserved for a user
+   * @param[in] user Key of the user
+   */
+  void release(const void *user);
+  /**
+   * @brief     Get the base pointer of the region of a user
+   * @param[in] user Key of the user
+   * @return    Base pointer
+   */
+  uint8_t *base(const void *user) const;
+  /**
+   * @brief  Get the size of the arena
+   * @return The size in bytes
+   */
+  uint32_t capacity() const;
+
+private:
+  struct Region
+  {
+    const void *user;
+    uint64_t group;
+    uint32_t capacity;
+    uint32_t offset;
+    RebindHandler rebind;
+  };
+
+  void relayout(const void *caller, std::vector<RebindHandler> &moved);
+
+private:
+  mutable std::mutex _mutex;
+  std::vector<Region> _regions;
+  std::unique_ptr<Allocator> _alloc;
+  uint32_t _capacity = 0;
+};
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_BASIC_SHARED_ARENA_H__
@@ -48,13 +48,66 @@ public:
 
   void claimPlan(const ir::OperandIndex &ind, uint32_t size);
   void releasePlan(const ir::OperandIndex &ind);
+  /**
+   * @brief Let a tensor share the memory planned for another tensor which dies at its definition
+   * @param[in] ind     Index of the tensor to be defined
+   * @param[in] src_ind Index of the tensor whose memory is reused
+   * @note  The plan of @c src_ind must not be released. It is released on @c releasePlan of
+   *        @c ind instead.
+   */
+  void claimInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &src_ind);
+  /**
+   * @brief Let a tensor be placed in the buffer of a tensor owned by another backend
+   * @param[in] ind     Index of the tensor to be defined
+   * @param[in] dst_ind Index of the external tensor, e.g. a model output
+   * @note  The tensor has no plan of its own. The buffer is bound by @c bindAliases once the
+   *        external tensor is registered to the tensor registry.
+   */
+  void claimAlias(const ir::OperandIndex &ind, const ir::OperandIndex &dst_ind);
+  void bindAliases(void);
+  /**
+   * @brief Let a tensor be placed in a part of the memory planned for another tensor
+   * @param[in] ind        Index of the tensor to be defined
+   * @param[in] parent_ind Index of the tensor whose memory contains the tensor
+   * @param[in] offset     Offset in bytes of the tensor in the memory of @c parent_ind
+   * @note  The tensor has no plan of its own. Its plan must not be released, and the plan of
+   *        @c parent_ind must cover the lifetime of the tensor.
+   */
+  void claimSubTensor(const ir::OperandIndex &ind, const ir::OperandIndex &parent_ind,
+                      uint32_t offset);
+
+  /**
+   * @brief Fill variable tensors with zeros, which start a new sequence of runs
+   *
+   * Variable tensors, e.g. states of LSTM, have memory of their own out of the plan, which keeps
+   * their values between runs and while memory of other non-constant tensors is released.
+   */
+  void resetVariables(void);
 
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
+  /**
+   * @brief Get the size of memory planned for non-constant tensors
+   */
+  uint32_t capacity() const { return _nonconst_mgr->capacity(); }
+  /**
+   * @brief Get the memory planned for non-constant tensors which have their own plan
+   */
+  const IMemoryPlanner::MemoryPlans &memoryPlans() const { return _nonconst_mgr->memoryPlans(); }
+
+private:
+  void bindNonconsts(void);
+  ir::OperandIndex planRoot(const ir::OperandIndex &ind) const;
 
 private:
   std::unique_ptr<MemoryManager> _nonconst_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
   ir::OperandIndexMap<bool> _as_constants;
+  ir::OperandIndexMap<std::shared_ptr<Allocator>> _variables;
+  ir::OperandIndexMap<ir::OperandIndex> _alias_roots;
+  ir::OperandIndexMap<ir::OperandIndex> _external_aliases;
+  ir::OperandIndexMap<std::pair<ir::OperandIndex, uint32_t>> _sub_tensors;
+  // Offsets planned ahead by the model, handed to _nonconst_mgr at the first plan
+  ir::OperandIndexMap<uint32_t> _planned_offsets;
   DynamicTensorManager *_dynamic_tensor_manager;
 };
 
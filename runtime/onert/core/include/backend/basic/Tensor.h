@@ -64,13 +64,24 @@ public:
     _buffer = alloc->base();
   }
 
+  /**
+   * @brief Let the tensor use the buffer of another tensor while this tensor is static
+   *
+   * This is for a static tensor whose data ends up in a tensor of another backend such as a model
+   * output, whose buffer is given only at execution time.
+   */
+  void setAliasOf(const ITensor *tensor) { _alias_of = tensor; }
+
   /**
    * @brief Reset the buffer and deallocate the allocation if it is managed by itself
    */
   void deallocBuffer() override;
 
 public:
-  uint8_t *buffer() const override { return _buffer; }
+  uint8_t *buffer() const override
+  {
+    return (_alias_of && !is_dynamic()) ? _alias_of->buffer() : _buffer;
+  }
   /**
    * @brief Get dimension by index
    *
@@ -147,6 +158,7 @@ protected:
   uint8_t *_buffer;
   int32_t _num_references;
   DynamicMemoryManager *_dynamic_mem_mgr;
+  const ITensor *_alias_of{nullptr};
 
 private:
   /**
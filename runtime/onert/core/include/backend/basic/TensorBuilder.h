@@ -50,18 +50,64 @@ public:
 
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
+  /**
+   * @brief     Notify the first use of a tensor which reuses the memory of a dying tensor
+   * @param[in] ind     Index of the tensor to be defined
+   * @param[in] src_ind Index of the tensor whose memory is reused
+   * @note      The last use of @c src_ind must not be notified
+   */
+  void claimInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &src_ind);
+  /**
+   * @brief     Notify the first use of a tensor which is placed in a tensor of another backend
+   * @param[in] ind     Index of the tensor to be defined
+   * @param[in] dst_ind Index of the external tensor whose buffer is used
+   * @note      The last use of @c ind must not be notified. @c bindAliases must be called after
+   *            the external tensor is registered as a migrant tensor.
+   */
+  void claimAlias(const ir::OperandIndex &ind, const ir::OperandIndex &dst_ind);
+  void bindAliases(void);
+  /**
+   * @brief     Notify the first use of a tensor which is placed in a part of another tensor
+   * @param[in] ind        Index of the tensor to be defined
+   * @param[in] parent_ind Index of the tensor whose memory contains the tensor
+   * @param[in] offset     Offset in bytes of the tensor in the memory of @c parent_ind
+   * @note      The last use of @c ind must not be notified. @c parent_ind must be alive while
+   *            @c ind is.
+   */
+  void claimSubTensor(const ir::OperandIndex &ind, const ir::OperandIndex &parent_ind,
+                      uint32_t offset);
 
   bool isRegistered(const ir::OperandIndex &) const;
 
   void allocate(void);
 
   DynamicTensorManager *dynamicTensorManager(void) { return _dynamic_tensor_mgr.get(); }
+  StaticTensorManager *staticTensorManager(void) { return _static_tensor_mgr.get(); }
+  /**
+   * @brief  Get the peak memory use of tensors since the last call
+   * @return Bytes planned for static tensors and the peak of ones allocated for dynamic tensors
+   */
+  uint64_t takeMemoryPeak(void);
+  /**
+   * @brief  Free memory of non-constant tensors and free memory kept for dynamic tensors
+   * @return Bytes of memory freed
+   */
+  uint64_t releaseMemory(void);
+  /**
+   * @brief Allocate memory of non-constant tensors again if it is released
+   */
+  void reacquireMemory(void);
+  /**
+   * @brief Fill variable tensors with zeros
+   */
+  void resetVariables(void) { _static_tensor_mgr->resetVariables(); }
 
 private:
   const std::shared_ptr<TensorRegistry> _tensor_reg;
   std::unique_ptr<DynamicTensorManager> _dynamic_tensor_mgr;
   std::unique_ptr<StaticTensorManager> _static_tensor_mgr;
   ir::OperandIndexMap<ir::OperandInfo> _tensor_info_map;
+  bool _released = false;
 };
 
 } // namespace basic
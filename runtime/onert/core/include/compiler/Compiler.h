@@ -23,7 +23,11 @@
 #define __ONERT_COMPILER_COMPILE_H_
 
 #include "ir/Graph.h"
+#include "exec/DriftMonitor.h"
 #include "exec/IExecutor.h"
+#include "exec/MinMaxRecords.h"
+#include "exec/OnlineProfiling.h"
+#include "exec/RunStats.h"
 #include "util/TracingCtx.h"
 
 namespace onert
@@ -60,13 +64,26 @@ struct CompilerOptions
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   std::string executor;       //< Executor name to use
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
-  bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
-  bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
-  bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
-  bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool he_scheduler;           //< HEScheduler if true, ManualScheduler otherwise
+  bool he_profiling_mode;      //< Whether HEScheduler profiling mode ON/OFF
+  int32_t he_online_runs;      //< Runs to profile online for HEScheduler, 0 if disabled
+  int32_t reschedule_interval; //< Runs between drift checks of HEScheduler, 0 if disabled
+  int32_t reschedule_drift;    //< Drift of exec times in percent to reschedule HEScheduler by
+  bool disable_compile;        //< Run with Interpreter if true, try compilation otherwise
+  int32_t interp_threads;      //< Threads to run Interpreter with, less than 1 for all cores
+  bool fp16_enable;            //< Whether fp16 mode ON/OFF
+  int32_t compile_threads;     //< Threads to compile subgraphs with, less than 1 for all cores
+  std::string compile_cache_dir;    //< Directory to cache schedules in, empty if disabled
+  std::string compile_cache_token;  //< Token of the application to key cached schedules with
+  int32_t dynamic_shape_cache_size; //< Input shapes to keep inferred shapes of, 0 if disabled
+  int32_t weight_prefetch_distance; //< Operations to prefetch constants ahead, 0 if disabled
   PartialGraphOptions partial_graph_options;
 
-  util::TracingCtx *tracing_ctx; //< Profiling information
+  util::TracingCtx *tracing_ctx;           //< Profiling information
+  exec::OnlineProfiling *online_profiling; //< Online profiling in progress, nullptr if none
+  exec::DriftMonitor *drift_monitor;       //< Monitor of drifts of the schedule, nullptr if none
+  exec::RunStats *run_stats;               //< Stats of runs to collect, nullptr if disabled
+  exec::MinMaxRecords *minmax_records;     //< Min/max of tensors to record, nullptr if disabled
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -101,6 +118,14 @@ public:
   std::vector<std::shared_ptr<exec::ExecutorMap>> compile(const char *package_file_path,
                                                           const char *map_file_path);
 
+  /**
+   * @brief   Do compilation into pipeline stages split where operations move between the host
+   *          and an accelerator such as trix
+   *
+   * @return std::vector<std::shared_ptr<exec::ExecutorMap>> Executors of the stages in order
+   */
+  std::vector<std::shared_ptr<exec::ExecutorMap>> compileStreaming();
+
   State state(void) const { return _state; }
 
   CompilerOptions &options() { return _options; }
@@ -123,6 +148,8 @@ public:
 
 private:
   void checkProfilerConditions();
+  std::vector<std::shared_ptr<exec::ExecutorMap>> compilePartialGraphs(uint32_t num_graphs);
+  uint32_t partitionByBackend();
   std::shared_ptr<ir::Graph> &primary_subgraph() { return _subgraphs->at(ir::SubgraphIndex{0}); }
 
 private:
@@ -56,11 +56,22 @@ public:
     auto itr = _has_dynamic_tensor_map.find(ind);
     return (itr == _has_dynamic_tensor_map.end()) ? false : itr->second;
   }
+  /**
+   * @brief Get the operations consuming outputs of each operation
+   *
+   * @note  This is built from def-use chains of operands in linear time and cached on the first
+   *        call, so it must be called after the graph is no longer modified. An operation appears
+   *        in the list as many times as the number of the producer's outputs it consumes.
+   *
+   * @return Map from an operation to its consumer operations
+   */
+  const ir::OperationIndexMap<std::vector<ir::OperationIndex>> &consumers();
 
 private:
   void makeLowerInfo(const compiler::BackendResolver &backend_resolver);
   void dumpLowerInfo();
   void lowerGraph(const ir::Graph &graph, const compiler::CompilerOptions &options);
+  void buildConsumers();
 
 private:
   ir::Graph _graph;
@@ -68,6 +79,7 @@ private:
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
   compiler::GraphLowerInfo _lower_info_map;
   ir::OperationIndexMap<bool> _has_dynamic_tensor_map;
+  std::unique_ptr<ir::OperationIndexMap<std::vector<ir::OperationIndex>>> _consumers;
 };
 
 } // namespace compiler
@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace onert
 {
@@ -69,6 +70,7 @@ private:
 private:
   // TODO Define visitors for operations. List them in alphabetic order.
   void visit(const ir::operation::ArgMinMax &op) override;
+  void visit(const ir::operation::Attention &op) override;
   void visit(const ir::operation::BatchMatMul &op) override;
   void visit(const ir::operation::BCQFullyConnected &op) override;
   void visit(const ir::operation::BCQGather &op) override;
@@ -77,6 +79,8 @@ private:
   void visit(const ir::operation::Comparison &op) override;
   void visit(const ir::operation::Concat &op) override;
   void visit(const ir::operation::Conv2D &op) override;
+  void visit(const ir::operation::ConvertFp16ToFp32 &op) override;
+  void visit(const ir::operation::ConvertFp32ToFp16 &op) override;
   void visit(const ir::operation::ElementwiseActivation &op) override;
   void visit(const ir::operation::ElementwiseBinary &op) override;
   void visit(const ir::operation::ElementwiseUnary &op) override;
@@ -87,6 +91,7 @@ private:
   void visit(const ir::operation::Gather &op) override;
   void visit(const ir::operation::If &op) override;
   void visit(const ir::operation::L2Normalization &op) override;
+  void visit(const ir::operation::LayerNorm &op) override;
   void visit(const ir::operation::LSTM &op) override;
   void visit(const ir::operation::MatrixBandPart &op) override;
   void visit(const ir::operation::OneHot &op) override;
@@ -109,6 +114,7 @@ private:
   void visit(const ir::operation::StridedSlice &op) override;
   void visit(const ir::operation::SquaredDifference &op) override;
   void visit(const ir::operation::Tile &op) override;
+  void visit(const ir::operation::TopKV2 &op) override;
   void visit(const ir::operation::Transpose &op) override;
   void visit(const ir::operation::Unpack &op) override;
   void visit(const ir::operation::While &op) override;
@@ -127,6 +133,13 @@ private:
    */
   void handleSimpleUnaryOp(const ir::Operation &op, const ir::OperandIndex input_idx);
 
+  /**
+   * @brief Get int32 values of an operand which are known before running it
+   * @return @c true if operand is constant or computed only from static shapes;
+   *         @c false otherwise.
+   */
+  bool getKnownValues(const ir::OperandIndex &index, std::vector<int32_t> &values) const;
+
 private:
   const std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>>
     &_lowered_subgs;
@@ -134,6 +147,9 @@ private:
   ir::Operands &_operands;     // operands of current subgraph
   ir::Operations &_operations; // operations of current subgraph
   bool _return_has_dynamic_tensor;
+  // values of non-constant operands which only depend on static shapes, e.g. output of Shape.
+  // Ops using them as shape keep their outputs static, while the ops themselves still run.
+  std::unordered_map<ir::OperandIndex, std::vector<int32_t>> _known_values;
 };
 
 } // namespace compiler
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_ASYNC_TRANSFERS_H__
+#define __ONERT_EXEC_ASYNC_TRANSFERS_H__
+
+#include "backend/ITensor.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Transfers from device memory and other work that a job enqueued without blocking
+ *
+ * An executor opens a scope while running a job. Functions of the job can defer waiting for their
+ * transfers to the executor, which runs other jobs and notifies the consumers of the job after
+ * the transfers are done.
+ */
+class AsyncTransfers
+{
+public:
+  /**
+   * @brief RAII object to collect transfers deferred on this thread within its lifetime
+   */
+  class Scope
+  {
+  public:
+    Scope(AsyncTransfers &transfers);
+    ~Scope();
+
+  private:
+    AsyncTransfers *_prev;
+  };
+
+  /**
+   * @brief Work other than a tensor transfer, such as a request submitted to an accelerator
+   */
+  class IPending
+  {
+  public:
+    virtual ~IPending() = default;
+
+  public:
+    virtual bool done() = 0;
+    virtual void wait() = 0;
+  };
+
+public:
+  /**
+   * @brief Defer waiting for the transfer of a tensor to the executor
+   * @param tensor Tensor which enqueues the transfer without blocking after this call
+   * @return true if deferred, false if there is no scope and the caller must block
+   */
+  static bool defer(backend::ITensor *tensor);
+  /**
+   * @brief Defer waiting for a pending work to the executor
+   * @param pending Work enqueued without blocking, which must outlive the wait
+   * @return true if deferred, false if there is no scope and the caller must block
+   */
+  static bool defer(IPending *pending);
+
+public:
+  bool empty() const { return _tensors.empty() && _pendings.empty(); }
+  bool done() const;
+  void wait();
+
+private:
+  std::vector<backend::ITensor *> _tensors;
+  std::vector<IPending *> _pendings;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_ASYNC_TRANSFERS_H__
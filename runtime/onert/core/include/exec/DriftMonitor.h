@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_DRIFT_MONITOR_H__
+#define __ONERT_EXEC_DRIFT_MONITOR_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace onert
+{
+namespace backend
+{
+class Backend;
+} // namespace backend
+
+namespace exec
+{
+
+/**
+ * @brief Monitor of how far backends run from the exec times HEScheduler assigned operations by
+ *
+ * Every interval-th run is sampled, where operations are timed and compared with the exec times
+ * the executors were scheduled with. Speeds of backends shift under DVFS and thermal throttling,
+ * so once the time of a backend is off by more than the threshold for the sampled runs of a
+ * window, the schedule is considered to have drifted and the session reschedules.
+ */
+class DriftMonitor
+{
+public:
+  /**
+   * @param interval  Runs between sampled runs, which must be positive
+   * @param threshold Relative difference of times of a backend to drift, e.g. 0.2 for 20%
+   */
+  DriftMonitor(uint32_t interval, double threshold) : _interval{interval}, _threshold{threshold}
+  {
+  }
+
+public:
+  /**
+   * @brief Begin a run of the primary subgraph
+   * @return true if the run is sampled
+   * @note   Runs are not sampled once drifted, so that exec times are not stored while the model
+   *         is compiled again with them
+   */
+  bool beginRun()
+  {
+    _sampling = (++_runs % _interval == 0) && !_drifted;
+    return _sampling;
+  }
+  /**
+   * @brief Return true if operations of the current run are timed
+   */
+  bool sampling() const { return _sampling; }
+  /**
+   * @brief Add times of operations of a backend in the current run
+   *
+   * @param observed Measured time in microseconds
+   * @param expected Exec time that the schedule assumed for the same operations
+   */
+  void addBackendTime(const backend::Backend *backend, int64_t observed, int64_t expected)
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto &times = _times[backend];
+    times.observed += observed;
+    times.expected += expected;
+  }
+  /**
+   * @brief End a run of the primary subgraph, which checks the drift at the end of a window
+   */
+  void endRun()
+  {
+    if (!_sampling)
+      return;
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (++_window_samples < WINDOW_SAMPLES)
+      return;
+
+    _max_drift = 0;
+    for (const auto &pair : _times)
+    {
+      // Backends running little of the model are too noisy to reschedule by
+      const auto &times = pair.second;
+      if (times.expected < MIN_EXPECTED_US * WINDOW_SAMPLES)
+        continue;
+      const double drift = std::abs(static_cast<double>(times.observed) / times.expected - 1.0);
+      _max_drift = std::max(_max_drift, drift);
+    }
+    if (_max_drift > _threshold)
+      _drifted = true;
+    _times.clear();
+    _window_samples = 0;
+  }
+
+public:
+  /**
+   * @brief Return true if the schedule has drifted so that the session should reschedule
+   */
+  bool drifted() const { return _drifted; }
+  /**
+   * @brief Get the largest relative difference of backends in the last window
+   */
+  double maxDrift() const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    return _max_drift;
+  }
+  /**
+   * @brief Start over with executors scheduled again
+   */
+  void reset()
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _drifted = false;
+    _times.clear();
+    _window_samples = 0;
+  }
+  uint32_t runs() const { return _runs; }
+
+private:
+  // A window of this many sampled runs decides a drift
+  static constexpr uint32_t WINDOW_SAMPLES = 3;
+  // Backends whose operations are expected to take less than this in a run are not compared
+  static constexpr int64_t MIN_EXPECTED_US = 100;
+
+  struct Times
+  {
+    int64_t observed = 0;
+    int64_t expected = 0;
+  };
+
+  const uint32_t _interval;
+  const double _threshold;
+  std::atomic<uint32_t> _runs{0};
+  std::atomic<bool> _sampling{false};
+  std::atomic<bool> _drifted{false};
+  // Subgraphs may be run on multiple threads
+  mutable std::mutex _mutex;
+  std::unordered_map<const backend::Backend *, Times> _times;
+  uint32_t _window_samples = 0;
+  double _max_drift = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_DRIFT_MONITOR_H__
@@ -24,22 +24,40 @@
 #include "ir/Layout.h"
 #include "exec/IExecutor.h"
 #include "IODescription.h"
+#include "SPSCRing.h"
 
-#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include <deque>
-#include <semaphore.h>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ruy
+{
+class Context;
+} // namespace ruy
 
 namespace onert
 {
 namespace exec
 {
 
+class MinMaxRecords;
+class RunStats;
+
 /**
  * @brief Class to define execution instance to collect input/output information for inference
  *        and prepare executor run (TODO)
  */
 class Execution
 {
+  // Batcher runs requests of executions in batches, reading their inputs and outputs
+  friend class ExecutionBatcher;
+
 
 public:
   /**
@@ -47,6 +65,7 @@ public:
    * @param[in] executor  Model executor
    */
   Execution(const std::shared_ptr<ExecutorMap> &executors);
+  ~Execution();
 
 public:
   /**
@@ -56,6 +75,26 @@ public:
   const ir::Graph &primary_subgraph() const { return primary_executor()->graph(); }
 
   const ir::Graph &primary_parentgraph() const { return primary_executor()->parent_graph(); }
+  /**
+   * @brief     Replace executors with ones compiled again from the same model
+   * @param[in] executors New executors
+   * @note      Inputs, outputs and input shapes set before are kept, but inputs are not padded
+   */
+  void replaceExecutors(const std::shared_ptr<ExecutorMap> &executors);
+  /**
+   * @brief     Replace executors with ones compiled for the input shapes changed before
+   * @param[in] executors New executors whose static input shapes are the changed ones
+   * @note      The changed input shapes are dropped so that the executors run statically
+   */
+  void specializeExecutors(const std::shared_ptr<ExecutorMap> &executors);
+  /**
+   * @brief     Replace executors with ones compiled for the changed input shapes padded
+   * @param[in] executors New executors whose static input shapes are the changed ones padded
+   * @param[in] axis      Axis along which inputs are padded with zeros and outputs are cropped
+   * @note      Outputs whose extent along the axis is the padded one of inputs are cropped to the
+   *            unpadded one. The changed input shapes are kept as the shapes of the user data.
+   */
+  void padExecutors(const std::shared_ptr<ExecutorMap> &executors, uint32_t axis);
   /**
    * @brief     Change input shape
    * @param[in] index   Input index
@@ -85,6 +124,16 @@ public:
    */
   void setInput(const ir::IOIndex &index, const ir::TypeInfo &type, const ir::Shape &shape,
                 const void *buffer, size_t length, ir::Layout layout = ir::Layout::NHWC);
+  /**
+   * @brief     Set input data given in another type than the input of the model
+   * @param[in] index   Input index
+   * @param[in] type    Type of the data in @p buffer, FLOAT32 for a quantized input
+   * @param[in] buffer  Input data's buffer pointer
+   * @param[in] length  Input data's length
+   * @note      The data is quantized into a buffer of this execution when each execution starts,
+   *            instead of running a Quantize operation with a tensor of its own
+   */
+  void setInput(const ir::IOIndex &index, ir::DataType type, const void *buffer, size_t length);
   /**
    * @brief     Set output data's information
    * @param[in] index   Output index
@@ -106,6 +155,30 @@ public:
    */
   void setOutput(const ir::IOIndex &index, const ir::TypeInfo &type, const ir::Shape &shape,
                  void *buffer, size_t length, ir::Layout layout = ir::Layout::NHWC);
+  /**
+   * @brief     Set output buffer to get data in another type than the output of the model
+   * @param[in] index   Output index
+   * @param[in] type    Type of the data to write to @p buffer, FLOAT32 for a quantized output
+   * @param[in] buffer  Output data's buffer pointer
+   * @param[in] length  Output data's length
+   * @note      The data is dequantized from a buffer of this execution when each execution ends
+   */
+  void setOutput(const ir::IOIndex &index, ir::DataType type, void *buffer, size_t length);
+  /**
+   * @brief     Register buffers of all inputs and outputs to be bound at once later
+   * @param[in] slot    Index of the set of buffers, which replaces the one registered before
+   * @param[in] inputs  Buffer and length of each input
+   * @param[in] outputs Buffer and length of each output
+   * @note      Lengths are validated here against static shapes, so binding them costs nothing
+   */
+  void registerIOBuffers(uint32_t slot, const std::vector<std::pair<const void *, size_t>> &inputs,
+                         const std::vector<std::pair<void *, size_t>> &outputs);
+  /**
+   * @brief     Bind the buffers registered before for next executions
+   * @param[in] slot Index of the set of buffers
+   * @note      Setting inputs, outputs, their layouts or input shapes unbinds them
+   */
+  void useIOBuffers(uint32_t slot);
   /**
    * @brief     Set input data's data format
    * @param[in] index   Input index
@@ -118,22 +191,76 @@ public:
    * @param[in] layout  Output data's data format
    */
   void setOutputLayout(const ir::IOIndex &index, ir::Layout layout);
+  /**
+   * @brief     Set priority of executions, where higher priority preempts others between operations
+   * @param[in] priority Priority of executions, 0 by default
+   */
+  void setPriority(int32_t priority) { _priority = priority; }
+  /**
+   * @brief     Set stats to collect for each execution
+   * @param[in] stats Stats given to the compiler of the executors as well, nullptr to disable
+   */
+  void setRunStats(RunStats *stats) { _run_stats = stats; }
+  /**
+   * @brief     Set min/max records to write for each execution
+   * @param[in] records Records given to the compiler of the executors as well, nullptr to disable
+   */
+  void setMinMaxRecords(MinMaxRecords *records) { _minmax_records = records; }
   /**
    * @brief  Execution
    * @note   It should be called after setting input and output buffer
    */
   void execute();
 
+  /**
+   * @brief     Run executors with zero-filled inputs to take the costs of the first run in advance
+   * @param[in] runs Number of runs
+   * @note      The first run faults in pages of memory and weights, and lets backends compile
+   *            kernels and pack weights lazily. Inputs and outputs set to this execution are not
+   *            used, but input shapes changed are.
+   */
+  void warmup(uint32_t runs = 1);
+
+  /**
+   * @brief     Release memory of executors while this execution is idle
+   * @param[in] weights Whether weights packed by backends are released as well
+   * @return    Bytes of memory released
+   * @note      Memory is acquired again at the next execution. Values of non-constant tensors
+   *            are not kept, except states of @c resetStates.
+   */
+  uint64_t releaseMemory(bool weights);
+
+  /**
+   * @brief Reset states kept between executions to start a new stream
+   *
+   * Variable tensors of the model, e.g. states of LSTM, are kept in executors across runs, so that
+   * a run of a streaming model takes only the new frame. They are zeros before the first run and
+   * after this call. Releasing memory by @c releaseMemory keeps them.
+   */
+  void resetStates();
+
+  /**
+   * @brief Callback called on a worker thread when asynchronous execution finishes
+   * @note  The argument is the exception thrown by the execution, or null if it succeeded.
+   *        It is called after waitFinish() is able to return.
+   */
+  using FinishCallback = std::function<void(std::exception_ptr)>;
+
   /**
    * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
+   * @note  It returns after execution is queued to the worker pool shared by all executions
    *        It should be called after setting input and output buffer
    */
   void startExecute(void);
+  /**
+   * @brief     Start asynchronous execution with a callback
+   * @param[in] callback Function called when execution finishes
+   */
+  void startExecute(const FinishCallback &callback);
 
   /**
    * @brief Return when execution is finished
-   * @note  It waits until execution is finished
+   * @note  It waits until execution is finished, and rethrows the exception thrown by it
    */
   void waitFinish(void);
 
@@ -150,80 +277,36 @@ public:
   // Experimental API
   //
 
-  // accessor
-  std::vector<
-    std::tuple<std::shared_ptr<onert::exec::Execution>, onert::ir::IOIndex, onert::ir::IOIndex>>
-  getNextExes()
-  {
-    return next_exes;
-  }
-  std::deque<std::pair<IODescription *, uint32_t>> *getAsyncIoDescs() { return &_async_io_descs; }
-  std::deque<std::vector<void *>> *getAsyncResults() { return &_async_results; }
-
   /**
-   * @brief     Push IO information between related executions into next_exes
-   * @param[in] next   address of next execution
+   * @brief     Connect an output of this execution to an input of the next execution
+   * @param[in] next     Next execution
    * @param[in] o_index  Output index of current execution (it will be the input of next execution)
    * @param[in] i_index  Input index of next execution
    */
   void pushNextExe(std::shared_ptr<onert::exec::Execution> next, onert::ir::IOIndex o_index,
-                   onert::ir::IOIndex i_index)
-  {
-    next_exes.push_back({next, o_index, i_index});
-  }
+                   onert::ir::IOIndex i_index);
 
   /**
-   * @brief     Create New IODescription instance for new inputs outputs
-   * @param[in] index   instance count number
+   * @brief     Allocate buffers to run this execution as a stage of the pipeline
+   * @param[in] depth Number of inferences which can be queued between two stages
+   * @note      It must be called after all the stages are connected by @c pushNextExe
    */
-  void createNewAsyncDesc(uint32_t count = 0);
+  void preparePipeline(uint32_t depth);
 
   /**
-   * @brief     Set async input data's information
-   * @param[in] index   Input index
-   * @param[in] buffer  Input data's buffer pointer
-   * @param[in] length  Input data's length
-   * @param[in] layout  Input data's data format
+   * @brief     Push inputs of an inference to the first stage
+   * @param[in] inputs   Input buffers, which are copied. Empty @p inputs ends the pipeline.
+   * @param[in] lengths  Sizes of input buffers
+   * @note      It waits while @c depth inferences are queued to the first stage
    */
-  void executeAsyncInput(const ir::IOIndex &index, const void *buffer, size_t length,
-                         ir::Layout layout = ir::Layout::NHWC);
+  void pushPipelineInput(const std::vector<void *> &inputs, const std::vector<uint32_t> &lengths);
 
   /**
-   * @brief     Set async output data's information
-   * @param[in] index   Output index
-   * @param[in] buffer  Output data's buffer pointer
-   * @param[in] length  Output data's length
-   * @param[in] layout  Output data's data format
-   */
-  void executeAsyncOutput(const ir::IOIndex &index, void *buffer, size_t length,
-                          ir::Layout layout = ir::Layout::NHWC);
-
-  /**
-   * @brief  Async execution
-   * @note   It should be called after setting input and output buffer
+   * @brief      Pop outputs of an inference from the last stage
+   * @param[out] outputs Output buffers allocated by malloc, which the caller must free
+   * @return     @c false if the pipeline has ended without an output left, otherwise @c true
    */
-  void AsyncExecute();
-
-  /**
-   * @brief   Set finish
-   */
-  void setFinish();
-
-  /**
-   * @brief   Check if input queue is empty
-   * @return  @c true if queue is empty, otherwise @c false
-   */
-  bool isEmptyQueue();
-
-  /**
-   * @brief   Wait semaphore to prevent race condition
-   */
-  void asyncIoDescSemWait();
-
-  /**
-   * @brief   Post semaphore to prevent race condition
-   */
-  void asyncIoDescSemPost();
+  bool popPipelineOutput(std::vector<void *> &outputs);
 
   /**
    * @brief   Inference
@@ -232,15 +315,11 @@ public:
   void runInference();
 
   /**
-   * @brief   Check if stop_wait is true
-   * @return  @c true if stop_wait is true, otherwise @c false
+   * @brief   Get the average time this stage of the pipeline takes to run an inference
+   * @return  Average time in microseconds, or 0 if the stage has not run
+   * @note    Time waiting for other stages is not counted
    */
-  bool stopWait(void) const;
-
-  /**
-   * @brief   Set stop_wait to terminate consumer thread
-   */
-  void sholudStop();
+  uint64_t pipelineStageTime() const;
 
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
@@ -248,19 +327,96 @@ private:
     return _executors->at(ir::SubgraphIndex{0});
   };
   std::unique_ptr<IExecutor> &primary_executor() { return _executors->at(ir::SubgraphIndex{0}); };
+  void executePadded();
+  /**
+   * @brief Mark an asynchronous run started, which throws if one is running already
+   */
+  void beginAsync();
+  /**
+   * @brief Mark an asynchronous run finished, which wakes up threads waiting for it
+   */
+  void finishAsync(std::exception_ptr error);
+  void convertInputs();
+  void convertOutputs();
+  const IODescription &currentIODesc() const
+  {
+    return _io_slot < 0 ? _io_desc : *_io_slots.at(_io_slot);
+  }
 
 private:
-  const std::shared_ptr<ExecutorMap> _executors;
+  std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
-  std::deque<std::pair<IODescription *, uint32_t>> _async_io_descs;
-  sem_t _async_io_descs_sem;
-  std::deque<std::vector<void *>> _async_results;
-  std::vector<
-    std::tuple<std::shared_ptr<onert::exec::Execution>, onert::ir::IOIndex, onert::ir::IOIndex>>
-    next_exes;
-  std::unique_ptr<std::thread> _exec_thread;
+  // Axis along which inputs are padded for the executors, or -1 if they are not padded
+  int32_t _pad_axis{-1};
+  std::vector<std::vector<uint8_t>> _pad_buffers;
+  // Sets of buffers registered for inputs and outputs, and the one in use or -1
+  std::vector<std::unique_ptr<IODescription>> _io_slots;
+  int32_t _io_slot{-1};
+  int32_t _priority{0};
+  RunStats *_run_stats{nullptr};
+  MinMaxRecords *_minmax_records{nullptr};
+  // Inputs and outputs given in another type, which the descriptions refer to the buffers of
+  struct ConvertedIO
+  {
+    ir::DataType type;
+    void *user_buffer;
+    size_t user_size;
+    std::vector<uint8_t> buffer;
+  };
+  std::unordered_map<uint32_t, ConvertedIO> _converted_inputs;
+  std::unordered_map<uint32_t, ConvertedIO> _converted_outputs;
+  // Context to convert them with on the calling thread if no other threads are available
+  std::unique_ptr<ruy::Context> _convert_context;
+  // Stages of the pipeline are connected by links, which pass preallocated frames of buffers
+  // from a producer stage to a consumer stage and return them after the consumer runs
+  struct PipelineFrame
+  {
+    std::vector<std::vector<uint8_t>> buffers;
+  };
+  struct PipelineLink
+  {
+    // nullptr for the link of inputs given by users
+    Execution *producer{nullptr};
+    Execution *consumer{nullptr};
+    // Pairs of an output index of the producer and an input index of the consumer
+    std::vector<std::pair<ir::IOIndex, ir::IOIndex>> io;
+    std::vector<PipelineFrame> frames;
+    // Frames filled by the producer, where nullptr means the end of the pipeline
+    std::unique_ptr<SPSCRing<PipelineFrame *>> filled;
+    // Frames which the consumer has done with
+    std::unique_ptr<SPSCRing<PipelineFrame *>> free;
+  };
+  void bindPipelineOutputs(IODescription &desc);
+  void passPipelineOutputs();
+  void endPipeline();
+  std::vector<std::shared_ptr<PipelineLink>> _prev_links;
+  std::vector<std::shared_ptr<PipelineLink>> _next_links;
+  // Descriptions for each frame index, which refer to frames and the buffers of outputs
+  std::vector<std::unique_ptr<IODescription>> _pipeline_descs;
+  // Buffers of outputs which no next stage takes, and which are not results of the last stage
+  std::vector<std::vector<uint8_t>> _pipeline_outputs;
+  std::vector<PipelineFrame *> _pipeline_frames;
+  // Pairs of a next link and a buffer of its frames for each output. The output is written to the
+  // first of them directly, and is copied from it to the others.
+  std::vector<std::vector<std::pair<uint32_t, uint32_t>>> _pipeline_output_targets;
+  // Frames of next links and results of the last stage which outputs are written to in a run
+  std::vector<PipelineFrame *> _pipeline_next_frames;
+  std::vector<void *> _pipeline_result_buffers;
+  // Outputs of the last stage to be popped by users
+  std::mutex _pipeline_mutex;
+  std::condition_variable _pipeline_cv;
+  std::deque<std::vector<void *>> _pipeline_results;
+  bool _pipeline_ended{false};
+  std::atomic<uint64_t> _pipeline_time_us{0};
+  std::atomic<uint32_t> _pipeline_runs{0};
+  // State of asynchronous execution
+  mutable std::mutex _async_mutex;
+  std::condition_variable _async_cv;
+  bool _async_running{false};
+  std::exception_ptr _async_error;
+  // Whether any run has started, after which runs are in the steady state
+  bool _steady{false};
   bool finished{false};
-  bool stop_wait{false};
 };
 
 } // namespace exec
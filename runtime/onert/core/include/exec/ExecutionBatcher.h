@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_EXECUTION_BATCHER_H__
+#define __ONERT_EXEC_EXECUTION_BATCHER_H__
+
+#include "exec/Execution.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Batcher of concurrent runs of executions of the same executors
+ *
+ * Executors run one execution at a time, so executions started by many clients at once wait for
+ * each other. Runs of executions are queued instead, and collected until there are as many as the
+ * maximum batch or the first one has waited for the timeout. Inputs of the runs are concatenated
+ * along the first axis, the batch runs once as a run of dynamic input shapes, and outputs are
+ * scattered back to the executions.
+ *
+ * Runs are batched only if every input and output of the model has batch 1 on the first axis.
+ * Executions whose inputs and outputs are not plain buffers of a sample, e.g. of other types or
+ * shapes, run alone. If a batch fails or gives outputs of other shapes than a batch of samples,
+ * e.g. a model reshaping to a fixed batch, its executions run alone and batching stops.
+ */
+class ExecutionBatcher
+{
+public:
+  /**
+   * @param executors  Executors of executions to batch
+   * @param max_batch  Maximum runs of a batch
+   * @param timeout_us Time for the first run of a batch to wait for others in microseconds
+   */
+  ExecutionBatcher(const std::shared_ptr<ExecutorMap> &executors, uint32_t max_batch,
+                   uint32_t timeout_us);
+  ~ExecutionBatcher();
+
+public:
+  /**
+   * @brief Return true if runs of executors can be batched on the first axis
+   */
+  static bool batchable(const ExecutorMap &executors);
+
+  /**
+   * @brief Start a run of an execution, which finishes as Execution::startExecute does
+   * @note  It is thread-safe, and Execution::waitFinish waits for the run
+   */
+  void startExecute(const std::shared_ptr<Execution> &execution);
+
+  uint64_t batches() const { return _batches; }
+
+private:
+  struct Request
+  {
+    std::shared_ptr<Execution> execution;
+    std::chrono::steady_clock::time_point arrival;
+  };
+
+  void work();
+  void runBatch(const std::vector<Request> &batch);
+  /**
+   * @brief Run executions of a batch
+   * @return false if the batch failed, where no execution is finished
+   */
+  bool tryBatch(const std::vector<Execution *> &batch);
+  bool canJoin(const Execution &execution) const;
+  static void runAlone(Execution &execution);
+
+private:
+  const uint32_t _max_batch;
+  const std::chrono::microseconds _timeout;
+  // Sizes of a sample of each input and output
+  std::vector<size_t> _input_sizes;
+  std::vector<size_t> _output_sizes;
+  // Execution of batches, whose buffers gather inputs and outputs of executions
+  std::unique_ptr<Execution> _batch_execution;
+  std::vector<std::vector<uint8_t>> _input_buffers;
+  std::vector<std::vector<uint8_t>> _output_buffers;
+  std::atomic<bool> _disabled{false};
+  std::atomic<uint64_t> _batches{0};
+
+  std::mutex _mutex;
+  std::condition_variable _queue_cv;
+  std::deque<Request> _queue;
+  bool _stop{false};
+  std::thread _worker;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_EXECUTION_BATCHER_H__
@@ -32,6 +32,8 @@ namespace onert
 namespace exec
 {
 
+class DynamicShapeCache;
+
 class FunctionSequence : public IFunction
 {
 public:
@@ -78,6 +80,8 @@ public: // methods related to dynamic tensor
     ir::OperationIndex op_ind;
     const ir::Operations *operations = nullptr;
     std::shared_ptr<exec::DynamicShapeInferer> dynamic_shape_inferer = nullptr;
+    // Shapes of the runs of the same input shapes, set by the executor if it keeps them
+    exec::DynamicShapeCache *shape_cache = nullptr;
   };
 
   /**
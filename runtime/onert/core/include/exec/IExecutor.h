@@ -105,6 +105,26 @@ struct IExecutor
    * @return Vector of @c IOTensor
    */
   virtual const std::vector<backend::builtin::IOTensor *> &getOutputTensors() const = 0;
+
+  /**
+   * @brief Free memory of intermediate tensors and caches of backends while the executor is idle
+   *
+   * The memory is acquired again at the start of the next execution, which costs allocating the
+   * memory and binding tensors to it, and faulting in its pages.
+   *
+   * @param[in] weights Whether caches of packed weights are dropped as well, which are packed
+   *                    again on their next use
+   * @return    Bytes of memory freed
+   * @note      It must not be called while the executor runs
+   */
+  virtual uint64_t releaseMemory(bool /* weights */) { return 0; }
+
+  /**
+   * @brief Reset states kept between executions, i.e. variable tensors, to their initial values
+   *
+   * @note  It must not be called while the executor runs
+   */
+  virtual void resetStates() {}
 };
 
 using ExecutorMap = std::unordered_map<ir::SubgraphIndex, std::unique_ptr<IExecutor>>;
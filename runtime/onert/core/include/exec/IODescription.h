@@ -19,7 +19,6 @@
 
 #include <vector>
 #include <unordered_map>
-#include <semaphore.h>
 
 #include "ir/OperandInfo.h"
 #include "ir/Index.h"
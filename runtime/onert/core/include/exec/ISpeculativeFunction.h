@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_I_SPECULATIVE_FUNCTION_H__
+#define __ONERT_EXEC_I_SPECULATIVE_FUNCTION_H__
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Interface of functions which can start their work before their first input is ready
+ *
+ * Executors call speculate() when all inputs but the first are ready, for example all inputs of
+ * If but the condition.
+ */
+class ISpeculativeFunction
+{
+public:
+  virtual ~ISpeculativeFunction() = default;
+  /**
+   * @brief Start the work which does not depend on the first input, without blocking
+   * @note  It is called at most once before each run(), and completes before run() is called.
+   *        run() must wait for the started work and discard what is not used.
+   */
+  virtual void speculate() = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_I_SPECULATIVE_FUNCTION_H__
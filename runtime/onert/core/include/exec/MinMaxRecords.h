@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_MINMAX_RECORDS_H__
+#define __ONERT_EXEC_MINMAX_RECORDS_H__
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <unordered_map>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Min/max of float tensors of each run, written to a file for calibration of
+ *        post-training quantization
+ *
+ * Executors record inputs and outputs of operations by @c MinMaxObserver while an execution is in
+ * progress, and the records of the run are appended to the file when it ends. Each line of the
+ * file is "<run> <min> <max> <tensor name>" for a tensor of the model, which record-minmax reads
+ * with "minmax" input data format. Runs of a session do not overlap, but jobs of a run may be
+ * recorded on multiple threads.
+ */
+class MinMaxRecords
+{
+public:
+  /**
+   * @param[in] filepath File to write records to, which is truncated
+   */
+  explicit MinMaxRecords(const std::string &filepath);
+
+  /**
+   * @brief Start collecting a new run
+   */
+  void beginRun();
+  /**
+   * @brief End the current run and append its records to the file
+   */
+  void endRun();
+  /**
+   * @brief     Record min/max of a tensor in the current run
+   * @param[in] name Name of the tensor in the model
+   * @param[in] min  Minimum of the values
+   * @param[in] max  Maximum of the values
+   *
+   * @note A tensor written several times in a run, e.g. in a loop, has min/max of all the writes
+   */
+  void record(const std::string &name, float min, float max);
+  /**
+   * @brief Get the number of runs ended
+   */
+  uint64_t runs() const;
+
+private:
+  mutable std::mutex _mutex;
+  std::ofstream _file;
+  // Records of the current run in the order they are first made
+  std::vector<std::pair<std::string, std::pair<float, float>>> _records;
+  std::unordered_map<std::string, size_t> _record_index;
+  uint64_t _runs = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_MINMAX_RECORDS_H__
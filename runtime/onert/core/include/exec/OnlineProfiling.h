@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_ONLINE_PROFILING_H__
+#define __ONERT_EXEC_ONLINE_PROFILING_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Progress of profiling production runs to refine exec times for HEScheduler
+ *
+ * A round of online profiling starts with each compilation. It ends when the estimates have been
+ * stable for a few runs or the runs given for profiling are used up. The session recompiles at
+ * the end of every round, and the profiling finishes after a round in which HEScheduler had no
+ * backend left to try.
+ */
+class OnlineProfiling
+{
+public:
+  /**
+   * @param max_runs Number of runs to profile at most
+   */
+  explicit OnlineProfiling(uint32_t max_runs) : _max_runs{max_runs} {}
+
+public:
+  /**
+   * @brief Start a new round with a compilation
+   */
+  void startRound()
+  {
+    _exploring = false;
+    _stable_runs = 0;
+    _max_change = 0;
+  }
+  /**
+   * @brief Mark that the current round runs operations on backends without exec time records
+   */
+  void markExploring() { _exploring = true; }
+  /**
+   * @brief Record a relative change of an exec time estimate by the current run
+   */
+  void addChange(double change) { _max_change = std::max(_max_change, change); }
+  /**
+   * @brief End a run of the primary subgraph
+   */
+  void endRun()
+  {
+    ++_runs;
+    _stable_runs = (_max_change < STABLE_CHANGE) ? _stable_runs + 1 : 0;
+    _max_change = 0;
+  }
+
+public:
+  /**
+   * @brief Return true if the current round is over so that the session should recompile
+   */
+  bool needReschedule() const { return budgetUsedUp() || _stable_runs >= STABLE_RUNS; }
+  /**
+   * @brief Return true if no more round is needed after the current one
+   */
+  bool finished() const { return budgetUsedUp() || (!_exploring && _stable_runs >= STABLE_RUNS); }
+  uint32_t runs() const { return _runs; }
+
+private:
+  bool budgetUsedUp() const { return _runs >= _max_runs; }
+
+private:
+  // Estimates are stable if no estimate changes more than 5% for 3 runs in a row
+  static constexpr double STABLE_CHANGE = 0.05;
+  static constexpr uint32_t STABLE_RUNS = 3;
+
+  uint32_t _max_runs;
+  uint32_t _runs = 0;
+  uint32_t _stable_runs = 0;
+  double _max_change = 0;
+  // Subgraphs may be scheduled on multiple threads
+  std::atomic<bool> _exploring{false};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_ONLINE_PROFILING_H__
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_PRIORITY_GATE_H__
+#define __ONERT_EXEC_PRIORITY_GATE_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Gate to let executions with higher priority run first on shared cores
+ *
+ * Each execution enters the gate by @c Entry with the priority of its session while it runs.
+ * Executors pass the preemption point between operations, where the calling thread waits while
+ * any execution with higher priority is running. Executions of the same priority never wait for
+ * each other, so sessions which do not set priority are not affected.
+ */
+class PriorityGate
+{
+public:
+  /**
+   * @brief Entry of an execution on the calling thread to the gate, which leaves on destruction
+   */
+  class Entry
+  {
+  public:
+    /**
+     * @param gate     Gate to enter
+     * @param priority Priority of the execution. Higher runs first, and the default is 0.
+     */
+    Entry(PriorityGate &gate, int32_t priority);
+    Entry(const Entry &) = delete;
+    Entry &operator=(const Entry &) = delete;
+    ~Entry();
+
+  private:
+    PriorityGate &_gate;
+    int32_t _priority;
+    int32_t _prev_priority;
+  };
+
+public:
+  /**
+   * @brief Get the gate shared by all sessions of the process
+   */
+  static PriorityGate &get();
+
+public:
+  /**
+   * @brief Preemption point to wait while executions with higher priority are running
+   */
+  void pass()
+  {
+    if (_highest.load(std::memory_order_relaxed) > _thread_priority)
+      wait();
+  }
+  /**
+   * @brief Get the highest priority among the executions in the gate
+   */
+  int32_t highest() const { return _highest.load(); }
+
+private:
+  void add(int32_t priority);
+  void remove(int32_t priority);
+  void wait();
+
+private:
+  static constexpr int32_t NO_PRIORITY = INT32_MIN;
+  static thread_local int32_t _thread_priority;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  // Number of executions in the gate for each priority
+  std::map<int32_t, uint32_t> _entries;
+  std::atomic<int32_t> _highest{NO_PRIORITY};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PRIORITY_GATE_H__
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_RUN_STATS_H__
+#define __ONERT_EXEC_RUN_STATS_H__
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+class Backend;
+} // namespace backend
+
+namespace exec
+{
+
+/**
+ * @brief Breakdown of the time and memory of runs, collected for the last one
+ *
+ * Executors record operation times by @c RunStatsObserver while an execution is in progress, and
+ * the result is published when the execution ends. Runs of a session do not overlap, but jobs of
+ * a run may be recorded on multiple threads.
+ */
+class RunStats
+{
+public:
+  struct Stats
+  {
+    uint64_t total_us = 0;
+    // Time of Permute operations, which is not counted as time of any backend
+    uint64_t permute_us = 0;
+    // Time of operations with dynamic tensors, which is counted as time of backends as well
+    uint64_t dynamic_shape_us = 0;
+    // Peak bytes of memory for tensors that backends which track it used
+    uint64_t peak_memory = 0;
+    // Time of operations on each backend by backend id
+    std::vector<std::pair<std::string, uint64_t>> backend_us;
+  };
+
+public:
+  /**
+   * @brief Start collecting a new run
+   */
+  void beginRun();
+  /**
+   * @brief     End the current run and publish its stats
+   * @param[in] total_us Time the whole run took
+   */
+  void endRun(uint64_t total_us);
+  /**
+   * @brief     Record the time of an operation of the current run
+   * @param[in] backend Backend the operation ran on
+   * @param[in] permute @c true if the operation is Permute
+   * @param[in] dynamic @c true if the operation has dynamic tensors
+   * @param[in] ns      Time of the operation in nanoseconds
+   */
+  void addOpTime(const backend::Backend *backend, bool permute, bool dynamic, uint64_t ns);
+  /**
+   * @brief     Record the peak memory use of an executor in the current run
+   * @param[in] owner Executor, whose memory is counted once however many times it runs
+   * @param[in] bytes Peak bytes of memory used by the executor
+   */
+  void addPeakMemory(const void *owner, uint64_t bytes);
+  /**
+   * @brief Get the stats of the last run, which are empty if none has ended
+   */
+  Stats last() const;
+  /**
+   * @brief Get the number of runs ended
+   */
+  uint64_t runs() const;
+
+private:
+  mutable std::mutex _mutex;
+  // Times of the current run are summed in nanoseconds not to lose short operations
+  uint64_t _permute_ns = 0;
+  uint64_t _dynamic_shape_ns = 0;
+  std::unordered_map<const backend::Backend *, uint64_t> _backend_ns;
+  std::unordered_map<const void *, uint64_t> _peak_memory;
+  Stats _last;
+  uint64_t _runs = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_RUN_STATS_H__
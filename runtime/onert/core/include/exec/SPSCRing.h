@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_SPSC_RING_H__
+#define __ONERT_EXEC_SPSC_RING_H__
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Bounded lock-free ring buffer for one producer thread and one consumer thread
+ *
+ * The producer only writes the tail and the consumer only writes the head, so neither of them
+ * takes a lock. Each index lives in its own cache line to avoid false sharing between the two.
+ *
+ * @tparam T Element type, which must be default-constructible and movable
+ */
+template <typename T> class SPSCRing
+{
+public:
+  /**
+   * @brief Construct a SPSCRing object
+   *
+   * @param capacity Maximum number of elements, which must be positive
+   */
+  SPSCRing(size_t capacity) : _slots(capacity + 1)
+  {
+    if (capacity == 0)
+      throw std::runtime_error{"SPSCRing: capacity must be positive"};
+  }
+
+public:
+  /**
+   * @brief Push an element. Only the producer thread may call this.
+   *
+   * @return @c true if pushed, @c false if the ring is full
+   */
+  bool tryPush(T &&value)
+  {
+    const auto tail = _tail.load(std::memory_order_relaxed);
+    const auto next = advance(tail);
+    if (next == _head.load(std::memory_order_acquire))
+      return false;
+    _slots[tail] = std::move(value);
+    _tail.store(next, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Pop an element. Only the consumer thread may call this.
+   *
+   * @param[out] value Popped element
+   * @return @c true if popped, @c false if the ring is empty
+   */
+  bool tryPop(T &value)
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire))
+      return false;
+    value = std::move(_slots[head]);
+    _head.store(advance(head), std::memory_order_release);
+    return true;
+  }
+
+  size_t capacity() const { return _slots.size() - 1; }
+
+private:
+  size_t advance(size_t index) const { return index + 1 == _slots.size() ? 0 : index + 1; }
+
+private:
+  std::vector<T> _slots;
+  alignas(64) std::atomic<size_t> _head{0};
+  alignas(64) std::atomic<size_t> _tail{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_SPSC_RING_H__
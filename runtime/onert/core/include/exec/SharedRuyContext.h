@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_SHARED_RUY_CONTEXT_H__
+#define __ONERT_EXEC_SHARED_RUY_CONTEXT_H__
+
+#include "exec/ThreadBudget.h"
+
+#include <memory>
+#include <mutex>
+
+namespace ruy
+{
+class Context;
+} // namespace ruy
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief ruy context whose worker threads are shared by the kernels of all backends and sessions
+ *
+ * ruy creates workers for each context and cker kernels also split their work on ruy's thread
+ * pool, so the backends take turns on this context instead of keeping workers of their own. A
+ * kernel which finds it in use by another one runs on the calling thread with its own context,
+ * which does not create any worker as it runs with a single thread.
+ */
+class SharedRuyContext
+{
+public:
+  /**
+   * @brief Threads and the context leased for a kernel, which are returned on destruction
+   *
+   * While a lease is kept, @c current() of the calling thread is its context.
+   */
+  class Lease
+  {
+  public:
+    Lease(ThreadBudget::Lease &&threads, ruy::Context *context,
+          std::unique_lock<std::mutex> &&lock);
+    Lease(Lease &&other);
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+    Lease &operator=(Lease &&) = delete;
+    ~Lease();
+
+  public:
+    /**
+     * @brief Number of threads to use including the calling thread
+     */
+    uint32_t threads() const { return _threads.threads(); }
+    ruy::Context *context() const { return _context; }
+
+  private:
+    ThreadBudget::Lease _threads;
+    ruy::Context *_context;
+    ruy::Context *_prev;
+    std::unique_lock<std::mutex> _lock;
+    bool _active;
+  };
+
+public:
+  /**
+   * @brief Get the context shared by all sessions of the process
+   */
+  static SharedRuyContext &get();
+  /**
+   * @brief Get the context leased by the calling thread
+   *
+   * @return Context of the lease the calling thread keeps, nullptr if it has none
+   */
+  static ruy::Context *current();
+
+public:
+  explicit SharedRuyContext(ThreadBudget &budget);
+  ~SharedRuyContext();
+
+public:
+  /**
+   * @brief Lease threads and a context for a kernel
+   *
+   * @param cost Estimated cost of the kernel such as the number of multiply-accumulates
+   * @param max_threads Maximum number of threads the kernel can use
+   * @param fallback Context to run the kernel with on the calling thread, which is used if the
+   *                 kernel gets a single thread or the shared context is in use
+   * @return Lease of the shared context with its threads, or of @c fallback with a single thread
+   */
+  Lease lease(uint64_t cost, uint32_t max_threads, ruy::Context *fallback);
+  /**
+   * @brief Drop the weights ruy has packed and cached
+   *
+   * ruy looks up the cache by the address of the weights, so it must be cleared when the weights
+   * of a session are freed. Otherwise weights allocated at the same address later would hit.
+   */
+  void clearCache();
+
+private:
+  ThreadBudget &_budget;
+  const std::unique_ptr<ruy::Context> _context;
+  std::mutex _mutex;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_SHARED_RUY_CONTEXT_H__
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_THREAD_BUDGET_H__
+#define __ONERT_EXEC_THREAD_BUDGET_H__
+
+#include <atomic>
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Budget of threads shared by operations running at the same time
+ *
+ * Kernels using a thread pool lease threads for each run according to their cost, so that
+ * operations running concurrently on executor workers share the cores instead of each using a
+ * fixed number of threads. The budget is set by THREAD_BUDGET, which is 0 to disable it or -1 to
+ * use all cores.
+ */
+class ThreadBudget
+{
+public:
+  /**
+   * @brief Threads leased for an operation, which are returned on destruction
+   */
+  class Lease
+  {
+  public:
+    Lease(ThreadBudget *budget, uint32_t threads) : _budget{budget}, _threads{threads} {}
+    Lease(Lease &&other) : _budget{other._budget}, _threads{other._threads}
+    {
+      other._budget = nullptr;
+    }
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+    Lease &operator=(Lease &&) = delete;
+    ~Lease()
+    {
+      if (_budget)
+        _budget->release(_threads);
+    }
+
+  public:
+    /**
+     * @brief Number of threads to use including the calling thread
+     */
+    uint32_t threads() const { return _threads; }
+
+  private:
+    ThreadBudget *_budget;
+    uint32_t _threads;
+  };
+
+public:
+  /**
+   * @brief Get the budget shared by all sessions of the process
+   */
+  static ThreadBudget &get();
+
+public:
+  /**
+   * @param capacity Number of threads which may run at the same time, 0 to disable the budget
+   */
+  explicit ThreadBudget(uint32_t capacity) : _capacity{capacity} {}
+
+public:
+  bool enabled() const { return _capacity > 0; }
+  uint32_t capacity() const { return _capacity; }
+  uint32_t inUse() const { return _in_use.load(); }
+  /**
+   * @brief Lease threads for an operation
+   *
+   * @param cost Estimated cost of the operation such as the number of multiply-accumulates
+   * @param max_threads Maximum number of threads the caller can use
+   * @return Lease of at least one thread and at most threads not in use by the others.
+   *         If the budget is disabled, it has @c max_threads threads that are not counted.
+   */
+  Lease lease(uint64_t cost, uint32_t max_threads);
+
+public:
+  // Cost which is not worth splitting for another thread
+  static constexpr uint64_t MIN_COST_PER_THREAD = 1 << 16;
+
+private:
+  void release(uint32_t threads) { _in_use.fetch_sub(threads); }
+
+private:
+  const uint32_t _capacity;
+  std::atomic<uint32_t> _in_use{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_THREAD_BUDGET_H__
@@ -17,8 +17,13 @@
 #ifndef __ONERT_IR_DATA_H__
 #define __ONERT_IR_DATA_H__
 
+#include "util/HugePages.h"
+
 #include <algorithm>
+#include <memory>
+#include <stdexcept>
 #include <sys/mman.h>
+#include <unistd.h>
 
 namespace onert
 {
@@ -31,25 +36,27 @@ struct Data
 
   virtual size_t size(void) const = 0;
   virtual const uint8_t *base(void) const = 0;
+  /**
+   * @brief Drop memory of the data if it can be read again, e.g. after a backend copied it
+   */
+  virtual void release(void) const {}
 };
 
 class CachedData final : public Data
 {
 public:
-  CachedData(const uint8_t *base, size_t size) : _base{new uint8_t[size]}, _size{size}
+  CachedData(const uint8_t *base, size_t size)
+    : _base{util::allocatePages(size, "constant", false)}, _size{size}
   {
-    std::copy(base, base + size, _base);
+    std::copy(base, base + size, _base.get());
   }
 
-public:
-  ~CachedData() { delete[] _base; }
-
 public:
   size_t size(void) const override { return _size; }
-  const uint8_t *base(void) const override { return _base; }
+  const uint8_t *base(void) const override { return _base.get(); }
 
 private:
-  uint8_t *_base;
+  util::PageMemory _base;
   size_t _size;
 };
 
@@ -80,7 +87,8 @@ public:
         static_cast<uint8_t *>(mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, fd, mmap_offset))),
       _mmap_size(mmap_size), _offset(data_offset - mmap_offset)
   {
-    // DO NOTHING
+    if (_mmap_base == MAP_FAILED)
+      throw std::runtime_error{"MMapedData: mmap failed"};
   }
 
 public:
@@ -101,6 +109,62 @@ private:
   std::ptrdiff_t _offset;
 };
 
+/**
+ * @brief Read-only mapping of a whole model file, shared by the constants in it
+ */
+class MappedFile
+{
+public:
+  /**
+   * @brief Take the ownership of a mapping
+   */
+  MappedFile(uint8_t *base, size_t size) : _base{base}, _size{size}
+  {
+    // DO NOTHING
+  }
+  ~MappedFile() { munmap(_base, _size); }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+  const uint8_t *base(void) const { return _base; }
+  size_t size(void) const { return _size; }
+
+private:
+  uint8_t *_base;
+  size_t _size;
+};
+
+/**
+ * @brief Data viewing a range of a mapped file
+ *
+ * Pages of the range are read from the page cache when accessed, so a constant takes memory only
+ * if it is used. @c release drops the pages, which are read again from the file if accessed later.
+ */
+class MappedFileData final : public ExternalData
+{
+public:
+  MappedFileData(const std::shared_ptr<const MappedFile> &file, std::ptrdiff_t offset,
+                 size_t size)
+    : ExternalData(file->base() + offset, size), _file{file}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void release(void) const override
+  {
+    const auto pagesize = static_cast<uintptr_t>(getpagesize());
+    const auto begin = reinterpret_cast<uintptr_t>(base()) / pagesize * pagesize;
+    const auto end = reinterpret_cast<uintptr_t>(base()) + size();
+    madvise(reinterpret_cast<void *>(begin), end - begin, MADV_DONTNEED);
+  }
+
+private:
+  std::shared_ptr<const MappedFile> _file;
+};
+
 } // namespace ir
 } // namespace onert
 
@@ -142,6 +142,10 @@ public:
   {
     return _tensor_names;
   }
+  const std::shared_ptr<std::unordered_map<ir::OperandIndex, std::string>> &tensor_names() const
+  {
+    return _tensor_names;
+  }
   std::unordered_map<std::string, IOIndex>::iterator _name_to_input_begin()
   {
     return _name_to_input.begin();
@@ -164,6 +168,11 @@ public:
   // Topological sort
 public:
   std::vector<ir::OperationIndex> topolSortOperations() const;
+  /**
+   * @brief Set order of execution of operations planned ahead, e.g. by the model
+   */
+  void setPlannedOrder(const std::vector<OperationIndex> &order) { _planned_order = order; }
+  const std::vector<OperationIndex> &plannedOrder() const { return _planned_order; }
 
 private:
   Operations _operations;
@@ -180,6 +189,7 @@ private:
   // Partial Graphs
   std::shared_ptr<ir::Subgraphs> _partialgraphs;
   std::shared_ptr<std::unordered_map<ir::OperandIndex, std::string>> _tensor_names;
+  std::vector<OperationIndex> _planned_order;
 };
 
 } // namespace ir
@@ -25,6 +25,8 @@
 #include "ir/TypeInfo.h"
 #include "ir/Layout.h"
 
+#include <limits>
+
 namespace onert
 {
 namespace ir
@@ -135,6 +137,20 @@ public:
   bool isVariable() const { return _variable; }
   bool isDynamic() const { return _alloc_type == MemAllocType::DYNAMIC; }
   void setDynamic() { _alloc_type = MemAllocType::DYNAMIC; }
+  /**
+   * @brief Set offset of the tensor in the memory arena, planned ahead by the model
+   */
+  void plannedOffset(uint32_t offset) { _planned_offset = offset; }
+  bool hasPlannedOffset() const { return _planned_offset != UNPLANNED_OFFSET; }
+  void clearPlannedOffset() { _planned_offset = UNPLANNED_OFFSET; }
+  uint32_t plannedOffset() const
+  {
+    assert(hasPlannedOffset());
+    return _planned_offset;
+  }
+
+private:
+  static constexpr uint32_t UNPLANNED_OFFSET = std::numeric_limits<uint32_t>::max();
 
 private:
   Shape _shape;
@@ -143,6 +159,7 @@ private:
   MemAllocType _alloc_type;
   bool _const;
   bool _variable;
+  uint32_t _planned_offset = UNPLANNED_OFFSET;
 };
 
 } // namespace ir
@@ -18,6 +18,7 @@
 
 #include "ir/operation/AddN.h"
 #include "ir/operation/ArgMinMax.h"
+#include "ir/operation/Attention.h"
 #include "ir/operation/BatchMatMul.h"
 #include "ir/operation/BatchToSpaceND.h"
 #include "ir/operation/BCQFullyConnected.h"
@@ -47,6 +48,7 @@
 #include "ir/operation/If.h"
 #include "ir/operation/InstanceNorm.h"
 #include "ir/operation/L2Normalization.h"
+#include "ir/operation/LayerNorm.h"
 #include "ir/operation/LocalResponseNormalization.h"
 #include "ir/operation/LogSoftmax.h"
 #include "ir/operation/LSTM.h"
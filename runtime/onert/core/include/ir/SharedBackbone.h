@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_SHARED_BACKBONE_H__
+#define __ONERT_IR_SHARED_BACKBONE_H__
+
+#include "ir/Subgraphs.h"
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace ir
+{
+
+/**
+ * @brief Graph of models which run their identical operations once
+ */
+struct SharedBackbone
+{
+  // Subgraphs of the merged primary graph
+  std::shared_ptr<Subgraphs> subgraphs;
+  // Index of the first output of each model in outputs of the merged graph
+  std::vector<uint32_t> output_begins;
+  // Operations of models after the first one which are run by an operation of an earlier model
+  uint32_t shared_operations = 0;
+};
+
+/**
+ * @brief Merge models which take the same inputs into a graph, where operations of identical
+ *        operation codes, parameters and inputs are run once for all of the models
+ *
+ * Models after the first one share a prefix of their graph with earlier models, which is e.g. the
+ * backbone of heads, and their outputs fan out from the shared operations. Inputs of the merged
+ * graph are ones of the first model, and its outputs are outputs of the models one after another.
+ *
+ * @note  - Parameters are compared byte by byte, so only equal ones without padding are
+ *          found to be the same, and custom operations are never shared
+ *        - Operations of model outputs are not shared to keep outputs of models apart
+ *        - Offsets and execution orders planned for each model are dropped
+ * @throw std::runtime_error if models have other subgraphs than the primary one, or inputs of
+ *        models are not the same
+ */
+SharedBackbone mergeSharedBackbone(const std::vector<std::shared_ptr<Subgraphs>> &models);
+
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_SHARED_BACKBONE_H__
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_OPERATION_ATTENTION_H__
+#define __ONERT_IR_OPERATION_ATTENTION_H__
+
+#include "ir/Operation.h"
+
+namespace onert
+{
+namespace ir
+{
+namespace operation
+{
+
+/**
+ * @brief Scaled dot-product attention, softmax(QUERY x KEY^T x scale + MASK) x VALUE
+ *
+ * QUERY is [..., S, D], KEY is [..., T, D] and VALUE is [..., T, E] with the same leading
+ * dimensions, and the output is [..., S, E]. MASK is optional and broadcast to [..., S, T].
+ *
+ * This operation does not come from models. AttentionFusionPass makes it from the chain of
+ * operations for attention so that the score matrix [..., S, T] does not need to be stored.
+ */
+class Attention : public Operation
+{
+public:
+  enum Input
+  {
+    QUERY = 0,
+    KEY,
+    VALUE,
+    MASK
+  };
+
+  struct Param
+  {
+    float scale;
+  };
+
+public:
+  Attention(const OperandIndexSequence &inputs, const OperandIndexSequence &outputs,
+            const Param &param);
+
+public:
+  void accept(OperationVisitor &v) const override;
+  OpCode opcode() const final { return OpCode::Attention; }
+
+public:
+  const Param &param() const { return _param; }
+
+private:
+  Param _param;
+};
+
+} // namespace operation
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_OPERATION_ATTENTION_H__
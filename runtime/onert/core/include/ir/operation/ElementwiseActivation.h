@@ -40,12 +40,15 @@ public:
     LOGISTIC,
     RELU,
     TANH,
-    LEAKY_RELU
+    LEAKY_RELU,
+    HARD_SWISH,
+    GELU
   };
 
   struct Param
   {
     Type op_type;
+    // NOTE GELU takes non-zero alpha as its tanh approximation
     float alpha;
     float beta;
     Param() : op_type(Type::ELU), alpha(0.0f), beta(0.0f) {}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_ATOMIC_FILE_H__
+#define __ONERT_UTIL_ATOMIC_FILE_H__
+
+#include <cstddef>
+#include <string>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Write a whole file by writing a temporary file next to it and renaming it
+ *
+ * Other sessions and processes reading or mapping the file see either the old file or the new
+ * one, never a partial file. The temporary file is removed if writing fails.
+ *
+ * @return true if the file is written, false otherwise, e.g. in a read-only directory
+ */
+bool writeFileAtomically(const std::string &path, const void *data, size_t size);
+
+inline bool writeFileAtomically(const std::string &path, const std::string &contents)
+{
+  return writeFileAtomically(path, contents.data(), contents.size());
+}
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_ATOMIC_FILE_H__
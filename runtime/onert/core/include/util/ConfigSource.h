@@ -18,6 +18,8 @@
 #define __ONERT_UTIL_CONFIG_SOURCE_H__
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include "IConfigSource.h"
 
@@ -36,6 +38,28 @@ bool getConfigBool(const std::string &key);
 int getConfigInt(const std::string &key);
 std::string getConfigString(const std::string &key);
 
+/**
+ * @brief Scope of config values which take precedence over all sources
+ *
+ * Scopes nest, where the innermost one wins for a key it has. Values are process-wide while a scope
+ * is alive, so that backends compiling on worker threads read them as well.
+ *
+ * @note Sessions compiling at the same time read the values too
+ */
+class ScopedConfig
+{
+public:
+  explicit ScopedConfig(const std::unordered_map<std::string, std::string> &values);
+  ~ScopedConfig();
+
+  ScopedConfig(const ScopedConfig &) = delete;
+  ScopedConfig &operator=(const ScopedConfig &) = delete;
+
+private:
+  // Key of the scope in the stack of scopes
+  uint64_t _id;
+};
+
 } // namespace util
 } // namespace onert
 
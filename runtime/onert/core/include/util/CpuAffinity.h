@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_CPU_AFFINITY_H__
+#define __ONERT_UTIL_CPU_AFFINITY_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Cores of a big.LITTLE CPU, which are told apart by their capacity or maximum frequency
+ * @note  @c little is empty if all cores are alike
+ */
+struct CpuClusters
+{
+  std::vector<uint32_t> big;
+  std::vector<uint32_t> little;
+};
+
+/**
+ * @brief Get the clusters of cores of this system
+ */
+const CpuClusters &cpuClusters();
+
+/**
+ * @brief Affinity of runtime threads given by CPU_AFFINITY
+ *
+ * CPU_AFFINITY is one of
+ * - ""       : Threads run on any core (default)
+ * - "big"    : Threads run on the big cores
+ * - "little" : Threads run on the little cores
+ * - "auto"   : Threads run on the big cores, but the calling thread of linear executors runs light
+ *              operations on the little cores
+ * - A list of cores, e.g. "0,2,4-7"
+ */
+class CpuAffinity
+{
+public:
+  static const CpuAffinity &get();
+
+  /**
+   * @brief Parse a value of CPU_AFFINITY
+   * @throw std::runtime_error if the value is invalid
+   */
+  static CpuAffinity parse(const std::string &value, const CpuClusters &clusters);
+
+public:
+  /**
+   * @brief Get the cores of runtime threads, empty if threads can run on any core
+   */
+  const std::vector<uint32_t> &cores() const { return _cores; }
+  /**
+   * @brief Return true if light operations go to the little cores
+   */
+  bool isAuto() const { return _auto; }
+
+private:
+  std::vector<uint32_t> _cores;
+  bool _auto = false;
+};
+
+/**
+ * @brief Let the calling thread run on the given cores only
+ * @return true if the affinity is set
+ */
+bool setThreadAffinity(const std::vector<uint32_t> &cores);
+
+/**
+ * @brief Restrict the calling thread to the cores of CPU_AFFINITY in the scope, so that threads
+ *        created in the scope, e.g. workers of ruy or XNNPACK, inherit the affinity
+ */
+class ScopedCpuAffinity
+{
+public:
+  ScopedCpuAffinity();
+  ~ScopedCpuAffinity();
+
+  ScopedCpuAffinity(const ScopedCpuAffinity &) = delete;
+  ScopedCpuAffinity &operator=(const ScopedCpuAffinity &) = delete;
+
+  /**
+   * @brief Move the calling thread to the big or the little cores, if CPU_AFFINITY is "auto"
+   */
+  void useBigCores(bool big);
+
+private:
+  std::vector<uint32_t> _saved;
+  bool _restore = false;
+  bool _big = true;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_CPU_AFFINITY_H__
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_HEAP_PHASE_H__
+#define __ONERT_UTIL_HEAP_PHASE_H__
+
+#include <string>
+
+/**
+ * @brief Hooks of runtime/contrib/heap_trace, which are defined only if the library is preloaded
+ */
+extern "C" void heap_trace_enter_phase(const char *phase) __attribute__((weak));
+extern "C" void heap_trace_leave_phase() __attribute__((weak));
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Scope whose heap allocations heap_trace attributes to a phase of onert
+ *
+ * Phases nest, e.g. "compile/pass/X", and are process-wide so that allocations of worker threads
+ * count for the phase. It does nothing unless heap_trace is preloaded.
+ */
+class HeapPhase
+{
+public:
+  explicit HeapPhase(const std::string &name)
+  {
+    if (heap_trace_enter_phase != nullptr && heap_trace_leave_phase != nullptr)
+    {
+      heap_trace_enter_phase(name.c_str());
+      _entered = true;
+    }
+  }
+
+  ~HeapPhase()
+  {
+    if (_entered)
+      heap_trace_leave_phase();
+  }
+
+  HeapPhase(const HeapPhase &) = delete;
+  HeapPhase &operator=(const HeapPhase &) = delete;
+
+private:
+  bool _entered = false;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_HEAP_PHASE_H__
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_HUGE_PAGES_H__
+#define __ONERT_UTIL_HUGE_PAGES_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Pages of large buffers given by HUGE_PAGES
+ *
+ * HUGE_PAGES is one of
+ * - ""        : Buffers are allocated as usual (default)
+ * - "thp"     : Buffers of a huge page or more are aligned to huge pages and madvise'd with
+ *               MADV_HUGEPAGE, so that transparent huge pages back them if the kernel has some
+ * - "hugetlb" : Buffers of a huge page or more are mapped with MAP_HUGETLB of the pages reserved
+ *               in /proc/sys/vm/nr_hugepages, and fall back to "thp" if there are not enough
+ */
+enum class HugePageMode
+{
+  NONE,
+  THP,
+  HUGETLB,
+};
+
+/**
+ * @brief Parse a value of HUGE_PAGES
+ * @throw std::runtime_error if the value is invalid
+ */
+HugePageMode parseHugePageMode(const std::string &value);
+
+/**
+ * @brief Get the mode of HUGE_PAGES, which is read once
+ */
+HugePageMode hugePageMode();
+
+/**
+ * @brief Size of a huge page, e.g. 2MiB on x86_64 and aarch64 of 4KiB pages
+ */
+size_t hugePageSize();
+
+/**
+ * @brief Deleter of memory by allocatePages(), which knows how it was allocated
+ */
+struct PageDeleter
+{
+  // Bytes mapped by mmap, 0 for memory by new[]
+  size_t mapped_size = 0;
+  // Label of the buffer for reports
+  const char *what = nullptr;
+  // Whether the memory is of hugetlb pages, or else of transparent huge pages if any
+  bool hugetlb = false;
+
+  void operator()(uint8_t *ptr) const;
+};
+
+using PageMemory = std::unique_ptr<uint8_t[], PageDeleter>;
+
+/**
+ * @brief Pages by allocatePages() so far, for reports and tests
+ */
+struct HugePageStats
+{
+  uint64_t hugetlb_buffers = 0;
+  uint64_t hugetlb_bytes = 0;
+  uint64_t thp_buffers = 0;
+  uint64_t thp_bytes = 0;
+  uint64_t small_buffers = 0;
+  uint64_t small_bytes = 0;
+};
+
+HugePageStats hugePageStats();
+
+/**
+ * @brief Allocate memory of size bytes by the given mode
+ * @param what Label of the buffer in reports, e.g. "arena" or "constant"
+ * @param zero Whether memory must be filled with zeros. Mapped memory is always zeros.
+ * @note  Huge pages are used only for buffers of hugePageSize() or more, and each of them is
+ *        reported to VERBOSE(HugePages) with the pages it got
+ */
+PageMemory allocatePages(size_t size, HugePageMode mode, const char *what, bool zero = true);
+
+/**
+ * @brief Allocate memory of size bytes by HUGE_PAGES
+ */
+inline PageMemory allocatePages(size_t size, const char *what, bool zero = true)
+{
+  return allocatePages(size, hugePageMode(), what, zero);
+}
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_HUGE_PAGES_H__
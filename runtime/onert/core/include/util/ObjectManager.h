@@ -19,11 +19,13 @@
 
 #include "util/logging.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
-#include <list>
 #include <memory>
+#include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 namespace onert
 {
@@ -33,6 +35,9 @@ namespace util
 /**
  * @brief Class that owns objects and maps them with indices as a handle for them
  *
+ * Objects are kept in a vector of slots at their index values, so that lookups and iterations do
+ * not hash. Indices far beyond the slots, which are rare, are kept in a map instead not to grow
+ * the slots too much. Indices are never reused, so a removed one leaves an empty slot.
  */
 template <typename Index, typename Object> class ObjectManager
 {
@@ -51,7 +56,7 @@ public:
     auto index = generateIndex();
     if (!index.valid())
       return index;
-    _objects.emplace(index, std::make_unique<Object>(std::forward<Args>(args)...));
+    store(index, std::make_unique<Object>(std::forward<Args>(args)...));
     return index;
   }
 
@@ -68,7 +73,7 @@ public:
   {
     auto gen_index = tryIndex(index);
     if (gen_index.valid())
-      _objects.emplace(gen_index, std::move(object));
+      store(gen_index, std::move(object));
     return gen_index;
   }
   /**
@@ -83,7 +88,7 @@ public:
   {
     auto gen_index = generateIndex();
     if (gen_index.valid())
-      _objects.emplace(gen_index, std::move(object));
+      store(gen_index, std::move(object));
     return gen_index;
   }
   /**
@@ -99,7 +104,7 @@ public:
   Index set(Index index, std::unique_ptr<Object> &&object)
   {
     if (index.valid())
-      _objects[index] = std::move(object);
+      store(index, std::move(object));
     return index;
   }
   /**
@@ -108,7 +113,19 @@ public:
    * @param[in] index Index of the object to be removed
    * @return N/A
    */
-  void remove(const Index &index) { _objects.erase(index); }
+  void remove(const Index &index)
+  {
+    if (index.value() < _slots.size())
+    {
+      if (_slots[index.value()] != nullptr)
+        --_size;
+      _slots[index.value()].reset();
+    }
+    else
+    {
+      _size -= _sparse_objects.erase(index);
+    }
+  }
 
   /**
    * @brief Get the object that is associated with the given index
@@ -118,7 +135,13 @@ public:
    * @param[in] index Index of the object to be returned
    * @return Object
    */
-  const Object &at(const Index &index) const { return *(_objects.at(index)); }
+  const Object &at(const Index &index) const
+  {
+    auto ptr = getRawPtr(index);
+    if (ptr == nullptr)
+      throw std::out_of_range{"ObjectManager: no object at the index"};
+    return *ptr;
+  }
   /**
    * @brief Get the object that is associated with the given index
    *
@@ -127,7 +150,10 @@ public:
    * @param[in] index Index of the object to be returned
    * @return Object
    */
-  Object &at(const Index &index) { return *(_objects.at(index)); }
+  Object &at(const Index &index)
+  {
+    return const_cast<Object &>(const_cast<const ObjectManager<Index, Object> *>(this)->at(index));
+  }
   /**
    * @brief Get the object that is associated with the given index
    *
@@ -138,8 +164,11 @@ public:
    */
   const Object *getRawPtr(const Index &index) const
   {
-    auto itr = _objects.find(index);
-    if (itr == _objects.end())
+    if (index.value() < _slots.size())
+      return _slots[index.value()].get();
+
+    auto itr = _sparse_objects.find(index);
+    if (itr == _sparse_objects.end())
       return nullptr;
     else
     {
@@ -166,26 +195,35 @@ public:
    * @param[in] index Index of the object to be returned
    * @return true if such entry exists otherwise false
    */
-  bool exist(const Index &index) const
-  {
-    auto it = _objects.find(index);
-    return it != _objects.end();
-  }
+  bool exist(const Index &index) const { return getRawPtr(index) != nullptr; }
   /**
    * @brief Return the number of objects that the manager contains
    *
    * @return size_t Number of objects
    */
-  size_t size() const { return _objects.size(); }
+  size_t size() const { return _size; }
+  /**
+   * @brief Reserve room for a number of objects before adding many of them
+   *
+   * @param[in] size Number of objects
+   */
+  void reserve(size_t size) { _slots.reserve(size); }
   /**
    * @brief Iterate over the container with given function
    *
+   * Objects in the slots are visited in the order of indices
+   *
    * @param[in] fn Function to be run for every container entry
    * @return N/A
    */
   void iterate(const std::function<void(const Index &, const Object &)> &fn) const
   {
-    for (const auto &e : _objects)
+    for (uint32_t i = 0; i < _slots.size(); ++i)
+    {
+      if (_slots[i] != nullptr)
+        fn(Index{i}, *_slots[i]);
+    }
+    for (const auto &e : _sparse_objects)
     {
       fn(e.first, *e.second);
     }
@@ -193,23 +231,32 @@ public:
   /**
    * @brief Iterate over the container with given function
    *
+   * Objects added by @c fn are not visited
+   *
    * @param[in] fn Function to be run for every container entry
    * @return N/A
    */
   void iterate(const std::function<void(const Index &, Object &)> &fn)
   {
-    // TODO Remove this workaround
-    // This implementation is a workaround in case of adding operands while iteration
-    std::list<Index> l;
-
-    for (auto &e : _objects)
+    // NOTE fn may add objects, which may move the slots and rehash the map
+    const uint32_t num_slots = _slots.size();
+    std::vector<Index> sparse_indices;
+    sparse_indices.reserve(_sparse_objects.size());
+    for (const auto &e : _sparse_objects)
     {
-      l.push_back(e.first);
+      sparse_indices.push_back(e.first);
     }
 
-    for (auto &index : l)
+    for (uint32_t i = 0; i < num_slots; ++i)
     {
-      fn(index, *_objects[index]);
+      if (_slots[i] != nullptr)
+        fn(Index{i}, *_slots[i]);
+    }
+    for (const auto &index : sparse_indices)
+    {
+      auto object = getRawPtr(index);
+      if (object != nullptr)
+        fn(index, *object);
     }
   }
 
@@ -219,7 +266,7 @@ private:
   {
     if (!index.valid())
       return index;
-    if (_objects.find(index) == _objects.end())
+    if (!exist(index))
     {
       // If the given index does not exist, update the next index and return the index
       if (index.value() >= _next_index)
@@ -244,8 +291,54 @@ private:
       return Index{};
   }
 
+private:
+  /**
+   * @brief Put the object at the index, replacing the existing one if any
+   */
+  void store(const Index &index, std::unique_ptr<Object> &&object)
+  {
+    assert(index.valid());
+    const auto value = index.value();
+    if (value >= _slots.size() && value <= 2 * _slots.size() + kMinSlots)
+    {
+      // Grow the slots and move objects in the new range from the map
+      const auto new_size = std::max<size_t>(value + 1, 2 * _slots.size());
+      _slots.resize(new_size);
+      for (auto it = _sparse_objects.begin(); it != _sparse_objects.end();)
+      {
+        if (it->first.value() < new_size)
+        {
+          _slots[it->first.value()] = std::move(it->second);
+          it = _sparse_objects.erase(it);
+        }
+        else
+          ++it;
+      }
+    }
+
+    if (value < _slots.size())
+    {
+      if (_slots[value] == nullptr)
+        ++_size;
+      _slots[value] = std::move(object);
+    }
+    else
+    {
+      auto &entry = _sparse_objects[index];
+      if (entry == nullptr)
+        ++_size;
+      entry = std::move(object);
+    }
+  }
+
+  // Indices up to this number beyond the slots are stored in the slots even when they are empty
+  static constexpr size_t kMinSlots = 64;
+
+  std::vector<std::unique_ptr<Object>> _slots;
+  std::unordered_map<Index, std::unique_ptr<Object>> _sparse_objects;
+  size_t _size = 0;
+
 protected:
-  std::unordered_map<Index, std::unique_ptr<Object>> _objects;
   uint32_t _next_index;
 };
 
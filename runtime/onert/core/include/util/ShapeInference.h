@@ -43,6 +43,9 @@ using Shapes = std::vector<ir::Shape>;
 
 ir::Shape inferArgMinMaxShape(const ir::Shape &input_shape, int axis, int rank);
 
+ir::Shape inferAttentionShape(const ir::Shape &query_shape, const ir::Shape &key_shape,
+                              const ir::Shape &value_shape);
+
 ir::Shape inferBatchMatMulShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
                                 const ir::operation::BatchMatMul::Param &param);
 
@@ -135,12 +138,19 @@ StridedSliceParams buildStridedSliceParams(const T *begin, const T *end, const T
                                            const uint32_t begin_mask, const uint32_t end_mask,
                                            const uint32_t shrink_axis_mask, const uint8_t rank);
 
+int StartForAxis(const StridedSliceParams &params, const ir::Shape &input_shape, int axis);
+
+int StopForAxis(const StridedSliceParams &params, const ir::Shape &input_shape, int axis,
+                int start_for_axis);
+
 ir::Shape inferStridedSliceShape(const ir::Shape &input_shape, const StridedSliceParams &op_params,
                                  uint32_t rank);
 
 ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_buf,
                          const int32_t multiplier_size);
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, int32_t k);
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t rank);
 
@@ -73,12 +73,20 @@ public:
   /**
    * @brief Set subgraph index of a graph
    */
-  void setSubgraphIndex(const ir::Graph *g, uint32_t index) { _subgraph_indices.emplace(g, index); }
+  void setSubgraphIndex(const ir::Graph *g, uint32_t index)
+  {
+    std::lock_guard<std::mutex> lock{_subgraph_indices_mutex};
+    _subgraph_indices.emplace(g, index);
+  }
 
   /**
    * @brief Get subgraph index of a graph.
    */
-  ir::SubgraphIndex getSubgraphIndex(const ir::Graph *g) const { return _subgraph_indices.at(g); }
+  ir::SubgraphIndex getSubgraphIndex(const ir::Graph *g) const
+  {
+    std::lock_guard<std::mutex> lock{_subgraph_indices_mutex};
+    return _subgraph_indices.at(g);
+  }
 
 private:
   void decideSessionID()
@@ -90,6 +98,8 @@ private:
 
 private:
   std::unordered_map<const ir::Graph *, ir::SubgraphIndex> _subgraph_indices;
+  // Subgraphs may be lowered on multiple threads
+  mutable std::mutex _subgraph_indices_mutex;
   uint32_t _session_id;
   static std::mutex _session_id_mutex;
   static uint32_t _next_session_id;
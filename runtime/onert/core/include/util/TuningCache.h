@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TUNING_CACHE_H__
+#define __ONERT_UTIL_TUNING_CACHE_H__
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Cache of choices made by measuring, e.g. the fastest kernel for shapes of an operation
+ *
+ * Choices are kept in a text file of "<key> <value>" lines, so that later sessions and processes
+ * use them without measuring again. Keys must not have whitespaces.
+ */
+class TuningCache
+{
+public:
+  /**
+   * @brief Get the cache in the file of a config
+   *
+   * @param config_key Config of the file, like CPU_AUTOTUNE_CACHE
+   * @return The cache, nullptr if the config is not set
+   */
+  static TuningCache *get(const char *config_key);
+
+public:
+  /**
+   * @brief Construct a cache and read choices in the file if it exists
+   */
+  explicit TuningCache(const std::string &path);
+
+public:
+  /**
+   * @brief Get the choice of a key
+   * @return The choice, empty if it is not cached
+   */
+  std::string lookup(const std::string &key) const;
+  /**
+   * @brief Keep the choice of a key, and rewrite the file with it
+   * @note  Choices in the file stored by other processes are kept as well
+   */
+  void store(const std::string &key, const std::string &value);
+
+private:
+  void read();
+
+private:
+  std::string _path;
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, std::string> _values;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TUNING_CACHE_H__
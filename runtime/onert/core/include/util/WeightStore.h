@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_WEIGHT_STORE_H__
+#define __ONERT_UTIL_WEIGHT_STORE_H__
+
+#include "ir/Data.h"
+
+#include <memory>
+#include <string>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Store of weights kept in files to be memory-mapped by later sessions
+ *
+ * A file is named by a hash of the original weights and the way they are packed, so any session
+ * with the same weights finds it. The mapped pages are backed by the file, which lets sessions
+ * and processes share them and the OS drop them under memory pressure instead of keeping a copy
+ * in heap. A directory in tmpfs like /dev/shm keeps them in shared memory.
+ */
+class WeightStore
+{
+public:
+  /**
+   * @brief Get the store in the directory of a config
+   *
+   * @param config_key Config of the directory, like CPU_PACKED_WEIGHT_DIR
+   * @return The store, nullptr if the config is not set
+   */
+  static WeightStore *get(const char *config_key);
+  /**
+   * @brief Get the key of weights packed in a way
+   *
+   * @param packing Name of the way to pack weights, which must be changed with the layout
+   * @param data    Original weights
+   * @param size    Size of the original weights in bytes
+   */
+  static uint64_t key(const std::string &packing, const uint8_t *data, size_t size);
+
+public:
+  explicit WeightStore(const std::string &dir) : _dir{dir} {}
+
+public:
+  /**
+   * @brief Map packed weights stored before
+   * @return Mapped weights, nullptr if they are not stored or their size differs
+   */
+  std::shared_ptr<ir::Data> load(uint64_t key, size_t size) const;
+  /**
+   * @brief Store packed weights and map them
+   * @return Mapped weights, nullptr if failed to store them
+   */
+  std::shared_ptr<ir::Data> store(uint64_t key, const uint8_t *data, size_t size) const;
+
+private:
+  std::string path(uint64_t key) const;
+
+private:
+  std::string _dir;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_WEIGHT_STORE_H__
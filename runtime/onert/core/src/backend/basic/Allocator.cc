@@ -25,9 +25,10 @@ namespace backend
 namespace basic
 {
 
-Allocator::Allocator(uint32_t capacity)
+Allocator::Allocator(uint32_t capacity, const char *what)
 {
-  _base = std::make_unique<uint8_t[]>(capacity);
+  // Huge pages by HUGE_PAGES for large buffers, to reduce TLB misses
+  _base = util::allocatePages(capacity, what);
 
   VERBOSE(ALLOC) << "allocation capacity: " << capacity << std::endl;
   VERBOSE(ALLOC) << "base pointer: " << static_cast<void *>(_base.get()) << std::endl;
@@ -16,9 +16,13 @@
 
 #include <backend/basic/MemoryManager.h>
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <limits>
 
-#include "MemoryPlannerFactory.h"
+#include "backend/basic/MemoryPlannerFactory.h"
+#include "MemoryPlanner.h"
 #include "util/ConfigSource.h"
 #include "util/logging.h"
 
@@ -29,15 +33,28 @@ namespace backend
 namespace basic
 {
 
-MemoryManager::MemoryManager() : _mem_planner{createMemoryPlanner()}
-{
-  // DO NOTHING
-}
+MemoryManager::MemoryManager() : _mem_planner{createMemoryPlanner()} { initSharedArena(); }
 
 MemoryManager::MemoryManager(const std::string planner_id)
   : _mem_planner{createMemoryPlanner(planner_id)}
 {
-  // DO NOTHING
+  initSharedArena();
+}
+
+MemoryManager::~MemoryManager()
+{
+  if (_shared_arena)
+    _shared_arena->release(this);
+}
+
+void MemoryManager::initSharedArena()
+{
+  if (!util::getConfigBool(util::config::CPU_SHARED_ARENA))
+    return;
+
+  // The group is decided at construction, which is in the compilation of a session
+  _shared_arena = SharedArena::get();
+  _arena_group = SharedArena::group();
 }
 
 basic::IMemoryPlanner *MemoryManager::createMemoryPlanner()
@@ -58,9 +75,24 @@ void MemoryManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
 
 void MemoryManager::releasePlan(const ir::OperandIndex &ind) { _mem_planner->release(ind); }
 
+void MemoryManager::usePlannedOffsets(const ir::OperandIndexMap<uint32_t> &offsets)
+{
+  _mem_planner = std::make_shared<PresetPlanner>(offsets);
+  VERBOSE(MemoryManager) << "Use " << offsets.size() << " planned offsets" << std::endl;
+}
+
 void MemoryManager::allocate(void)
 {
-  _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity());
+  if (_shared_arena)
+  {
+    _shared_arena->reserve(this, _arena_group, _mem_planner->capacity(), [this]() {
+      if (_rebind)
+        _rebind();
+    });
+    return;
+  }
+
+  _mem_alloc = std::make_shared<basic::Allocator>(_mem_planner->capacity(), "arena");
   assert(_mem_alloc->base());
 }
 
@@ -68,7 +100,49 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
 {
   assert(_mem_planner->memory_plans().find(ind) != _mem_planner->memory_plans().end());
   const auto &mem_blk = _mem_planner->memory_plans().at(ind);
-  return _mem_alloc->base() + mem_blk.offset;
+  auto base = _shared_arena ? _shared_arena->base(this) : _mem_alloc->base();
+  return base + mem_blk.offset;
+}
+
+void MemoryManager::deallocate(void)
+{
+  if (_shared_arena)
+    _shared_arena->release(this);
+  else
+    _mem_alloc->release();
+}
+
+namespace
+{
+
+// Round up to a multiple of a quarter of the largest power of two not greater than the capacity,
+// which wastes less than a fifth of each size class. Capacities that cannot be rounded within
+// uint32_t are their own class.
+uint32_t sizeClass(uint32_t capacity)
+{
+  constexpr uint32_t min_class = 64;
+  if (capacity <= min_class)
+    return min_class;
+
+  uint64_t pow2 = min_class;
+  while (pow2 <= capacity / 2)
+    pow2 *= 2;
+  const uint64_t step = pow2 / 4;
+  const uint64_t size_class = (capacity + step - 1) / step * step;
+  if (size_class > std::numeric_limits<uint32_t>::max())
+    return capacity;
+  return static_cast<uint32_t>(size_class);
+}
+
+} // namespace
+
+DynamicMemoryManager::~DynamicMemoryManager()
+{
+  if (_pool_hits + _pool_misses > 0)
+  {
+    VERBOSE(DynamicMemoryManager) << "Pool hits " << _pool_hits << " of "
+                                  << _pool_hits + _pool_misses << " allocations" << std::endl;
+  }
 }
 
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
@@ -78,8 +152,30 @@ std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
-  return _mem_alloc_map[tensor];
+  auto size_class = sizeClass(capacity);
+  std::shared_ptr<basic::Allocator> alloc;
+  // Reuse the smallest free memory of the same or a larger class unless it wastes over half
+  auto free_list = _pool.lower_bound(size_class);
+  if (free_list != _pool.end() && free_list->first / 2 <= size_class)
+  {
+    size_class = free_list->first;
+    alloc = std::make_shared<basic::Allocator>(std::move(free_list->second.back()));
+    free_list->second.pop_back();
+    if (free_list->second.empty())
+      _pool.erase(free_list);
+    _pool_bytes -= size_class;
+    _pool_hits++;
+  }
+  else
+  {
+    alloc = std::make_shared<basic::Allocator>(size_class, "dynamic tensor");
+    _pool_misses++;
+  }
+
+  _mem_alloc_map.emplace(tensor, Allocation{alloc, size_class});
+  _in_use += size_class;
+  _peak = std::max(_peak, _in_use);
+  return alloc;
 }
 
 void DynamicMemoryManager::deallocate(const ITensor *tensor)
@@ -88,8 +184,34 @@ void DynamicMemoryManager::deallocate(const ITensor *tensor)
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  find->second->release();    // explicitly erase memory
+  // Move memory to the pool so that allocators still held by others do not own it
+  auto &allocation = find->second;
+  _in_use -= allocation.size_class;
+  _pool[allocation.size_class].push_back(allocation.alloc->detach());
+  _pool_bytes += allocation.size_class;
   _mem_alloc_map.erase(find); // remove tensor and alloc
+  trimPool();
+}
+
+void DynamicMemoryManager::trimPool()
+{
+  // Free the largest memory first, which is the least likely to be reused
+  while (_pool_bytes > _pool_limit)
+  {
+    auto free_list = std::prev(_pool.end());
+    free_list->second.pop_back();
+    _pool_bytes -= free_list->first;
+    if (free_list->second.empty())
+      _pool.erase(free_list);
+  }
+}
+
+uint64_t DynamicMemoryManager::releasePool()
+{
+  const auto bytes = _pool_bytes;
+  _pool.clear();
+  _pool_bytes = 0;
+  return bytes;
 }
 
 void DynamicMemoryManager::deallocate(void)
@@ -97,10 +219,15 @@ void DynamicMemoryManager::deallocate(void)
   for (auto &mem_alloc : _mem_alloc_map)
   {
     // Release memory buffer of mem_alloc
-    mem_alloc.second->release();
+    mem_alloc.second.alloc->release();
   }
 
   _mem_alloc_map.clear();
+  _pool.clear();
+  _in_use = 0;
+
+  VERBOSE(DynamicMemoryManager) << "Pool hits " << _pool_hits << " of "
+                                << _pool_hits + _pool_misses << " allocations" << std::endl;
 }
 
 } // namespace basic
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <backend/basic/MemoryManager.h>
+
+#include <gtest/gtest.h>
+
+using namespace onert::backend;
+
+TEST(DynamicMemoryManager, reuse_pool)
+{
+  basic::DynamicMemoryManager mem_mgr;
+  // Tensors are used as keys only
+  auto tensor1 = reinterpret_cast<const ITensor *>(0x10);
+  auto tensor2 = reinterpret_cast<const ITensor *>(0x20);
+
+  auto alloc1 = mem_mgr.allocate(tensor1, 1000);
+  auto base = alloc1->base();
+  mem_mgr.deallocate(tensor1);
+  ASSERT_EQ(alloc1->base(), nullptr);
+
+  // Sizes in the same class get the memory deallocated before
+  auto alloc2 = mem_mgr.allocate(tensor2, 900);
+  ASSERT_EQ(alloc2->base(), base);
+  ASSERT_EQ(mem_mgr.pool_hits(), 1);
+  ASSERT_EQ(mem_mgr.pool_misses(), 1);
+
+  auto alloc3 = mem_mgr.allocate(tensor1, 4000);
+  ASSERT_NE(alloc3->base(), base);
+  ASSERT_EQ(mem_mgr.pool_misses(), 2);
+
+  mem_mgr.deallocate();
+}
+
+TEST(DynamicMemoryManager, reuse_larger_class)
+{
+  basic::DynamicMemoryManager mem_mgr;
+  auto tensor1 = reinterpret_cast<const ITensor *>(0x10);
+  auto tensor2 = reinterpret_cast<const ITensor *>(0x20);
+
+  auto alloc1 = mem_mgr.allocate(tensor1, 2048);
+  auto base = alloc1->base();
+  mem_mgr.deallocate(tensor1);
+
+  // Memory of a larger class is reused unless it wastes over half
+  auto alloc2 = mem_mgr.allocate(tensor2, 700);
+  ASSERT_NE(alloc2->base(), base);
+  ASSERT_EQ(mem_mgr.pool_misses(), 2);
+  mem_mgr.deallocate(tensor2);
+  auto alloc3 = mem_mgr.allocate(tensor1, 1500);
+  ASSERT_EQ(alloc3->base(), base);
+  ASSERT_EQ(mem_mgr.pool_hits(), 1);
+  ASSERT_EQ(mem_mgr.pool_bytes(), 768);
+
+  // The reused memory returns to its own class
+  mem_mgr.deallocate(tensor1);
+  auto alloc4 = mem_mgr.allocate(tensor2, 2048);
+  ASSERT_EQ(alloc4->base(), base);
+
+  mem_mgr.deallocate();
+}
+
+TEST(DynamicMemoryManager, pool_limit)
+{
+  basic::DynamicMemoryManager mem_mgr{2048};
+  auto tensor1 = reinterpret_cast<const ITensor *>(0x10);
+  auto tensor2 = reinterpret_cast<const ITensor *>(0x20);
+
+  mem_mgr.allocate(tensor1, 1024);
+  mem_mgr.allocate(tensor2, 2048);
+  mem_mgr.deallocate(tensor1);
+  mem_mgr.deallocate(tensor2);
+
+  // The largest memory is freed first to keep the pool within the limit
+  ASSERT_EQ(mem_mgr.pool_bytes(), 1024);
+  mem_mgr.allocate(tensor1, 2048);
+  ASSERT_EQ(mem_mgr.pool_hits(), 0);
+  mem_mgr.allocate(tensor2, 1024);
+  ASSERT_EQ(mem_mgr.pool_hits(), 1);
+  ASSERT_EQ(mem_mgr.pool_bytes(), 0);
+
+  mem_mgr.deallocate();
+}
+
+TEST(DynamicMemoryManager, peak)
+{
+  basic::DynamicMemoryManager mem_mgr;
+  auto tensor1 = reinterpret_cast<const ITensor *>(0x10);
+  auto tensor2 = reinterpret_cast<const ITensor *>(0x20);
+
+  mem_mgr.allocate(tensor1, 1024);
+  mem_mgr.allocate(tensor2, 2048);
+  mem_mgr.deallocate(tensor1);
+  ASSERT_EQ(mem_mgr.peak(), 3072);
+
+  // The peak is reset to the memory still allocated
+  mem_mgr.resetPeak();
+  ASSERT_EQ(mem_mgr.peak(), 2048);
+  mem_mgr.deallocate(tensor2);
+  mem_mgr.allocate(tensor1, 1024);
+  ASSERT_EQ(mem_mgr.peak(), 2048);
+
+  mem_mgr.deallocate();
+}
+
+TEST(DynamicMemoryManager, releasePool)
+{
+  basic::DynamicMemoryManager mem_mgr;
+  auto tensor1 = reinterpret_cast<const ITensor *>(0x10);
+  auto tensor2 = reinterpret_cast<const ITensor *>(0x20);
+
+  mem_mgr.allocate(tensor1, 1024);
+  mem_mgr.allocate(tensor2, 2048);
+  mem_mgr.deallocate(tensor1);
+
+  // Only the memory kept in the pool is released
+  ASSERT_EQ(mem_mgr.releasePool(), 1024);
+  ASSERT_EQ(mem_mgr.releasePool(), 0);
+  mem_mgr.allocate(tensor1, 1024);
+  ASSERT_EQ(mem_mgr.pool_hits(), 0);
+
+  mem_mgr.deallocate();
+}
+
+TEST(DynamicMemoryManager, neg_allocate_twice)
+{
+  basic::DynamicMemoryManager mem_mgr;
+  auto tensor = reinterpret_cast<const ITensor *>(0x10);
+
+  mem_mgr.allocate(tensor, 16);
+  EXPECT_ANY_THROW(mem_mgr.allocate(tensor, 16));
+  mem_mgr.deallocate(tensor);
+  EXPECT_ANY_THROW(mem_mgr.deallocate(tensor));
+}
@@ -16,7 +16,11 @@
 
 #include "MemoryPlanner.h"
 #include "util/logging.h"
+
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <numeric>
 
 namespace onert
 {
@@ -203,6 +207,290 @@ WICPlanner::MemoryPlans &WICPlanner::memory_plans()
   return _mem_plans;
 }
 
+OffsetPlanner::OffsetPlanner(uint32_t refine_limit)
+  : _initialized(false), _capacity(0), _refine_limit(refine_limit), _step(0)
+{
+  // DO NOTHING
+}
+
+void OffsetPlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  assert(!_initialized);
+  assert(_live_operands.find(ind) == _live_operands.end());
+
+  // Operands which are never released live until the end
+  _live_operands[ind] = _lifetimes.size();
+  _lifetimes.push_back({ind, size, _step++, std::numeric_limits<uint32_t>::max()});
+
+  VERBOSE(OFFSET_PLANNER) << "claim(" << ind << "): [" << size << "sz]" << std::endl;
+}
+
+void OffsetPlanner::release(const ir::OperandIndex &ind)
+{
+  auto it = _live_operands.find(ind);
+  if (it == _live_operands.end())
+    return;
+
+  _lifetimes[it->second].last = _step++;
+  _live_operands.erase(it);
+
+  VERBOSE(OFFSET_PLANNER) << "release(" << ind << ")" << std::endl;
+}
+
+namespace
+{
+
+template <typename T> bool isOverlapped(const T &a, const T &b)
+{
+  return a.first <= b.last && b.first <= a.last;
+}
+
+} // namespace
+
+/*
+ * The sum of sizes of live operands can increase only at the time an operand is claimed, so it is
+ * enough to check the sum at each claim
+ */
+size_t OffsetPlanner::lowerBound() const
+{
+  size_t bound = 0;
+  for (const auto &lifetime : _lifetimes)
+  {
+    size_t live_size = 0;
+    for (const auto &other : _lifetimes)
+    {
+      if (other.first <= lifetime.first && lifetime.first <= other.last)
+        live_size += other.size;
+    }
+    bound = std::max(bound, live_size);
+  }
+  return bound;
+}
+
+/*
+ * Find the offset of the target operand among the free gaps between placed operands whose
+ * lifetime overlaps with the target
+ * - best_fit is true : The smallest gap which can hold the target
+ * - best_fit is false : The lowest gap which can hold the target
+ * If there is no such gap, the target goes above all of them.
+ */
+size_t OffsetPlanner::findOffset(size_t target, const std::vector<size_t> &placed,
+                                 const std::vector<size_t> &offsets, bool best_fit) const
+{
+  const auto &lifetime = _lifetimes[target];
+
+  std::vector<std::pair<size_t, size_t>> blocks;
+  for (const auto &p : placed)
+  {
+    if (isOverlapped(lifetime, _lifetimes[p]))
+      blocks.emplace_back(offsets[p], _lifetimes[p].size);
+  }
+  std::sort(blocks.begin(), blocks.end());
+
+  size_t next_offset = 0;
+  size_t best_offset = std::numeric_limits<size_t>::max();
+  size_t best_gap = std::numeric_limits<size_t>::max();
+  for (const auto &block : blocks)
+  {
+    if (block.first >= next_offset + lifetime.size)
+    {
+      if (!best_fit)
+        return next_offset;
+      const auto gap = block.first - next_offset;
+      if (gap < best_gap)
+      {
+        best_gap = gap;
+        best_offset = next_offset;
+      }
+    }
+    next_offset = std::max(next_offset, block.first + block.second);
+  }
+
+  return best_gap != std::numeric_limits<size_t>::max() ? best_offset : next_offset;
+}
+
+size_t OffsetPlanner::place(const std::vector<size_t> &order, bool best_fit,
+                            std::vector<size_t> &offsets) const
+{
+  size_t peak = 0;
+  std::vector<size_t> placed;
+  placed.reserve(order.size());
+  for (const auto &target : order)
+  {
+    offsets[target] = findOffset(target, placed, offsets, best_fit);
+    placed.push_back(target);
+    peak = std::max(peak, offsets[target] + _lifetimes[target].size);
+  }
+  return peak;
+}
+
+/*
+ * Search all placement orders with branch and bound. Each operand takes the lowest gap, so that
+ * only the order decides the plan.
+ */
+void OffsetPlanner::refine(std::vector<size_t> &placed, std::vector<size_t> &offsets, size_t peak,
+                           size_t lower_bound, size_t &best_peak,
+                           std::vector<size_t> &best_offsets) const
+{
+  if (peak >= best_peak)
+    return;
+
+  if (placed.size() == _lifetimes.size())
+  {
+    best_peak = peak;
+    best_offsets = offsets;
+    return;
+  }
+
+  for (size_t target = 0; target < _lifetimes.size(); ++target)
+  {
+    if (std::find(placed.begin(), placed.end(), target) != placed.end())
+      continue;
+
+    offsets[target] = findOffset(target, placed, offsets, false);
+    placed.push_back(target);
+    refine(placed, offsets, std::max(peak, offsets[target] + _lifetimes[target].size),
+           lower_bound, best_peak, best_offsets);
+    placed.pop_back();
+
+    if (best_peak == lower_bound)
+      return;
+  }
+}
+
+/*
+ * Build memory plans using lifetime and size of operands
+ * 1. Sort operands in descending order of size, and longer lifetime first for the same size
+ * 2. Place sorted operands into the best-fit gap among operands with overlapped lifetime
+ * 3. If the peak does not reach the lower bound and the number of operands is not larger than
+ *    the refinement limit, search all placement orders for a lower peak
+ */
+void OffsetPlanner::buildMemoryPlans()
+{
+  const auto num_operands = _lifetimes.size();
+
+  std::vector<size_t> order(num_operands);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    const auto &l = _lifetimes[lhs];
+    const auto &r = _lifetimes[rhs];
+    if (l.size != r.size)
+      return l.size > r.size;
+    return l.last - l.first > r.last - r.first;
+  });
+
+  std::vector<size_t> offsets(num_operands);
+  auto peak = place(order, true, offsets);
+  const auto lower_bound = lowerBound();
+
+  if (peak > lower_bound && num_operands <= _refine_limit)
+  {
+    std::vector<size_t> placed;
+    std::vector<size_t> tmp_offsets(num_operands);
+    auto best_peak = peak;
+    refine(placed, tmp_offsets, 0, lower_bound, best_peak, offsets);
+    VERBOSE(OFFSET_PLANNER) << "refine : " << peak << " -> " << best_peak << std::endl;
+    peak = best_peak;
+  }
+
+  for (size_t i = 0; i < num_operands; ++i)
+  {
+    const auto &lifetime = _lifetimes[i];
+    _mem_plans[lifetime.ind] = {static_cast<uint32_t>(offsets[i]), lifetime.size};
+    VERBOSE(OFFSET_PLANNER) << "alloc(" << lifetime.ind << "): [+" << offsets[i] << ", "
+                            << lifetime.size << "sz]" << std::endl;
+  }
+
+  _capacity = static_cast<uint32_t>(peak);
+  VERBOSE(OFFSET_PLANNER) << "peak : " << peak << " bytes (lower bound : " << lower_bound
+                          << " bytes)" << std::endl;
+
+  _initialized = true;
+  _lifetimes.clear();
+  _live_operands.clear();
+}
+
+OffsetPlanner::MemoryPlans &OffsetPlanner::memory_plans()
+{
+  if (!_initialized)
+    buildMemoryPlans();
+  return _mem_plans;
+}
+
+PresetPlanner::PresetPlanner(const ir::OperandIndexMap<uint32_t> &offsets)
+  : _planned_offsets{offsets}
+{
+  // DO NOTHING
+}
+
+bool PresetPlanner::overlaps(uint32_t offset, size_t size) const
+{
+  if (size == 0)
+    return false;
+
+  for (const auto &mem_claim : _claim_table)
+  {
+    const auto claimed_offset = mem_claim.first;
+    if (claimed_offset >= offset + size)
+      break;
+    const auto claimed_size = _mem_plans.at(mem_claim.second).size;
+    if (claimed_size > 0 && claimed_offset + claimed_size > offset)
+      return true;
+  }
+  return false;
+}
+
+void PresetPlanner::claim(const ir::OperandIndex &ind, size_t size)
+{
+  const auto planned = _planned_offsets.find(ind);
+  const bool as_planned = planned != _planned_offsets.end() && !overlaps(planned->second, size);
+  uint32_t offset = 0;
+  if (as_planned)
+  {
+    offset = planned->second;
+  }
+  else
+  {
+    // Find the right position for claiming by firstfit way
+    for (const auto &mem_claim : _claim_table)
+    {
+      if (offset + size <= mem_claim.first)
+        break;
+      offset = std::max<uint32_t>(offset, mem_claim.first + _mem_plans[mem_claim.second].size);
+    }
+    _unplanned++;
+  }
+
+  _claim_table.emplace(offset, ind);
+  _mem_plans[ind] = {offset, size};
+
+  VERBOSE(PRESET_PLANNER) << "claim(" << ind << "): [+" << offset << ", " << size << "sz]"
+                          << (as_planned ? "" : " unplanned") << std::endl;
+
+  if (_capacity < offset + size)
+  {
+    _capacity = offset + size;
+  }
+}
+
+void PresetPlanner::release(const ir::OperandIndex &ind)
+{
+  assert(_mem_plans.find(ind) != _mem_plans.end());
+  const auto range = _claim_table.equal_range(_mem_plans[ind].offset);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (it->second == ind)
+    {
+      _claim_table.erase(it);
+
+      VERBOSE(PRESET_PLANNER) << "release(" << ind << "): [+" << _mem_plans[ind].offset << ", "
+                              << _mem_plans[ind].size << "sz]" << std::endl;
+      return;
+    }
+  }
+  assert(!"Cannot release for given index. It has been not claimed or released already.");
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
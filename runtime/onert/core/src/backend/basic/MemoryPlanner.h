@@ -153,6 +153,129 @@ private:
   std::multimap<uint32_t, ir::OperandIndex, std::greater<uint32_t>> _operands;
 };
 
+/**
+ * @brief Class to plan memory by offset calculation on operand lifetimes
+ *
+ * Operands are placed in descending order of size, each into the best-fit gap between the
+ * operands whose lifetime overlaps. If the peak is above the lower bound, which is the largest
+ * sum of sizes of operands alive at the same time, and there are not more operands than the
+ * refinement limit, all placement orders are searched for a lower peak.
+ */
+class OffsetPlanner : public IMemoryPlanner
+{
+public:
+  /**
+   * @brief Construct a new OffsetPlanner object
+   * @param[in] refine_limit Maximum number of operands to search placement orders exhaustively
+   */
+  OffsetPlanner(uint32_t refine_limit = 0);
+
+  /**
+   * @brief Claim memory for operand, which begins the lifetime of the operand
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand, which ends the lifetime of the operand
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint32_t capacity() override
+  {
+    if (!_initialized)
+      buildMemoryPlans();
+    return _capacity;
+  }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override;
+
+private:
+  struct Lifetime
+  {
+    ir::OperandIndex ind;
+    size_t size;
+    uint32_t first;
+    uint32_t last;
+  };
+
+  void buildMemoryPlans();
+  size_t lowerBound() const;
+  size_t place(const std::vector<size_t> &order, bool best_fit, std::vector<size_t> &offsets) const;
+  size_t findOffset(size_t target, const std::vector<size_t> &placed,
+                    const std::vector<size_t> &offsets, bool best_fit) const;
+  void refine(std::vector<size_t> &placed, std::vector<size_t> &offsets, size_t peak,
+              size_t lower_bound, size_t &best_peak, std::vector<size_t> &best_offsets) const;
+
+  bool _initialized;
+  uint32_t _capacity;
+  uint32_t _refine_limit;
+  uint32_t _step;
+  MemoryPlans _mem_plans;
+  std::vector<Lifetime> _lifetimes;
+  ir::OperandIndexMap<size_t> _live_operands;
+};
+
+/**
+ * @brief Class to plan memory with offsets planned ahead, e.g. by the model
+ *
+ * An operand is placed at its planned offset unless the offset overlaps the memory of live
+ * operands, which can happen when operations are executed in another order than the one for
+ * the plan. Such an operand and an operand without a planned offset are placed by firstfit way.
+ */
+class PresetPlanner : public IMemoryPlanner
+{
+public:
+  /**
+   * @brief Construct a new PresetPlanner object
+   * @param[in] offsets Planned offsets of operands
+   */
+  PresetPlanner(const ir::OperandIndexMap<uint32_t> &offsets);
+
+  /**
+   * @brief Claim memory for operand at its planned offset if possible
+   * @param[in] index The operand index
+   * @param[in] size The size of the memory
+   */
+  void claim(const ir::OperandIndex &, size_t) override;
+  /**
+   * @brief Release memory for operand
+   * @param[in] index The operand index
+   */
+  void release(const ir::OperandIndex &) override;
+  /**
+   * @brief Get capacity for memory planning
+   * @return The value of capacity
+   */
+  uint32_t capacity() override { return _capacity; }
+  /**
+   * @brief Get MemoryPlans
+   * @return MemoryPlans
+   */
+  MemoryPlans &memory_plans() override { return _mem_plans; }
+  /**
+   * @brief Get the number of operands not placed at their planned offsets
+   */
+  uint32_t unplanned() const { return _unplanned; }
+
+private:
+  bool overlaps(uint32_t offset, size_t size) const;
+
+  uint32_t _capacity = 0;
+  uint32_t _unplanned = 0;
+  MemoryPlans _mem_plans;
+  ir::OperandIndexMap<uint32_t> _planned_offsets;
+  // Claimed operands sorted by offset, where operands of size 0 may share an offset
+  std::multimap<uint32_t, ir::OperandIndex> _claim_table;
+};
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
@@ -191,3 +191,118 @@ TEST(WICPlanner, claim_release_test)
   // CAPACITY - 40
   capacity(40);
 }
+
+TEST(OffsetPlanner, claim_release_test)
+{
+  ::onert::backend::basic::OffsetPlanner planner;
+
+  auto claim = [&planner](uint32_t index, size_t size) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  auto verify = [&planner](uint32_t index, uint32_t size, uint32_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  // 3 reuses the memory of 0
+  claim(0, 30);
+  claim(1, 10);
+  claim(2, 10);
+  release(0);
+  claim(3, 10);
+  release(1);
+  release(2);
+  release(3);
+
+  verify(0, 30, 0);
+  verify(1, 10, 30);
+  verify(2, 10, 40);
+  verify(3, 10, 0);
+  ASSERT_EQ(planner.capacity(), 50);
+}
+
+TEST(OffsetPlanner, refine_test)
+{
+  auto plan = [](uint32_t refine_limit) {
+    ::onert::backend::basic::OffsetPlanner planner(refine_limit);
+    auto claim = [&planner](uint32_t index, size_t size) {
+      planner.claim(onert::ir::OperandIndex{index}, size);
+    };
+    auto release = [&planner](uint32_t index) {
+      planner.release(onert::ir::OperandIndex{index});
+    };
+
+    claim(0, 20);
+    claim(1, 15);
+    release(0);
+    claim(2, 10);
+    release(1);
+    claim(3, 15);
+    release(3);
+    release(2);
+    claim(4, 15);
+    release(4);
+    return planner.capacity();
+  };
+
+  // Placing by size puts 3 below 1 before 2, which leaves no room for 2 but above 1
+  ASSERT_EQ(plan(0), 45);
+  // The lower bound is 35 while 0 and 1 are alive
+  ASSERT_EQ(plan(8), 35);
+}
+
+TEST(PresetPlanner, claim_release_test)
+{
+  onert::ir::OperandIndexMap<uint32_t> offsets;
+  offsets[onert::ir::OperandIndex{0u}] = 20;
+  offsets[onert::ir::OperandIndex{1u}] = 0;
+  offsets[onert::ir::OperandIndex{2u}] = 20;
+  offsets[onert::ir::OperandIndex{3u}] = 10;
+  ::onert::backend::basic::PresetPlanner planner(offsets);
+
+  auto claim = [&planner](uint32_t index, size_t size, uint32_t expected_offset) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.claim(mem_idx, size);
+    auto mem_blk = planner.memory_plans()[mem_idx];
+    ASSERT_EQ(mem_blk.offset, expected_offset);
+    ASSERT_EQ(mem_blk.size, size);
+  };
+
+  auto release = [&planner](uint32_t index) {
+    onert::ir::OperandIndex mem_idx(index);
+    planner.release(mem_idx);
+  };
+
+  // Planned offsets
+  claim(0, 10, 20);
+  claim(1, 20, 0);
+  release(1);
+  ASSERT_EQ(planner.unplanned(), 0);
+
+  // Planned offset overlaps 0, which is still alive
+  claim(2, 10, 0);
+  ASSERT_EQ(planner.unplanned(), 1);
+
+  // No planned offset
+  claim(4, 10, 10);
+  release(4);
+  ASSERT_EQ(planner.unplanned(), 2);
+
+  // Planned offset is free again
+  claim(3, 10, 10);
+  ASSERT_EQ(planner.unplanned(), 2);
+
+  release(0);
+  release(2);
+  release(3);
+  ASSERT_EQ(planner.capacity(), 30);
+}
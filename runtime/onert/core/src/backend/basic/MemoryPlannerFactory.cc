@@ -14,9 +14,10 @@
  * limitations under the License.
  */
 
-#include "MemoryPlannerFactory.h"
+#include "backend/basic/MemoryPlannerFactory.h"
 
 #include "MemoryPlanner.h"
+#include "util/ConfigSource.h"
 
 namespace onert
 {
@@ -45,6 +46,10 @@ IMemoryPlanner *MemoryPlannerFactory::create(const std::string &key)
   {
     return new WICPlanner;
   }
+  else if (key == "Offset")
+  {
+    return new OffsetPlanner(util::getConfigInt(util::config::CPU_MEMORY_PLANNER_REFINE_LIMIT));
+  }
   return new FirstFitPlanner; // Default Planner
 }
 
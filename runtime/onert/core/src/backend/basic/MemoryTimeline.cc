@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/MemoryTimeline.h"
+
+#include "util/logging.h"
+
+#include <json/json.h>
+
+#include <fstream>
+#include <map>
+#include <mutex>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+namespace
+{
+
+// Sections of all backends dumped in this process, rewritten as a whole on each dump
+std::mutex dump_mutex;
+std::map<std::string, Json::Value> dumps;
+
+} // namespace
+
+void MemoryTimeline::notifyFirstUse(const ir::OperandIndex &ind)
+{
+  _lifetimes[ind] = Lifetime{_step, static_cast<int32_t>(_order.size())};
+}
+
+void MemoryTimeline::notifyLastUse(const ir::OperandIndex &ind)
+{
+  auto root = _roots.find(ind);
+  const auto &owner = root == _roots.end() ? ind : root->second;
+  auto lifetime = _lifetimes.find(owner);
+  if (lifetime != _lifetimes.end())
+    lifetime->second.last = _step;
+}
+
+void MemoryTimeline::notifyShare(const ir::OperandIndex &ind, const ir::OperandIndex &root)
+{
+  auto root_of_root = _roots.find(root);
+  _roots[ind] = root_of_root == _roots.end() ? root : root_of_root->second;
+}
+
+MemoryTimeline::Lifetime MemoryTimeline::lifetime(const ir::OperandIndex &ind) const
+{
+  auto lifetime = _lifetimes.find(ind);
+  if (lifetime == _lifetimes.end())
+    return Lifetime{-1, static_cast<int32_t>(_order.size())};
+  return lifetime->second;
+}
+
+void MemoryTimeline::dump(const std::string &filepath, const std::string &backend_id,
+                          const ir::Graph &graph, const IMemoryPlanner::MemoryPlans &plans,
+                          uint32_t capacity) const
+{
+  Json::Value section;
+  section["backend"] = backend_id;
+  section["capacity"] = capacity;
+
+  Json::Value operations{Json::arrayValue};
+  for (const auto &op_ind : _order)
+  {
+    Json::Value op;
+    op["index"] = op_ind.value();
+    op["name"] = graph.operations().at(op_ind).name();
+    operations.append(op);
+  }
+  section["operations"] = operations;
+
+  // Bytes alive at each step, from -1 to _order.size()
+  std::vector<uint64_t> alive(_order.size() + 2, 0);
+  Json::Value tensors{Json::arrayValue};
+  for (const auto &it : plans)
+  {
+    const auto life = lifetime(it.first);
+    Json::Value tensor;
+    tensor["operand"] = it.first.value();
+    tensor["offset"] = it.second.offset;
+    tensor["size"] = static_cast<Json::UInt64>(it.second.size);
+    tensor["first"] = life.first;
+    tensor["last"] = life.last;
+    tensors.append(tensor);
+
+    for (auto step = life.first; step <= life.last; ++step)
+      alive[step + 1] += it.second.size;
+  }
+  section["tensors"] = tensors;
+
+  // The first step where the most bytes are alive, which the arena must hold at least
+  size_t peak = 0;
+  for (size_t i = 1; i < alive.size(); ++i)
+  {
+    if (alive[i] > alive[peak])
+      peak = i;
+  }
+  const auto peak_step = static_cast<int32_t>(peak) - 1;
+  Json::Value peak_tensors{Json::arrayValue};
+  for (const auto &it : plans)
+  {
+    const auto life = lifetime(it.first);
+    if (life.first <= peak_step && peak_step <= life.last)
+      peak_tensors.append(it.first.value());
+  }
+  section["peak"]["step"] = peak_step;
+  section["peak"]["bytes"] = static_cast<Json::UInt64>(alive[peak]);
+  section["peak"]["tensors"] = peak_tensors;
+
+  std::lock_guard<std::mutex> lock{dump_mutex};
+  auto &dump = dumps[filepath];
+  dump["backends"].append(section);
+
+  std::ofstream ofs{filepath};
+  if (!ofs)
+  {
+    VERBOSE(MemoryTimeline) << "Cannot open " << filepath << std::endl;
+    return;
+  }
+  ofs << dump;
+}
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/MemoryTimeline.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::basic;
+
+TEST(MemoryTimeline, lifetimes)
+{
+  const std::vector<ir::OperationIndex> order{ir::OperationIndex{0}, ir::OperationIndex{1},
+                                              ir::OperationIndex{2}};
+  MemoryTimeline timeline{order};
+  const ir::OperandIndex input{0}, a{1}, b{2}, c{3};
+
+  timeline.notifyFirstUse(input);
+  timeline.setStep(0);
+  timeline.notifyFirstUse(a);
+  timeline.notifyLastUse(input);
+  timeline.setStep(1);
+  // b reuses the memory of a, which dies with b
+  timeline.notifyShare(b, a);
+  timeline.setStep(2);
+  timeline.notifyFirstUse(c);
+  timeline.notifyLastUse(b);
+
+  auto expect = [&](const ir::OperandIndex &ind, int32_t first, int32_t last) {
+    const auto lifetime = timeline.lifetime(ind);
+    ASSERT_EQ(lifetime.first, first);
+    ASSERT_EQ(lifetime.last, last);
+  };
+  expect(input, -1, 0);
+  expect(a, 0, 2);
+  // Not released until the end of the run
+  expect(c, 2, 3);
+  // Not notified and alive over the run
+  expect(ir::OperandIndex{4}, -1, 3);
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/SharedArena.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace onert
+{
+namespace backend
+{
+namespace basic
+{
+
+namespace
+{
+
+std::atomic<uint64_t> next_group{1};
+thread_local uint64_t current_group = 0;
+thread_local std::weak_ptr<SharedArena> current_arena;
+
+} // namespace
+
+SharedArena::GroupScope::GroupScope() : _outermost{current_group == 0}
+{
+  if (_outermost)
+    current_group = next_group++;
+}
+
+SharedArena::GroupScope::~GroupScope()
+{
+  if (_outermost)
+    current_group = 0;
+}
+
+SharedArena::WorkerScope::WorkerScope(const std::shared_ptr<SharedArena> &arena, uint64_t group)
+  : _prev_arena{current_arena}, _prev_group{current_group}
+{
+  current_arena = arena;
+  current_group = group;
+}
+
+SharedArena::WorkerScope::~WorkerScope()
+{
+  current_arena = _prev_arena;
+  current_group = _prev_group;
+}
+
+std::shared_ptr<SharedArena> SharedArena::get()
+{
+  auto ret = current_arena.lock();
+  if (!ret)
+  {
+    ret = std::make_shared<SharedArena>();
+    current_arena = ret;
+  }
+  return ret;
+}
+
+uint64_t SharedArena::group() { return current_group != 0 ? current_group : next_group++; }
+
+void SharedArena::reserve(const void *user, uint64_t group, uint32_t capacity,
+                          const RebindHandler &rebind)
+{
+  std::vector<RebindHandler> moved;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto it = std::find_if(_regions.begin(), _regions.end(),
+                           [&](const Region &region) { return region.user == user; });
+    if (it != _regions.end())
+      _regions.erase(it);
+    _regions.push_back({user, group, capacity, 0, rebind});
+
+    relayout(user, moved);
+  }
+
+  // Handlers may access the arena
+  for (const auto &fn : moved)
+    fn();
+}
+
+void SharedArena::release(const void *user)
+{
+  std::vector<RebindHandler> moved;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    auto it = std::find_if(_regions.begin(), _regions.end(),
+                           [&](const Region &region) { return region.user == user; });
+    if (it == _regions.end())
+      return;
+    _regions.erase(it);
+
+    if (_regions.empty())
+    {
+      _alloc.reset();
+      _capacity = 0;
+      return;
+    }
+    relayout(user, moved);
+  }
+
+  for (const auto &fn : moved)
+    fn();
+}
+
+uint8_t *SharedArena::base(const void *user) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = std::find_if(_regions.begin(), _regions.end(),
+                         [&](const Region &region) { return region.user == user; });
+  if (it == _regions.end())
+    throw std::runtime_error{"SharedArena: Memory is not reserved for the user"};
+
+  assert(_alloc && _alloc->base());
+  return _alloc->base() + it->offset;
+}
+
+uint32_t SharedArena::capacity() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _capacity;
+}
+
+/*
+ * Lay out the regions of each group from the beginning in the order of reservation
+ * - The arena is reallocated if the largest group does not fit, and it never shrinks except
+ *   when there is no user
+ * - Handlers of the users whose region is moved are collected, except the caller's
+ */
+void SharedArena::relayout(const void *caller, std::vector<RebindHandler> &moved)
+{
+  std::unordered_map<uint64_t, uint32_t> group_sizes;
+  std::vector<uint32_t> offsets;
+  offsets.reserve(_regions.size());
+  uint32_t capacity = 0;
+  for (const auto &region : _regions)
+  {
+    auto &group_size = group_sizes[region.group];
+    offsets.push_back(group_size);
+    group_size += region.capacity;
+    capacity = std::max(capacity, group_size);
+  }
+
+  const bool grown = capacity > _capacity;
+  if (grown)
+  {
+    _alloc = std::make_unique<Allocator>(capacity, "shared arena");
+    _capacity = capacity;
+    VERBOSE(SharedArena) << "Arena grows to " << capacity << " bytes" << std::endl;
+  }
+
+  for (size_t i = 0; i < _regions.size(); ++i)
+  {
+    auto &region = _regions[i];
+    const bool is_moved = grown || region.offset != offsets[i];
+    region.offset = offsets[i];
+    if (is_moved && region.user != caller && region.rebind)
+      moved.push_back(region.rebind);
+  }
+}
+
+} // namespace basic
+} // namespace backend
+} // namespace onert
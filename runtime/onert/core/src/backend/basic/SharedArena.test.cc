@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/SharedArena.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace onert::backend::basic;
+
+TEST(SharedArena, share_between_groups)
+{
+  auto arena = SharedArena::get();
+  ASSERT_EQ(arena, SharedArena::get());
+
+  int a, b, c;
+  uint64_t group_a, group_c;
+  {
+    SharedArena::GroupScope scope;
+    group_a = SharedArena::group();
+    ASSERT_EQ(SharedArena::group(), group_a);
+  }
+  {
+    SharedArena::GroupScope scope;
+    group_c = SharedArena::group();
+  }
+  ASSERT_NE(group_a, group_c);
+
+  // a and b are in the same group, and c is in another group
+  arena->reserve(&a, group_a, 16, nullptr);
+  arena->reserve(&b, group_a, 32, nullptr);
+  ASSERT_EQ(arena->capacity(), 48);
+  ASSERT_EQ(arena->base(&b), arena->base(&a) + 16);
+
+  int rebind_count = 0;
+  arena->reserve(&c, group_c, 40, [&]() { rebind_count++; });
+  ASSERT_EQ(arena->capacity(), 48);
+  ASSERT_EQ(arena->base(&c), arena->base(&a));
+  ASSERT_EQ(rebind_count, 0);
+
+  // Growing the arena moves others
+  arena->reserve(&c, group_c, 64, [&]() { rebind_count++; });
+  arena->reserve(&a, group_a, 16, [&]() { rebind_count++; });
+  arena->reserve(&b, group_a, 64, nullptr);
+  ASSERT_EQ(arena->capacity(), 80);
+  ASSERT_EQ(rebind_count, 2);
+
+  arena->release(&a);
+  ASSERT_EQ(arena->base(&b), arena->base(&c));
+  arena->release(&b);
+  arena->release(&c);
+  ASSERT_EQ(arena->capacity(), 0);
+}
+
+TEST(SharedArena, worker_scope)
+{
+  SharedArena::GroupScope scope;
+  auto arena = SharedArena::get();
+  const auto group = SharedArena::group();
+
+  std::shared_ptr<SharedArena> worker_arena;
+  uint64_t worker_group = 0;
+  std::thread worker([&]() {
+    SharedArena::WorkerScope worker_scope{arena, group};
+    worker_arena = SharedArena::get();
+    worker_group = SharedArena::group();
+  });
+  worker.join();
+
+  ASSERT_EQ(worker_arena, arena);
+  ASSERT_EQ(worker_group, group);
+}
+
+TEST(SharedArena, neg_base_without_reserve)
+{
+  auto arena = SharedArena::get();
+  int a;
+  ASSERT_THROW(arena->base(&a), std::runtime_error);
+}
@@ -18,8 +18,11 @@
 
 #include "backend/basic/DynamicTensorManager.h"
 #include "backend/basic/Tensor.h"
+#include <util/ConfigSource.h>
 #include <util/logging.h>
 
+#include <cstring>
+
 namespace onert
 {
 namespace backend
@@ -32,20 +35,30 @@ StaticTensorManager::StaticTensorManager(const std::shared_ptr<TensorRegistry> &
   : _nonconst_mgr{new MemoryManager()}, _tensors{reg}, _dynamic_tensor_manager{
                                                          dynamic_tensor_manager}
 {
-  // DO NOTHING
+  // Buffers in the shared arena can be moved by other sessions
+  _nonconst_mgr->setRebindHandler([this]() { bindNonconsts(); });
 }
 
 void StaticTensorManager::allocateNonconsts(void)
 {
   _nonconst_mgr->allocate();
+  bindNonconsts();
+}
 
+void StaticTensorManager::bindNonconsts(void)
+{
   for (auto &pair : _tensors->native_tensors())
   {
     const auto &ind = pair.first;
     auto tensor = pair.second.get();
-    if (!_as_constants[ind] && !tensor->is_dynamic())
+    if (!_as_constants[ind] && !tensor->is_dynamic() &&
+        _external_aliases.find(ind) == _external_aliases.end() &&
+        _variables.find(ind) == _variables.end())
     {
-      auto *buffer = _nonconst_mgr->getBuffer(ind);
+      auto sub = _sub_tensors.find(ind);
+      auto *buffer = sub == _sub_tensors.end()
+                       ? _nonconst_mgr->getBuffer(planRoot(ind))
+                       : _nonconst_mgr->getBuffer(planRoot(sub->second.first)) + sub->second.second;
       tensor->setBuffer(buffer);
 
       VERBOSE(CPU_StaticTensorManager)
@@ -70,6 +83,15 @@ void StaticTensorManager::buildTensor(const ir::OperandIndex &ind,
   {
     auto tensor = std::make_unique<Tensor>(tensor_info, backend_layout,
                                            _dynamic_tensor_manager->dynamic_mem_mgr().get());
+    if (tensor_info.isVariable())
+    {
+      // Zeros as the initial values
+      auto alloc = std::make_shared<Allocator>(tensor_info.total_size(), "variable");
+      tensor->setBuffer(alloc);
+      _variables[ind] = alloc;
+    }
+    else if (tensor_info.hasPlannedOffset())
+      _planned_offsets[ind] = tensor_info.plannedOffset();
     _tensors->setNativeTensor(ind, std::move(tensor));
   }
   _as_constants[ind] = as_const;
@@ -82,8 +104,22 @@ void StaticTensorManager::claimPlan(const ir::OperandIndex &ind, uint32_t size)
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
-  if (!_as_constants[ind])
+  // Tensors sharing memory with another tensor do not have their own plan
+  assert(_alias_roots.find(ind) == _alias_roots.end());
+  assert(_external_aliases.find(ind) == _external_aliases.end());
+  assert(_sub_tensors.find(ind) == _sub_tensors.end());
+
+  if (!_as_constants[ind] && _variables.find(ind) == _variables.end())
+  {
+    // All tensors are built before the first plan
+    if (!_planned_offsets.empty())
+    {
+      if (util::getConfigBool(util::config::CPU_PLANNED_OFFSETS))
+        _nonconst_mgr->usePlannedOffsets(_planned_offsets);
+      _planned_offsets.clear();
+    }
     _nonconst_mgr->claimPlan(ind, size);
+  }
 }
 
 void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
@@ -93,8 +129,78 @@ void StaticTensorManager::releasePlan(const ir::OperandIndex &ind)
   // This method is called only when a tensor has proper shape
   assert(!_tensors->getNativeTensor(ind)->is_dynamic());
 
-  if (!_as_constants[ind])
-    _nonconst_mgr->releasePlan(ind);
+  if (!_as_constants[ind] && _variables.find(ind) == _variables.end())
+    _nonconst_mgr->releasePlan(planRoot(ind));
+}
+
+void StaticTensorManager::claimInPlace(const ir::OperandIndex &ind,
+                                       const ir::OperandIndex &src_ind)
+{
+  assert(_tensors->getNativeTensor(ind));
+  assert(_tensors->getNativeTensor(src_ind));
+
+  // This method is called only when both tensors have proper shape
+  assert(!_tensors->getNativeTensor(ind)->is_dynamic());
+  assert(!_tensors->getNativeTensor(src_ind)->is_dynamic());
+  assert(!_as_constants[ind] && !_as_constants[src_ind]);
+
+  // Follow the chain so that every tensor in it refers to the tensor which owns the plan
+  const auto root = planRoot(src_ind);
+  _alias_roots[ind] = root;
+
+  VERBOSE(CPU_StaticTensorManager) << "TENSOR " << ind << " : in-place of " << root << std::endl;
+}
+
+void StaticTensorManager::claimAlias(const ir::OperandIndex &ind, const ir::OperandIndex &dst_ind)
+{
+  assert(_tensors->getNativeTensor(ind));
+  assert(!_tensors->getNativeTensor(ind)->is_dynamic());
+  assert(!_as_constants[ind]);
+
+  _external_aliases[ind] = dst_ind;
+
+  VERBOSE(CPU_StaticTensorManager) << "TENSOR " << ind << " : placed in " << dst_ind << std::endl;
+}
+
+void StaticTensorManager::bindAliases(void)
+{
+  for (const auto &it : _external_aliases)
+  {
+    auto dst = _tensors->getITensor(it.second);
+    if (dst == nullptr)
+      throw std::runtime_error{"StaticTensorManager: Tensor to be aliased is not registered"};
+    _tensors->getNativeTensor(it.first)->setAliasOf(dst);
+  }
+}
+
+void StaticTensorManager::claimSubTensor(const ir::OperandIndex &ind,
+                                         const ir::OperandIndex &parent_ind, uint32_t offset)
+{
+  assert(_tensors->getNativeTensor(ind));
+  assert(_tensors->getNativeTensor(parent_ind));
+  assert(!_tensors->getNativeTensor(ind)->is_dynamic());
+  assert(!_as_constants[ind] && !_as_constants[parent_ind]);
+  assert(_sub_tensors.find(parent_ind) == _sub_tensors.end());
+
+  _sub_tensors[ind] = std::make_pair(parent_ind, offset);
+
+  VERBOSE(CPU_StaticTensorManager) << "TENSOR " << ind << " : part of " << parent_ind
+                                   << " at offset " << offset << std::endl;
+}
+
+ir::OperandIndex StaticTensorManager::planRoot(const ir::OperandIndex &ind) const
+{
+  auto it = _alias_roots.find(ind);
+  return it == _alias_roots.end() ? ind : it->second;
+}
+
+void StaticTensorManager::resetVariables(void)
+{
+  for (const auto &it : _variables)
+  {
+    const auto tensor = _tensors->getNativeTensor(it.first);
+    std::memset(it.second->base(), 0, tensor->total_size());
+  }
 }
 
 void StaticTensorManager::iterate(const std::function<void(const ir::OperandIndex &)> &fn)
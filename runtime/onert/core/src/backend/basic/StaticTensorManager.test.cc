@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/StaticTensorManager.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend::basic;
+
+namespace
+{
+
+struct StaticTensorManagerTest : public ::testing::Test
+{
+  StaticTensorManagerTest()
+    : reg{std::make_shared<TensorRegistry>()}, dyn_mgr{reg}, mgr{reg, &dyn_mgr}
+  {
+  }
+
+  void build(const ir::OperandIndex &ind)
+  {
+    ir::OperandInfo info{ir::Shape{4}, ir::TypeInfo{ir::DataType::FLOAT32},
+                         ir::MemAllocType::STATIC, false};
+    mgr.buildTensor(ind, info, ir::Layout::NHWC, false);
+  }
+
+  std::shared_ptr<TensorRegistry> reg;
+  DynamicTensorManager dyn_mgr;
+  StaticTensorManager mgr;
+};
+
+} // namespace
+
+TEST_F(StaticTensorManagerTest, claimInPlace)
+{
+  ir::OperandIndex a{0u}, b{1u}, c{2u}, d{3u};
+  for (const auto &ind : {a, b, c, d})
+    build(ind);
+
+  // a -> [op] -> b -> [op] -> c, both in-place, and d lives with a
+  mgr.claimPlan(a, 16);
+  mgr.claimPlan(d, 16);
+  mgr.claimInPlace(b, a);
+  mgr.claimInPlace(c, b);
+  mgr.releasePlan(c);
+  mgr.releasePlan(d);
+  mgr.allocateNonconsts();
+
+  auto buf = reg->getNativeTensor(a)->buffer();
+  ASSERT_NE(buf, nullptr);
+  ASSERT_EQ(reg->getNativeTensor(b)->buffer(), buf);
+  ASSERT_EQ(reg->getNativeTensor(c)->buffer(), buf);
+  ASSERT_NE(reg->getNativeTensor(d)->buffer(), buf);
+}
+
+TEST_F(StaticTensorManagerTest, claimAlias)
+{
+  ir::OperandIndex a{0u}, b{1u};
+  for (const auto &ind : {a, b})
+    build(ind);
+
+  // a is placed in b, which stands for a model output owned by another backend
+  mgr.claimPlan(b, 16);
+  mgr.claimAlias(a, b);
+  mgr.releasePlan(b);
+  mgr.allocateNonconsts();
+  ASSERT_EQ(reg->getNativeTensor(a)->buffer(), nullptr);
+
+  mgr.bindAliases();
+  auto tensor = reg->getNativeTensor(a);
+  ASSERT_NE(tensor->buffer(), nullptr);
+  ASSERT_EQ(tensor->buffer(), reg->getNativeTensor(b)->buffer());
+
+  // A dynamic tensor has its own buffer
+  tensor->set_dynamic();
+  ASSERT_EQ(tensor->buffer(), nullptr);
+}
+
+TEST_F(StaticTensorManagerTest, claimSubTensor)
+{
+  ir::OperandIndex a{0u}, b{1u}, c{2u}, d{3u};
+  for (const auto &ind : {a, b, c, d})
+    build(ind);
+
+  // b and c are the halves of a, like the inputs of Concat, and d lives with them
+  mgr.claimPlan(a, 16);
+  mgr.claimSubTensor(b, a, 0);
+  mgr.claimSubTensor(c, a, 8);
+  mgr.claimPlan(d, 16);
+  mgr.releasePlan(a);
+  mgr.releasePlan(d);
+  mgr.allocateNonconsts();
+
+  auto buf = reg->getNativeTensor(a)->buffer();
+  ASSERT_NE(buf, nullptr);
+  ASSERT_EQ(reg->getNativeTensor(b)->buffer(), buf);
+  ASSERT_EQ(reg->getNativeTensor(c)->buffer(), buf + 8);
+  ASSERT_NE(reg->getNativeTensor(d)->buffer(), buf);
+}
+
+TEST_F(StaticTensorManagerTest, claimPlan_plannedOffsets)
+{
+  ir::OperandIndex a{0u}, b{1u}, c{2u};
+  for (const auto &ind : {a, b, c})
+  {
+    ir::OperandInfo info{ir::Shape{4}, ir::TypeInfo{ir::DataType::FLOAT32},
+                         ir::MemAllocType::STATIC, false};
+    // c is planned to share the memory of a, which is still alive
+    info.plannedOffset(ind == b ? 0 : 32);
+    mgr.buildTensor(ind, info, ir::Layout::NHWC, false);
+  }
+
+  mgr.claimPlan(a, 16);
+  mgr.claimPlan(b, 16);
+  mgr.claimPlan(c, 16);
+  mgr.releasePlan(a);
+  mgr.releasePlan(b);
+  mgr.releasePlan(c);
+  mgr.allocateNonconsts();
+
+  auto buf = reg->getNativeTensor(b)->buffer();
+  ASSERT_NE(buf, nullptr);
+  ASSERT_EQ(reg->getNativeTensor(a)->buffer(), buf + 32);
+  ASSERT_EQ(reg->getNativeTensor(c)->buffer(), buf + 16);
+  ASSERT_EQ(mgr.capacity(), 48);
+}
+
+TEST_F(StaticTensorManagerTest, reallocateNonconsts)
+{
+  ir::OperandIndex a{0u}, b{1u};
+  for (const auto &ind : {a, b})
+    build(ind);
+
+  mgr.claimPlan(a, 16);
+  mgr.claimSubTensor(b, a, 8);
+  mgr.releasePlan(a);
+  mgr.allocateNonconsts();
+  ASSERT_NE(reg->getNativeTensor(a)->buffer(), nullptr);
+
+  // Memory released while idle is acquired again with tensors bound to the new memory
+  mgr.deallocateNonconsts();
+  mgr.allocateNonconsts();
+  auto buf = reg->getNativeTensor(a)->buffer();
+  ASSERT_NE(buf, nullptr);
+  ASSERT_EQ(reg->getNativeTensor(b)->buffer(), buf + 8);
+  buf[15] = 1;
+}
+
+TEST_F(StaticTensorManagerTest, variables)
+{
+  ir::OperandIndex a{0u}, v{1u};
+  build(a);
+  ir::OperandInfo info{ir::Shape{4}, ir::TypeInfo{ir::DataType::FLOAT32},
+                       ir::MemAllocType::STATIC, false};
+  info.setAsVariable();
+  mgr.buildTensor(v, info, ir::Layout::NHWC, false);
+
+  // The variable has memory of zeros out of the plan
+  mgr.claimPlan(a, 16);
+  mgr.claimPlan(v, 16);
+  mgr.releasePlan(a);
+  mgr.releasePlan(v);
+  mgr.allocateNonconsts();
+  ASSERT_EQ(mgr.capacity(), 16);
+  auto state = reinterpret_cast<float *>(reg->getNativeTensor(v)->buffer());
+  ASSERT_NE(state, nullptr);
+  for (int i = 0; i < 4; ++i)
+    ASSERT_EQ(state[i], 0.f);
+
+  // Values are kept while memory of the others is released, until they are reset
+  state[2] = 1.f;
+  mgr.deallocateNonconsts();
+  mgr.allocateNonconsts();
+  ASSERT_EQ(reinterpret_cast<float *>(reg->getNativeTensor(v)->buffer()), state);
+  ASSERT_EQ(state[2], 1.f);
+  mgr.resetVariables();
+  ASSERT_EQ(state[2], 0.f);
+}
+
+TEST_F(StaticTensorManagerTest, neg_bindAliases_unregistered)
+{
+  ir::OperandIndex a{0u}, b{1u};
+  build(a);
+
+  mgr.claimAlias(a, b);
+  mgr.allocateNonconsts();
+  ASSERT_THROW(mgr.bindAliases(), std::runtime_error);
+}
@@ -51,6 +51,35 @@ void TensorBuilder::registerTensorInfo(const ir::OperandIndex &ind, const ir::Op
   }
 }
 
+uint64_t TensorBuilder::takeMemoryPeak(void)
+{
+  auto dynamic_mem_mgr = _dynamic_tensor_mgr->dynamic_mem_mgr();
+  const auto peak = _static_tensor_mgr->capacity() + dynamic_mem_mgr->peak();
+  dynamic_mem_mgr->resetPeak();
+  return peak;
+}
+
+uint64_t TensorBuilder::releaseMemory(void)
+{
+  if (_released)
+    return 0;
+
+  const uint64_t bytes =
+    _static_tensor_mgr->capacity() + _dynamic_tensor_mgr->dynamic_mem_mgr()->releasePool();
+  _static_tensor_mgr->deallocateNonconsts();
+  _released = true;
+  return bytes;
+}
+
+void TensorBuilder::reacquireMemory(void)
+{
+  if (!_released)
+    return;
+
+  _static_tensor_mgr->allocateNonconsts();
+  _released = false;
+}
+
 void TensorBuilder::notifyFirstUse(const ir::OperandIndex &ind)
 {
   assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
@@ -71,6 +100,33 @@ void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
   }
 }
 
+void TensorBuilder::claimInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &src_ind)
+{
+  assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
+  assert(_tensor_info_map.at(ind).total_size() == _tensor_info_map.at(src_ind).total_size());
+
+  _static_tensor_mgr->claimInPlace(ind, src_ind);
+}
+
+void TensorBuilder::claimAlias(const ir::OperandIndex &ind, const ir::OperandIndex &dst_ind)
+{
+  assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
+  _static_tensor_mgr->claimAlias(ind, dst_ind);
+}
+
+void TensorBuilder::bindAliases(void) { _static_tensor_mgr->bindAliases(); }
+
+void TensorBuilder::claimSubTensor(const ir::OperandIndex &ind, const ir::OperandIndex &parent_ind,
+                                   uint32_t offset)
+{
+  assert(_tensor_info_map.find(ind) != _tensor_info_map.end());
+  assert(_tensor_info_map.find(parent_ind) != _tensor_info_map.end());
+  assert(offset + _tensor_info_map.at(ind).total_size() <=
+         _tensor_info_map.at(parent_ind).total_size());
+
+  _static_tensor_mgr->claimSubTensor(ind, parent_ind, offset);
+}
+
 bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
 {
   return _tensor_info_map.find(ind) != _tensor_info_map.end();
@@ -17,6 +17,7 @@
 #ifndef __ONERT_BACKEND_BUILTIN_EXTERNAL_CONTEXT_H__
 #define __ONERT_BACKEND_BUILTIN_EXTERNAL_CONTEXT_H__
 
+#include <exec/SharedRuyContext.h>
 #include <util/ConfigSource.h>
 
 #include <ruy/context.h>
@@ -40,18 +41,30 @@ private:
 public:
   ExternalContext() : _ruy_context(std::make_unique<ruy::Context>())
   {
+    // It runs kernels which do not get the shared context on the calling thread
+    _ruy_context->set_max_num_threads(1);
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
     initPerThreadState();
   }
 
   void setMaxNumThreads(int max_num_threads)
   {
-    const int target_num_threads =
-      max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
-    _ruy_context->set_max_num_threads(target_num_threads);
+    _max_num_threads = max_num_threads > -1 ? max_num_threads : kDefaultNumThreadpoolThreads;
   }
 
-  ruy::Context *ruy_context() const { return _ruy_context.get(); }
+  int maxNumThreads() const { return _max_num_threads; }
+
+  /**
+   * @brief Lease threads from the thread budget with the ruy context shared by the backends
+   *
+   * @param cost Estimated cost of the kernel to run
+   * @param max_threads Maximum number of threads the kernel can use
+   * @return Lease of the threads and the context to run the kernel with
+   */
+  exec::SharedRuyContext::Lease leaseThreads(uint64_t cost, uint32_t max_threads)
+  {
+    return exec::SharedRuyContext::get().lease(cost, max_threads, _ruy_context.get());
+  }
 
 private:
   void initPerThreadState()
@@ -68,6 +81,7 @@ private:
 
 private:
   const std::unique_ptr<ruy::Context> _ruy_context;
+  int _max_num_threads = kDefaultNumThreadpoolThreads;
 };
 
 } // namespace builtin
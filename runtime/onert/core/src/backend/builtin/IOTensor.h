@@ -49,6 +49,10 @@ public:
   void setUserTensor(uint8_t *buffer, size_t size);
   ir::OperandInfo orig_info() const { return _orig_info; }
   ir::Layout orig_layout() const { return _orig_layout; }
+  /**
+   * @brief Return true if it is the buffer given by user, which is not written during a run
+   */
+  bool isUserTensor() const { return _user_tensor && _tensor == _user_tensor.get(); }
 
 public:
   uint8_t *buffer() const override { return _tensor->buffer(); }
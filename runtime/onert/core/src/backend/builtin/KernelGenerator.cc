@@ -110,6 +110,8 @@ void KernelGenerator::visit(const ir::operation::Permute &node)
 
   auto fn =
     std::make_unique<kernel::PermuteLayer>(input_tensors, output_tensors, _external_context);
+  // Executors that support it wait for reads from device memory before running consumers
+  fn->enableAsyncTransfer();
   _return_fn = std::move(fn);
 }
 
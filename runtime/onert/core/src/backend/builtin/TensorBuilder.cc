@@ -78,6 +78,36 @@ void TensorBuilder::notifyLastUse(const ir::OperandIndex &ind)
   }
 }
 
+void TensorBuilder::claimInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &src_ind)
+{
+  // TODO Enhance the way of checking user tensors
+  if (_tensor_info_map.find(ind) == _tensor_info_map.end()) // Do not proceed for user tensors
+    return;
+
+  assert(_tensor_info_map.find(src_ind) != _tensor_info_map.end());
+  _static_tensor_mgr->claimInPlace(ind, src_ind);
+}
+
+void TensorBuilder::claimAlias(const ir::OperandIndex &ind, const ir::OperandIndex &dst_ind)
+{
+  // TODO Enhance the way of checking user tensors
+  if (_tensor_info_map.find(ind) == _tensor_info_map.end()) // Do not proceed for user tensors
+    return;
+
+  _static_tensor_mgr->claimAlias(ind, dst_ind);
+}
+
+void TensorBuilder::claimSubTensor(const ir::OperandIndex &ind, const ir::OperandIndex &parent_ind,
+                                   uint32_t offset)
+{
+  // TODO Enhance the way of checking user tensors
+  if (_tensor_info_map.find(ind) == _tensor_info_map.end()) // Do not proceed for user tensors
+    return;
+
+  assert(_tensor_info_map.find(parent_ind) != _tensor_info_map.end());
+  _static_tensor_mgr->claimSubTensor(ind, parent_ind, offset);
+}
+
 bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
 {
   // User tensors are not registered in _tensor_info_map but objects for them are exist
@@ -50,12 +50,36 @@ public:
 
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
+  /**
+   * @brief     Notify the first use of a tensor which reuses the memory of a dying tensor
+   * @param[in] ind     Index of the tensor to be defined
+   * @param[in] src_ind Index of the tensor whose memory is reused
+   * @note      The last use of @c src_ind must not be notified
+   */
+  void claimInPlace(const ir::OperandIndex &ind, const ir::OperandIndex &src_ind);
+  /**
+   * @brief     Notify the first use of a tensor which is placed in a tensor of another backend
+   * @param[in] ind     Index of the tensor to be defined
+   * @param[in] dst_ind Index of the external tensor whose buffer is used
+   */
+  void claimAlias(const ir::OperandIndex &ind, const ir::OperandIndex &dst_ind);
+  /**
+   * @brief     Notify the first use of a tensor which is placed in a part of another tensor
+   * @param[in] ind        Index of the tensor to be defined
+   * @param[in] parent_ind Index of the tensor whose memory contains the tensor
+   * @param[in] offset     Offset in bytes of the tensor in the memory of @c parent_ind
+   * @note      The last use of @c ind must not be notified. @c parent_ind must be alive while
+   *            @c ind is.
+   */
+  void claimSubTensor(const ir::OperandIndex &ind, const ir::OperandIndex &parent_ind,
+                      uint32_t offset);
 
   bool isRegistered(const ir::OperandIndex &) const;
 
   void allocate(void);
 
   DynamicTensorManager *dynamicTensorManager(void);
+  basic::StaticTensorManager *staticTensorManager(void) { return _static_tensor_mgr.get(); }
 
   /**
    * @brief Get tensor with a specific OperandIndex.
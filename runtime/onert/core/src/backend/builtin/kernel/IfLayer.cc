@@ -16,6 +16,12 @@
 
 #include "IfLayer.h"
 
+#include "PermuteLayer.h"
+#include "../IOTensor.h"
+
+#include <algorithm>
+#include <cassert>
+
 namespace onert
 {
 namespace backend
@@ -38,6 +44,85 @@ IfLayer::IfLayer(backend::IPortableTensor *cond_tensor,
   // At this point, executor_map may not have executors of then subg and else subg
 }
 
+IfLayer::~IfLayer() { joinSpeculations(); }
+
+bool IfLayer::prepareSpeculation()
+{
+  if (_then_subg_index == _else_subg_index)
+    return false;
+
+  const auto is_dynamic = [](const backend::IPortableTensor *tensor) {
+    return tensor->is_dynamic();
+  };
+  if (std::any_of(_input_tensors.begin(), _input_tensors.end(), is_dynamic) ||
+      std::any_of(_output_tensors.begin(), _output_tensors.end(), is_dynamic))
+    return false;
+
+  if (!_speculations.empty())
+    return true;
+
+  std::vector<Speculation> speculations(2);
+  const ir::SubgraphIndex subg_indices[] = {_then_subg_index, _else_subg_index};
+  for (size_t i = 0; i < speculations.size(); ++i)
+  {
+    const auto &subg_outputs = _executor_map->at(subg_indices[i])->getOutputTensors();
+    if (subg_outputs.size() != _output_tensors.size())
+      return false;
+    for (auto io_tensor : subg_outputs)
+    {
+      if (io_tensor->orig_info().isDynamic())
+        return false;
+      auto tensor = std::make_unique<Tensor>(io_tensor->orig_info(), io_tensor->orig_layout(),
+                                             nullptr);
+      tensor->setBuffer(std::make_shared<basic::Allocator>(tensor->total_size()));
+      speculations[i].outputs.push_back(std::move(tensor));
+    }
+  }
+  _speculations = std::move(speculations);
+  return true;
+}
+
+void IfLayer::speculate()
+{
+  assert(!_speculating);
+  if (!prepareSpeculation())
+    return;
+
+  VERBOSE(If) << "Speculate $" << _then_subg_index << " (then) and $" << _else_subg_index
+              << " (else)" << std::endl;
+  const ir::SubgraphIndex subg_indices[] = {_then_subg_index, _else_subg_index};
+  for (size_t i = 0; i < _speculations.size(); ++i)
+  {
+    auto &speculation = _speculations[i];
+    auto subg_exec = _executor_map->at(subg_indices[i]).get();
+    std::vector<backend::IPortableTensor *> outputs;
+    for (const auto &tensor : speculation.outputs)
+      outputs.push_back(tensor.get());
+    speculation.error = nullptr;
+    speculation.thread = std::thread([this, subg_exec, outputs, &speculation]() {
+      try
+      {
+        subg_exec->execute(_input_tensors, outputs);
+      }
+      catch (...)
+      {
+        speculation.error = std::current_exception();
+      }
+    });
+  }
+  _speculating = true;
+}
+
+void IfLayer::joinSpeculations()
+{
+  for (auto &speculation : _speculations)
+  {
+    if (speculation.thread.joinable())
+      speculation.thread.join();
+  }
+  _speculating = false;
+}
+
 void IfLayer::run()
 {
   // Check condition
@@ -56,8 +141,29 @@ void IfLayer::run()
     return ret;
   };
 
-  exec::IExecutor *subg_exec = nullptr;
   bool cond_result = getResultCond(_cond_tensor);
+
+  // Both branches have run already, so take outputs of one and discard the other
+  // NOTE The other one is joined as well since it reads the inputs
+  if (_speculating)
+  {
+    joinSpeculations();
+    const auto &taken = _speculations.at(cond_result ? 0 : 1);
+    if (taken.error)
+      std::rethrow_exception(taken.error);
+
+    VERBOSE(If) << "Take $" << (cond_result ? _then_subg_index : _else_subg_index)
+                << " (speculated)" << std::endl;
+    std::vector<ITensor *> src_tensors;
+    for (const auto &tensor : taken.outputs)
+      src_tensors.push_back(tensor.get());
+    std::vector<ITensor *> dst_tensors(_output_tensors.begin(), _output_tensors.end());
+    PermuteLayer copy_outputs{src_tensors, dst_tensors, _external_context};
+    copy_outputs.run();
+    return;
+  }
+
+  exec::IExecutor *subg_exec = nullptr;
   if (cond_result)
   {
     VERBOSE(If) << "Call to $" << _then_subg_index << " (then)" << std::endl;
@@ -19,7 +19,14 @@
 
 #include <backend/IPortableTensor.h>
 #include <exec/IExecutor.h>
+#include <exec/ISpeculativeFunction.h>
 #include "../ExternalContext.h"
+#include "../Tensor.h"
+
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
 
 namespace onert
 {
@@ -30,7 +37,7 @@ namespace builtin
 namespace kernel
 {
 
-class IfLayer : public ::onert::exec::IFunction
+class IfLayer : public ::onert::exec::IFunction, public ::onert::exec::ISpeculativeFunction
 {
 public:
   IfLayer(backend::IPortableTensor *cond_tensor,
@@ -39,9 +46,27 @@ public:
           const ir::SubgraphIndex &then_subg_index, const ir::SubgraphIndex &else_subg_index,
           exec::ExecutorMap *executor_map,
           const std::shared_ptr<ExternalContext> &external_context);
+  ~IfLayer();
 
 public:
   void run() override;
+  /**
+   * @brief Start both branches on their own threads before the condition is known
+   * @note  Branches write to temp outputs, and run() copies those of the taken branch to the
+   *        outputs. Nothing is started if tensors are dynamic or both branches are the same.
+   */
+  void speculate() override;
+
+private:
+  struct Speculation
+  {
+    std::vector<std::unique_ptr<Tensor>> outputs;
+    std::thread thread;
+    std::exception_ptr error;
+  };
+
+  bool prepareSpeculation();
+  void joinSpeculations();
 
 private:
   backend::IPortableTensor *_cond_tensor;
@@ -51,6 +76,9 @@ private:
   const ir::SubgraphIndex _else_subg_index;
   exec::ExecutorMap *_executor_map;
   const std::shared_ptr<ExternalContext> _external_context;
+  // Speculative runs of then and else branches, in the order
+  std::vector<Speculation> _speculations;
+  bool _speculating = false;
 };
 
 } // namespace kernel
@@ -16,10 +16,13 @@
 
 #include "PermuteLayer.h"
 
+#include "../IOTensor.h"
 #include "../../../exec/ShapeConverter.h"
 
 #include <ruy/context.h> // from @ruy
 
+#include <iostream>
+
 namespace onert
 {
 namespace backend
@@ -29,6 +32,14 @@ namespace builtin
 namespace kernel
 {
 
+namespace
+{
+
+// Splitting a tensor smaller than this for each thread costs more than copying it in a thread
+constexpr size_t kMinBytesPerThread = 16 * 1024;
+
+} // namespace
+
 PermuteLayer::PermuteLayer(const std::vector<ITensor *> &src_tensors,
                            const std::vector<ITensor *> &dst_tensors,
                            const std::shared_ptr<ExternalContext> &external_context)
@@ -91,10 +102,7 @@ void PermuteLayer::optimize()
             if ((!src_tensor.has_padding() && !dst_tensor.has_padding()))
             {
               const auto num_elements = src_tensor.getShape().num_elements();
-              const int thread_count =
-                _external_context->ruy_context()->max_num_threads() < static_cast<int>(num_elements)
-                  ? _external_context->ruy_context()->max_num_threads()
-                  : num_elements;
+              const int thread_count = threadCount(num_elements, num_elements * data_size);
 
               std::vector<PermuteWorkerTask> tasks;
               auto start = 0;
@@ -153,14 +161,18 @@ void PermuteLayer::appendPermuteTasks(const ITensor *src_tensor, ITensor *dst_te
       distributed_dim = src_shape.dim(distributed_dim) < src_shape.dim(i) ? i : distributed_dim;
     }
   }
+  else
+  {
+    // Tiles are transposed on the plane of W and C, so distribute along N or H
+    assert(src_shape.rank() == 4);
+    const size_t h_dim = src_tensor->layout() == ir::Layout::NHWC ? 1 : 2;
+    distributed_dim = src_shape.dim(0) < src_shape.dim(h_dim) ? h_dim : 0;
+  }
   const auto distributed_dim_val = src_shape.dim(distributed_dim);
-  const int thread_count =
-    _external_context->ruy_context()->max_num_threads() < static_cast<int>(distributed_dim_val)
-      ? _external_context->ruy_context()->max_num_threads()
-      : distributed_dim_val;
+  const int thread_count = threadCount(distributed_dim_val, src_tensor->total_size());
   // NOTE Do not remove this assertion. It would cause performance degradation by new threads to be
   // created in the context's thread pool
-  assert(thread_count <= _external_context->ruy_context()->max_num_threads());
+  assert(thread_count <= _external_context->maxNumThreads());
 
   std::vector<PermuteWorkerTask> tasks;
   int start = 0;
@@ -178,6 +190,13 @@ void PermuteLayer::appendPermuteTasks(const ITensor *src_tensor, ITensor *dst_te
   _tasks_map[src_tensor] = std::move(tasks);
 }
 
+int PermuteLayer::threadCount(size_t num_units, size_t total_size) const
+{
+  const size_t max_threads = _external_context->maxNumThreads();
+  const size_t by_size = std::max<size_t>(1, total_size / kMinBytesPerThread);
+  return static_cast<int>(std::max<size_t>(1, std::min({max_threads, num_units, by_size})));
+}
+
 void PermuteLayer::runPermuteTasks(backend::ITensor *src, uint8_t *dst_buffer)
 {
   assert(src->getShape().num_elements() * ir::sizeOfDataType(src->data_type()) <=
@@ -188,7 +207,48 @@ void PermuteLayer::runPermuteTasks(backend::ITensor *src, uint8_t *dst_buffer)
     tasks.at(i).setBuffers(src->buffer(), dst_buffer);
   }
   assert(tasks.size() >= 1);
-  _external_context->ruy_context()->mutable_thread_pool()->Execute(tasks.size(), tasks.data());
+  executeTasks(tasks.size(), tasks.data());
+}
+
+void PermuteLayer::appendBatchedTasks(backend::ITensor *src, uint8_t *dst_buffer)
+{
+  std::vector<PermuteWorkerTask> &tasks = _tasks_map.at(src);
+
+  // Do not let the thread pool create more threads than the context has
+  const size_t max_threads = _external_context->maxNumThreads();
+  if (_batched_tasks.size() + tasks.size() > max_threads)
+    runBatchedTasks();
+
+  for (auto &task : tasks)
+  {
+    task.setBuffers(src->buffer(), dst_buffer);
+    _batched_tasks.emplace_back(&task);
+  }
+}
+
+void PermuteLayer::runBatchedTasks()
+{
+  if (_batched_tasks.empty())
+    return;
+
+  executeTasks(_batched_tasks.size(), _batched_tasks.data());
+  _batched_tasks.clear();
+}
+
+template <typename Task> void PermuteLayer::executeTasks(size_t num_tasks, Task *tasks)
+{
+  // The tasks have been split for the threads by their size
+  const auto lease = _external_context->leaseThreads(
+    num_tasks * exec::ThreadBudget::MIN_COST_PER_THREAD, static_cast<uint32_t>(num_tasks));
+  if (num_tasks > 1 && lease.threads() > 1)
+  {
+    lease.context()->mutable_thread_pool()->Execute(num_tasks, tasks);
+  }
+  else
+  {
+    for (size_t i = 0; i < num_tasks; ++i)
+      tasks[i].Run();
+  }
 }
 
 void PermuteLayer::run()
@@ -258,10 +318,22 @@ void PermuteLayer::run()
       {
         // Conditions to run permutation with multithreading
         // 1. The tasks for multithreathing was created
-        // 2. The tasks's size > 1
-        // 3. Both tensors are not dynamic
-        if (_tasks_map.find(src) == _tasks_map.end() || _tasks_map.at(src).size() == 1 ||
-            src->is_dynamic() || dst->is_dynamic())
+        // 2. Both tensors are not dynamic
+        // 3. The tasks's size > 1, or both tensors are on host memory to run with other tensors
+        if (exec::IsSharedBuffer(src, dst))
+        {
+          // Nothing to copy
+        }
+        else if (_tasks_map.find(src) == _tasks_map.end() || src->is_dynamic() ||
+                 dst->is_dynamic())
+        {
+          permute(src, dst, src->getShape().rank(), src_offsets, dst_offsets);
+        }
+        else if (!src->needMemoryMap() && !dst->needMemoryMap())
+        {
+          appendBatchedTasks(src, dst->buffer());
+        }
+        else if (_tasks_map.at(src).size() == 1)
         {
           permute(src, dst, src->getShape().rank(), src_offsets, dst_offsets);
         }
@@ -270,8 +342,14 @@ void PermuteLayer::run()
         {
           if (!src->has_padding() && !dst->has_padding() && src->layout() == dst->layout())
           {
-            // This is more effective than multi-threading
-            src->access([&](backend::ITensor &) { dst->enqueueWriteBuffer(src->buffer(), false); });
+            // Buffers of user are not written during the run, so they can be read in place
+            const auto io_tensor = dynamic_cast<const IOTensor *>(src);
+            if (!(io_tensor && io_tensor->isUserTensor() && dst->importHostBuffer(src->buffer())))
+            {
+              // This is more effective than multi-threading
+              src->access(
+                [&](backend::ITensor &) { dst->enqueueWriteBuffer(src->buffer(), false); });
+            }
           }
           else
           {
@@ -288,7 +366,9 @@ void PermuteLayer::run()
         {
           // This is more effective than multi-threading
           assert(!dst->needMemoryMap());
-          dst->access([&](backend::ITensor &) { src->enqueueReadBuffer(dst->buffer(), true); });
+          const bool deferred = _async_transfer && exec::AsyncTransfers::defer(src);
+          dst->access(
+            [&](backend::ITensor &) { src->enqueueReadBuffer(dst->buffer(), !deferred); });
         }
         else
         {
@@ -304,6 +384,7 @@ void PermuteLayer::run()
     src_offsets_it++;
     dst_offsets_it++;
   }
+  runBatchedTasks();
 }
 
 } // namespace kernel
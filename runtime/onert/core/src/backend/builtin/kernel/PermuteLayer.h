@@ -49,6 +49,11 @@ private:
                           const ir::Shape &loop_shape, size_t size);
 
   void runPermuteTasks(backend::ITensor *src, uint8_t *dst_buffer);
+  void appendBatchedTasks(backend::ITensor *src, uint8_t *dst_buffer);
+  void runBatchedTasks();
+  // Run tasks on the shared thread pool if it leases threads, or on the calling thread
+  template <typename Task> void executeTasks(size_t num_tasks, Task *tasks);
+  int threadCount(size_t num_units, size_t total_size) const;
 
   struct PermuteWorkerTask : ruy::Task
   {
@@ -58,15 +63,24 @@ private:
                       const ir::Coordinates &start_coords, const ir::Shape &loop_shape, size_t size)
       : _src_buffer{src_tensor.buffer()}, _dst_buffer{dst_tensor.buffer()},
         _src_start_offset{src_tensor.calcOffset(start_coords)},
-        _dst_start_offset{dst_tensor.calcOffset(start_coords)}, _src_strides{}, _dst_strides{},
-        _loop_shape{loop_shape}, _size{size}, _src_layout{src_tensor.layout()},
-        _dst_layout{dst_tensor.layout()}, _is_permutation{true}
+        _dst_start_offset{dst_tensor.calcOffset(
+          ir::convertCoordinates(start_coords, src_tensor.layout(), dst_tensor.layout()))},
+        _src_strides{}, _dst_strides{}, _loop_shape{loop_shape}, _size{size},
+        _src_layout{src_tensor.layout()}, _dst_layout{dst_tensor.layout()}, _is_permutation{true}
     {
-      // Set strides
-      setStrides(src_tensor, &_src_strides);
-      setStrides(dst_tensor, &_dst_strides);
-
       _is_permutation = (_src_layout != _dst_layout && loop_shape.rank() == 4);
+
+      // Set strides
+      if (_is_permutation)
+      {
+        // Strides of both tensors are for dimensions of src to transpose tiles
+        exec::CalcPermuteStrides(src_tensor, dst_tensor, _src_block_strides, _dst_block_strides);
+      }
+      else
+      {
+        setStrides(src_tensor, &_src_strides);
+        setStrides(dst_tensor, &_dst_strides);
+      }
     }
     // Constructor for a copy
     PermuteWorkerTask(const uint8_t *src_buffer, uint8_t *dst_buffer, uint32_t src_start_offset,
@@ -84,20 +98,23 @@ private:
     }
     void Run() override
     {
+      if (_is_permutation)
+      {
+        // _size is the size of an element for permutation
+        exec::PermuteBlock(_size, _src_buffer + _src_start_offset, _src_block_strides,
+                           _dst_buffer + _dst_start_offset, _dst_block_strides, _loop_shape);
+        return;
+      }
+
       ShapeLoop(_loop_shape, [&](const onert::ir::Coordinates &coords) {
         size_t src_offset = _src_start_offset;
         size_t dst_offset = _dst_start_offset;
         assert(static_cast<size_t>(_loop_shape.rank()) == coords.size());
-        ir::Coordinates dst_coords = coords;
-        if (_is_permutation)
-        {
-          dst_coords = ir::convertCoordinates(coords, _src_layout, _dst_layout);
-        }
         for (auto i = 0; i < _loop_shape.rank(); ++i)
         {
-          assert(coords[i] >= 0 && dst_coords[i] >= 0);
+          assert(coords[i] >= 0);
           src_offset += coords[i] * _src_strides[i];
-          dst_offset += dst_coords[i] * _dst_strides[i];
+          dst_offset += coords[i] * _dst_strides[i];
         }
         memcpy(_dst_buffer + dst_offset, _src_buffer + src_offset, _size);
       });
@@ -133,6 +150,8 @@ private:
     size_t _dst_start_offset;
     Strides _src_strides;
     Strides _dst_strides;
+    std::vector<size_t> _src_block_strides;
+    std::vector<size_t> _dst_block_strides;
     const ir::Shape _loop_shape;
     const size_t _size;
     const ir::Layout _src_layout;
@@ -140,6 +159,18 @@ private:
     bool _is_permutation;
   };
   std::unordered_map<const ITensor *, std::vector<PermuteWorkerTask>> _tasks_map;
+
+  // Task to run a task of any tensor in a batch
+  struct BatchedTask : ruy::Task
+  {
+    BatchedTask(ruy::Task *task) : _task{task} {}
+    void Run() override { _task->Run(); }
+
+  private:
+    ruy::Task *_task;
+  };
+  // Tasks of host memory tensors to run at once on the thread pool
+  std::vector<BatchedTask> _batched_tasks;
 };
 
 } // namespace kernel
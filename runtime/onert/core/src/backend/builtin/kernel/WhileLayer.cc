@@ -20,8 +20,11 @@
 #include "../../../exec/ExecutorBase.h"
 
 #include <misc/polymorphic_downcast.h>
+#include <util/ConfigSource.h>
 
 #include <algorithm>
+#include <exception>
+#include <thread>
 
 namespace onert
 {
@@ -40,7 +43,8 @@ WhileLayer::WhileLayer(const std::vector<backend::IPortableTensor *> input_tenso
                        const std::shared_ptr<ExternalContext> &external_context)
   : _cond_subg_index{cond_subg_index}, _body_subg_index{body_subg_index},
     _input_tensors{input_tensors}, _output_tensors{output_tensors}, _executor_map{executor_map},
-    _dyn_memory_manager{dyn_memory_manager}, _external_context{external_context}
+    _dyn_memory_manager{dyn_memory_manager}, _external_context{external_context},
+    _speculative{util::getConfigBool(util::config::SPECULATIVE_EXEC)}
 {
   // At this point, executor_map may not have executors of cond subg and body subg
 }
@@ -57,6 +61,8 @@ void WhileLayer::run()
   // // Run cond subg
   // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "cond subg inputs" ->
   // "_dst_tensors"
+  // Copies between iterations are skipped by swapping buffers if shapes of loop variables are
+  // invariant. Subgraphs bind the given tensors rather than copying them.
   auto cond_exec = _executor_map->at(_cond_subg_index).get();
   auto body_exec = _executor_map->at(_body_subg_index).get();
 
@@ -92,54 +98,145 @@ void WhileLayer::run()
   }
 
   // Need some temp tensors to hold the body subgraph output
+  // Outputs of loop variables whose shapes were inferred invariant stay static, so that they do
+  // not go through the dynamic path of the body and the copies. They may still become dynamic if
+  // shapes of inputs change at execution time.
   std::vector<std::unique_ptr<Tensor>> temp_outputs_o;
   std::vector<IPortableTensor *> temp_outputs;
   for (auto io_tensor : body_exec->getOutputTensors())
   {
     auto tensor = std::make_unique<Tensor>(io_tensor->orig_info(), io_tensor->orig_layout(),
                                            _dyn_memory_manager);
-    tensor->set_dynamic();
-    tensor->setBuffer(_dyn_memory_manager->allocate(tensor.get(), tensor->total_size()));
+    if (io_tensor->orig_info().isDynamic())
+    {
+      tensor->set_dynamic();
+      tensor->setBuffer(_dyn_memory_manager->allocate(tensor.get(), tensor->total_size()));
+    }
+    else
+    {
+      tensor->setBuffer(std::make_shared<basic::Allocator>(tensor->total_size()));
+    }
     temp_outputs.push_back(tensor.get());
     temp_outputs_o.push_back(std::move(tensor));
   }
 
-  std::vector<ITensor *> body_outputs(temp_outputs.begin(), temp_outputs.end());
-  PermuteLayer copy_body_outputs_to_op_outputs{body_outputs, op_outputs, _external_context};
-
-  const auto body_execute_with_op_inputs = [&]() {
-    VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_input_tensors, temp_outputs);
-    VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
-  };
+  // Loop variables can be ping-ponged between op outputs and temp outputs without copying, if
+  // their shapes do not change: body reads the buffers which the previous iteration wrote and
+  // writes the other ones. Otherwise body outputs are copied to op outputs in every iteration.
+  const bool swap_buffers = [&]() {
+    for (size_t i = 0; i < _output_tensors.size(); ++i)
+    {
+      const auto op_input = _input_tensors.at(i);
+      const auto op_output = _output_tensors.at(i);
+      const auto temp_output = temp_outputs.at(i);
+      if (op_input->is_dynamic() || op_output->is_dynamic() || temp_output->is_dynamic() ||
+          op_output->layout() != temp_output->layout() ||
+          op_input->getShape() != op_output->getShape() ||
+          op_output->total_size() != temp_output->total_size())
+        return false;
+    }
+    return true;
+  }();
 
-  const auto body_execute_with_body_outputs = [&]() {
+  const auto body_execute = [&](const std::vector<IPortableTensor *> &inputs,
+                                const std::vector<IPortableTensor *> &outputs) {
     VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_output_tensors, temp_outputs);
+    body_exec->execute(inputs, outputs);
     VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
   };
 
-  std::function<void()> body_execute = body_execute_with_op_inputs;
-  const auto cond_execute = [&]() {
+  const auto cond_execute = [&](const std::vector<IPortableTensor *> &inputs) {
     VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
-    cond_exec->execute(_output_tensors, {cond_output_tensor.get()});
+    cond_exec->execute(inputs, {cond_output_tensor.get()});
     VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
   };
 
-  // Loop while Cond subgraph's output is true
-  while (getResultCond(cond_output_tensor.get()))
+  std::vector<ITensor *> body_outputs(temp_outputs.begin(), temp_outputs.end());
+  PermuteLayer copy_body_outputs_to_op_outputs{body_outputs, op_outputs, _external_context};
+
+  if (swap_buffers && _speculative)
+  {
+    // Body of the next iteration runs while cond checks the current state, and its result is
+    // discarded if the loop ends. Both of them only read the current state, and the body writes
+    // the buffers of the previous state. So op inputs are never written.
+    body_execute(_input_tensors, _output_tensors);
+    std::vector<IPortableTensor *> cur = _output_tensors;
+    std::vector<IPortableTensor *> next = temp_outputs;
+    while (true)
+    {
+      std::exception_ptr cond_error;
+      std::thread cond_thread{[&]() {
+        try
+        {
+          cond_execute(cur);
+        }
+        catch (...)
+        {
+          cond_error = std::current_exception();
+        }
+      }};
+      std::exception_ptr body_error;
+      try
+      {
+        body_execute(cur, next);
+      }
+      catch (...)
+      {
+        body_error = std::current_exception();
+      }
+      cond_thread.join();
+      if (cond_error)
+        std::rethrow_exception(cond_error);
+
+      // Body may be valid only while cond is true, so its error is dropped if the loop ends
+      if (!getResultCond(cond_output_tensor.get()))
+        break;
+      if (body_error)
+        std::rethrow_exception(body_error);
+      std::swap(cur, next);
+    }
+
+    if (cur != _output_tensors)
+      copy_body_outputs_to_op_outputs.run();
+  }
+  else if (swap_buffers)
+  {
+    // Loop state is read from "cur" and written to "next", which swap after each iteration
+    std::vector<IPortableTensor *> cur = _input_tensors;
+    std::vector<IPortableTensor *> next = _output_tensors;
+    while (getResultCond(cond_output_tensor.get()))
+    {
+      body_execute(cur, next);
+      cond_execute(next);
+      cur = next;
+      next = (next == _output_tensors) ? temp_outputs : _output_tensors;
+    }
+
+    // Last state is in temp outputs after an even number of iterations
+    if (cur != _output_tensors)
+      copy_body_outputs_to_op_outputs.run();
+  }
+  else
   {
-    body_execute();
+    // Loop while Cond subgraph's output is true
+    body_execute(_input_tensors, temp_outputs);
     copy_body_outputs_to_op_outputs.run();
-    cond_execute();
-    body_execute = body_execute_with_body_outputs;
+    cond_execute(_output_tensors);
+    while (getResultCond(cond_output_tensor.get()))
+    {
+      body_execute(_output_tensors, temp_outputs);
+      copy_body_outputs_to_op_outputs.run();
+      cond_execute(_output_tensors);
+    }
   }
 
   // Clean-up the temp tensors
   _dyn_memory_manager->deallocate(cond_output_tensor.get());
   for (auto tensor : temp_outputs)
   {
-    _dyn_memory_manager->deallocate(tensor);
+    // Static ones own their memory
+    if (tensor->is_dynamic())
+      _dyn_memory_manager->deallocate(tensor);
   }
 }
 
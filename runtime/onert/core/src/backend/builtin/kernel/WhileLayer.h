@@ -55,6 +55,8 @@ private:
   exec::ExecutorMap *_executor_map;
   basic::DynamicMemoryManager *_dyn_memory_manager; // For generating temp tensors
   const std::shared_ptr<ExternalContext> _external_context;
+  // Whether to run cond and body of the next iteration together
+  const bool _speculative;
 };
 
 } // namespace kernel
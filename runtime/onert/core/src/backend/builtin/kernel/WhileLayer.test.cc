@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WhileLayer.h"
+#include "../IOTensor.h"
+#include "backend/basic/Tensor.h"
+#include "util/ConfigSource.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <stdexcept>
+
+using namespace onert;
+using namespace onert::backend;
+using namespace onert::backend::builtin;
+
+namespace
+{
+
+using SubgraphFn = std::function<void(const std::vector<IPortableTensor *> &inputs,
+                                      const std::vector<IPortableTensor *> &outputs)>;
+
+// Executor of a subgraph given by a function, which only runs with tensors bound
+class FunctionExecutor : public exec::IExecutor
+{
+public:
+  FunctionExecutor(const std::vector<ir::OperandInfo> &output_infos, const SubgraphFn &fn)
+    : _fn{fn}
+  {
+    for (const auto &info : output_infos)
+    {
+      _outputs_o.push_back(std::make_unique<IOTensor>(info, ir::Layout::NHWC));
+      _outputs.push_back(_outputs_o.back().get());
+    }
+  }
+
+  const ir::Graph &graph() override { throw std::runtime_error{"No graph"}; }
+  const ir::Graph &parent_graph() override { throw std::runtime_error{"No graph"}; }
+  void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>>) override {}
+  void execute(const exec::IODescription &) override
+  {
+    throw std::runtime_error{"No IO description"};
+  }
+  void execute(const std::vector<IPortableTensor *> &inputs,
+               const std::vector<IPortableTensor *> &outputs) override
+  {
+    _fn(inputs, outputs);
+  }
+  const std::vector<IOTensor *> &getOutputTensors() const override { return _outputs; }
+
+private:
+  SubgraphFn _fn;
+  std::vector<std::unique_ptr<IOTensor>> _outputs_o;
+  std::vector<IOTensor *> _outputs;
+};
+
+int32_t &value(IPortableTensor *tensor) { return *reinterpret_cast<int32_t *>(tensor->buffer()); }
+
+// Run "while (x < 3) x = x + 1" from 0, whose body throws for x of throw_from or more
+int32_t runLoop(int32_t throw_from)
+{
+  const auto x_info = ir::OperandInfo::createStaticInfo({1}, ir::TypeInfo{ir::DataType::INT32});
+  const auto cond_info = ir::OperandInfo::createStaticInfo({1}, ir::TypeInfo{ir::DataType::BOOL8});
+
+  exec::ExecutorMap executors;
+  executors.emplace(ir::SubgraphIndex{1},
+                    std::make_unique<FunctionExecutor>(
+                      std::vector<ir::OperandInfo>{cond_info},
+                      [](const std::vector<IPortableTensor *> &inputs,
+                         const std::vector<IPortableTensor *> &outputs) {
+                        *reinterpret_cast<bool *>(outputs.at(0)->buffer()) =
+                          value(inputs.at(0)) < 3;
+                      }));
+  executors.emplace(ir::SubgraphIndex{2},
+                    std::make_unique<FunctionExecutor>(
+                      std::vector<ir::OperandInfo>{x_info},
+                      [&](const std::vector<IPortableTensor *> &inputs,
+                          const std::vector<IPortableTensor *> &outputs) {
+                        if (value(inputs.at(0)) >= throw_from)
+                          throw std::runtime_error{"Body of an invalid state"};
+                        value(outputs.at(0)) = value(inputs.at(0)) + 1;
+                      }));
+
+  basic::DynamicMemoryManager dyn_memory_manager;
+  basic::Tensor input{x_info, ir::Layout::NHWC, &dyn_memory_manager};
+  basic::Tensor output{x_info, ir::Layout::NHWC, &dyn_memory_manager};
+  input.setBuffer(std::make_shared<basic::Allocator>(input.total_size()));
+  output.setBuffer(std::make_shared<basic::Allocator>(output.total_size()));
+  value(&input) = 0;
+
+  kernel::WhileLayer layer{{&input},
+                           {&output},
+                           ir::SubgraphIndex{1},
+                           ir::SubgraphIndex{2},
+                           &executors,
+                           &dyn_memory_manager,
+                           std::make_shared<ExternalContext>()};
+  layer.run();
+  return value(&output);
+}
+
+} // namespace
+
+TEST(WhileLayer, speculative_body_fails_after_loop_ends)
+{
+  util::ScopedConfig speculative{{{util::config::SPECULATIVE_EXEC, "1"}}};
+
+  // Body of the state where cond is false runs speculatively and throws, which is not an error
+  ASSERT_EQ(runLoop(3), 3);
+}
+
+TEST(WhileLayer, neg_speculative_body_fails_in_loop)
+{
+  util::ScopedConfig speculative{{{util::config::SPECULATIVE_EXEC, "1"}}};
+
+  ASSERT_THROW(runLoop(2), std::runtime_error);
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompileCache.h"
+
+#include "backend/IConfig.h"
+#include "util/AtomicFile.h"
+#include "util/logging.h"
+
+#include <json/json.h>
+
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+namespace
+{
+
+using namespace onert;
+
+// FNV-1a hash
+class Hasher
+{
+public:
+  void add(const void *data, size_t size)
+  {
+    const auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+      _value ^= bytes[i];
+      _value *= 1099511628211ull;
+    }
+  }
+  template <typename T> void add(const T &value) { add(&value, sizeof(value)); }
+  void add(const std::string &str)
+  {
+    add(str.size());
+    add(str.data(), str.size());
+  }
+  void addFile(const std::string &path)
+  {
+    std::ifstream stream(path);
+    std::stringstream contents;
+    if (stream.is_open())
+      contents << stream.rdbuf();
+    add(contents.str());
+  }
+  uint64_t value() const { return _value; }
+
+private:
+  uint64_t _value = 14695981039346656037ull;
+};
+
+void addGraph(Hasher &hasher, const ir::Graph &graph)
+{
+  // Objects are iterated in index order as the order of hash maps may differ between sessions
+  std::map<uint32_t, const ir::Operand *> operands;
+  graph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    operands.emplace(index.value(), &operand);
+  });
+  for (const auto &pair : operands)
+  {
+    const auto &operand = *pair.second;
+    hasher.add(pair.first);
+    hasher.add(operand.typeInfo().type());
+    hasher.add(operand.isConstant());
+    hasher.add(operand.shape().rank());
+    for (const auto dim : operand.shape().dims())
+      hasher.add(dim);
+  }
+
+  std::map<uint32_t, const ir::Operation *> operations;
+  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+    operations.emplace(index.value(), &op);
+  });
+  for (const auto &pair : operations)
+  {
+    const auto &op = *pair.second;
+    hasher.add(pair.first);
+    hasher.add(op.name());
+    for (const auto &ind : op.getInputs())
+      hasher.add(ind.value());
+    hasher.add(op.getInputs().size());
+    for (const auto &ind : op.getOutputs())
+      hasher.add(ind.value());
+    hasher.add(op.getOutputs().size());
+  }
+
+  for (const auto &ind : graph.getInputs())
+    hasher.add(ind.value());
+  for (const auto &ind : graph.getOutputs())
+    hasher.add(ind.value());
+}
+
+void addOptions(Hasher &hasher, const compiler::CompilerOptions &options)
+{
+  for (const auto &backend : options.backend_list)
+    hasher.add(backend);
+  hasher.add(options.backend_list.size());
+  hasher.add(options.executor);
+  hasher.add(options.he_scheduler);
+
+  const auto &ms_options = options.manual_scheduler_options;
+  hasher.add(ms_options.backend_for_all);
+  const std::map<ir::OpCode, std::string> opcode_to_backend{ms_options.opcode_to_backend.begin(),
+                                                             ms_options.opcode_to_backend.end()};
+  for (const auto &pair : opcode_to_backend)
+  {
+    hasher.add(pair.first);
+    hasher.add(pair.second);
+  }
+  std::map<uint32_t, std::string> index_to_backend;
+  for (const auto &pair : ms_options.index_to_backend)
+    index_to_backend.emplace(pair.first.value(), pair.second);
+  for (const auto &pair : index_to_backend)
+  {
+    hasher.add(pair.first);
+    hasher.add(pair.second);
+  }
+
+  // Applications may tell models apart by a token, e.g. of NNAPI, as well
+  if (!options.compile_cache_token.empty())
+    hasher.add(options.compile_cache_token);
+
+  // HEScheduler decides with the profiling records
+  if (options.he_scheduler)
+  {
+    hasher.addFile("exec_time.json");
+    hasher.addFile("transfer_cost.json");
+  }
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+CompileCache::CompileCache(const ir::Graph &graph, const CompilerOptions &options) : _graph{graph}
+{
+  // Profiling needs scheduling to try backends without records
+  if (options.compile_cache_dir.empty() || options.he_profiling_mode || options.online_profiling ||
+      options.drift_monitor)
+    return;
+
+  std::stringstream file;
+  file << options.compile_cache_dir << "/schedule_" << std::hex << std::setw(16)
+       << std::setfill('0') << key(graph, options) << ".json";
+  _file = file.str();
+}
+
+uint64_t CompileCache::key(const ir::Graph &graph, const CompilerOptions &options)
+{
+  Hasher hasher;
+  addGraph(hasher, graph);
+  addOptions(hasher, options);
+  return hasher.value();
+}
+
+std::unique_ptr<BackendResolver>
+CompileCache::loadSchedule(const std::vector<const backend::Backend *> &backends,
+                           std::shared_ptr<ir::OperationIndexMap<int64_t>> &indexed_ranks) const
+{
+  if (!enabled())
+    return nullptr;
+
+  std::ifstream stream(_file);
+  if (!stream.is_open())
+    return nullptr;
+
+  Json::Value root;
+  Json::CharReaderBuilder builder;
+  std::string errors;
+  if (!Json::parseFromStream(builder, stream, &root, &errors) || !root.isObject())
+  {
+    VERBOSE(CompileCache) << "Ignore invalid cache file " << _file << " : " << errors << std::endl;
+    return nullptr;
+  }
+
+  std::unordered_map<std::string, const backend::Backend *> backend_map;
+  for (const auto backend : backends)
+    backend_map.emplace(backend->config()->id(), backend);
+
+  auto resolver = std::make_unique<BackendResolver>();
+  const auto &json_backends = root["backends"];
+  bool complete = true;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &) {
+    const auto &id = json_backends[std::to_string(index.value())];
+    auto it = id.isString() ? backend_map.find(id.asString()) : backend_map.end();
+    if (it == backend_map.end())
+    {
+      complete = false;
+      return;
+    }
+    resolver->setBackend(index, it->second);
+  });
+  if (!complete)
+  {
+    VERBOSE(CompileCache) << "Ignore cache file not matching backends " << _file << std::endl;
+    return nullptr;
+  }
+
+  indexed_ranks = nullptr;
+  const auto &json_ranks = root["ranks"];
+  if (json_ranks.isObject())
+  {
+    indexed_ranks = std::make_shared<ir::OperationIndexMap<int64_t>>();
+    for (const auto &index : json_ranks.getMemberNames())
+    {
+      const auto op_index = ir::OperationIndex{static_cast<uint32_t>(std::stoul(index))};
+      indexed_ranks->emplace(op_index, json_ranks[index].asInt64());
+    }
+  }
+
+  VERBOSE(CompileCache) << "Loaded schedule from " << _file << std::endl;
+  return resolver;
+}
+
+void CompileCache::storeSchedule(const BackendResolver &resolver,
+                                 const ir::OperationIndexMap<int64_t> *indexed_ranks) const
+{
+  if (!enabled())
+    return;
+
+  Json::Value root{Json::objectValue};
+  auto &json_backends = root["backends"];
+  resolver.iterate([&](const ir::OperationIndex &index, const backend::Backend &backend) {
+    json_backends[std::to_string(index.value())] = backend.config()->id();
+  });
+  if (indexed_ranks)
+  {
+    auto &json_ranks = root["ranks"];
+    for (const auto &pair : *indexed_ranks)
+      json_ranks[std::to_string(pair.first.value())] = Json::Int64{pair.second};
+  }
+
+  std::ostringstream stream;
+  stream << root;
+  if (!util::writeFileAtomically(_file, stream.str()))
+    VERBOSE(CompileCache) << "Failed to write cache file " << _file << std::endl;
+}
+
+} // namespace compiler
+} // namespace onert
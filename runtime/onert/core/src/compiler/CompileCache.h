@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_COMPILE_CACHE_H__
+#define __ONERT_COMPILER_COMPILE_CACHE_H__
+
+#include "compiler/BackendResolver.h"
+#include "compiler/Compiler.h"
+#include "ir/Graph.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Cache of backend assignment kept on disk across sessions
+ *
+ * Scheduling, HEScheduler in particular, is the part of lowering that depends only on the
+ * structure of a graph and the options. The cache keeps its result for each graph in
+ * "<COMPILE_CACHE_DIR>/schedule_<key>.json", where the key is a hash of the operations, the
+ * operand shapes and types, the options and profiling records that affect scheduling, and the
+ * token of the application if any, so that sessions creating the same model with the same
+ * options skip scheduling.
+ */
+class CompileCache
+{
+public:
+  CompileCache(const ir::Graph &graph, const CompilerOptions &options);
+
+public:
+  /**
+   * @brief Return true if the cache is used, which needs a cache directory and no profiling
+   */
+  bool enabled() const { return !_file.empty(); }
+  /**
+   * @brief Load the backend assignment of the graph
+   *
+   * @param[in]  backends Backends available
+   * @param[out] indexed_ranks Ranks of operations given by HEScheduler, nullptr if none
+   * @return Backend assignment, nullptr if it is not cached or needs a backend not available
+   */
+  std::unique_ptr<BackendResolver>
+  loadSchedule(const std::vector<const backend::Backend *> &backends,
+               std::shared_ptr<ir::OperationIndexMap<int64_t>> &indexed_ranks) const;
+  /**
+   * @brief Store the backend assignment of the graph
+   *
+   * @param[in] resolver Backend assignment
+   * @param[in] indexed_ranks Ranks of operations given by HEScheduler, nullptr if none
+   */
+  void storeSchedule(const BackendResolver &resolver,
+                     const ir::OperationIndexMap<int64_t> *indexed_ranks) const;
+
+public:
+  /**
+   * @brief Get the key of a graph compiled with options
+   */
+  static uint64_t key(const ir::Graph &graph, const CompilerOptions &options);
+
+private:
+  const ir::Graph &_graph;
+  std::string _file;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_COMPILE_CACHE_H__
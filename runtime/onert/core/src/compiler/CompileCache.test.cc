@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CompileCache.h"
+
+#include "backend/IConfig.h"
+#include "ir/operation/ElementwiseActivation.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+using namespace onert;
+using namespace onert::backend;
+using namespace onert::ir;
+using namespace onert::compiler;
+
+namespace
+{
+
+struct MockConfig : public IConfig
+{
+  MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  Layout supportLayout(const Operation &, Layout) override { return Layout::UNKNOWN; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+private:
+  std::string _id;
+};
+
+struct MockBackend : public Backend
+{
+  MockBackend(const std::string &id) : _id{id} {}
+  std::shared_ptr<IConfig> config() const override { return std::make_shared<MockConfig>(_id); }
+  std::unique_ptr<BackendContext> newContext(ContextData &&) const override { return nullptr; }
+
+private:
+  std::string _id;
+};
+
+OperationIndex addRelu(Graph &graph, const Shape &shape)
+{
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(shape, type);
+  auto out = graph.addOperand(shape, type);
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  operation::ElementwiseActivation::Param param;
+  param.op_type = operation::ElementwiseActivation::Type::RELU;
+  param.alpha = operation::ElementwiseActivation::infinity;
+  param.beta = 0.f;
+  return graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+    OperandIndexSequence{in}, OperandIndexSequence{out}, param));
+}
+
+CompilerOptions cacheOptions()
+{
+  char dir_template[] = "/tmp/compile_cache_test_XXXXXX";
+  const auto dir = mkdtemp(dir_template);
+  assert(dir);
+
+  CompilerOptions options{};
+  options.backend_list = {"cpu", "gpu"};
+  options.compile_cache_dir = dir;
+  return options;
+}
+
+} // namespace
+
+TEST(CompileCache, store_and_load)
+{
+  MockBackend cpu{"cpu"}, gpu{"gpu"};
+  const std::vector<const Backend *> backends{&cpu, &gpu};
+  auto options = cacheOptions();
+
+  Graph graph;
+  auto relu = addRelu(graph, Shape{1, 4});
+
+  CompileCache cache{graph, options};
+  ASSERT_TRUE(cache.enabled());
+  std::shared_ptr<OperationIndexMap<int64_t>> ranks;
+  ASSERT_EQ(cache.loadSchedule(backends, ranks), nullptr);
+
+  BackendResolver resolver;
+  resolver.setBackend(relu, &gpu);
+  OperationIndexMap<int64_t> stored_ranks{{relu, 42}};
+  cache.storeSchedule(resolver, &stored_ranks);
+
+  // Another session of the same model
+  Graph same_graph;
+  addRelu(same_graph, Shape{1, 4});
+  auto loaded = CompileCache{same_graph, options}.loadSchedule(backends, ranks);
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_EQ(loaded->getBackend(relu), &gpu);
+  ASSERT_NE(ranks, nullptr);
+  ASSERT_EQ(ranks->at(relu), 42);
+}
+
+TEST(CompileCache, token)
+{
+  MockBackend cpu{"cpu"}, gpu{"gpu"};
+  const std::vector<const Backend *> backends{&cpu, &gpu};
+  auto options = cacheOptions();
+  options.compile_cache_token = "0123";
+
+  Graph graph;
+  auto relu = addRelu(graph, Shape{1, 4});
+  BackendResolver resolver;
+  resolver.setBackend(relu, &gpu);
+  CompileCache{graph, options}.storeSchedule(resolver, nullptr);
+
+  // The same token finds the schedule, another token does not
+  std::shared_ptr<OperationIndexMap<int64_t>> ranks;
+  ASSERT_NE(CompileCache(graph, options).loadSchedule(backends, ranks), nullptr);
+  auto other_options = options;
+  other_options.compile_cache_token = "4567";
+  ASSERT_NE(CompileCache::key(graph, options), CompileCache::key(graph, other_options));
+  ASSERT_EQ(CompileCache(graph, other_options).loadSchedule(backends, ranks), nullptr);
+}
+
+TEST(CompileCache, neg_mismatch)
+{
+  MockBackend cpu{"cpu"}, gpu{"gpu"};
+  auto options = cacheOptions();
+
+  Graph graph;
+  auto relu = addRelu(graph, Shape{1, 4});
+  BackendResolver resolver;
+  resolver.setBackend(relu, &gpu);
+  CompileCache{graph, options}.storeSchedule(resolver, nullptr);
+
+  const std::vector<const Backend *> backends{&cpu, &gpu};
+  const std::vector<const Backend *> cpu_only{&cpu};
+  std::shared_ptr<OperationIndexMap<int64_t>> ranks;
+
+  // Different shapes
+  Graph other_graph;
+  addRelu(other_graph, Shape{1, 8});
+  ASSERT_EQ(CompileCache(other_graph, options).loadSchedule(backends, ranks), nullptr);
+
+  // Cached backend not available
+  ASSERT_EQ(CompileCache(graph, options).loadSchedule(cpu_only, ranks), nullptr);
+
+  // Profiling does not use the cache
+  options.he_profiling_mode = true;
+  ASSERT_FALSE(CompileCache(graph, options).enabled());
+}
@@ -18,26 +18,38 @@
 
 #include "ExecutorFactory.h"
 #include "ShapeValidator.h"
+#include "pass/AttentionFusionPass.h"
 #include "pass/ConstantOutputPass.h"
+#include "pass/Fp16ConversionPass.h"
 #include "pass/OddOutputPass.h"
+#include "pass/OperationFusionPass.h"
 #include "pass/PassRunner.h"
 #include "pass/UnusedOperandEliminationPass.h"
 #include "../backend/builtin/Config.h"
 #include "../dumper/dot/DotDumper.h"
+#include "../exec/ThreadPool.h"
 #include "../interp/InterpExecutor.h"
 #include "../ir/OperationCloner.h"
 #include "../ir/OperationDumper.h"
 #include "../ir/verifier/Verifier.h"
 
+#include "backend/basic/SharedArena.h"
+#include "compiler/BackendManager.h"
 #include "compiler/StaticShapeInferer.h"
 #include "util/ConfigSource.h"
+#include "util/CpuAffinity.h"
+#include "util/HeapPhase.h"
 #include "util/logging.h"
 
 #include <misc/string_helpers.h>
 #include <json/json.h>
 
+#include <algorithm>
 // TODO Remove using fstream header
 #include <fstream>
+#include <mutex>
+#include <set>
+#include <unordered_map>
 
 namespace
 {
@@ -78,8 +90,19 @@ void verboseOptions(compiler::CompilerOptions &options)
                     << std::endl;
   VERBOSE(Compiler) << "he_scheduler             : " << options.he_scheduler << std::endl;
   VERBOSE(Compiler) << "he_profiling_mode        : " << options.he_profiling_mode << std::endl;
+  VERBOSE(Compiler) << "he_online_runs           : " << options.he_online_runs << std::endl;
+  VERBOSE(Compiler) << "reschedule_interval      : " << options.reschedule_interval << std::endl;
+  VERBOSE(Compiler) << "reschedule_drift         : " << options.reschedule_drift << std::endl;
   VERBOSE(Compiler) << "disable_compile          : " << options.disable_compile << std::endl;
-  VERBOSE(Compiler) << "fp16_enable              : " << options.fp16_enable << std::endl
+  VERBOSE(Compiler) << "interp_threads           : " << options.interp_threads << std::endl;
+  VERBOSE(Compiler) << "fp16_enable              : " << options.fp16_enable << std::endl;
+  VERBOSE(Compiler) << "compile_threads          : " << options.compile_threads << std::endl;
+  VERBOSE(Compiler) << "compile_cache_dir        : " << options.compile_cache_dir << std::endl;
+  VERBOSE(Compiler) << "compile_cache_token      : " << options.compile_cache_token << std::endl;
+  VERBOSE(Compiler) << "dynamic_shape_cache_size : " << options.dynamic_shape_cache_size
+                    << std::endl;
+  VERBOSE(Compiler) << "weight_prefetch_distance : " << options.weight_prefetch_distance
+                    << std::endl
                     << std::noboolalpha;
 }
 
@@ -107,6 +130,121 @@ void setBackendMap(compiler::ManualSchedulerOptions &ms_options, const ir::Subgr
   }
 }
 
+// Load backends before lowering subgraphs on multiple threads, which only looks them up then
+void loadBackends(const compiler::CompilerOptions &options)
+{
+  auto &backend_manager = compiler::BackendManager::get();
+  for (const auto &backend_str : options.backend_list)
+    backend_manager.loadBackend(backend_str);
+}
+
+class CompileJob : public exec::IFunction
+{
+public:
+  CompileJob(const std::function<void()> &fn) : _fn{fn} {}
+
+public:
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+/**
+ * @brief Threads of Interpreter by CompilerOptions::interp_threads
+ */
+uint32_t interpThreads(const compiler::CompilerOptions &options)
+{
+  if (options.interp_threads < 1)
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  return static_cast<uint32_t>(options.interp_threads);
+}
+
+/**
+ * @brief Call a function for each of the items on up to @c num_threads threads
+ *
+ * Workers reserve static memory in the shared arena group of the calling thread. The first
+ * exception from the function is rethrown on the calling thread after all workers stop.
+ *
+ * @param num_threads Number of threads, less than 1 for all cores
+ */
+template <typename T, typename Fn>
+void parallelForEach(std::vector<T> &items, int32_t num_threads, const Fn &fn)
+{
+  if (num_threads < 1)
+    num_threads = static_cast<int32_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  const auto num_workers = std::min(static_cast<size_t>(num_threads), items.size());
+  if (num_workers <= 1)
+  {
+    for (auto &item : items)
+      fn(item);
+    return;
+  }
+
+  const auto arena = backend::basic::SharedArena::get();
+  const auto arena_group = backend::basic::SharedArena::group();
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  {
+    exec::ThreadPool pool{static_cast<uint32_t>(num_workers)};
+    for (auto &item : items)
+    {
+      pool.enqueue(std::make_unique<CompileJob>([&, item_ptr = &item]() {
+        {
+          std::lock_guard<std::mutex> lock{error_mutex};
+          if (error)
+            return;
+        }
+        try
+        {
+          backend::basic::SharedArena::WorkerScope arena_scope{arena, arena_group};
+          fn(*item_ptr);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock{error_mutex};
+          if (!error)
+            error = std::current_exception();
+        }
+      }));
+    }
+    pool.finish();
+  }
+  if (error)
+    std::rethrow_exception(error);
+}
+
+// Attention made by AttentionFusionPass has a kernel in cpu backend only
+bool fusesAttention(const compiler::CompilerOptions &options)
+{
+  const auto &backends = options.backend_list;
+  return !options.disable_compile && !options.he_scheduler &&
+         std::find(backends.begin(), backends.end(), "cpu") != backends.end();
+}
+
+// Float16 operations made by Fp16ConversionPass have kernels in cpu backend only, so the pass
+// runs only when the manual scheduler puts all the convertible operations on cpu
+bool convertsToFp16(const compiler::CompilerOptions &options)
+{
+  if (!options.fp16_enable || options.disable_compile || options.he_scheduler ||
+      options.backend_list.empty())
+    return false;
+
+  const auto &manual_options = options.manual_scheduler_options;
+  const auto &backend_for_all = manual_options.backend_for_all;
+  if (backend_for_all.empty() ? options.backend_list.front() != "cpu" : backend_for_all != "cpu")
+    return false;
+  if (!manual_options.index_to_backend.empty())
+    return false;
+  for (const auto &opcode : compiler::pass::Fp16ConversionPass::convertibleOpCodes())
+  {
+    auto it = manual_options.opcode_to_backend.find(opcode);
+    if (it != manual_options.opcode_to_backend.end() && it->second != "cpu")
+      return false;
+  }
+  return true;
+}
+
 } // namespace
 
 namespace onert
@@ -124,8 +262,16 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.executor = util::getConfigString(util::config::EXECUTOR);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
+  options.he_online_runs = util::getConfigInt(util::config::PROFILING_ONLINE_RUNS);
+  options.reschedule_interval = util::getConfigInt(util::config::RESCHEDULE_INTERVAL);
+  options.reschedule_drift = util::getConfigInt(util::config::RESCHEDULE_DRIFT);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
+  options.interp_threads = util::getConfigInt(util::config::INTERP_THREADS);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  options.compile_threads = util::getConfigInt(util::config::COMPILE_THREADS);
+  options.compile_cache_dir = util::getConfigString(util::config::COMPILE_CACHE_DIR);
+  options.dynamic_shape_cache_size = util::getConfigInt(util::config::DYNAMIC_SHAPE_CACHE_SIZE);
+  options.weight_prefetch_distance = util::getConfigInt(util::config::WEIGHT_PREFETCH_DISTANCE);
 
   {
     // Backend for all
@@ -162,6 +308,10 @@ Compiler::Compiler(const std::shared_ptr<ir::Subgraphs> &subgs, util::TracingCtx
   _options = fetchCompilerOptionsFromGlobalConfig(*subgs);
 
   _options.tracing_ctx = tracing_ctx;
+  _options.online_profiling = nullptr;
+  _options.drift_monitor = nullptr;
+  _options.run_stats = nullptr;
+  _options.minmax_records = nullptr;
 }
 
 void Compiler::enableToFp16() { _options.fp16_enable = true; }
@@ -343,6 +493,12 @@ bool Compiler::buildPartialGraph(uint32_t num_graphs)
 
 std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
 {
+  util::HeapPhase heap_phase{"compile"};
+  // Memory managers of this session take separate regions in the shared arena
+  backend::basic::SharedArena::GroupScope arena_scope;
+  // Threads that backends start on their contexts, e.g. those of XNNPACK, inherit this affinity
+  util::ScopedCpuAffinity affinity;
+
   // Set control flow backend for control flow operators
   {
     auto &builtin_id = backend::builtin::Config::ID;
@@ -357,9 +513,31 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
   }
 
+  // Attention is fused for cpu backend only, unless it is given a backend explicitly
+  const bool fuse_attention = fusesAttention(_options);
+  if (fuse_attention)
+    _options.manual_scheduler_options.opcode_to_backend.emplace(ir::OpCode::Attention, "cpu");
+
+  // Conversions between float32 and float16 run on cpu with the float16 operations
+  const bool convert_fp16 = convertsToFp16(_options);
+  if (convert_fp16)
+  {
+    auto &opcode_to_backend = _options.manual_scheduler_options.opcode_to_backend;
+    opcode_to_backend.emplace(ir::OpCode::ConvertFp32ToFp16, "cpu");
+    opcode_to_backend.emplace(ir::OpCode::ConvertFp16ToFp32, "cpu");
+  }
+
   verboseOptions(_options);
 
-  _subgraphs->iterate([&](const ir::SubgraphIndex &, ir::Graph &subg) {
+  // Subgraphs are independent until shape inference, so they are processed on multiple threads
+  using Subg = std::pair<ir::SubgraphIndex, ir::Graph *>;
+  std::vector<Subg> subgs;
+  _subgraphs->iterate(
+    [&](const ir::SubgraphIndex &index, ir::Graph &subg) { subgs.emplace_back(index, &subg); });
+
+  parallelForEach(subgs, _options.compile_threads, [&](Subg &pair) {
+    auto &subg = *pair.second;
+
     // Mandatory passes
     pass::PassRunner{}
       .append(std::make_unique<pass::ConstantOutputPass>(subg))
@@ -367,7 +545,13 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
       .run();
 
     // Optimizations
-    pass::PassRunner{}.append(std::make_unique<pass::UnusedOperandEliminationPass>(subg)).run();
+    pass::PassRunner runner;
+    runner.append(std::make_unique<pass::OperationFusionPass>(subg));
+    if (fuse_attention)
+      runner.append(std::make_unique<pass::AttentionFusionPass>(subg));
+    if (convert_fp16)
+      runner.append(std::make_unique<pass::Fp16ConversionPass>(subg));
+    runner.append(std::make_unique<pass::UnusedOperandEliminationPass>(subg)).run();
   });
 
   /***************************************************
@@ -380,8 +564,9 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   //       execution between interpreter and compiled executor (including control flow)
   if (_options.disable_compile)
   {
+    const auto interp_threads = interpThreads(_options);
     _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
-      executors->emplace(index, std::make_unique<interp::InterpExecutor>(subg));
+      executors->emplace(index, std::make_unique<interp::InterpExecutor>(subg, interp_threads));
     });
     _state = State::COMPILED;
     return executors;
@@ -390,6 +575,11 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   // Mode check
   if (_options.he_profiling_mode)
     checkProfilerConditions();
+  if (_options.online_profiling)
+  {
+    checkProfilerConditions();
+    _options.online_profiling->startRound();
+  }
 
   /***************************************************
    * Backend independent analysis & optimization phase
@@ -398,12 +588,18 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
 
   // Lower: Assign backend
   std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>> lowered_subgs;
-  _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
+  // Make the entries beforehand so that workers do not modify the map
+  for (const auto &pair : subgs)
+    lowered_subgs[pair.first] = nullptr;
+  loadBackends(_options);
+  parallelForEach(subgs, _options.compile_threads, [&](Subg &pair) {
+    const auto &index = pair.first;
+    auto &subg = *pair.second;
     onert::dumper::dot::DotDumper dot_dumper(subg, dump_level);
     dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
 
     // Lower: Assign backend
-    lowered_subgs[index] = std::make_unique<compiler::LoweredGraph>(subg, _options);
+    lowered_subgs.at(index) = std::make_unique<compiler::LoweredGraph>(subg, _options);
 
     subg.setSubgraphs(nullptr);
   });
@@ -419,6 +615,8 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   }
 
   // Shape inference.
+  // NOTE Subgraphs of If and While are inferred with the shapes of their callers, so it starts
+  //      from the primary subgraph and cannot be split among threads
   {
     const auto primary_subg_idx = ir::SubgraphIndex{0};
     StaticShapeInferer inferer(primary_subg_idx, lowered_subgs);
@@ -440,19 +638,22 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   //      - Check parameter value validation which valid value is depend on input tensor shape
   //      - Output tensor shape validation check is needless because
   //        static/dynamic shape inferer will make valid output shape
+  using LoweredSubg = std::pair<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>>;
+  std::vector<LoweredSubg> lowered_subg_list;
   for (auto &pair : lowered_subgs)
-  {
-    auto &lowered_subg = pair.second;
-    compiler::ShapeValidator{lowered_subg->graph()}();
-  }
+    lowered_subg_list.emplace_back(pair.first, std::move(pair.second));
+
+  parallelForEach(lowered_subg_list, _options.compile_threads, [&](LoweredSubg &pair) {
+    compiler::ShapeValidator{pair.second->graph()}();
+  });
 
   /*************************************************************
    *  Backend independent analysis & optimization phase finished
    *************************************************************/
 
   executors = std::make_shared<exec::ExecutorMap>();
-  for (auto &pair : lowered_subgs)
-  {
+  std::mutex executors_mutex;
+  parallelForEach(lowered_subg_list, _options.compile_threads, [&](LoweredSubg &pair) {
     const auto &subg_index = pair.first;
     auto &lowered_subg = pair.second;
     auto indexed_ranks = lowered_subg->indexed_ranks();
@@ -464,8 +665,10 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     auto executor = std::unique_ptr<exec::IExecutor>{
       ExecutorFactory::get().create(std::move(lowered_subg), _options, executors)};
     executor->setIndexedRanks(indexed_ranks);
+
+    std::lock_guard<std::mutex> lock{executors_mutex};
     executors->insert(std::make_pair(subg_index, std::move(executor)));
-  }
+  });
 
   /********************************
    * Code generation phase finished
@@ -477,9 +680,6 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
 std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *package_file_path,
                                                                   const char *map_file_path)
 {
-  std::vector<std::shared_ptr<exec::ExecutorMap>> executors;
-  auto executor_map = std::make_shared<exec::ExecutorMap>();
-
   std::string package_path(package_file_path);
   std::string partition_map_file;
 
@@ -514,6 +714,66 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
     throw std::runtime_error("There is no partition map file");
   }
 
+  return compilePartialGraphs(num_graphs);
+}
+
+std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compileStreaming()
+{
+  return compilePartialGraphs(partitionByBackend());
+}
+
+uint32_t Compiler::partitionByBackend()
+{
+  const auto &graph = *primary_subgraph();
+  const auto &ms_options = _options.manual_scheduler_options;
+  auto offloaded = [&](const ir::OperationIndex &index) {
+    const auto &operation = graph.operations().at(index);
+    if (operation.opcode() == ir::OpCode::Bulk)
+      return true;
+    auto it = ms_options.index_to_backend.find(index);
+    return it != ms_options.index_to_backend.end() && it->second == "trix";
+  };
+
+  // Stages of the host are even and stages of the accelerator are odd. An operation takes the
+  // first stage of its kind not before the stages of its producers, so stages only feed later ones.
+  std::unordered_map<ir::OperationIndex, uint32_t> stages;
+  std::set<uint32_t> used_stages;
+  for (const auto &index : graph.topolSortOperations())
+  {
+    uint32_t stage = 0;
+    for (const auto &input : graph.operations().at(index).getInputs() | ir::Remove::UNDEFINED)
+    {
+      const auto &def = graph.operands().at(input).getDef();
+      if (def.valid())
+        stage = std::max(stage, stages.at(def));
+    }
+    if ((stage % 2 == 1) != offloaded(index))
+      ++stage;
+    stages[index] = stage;
+    used_stages.insert(stage);
+  }
+
+  // Renumber stages without gaps
+  std::unordered_map<uint32_t, uint32_t> partitions;
+  for (auto stage : used_stages)
+    partitions.emplace(stage, static_cast<uint32_t>(partitions.size()));
+  auto &index_to_graph = _options.partial_graph_options.index_to_graph;
+  for (const auto &entry : stages)
+    index_to_graph[entry.first] = ir::SubgraphIndex{partitions.at(entry.second)};
+
+  VERBOSE(Compiler) << "Partitioned into " << partitions.size() << " stages by backend"
+                    << std::endl;
+  return std::max(static_cast<uint32_t>(partitions.size()), 1u);
+}
+
+std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compilePartialGraphs(uint32_t num_graphs)
+{
+  // Memory managers of this session take separate regions in the shared arena
+  backend::basic::SharedArena::GroupScope arena_scope;
+
+  std::vector<std::shared_ptr<exec::ExecutorMap>> executors;
+  auto executor_map = std::make_shared<exec::ExecutorMap>();
+
   if (!buildPartialGraph(num_graphs))
   {
     throw std::runtime_error("It doesn't support in case there are subgraphs");
@@ -533,6 +793,20 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
     _options.manual_scheduler_options.opcode_to_backend[ir::OpCode::BCQGather] = "bcq";
   }
 
+  // Attention is fused for cpu backend only, unless it is given a backend explicitly
+  const bool fuse_attention = fusesAttention(_options);
+  if (fuse_attention)
+    _options.manual_scheduler_options.opcode_to_backend.emplace(ir::OpCode::Attention, "cpu");
+
+  // Conversions between float32 and float16 run on cpu with the float16 operations
+  const bool convert_fp16 = convertsToFp16(_options);
+  if (convert_fp16)
+  {
+    auto &opcode_to_backend = _options.manual_scheduler_options.opcode_to_backend;
+    opcode_to_backend.emplace(ir::OpCode::ConvertFp32ToFp16, "cpu");
+    opcode_to_backend.emplace(ir::OpCode::ConvertFp16ToFp32, "cpu");
+  }
+
   // It doesn't support tracing in case of partial graph
   {
     _options.tracing_ctx = nullptr;
@@ -540,22 +814,40 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
 
   verboseOptions(_options);
 
+  // Partial graphs are independent, so they are processed on multiple threads
+  struct PartialGraph
+  {
+    ir::SubgraphIndex index;
+    ir::Graph *parent;
+    ir::Graph *graph;
+  };
+  std::vector<PartialGraph> partialgraphs;
   _subgraphs->iterate([&](const ir::SubgraphIndex &, ir::Graph &subg) {
-    // Mandatory passes
     auto part = subg.partialgraphs();
-    part->iterate([&](const ir::SubgraphIndex &, ir::Graph &partialgraph) {
-      pass::PassRunner{}
-        .append(std::make_unique<pass::ConstantOutputPass>(partialgraph))
-        .append(std::make_unique<pass::OddOutputPass>(partialgraph))
-        .run();
-
-      // Optimizations
-      pass::PassRunner{}
-        .append(std::make_unique<pass::UnusedOperandEliminationPass>(partialgraph))
-        .run();
+    part->iterate([&](const ir::SubgraphIndex &pindex, ir::Graph &partialgraph) {
+      partialgraphs.push_back({pindex, &subg, &partialgraph});
     });
   });
 
+  parallelForEach(partialgraphs, _options.compile_threads, [&](PartialGraph &part) {
+    auto &partialgraph = *part.graph;
+
+    // Mandatory passes
+    pass::PassRunner{}
+      .append(std::make_unique<pass::ConstantOutputPass>(partialgraph))
+      .append(std::make_unique<pass::OddOutputPass>(partialgraph))
+      .run();
+
+    // Optimizations
+    pass::PassRunner runner;
+    runner.append(std::make_unique<pass::OperationFusionPass>(partialgraph));
+    if (fuse_attention)
+      runner.append(std::make_unique<pass::AttentionFusionPass>(partialgraph));
+    if (convert_fp16)
+      runner.append(std::make_unique<pass::Fp16ConversionPass>(partialgraph));
+    runner.append(std::make_unique<pass::UnusedOperandEliminationPass>(partialgraph)).run();
+  });
+
   /***************************************************
    * Prepare compilation phase
    ***************************************************/
@@ -565,8 +857,10 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
   //       execution between interpreter and compiled executor (including control flow)
   if (_options.disable_compile)
   {
+    const auto interp_threads = interpThreads(_options);
     _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
-      executor_map->emplace(index, std::make_unique<interp::InterpExecutor>(subg));
+      executor_map->emplace(index,
+                            std::make_unique<interp::InterpExecutor>(subg, interp_threads));
       executors.push_back(executor_map);
     });
     _state = State::COMPILED;
@@ -585,17 +879,20 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
   // Lower: Assign backend
   std::unordered_map<ir::SubgraphIndex, std::unique_ptr<compiler::LoweredGraph>>
     lowered_partialgraphs;
-  _subgraphs->iterate([&](const ir::SubgraphIndex &, ir::Graph &subg) {
-    auto part = subg.partialgraphs();
-    part->iterate([&](const ir::SubgraphIndex &pindex, ir::Graph &partialgraph) {
-      onert::dumper::dot::DotDumper dot_dumper_part(partialgraph, dump_level);
-      dot_dumper_part.dump(nnfw::misc::str("before_lower_subg_partialgraph-", pindex.value()));
-
-      // // Lower: Assign backend
-      lowered_partialgraphs[pindex] =
-        std::make_unique<compiler::LoweredGraph>(subg, partialgraph, _options);
-      partialgraph.setSubgraphs(nullptr);
-    });
+  // Make the entries beforehand so that workers do not modify the map
+  for (const auto &part : partialgraphs)
+    lowered_partialgraphs[part.index] = nullptr;
+  loadBackends(_options);
+  parallelForEach(partialgraphs, _options.compile_threads, [&](PartialGraph &part) {
+    const auto &pindex = part.index;
+    auto &partialgraph = *part.graph;
+    onert::dumper::dot::DotDumper dot_dumper_part(partialgraph, dump_level);
+    dot_dumper_part.dump(nnfw::misc::str("before_lower_subg_partialgraph-", pindex.value()));
+
+    // // Lower: Assign backend
+    lowered_partialgraphs.at(pindex) =
+      std::make_unique<compiler::LoweredGraph>(*part.parent, partialgraph, _options);
+    partialgraph.setSubgraphs(nullptr);
   });
 
   for (auto &pair : lowered_partialgraphs)
@@ -609,10 +906,10 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
   }
 
   // Partial Graph shape inference
-  for (auto &pair : lowered_partialgraphs)
-  {
-    const auto &partialgraph_index = pair.first;
-    auto &lowered_partialgraph = pair.second;
+  // NOTE Partial graphs do not have control flow operations, so each of them is inferred alone
+  parallelForEach(partialgraphs, _options.compile_threads, [&](PartialGraph &part) {
+    const auto &partialgraph_index = part.index;
+    auto &lowered_partialgraph = lowered_partialgraphs.at(partialgraph_index);
     StaticShapeInferer partial_inferer(partialgraph_index, lowered_partialgraphs);
     auto ordered_ops = lowered_partialgraph->graph().topolSortOperations();
     for (auto op_ind : ordered_ops)
@@ -622,7 +919,7 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
       lowered_partialgraph->setHasDynamicTensor(op_ind, has_dynamic_tensor);
     }
     partial_inferer.dump();
-  }
+  });
 
   // Shape validation
   // TODO Move shape independent feature check from ShapeValidator to OperationValidator
@@ -631,11 +928,9 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
   //      - Check parameter value validation which valid value is depend on input tensor shape
   //      - Output tensor shape validation check is needless because
   //        static/dynamic shape inferer will make valid output shape
-  for (auto &pair : lowered_partialgraphs)
-  {
-    auto &lowered_partialgraph = pair.second;
-    compiler::ShapeValidator{lowered_partialgraph->graph()}();
-  }
+  parallelForEach(partialgraphs, _options.compile_threads, [&](PartialGraph &part) {
+    compiler::ShapeValidator{lowered_partialgraphs.at(part.index)->graph()}();
+  });
 
   /*************************************************************
    *  Backend independent analysis & optimization phase finished
@@ -649,22 +944,28 @@ std::vector<std::shared_ptr<exec::ExecutorMap>> Compiler::compile(const char *pa
     ordered.insert(make_pair(pair.first.value(), std::move(lowered_partialgraph)));
   }
 
+  // Executors are kept in the order of partial graph indices
+  using LoweredPart = std::pair<const uint32_t, std::unique_ptr<compiler::LoweredGraph>> *;
+  std::vector<LoweredPart> lowered_parts;
   for (auto &pair : ordered)
-  {
-    executor_map = std::make_shared<exec::ExecutorMap>();
-    const auto &partialgraph_index = ir::SubgraphIndex(pair.first);
-    auto &lowered_partialgraph = pair.second;
+    lowered_parts.push_back(&pair);
+  executors.resize(lowered_parts.size());
+
+  parallelForEach(lowered_parts, _options.compile_threads, [&](LoweredPart &pair) {
+    auto part_executor_map = std::make_shared<exec::ExecutorMap>();
+    const auto &partialgraph_index = ir::SubgraphIndex(pair->first);
+    auto &lowered_partialgraph = pair->second;
     auto indexed_ranks = lowered_partialgraph->indexed_ranks();
     ir::OperationDumper dumper("Executor generation of Subgraph " +
                                std::to_string(partialgraph_index.value()));
     lowered_partialgraph->graph().operations().iterate(
       [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
     auto executor = std::unique_ptr<exec::IExecutor>{
-      ExecutorFactory::get().create(std::move(lowered_partialgraph), _options, executor_map)};
+      ExecutorFactory::get().create(std::move(lowered_partialgraph), _options, part_executor_map)};
     executor->setIndexedRanks(indexed_ranks);
-    executor_map->insert(std::make_pair(ir::SubgraphIndex{0}, std::move(executor)));
-    executors.push_back(executor_map);
-  }
+    part_executor_map->insert(std::make_pair(ir::SubgraphIndex{0}, std::move(executor)));
+    executors.at(&pair - lowered_parts.data()) = part_executor_map;
+  });
 
   _subgraphs.reset();
   /********************************
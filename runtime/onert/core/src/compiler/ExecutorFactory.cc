@@ -22,15 +22,18 @@
 #include "../backend/builtin/UserTensor.h"
 #include "../dumper/text/GraphDumper.h"
 #include "../exec/DataflowExecutor.h"
+#include "../exec/DynamicShapeCache.h"
 #include "../exec/ExecTime.h"
 #include "../exec/ExecutionObservers.h"
 #include "../exec/LinearExecutor.h"
 #include "../exec/ParallelExecutor.h"
+#include "../exec/WeightPrefetcher.h"
 #include "../ir/OperationCloner.h"
 
 #include <backend/IPortableTensor.h>
 #include <compiler/BackendManager.h>
 #include <compiler/ExecutionBuilder.h>
+#include <util/HeapPhase.h>
 #include <util/TracingCtx.h>
 
 #include <functional>
@@ -67,6 +70,61 @@ private:
 
 using DeallocList = std::vector<backend::ITensor *>;
 // Deallocation after execution of an operation used by Linear Executor
+/**
+ * @brief Create the cache of dynamic shapes of an executor, nullptr if it is disabled
+ */
+std::unique_ptr<exec::DynamicShapeCache>
+createDynamicShapeCache(const compiler::LoweredGraph &lowered_graph,
+                        const compiler::TensorRegistries &tensor_regs,
+                        const compiler::CompilerOptions &options)
+{
+  if (options.dynamic_shape_cache_size <= 0)
+    return nullptr;
+
+  auto cache = std::make_unique<exec::DynamicShapeCache>(options.dynamic_shape_cache_size);
+  lowered_graph.graph().operations().iterate(
+    [&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+      std::vector<backend::ITensor *> outputs;
+      for (const auto &ind : op.getOutputs() | ir::Remove::UNDEFINED)
+        outputs.emplace_back(tensor_regs.getITensor(ind));
+      cache->addOperation(op_ind, op.opcode(), std::move(outputs));
+    });
+  return cache;
+}
+
+/**
+ * @brief Create the prefetcher of constants of operations in execution order if enabled
+ *
+ * @note Buffers of constants are taken after kernels are generated, as backends may copy them
+ */
+std::unique_ptr<exec::WeightPrefetcher>
+createWeightPrefetcher(const compiler::LoweredGraph &lowered_graph,
+                       const compiler::TensorRegistries &tensor_regs,
+                       const std::vector<ir::OperationIndex> &order,
+                       const compiler::CompilerOptions &options)
+{
+  if (options.weight_prefetch_distance <= 0)
+    return nullptr;
+
+  const auto &graph = lowered_graph.graph();
+  auto prefetcher = std::make_unique<exec::WeightPrefetcher>(options.weight_prefetch_distance);
+  for (const auto &op_ind : order)
+  {
+    std::vector<std::pair<const uint8_t *, size_t>> weights;
+    const auto &op = graph.operations().at(op_ind);
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    {
+      if (!graph.operands().at(ind).isConstant())
+        continue;
+      const auto tensor = tensor_regs.getITensor(ind);
+      if (tensor)
+        weights.emplace_back(tensor->buffer(), tensor->total_size());
+    }
+    prefetcher->addOperation(weights);
+  }
+  return prefetcher;
+}
+
 class DeallocFunction final : public exec::IFunction
 {
 public:
@@ -195,7 +253,8 @@ backend::BackendContexts createBackendContexts(compiler::LoweredGraph &lgraph, b
     });
 
   // Create contexts
-  auto whole_op_order = lgraph.graph().topolSortOperations();
+  // NOTE Tensors are planned in the same order as LinearExecutor executes operations
+  auto whole_op_order = compiler::Linear::linearize(lgraph);
   for (auto &pair : context_data_map)
   {
     auto backend = pair.first;
@@ -339,6 +398,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
 
   for (auto &pair : backend_contexts)
   {
+    util::HeapPhase phase{pair.first->config()->id() + "/tensors"};
     pair.second->genTensors();
   }
 
@@ -405,10 +465,15 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
                   [](std::pair<const ir::OperandIndex, uint32_t> it) { return it.second == 0; }));
   }
 
+  auto shape_cache = createDynamicShapeCache(*lowered_graph, tensor_regs, options);
+
   // Generate kernels
   for (auto &pair : ordered_contexts)
   {
-    auto codes = pair.second->genKernels();
+    auto codes = [&]() {
+      util::HeapPhase phase{pair.first->config()->id() + "/kernels"};
+      return pair.second->genKernels();
+    }();
     for (auto &pair : codes)
     {
       auto &op_ind = pair.first;
@@ -419,16 +484,54 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
         fn_seq->wrap<SyncFunction>(lower_info->backend()->config());
       if (!dealloc_list_map[op_ind].empty())
         fn_seq->append(std::make_unique<DeallocFunction>(dealloc_list_map[op_ind]));
+      if (shape_cache && fn_seq->dynamic_tensor_ctx())
+        fn_seq->dynamic_tensor_ctx()->shape_cache = shape_cache.get();
       builder.append(op_ind, {op_ind, &op, lower_info, std::move(fn_seq)});
     }
   }
 
   auto code_map = builder.releaseCodeMap();
 
+  std::unique_ptr<exec::IExecutionObserver> run_stats_obs;
+  if (options.run_stats)
+  {
+    run_stats_obs = std::make_unique<exec::RunStatsObserver>(options.run_stats, *lowered_graph,
+                                                             backend_contexts);
+  }
+
+  std::unique_ptr<exec::IExecutionObserver> minmax_obs;
+  if (options.minmax_records)
+  {
+    minmax_obs =
+      std::make_unique<exec::MinMaxObserver>(options.minmax_records, *lowered_graph, tensor_regs);
+  }
+
+  std::unique_ptr<exec::IExecutionObserver> drift_obs;
+  if (options.drift_monitor && !options.he_profiling_mode)
+  {
+    std::vector<const backend::Backend *> backends;
+    for (const auto &pair : backend_contexts)
+      backends.push_back(pair.first);
+    drift_obs = std::make_unique<exec::DriftObserver>(
+      options.drift_monitor, std::make_shared<exec::ExecTime>(backends), *lowered_graph);
+  }
+
+  auto prefetcher = createWeightPrefetcher(*lowered_graph, tensor_regs, order, options);
+
   auto exec = new exec::LinearExecutor{
     std::move(lowered_graph), std::move(backend_contexts), tensor_regs, std::move(code_map), order,
     options.tracing_ctx};
 
+  exec->setDynamicShapeCache(std::move(shape_cache));
+  if (prefetcher)
+    exec->setWeightPrefetcher(std::move(prefetcher));
+  if (drift_obs)
+    exec->addObserver(std::move(drift_obs));
+  if (run_stats_obs)
+    exec->addObserver(std::move(run_stats_obs));
+  if (minmax_obs)
+    exec->addObserver(std::move(minmax_obs));
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::TracingObserver>(
@@ -455,6 +558,7 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
 
   for (auto &pair : backend_contexts)
   {
+    util::HeapPhase phase{pair.first->config()->id() + "/tensors"};
     pair.second->genTensors();
   }
 
@@ -465,27 +569,81 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
 
   ExecutionBuilder builder;
 
+  // Production runs are profiled as well while online profiling is in progress
+  const bool profiling = options.he_profiling_mode || options.online_profiling != nullptr;
+  std::vector<const backend::Backend *> backends;
+  for (const auto &pair : backend_contexts)
+  {
+    backends.push_back(pair.first);
+  }
+
+  // Source and destination backends of Permute operations to calibrate transfer cost
+  ir::OperationIndexMap<exec::ProfileObserver::BackendPair> permute_backends;
+  if (profiling)
+  {
+    const auto &operand_li = lowered_graph->lower_info().operand;
+    lowered_graph->graph().operations().iterate(
+      [&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+        if (op.opcode() != ir::OpCode::Permute)
+          return;
+        const auto &in_factors = operand_li.at(op.getInputs().at(0)).def_factors();
+        const auto &out_factors = operand_li.at(op.getOutputs().at(0)).def_factors();
+        permute_backends.emplace(op_ind, exec::ProfileObserver::BackendPair{
+                                           in_factors.getOnlyElement().backend(),
+                                           out_factors.getOnlyElement().backend()});
+      });
+  }
+
   // Adjust the order of backends for the upcoming iteration
   auto ordered_contexts = orderBackendContext(backend_contexts);
 
+  auto shape_cache = createDynamicShapeCache(*lowered_graph, tensor_regs, options);
+
   // Generate kernels
   for (auto &pair : ordered_contexts)
   {
-    auto codes = pair.second->genKernels();
+    auto codes = [&]() {
+      util::HeapPhase phase{pair.first->config()->id() + "/kernels"};
+      return pair.second->genKernels();
+    }();
     for (auto &pair : codes)
     {
       auto &op_ind = pair.first;
       auto &fn_seq = pair.second;
       auto &op = lowered_graph->graph().operations().at(op_ind);
       auto lower_info = lowered_graph->lower_info().operation.getRawPtr(op_ind);
-      if (options.he_profiling_mode)
+      if (profiling)
         fn_seq->wrap<SyncFunction>(lower_info->backend()->config());
+      if (shape_cache && fn_seq->dynamic_tensor_ctx())
+        fn_seq->dynamic_tensor_ctx()->shape_cache = shape_cache.get();
       builder.append(op_ind, {op_ind, &op, lower_info, std::move(fn_seq)});
     }
   }
 
   auto code_map = builder.releaseCodeMap();
 
+  std::unique_ptr<exec::IExecutionObserver> run_stats_obs;
+  if (options.run_stats)
+  {
+    run_stats_obs = std::make_unique<exec::RunStatsObserver>(options.run_stats, *lowered_graph,
+                                                             backend_contexts);
+  }
+
+  std::unique_ptr<exec::IExecutionObserver> minmax_obs;
+  if (options.minmax_records)
+  {
+    minmax_obs =
+      std::make_unique<exec::MinMaxObserver>(options.minmax_records, *lowered_graph, tensor_regs);
+  }
+
+  // Runs profiled by ProfileObserver already record exec times
+  std::unique_ptr<exec::IExecutionObserver> drift_obs;
+  if (options.drift_monitor && !profiling)
+  {
+    drift_obs = std::make_unique<exec::DriftObserver>(
+      options.drift_monitor, std::make_shared<exec::ExecTime>(backends), *lowered_graph);
+  }
+
   exec::ExecutorBase *exec = nullptr;
   if (parallel)
   {
@@ -497,21 +655,26 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     auto dataflow_exec =
       new exec::DataflowExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
                                  std::move(code_map), options.tracing_ctx};
-    if (options.he_profiling_mode)
+    if (profiling)
     {
-      std::vector<const backend::Backend *> backends;
-      for (const auto &pair : backend_contexts)
-      {
-        backends.push_back(pair.first);
-      }
       auto et = std::make_shared<exec::ExecTime>(backends);
-      std::unique_ptr<exec::IExecutionObserver> obs =
-        std::make_unique<exec::ProfileObserver>(et, dataflow_exec->graph());
+      auto obs = std::make_unique<exec::ProfileObserver>(et, dataflow_exec->graph(),
+                                                         options.online_profiling);
+      obs->enableTransferCalibration(std::make_shared<exec::TransferCost>(backends),
+                                     std::move(permute_backends));
       dataflow_exec->addObserver(std::move(obs));
     }
     exec = dataflow_exec;
   }
 
+  exec->setDynamicShapeCache(std::move(shape_cache));
+  if (drift_obs)
+    exec->addObserver(std::move(drift_obs));
+  if (run_stats_obs)
+    exec->addObserver(std::move(run_stats_obs));
+  if (minmax_obs)
+    exec->addObserver(std::move(minmax_obs));
+
   if (!options.trace_filepath.empty())
   {
     std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::TracingObserver>(
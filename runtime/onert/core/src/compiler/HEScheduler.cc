@@ -247,21 +247,25 @@ int64_t HEScheduler::getOpTime(const backend::Backend *backend, const std::strin
 int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
                                     const backend::Backend *dst_backend, bool quant, uint32_t size)
 {
-  // TODO Change it to getOperationExecTime()
-  const auto time = _exec_time->getPermuteTime(src_backend, dst_backend, quant, size);
-
-  if (time != _exec_time->NOT_FOUND)
+  const auto time = _transfer_cost->getTransferTime(src_backend, dst_backend, size);
+  if (time != _transfer_cost->NOT_FOUND)
     return time;
 
-  // FIXME permute time is not recorded so the control reaches here always
+  // Fall back to the permute times recorded for the sizes if the pair is not calibrated
+  // NOTE Permute records have the size of the input and the output
+  // TODO Change it to getOperationExecTime()
+  const auto recorded_time = _exec_time->getPermuteTime(src_backend, dst_backend, quant, size * 2);
+  if (recorded_time != _exec_time->NOT_FOUND)
+    return recorded_time;
+
   // Makes the scheduler prefer keeping computations on one backend
-  return size / 400;
+  return size / 200;
 }
 
 int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backend *backend)
 {
   // if there is no profiling info don't use this backend during scheduling
-  if (!_is_profiling_mode)
+  if (!_is_profiling_mode && _online_profiling == nullptr)
   {
     VERBOSE(HEScheduler::tryBackend)
       << "Trying to HE schedule while there is no profiling info for " << node.name()
@@ -279,6 +283,8 @@ int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backen
       return _is_supported[backend][node.name()] ? 1 : _exec_time->getMax();
     }
   }
+  if (_online_profiling)
+    _online_profiling->markExploring();
   try
   {
     // DO NOTHING
@@ -582,9 +588,8 @@ int64_t HEScheduler::predMaxEFT(const backend::Backend *backend, const ir::Opera
       max_pred_eft = std::max(max_pred_eft, _ops_eft.at(input_node_idx));
       if (parent_backend != backend)
       {
-        // Multiply operand size by 2 because size must describe input+output size
         int64_t transfer_cost =
-          getPermuteTime(parent_backend, backend, quant, input_operand.info().total_size() * 2);
+          getPermuteTime(parent_backend, backend, quant, input_operand.info().total_size());
         transfer_st_exec_time.emplace(_ops_eft.at(input_node_idx), transfer_cost);
       }
     }
@@ -26,6 +26,7 @@
 #include "IScheduler.h"
 #include "../backend/builtin/Config.h"
 #include "../exec/ExecTime.h"
+#include "../exec/TransferCost.h"
 
 #include <backend/Backend.h>
 #include <compiler/BackendManager.h>
@@ -55,7 +56,8 @@ public:
   HEScheduler(const std::vector<const backend::Backend *> &backends, const CompilerOptions &options)
     : _is_supported{}, _backends_avail_time{}, _ops_eft{},
       _op_to_rank{std::make_shared<ir::OperationIndexMap<int64_t>>()},
-      _is_profiling_mode{options.he_profiling_mode}, _is_linear_exec{options.executor == "Linear"},
+      _is_profiling_mode{options.he_profiling_mode}, _online_profiling{options.online_profiling},
+      _is_linear_exec{options.executor == "Linear"},
       _is_parallel_exec{options.executor == "Parallel"}
   {
     for (auto entry : backends)
@@ -66,6 +68,7 @@ public:
     }
     _backend_resolver = std::make_unique<compiler::BackendResolver>();
     _exec_time = std::make_unique<exec::ExecTime>(_all_backends);
+    _transfer_cost = std::make_unique<exec::TransferCost>(_all_backends);
 
     // Find cpu backend
     auto cpu_backend_it =
@@ -141,6 +144,11 @@ private:
   int64_t getOpTime(const backend::Backend *backend, const std::string &operation, bool quant,
                     uint32_t size);
 
+  /**
+   * @brief   Get the time to transfer a tensor between backends
+   *
+   * @param[in] size size of the tensor in bytes
+   */
   int64_t getPermuteTime(const backend::Backend *src_backend, const backend::Backend *dst_backend,
                          bool quant, uint32_t size);
 
@@ -173,10 +181,13 @@ private:
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _op_to_rank;
   std::unique_ptr<compiler::BackendResolver> _backend_resolver;
   std::unique_ptr<exec::ExecTime> _exec_time;
+  std::unique_ptr<exec::TransferCost> _transfer_cost;
   const ir::Graph *_graph{nullptr};
   std::vector<const backend::Backend *> _all_backends;
   const backend::Backend *_cpu_backend{nullptr}; // TODO Change this to _builtin_backend
   bool _is_profiling_mode;
+  // Production runs profile backends without exec time records if not nullptr
+  exec::OnlineProfiling *_online_profiling;
   bool _is_linear_exec;
   bool _is_parallel_exec;
 };
@@ -20,6 +20,9 @@
 
 #include "util/logging.h"
 
+#include <algorithm>
+#include <cassert>
+#include <iterator>
 #include <sstream>
 
 namespace onert
@@ -30,7 +33,120 @@ namespace compiler
 // TODO(easy) Change the LoweredGraph param to Graph
 std::vector<ir::OperationIndex> Linear::linearize(const compiler::LoweredGraph &lowered_graph)
 {
-  return lowered_graph.graph().topolSortOperations();
+  const auto &graph = lowered_graph.graph();
+
+  // Topological order is used to break ties, so the order is kept when memory does not differ
+  const auto topol_order = graph.topolSortOperations();
+  ir::OperationIndexMap<size_t> topol_rank;
+  for (size_t i = 0; i < topol_order.size(); ++i)
+    topol_rank[topol_order[i]] = i;
+
+  // Order planned ahead goes before the greedy one. Operations not in the plan, like the ones
+  // inserted by lowering, run as soon as they are ready.
+  ir::OperationIndexMap<size_t> planned_rank;
+  const auto &planned_order = graph.plannedOrder();
+  for (size_t i = 0; i < planned_order.size(); ++i)
+    planned_rank[planned_order[i]] = i + 1;
+  auto rank_in_plan = [&](const ir::OperationIndex &ind) -> size_t {
+    auto it = planned_rank.find(ind);
+    return it == planned_rank.end() ? 0 : it->second;
+  };
+
+  auto model_io =
+    (graph.getInputs() + graph.getOutputs()) | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED;
+
+  // Size of an operand allocated and deallocated while executing, or 0 for others
+  auto planned_size = [&](const ir::OperandIndex &ind) -> int64_t {
+    const auto &operand = graph.operands().at(ind);
+    const auto &info = operand.info();
+    if (operand.isConstant() || info.isVariable() || info.isDynamic() || model_io.contains(ind))
+      return 0;
+    return static_cast<int64_t>(info.total_size());
+  };
+
+  ir::OperandIndexMap<uint32_t> remaining_uses;
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+    remaining_uses[ind] = operand.getUses().size();
+  });
+
+  ir::OperationIndexMap<uint32_t> pending_inputs;
+  std::vector<ir::OperationIndex> ready;
+  for (const auto &op_ind : topol_order)
+  {
+    const auto &op = graph.operations().at(op_ind);
+    uint32_t count = 0;
+    for (const auto &ind : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (graph.operands().at(ind).getDef().valid())
+        count++;
+    }
+    pending_inputs[op_ind] = count;
+    if (count == 0)
+      ready.push_back(op_ind);
+  }
+
+  // Change of live memory if an operation is executed now
+  auto memory_delta = [&](const ir::OperationIndex &op_ind) -> int64_t {
+    const auto &op = graph.operations().at(op_ind);
+    int64_t delta = 0;
+    for (const auto &ind : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      delta += planned_size(ind);
+    for (const auto &ind : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      if (remaining_uses.at(ind) == 1)
+        delta -= planned_size(ind);
+    }
+    return delta;
+  };
+
+  // Greedy list scheduling which executes the ready operation increasing live memory the least,
+  // so that a branch is finished and its tensors are freed before another branch starts
+  std::vector<ir::OperationIndex> order;
+  order.reserve(topol_order.size());
+  while (!ready.empty())
+  {
+    auto best = ready.begin();
+    if (!planned_rank.empty())
+    {
+      best = std::min_element(ready.begin(), ready.end(),
+                              [&](const ir::OperationIndex &lhs, const ir::OperationIndex &rhs) {
+                                return rank_in_plan(lhs) < rank_in_plan(rhs);
+                              });
+    }
+    else
+    {
+      auto best_delta = memory_delta(*best);
+      for (auto it = std::next(ready.begin()); it != ready.end(); ++it)
+      {
+        const auto delta = memory_delta(*it);
+        if (delta < best_delta ||
+            (delta == best_delta && topol_rank.at(*it) < topol_rank.at(*best)))
+        {
+          best = it;
+          best_delta = delta;
+        }
+      }
+    }
+
+    const auto op_ind = *best;
+    ready.erase(best);
+    order.push_back(op_ind);
+
+    const auto &op = graph.operations().at(op_ind);
+    for (const auto &ind : op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+      remaining_uses.at(ind)--;
+    for (const auto &ind : op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED)
+    {
+      for (const auto &use : graph.operands().at(ind).getUses())
+      {
+        if (--pending_inputs.at(use) == 0)
+          ready.push_back(use);
+      }
+    }
+  }
+
+  assert(order.size() == topol_order.size()); // All of the operations must have been scheduled
+  return order;
 }
 
 // TODO(easy) Change the LoweredGraph param to Graph
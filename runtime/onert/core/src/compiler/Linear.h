@@ -31,6 +31,9 @@ namespace compiler
 class Linear
 {
 public:
+  /**
+   * @brief Return a topological order of operations which keeps peak live tensor memory low
+   */
   static std::vector<ir::OperationIndex> linearize(const compiler::LoweredGraph &lowered_graph);
   static void dump(const compiler::LoweredGraph &lowered_graph,
                    const std::vector<ir::OperationIndex> &order);
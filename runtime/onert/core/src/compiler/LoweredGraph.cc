@@ -16,6 +16,7 @@
 
 #include "compiler/LoweredGraph.h"
 
+#include "CompileCache.h"
 #include "HEScheduler.h"
 #include "ManualScheduler.h"
 #include "pass/ConstantInsertionPass.h"
@@ -85,16 +86,22 @@ void LoweredGraph::lowerGraph(const ir::Graph &graph, const CompilerOptions &opt
   // Schedule
   std::unique_ptr<BackendResolver> backend_resolver;
   auto all_backends = backend_manager.getAll();
-  if (options.he_scheduler)
+  CompileCache cache{_graph, options};
+  backend_resolver = cache.loadSchedule(all_backends, _indexed_ranks);
+  if (!backend_resolver)
   {
-    auto scheduler = HEScheduler(all_backends, options);
-    backend_resolver = scheduler.schedule(_graph);
-    _indexed_ranks = scheduler.getIndexedRanks();
-  }
-  else
-  {
-    auto scheduler = ManualScheduler(all_backends, options);
-    backend_resolver = scheduler.schedule(_graph);
+    if (options.he_scheduler)
+    {
+      auto scheduler = HEScheduler(all_backends, options);
+      backend_resolver = scheduler.schedule(_graph);
+      _indexed_ranks = scheduler.getIndexedRanks();
+    }
+    else
+    {
+      auto scheduler = ManualScheduler(all_backends, options);
+      backend_resolver = scheduler.schedule(_graph);
+    }
+    cache.storeSchedule(*backend_resolver, _indexed_ranks.get());
   }
 
   makeLowerInfo(*backend_resolver);
@@ -129,6 +136,30 @@ void LoweredGraph::lowerGraph(const ir::Graph &graph, const CompilerOptions &opt
   }
 }
 
+const ir::OperationIndexMap<std::vector<ir::OperationIndex>> &LoweredGraph::consumers()
+{
+  if (!_consumers)
+    buildConsumers();
+  return *_consumers;
+}
+
+void LoweredGraph::buildConsumers()
+{
+  _consumers = std::make_unique<ir::OperationIndexMap<std::vector<ir::OperationIndex>>>();
+
+  const auto &operands = _graph.operands();
+  _graph.operations().iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+    auto &op_consumers = (*_consumers)[op_ind];
+    for (auto output : op.getOutputs() | ir::Remove::UNDEFINED)
+    {
+      for (auto use : operands.at(output).getUses())
+      {
+        op_consumers.emplace_back(use);
+      }
+    }
+  });
+}
+
 void LoweredGraph::makeLowerInfo(const compiler::BackendResolver &backend_resolver)
 {
   _graph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &) {
@@ -824,6 +824,26 @@ void ShapeValidator::visit(const ir::operation::L2Normalization &node)
   }
 }
 
+void ShapeValidator::visit(const ir::operation::LayerNorm &node)
+{
+  const auto ofm_index{node.getOutputs().at(0)};
+  if (_ctx.at(ofm_index).info().isDynamic())
+    return;
+
+  const auto ifm_index{node.getInputs().at(ir::operation::LayerNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(ir::operation::LayerNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(ir::operation::LayerNorm::Input::BETA)};
+
+  const auto &ifm_shape = _ctx.at(ifm_index).shape();
+
+  // Normalization runs over the last axis, so gamma and beta hold one value per element of it
+  OP_REQUIRES(ifm_shape.rank() >= 1);
+  OP_REQUIRES(ifm_shape == _ctx.at(ofm_index).shape());
+  OP_REQUIRES(_ctx.at(gamma_index).shape().rank() == 1);
+  OP_REQUIRES(_ctx.at(gamma_index).shape().dim(0) == ifm_shape.dim(ifm_shape.rank() - 1));
+  OP_REQUIRES(_ctx.at(beta_index).shape() == _ctx.at(gamma_index).shape());
+}
+
 void ShapeValidator::visit(const ir::operation::Unpack &node)
 {
   const auto axis{node.param().axis};
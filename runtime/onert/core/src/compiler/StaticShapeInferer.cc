@@ -120,6 +120,25 @@ void StaticShapeInferer::handleSimpleUnaryOp(const ir::Operation &op,
   output.info().shape(new_shape);
 }
 
+bool StaticShapeInferer::getKnownValues(const ir::OperandIndex &index,
+                                        std::vector<int32_t> &values) const
+{
+  const auto &operand = _operands.at(index);
+  if (operand.isConstant())
+  {
+    if (operand.typeInfo().type() != ir::DataType::INT32)
+      return false;
+    values = operand.asVector<int32_t>();
+    return true;
+  }
+
+  auto it = _known_values.find(index);
+  if (it == _known_values.end())
+    return false;
+  values = it->second;
+  return true;
+}
+
 void StaticShapeInferer::dump()
 {
   auto get_shape_str = [](const ir::Shape &shape) {
@@ -179,6 +198,16 @@ void StaticShapeInferer::visit(const ir::operation::ArgMinMax &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::Attention &op)
+{
+  const auto &query = _operands.at(op.getInputs().at(ir::operation::Attention::Input::QUERY));
+  const auto &key = _operands.at(op.getInputs().at(ir::operation::Attention::Input::KEY));
+  const auto &value = _operands.at(op.getInputs().at(ir::operation::Attention::Input::VALUE));
+  auto &output = _operands.at(op.getOutputs().at(0));
+  auto new_shape = shape_inference::inferAttentionShape(query.shape(), key.shape(), value.shape());
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::BatchMatMul &op)
 {
   const auto lhs_index = op.getInputs().at(ir::operation::BatchMatMul::Input::LHS);
@@ -293,6 +322,20 @@ void StaticShapeInferer::visit(const ir::operation::Concat &op)
 
   // re-sizing output shape
   output.info().shape(out_shape);
+
+  // concatenation of known shape vectors is known as well
+  if (out_shape.rank() == 1)
+  {
+    std::vector<int32_t> values;
+    for (uint32_t i = 0; i < input_count; i++)
+    {
+      std::vector<int32_t> input_values;
+      if (!getKnownValues(op.getInputs().at(i), input_values))
+        return;
+      values.insert(values.end(), input_values.begin(), input_values.end());
+    }
+    _known_values[output_idx] = std::move(values);
+  }
 }
 
 void StaticShapeInferer::visit(const ir::operation::Conv2D &op)
@@ -310,6 +353,16 @@ void StaticShapeInferer::visit(const ir::operation::Conv2D &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::ConvertFp16ToFp32 &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ConvertFp16ToFp32::Input::INPUT));
+}
+
+void StaticShapeInferer::visit(const ir::operation::ConvertFp32ToFp16 &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ConvertFp32ToFp16::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::ElementwiseActivation &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseActivation::Input::INPUT));
@@ -505,6 +558,11 @@ void StaticShapeInferer::visit(const ir::operation::L2Normalization &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::L2Normalization::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::LayerNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::LayerNorm::Input::INPUT));
+}
+
 void StaticShapeInferer::visit(const ir::operation::LSTM &op)
 {
   const auto output_index{op.getOutputs().at(ir::operation::LSTM::Output::OUTPUT)};
@@ -647,6 +705,20 @@ void StaticShapeInferer::visit(const ir::operation::Pack &op)
   // re-sizing output shape
   ir::Shape new_shape = shape_inference::inferPackShape(input.info().shape(), axis, rank, num);
   output.info().shape(new_shape);
+
+  // packing known scalars makes a known shape vector, like Pack(StridedSlice(Shape(x)), ...)
+  if (rank == 1)
+  {
+    std::vector<int32_t> values;
+    for (const auto &input_idx : op.getInputs())
+    {
+      std::vector<int32_t> input_values;
+      if (!getKnownValues(input_idx, input_values) || input_values.size() != 1)
+        return;
+      values.push_back(input_values[0]);
+    }
+    _known_values[output_idx] = std::move(values);
+  }
 }
 
 void StaticShapeInferer::visit(const ir::operation::Pad &op)
@@ -789,15 +861,13 @@ void StaticShapeInferer::visit(const ir::operation::Reshape &op)
   {
     // Let's check the second input
     const auto shape_idx{op.getInputs().at(ir::operation::Reshape::Input::SHAPE)};
-    const auto &shape = _operands.at(shape_idx);
 
-    if (shape.isConstant())
+    // shape can be known without being constant if it is computed from static shapes
+    std::vector<int32_t> shape_values;
+    if (getKnownValues(shape_idx, shape_values))
     {
-      const auto *shape_buf = reinterpret_cast<const int32_t *>(shape.data()->base());
-      assert(shape_buf);
-
       ir::Shape new_shape = shape_inference::inferReshapeShape(
-        shape_buf, shape.shape().num_elements(), input.shape().num_elements());
+        shape_values.data(), shape_values.size(), input.shape().num_elements());
 
       // if shape is from Const, TFLC put the shape of output into tensor
       if (new_shape != output.shape())
@@ -913,6 +983,13 @@ void StaticShapeInferer::visit(const ir::operation::Shape &op)
   output_shape.append(input.info().shape().rank());
 
   output.info().shape(output_shape);
+
+  // input shape is static here, so output values are known before running
+  const auto &input_shape = input.info().shape();
+  if (!input_shape.hasUnspecifiedDims())
+  {
+    _known_values[output_idx] = input_shape.dims();
+  }
 }
 
 void StaticShapeInferer::visit(const ir::operation::Slice &op)
@@ -1051,15 +1128,14 @@ void StaticShapeInferer::visit(const ir::operation::StridedSlice &op)
   const auto input_index{op.getInputs().at(ir::operation::StridedSlice::Input::INPUT)};
   const auto &input = _operands.at(input_index);
   const auto starts_index{op.getInputs().at(ir::operation::StridedSlice::Input::STARTS)};
-  const auto &starts = _operands.at(starts_index);
   const auto ends_index{op.getInputs().at(ir::operation::StridedSlice::Input::ENDS)};
-  const auto &ends = _operands.at(ends_index);
   const auto strides_index{op.getInputs().at(ir::operation::StridedSlice::Input::STRIDES)};
-  const auto &strides = _operands.at(strides_index);
   const auto output_index = op.getOutputs().at(0);
   ir::Operand &output = _operands.at(output_index);
 
-  if (!(starts.isConstant() && ends.isConstant() && strides.isConstant()))
+  std::vector<int32_t> starts_values, ends_values, strides_values;
+  if (!(getKnownValues(starts_index, starts_values) && getKnownValues(ends_index, ends_values) &&
+        getKnownValues(strides_index, strides_values)))
   {
     output.info().setDynamic();
     _return_has_dynamic_tensor = true;
@@ -1071,16 +1147,28 @@ void StaticShapeInferer::visit(const ir::operation::StridedSlice &op)
   const auto shrink_axis_mask = op.param().shrink_axis_mask;
   const auto rank = input.info().shape().rank();
 
-  auto starts_buf = reinterpret_cast<const uint32_t *>(starts.data()->base());
-  auto ends_buf = reinterpret_cast<const uint32_t *>(ends.data()->base());
-  auto strides_buf = reinterpret_cast<const uint32_t *>(strides.data()->base());
-
   auto op_params = shape_inference::buildStridedSliceParams(
-    starts_buf, ends_buf, strides_buf, begin_mask, end_mask, shrink_axis_mask, rank);
+    starts_values.data(), ends_values.data(), strides_values.data(), begin_mask, end_mask,
+    shrink_axis_mask, rank);
 
   ir::Shape new_shape =
     shape_inference::inferStridedSliceShape(input.info().shape(), op_params, rank);
   output.info().shape(new_shape);
+
+  // slice of a known shape vector, e.g. a dimension of Shape(x), is known as well
+  std::vector<int32_t> input_values;
+  if (rank == 1 && getKnownValues(input_index, input_values))
+  {
+    const auto &input_shape = input.info().shape();
+    const int stride = op_params.strides[0];
+    const int begin = shape_inference::StartForAxis(op_params, input_shape, 0);
+    const int end = shape_inference::StopForAxis(op_params, input_shape, 0, begin);
+
+    std::vector<int32_t> values;
+    for (int i = begin; stride > 0 ? i < end : i > end; i += stride)
+      values.push_back(input_values[i]);
+    _known_values[output_index] = std::move(values);
+  }
 }
 
 void StaticShapeInferer::visit(const ir::operation::Tile &op)
@@ -1110,6 +1198,17 @@ void StaticShapeInferer::visit(const ir::operation::Tile &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  const auto input_idx{op.getInputs().at(ir::operation::TopKV2::Input::INPUT)};
+  const auto &input = _operands.at(input_idx);
+
+  // re-sizing output shapes
+  const auto new_shape = shape_inference::inferTopKV2Shape(input.info().shape(), op.param().k);
+  for (const auto &output_idx : op.getOutputs())
+    _operands.at(output_idx).info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::Transpose &op)
 {
   const auto input_idx{op.getInputs().at(ir::operation::Transpose::Input::INPUT)};
@@ -1231,59 +1330,43 @@ void StaticShapeInferer::visit(const ir::operation::While &op)
   }
 
   // re-sizing operands of body subgraph
-  inferSubgraph(op.param().body_subg_index);
-
-  // Check whether while operation's shapes are predictable
-  // If any of shape of body outputs and cond inputs are different, non-constant operands would be
-  // set to dynamic
-  bool check_unpredictable_dynamic = false;
+  // Loop variables whose shapes change through the body are set to dynamic, which may change
+  // shapes of other loop variables. Repeat until every remaining static variable is invariant.
   const auto &body_outputs = body_graph.getOutputs();
   assert(body_outputs.size() == cond_inputs.size());
-  for (size_t i = 0; i < body_outputs.size(); ++i)
-  {
-    const auto &body_output = body_graph.operands().at(body_outputs.at(i));
-    auto &cond_input = cond_graph.operands().at(cond_inputs.at(i));
-    if ((cond_input.info().isDynamic() != body_output.info().isDynamic()) ||
-        (cond_input.shape() != body_output.shape()))
-    {
-      check_unpredictable_dynamic = true;
-      break;
-    }
-  }
-
-  if (check_unpredictable_dynamic)
+  bool has_variant = true;
+  while (has_variant)
   {
-    // Set inputs of body subgraph
-    for (const auto &input_index : body_inputs)
-    {
-      auto &input = body_graph.operands().at(input_index);
-      if (!input.isConstant())
-      {
-        input.info().setDynamic();
-      }
-    }
+    inferSubgraph(op.param().body_subg_index);
 
-    // Set inputs of cond subgraph
-    for (const auto &input_index : cond_inputs)
+    has_variant = false;
+    for (size_t i = 0; i < body_outputs.size(); ++i)
     {
-      auto &input = cond_graph.operands().at(input_index);
-      if (!input.isConstant())
+      const auto &body_output = body_graph.operands().at(body_outputs.at(i));
+      auto &cond_input = cond_graph.operands().at(cond_inputs.at(i));
+      auto &body_input = body_graph.operands().at(body_inputs.at(i));
+      if (cond_input.info().isDynamic() ||
+          (!body_output.info().isDynamic() && cond_input.shape() == body_output.shape()))
+        continue;
+
+      VERBOSE(StaticShapeInferer) << "While loop variable " << i << " is not shape invariant"
+                                  << std::endl;
+      if (!cond_input.isConstant())
+        cond_input.info().setDynamic();
+      if (!body_input.isConstant() && !body_input.info().isDynamic())
       {
-        input.info().setDynamic();
+        body_input.info().setDynamic();
+        has_variant = true;
       }
     }
-
-    // Set non-constant operands of body subgraph to dynamic
-    inferSubgraph(op.param().body_subg_index);
   }
 
   // re-sizing operands of cond subgraph
-  // If check_unpredictable_dynamic is true, non-constant operands of cond subgraph would be set to
-  // dynamic
+  // Operands of cond subgraph depending on variant loop variables would be set to dynamic
   inferSubgraph(op.param().cond_subg_index);
 
   // re-sizing outputs of while operation
-  // If check_unpredictable_dynamic is true, outputs of while operation would be set to dynamic
+  // Outputs of variant loop variables would be set to dynamic
   assert(cond_inputs.size() == outputs.size());
   for (size_t i = 0; i < cond_inputs.size(); ++i)
   {
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AttentionFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/Attention.h"
+#include "ir/operation/BatchMatMul.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Softmax.h"
+#include "ir/operation/Transpose.h"
+#include "util/logging.h"
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+void AttentionFusionPass::run()
+{
+  std::vector<ir::OperationIndex> candidates;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+    if (op.opcode() == ir::OpCode::BatchMatMul)
+      candidates.emplace_back(index);
+  });
+
+  for (const auto &index : candidates)
+  {
+    // The candidate could be fused into another Attention already, as its first BatchMatMul
+    if (_graph.operations().exist(index))
+      fuse(index);
+  }
+}
+
+bool AttentionFusionPass::fuse(const ir::OperationIndex &index)
+{
+  using ir::operation::BatchMatMul;
+  using ir::operation::BinaryArithmetic;
+
+  const auto &operations = _graph.operations();
+  const auto &operands = _graph.operands();
+
+  // Weighted sum of values
+  const auto &pv = static_cast<const BatchMatMul &>(operations.at(index));
+  if (pv.param().adj_x || pv.param().adj_y)
+    return false;
+  const auto value = pv.getInputs().at(BatchMatMul::Input::RHS);
+  const auto output = pv.getOutputs().at(0);
+  std::vector<ir::OperationIndex> chain{index};
+
+  // Softmax
+  const auto softmax_index = fusableProducer(pv.getInputs().at(BatchMatMul::Input::LHS),
+                                             ir::OpCode::Softmax);
+  if (!softmax_index.valid())
+    return false;
+  const auto &softmax = static_cast<const ir::operation::Softmax &>(operations.at(softmax_index));
+  // Beta would scale the mask too
+  if (softmax.param().beta != 1.f)
+    return false;
+  auto scores = softmax.getInputs().at(ir::operation::Softmax::Input::INPUT);
+  chain.emplace_back(softmax_index);
+
+  auto arithmetic_index = fusableProducer(scores, ir::OpCode::BinaryArithmetic);
+  auto arithmetic_param = [&](const ir::OperationIndex &arith_index) {
+    return static_cast<const BinaryArithmetic &>(operations.at(arith_index)).param();
+  };
+
+  // Mask, which is the input of Add not coming from the chain
+  ir::OperandIndex mask;
+  if (arithmetic_index.valid() &&
+      arithmetic_param(arithmetic_index).arithmetic_type == BinaryArithmetic::ArithmeticType::ADD &&
+      arithmetic_param(arithmetic_index).activation == ir::Activation::NONE)
+  {
+    const auto &add = operations.at(arithmetic_index);
+    auto from_chain = [&](const ir::OperandIndex &operand) {
+      return fusableProducer(operand, ir::OpCode::BatchMatMul).valid() ||
+             fusableProducer(operand, ir::OpCode::BinaryArithmetic).valid();
+    };
+    const auto lhs = add.getInputs().at(BinaryArithmetic::Input::LHS);
+    const auto rhs = add.getInputs().at(BinaryArithmetic::Input::RHS);
+    if (from_chain(lhs))
+    {
+      scores = lhs;
+      mask = rhs;
+    }
+    else if (from_chain(rhs))
+    {
+      scores = rhs;
+      mask = lhs;
+    }
+    if (!mask.valid() || !isBroadcastableMask(mask, scores))
+      return false;
+    chain.emplace_back(arithmetic_index);
+    arithmetic_index = fusableProducer(scores, ir::OpCode::BinaryArithmetic);
+  }
+
+  // Scale
+  float scale = 1.f;
+  if (arithmetic_index.valid())
+  {
+    const auto param = arithmetic_param(arithmetic_index);
+    const bool is_mul = (param.arithmetic_type == BinaryArithmetic::ArithmeticType::MUL);
+    const bool is_div = (param.arithmetic_type == BinaryArithmetic::ArithmeticType::DIV);
+    if ((!is_mul && !is_div) || param.activation != ir::Activation::NONE)
+      return false;
+
+    const auto &op = operations.at(arithmetic_index);
+    const auto lhs = op.getInputs().at(BinaryArithmetic::Input::LHS);
+    const auto rhs = op.getInputs().at(BinaryArithmetic::Input::RHS);
+    float factor = 0.f;
+    if (isScalarConstant(rhs, factor))
+      scores = lhs;
+    else if (is_mul && isScalarConstant(lhs, factor))
+      scores = rhs;
+    else
+      return false;
+    if (is_div && factor == 0.f)
+      return false;
+    scale = is_mul ? factor : 1.f / factor;
+    chain.emplace_back(arithmetic_index);
+  }
+
+  // Scores of queries against keys
+  const auto qk_index = fusableProducer(scores, ir::OpCode::BatchMatMul);
+  if (!qk_index.valid())
+    return false;
+  const auto &qk = static_cast<const BatchMatMul &>(operations.at(qk_index));
+  if (qk.param().adj_x)
+    return false;
+  const auto query = qk.getInputs().at(BatchMatMul::Input::LHS);
+  auto key = qk.getInputs().at(BatchMatMul::Input::RHS);
+  if (!qk.param().adj_y)
+  {
+    ir::OperationIndex transpose_index;
+    key = untransposedKey(key, transpose_index);
+    if (!key.valid())
+      return false;
+    chain.emplace_back(transpose_index);
+  }
+  chain.emplace_back(qk_index);
+
+  // Check types and shapes
+  for (const auto &operand : {query, key, value, output})
+  {
+    const auto &obj = operands.at(operand);
+    if (obj.typeInfo().type() != ir::DataType::FLOAT32 || obj.shape().hasUnspecifiedDims())
+      return false;
+  }
+  const auto &query_shape = operands.at(query).shape();
+  const auto &key_shape = operands.at(key).shape();
+  const auto &value_shape = operands.at(value).shape();
+  const auto rank = query_shape.rank();
+  if (rank < 2 || key_shape.rank() != rank || value_shape.rank() != rank)
+    return false;
+  // Batch dimensions are not broadcast
+  for (int i = 0; i < rank - 2; ++i)
+  {
+    if (key_shape.dim(i) != query_shape.dim(i) || value_shape.dim(i) != query_shape.dim(i))
+      return false;
+  }
+  if (key_shape.dim(rank - 1) != query_shape.dim(rank - 1) ||
+      value_shape.dim(rank - 2) != key_shape.dim(rank - 2))
+    return false;
+
+  VERBOSE(AttentionFusionPass) << "Fuse " << chain.size() << " operations from "
+                               << operations.at(qk_index).name() << "(" << qk_index << ") into "
+                               << "Attention for " << output << std::endl;
+
+  ir::OperandIndexSequence inputs{query, key, value};
+  if (mask.valid())
+    inputs.append(mask);
+  removeOperations(chain);
+  _graph.addOperation(std::make_unique<ir::operation::Attention>(
+    inputs, ir::OperandIndexSequence{output}, ir::operation::Attention::Param{scale}));
+  return true;
+}
+
+ir::OperationIndex AttentionFusionPass::fusableProducer(const ir::OperandIndex &operand,
+                                                       ir::OpCode opcode)
+{
+  if (_graph.getInputs().contains(operand) || _graph.getOutputs().contains(operand))
+    return ir::OperationIndex{};
+
+  const auto &obj = _graph.operands().at(operand);
+  if (obj.getUses().size() != 1 || !obj.getDef().valid() || obj.isConstant() ||
+      obj.typeInfo().type() != ir::DataType::FLOAT32)
+    return ir::OperationIndex{};
+
+  const auto &producer = _graph.operations().at(obj.getDef());
+  if (producer.opcode() != opcode || producer.getOutputs().size() != 1)
+    return ir::OperationIndex{};
+
+  return obj.getDef();
+}
+
+ir::OperandIndex AttentionFusionPass::untransposedKey(const ir::OperandIndex &operand,
+                                                      ir::OperationIndex &transpose)
+{
+  transpose = fusableProducer(operand, ir::OpCode::Transpose);
+  if (!transpose.valid())
+    return ir::OperandIndex{};
+
+  const auto &op = _graph.operations().at(transpose);
+  const auto input = op.getInputs().at(ir::operation::Transpose::Input::INPUT);
+  const auto &perm = _graph.operands().at(op.getInputs().at(ir::operation::Transpose::PERMUTATION));
+  if (!perm.isConstant() || perm.typeInfo().type() != ir::DataType::INT32)
+    return ir::OperandIndex{};
+
+  // Only the last two dimensions are swapped
+  const auto values = perm.asVector<int32_t>();
+  const auto rank = static_cast<int32_t>(values.size());
+  if (rank < 2 || _graph.operands().at(input).shape().rank() != rank)
+    return ir::OperandIndex{};
+  for (int32_t i = 0; i < rank; ++i)
+  {
+    const auto expected = (i == rank - 2) ? rank - 1 : ((i == rank - 1) ? rank - 2 : i);
+    if (values[i] != expected)
+      return ir::OperandIndex{};
+  }
+
+  return input;
+}
+
+bool AttentionFusionPass::isScalarConstant(const ir::OperandIndex &operand, float &value)
+{
+  const auto &obj = _graph.operands().at(operand);
+  if (!obj.isConstant() || obj.typeInfo().type() != ir::DataType::FLOAT32 ||
+      obj.shape().num_elements() != 1)
+    return false;
+
+  value = obj.asScalar<float>();
+  return true;
+}
+
+bool AttentionFusionPass::isBroadcastableMask(const ir::OperandIndex &mask,
+                                              const ir::OperandIndex &scores)
+{
+  const auto &mask_obj = _graph.operands().at(mask);
+  const auto &mask_shape = mask_obj.shape();
+  const auto &scores_shape = _graph.operands().at(scores).shape();
+  if (mask_obj.typeInfo().type() != ir::DataType::FLOAT32 || mask_shape.hasUnspecifiedDims() ||
+      scores_shape.hasUnspecifiedDims() || mask_shape.rank() > scores_shape.rank())
+    return false;
+
+  // Mask is broadcast to scores, not the other way around
+  const auto offset = scores_shape.rank() - mask_shape.rank();
+  for (int i = 0; i < mask_shape.rank(); ++i)
+  {
+    if (mask_shape.dim(i) != 1 && mask_shape.dim(i) != scores_shape.dim(i + offset))
+      return false;
+  }
+  return true;
+}
+
+void AttentionFusionPass::removeOperations(const std::vector<ir::OperationIndex> &indices)
+{
+  // Outputs of the operations but the last one in the chain, i.e. the first of indices, are
+  // intermediates
+  std::vector<ir::OperandIndex> intermediates;
+  for (const auto &index : indices)
+  {
+    const auto &op = _graph.operations().at(index);
+    for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+      _graph.operands().at(input).removeUse(index);
+    if (index != indices.front())
+      intermediates.emplace_back(op.getOutputs().at(0));
+    _graph.operations().remove(index);
+  }
+
+  for (const auto &operand : intermediates)
+    _graph.removeOperand(operand);
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
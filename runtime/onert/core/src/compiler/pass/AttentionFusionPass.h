@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_ATTENTION_FUSION_PASS_H__
+#define __ONERT_COMPILER_PASS_ATTENTION_FUSION_PASS_H__
+
+#include "Pass.h"
+#include "ir/Index.h"
+#include "ir/OpCode.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief Pass to fuse the chain of operations for scaled dot-product attention into Attention
+ *
+ * ```
+ * [BatchMatMul(Q, K, adj_y)] -> [Mul(scale) or Div(1/scale)] -> [Add(mask)] -> [Softmax]
+ *   -> [BatchMatMul(V)]
+ * becomes
+ * [Attention(Q, K, V, mask, scale)]
+ * ```
+ *
+ * Mul/Div and Add are optional. K can also come through a Transpose of the last two dimensions
+ * instead of adj_y, and the Transpose is removed then. Only float32 chains with static shapes and
+ * without broadcast of batch dimensions are fused.
+ *
+ * No backend but cpu supports Attention, so the compiler runs this pass only when cpu is there.
+ */
+class AttentionFusionPass : public Pass
+{
+public:
+  using Pass::Pass;
+
+public:
+  std::string id() final { return "AttentionFusionPass"; }
+
+public:
+  void run() override;
+
+private:
+  bool fuse(const ir::OperationIndex &index);
+  ir::OperationIndex fusableProducer(const ir::OperandIndex &operand, ir::OpCode opcode);
+  ir::OperandIndex untransposedKey(const ir::OperandIndex &operand, ir::OperationIndex &transpose);
+  bool isScalarConstant(const ir::OperandIndex &operand, float &value);
+  bool isBroadcastableMask(const ir::OperandIndex &mask, const ir::OperandIndex &scores);
+  void removeOperations(const std::vector<ir::OperationIndex> &indices);
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_ATTENTION_FUSION_PASS_H__
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AttentionFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/Attention.h"
+#include "ir/operation/BatchMatMul.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Softmax.h"
+#include "ir/operation/Transpose.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::ir;
+using namespace onert::compiler::pass;
+
+namespace
+{
+
+OperandIndex addScalar(Graph &graph, float value)
+{
+  auto ind = graph.addOperand(Shape{}, TypeInfo{DataType::FLOAT32});
+  graph.setOperandValue(ind, std::make_shared<CachedData>(
+                               reinterpret_cast<const uint8_t *>(&value), sizeof(value)));
+  return ind;
+}
+
+OperationIndex addBatchMatMul(Graph &graph, OperandIndex lhs, OperandIndex rhs, bool adj_y,
+                              OperandIndex out)
+{
+  return graph.addOperation(std::make_unique<operation::BatchMatMul>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{out},
+    operation::BatchMatMul::Param{false, adj_y}));
+}
+
+void addBinaryArithmetic(Graph &graph, operation::BinaryArithmetic::ArithmeticType type,
+                         OperandIndex lhs, OperandIndex rhs, OperandIndex out)
+{
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{out},
+    operation::BinaryArithmetic::Param{type, Activation::NONE}));
+}
+
+void addSoftmax(Graph &graph, OperandIndex in, OperandIndex out, float beta = 1.f)
+{
+  graph.addOperation(std::make_unique<operation::Softmax>(
+    OperandIndexSequence{in}, OperandIndexSequence{out}, operation::Softmax::Param{beta}));
+}
+
+std::vector<OperandIndex> inputsOf(const Operation &op)
+{
+  return std::vector<OperandIndex>(op.getInputs().begin(), op.getInputs().end());
+}
+
+} // namespace
+
+TEST(AttentionFusionPass, fuse_masked)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto q = graph.addOperand(Shape{1, 2, 4, 8}, type);
+  auto k = graph.addOperand(Shape{1, 2, 6, 8}, type);
+  auto v = graph.addOperand(Shape{1, 2, 6, 8}, type);
+  auto mask = graph.addOperand(Shape{1, 1, 4, 6}, type);
+  auto scores = graph.addOperand(Shape{1, 2, 4, 6}, type);
+  auto scaled = graph.addOperand(Shape{1, 2, 4, 6}, type);
+  auto masked = graph.addOperand(Shape{1, 2, 4, 6}, type);
+  auto probs = graph.addOperand(Shape{1, 2, 4, 6}, type);
+  auto out = graph.addOperand(Shape{1, 2, 4, 8}, type);
+  graph.addInput(q);
+  graph.addInput(k);
+  graph.addInput(v);
+  graph.addInput(mask);
+  graph.addOutput(out);
+
+  using ArithmeticType = operation::BinaryArithmetic::ArithmeticType;
+  addBatchMatMul(graph, q, k, true, scores);
+  addBinaryArithmetic(graph, ArithmeticType::MUL, scores, addScalar(graph, 0.125f), scaled);
+  addBinaryArithmetic(graph, ArithmeticType::ADD, mask, scaled, masked);
+  addSoftmax(graph, masked, probs);
+  addBatchMatMul(graph, probs, v, false, out);
+
+  AttentionFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  ASSERT_FALSE(graph.operands().exist(scores));
+  ASSERT_FALSE(graph.operands().exist(probs));
+  const auto &def = graph.operands().at(out).getDef();
+  ASSERT_EQ(graph.operations().at(def).opcode(), OpCode::Attention);
+  const auto &op = static_cast<const operation::Attention &>(graph.operations().at(def));
+  ASSERT_EQ(inputsOf(op), (std::vector<OperandIndex>{q, k, v, mask}));
+  ASSERT_FLOAT_EQ(op.param().scale, 0.125f);
+  ASSERT_EQ(graph.operands().at(mask).getUses().size(), 1);
+}
+
+TEST(AttentionFusionPass, fuse_transposed_key)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto q = graph.addOperand(Shape{2, 4, 8}, type);
+  auto k = graph.addOperand(Shape{2, 6, 8}, type);
+  auto v = graph.addOperand(Shape{2, 6, 3}, type);
+  auto k_t = graph.addOperand(Shape{2, 8, 6}, type);
+  auto scores = graph.addOperand(Shape{2, 4, 6}, type);
+  auto scaled = graph.addOperand(Shape{2, 4, 6}, type);
+  auto probs = graph.addOperand(Shape{2, 4, 6}, type);
+  auto out = graph.addOperand(Shape{2, 4, 3}, type);
+  graph.addInput(q);
+  graph.addInput(k);
+  graph.addInput(v);
+  graph.addOutput(out);
+
+  const std::vector<int32_t> perm_values{0, 2, 1};
+  auto perm = graph.addOperand(Shape{3}, TypeInfo{DataType::INT32});
+  graph.setOperandValue(perm, std::make_shared<CachedData>(
+                                reinterpret_cast<const uint8_t *>(perm_values.data()),
+                                perm_values.size() * sizeof(int32_t)));
+  graph.addOperation(std::make_unique<operation::Transpose>(OperandIndexSequence{k, perm},
+                                                            OperandIndexSequence{k_t}));
+  addBatchMatMul(graph, q, k_t, false, scores);
+  addBinaryArithmetic(graph, operation::BinaryArithmetic::ArithmeticType::DIV, scores,
+                      addScalar(graph, 4.f), scaled);
+  addSoftmax(graph, scaled, probs);
+  addBatchMatMul(graph, probs, v, false, out);
+
+  AttentionFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  ASSERT_FALSE(graph.operands().exist(k_t));
+  const auto &def = graph.operands().at(out).getDef();
+  const auto &op = static_cast<const operation::Attention &>(graph.operations().at(def));
+  ASSERT_EQ(inputsOf(op), (std::vector<OperandIndex>{q, k, v}));
+  ASSERT_FLOAT_EQ(op.param().scale, 0.25f);
+}
+
+TEST(AttentionFusionPass, neg_softmax_beta)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto q = graph.addOperand(Shape{2, 4, 8}, type);
+  auto k = graph.addOperand(Shape{2, 6, 8}, type);
+  auto v = graph.addOperand(Shape{2, 6, 8}, type);
+  auto scores = graph.addOperand(Shape{2, 4, 6}, type);
+  auto probs = graph.addOperand(Shape{2, 4, 6}, type);
+  auto out = graph.addOperand(Shape{2, 4, 8}, type);
+  graph.addInput(q);
+  graph.addInput(k);
+  graph.addInput(v);
+  graph.addOutput(out);
+
+  addBatchMatMul(graph, q, k, true, scores);
+  addSoftmax(graph, scores, probs, 2.f);
+  addBatchMatMul(graph, probs, v, false, out);
+
+  AttentionFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 3);
+  ASSERT_TRUE(graph.operands().exist(scores));
+}
+
+TEST(AttentionFusionPass, neg_scores_are_output)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto q = graph.addOperand(Shape{2, 4, 8}, type);
+  auto k = graph.addOperand(Shape{2, 6, 8}, type);
+  auto v = graph.addOperand(Shape{2, 6, 8}, type);
+  auto scores = graph.addOperand(Shape{2, 4, 6}, type);
+  auto probs = graph.addOperand(Shape{2, 4, 6}, type);
+  auto out = graph.addOperand(Shape{2, 4, 8}, type);
+  graph.addInput(q);
+  graph.addInput(k);
+  graph.addInput(v);
+  graph.addOutput(probs);
+  graph.addOutput(out);
+
+  addBatchMatMul(graph, q, k, true, scores);
+  addSoftmax(graph, scores, probs);
+  addBatchMatMul(graph, probs, v, false, out);
+
+  AttentionFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 3);
+}
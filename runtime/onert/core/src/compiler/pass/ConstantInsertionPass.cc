@@ -44,13 +44,30 @@ void ConstantInsertionPass::callback(const ir::OperationIndex &node_index, ir::O
       const auto key = ReplaceKey{input, factor};
       if (_replace_operands_map.count(key) == 0)
       {
-        ir::Operand new_object(object);
-        new_object.clearDefUse();
-        const auto new_index = _graph.operands().emplace(new_object);
-        _replace_operands_map[key] = new_index;
+        if (_kept_operands.count(input) == 0)
+        {
+          // The first PermuteFactor keeps the original operand, so that a constant used by a
+          // backend alone is not copied at all
+          _kept_operands.insert(input);
+          _replace_operands_map[key] = input;
+          VERBOSE(ConstInsertPass) << "Operand " << input << " kept for " << factor << std::endl;
+        }
+        else
+        {
+          // The copy shares the data of the original, and each backend makes its own copy of the
+          // data only if it needs a different format, e.g. in device memory or another layout
+          ir::Operand new_object(object);
+          new_object.clearDefUse();
+          const auto new_index = _graph.operands().emplace(new_object);
+          _replace_operands_map[key] = new_index;
+          VERBOSE(ConstInsertPass) << "New operand " << new_index << " added(copy of " << input
+                                   << ") for " << factor << std::endl;
+        }
       }
 
       const auto replaced_input = _replace_operands_map[key];
+      if (replaced_input == input)
+        continue;
 
       // Update the same inputs of a node at once because inputs of an operation have the same
       // PermuteFactor
@@ -60,20 +77,10 @@ void ConstantInsertionPass::callback(const ir::OperationIndex &node_index, ir::O
       auto &replaced_object = _graph.operands().at(replaced_input);
       replaced_object.insertUse(node_index);
 
-      VERBOSE(ConstInsertPass) << "New operand " << replaced_input << " added(copy of " << input
-                               << ") for " << factor << std::endl;
       // Remove this node from uses of origin operand
       // Constant operand has no def.
       assert(!object.getDef().valid());
       object.removeUse(node_index);
-
-      // Remove origin operand
-      if (object.getUses().size() == 0)
-      {
-        _graph.removeOperand(input);
-        VERBOSE(ConstInsertPass) << "Original operand " << input << " removed - no uses"
-                                 << std::endl;
-      }
     }
   }
 
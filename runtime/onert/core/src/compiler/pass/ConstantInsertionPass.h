@@ -21,6 +21,7 @@
 #include <ir/Index.h>
 #include "LoweredOperationPass.h"
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 namespace onert
@@ -66,6 +67,8 @@ private:
   };
 
   std::unordered_map<ReplaceKey, ir::OperandIndex, KeyHasher> _replace_operands_map;
+  // Original operands kept for the first PermuteFactor using them
+  std::unordered_set<ir::OperandIndex> _kept_operands;
 };
 
 } // namespace pass
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Fp16ConversionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/ConvertFp16ToFp32.h"
+#include "ir/operation/ConvertFp32ToFp16.h"
+#include "ir/operation/FullyConnected.h"
+#include "util/logging.h"
+
+#include <cker/Fp16.h>
+
+#include <algorithm>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+const std::vector<ir::OpCode> &Fp16ConversionPass::convertibleOpCodes()
+{
+  static const std::vector<ir::OpCode> opcodes{
+    ir::OpCode::Conv2D, ir::OpCode::DepthwiseConv2D, ir::OpCode::FullyConnected,
+    ir::OpCode::BinaryArithmetic, ir::OpCode::Softmax};
+  return opcodes;
+}
+
+void Fp16ConversionPass::run()
+{
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+    if (isConvertible(op))
+      _converted.insert(index);
+  });
+  if (_converted.empty())
+    return;
+
+  // Operands of the converted operations, in the order of operations
+  std::vector<ir::OperandIndex> operands;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+    if (_converted.count(index) == 0)
+      return;
+    for (const auto &operand : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+    {
+      if (std::find(operands.begin(), operands.end(), operand) == operands.end())
+        operands.emplace_back(operand);
+    }
+  });
+  for (const auto &operand : operands)
+    convertOperand(operand);
+
+  VERBOSE(Fp16ConversionPass) << "Converted " << _converted.size() << " operations to float16"
+                              << std::endl;
+}
+
+bool Fp16ConversionPass::isConvertible(const ir::Operation &op) const
+{
+  const auto &opcodes = convertibleOpCodes();
+  if (std::find(opcodes.begin(), opcodes.end(), op.opcode()) == opcodes.end())
+    return false;
+
+  for (const auto &index : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+  {
+    const auto &operand = _graph.operands().at(index);
+    if (operand.typeInfo().type() != ir::DataType::FLOAT32 || operand.typeInfo().sparsity())
+      return false;
+  }
+
+  switch (op.opcode())
+  {
+    case ir::OpCode::FullyConnected:
+    {
+      const auto &fc = static_cast<const ir::operation::FullyConnected &>(op);
+      return fc.param().weights_format == ir::FullyConnectedWeightsFormat::Default;
+    }
+    case ir::OpCode::BinaryArithmetic:
+      // The float16 kernel broadcasts up to 4D
+      return _graph.operands().at(op.getOutputs().at(0)).shape().rank() <= 4;
+    default:
+      return true;
+  }
+}
+
+void Fp16ConversionPass::convertOperand(const ir::OperandIndex &index)
+{
+  auto &operand = _graph.operands().at(index);
+  if (operand.isConstant())
+  {
+    replaceConvertedUses(index, halfConstant(index));
+    return;
+  }
+
+  const auto def = operand.getDef();
+  const bool defined_inside = def.valid() && _converted.count(def) > 0;
+  bool used_outside = _graph.getOutputs().contains(index);
+  for (const auto &use : operand.getUses())
+    used_outside = used_outside || _converted.count(use) == 0;
+
+  if (defined_inside && !used_outside)
+  {
+    operand.info().type(ir::DataType::FLOAT16);
+    return;
+  }
+
+  const auto half = _graph.addOperand(operand.shape(), ir::TypeInfo{ir::DataType::FLOAT16});
+  if (operand.info().isDynamic())
+    _graph.operands().at(half).info().setDynamic();
+  replaceConvertedUses(index, half);
+
+  if (defined_inside)
+  {
+    // The converted operation writes float16, which is converted back for the others
+    _graph.operations().at(def).replaceOutputs(index, half);
+    _graph.operands().at(index).unsetDef();
+    _graph.operands().at(half).setDef(def);
+    _graph.addOperation(std::make_unique<ir::operation::ConvertFp16ToFp32>(
+      ir::OperandIndexSequence{half}, ir::OperandIndexSequence{index}));
+  }
+  else
+  {
+    _graph.addOperation(std::make_unique<ir::operation::ConvertFp32ToFp16>(
+      ir::OperandIndexSequence{index}, ir::OperandIndexSequence{half}));
+  }
+}
+
+ir::OperandIndex Fp16ConversionPass::halfConstant(const ir::OperandIndex &index)
+{
+  auto it = _half_constants.find(index);
+  if (it != _half_constants.end())
+    return it->second;
+
+  const auto &operand = _graph.operands().at(index);
+  const auto num_elements = operand.shape().num_elements();
+  std::vector<nnfw::cker::float16> data(num_elements);
+  nnfw::cker::ConvertFloatToFp16(reinterpret_cast<const float *>(operand.data()->base()),
+                                 data.data(), num_elements);
+
+  const auto half = _graph.addOperand(operand.shape(), ir::TypeInfo{ir::DataType::FLOAT16});
+  _graph.setOperandValue(half, std::make_shared<ir::CachedData>(
+                                 reinterpret_cast<const uint8_t *>(data.data()),
+                                 num_elements * sizeof(nnfw::cker::float16)));
+  _half_constants.emplace(index, half);
+  return half;
+}
+
+void Fp16ConversionPass::replaceConvertedUses(const ir::OperandIndex &from,
+                                              const ir::OperandIndex &to)
+{
+  // Copy the uses as they change while being replaced
+  const auto uses = _graph.operands().at(from).getUses();
+  for (const auto &use : uses)
+  {
+    if (_converted.count(use) == 0)
+      continue;
+    _graph.operations().at(use).replaceInputs(from, to);
+    _graph.operands().at(from).removeUse(use);
+    _graph.operands().at(to).insertUse(use);
+  }
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_FP16_CONVERSION_PASS_H__
+#define __ONERT_COMPILER_PASS_FP16_CONVERSION_PASS_H__
+
+#include "Pass.h"
+#include "ir/Index.h"
+#include "ir/OpCode.h"
+#include "ir/Operation.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief Pass to run float32 operations in float16, which halves memory traffic of activations
+ *        and weights
+ *
+ * Conv2D, DepthwiseConv2D, FullyConnected, BinaryArithmetic and Softmax of float32 become
+ * float16 ones. Their constants get float16 copies, and operands between them become float16 in
+ * place. ConvertFp32ToFp16 is inserted where a float32 operand comes into those operations and
+ * ConvertFp16ToFp32 where a result goes out of them, so graph inputs and outputs stay float32.
+ *
+ * Only cpu backend runs float16 operations, so the compiler runs this pass only when all the
+ * operations go to cpu.
+ */
+class Fp16ConversionPass : public Pass
+{
+public:
+  using Pass::Pass;
+
+public:
+  std::string id() final { return "Fp16ConversionPass"; }
+
+public:
+  void run() override;
+
+public:
+  static const std::vector<ir::OpCode> &convertibleOpCodes();
+
+private:
+  bool isConvertible(const ir::Operation &op) const;
+  void convertOperand(const ir::OperandIndex &index);
+  ir::OperandIndex halfConstant(const ir::OperandIndex &index);
+  void replaceConvertedUses(const ir::OperandIndex &from, const ir::OperandIndex &to);
+
+private:
+  std::unordered_set<ir::OperationIndex> _converted;
+  std::unordered_map<ir::OperandIndex, ir::OperandIndex> _half_constants;
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_FP16_CONVERSION_PASS_H__
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Fp16ConversionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/Softmax.h"
+
+#include <cker/Fp16.h>
+
+#include <gtest/gtest.h>
+
+using namespace onert::ir;
+using namespace onert::compiler::pass;
+
+namespace
+{
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const std::vector<float> &values)
+{
+  auto ind = graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+  graph.setOperandValue(ind, std::make_shared<CachedData>(
+                               reinterpret_cast<const uint8_t *>(values.data()),
+                               values.size() * sizeof(float)));
+  return ind;
+}
+
+void addFullyConnected(Graph &graph, OperandIndex in, OperandIndex weights, OperandIndex out)
+{
+  graph.addOperation(std::make_unique<operation::FullyConnected>(
+    OperandIndexSequence{in, weights, OperandIndex{}}, OperandIndexSequence{out},
+    operation::FullyConnected::Param{Activation::NONE, FullyConnectedWeightsFormat::Default}));
+}
+
+void addSoftmax(Graph &graph, OperandIndex in, OperandIndex out)
+{
+  graph.addOperation(std::make_unique<operation::Softmax>(
+    OperandIndexSequence{in}, OperandIndexSequence{out}, operation::Softmax::Param{1.f}));
+}
+
+OpCode defOpCode(const Graph &graph, OperandIndex operand)
+{
+  return graph.operations().at(graph.operands().at(operand).getDef()).opcode();
+}
+
+} // namespace
+
+TEST(Fp16ConversionPass, convert_chain)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 3}, type);
+  auto weights = addConstant(graph, Shape{2, 3}, {1.f, 0.5f, -2.f, 0.25f, 3.f, -1.f});
+  auto fc_out = graph.addOperand(Shape{1, 2}, type);
+  auto out = graph.addOperand(Shape{1, 2}, type);
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  addFullyConnected(graph, in, weights, fc_out);
+  addSoftmax(graph, fc_out, out);
+
+  Fp16ConversionPass{graph}.run();
+
+  // FullyConnected and Softmax, and the conversions of the input and the output
+  ASSERT_EQ(graph.operations().size(), 4);
+  ASSERT_EQ(graph.operands().at(in).typeInfo().type(), DataType::FLOAT32);
+  ASSERT_EQ(graph.operands().at(out).typeInfo().type(), DataType::FLOAT32);
+  ASSERT_EQ(graph.operands().at(fc_out).typeInfo().type(), DataType::FLOAT16);
+  ASSERT_EQ(defOpCode(graph, out), OpCode::ConvertFp16ToFp32);
+  ASSERT_EQ(defOpCode(graph, fc_out), OpCode::FullyConnected);
+
+  const auto &fc = graph.operations().at(graph.operands().at(fc_out).getDef());
+  const auto half_in = fc.getInputs().at(operation::FullyConnected::Input::INPUT);
+  ASSERT_EQ(graph.operands().at(half_in).typeInfo().type(), DataType::FLOAT16);
+  ASSERT_EQ(defOpCode(graph, half_in), OpCode::ConvertFp32ToFp16);
+
+  // Weights are copied in float16, and the float32 ones are left unused
+  const auto half_weights = fc.getInputs().at(operation::FullyConnected::Input::WEIGHT);
+  const auto &half_weights_operand = graph.operands().at(half_weights);
+  ASSERT_TRUE(half_weights_operand.isConstant());
+  ASSERT_EQ(half_weights_operand.typeInfo().type(), DataType::FLOAT16);
+  ASSERT_EQ(half_weights_operand.data()->size(), 6 * sizeof(nnfw::cker::float16));
+  const auto *half_values =
+    reinterpret_cast<const nnfw::cker::float16 *>(half_weights_operand.data()->base());
+  ASSERT_EQ(nnfw::cker::Fp16ToFloat(half_values[1]), 0.5f);
+  ASSERT_EQ(nnfw::cker::Fp16ToFloat(half_values[2]), -2.f);
+  ASSERT_EQ(graph.operands().at(weights).getUses().size(), 0);
+}
+
+TEST(Fp16ConversionPass, convert_back_for_unconverted_use)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto lhs = graph.addOperand(Shape{2, 4}, type);
+  auto rhs = graph.addOperand(Shape{4}, type);
+  auto sum = graph.addOperand(Shape{2, 4}, type);
+  auto probs = graph.addOperand(Shape{2, 4}, type);
+  auto relu = graph.addOperand(Shape{2, 4}, type);
+  graph.addInput(lhs);
+  graph.addInput(rhs);
+  graph.addOutput(probs);
+  graph.addOutput(relu);
+
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{sum},
+    operation::BinaryArithmetic::Param{operation::BinaryArithmetic::ArithmeticType::ADD,
+                                       Activation::NONE}));
+  addSoftmax(graph, sum, probs);
+  operation::ElementwiseActivation::Param relu_param;
+  relu_param.op_type = operation::ElementwiseActivation::Type::RELU;
+  graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+    OperandIndexSequence{sum}, OperandIndexSequence{relu}, relu_param));
+
+  Fp16ConversionPass{graph}.run();
+
+  // The sum stays float32 for ReLU, and Softmax takes the float16 result of Add
+  ASSERT_EQ(graph.operands().at(sum).typeInfo().type(), DataType::FLOAT32);
+  ASSERT_EQ(defOpCode(graph, sum), OpCode::ConvertFp16ToFp32);
+  const auto &softmax = graph.operations().at(graph.operands().at(probs).getDef());
+  ASSERT_EQ(softmax.opcode(), OpCode::ConvertFp16ToFp32);
+  const auto half_probs = softmax.getInputs().at(0);
+  const auto &half_softmax = graph.operations().at(graph.operands().at(half_probs).getDef());
+  ASSERT_EQ(half_softmax.opcode(), OpCode::Softmax);
+  const auto half_sum = half_softmax.getInputs().at(0);
+  ASSERT_EQ(graph.operands().at(half_sum).typeInfo().type(), DataType::FLOAT16);
+  ASSERT_EQ(defOpCode(graph, half_sum), OpCode::BinaryArithmetic);
+  ASSERT_EQ(graph.operands().at(half_sum).getUses().size(), 2);
+}
+
+TEST(Fp16ConversionPass, neg_int32)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::INT32};
+  auto lhs = graph.addOperand(Shape{4}, type);
+  auto rhs = graph.addOperand(Shape{4}, type);
+  auto out = graph.addOperand(Shape{4}, type);
+  graph.addInput(lhs);
+  graph.addInput(rhs);
+  graph.addOutput(out);
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{out},
+    operation::BinaryArithmetic::Param{operation::BinaryArithmetic::ArithmeticType::MUL,
+                                       Activation::NONE}));
+
+  Fp16ConversionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  ASSERT_EQ(graph.operands().size(), 3);
+  ASSERT_EQ(graph.operands().at(out).typeInfo().type(), DataType::INT32);
+}
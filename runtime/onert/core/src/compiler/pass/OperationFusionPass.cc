@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/BroadcastTo.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/Tile.h"
+#include "util/logging.h"
+#include "util/ShapeInference.h"
+
+#include <cstring>
+
+namespace
+{
+
+using namespace onert::ir;
+
+bool isWeighted(OpCode opcode)
+{
+  return opcode == OpCode::Conv2D || opcode == OpCode::DepthwiseConv2D ||
+         opcode == OpCode::FullyConnected;
+}
+
+bool getActivation(const Operation &op, Activation &activation)
+{
+  switch (op.opcode())
+  {
+    case OpCode::Conv2D:
+      activation = static_cast<const operation::Conv2D &>(op).param().activation;
+      return true;
+    case OpCode::DepthwiseConv2D:
+      activation = static_cast<const operation::DepthwiseConv2D &>(op).param().activation;
+      return true;
+    case OpCode::FullyConnected:
+      activation = static_cast<const operation::FullyConnected &>(op).param().activation;
+      return true;
+    case OpCode::BinaryArithmetic:
+      activation = static_cast<const operation::BinaryArithmetic &>(op).param().activation;
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Find the fused activation type which is the same with the given ReLU
+bool toClampActivation(const operation::ElementwiseActivation::Param &param,
+                       Activation &activation)
+{
+  if (param.op_type != operation::ElementwiseActivation::Type::RELU)
+    return false;
+
+  if (param.alpha == operation::ElementwiseActivation::infinity && param.beta == 0.f)
+    activation = Activation::RELU;
+  else if (param.alpha == 6.f && param.beta == 0.f)
+    activation = Activation::RELU6;
+  else if (param.alpha == 1.f && param.beta == -1.f)
+    activation = Activation::RELU1;
+  else
+    return false;
+
+  return true;
+}
+
+std::vector<float> getFloatData(const Operand &operand)
+{
+  assert(operand.isConstant() && operand.typeInfo().type() == DataType::FLOAT32);
+  std::vector<float> values(operand.data()->size() / sizeof(float));
+  std::memcpy(values.data(), operand.data()->base(), values.size() * sizeof(float));
+  return values;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+void OperationFusionPass::run()
+{
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+
+    std::vector<ir::OperationIndex> candidates;
+    _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &op) {
+      if (op.opcode() == ir::OpCode::ElementwiseActivation ||
+          op.opcode() == ir::OpCode::BinaryArithmetic || op.opcode() == ir::OpCode::BroadcastTo ||
+          op.opcode() == ir::OpCode::Tile)
+        candidates.emplace_back(index);
+    });
+
+    for (const auto &index : candidates)
+    {
+      // The candidate could be merged into its producer already
+      if (!_graph.operations().exist(index))
+        continue;
+
+      const auto opcode = _graph.operations().at(index).opcode();
+      if (opcode == ir::OpCode::ElementwiseActivation)
+        changed |= fuseActivation(index);
+      else if (opcode == ir::OpCode::BinaryArithmetic)
+        changed |= fuseBinaryArithmetic(index);
+      else
+        changed |= eliminateBroadcast(index);
+    }
+  }
+}
+
+bool OperationFusionPass::fuseActivation(const ir::OperationIndex &index)
+{
+  const auto &op = static_cast<const ir::operation::ElementwiseActivation &>(
+    _graph.operations().at(index));
+
+  ir::Activation activation;
+  if (!toClampActivation(op.param(), activation))
+    return false;
+
+  const auto producer = fusableProducer(op.getInputs().at(0), false);
+  if (!producer.valid())
+    return false;
+
+  VERBOSE(OperationFusionPass) << "Fuse " << op.name() << "(" << index << ") into "
+                               << _graph.operations().at(producer).name() << "(" << producer
+                               << ")" << std::endl;
+
+  mergeConsumer(producer, index);
+  setActivation(producer, activation);
+  return true;
+}
+
+bool OperationFusionPass::fuseBinaryArithmetic(const ir::OperationIndex &index)
+{
+  using ir::operation::BinaryArithmetic;
+
+  const auto &op = static_cast<const BinaryArithmetic &>(_graph.operations().at(index));
+  const auto type = op.param().arithmetic_type;
+  if (type != BinaryArithmetic::ArithmeticType::ADD &&
+      type != BinaryArithmetic::ArithmeticType::MUL)
+    return false;
+
+  for (uint32_t side = 0; side < 2; ++side)
+  {
+    const auto input = op.getInputs().at(side);
+    const auto constant = op.getInputs().at(1 - side);
+
+    const auto producer = fusableProducer(input, true);
+    if (!producer.valid())
+      continue;
+
+    const auto &shape = _graph.operands().at(input).shape();
+    if (shape.rank() == 0 || shape.hasUnspecifiedDims() ||
+        _graph.operands().at(op.getOutputs().at(0)).shape() != shape)
+      continue;
+
+    const auto num_channels = shape.dim(shape.rank() - 1);
+    if (!isPerChannelConstant(constant, num_channels))
+      continue;
+
+    const auto &prod_op = _graph.operations().at(producer);
+    const auto opcode = prod_op.opcode();
+    // Every weighted operation has the same indices for weights and bias
+    static_assert(ir::operation::Conv2D::Input::KERNEL == 1 &&
+                    ir::operation::DepthwiseConv2D::Input::KERNEL == 1 &&
+                    ir::operation::FullyConnected::Input::WEIGHT == 1,
+                  "Weights index must be 1");
+    static_assert(ir::operation::Conv2D::Input::BIAS == 2 &&
+                    ir::operation::DepthwiseConv2D::Input::BIAS == 2 &&
+                    ir::operation::FullyConnected::Input::BIAS == 2,
+                  "Bias index must be 2");
+    if (prod_op.getInputs().size() < 3)
+      continue;
+    const auto weights = prod_op.getInputs().at(1);
+    const auto bias = prod_op.getInputs().at(2);
+
+    // Check bias
+    if (bias.valid())
+    {
+      const auto &bias_obj = _graph.operands().at(bias);
+      if (!bias_obj.isConstant() || bias_obj.typeInfo().type() != ir::DataType::FLOAT32 ||
+          bias_obj.shape().num_elements() != static_cast<uint64_t>(num_channels))
+        continue;
+    }
+
+    // Check weights
+    const auto &weights_obj = _graph.operands().at(weights);
+    const auto &weights_shape = weights_obj.shape();
+    const bool is_depthwise = (opcode == ir::OpCode::DepthwiseConv2D);
+    if (type == BinaryArithmetic::ArithmeticType::MUL)
+    {
+      if (!weights_obj.isConstant() || weights_obj.typeInfo().type() != ir::DataType::FLOAT32 ||
+          weights_obj.typeInfo().sparsity() != nullptr)
+        continue;
+      // Output channel is the last dimension for depthwise conv, the first one for others
+      const auto out_channels =
+        is_depthwise ? weights_shape.dim(weights_shape.rank() - 1) : weights_shape.dim(0);
+      if (out_channels != num_channels)
+        continue;
+      if (opcode == ir::OpCode::FullyConnected &&
+          static_cast<const ir::operation::FullyConnected &>(prod_op).param().weights_format !=
+            ir::FullyConnectedWeightsFormat::Default)
+        continue;
+    }
+
+    VERBOSE(OperationFusionPass) << "Fuse " << op.name() << "(" << index << ") into "
+                                 << prod_op.name() << "(" << producer << ")" << std::endl;
+
+    // Broadcast the constant to the number of channels
+    auto factors = getFloatData(_graph.operands().at(constant));
+    if (factors.size() == 1)
+      factors.resize(num_channels, factors[0]);
+
+    auto bias_values =
+      bias.valid() ? getFloatData(_graph.operands().at(bias)) : std::vector<float>(num_channels);
+    for (int32_t c = 0; c < num_channels; ++c)
+    {
+      if (type == BinaryArithmetic::ArithmeticType::ADD)
+        bias_values[c] += factors[c];
+      else
+        bias_values[c] *= factors[c];
+    }
+
+    if (type == BinaryArithmetic::ArithmeticType::MUL)
+    {
+      auto weights_values = getFloatData(weights_obj);
+      const auto inner_size = weights_values.size() / num_channels;
+      for (size_t i = 0; i < weights_values.size(); ++i)
+      {
+        const auto c = is_depthwise ? (i % num_channels) : (i / inner_size);
+        weights_values[i] *= factors[c];
+      }
+      replaceInput(producer, weights, addConstant(weights, std::move(weights_values)));
+    }
+
+    // Bias could be optional, so make its operand look like the constant of channels
+    const auto new_bias = addConstant(bias.valid() ? bias : constant, std::move(bias_values));
+    if (!bias.valid())
+      _graph.operands().at(new_bias).info().shape(ir::Shape{num_channels});
+    replaceInput(producer, bias, new_bias);
+
+    const auto activation = op.param().activation;
+    mergeConsumer(producer, index);
+    setActivation(producer, activation);
+    return true;
+  }
+
+  return false;
+}
+
+bool OperationFusionPass::eliminateBroadcast(const ir::OperationIndex &index)
+{
+  const auto &op = _graph.operations().at(index);
+  static_assert(ir::operation::BroadcastTo::Input::INPUT == 0 &&
+                  ir::operation::Tile::Input::INPUT == 0,
+                "Input index must be 0");
+  const auto input = op.getInputs().at(0);
+  const auto output = op.getOutputs().at(0);
+  if (_graph.getOutputs().contains(output))
+    return false;
+
+  const auto &input_obj = _graph.operands().at(input);
+  const auto &output_obj = _graph.operands().at(output);
+  const auto &input_shape = input_obj.shape();
+  const auto &output_shape = output_obj.shape();
+  if (input_obj.typeInfo().type() != ir::DataType::FLOAT32 || input_shape.hasUnspecifiedDims() ||
+      output_shape.hasUnspecifiedDims() || output_obj.getUses().size() == 0)
+    return false;
+
+  if (op.opcode() == ir::OpCode::Tile)
+  {
+    // Tile of dimensions of size 1 is the same with broadcast
+    const auto &multiples = _graph.operands().at(op.getInputs().at(ir::operation::Tile::MULTIPLES));
+    if (!multiples.isConstant() || multiples.typeInfo().type() != ir::DataType::INT32 ||
+        input_shape.rank() != output_shape.rank())
+      return false;
+    const auto multiples_values = multiples.asVector<int32_t>();
+    for (int32_t i = 0; i < input_shape.rank(); ++i)
+    {
+      if (multiples_values.at(i) != 1 && input_shape.dim(i) != 1)
+        return false;
+    }
+  }
+
+  // Every consumer must get the same output with the input not broadcasted
+  for (const auto &use : output_obj.getUses())
+  {
+    const auto &use_op = _graph.operations().at(use);
+    if (use_op.opcode() != ir::OpCode::BinaryArithmetic)
+      return false;
+
+    const auto lhs = use_op.getInputs().at(ir::operation::BinaryArithmetic::Input::LHS);
+    const auto rhs = use_op.getInputs().at(ir::operation::BinaryArithmetic::Input::RHS);
+    if (lhs == rhs)
+      return false;
+    const auto &other_shape = _graph.operands().at(lhs == output ? rhs : lhs).shape();
+    const auto &use_output_shape = _graph.operands().at(use_op.getOutputs().at(0)).shape();
+    // Kernels broadcast up to 4 dimensions
+    if (other_shape.hasUnspecifiedDims() || use_output_shape.hasUnspecifiedDims() ||
+        use_output_shape.rank() > 4)
+      return false;
+    try
+    {
+      if (shape_inference::inferEltwiseShape(input_shape, other_shape) != use_output_shape)
+        return false;
+    }
+    catch (const std::runtime_error &)
+    {
+      // Shapes are not broadcastable
+      return false;
+    }
+  }
+
+  VERBOSE(OperationFusionPass) << "Eliminate " << op.name() << "(" << index << ")" << std::endl;
+
+  const auto uses = output_obj.getUses();
+  for (const auto &use : uses)
+    replaceInput(use, output, input);
+
+  for (const auto &op_input : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(op_input).removeUse(index);
+  _graph.operations().remove(index);
+  _graph.removeOperand(output);
+  return true;
+}
+
+ir::OperationIndex OperationFusionPass::fusableProducer(const ir::OperandIndex &operand,
+                                                       bool weighted_only)
+{
+  if (_graph.getInputs().contains(operand) || _graph.getOutputs().contains(operand))
+    return ir::OperationIndex{};
+
+  const auto &obj = _graph.operands().at(operand);
+  if (obj.getUses().size() != 1 || !obj.getDef().valid() || obj.isConstant() ||
+      obj.typeInfo().type() != ir::DataType::FLOAT32)
+    return ir::OperationIndex{};
+
+  const auto &producer = _graph.operations().at(obj.getDef());
+  if (producer.getOutputs().size() != 1)
+    return ir::OperationIndex{};
+  if (weighted_only && !isWeighted(producer.opcode()))
+    return ir::OperationIndex{};
+
+  ir::Activation activation;
+  if (!getActivation(producer, activation) || activation != ir::Activation::NONE)
+    return ir::OperationIndex{};
+
+  return obj.getDef();
+}
+
+bool OperationFusionPass::isPerChannelConstant(const ir::OperandIndex &operand,
+                                               int32_t num_channels)
+{
+  const auto &obj = _graph.operands().at(operand);
+  if (!obj.isConstant() || obj.typeInfo().type() != ir::DataType::FLOAT32)
+    return false;
+
+  const auto &shape = obj.shape();
+  if (shape.num_elements() == 1)
+    return true;
+
+  // Only the last(channel) dimension can be larger than 1
+  if (shape.rank() == 0 || shape.dim(shape.rank() - 1) != num_channels)
+    return false;
+  for (int32_t i = 0; i < shape.rank() - 1; ++i)
+  {
+    if (shape.dim(i) != 1)
+      return false;
+  }
+  return true;
+}
+
+ir::OperandIndex OperationFusionPass::addConstant(const ir::OperandIndex &like,
+                                                  std::vector<float> &&values)
+{
+  const auto &like_obj = _graph.operands().at(like);
+  auto index = _graph.addOperand(like_obj.shape(), like_obj.typeInfo());
+  auto data = std::make_shared<ir::CachedData>(reinterpret_cast<const uint8_t *>(values.data()),
+                                               values.size() * sizeof(float));
+  _graph.setOperandValue(index, std::move(data));
+  return index;
+}
+
+void OperationFusionPass::replaceInput(const ir::OperationIndex &index,
+                                       const ir::OperandIndex &from, const ir::OperandIndex &to)
+{
+  auto &op = _graph.operations().at(index);
+  if (from.valid())
+  {
+    _graph.operands().at(from).removeUse(index);
+    op.replaceInputs(from, to);
+  }
+  else
+  {
+    // Optional bias is the only undefined input to be replaced
+    ir::OperandIndexSequence inputs;
+    for (uint32_t i = 0; i < op.getInputs().size(); ++i)
+      inputs.append(i == 2 ? to : op.getInputs().at(i));
+    op.setInputs(inputs);
+  }
+  _graph.operands().at(to).insertUse(index);
+}
+
+void OperationFusionPass::mergeConsumer(const ir::OperationIndex &producer,
+                                        const ir::OperationIndex &consumer)
+{
+  auto &prod_op = _graph.operations().at(producer);
+  const auto &cons_op = _graph.operations().at(consumer);
+
+  const auto intermediate = prod_op.getOutputs().at(0);
+  const auto output = cons_op.getOutputs().at(0);
+
+  for (const auto &input : cons_op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(input).removeUse(consumer);
+
+  prod_op.replaceOutputs(intermediate, output);
+  _graph.operands().at(output).setDef(producer);
+
+  _graph.operations().remove(consumer);
+  _graph.removeOperand(intermediate);
+}
+
+void OperationFusionPass::setActivation(const ir::OperationIndex &index,
+                                        ir::Activation activation)
+{
+  const auto &op = _graph.operations().at(index);
+
+  std::unique_ptr<ir::Operation> new_op;
+  switch (op.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    {
+      auto param = static_cast<const ir::operation::Conv2D &>(op).param();
+      param.activation = activation;
+      new_op = std::make_unique<ir::operation::Conv2D>(op.getInputs(), op.getOutputs(), param);
+      break;
+    }
+    case ir::OpCode::DepthwiseConv2D:
+    {
+      auto param = static_cast<const ir::operation::DepthwiseConv2D &>(op).param();
+      param.activation = activation;
+      new_op =
+        std::make_unique<ir::operation::DepthwiseConv2D>(op.getInputs(), op.getOutputs(), param);
+      break;
+    }
+    case ir::OpCode::FullyConnected:
+    {
+      auto param = static_cast<const ir::operation::FullyConnected &>(op).param();
+      param.activation = activation;
+      new_op =
+        std::make_unique<ir::operation::FullyConnected>(op.getInputs(), op.getOutputs(), param);
+      break;
+    }
+    case ir::OpCode::BinaryArithmetic:
+    {
+      auto param = static_cast<const ir::operation::BinaryArithmetic &>(op).param();
+      param.activation = activation;
+      new_op =
+        std::make_unique<ir::operation::BinaryArithmetic>(op.getInputs(), op.getOutputs(), param);
+      break;
+    }
+    default:
+      throw std::runtime_error{"OperationFusionPass: Unsupported operation to set activation"};
+  }
+
+  _graph.operations().set(index, std::move(new_op));
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
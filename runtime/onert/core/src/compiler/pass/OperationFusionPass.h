@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
+#define __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
+
+#include "Pass.h"
+#include "ir/Index.h"
+#include "ir/InternalType.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief Pass to fuse chains of operations that come unfused from the model
+ *
+ * This pass handles float32 operations only and removes the intermediate operands between fused
+ * operations. Constants that become unused are left for UnusedOperandEliminationPass.
+ *
+ * Case 1 : Clamping activation after an operation with fused activation parameter
+ *
+ * ReLU, ReLU1 and ReLU6 following Conv2D, DepthwiseConv2D, FullyConnected or BinaryArithmetic
+ * are merged into the activation parameter of the producer.
+ *
+ * ```
+ * [Conv2D(act=NONE)] -> ((#1)) -> [ReLU6] -> ((#2))
+ * becomes
+ * [Conv2D(act=RELU6)] -> ((#2))
+ * ```
+ *
+ * Case 2 : Add or Mul with per-channel constant after Conv2D, DepthwiseConv2D or FullyConnected
+ *
+ * Add is folded into the bias and Mul is folded into both of the weights and the bias. The
+ * activation of Add or Mul is moved to the producer.
+ *
+ * ```
+ * [Conv2D(W, B)] -> ((#1)) -> [Mul(S, act=RELU)] -> ((#2))
+ * becomes
+ * [Conv2D(W * S, B * S, act=RELU)] -> ((#2))
+ * ```
+ *
+ * Case 3 : BroadcastTo or Tile consumed only by BinaryArithmetic
+ *
+ * BinaryArithmetic kernels broadcast their inputs by themselves without expanding them, so the
+ * expanded tensor is not written at all. Tile is handled only if it tiles dimensions of size 1.
+ *
+ * ```
+ * ((#1)) -> [BroadcastTo] -> ((#2)) -> [Add(#2, #3)] -> ((#4))
+ * becomes
+ * ((#1)) -> [Add(#1, #3)] -> ((#4))
+ * ```
+ */
+class OperationFusionPass : public Pass
+{
+public:
+  using Pass::Pass;
+
+public:
+  std::string id() final { return "OperationFusionPass"; }
+
+public:
+  void run() override;
+
+private:
+  bool fuseActivation(const ir::OperationIndex &index);
+  bool fuseBinaryArithmetic(const ir::OperationIndex &index);
+  bool eliminateBroadcast(const ir::OperationIndex &index);
+  ir::OperationIndex fusableProducer(const ir::OperandIndex &operand, bool weighted_only);
+  bool isPerChannelConstant(const ir::OperandIndex &operand, int32_t num_channels);
+  ir::OperandIndex addConstant(const ir::OperandIndex &like, std::vector<float> &&values);
+  void replaceInput(const ir::OperationIndex &index, const ir::OperandIndex &from,
+                    const ir::OperandIndex &to);
+  void mergeConsumer(const ir::OperationIndex &producer, const ir::OperationIndex &consumer);
+  void setActivation(const ir::OperationIndex &index, ir::Activation activation);
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/BroadcastTo.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/Tile.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::ir;
+using namespace onert::compiler::pass;
+
+namespace
+{
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const std::vector<float> &values)
+{
+  auto ind = graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+  graph.setOperandValue(ind, std::make_shared<CachedData>(
+                               reinterpret_cast<const uint8_t *>(values.data()),
+                               values.size() * sizeof(float)));
+  return ind;
+}
+
+// in -> [FC] -> mid
+OperationIndex addFullyConnected(Graph &graph, OperandIndex in, OperandIndex mid)
+{
+  auto weights = addConstant(graph, Shape{2, 2}, {1.f, 2.f, 3.f, 4.f});
+  auto bias = addConstant(graph, Shape{2}, {1.f, 1.f});
+
+  operation::FullyConnected::Param param;
+  param.activation = Activation::NONE;
+  param.weights_format = FullyConnectedWeightsFormat::Default;
+  return graph.addOperation(
+    std::make_unique<operation::FullyConnected>(OperandIndexSequence{in, weights, bias},
+                                                OperandIndexSequence{mid}, param));
+}
+
+} // namespace
+
+TEST(OperationFusionPass, fuse_relu6)
+{
+  Graph graph;
+
+  Shape shape{1, 2};
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(shape, type);
+  auto mid = graph.addOperand(shape, type);
+  auto out = graph.addOperand(shape, type);
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  auto fc = addFullyConnected(graph, in, mid);
+  operation::ElementwiseActivation::Param act_param;
+  act_param.op_type = operation::ElementwiseActivation::Type::RELU;
+  act_param.alpha = 6.f;
+  act_param.beta = 0.f;
+  graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+    OperandIndexSequence{mid}, OperandIndexSequence{out}, act_param));
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  ASSERT_FALSE(graph.operands().exist(mid));
+  const auto &fc_op = static_cast<const operation::FullyConnected &>(graph.operations().at(fc));
+  ASSERT_EQ(fc_op.param().activation, Activation::RELU6);
+  ASSERT_EQ(fc_op.getOutputs().at(0), out);
+  ASSERT_EQ(graph.operands().at(out).getDef(), fc);
+}
+
+TEST(OperationFusionPass, fold_mul)
+{
+  Graph graph;
+
+  Shape shape{1, 2};
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(shape, type);
+  auto mid = graph.addOperand(shape, type);
+  auto out = graph.addOperand(shape, type);
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  auto fc = addFullyConnected(graph, in, mid);
+  auto scale = addConstant(graph, Shape{2}, {2.f, 3.f});
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{mid, scale}, OperandIndexSequence{out},
+    operation::BinaryArithmetic::Param{operation::BinaryArithmetic::ArithmeticType::MUL,
+                                       Activation::RELU}));
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  const auto &fc_op = static_cast<const operation::FullyConnected &>(graph.operations().at(fc));
+  ASSERT_EQ(fc_op.param().activation, Activation::RELU);
+
+  const auto weights = graph.operands().at(fc_op.getInputs().at(1)).asVector<float>();
+  const auto bias = graph.operands().at(fc_op.getInputs().at(2)).asVector<float>();
+  ASSERT_EQ(weights, (std::vector<float>{2.f, 4.f, 9.f, 12.f}));
+  ASSERT_EQ(bias, (std::vector<float>{2.f, 3.f}));
+}
+
+TEST(OperationFusionPass, neg_intermediate_is_output)
+{
+  Graph graph;
+
+  Shape shape{1, 2};
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(shape, type);
+  auto mid = graph.addOperand(shape, type);
+  auto out = graph.addOperand(shape, type);
+  graph.addInput(in);
+  graph.addOutput(mid);
+  graph.addOutput(out);
+
+  addFullyConnected(graph, in, mid);
+  operation::ElementwiseActivation::Param act_param;
+  act_param.op_type = operation::ElementwiseActivation::Type::RELU;
+  act_param.alpha = operation::ElementwiseActivation::infinity;
+  act_param.beta = 0.f;
+  graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+    OperandIndexSequence{mid}, OperandIndexSequence{out}, act_param));
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 2);
+  ASSERT_TRUE(graph.operands().exist(mid));
+}
+
+TEST(OperationFusionPass, eliminate_broadcast_to)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 2}, type);
+  auto other = graph.addOperand(Shape{3, 2}, type);
+  auto mid = graph.addOperand(Shape{3, 2}, type);
+  auto out = graph.addOperand(Shape{3, 2}, type);
+  graph.addInput(in);
+  graph.addInput(other);
+  graph.addOutput(out);
+
+  std::vector<int32_t> shape_values{3, 2};
+  auto shape = graph.addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  graph.setOperandValue(shape, std::make_shared<CachedData>(
+                                 reinterpret_cast<const uint8_t *>(shape_values.data()),
+                                 shape_values.size() * sizeof(int32_t)));
+  graph.addOperation(std::make_unique<operation::BroadcastTo>(OperandIndexSequence{in, shape},
+                                                              OperandIndexSequence{mid}));
+  auto add = graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{mid, other}, OperandIndexSequence{out},
+    operation::BinaryArithmetic::Param{operation::BinaryArithmetic::ArithmeticType::ADD,
+                                       Activation::NONE}));
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  ASSERT_FALSE(graph.operands().exist(mid));
+  ASSERT_EQ(graph.operations().at(add).getInputs().at(0), in);
+  ASSERT_TRUE(graph.operands().at(in).getUses().contains(add));
+}
+
+TEST(OperationFusionPass, neg_tile_non_unit_dim)
+{
+  Graph graph;
+
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 2}, type);
+  auto other = graph.addOperand(Shape{1, 4}, type);
+  auto mid = graph.addOperand(Shape{1, 4}, type);
+  auto out = graph.addOperand(Shape{1, 4}, type);
+  graph.addInput(in);
+  graph.addInput(other);
+  graph.addOutput(out);
+
+  std::vector<int32_t> multiples_values{1, 2};
+  auto multiples = graph.addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  graph.setOperandValue(multiples, std::make_shared<CachedData>(
+                                     reinterpret_cast<const uint8_t *>(multiples_values.data()),
+                                     multiples_values.size() * sizeof(int32_t)));
+  graph.addOperation(std::make_unique<operation::Tile>(OperandIndexSequence{in, multiples},
+                                                       OperandIndexSequence{mid}));
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{mid, other}, OperandIndexSequence{out},
+    operation::BinaryArithmetic::Param{operation::BinaryArithmetic::ArithmeticType::ADD,
+                                       Activation::NONE}));
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 2);
+  ASSERT_TRUE(graph.operands().exist(mid));
+}
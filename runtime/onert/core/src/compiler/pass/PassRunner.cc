@@ -16,6 +16,8 @@
 
 #include "PassRunner.h"
 
+#include "util/HeapPhase.h"
+
 namespace onert
 {
 namespace compiler
@@ -34,7 +36,10 @@ void PassRunner::run()
   for (auto &pass : _passes)
   {
     VERBOSE(PassRunner) << "Start running '" << pass->id() << "'" << std::endl;
-    pass->run();
+    {
+      util::HeapPhase phase{std::string{"pass/"} + pass->id()};
+      pass->run();
+    }
     VERBOSE(PassRunner) << "Finished running '" << pass->id() << "'" << std::endl;
     // TODO Dump graph?
   }
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/AsyncTransfers.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+thread_local AsyncTransfers *current_transfers = nullptr;
+
+} // namespace
+
+AsyncTransfers::Scope::Scope(AsyncTransfers &transfers) : _prev{current_transfers}
+{
+  current_transfers = &transfers;
+}
+
+AsyncTransfers::Scope::~Scope() { current_transfers = _prev; }
+
+bool AsyncTransfers::defer(backend::ITensor *tensor)
+{
+  if (current_transfers == nullptr)
+    return false;
+
+  current_transfers->_tensors.emplace_back(tensor);
+  return true;
+}
+
+bool AsyncTransfers::defer(IPending *pending)
+{
+  if (current_transfers == nullptr)
+    return false;
+
+  current_transfers->_pendings.emplace_back(pending);
+  return true;
+}
+
+bool AsyncTransfers::done() const
+{
+  return std::all_of(_tensors.begin(), _tensors.end(),
+                     [](backend::ITensor *tensor) { return tensor->isTransferDone(); }) &&
+         std::all_of(_pendings.begin(), _pendings.end(),
+                     [](IPending *pending) { return pending->done(); });
+}
+
+void AsyncTransfers::wait()
+{
+  for (auto tensor : _tensors)
+    tensor->waitTransfer();
+  _tensors.clear();
+  for (auto pending : _pendings)
+    pending->wait();
+  _pendings.clear();
+}
+
+} // namespace exec
+} // namespace onert
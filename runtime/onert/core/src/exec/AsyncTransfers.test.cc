@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/AsyncTransfers.h"
+
+#include "backend/basic/Tensor.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+
+namespace
+{
+
+class MockUpTensor : public backend::basic::Tensor
+{
+public:
+  MockUpTensor()
+    : Tensor{ir::OperandInfo{ir::Shape{1}, ir::TypeInfo{ir::DataType::FLOAT32},
+                             ir::MemAllocType::STATIC, false},
+             ir::Layout::NHWC, nullptr}
+  {
+  }
+
+public:
+  bool isTransferDone() override { return _done; }
+  void waitTransfer() override { _done = true; }
+
+private:
+  bool _done = false;
+};
+
+class MockUpPending : public exec::AsyncTransfers::IPending
+{
+public:
+  bool done() override { return _done; }
+  void wait() override { _done = true; }
+
+private:
+  bool _done = false;
+};
+
+} // namespace
+
+TEST(AsyncTransfers, defer_in_scope)
+{
+  MockUpTensor tensor;
+  exec::AsyncTransfers transfers;
+  {
+    exec::AsyncTransfers::Scope scope{transfers};
+    ASSERT_TRUE(exec::AsyncTransfers::defer(&tensor));
+  }
+  ASSERT_FALSE(transfers.empty());
+  ASSERT_FALSE(transfers.done());
+
+  transfers.wait();
+  ASSERT_TRUE(transfers.empty());
+  ASSERT_TRUE(tensor.isTransferDone());
+}
+
+TEST(AsyncTransfers, defer_pending_in_scope)
+{
+  MockUpPending pending;
+  exec::AsyncTransfers transfers;
+  {
+    exec::AsyncTransfers::Scope scope{transfers};
+    ASSERT_TRUE(exec::AsyncTransfers::defer(&pending));
+  }
+  ASSERT_FALSE(transfers.empty());
+  ASSERT_FALSE(transfers.done());
+
+  transfers.wait();
+  ASSERT_TRUE(transfers.empty());
+  ASSERT_TRUE(pending.done());
+}
+
+TEST(AsyncTransfers, neg_defer_without_scope)
+{
+  MockUpTensor tensor;
+  exec::AsyncTransfers transfers;
+  {
+    exec::AsyncTransfers::Scope scope{transfers};
+  }
+  ASSERT_FALSE(exec::AsyncTransfers::defer(&tensor));
+  MockUpPending pending;
+  ASSERT_FALSE(exec::AsyncTransfers::defer(&pending));
+  ASSERT_TRUE(transfers.empty());
+}
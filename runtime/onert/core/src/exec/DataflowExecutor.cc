@@ -16,7 +16,10 @@
 
 #include "DataflowExecutor.h"
 
+#include "exec/AsyncTransfers.h"
+
 #include <cassert>
+#include <unordered_map>
 
 #include "util/logging.h"
 
@@ -102,23 +105,20 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
   _output_info.resize(next_job_index);
   _initial_input_info.resize(next_job_index, 0);
 
-  operations.iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+  // Update output and input info from def-use chains which costs linear time of graph size
+  const auto &consumers = _lowered_graph->consumers();
+  operations.iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &) {
     auto job_index = op_to_job[op_ind];
-    for (auto output : op.getOutputs())
+    for (const auto &consumer : consumers.at(op_ind))
     {
-      // Update output and input info
-      operations.iterate([&](const ir::OperationIndex &op_cur_ind, const ir::Operation &op_cur) {
-        if (op_cur.getInputs().contains(output))
-        {
-          auto dep_index = op_to_job[op_cur_ind];
-          ++_initial_input_info[dep_index];
-          _output_info[job_index].push_back(dep_index);
-        }
-      });
+      auto dep_index = op_to_job[consumer];
+      ++_initial_input_info[dep_index];
+      _output_info[job_index].push_back(dep_index);
     }
   });
+  _job_to_op.resize(next_job_index);
   for (const auto &s : op_to_job)
-    _job_to_op.emplace(s.second, s.first);
+    _job_to_op[s.second] = s.first;
 
   _input_info = _initial_input_info;
 }
@@ -145,8 +145,52 @@ void DataflowExecutor::executeImpl()
 
   _subject.notifySubgraphBegin(profiling_subg_index);
 
-  while (!_ready_jobs.empty())
+  // Jobs whose reads from device memory are not done yet. Their consumers are not ready until
+  // the reads are done, but other ready jobs run meanwhile.
+  struct InFlightJob
+  {
+    std::unique_ptr<Job> job;
+    AsyncTransfers transfers;
+  };
+  std::list<InFlightJob> in_flight_jobs;
+
+  auto finish_job = [&](std::unique_ptr<Job> job) {
+    auto job_index = job->index();
+    auto op_ind = _job_to_op[job_index];
+    const backend::Backend *backend = _lowered_graph->lower_info().operation.at(op_ind).backend();
+    _subject.notifyJobEnd(this, profiling_subg_index, op_ind, backend);
+    notify(job_index);
+    _finished_jobs[job_index] = std::move(job);
+  };
+
+  while (!_ready_jobs.empty() || !in_flight_jobs.empty())
   {
+    for (auto it = in_flight_jobs.begin(); it != in_flight_jobs.end();)
+    {
+      if (it->transfers.done())
+      {
+        it->transfers.wait();
+        finish_job(std::move(it->job));
+        it = in_flight_jobs.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+
+    if (_ready_jobs.empty())
+    {
+      // Nothing to overlap with, so wait for the oldest one
+      if (!in_flight_jobs.empty())
+      {
+        in_flight_jobs.front().transfers.wait();
+        finish_job(std::move(in_flight_jobs.front().job));
+        in_flight_jobs.pop_front();
+      }
+      continue;
+    }
+
     auto job = std::move((_ready_jobs.begin())->second);
     _ready_jobs.erase(_ready_jobs.begin());
     auto job_index = job->index();
@@ -164,11 +208,16 @@ void DataflowExecutor::executeImpl()
       _lowered_graph->getHasDynamicTensor(op_ind) || dynamic_input_exists;
     job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
 
-    job->run();
+    AsyncTransfers transfers;
+    {
+      AsyncTransfers::Scope scope{transfers};
+      job->run();
+    }
 
-    _subject.notifyJobEnd(this, profiling_subg_index, op_ind, backend);
-    notify(job_index);
-    _finished_jobs[job_index] = std::move(job);
+    if (transfers.empty())
+      finish_job(std::move(job));
+    else
+      in_flight_jobs.push_back(InFlightJob{std::move(job), std::move(transfers)});
   }
   assert(noWaitingJobs());
 
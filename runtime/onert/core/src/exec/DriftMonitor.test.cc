@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/DriftMonitor.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::exec;
+
+namespace
+{
+
+// Backends are only compared by their addresses
+const auto *const kCpu = reinterpret_cast<const onert::backend::Backend *>(0x10);
+const auto *const kGpu = reinterpret_cast<const onert::backend::Backend *>(0x20);
+
+// Run the monitor for a run, where sampled runs have the given times
+void run(DriftMonitor &monitor, int64_t cpu_observed, int64_t gpu_observed)
+{
+  if (monitor.beginRun())
+  {
+    monitor.addBackendTime(kCpu, cpu_observed, 1000);
+    monitor.addBackendTime(kGpu, gpu_observed, 1000);
+  }
+  monitor.endRun();
+}
+
+} // namespace
+
+TEST(DriftMonitor, sample_interval)
+{
+  DriftMonitor monitor{4, 0.2};
+  for (int i = 1; i <= 8; ++i)
+  {
+    ASSERT_EQ(monitor.beginRun(), i % 4 == 0);
+    ASSERT_EQ(monitor.sampling(), i % 4 == 0);
+    monitor.endRun();
+  }
+  ASSERT_EQ(monitor.runs(), 8);
+}
+
+TEST(DriftMonitor, drift_after_window)
+{
+  DriftMonitor monitor{2, 0.2};
+
+  // A throttled backend drifts only at the end of the window of 3 sampled runs
+  for (int i = 0; i < 5; ++i)
+  {
+    run(monitor, 1000, 1500);
+    ASSERT_FALSE(monitor.drifted());
+  }
+  run(monitor, 1000, 1500);
+  ASSERT_TRUE(monitor.drifted());
+  ASSERT_NEAR(monitor.maxDrift(), 0.5, 1e-9);
+
+  // Runs are not sampled until the session reschedules
+  ASSERT_FALSE(monitor.beginRun());
+  ASSERT_FALSE(monitor.beginRun());
+  monitor.endRun();
+
+  monitor.reset();
+  ASSERT_FALSE(monitor.drifted());
+  for (int i = 0; i < 6; ++i)
+    run(monitor, 900, 1100);
+  ASSERT_FALSE(monitor.drifted());
+  ASSERT_NEAR(monitor.maxDrift(), 0.1, 1e-9);
+}
+
+TEST(DriftMonitor, neg_small_backend)
+{
+  DriftMonitor monitor{1, 0.2};
+
+  // Backends of little time are not compared however far they are off
+  for (int i = 0; i < 3; ++i)
+  {
+    ASSERT_TRUE(monitor.beginRun());
+    monitor.addBackendTime(kCpu, 1000, 1000);
+    monitor.addBackendTime(kGpu, 200, 50);
+    monitor.endRun();
+  }
+  ASSERT_FALSE(monitor.drifted());
+  ASSERT_EQ(monitor.maxDrift(), 0);
+}
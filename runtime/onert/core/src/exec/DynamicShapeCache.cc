@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DynamicShapeCache.h"
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+/**
+ * @brief Return true if output shapes of an operation may depend on values of its inputs
+ *
+ * These are operations DynamicShapeInferer reads buffers of inputs for, and ones whose kernels
+ * give shapes to outputs by themselves.
+ */
+bool shapesByValues(ir::OpCode opcode)
+{
+  switch (opcode)
+  {
+    case ir::OpCode::ArgMinMax:
+    case ir::OpCode::BCQFullyConnected:
+    case ir::OpCode::BCQGather:
+    case ir::OpCode::BroadcastTo:
+    case ir::OpCode::Custom:
+    case ir::OpCode::ExpandDims:
+    case ir::OpCode::Fill:
+    case ir::OpCode::If:
+    case ir::OpCode::LSTM:
+    case ir::OpCode::OneHot:
+    case ir::OpCode::Pad:
+    case ir::OpCode::Range:
+    case ir::OpCode::Reduce:
+    case ir::OpCode::Reshape:
+    case ir::OpCode::ResizeBilinear:
+    case ir::OpCode::Slice:
+    case ir::OpCode::SpaceToBatchND:
+    case ir::OpCode::Split:
+    case ir::OpCode::StridedSlice:
+    case ir::OpCode::Tile:
+    case ir::OpCode::TopKV2:
+    case ir::OpCode::Transpose:
+    case ir::OpCode::While:
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+void DynamicShapeCache::addOperation(const ir::OperationIndex &op_ind, ir::OpCode opcode,
+                                     std::vector<backend::ITensor *> outputs)
+{
+  _ops.emplace(op_ind, OpInfo{std::move(outputs), shapesByValues(opcode)});
+}
+
+void DynamicShapeCache::endRun()
+{
+  if (!_running)
+    return;
+
+  if (!_replaying)
+    _entry->complete = true;
+  else if (!_valid)
+    _entries.erase(_entry);
+  _running = false;
+}
+
+bool DynamicShapeCache::applyShapes(const ir::OperationIndex &op_ind)
+{
+  if (!_running || !_replaying || !_valid)
+    return false;
+
+  const auto info = _ops.find(op_ind);
+  if (info == _ops.end() || info->second.by_values)
+    return false;
+  const auto &recorded = _entry->ops.at(op_ind);
+  if (!recorded.recorded)
+    return false;
+
+  const auto &outputs = info->second.outputs;
+  for (size_t i = 0; i < outputs.size(); ++i)
+  {
+    // Static outputs were left as they were by DynamicShapeInferer
+    if (recorded.outputs[i].dynamic)
+      outputs[i]->applyShape(recorded.outputs[i].shape);
+  }
+  return true;
+}
+
+void DynamicShapeCache::recordShapes(const ir::OperationIndex &op_ind)
+{
+  if (!_running || !_valid)
+    return;
+
+  const auto info = _ops.find(op_ind);
+  if (info == _ops.end())
+    return;
+  auto &recorded = _entry->ops.at(op_ind);
+  const auto &outputs = info->second.outputs;
+
+  if (!_replaying)
+  {
+    recorded.outputs.clear();
+    for (const auto &output : outputs)
+      recorded.outputs.emplace_back(OutputShape{output->getShape(), output->is_dynamic()});
+    recorded.recorded = true;
+    return;
+  }
+
+  if (!info->second.by_values)
+    return;
+
+  // Shapes of the rest of the run may differ from ones recorded if an output differs
+  bool same = recorded.recorded;
+  for (size_t i = 0; same && i < outputs.size(); ++i)
+    same = recorded.outputs[i].shape == outputs[i]->getShape();
+  if (!same)
+    _valid = false;
+}
+
+} // namespace exec
+} // namespace onert
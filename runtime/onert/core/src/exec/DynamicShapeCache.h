@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_DYNAMIC_SHAPE_CACHE_H__
+#define __ONERT_EXEC_DYNAMIC_SHAPE_CACHE_H__
+
+#include "backend/ITensor.h"
+#include "ir/Index.h"
+#include "ir/OpCode.h"
+#include "ir/OperationIndexMap.h"
+#include "ir/Shape.h"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Cache of shapes that DynamicShapeInferer gave to outputs of operations, keyed by shapes
+ *        of the inputs of an executor
+ *
+ * The first run of a set of input shapes records the output shapes of each operation after it
+ * runs, and later runs of the set apply them instead of inferring. Output shapes of most
+ * operations depend only on shapes of their inputs, so the same input shapes of the executor give
+ * the same shapes to all tensors. Operations whose output shapes depend on values of inputs, e.g.
+ * Reshape of a computed shape, are inferred as usual and checked against the shapes recorded.
+ * Any difference stops replaying for the rest of the run and drops the set.
+ *
+ * @note Operations of a run may record or replay on multiple threads, each to its own slot which
+ *       beginRun() makes before the run
+ */
+class DynamicShapeCache
+{
+public:
+  /**
+   * @param capacity Sets of input shapes to keep, the least recently used one is dropped first
+   */
+  explicit DynamicShapeCache(uint32_t capacity) : _capacity{capacity} {}
+
+public:
+  /**
+   * @brief Add an operation whose FunctionSequence may infer shapes
+   */
+  void addOperation(const ir::OperationIndex &op_ind, ir::OpCode opcode,
+                    std::vector<backend::ITensor *> outputs);
+
+  /**
+   * @brief Begin a run, which replays shapes if a run of the same input shapes has finished
+   */
+  template <typename Tensors> void beginRun(const Tensors &inputs)
+  {
+    auto it = _entries.begin();
+    for (; it != _entries.end(); ++it)
+    {
+      if (matches(*it, inputs))
+        break;
+    }
+
+    if (it != _entries.end() && it->complete)
+    {
+      _entries.splice(_entries.begin(), _entries, it);
+      _replaying = true;
+      ++_hits;
+    }
+    else
+    {
+      if (it != _entries.end())
+        _entries.erase(it);
+      if (!_entries.empty() && _entries.size() >= _capacity)
+        _entries.pop_back();
+      _entries.emplace_front(newEntry(inputs));
+      _replaying = false;
+      ++_misses;
+    }
+    _entry = _entries.begin();
+    _running = true;
+    _valid = true;
+  }
+
+  /**
+   * @brief End a run, which keeps the shapes recorded or drops ones failed to replay
+   */
+  void endRun();
+
+  /**
+   * @brief Apply shapes recorded to outputs of an operation before its kernels run
+   * @return true if applied so that DynamicShapeInferer is not needed
+   */
+  bool applyShapes(const ir::OperationIndex &op_ind);
+
+  /**
+   * @brief Record shapes of outputs of an operation after its kernels run, or compare them with
+   *        ones recorded for operations of shapes by values
+   */
+  void recordShapes(const ir::OperationIndex &op_ind);
+
+  uint64_t hits() const { return _hits; }
+  uint64_t misses() const { return _misses; }
+
+private:
+  struct OutputShape
+  {
+    ir::Shape shape;
+    bool dynamic;
+  };
+
+  struct OpShapes
+  {
+    bool recorded = false;
+    std::vector<OutputShape> outputs;
+  };
+
+  struct Entry
+  {
+    std::vector<ir::Shape> input_shapes;
+    std::vector<bool> input_dynamic;
+    // Slots of all operations are made at first so that no slot moves in the run
+    ir::OperationIndexMap<OpShapes> ops;
+    bool complete = false;
+  };
+
+  struct OpInfo
+  {
+    std::vector<backend::ITensor *> outputs;
+    // Output shapes depend on values of inputs, which are inferred in every run
+    bool by_values;
+  };
+
+  template <typename Tensors> static bool matches(const Entry &entry, const Tensors &inputs)
+  {
+    if (entry.input_shapes.size() != inputs.size())
+      return false;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+      if (entry.input_dynamic[i] != inputs[i]->is_dynamic() ||
+          entry.input_shapes[i] != inputs[i]->getShape())
+        return false;
+    }
+    return true;
+  }
+
+  template <typename Tensors> Entry newEntry(const Tensors &inputs) const
+  {
+    Entry entry;
+    for (const auto &input : inputs)
+    {
+      entry.input_shapes.emplace_back(input->getShape());
+      entry.input_dynamic.emplace_back(input->is_dynamic());
+    }
+    for (const auto &pair : _ops)
+      entry.ops.emplace(pair.first, OpShapes{});
+    return entry;
+  }
+
+private:
+  const uint32_t _capacity;
+  ir::OperationIndexMap<OpInfo> _ops;
+  std::list<Entry> _entries;
+  std::list<Entry>::iterator _entry;
+  bool _running = false;
+  bool _replaying = false;
+  std::atomic<bool> _valid{true};
+  uint64_t _hits = 0;
+  uint64_t _misses = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_DYNAMIC_SHAPE_CACHE_H__
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DynamicShapeCache.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::exec;
+
+namespace
+{
+
+// Tensor of a shape only, which counts shapes applied to it
+class ShapeTensor : public backend::ITensor
+{
+public:
+  ShapeTensor(const ir::Shape &shape, bool dynamic) : _shape{shape}, _dynamic{dynamic} {}
+
+  uint8_t *buffer() const override { return nullptr; }
+  size_t total_size() const override { return 0; }
+  size_t calcOffset(const ir::Coordinates &) const override { return 0; }
+  ir::Layout layout() const override { return ir::Layout::NHWC; }
+  ir::DataType data_type() const override { return ir::DataType::FLOAT32; }
+  float data_scale() const override { return 0; }
+  int32_t data_zero_point() const override { return 0; }
+  const std::vector<float> &data_scales() const override { return _scales; }
+  const std::vector<int32_t> &data_zero_points() const override { return _zero_points; }
+  bool has_padding() const override { return false; }
+  void access(const std::function<void(ITensor &tensor)> &fn) override { fn(*this); }
+  bool is_dynamic() const override { return _dynamic; }
+  ir::Shape getShape() const override { return _shape; }
+  bool applyShape(const ir::Shape &shape) override
+  {
+    _shape = shape;
+    _dynamic = true;
+    ++applied;
+    return true;
+  }
+
+  int applied = 0;
+
+private:
+  ir::Shape _shape;
+  bool _dynamic;
+  std::vector<float> _scales;
+  std::vector<int32_t> _zero_points;
+};
+
+} // namespace
+
+TEST(DynamicShapeCache, replay_same_input_shapes)
+{
+  ShapeTensor input{{1, 4}, true};
+  ShapeTensor output{{1, 4}, false};
+  std::vector<ShapeTensor *> inputs{&input};
+  const ir::OperationIndex op{0};
+
+  DynamicShapeCache cache{2};
+  cache.addOperation(op, ir::OpCode::ElementwiseActivation, {&output});
+
+  // The first run infers and records
+  cache.beginRun(inputs);
+  ASSERT_FALSE(cache.applyShapes(op));
+  output.applyShape({1, 4});
+  cache.recordShapes(op);
+  cache.endRun();
+
+  // Later runs of the same shapes apply ones recorded
+  for (int i = 0; i < 3; ++i)
+  {
+    cache.beginRun(inputs);
+    ASSERT_TRUE(cache.applyShapes(op));
+    cache.recordShapes(op);
+    cache.endRun();
+  }
+  ASSERT_EQ(output.applied, 4);
+  ASSERT_EQ(cache.hits(), 3);
+  ASSERT_EQ(cache.misses(), 1);
+
+  // Other shapes are not replayed until they are recorded
+  input.applyShape({2, 4});
+  cache.beginRun(inputs);
+  ASSERT_FALSE(cache.applyShapes(op));
+  output.applyShape({2, 4});
+  cache.recordShapes(op);
+  cache.endRun();
+
+  input.applyShape({1, 4});
+  cache.beginRun(inputs);
+  ASSERT_TRUE(cache.applyShapes(op));
+  cache.endRun();
+  ASSERT_EQ(output.getShape(), (ir::Shape{1, 4}));
+}
+
+TEST(DynamicShapeCache, evict_least_recently_used)
+{
+  ShapeTensor input{{1}, true};
+  ShapeTensor output{{1}, false};
+  std::vector<ShapeTensor *> inputs{&input};
+  const ir::OperationIndex op{0};
+
+  DynamicShapeCache cache{2};
+  cache.addOperation(op, ir::OpCode::ElementwiseActivation, {&output});
+
+  auto run = [&](int32_t dim) {
+    input.applyShape({dim});
+    cache.beginRun(inputs);
+    if (!cache.applyShapes(op))
+      output.applyShape({dim});
+    cache.recordShapes(op);
+    cache.endRun();
+  };
+
+  run(1);
+  run(2);
+  run(1);
+  run(3);
+  ASSERT_EQ(cache.misses(), 3);
+
+  // 2 is dropped for 3 as 1 was used later
+  run(1);
+  run(2);
+  ASSERT_EQ(cache.hits(), 2);
+  ASSERT_EQ(cache.misses(), 4);
+}
+
+TEST(DynamicShapeCache, neg_shapes_by_values)
+{
+  ShapeTensor input{{4}, true};
+  ShapeTensor reshaped{{4}, false};
+  ShapeTensor output{{4}, false};
+  std::vector<ShapeTensor *> inputs{&input};
+  const ir::OperationIndex reshape{0};
+  const ir::OperationIndex relu{1};
+
+  DynamicShapeCache cache{2};
+  cache.addOperation(reshape, ir::OpCode::Reshape, {&reshaped});
+  cache.addOperation(relu, ir::OpCode::ElementwiseActivation, {&output});
+
+  cache.beginRun(inputs);
+  reshaped.applyShape({2, 2});
+  cache.recordShapes(reshape);
+  output.applyShape({2, 2});
+  cache.recordShapes(relu);
+  cache.endRun();
+
+  // Reshape is always inferred, and another shape of it stops replaying
+  cache.beginRun(inputs);
+  ASSERT_FALSE(cache.applyShapes(reshape));
+  reshaped.applyShape({4, 1});
+  cache.recordShapes(reshape);
+  ASSERT_FALSE(cache.applyShapes(relu));
+  cache.endRun();
+
+  // The shapes failed to replay are recorded again
+  cache.beginRun(inputs);
+  ASSERT_FALSE(cache.applyShapes(relu));
+  cache.endRun();
+  ASSERT_EQ(cache.misses(), 2);
+}
@@ -117,6 +117,22 @@ void DynamicShapeInferer::visit(const ir::operation::ArgMinMax &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::Attention &op)
+{
+  auto query = _tensor_registry->getITensor(op.getInputs().at(ir::operation::Attention::QUERY));
+  auto key = _tensor_registry->getITensor(op.getInputs().at(ir::operation::Attention::KEY));
+  auto value = _tensor_registry->getITensor(op.getInputs().at(ir::operation::Attention::VALUE));
+
+  if (!query->is_dynamic() && !key->is_dynamic() && !value->is_dynamic())
+    return;
+
+  auto output = _tensor_registry->getITensor(op.getOutputs().at(0));
+  auto new_shape =
+    shape_inference::inferAttentionShape(query->getShape(), key->getShape(), value->getShape());
+  output->applyShape(new_shape);
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::BatchMatMul &op)
 {
   const auto lhs_index = op.getInputs().at(ir::operation::BatchMatMul::Input::LHS);
@@ -339,6 +355,16 @@ void DynamicShapeInferer::visit(const ir::operation::Conv2D &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::ConvertFp16ToFp32 &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ConvertFp16ToFp32::INPUT));
+}
+
+void DynamicShapeInferer::visit(const ir::operation::ConvertFp32ToFp16 &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ConvertFp32ToFp16::INPUT));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::ElementwiseActivation &op)
 {
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseActivation::INPUT));
@@ -493,6 +519,11 @@ void DynamicShapeInferer::visit(const ir::operation::L2Normalization &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::L2Normalization::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::LayerNorm &op)
+{
+  handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::LayerNorm::INPUT));
+}
+
 void DynamicShapeInferer::visit(const ir::operation::LSTM &op)
 {
   const auto output_index{op.getOutputs().at(ir::operation::LSTM::Output::OUTPUT)};
@@ -1170,6 +1201,28 @@ void DynamicShapeInferer::visit(const ir::operation::Tile &op)
   assert(output->buffer() != nullptr);
 }
 
+void DynamicShapeInferer::visit(const ir::operation::TopKV2 &op)
+{
+  auto input_idx = op.getInputs().at(ir::operation::TopKV2::Input::INPUT);
+  auto input = _tensor_registry->getITensor(input_idx);
+
+  auto values = _tensor_registry->getITensor(
+    op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_VALUES));
+  auto indices = _tensor_registry->getITensor(
+    op.getOutputs().at(ir::operation::TopKV2::Output::OUTPUT_INDICES));
+
+  if (!input->is_dynamic() && !values->is_dynamic() && !indices->is_dynamic())
+    return;
+
+  const auto output_shape = shape_inference::inferTopKV2Shape(input->getShape(), op.param().k);
+
+  // set output shapes and output buffers
+  values->applyShape(output_shape);
+  assert(values->buffer() != nullptr);
+  indices->applyShape(output_shape);
+  assert(indices->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::Transpose &op)
 {
   // check if output is not dynamic
@@ -16,6 +16,8 @@
 
 #include "ExecTime.h"
 
+#include "util/ConfigSource.h"
+
 #include <algorithm>
 #include <cassert>
 
@@ -24,6 +26,59 @@ namespace onert
 namespace exec
 {
 
+ExecTime::ExecTime(const std::vector<const backend::Backend *> &backends)
+  : _json(backends, _measurements)
+{
+  compact(static_cast<uint32_t>(std::max(util::getConfigInt(util::config::EXEC_TIME_MAX_AGE), 0)));
+}
+
+uint32_t ExecTime::getSizeBucket(uint32_t op_size)
+{
+  uint32_t shift = 0;
+  while ((op_size >> shift) >= 32)
+    shift++;
+  return (op_size >> shift) << shift;
+}
+
+void ExecTime::compact(uint32_t max_age)
+{
+  for (auto &backend : _measurements)
+  {
+    for (auto &operation : backend.second)
+    {
+      for (auto type = operation.second.begin(); type != operation.second.end();)
+      {
+        std::map<uint32_t, MeasurementRecord> records;
+        for (const auto &rec : type->second)
+        {
+          // Unsupported operations stay unsupported however old the record is
+          const auto &record = rec.second;
+          if (max_age > 0 && record.age > max_age && record.time != getMax())
+            continue;
+
+          auto it = records.emplace(getSizeBucket(rec.first), record);
+          if (!it.second)
+          {
+            auto &merged = it.first->second;
+            merged.time = (merged.time == getMax() || record.time == getMax())
+                            ? getMax()
+                            : (merged.time + record.time) / 2;
+            merged.age = std::min(merged.age, record.age);
+          }
+        }
+
+        if (records.empty())
+          type = operation.second.erase(type);
+        else
+        {
+          type->second = std::move(records);
+          ++type;
+        }
+      }
+    }
+  }
+}
+
 int64_t ExecTime::getOperationExecTime(const backend::Backend *backend,
                                        const std::string &operation, bool quant,
                                        uint32_t op_size) const
@@ -42,26 +97,32 @@ int64_t ExecTime::getOperationExecTime(const backend::Backend *backend,
     // no execution time for this operation
     return NOT_FOUND;
 
-  auto found_size = found_operation->second.find(op_size);
-  if (found_size != found_operation->second.end())
-    return found_size->second; // found execution time
+  const auto &records = found_operation->second;
+  if (records.empty())
+    return NOT_FOUND;
+
+  auto found_size = records.find(getSizeBucket(op_size));
+  if (found_size != records.end())
+    return found_size->second.time; // found execution time
 
   // Try to interpolate
-  if (found_operation->second.size() < 2)
+  if (records.size() < 2)
     // not possible to do linear interpolation
-    return found_operation->second.begin()->second;
+    return records.begin()->second.time;
 
   // if we reach here, then this means, that there is no record, that is equal to op_size
-  auto upper_bound = found_operation->second.upper_bound(op_size); // > op_size
+  auto upper_bound = records.upper_bound(op_size); // > op_size
   auto lower_bound = upper_bound;
 
-  if (upper_bound == found_operation->second.end()) // all values <= op_size
+  if (upper_bound == records.end()) // all values <= op_size
   {
-    upper_bound--;
-    lower_bound = upper_bound;
-    lower_bound--;
+    // Larger operations are bound by memory bandwidth rather than by fixed costs, so scale the
+    // time of the largest one. It is also robust to noisy records that slope down.
+    const auto &largest = *records.rbegin();
+    const auto scaled = static_cast<double>(largest.second.time) * op_size / largest.first;
+    return std::max<int64_t>(std::min<double>(scaled, getMax() - 1), 1);
   }
-  else if (upper_bound == found_operation->second.begin()) // all values > op_size
+  else if (upper_bound == records.begin()) // all values > op_size
   {
     upper_bound++;
   }
@@ -73,18 +134,12 @@ int64_t ExecTime::getOperationExecTime(const backend::Backend *backend,
   // Linear interpolation
   const auto x0 = static_cast<int64_t>(lower_bound->first); // size
   const auto x1 = static_cast<int64_t>(upper_bound->first); // size
-  const int64_t y0 = lower_bound->second;                   // time
-  const int64_t y1 = upper_bound->second;                   // time
+  const int64_t y0 = lower_bound->second.time;              // time
+  const int64_t y1 = upper_bound->second.time;              // time
   const auto x = static_cast<int64_t>(op_size);
 
   int64_t interpolated_value = y0 + (x - x0) * (y1 - y0) / (x1 - x0);
 
-  // In some cases ops with smaller inputs is executed slower than the one
-  // with larger inputs, more likely because of a backend's load difference
-  if (interpolated_value < 0 && x > x1)
-  {
-    return y0;
-  }
   // It must be non-positive ONLY if it's lesser than both of them
   assert(interpolated_value > 0 || x < x0);
 
@@ -97,22 +152,27 @@ void ExecTime::updateOperationExecTime(const backend::Backend *backend,
                                        int64_t time)
 {
   // If the op is not implemented for some input, it should not be scheduled
-  const auto &recs = _measurements[backend][operation][quant];
+  auto &recs = _measurements[backend][operation][quant];
   if (time == getMax() ||
       std::any_of(recs.begin(), recs.end(),
-                  [](std::pair<const uint32_t, const int64_t> p) { return p.second == getMax(); }))
+                  [](const std::pair<const uint32_t, MeasurementRecord> &p) {
+                    return p.second.time == getMax();
+                  }))
   {
-    _measurements[backend][operation][quant].clear();
-    _measurements[backend][operation][quant].emplace(op_size, getMax());
+    recs.clear();
+    recs.emplace(getSizeBucket(op_size), MeasurementRecord{getMax(), 0, true});
   }
   else
   {
-    auto it = _measurements[backend][operation][quant].emplace(op_size, time);
+    auto it = recs.emplace(getSizeBucket(op_size), MeasurementRecord{time, 0, true});
     if (!it.second)
     {
       // affect of the last measurement is bigger than the previous ones:
       //   this prefers new metrics than older once, so will adapt backend changes
-      it.first->second = (it.first->second + time) / 2;
+      auto &record = it.first->second;
+      record.time = (record.time + time) / 2;
+      record.age = 0;
+      record.fresh = true;
     }
   }
 }
@@ -131,5 +191,31 @@ int64_t ExecTime::getPermuteTime(const backend::Backend *from_backend,
   return getOperationExecTime(from_backend, to_backend->config()->id(), quant, op_size);
 }
 
+std::map<uint32_t, int64_t> ExecTime::getPermuteRecords(const backend::Backend *from_backend,
+                                                        const backend::Backend *to_backend) const
+{
+  std::map<uint32_t, int64_t> records;
+  auto found_backend = _measurements.find(from_backend);
+  if (found_backend == _measurements.end())
+    return records;
+
+  auto found_operation = found_backend->second.find(to_backend->config()->id());
+  if (found_operation == found_backend->second.end())
+    return records;
+
+  for (const auto &type : found_operation->second)
+  {
+    for (const auto &rec : type.second)
+    {
+      if (rec.second.time == getMax())
+        continue;
+      auto it = records.emplace(rec.first, rec.second.time);
+      if (!it.second)
+        it.first->second = (it.first->second + rec.second.time) / 2;
+    }
+  }
+  return records;
+}
+
 } // namespace exec
 } // namespace onert
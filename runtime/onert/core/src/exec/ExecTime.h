@@ -30,18 +30,24 @@ namespace onert
 {
 namespace exec
 {
+/**
+ * @brief Execution times of operations for their sizes, which are kept in "exec_time.json"
+ *
+ * Sizes are grouped into buckets at most 1/16 of the sizes wide so that dynamic shapes do not grow
+ * the records without bound. A record is the exponentially decayed mean of the measurements in its
+ * bucket, and is dropped once it is not measured for EXEC_TIME_MAX_AGE profiling sessions.
+ */
 class ExecTime
 {
 public:
-  explicit ExecTime(const std::vector<const backend::Backend *> &backends)
-    : _json(backends, _measurements)
-  {
-  }
+  explicit ExecTime(const std::vector<const backend::Backend *> &backends);
 
 public:
   /**
    * @brief Get exec time of an operation with input size
    *        or linearly interpolated value based on size if there is no record for given size
+   * @note  Sizes larger than all records are assumed to be memory bound, so that the time grows
+   *        in proportion to the size from the largest record
    *
    * @param[in] backend id of a backend
    * @param[in] operation name of an operation
@@ -86,6 +92,20 @@ public:
    */
   void updatePermuteTime(const backend::Backend *from_backend, const backend::Backend *to_backend,
                          bool quant, uint32_t op_size, int64_t time);
+  /**
+   * @brief Get all measured permute times from one backend to another
+   *
+   * @param[in] from_backend
+   * @param[in] to_backend
+   * @return Map from operation size to permute time, which merges quantized and non-quantized
+   *         records and excludes unsupported ones
+   */
+  std::map<uint32_t, int64_t> getPermuteRecords(const backend::Backend *from_backend,
+                                                const backend::Backend *to_backend) const;
+  /**
+   * @brief Get the bucket of an operation size, which keeps its 5 most significant bits
+   */
+  static uint32_t getSizeBucket(uint32_t op_size);
   /**
    * @brief Get the max value of int32_t in int64_t
    * @return max value
@@ -97,6 +117,12 @@ public:
   void storeOperationsExecTime() const { _json.storeOperationsExecTime(); }
   static const int64_t NOT_FOUND = -1;
 
+private:
+  /**
+   * @brief Merge loaded records into buckets and drop the stale ones
+   */
+  void compact(uint32_t max_age);
+
 private:
   /// @brief Measurement data, which is shared with serializer
   MeasurementData _measurements;
@@ -21,6 +21,7 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <string>
 
 namespace
@@ -103,4 +104,50 @@ TEST(ExecTime, structure)
   // clean up
   EXPECT_EQ(remove("exec_time.json"), 0);
 }
+TEST(ExecTime, bucket_sizes)
+{
+  ASSERT_EQ(ExecTime::getSizeBucket(31), 31);
+  ASSERT_EQ(ExecTime::getSizeBucket(100), 100);
+  ASSERT_EQ(ExecTime::getSizeBucket(1000), 992);
+  ASSERT_EQ(ExecTime::getSizeBucket(1023), 992);
+
+  const auto *b = new MockBackend();
+  std::vector<const Backend *> bs = {b};
+  ExecTime et(bs);
+  // Sizes in a bucket share the record, which prefers recent measurements
+  et.updateOperationExecTime(b, "op1", false, 1000, 100);
+  et.updateOperationExecTime(b, "op1", false, 1010, 300);
+  ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 1023), 200);
+}
+
+TEST(ExecTime, extrapolate_memory_bound)
+{
+  const auto *b = new MockBackend();
+  std::vector<const Backend *> bs = {b};
+  ExecTime et(bs);
+  et.updateOperationExecTime(b, "op1", false, 100, 100);
+  // Slope down because of noise
+  et.updateOperationExecTime(b, "op1", false, 200, 50);
+  ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 800), 200);
+}
+
+TEST(ExecTime, drop_stale_records)
+{
+  const auto *b = new MockBackend();
+  std::vector<const Backend *> bs = {b};
+  {
+    std::ofstream file("exec_time.json");
+    // Old records without age, and a record not measured for long
+    file << R"({"b1": {"op1": {"0": [[100, 100], [200, 200, 100]]}, "op2": {"0": [[1, 5, 99]]}}})";
+  }
+  {
+    ExecTime et(bs);
+    ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 100), 100);
+    // Extrapolated from the record of 100 only
+    ASSERT_EQ(et.getOperationExecTime(b, "op1", false, 200), 100);
+    ASSERT_TRUE(et.getOperationExecTime(b, "op2", false, 1) == ExecTime::NOT_FOUND);
+  }
+  // clean up
+  EXPECT_EQ(remove("exec_time.json"), 0);
+}
 } // unnamed namespace
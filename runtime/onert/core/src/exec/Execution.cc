@@ -16,13 +16,156 @@
 
 #include "exec/Execution.h"
 
+#include "ThreadPool.h"
+#include "exec/PriorityGate.h"
+#include "exec/MinMaxRecords.h"
+#include "exec/RunStats.h"
+#include "exec/SharedRuyContext.h"
+#include "util/ConfigSource.h"
+#include "util/CpuAffinity.h"
+#include "util/HeapPhase.h"
+#include "util/Exceptions.h"
 #include "util/logging.h"
 
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/Quantize.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+
 namespace onert
 {
 namespace exec
 {
 
+namespace
+{
+
+// Copy data to a shape that differs only along the axis, filling the region beyond with zeros
+void copyAlongAxis(const uint8_t *src, const ir::Shape &src_shape, uint8_t *dst,
+                   const ir::Shape &dst_shape, uint32_t axis, size_t elem_size)
+{
+  size_t outer = 1;
+  for (uint32_t i = 0; i < axis; ++i)
+    outer *= src_shape.dim(i);
+  size_t inner = elem_size;
+  for (int i = axis + 1; i < src_shape.rank(); ++i)
+    inner *= src_shape.dim(i);
+
+  const size_t src_block = src_shape.dim(axis) * inner;
+  const size_t dst_block = dst_shape.dim(axis) * inner;
+  const size_t block = std::min(src_block, dst_block);
+  for (size_t o = 0; o < outer; ++o)
+  {
+    std::memcpy(dst + o * dst_block, src + o * src_block, block);
+    std::memset(dst + o * dst_block + block, 0, dst_block - block);
+  }
+}
+
+// Types of quantized inputs and outputs which can be given in float
+bool isConvertibleFromFloat(ir::DataType type)
+{
+  return type == ir::DataType::QUANT_UINT8_ASYMM || type == ir::DataType::QUANT_INT8_ASYMM ||
+         type == ir::DataType::QUANT_INT16_SYMM;
+}
+
+void quantize(const float *src, const ir::TypeInfo &type, void *dst, int size,
+              ruy::Context *ruy_context)
+{
+  const nnfw::cker::Shape shape{size};
+  switch (type.type())
+  {
+    case ir::DataType::QUANT_UINT8_ASYMM:
+      nnfw::cker::Quantize(shape, src, shape, static_cast<uint8_t *>(dst), type.scale(),
+                           type.zero_point(), ruy_context);
+      break;
+    case ir::DataType::QUANT_INT8_ASYMM:
+      nnfw::cker::Quantize(shape, src, shape, static_cast<int8_t *>(dst), type.scale(),
+                           type.zero_point(), ruy_context);
+      break;
+    case ir::DataType::QUANT_INT16_SYMM:
+      nnfw::cker::Quantize(shape, src, shape, static_cast<int16_t *>(dst), type.scale(),
+                           type.zero_point(), ruy_context);
+      break;
+    default:
+      throw std::runtime_error{"Unsupported type to quantize into"};
+  }
+}
+
+void dequantize(const void *src, const ir::TypeInfo &type, float *dst, int size,
+                ruy::Context *ruy_context)
+{
+  const nnfw::cker::Shape shape{size};
+  switch (type.type())
+  {
+    case ir::DataType::QUANT_UINT8_ASYMM:
+      nnfw::cker::Dequantize(shape, static_cast<const uint8_t *>(src), shape, dst, type.scale(),
+                             type.zero_point(), ruy_context);
+      break;
+    case ir::DataType::QUANT_INT8_ASYMM:
+      nnfw::cker::Dequantize(shape, static_cast<const int8_t *>(src), shape, dst, type.scale(),
+                             type.zero_point(), ruy_context);
+      break;
+    case ir::DataType::QUANT_INT16_SYMM:
+      nnfw::cker::Dequantize(shape, static_cast<const int16_t *>(src), shape, dst, type.scale(),
+                             type.zero_point(), ruy_context);
+      break;
+    default:
+      throw std::runtime_error{"Unsupported type to dequantize from"};
+  }
+}
+
+class AsyncJob : public IFunction
+{
+public:
+  AsyncJob(const std::function<void()> &fn) : _fn{fn} {}
+
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+// Workers for asynchronous executions, which live until the process exits
+ThreadPool &asyncPool()
+{
+  static ThreadPool pool{[]() {
+    const auto num_threads = util::getConfigInt(util::config::ASYNC_THREADS);
+    return num_threads > 0 ? static_cast<uint32_t>(num_threads)
+                           : std::max(std::thread::hardware_concurrency(), 1u);
+  }()};
+  return pool;
+}
+
+// Wait for a lock-free condition, giving the core away to other stages while waiting
+template <typename Cond> void waitUntil(Cond cond)
+{
+  for (uint32_t trial = 0; !cond(); trial++)
+  {
+    if (trial < 1024)
+      std::this_thread::yield();
+    else
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+}
+
+template <typename T> void waitPush(SPSCRing<T> &ring, T value)
+{
+  waitUntil([&]() { return ring.tryPush(std::move(value)); });
+}
+
+template <typename T> T waitPop(SPSCRing<T> &ring)
+{
+  T value;
+  waitUntil([&]() { return ring.tryPop(value); });
+  return value;
+}
+
+} // namespace
+
 Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors{executors}
 {
   assert(executors != nullptr);
@@ -30,7 +173,74 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   const auto &primary_subg = primary_subgraph();
   _io_desc.inputs.resize(primary_subg.getInputs().size());
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
-  sem_init(&_async_io_descs_sem, 0, 1);
+}
+
+Execution::~Execution()
+{
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [&]() { return !_async_running; });
+}
+
+void Execution::replaceExecutors(const std::shared_ptr<ExecutorMap> &executors)
+{
+  assert(executors != nullptr);
+  assert(executors->at(ir::SubgraphIndex{0}) != nullptr);
+  assert(executors->at(ir::SubgraphIndex{0})->graph().getInputs().size() ==
+         _io_desc.inputs.size());
+  assert(executors->at(ir::SubgraphIndex{0})->graph().getOutputs().size() ==
+         _io_desc.outputs.size());
+  _executors = executors;
+  _pad_axis = -1;
+}
+
+void Execution::specializeExecutors(const std::shared_ptr<ExecutorMap> &executors)
+{
+  const auto &subg = executors->at(ir::SubgraphIndex{0})->graph();
+
+  // Outputs are static too, so their buffers must be large enough in advance
+  for (uint32_t i = 0; i < _io_desc.outputs.size(); ++i)
+  {
+    const auto &output = _io_desc.outputs.at(i);
+    const auto &info = subg.operands().at(subg.getOutputs().at(i)).info();
+    if (output && output->size < info.total_size())
+      throw InsufficientBufferSizeException{"Output " + std::to_string(i) +
+                                            "'s buffer is too small for the input shapes"};
+  }
+
+  replaceExecutors(executors);
+
+  for (uint32_t i = 0; i < _io_desc.inputs.size(); ++i)
+  {
+    const ir::IOIndex index{i};
+    auto it = _io_desc.dynamic_input_shapes.find(index);
+    if (it == _io_desc.dynamic_input_shapes.end())
+      continue;
+    const auto &static_shape = subg.operands().at(subg.getInputs().at(index)).shape();
+    if (it->second == static_shape)
+      _io_desc.dynamic_input_shapes.erase(it);
+  }
+}
+
+void Execution::padExecutors(const std::shared_ptr<ExecutorMap> &executors, uint32_t axis)
+{
+  const auto &subg = executors->at(ir::SubgraphIndex{0})->graph();
+  for (uint32_t i = 0; i < _io_desc.inputs.size(); ++i)
+  {
+    const auto shape = getInputShape(ir::IOIndex{i});
+    const auto &padded = subg.operands().at(subg.getInputs().at(i)).shape();
+    bool paddable = shape.rank() == padded.rank();
+    for (int d = 0; paddable && d < shape.rank(); ++d)
+    {
+      paddable = (static_cast<uint32_t>(d) == axis) ? shape.dim(d) <= padded.dim(d)
+                                                    : shape.dim(d) == padded.dim(d);
+    }
+    if (!paddable)
+      throw std::runtime_error{"Input " + std::to_string(i) + " cannot be padded along axis " +
+                               std::to_string(axis)};
+  }
+
+  replaceExecutors(executors);
+  _pad_axis = static_cast<int32_t>(axis);
 }
 
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
@@ -39,6 +249,7 @@ void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_
   // Note that 'compiled' model will not be updated with new_shape
   // but new_shape will change model input shape while 'running' the model
   _io_desc.dynamic_input_shapes[index] = new_shape;
+  _io_slot = -1;
 
   VERBOSE(Execution) << "Model input shape will be changed at the start of execute()"
                      << "(index: " << index << ")" << std::endl;
@@ -70,87 +281,74 @@ void Execution::setInput(const ir::IOIndex &index, const void *buffer, size_t le
   }
 
   _io_desc.inputs.at(index.value()) = std::make_unique<InputDesc>(info, buffer, length, layout);
+  _converted_inputs.erase(index.value());
+  _io_slot = -1;
 }
 
-void Execution::createNewAsyncDesc(uint32_t count)
+// TODO Remove default parameter
+void Execution::setInput(const ir::IOIndex &index, const ir::TypeInfo &type, const ir::Shape &shape,
+                         const void *buffer, size_t length, ir::Layout layout)
 {
-  IODescription *_async_io_desc = new IODescription;
-  _async_io_desc->inputs.resize(primary_subgraph().getInputs().size());
-  _async_io_desc->outputs.resize(primary_subgraph().getOutputs().size());
-
-  _async_io_descs.push_back({_async_io_desc, count});
-}
-
-void Execution::setFinish() { finished = true; }
+  auto info = ir::OperandInfo::createStaticInfo(shape, type);
 
-bool Execution::isEmptyQueue()
-{
-  asyncIoDescSemWait();
-  bool ret = _async_io_descs.empty();
-  if (!ret)
+  if (length < info.total_size())
   {
-    for (uint32_t idx = 0; idx < _async_io_descs.front().first->inputs.size(); idx++)
-    {
-      if (_async_io_descs.front().first->inputs.at(idx).get() == nullptr)
-      {
-        ret = true;
-        break;
-      }
-    }
+    throw std::runtime_error{"Too small length"};
   }
-  asyncIoDescSemPost();
-  return ret;
+
+  _io_desc.inputs.at(index.value()) = std::make_unique<InputDesc>(info, buffer, length, layout);
+  _converted_inputs.erase(index.value());
+  _io_slot = -1;
 }
 
-void Execution::executeAsyncInput(const ir::IOIndex &index, const void *buffer, size_t length,
-                                  ir::Layout layout)
+void Execution::setInput(const ir::IOIndex &index, ir::DataType type, const void *buffer,
+                         size_t length)
 {
   const auto input_index = primary_subgraph().getInputs().at(index);
-  const auto info = primary_subgraph().operands().at(input_index).info();
-  IODescription *_async_io_desc = _async_io_descs.back().first;
-
+  const auto &info = primary_subgraph().operands().at(input_index).info();
+  if (type == info.typeInfo().type())
   {
-    auto input_shape_sig = _async_io_desc->dynamic_input_shapes.find(index);
-    auto size_required =
-      (input_shape_sig != _async_io_desc->dynamic_input_shapes.end())
-        ? input_shape_sig->second.num_elements() * onert::ir::sizeOfDataType(info.typeInfo().type())
-        : info.total_size();
-
-    if (length < size_required)
-    {
-      throw std::runtime_error{"Too small length"};
-    }
+    setInput(index, buffer, length);
+    return;
   }
-  void *_buffer = (void *)malloc(length);
-  if (_buffer == NULL)
+  if (type != ir::DataType::FLOAT32 || !isConvertibleFromFloat(info.typeInfo().type()))
+    throw std::runtime_error{"Input " + std::to_string(index.value()) +
+                             " cannot be converted from the given type"};
+
+  const auto num_elements = getInputShape(index).num_elements();
+  if (length < num_elements * sizeof(float))
   {
-    throw std::runtime_error{"malloc failed"};
+    throw std::runtime_error{"Too small length"};
   }
-  memcpy(_buffer, buffer, length);
 
-  _async_io_desc->inputs.at(index.value()) =
-    std::make_unique<InputDesc>(info, _buffer, length, layout);
+  // The buffer holds as many elements as the user's to follow input shapes changed later
+  ConvertedIO converted{type, const_cast<void *>(buffer), length, {}};
+  converted.buffer.resize(length / sizeof(float) * ir::sizeOfDataType(info.typeInfo().type()));
+  _io_desc.inputs.at(index.value()) = std::make_unique<InputDesc>(
+    info, converted.buffer.data(), converted.buffer.size(), ir::Layout::NHWC);
+  _converted_inputs[index.value()] = std::move(converted);
+  _io_slot = -1;
 }
 
-void Execution::executeAsyncOutput(const ir::IOIndex &index, void *buffer, size_t length,
-                                   ir::Layout layout)
+// TODO Remove default parameter
+void Execution::setOutput(const ir::IOIndex &index, void *buffer, size_t length, ir::Layout layout)
 {
   const auto output_index = primary_subgraph().getOutputs().at(index);
   const auto info = primary_subgraph().operands().at(output_index).info();
-  IODescription *_async_io_desc = _async_io_descs.front().first;
 
   if (length < info.total_size())
   {
     throw std::runtime_error{"Too small length"};
   }
 
-  _async_io_desc->outputs.at(index.value()) =
-    std::make_unique<OutputDesc>(info, buffer, length, layout);
+  _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(info, buffer, length, layout);
+  _converted_outputs.erase(index.value());
+  _io_slot = -1;
 }
 
 // TODO Remove default parameter
-void Execution::setInput(const ir::IOIndex &index, const ir::TypeInfo &type, const ir::Shape &shape,
-                         const void *buffer, size_t length, ir::Layout layout)
+void Execution::setOutput(const ir::IOIndex &index, const ir::TypeInfo &type,
+                          const ir::Shape &shape, void *buffer, size_t length, ir::Layout layout)
 {
   auto info = ir::OperandInfo::createStaticInfo(shape, type);
 
@@ -159,35 +357,77 @@ void Execution::setInput(const ir::IOIndex &index, const ir::TypeInfo &type, con
     throw std::runtime_error{"Too small length"};
   }
 
-  _io_desc.inputs.at(index.value()) = std::make_unique<InputDesc>(info, buffer, length, layout);
+  _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(info, buffer, length, layout);
+  _converted_outputs.erase(index.value());
+  _io_slot = -1;
 }
 
-// TODO Remove default parameter
-void Execution::setOutput(const ir::IOIndex &index, void *buffer, size_t length, ir::Layout layout)
+void Execution::setOutput(const ir::IOIndex &index, ir::DataType type, void *buffer,
+                          size_t length)
 {
   const auto output_index = primary_subgraph().getOutputs().at(index);
-  const auto info = primary_subgraph().operands().at(output_index).info();
+  const auto &info = primary_subgraph().operands().at(output_index).info();
+  if (type == info.typeInfo().type())
+  {
+    setOutput(index, buffer, length);
+    return;
+  }
+  if (type != ir::DataType::FLOAT32 || !isConvertibleFromFloat(info.typeInfo().type()))
+    throw std::runtime_error{"Output " + std::to_string(index.value()) +
+                             " cannot be converted to the given type"};
 
-  if (length < info.total_size())
+  if (length < info.shape().num_elements() * sizeof(float))
   {
     throw std::runtime_error{"Too small length"};
   }
 
-  _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(info, buffer, length, layout);
+  // Dynamic outputs may be as large as the user's buffer
+  ConvertedIO converted{type, buffer, length, {}};
+  converted.buffer.resize(length / sizeof(float) * ir::sizeOfDataType(info.typeInfo().type()));
+  _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(
+    info, converted.buffer.data(), converted.buffer.size(), ir::Layout::NHWC);
+  _converted_outputs[index.value()] = std::move(converted);
+  _io_slot = -1;
 }
 
-// TODO Remove default parameter
-void Execution::setOutput(const ir::IOIndex &index, const ir::TypeInfo &type,
-                          const ir::Shape &shape, void *buffer, size_t length, ir::Layout layout)
+void Execution::registerIOBuffers(uint32_t slot,
+                                  const std::vector<std::pair<const void *, size_t>> &inputs,
+                                  const std::vector<std::pair<void *, size_t>> &outputs)
 {
-  auto info = ir::OperandInfo::createStaticInfo(shape, type);
+  const auto &subg = primary_subgraph();
+  if (inputs.size() != subg.getInputs().size() || outputs.size() != subg.getOutputs().size())
+    throw std::runtime_error{"Buffers must be given for all inputs and outputs"};
 
-  if (length < info.total_size())
+  auto desc = std::make_unique<IODescription>();
+  for (uint32_t i = 0; i < inputs.size(); ++i)
   {
-    throw std::runtime_error{"Too small length"};
+    const auto &info = subg.operands().at(subg.getInputs().at(i)).info();
+    if (info.isDynamic() || inputs[i].second < info.total_size())
+      throw std::runtime_error{"Input " + std::to_string(i) + "'s buffer is too small"};
+    desc->inputs.emplace_back(
+      std::make_unique<InputDesc>(info, inputs[i].first, inputs[i].second, ir::Layout::NHWC));
+  }
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+  {
+    const auto &info = subg.operands().at(subg.getOutputs().at(i)).info();
+    if (info.isDynamic() || outputs[i].second < info.total_size())
+      throw std::runtime_error{"Output " + std::to_string(i) + "'s buffer is too small"};
+    desc->outputs.emplace_back(
+      std::make_unique<OutputDesc>(info, outputs[i].first, outputs[i].second, ir::Layout::NHWC));
   }
 
-  _io_desc.outputs.at(index.value()) = std::make_unique<OutputDesc>(info, buffer, length, layout);
+  if (_io_slots.size() <= slot)
+    _io_slots.resize(slot + 1);
+  _io_slots.at(slot) = std::move(desc);
+}
+
+void Execution::useIOBuffers(uint32_t slot)
+{
+  if (slot >= _io_slots.size() || !_io_slots.at(slot))
+    throw std::runtime_error{"Buffers are not registered for slot " + std::to_string(slot)};
+  if (!_io_desc.dynamic_input_shapes.empty())
+    throw std::runtime_error{"Registered buffers cannot be used with changed input shapes"};
+  _io_slot = static_cast<int32_t>(slot);
 }
 
 void Execution::setInputLayout(const ir::IOIndex &index, ir::Layout layout)
@@ -195,6 +435,7 @@ void Execution::setInputLayout(const ir::IOIndex &index, ir::Layout layout)
   const auto &input_desc = _io_desc.inputs.at(index.value());
   _io_desc.inputs.at(index.value()) =
     std::make_unique<InputDesc>(input_desc->info, input_desc->buffer, input_desc->size, layout);
+  _io_slot = -1;
 }
 
 void Execution::setOutputLayout(const ir::IOIndex &index, ir::Layout layout)
@@ -202,43 +443,319 @@ void Execution::setOutputLayout(const ir::IOIndex &index, ir::Layout layout)
   const auto &output_desc = _io_desc.outputs.at(index.value());
   _io_desc.outputs.at(index.value()) =
     std::make_unique<OutputDesc>(output_desc->info, output_desc->buffer, output_desc->size, layout);
+  _io_slot = -1;
 }
 
 void Execution::execute()
 {
   VERBOSE(Execution) << "Start execution" << std::endl;
 
-  primary_executor()->execute(_io_desc);
+  // Steady runs are expected to allocate nothing
+  util::HeapPhase heap_phase{_steady ? "run/steady" : "run/first"};
+  _steady = true;
+  PriorityGate::Entry entry{PriorityGate::get(), _priority};
+  // Backend threads started during the run, e.g. those of ruy, inherit this affinity
+  util::ScopedCpuAffinity affinity;
+  const auto begin = std::chrono::steady_clock::now();
+  if (_run_stats)
+    _run_stats->beginRun();
+  if (_minmax_records)
+    _minmax_records->beginRun();
+
+  if (_io_slot >= 0)
+    primary_executor()->execute(*_io_slots.at(_io_slot));
+  else
+  {
+    convertInputs();
+    if (_pad_axis < 0)
+      primary_executor()->execute(_io_desc);
+    else
+      executePadded();
+    convertOutputs();
+  }
   finished = true;
 
+  if (_run_stats)
+  {
+    const auto end = std::chrono::steady_clock::now();
+    _run_stats->endRun(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+  }
+  if (_minmax_records)
+    _minmax_records->endRun();
+
   VERBOSE(Execution) << "Execution finished" << std::endl;
 }
 
-void Execution::AsyncExecute()
+void Execution::executePadded()
+{
+  const auto &subg = primary_subgraph();
+  const auto axis = static_cast<uint32_t>(_pad_axis);
+  const auto num_inputs = _io_desc.inputs.size();
+  const auto num_outputs = _io_desc.outputs.size();
+  _pad_buffers.resize(num_inputs + num_outputs);
+
+  // Inputs are padded to the static shapes of the executors, so none of them runs dynamically
+  IODescription desc;
+  desc.inputs.resize(num_inputs);
+  desc.outputs.resize(num_outputs);
+  int32_t len = -1;
+  int32_t padded_len = -1;
+  for (uint32_t i = 0; i < num_inputs; ++i)
+  {
+    const auto &input = _io_desc.inputs.at(i);
+    if (!input)
+      continue;
+    if (input->layout != subg.layout())
+      throw std::runtime_error{"Padding inputs in other layouts is not supported"};
+
+    const auto &info = subg.operands().at(subg.getInputs().at(i)).info();
+    const auto shape = getInputShape(ir::IOIndex{i});
+    if (shape == info.shape())
+    {
+      desc.inputs.at(i) =
+        std::make_unique<InputDesc>(info, input->buffer, input->size, input->layout);
+      continue;
+    }
+
+    len = shape.dim(axis);
+    padded_len = info.shape().dim(axis);
+    auto &buffer = _pad_buffers.at(i);
+    buffer.resize(info.total_size());
+    copyAlongAxis(static_cast<const uint8_t *>(input->buffer), shape, buffer.data(), info.shape(),
+                  axis, ir::sizeOfDataType(info.typeInfo().type()));
+    desc.inputs.at(i) =
+      std::make_unique<InputDesc>(info, buffer.data(), buffer.size(), input->layout);
+  }
+
+  // Outputs over the padded region are written to internal buffers and cropped afterwards
+  std::vector<ir::Shape> cropped_shapes(num_outputs);
+  for (uint32_t i = 0; i < num_outputs; ++i)
+  {
+    const auto &output = _io_desc.outputs.at(i);
+    if (!output)
+      continue;
+    if (output->layout != subg.layout())
+      throw std::runtime_error{"Cropping outputs in other layouts is not supported"};
+
+    const auto &info = subg.operands().at(subg.getOutputs().at(i)).info();
+    auto &cropped_shape = cropped_shapes.at(i);
+    cropped_shape = info.shape();
+    const bool crop = len != padded_len && static_cast<uint32_t>(cropped_shape.rank()) > axis &&
+                      cropped_shape.dim(axis) == padded_len;
+    if (crop)
+      cropped_shape.dim(axis) = len;
+    const auto cropped_size =
+      cropped_shape.num_elements() * ir::sizeOfDataType(info.typeInfo().type());
+    if (output->size < cropped_size)
+      throw InsufficientBufferSizeException{"Output " + std::to_string(i) +
+                                            "'s buffer is too small for the input shapes"};
+
+    if (!crop)
+    {
+      desc.outputs.at(i) =
+        std::make_unique<OutputDesc>(info, output->buffer, output->size, output->layout);
+      continue;
+    }
+
+    auto &buffer = _pad_buffers.at(num_inputs + i);
+    buffer.resize(info.total_size());
+    desc.outputs.at(i) =
+      std::make_unique<OutputDesc>(info, buffer.data(), buffer.size(), output->layout);
+  }
+
+  primary_executor()->execute(desc);
+
+  for (uint32_t i = 0; i < num_outputs; ++i)
+  {
+    const auto &output = _io_desc.outputs.at(i);
+    if (!output)
+      continue;
+
+    const auto &padded = desc.outputs.at(i);
+    if (padded->buffer != output->buffer)
+    {
+      copyAlongAxis(static_cast<const uint8_t *>(padded->buffer), padded->info.shape(),
+                    static_cast<uint8_t *>(output->buffer), cropped_shapes.at(i), axis,
+                    ir::sizeOfDataType(padded->info.typeInfo().type()));
+    }
+    output->info.shape(cropped_shapes.at(i));
+  }
+}
+
+void Execution::convertInputs()
 {
-  VERBOSE(Execution) << "Start Async execution" << std::endl;
-  if (_async_io_descs.empty())
+  if (_converted_inputs.empty())
+    return;
+  if (!_convert_context)
+    _convert_context = std::make_unique<ruy::Context>();
+
+  for (auto &entry : _converted_inputs)
   {
-    VERBOSE(Execution) << "The input is not ready" << std::endl;
+    const ir::IOIndex index{entry.first};
+    auto &converted = entry.second;
+    const auto &info = _io_desc.inputs.at(index.value())->info;
+    const auto num_elements = getInputShape(index).num_elements();
+    if (converted.user_size < num_elements * sizeof(float))
+      throw InsufficientBufferSizeException{"Input " + std::to_string(index.value()) +
+                                            "'s buffer is too small for the input shape"};
+
+    const auto lease = SharedRuyContext::get().lease(
+      num_elements, std::max(std::thread::hardware_concurrency(), 1u), _convert_context.get());
+    quantize(static_cast<const float *>(converted.user_buffer), info.typeInfo(),
+             converted.buffer.data(), static_cast<int>(num_elements), lease.context());
+  }
+}
+
+void Execution::convertOutputs()
+{
+  if (_converted_outputs.empty())
     return;
+  if (!_convert_context)
+    _convert_context = std::make_unique<ruy::Context>();
+
+  for (auto &entry : _converted_outputs)
+  {
+    auto &converted = entry.second;
+    const auto &output = _io_desc.outputs.at(entry.first);
+    const auto num_elements = output->info.shape().num_elements();
+
+    const auto lease = SharedRuyContext::get().lease(
+      num_elements, std::max(std::thread::hardware_concurrency(), 1u), _convert_context.get());
+    dequantize(converted.buffer.data(), output->info.typeInfo(),
+               static_cast<float *>(converted.user_buffer), static_cast<int>(num_elements),
+               lease.context());
+  }
+}
+
+void Execution::warmup(uint32_t runs)
+{
+  VERBOSE(Execution) << "Warm up executors for " << runs << " runs" << std::endl;
+
+  const auto &subg = primary_subgraph();
+  IODescription desc;
+  std::vector<std::vector<uint8_t>> buffers;
+  for (uint32_t i = 0; i < subg.getInputs().size(); ++i)
+  {
+    const ir::IOIndex index{i};
+    auto info = subg.operands().at(subg.getInputs().at(index)).info();
+    // Padded executors are compiled for the padded shapes already
+    auto shape = _io_desc.dynamic_input_shapes.find(index);
+    if (_pad_axis < 0 && shape != _io_desc.dynamic_input_shapes.end())
+    {
+      info.shape(shape->second);
+      desc.dynamic_input_shapes.emplace(index, shape->second);
+    }
+    if (info.shape().hasUnspecifiedDims())
+      throw std::runtime_error{"Warm-up needs the shape of input " + std::to_string(i)};
+
+    buffers.emplace_back(info.total_size());
+    desc.inputs.emplace_back(std::make_unique<InputDesc>(info, buffers.back().data(),
+                                                         buffers.back().size(), subg.layout()));
+  }
+  for (uint32_t i = 0; i < subg.getOutputs().size(); ++i)
+  {
+    const auto &info = subg.operands().at(subg.getOutputs().at(ir::IOIndex{i})).info();
+    if (info.isDynamic() || info.shape().hasUnspecifiedDims())
+      throw std::runtime_error{"Warm-up does not support dynamic output " + std::to_string(i)};
+
+    buffers.emplace_back(info.total_size());
+    desc.outputs.emplace_back(std::make_unique<OutputDesc>(info, buffers.back().data(),
+                                                           buffers.back().size(), subg.layout()));
+  }
+
+  for (uint32_t n = 0; n < runs; ++n)
+    primary_executor()->execute(desc);
+}
+
+uint64_t Execution::releaseMemory(bool weights)
+{
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    if (_async_running)
+      throw std::runtime_error{"Execution is running"};
+  }
+
+  uint64_t bytes = 0;
+  for (auto &pair : *_executors)
+    bytes += pair.second->releaseMemory(weights);
+
+  VERBOSE(Execution) << "Released " << bytes << " bytes of memory" << std::endl;
+  return bytes;
+}
+
+void Execution::resetStates()
+{
+  {
+    std::lock_guard<std::mutex> lock{_async_mutex};
+    if (_async_running)
+      throw std::runtime_error{"Execution is running"};
   }
 
-  primary_executor()->execute(*_async_io_descs.front().first);
+  for (auto &pair : *_executors)
+    pair.second->resetStates();
+
+  VERBOSE(Execution) << "Reset states" << std::endl;
+}
+
+void Execution::startExecute() { startExecute(nullptr); }
+
+void Execution::startExecute(const FinishCallback &callback)
+{
+  VERBOSE(Execution) << "Queue asynchronous execution" << std::endl;
+
+  beginAsync();
+
+  asyncPool().enqueue(std::make_unique<AsyncJob>([this, callback]() {
+    std::exception_ptr error;
+    try
+    {
+      execute();
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    finishAsync(error);
+
+    // This execution may be gone since here
+    if (callback)
+      callback(error);
+  }));
 }
 
-void Execution::startExecute()
+void Execution::beginAsync()
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  std::lock_guard<std::mutex> lock{_async_mutex};
+  if (_async_running)
+    throw std::runtime_error{"Execution is already running"};
+  _async_running = true;
+  _async_error = nullptr;
+  finished = false;
+}
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+void Execution::finishAsync(std::exception_ptr error)
+{
+  std::lock_guard<std::mutex> lock{_async_mutex};
+  _async_error = error;
+  _async_running = false;
+  finished = true;
+  _async_cv.notify_all();
 }
 
 void Execution::waitFinish()
 {
   VERBOSE(Execution) << "Wait to finish execution" << std::endl;
 
-  _exec_thread->join();
+  std::unique_lock<std::mutex> lock{_async_mutex};
+  _async_cv.wait(lock, [&]() { return !_async_running; });
   finished = true;
+  if (_async_error)
+  {
+    auto error = _async_error;
+    _async_error = nullptr;
+    std::rethrow_exception(error);
+  }
 }
 
 bool Execution::isFinished(void) const { return finished; }
@@ -262,158 +779,326 @@ ir::Shape Execution::getOutputShape(ir::IOIndex ind) const
   if (!isFinished())
     throw std::runtime_error("Cannot get output shape before execution is finished");
 
-  const auto &output_desc = _io_desc.outputs.at(ind.value());
+  const auto &output_desc = currentIODesc().outputs.at(ind.value());
 
   return output_desc->info.shape();
 }
 
-void Execution::asyncIoDescSemWait() { sem_wait(&_async_io_descs_sem); }
-
-void Execution::asyncIoDescSemPost() { sem_post(&_async_io_descs_sem); }
+void Execution::pushNextExe(std::shared_ptr<onert::exec::Execution> next,
+                            onert::ir::IOIndex o_index, onert::ir::IOIndex i_index)
+{
+  auto it = std::find_if(_next_links.begin(), _next_links.end(),
+                         [&](const auto &link) { return link->consumer == next.get(); });
+  if (it == _next_links.end())
+  {
+    auto link = std::make_shared<PipelineLink>();
+    link->producer = this;
+    link->consumer = next.get();
+    next->_prev_links.emplace_back(link);
+    _next_links.emplace_back(link);
+    it = std::prev(_next_links.end());
+  }
+  (*it)->io.emplace_back(o_index, i_index);
+}
 
-void Execution::runInference()
+void Execution::preparePipeline(uint32_t depth)
 {
-  uint32_t inference_cnt;
-  uint32_t output_sz = primary_subgraph().getOutputs().size();
-  while (true)
+  if (depth == 0)
+    throw std::runtime_error{"Pipeline depth must be positive"};
+
+  const auto &subg = primary_subgraph();
+  const auto num_inputs = subg.getInputs().size();
+  const auto num_outputs = subg.getOutputs().size();
+  auto input_info = [&](const ir::IOIndex &index) -> const ir::OperandInfo & {
+    const auto &info = subg.operands().at(subg.getInputs().at(index)).info();
+    if (info.isDynamic())
+      throw std::runtime_error{"Pipeline does not support dynamic inputs"};
+    return info;
+  };
+
+  // The stage without previous stages takes inputs from users
+  if (_prev_links.empty())
   {
-    if (isEmptyQueue())
+    auto link = std::make_shared<PipelineLink>();
+    link->consumer = this;
+    for (uint32_t i = 0; i < num_inputs; i++)
+      link->io.emplace_back(ir::IOIndex{i}, ir::IOIndex{i});
+    _prev_links.emplace_back(link);
+  }
+
+  // Frames of a link are allocated by its consumer
+  std::vector<bool> connected(num_inputs, false);
+  for (auto &link : _prev_links)
+  {
+    for (const auto &io : link->io)
     {
-      if (isFinished())
+      if (connected.at(io.second.value()))
+        throw std::runtime_error{"Pipeline input " + std::to_string(io.second.value()) +
+                                 " is connected more than once"};
+      connected.at(io.second.value()) = true;
+      if (link->producer)
       {
-        if (!next_exes.empty())
-        {
-          for (uint32_t i = 0; i < next_exes.size(); i++)
-          {
-            std::get<0>(next_exes[i])->setFinish();
-          }
-        }
-        else
-        {
-          sholudStop();
-        }
-        break;
+        const auto &producer_subg = link->producer->primary_subgraph();
+        const auto &output_info =
+          producer_subg.operands().at(producer_subg.getOutputs().at(io.first)).info();
+        if (output_info.total_size() != input_info(io.second).total_size())
+          throw std::runtime_error{"Pipeline output and input connected have different sizes"};
       }
     }
-    else
+
+    link->frames.resize(depth);
+    link->filled = std::make_unique<SPSCRing<PipelineFrame *>>(depth + 1);
+    link->free = std::make_unique<SPSCRing<PipelineFrame *>>(depth);
+    for (auto &frame : link->frames)
+    {
+      for (const auto &io : link->io)
+        frame.buffers.emplace_back(input_info(io.second).total_size());
+      link->free->tryPush(&frame);
+    }
+  }
+  if (std::find(connected.begin(), connected.end(), false) != connected.end())
+    throw std::runtime_error{"Pipeline has an input which is not connected"};
+
+  // Outputs are written to frames of next stages or to results of the last stage directly, so
+  // only outputs which no stage takes in the middle of the pipeline have buffers of their own
+  _pipeline_output_targets.assign(num_outputs, {});
+  for (uint32_t l = 0; l < _next_links.size(); l++)
+  {
+    const auto &io = _next_links[l]->io;
+    for (uint32_t j = 0; j < io.size(); j++)
+      _pipeline_output_targets.at(io.at(j).first.value()).emplace_back(l, j);
+  }
+  _pipeline_outputs.clear();
+  for (uint32_t i = 0; i < num_outputs; i++)
+  {
+    const auto &info = subg.operands().at(subg.getOutputs().at(ir::IOIndex{i})).info();
+    if (info.isDynamic())
+      throw std::runtime_error{"Pipeline does not support dynamic outputs"};
+    const bool own_buffer = !_next_links.empty() && _pipeline_output_targets.at(i).empty();
+    _pipeline_outputs.emplace_back(own_buffer ? info.total_size() : 0);
+  }
+  _pipeline_next_frames.assign(_next_links.size(), nullptr);
+
+  // Frames of every link are used in the same order, so one description serves each frame index
+  _pipeline_descs.clear();
+  for (uint32_t k = 0; k < depth; k++)
+  {
+    auto desc = std::make_unique<IODescription>();
+    desc->inputs.resize(num_inputs);
+    desc->outputs.resize(num_outputs);
+    for (auto &link : _prev_links)
     {
-      for (uint32_t i = 0; i < output_sz; i++)
+      auto &frame = link->frames.at(k);
+      for (uint32_t j = 0; j < link->io.size(); j++)
       {
-        auto opidx = primary_subgraph().getOutputs().at(i);
-        auto shape = primary_subgraph().operands().at(opidx).shape();
-        auto dtype = primary_subgraph().operands().at(opidx).typeInfo().type();
-        auto rank = shape.rank();
-        uint32_t tensor_size = 1;
-        for (int32_t j = 0; j < rank; j++)
-        {
-          tensor_size *= shape.dim(j);
-        }
-        if (dtype == onert::ir::DataType::FLOAT32 || dtype == onert::ir::DataType::INT32 ||
-            dtype == onert::ir::DataType::UINT32)
-          tensor_size *= 4;
-        else if (dtype == onert::ir::DataType::INT64)
-          tensor_size *= 8;
-        void *_buffer = (void *)malloc(tensor_size);
-        if (_buffer == NULL)
-        {
-          throw std::runtime_error{"malloc failed"};
-        }
-        executeAsyncOutput(onert::ir::IOIndex(i), _buffer, tensor_size);
+        const auto &index = link->io.at(j).second;
+        desc->inputs.at(index.value()) = std::make_unique<InputDesc>(
+          input_info(index), frame.buffers.at(j).data(), frame.buffers.at(j).size(),
+          ir::Layout::NHWC);
       }
-      AsyncExecute();
+    }
+    for (uint32_t i = 0; i < num_outputs; i++)
+    {
+      const auto &info = subg.operands().at(subg.getOutputs().at(ir::IOIndex{i})).info();
+      // Buffers of outputs are bound for each run by bindPipelineOutputs
+      desc->outputs.at(i) =
+        std::make_unique<OutputDesc>(info, nullptr, info.total_size(), ir::Layout::NHWC);
+    }
+    _pipeline_descs.emplace_back(std::move(desc));
+  }
+  _pipeline_frames.resize(_prev_links.size());
+}
 
-      // set inputs of next execution
-      auto _io_desc = getAsyncIoDescs()->front().first;
-      inference_cnt = getAsyncIoDescs()->front().second;
-      getAsyncIoDescs()->pop_front();
+void Execution::pushPipelineInput(const std::vector<void *> &inputs,
+                                  const std::vector<uint32_t> &lengths)
+{
+  if (_prev_links.size() != 1 || _prev_links.front()->producer != nullptr)
+    throw std::runtime_error{"Pipeline inputs must be pushed to the first stage"};
+  auto &link = *_prev_links.front();
 
-      for (uint32_t i = 0; i < next_exes.size(); i++)
-      {
-        auto next_exe = std::get<0>(next_exes[i]);
-        auto o_index = std::get<1>(next_exes[i]);
-        auto i_index = std::get<2>(next_exes[i]);
-
-        next_exe->asyncIoDescSemWait();
-        auto next_io_descs = next_exe->getAsyncIoDescs();
-        bool exist = false;
-        for (auto iter = next_io_descs->begin(); iter != next_io_descs->end(); iter++)
-        {
-          if (inference_cnt == iter->second)
-          {
-            exist = true;
-          }
-        }
+  if (inputs.empty())
+  {
+    waitPush<PipelineFrame *>(*link.filled, nullptr);
+    return;
+  }
 
-        if (!exist)
-        {
-          next_exe->createNewAsyncDesc(inference_cnt);
-        }
-        for (auto iter = next_io_descs->begin(); iter != next_io_descs->end(); iter++)
-        {
-          if (inference_cnt == iter->second)
-          {
-            const auto input_index = next_exe->primary_subgraph().getInputs().at(i_index.value());
-            const auto info = next_exe->primary_subgraph().operands().at(input_index).info();
-
-            size_t length = _io_desc->outputs[o_index.value()]->size;
-            void *_buffer = (void *)malloc(length);
-            if (_buffer == NULL)
-            {
-              throw std::runtime_error{"malloc failed"};
-            }
-            memcpy(_buffer, _io_desc->outputs[o_index.value()]->buffer, length);
-
-            iter->first->inputs.at(i_index.value()) = std::make_unique<onert::exec::InputDesc>(
-              info, _buffer, length, onert::ir::Layout::NHWC);
-            break;
-          }
-        }
-        next_exe->asyncIoDescSemPost();
-      }
+  if (inputs.size() != link.io.size() || lengths.size() != inputs.size())
+    throw std::runtime_error{"Pipeline inputs do not match the model inputs"};
+  for (uint32_t j = 0; j < inputs.size(); j++)
+  {
+    if (lengths.at(j) < link.frames.front().buffers.at(j).size())
+      throw std::runtime_error{"Too small length"};
+  }
+
+  auto frame = waitPop(*link.free);
+  for (uint32_t j = 0; j < inputs.size(); j++)
+    std::memcpy(frame->buffers.at(j).data(), inputs.at(j), frame->buffers.at(j).size());
+  waitPush(*link.filled, frame);
+}
+
+bool Execution::popPipelineOutput(std::vector<void *> &outputs)
+{
+  std::unique_lock<std::mutex> lock{_pipeline_mutex};
+  _pipeline_cv.wait(lock, [&]() { return !_pipeline_results.empty() || _pipeline_ended; });
+  if (_pipeline_results.empty())
+    return false;
+
+  auto &result = _pipeline_results.front();
+  outputs.insert(outputs.end(), result.begin(), result.end());
+  _pipeline_results.pop_front();
+  return true;
+}
 
-      if (next_exes.empty())
+void Execution::runInference()
+{
+  bool failed = false;
+  for (uint32_t seq = 0;; seq++)
+  {
+    auto &desc = *_pipeline_descs.at(seq % _pipeline_descs.size());
+
+    bool ended = false;
+    for (uint32_t l = 0; l < _prev_links.size(); l++)
+    {
+      _pipeline_frames[l] = waitPop(*_prev_links[l]->filled);
+      ended |= (_pipeline_frames[l] == nullptr);
+    }
+
+    if (ended)
+    {
+      // Links end at the same inference unless a previous stage has failed, so keep returning
+      // frames of the others until they end too
+      for (uint32_t l = 0; l < _prev_links.size(); l++)
       {
-        std::vector<void *> results;
-        for (uint32_t i = 0; i < _io_desc->outputs.size(); i++)
+        while (_pipeline_frames[l] != nullptr)
         {
-          size_t length = _io_desc->outputs[i]->size;
-          void *_buffer = (void *)malloc(length);
-          if (_buffer == NULL)
-          {
-            throw std::runtime_error{"malloc failed"};
-          }
-          memcpy(_buffer, _io_desc->outputs[i]->buffer, length);
-          results.push_back(_buffer);
+          waitPush(*_prev_links[l]->free, _pipeline_frames[l]);
+          _pipeline_frames[l] = waitPop(*_prev_links[l]->filled);
         }
-        _async_results.push_back(results);
       }
+      break;
+    }
 
-      for (uint32_t i = 0; i < _io_desc->inputs.size(); i++)
+    if (!failed)
+    {
+      try
       {
-        auto p = _io_desc->inputs.at(i).release();
-        if (p)
-        {
-          free((void *)p->buffer);
-          delete p;
-        }
+        bindPipelineOutputs(desc);
+        const auto begin = std::chrono::steady_clock::now();
+        primary_executor()->execute(desc);
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+        _pipeline_time_us +=
+          std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        _pipeline_runs++;
+        passPipelineOutputs();
       }
-      for (uint32_t i = 0; i < _io_desc->outputs.size(); i++)
+      catch (const std::exception &e)
       {
-        auto p = _io_desc->outputs.at(i).release();
-        if (p)
-        {
-          free(p->buffer);
-          delete p;
-        }
+        VERBOSE(Execution) << "Pipeline stage failed : " << e.what() << std::endl;
+        failed = true;
+        // Frames taken from next links are not returned, as only their consumers push free ones
+        for (auto buffer : _pipeline_result_buffers)
+          free(buffer);
+        _pipeline_result_buffers.clear();
+        // Let next stages finish without waiting for the end of inputs
+        endPipeline();
+      }
+    }
+
+    for (uint32_t l = 0; l < _prev_links.size(); l++)
+    {
+      assert(_pipeline_frames[l] == &_prev_links[l]->frames.at(seq % _pipeline_descs.size()));
+      waitPush(*_prev_links[l]->free, _pipeline_frames[l]);
+    }
+  }
+
+  if (!failed)
+    endPipeline();
+}
+
+uint64_t Execution::pipelineStageTime() const
+{
+  const auto runs = _pipeline_runs.load();
+  return runs == 0 ? 0 : _pipeline_time_us.load() / runs;
+}
+
+void Execution::bindPipelineOutputs(IODescription &desc)
+{
+  // Frames are taken before the run so that the executor writes outputs into them, which may wait
+  // for a consumer a run earlier than copying outputs after the run did
+  for (uint32_t l = 0; l < _next_links.size(); l++)
+    _pipeline_next_frames[l] = waitPop(*_next_links[l]->free);
+
+  // Results are handed over to users, who free them
+  if (_next_links.empty())
+  {
+    assert(_pipeline_result_buffers.empty());
+    for (const auto &output : desc.outputs)
+    {
+      void *buffer = malloc(output->size);
+      if (buffer == nullptr)
+      {
+        for (auto result : _pipeline_result_buffers)
+          free(result);
+        _pipeline_result_buffers.clear();
+        throw std::runtime_error{"malloc failed"};
       }
-      delete _io_desc;
+      _pipeline_result_buffers.push_back(buffer);
+    }
+  }
+
+  for (uint32_t i = 0; i < desc.outputs.size(); i++)
+  {
+    const auto &targets = _pipeline_output_targets.at(i);
+    auto &buffer = desc.outputs.at(i)->buffer;
+    if (!targets.empty())
+      buffer = _pipeline_next_frames.at(targets.front().first)
+                 ->buffers.at(targets.front().second)
+                 .data();
+    else if (_next_links.empty())
+      buffer = _pipeline_result_buffers.at(i);
+    else
+      buffer = _pipeline_outputs.at(i).data();
+  }
+}
+
+void Execution::passPipelineOutputs()
+{
+  // Outputs taken by more than one input are copied from the frame they were written to
+  for (const auto &targets : _pipeline_output_targets)
+  {
+    for (uint32_t t = 1; t < targets.size(); t++)
+    {
+      const auto &src = _pipeline_next_frames.at(targets.front().first)
+                          ->buffers.at(targets.front().second);
+      auto &dst = _pipeline_next_frames.at(targets.at(t).first)->buffers.at(targets.at(t).second);
+      std::memcpy(dst.data(), src.data(), dst.size());
     }
   }
+
+  for (uint32_t l = 0; l < _next_links.size(); l++)
+  {
+    waitPush(*_next_links[l]->filled, _pipeline_next_frames[l]);
+    _pipeline_next_frames[l] = nullptr;
+  }
+
+  if (_next_links.empty())
+  {
+    std::lock_guard<std::mutex> lock{_pipeline_mutex};
+    _pipeline_results.emplace_back(std::move(_pipeline_result_buffers));
+    _pipeline_result_buffers.clear();
+    _pipeline_cv.notify_all();
+  }
 }
 
-bool Execution::stopWait(void) const { return stop_wait; }
+void Execution::endPipeline()
+{
+  for (auto &link : _next_links)
+    waitPush<PipelineFrame *>(*link->filled, nullptr);
 
-void Execution::sholudStop() { stop_wait = true; }
+  std::lock_guard<std::mutex> lock{_pipeline_mutex};
+  _pipeline_ended = true;
+  _pipeline_cv.notify_all();
+}
 
 } // namespace exec
 } // namespace onert
@@ -15,6 +15,10 @@
  */
 
 #include "exec/Execution.h"
+#include "exec/ExecutionBatcher.h"
+
+#include "ExecutionObservers.h"
+#include "ExecutorBase.h"
 
 #include "compiler/Compiler.h"
 #include "ir/Graph.h"
@@ -118,6 +122,75 @@ TEST(ExecInstance, simple)
   }
 }
 
+TEST(ExecInstance, warmup)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+
+  // Warm-up runs with its own buffers
+  execution.warmup(2);
+  for (auto i = 0; i < 4; i++)
+    EXPECT_EQ(output_buffer[i], 0);
+
+  execution.execute();
+  for (auto i = 0; i < 4; i++)
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+}
+
+TEST(ExecInstance, observer_after_warmup)
+{
+  struct CountingObserver : public onert::exec::IExecutionObserver
+  {
+    CountingObserver(int &jobs) : _jobs{jobs} {}
+    void handleJobBegin(onert::exec::IExecutor *, SubgraphIndex, OperationIndex,
+                        const onert::backend::Backend *) override
+    {
+      _jobs++;
+    }
+    void handleJobEnd(onert::exec::IExecutor *, SubgraphIndex, OperationIndex,
+                      const onert::backend::Backend *) override
+    {
+    }
+
+  private:
+    int &_jobs;
+  };
+
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  execution.warmup(2);
+
+  // Observers added after runs without them are notified of every operation
+  int jobs = 0;
+  auto executor = dynamic_cast<onert::exec::ExecutorBase *>(executors->at(SubgraphIndex{0}).get());
+  ASSERT_NE(executor, nullptr);
+  executor->addObserver(std::make_unique<CountingObserver>(jobs));
+  execution.execute();
+  EXPECT_GE(jobs, 2);
+  for (auto i = 0; i < 4; i++)
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+}
+
 TEST(ExecInstance, twoCompile)
 {
   auto mockup = CompiledMockUpModel();
@@ -165,6 +238,174 @@ TEST(ExecInstance, twoCompile)
   }
 }
 
+TEST(ExecInstance, specializeExecutors)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+  // Executors of another compilation for the same shapes
+  auto other = CompiledMockUpModel();
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution execution{executors};
+  execution.changeInputShape(input1, Shape{1, 2, 2, 1});
+  execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+
+  execution.specializeExecutors(other.executors);
+  execution.execute();
+
+  EXPECT_EQ(execution.getInputShape(input1), (Shape{1, 2, 2, 1}));
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+}
+
+TEST(ExecInstance, padExecutors)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+  auto other = CompiledMockUpModel();
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[2] = {1, 0};
+  const float input2_buffer[2] = {1, -3};
+  float output_buffer[2] = {};
+  const float output_expected[2] = {5, -2};
+
+  onert::exec::Execution execution{executors};
+  execution.changeInputShape(input1, Shape{1, 1, 2, 1});
+  execution.changeInputShape(input2, Shape{1, 1, 2, 1});
+  execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 8);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 8);
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 8);
+
+  execution.padExecutors(other.executors, 1);
+  execution.execute();
+
+  EXPECT_EQ(execution.getInputShape(input1), (Shape{1, 1, 2, 1}));
+  EXPECT_EQ(execution.getOutputShape(output), (Shape{1, 1, 2, 1}));
+  for (auto i = 0; i < 2; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+}
+
+TEST(ExecInstance, neg_padExecutors)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+  auto other = CompiledMockUpModel();
+
+  onert::exec::Execution execution{executors};
+  execution.changeInputShape(IOIndex{0}, Shape{1, 1, 2, 1});
+
+  // The shape differs along another axis than the padded one
+  EXPECT_ANY_THROW(execution.padExecutors(other.executors, 2));
+}
+
+TEST(ExecInstance, useIOBuffers)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input1_buffers[2][4] = {{1, 0, -1, -2}, {2, 1, -2, 0}};
+  const float input2_buffers[2][4] = {{1, -3, 2, -4}, {-3, 3, 1, 2}};
+  float output_buffers[2][4] = {};
+  const float output_expected[2][4] = {{5, -2, 0, -1}, {2, 5, -2, 7}};
+
+  onert::exec::Execution execution{executors};
+  for (uint32_t slot = 0; slot < 2; slot++)
+  {
+    execution.registerIOBuffers(slot, {{input1_buffers[slot], 16}, {input2_buffers[slot], 16}},
+                                {{output_buffers[slot], 16}});
+  }
+
+  for (uint32_t slot = 0; slot < 2; slot++)
+  {
+    execution.useIOBuffers(slot);
+    execution.execute();
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffers[slot][i], output_expected[slot][i]);
+    }
+  }
+}
+
+TEST(ExecInstance, neg_useIOBuffers)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  const float input_buffer[4] = {};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+  EXPECT_ANY_THROW(execution.registerIOBuffers(0, {{input_buffer, 16}, {input_buffer, 8}},
+                                               {{output_buffer, 16}}));
+  EXPECT_ANY_THROW(execution.useIOBuffers(0));
+}
+
+TEST(ExecInstance, convertIO)
+{
+  // Model: an add of quantized inputs into a quantized output
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::QUANT_UINT8_ASYMM, 0.5f, 10};
+  auto operand_lhs = graph->addOperand(shape, type);
+  auto operand_rhs = graph->addOperand(shape, type);
+  auto operand_result = graph->addOperand(shape, type);
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{operand_lhs, operand_rhs}, OperandIndexSequence{operand_result}, param));
+  graph->addInput(operand_lhs);
+  graph->addInput(operand_rhs);
+  graph->addOutput(operand_result);
+  graph->verify();
+
+  auto subgs = std::make_shared<onert::ir::Subgraphs>();
+  subgs->push(onert::ir::SubgraphIndex{0}, graph);
+  auto tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgs.get());
+  onert::compiler::Compiler compiler{subgs, tracing_ctx.get()};
+  auto executors = compiler.compile();
+
+  const float input1_buffer[4] = {1, 0.5, -1, -2};
+  const float input2_buffer[4] = {1.5, -3, 2, -2.5};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {2.5, -2.5, 1, -4.5};
+
+  // Inputs are quantized and outputs dequantized while they are bound
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, DataType::FLOAT32, input1_buffer, 16);
+  execution.setInput(IOIndex{1}, DataType::FLOAT32, input2_buffer, 16);
+  execution.setOutput(IOIndex{0}, DataType::FLOAT32, output_buffer, 16);
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+
+  // Only float is converted, and data in the type of the model is bound as it is
+  EXPECT_ANY_THROW(execution.setInput(IOIndex{0}, DataType::FLOAT32, input1_buffer, 4));
+  EXPECT_ANY_THROW(execution.setInput(IOIndex{0}, DataType::INT32, input1_buffer, 16));
+  EXPECT_NO_THROW(execution.setInput(IOIndex{0}, DataType::QUANT_UINT8_ASYMM, input1_buffer, 4));
+}
+
 // Support two initialized execution instance then ordered execution
 TEST(ExecInstance, twoExecution)
 {
@@ -299,4 +540,125 @@ TEST(ExecInstance, async)
   }
 }
 
+TEST(ExecInstance, batcher)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+  ASSERT_TRUE(onert::exec::ExecutionBatcher::batchable(*executors));
+
+  // Runs wait long enough for all of them to be in a batch
+  constexpr uint32_t num_runs = 4;
+  onert::exec::ExecutionBatcher batcher{executors, num_runs, 10 * 1000 * 1000};
+
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float input1_buffers[num_runs][4];
+  float output_buffers[num_runs][4] = {};
+  std::vector<std::shared_ptr<onert::exec::Execution>> executions;
+  for (uint32_t r = 0; r < num_runs; ++r)
+  {
+    for (auto i = 0; i < 4; i++)
+      input1_buffers[r][i] = r * 10 + i;
+
+    auto execution = std::make_shared<onert::exec::Execution>(executors);
+    execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffers[r]), 16);
+    execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+    execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffers[r]), 16);
+    batcher.startExecute(execution);
+    executions.emplace_back(std::move(execution));
+  }
+
+  const float rhs2[4] = {3, 1, -1, 5};
+  for (uint32_t r = 0; r < num_runs; ++r)
+  {
+    executions[r]->waitFinish();
+    ASSERT_TRUE(executions[r]->isFinished());
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffers[r][i], input1_buffers[r][i] + input2_buffer[i] + rhs2[i]);
+    }
+  }
+  EXPECT_EQ(batcher.batches(), 1);
+}
+
+TEST(ExecInstance, neg_batcher_alone)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  onert::exec::ExecutionBatcher batcher{executors, 4, 0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  // A run without others to batch with runs alone
+  auto execution = std::make_shared<onert::exec::Execution>(executors);
+  execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  batcher.startExecute(execution);
+  execution->waitFinish();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+  EXPECT_EQ(batcher.batches(), 0);
+}
+
+TEST(ExecInstance, pipeline)
+{
+  auto mockup1 = CompiledMockUpModel();
+  auto mockup2 = CompiledMockUpModel();
+
+  // Both inputs of the second stage take the output of the first stage
+  auto stage1 = std::make_shared<onert::exec::Execution>(mockup1.executors);
+  auto stage2 = std::make_shared<onert::exec::Execution>(mockup2.executors);
+  stage1->pushNextExe(stage2, IOIndex{0}, IOIndex{0});
+  stage1->pushNextExe(stage2, IOIndex{0}, IOIndex{1});
+  stage1->preparePipeline(2);
+  stage2->preparePipeline(2);
+  std::thread thread1{&onert::exec::Execution::runInference, stage1.get()};
+  std::thread thread2{&onert::exec::Execution::runInference, stage2.get()};
+
+  // Push more inferences than the depth to be blocked until the stages run
+  float input1_buffer[4] = {1, 0, -1, -2};
+  float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {13, -3, -1, 3};
+  std::vector<void *> inputs{input1_buffer, input2_buffer};
+  std::vector<uint32_t> lengths{16, 16};
+  for (int n = 0; n < 5; n++)
+    stage1->pushPipelineInput(inputs, lengths);
+  stage1->pushPipelineInput({}, {});
+
+  for (int n = 0; n < 5; n++)
+  {
+    std::vector<void *> outputs;
+    ASSERT_TRUE(stage2->popPipelineOutput(outputs));
+    ASSERT_EQ(outputs.size(), 1);
+    for (auto i = 0; i < 4; i++)
+      EXPECT_EQ(static_cast<float *>(outputs[0])[i], output_expected[i]);
+    free(outputs[0]);
+  }
+  thread1.join();
+  thread2.join();
+
+  std::vector<void *> outputs;
+  ASSERT_FALSE(stage2->popPipelineOutput(outputs));
+}
+
+TEST(ExecInstance, neg_pipeline_unconnected)
+{
+  auto mockup1 = CompiledMockUpModel();
+  auto mockup2 = CompiledMockUpModel();
+
+  auto stage1 = std::make_shared<onert::exec::Execution>(mockup1.executors);
+  auto stage2 = std::make_shared<onert::exec::Execution>(mockup2.executors);
+  stage1->pushNextExe(stage2, IOIndex{0}, IOIndex{0});
+  stage1->preparePipeline(2);
+  EXPECT_ANY_THROW(stage2->preparePipeline(2));
+  EXPECT_ANY_THROW(stage2->pushPipelineInput({}, {}));
+}
+
 } // namespace
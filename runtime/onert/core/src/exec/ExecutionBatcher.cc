@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ExecutionBatcher.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+// Return true if an operand is static with batch 1 on the first axis
+bool hasBatchOfOne(const ir::OperandInfo &info)
+{
+  const auto &shape = info.shape();
+  return !info.isDynamic() && !shape.hasUnspecifiedDims() && shape.rank() >= 1 &&
+         shape.dim(0) == 1;
+}
+
+ir::Shape batchShape(const ir::Shape &sample_shape, uint32_t batch_size)
+{
+  auto shape = sample_shape;
+  shape.dim(0) = static_cast<int32_t>(batch_size);
+  return shape;
+}
+
+} // namespace
+
+ExecutionBatcher::ExecutionBatcher(const std::shared_ptr<ExecutorMap> &executors,
+                                   uint32_t max_batch, uint32_t timeout_us)
+  : _max_batch{std::max(max_batch, 1u)}, _timeout{timeout_us},
+    _batch_execution{std::make_unique<Execution>(executors)}
+{
+  if (!batchable(*executors))
+  {
+    VERBOSE(ExecutionBatcher) << "Model is not batchable, executions run alone" << std::endl;
+    _disabled = true;
+  }
+
+  const auto &graph = _batch_execution->primary_subgraph();
+  for (const auto &ind : graph.getInputs())
+    _input_sizes.push_back(graph.operands().at(ind).info().total_size());
+  for (const auto &ind : graph.getOutputs())
+    _output_sizes.push_back(graph.operands().at(ind).info().total_size());
+  _input_buffers.resize(_input_sizes.size());
+  _output_buffers.resize(_output_sizes.size());
+
+  _worker = std::thread{&ExecutionBatcher::work, this};
+}
+
+ExecutionBatcher::~ExecutionBatcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stop = true;
+  }
+  _queue_cv.notify_all();
+  if (_worker.joinable())
+    _worker.join();
+}
+
+bool ExecutionBatcher::batchable(const ExecutorMap &executors)
+{
+  // Subgraphs other than the primary one run with inputs given by operations
+  const auto &graph = executors.at(ir::SubgraphIndex{0})->graph();
+  for (const auto &ind : graph.getInputs() + graph.getOutputs())
+  {
+    if (!ind.valid() || !hasBatchOfOne(graph.operands().at(ind).info()))
+      return false;
+  }
+  return graph.getInputs().size() > 0;
+}
+
+void ExecutionBatcher::startExecute(const std::shared_ptr<Execution> &execution)
+{
+  execution->beginAsync();
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _queue.push_back({execution, std::chrono::steady_clock::now()});
+  }
+  _queue_cv.notify_all();
+}
+
+void ExecutionBatcher::work()
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  while (true)
+  {
+    _queue_cv.wait(lock, [&]() { return _stop || !_queue.empty(); });
+    if (_queue.empty())
+      break;
+
+    // Wait for more runs within the timeout of the first one
+    const auto deadline = _queue.front().arrival + _timeout;
+    _queue_cv.wait_until(lock, deadline, [&]() { return _stop || _queue.size() >= _max_batch; });
+
+    const auto batch_size = std::min<size_t>(_queue.size(), _max_batch);
+    std::vector<Request> batch(_queue.begin(), _queue.begin() + batch_size);
+    _queue.erase(_queue.begin(), _queue.begin() + batch_size);
+
+    // Runs started meanwhile are queued for the next batch
+    lock.unlock();
+    runBatch(batch);
+    lock.lock();
+  }
+}
+
+void ExecutionBatcher::runBatch(const std::vector<Request> &batch)
+{
+  std::vector<Execution *> joined;
+  for (const auto &request : batch)
+  {
+    if (!_disabled && canJoin(*request.execution))
+      joined.push_back(request.execution.get());
+    else
+      runAlone(*request.execution);
+  }
+
+  if (joined.size() == 1)
+  {
+    runAlone(*joined.front());
+  }
+  else if (joined.size() > 1 && !tryBatch(joined))
+  {
+    VERBOSE(ExecutionBatcher) << "Batch failed, executions run alone from now on" << std::endl;
+    _disabled = true;
+    for (auto execution : joined)
+      runAlone(*execution);
+  }
+}
+
+bool ExecutionBatcher::tryBatch(const std::vector<Execution *> &batch)
+{
+  const auto batch_size = static_cast<uint32_t>(batch.size());
+  VERBOSE(ExecutionBatcher) << "Run a batch of " << batch_size << " executions" << std::endl;
+
+  const auto &graph = _batch_execution->primary_subgraph();
+  try
+  {
+    // Gather inputs along the batch axis
+    for (uint32_t i = 0; i < _input_sizes.size(); ++i)
+    {
+      const ir::IOIndex index{i};
+      const auto &sample_shape = graph.operands().at(graph.getInputs().at(index)).shape();
+      _batch_execution->changeInputShape(index, batchShape(sample_shape, batch_size));
+
+      auto &buffer = _input_buffers[i];
+      buffer.resize(_input_sizes[i] * batch_size);
+      for (uint32_t b = 0; b < batch_size; ++b)
+      {
+        const auto &desc = batch[b]->_io_desc.inputs[i];
+        std::memcpy(buffer.data() + b * _input_sizes[i], desc->buffer, _input_sizes[i]);
+      }
+      _batch_execution->setInput(index, buffer.data(), buffer.size());
+    }
+
+    for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+    {
+      auto &buffer = _output_buffers[i];
+      buffer.resize(_output_sizes[i] * batch_size);
+      _batch_execution->setOutput(ir::IOIndex{i}, buffer.data(), buffer.size());
+    }
+
+    _batch_execution->execute();
+
+    // Outputs other than a batch of samples mean that samples are not independent
+    for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+    {
+      const ir::IOIndex index{i};
+      const auto &sample_shape = graph.operands().at(graph.getOutputs().at(index)).shape();
+      if (_batch_execution->getOutputShape(index) != batchShape(sample_shape, batch_size))
+        return false;
+    }
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(ExecutionBatcher) << "Error in a batch: " << e.what() << std::endl;
+    return false;
+  }
+
+  // Scatter outputs to the executions
+  for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+  {
+    const auto &buffer = _output_buffers[i];
+    for (uint32_t b = 0; b < batch_size; ++b)
+    {
+      const auto &desc = batch[b]->_io_desc.outputs[i];
+      std::memcpy(desc->buffer, buffer.data() + b * _output_sizes[i], _output_sizes[i]);
+    }
+  }
+
+  ++_batches;
+  for (auto execution : batch)
+    execution->finishAsync(nullptr);
+  return true;
+}
+
+bool ExecutionBatcher::canJoin(const Execution &execution) const
+{
+  // Executions set up for other ways of running are run as they are
+  if (execution._io_slot >= 0 || execution._pad_axis >= 0 ||
+      !execution._converted_inputs.empty() || !execution._converted_outputs.empty() ||
+      !execution._io_desc.dynamic_input_shapes.empty() || !execution._prev_links.empty() ||
+      !execution._next_links.empty() || execution._run_stats || execution._minmax_records)
+    return false;
+
+  const auto &graph = execution.primary_subgraph();
+  for (uint32_t i = 0; i < _input_sizes.size(); ++i)
+  {
+    const auto &desc = execution._io_desc.inputs[i];
+    const auto &info = graph.operands().at(graph.getInputs().at(ir::IOIndex{i})).info();
+    if (!desc || !desc->buffer || desc->size < _input_sizes[i] ||
+        desc->layout != ir::Layout::NHWC || desc->info.shape() != info.shape() ||
+        desc->info.typeInfo().type() != info.typeInfo().type())
+      return false;
+  }
+  for (uint32_t i = 0; i < _output_sizes.size(); ++i)
+  {
+    const auto &desc = execution._io_desc.outputs[i];
+    const auto &info = graph.operands().at(graph.getOutputs().at(ir::IOIndex{i})).info();
+    if (!desc || !desc->buffer || desc->size < _output_sizes[i] ||
+        desc->layout != ir::Layout::NHWC || desc->info.shape() != info.shape() ||
+        desc->info.typeInfo().type() != info.typeInfo().type())
+      return false;
+  }
+  return true;
+}
+
+void ExecutionBatcher::runAlone(Execution &execution)
+{
+  std::exception_ptr error;
+  try
+  {
+    execution.execute();
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+  execution.finishAsync(error);
+}
+
+} // namespace exec
+} // namespace onert
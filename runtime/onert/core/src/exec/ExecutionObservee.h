@@ -41,6 +41,12 @@ public:
    * @param observer Observer to be added
    */
   void add(std::unique_ptr<IExecutionObserver> observer);
+  /**
+   * @brief Check whether there is no observer
+   *
+   * @return @c true if no observer is registered, otherwise @c false
+   */
+  bool empty() const { return _observers.empty(); }
   void notifySubgraphBegin(ir::SubgraphIndex ind);
   void notifySubgraphEnd(ir::SubgraphIndex ind);
   void notifyJobBegin(IExecutor *executor, ir::SubgraphIndex subg_ind, ir::OperationIndex op_ind,
@@ -18,12 +18,19 @@
 
 #include "../util/EventWriter.h"
 
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
 #include <misc/polymorphic_downcast.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <map>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 
 namespace
 {
@@ -102,30 +109,91 @@ void ProfileObserver::handleJobEnd(IExecutor *exec, ir::SubgraphIndex,
   {
     size += exec->graph().operands().at(ind).info().total_size();
   }
+
+  const backend::Backend *record_backend = backend;
+  std::string record_name = node_name;
   if (node_name == "Permute")
   {
-    // TODO Change it to updateOperationExecTime()
-    _et->updatePermuteTime(backend, backend, is_quantized, size, timer_res);
+    // Backends of Permute are unknown if transfer calibration is not enabled
+    auto found = _permute_backends.find(op_ind);
+    const auto backends =
+      (found != _permute_backends.end()) ? found->second : BackendPair{backend, backend};
+    if (found != _permute_backends.end())
+      _updated_pairs.insert(backends);
+
+    // NOTE Permute time is recorded as exec time of an operation named after the destination
+    record_backend = backends.first;
+    record_name = backends.second->config()->id();
   }
-  else
+
+  const auto prev_time = _et->getOperationExecTime(record_backend, record_name, is_quantized, size);
+  _et->updateOperationExecTime(record_backend, record_name, is_quantized, size, timer_res);
+
+  if (_online_profiling)
   {
-    _et->updateOperationExecTime(backend, node_name, is_quantized, size, timer_res);
+    const auto time = _et->getOperationExecTime(record_backend, record_name, is_quantized, size);
+    // The first record for the size changes the estimate completely
+    double change = 1.0;
+    if (prev_time > 0)
+      change = std::abs(time - prev_time) / static_cast<double>(prev_time);
+    _online_profiling->addChange(change);
   }
 };
 
+void ProfileObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
+{
+  _et->storeOperationsExecTime();
+
+  if (!_updated_pairs.empty())
+  {
+    for (const auto &pair : _updated_pairs)
+    {
+      // Permute records have the size of the input and the output, which are the same
+      std::map<uint32_t, int64_t> records;
+      for (const auto &rec : _et->getPermuteRecords(pair.first, pair.second))
+        records.emplace(rec.first / 2, rec.second);
+      _transfer_cost->calibrate(pair.first, pair.second, records);
+    }
+    _transfer_cost->store();
+    _updated_pairs.clear();
+  }
+
+  // A run of the primary subgraph includes runs of the other subgraphs
+  if (_online_profiling && subg_ind == ir::SubgraphIndex{0})
+    _online_profiling->endRun();
+}
+
 TracingObserver::TracingObserver(const std::string &filepath, const ir::Graph &graph,
                                  const util::TracingCtx *tracing_ctx)
-  : _recorder{std::make_unique<EventRecorder>()}, _collector{_recorder.get()}, _graph{graph},
+  : _trace{static_cast<size_t>(
+      std::max(util::getConfigInt(util::config::TRACE_BUFFER_SIZE), 1))},
+    _recorder{std::make_unique<EventRecorder>()}, _collector{_recorder.get()}, _graph{graph},
     _tracing_ctx{tracing_ctx}
 {
   _event_writer = EventWriter::get(filepath);
   _event_writer->startToUse();
+
+  if (util::getConfigBool(util::config::TRACE_PERF_COUNTERS))
+  {
+    // Assume that other threads can open the counters which this thread can
+    const auto &counters = util::PerfCounters::thisThread();
+    for (int i = 0; i < util::PerfCounters::COUNT; ++i)
+    {
+      const auto counter = static_cast<util::PerfCounters::Counter>(i);
+      if (counters.available(counter))
+        _perf_counters.push_back(counter);
+    }
+    if (_perf_counters.empty())
+      VERBOSE(TracingObserver) << "No hardware counter is available. Check perf_event_paranoid"
+                               << std::endl;
+  }
 }
 
 TracingObserver::~TracingObserver()
 {
   try
   {
+    convertRecords();
     _event_writer->readyToFlush(std::move(_recorder));
   }
   catch (const std::exception &e)
@@ -134,38 +202,303 @@ TracingObserver::~TracingObserver()
   }
 }
 
+void TracingObserver::record(uint32_t subg_index, uint32_t op_index,
+                             const backend::Backend *backend, bool begin)
+{
+  util::TraceRecord record{util::TraceRecord::now(), backend, subg_index, op_index, begin, {}};
+  if (!_perf_counters.empty())
+    record.counters = util::PerfCounters::thisThread().read();
+  _trace.record(record);
+}
+
+void TracingObserver::convertRecords()
+{
+  // Merge records of all threads in time order, as writers take events of a run in order
+  std::vector<util::TraceRecord> records;
+  for (const auto buffer : _trace.buffers())
+  {
+    const auto buffer_records = buffer->records();
+    auto it = buffer_records.begin();
+    if (buffer->dropped() > 0)
+    {
+      VERBOSE(TracingObserver) << buffer->dropped() << " records are overwritten. Increase "
+                               << "TRACE_BUFFER_SIZE to keep all of them" << std::endl;
+
+      // Skip records whose begin edge is overwritten, from a subgraph begin if any
+      auto is_subg_begin = [](const util::TraceRecord &r) {
+        return r.begin && r.op_index == util::TraceRecord::NO_OPERATION;
+      };
+      it = std::find_if(buffer_records.begin(), buffer_records.end(), is_subg_begin);
+      if (it == buffer_records.end())
+        it = std::find_if(buffer_records.begin(), buffer_records.end(),
+                          [](const util::TraceRecord &r) { return r.begin; });
+    }
+    records.insert(records.end(), it, buffer_records.end());
+  }
+  std::stable_sort(records.begin(), records.end(),
+                   [](const util::TraceRecord &lhs, const util::TraceRecord &rhs) {
+                     return lhs.ts_ns < rhs.ts_ns;
+                   });
+
+  // Counters at the begin edge of running operations
+  std::map<std::pair<uint32_t, uint32_t>, util::PerfCounters::Values> begin_counters;
+  for (const auto &record : records)
+  {
+    const auto edge = record.begin ? EventCollector::Edge::BEGIN : EventCollector::Edge::END;
+    const auto ts_us = record.ts_ns / 1000;
+    if (record.op_index == util::TraceRecord::NO_OPERATION)
+    {
+      _collector.onEvent(EventCollector::SubgEvent{_tracing_ctx, edge, record.subg_index}, ts_us);
+      continue;
+    }
+
+    const auto backend = static_cast<const backend::Backend *>(record.backend);
+    const auto &op = _graph.operations().at(ir::OperationIndex{record.op_index});
+    auto ev = EventCollector::OpSeqEvent{
+      _tracing_ctx, edge, record.subg_index, backend->config()->id(), record.op_index, op.name()};
+    const auto key = std::make_pair(record.subg_index, record.op_index);
+    if (record.begin)
+    {
+      // add shape of inputs
+      setUserData(_graph, &op, ev.userData);
+      if (!_perf_counters.empty())
+        begin_counters[key] = record.counters;
+    }
+    else
+    {
+      auto it = begin_counters.find(key);
+      if (it != begin_counters.end())
+      {
+        for (const auto counter : _perf_counters)
+          ev.counters.emplace_back(util::PerfCounters::name(counter),
+                                   record.counters[counter] - it->second[counter]);
+        begin_counters.erase(it);
+      }
+    }
+    _collector.onEvent(ev, ts_us);
+  }
+}
+
 void TracingObserver::handleSubgraphBegin(ir::SubgraphIndex subg_ind)
 {
-  _collector.onEvent(
-    EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::BEGIN, subg_ind.value()});
+  record(subg_ind.value(), util::TraceRecord::NO_OPERATION, nullptr, true);
 }
 
 void TracingObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex subg_ind,
                                      ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  const auto &op = _graph.operations().at(op_ind);
-  auto ev = EventCollector::OpSeqEvent{_tracing_ctx,     EventCollector::Edge::BEGIN,
-                                       subg_ind.value(), backend_id,
-                                       op_ind.value(),   op.name()};
-  // add shape of inputs
-  setUserData(_graph, &op, ev.userData);
-  _collector.onEvent(ev);
+  record(subg_ind.value(), op_ind.value(), backend, true);
 }
 
 void TracingObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_ind,
                                    ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  _collector.onEvent(EventCollector::OpSeqEvent{_tracing_ctx, EventCollector::Edge::END,
-                                                subg_ind.value(), backend_id, op_ind.value(),
-                                                _graph.operations().at(op_ind).name()});
+  record(subg_ind.value(), op_ind.value(), backend, false);
 }
 
 void TracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
 {
-  _collector.onEvent(
-    EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END, subg_ind.value()});
+  record(subg_ind.value(), util::TraceRecord::NO_OPERATION, nullptr, false);
+}
+
+RunStatsObserver::RunStatsObserver(RunStats *stats, const compiler::LoweredGraph &lowered_graph,
+                                   const backend::BackendContexts &backend_contexts)
+  : _stats{stats}
+{
+  lowered_graph.graph().operations().iterate(
+    [&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+      const auto opcode = op.opcode();
+      const bool timed = opcode != ir::OpCode::If && opcode != ir::OpCode::While;
+      _records.emplace(op_ind, OpRecord{timed, opcode == ir::OpCode::Permute,
+                                        lowered_graph.getHasDynamicTensor(op_ind), {}});
+    });
+  for (const auto &pair : backend_contexts)
+    _backend_contexts.push_back(pair.second.get());
+}
+
+void RunStatsObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                      const backend::Backend *)
+{
+  _records.at(op_ind).begin = std::chrono::steady_clock::now();
+}
+
+void RunStatsObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                    const backend::Backend *backend)
+{
+  const auto end = std::chrono::steady_clock::now();
+  const auto &record = _records.at(op_ind);
+  if (!record.timed)
+    return;
+
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - record.begin).count();
+  _stats->addOpTime(backend, record.permute, record.dynamic, ns);
+}
+
+void RunStatsObserver::handleSubgraphEnd(ir::SubgraphIndex)
+{
+  uint64_t bytes = 0;
+  for (auto context : _backend_contexts)
+    bytes += context->takeMemoryPeak();
+  _stats->addPeakMemory(this, bytes);
+}
+
+DriftObserver::DriftObserver(DriftMonitor *monitor, std::shared_ptr<ExecTime> et,
+                             const compiler::LoweredGraph &lowered_graph)
+  : _monitor{monitor}, _et{std::move(et)}
+{
+  const auto &graph = lowered_graph.graph();
+  graph.operations().iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
+    // Operations of control flow are timed by observers of their subgraphs, and Permute is
+    // recorded by backend pairs which the schedule does not keep
+    const auto opcode = op.opcode();
+    if (opcode == ir::OpCode::If || opcode == ir::OpCode::While || opcode == ir::OpCode::Permute)
+      return;
+
+    // The same keys as ProfileObserver
+    const bool quant = graph.operands().at(op.getInputs().at(0)).typeInfo().type() ==
+                       ir::DataType::QUANT_UINT8_ASYMM;
+    uint32_t size = 0;
+    for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+      size += graph.operands().at(ind).info().total_size();
+    const auto backend = lowered_graph.lower_info().operation.getRawPtr(op_ind)->backend();
+    const auto expected = _et->getOperationExecTime(backend, op.name(), quant, size);
+    _records.emplace(op_ind, OpRecord{backend, op.name(), quant, size, expected, -1, {}});
+  });
+}
+
+void DriftObserver::handleSubgraphBegin(ir::SubgraphIndex subg_ind)
+{
+  // Runs of other subgraphs are sampled with the run of the primary subgraph calling them
+  if (subg_ind == ir::SubgraphIndex{0})
+    _monitor->beginRun();
+}
+
+void DriftObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                   const backend::Backend *)
+{
+  if (!_monitor->sampling())
+    return;
+  auto it = _records.find(op_ind);
+  if (it != _records.end())
+    it->second.begin = std::chrono::steady_clock::now();
+}
+
+void DriftObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                 const backend::Backend *backend)
+{
+  if (!_monitor->sampling())
+    return;
+  auto it = _records.find(op_ind);
+  if (it == _records.end())
+    return;
+
+  // Backends running asynchronously are timed until their work is done
+  backend->config()->sync();
+  const auto end = std::chrono::steady_clock::now();
+  auto &record = it->second;
+  record.observed =
+    std::chrono::duration_cast<std::chrono::microseconds>(end - record.begin).count();
+}
+
+void DriftObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
+{
+  if (_monitor->sampling())
+  {
+    std::unordered_map<const backend::Backend *, std::pair<int64_t, int64_t>> times;
+    for (auto &pair : _records)
+    {
+      auto &record = pair.second;
+      if (record.observed < 0)
+        continue;
+      _et->updateOperationExecTime(record.backend, record.name, record.quant, record.size,
+                                   record.observed);
+      if (record.expected > 0)
+      {
+        auto &time = times[record.backend];
+        time.first += record.observed;
+        time.second += record.expected;
+      }
+      record.observed = -1;
+    }
+    for (const auto &pair : times)
+      _monitor->addBackendTime(pair.first, pair.second.first, pair.second.second);
+    _et->storeOperationsExecTime();
+  }
+
+  if (subg_ind == ir::SubgraphIndex{0})
+    _monitor->endRun();
+}
+
+MinMaxObserver::MinMaxObserver(MinMaxRecords *records, const compiler::LoweredGraph &lowered_graph,
+                               const compiler::TensorRegistries &tensor_regs)
+  : _records{records}, _graph{lowered_graph.graph()}, _tensor_regs{tensor_regs}
+{
+  const auto &names = _graph.tensor_names();
+  if (!names)
+    return;
+
+  for (const auto &pair : *names)
+  {
+    const auto &ind = pair.first;
+    if (!_graph.operands().exist(ind) || pair.second.empty())
+      continue;
+    const auto &operand = _graph.operands().at(ind);
+    if (operand.isConstant() || operand.typeInfo().type() != ir::DataType::FLOAT32)
+      continue;
+    _names.emplace(ind, pair.second);
+  }
+}
+
+void MinMaxObserver::handleSubgraphBegin(ir::SubgraphIndex)
+{
+  for (const auto &ind : _graph.getInputs() | ir::Remove::UNDEFINED)
+    recordTensor(ind);
+}
+
+void MinMaxObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                  const backend::Backend *)
+{
+  const auto &op = _graph.operations().at(op_ind);
+  if (op.opcode() == ir::OpCode::Permute)
+    return;
+
+  for (const auto &ind : op.getOutputs() | ir::Remove::UNDEFINED)
+    recordTensor(ind);
+}
+
+void MinMaxObserver::recordTensor(const ir::OperandIndex &ind)
+{
+  auto name = _names.find(ind);
+  if (name == _names.end())
+    return;
+
+  auto tensor = _tensor_regs.getITensor(ind);
+  if (tensor == nullptr || tensor->data_type() != ir::DataType::FLOAT32)
+    return;
+
+  // NaN and the lowest float number are not recorded, like record-minmax does
+  float min = std::numeric_limits<float>::max();
+  float max = std::numeric_limits<float>::lowest();
+  bool has_value = false;
+  tensor->access([&](backend::ITensor &tensor) {
+    const auto buffer = reinterpret_cast<const float *>(tensor.buffer());
+    if (buffer == nullptr || tensor.has_padding())
+      return;
+
+    const auto num_elements = tensor.getShape().num_elements();
+    for (uint64_t i = 0; i < num_elements; ++i)
+    {
+      const float value = buffer[i];
+      if (std::isnan(value) || value == std::numeric_limits<float>::lowest())
+        continue;
+      min = std::min(min, value);
+      max = std::max(max, value);
+      has_value = true;
+    }
+  });
+
+  if (has_value)
+    _records->record(name->second, min, max);
 }
 
 } // namespace exec
@@ -18,16 +18,33 @@
 #define __ONERT_EXEC_OBSREVERS_H__
 
 #include "ExecTime.h"
+#include "TransferCost.h"
+#include "../compiler/TensorRegistries.h"
 #include "../util/EventCollector.h"
 #include "../util/EventRecorder.h"
 #include "../util/EventWriter.h"
+#include "../util/TraceBuffer.h"
 
+#include "backend/BackendContext.h"
+#include "compiler/LoweredGraph.h"
+#include "exec/DriftMonitor.h"
 #include "exec/IExecutor.h"
+#include "exec/MinMaxRecords.h"
+#include "exec/OnlineProfiling.h"
+#include "exec/RunStats.h"
 #include "ir/Index.h"
 #include "ir/Operation.h"
+#include "ir/OperationIndexMap.h"
 #include "util/ITimer.h"
 #include "util/TracingCtx.h"
 
+#include <chrono>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace onert
 {
 namespace exec
@@ -52,21 +69,45 @@ public:
 class ProfileObserver : public IExecutionObserver
 {
 public:
-  explicit ProfileObserver(std::shared_ptr<ExecTime> et, const ir::Graph &graph)
-    : _et(std::move(et)), _graph(graph)
+  using BackendPair = std::pair<const backend::Backend *, const backend::Backend *>;
+
+public:
+  /**
+   * @param online_profiling Online profiling to report changes of estimates, nullptr if none
+   */
+  explicit ProfileObserver(std::shared_ptr<ExecTime> et, const ir::Graph &graph,
+                           OnlineProfiling *online_profiling = nullptr)
+    : _et(std::move(et)), _graph(graph), _online_profiling(online_profiling)
   {
   }
+  /**
+   * @brief Record permute times by backend pairs and calibrate transfer cost with them
+   *
+   * @param transfer_cost Transfer cost to calibrate
+   * @param permute_backends Source and destination backends of each Permute operation
+   */
+  void enableTransferCalibration(std::shared_ptr<TransferCost> transfer_cost,
+                                 ir::OperationIndexMap<BackendPair> &&permute_backends)
+  {
+    _transfer_cost = std::move(transfer_cost);
+    _permute_backends = std::move(permute_backends);
+  }
   void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
                       const backend::Backend *) override;
   void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
                     const backend::Backend *) override;
 
-  void handleSubgraphEnd(ir::SubgraphIndex) override { _et->storeOperationsExecTime(); }
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
 
 private:
   std::unique_ptr<util::ITimer> _timer;
   std::shared_ptr<ExecTime> _et;
   const ir::Graph &_graph;
+  OnlineProfiling *_online_profiling;
+  std::shared_ptr<TransferCost> _transfer_cost;
+  ir::OperationIndexMap<BackendPair> _permute_backends;
+  // Backend pairs whose permute times are updated by the current run
+  std::set<BackendPair> _updated_pairs;
 };
 
 class TracingObserver : public IExecutionObserver
@@ -83,6 +124,15 @@ public:
   void handleSubgraphEnd(ir::SubgraphIndex) override;
 
 private:
+  void record(uint32_t subg_index, uint32_t op_index, const backend::Backend *backend, bool begin);
+  // Convert records of all threads into events of _recorder
+  void convertRecords();
+
+private:
+  // Runs record into lock-free buffers, which are converted into events when tracing finishes
+  util::TraceRecorder _trace;
+  // Hardware counters recorded with each edge of operations, empty if they are not traced
+  std::vector<util::PerfCounters::Counter> _perf_counters;
   std::unique_ptr<EventRecorder> _recorder;
   EventCollector _collector;
   const ir::Graph &_graph;
@@ -90,6 +140,110 @@ private:
   const util::TracingCtx *_tracing_ctx;
 };
 
+/**
+ * @brief Observer to time operations of the runs sampled by @c DriftMonitor
+ *
+ * Times of a backend are compared with the exec times the executor was scheduled with, and they
+ * are recorded to the exec times as well so that HEScheduler schedules again by the speeds of
+ * backends as they are. Backends are synchronized after each operation of sampled runs only.
+ */
+class DriftObserver : public IExecutionObserver
+{
+public:
+  DriftObserver(DriftMonitor *monitor, std::shared_ptr<ExecTime> et,
+                const compiler::LoweredGraph &lowered_graph);
+  void handleSubgraphBegin(ir::SubgraphIndex) override;
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
+
+private:
+  struct OpRecord
+  {
+    const backend::Backend *backend;
+    std::string name;
+    bool quant;
+    uint32_t size;
+    // Exec time at the compilation, or -1 if there was no record
+    int64_t expected;
+    // Time measured by the current run, or -1 if it is not measured
+    int64_t observed;
+    std::chrono::steady_clock::time_point begin;
+  };
+
+  DriftMonitor *_monitor;
+  std::shared_ptr<ExecTime> _et;
+  // Records are made for all timed operations at construction like RunStatsObserver
+  ir::OperationIndexMap<OpRecord> _records;
+};
+
+/**
+ * @brief Observer to record operation times and memory of each run into @c RunStats
+ *
+ * Operations are timed on the host, so time of backends running asynchronously is the time to
+ * enqueue their work. Control flow operations are not timed since operations of their subgraphs
+ * are recorded by observers of their executors.
+ */
+class RunStatsObserver : public IExecutionObserver
+{
+public:
+  RunStatsObserver(RunStats *stats, const compiler::LoweredGraph &lowered_graph,
+                   const backend::BackendContexts &backend_contexts);
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
+
+private:
+  struct OpRecord
+  {
+    bool timed;
+    bool permute;
+    bool dynamic;
+    std::chrono::steady_clock::time_point begin;
+  };
+
+  RunStats *_stats;
+  // Records are made for all operations at construction, so that jobs running at the same time
+  // on multiple threads update different records without inserting any
+  ir::OperationIndexMap<OpRecord> _records;
+  std::vector<backend::BackendContext *> _backend_contexts;
+};
+
+/**
+ * @brief Observer to record min/max of float tensors of each run into @c MinMaxRecords
+ *
+ * Inputs of the graph are recorded when the subgraph begins, and outputs of operations when they
+ * end. Only non-constant tensors with names in the model are recorded, so that tensors inserted by
+ * lowering, like outputs of Permute, are not.
+ */
+class MinMaxObserver : public IExecutionObserver
+{
+public:
+  MinMaxObserver(MinMaxRecords *records, const compiler::LoweredGraph &lowered_graph,
+                 const compiler::TensorRegistries &tensor_regs);
+  void handleSubgraphBegin(ir::SubgraphIndex) override;
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override
+  {
+    return;
+  }
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+
+private:
+  void recordTensor(const ir::OperandIndex &ind);
+
+  MinMaxRecords *_records;
+  const ir::Graph &_graph;
+  compiler::TensorRegistries _tensor_regs;
+  // Names of the operands to record
+  std::unordered_map<ir::OperandIndex, std::string> _names;
+};
+
 } // namespace exec
 } // namespace onert
 
@@ -19,6 +19,7 @@
 #include "ShapeConverter.h"
 
 #include <misc/polymorphic_downcast.h>
+#include <util/logging.h>
 
 namespace onert
 {
@@ -55,6 +56,7 @@ void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs
   //       do not need to use mutex (otherwise, use mutex)
   // Deadlock occurs when an Executor is called recursively.
   std::lock_guard<std::mutex> lock(_mutex);
+  reacquireMemory();
 
   assert(inputs.size() == _graph.getInputs().size());
   assert(inputs.size() == _input_tensors.size());
@@ -94,7 +96,7 @@ void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs
     output_tensor->setTensor(output);
   }
 
-  executeImpl();
+  executeWithShapeCache();
 }
 
 void ExecutorBase::execute(const IODescription &desc)
@@ -103,6 +105,7 @@ void ExecutorBase::execute(const IODescription &desc)
   // TODO: if all used backends on this executor are thread-safe,
   //       do not need to use mutex (otherwise, use mutex)
   std::lock_guard<std::mutex> lock(_mutex);
+  reacquireMemory();
 
   // Set input(s)
   assert(_input_tensors.size() == desc.inputs.size());
@@ -136,7 +139,7 @@ void ExecutorBase::execute(const IODescription &desc)
     tensor->set_dynamic(); // It can't be resized but shape could change
   }
 
-  executeImpl();
+  executeWithShapeCache();
 
   // Update output(s) desc
   for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
@@ -185,6 +188,51 @@ void ExecutorBase::handleDynamicInputTensor(ir::IOIndex io_ind, const IODescript
   }
 }
 
+uint64_t ExecutorBase::releaseMemory(bool weights)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  uint64_t bytes = 0;
+  for (auto &pair : _backend_contexts)
+    bytes += pair.second->releaseMemory(weights);
+  _memory_released = true;
+
+  VERBOSE(ExecutorBase) << "Released " << bytes << " bytes of memory" << std::endl;
+  return bytes;
+}
+
+void ExecutorBase::resetStates()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (auto &pair : _backend_contexts)
+    pair.second->resetStates();
+}
+
+void ExecutorBase::executeWithShapeCache()
+{
+  if (!_shape_cache)
+  {
+    executeImpl();
+    return;
+  }
+
+  // A run that throws is not ended, and its shapes are recorded again by the next run
+  _shape_cache->beginRun(_input_tensors);
+  executeImpl();
+  _shape_cache->endRun();
+}
+
+void ExecutorBase::reacquireMemory()
+{
+  if (!_memory_released)
+    return;
+
+  for (auto &pair : _backend_contexts)
+    pair.second->reacquireMemory();
+  _memory_released = false;
+}
+
 bool ExecutorBase::hasDynamicInput()
 {
   for (auto &tensor : _input_tensors)
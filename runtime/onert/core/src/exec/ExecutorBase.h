@@ -17,6 +17,7 @@
 #ifndef __ONERT_EXEC_EXECUTOR_BASE_H__
 #define __ONERT_EXEC_EXECUTOR_BASE_H__
 
+#include "DynamicShapeCache.h"
 #include "ExecutionObservee.h"
 #include "../backend/builtin/IOTensor.h"
 #include "../compiler/TensorRegistries.h"
@@ -70,16 +71,36 @@ public:
 
   void addObserver(std::unique_ptr<IExecutionObserver> ref) { _subject.add(std::move(ref)); };
 
+  /**
+   * @brief Set the cache of dynamic shapes that FunctionSequences of this executor refer to
+   */
+  void setDynamicShapeCache(std::unique_ptr<DynamicShapeCache> cache)
+  {
+    _shape_cache = std::move(cache);
+  }
+
   const std::vector<backend::builtin::IOTensor *> &getOutputTensors() const override
   {
     return _output_tensors;
   }
 
+  uint64_t releaseMemory(bool weights) override;
+
+  void resetStates() override;
+
 protected:
   /**
    * @brief Returns @c true if any input tensor is dynamic; @c false if all are static tensors
    */
   bool hasDynamicInput();
+  /**
+   * @brief Acquire memory of backends again if it is released, which must be called under _mutex
+   */
+  void reacquireMemory();
+  /**
+   * @brief Run executeImpl() with the cache of dynamic shapes for the shapes of inputs
+   */
+  void executeWithShapeCache();
 
 protected:
   ExecutionObservee _subject;
@@ -92,6 +113,8 @@ protected:
   std::vector<backend::builtin::IOTensor *> _output_tensors;
   std::mutex _mutex;
   const util::TracingCtx *_tracing_ctx;
+  bool _memory_released = false;
+  std::unique_ptr<DynamicShapeCache> _shape_cache;
 
 private:
   void handleDynamicInputTensor(ir::IOIndex input_index, const IODescription &desc);
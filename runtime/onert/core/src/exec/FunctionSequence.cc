@@ -16,6 +16,8 @@
 
 #include "exec/FunctionSequence.h"
 
+#include "DynamicShapeCache.h"
+
 #include "ir/Operation.h"
 #include "backend/ITensorRegistry.h"
 #include "util/logging.h"
@@ -33,10 +35,14 @@ void FunctionSequence::run()
     // _dynamic_tensor_ctx is always nullptr for acl_cl and acl_neon
     // Thus, those two bakends cannot reach here.
 
-    // Do dynamic shape inference
+    // Do dynamic shape inference unless the shapes of a run of the same input shapes are applied
     auto op_ind = _dynamic_tensor_ctx->op_ind;
-    auto &op = _dynamic_tensor_ctx->operations->at(op_ind);
-    op.accept(*_dynamic_tensor_ctx->dynamic_shape_inferer);
+    auto shape_cache = _dynamic_tensor_ctx->shape_cache;
+    if (shape_cache == nullptr || !shape_cache->applyShapes(op_ind))
+    {
+      auto &op = _dynamic_tensor_ctx->operations->at(op_ind);
+      op.accept(*_dynamic_tensor_ctx->dynamic_shape_inferer);
+    }
 
     for (const auto &function : _functions)
     {
@@ -52,6 +58,9 @@ void FunctionSequence::run()
       // run kernel
       function->run();
     }
+
+    if (shape_cache)
+      shape_cache->recordShapes(op_ind);
   }
   else
   {
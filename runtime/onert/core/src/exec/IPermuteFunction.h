@@ -17,19 +17,16 @@
 #ifndef __ONERT_EXEC_I_PERMUTE_FUNCTION_H__
 #define __ONERT_EXEC_I_PERMUTE_FUNCTION_H__
 
-#include "feature/IndexIterator.h"
-#include "feature/nchw/Reader.h"
-#include "feature/nchw/View.h"
-#include "feature/nhwc/Reader.h"
-#include "feature/nhwc/View.h"
-
+#include "exec/AsyncTransfers.h"
 #include "backend/ITensor.h"
 #include "exec/IFunction.h"
+#include "ir/Coordinates.h"
 #include "ir/Index.h"
 #include "ir/Shape.h"
 #include <memory>
 #include <typeinfo>
 #include "util/Utils.h"
+#include <algorithm>
 #include <vector>
 #include <unordered_map>
 
@@ -68,6 +65,154 @@ inline void CopyDynamic(const ::onert::backend::ITensor *src, const ::onert::bac
   });
 }
 
+/**
+ * @brief Calculate byte strides of src and dst for each dimension of src
+ * @note  Strides of dimensions whose value is 0 or 1 are 0, since they are never used
+ */
+inline void CalcPermuteStrides(const ::onert::backend::ITensor &src,
+                               const ::onert::backend::ITensor &dst,
+                               std::vector<size_t> &src_strides, std::vector<size_t> &dst_strides)
+{
+  const auto shape = src.getShape();
+  const auto rank = shape.rank();
+  src_strides.assign(rank, 0);
+  dst_strides.assign(rank, 0);
+
+  const ir::Coordinates no_step(rank);
+  const auto src_base = src.calcOffset(no_step);
+  const auto dst_base = dst.calcOffset(no_step);
+  for (auto i = 0; i < rank; ++i)
+  {
+    if (shape.dim(i) <= 1)
+      continue;
+    ir::Coordinates one_step(rank);
+    one_step.set(i, 1);
+    src_strides[i] = src.calcOffset(one_step) - src_base;
+    dst_strides[i] =
+      dst.calcOffset(ir::convertCoordinates(one_step, src.layout(), dst.layout())) - dst_base;
+  }
+}
+
+/**
+ * @brief Transpose a matrix in tiles, i.e. dst(c, r) = src(r, c)
+ *
+ * Strides are in bytes. A tile of both sides fits in L1 cache, and the inner loop walks along the
+ * contiguous rows of dst so that compilers can vectorize it.
+ */
+template <typename T>
+void TransposeTiles(const uint8_t *src, size_t src_row_stride, size_t src_col_stride, uint8_t *dst,
+                    size_t dst_row_stride, size_t dst_col_stride, size_t rows, size_t cols)
+{
+  constexpr size_t kTileSize = 64 / sizeof(T) < 8 ? 8 : 64 / sizeof(T);
+  for (size_t r0 = 0; r0 < rows; r0 += kTileSize)
+  {
+    const auto r1 = std::min(rows, r0 + kTileSize);
+    for (size_t c0 = 0; c0 < cols; c0 += kTileSize)
+    {
+      const auto c1 = std::min(cols, c0 + kTileSize);
+      for (size_t c = c0; c < c1; ++c)
+      {
+        const uint8_t *from = src + c * src_col_stride;
+        uint8_t *into = dst + c * dst_row_stride;
+        for (size_t r = r0; r < r1; ++r)
+        {
+          *reinterpret_cast<T *>(into + r * dst_col_stride) =
+            *reinterpret_cast<const T *>(from + r * src_row_stride);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Copy a block of elements into a tensor in another layout
+ * @param src         Buffer of src at the beginning of the block
+ * @param src_strides Byte strides of src for each dimension of loop_shape
+ * @param dst         Buffer of dst at the beginning of the block
+ * @param dst_strides Byte strides of dst for each dimension of loop_shape
+ * @param loop_shape  Shape of the block in the layout of src
+ *
+ * The plane of the innermost dimensions of src and dst is transposed in tiles for each
+ * coordinates of the other dimensions.
+ */
+template <typename T>
+void PermuteBlock(const uint8_t *src, const std::vector<size_t> &src_strides, uint8_t *dst,
+                  const std::vector<size_t> &dst_strides, const ir::Shape &loop_shape)
+{
+  const auto rank = loop_shape.rank();
+  assert(rank > 0);
+  assert(src_strides.size() == static_cast<size_t>(rank));
+  assert(dst_strides.size() == static_cast<size_t>(rank));
+
+  // Columns go along the innermost dimension of src, and rows along the one of dst
+  const auto col_dim = rank - 1;
+  auto row_dim = -1;
+  for (auto i = 0; i < rank; ++i)
+  {
+    if (i == col_dim || loop_shape.dim(i) <= 1)
+      continue;
+    if (row_dim == -1 || dst_strides[i] < dst_strides[row_dim])
+      row_dim = i;
+  }
+
+  const size_t cols = loop_shape.dim(col_dim);
+  const size_t rows = row_dim == -1 ? 1 : loop_shape.dim(row_dim);
+  const size_t src_row_stride = row_dim == -1 ? 0 : src_strides[row_dim];
+  const size_t dst_col_stride = row_dim == -1 ? 0 : dst_strides[row_dim];
+
+  auto outer_shape = loop_shape;
+  outer_shape.dim(col_dim) = 1;
+  if (row_dim != -1)
+    outer_shape.dim(row_dim) = 1;
+
+  ShapeLoop(outer_shape, [&](const onert::ir::Coordinates &coords) {
+    size_t src_offset = 0;
+    size_t dst_offset = 0;
+    for (auto i = 0; i < rank; ++i)
+    {
+      src_offset += coords[i] * src_strides[i];
+      dst_offset += coords[i] * dst_strides[i];
+    }
+    TransposeTiles<T>(src + src_offset, src_row_stride, src_strides[col_dim], dst + dst_offset,
+                      dst_strides[col_dim], dst_col_stride, rows, cols);
+  });
+}
+
+inline void PermuteBlock(size_t element_size, const uint8_t *src,
+                         const std::vector<size_t> &src_strides, uint8_t *dst,
+                         const std::vector<size_t> &dst_strides, const ir::Shape &loop_shape)
+{
+  // Elements are only moved, so types of the same size are interchangeable
+  switch (element_size)
+  {
+    case 1:
+      PermuteBlock<uint8_t>(src, src_strides, dst, dst_strides, loop_shape);
+      break;
+    case 2:
+      PermuteBlock<uint16_t>(src, src_strides, dst, dst_strides, loop_shape);
+      break;
+    case 4:
+      PermuteBlock<uint32_t>(src, src_strides, dst, dst_strides, loop_shape);
+      break;
+    case 8:
+      PermuteBlock<uint64_t>(src, src_strides, dst, dst_strides, loop_shape);
+      break;
+    default:
+      throw std::runtime_error("PermuteBlock: Not supported element size");
+  }
+}
+
+/**
+ * @brief Check if copying from src to dst can be skipped since they share the same memory
+ */
+inline bool IsSharedBuffer(const ::onert::backend::ITensor *src,
+                           const ::onert::backend::ITensor *dst)
+{
+  return src->buffer() != nullptr && src->buffer() == dst->buffer() &&
+         src->layout() == dst->layout() && !src->has_padding() && !dst->has_padding() &&
+         src->total_size() == dst->total_size();
+}
+
 class IPermuteFunction : public IFunction
 {
 protected:
@@ -109,6 +254,13 @@ public:
 
   virtual void optimize() = 0;
 
+  /**
+   * @brief Let reads from device memory finish after run() if the executor allows it
+   *
+   * Enable this only if no one reads destination tensors before the executor waits for them.
+   */
+  void enableAsyncTransfer() { _async_transfer = true; }
+
 protected:
   void permute(backend::ITensor *src_tensor, backend::ITensor *dst_tensor, size_t rank,
                std::vector<size_t> &src_offsets, std::vector<size_t> &dst_offsets)
@@ -122,6 +274,8 @@ protected:
     assert(src_tensor != dst_tensor);
     if (underlying_type(src_tensor->data_type()) != underlying_type(dst_tensor->data_type()))
       throw std::runtime_error("data type does not match");
+    if (IsSharedBuffer(src_tensor, dst_tensor))
+      return;
     switch (src_tensor->data_type())
     {
       case ir::DataType::FLOAT32:
@@ -187,7 +341,8 @@ private:
              !dst->has_padding() && src->layout() == dst->layout())
     {
       assert(!dst->needMemoryMap());
-      dst->access([&](backend::ITensor &) { src->enqueueReadBuffer(dst->buffer(), true); });
+      const bool deferred = _async_transfer && AsyncTransfers::defer(src);
+      dst->access([&](backend::ITensor &) { src->enqueueReadBuffer(dst->buffer(), !deferred); });
     }
     else
     {
@@ -206,6 +361,7 @@ private:
   {
     assert(dst_buffer != nullptr);
     assert(dst_size == dst->total_size());
+    UNUSED_RELEASE(dst_size);
 
     const auto permute_type = [&]() -> PermuteType {
       if (src->layout() == ir::Layout::NHWC && dst->layout() == ir::Layout::NCHW)
@@ -223,64 +379,13 @@ private:
     }();
     if (rank == 4 && permute_type != PermuteType::COPY)
     {
-      switch (permute_type)
-      {
-        case PermuteType::NHWC_TO_NCHW:
-        {
-          ir::FeatureShape shape;
-          auto dst_shape = dst->getShape();
-          shape.N = dst_shape.dim(0);
-          shape.C = dst_shape.dim(1);
-          shape.H = dst_shape.dim(2);
-          shape.W = dst_shape.dim(3);
-
-          typename feature::nchw::View<T>::Strides strides;
-          const auto start_offset = dst->calcOffset({0, 0, 0, 0});
-          strides.W = dst_shape.dim(3) == 1 ? 0 : dst->calcOffset({0, 0, 0, 1}) - start_offset;
-          strides.H = dst_shape.dim(2) == 1 ? 0 : dst->calcOffset({0, 0, 1, 0}) - start_offset;
-          strides.C = dst_shape.dim(1) == 1 ? 0 : dst->calcOffset({0, 1, 0, 0}) - start_offset;
-          strides.N = dst_shape.dim(0) == 1 ? 0 : dst->calcOffset({1, 0, 0, 0}) - start_offset;
-
-          const feature::nhwc::Reader<T> from(src);
-          feature::nchw::View<T> into(shape, strides,
-                                      reinterpret_cast<T *>(dst_buffer + start_offset), dst_size);
-          feature::iterate(shape) << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
-            const auto value = from.at(batch, row, col, ch);
-            into.at(batch, ch, row, col) = value;
-          };
-          break;
-        }
-        case PermuteType::NCHW_TO_NHWC:
-        {
-          ir::FeatureShape shape;
-          auto dst_shape = dst->getShape();
-          shape.N = dst_shape.dim(0);
-          shape.H = dst_shape.dim(1);
-          shape.W = dst_shape.dim(2);
-          shape.C = dst_shape.dim(3);
-
-          typename feature::nhwc::View<T>::Strides strides;
-          const auto start_offset = dst->calcOffset({0, 0, 0, 0});
-          strides.C = dst_shape.dim(3) == 1 ? 0 : dst->calcOffset({0, 0, 0, 1}) - start_offset;
-          strides.W = dst_shape.dim(2) == 1 ? 0 : dst->calcOffset({0, 0, 1, 0}) - start_offset;
-          strides.H = dst_shape.dim(1) == 1 ? 0 : dst->calcOffset({0, 1, 0, 0}) - start_offset;
-          strides.N = dst_shape.dim(0) == 1 ? 0 : dst->calcOffset({1, 0, 0, 0}) - start_offset;
-
-          const feature::nchw::Reader<T> from(src);
-          feature::nhwc::View<T> into(shape, strides,
-                                      reinterpret_cast<T *>(dst_buffer + start_offset), dst_size);
-          feature::iterate(shape) << [&](uint32_t batch, uint32_t ch, uint32_t row, uint32_t col) {
-            const auto value = from.at(batch, ch, row, col);
-            into.at(batch, row, col, ch) = value;
-          };
-          break;
-        }
-        default:
-        {
-          throw std::runtime_error("Unsupported Permutation");
-          break;
-        }
-      }
+      std::vector<size_t> src_strides;
+      std::vector<size_t> dst_strides;
+      CalcPermuteStrides(*src, *dst, src_strides, dst_strides);
+
+      const ir::Coordinates no_step(rank);
+      PermuteBlock<T>(src->buffer() + src->calcOffset(no_step), src_strides,
+                      dst_buffer + dst->calcOffset(no_step), dst_strides, src->getShape());
     }
     else if (!src->has_padding() && !dst->has_padding())
     {
@@ -354,6 +459,7 @@ protected:
   std::vector<std::vector<size_t>> _src_tensors_offsets;
   std::vector<std::vector<size_t>> _dst_tensors_offsets;
   std::unordered_map<const backend::ITensor *, std::vector<uint8_t>> _buffers_map;
+  bool _async_transfer = false;
 };
 
 } // namespace exec
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IPermuteFunction.h"
+
+#include <backend/basic/Tensor.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace onert;
+
+namespace
+{
+
+class MockUpPermuteFunction : public exec::IPermuteFunction
+{
+public:
+  MockUpPermuteFunction(backend::ITensor *src, backend::ITensor *dst)
+  {
+    _src_tensors = {src};
+    _dst_tensors = {dst};
+  }
+
+  void optimize() override {}
+};
+
+std::unique_ptr<backend::basic::Tensor> makeTensor(const ir::Shape &shape, ir::Layout layout)
+{
+  ir::OperandInfo info{shape, ir::TypeInfo{ir::DataType::FLOAT32}, ir::MemAllocType::STATIC,
+                       false};
+  return std::make_unique<backend::basic::Tensor>(info, layout, nullptr);
+}
+
+} // namespace
+
+TEST(IPermuteFunction, nhwc_to_nchw)
+{
+  // Larger than a tile on both of W and C
+  const uint32_t N = 2, H = 3, W = 19, C = 21;
+  std::vector<float> src_data(N * H * W * C);
+  std::vector<float> dst_data(src_data.size());
+  std::iota(src_data.begin(), src_data.end(), 0.f);
+
+  auto src = makeTensor(ir::Shape{N, H, W, C}, ir::Layout::NHWC);
+  auto dst = makeTensor(ir::Shape{N, C, H, W}, ir::Layout::NCHW);
+  src->setBuffer(reinterpret_cast<uint8_t *>(src_data.data()));
+  dst->setBuffer(reinterpret_cast<uint8_t *>(dst_data.data()));
+
+  MockUpPermuteFunction fn{src.get(), dst.get()};
+  fn.run();
+
+  for (uint32_t n = 0; n < N; ++n)
+    for (uint32_t h = 0; h < H; ++h)
+      for (uint32_t w = 0; w < W; ++w)
+        for (uint32_t c = 0; c < C; ++c)
+          ASSERT_EQ(dst_data[((n * C + c) * H + h) * W + w],
+                    src_data[((n * H + h) * W + w) * C + c]);
+}
+
+TEST(IPermuteFunction, nchw_to_nhwc_block)
+{
+  const uint32_t N = 1, C = 3, H = 4, W = 5;
+  std::vector<float> src_data(N * C * H * W);
+  std::vector<float> dst_data(src_data.size());
+  std::iota(src_data.begin(), src_data.end(), 0.f);
+
+  auto src = makeTensor(ir::Shape{N, C, H, W}, ir::Layout::NCHW);
+  auto dst = makeTensor(ir::Shape{N, H, W, C}, ir::Layout::NHWC);
+
+  std::vector<size_t> src_strides, dst_strides;
+  exec::CalcPermuteStrides(*src, *dst, src_strides, dst_strides);
+
+  // Copy the rows of H from 1 to 2 only
+  const size_t h_offset = 1;
+  exec::PermuteBlock<float>(
+    reinterpret_cast<const uint8_t *>(src_data.data()) + h_offset * src_strides[2], src_strides,
+    reinterpret_cast<uint8_t *>(dst_data.data()) + h_offset * dst_strides[2], dst_strides,
+    ir::Shape{N, C, 2, W});
+
+  for (uint32_t h = 0; h < H; ++h)
+    for (uint32_t w = 0; w < W; ++w)
+      for (uint32_t c = 0; c < C; ++c)
+      {
+        const auto expected = (h == 1 || h == 2) ? src_data[(c * H + h) * W + w] : 0.f;
+        ASSERT_EQ(dst_data[(h * W + w) * C + c], expected);
+      }
+}
+
+TEST(IPermuteFunction, skip_shared_buffer)
+{
+  std::vector<float> data(4, 1.f);
+  auto src = makeTensor(ir::Shape{4}, ir::Layout::NHWC);
+  auto dst = makeTensor(ir::Shape{4}, ir::Layout::NHWC);
+  src->setBuffer(reinterpret_cast<uint8_t *>(data.data()));
+  dst->setBuffer(reinterpret_cast<uint8_t *>(data.data()));
+
+  ASSERT_TRUE(exec::IsSharedBuffer(src.get(), dst.get()));
+  MockUpPermuteFunction fn{src.get(), dst.get()};
+  fn.run();
+  ASSERT_EQ(data, std::vector<float>(4, 1.f));
+}
@@ -16,6 +16,7 @@
 
 #include "JSONExecTime.h"
 
+#include <cstdlib>
 #include <fstream>
 
 namespace onert
@@ -62,75 +63,57 @@ void printBool(bool quant, std::ofstream &stream) { stream << "\"" << quant << "
 void JSON::readOperation(const std::string &backend, const std::string &operation, bool quant,
                          std::ifstream &stream)
 {
-  uint32_t size = 0;
-  int64_t time = 0;
-
+  // Records are [size, time] or [size, time, age] in the list, whose '[' is already read
+  std::vector<int64_t> values;
   std::string int_buf;
+  bool in_record = false;
   char buf;
-  int number_of_closed_braces = 0;
-  int number_of_commas = 0;
 
-  while (stream.good())
+  while (stream.get(buf))
   {
-    stream.get(buf);
-
-    switch (buf)
+    if (std::isdigit(buf))
     {
-      case ']':
-      {
-        number_of_closed_braces++;
-        break;
-      }
-      case '[':
-      {
-        number_of_closed_braces--;
-        break;
-      }
-      default:
-      {
-        if (std::isdigit(buf))
-        {
-          int_buf.push_back(buf);
-        }
-        break;
-      }
+      int_buf.push_back(buf);
+      continue;
     }
 
-    if (number_of_closed_braces == 1)
-      break;
+    if (!int_buf.empty())
+    {
+      values.push_back(static_cast<int64_t>(std::atoll(int_buf.c_str())));
+      int_buf.clear();
+    }
 
-    if ((buf == ']' && number_of_closed_braces == 0) ||
-        (buf == ',' && number_of_closed_braces == -1))
+    if (buf == '[')
+    {
+      in_record = true;
+      values.clear();
+    }
+    else if (buf == ']')
     {
-      switch (number_of_commas % 2)
+      if (!in_record)
+        break; // end of the list
+
+      in_record = false;
+      auto bf = _backends.find(backend);
+      if (values.size() >= 2 && bf != _backends.end())
       {
-        case 0:
-        {
-          size = static_cast<uint32_t>(std::atoi(int_buf.c_str()));
-          break;
-        }
-        case 1:
-        {
-          time = static_cast<int64_t>(std::atol(int_buf.c_str()));
-          auto bf = _backends.find(backend);
-          if (bf != _backends.end())
-          {
-            _measurements[bf->second][operation][quant][size] = time;
-          } // we ignore the records for unsupported backends
-          break;
-        }
-      }
-      number_of_commas++;
-      int_buf.clear();
+        MeasurementRecord record;
+        record.time = values[1];
+        record.age = values.size() > 2 ? static_cast<uint32_t>(values[2]) : 0;
+        _measurements[bf->second][operation][quant][static_cast<uint32_t>(values[0])] = record;
+      } // we ignore the records for unsupported backends
     }
   }
 }
-void JSON::printOperation(const std::map<uint32_t, int64_t> &operation_info,
+
+void JSON::printOperation(const std::map<uint32_t, MeasurementRecord> &operation_info,
                           std::ofstream &stream) const
 {
   for (const auto &items : operation_info)
   {
-    stream << "[" << items.first << ", " << items.second << "], ";
+    const auto &record = items.second;
+    const auto age = record.fresh ? 0 : record.age + 1;
+    stream << "[" << items.first << ", " << record.time << ", " << age << "], ";
   }
   stream.seekp(-2, std::ofstream::end);
 }
@@ -29,16 +29,27 @@ namespace onert
 namespace exec
 {
 
+/**
+ * @brief Execution time measured for an operation size
+ */
+struct MeasurementRecord
+{
+  int64_t time;       //< Exponentially decayed mean of measurements
+  uint32_t age = 0;   //< Number of profiling sessions since the last measurement
+  bool fresh = false; //< Measured in this session
+};
+
 /**
  * @brief table, that contains execution time of an operation on some backend for different input
  * sizes and transfer time from one backend to another for various input sizes (permutation time)
  *
- *               backend ->  op ->  quant->  size   --> time
- * _measurements[Backend*]["string"][bool][uint32_t] = int64_t
+ *               backend ->  op ->  quant->  size   --> record
+ * _measurements[Backend*]["string"][bool][uint32_t] = MeasurementRecord
  */
 using MeasurementData = std::unordered_map<
   const backend::Backend *,
-  std::unordered_map<std::string, std::unordered_map<bool, std::map<uint32_t, int64_t>>>>;
+  std::unordered_map<std::string,
+                     std::unordered_map<bool, std::map<uint32_t, MeasurementRecord>>>>;
 
 class JSON
 {
@@ -55,6 +66,7 @@ public:
   };
   /**
    * @brief Update _measurement_file with new data.
+   * @note  Records not measured in this session get one session older in the file
    */
   void storeOperationsExecTime() const;
 
@@ -81,7 +93,7 @@ private:
    * @param operation_info Map of operations execution information
    * @param stream File stream
    */
-  void printOperation(const std::map<uint32_t, int64_t> &operation_info,
+  void printOperation(const std::map<uint32_t, MeasurementRecord> &operation_info,
                       std::ofstream &stream) const;
   /**
    * @brief Parse and load _measurements from _measurement_file.
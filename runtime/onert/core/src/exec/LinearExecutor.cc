@@ -15,6 +15,12 @@
  */
 
 #include "LinearExecutor.h"
+
+#include "exec/PriorityGate.h"
+#include "util/CpuAffinity.h"
+#include "util/logging.h"
+
+#include <cassert>
 #ifdef RUY_PROFILER
 #include "ruy/profiler/instrumentation.h"
 #endif
@@ -24,15 +30,69 @@ namespace onert
 namespace exec
 {
 
+namespace
+{
+
+// Operations touching less memory than this are light enough for the little cores
+constexpr uint64_t kHeavyOpBytes = 256 * 1024;
+
+} // namespace
+
+bool LinearExecutor::isHeavy(const ir::Operation &op) const
+{
+  if (!util::CpuAffinity::get().isAuto())
+    return true;
+
+  uint64_t bytes = 0;
+  for (const auto &ind : (op.getInputs() + op.getOutputs()) | ir::Remove::UNDEFINED)
+  {
+    const auto &info = _graph.operands().at(ind).info();
+    // Sizes are unknown until the run
+    if (info.isDynamic() || info.shape().hasUnspecifiedDims())
+      return true;
+    bytes += info.total_size();
+  }
+  return bytes >= kHeavyOpBytes;
+}
+
 void LinearExecutor::executeImpl()
 {
+  const bool dynamic_input_exists = hasDynamicInput();
+  // Operations are preemption points where executions of higher priority go first
+  auto &gate = PriorityGate::get();
+  // Light operations move the calling thread to the little cores if CPU_AFFINITY is "auto"
+  util::ScopedCpuAffinity affinity;
+  if (_prefetcher)
+    _prefetcher->beginRun();
+#ifndef RUY_PROFILER
+  if (dynamic_input_exists || _has_dynamic_op)
+    _frozen_plan_disabled = true;
+  // Observers may be added after the plan is frozen, and they are notified of every operation
+  if (_frozen_plan_disabled || !_subject.empty())
+  {
+    _frozen_plan.clear();
+    _frozen_heavy.clear();
+    _frozen_ops.clear();
+  }
+  if (!_frozen_plan.empty())
+  {
+    executeFrozenPlan(affinity);
+    return;
+  }
+#endif
+
   if (_tracing_ctx)
   {
     auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
 
     _subject.notifySubgraphBegin(profiling_subg_index);
-    for (auto &&code : _code)
+    for (size_t i = 0; i < _code.size(); ++i)
     {
+      auto &code = _code[i];
+      gate.pass();
+      affinity.useBigCores(_heavy[i]);
+      if (_prefetcher)
+        _prefetcher->prefetch(i);
       const auto backend = code.lower_info->backend();
 // TODO : Move ruy profiler into ExecutionObserver
 #ifdef RUY_PROFILER
@@ -45,7 +105,7 @@ void LinearExecutor::executeImpl()
       fn_seq->initRunning();
 
       bool handle_dynamic_tensor =
-        _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
+        _lowered_graph->getHasDynamicTensor(code.op_ind) || dynamic_input_exists;
       fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
       fn_seq->run();
 
@@ -55,8 +115,13 @@ void LinearExecutor::executeImpl()
   }
   else
   {
-    for (auto &&code : _code)
+    for (size_t i = 0; i < _code.size(); ++i)
     {
+      auto &code = _code[i];
+      gate.pass();
+      affinity.useBigCores(_heavy[i]);
+      if (_prefetcher)
+        _prefetcher->prefetch(i);
 // TODO : Move ruy profiler into ExecutionObserver
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
@@ -67,11 +132,62 @@ void LinearExecutor::executeImpl()
       fn_seq->initRunning();
 
       bool handle_dynamic_tensor =
-        _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
+        _lowered_graph->getHasDynamicTensor(code.op_ind) || dynamic_input_exists;
       fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
       fn_seq->run();
     }
   }
+
+#ifndef RUY_PROFILER
+  if (!_frozen_plan_disabled && _subject.empty())
+  {
+    freezePlan();
+  }
+#endif
+}
+
+void LinearExecutor::executeFrozenPlan(util::ScopedCpuAffinity &affinity)
+{
+  auto &gate = PriorityGate::get();
+  for (size_t i = 0; i < _frozen_plan.size(); ++i)
+  {
+    gate.pass();
+    affinity.useBigCores(_frozen_heavy[i]);
+    // Prefetch once for each operation, at its first kernel
+    if (_prefetcher && (i == 0 || _frozen_ops[i] != _frozen_ops[i - 1]))
+      _prefetcher->prefetch(_frozen_ops[i]);
+    _frozen_plan[i]->run();
+  }
+}
+
+void LinearExecutor::freezePlan()
+{
+  assert(_frozen_plan.empty());
+
+  // NOTE FunctionSequence without dynamic shape inference just runs its functions in order
+  bool heavy = true;
+  size_t op = 0;
+  std::function<void(IFunction &)> collect = [&](IFunction &fn) {
+    auto fn_seq = dynamic_cast<FunctionSequence *>(&fn);
+    if (fn_seq)
+      fn_seq->iterate(collect);
+    else
+    {
+      _frozen_plan.emplace_back(&fn);
+      _frozen_heavy.emplace_back(heavy);
+      _frozen_ops.emplace_back(op);
+    }
+  };
+
+  for (size_t i = 0; i < _code.size(); ++i)
+  {
+    heavy = _heavy[i];
+    op = i;
+    collect(*_code[i].fn_seq);
+  }
+
+  VERBOSE(LinearExecutor) << "Frozen execution plan with " << _frozen_plan.size() << " kernels"
+                          << std::endl;
 }
 
 } // namespace exec
@@ -23,11 +23,16 @@
 #define __ONERT_EXEC_EXECUTOR_H_
 
 #include "ExecutorBase.h"
+#include "WeightPrefetcher.h"
 
 #include "compiler/CodeMap.h"
 #include "ir/Index.h"
+#include "util/CpuAffinity.h"
 #include "util/TracingCtx.h"
 
+#include <cassert>
+#include <memory>
+
 namespace onert
 {
 namespace exec
@@ -55,14 +60,51 @@ public:
     for (auto index : order)
     {
       _code.emplace_back(std::move(code_map.at(index)));
+      _heavy.emplace_back(isHeavy(*_code.back().op));
+      _has_dynamic_op = _has_dynamic_op || _lowered_graph->getHasDynamicTensor(index);
     }
   }
 
 public:
   void executeImpl(void) override;
+  /**
+   * @brief Set the prefetcher of constants, whose operations were added in the order of execution
+   */
+  void setWeightPrefetcher(std::unique_ptr<WeightPrefetcher> prefetcher)
+  {
+    assert(prefetcher->size() == _code.size());
+    _prefetcher = std::move(prefetcher);
+  }
+
+private:
+  void executeFrozenPlan(util::ScopedCpuAffinity &affinity);
+  void freezePlan();
+  /**
+   * @brief Return true if an operation is worth the big cores when CPU_AFFINITY is "auto"
+   */
+  bool isHeavy(const ir::Operation &op) const;
 
 private:
   std::vector<compiler::CodeAndInfo> _code;
+  /**
+   * @brief Flat list of kernels of all operations in execution order
+   *
+   * For static-shape models without observers, every run is just running all kernels in order
+   * since kernels are configured with their tensors already. After the first run, the kernels are
+   * collected into this list and later runs skip per-operation bookkeeping such as
+   * FunctionSequence dispatch and dynamic shape checks. The list is dropped once an observer is
+   * added.
+   */
+  std::vector<IFunction *> _frozen_plan;
+  // Flags of operations that run on the big cores, parallel to _code and _frozen_plan
+  std::vector<bool> _heavy;
+  std::vector<bool> _frozen_heavy;
+  // Positions in _code of operations of kernels, parallel to _frozen_plan
+  std::vector<size_t> _frozen_ops;
+  bool _has_dynamic_op = false;
+  // Once any run has dynamic inputs, kernels may need dynamic shape inference from then on
+  bool _frozen_plan_disabled = false;
+  std::unique_ptr<WeightPrefetcher> _prefetcher;
 };
 
 } // namespace exec
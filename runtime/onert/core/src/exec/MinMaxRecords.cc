@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/MinMaxRecords.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace onert
+{
+namespace exec
+{
+
+MinMaxRecords::MinMaxRecords(const std::string &filepath) : _file{filepath, std::ios::trunc}
+{
+  if (!_file.is_open())
+    throw std::runtime_error{"Failed to open min/max file " + filepath};
+  // Values are written precisely enough to be read back as the same floats
+  _file.precision(std::numeric_limits<float>::max_digits10);
+}
+
+void MinMaxRecords::beginRun()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _records.clear();
+  _record_index.clear();
+}
+
+void MinMaxRecords::endRun()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  for (const auto &record : _records)
+  {
+    _file << _runs << " " << record.second.first << " " << record.second.second << " "
+          << record.first << "\n";
+  }
+  _file.flush();
+  _runs++;
+}
+
+void MinMaxRecords::record(const std::string &name, float min, float max)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto it = _record_index.find(name);
+  if (it == _record_index.end())
+  {
+    _record_index.emplace(name, _records.size());
+    _records.emplace_back(name, std::make_pair(min, max));
+    return;
+  }
+
+  auto &minmax = _records.at(it->second).second;
+  minmax.first = std::min(minmax.first, min);
+  minmax.second = std::max(minmax.second, max);
+}
+
+uint64_t MinMaxRecords::runs() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _runs;
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/MinMaxRecords.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+using namespace onert::exec;
+
+struct Line
+{
+  uint64_t run;
+  float min;
+  float max;
+  std::string name;
+};
+
+std::vector<Line> readLines(const std::string &path)
+{
+  std::vector<Line> lines;
+  std::ifstream file{path};
+  Line line;
+  while (file >> line.run >> line.min >> line.max)
+  {
+    file.get();
+    std::getline(file, line.name);
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+class MinMaxRecordsTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/onert_minmax_test_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    _path = path;
+  }
+  void TearDown() override { unlink(_path.c_str()); }
+
+  std::string _path;
+};
+
+} // namespace
+
+TEST_F(MinMaxRecordsTest, runs)
+{
+  {
+    MinMaxRecords records{_path};
+    records.beginRun();
+    records.record("input", -1.0f, 1.0f);
+    records.record("conv 1", 0.0f, 6.0f);
+    // Writes in a loop are merged
+    records.record("input", -2.0f, 0.5f);
+    records.endRun();
+
+    records.beginRun();
+    records.record("conv 1", 0.1f, 3.0f);
+    records.endRun();
+    ASSERT_EQ(records.runs(), 2);
+  }
+
+  const auto lines = readLines(_path);
+  ASSERT_EQ(lines.size(), 3);
+  ASSERT_EQ(lines[0].run, 0);
+  ASSERT_EQ(lines[0].name, "input");
+  ASSERT_EQ(lines[0].min, -2.0f);
+  ASSERT_EQ(lines[0].max, 1.0f);
+  ASSERT_EQ(lines[1].run, 0);
+  ASSERT_EQ(lines[1].name, "conv 1");
+  ASSERT_EQ(lines[2].run, 1);
+  ASSERT_EQ(lines[2].name, "conv 1");
+  ASSERT_EQ(lines[2].min, 0.1f);
+  ASSERT_EQ(lines[2].max, 3.0f);
+}
+
+TEST_F(MinMaxRecordsTest, neg_no_file)
+{
+  ASSERT_THROW(MinMaxRecords{"/nonexistent/minmax.txt"}, std::runtime_error);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/OnlineProfiling.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::exec;
+
+TEST(OnlineProfiling, reschedule_when_stable)
+{
+  OnlineProfiling profiling{100};
+  profiling.startRound();
+  profiling.markExploring();
+
+  // New records change estimates completely
+  profiling.addChange(1.0);
+  profiling.endRun();
+  ASSERT_FALSE(profiling.needReschedule());
+
+  for (int i = 0; i < 3; ++i)
+  {
+    profiling.addChange(0.01);
+    profiling.endRun();
+  }
+  ASSERT_TRUE(profiling.needReschedule());
+  ASSERT_FALSE(profiling.finished());
+
+  // No backend is left to try in the next round
+  profiling.startRound();
+  ASSERT_FALSE(profiling.needReschedule());
+  for (int i = 0; i < 3; ++i)
+    profiling.endRun();
+  ASSERT_TRUE(profiling.needReschedule());
+  ASSERT_TRUE(profiling.finished());
+  ASSERT_EQ(profiling.runs(), 7);
+}
+
+TEST(OnlineProfiling, neg_unstable_until_budget)
+{
+  OnlineProfiling profiling{5};
+  profiling.startRound();
+
+  for (int i = 0; i < 4; ++i)
+  {
+    profiling.addChange(0.5);
+    profiling.endRun();
+    ASSERT_FALSE(profiling.needReschedule());
+  }
+  profiling.addChange(0.5);
+  profiling.endRun();
+  ASSERT_TRUE(profiling.needReschedule());
+  ASSERT_TRUE(profiling.finished());
+}
@@ -16,8 +16,12 @@
 
 #include "ParallelExecutor.h"
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <queue>
 
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "exec/IFunction.h"
 
@@ -49,14 +53,168 @@ private:
   std::function<void()> _teardown;
 };
 
+// NOTE The number of shards does not need to be exact, it only reduces contention between workers
+constexpr uint32_t kNumReadyJobQueueShards = 4;
+// Number of empty polls of the ready job queue before the executor thread blocks
+constexpr uint32_t kMaxIdleSpins = 128;
+
 void ParallelExecutor::notify(uint32_t finished_job_id)
 {
+  // NOTE This is called from worker threads, so it must not touch _waiting_jobs or _ready_jobs
+  for (auto id : _output_info[finished_job_id])
+  {
+    // NOTE Speculation must be started before the job can be ready
+    if (_speculation_enabled)
+      trySpeculate(id, finished_job_id);
+
+    assert(_pending_inputs[id].load() > 0);
+    if (_pending_inputs[id].fetch_sub(1) == 1) // No dependent jobs left, ready for execution
+    {
+      pushReadyJob(id);
+    }
+  }
+}
+
+void ParallelExecutor::trySpeculate(uint32_t job_index, uint32_t finished_job_id)
+{
+  auto it = _speculative_jobs.find(job_index);
+  if (it == _speculative_jobs.end() || it->second.first_producer == finished_job_id)
+    return;
+
+  // Start if the others are all done, but the first input is not ready yet
+  auto &job = it->second;
+  if (job.pending.fetch_sub(1) == 1 && _pending_inputs[job_index].load() > 1)
+  {
+    VERBOSE(ParallelExecutor) << "Speculate job " << job_index << std::endl;
+    job.fn->speculate();
+  }
+}
+
+void ParallelExecutor::pushReadyJob(uint32_t job_index)
+{
+  _ready_job_queue.push(_job_ranks[job_index], job_index);
+
+  if (_waiting_ready_job.load())
+  {
+    std::lock_guard<std::mutex> lock{_mu_jobs};
+    _cv_jobs.notify_one();
+  }
+}
+
+void ParallelExecutor::waitReadyJob()
+{
+  for (uint32_t i = 0; i < kMaxIdleSpins; i++)
+  {
+    if (!_ready_job_queue.empty())
+      return;
+    std::this_thread::yield();
+  }
+
   std::unique_lock<std::mutex> lock{_mu_jobs};
+  _waiting_ready_job = true;
+  _cv_jobs.wait(lock, [this] { return !_ready_job_queue.empty(); });
+  _waiting_ready_job = false;
+}
 
-  DataflowExecutor::notify(finished_job_id);
+void ParallelExecutor::calculateJobRanks()
+{
+  const auto num_jobs = _finished_jobs.size();
+  _job_ranks.assign(num_jobs, 0);
 
-  lock.unlock();
-  _cv_jobs.notify_all();
+  if (_indexed_ranks)
+  {
+    for (uint32_t i = 0; i < num_jobs; ++i)
+      _job_ranks[i] = calculateRank({_job_to_op[i]});
+    return;
+  }
+
+  // Topological order of jobs
+  std::vector<uint32_t> order;
+  std::vector<uint32_t> in_degrees = _initial_input_info;
+  std::queue<uint32_t> queue;
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    if (in_degrees[i] == 0)
+      queue.push(i);
+  }
+  while (!queue.empty())
+  {
+    auto id = queue.front();
+    queue.pop();
+    order.push_back(id);
+    for (auto next : _output_info[id])
+    {
+      if (--in_degrees[next] == 0)
+        queue.push(next);
+    }
+  }
+  assert(order.size() == num_jobs);
+
+  // Length of the longest path to the end of the graph
+  for (auto it = order.rbegin(); it != order.rend(); ++it)
+  {
+    int64_t rank = 1;
+    for (auto next : _output_info[*it])
+      rank = std::max(rank, _job_ranks[next] + 1);
+    _job_ranks[*it] = rank;
+  }
+
+  // Run Permute ASAP for next operations to be ready for other backends
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    if (_graph.operations().at(_job_to_op[i]).opcode() == ir::OpCode::Permute)
+      _job_ranks[i] = std::numeric_limits<int64_t>::max();
+  }
+}
+
+void ParallelExecutor::collectSpeculativeJobs()
+{
+  std::unordered_map<ir::OperationIndex, uint32_t> op_to_job;
+  for (uint32_t i = 0; i < _job_to_op.size(); ++i)
+    op_to_job.emplace(_job_to_op[i], i);
+
+  for (uint32_t job_index = 0; job_index < _job_to_op.size(); ++job_index)
+  {
+    const auto &op_ind = _job_to_op[job_index];
+
+    ISpeculativeFunction *fn = nullptr;
+    _code_map.at(op_ind).fn_seq->iterate([&](IFunction &ifunc) {
+      if (fn == nullptr)
+        fn = dynamic_cast<ISpeculativeFunction *>(&ifunc);
+    });
+    if (fn == nullptr || _lowered_graph->getHasDynamicTensor(op_ind))
+      continue;
+
+    // Nothing to speculate if the first input is ready from the beginning
+    const auto &op = _graph.operations().at(op_ind);
+    const auto first_def = _graph.operands().at(op.getInputs().at(0)).getDef();
+    if (!first_def.valid())
+      continue;
+
+    auto &job = _speculative_jobs[job_index];
+    job.fn = fn;
+    job.first_producer = op_to_job.at(first_def);
+  }
+
+  for (uint32_t i = 0; i < _output_info.size(); ++i)
+  {
+    for (auto id : _output_info[i])
+    {
+      auto it = _speculative_jobs.find(id);
+      if (it != _speculative_jobs.end() && it->second.first_producer != i)
+        it->second.initial_pending++;
+    }
+  }
+
+  // Other inputs from the producer of the first input are not ready before it either
+  for (auto it = _speculative_jobs.begin(); it != _speculative_jobs.end();)
+  {
+    const auto &from_first = _output_info[it->second.first_producer];
+    if (std::count(from_first.begin(), from_first.end(), it->first) > 1)
+      it = _speculative_jobs.erase(it);
+    else
+      ++it;
+  }
 }
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
@@ -65,9 +223,14 @@ ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lower
                                    compiler::CodeMap &&code_map,
                                    const util::TracingCtx *tracing_ctx)
   : DataflowExecutor{std::move(lowered_graph), std::move(backend_contexts), tensor_regs,
-                     std::move(code_map), tracing_ctx}
+                     std::move(code_map), tracing_ctx},
+    _pending_inputs{new std::atomic<uint32_t>[_initial_input_info.size()]},
+    _ready_job_queue{kNumReadyJobQueueShards}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
+
+  if (util::getConfigBool(util::config::SPECULATIVE_EXEC))
+    collectSpeculativeJobs();
 }
 
 void ParallelExecutor::executeImpl()
@@ -85,47 +248,60 @@ void ParallelExecutor::executeImpl()
 
   assert(noWaitingJobs());
 
+  // NOTE Ranks are calculated here since indexed ranks are set after construction
+  if (_job_ranks.empty())
+    calculateJobRanks();
+
   // Execution setup
   _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
 
-  for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
+  const uint32_t num_jobs = _waiting_jobs.size();
+  for (uint32_t i = 0; i < num_jobs; ++i)
   {
-    VERBOSE(ParallelExecutor) << i << ": " << _input_info[i] << std::endl;
-    if (_input_info[i] == 0)
+    _pending_inputs[i] = _initial_input_info[i];
+  }
+
+  // Speculative functions keep static tensors, so nothing is speculated with dynamic inputs
+  _speculation_enabled = !_speculative_jobs.empty() && !dynamic_input_exists;
+  if (_speculation_enabled)
+  {
+    for (auto &e : _speculative_jobs)
+    {
+      auto &job = e.second;
+      job.pending = job.initial_pending;
+      if (job.initial_pending == 0)
+        job.fn->speculate();
+    }
+  }
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    VERBOSE(ParallelExecutor) << i << ": " << _initial_input_info[i] << std::endl;
+    if (_initial_input_info[i] == 0)
     {
-      emplaceToReadyJobs(i);
+      pushReadyJob(i);
     }
   }
-  assert(!_ready_jobs.empty()); // Cannot begin if there is no initial jobs
+  assert(!_ready_job_queue.empty()); // Cannot begin if there is no initial jobs
 
-  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_jobs.size() << std::endl;
+  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_job_queue.size() << std::endl;
 
   auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
 
   _subject.notifySubgraphBegin(profiling_subg_index);
 
-  while (true)
+  for (uint32_t num_assigned = 0; num_assigned < num_jobs; ++num_assigned)
   {
-    std::unique_lock<std::mutex> lock{_mu_jobs};
-
-    if (_ready_jobs.empty())
+    uint32_t job_index;
+    while (!_ready_job_queue.pop(job_index))
     {
-      _cv_jobs.wait(lock, [this] { return !_ready_jobs.empty() || noWaitingJobs(); });
-      // Check finish condition
-      if (_ready_jobs.empty() && noWaitingJobs())
-      {
-        break;
-      }
+      waitReadyJob();
     }
 
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
-
-    lock.unlock();
+    auto job = std::move(_waiting_jobs[job_index]);
+    assert(job != nullptr);
 
     VERBOSE(ParallelExecutor) << "Assigning fn " << job->index() << std::endl;
 
-    auto job_index = job->index();
     auto op_ind = _job_to_op[job_index];
     auto backend = _lowered_graph->lower_info().operation.at(op_ind).backend();
     auto setup = [&, op_ind, backend]() {
@@ -143,8 +319,9 @@ void ParallelExecutor::executeImpl()
       _lowered_graph->getHasDynamicTensor(op_ind) || dynamic_input_exists;
     job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
 
-    _scheduler->assign(std::make_unique<HookFunction>(job->fn_seq(), setup, teardown), backend);
+    auto fn_seq = job->fn_seq();
     _finished_jobs[job_index] = std::move(job);
+    _scheduler->assign(std::make_unique<HookFunction>(fn_seq, setup, teardown), backend);
   }
 
   assert(noWaitingJobs());
@@ -152,9 +329,6 @@ void ParallelExecutor::executeImpl()
   // Wait for all the jobs done
   _scheduler->finish();
   _subject.notifySubgraphEnd(profiling_subg_index);
-
-  // Reset input info for the next execution
-  _input_info = _initial_input_info;
 }
 
 } // namespace exec
@@ -19,10 +19,14 @@
 
 #include "DataflowExecutor.h"
 #include "ParallelScheduler.h"
+#include "ReadyJobQueue.h"
 
+#include "exec/ISpeculativeFunction.h"
 #include "util/TracingCtx.h"
 
+#include <atomic>
 #include <memory>
+#include <unordered_map>
 
 namespace onert
 {
@@ -52,10 +56,52 @@ public:
 
   void executeImpl() override;
 
+private:
+  /**
+   * @brief Calculate priorities of all jobs
+   *        Ranks from HEScheduler are used if exist, otherwise the length of the longest path
+   *        from each job to the end of the graph is used so that the critical path goes first.
+   *        Permute jobs always get the highest priority.
+   */
+  void calculateJobRanks();
+  /**
+   * @brief Find jobs of ISpeculativeFunction whose first input is produced by other job
+   */
+  void collectSpeculativeJobs();
+  /**
+   * @brief Start a speculative job if the finished job was the last one but the first input's
+   */
+  void trySpeculate(uint32_t job_index, uint32_t finished_job_id);
+  void pushReadyJob(uint32_t job_index);
+  void waitReadyJob();
+
+private:
+  struct SpeculativeJob
+  {
+    ISpeculativeFunction *fn = nullptr;
+    // Job which produces the first input
+    uint32_t first_producer = 0;
+    // Number of dependencies from the other jobs
+    uint32_t initial_pending = 0;
+    std::atomic<uint32_t> pending{0};
+  };
+
 private:
   std::condition_variable _cv_jobs;
   std::mutex _mu_jobs;
   std::unique_ptr<ParallelScheduler> _scheduler;
+  std::vector<int64_t> _job_ranks;
+  /**
+   * @brief Number of unfinished dependencies of each job, which is updated by worker threads
+   */
+  std::unique_ptr<std::atomic<uint32_t>[]> _pending_inputs;
+  ReadyJobQueue _ready_job_queue;
+  std::atomic<bool> _waiting_ready_job{false};
+  /**
+   * @brief Jobs to speculate with SPECULATIVE_EXEC, which are not changed after construction
+   */
+  std::unordered_map<uint32_t, SpeculativeJob> _speculative_jobs;
+  bool _speculation_enabled = false;
 };
 
 } // namespace exec
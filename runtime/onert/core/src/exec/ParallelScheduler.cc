@@ -16,9 +16,11 @@
 
 #include "ParallelScheduler.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include <memory>
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
 namespace onert
@@ -30,9 +32,17 @@ ParallelScheduler::ParallelScheduler(const BackendSet &backends)
 {
   assert(!backends.empty());
 
+  const auto num_threads =
+    static_cast<uint32_t>(std::max(util::getConfigInt(util::config::PARALLEL_THREADS), 1));
+  const bool pin_threads = util::getConfigBool(util::config::PARALLEL_PIN_THREADS);
+
+  // Give each backend its own range of cores so that pinned workers do not compete
+  int32_t first_core = 0;
   for (auto backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    _thread_pools[backend] =
+      std::make_unique<ThreadPool>(num_threads, pin_threads ? first_core : -1);
+    first_core += num_threads;
   }
 }
 
@@ -36,6 +36,9 @@ public:
    * @brief Constructs ParallelScheduler object
    *
    * @param backends Backend set
+   *
+   * @note  Each backend gets a ThreadPool with @c PARALLEL_THREADS workers. Use more than one
+   *        worker only with backends whose kernels can run concurrently.
    */
   ParallelScheduler(const BackendSet &backends);
   /**
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PriorityGate.h"
+
+#include "util/logging.h"
+
+namespace onert
+{
+namespace exec
+{
+
+// Threads out of any execution, e.g. ones running executors directly, run at the default priority
+thread_local int32_t PriorityGate::_thread_priority = 0;
+
+PriorityGate::Entry::Entry(PriorityGate &gate, int32_t priority)
+  : _gate{gate}, _priority{priority}, _prev_priority{_thread_priority}
+{
+  _gate.add(_priority);
+  _thread_priority = _priority;
+}
+
+PriorityGate::Entry::~Entry()
+{
+  _thread_priority = _prev_priority;
+  _gate.remove(_priority);
+}
+
+PriorityGate &PriorityGate::get()
+{
+  static PriorityGate gate;
+  return gate;
+}
+
+void PriorityGate::add(int32_t priority)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _entries[priority]++;
+  _highest = _entries.rbegin()->first;
+}
+
+void PriorityGate::remove(int32_t priority)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto it = _entries.find(priority);
+    if (--it->second == 0)
+      _entries.erase(it);
+    _highest = _entries.empty() ? NO_PRIORITY : _entries.rbegin()->first;
+  }
+  _cv.notify_all();
+}
+
+void PriorityGate::wait()
+{
+  VERBOSE(PriorityGate) << "Execution of priority " << _thread_priority << " is preempted"
+                        << std::endl;
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  _cv.wait(lock, [&]() { return _highest.load() <= _thread_priority; });
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PriorityGate.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace onert::exec;
+
+TEST(PriorityGate, highest)
+{
+  PriorityGate gate;
+  {
+    PriorityGate::Entry low{gate, -1};
+    ASSERT_EQ(gate.highest(), -1);
+    {
+      PriorityGate::Entry high{gate, 2};
+      PriorityGate::Entry same{gate, 2};
+      ASSERT_EQ(gate.highest(), 2);
+    }
+    ASSERT_EQ(gate.highest(), -1);
+    // Passing the gate does not wait for executions of the same or lower priority
+    gate.pass();
+  }
+  gate.pass();
+}
+
+TEST(PriorityGate, preempt)
+{
+  PriorityGate gate;
+  std::atomic<bool> high_done{false};
+  std::atomic<bool> low_passed{false};
+
+  auto high = std::make_unique<PriorityGate::Entry>(gate, 1);
+  std::thread low_thread{[&]() {
+    PriorityGate::Entry low{gate, 0};
+    gate.pass();
+    low_passed = true;
+    ASSERT_TRUE(high_done.load());
+  }};
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ASSERT_FALSE(low_passed.load());
+  high_done = true;
+  high.reset();
+  low_thread.join();
+  ASSERT_TRUE(low_passed.load());
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReadyJobQueue.h"
+
+#include <cassert>
+#include <functional>
+#include <thread>
+
+namespace onert
+{
+namespace exec
+{
+
+ReadyJobQueue::ReadyJobQueue(uint32_t num_shards)
+{
+  assert(num_shards >= 1);
+  for (uint32_t i = 0; i < num_shards; i++)
+  {
+    _shards.emplace_back(std::make_unique<Shard>());
+  }
+}
+
+void ReadyJobQueue::push(int64_t rank, uint32_t job_index)
+{
+  const auto thread_hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  auto &shard = *_shards[thread_hash % _shards.size()];
+
+  std::lock_guard<std::mutex> lock{shard.mu};
+  shard.entries.emplace(rank, job_index);
+  shard.top_rank = shard.entries.top().first;
+  shard.has_top = true;
+  _size++;
+}
+
+bool ReadyJobQueue::pop(uint32_t &job_index)
+{
+  while (_size.load() > 0)
+  {
+    // Find the shard with the highest rank without locking
+    Shard *best = nullptr;
+    int64_t best_rank = 0;
+    for (auto &shard : _shards)
+    {
+      if (!shard->has_top.load())
+        continue;
+      const auto rank = shard->top_rank.load();
+      if (best == nullptr || rank > best_rank)
+      {
+        best = shard.get();
+        best_rank = rank;
+      }
+    }
+
+    if (best == nullptr)
+      continue; // A producer is in the middle of pushing
+
+    std::lock_guard<std::mutex> lock{best->mu};
+    if (best->entries.empty())
+      continue; // Taken by another consumer
+
+    job_index = best->entries.top().second;
+    best->entries.pop();
+    best->has_top = !best->entries.empty();
+    if (best->has_top)
+      best->top_rank = best->entries.top().first;
+    _size--;
+    return true;
+  }
+
+  return false;
+}
+
+} // namespace exec
+} // namespace onert
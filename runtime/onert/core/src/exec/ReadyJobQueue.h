@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_READY_JOB_QUEUE_H__
+#define __ONERT_EXEC_READY_JOB_QUEUE_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Priority queue of ready job indices which is sharded to avoid a global lock
+ *
+ * Producers push into the shard chosen by their thread, so concurrent producers rarely touch the
+ * same lock. The consumer reads the top rank of every shard without locking and pops from the
+ * shard with the highest one. Jobs with the same rank are popped in the order of job index.
+ *
+ * @note  The priority order is exact for a single producer and approximate across shards while
+ *        producers are pushing, which is enough for scheduling.
+ */
+class ReadyJobQueue
+{
+public:
+  /**
+   * @brief Construct a ReadyJobQueue object
+   *
+   * @param num_shards Number of shards
+   */
+  ReadyJobQueue(uint32_t num_shards = 1);
+
+public:
+  /**
+   * @brief Push a job to the queue
+   *
+   * @param rank      Priority of the job. Higher is popped first.
+   * @param job_index Index of the job
+   */
+  void push(int64_t rank, uint32_t job_index);
+  /**
+   * @brief Pop a job with the highest rank
+   *
+   * @param[out] job_index Index of the popped job
+   * @return @c true if a job is popped, @c false if the queue is empty
+   */
+  bool pop(uint32_t &job_index);
+  /**
+   * @brief Get the number of jobs in the queue
+   */
+  uint32_t size() const { return _size.load(); }
+  /**
+   * @brief Check whether the queue is empty
+   */
+  bool empty() const { return size() == 0; }
+
+private:
+  using Entry = std::pair<int64_t, uint32_t>;
+  struct EntryLess
+  {
+    bool operator()(const Entry &lhs, const Entry &rhs) const
+    {
+      return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second > rhs.second);
+    }
+  };
+  struct Shard
+  {
+    std::mutex mu;
+    std::priority_queue<Entry, std::vector<Entry>, EntryLess> entries;
+    std::atomic<bool> has_top{false};
+    std::atomic<int64_t> top_rank{0};
+  };
+
+private:
+  std::vector<std::unique_ptr<Shard>> _shards;
+  std::atomic<uint32_t> _size{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_READY_JOB_QUEUE_H__
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ReadyJobQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+using namespace onert::exec;
+
+TEST(ReadyJobQueue, pop_by_rank)
+{
+  ReadyJobQueue queue;
+  queue.push(1, 0);
+  queue.push(3, 1);
+  queue.push(2, 2);
+  queue.push(3, 3);
+  ASSERT_EQ(queue.size(), 4);
+
+  uint32_t job_index;
+  std::vector<uint32_t> popped;
+  while (queue.pop(job_index))
+    popped.push_back(job_index);
+
+  // Higher rank first, and lower job index first among the same rank
+  ASSERT_EQ(popped, (std::vector<uint32_t>{1, 3, 2, 0}));
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(ReadyJobQueue, concurrent_push)
+{
+  ReadyJobQueue queue{4};
+  std::vector<std::thread> producers;
+  for (uint32_t t = 0; t < 4; t++)
+  {
+    producers.emplace_back([&queue, t]() {
+      for (uint32_t i = 0; i < 100; i++)
+        queue.push(i, t * 100 + i);
+    });
+  }
+
+  uint32_t num_popped = 0;
+  uint32_t job_index;
+  while (num_popped < 400)
+  {
+    if (queue.pop(job_index))
+      num_popped++;
+  }
+  for (auto &producer : producers)
+    producer.join();
+
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(ReadyJobQueue, neg_pop_empty)
+{
+  ReadyJobQueue queue{2};
+  uint32_t job_index;
+  ASSERT_FALSE(queue.pop(job_index));
+}
+
+} // namespace
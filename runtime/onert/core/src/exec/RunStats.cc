@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/RunStats.h"
+
+#include "backend/Backend.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace exec
+{
+
+void RunStats::beginRun()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _permute_ns = 0;
+  _dynamic_shape_ns = 0;
+  _backend_ns.clear();
+  _peak_memory.clear();
+}
+
+void RunStats::endRun(uint64_t total_us)
+{
+  Stats stats;
+  stats.total_us = total_us;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  stats.permute_us = _permute_ns / 1000;
+  stats.dynamic_shape_us = _dynamic_shape_ns / 1000;
+  for (const auto &pair : _backend_ns)
+    stats.backend_us.emplace_back(pair.first->config()->id(), pair.second / 1000);
+  std::sort(stats.backend_us.begin(), stats.backend_us.end());
+  for (const auto &pair : _peak_memory)
+    stats.peak_memory += pair.second;
+  _last = std::move(stats);
+  _runs++;
+}
+
+void RunStats::addOpTime(const backend::Backend *backend, bool permute, bool dynamic, uint64_t ns)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (permute)
+  {
+    _permute_ns += ns;
+    return;
+  }
+  _backend_ns[backend] += ns;
+  if (dynamic)
+    _dynamic_shape_ns += ns;
+}
+
+void RunStats::addPeakMemory(const void *owner, uint64_t bytes)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto &peak = _peak_memory[owner];
+  peak = std::max(peak, bytes);
+}
+
+RunStats::Stats RunStats::last() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _last;
+}
+
+uint64_t RunStats::runs() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _runs;
+}
+
+} // namespace exec
+} // namespace onert
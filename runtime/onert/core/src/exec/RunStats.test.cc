@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/RunStats.h"
+
+#include "backend/IConfig.h"
+#include "backend/Backend.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+using namespace backend;
+
+struct MockConfig : public IConfig
+{
+  MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) override
+  {
+    return ir::Layout::UNKNOWN;
+  }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+private:
+  std::string _id;
+};
+
+struct MockBackend : public ::onert::backend::Backend
+{
+  MockBackend(const std::string &id) : _id{id} {}
+  std::shared_ptr<onert::backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_id);
+  }
+  std::unique_ptr<onert::backend::BackendContext> newContext(ContextData &&) const override
+  {
+    return nullptr;
+  }
+
+private:
+  std::string _id;
+};
+
+TEST(RunStats, last_run)
+{
+  MockBackend b1{"b1"};
+  MockBackend b2{"b2"};
+  RunStats stats;
+  int owner1 = 0;
+  int owner2 = 0;
+
+  stats.beginRun();
+  stats.addOpTime(&b2, false, false, 3000);
+  stats.addOpTime(&b1, false, true, 1500);
+  stats.addOpTime(&b1, false, false, 1500);
+  stats.addOpTime(&b1, true, false, 2000);
+  stats.addPeakMemory(&owner1, 100);
+  stats.addPeakMemory(&owner1, 300);
+  stats.addPeakMemory(&owner2, 50);
+  stats.endRun(10);
+
+  auto last = stats.last();
+  ASSERT_EQ(stats.runs(), 1);
+  ASSERT_EQ(last.total_us, 10);
+  ASSERT_EQ(last.permute_us, 2);
+  ASSERT_EQ(last.dynamic_shape_us, 1);
+  // An executor running several times in a run is counted for its peak once
+  ASSERT_EQ(last.peak_memory, 350);
+  ASSERT_EQ(last.backend_us.size(), 2);
+  ASSERT_EQ(last.backend_us[0].first, "b1");
+  ASSERT_EQ(last.backend_us[0].second, 3);
+  ASSERT_EQ(last.backend_us[1].first, "b2");
+  ASSERT_EQ(last.backend_us[1].second, 3);
+
+  // Stats of the run in progress are not published until it ends
+  stats.beginRun();
+  stats.addOpTime(&b1, false, false, 5000);
+  ASSERT_EQ(stats.last().backend_us[0].second, 3);
+  stats.endRun(5);
+  last = stats.last();
+  ASSERT_EQ(last.permute_us, 0);
+  ASSERT_EQ(last.peak_memory, 0);
+  ASSERT_EQ(last.backend_us.size(), 1);
+  ASSERT_EQ(last.backend_us[0].second, 5);
+}
+
+TEST(RunStats, neg_no_run)
+{
+  RunStats stats;
+  auto last = stats.last();
+  ASSERT_EQ(stats.runs(), 0);
+  ASSERT_EQ(last.total_us, 0);
+  ASSERT_TRUE(last.backend_us.empty());
+}
+
+} // namespace
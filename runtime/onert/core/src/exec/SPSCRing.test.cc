@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/SPSCRing.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+using namespace onert::exec;
+
+TEST(SPSCRing, push_pop)
+{
+  SPSCRing<int> ring{2};
+  ASSERT_EQ(ring.capacity(), 2);
+  ASSERT_TRUE(ring.tryPush(1));
+  ASSERT_TRUE(ring.tryPush(2));
+  ASSERT_FALSE(ring.tryPush(3));
+
+  int value;
+  ASSERT_TRUE(ring.tryPop(value));
+  ASSERT_EQ(value, 1);
+  ASSERT_TRUE(ring.tryPush(3));
+  ASSERT_TRUE(ring.tryPop(value));
+  ASSERT_EQ(value, 2);
+  ASSERT_TRUE(ring.tryPop(value));
+  ASSERT_EQ(value, 3);
+  ASSERT_FALSE(ring.tryPop(value));
+}
+
+TEST(SPSCRing, concurrent_push_pop)
+{
+  SPSCRing<int> ring{4};
+  std::thread producer([&ring]() {
+    for (int i = 0; i < 1000; i++)
+      while (!ring.tryPush(int{i}))
+        std::this_thread::yield();
+  });
+
+  // Elements are popped in the order they are pushed
+  int value;
+  for (int i = 0; i < 1000; i++)
+  {
+    while (!ring.tryPop(value))
+      std::this_thread::yield();
+    ASSERT_EQ(value, i);
+  }
+  producer.join();
+}
+
+TEST(SPSCRing, neg_zero_capacity)
+{
+  ASSERT_THROW(SPSCRing<int>{0}, std::runtime_error);
+}
+
+} // namespace
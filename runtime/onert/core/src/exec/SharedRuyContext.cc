@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/SharedRuyContext.h"
+
+#include <ruy/context.h>
+
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+thread_local ruy::Context *current_context = nullptr;
+
+} // namespace
+
+SharedRuyContext::Lease::Lease(ThreadBudget::Lease &&threads, ruy::Context *context,
+                               std::unique_lock<std::mutex> &&lock)
+  : _threads{std::move(threads)}, _context{context}, _prev{current_context},
+    _lock{std::move(lock)}, _active{true}
+{
+  current_context = _context;
+}
+
+SharedRuyContext::Lease::Lease(Lease &&other)
+  : _threads{std::move(other._threads)}, _context{other._context}, _prev{other._prev},
+    _lock{std::move(other._lock)}, _active{other._active}
+{
+  other._active = false;
+}
+
+SharedRuyContext::Lease::~Lease()
+{
+  if (_active)
+    current_context = _prev;
+}
+
+SharedRuyContext &SharedRuyContext::get()
+{
+  static SharedRuyContext context{ThreadBudget::get()};
+  return context;
+}
+
+ruy::Context *SharedRuyContext::current() { return current_context; }
+
+SharedRuyContext::SharedRuyContext(ThreadBudget &budget)
+  : _budget{budget}, _context{std::make_unique<ruy::Context>()}
+{
+  // DO NOTHING
+}
+
+SharedRuyContext::~SharedRuyContext() = default;
+
+SharedRuyContext::Lease SharedRuyContext::lease(uint64_t cost, uint32_t max_threads,
+                                                ruy::Context *fallback)
+{
+  assert(fallback != nullptr);
+  {
+    auto threads = _budget.lease(cost, max_threads);
+    if (threads.threads() > 1)
+    {
+      std::unique_lock<std::mutex> lock{_mutex, std::try_to_lock};
+      if (lock.owns_lock())
+      {
+        // ruy creates workers up to the largest number of threads it has been given
+        _context->set_max_num_threads(static_cast<int>(threads.threads()));
+        return Lease{std::move(threads), _context.get(), std::move(lock)};
+      }
+    }
+    // The threads are returned to the budget but the calling one, which is leased again below
+  }
+
+  fallback->set_max_num_threads(1);
+  return Lease{_budget.lease(cost, 1), fallback, std::unique_lock<std::mutex>{}};
+}
+
+void SharedRuyContext::clearCache()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _context->ClearPrepackedCache();
+}
+
+} // namespace exec
+} // namespace onert
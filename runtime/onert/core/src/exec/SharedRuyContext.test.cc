@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/SharedRuyContext.h"
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+using namespace onert::exec;
+
+TEST(SharedRuyContext, lease_shared)
+{
+  ThreadBudget budget{4};
+  SharedRuyContext shared{budget};
+  ruy::Context fallback1, fallback2;
+  const auto big_cost = ThreadBudget::MIN_COST_PER_THREAD * 16;
+  ASSERT_EQ(SharedRuyContext::current(), nullptr);
+  {
+    auto lease1 = shared.lease(big_cost, 3, &fallback1);
+    ASSERT_EQ(lease1.threads(), 3);
+    ASSERT_NE(lease1.context(), &fallback1);
+    ASSERT_EQ(lease1.context()->max_num_threads(), 3);
+    ASSERT_EQ(SharedRuyContext::current(), lease1.context());
+
+    // The shared context is in use, so the other runs on the calling thread
+    auto lease2 = shared.lease(big_cost, 3, &fallback2);
+    ASSERT_EQ(lease2.threads(), 1);
+    ASSERT_EQ(lease2.context(), &fallback2);
+    ASSERT_EQ(fallback2.max_num_threads(), 1);
+    ASSERT_EQ(SharedRuyContext::current(), &fallback2);
+    ASSERT_EQ(budget.inUse(), 4);
+  }
+  ASSERT_EQ(SharedRuyContext::current(), nullptr);
+  ASSERT_EQ(budget.inUse(), 0);
+
+  // The shared context has been returned
+  auto lease = shared.lease(big_cost, 4, &fallback1);
+  ASSERT_EQ(lease.threads(), 4);
+  ASSERT_NE(lease.context(), &fallback1);
+}
+
+TEST(SharedRuyContext, lease_single_thread)
+{
+  ThreadBudget budget{4};
+  SharedRuyContext shared{budget};
+  ruy::Context fallback;
+  {
+    auto lease = shared.lease(ThreadBudget::MIN_COST_PER_THREAD, 4, &fallback);
+    ASSERT_EQ(lease.threads(), 1);
+    ASSERT_EQ(lease.context(), &fallback);
+    ASSERT_EQ(budget.inUse(), 1);
+  }
+  ASSERT_EQ(budget.inUse(), 0);
+  ASSERT_EQ(SharedRuyContext::current(), nullptr);
+}
+
+TEST(SharedRuyContext, budget_disabled)
+{
+  ThreadBudget budget{0};
+  SharedRuyContext shared{budget};
+  ruy::Context fallback;
+  auto lease = shared.lease(0, 8, &fallback);
+  ASSERT_EQ(lease.threads(), 8);
+  ASSERT_NE(lease.context(), &fallback);
+  ASSERT_EQ(lease.context()->max_num_threads(), 8);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ThreadBudget.h"
+
+#include "util/ConfigSource.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace onert
+{
+namespace exec
+{
+
+ThreadBudget &ThreadBudget::get()
+{
+  static ThreadBudget budget{[]() {
+    const auto capacity = util::getConfigInt(util::config::THREAD_BUDGET);
+    if (capacity < 0)
+      return std::max(std::thread::hardware_concurrency(), 1u);
+    return static_cast<uint32_t>(capacity);
+  }()};
+  return budget;
+}
+
+ThreadBudget::Lease ThreadBudget::lease(uint64_t cost, uint32_t max_threads)
+{
+  max_threads = std::max(max_threads, 1u);
+  if (!enabled())
+    return Lease{nullptr, max_threads};
+
+  const auto desired = static_cast<uint32_t>(
+    std::min<uint64_t>(std::max<uint64_t>(cost / MIN_COST_PER_THREAD, 1), max_threads));
+  auto in_use = _in_use.load();
+  uint32_t threads = 0;
+  do
+  {
+    // The calling thread runs anyway even if the others use up the budget
+    const uint32_t available = (in_use < _capacity) ? _capacity - in_use : 0;
+    threads = std::max(std::min(desired, available), 1u);
+  } while (!_in_use.compare_exchange_weak(in_use, in_use + threads));
+
+  return Lease{this, threads};
+}
+
+} // namespace exec
+} // namespace onert
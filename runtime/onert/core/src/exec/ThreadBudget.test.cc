@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ThreadBudget.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::exec;
+
+TEST(ThreadBudget, lease_share)
+{
+  ThreadBudget budget{4};
+  const auto big_cost = ThreadBudget::MIN_COST_PER_THREAD * 16;
+  {
+    auto lease1 = budget.lease(big_cost, 3);
+    ASSERT_EQ(lease1.threads(), 3);
+    auto lease2 = budget.lease(big_cost, 3);
+    ASSERT_EQ(lease2.threads(), 1);
+    auto lease3 = budget.lease(big_cost, 3);
+    ASSERT_EQ(lease3.threads(), 1);
+    ASSERT_EQ(budget.inUse(), 5);
+  }
+  ASSERT_EQ(budget.inUse(), 0);
+
+  auto small = budget.lease(ThreadBudget::MIN_COST_PER_THREAD, 4);
+  ASSERT_EQ(small.threads(), 1);
+}
+
+TEST(ThreadBudget, disabled)
+{
+  ThreadBudget budget{0};
+  ASSERT_FALSE(budget.enabled());
+  auto lease = budget.lease(0, 8);
+  ASSERT_EQ(lease.threads(), 8);
+  ASSERT_EQ(budget.inUse(), 0);
+}
@@ -16,20 +16,57 @@
 
 #include "ThreadPool.h"
 
+#include "util/CpuAffinity.h"
+
+#include <algorithm>
 #include <cassert>
 
+namespace
+{
+
+// Number of failed attempts to find a job before an idle worker parks itself
+constexpr uint32_t kMaxIdleSpins = 256;
+
+// Worker identity of the current thread, used to push jobs to the worker's own queue
+thread_local const void *tls_pool = nullptr;
+thread_local uint32_t tls_worker_index = 0;
+
+// Cores a worker may run on, which are within CPU_AFFINITY if it is given
+std::vector<uint32_t> workerCores(uint32_t worker_index, int32_t first_core)
+{
+  const auto &affinity = onert::util::CpuAffinity::get().cores();
+  if (first_core < 0)
+    return affinity;
+
+  std::vector<uint32_t> cores = affinity;
+  if (cores.empty())
+  {
+    const auto num_cores = std::max(std::thread::hardware_concurrency(), 1u);
+    for (uint32_t core = 0; core < num_cores; core++)
+      cores.push_back(core);
+  }
+  return {cores[(static_cast<uint32_t>(first_core) + worker_index) % cores.size()]};
+}
+
+} // namespace
+
 namespace onert
 {
 namespace exec
 {
 
-ThreadPool::ThreadPool(uint32_t num_threads)
+ThreadPool::ThreadPool(uint32_t num_threads, int32_t first_core) : _first_core{first_core}
 {
   assert(num_threads >= 1);
 
   for (uint32_t i = 0; i < num_threads; i++)
   {
-    _threads.emplace_back(std::ref(_worker));
+    _queues.emplace_back(std::make_unique<WorkQueue>());
+  }
+
+  for (uint32_t i = 0; i < num_threads; i++)
+  {
+    _threads.emplace_back(&ThreadPool::work, this, i);
   }
 }
 
@@ -37,14 +74,114 @@ ThreadPool::~ThreadPool()
 {
   if (!_threads.empty())
   {
-    _worker.terminate();
+    terminate();
     join();
   }
 }
 
-void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn) { _worker.enqueue(std::move(fn)); }
+void ThreadPool::enqueue(std::unique_ptr<IFunction> &&fn)
+{
+  // Count the job before it becomes visible so that _num_pending never goes below zero
+  _num_pending.fetch_add(1);
+
+  if (tls_pool == this)
+  {
+    _queues[tls_worker_index]->push(std::move(fn));
+  }
+  else
+  {
+    const auto index = _next_queue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+    _queues[index]->push(std::move(fn));
+  }
+
+  if (_num_parked.load() > 0)
+  {
+    // Taking the lock guarantees that a parking worker either sees the new job or gets notified
+    std::lock_guard<std::mutex> lock{_park_mu};
+    _park_cv.notify_one();
+  }
+}
+
+uint32_t ThreadPool::numJobsInQueue() { return std::max(_num_pending.load(), 0); }
 
-uint32_t ThreadPool::numJobsInQueue() { return _worker.numJobsInQueue(); }
+void ThreadPool::work(uint32_t worker_index)
+{
+  tls_pool = this;
+  tls_worker_index = worker_index;
+  // Set by the worker itself, which works on Android too where pthread_setaffinity_np is missing
+  util::setThreadAffinity(workerCores(worker_index, _first_core));
+
+  uint32_t idle_spins = 0;
+  while (true)
+  {
+    auto fn = take(worker_index);
+    if (fn)
+    {
+      idle_spins = 0;
+      fn->run();
+      continue;
+    }
+
+    const auto state = _state.load();
+    if (state == State::FORCE_FINISHING)
+    {
+      assert(_num_pending.load() == 0 && "Terminating with unfinished jobs");
+      break;
+    }
+    else if (state == State::FINISHING && _num_pending.load() == 0)
+    {
+      break;
+    }
+
+    if (idle_spins < kMaxIdleSpins)
+    {
+      ++idle_spins;
+      std::this_thread::yield();
+    }
+    else
+    {
+      park();
+      idle_spins = 0;
+    }
+  }
+
+  tls_pool = nullptr;
+}
+
+std::unique_ptr<IFunction> ThreadPool::take(uint32_t worker_index)
+{
+  auto fn = _queues[worker_index]->pop();
+
+  const auto num_queues = _queues.size();
+  for (uint32_t i = 1; !fn && i < num_queues; i++)
+  {
+    fn = _queues[(worker_index + i) % num_queues]->steal();
+  }
+
+  if (fn)
+  {
+    _num_pending.fetch_sub(1);
+  }
+  return fn;
+}
+
+void ThreadPool::park()
+{
+  std::unique_lock<std::mutex> lock{_park_mu};
+  _num_parked.fetch_add(1);
+  _park_cv.wait(lock,
+                [this] { return _num_pending.load() > 0 || _state.load() != State::ONLINE; });
+  _num_parked.fetch_sub(1);
+}
+
+void ThreadPool::terminate()
+{
+  {
+    std::lock_guard<std::mutex> lock{_park_mu};
+    _state = State::FORCE_FINISHING;
+  }
+  _park_cv.notify_all();
+}
 
 void ThreadPool::join()
 {
@@ -57,7 +194,11 @@ void ThreadPool::join()
 
 void ThreadPool::finish()
 {
-  _worker.finish();
+  {
+    std::lock_guard<std::mutex> lock{_park_mu};
+    _state = State::FINISHING;
+  }
+  _park_cv.notify_all();
   join();
 }
 
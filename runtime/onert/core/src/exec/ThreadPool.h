@@ -17,8 +17,11 @@
 #ifndef __ONERT_EXEC_THREAD_POOL_H__
 #define __ONERT_EXEC_THREAD_POOL_H__
 
-#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "WorkQueue.h"
@@ -28,15 +31,34 @@ namespace onert
 namespace exec
 {
 
+/**
+ * @brief Work-stealing thread pool
+ *
+ * Every worker owns a WorkQueue. Jobs from outside of the pool are distributed to the queues in
+ * round-robin manner and jobs from a worker go to its own queue. An idle worker steals jobs from
+ * the other queues, spins for a while and then parks until a new job arrives.
+ */
 class ThreadPool
 {
+public:
+  enum class State
+  {
+    ONLINE,
+    FINISHING,
+    FORCE_FINISHING
+  };
+
 public:
   /**
    * @brief Coustruct ThreadPool object
    *
    * @param num_threads Number of threads
+   * @param first_core  Core index to pin the first worker to. Worker @c i is pinned to core
+   *                    @c (first_core + i) % (number of cores). Negative value means no pinning.
+   * @note  Cores are those of CPU_AFFINITY if it is given, and workers that are not pinned run on
+   *        any of them
    */
-  ThreadPool(uint32_t num_threads = 1);
+  ThreadPool(uint32_t num_threads = 1, int32_t first_core = -1);
   /**
    * @brief Destroy ThreadPool object
    */
@@ -60,11 +82,22 @@ public:
   void finish();
 
 private:
+  void work(uint32_t worker_index);
+  std::unique_ptr<IFunction> take(uint32_t worker_index);
+  void park();
+  void terminate();
   void join();
 
 private:
-  WorkQueue _worker;
+  std::vector<std::unique_ptr<WorkQueue>> _queues;
   std::vector<std::thread> _threads;
+  const int32_t _first_core;
+  std::atomic<State> _state{State::ONLINE};
+  std::atomic<int32_t> _num_pending{0};
+  std::atomic<uint32_t> _num_parked{0};
+  std::atomic<uint32_t> _next_queue{0};
+  std::mutex _park_mu;
+  std::condition_variable _park_cv;
 };
 
 } // namespace exec
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+
+namespace
+{
+using namespace onert::exec;
+
+class CountFunction : public IFunction
+{
+public:
+  CountFunction(std::atomic<uint32_t> &count) : _count{count} {}
+  void run() override { _count++; }
+
+private:
+  std::atomic<uint32_t> &_count;
+};
+
+TEST(ThreadPool, run_all_jobs)
+{
+  std::atomic<uint32_t> count{0};
+  ThreadPool pool{4};
+  for (uint32_t i = 0; i < 1000; i++)
+    pool.enqueue(std::make_unique<CountFunction>(count));
+  pool.finish();
+
+  ASSERT_EQ(count.load(), 1000);
+  ASSERT_EQ(pool.numJobsInQueue(), 0);
+}
+
+TEST(ThreadPool, wake_parked_workers)
+{
+  std::atomic<uint32_t> count{0};
+  ThreadPool pool{2};
+  // Let the workers give up spinning and park
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  pool.enqueue(std::make_unique<CountFunction>(count));
+  pool.finish();
+
+  ASSERT_EQ(count.load(), 1);
+}
+
+TEST(ThreadPool, pinned_workers)
+{
+  std::atomic<uint32_t> count{0};
+  ThreadPool pool{2, 0};
+  for (uint32_t i = 0; i < 100; i++)
+    pool.enqueue(std::make_unique<CountFunction>(count));
+  pool.finish();
+
+  ASSERT_EQ(count.load(), 100);
+}
+
+TEST(ThreadPool, neg_destroy_without_finish)
+{
+  // Destroying a pool without any job must not hang
+  ThreadPool pool{2};
+}
+
+} // namespace
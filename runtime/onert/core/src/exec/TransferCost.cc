@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransferCost.h"
+
+#include "backend/IConfig.h"
+#include "util/AtomicFile.h"
+#include "util/logging.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace onert
+{
+namespace exec
+{
+
+const int64_t TransferCost::NOT_FOUND;
+
+TransferCost::TransferCost(const std::vector<const backend::Backend *> &backends)
+  : _file{"transfer_cost.json"}
+{
+  for (const auto b : backends)
+  {
+    _backends.emplace(b->config()->id(), b);
+  }
+  load();
+}
+
+int64_t TransferCost::getTransferTime(const backend::Backend *from_backend,
+                                      const backend::Backend *to_backend, uint32_t size) const
+{
+  auto it = _models.find({from_backend, to_backend});
+  if (it == _models.end())
+    return NOT_FOUND;
+
+  const auto &model = it->second;
+  double time = model.latency;
+  if (model.bandwidth > 0)
+    time += size / model.bandwidth;
+  return std::max<int64_t>(std::llround(time), 1);
+}
+
+bool TransferCost::calibrate(const backend::Backend *from_backend,
+                             const backend::Backend *to_backend,
+                             const std::map<uint32_t, int64_t> &records)
+{
+  if (records.size() < 2)
+    return false;
+
+  // Least squares fit of time = latency + size * slope
+  const double n = records.size();
+  double sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+  for (const auto &rec : records)
+  {
+    const double x = rec.first;
+    const double y = rec.second;
+    sum_x += x;
+    sum_y += y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+  }
+  double slope = (n * sum_xy - sum_x * sum_y) / (n * sum_xx - sum_x * sum_x);
+  double latency = (sum_y - slope * sum_x) / n;
+  if (slope <= 0)
+  {
+    // Transfer time does not depend on the size within the measured range
+    slope = 0;
+    latency = sum_y / n;
+  }
+  else if (latency < 0)
+  {
+    // Fit again with no latency
+    slope = sum_xy / sum_xx;
+    latency = 0;
+  }
+
+  Model model{latency, slope > 0 ? 1 / slope : 0};
+  _models[{from_backend, to_backend}] = model;
+  VERBOSE(TransferCost) << from_backend->config()->id() << " -> " << to_backend->config()->id()
+                        << " : latency " << model.latency << " us, bandwidth " << model.bandwidth
+                        << " bytes/us" << std::endl;
+  return true;
+}
+
+void TransferCost::store() const
+{
+  Json::Value root{Json::objectValue};
+  for (const auto &entry : _models)
+  {
+    const auto from_id = entry.first.first->config()->id();
+    const auto to_id = entry.first.second->config()->id();
+    auto &json_model = root[from_id][to_id];
+    json_model["latency"] = entry.second.latency;
+    json_model["bandwidth"] = entry.second.bandwidth;
+  }
+
+  std::ostringstream stream;
+  stream << root;
+  if (!util::writeFileAtomically(_file, stream.str()))
+    throw std::runtime_error("Failed to save transfer cost file");
+}
+
+void TransferCost::load()
+{
+  std::ifstream stream(_file);
+  if (!stream.is_open())
+    return;
+
+  Json::Value root;
+  Json::CharReaderBuilder builder;
+  std::string errors;
+  if (!Json::parseFromStream(builder, stream, &root, &errors) || !root.isObject())
+  {
+    VERBOSE(TransferCost) << "Ignore invalid transfer cost file : " << errors << std::endl;
+    return;
+  }
+
+  for (const auto &from_id : root.getMemberNames())
+  {
+    auto from = _backends.find(from_id);
+    if (from == _backends.end())
+      continue; // we ignore the records for unsupported backends
+    for (const auto &to_id : root[from_id].getMemberNames())
+    {
+      auto to = _backends.find(to_id);
+      if (to == _backends.end())
+        continue;
+      const auto &json_model = root[from_id][to_id];
+      _models[{from->second, to->second}] =
+        Model{json_model["latency"].asDouble(), json_model["bandwidth"].asDouble()};
+    }
+  }
+}
+
+} // namespace exec
+} // namespace onert
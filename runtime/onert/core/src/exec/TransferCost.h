@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_TRANSFER_COST_H__
+#define __ONERT_EXEC_TRANSFER_COST_H__
+
+#include "backend/Backend.h"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Cost model of data transfer between backends
+ *
+ * Each pair of backends has a model of time = latency + size / bandwidth, which is fit to permute
+ * times measured by profiling. The models are saved to "transfer_cost.json" next to
+ * "exec_time.json" so that a device needs to be calibrated once.
+ */
+class TransferCost
+{
+public:
+  struct Model
+  {
+    double latency;   //< Time to transfer no data in microseconds
+    double bandwidth; //< Bytes per microsecond, 0 if the size does not matter
+  };
+
+public:
+  explicit TransferCost(const std::vector<const backend::Backend *> &backends);
+
+public:
+  /**
+   * @brief Get the estimated time to transfer a tensor from one backend to another
+   *
+   * @param[in] from_backend Backend having the tensor
+   * @param[in] to_backend Backend to use the tensor
+   * @param[in] size Size of the tensor in bytes
+   * @return Time in microseconds, NOT_FOUND if the pair of backends is not calibrated
+   */
+  int64_t getTransferTime(const backend::Backend *from_backend,
+                          const backend::Backend *to_backend, uint32_t size) const;
+  /**
+   * @brief Fit the model of a pair of backends to measured transfer times
+   *
+   * @param[in] from_backend Backend having the tensor
+   * @param[in] to_backend Backend to use the tensor
+   * @param[in] records Map from tensor size in bytes to transfer time in microseconds
+   * @return true if calibrated, false if the records have less than two sizes
+   */
+  bool calibrate(const backend::Backend *from_backend, const backend::Backend *to_backend,
+                 const std::map<uint32_t, int64_t> &records);
+  /**
+   * @brief Update the calibration file with the models
+   */
+  void store() const;
+
+  static const int64_t NOT_FOUND = -1;
+
+private:
+  void load();
+
+private:
+  std::string _file;
+  std::unordered_map<std::string, const backend::Backend *> _backends;
+  std::map<std::pair<const backend::Backend *, const backend::Backend *>, Model> _models;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_TRANSFER_COST_H__
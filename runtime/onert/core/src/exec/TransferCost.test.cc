@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransferCost.h"
+
+#include "backend/IConfig.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+using namespace backend;
+
+struct MockConfig : public IConfig
+{
+  MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) override
+  {
+    return ir::Layout::UNKNOWN;
+  }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+  std::string _id;
+};
+
+struct MockBackend : public ::onert::backend::Backend
+{
+  MockBackend(const std::string &id) : _id{id} {}
+  std::shared_ptr<onert::backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_id);
+  }
+  std::unique_ptr<onert::backend::BackendContext> newContext(ContextData &&) const override
+  {
+    return nullptr;
+  }
+
+  std::string _id;
+};
+
+TEST(TransferCost, calibrate_roundtrip)
+{
+  MockBackend b1{"b1"}, b2{"b2"};
+  std::vector<const Backend *> bs = {&b1, &b2};
+  {
+    TransferCost tc(bs);
+    ASSERT_EQ(tc.getTransferTime(&b1, &b2, 1000), TransferCost::NOT_FOUND);
+
+    // 100us of latency and 10 bytes/us of bandwidth
+    ASSERT_TRUE(tc.calibrate(&b1, &b2, {{1000, 200}, {2000, 300}, {4000, 500}}));
+    ASSERT_EQ(tc.getTransferTime(&b1, &b2, 10), 101);
+    ASSERT_EQ(tc.getTransferTime(&b1, &b2, 10000), 1100);
+    ASSERT_EQ(tc.getTransferTime(&b2, &b1, 1000), TransferCost::NOT_FOUND);
+    tc.store();
+  }
+  {
+    TransferCost tc(bs);
+    ASSERT_EQ(tc.getTransferTime(&b1, &b2, 10000), 1100);
+  }
+  // clean up
+  EXPECT_EQ(remove("transfer_cost.json"), 0);
+}
+
+TEST(TransferCost, neg_calibrate_single_size)
+{
+  MockBackend b1{"b1"}, b2{"b2"};
+  std::vector<const Backend *> bs = {&b1, &b2};
+  TransferCost tc(bs);
+  ASSERT_FALSE(tc.calibrate(&b1, &b2, {{1000, 200}}));
+  ASSERT_EQ(tc.getTransferTime(&b1, &b2, 1000), TransferCost::NOT_FOUND);
+}
+} // unnamed namespace
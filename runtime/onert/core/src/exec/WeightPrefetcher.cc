@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WeightPrefetcher.h"
+
+#include <algorithm>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace onert
+{
+namespace exec
+{
+
+void WeightPrefetcher::addOperation(const std::vector<std::pair<const uint8_t *, size_t>> &weights)
+{
+  const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+
+  std::vector<Range> ranges;
+  for (const auto &weight : weights)
+  {
+    if (weight.first == nullptr || weight.second == 0)
+      continue;
+    const auto begin = reinterpret_cast<uintptr_t>(weight.first) / page_size * page_size;
+    const auto end = reinterpret_cast<uintptr_t>(weight.first) + weight.second;
+    ranges.push_back({begin, end - begin});
+  }
+
+  // Constants sharing pages are merged so that no page is advised twice for an operation
+  std::sort(ranges.begin(), ranges.end(),
+            [](const Range &lhs, const Range &rhs) { return lhs.begin < rhs.begin; });
+  std::vector<Range> merged;
+  for (const auto &range : ranges)
+  {
+    if (!merged.empty() && range.begin <= merged.back().begin + merged.back().size)
+    {
+      auto &last = merged.back();
+      last.size = std::max(last.begin + last.size, range.begin + range.size) - last.begin;
+    }
+    else
+    {
+      merged.push_back(range);
+    }
+  }
+  _ranges.emplace_back(std::move(merged));
+}
+
+void WeightPrefetcher::beginRun()
+{
+  for (size_t i = 0; i < std::min<size_t>(_distance, _ranges.size()); ++i)
+    advise(i);
+}
+
+void WeightPrefetcher::advise(size_t index)
+{
+  for (const auto &range : _ranges[index])
+  {
+    // It is only advice, which fails harmlessly for memory that is not mapped from a file
+    if (madvise(reinterpret_cast<void *>(range.begin), range.size, MADV_WILLNEED) == 0)
+      _advised_bytes += range.size;
+  }
+}
+
+} // namespace exec
+} // namespace onert
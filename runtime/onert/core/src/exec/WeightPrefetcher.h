@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WEIGHT_PREFETCHER_H__
+#define __ONERT_EXEC_WEIGHT_PREFETCHER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Prefetcher of pages of constants of operations ahead of their execution
+ *
+ * Constants mapped from the model file, with LAZY_CONSTANTS or USE_MMAPED_DATA, are paged in on
+ * their first access, and may be evicted under memory pressure to be paged in again. Before an
+ * operation runs, pages of constants of the operation the distance ahead in execution order are
+ * advised with MADV_WILLNEED, so that the kernel reads them in while the operations before it run.
+ */
+class WeightPrefetcher
+{
+public:
+  /**
+   * @param distance Operations to prefetch ahead, which must be positive
+   */
+  explicit WeightPrefetcher(uint32_t distance) : _distance{distance} {}
+
+public:
+  /**
+   * @brief Add an operation of the next position in execution order
+   * @param weights Buffers and sizes of constants of the operation
+   */
+  void addOperation(const std::vector<std::pair<const uint8_t *, size_t>> &weights);
+
+  /**
+   * @brief Prefetch constants of the first operations before a run
+   */
+  void beginRun();
+
+  /**
+   * @brief Prefetch constants of the operation the distance after an operation about to run
+   * @param index Position of the operation in execution order
+   */
+  void prefetch(size_t index)
+  {
+    if (index + _distance < _ranges.size())
+      advise(index + _distance);
+  }
+
+  size_t size() const { return _ranges.size(); }
+  /**
+   * @brief Get bytes of pages advised so far
+   */
+  uint64_t advisedBytes() const { return _advised_bytes; }
+
+private:
+  struct Range
+  {
+    uintptr_t begin;
+    size_t size;
+  };
+
+  void advise(size_t index);
+
+private:
+  const uint32_t _distance;
+  // Page-aligned ranges of constants of each operation, which do not overlap each other
+  std::vector<std::vector<Range>> _ranges;
+  uint64_t _advised_bytes = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WEIGHT_PREFETCHER_H__
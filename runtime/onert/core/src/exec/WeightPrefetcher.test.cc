@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WeightPrefetcher.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace onert::exec;
+
+namespace
+{
+
+// Read-only mapping of a temporary file of some pages
+class MappedPages
+{
+public:
+  explicit MappedPages(size_t pages) : _size{pages * static_cast<size_t>(getpagesize())}
+  {
+    auto file = std::tmpfile();
+    std::vector<uint8_t> zeros(_size);
+    std::fwrite(zeros.data(), 1, _size, file);
+    std::fflush(file);
+    _base = static_cast<uint8_t *>(mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileno(file), 0));
+    std::fclose(file);
+  }
+  ~MappedPages() { munmap(_base, _size); }
+
+  const uint8_t *page(size_t i) const { return _base + i * getpagesize(); }
+
+private:
+  size_t _size;
+  uint8_t *_base;
+};
+
+} // namespace
+
+TEST(WeightPrefetcher, prefetch_ahead)
+{
+  const size_t page_size = getpagesize();
+  MappedPages pages{4};
+
+  WeightPrefetcher prefetcher{2};
+  prefetcher.addOperation({{pages.page(0), page_size}});
+  prefetcher.addOperation({{pages.page(1), page_size}});
+  prefetcher.addOperation({});
+  prefetcher.addOperation({{pages.page(2), 2 * page_size}});
+  ASSERT_EQ(prefetcher.size(), 4);
+
+  // The first operations before the run, and each operation the distance ahead after that
+  prefetcher.beginRun();
+  ASSERT_EQ(prefetcher.advisedBytes(), 2 * page_size);
+  prefetcher.prefetch(0);
+  ASSERT_EQ(prefetcher.advisedBytes(), 2 * page_size);
+  prefetcher.prefetch(1);
+  ASSERT_EQ(prefetcher.advisedBytes(), 4 * page_size);
+  prefetcher.prefetch(2);
+  prefetcher.prefetch(3);
+  ASSERT_EQ(prefetcher.advisedBytes(), 4 * page_size);
+}
+
+TEST(WeightPrefetcher, merge_shared_pages)
+{
+  const size_t page_size = getpagesize();
+  MappedPages pages{3};
+
+  // Constants in the middle of pages are advised from the start of their pages, and ones sharing
+  // a page are advised as one range
+  WeightPrefetcher prefetcher{1};
+  prefetcher.addOperation({{pages.page(1) + 16, page_size},
+                           {pages.page(0) + 8, 8},
+                           {pages.page(1), 16}});
+  prefetcher.beginRun();
+  ASSERT_EQ(prefetcher.advisedBytes(), 16 + (page_size + 16));
+}
+
+TEST(WeightPrefetcher, neg_no_weights)
+{
+  WeightPrefetcher prefetcher{4};
+  prefetcher.addOperation({{nullptr, 64}});
+  prefetcher.beginRun();
+  prefetcher.prefetch(0);
+  ASSERT_EQ(prefetcher.advisedBytes(), 0);
+}
@@ -16,87 +16,42 @@
 
 #include "WorkQueue.h"
 
-#include <cassert>
-
 namespace onert
 {
 namespace exec
 {
 
-WorkQueue::~WorkQueue()
+void WorkQueue::push(std::unique_ptr<IFunction> &&fn)
 {
-  {
-    std::unique_lock<std::mutex> lock(_mu);
-    _state = State::FORCE_FINISHING;
-  }
-  _cv.notify_all();
+  std::lock_guard<std::mutex> lock{_mu};
+  _functions.emplace_back(std::move(fn));
 }
 
-void WorkQueue::operator()()
+std::unique_ptr<IFunction> WorkQueue::pop()
 {
-  while (true)
-  {
-    std::unique_ptr<IFunction> fn = nullptr;
-
-    {
-      std::unique_lock<std::mutex> lock{_mu};
-      _cv.wait(lock, [this] {
-        return (_state == State::FORCE_FINISHING) || (_state == State::FINISHING) ||
-               (_state == State::ONLINE && !_functions.empty());
-      });
-
-      if (_state == State::FORCE_FINISHING)
-      {
-        assert(_functions.empty() && "Terminating with unfinished jobs");
-        return;
-      }
-      else if (_state == State::FINISHING && _functions.empty())
-      {
-        return;
-      }
-      else
-      {
-        assert(((_state == State::FINISHING) || (_state == State::ONLINE)) && !_functions.empty());
-        fn = std::move(_functions.front());
-        _functions.pop();
-      }
-    }
-
-    assert(fn);
-    fn->run();
-  }
-}
+  std::lock_guard<std::mutex> lock{_mu};
+  if (_functions.empty())
+    return nullptr;
 
-void WorkQueue::enqueue(std::unique_ptr<IFunction> &&fn)
-{
-  {
-    std::unique_lock<std::mutex> lock{_mu};
-    _functions.emplace(std::move(fn));
-  }
-  _cv.notify_one();
+  auto fn = std::move(_functions.back());
+  _functions.pop_back();
+  return fn;
 }
 
-void WorkQueue::terminate()
+std::unique_ptr<IFunction> WorkQueue::steal()
 {
-  {
-    std::unique_lock<std::mutex> lock{_mu};
-    _state = State::FORCE_FINISHING;
-  }
-  _cv.notify_all();
-}
+  std::lock_guard<std::mutex> lock{_mu};
+  if (_functions.empty())
+    return nullptr;
 
-void WorkQueue::finish()
-{
-  {
-    std::unique_lock<std::mutex> lock{_mu};
-    _state = State::FINISHING;
-  }
-  _cv.notify_all();
+  auto fn = std::move(_functions.front());
+  _functions.pop_front();
+  return fn;
 }
 
-uint32_t WorkQueue::numJobsInQueue()
+uint32_t WorkQueue::size()
 {
-  std::unique_lock<std::mutex> lock{_mu};
+  std::lock_guard<std::mutex> lock{_mu};
   return _functions.size();
 }
 
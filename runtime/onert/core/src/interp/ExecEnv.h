@@ -21,6 +21,8 @@
 #ifndef __ONERT_INTERP_EXEC_ENV_H_
 #define __ONERT_INTERP_EXEC_ENV_H_
 
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_set>
 
 #include "ir/Graph.h"
@@ -34,6 +36,8 @@ namespace interp
 /**
  * @brief Class to gather interpreter execution environment
  *        Each interpreter instance own execution environment
+ * @note  Kernels of operations may run on multiple threads. Tensors are looked up under a shared
+ *        lock, and assigned under an exclusive lock.
  */
 class ExecEnv
 {
@@ -64,8 +68,8 @@ public:
    */
   void assignTensor(const ir::OperandIndex index, std::shared_ptr<ITensor> tensor)
   {
-    assert(tensor->bufferRO() != nullptr);
-    _tensors.emplace(index, tensor);
+    std::unique_lock<std::shared_timed_mutex> lock{_mutex};
+    assignTensorUnlocked(index, std::move(tensor));
   }
 
   /**
@@ -76,6 +80,7 @@ public:
    */
   const ITensor *tensorAt(const ir::OperandIndex index, bool can_optional = false) const
   {
+    std::shared_lock<std::shared_timed_mutex> lock{_mutex};
     if (_tensors.find(index) == _tensors.end())
     {
       // It may optional input,
@@ -98,7 +103,8 @@ public:
    */
   bool contains(const ir::OperandIndex index) const
   {
-    return (_tensors.find(index) != _tensors.end());
+    std::shared_lock<std::shared_timed_mutex> lock{_mutex};
+    return containsUnlocked(index);
   }
 
   /**
@@ -110,8 +116,10 @@ public:
    */
   void allocateIfNeeded(const ir::OperandIndex index, const ir::OperandInfo &info)
   {
+    std::unique_lock<std::shared_timed_mutex> lock{_mutex};
+
     // already allocated, or constant
-    if (contains(index))
+    if (containsUnlocked(index))
     {
       return;
     }
@@ -121,13 +129,13 @@ public:
     if (isExtBuffer(index))
     {
       tensor->setBuffer(_external_buffers.at(index));
-      assignTensor(index, tensor);
+      assignTensorUnlocked(index, tensor);
 
       return;
     }
 
     tensor->setBuffer(std::make_shared<InternalBuffer>(tensor->total_size()));
-    assignTensor(index, tensor);
+    assignTensorUnlocked(index, tensor);
     _buffers.insert(index);
   }
 
@@ -140,13 +148,15 @@ public:
   void allocateAndShareIfNeeded(const ir::OperandIndex index, const ir::OperandInfo &info,
                                 const ir::OperandIndex index_to_share)
   {
-    if (!contains(index_to_share))
+    std::unique_lock<std::shared_timed_mutex> lock{_mutex};
+
+    if (!containsUnlocked(index_to_share))
     {
       throw std::runtime_error{"Cannot find tensor to share data"};
     }
 
     // already allocated
-    if (contains(index))
+    if (containsUnlocked(index))
     {
       return;
     }
@@ -155,13 +165,13 @@ public:
     {
       auto tensor = std::make_shared<Tensor>(info);
       tensor->setBuffer(_external_buffers.at(index));
-      assignTensor(index, tensor);
+      assignTensorUnlocked(index, tensor);
     }
     else
     {
       auto tensor = std::make_shared<ROTensor>(info);
-      tensor->setData(tensorAt(index_to_share)->shareData());
-      assignTensor(index, tensor);
+      tensor->setData(_tensors.at(index_to_share)->shareData());
+      assignTensorUnlocked(index, tensor);
       _buffers.insert(index);
     }
   }
@@ -173,6 +183,7 @@ public:
    */
   void freeIfAllocated(const ir::OperandIndex index)
   {
+    std::shared_lock<std::shared_timed_mutex> lock{_mutex};
     if (_buffers.find(index) != _buffers.end())
     {
       _tensors.at(index)->releaseData();
@@ -186,10 +197,22 @@ public:
    */
   void assignExternalBuffer(const ir::OperandIndex index, std::shared_ptr<ExternalBuffer> buffer)
   {
+    std::unique_lock<std::shared_timed_mutex> lock{_mutex};
     _external_buffers.emplace(index, buffer);
   }
 
 private:
+  bool containsUnlocked(const ir::OperandIndex index) const
+  {
+    return (_tensors.find(index) != _tensors.end());
+  }
+
+  void assignTensorUnlocked(const ir::OperandIndex index, std::shared_ptr<ITensor> tensor)
+  {
+    assert(tensor->bufferRO() != nullptr);
+    _tensors.emplace(index, tensor);
+  }
+
   bool isExtBuffer(const ir::OperandIndex index)
   {
     return (_external_buffers.find(index) != _external_buffers.end());
@@ -204,6 +227,7 @@ private:
   std::unordered_set<ir::OperandIndex> _buffers;
   // Tensor buffer from external
   std::unordered_map<ir::OperandIndex, std::shared_ptr<ExternalBuffer>> _external_buffers;
+  mutable std::shared_timed_mutex _mutex;
 };
 
 } // namespace interp
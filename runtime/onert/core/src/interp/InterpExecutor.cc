@@ -111,7 +111,7 @@ void InterpExecutor::execute(const exec::IODescription &desc)
    * Invoke interpreter
    ****************************************************************************/
 
-  interp::Interpreter interp(std::move(interp_env));
+  interp::Interpreter interp(std::move(interp_env), _num_threads);
   interp.run();
 
   /*****************************************************************************
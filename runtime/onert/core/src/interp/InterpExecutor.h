@@ -39,7 +39,12 @@ class ITensor;
 class InterpExecutor final : public exec::IExecutor
 {
 public:
-  explicit InterpExecutor(const ir::Graph &graph) : _graph(graph)
+  /**
+   * @param[in] graph       Graph to execute
+   * @param[in] num_threads Threads to run independent operations with
+   */
+  explicit InterpExecutor(const ir::Graph &graph, uint32_t num_threads = 1)
+    : _graph(graph), _num_threads(num_threads)
   {
     // DO NOTHING
   }
@@ -75,6 +80,7 @@ public:
 
 private:
   const ir::Graph &_graph;
+  const uint32_t _num_threads;
   ir::OperandIndexMap<std::shared_ptr<ITensor>> _tensor_map;
 };
 
@@ -201,6 +201,56 @@ protected:
       std::make_pair(onert::ir::SubgraphIndex{0}, std::make_unique<InterpExecutor>(*_graph)));
   }
 
+  void CreateDiamondModel(uint32_t num_threads)
+  {
+    // Model: two independent elementwise add operations feeding a third
+    // model input: lhs, rhs
+    // model output: result3
+    // result1 <= (lhs + rhs)
+    // result2 <= (lhs + lhs)
+    // result3 <= (result1 + result2)
+    // lhs, rhs, result1, result2, result3 shape: {1, 2, 2, 1}
+    _graph = std::make_unique<Graph>();
+
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::INT32};
+
+    auto operand_lhs = _graph->addOperand(shape, type);
+    auto operand_rhs = _graph->addOperand(shape, type);
+    auto operand_result1 = _graph->addOperand(shape, type);
+    auto operand_result2 = _graph->addOperand(shape, type);
+    auto operand_result3 = _graph->addOperand(shape, type);
+
+    operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = Activation::NONE;
+    _graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{operand_lhs, operand_rhs}, OperandIndexSequence{operand_result1},
+      param));
+    _graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{operand_lhs, operand_lhs}, OperandIndexSequence{operand_result2},
+      param));
+    _graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{operand_result1, operand_result2},
+      OperandIndexSequence{operand_result3}, param));
+
+    // Identify model inputs and outputs
+
+    _graph->getInputs().append(operand_lhs);
+    _graph->getInputs().append(operand_rhs);
+    _graph->getOutputs().append(operand_result3);
+
+    _graph->verify();
+
+    auto subgs = std::make_shared<onert::ir::Subgraphs>();
+    subgs->push(onert::ir::SubgraphIndex{0}, _graph);
+    _graph->setSubgraphs(subgs);
+
+    _executors = std::make_shared<ExecutorMap>();
+    _executors->insert(std::make_pair(onert::ir::SubgraphIndex{0},
+                                      std::make_unique<InterpExecutor>(*_graph, num_threads)));
+  }
+
   void createExecution() { _execution = std::make_unique<Execution>(_executors); }
 
   virtual void TearDown() { _executors = nullptr; }
@@ -358,4 +408,29 @@ TEST_F(InterpExecutorTest, executeTwoStep)
   EXPECT_EQ(output_buffer[3], -1);
 }
 
+TEST_F(InterpExecutorTest, executeParallel)
+{
+  CreateDiamondModel(4);
+  createExecution();
+
+  const int32_t input1_buffer[4] = {1, 0, -1, -2};
+  const int32_t input2_buffer[4] = {1, -3, 2, -4};
+  int32_t output_buffer[4] = {};
+
+  // Runs twice so that operands freed in a run are allocated again in the next
+  for (int i = 0; i < 2; ++i)
+  {
+    EXPECT_NO_THROW(
+      _execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16));
+    EXPECT_NO_THROW(
+      _execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16));
+    EXPECT_NO_THROW(_execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16));
+    EXPECT_NO_THROW(_execution->execute());
+    EXPECT_EQ(output_buffer[0], 4);
+    EXPECT_EQ(output_buffer[1], -3);
+    EXPECT_EQ(output_buffer[2], -1);
+    EXPECT_EQ(output_buffer[3], -8);
+  }
+}
+
 } // namespace
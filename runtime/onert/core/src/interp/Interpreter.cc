@@ -16,12 +16,18 @@
 
 #include "Interpreter.h"
 
-#include <stack>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include "Registration.h"
 
 #include "ir/OperandIndexMap.h"
+#include "ir/OperationIndexMap.h"
 #include "util/logging.h"
 #include "ir/OperationVisitor.h"
 
@@ -30,9 +36,6 @@ namespace onert
 namespace interp
 {
 
-// TODO more structured execution kernel implementation
-// TODO use cker for execution
-// TODO divide tensor prepare and execution
 // TODO introduce memory manager (buffer allocate and free)
 class OperationExecutor
 {
@@ -44,24 +47,43 @@ public:
 #undef INTERP_OP
   }
 
-  void execute(const ir::OperationIndex &idx)
+  /**
+   * @brief Prepare output operands of an operation, which assigns tensors to ExecEnv
+   */
+  void prepare(const ir::OperationIndex &idx)
   {
     const ir::Operation &node = _env->graph().operations().at(idx);
-    const auto nodeName = node.name();
-    VERBOSE(INTERPRETER) << "Prepare output operands and execute " << nodeName
+    VERBOSE(INTERPRETER) << "Prepare output operands of " << node.name()
                          << " operation (id: " << idx << ")" << std::endl;
 
-    const auto nodeOpCode = node.opcode();
-    if (_kernels.find(nodeOpCode) == _kernels.end())
+    const auto kernel = find(node);
+    if (kernel->prepare != nullptr)
     {
-      throw std::runtime_error{"Interpreter: Operation " + nodeName + " is not yet implemented"};
+      kernel->prepare(_env, node);
     }
+  }
 
-    if (_kernels[nodeOpCode]->prepare != nullptr)
+  /**
+   * @brief Execute an operation prepared, which may run with other operations
+   */
+  void invoke(const ir::OperationIndex &idx) const
+  {
+    const ir::Operation &node = _env->graph().operations().at(idx);
+    VERBOSE(INTERPRETER) << "Execute " << node.name() << " operation (id: " << idx << ")"
+                         << std::endl;
+
+    find(node)->invoke(_env, node);
+  }
+
+private:
+  OpKernel *find(const ir::Operation &node) const
+  {
+    const auto kernel = _kernels.find(node.opcode());
+    if (kernel == _kernels.end())
     {
-      _kernels[nodeOpCode]->prepare(_env, node);
+      throw std::runtime_error{"Interpreter: Operation " + node.name() + " is not yet implemented"};
     }
-    _kernels[nodeOpCode]->invoke(_env, node);
+    return kernel->second;
   }
 
 private:
@@ -71,112 +93,129 @@ private:
 
 void Interpreter::run()
 {
-  VERBOSE(INTERPRETER) << "Interpreter is invoked " << std::endl;
+  VERBOSE(INTERPRETER) << "Interpreter is invoked with " << _num_threads << " threads"
+                       << std::endl;
 
-  // operand_stack: save operands prepared to use
-  std::stack<ir::OperandIndex> operand_stack;
+  const auto &graph = _env->graph();
 
-  // Note: We should push input first, then constant.
-  //       We use use-def for find operators ready to execution,
-  //       but Use-Def cannot handle parameters (maybe constant, but not always)
-  // Note: If all model inputs are constant, it may not work (depend on tensors' order).
-  //       But that scenario may not exist
-  for (auto ind : _env->graph().getInputs())
+  // Note: Use-Def cannot handle parameters (maybe constant, but not always), so model inputs and
+  //       constants are ready at first. Operations are ready once all their inputs are ready.
+  std::unordered_set<ir::OperandIndex> ready_operands;
+  for (auto ind : graph.getInputs())
   {
-    VERBOSE(INTERPRETER) << "Input: Push to operand stack " << ind << std::endl;
-
-    operand_stack.push(ind);
+    ready_operands.insert(ind);
   }
-
-  _env->graph().operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
     if (obj.isConstant())
     {
-      VERBOSE(INTERPRETER) << "Constant: Push to operand stack " << ind << std::endl;
+      ready_operands.insert(ind);
+    }
+  });
 
-      operand_stack.push(ind);
+  // pending_inputs: inputs of each operation that are not ready yet
+  // remaining_uses: operations to execute yet before the buffer of each operand is freed
+  ir::OperationIndexMap<uint32_t> pending_inputs;
+  ir::OperandIndexMap<uint32_t> remaining_uses;
+  std::deque<ir::OperationIndex> ready_operations;
+  graph.operations().iterate([&](const ir::OperationIndex &ind, const ir::Operation &node) {
+    uint32_t pending = 0;
+    for (auto input_index : node.getInputs())
+    {
+      if (ready_operands.find(input_index) == ready_operands.end())
+        ++pending;
     }
+    pending_inputs[ind] = pending;
+    // Operations without any input are never used
+    if (pending == 0 && node.getInputs().size() > 0)
+      ready_operations.push_back(ind);
+  });
+  graph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    remaining_uses[ind] = obj.getUses().size();
   });
 
   // Execution
-  std::unordered_set<ir::OperandIndex> ready_check;
-  std::unordered_set<ir::OperationIndex> executed;
+  // 1. Prepare output tensor, which is serialized by the lock
+  // 2. Call operation kernel without the lock
+  // 3. Mark outputs ready, and free buffers of inputs whose uses are all executed
   OperationExecutor executor{_env.get()};
-  while (!operand_stack.empty())
-  {
-    const auto current_operand_index = operand_stack.top();
-    operand_stack.pop();
-    VERBOSE(INTERPRETER) << "Poped operand " << current_operand_index.value()
-                         << " is checked ready to use" << std::endl;
-
-    assert(ready_check.find(current_operand_index) == ready_check.end());
-    ready_check.insert(current_operand_index);
-
-    // Find prepared operations by scan use of current operand
-    std::stack<ir::OperationIndex> operation_stack;
-    const auto use_operators = _env->graph().operands().at(current_operand_index).getUses();
-    for (const auto &use_operator : use_operators)
+  std::mutex mutex;
+  std::condition_variable cv;
+  uint32_t running = 0;
+  std::exception_ptr error;
+
+  auto work = [&]() {
+    std::unique_lock<std::mutex> lock{mutex};
+    while (true)
     {
-      // Assumption: all parameters are ready to use
-      bool operator_ready = true;
-      for (auto input_index : _env->graph().operations().at(use_operator).getInputs())
-      {
-        if (ready_check.find(input_index) == ready_check.end())
-        {
-          operator_ready = false;
-          break;
-        }
-      }
-
-      if (operator_ready)
+      cv.wait(lock, [&]() { return error || !ready_operations.empty() || running == 0; });
+      if (error || ready_operations.empty())
+        break;
+
+      const auto current_operation_index = ready_operations.front();
+      ready_operations.pop_front();
+      ++running;
+      try
       {
-        VERBOSE(INTERPRETER) << "Ready to execute operation " << use_operator << std::endl;
-        operation_stack.push(use_operator);
+        executor.prepare(current_operation_index);
+        lock.unlock();
+        executor.invoke(current_operation_index);
+        lock.lock();
       }
-    }
-
-    while (!operation_stack.empty())
-    {
-      const auto current_operation_index = operation_stack.top();
-      operation_stack.pop();
-      VERBOSE(INTERPRETER) << "Poped operation: " << current_operation_index << "("
-                           << _env->graph().operations().at(current_operation_index).name() << ")"
-                           << std::endl;
-
-      // execution
-      // 1. Prepare output tensor
-      // 2. Call operation kernel
-      executor.execute(current_operation_index);
-      executed.insert(current_operation_index);
-
-      // 3. Push each output into operand stack
-      const auto def_operands = _env->graph().operations().at(current_operation_index).getOutputs();
-      for (auto def_operand : def_operands)
+      catch (...)
       {
-        VERBOSE(INTERPRETER) << "Buffer: Push to operand stack " << def_operand.value()
-                             << std::endl;
-        operand_stack.push(def_operand);
+        if (!lock.owns_lock())
+          lock.lock();
+        error = std::current_exception();
+        --running;
+        break;
       }
+      --running;
 
-      // 4. Free if lifetime of buffer operands used by input is finished
-      for (auto input_index : _env->graph().operations().at(current_operation_index).getInputs())
+      const auto &node = graph.operations().at(current_operation_index);
+      for (auto def_operand : node.getOutputs())
       {
-        const auto use_operators = _env->graph().operands().at(input_index).getUses();
-        bool dead_buffer = true;
-        for (const auto &use_operator : use_operators)
+        for (const auto &use_operator : graph.operands().at(def_operand).getUses())
         {
-          if (executed.find(use_operator) == executed.end())
+          auto &pending = pending_inputs.at(use_operator);
+          for (auto input_index : graph.operations().at(use_operator).getInputs())
+          {
+            if (input_index == def_operand)
+              --pending;
+          }
+          if (pending == 0)
           {
-            dead_buffer = false;
-            break;
+            VERBOSE(INTERPRETER) << "Ready to execute operation " << use_operator << std::endl;
+            ready_operations.push_back(use_operator);
           }
         }
+      }
 
-        if (dead_buffer)
+      for (auto input_index : node.getInputs() | ir::Remove::DUPLICATED)
+      {
+        if (--remaining_uses.at(input_index) == 0)
         {
           _env->freeIfAllocated(input_index);
         }
       }
+      cv.notify_all();
     }
+    cv.notify_all();
+  };
+
+  std::vector<std::thread> workers;
+  for (uint32_t i = 1; i < _num_threads; ++i)
+  {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto &worker : workers)
+  {
+    worker.join();
+  }
+
+  if (error)
+  {
+    std::rethrow_exception(error);
   }
 }
 
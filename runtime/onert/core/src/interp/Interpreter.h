@@ -23,6 +23,9 @@
 
 #include "ExecEnv.h"
 
+#include <algorithm>
+#include <cstdint>
+
 namespace onert
 {
 namespace interp
@@ -41,9 +44,11 @@ public:
   Interpreter() = delete;
   /**
    * @brief     Construct a new Interpreter object
-   * @param[in] env Execution environment variable for interpreter object
+   * @param[in] env         Execution environment variable for interpreter object
+   * @param[in] num_threads Threads to run operations ready at the same time with
    */
-  Interpreter(std::unique_ptr<ExecEnv> env) : _env{std::move(env)}
+  Interpreter(std::unique_ptr<ExecEnv> env, uint32_t num_threads = 1)
+    : _env{std::move(env)}, _num_threads{std::max(num_threads, 1u)}
   {
     // DO NOTHING
   }
@@ -51,11 +56,14 @@ public:
 public:
   /**
    * @brief Run interpreter until there is no operation to execute
+   * @note  Operations whose inputs are all ready run on the threads in any order. Outputs are
+   *        the same as ones of a thread, as each kernel runs as it does alone.
    */
   void run();
 
 private:
   std::unique_ptr<ExecEnv> _env;
+  const uint32_t _num_threads;
 };
 
 } // namespace interp
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/Data.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+using namespace onert::ir;
+
+TEST(ir_Data, mapped_file_data)
+{
+  char path[] = "/tmp/onert_data_test_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+
+  std::vector<uint8_t> contents(3 * getpagesize());
+  for (size_t i = 0; i < contents.size(); ++i)
+    contents[i] = static_cast<uint8_t>(i * 7);
+  ASSERT_EQ(write(fd, contents.data(), contents.size()), static_cast<ssize_t>(contents.size()));
+
+  auto base = static_cast<uint8_t *>(mmap(NULL, contents.size(), PROT_READ, MAP_PRIVATE, fd, 0));
+  close(fd);
+  unlink(path);
+  ASSERT_NE(base, MAP_FAILED);
+
+  std::shared_ptr<Data> data;
+  {
+    auto file = std::make_shared<const MappedFile>(base, contents.size());
+    data = std::make_shared<MappedFileData>(file, getpagesize() + 5, 100);
+  }
+  // The data keeps the mapping alive
+  ASSERT_EQ(data->size(), 100);
+  ASSERT_TRUE(std::equal(data->base(), data->base() + 100, contents.begin() + getpagesize() + 5));
+
+  // Pages are read again after released
+  data->release();
+  ASSERT_TRUE(std::equal(data->base(), data->base() + 100, contents.begin() + getpagesize() + 5));
+}
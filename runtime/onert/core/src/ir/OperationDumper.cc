@@ -200,6 +200,14 @@ void OperationDumper::visit(const InstanceNorm &node)
 
 void OperationDumper::visit(const L2Normalization &node) { dumpOpGeneric(node); }
 
+void OperationDumper::visit(const LayerNorm &node)
+{
+  std::string inputs =
+    "Gamma(" + std::to_string(node.getInputs().at(LayerNorm::Input::GAMMA).value()) + ") Beta(" +
+    std::to_string(node.getInputs().at(LayerNorm::Input::BETA).value()) + ")";
+  dumpUnaryInputOp(node, inputs);
+}
+
 void OperationDumper::visit(const LocalResponseNormalization &node) { dumpOpGeneric(node); }
 
 void OperationDumper::visit(const LSTM &node)
@@ -54,6 +54,7 @@ public:
   void visit(const operation::HashtableLookup &) override;
   void visit(const operation::InstanceNorm &) override;
   void visit(const operation::L2Normalization &) override;
+  void visit(const operation::LayerNorm &) override;
   void visit(const operation::LocalResponseNormalization &) override;
   void visit(const operation::LSTM &) override;
   void visit(const operation::Pack &) override;
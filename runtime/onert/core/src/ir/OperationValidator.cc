@@ -113,6 +113,15 @@ void OperationValidator::visit(const operation::ArgMinMax &node)
   OP_REQUIRES(isValidType(output_index, output_type));
 }
 
+void OperationValidator::visit(const operation::Attention &node)
+{
+  const auto output_index(node.getOutputs().at(0));
+
+  OP_REQUIRES(isValidType(output_index, DataType::FLOAT32));
+  for (const auto &input_index : node.getInputs())
+    OP_REQUIRES(isSameType(input_index, output_index));
+}
+
 void OperationValidator::visit(const operation::BatchMatMul &node)
 {
   const auto lhs_index(node.getInputs().at(operation::BatchMatMul::Input::LHS));
@@ -254,6 +263,12 @@ void OperationValidator::visit(const operation::ElementwiseActivation &node)
     case operation::ElementwiseActivation::Type::ELU:
       OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
       break;
+    case operation::ElementwiseActivation::Type::GELU:
+      OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+      break;
+    case operation::ElementwiseActivation::Type::HARD_SWISH:
+      OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+      break;
     case operation::ElementwiseActivation::Type::LEAKY_RELU:
       OP_REQUIRES(
         isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
@@ -373,6 +388,19 @@ void OperationValidator::visit(const operation::HashtableLookup &node)
   OP_REQUIRES(isValidType(hits_index, DataType::QUANT_UINT8_ASYMM));
 }
 
+void OperationValidator::visit(const operation::LayerNorm &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto input_index{node.getInputs().at(operation::LayerNorm::Input::INPUT)};
+  const auto gamma_index{node.getInputs().at(operation::LayerNorm::Input::GAMMA)};
+  const auto beta_index{node.getInputs().at(operation::LayerNorm::Input::BETA)};
+
+  OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+  OP_REQUIRES(isSameType(output_index, input_index));
+  OP_REQUIRES(isSameType(gamma_index, input_index));
+  OP_REQUIRES(isSameType(beta_index, input_index));
+}
+
 void OperationValidator::visit(const operation::Pack &node)
 {
   const auto num{node.param().num};
@@ -47,6 +47,7 @@ public:
 public:
   void visit(const operation::AddN &node) override;
   void visit(const operation::ArgMinMax &node) override;
+  void visit(const operation::Attention &node) override;
   void visit(const operation::BatchMatMul &node) override;
   void visit(const operation::BatchToSpaceND &node) override;
   void visit(const operation::BinaryArithmetic &node) override;
@@ -63,6 +64,7 @@ public:
   void visit(const operation::ExpandDims &node) override;
   void visit(const operation::Fill &node) override;
   void visit(const operation::HashtableLookup &node) override;
+  void visit(const operation::LayerNorm &node) override;
   void visit(const operation::Pack &node) override;
   void visit(const operation::Pad &node) override;
   void visit(const operation::Rank &node) override;
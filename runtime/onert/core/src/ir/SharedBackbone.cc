@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/SharedBackbone.h"
+
+#include "OperationCloner.h"
+#include "ir/Graph.h"
+#include "ir/OperationVisitor.h"
+#include "util/logging.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace onert
+{
+namespace ir
+{
+
+namespace
+{
+
+template <typename T>
+auto equalParams(const T &lhs, const T &rhs, int) -> decltype(lhs.param(), bool())
+{
+  using Param = typename std::decay<decltype(lhs.param())>::type;
+  return std::is_trivially_copyable<Param>::value &&
+         std::memcmp(&lhs.param(), &rhs.param(), sizeof(Param)) == 0;
+}
+
+// Operations without parameters are the same of the same inputs
+template <typename T> bool equalParams(const T &, const T &, long) { return true; }
+
+/**
+ * @brief Whether operations are of the same operation code and parameters
+ */
+class SameOperation : public OperationVisitor
+{
+public:
+  explicit SameOperation(const Operation &other) : _other(other) {}
+
+  bool operator()(const Operation &operation)
+  {
+    // Custom operations may keep states of their own
+    if (operation.opcode() != _other.opcode() || operation.opcode() == OpCode::Custom)
+      return false;
+    _same = false;
+    operation.accept(*this);
+    return _same;
+  }
+
+#define OP(Name)                                                             \
+  void visit(const operation::Name &o) override                             \
+  {                                                                          \
+    _same = equalParams(o, static_cast<const operation::Name &>(_other), 0); \
+  }
+#include "ir/Operations.lst"
+#undef OP
+
+private:
+  const Operation &_other;
+  bool _same = false;
+};
+
+// operator== of TypeInfo is only for types of a quantization parameter
+bool sameTypeInfo(const TypeInfo &lhs, const TypeInfo &rhs)
+{
+  return lhs.type() == rhs.type() && lhs.scales() == rhs.scales() &&
+         lhs.zero_points() == rhs.zero_points() && lhs.sparsity() == rhs.sparsity();
+}
+
+bool sameInfo(const OperandInfo &lhs, const OperandInfo &rhs)
+{
+  return lhs.shape() == rhs.shape() && sameTypeInfo(lhs.typeInfo(), rhs.typeInfo());
+}
+
+bool sameConstant(const Operand &lhs, const Operand &rhs)
+{
+  if (!lhs.isConstant() || !rhs.isConstant() || !sameInfo(lhs.info(), rhs.info()))
+    return false;
+
+  const auto *lhs_data = lhs.data();
+  const auto *rhs_data = rhs.data();
+  if (lhs_data == rhs_data)
+    return true;
+  if (lhs_data == nullptr || rhs_data == nullptr || lhs_data->size() != rhs_data->size())
+    return false;
+  return std::memcmp(lhs_data->base(), rhs_data->base(), lhs_data->size()) == 0;
+}
+
+/**
+ * @brief Merger of models into a graph, one model after another
+ */
+class Merger
+{
+public:
+  Merger()
+    : _graph{std::make_shared<Graph>()},
+      _names{std::make_shared<std::unordered_map<OperandIndex, std::string>>()}
+  {
+  }
+
+  void merge(const Graph &model, size_t model_index, SharedBackbone &result);
+  std::shared_ptr<Graph> release();
+
+private:
+  std::string nameOf(const OperandIndex &index) const;
+  OperandIndex copy(const OperandIndex &index);
+  OperationIndex findShared(const Operation &operation) const;
+
+private:
+  std::shared_ptr<Graph> _graph;
+  std::shared_ptr<std::unordered_map<OperandIndex, std::string>> _names;
+
+  // States of the model being merged
+  const Graph *_model = nullptr;
+  // Operands of the model to ones of the merged graph
+  std::unordered_map<OperandIndex, OperandIndex> _to_merged;
+  // Operations added for the model, which are not shared with it again
+  std::unordered_set<OperationIndex> _added;
+};
+
+std::string Merger::nameOf(const OperandIndex &index) const
+{
+  const auto &tensor_names = _model->tensor_names();
+  if (tensor_names == nullptr)
+    return "";
+  const auto it = tensor_names->find(index);
+  return it == tensor_names->end() ? "" : it->second;
+}
+
+OperandIndex Merger::copy(const OperandIndex &index)
+{
+  auto operand = std::make_unique<Operand>(_model->operands().at(index));
+  operand->clearDefUse();
+  operand->info().clearPlannedOffset();
+  const auto merged_index = _graph->operands().push(std::move(operand));
+  _names->emplace(merged_index, nameOf(index));
+  _to_merged[index] = merged_index;
+  return merged_index;
+}
+
+OperationIndex Merger::findShared(const Operation &operation) const
+{
+  // Candidates are users of a non-constant input, which must be in the merged graph already
+  OperationIndexSet candidates;
+  for (const auto &input : operation.getInputs() | Remove::UNDEFINED)
+  {
+    if (_model->operands().at(input).isConstant())
+      continue;
+    const auto it = _to_merged.find(input);
+    if (it == _to_merged.end())
+      return OperationIndex{};
+    candidates = _graph->operands().at(it->second).getUses();
+  }
+
+  SameOperation same{operation};
+  for (const auto &candidate_index : candidates)
+  {
+    if (_added.count(candidate_index) > 0)
+      continue;
+    const auto &candidate = _graph->operations().at(candidate_index);
+    if (!same(candidate) || candidate.getInputs().size() != operation.getInputs().size() ||
+        candidate.getOutputs().size() != operation.getOutputs().size())
+      continue;
+
+    bool same_io = true;
+    for (uint32_t i = 0; i < operation.getInputs().size() && same_io; ++i)
+    {
+      const auto input = operation.getInputs().at(i);
+      const auto merged_input = candidate.getInputs().at(i);
+      if (!input.valid() || !merged_input.valid())
+        same_io = !input.valid() && !merged_input.valid();
+      else if (_model->operands().at(input).isConstant())
+        same_io = sameConstant(_model->operands().at(input), _graph->operands().at(merged_input));
+      else
+        same_io = _to_merged.at(input) == merged_input;
+    }
+    for (uint32_t i = 0; i < operation.getOutputs().size() && same_io; ++i)
+    {
+      const auto output = operation.getOutputs().at(i);
+      const auto merged_output = candidate.getOutputs().at(i);
+      if (!output.valid() || !merged_output.valid())
+      {
+        same_io = !output.valid() && !merged_output.valid();
+        continue;
+      }
+      same_io =
+        sameInfo(_model->operands().at(output).info(), _graph->operands().at(merged_output).info());
+    }
+    if (same_io)
+      return candidate_index;
+  }
+  return OperationIndex{};
+}
+
+void Merger::merge(const Graph &model, size_t model_index, SharedBackbone &result)
+{
+  _model = &model;
+  _to_merged.clear();
+  _added.clear();
+
+  const auto model_name = "model " + std::to_string(model_index);
+  for (uint32_t i = 0; i < model.getInputs().size(); ++i)
+  {
+    const auto input = model.getInputs().at(i);
+    if (model_index == 0)
+    {
+      _graph->addInput(copy(input), nameOf(input));
+      continue;
+    }
+
+    const auto merged_input = _graph->getInputs().at(i);
+    if (!sameInfo(model.operands().at(input).info(), _graph->operands().at(merged_input).info()))
+      throw std::runtime_error{"SharedBackbone: input " + std::to_string(i) + " of " + model_name +
+                               " is not the same as the one of the first model"};
+    _to_merged[input] = merged_input;
+  }
+
+  for (const auto &index : model.topolSortOperations())
+  {
+    const auto &operation = model.operations().at(index);
+
+    // Operations of model outputs are run for each model
+    bool shareable = model_index > 0;
+    for (const auto &output : operation.getOutputs() | Remove::UNDEFINED)
+      shareable = shareable && !model.getOutputs().contains(output);
+
+    const auto shared_index = shareable ? findShared(operation) : OperationIndex{};
+    if (shared_index.valid())
+    {
+      const auto &shared = _graph->operations().at(shared_index);
+      for (uint32_t i = 0; i < operation.getOutputs().size(); ++i)
+      {
+        if (operation.getOutputs().at(i).valid())
+          _to_merged[operation.getOutputs().at(i)] = shared.getOutputs().at(i);
+      }
+      result.shared_operations++;
+      continue;
+    }
+
+    OperandIndexSequence inputs;
+    for (const auto &input : operation.getInputs())
+    {
+      const auto it = input.valid() ? _to_merged.find(input) : _to_merged.end();
+      inputs.append(!input.valid() ? input : (it != _to_merged.end() ? it->second : copy(input)));
+    }
+    OperandIndexSequence outputs;
+    for (const auto &output : operation.getOutputs())
+      outputs.append(output.valid() ? copy(output) : output);
+
+    auto merged_operation = clone(operation);
+    merged_operation->setInputs(inputs);
+    merged_operation->setOutputs(outputs);
+    const auto merged_index = _graph->addOperation(std::move(merged_operation));
+    if (!merged_index.valid())
+      throw std::runtime_error{"SharedBackbone: failed to add an operation of " + model_name};
+    _added.insert(merged_index);
+  }
+
+  result.output_begins.push_back(_graph->getOutputs().size());
+  for (const auto &output : model.getOutputs())
+  {
+    const auto it = _to_merged.find(output);
+    const auto merged_output = it != _to_merged.end() ? it->second : copy(output);
+    if (_graph->getOutputs().contains(merged_output))
+      throw std::runtime_error{"SharedBackbone: an output of " + model_name +
+                               " is an output of another model"};
+    _graph->addOutput(merged_output, nameOf(output));
+  }
+}
+
+std::shared_ptr<Graph> Merger::release()
+{
+  _graph->setTensorName(_names);
+  _graph->verify();
+  return std::move(_graph);
+}
+
+} // namespace
+
+SharedBackbone mergeSharedBackbone(const std::vector<std::shared_ptr<Subgraphs>> &models)
+{
+  if (models.empty())
+    throw std::runtime_error{"SharedBackbone: no model to merge"};
+
+  const auto &first = *models.front()->primary();
+  SharedBackbone result;
+  Merger merger;
+  size_t operations = 0;
+  for (size_t i = 0; i < models.size(); ++i)
+  {
+    if (models[i]->count() != 1)
+      throw std::runtime_error{"SharedBackbone: models of several subgraphs are not supported"};
+
+    const auto &model = *models[i]->primary();
+    if (model.getInputs().size() != first.getInputs().size() || model.layout() != first.layout())
+      throw std::runtime_error{"SharedBackbone: model " + std::to_string(i) +
+                               " does not take the same inputs as the first model"};
+
+    merger.merge(model, i, result);
+    operations += model.operations().size();
+  }
+
+  auto graph = merger.release();
+  graph->setLayout(first.layout());
+  VERBOSE(SharedBackbone) << result.shared_operations << " of " << operations
+                          << " operations of " << models.size() << " models are shared"
+                          << std::endl;
+
+  result.subgraphs = std::make_shared<Subgraphs>();
+  result.subgraphs->push(SubgraphIndex{0}, graph);
+  return result;
+}
+
+} // namespace ir
+} // namespace onert
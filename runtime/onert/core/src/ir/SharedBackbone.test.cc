@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/SharedBackbone.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::ir;
+
+namespace
+{
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, float value)
+{
+  std::vector<float> values(shape.num_elements(), value);
+  auto index = graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+  graph.operands().at(index).data(std::make_shared<CachedData>(
+    reinterpret_cast<const uint8_t *>(values.data()), values.size() * sizeof(float)));
+  return index;
+}
+
+OperandIndex addArithmetic(Graph &graph, operation::BinaryArithmetic::ArithmeticType type,
+                           OperandIndex lhs, OperandIndex rhs)
+{
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = type;
+  param.activation = Activation::NONE;
+  auto output = graph.addOperand(graph.operands().at(lhs).shape(), TypeInfo{DataType::FLOAT32});
+  graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{output}, param));
+  return output;
+}
+
+/**
+ * @brief Model of a backbone of two ADDs with constants and a head of MUL by @p head_value
+ */
+std::shared_ptr<Subgraphs> makeModel(float backbone_value, float head_value)
+{
+  using Type = operation::BinaryArithmetic::ArithmeticType;
+  const Shape shape{1, 4};
+  auto graph = std::make_shared<Graph>();
+  auto input = graph->addOperand(shape, TypeInfo{DataType::FLOAT32});
+  auto feature =
+    addArithmetic(*graph, Type::ADD, input, addConstant(*graph, shape, backbone_value));
+  feature = addArithmetic(*graph, Type::ADD, feature, input);
+  auto output = addArithmetic(*graph, Type::MUL, feature, addConstant(*graph, shape, head_value));
+  graph->addInput(input);
+  graph->addOutput(output);
+  graph->verify();
+
+  auto subgraphs = std::make_shared<Subgraphs>();
+  subgraphs->push(SubgraphIndex{0}, graph);
+  return subgraphs;
+}
+
+} // namespace
+
+TEST(SharedBackbone, heads)
+{
+  auto merged =
+    mergeSharedBackbone({makeModel(1.f, 2.f), makeModel(1.f, 3.f), makeModel(1.f, 4.f)});
+
+  // The backbone runs once, and each head runs on its outputs
+  const auto &graph = *merged.subgraphs->primary();
+  ASSERT_EQ(merged.shared_operations, 4);
+  ASSERT_EQ(graph.operations().size(), 5);
+  ASSERT_EQ(graph.getInputs().size(), 1);
+  ASSERT_EQ(graph.getOutputs().size(), 3);
+  ASSERT_EQ(merged.output_begins, (std::vector<uint32_t>{0, 1, 2}));
+
+  const auto headOf = [&](uint32_t output) -> const Operation & {
+    return graph.operations().at(graph.operands().at(graph.getOutputs().at(output)).getDef());
+  };
+  for (uint32_t i = 1; i < 3; ++i)
+    ASSERT_EQ(headOf(i).getInputs().at(0), headOf(0).getInputs().at(0));
+}
+
+TEST(SharedBackbone, different_constants)
+{
+  // Backbones of different constants are not the same
+  auto merged = mergeSharedBackbone({makeModel(1.f, 2.f), makeModel(5.f, 2.f)});
+
+  ASSERT_EQ(merged.shared_operations, 0);
+  ASSERT_EQ(merged.subgraphs->primary()->operations().size(), 6);
+  ASSERT_EQ(merged.subgraphs->primary()->getOutputs().size(), 2);
+}
+
+TEST(SharedBackbone, same_models)
+{
+  // Operations of outputs are kept for each model
+  auto merged = mergeSharedBackbone({makeModel(1.f, 2.f), makeModel(1.f, 2.f)});
+
+  ASSERT_EQ(merged.shared_operations, 2);
+  ASSERT_EQ(merged.subgraphs->primary()->operations().size(), 4);
+  ASSERT_EQ(merged.subgraphs->primary()->getOutputs().size(), 2);
+}
+
+TEST(SharedBackbone, neg_different_inputs)
+{
+  auto model = makeModel(1.f, 2.f);
+  auto other = makeModel(1.f, 2.f);
+  auto &input = other->primary()->operands().at(other->primary()->getInputs().at(0));
+  input.info().shape(Shape{2, 4});
+
+  ASSERT_THROW(mergeSharedBackbone({model, other}), std::runtime_error);
+  ASSERT_THROW(mergeSharedBackbone({}), std::runtime_error);
+}
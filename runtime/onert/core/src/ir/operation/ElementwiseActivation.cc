@@ -61,7 +61,9 @@ std::string ElementwiseActivation::name() const
     {ElementwiseActivationType::LOGISTIC, "Logistic"},
     {ElementwiseActivationType::RELU, "ReLU"},
     {ElementwiseActivationType::TANH, "Tanh"},
-    {ElementwiseActivationType::LEAKY_RELU, "LeakyRelu"}};
+    {ElementwiseActivationType::LEAKY_RELU, "LeakyRelu"},
+    {ElementwiseActivationType::HARD_SWISH, "HardSwish"},
+    {ElementwiseActivationType::GELU, "Gelu"}};
   return name_map.at(_param.op_type);
 }
 
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/AtomicFile.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
+
+namespace onert
+{
+namespace util
+{
+
+bool writeFileAtomically(const std::string &path, const void *data, size_t size)
+{
+  // Temporary files of writers in this process and of other processes do not collide
+  static std::atomic<uint64_t> next_id{0};
+  const auto tmp_path = path + ".tmp" + std::to_string(getpid()) + "-" + std::to_string(next_id++);
+  {
+    std::ofstream stream(tmp_path, std::ios::binary);
+    if (!stream.is_open())
+      return false;
+    if (!stream.write(static_cast<const char *>(data), size) || !stream.flush())
+    {
+      stream.close();
+      std::remove(tmp_path.c_str());
+      return false;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+  {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+} // namespace util
+} // namespace onert
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/AtomicFile.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+
+using namespace onert;
+
+namespace
+{
+
+class AtomicFileTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/atomic_file_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    _dir = dir;
+  }
+  void TearDown() override { std::system(("rm -rf " + _dir).c_str()); }
+
+  std::string read(const std::string &path)
+  {
+    std::ifstream stream(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  }
+
+  size_t countFiles()
+  {
+    size_t count = 0;
+    auto dir = opendir(_dir.c_str());
+    while (auto entry = readdir(dir))
+      count += entry->d_name[0] != '.';
+    closedir(dir);
+    return count;
+  }
+
+  std::string _dir;
+};
+
+} // namespace
+
+TEST_F(AtomicFileTest, write_and_replace)
+{
+  const auto path = _dir + "/file";
+  ASSERT_TRUE(util::writeFileAtomically(path, "first"));
+  ASSERT_EQ(read(path), "first");
+
+  const uint8_t bytes[] = {0, 1, 2};
+  ASSERT_TRUE(util::writeFileAtomically(path, bytes, sizeof(bytes)));
+  ASSERT_EQ(read(path), std::string("\0\1\2", 3));
+
+  // No temporary file is left
+  ASSERT_EQ(countFiles(), 1);
+}
+
+TEST_F(AtomicFileTest, neg_write_unwritable)
+{
+  ASSERT_FALSE(util::writeFileAtomically(_dir + "/no_dir/file", "contents"));
+  ASSERT_EQ(countFiles(), 0);
+}
@@ -20,7 +20,11 @@
 
 #include <array>
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <memory>
 
@@ -35,6 +39,52 @@ static std::unique_ptr<IConfigSource> _source_ext;
 void config_source(std::unique_ptr<IConfigSource> &&source) { _source = std::move(source); }
 void config_source_ext(std::unique_ptr<IConfigSource> &&source) { _source_ext = std::move(source); }
 
+namespace
+{
+
+// Values of ScopedConfig, innermost last
+std::mutex scoped_mutex;
+std::vector<std::pair<uint64_t, std::unordered_map<std::string, std::string>>> scoped_values;
+uint64_t scoped_next_id = 0;
+// Configs are read without locking while no scope is alive
+std::atomic<bool> scoped_any{false};
+
+std::string getScopedConfig(const std::string &key)
+{
+  if (!scoped_any)
+    return "";
+
+  std::lock_guard<std::mutex> lock{scoped_mutex};
+  for (auto it = scoped_values.rbegin(); it != scoped_values.rend(); ++it)
+  {
+    auto value = it->second.find(key);
+    if (value != it->second.end())
+      return value->second;
+  }
+  return "";
+}
+
+} // namespace
+
+ScopedConfig::ScopedConfig(const std::unordered_map<std::string, std::string> &values)
+{
+  std::lock_guard<std::mutex> lock{scoped_mutex};
+  _id = scoped_next_id++;
+  scoped_values.emplace_back(_id, values);
+  scoped_any = true;
+}
+
+ScopedConfig::~ScopedConfig()
+{
+  std::lock_guard<std::mutex> lock{scoped_mutex};
+  // Scopes of other threads may end in any order
+  auto it = std::find_if(scoped_values.begin(), scoped_values.end(),
+                         [&](const auto &scope) { return scope.first == _id; });
+  assert(it != scoped_values.end());
+  scoped_values.erase(it);
+  scoped_any = !scoped_values.empty();
+}
+
 static IConfigSource *config_source()
 {
   if (!_source)
@@ -66,7 +116,9 @@ static std::string getConfigOrDefault(const std::string &key)
   }
 
   // Treat empty string and absence of the value to be the same
-  auto ret = config_source()->get(key);
+  auto ret = getScopedConfig(key);
+  if (ret.empty())
+    ret = config_source()->get(key);
   if (ret.empty())
   {
     // if env is not set, search from external
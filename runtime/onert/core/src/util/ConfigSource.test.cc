@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ConfigSource.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::util;
+
+TEST(ScopedConfig, override_in_scope)
+{
+  const auto planner = getConfigString(config::CPU_MEMORY_PLANNER);
+  {
+    ScopedConfig outer{{{config::CPU_MEMORY_PLANNER, "Bump"}, {config::RUY_THREADS, "4"}}};
+    ASSERT_EQ(getConfigString(config::CPU_MEMORY_PLANNER), "Bump");
+    {
+      // The innermost scope wins for keys it has only
+      ScopedConfig inner{{{config::CPU_MEMORY_PLANNER, "FirstFit"}}};
+      ASSERT_EQ(getConfigString(config::CPU_MEMORY_PLANNER), "FirstFit");
+      ASSERT_EQ(getConfigInt(config::RUY_THREADS), 4);
+    }
+    ASSERT_EQ(getConfigString(config::CPU_MEMORY_PLANNER), "Bump");
+  }
+  ASSERT_EQ(getConfigString(config::CPU_MEMORY_PLANNER), planner);
+}
+
+TEST(ScopedConfig, neg_end_out_of_order)
+{
+  const auto threads = getConfigInt(config::RUY_THREADS);
+  auto first = std::make_unique<ScopedConfig>(
+    std::unordered_map<std::string, std::string>{{config::RUY_THREADS, "2"}});
+  auto second = std::make_unique<ScopedConfig>(
+    std::unordered_map<std::string, std::string>{{config::RUY_THREADS, "3"}});
+
+  // Scopes of threads may end before the scopes in them
+  first.reset();
+  ASSERT_EQ(getConfigInt(config::RUY_THREADS), 3);
+  second.reset();
+  ASSERT_EQ(getConfigInt(config::RUY_THREADS), threads);
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/CpuAffinity.h"
+
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+// Capacity of a core relative to the others, 0 if unknown
+uint64_t coreCapacity(uint32_t core)
+{
+  const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(core);
+  for (const auto &file : {"/cpu_capacity", "/cpufreq/cpuinfo_max_freq"})
+  {
+    std::ifstream ifs{base + file};
+    uint64_t value = 0;
+    if (ifs >> value)
+      return value;
+  }
+  return 0;
+}
+
+std::vector<uint32_t> currentAffinity()
+{
+  std::vector<uint32_t> cores;
+#ifdef __linux__
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuset) != 0)
+    return cores;
+  for (uint32_t core = 0; core < CPU_SETSIZE; ++core)
+  {
+    if (CPU_ISSET(core, &cpuset))
+      cores.push_back(core);
+  }
+#endif
+  return cores;
+}
+
+} // namespace
+
+const CpuClusters &cpuClusters()
+{
+  static const CpuClusters clusters = []() {
+    CpuClusters clusters;
+    const auto num_cores = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<uint64_t> capacities;
+    for (uint32_t core = 0; core < num_cores; ++core)
+      capacities.push_back(coreCapacity(core));
+
+    const auto max_capacity = *std::max_element(capacities.begin(), capacities.end());
+    for (uint32_t core = 0; core < num_cores; ++core)
+    {
+      if (capacities[core] == max_capacity)
+        clusters.big.push_back(core);
+      else
+        clusters.little.push_back(core);
+    }
+    return clusters;
+  }();
+  return clusters;
+}
+
+const CpuAffinity &CpuAffinity::get()
+{
+  static const CpuAffinity affinity =
+    parse(getConfigString(config::CPU_AFFINITY), cpuClusters());
+  return affinity;
+}
+
+CpuAffinity CpuAffinity::parse(const std::string &value, const CpuClusters &clusters)
+{
+  CpuAffinity affinity;
+  if (value.empty())
+    return affinity;
+
+  if (value == "big" || value == "auto")
+  {
+    // Systems whose cores are alike need no affinity
+    if (!clusters.little.empty())
+    {
+      affinity._cores = clusters.big;
+      affinity._auto = value == "auto";
+    }
+    return affinity;
+  }
+  if (value == "little")
+  {
+    affinity._cores = clusters.little;
+    return affinity;
+  }
+
+  // List of cores and ranges of cores
+  std::stringstream ss{value};
+  std::string item;
+  while (std::getline(ss, item, ','))
+  {
+    try
+    {
+      size_t pos = 0;
+      const auto first = std::stoul(item, &pos);
+      auto last = first;
+      if (pos < item.size())
+      {
+        if (item[pos] != '-')
+          throw std::invalid_argument{item};
+        last = std::stoul(item.substr(pos + 1));
+      }
+      if (last < first)
+        throw std::invalid_argument{item};
+      for (auto core = first; core <= last; ++core)
+        affinity._cores.push_back(static_cast<uint32_t>(core));
+    }
+    catch (const std::logic_error &)
+    {
+      throw std::runtime_error{"Invalid CPU_AFFINITY: " + value};
+    }
+  }
+  std::sort(affinity._cores.begin(), affinity._cores.end());
+  affinity._cores.erase(std::unique(affinity._cores.begin(), affinity._cores.end()),
+                        affinity._cores.end());
+  return affinity;
+}
+
+bool setThreadAffinity(const std::vector<uint32_t> &cores)
+{
+#ifdef __linux__
+  if (cores.empty())
+    return false;
+
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  for (auto core : cores)
+  {
+    if (core < CPU_SETSIZE)
+      CPU_SET(core, &cpuset);
+  }
+  if (sched_setaffinity(0, sizeof(cpu_set_t), &cpuset) != 0)
+  {
+    VERBOSE(CpuAffinity) << "Failed to set the affinity of a thread" << std::endl;
+    return false;
+  }
+  return true;
+#else
+  (void)cores;
+  return false;
+#endif
+}
+
+ScopedCpuAffinity::ScopedCpuAffinity()
+{
+  const auto &cores = CpuAffinity::get().cores();
+  if (cores.empty())
+    return;
+
+  _saved = currentAffinity();
+  _restore = !_saved.empty() && setThreadAffinity(cores);
+}
+
+ScopedCpuAffinity::~ScopedCpuAffinity()
+{
+  if (_restore)
+    setThreadAffinity(_saved);
+}
+
+void ScopedCpuAffinity::useBigCores(bool big)
+{
+  const auto &affinity = CpuAffinity::get();
+  if (!_restore || !affinity.isAuto() || big == _big)
+    return;
+
+  const auto &clusters = cpuClusters();
+  if (setThreadAffinity(big ? clusters.big : clusters.little))
+    _big = big;
+}
+
+} // namespace util
+} // namespace onert
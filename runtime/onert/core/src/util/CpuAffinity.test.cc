@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/CpuAffinity.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::util;
+
+namespace
+{
+
+const CpuClusters big_little{{4, 5, 6, 7}, {0, 1, 2, 3}};
+const CpuClusters uniform{{0, 1, 2, 3}, {}};
+
+} // namespace
+
+TEST(CpuAffinity, parse_list)
+{
+  const auto affinity = CpuAffinity::parse("6,0-2,1", big_little);
+  ASSERT_EQ(affinity.cores(), (std::vector<uint32_t>{0, 1, 2, 6}));
+  ASSERT_FALSE(affinity.isAuto());
+
+  ASSERT_TRUE(CpuAffinity::parse("", big_little).cores().empty());
+}
+
+TEST(CpuAffinity, parse_clusters)
+{
+  ASSERT_EQ(CpuAffinity::parse("big", big_little).cores(), big_little.big);
+  ASSERT_EQ(CpuAffinity::parse("little", big_little).cores(), big_little.little);
+
+  const auto affinity = CpuAffinity::parse("auto", big_little);
+  ASSERT_EQ(affinity.cores(), big_little.big);
+  ASSERT_TRUE(affinity.isAuto());
+
+  // Nothing to choose from
+  ASSERT_TRUE(CpuAffinity::parse("auto", uniform).cores().empty());
+  ASSERT_FALSE(CpuAffinity::parse("auto", uniform).isAuto());
+}
+
+TEST(CpuAffinity, neg_parse)
+{
+  ASSERT_THROW(CpuAffinity::parse("fast", big_little), std::runtime_error);
+  ASSERT_THROW(CpuAffinity::parse("3-1", big_little), std::runtime_error);
+  ASSERT_THROW(CpuAffinity::parse("1,,2", big_little), std::runtime_error);
+  ASSERT_THROW(CpuAffinity::parse("1:2", big_little), std::runtime_error);
+}
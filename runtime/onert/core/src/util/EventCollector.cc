@@ -26,11 +26,10 @@
 namespace
 {
 
-std::string timestamp(void)
+uint64_t timestamp(void)
 {
   auto now = std::chrono::steady_clock::now();
-  return std::to_string(
-    std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count());
+  return std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
 }
 
 class DurationEventBuilder : public EventCollector::EventVisitor
@@ -78,12 +77,15 @@ public:
     dur_evt->backend = evt_collected.backend;
     dur_evt->op_index = evt_collected.op_index;
     dur_evt->op_name = evt_collected.op_name;
+    dur_evt->counters = evt_collected.counters;
 
     dur_evt->args = evt_collected.userData;
     {
       dur_evt->args.emplace_back("session", std::to_string(evt_collected.session_index));
       dur_evt->args.emplace_back("subgraph", std::to_string(evt_collected.subg_index));
     }
+    for (const auto &counter : evt_collected.counters)
+      dur_evt->args.emplace_back(counter.first, std::to_string(counter.second));
 
     return dur_evt;
   }
@@ -126,7 +128,12 @@ inline void emit_rusage(EventRecorder *rec, const std::string &ts)
 
 template <typename EventT> void EventCollector::onEvent(const EventT &event)
 {
-  auto ts = timestamp();
+  onEvent(event, timestamp());
+}
+
+template <typename EventT> void EventCollector::onEvent(const EventT &event, uint64_t ts_us)
+{
+  auto ts = std::to_string(ts_us);
 
   DurationEventBuilder builder(ts);
 
@@ -156,3 +163,7 @@ template <typename EventT> void EventCollector::onEvent(const EventT &event)
 // template instantiation
 template void EventCollector::onEvent<EventCollector::SubgEvent>(const SubgEvent &event);
 template void EventCollector::onEvent<EventCollector::OpSeqEvent>(const OpSeqEvent &event);
+template void EventCollector::onEvent<EventCollector::SubgEvent>(const SubgEvent &event,
+                                                                 uint64_t ts_us);
+template void EventCollector::onEvent<EventCollector::OpSeqEvent>(const OpSeqEvent &event,
+                                                                  uint64_t ts_us);
@@ -88,6 +88,8 @@ public:
     std::string backend;
     uint32_t op_index;
     std::string op_name;
+    // Hardware counters of the operation on end edge: pairs of (name, value)
+    std::vector<std::pair<std::string, uint64_t>> counters;
 
     OpSeqEvent(const onert::util::TracingCtx *a_tracing_ctx, Edge a_edge, uint32_t a_subg_index,
                const std::string a_backend, uint32_t a_op_index, const std::string a_op_name)
@@ -107,6 +109,10 @@ public:
 
 public:
   template <typename EventT> void onEvent(const EventT &event);
+  /**
+   * @brief Record an event which happened at the given time, e.g. converted from a @c TraceRecord
+   */
+  template <typename EventT> void onEvent(const EventT &event, uint64_t ts_us);
 
 protected:
   EventRecorder *_rec;
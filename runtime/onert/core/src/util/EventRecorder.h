@@ -57,6 +57,8 @@ struct OpSeqDurationEvent : public DurationEvent
   std::string backend;
   uint32_t op_index;
   std::string op_name;
+  // Hardware counters of the operation, which only end events have: pairs of (name, value)
+  std::vector<std::pair<std::string, uint64_t>> counters;
 };
 
 struct CounterEvent : public Event
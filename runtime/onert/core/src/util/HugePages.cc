@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/HugePages.h"
+
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+constexpr size_t kDefaultHugePageSize = 2 * 1024 * 1024;
+
+struct Counters
+{
+  std::atomic<uint64_t> hugetlb_buffers{0};
+  std::atomic<uint64_t> hugetlb_bytes{0};
+  std::atomic<uint64_t> thp_buffers{0};
+  std::atomic<uint64_t> thp_bytes{0};
+  std::atomic<uint64_t> small_buffers{0};
+  std::atomic<uint64_t> small_bytes{0};
+};
+
+Counters &counters()
+{
+  static Counters counters;
+  return counters;
+}
+
+size_t roundUp(size_t size, size_t align) { return (size + align - 1) / align * align; }
+
+#ifdef __linux__
+
+/**
+ * @brief Bytes of transparent huge pages in [begin, end) from /proc/self/smaps
+ */
+uint64_t anonHugePageBytes(uintptr_t begin, uintptr_t end)
+{
+  std::ifstream smaps{"/proc/self/smaps"};
+  uint64_t bytes = 0;
+  bool in_range = false;
+  std::string line;
+  while (std::getline(smaps, line))
+  {
+    uintptr_t vma_begin = 0, vma_end = 0;
+    char dash = 0;
+    std::istringstream iss{line};
+    if (iss >> std::hex >> vma_begin >> dash >> vma_end && dash == '-')
+    {
+      in_range = vma_begin < end && begin < vma_end;
+      continue;
+    }
+
+    uint64_t kb = 0;
+    if (in_range && line.compare(0, 14, "AnonHugePages:") == 0 &&
+        std::istringstream{line.substr(14)} >> kb)
+      bytes += kb * 1024;
+  }
+  return bytes;
+}
+
+/**
+ * @brief Map size bytes aligned to align, by trimming an anonymous mapping of align more bytes
+ */
+uint8_t *mapAligned(size_t size, size_t align)
+{
+  const size_t length = size + align;
+  void *mapped = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED)
+    return nullptr;
+
+  const auto base = reinterpret_cast<uintptr_t>(mapped);
+  const auto aligned = roundUp(base, align);
+  if (aligned > base)
+    munmap(mapped, aligned - base);
+  if (base + length > aligned + size)
+    munmap(reinterpret_cast<void *>(aligned + size), base + length - aligned - size);
+  return reinterpret_cast<uint8_t *>(aligned);
+}
+
+#endif // __linux__
+
+} // namespace
+
+HugePageMode parseHugePageMode(const std::string &value)
+{
+  if (value.empty() || value == "0" || value == "none")
+    return HugePageMode::NONE;
+  if (value == "thp" || value == "1")
+    return HugePageMode::THP;
+  if (value == "hugetlb")
+    return HugePageMode::HUGETLB;
+  throw std::runtime_error("Invalid HUGE_PAGES: " + value);
+}
+
+HugePageMode hugePageMode()
+{
+  static const HugePageMode mode = parseHugePageMode(getConfigString(config::HUGE_PAGES));
+  return mode;
+}
+
+size_t hugePageSize()
+{
+  static const size_t size = []() {
+    std::ifstream meminfo{"/proc/meminfo"};
+    std::string line;
+    while (std::getline(meminfo, line))
+    {
+      uint64_t kb = 0;
+      if (line.compare(0, 13, "Hugepagesize:") == 0 && std::istringstream{line.substr(13)} >> kb &&
+          kb > 0)
+        return static_cast<size_t>(kb * 1024);
+    }
+    return kDefaultHugePageSize;
+  }();
+  return size;
+}
+
+void PageDeleter::operator()(uint8_t *ptr) const
+{
+  if (ptr == nullptr)
+    return;
+
+  if (mapped_size == 0)
+  {
+    delete[] ptr;
+    return;
+  }
+
+#ifdef __linux__
+  // Transparent huge pages are given as the pages are touched, so they are reported at the end
+  if (!hugetlb)
+  {
+    WHEN_LOG_ENABLED({
+      const auto begin = reinterpret_cast<uintptr_t>(ptr);
+      VERBOSE(HugePages) << (what ? what : "buffer") << " " << static_cast<void *>(ptr)
+                         << " had " << anonHugePageBytes(begin, begin + mapped_size)
+                         << " bytes of transparent huge pages of " << mapped_size << std::endl;
+    });
+  }
+  munmap(ptr, mapped_size);
+#endif
+}
+
+HugePageStats hugePageStats()
+{
+  const auto &c = counters();
+  HugePageStats stats;
+  stats.hugetlb_buffers = c.hugetlb_buffers;
+  stats.hugetlb_bytes = c.hugetlb_bytes;
+  stats.thp_buffers = c.thp_buffers;
+  stats.thp_bytes = c.thp_bytes;
+  stats.small_buffers = c.small_buffers;
+  stats.small_bytes = c.small_bytes;
+  return stats;
+}
+
+PageMemory allocatePages(size_t size, HugePageMode mode, const char *what, bool zero)
+{
+  auto &c = counters();
+
+#ifdef __linux__
+  const size_t huge_page = hugePageSize();
+  if (mode != HugePageMode::NONE && size >= huge_page)
+  {
+    const size_t mapped_size = roundUp(size, huge_page);
+
+#ifdef MAP_HUGETLB
+    if (mode == HugePageMode::HUGETLB)
+    {
+      void *mapped = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (mapped != MAP_FAILED)
+      {
+        c.hugetlb_buffers++;
+        c.hugetlb_bytes += mapped_size;
+        VERBOSE(HugePages) << what << " " << mapped << ": " << mapped_size
+                           << " bytes of hugetlb pages" << std::endl;
+        // munmap of hugetlb pages needs the length of huge pages, which is mapped_size
+        return PageMemory{static_cast<uint8_t *>(mapped), PageDeleter{mapped_size, what, true}};
+      }
+      VERBOSE(HugePages) << what << ": no hugetlb pages for " << mapped_size
+                         << " bytes, falling back to transparent huge pages" << std::endl;
+    }
+#endif // MAP_HUGETLB
+
+#ifdef MADV_HUGEPAGE
+    auto ptr = mapAligned(mapped_size, huge_page);
+    if (ptr != nullptr)
+    {
+      if (madvise(ptr, mapped_size, MADV_HUGEPAGE) == 0)
+      {
+        c.thp_buffers++;
+        c.thp_bytes += mapped_size;
+        VERBOSE(HugePages) << what << " " << static_cast<void *>(ptr) << ": " << mapped_size
+                           << " bytes madvise'd for transparent huge pages" << std::endl;
+      }
+      else
+      {
+        c.small_buffers++;
+        c.small_bytes += mapped_size;
+        VERBOSE(HugePages) << what << " " << static_cast<void *>(ptr) << ": madvise failed ("
+                           << std::strerror(errno) << "), " << mapped_size << " bytes of "
+                           << "small pages" << std::endl;
+      }
+      return PageMemory{ptr, PageDeleter{mapped_size, what}};
+    }
+#endif // MADV_HUGEPAGE
+  }
+#else
+  (void)mode;
+#endif // __linux__
+
+  c.small_buffers++;
+  c.small_bytes += size;
+  return PageMemory{zero ? new uint8_t[size]() : new uint8_t[size], PageDeleter{0, what}};
+}
+
+} // namespace util
+} // namespace onert
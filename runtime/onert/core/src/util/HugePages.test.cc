@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/HugePages.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace onert::util;
+
+namespace
+{
+
+bool allZeros(const uint8_t *ptr, size_t size)
+{
+  return std::all_of(ptr, ptr + size, [](uint8_t v) { return v == 0; });
+}
+
+} // namespace
+
+TEST(HugePages, parse)
+{
+  ASSERT_EQ(parseHugePageMode(""), HugePageMode::NONE);
+  ASSERT_EQ(parseHugePageMode("thp"), HugePageMode::THP);
+  ASSERT_EQ(parseHugePageMode("hugetlb"), HugePageMode::HUGETLB);
+}
+
+TEST(HugePages, neg_parse)
+{
+  ASSERT_THROW(parseHugePageMode("2M"), std::runtime_error);
+  ASSERT_THROW(parseHugePageMode("THP"), std::runtime_error);
+}
+
+TEST(HugePages, small_buffer)
+{
+  const auto before = hugePageStats();
+  auto memory = allocatePages(100, HugePageMode::THP, "test");
+  ASSERT_NE(memory.get(), nullptr);
+  ASSERT_TRUE(allZeros(memory.get(), 100));
+
+  // Smaller than a huge page, memory of huge pages would be wasted
+  const auto after = hugePageStats();
+  ASSERT_EQ(after.small_buffers, before.small_buffers + 1);
+  ASSERT_EQ(after.thp_buffers + after.hugetlb_buffers,
+            before.thp_buffers + before.hugetlb_buffers);
+}
+
+TEST(HugePages, large_buffer)
+{
+  const size_t size = hugePageSize() * 2 + 1;
+  for (auto mode : {HugePageMode::NONE, HugePageMode::THP, HugePageMode::HUGETLB})
+  {
+    auto memory = allocatePages(size, mode, "test");
+    ASSERT_NE(memory.get(), nullptr);
+    ASSERT_TRUE(allZeros(memory.get(), size));
+    std::fill(memory.get(), memory.get() + size, 1);
+
+    if (mode != HugePageMode::NONE && memory.get_deleter().mapped_size > 0)
+    {
+      // Mapped memory of whole huge pages
+      ASSERT_EQ(reinterpret_cast<uintptr_t>(memory.get()) % hugePageSize(), 0);
+      ASSERT_EQ(memory.get_deleter().mapped_size, hugePageSize() * 3);
+    }
+  }
+}
+
+TEST(HugePages, not_zeroed)
+{
+  auto memory = allocatePages(64, HugePageMode::NONE, "test", false);
+  ASSERT_NE(memory.get(), nullptr);
+  std::fill(memory.get(), memory.get() + 64, 1);
+}
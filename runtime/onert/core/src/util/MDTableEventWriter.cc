@@ -91,6 +91,8 @@ struct Operation : public MDContent
 {
   std::string backend;
   uint64_t graph_latency;
+  // Hardware counters of the operation: pairs of (name, value)
+  std::vector<std::pair<std::string, uint64_t>> counters;
 
   struct OperationCmp
   {
@@ -109,9 +111,36 @@ struct Operation : public MDContent
   {
     uint64_t op_latency = end_ts - begin_ts;
     double op_per = static_cast<double>(op_latency) / graph_latency * 100.0;
-    writeMDTableRow(os, {name, backend, std::to_string(op_latency), std::to_string(op_per),
-                         std::to_string(min_rss), std::to_string(max_rss),
-                         std::to_string(min_page_reclaims), std::to_string(max_page_reclaims)});
+    std::vector<std::string> row{name,         backend, std::to_string(op_latency),
+                                 std::to_string(op_per),    std::to_string(min_rss),
+                                 std::to_string(max_rss),   std::to_string(min_page_reclaims),
+                                 std::to_string(max_page_reclaims)};
+    for (const auto &counter : counters)
+      row.emplace_back(std::to_string(counter.second));
+    if (!counters.empty())
+      row.emplace_back(ipc());
+    writeMDTableRow(os, row);
+  }
+
+  // Instructions per cycle, which is low for memory-bound operations
+  std::string ipc() const
+  {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    for (const auto &counter : counters)
+    {
+      if (counter.first == "cycles")
+        cycles = counter.second;
+      else if (counter.first == "instructions")
+        instructions = counter.second;
+    }
+    if (cycles == 0 || instructions == 0)
+      return "-";
+
+    std::ostringstream ss;
+    ss.precision(2);
+    ss << std::fixed << static_cast<double>(instructions) / cycles;
+    return ss.str();
   }
 };
 
@@ -157,14 +186,26 @@ struct Graph : public MDContent
 
     os << "\n";
 
-    static std::vector<std::string> op_headers{
+    std::vector<std::string> op_headers{
       "Op name",     "backend",     "latency(us)",       "latency(%)",
       "rss_min(kb)", "rss_max(kb)", "page_reclaims_min", "page_reclaims_max"};
 
-    static std::vector<std::string> op_headers_line{
+    std::vector<std::string> op_headers_line{
       "-------", "-------", "-----------",       "-----------",
       "-------", "-------", "-----------------", "-----------------"};
 
+    // Operations have the same counters if any
+    if (!ops.empty() && !ops.begin()->counters.empty())
+    {
+      for (const auto &counter : ops.begin()->counters)
+      {
+        op_headers.emplace_back(counter.first);
+        op_headers_line.emplace_back(std::string(counter.first.size(), '-'));
+      }
+      op_headers.emplace_back("ipc");
+      op_headers_line.emplace_back("---");
+    }
+
     os << "## Op \n";
 
     // Operation's Header
@@ -250,6 +291,7 @@ struct MDTableBuilder
           assert(name_to_op.find(evt_name) != name_to_op.end());
           auto &op = name_to_op.at(evt_name);
           updateOperation(op, *evt);
+          op.counters = evt->counters;
         }
       }
 
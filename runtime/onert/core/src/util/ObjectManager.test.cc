@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace onert;
 
 struct TestTag;
@@ -209,3 +211,46 @@ TEST(ObjectManager, neg_getRawPtr)
   auto ptr = man.getRawPtr(Index{1});
   ASSERT_EQ(ptr, nullptr);
 }
+
+TEST(ObjectManager, push_far_index)
+{
+  util::ObjectManager<Index, int> man;
+
+  auto far_index = man.push(std::make_unique<int>(100), Index{1000});
+  ASSERT_EQ(man.at(far_index), 100);
+
+  // Indices below the far one fill the slots up to it
+  auto index = man.push(std::make_unique<int>(0), Index{0});
+  for (uint32_t i = 1; i < 1000; ++i)
+    man.push(std::make_unique<int>(i), Index{i});
+  ASSERT_EQ(man.size(), 1001);
+  ASSERT_EQ(man.at(index), 0);
+  ASSERT_EQ(man.at(far_index), 100);
+
+  man.remove(far_index);
+  ASSERT_FALSE(man.exist(far_index));
+  ASSERT_EQ(man.size(), 1000);
+}
+
+TEST(ObjectManager, iterate_in_order)
+{
+  util::ObjectManager<Index, int> man;
+
+  man.push(std::make_unique<int>(300), Index{3});
+  man.push(std::make_unique<int>(100), Index{1});
+  man.push(std::make_unique<int>(200), Index{2});
+
+  std::vector<uint32_t> indices;
+  man.iterate([&](const Index &index, const int &) { indices.push_back(index.value()); });
+  ASSERT_EQ(indices, (std::vector<uint32_t>{1, 2, 3}));
+}
+
+TEST(ObjectManager, neg_at)
+{
+  util::ObjectManager<Index, int> man;
+
+  auto index = man.emplace(100);
+  man.remove(index);
+  ASSERT_THROW(man.at(index), std::out_of_range);
+  ASSERT_THROW(man.at(Index{12345}), std::out_of_range);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PerfCounters.h"
+
+#include <cstring>
+#include <memory>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+#ifdef __linux__
+struct EventConfig
+{
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr uint64_t cacheConfig(uint64_t cache, uint64_t op, uint64_t result)
+{
+  return cache | (op << 8) | (result << 16);
+}
+
+// Indexed by PerfCounters::Counter
+const EventConfig event_configs[PerfCounters::COUNT] = {
+  {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+  {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+  {PERF_TYPE_HW_CACHE, cacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                                   PERF_COUNT_HW_CACHE_RESULT_MISS)},
+  {PERF_TYPE_HW_CACHE, cacheConfig(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ,
+                                   PERF_COUNT_HW_CACHE_RESULT_MISS)},
+  {PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND},
+  {PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND},
+};
+
+int openEvent(const EventConfig &event, int group_fd)
+{
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = event.type;
+  attr.config = event.config;
+  attr.disabled = group_fd < 0 ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+
+  // Count the calling thread on any CPU
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+#endif
+
+} // namespace
+
+PerfCounters &PerfCounters::thisThread()
+{
+  thread_local std::unique_ptr<PerfCounters> counters{new PerfCounters};
+  return *counters;
+}
+
+const char *PerfCounters::name(Counter counter)
+{
+  switch (counter)
+  {
+    case CYCLES:
+      return "cycles";
+    case INSTRUCTIONS:
+      return "instructions";
+    case L1D_READ_MISSES:
+      return "l1d_read_misses";
+    case LLC_READ_MISSES:
+      return "llc_read_misses";
+    case STALLED_CYCLES_FRONTEND:
+      return "stalled_cycles_frontend";
+    case STALLED_CYCLES_BACKEND:
+      return "stalled_cycles_backend";
+    default:
+      return "unknown";
+  }
+}
+
+PerfCounters::PerfCounters()
+{
+  _fds.fill(-1);
+  _slots.fill(-1);
+
+#ifdef __linux__
+  // Counters are read at once as a group, whose leader is the first counter opened
+  for (int counter = 0; counter < COUNT; ++counter)
+  {
+    const int fd = openEvent(event_configs[counter], _leader_fd);
+    if (fd < 0)
+      continue;
+
+    if (_leader_fd < 0)
+      _leader_fd = fd;
+    _fds[counter] = fd;
+    _slots[counter] = static_cast<int>(_opened++);
+  }
+
+  if (_leader_fd >= 0)
+  {
+    ioctl(_leader_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+  for (auto fd : _fds)
+  {
+    if (fd >= 0)
+      close(fd);
+  }
+#endif
+}
+
+PerfCounters::Values PerfCounters::read() const
+{
+  Values values;
+  values.fill(0);
+
+#ifdef __linux__
+  if (_leader_fd < 0)
+    return values;
+
+  // The number of values, followed by the values in the order the counters joined the group
+  uint64_t buffer[COUNT + 1];
+  const auto size = static_cast<ssize_t>(sizeof(uint64_t) * (_opened + 1));
+  if (::read(_leader_fd, buffer, size) != size)
+    return values;
+
+  for (int counter = 0; counter < COUNT; ++counter)
+  {
+    if (_slots[counter] >= 0)
+      values[counter] = buffer[_slots[counter] + 1];
+  }
+#endif
+  return values;
+}
+
+} // namespace util
+} // namespace onert
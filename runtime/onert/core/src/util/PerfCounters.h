@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_PERF_COUNTERS_H__
+#define __ONERT_UTIL_PERF_COUNTERS_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Hardware performance counters of the calling thread, read through perf_event_open(2)
+ *
+ * Counters which the kernel or the CPU does not support are not opened, and read as zero. Every
+ * counter is unavailable when perf events are not permitted, e.g. by perf_event_paranoid.
+ */
+class PerfCounters
+{
+public:
+  enum Counter
+  {
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_READ_MISSES,
+    LLC_READ_MISSES,
+    STALLED_CYCLES_FRONTEND,
+    STALLED_CYCLES_BACKEND,
+    COUNT
+  };
+
+  using Values = std::array<uint64_t, COUNT>;
+
+public:
+  /**
+   * @brief Get the counters of the calling thread, which are opened on the first call
+   */
+  static PerfCounters &thisThread();
+
+  /**
+   * @brief Get the name of a counter, which traces use as the key of its value
+   */
+  static const char *name(Counter counter);
+
+public:
+  ~PerfCounters();
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+public:
+  /**
+   * @brief Read the values counted by this thread so far
+   */
+  Values read() const;
+
+  bool available(Counter counter) const { return _slots[counter] >= 0; }
+
+private:
+  PerfCounters();
+
+private:
+  int _leader_fd = -1;
+  std::array<int, COUNT> _fds;
+  // Position of each counter in the values of the group, -1 if it is not opened
+  std::array<int, COUNT> _slots;
+  size_t _opened = 0;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_PERF_COUNTERS_H__
@@ -233,6 +233,27 @@ ir::Shape inferReduceShape(const ir::Shape &input_shape, const std::vector<int>
   }
 }
 
+ir::Shape inferAttentionShape(const ir::Shape &query_shape, const ir::Shape &key_shape,
+                              const ir::Shape &value_shape)
+{
+  const auto rank = query_shape.rank();
+  if (rank < 2 || key_shape.rank() != rank || value_shape.rank() != rank)
+    throw std::runtime_error{"Attention shape inference: query, key and value must have same rank"};
+
+  for (int i = 0; i < rank - 2; i++)
+  {
+    if (key_shape.dim(i) != query_shape.dim(i) || value_shape.dim(i) != query_shape.dim(i))
+      throw std::runtime_error{"Attention shape inference: batch dimensions must be same"};
+  }
+  if (key_shape.dim(rank - 1) != query_shape.dim(rank - 1) ||
+      value_shape.dim(rank - 2) != key_shape.dim(rank - 2))
+    throw std::runtime_error{"Attention shape inference: invalid key or value shape"};
+
+  ir::Shape output_shape(query_shape);
+  output_shape.dim(rank - 1) = value_shape.dim(rank - 1);
+  return output_shape;
+}
+
 ir::Shape inferBatchMatMulShape(const ir::Shape &lhs_shape, const ir::Shape &rhs_shape,
                                 const ir::operation::BatchMatMul::Param &param)
 {
@@ -903,6 +924,10 @@ template StridedSliceParams
 buildStridedSliceParams(const uint32_t *begin, const uint32_t *end, const uint32_t *strides,
                         const uint32_t begin_mask, const uint32_t end_mask,
                         const uint32_t shrink_axis_mask, const uint8_t rank);
+template StridedSliceParams
+buildStridedSliceParams(const int32_t *begin, const int32_t *end, const int32_t *strides,
+                        const uint32_t begin_mask, const uint32_t end_mask,
+                        const uint32_t shrink_axis_mask, const uint8_t rank);
 
 int Clamp(const int v, const int lo, const int hi)
 {
@@ -1070,6 +1095,24 @@ ir::Shape inferTileShape(const ir::Shape &in_shape, const int32_t *multiplier_bu
   return new_Shape;
 }
 
+ir::Shape inferTopKV2Shape(const ir::Shape &in_shape, int32_t k)
+{
+  const auto rank = in_shape.rank();
+  if (rank < 1)
+  {
+    throw std::runtime_error("inferTopKV2Shape failed, input must be of rank 1 or more");
+  }
+  if (k < 0 || k > in_shape.dim(rank - 1))
+  {
+    throw std::runtime_error("inferTopKV2Shape failed, bad k: " + std::to_string(k));
+  }
+
+  // Both values and indices
+  ir::Shape out_shape = in_shape;
+  out_shape.dim(rank - 1) = k;
+  return out_shape;
+}
+
 ir::Shape inferTransposeShape(const ir::Shape &in_shape, const int32_t *perm_buf,
                               const int32_t perm_size)
 {
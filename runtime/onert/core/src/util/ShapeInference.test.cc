@@ -416,6 +416,25 @@ TEST(ShapeInference, neg_Transpose)
   }
 }
 
+TEST(ShapeInference, TopKV2)
+{
+  Shape in_shape{2, 3, 32000};
+  auto infered_out_shape = onert::shape_inference::inferTopKV2Shape(in_shape, 5);
+
+  ASSERT_EQ(infered_out_shape.rank(), 3);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 3);
+  ASSERT_EQ(infered_out_shape.dim(2), 5);
+}
+
+TEST(ShapeInference, neg_TopKV2)
+{
+  Shape in_shape{2, 10};
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(in_shape, 11), std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(in_shape, -1), std::runtime_error);
+  ASSERT_THROW(onert::shape_inference::inferTopKV2Shape(Shape{}, 1), std::runtime_error);
+}
+
 TEST(ShapeInference, Gather)
 {
   auto check = [&](Shape &input, Shape &indices, Shape &expected, int32_t axis) {
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceBuffer.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace util
+{
+
+namespace
+{
+
+size_t roundUpToPowerOfTwo(size_t value)
+{
+  size_t result = 1;
+  while (result < value)
+    result <<= 1;
+  return result;
+}
+
+uint64_t nextRecorderId()
+{
+  static std::atomic<uint64_t> next_id{1};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Buffers of the recorders that a thread recorded into lately, as nested executors of control
+// flow have their own recorders
+struct CachedBuffer
+{
+  uint64_t recorder_id = 0;
+  TraceBuffer *buffer = nullptr;
+};
+
+constexpr size_t CACHED_BUFFERS = 4;
+thread_local CachedBuffer cached_buffers[CACHED_BUFFERS];
+thread_local size_t next_cached_buffer = 0;
+
+} // namespace
+
+TraceBuffer::TraceBuffer(size_t capacity)
+  : _records(roundUpToPowerOfTwo(std::max<size_t>(capacity, 1))), _mask{_records.size() - 1}
+{
+}
+
+std::vector<TraceRecord> TraceBuffer::records() const
+{
+  const auto head = _head.load(std::memory_order_acquire);
+  const auto count = std::min<uint64_t>(head, _records.size());
+
+  std::vector<TraceRecord> records;
+  records.reserve(count);
+  for (auto i = head - count; i < head; ++i)
+    records.push_back(_records[i & _mask]);
+  return records;
+}
+
+uint64_t TraceBuffer::dropped() const
+{
+  const auto head = _head.load(std::memory_order_acquire);
+  return head > _records.size() ? head - _records.size() : 0;
+}
+
+TraceRecorder::TraceRecorder(size_t capacity) : _id{nextRecorderId()}, _capacity{capacity} {}
+
+std::vector<const TraceBuffer *> TraceRecorder::buffers() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  std::vector<const TraceBuffer *> buffers;
+  for (const auto &pair : _buffers)
+    buffers.push_back(pair.second.get());
+  return buffers;
+}
+
+TraceBuffer &TraceRecorder::localBuffer()
+{
+  for (const auto &cached : cached_buffers)
+  {
+    if (cached.recorder_id == _id)
+      return *cached.buffer;
+  }
+  return registerThread();
+}
+
+TraceBuffer &TraceRecorder::registerThread()
+{
+  TraceBuffer *buffer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+
+    // A thread evicted from the cache keeps recording into the buffer it had
+    auto &slot = _buffers[std::this_thread::get_id()];
+    if (!slot)
+      slot = std::make_unique<TraceBuffer>(_capacity);
+    buffer = slot.get();
+  }
+
+  auto &cached = cached_buffers[next_cached_buffer];
+  next_cached_buffer = (next_cached_buffer + 1) % CACHED_BUFFERS;
+  cached.recorder_id = _id;
+  cached.buffer = buffer;
+  return *buffer;
+}
+
+} // namespace util
+} // namespace onert
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TRACE_BUFFER_H__
+#define __ONERT_UTIL_TRACE_BUFFER_H__
+
+#include "PerfCounters.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Fixed-size binary record of a tracing event
+ *
+ * Records hold no strings so that recording one is a plain copy. Names, backends and shapes are
+ * resolved when records are converted into @c Event of @c EventRecorder.
+ */
+struct TraceRecord
+{
+  static constexpr uint32_t NO_OPERATION = UINT32_MAX;
+
+  uint64_t ts_ns;      // Timestamp from now()
+  const void *backend; // Backend of the operation, nullptr for subgraph events
+  uint32_t subg_index;
+  uint32_t op_index; // NO_OPERATION for subgraph events
+  bool begin;        // true on begin edge, false on end edge
+  // Hardware counters of the recording thread, all zero unless counters are traced
+  PerfCounters::Values counters;
+
+  /**
+   * @brief Timestamp in nanoseconds from the monotonic clock, which is read from vDSO
+   */
+  static uint64_t now()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+  }
+};
+
+/**
+ * @brief Ring buffer of records that a single thread writes without a lock
+ *
+ * When the ring is full, new records overwrite the oldest ones, so memory for tracing is bounded
+ * however long tracing is on.
+ */
+class TraceBuffer
+{
+public:
+  /**
+   * @param capacity Number of records to keep, rounded up to a power of two
+   */
+  explicit TraceBuffer(size_t capacity);
+
+public:
+  /**
+   * @brief Append a record, which only the owner thread may call
+   */
+  void push(const TraceRecord &record)
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+    _records[head & _mask] = record;
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Get records kept in the order they were pushed
+   * @note  The owner thread must not push while this is called
+   */
+  std::vector<TraceRecord> records() const;
+
+  /**
+   * @brief Get the number of records overwritten since the ring was full
+   */
+  uint64_t dropped() const;
+
+  size_t capacity() const { return _records.size(); }
+
+private:
+  std::vector<TraceRecord> _records;
+  size_t _mask;
+  std::atomic<uint64_t> _head{0};
+};
+
+/**
+ * @brief Recorder of tracing events into a @c TraceBuffer per thread
+ *
+ * A thread takes a lock only when it records into this recorder for the first time. Then it finds
+ * its buffer from a thread-local cache.
+ */
+class TraceRecorder
+{
+public:
+  /**
+   * @param capacity Number of records each thread keeps
+   */
+  explicit TraceRecorder(size_t capacity);
+
+public:
+  void record(const TraceRecord &record) { localBuffer().push(record); }
+
+  /**
+   * @brief Get the buffers of threads which recorded
+   * @note  Threads must not record while this is called
+   */
+  std::vector<const TraceBuffer *> buffers() const;
+
+private:
+  TraceBuffer &localBuffer();
+  TraceBuffer &registerThread();
+
+private:
+  // Identifies this recorder in thread-local caches, which outlive recorders at the same address
+  const uint64_t _id;
+  const size_t _capacity;
+  mutable std::mutex _mutex;
+  std::unordered_map<std::thread::id, std::unique_ptr<TraceBuffer>> _buffers;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TRACE_BUFFER_H__
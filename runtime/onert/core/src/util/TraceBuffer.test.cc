@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceBuffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace onert::util;
+
+namespace
+{
+
+TraceRecord makeRecord(uint32_t op_index) { return {op_index, nullptr, 0, op_index, true, {}}; }
+
+} // namespace
+
+TEST(TraceBuffer, records)
+{
+  TraceBuffer buffer{3};
+  ASSERT_EQ(buffer.capacity(), 4);
+
+  for (uint32_t i = 0; i < 3; ++i)
+    buffer.push(makeRecord(i));
+
+  const auto records = buffer.records();
+  ASSERT_EQ(records.size(), 3);
+  for (uint32_t i = 0; i < 3; ++i)
+    ASSERT_EQ(records[i].op_index, i);
+  ASSERT_EQ(buffer.dropped(), 0);
+}
+
+TEST(TraceBuffer, overwrite_oldest)
+{
+  TraceBuffer buffer{4};
+  for (uint32_t i = 0; i < 10; ++i)
+    buffer.push(makeRecord(i));
+
+  const auto records = buffer.records();
+  ASSERT_EQ(records.size(), 4);
+  for (uint32_t i = 0; i < 4; ++i)
+    ASSERT_EQ(records[i].op_index, i + 6);
+  ASSERT_EQ(buffer.dropped(), 6);
+}
+
+TEST(TraceRecorder, buffer_per_thread)
+{
+  TraceRecorder recorder{16};
+  auto record = [&](uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i)
+      recorder.record(makeRecord(i));
+  };
+
+  record(2);
+  std::thread thread{record, 5};
+  thread.join();
+  record(1);
+
+  size_t total = 0;
+  const auto buffers = recorder.buffers();
+  ASSERT_EQ(buffers.size(), 2);
+  for (const auto buffer : buffers)
+  {
+    const auto records = buffer->records();
+    ASSERT_TRUE(records.size() == 3 || records.size() == 5);
+    total += records.size();
+  }
+  ASSERT_EQ(total, 8);
+
+  // Another recorder does not share buffers with the former
+  TraceRecorder other{16};
+  other.record(makeRecord(0));
+  ASSERT_EQ(other.buffers().size(), 1);
+  ASSERT_EQ(other.buffers()[0]->records().size(), 1);
+}
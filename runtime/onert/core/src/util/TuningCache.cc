@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/TuningCache.h"
+
+#include "util/AtomicFile.h"
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+
+namespace onert
+{
+namespace util
+{
+
+TuningCache *TuningCache::get(const char *config_key)
+{
+  // A cache of each config is created at its first use, and lives through the process
+  static std::mutex mutex;
+  static std::map<std::string, std::unique_ptr<TuningCache>> caches;
+
+  std::lock_guard<std::mutex> lock{mutex};
+  auto it = caches.find(config_key);
+  if (it == caches.end())
+  {
+    const auto path = getConfigString(config_key);
+    it = caches.emplace(config_key, path.empty() ? nullptr : std::make_unique<TuningCache>(path))
+           .first;
+  }
+  return it->second.get();
+}
+
+TuningCache::TuningCache(const std::string &path) : _path{path} { read(); }
+
+void TuningCache::read()
+{
+  std::ifstream stream(_path);
+  std::string key, value;
+  while (stream >> key >> value)
+    _values[key] = value;
+}
+
+std::string TuningCache::lookup(const std::string &key) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto it = _values.find(key);
+  return it == _values.end() ? std::string{} : it->second;
+}
+
+void TuningCache::store(const std::string &key, const std::string &value)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  // Choices other processes have stored since are read again, not to be dropped by the rewrite
+  read();
+  _values[key] = value;
+
+  std::ostringstream stream;
+  for (const auto &pair : _values)
+    stream << pair.first << " " << pair.second << "\n";
+  if (!writeFileAtomically(_path, stream.str()))
+    VERBOSE(TuningCache) << "Failed to write " << _path << std::endl;
+}
+
+} // namespace util
+} // namespace onert
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/TuningCache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+
+using namespace onert;
+
+namespace
+{
+
+class TuningCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/tuning_cache_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    _dir = dir;
+  }
+  void TearDown() override { std::system(("rm -rf " + _dir).c_str()); }
+
+  std::string _dir;
+};
+
+} // namespace
+
+TEST_F(TuningCacheTest, store_and_lookup)
+{
+  const auto path = _dir + "/cache.txt";
+  util::TuningCache cache{path};
+  ASSERT_TRUE(cache.lookup("conv").empty());
+
+  cache.store("conv", "direct");
+  cache.store("fc", "ruy");
+  ASSERT_EQ(cache.lookup("conv"), "direct");
+
+  // Another cache reads the file, and the latest choice wins
+  cache.store("conv", "winograd");
+  util::TuningCache other{path};
+  ASSERT_EQ(other.lookup("conv"), "winograd");
+  ASSERT_EQ(other.lookup("fc"), "ruy");
+}
+
+TEST_F(TuningCacheTest, neg_lookup_unknown)
+{
+  util::TuningCache cache{_dir + "/cache.txt"};
+  cache.store("conv", "direct");
+  ASSERT_TRUE(cache.lookup("fc").empty());
+}
+
+TEST_F(TuningCacheTest, neg_store_unwritable)
+{
+  // Choices are still kept in memory
+  util::TuningCache cache{_dir + "/no_dir/cache.txt"};
+  cache.store("conv", "direct");
+  ASSERT_EQ(cache.lookup("conv"), "direct");
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/WeightStore.h"
+
+#include "util/AtomicFile.h"
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace onert
+{
+namespace util
+{
+
+WeightStore *WeightStore::get(const char *config_key)
+{
+  // A store of each config is created at its first use, and lives through the process
+  static std::mutex mutex;
+  static std::map<std::string, std::unique_ptr<WeightStore>> stores;
+
+  std::lock_guard<std::mutex> lock{mutex};
+  auto it = stores.find(config_key);
+  if (it == stores.end())
+  {
+    const auto dir = getConfigString(config_key);
+    it = stores.emplace(config_key, dir.empty() ? nullptr : std::make_unique<WeightStore>(dir))
+           .first;
+  }
+  return it->second.get();
+}
+
+uint64_t WeightStore::key(const std::string &packing, const uint8_t *data, size_t size)
+{
+  // FNV-1a on 64-bit words, which is fast enough to hash weights of every session
+  constexpr uint64_t prime = 1099511628211ull;
+  uint64_t hash = 14695981039346656037ull;
+  auto add = [&](uint64_t word) {
+    hash ^= word;
+    hash *= prime;
+  };
+
+  for (const auto c : packing)
+    add(static_cast<uint8_t>(c));
+  add(size);
+
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+  {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    add(word);
+  }
+  for (; i < size; ++i)
+    add(data[i]);
+  return hash;
+}
+
+std::string WeightStore::path(uint64_t key) const
+{
+  std::stringstream path;
+  path << _dir << "/packed_" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+  return path.str();
+}
+
+std::shared_ptr<ir::Data> WeightStore::load(uint64_t key, size_t size) const
+{
+  const auto file = path(key);
+  const int fd = open(file.c_str(), O_RDONLY);
+  if (fd < 0)
+    return nullptr;
+
+  std::shared_ptr<ir::Data> data;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) == 0 && static_cast<size_t>(file_stat.st_size) == size && size > 0)
+  {
+    try
+    {
+      data = std::make_shared<ir::MMapedData>(fd, 0, size, 0, size);
+    }
+    catch (const std::runtime_error &)
+    {
+      data = nullptr;
+    }
+  }
+  // The mapping is kept after closing the file
+  close(fd);
+
+  if (!data)
+  {
+    VERBOSE(WeightStore) << "Ignore packed weights " << file << std::endl;
+    return nullptr;
+  }
+  return data;
+}
+
+std::shared_ptr<ir::Data> WeightStore::store(uint64_t key, const uint8_t *data,
+                                             size_t size) const
+{
+  const auto file = path(key);
+
+  // Other sessions may map the file at once, so it is never written in place
+  if (!util::writeFileAtomically(file, data, size))
+  {
+    VERBOSE(WeightStore) << "Failed to write packed weights " << file << std::endl;
+    return nullptr;
+  }
+
+  return load(key, size);
+}
+
+} // namespace util
+} // namespace onert
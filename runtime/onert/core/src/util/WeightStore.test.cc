@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/WeightStore.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace onert;
+
+namespace
+{
+
+class WeightStoreTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char dir[] = "/tmp/weight_store_test_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    _dir = dir;
+  }
+  void TearDown() override { std::system(("rm -rf " + _dir).c_str()); }
+
+  std::string _dir;
+};
+
+} // namespace
+
+TEST_F(WeightStoreTest, store_and_load)
+{
+  util::WeightStore store{_dir};
+  const std::vector<uint8_t> weights = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  const auto key = util::WeightStore::key("test", weights.data(), weights.size());
+
+  ASSERT_EQ(store.load(key, weights.size()), nullptr);
+  auto stored = store.store(key, weights.data(), weights.size());
+  ASSERT_NE(stored, nullptr);
+  ASSERT_EQ(stored->size(), weights.size());
+  ASSERT_EQ(std::memcmp(stored->base(), weights.data(), weights.size()), 0);
+
+  // Another store in the same directory maps the same file
+  util::WeightStore other{_dir};
+  auto loaded = other.load(key, weights.size());
+  ASSERT_NE(loaded, nullptr);
+  ASSERT_EQ(std::memcmp(loaded->base(), weights.data(), weights.size()), 0);
+}
+
+TEST_F(WeightStoreTest, key_by_packing)
+{
+  const std::vector<uint8_t> weights = {1, 2, 3, 4};
+  ASSERT_NE(util::WeightStore::key("a", weights.data(), weights.size()),
+            util::WeightStore::key("b", weights.data(), weights.size()));
+}
+
+TEST_F(WeightStoreTest, neg_load_other_size)
+{
+  util::WeightStore store{_dir};
+  const std::vector<uint8_t> weights = {1, 2, 3, 4};
+  const auto key = util::WeightStore::key("test", weights.data(), weights.size());
+  ASSERT_NE(store.store(key, weights.data(), weights.size()), nullptr);
+
+  ASSERT_EQ(store.load(key, weights.size() + 1), nullptr);
+}
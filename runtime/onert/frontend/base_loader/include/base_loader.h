@@ -21,17 +21,28 @@
 #include "ir/Graph.h"
 #include "ir/Shape.h"
 #include "ir/Operations.Include.h"
+#include "util/WeightStore.h"
+#include "stream_buffer.h"
 
 #include "flatbuffers/flexbuffers.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <fstream>
 #include <limits>
+#include <cstring>
+#include <thread>
+#include <unordered_set>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
 #include <unistd.h>
+#include <util/AtomicFile.h>
+#include <util/HeapPhase.h>
 #include <util/logging.h>
 
 namespace onert
@@ -72,6 +83,7 @@ public:
       _tensor_names(std::make_shared<std::unordered_map<ir::OperandIndex, std::string>>())
   {
     _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA);
+    _use_lazy_data = util::getConfigBool(util::config::LAZY_CONSTANTS);
   }
 
   /**
@@ -87,10 +99,34 @@ public:
    * @param size buffer size
    */
   void loadFromBuffer(uint8_t *buffer, size_t size);
+  /**
+   * @brief Load a model from a stream still arriving
+   *
+   * It returns once the structure of the model arrives. Constants stored out of the flatbuffer
+   * wait for their data when a backend accesses them.
+   *
+   * @param stream stream buffer
+   */
+  void loadFromStream(const std::shared_ptr<const StreamBuffer> &stream);
 
 protected:
   ~BaseLoader() = default;
   void loadModel();
+  // Find where the flatbuffer ends, before the data of buffers stored after it. Nothing is
+  // verified yet, so it reads only the ranges given to wait_for first.
+  template <typename WaitFn> size_t findStructureEnd(const WaitFn &wait_for);
+  // Name of the file with the data of buffers, given by the metadata of the model
+  std::string weightFileName();
+  void openWeightFile();
+  // Words of a metadata of the model, empty if the model does not have it
+  std::vector<uint32_t> metadataWords(const char *name);
+  // Set offsets of tensors and order of operations planned ahead, given by the metadata of the
+  // model, to the primary subgraph
+  void loadPlan(ir::Graph &subg);
+  // Signature of a model file, which changes if the file is modified or replaced
+  static std::string fileSignature(const struct stat &file_stat);
+  static std::string readSignature(const std::string &sidecar_path);
+  static void writeSignature(const std::string &sidecar_path, const std::string &signature);
 
   // Helper functions
   ir::Activation convertActivation(ActivationFunctionType type);
@@ -99,7 +135,12 @@ protected:
   flexbuffers::Map getCustomOpAttrMap(const Operator *op);
 
   // Create operands form tflite::Tensor
-  ir::OperandIndex loadOperand(const Tensor *tensor, ir::Graph &subg);
+  void loadOperands(const SubGraph *subg, ir::Graph &graph);
+  std::unique_ptr<ir::Operand> createOperand(const Tensor *tensor);
+  // Whether a buffer has data, in the flatbuffer or after it
+  static bool hasData(const Buffer *buffer);
+  std::shared_ptr<ir::Data> createData(const Buffer *buffer);
+  template <typename Fn> static void parallelFor(uint32_t size, const Fn &fn);
   void loadQuantization(const Tensor *tensor, ir::TypeInfo &typeInfo);
   void loadSparsity(const Tensor *tensor, ir::TypeInfo &typeInfo);
   void loadOperationIO(const Operator *op, ir::OperandIndexSequence &inputs,
@@ -169,6 +210,7 @@ private:
   void loadSplitV(const Operator *op, ir::Graph &subg);
   void loadSqueeze(const Operator *op, ir::Graph &subg);
   void loadStridedSlice(const Operator *op, ir::Graph &subg);
+  void loadTopKV2(const Operator *op, ir::Graph &subg);
   void loadTransposeConv(const Operator *op, ir::Graph &subg);
   void loadUnidirectionalSequenceLSTM(const Operator *op, ir::Graph &subg);
   void loadUnpack(const Operator *op, ir::Graph &subg);
@@ -189,6 +231,13 @@ protected:
   int32_t _pagesize;
   // loaded file description
   int _fd;
+  // Size of the model
+  size_t _size = 0;
+  // Directory of the model file, which a relative weight file name is from
+  std::string _model_dir;
+  // Weight file with the data of buffers out of the model, and its size
+  int _weight_fd = -1;
+  size_t _weight_size = 0;
   // Reference on loadable subgraphs
   std::unique_ptr<ir::Subgraphs> &_subgraphs;
   const Model *_model;
@@ -199,6 +248,15 @@ protected:
   std::unique_ptr<Verifier> _verifier;
   // Boolean flag to use MMAPED_DATA
   bool _use_mmaped_data = false;
+  // Boolean flag to skip verification of a model verified before
+  bool _skip_verification = false;
+  // Boolean flag set when the model is verified valid
+  bool _verified = false;
+  // Boolean flag to view constants in the mapping of the file, kept while they live
+  bool _use_lazy_data = false;
+  std::shared_ptr<const ir::MappedFile> _mapped_file;
+  // Stream of the model loaded while it arrives
+  std::shared_ptr<const StreamBuffer> _stream;
 
   std::unordered_map<uint32_t /* Buffer Index in circle file */, std::shared_ptr<ir::Data>>
     _buf_to_data;
@@ -218,7 +276,16 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
   {
     throw std::runtime_error("Fstat failed or file " + file_path + " is not a regular file");
   }
-  int size = file_stat.st_size;
+  const size_t size = file_stat.st_size;
+  _size = size;
+  const auto slash = file_path.find_last_of('/');
+  _model_dir = slash == std::string::npos ? "" : file_path.substr(0, slash + 1);
+
+  // A trusted model verified once is not verified again until the file changes
+  const bool trusted = util::getConfigBool(util::config::TRUSTED_MODEL);
+  const auto sidecar_path = file_path + ".verified";
+  const auto signature = fileSignature(file_stat);
+  _skip_verification = trusted && readSignature(sidecar_path) == signature;
 
   // Map model file into memory region
   _base = static_cast<uint8_t *>(mmap(NULL, size, PROT_READ, MAP_PRIVATE, _fd, 0));
@@ -228,19 +295,274 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
     throw std::runtime_error("mmap failed - " + std::string(strerror(errno)));
   }
 
-  _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), size);
+  const auto structure_end = findStructureEnd([&](size_t end) {
+    if (end > _size)
+      throw std::runtime_error{"Invalid offset in the model file " + file_path};
+  });
+  _verifier =
+    std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), structure_end);
 
-  loadModel();
-  munmap(_base, size);
+  if (_use_lazy_data)
+  {
+    // Constants keep the mapping alive, and the rest is unmapped with the last of them
+    _mapped_file = std::make_shared<ir::MappedFile>(_base, size);
+    loadModel();
+    _mapped_file.reset();
+  }
+  else
+  {
+    loadModel();
+    munmap(_base, size);
+  }
 
   close(_fd);
+
+  if (trusted && !_skip_verification && _verified)
+    writeSignature(sidecar_path, signature);
+}
+
+template <typename LoaderDomain>
+template <typename WaitFn>
+size_t BaseLoader<LoaderDomain>::findStructureEnd(const WaitFn &wait_for)
+{
+  const auto wait_for_range = [&](int64_t begin, int64_t end) {
+    if (begin < 0 || end < begin)
+      throw std::runtime_error{"Invalid offset in the model"};
+    wait_for(static_cast<size_t>(end));
+  };
+  const auto read32 = [&](int64_t pos) {
+    wait_for_range(pos, pos + 4);
+    int32_t value;
+    std::memcpy(&value, _base + pos, sizeof(value));
+    return value;
+  };
+  const auto read16 = [&](int64_t pos) {
+    wait_for_range(pos, pos + 2);
+    uint16_t value;
+    std::memcpy(&value, _base + pos, sizeof(value));
+    return value;
+  };
+  const auto offset_of = [&](const void *p) { return static_cast<const uint8_t *>(p) - _base; };
+  // Wait for a table with its vtable
+  const auto wait_for_table = [&](const void *table) {
+    const int64_t pos = offset_of(table);
+    const int64_t vtable = pos - read32(pos);
+    wait_for_range(vtable, vtable + read16(vtable));
+    wait_for_range(pos, pos + read16(vtable + 2));
+  };
+  // Wait for a vector of scalars or offsets, or a string with its terminator
+  const auto wait_for_vector = [&](const void *vector, int64_t element_size, int64_t extra) {
+    const int64_t pos = offset_of(vector);
+    const int64_t length = static_cast<uint32_t>(read32(pos));
+    wait_for_range(pos, pos + 4 + length * element_size + extra);
+  };
+
+  wait_for_table(_base + static_cast<uint32_t>(read32(0)));
+  const auto *model = LoaderDomain::GetModel(_base);
+
+  // Data in a weight file leaves the whole model to the flatbuffer
+  if (const auto *metadata = model->metadata())
+  {
+    wait_for_vector(metadata, 4, 0);
+    for (uint32_t i = 0; i < metadata->size(); ++i)
+    {
+      wait_for_table(metadata->Get(i));
+      const auto *name = metadata->Get(i)->name();
+      if (name == nullptr)
+        continue;
+      wait_for_vector(name, 1, 1);
+      if (name->str() == LoaderDomain::WEIGHT_FILE_METADATA)
+        return _size;
+    }
+  }
+
+  size_t structure_end = _size;
+  if (const auto *buffers = model->buffers())
+  {
+    wait_for_vector(buffers, 4, 0);
+    for (uint32_t i = 0; i < buffers->size(); ++i)
+    {
+      const auto *buffer = buffers->Get(i);
+      wait_for_table(buffer);
+      uint64_t offset, size;
+      if (LoaderDomain::getExternalBuffer(buffer, offset, size) && size > 0)
+        structure_end = std::min<size_t>(structure_end, offset);
+    }
+  }
+  return structure_end;
+}
+
+template <typename LoaderDomain> std::string BaseLoader<LoaderDomain>::weightFileName()
+{
+  const auto *metadata = _model->metadata();
+  if (metadata == nullptr)
+    return "";
+
+  for (const auto *entry : *metadata)
+  {
+    if (entry->name() == nullptr || entry->name()->str() != LoaderDomain::WEIGHT_FILE_METADATA)
+      continue;
+    const auto *data = _model->buffers()->Get(entry->buffer())->data();
+    if (data == nullptr || data->size() == 0)
+      throw std::runtime_error{"Empty weight file name in the model"};
+    // It may or may not be terminated by the null character
+    const auto *name = reinterpret_cast<const char *>(data->data());
+    return std::string(name, strnlen(name, data->size()));
+  }
+  return "";
+}
+
+template <typename LoaderDomain>
+std::vector<uint32_t> BaseLoader<LoaderDomain>::metadataWords(const char *name)
+{
+  const auto *metadata = _model->metadata();
+  if (metadata == nullptr)
+    return {};
+
+  for (const auto *entry : *metadata)
+  {
+    if (entry->name() == nullptr || entry->name()->str() != name)
+      continue;
+    const auto *data = _model->buffers()->Get(entry->buffer())->data();
+    if (data == nullptr || data->size() == 0 || data->size() % 4 != 0)
+      throw std::runtime_error{std::string{"Invalid "} + name + " in the model"};
+
+    // The words are little endian
+    std::vector<uint32_t> words(data->size() / 4);
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+      const auto *bytes = data->data() + i * 4;
+      words[i] = static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 |
+                 static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+    }
+    return words;
+  }
+  return {};
+}
+
+template <typename LoaderDomain> void BaseLoader<LoaderDomain>::loadPlan(ir::Graph &subg)
+{
+  // [ entry_number ][ tensor_id, offset ] * entry_number
+  const auto offsets = metadataWords(LoaderDomain::TENSOR_OFFSET_METADATA);
+  if (!offsets.empty())
+  {
+    if (offsets.size() != 1 + static_cast<size_t>(offsets[0]) * 2)
+      throw std::runtime_error{"Invalid size of tensor offset table"};
+    auto &operands = subg.operands();
+    for (size_t i = 1; i < offsets.size(); i += 2)
+    {
+      const auto tensor_id = offsets[i];
+      if (tensor_id >= _tensor_to_operand.size())
+        throw std::runtime_error{"Invalid tensor index in tensor offset table"};
+      const auto &ind = _tensor_to_operand[tensor_id];
+      if (operands.exist(ind))
+        operands.at(ind).info().plannedOffset(offsets[i + 1]);
+    }
+    VERBOSE(BaseLoader) << "Load " << offsets[0] << " planned tensor offsets" << std::endl;
+  }
+
+  // [ entry_number ][ operator_id ] * entry_number, in order of execution
+  const auto order = metadataWords(LoaderDomain::EXECUTION_ORDER_METADATA);
+  if (!order.empty())
+  {
+    if (order.size() != 1 + static_cast<size_t>(order[0]))
+      throw std::runtime_error{"Invalid size of execution order table"};
+    // Operator index is the operation index unless an operator is loaded as several operations
+    const auto num_operators = _model->subgraphs()->Get(0)->operators()->size();
+    if (subg.operations().size() != num_operators)
+    {
+      VERBOSE(BaseLoader) << "Ignore planned execution order" << std::endl;
+      return;
+    }
+    std::vector<ir::OperationIndex> planned_order;
+    for (size_t i = 1; i < order.size(); ++i)
+    {
+      if (order[i] >= num_operators)
+        throw std::runtime_error{"Invalid operator index in execution order table"};
+      planned_order.emplace_back(order[i]);
+    }
+    subg.setPlannedOrder(planned_order);
+    VERBOSE(BaseLoader) << "Load planned order of " << order[0] << " operations" << std::endl;
+  }
+}
+
+template <typename LoaderDomain> void BaseLoader<LoaderDomain>::openWeightFile()
+{
+  auto file_name = weightFileName();
+  if (file_name.empty())
+    return;
+  if (file_name[0] != '/')
+    file_name = _model_dir + file_name;
+
+  _weight_fd = open(file_name.c_str(), O_RDONLY);
+  if (_weight_fd < 0)
+    throw std::runtime_error{"Failed to open weight file " + file_name};
+
+  struct stat file_stat;
+  if (fstat(_weight_fd, &file_stat) != 0)
+  {
+    close(_weight_fd);
+    _weight_fd = -1;
+    throw std::runtime_error{"Fstat failed or weight file " + file_name +
+                             " is not a regular file"};
+  }
+  _weight_size = file_stat.st_size;
+  VERBOSE(BaseLoader) << "Load buffers from weight file " << file_name << std::endl;
+}
+
+template <typename LoaderDomain>
+std::string BaseLoader<LoaderDomain>::fileSignature(const struct stat &file_stat)
+{
+  return std::to_string(file_stat.st_dev) + " " + std::to_string(file_stat.st_ino) + " " +
+         std::to_string(file_stat.st_size) + " " + std::to_string(file_stat.st_mtim.tv_sec) + "." +
+         std::to_string(file_stat.st_mtim.tv_nsec);
+}
+
+template <typename LoaderDomain>
+std::string BaseLoader<LoaderDomain>::readSignature(const std::string &sidecar_path)
+{
+  std::ifstream ifs(sidecar_path);
+  std::string signature;
+  std::getline(ifs, signature);
+  return signature;
+}
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::writeSignature(const std::string &sidecar_path,
+                                             const std::string &signature)
+{
+  // Failure only means verifying again on the next load, e.g. in a read-only directory
+  util::writeFileAtomically(sidecar_path, signature + "\n");
 }
 
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::BaseLoader::loadFromBuffer(uint8_t *buffer, size_t size)
 {
   _base = buffer;
-  _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), size);
+  _size = size;
+  const auto structure_end = findStructureEnd([&](size_t end) {
+    if (end > _size)
+      throw std::runtime_error{"Invalid offset in the model buffer"};
+  });
+  _verifier =
+    std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), structure_end);
+  loadModel();
+}
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::BaseLoader::loadFromStream(
+  const std::shared_ptr<const StreamBuffer> &stream)
+{
+  _stream = stream;
+  _base = const_cast<uint8_t *>(stream->base());
+  _size = stream->size();
+
+  const auto structure_end = findStructureEnd([&](size_t end) { stream->waitFor(end); });
+  VERBOSE(BaseLoader) << "Load the structure of the model streamed in first " << structure_end
+                      << " of " << _size << " bytes" << std::endl;
+  stream->waitFor(structure_end);
+  _verifier =
+    std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), structure_end);
   loadModel();
 }
 
@@ -331,7 +653,105 @@ template <typename T> bool Copy(const T *data_ptr, std::vector<uint16_t> &arr)
 }
 
 template <typename LoaderDomain>
-ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir::Graph &subg)
+template <typename Fn>
+void BaseLoader<LoaderDomain>::parallelFor(uint32_t size, const Fn &fn)
+{
+  // Chunks of indices run on LOAD_THREADS threads, or on all the cores if it is less than 1
+  constexpr uint32_t chunk_size = 256;
+  const uint32_t num_chunks = (size + chunk_size - 1) / chunk_size;
+  auto threads = util::getConfigInt(util::config::LOAD_THREADS);
+  if (threads < 1)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  const auto num_workers = std::min(static_cast<uint32_t>(threads), num_chunks);
+
+  std::atomic<uint32_t> next_chunk{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto work = [&]() {
+    for (uint32_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++)
+    {
+      try
+      {
+        const auto end = std::min(size, (chunk + 1) * chunk_size);
+        for (uint32_t i = chunk * chunk_size; i < end; ++i)
+          fn(i);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock{error_mutex};
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (uint32_t i = 1; i < num_workers; ++i)
+    workers.emplace_back(work);
+  work();
+  for (auto &worker : workers)
+    worker.join();
+  if (error)
+    std::rethrow_exception(error);
+}
+
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadOperands(const SubGraph *subg, ir::Graph &graph)
+{
+  const auto *tensors = subg->tensors();
+  const uint32_t num_tensors = tensors->size();
+
+  // A buffer shared by tensors gets one Data, which the first of them creates
+  std::vector<bool> creates_data(num_tensors, false);
+  {
+    std::unordered_set<uint32_t> buffers;
+    for (uint32_t i = 0; i < num_tensors; ++i)
+    {
+      const auto buf_idx = tensors->Get(i)->buffer();
+      if (hasData(_model->buffers()->Get(buf_idx)) &&
+          _buf_to_data.find(buf_idx) == _buf_to_data.end() && buffers.insert(buf_idx).second)
+        creates_data[i] = true;
+    }
+  }
+
+  // Operands and constants are independent of each other, so they are created on many threads
+  // and added to the graph in the order of tensors
+  std::vector<std::unique_ptr<ir::Operand>> operands(num_tensors);
+  std::vector<std::shared_ptr<ir::Data>> datas(num_tensors);
+  parallelFor(num_tensors, [&](uint32_t i) {
+    const auto *tensor = tensors->Get(i);
+    operands[i] = createOperand(tensor);
+    if (creates_data[i])
+      datas[i] = createData(_model->buffers()->Get(tensor->buffer()));
+  });
+
+  graph.operands().reserve(num_tensors);
+  // Operand indices start from 0 in each subgraph, so each of them has its own names
+  _tensor_names = std::make_shared<std::unordered_map<ir::OperandIndex, std::string>>();
+  _tensor_names->reserve(num_tensors);
+  _tensor_to_operand.resize(num_tensors);
+  for (uint32_t i = 0; i < num_tensors; ++i)
+  {
+    const auto *tensor = tensors->Get(i);
+    const auto buf_idx = tensor->buffer();
+    if (creates_data[i])
+      _buf_to_data[buf_idx] = std::move(datas[i]);
+
+    // Constant tensors are indicated by non-empty data.
+    if (hasData(_model->buffers()->Get(buf_idx)))
+    {
+      auto data_obj = _buf_to_data.at(buf_idx);
+      operands[i]->data(std::move(data_obj));
+    }
+
+    const auto operand_index = graph.operands().push(std::move(operands[i]));
+    _tensor_names->emplace(operand_index, tensor->name()->str());
+    _tensor_to_operand[i] = operand_index;
+  }
+}
+
+template <typename LoaderDomain>
+std::unique_ptr<ir::Operand> BaseLoader<LoaderDomain>::createOperand(const Tensor *tensor)
 {
   ir::Shape shape;
   // Shape
@@ -357,72 +777,112 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
   loadSparsity(tensor, type_info);
 
   // Create operand
-  const auto operand_index = subg.addOperand(shape, type_info);
+  auto operand = std::make_unique<ir::Operand>(shape, type_info);
 
-  // Constant tensors are indicated by non-empty data.
-  const auto *data = _model->buffers()->Get(tensor->buffer())->data();
-  if (data != nullptr)
+  // Variable
+  if (tensor->is_variable())
   {
-    using std::ptrdiff_t;
-    std::shared_ptr<ir::Data> data_obj;
-
-    if (_fd == -1) // Model is from memory
-    {
-      data_obj = std::make_shared<ir::ExternalData>(data->data(), data->size());
-    }
-    else // Model is loaded(mmap'd) from a file
-    {
-      size_t data_size = data->size();
-      ptrdiff_t unaligned_offset_start = data->data() - _base;
-      ptrdiff_t offset_end = unaligned_offset_start + data_size;
+    if (hasData(_model->buffers()->Get(tensor->buffer())))
+      throw std::runtime_error("Variable tensor with buffer is not supported!");
 
-      // Calculated aligned offset from base address of mapped region
-      // munmap accepts memory address which is a multiple of the pagesize
-      ptrdiff_t aligned_offset_start = (unaligned_offset_start / _pagesize) * _pagesize;
-      size_t mmap_size = offset_end - aligned_offset_start;
+    operand->info().setAsVariable();
+  }
 
-      uint32_t buf_idx = tensor->buffer();
-      auto buffer_found = _buf_to_data.find(buf_idx);
+  return operand;
+}
 
-      if (buffer_found != _buf_to_data.end())
-      {
-        // Another tensor points this buffer and its matching Data(either CachedData or MMapedData)
-        // was already created. Let's reuse the Data
-        data_obj = buffer_found->second;
-      }
-      else if (_use_mmaped_data)
-      {
-        data_obj = std::make_shared<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
-                                                    unaligned_offset_start, data_size);
-        _buf_to_data[buf_idx] = data_obj;
-      }
-      else
-      {
-        size_t offset = unaligned_offset_start - aligned_offset_start;
-        uint8_t *mmap_base = static_cast<uint8_t *>(
-          mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
+template <typename LoaderDomain>
+bool BaseLoader<LoaderDomain>::hasData(const Buffer *buffer)
+{
+  uint64_t offset, size;
+  return buffer->data() != nullptr ||
+         (LoaderDomain::getExternalBuffer(buffer, offset, size) && size > 0);
+}
 
-        data_obj = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
-        _buf_to_data[buf_idx] = data_obj;
+template <typename LoaderDomain>
+std::shared_ptr<ir::Data> BaseLoader<LoaderDomain>::createData(const Buffer *buffer)
+{
+  using std::ptrdiff_t;
 
-        munmap(mmap_base, mmap_size);
-      }
-    }
-    subg.setOperandValue(operand_index, std::move(data_obj));
+  const uint8_t *data_base;
+  size_t data_size;
+  uint64_t offset, size;
+  if (buffer->data() == nullptr && LoaderDomain::getExternalBuffer(buffer, offset, size) &&
+      _weight_fd != -1)
+  {
+    if (offset > _weight_size || size > _weight_size - offset)
+      throw std::runtime_error{"Buffer out of the weight file (offset " + std::to_string(offset) +
+                               ", size " + std::to_string(size) + ")"};
+
+    // Mapped pages of the weight file are shared by processes loading it
+    const ptrdiff_t aligned_offset = (offset / _pagesize) * _pagesize;
+    return std::make_shared<ir::MMapedData>(_weight_fd, aligned_offset,
+                                            offset + size - aligned_offset, offset, size);
+  }
+  else if (buffer->data() == nullptr && LoaderDomain::getExternalBuffer(buffer, offset, size))
+  {
+    if (offset > _size || size > _size - offset)
+      throw std::runtime_error{"Buffer out of the model (offset " + std::to_string(offset) +
+                               ", size " + std::to_string(size) + ")"};
+    data_base = _base + offset;
+    data_size = size;
+  }
+  else
+  {
+    data_base = buffer->data()->data();
+    data_size = buffer->data()->size();
   }
 
-  _tensor_names->emplace(operand_index, tensor->name()->str());
+  if (_stream) // Model is still arriving
+  {
+    return std::make_shared<StreamedData>(_stream, data_base - _base, data_size);
+  }
 
-  // Variable
-  if (tensor->is_variable())
+  if (_fd == -1) // Model is from memory
   {
-    if (data != nullptr)
-      throw std::runtime_error("Variable tensor with buffer is not supported!");
+    return std::make_shared<ir::ExternalData>(data_base, data_size);
+  }
 
-    subg.operands().at(operand_index).info().setAsVariable();
+  // Model is loaded(mmap'd) from a file
+  ptrdiff_t unaligned_offset_start = data_base - _base;
+  ptrdiff_t offset_end = unaligned_offset_start + data_size;
+
+  // Calculated aligned offset from base address of mapped region
+  // munmap accepts memory address which is a multiple of the pagesize
+  ptrdiff_t aligned_offset_start = (unaligned_offset_start / _pagesize) * _pagesize;
+  size_t mmap_size = offset_end - aligned_offset_start;
+
+  if (_mapped_file)
+  {
+    // Not read until a backend accesses it
+    return std::make_shared<ir::MappedFileData>(_mapped_file, unaligned_offset_start, data_size);
   }
+  else if (_use_mmaped_data)
+  {
+    return std::make_shared<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
+                                            unaligned_offset_start, data_size);
+  }
+  else
+  {
+    size_t offset = unaligned_offset_start - aligned_offset_start;
+    uint8_t *mmap_base = static_cast<uint8_t *>(
+      mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
+
+    // Processes loading the same constants share them in the store instead of each caching them
+    std::shared_ptr<ir::Data> data_obj;
+    if (auto store = util::WeightStore::get(util::config::SHARED_WEIGHT_DIR))
+    {
+      const auto key = util::WeightStore::key("constant", mmap_base + offset, data_size);
+      data_obj = store->load(key, data_size);
+      if (!data_obj)
+        data_obj = store->store(key, mmap_base + offset, data_size);
+    }
+    if (!data_obj)
+      data_obj = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
 
-  return operand_index;
+    munmap(mmap_base, mmap_size);
+    return data_obj;
+  }
 }
 
 template <typename LoaderDomain>
@@ -1351,6 +1811,27 @@ void BaseLoader<LoaderDomain>::loadLeakyRelu(const Operator *op, ir::Graph &subg
                             1.f);
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadTopKV2(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  // 'k' is the second input of TOPK_V2, which is a parameter of ir::operation::TopKV2
+  const auto &k = subg.operands().at(inputs.at(1));
+  if (!k.isConstant())
+    throw std::runtime_error("TopKV2: non-constant 'k' is not supported.");
+
+  ir::operation::TopKV2::Param param;
+  param.k = k.asScalar<int32_t>();
+
+  auto new_op = std::make_unique<ir::operation::TopKV2>(ir::OperandIndexSequence{inputs.at(0)},
+                                                        outputs, param);
+  subg.addOperation(std::move(new_op));
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadUnidirectionalSequenceLSTM(const Operator *op, ir::Graph &subg)
 {
@@ -1445,6 +1926,9 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_ELU:
       loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::ELU);
       return;
+    case BuiltinOperator::BuiltinOperator_HARD_SWISH:
+      loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::HARD_SWISH);
+      return;
     case BuiltinOperator::BuiltinOperator_RELU:
       loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::RELU,
                                 ir::operation::ElementwiseActivation::infinity, 0.f);
@@ -1630,6 +2114,9 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_TILE:
       loadOperationTo<ir::operation::Tile>(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_TOPK_V2:
+      loadTopKV2(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_RANGE:
       loadOperationTo<ir::operation::Range>(op, subg);
       return;
@@ -1671,8 +2158,18 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
 
 template <typename LoaderDomain> void BaseLoader<LoaderDomain>::loadModel()
 {
-  LoaderDomain::VerifyModelBuffer(*_verifier.get());
+  util::HeapPhase heap_phase{"load"};
+  if (_skip_verification)
+  {
+    VERBOSE(BaseLoader) << "Skip verification of the trusted model" << std::endl;
+  }
+  else
+  {
+    // NOTE The result only decides whether a trusted model is recorded as verified
+    _verified = LoaderDomain::VerifyModelBuffer(*_verifier.get());
+  }
   _model = LoaderDomain::GetModel(_base);
+  openWeightFile();
   // Version unused
   // const auto version = _model->version();
   // Description unused
@@ -1685,9 +2182,19 @@ template <typename LoaderDomain> void BaseLoader<LoaderDomain>::loadModel()
   for (uint32_t subgraph_index = 0; subgraph_index < domain_subgraphs->size(); ++subgraph_index)
   {
     auto subg = loadSubgraph((*_model->subgraphs())[subgraph_index]);
+    // Indices of the plan are of the primary subgraph
+    if (subgraph_index == 0)
+      loadPlan(*subg);
     subgraphs->push(ir::SubgraphIndex{subgraph_index}, std::move(subg));
   }
   _subgraphs = std::move(subgraphs);
+
+  // Constants keep their own mappings
+  if (_weight_fd != -1)
+  {
+    close(_weight_fd);
+    _weight_fd = -1;
+  }
 }
 
 } // namespace base_loader
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BASE_LOADER_STREAM_BUFFER_H__
+#define __BASE_LOADER_STREAM_BUFFER_H__
+
+#include "ir/Data.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace onert
+{
+namespace base_loader
+{
+
+/**
+ * @brief Buffer of a model filled by a reader thread from a non-seekable source
+ *
+ * Readers wait for the range they access, so a model can be loaded while the rest of it arrives.
+ */
+class StreamBuffer
+{
+public:
+  /**
+   * @brief Function reading at most @c size bytes to @c dst
+   *
+   * It returns the number of bytes read, 0 at the end of the stream or a negative value on error.
+   */
+  using ReadFn = std::function<int64_t(uint8_t *dst, size_t size)>;
+
+public:
+  StreamBuffer(size_t size, ReadFn read)
+    : _buffer(new uint8_t[size]), _size(size), _read(std::move(read)), _received(0),
+      _failed(false), _cancelled(false)
+  {
+    _thread = std::thread([this] { receive(); });
+  }
+  ~StreamBuffer()
+  {
+    _cancelled = true;
+    _thread.join();
+  }
+
+  StreamBuffer(const StreamBuffer &) = delete;
+  StreamBuffer &operator=(const StreamBuffer &) = delete;
+
+public:
+  const uint8_t *base() const { return _buffer.get(); }
+  size_t size() const { return _size; }
+  /**
+   * @brief Wait until the bytes before @c end arrive
+   *
+   * @throw std::runtime_error if the stream fails or ends before them
+   */
+  void waitFor(size_t end) const
+  {
+    if (end > _size)
+      throw std::runtime_error{"StreamBuffer: Access out of the stream (" + std::to_string(end) +
+                               " > " + std::to_string(_size) + ")"};
+    if (_received.load(std::memory_order_acquire) >= end)
+      return;
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cv.wait(lock, [&] { return _received.load(std::memory_order_acquire) >= end || _failed; });
+    if (_received.load(std::memory_order_acquire) < end)
+      throw std::runtime_error{"StreamBuffer: Stream ended at " + std::to_string(_received) +
+                               " before " + std::to_string(end)};
+  }
+
+private:
+  void receive()
+  {
+    // Small chunks to let the loader go on as soon as the structure arrives
+    constexpr size_t chunk = 64 * 1024;
+    size_t received = 0;
+    while (received < _size && !_cancelled)
+    {
+      const auto read = _read(_buffer.get() + received, std::min(chunk, _size - received));
+      if (read <= 0)
+        break;
+      received += static_cast<size_t>(read);
+      std::lock_guard<std::mutex> lock{_mutex};
+      _received.store(received, std::memory_order_release);
+      _cv.notify_all();
+    }
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    _failed = received < _size;
+    _cv.notify_all();
+  }
+
+private:
+  std::unique_ptr<uint8_t[]> _buffer;
+  size_t _size;
+  ReadFn _read;
+  std::atomic<size_t> _received;
+  bool _failed;
+  std::atomic<bool> _cancelled;
+  mutable std::mutex _mutex;
+  mutable std::condition_variable _cv;
+  std::thread _thread;
+};
+
+/**
+ * @brief Data in a StreamBuffer, which waits for its bytes on access
+ */
+class StreamedData final : public ir::Data
+{
+public:
+  StreamedData(const std::shared_ptr<const StreamBuffer> &stream, size_t offset, size_t size)
+    : _stream{stream}, _offset{offset}, _size{size}
+  {
+    // DO NOTHING
+  }
+
+public:
+  size_t size(void) const override { return _size; }
+  const uint8_t *base(void) const override
+  {
+    _stream->waitFor(_offset + _size);
+    return _stream->base() + _offset;
+  }
+
+private:
+  std::shared_ptr<const StreamBuffer> _stream;
+  const size_t _offset;
+  const size_t _size;
+};
+
+} // namespace base_loader
+} // namespace onert
+
+#endif // __BASE_LOADER_STREAM_BUFFER_H__
@@ -23,10 +23,16 @@
 
 namespace onert
 {
+namespace base_loader
+{
+class StreamBuffer;
+} // namespace base_loader
 namespace circle_loader
 {
 std::unique_ptr<ir::Subgraphs> loadModel(const std::string &filename);
 std::unique_ptr<ir::Subgraphs> loadModel(uint8_t *buffer, size_t size);
+std::unique_ptr<ir::Subgraphs>
+loadModel(const std::shared_ptr<const base_loader::StreamBuffer> &stream);
 } // namespace circle_loader
 } // namespace onert
 
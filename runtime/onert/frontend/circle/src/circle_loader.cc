@@ -67,6 +67,19 @@ struct LoaderDomain
   static const char *EnumNameTensorType(TensorType e) { return circle::EnumNameTensorType(e); }
   static const Model *GetModel(const void *buf) { return circle::GetModel(buf); }
   static bool VerifyModelBuffer(Verifier &verifier) { return circle::VerifyModelBuffer(verifier); }
+  // Metadata with the name of the weight file, from the directory of the model
+  static constexpr const char *WEIGHT_FILE_METADATA = "ONE_weight_file";
+  // Metadata with offsets of tensors planned ahead, e.g. by circle-execution-plan
+  static constexpr const char *TENSOR_OFFSET_METADATA = "ONE_tensor_offset_table";
+  static constexpr const char *EXECUTION_ORDER_METADATA = "ONE_execution_order_table";
+  // Data of a buffer stored after the flatbuffer or in the weight file. It never begins at 0 of
+  // the root offset.
+  static bool getExternalBuffer(const Buffer *buffer, uint64_t &offset, uint64_t &size)
+  {
+    offset = buffer->offset();
+    size = buffer->size();
+    return offset != 0;
+  }
 };
 
 class CircleLoader final : public base_loader::BaseLoader<LoaderDomain>
@@ -78,7 +91,9 @@ protected:
   void loadBatchMatMul(const Operator *op, ir::Graph &subg);
 
   // Only circle operations
+  void loadGelu(const Operator *op, ir::Graph &subg);
   void loadInstanceNorm(const Operator *op, ir::Graph &subg);
+  void loadLayerNorm(const Operator *op, ir::Graph &subg);
   void loadBCQFullyConnected(const Operator *op, ir::Graph &subg);
   void loadBCQGather(const Operator *op, ir::Graph &subg);
 
@@ -103,11 +118,7 @@ private:
   {
     auto subg = std::make_unique<ir::Graph>();
     // Load tensors
-    _tensor_to_operand.resize(circle_subg->tensors()->size());
-    for (flatbuffers::uoffset_t i = 0; i < circle_subg->tensors()->size(); ++i)
-    {
-      _tensor_to_operand[i] = loadOperand(circle_subg->tensors()->Get(i), *subg);
-    }
+    loadOperands(circle_subg, *subg);
     // Set inputs
     for (const std::int32_t input_ind : *circle_subg->inputs())
     {
@@ -121,11 +132,14 @@ private:
                       _tensor_names->at(_tensor_to_operand[output_ind]));
     }
     // Create operations
+    subg->operations().reserve(circle_subg->operators()->size());
     for (const auto *op : *circle_subg->operators())
     {
       CircleLoader::loadOperation(op, *subg);
     }
 
+    subg->setTensorName(_tensor_names);
+
     subg->setLayout(convertDataFormat(circle_subg->data_format()));
 
     subg->verify();
@@ -142,9 +156,15 @@ private:
       case circle::BuiltinOperator::BuiltinOperator_BATCH_MATMUL:
         loadBatchMatMul(op, subg);
         return;
+      case circle::BuiltinOperator::BuiltinOperator_GELU:
+        loadGelu(op, subg);
+        return;
       case circle::BuiltinOperator::BuiltinOperator_INSTANCE_NORM:
         loadInstanceNorm(op, subg);
         return;
+      case circle::BuiltinOperator::BuiltinOperator_LAYER_NORM:
+        loadLayerNorm(op, subg);
+        return;
       case circle::BuiltinOperator::BuiltinOperator_BCQ_FULLY_CONNECTED:
         loadBCQFullyConnected(op, subg);
         return;
@@ -175,6 +195,15 @@ void CircleLoader::loadBatchMatMul(const Operator *op, ir::Graph &subg)
   subg.addOperation(std::move(new_op));
 }
 
+void CircleLoader::loadGelu(const Operator *op, ir::Graph &subg)
+{
+  const auto *options = op->builtin_options_as_GeluOptions();
+  const bool approximate = options != nullptr && options->approximate();
+
+  loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::GELU,
+                            approximate ? 1.f : 0.f);
+}
+
 void CircleLoader::loadInstanceNorm(const Operator *op, ir::Graph &subg)
 {
   ir::OperandIndexSequence inputs;
@@ -193,6 +222,23 @@ void CircleLoader::loadInstanceNorm(const Operator *op, ir::Graph &subg)
   subg.addOperation(std::move(new_op));
 }
 
+void CircleLoader::loadLayerNorm(const Operator *op, ir::Graph &subg)
+{
+  ir::OperandIndexSequence inputs;
+  ir::OperandIndexSequence outputs;
+
+  loadOperationIO(op, inputs, outputs);
+
+  ir::operation::LayerNorm::Param param;
+  const auto *options = op->builtin_options_as_LayerNormOptions();
+
+  // Use default value 1e-5 if value of epsilon is zero or the options are missing
+  param.epsilon = (options == nullptr || options->epsilon() == 0.f) ? 1e-5 : options->epsilon();
+
+  std::unique_ptr<ir::Operation> new_op(new ir::operation::LayerNorm(inputs, outputs, param));
+  subg.addOperation(std::move(new_op));
+}
+
 void CircleLoader::loadBCQGather(const Operator *op, ir::Graph &subg)
 {
   ir::OperandIndexSequence inputs;
@@ -244,5 +290,14 @@ std::unique_ptr<ir::Subgraphs> loadModel(uint8_t *buffer, size_t size)
   return subgraphs;
 }
 
+std::unique_ptr<ir::Subgraphs>
+loadModel(const std::shared_ptr<const base_loader::StreamBuffer> &stream)
+{
+  auto subgraphs = std::make_unique<ir::Subgraphs>();
+  CircleLoader loader(subgraphs);
+  loader.loadFromStream(stream);
+  return subgraphs;
+}
+
 } // namespace circle_loader
 } // namespace onert
@@ -399,6 +399,12 @@ struct BCQFullyConnectedOptionsBuilder;
 struct InstanceNormOptions;
 struct InstanceNormOptionsBuilder;
 
+struct GeluOptions;
+struct GeluOptionsBuilder;
+
+struct LayerNormOptions;
+struct LayerNormOptionsBuilder;
+
 struct OperatorCode;
 struct OperatorCodeBuilder;
 
@@ -606,6 +612,8 @@ bool VerifySparseIndexVectorVector(flatbuffers::Verifier &verifier,
 
 enum BuiltinOperator : int32_t
 {
+  BuiltinOperator_GELU = -6,
+  BuiltinOperator_LAYER_NORM = -5,
   BuiltinOperator_BCQ_GATHER = -4,
   BuiltinOperator_BCQ_FULLY_CONNECTED = -3,
   BuiltinOperator_INSTANCE_NORM = -2,
@@ -756,13 +764,15 @@ enum BuiltinOperator : int32_t
   BuiltinOperator_ASSIGN_VARIABLE = 144,
   BuiltinOperator_BROADCAST_ARGS = 145,
   BuiltinOperator_RANDOM_STANDARD_NORMAL = 146,
-  BuiltinOperator_MIN = BuiltinOperator_BCQ_GATHER,
+  BuiltinOperator_MIN = BuiltinOperator_GELU,
   BuiltinOperator_MAX = BuiltinOperator_RANDOM_STANDARD_NORMAL
 };
 
-inline const BuiltinOperator (&EnumValuesBuiltinOperator())[150]
+inline const BuiltinOperator (&EnumValuesBuiltinOperator())[152]
 {
-  static const BuiltinOperator values[] = {BuiltinOperator_BCQ_GATHER,
+  static const BuiltinOperator values[] = {BuiltinOperator_GELU,
+                                           BuiltinOperator_LAYER_NORM,
+                                           BuiltinOperator_BCQ_GATHER,
                                            BuiltinOperator_BCQ_FULLY_CONNECTED,
                                            BuiltinOperator_INSTANCE_NORM,
                                            BuiltinOperator_ADD,
@@ -917,7 +927,9 @@ inline const BuiltinOperator (&EnumValuesBuiltinOperator())[150]
 
 inline const char *const *EnumNamesBuiltinOperator()
 {
-  static const char *const names[152] = {"BCQ_GATHER",
+  static const char *const names[154] = {"GELU",
+                                         "LAYER_NORM",
+                                         "BCQ_GATHER",
                                          "BCQ_FULLY_CONNECTED",
                                          "INSTANCE_NORM",
                                          "",
@@ -1074,10 +1086,9 @@ inline const char *const *EnumNamesBuiltinOperator()
 
 inline const char *EnumNameBuiltinOperator(BuiltinOperator e)
 {
-  if (flatbuffers::IsOutRange(e, BuiltinOperator_BCQ_GATHER,
-                              BuiltinOperator_RANDOM_STANDARD_NORMAL))
+  if (flatbuffers::IsOutRange(e, BuiltinOperator_GELU, BuiltinOperator_RANDOM_STANDARD_NORMAL))
     return "";
-  const size_t index = static_cast<size_t>(e) - static_cast<size_t>(BuiltinOperator_BCQ_GATHER);
+  const size_t index = static_cast<size_t>(e) - static_cast<size_t>(BuiltinOperator_GELU);
   return EnumNamesBuiltinOperator()[index];
 }
 
@@ -1198,6 +1209,8 @@ enum BuiltinOptions : uint8_t
   BuiltinOptions_ReadVariableOptions = 112,
   BuiltinOptions_AssignVariableOptions = 113,
   BuiltinOptions_RandomOptions = 114,
+  BuiltinOptions_GeluOptions = 250,
+  BuiltinOptions_LayerNormOptions = 251,
   BuiltinOptions_BCQGatherOptions = 252,
   BuiltinOptions_BCQFullyConnectedOptions = 253,
   BuiltinOptions_InstanceNormOptions = 254,
@@ -1205,7 +1218,7 @@ enum BuiltinOptions : uint8_t
   BuiltinOptions_MAX = BuiltinOptions_InstanceNormOptions
 };
 
-inline const BuiltinOptions (&EnumValuesBuiltinOptions())[118]
+inline const BuiltinOptions (&EnumValuesBuiltinOptions())[120]
 {
   static const BuiltinOptions values[] = {BuiltinOptions_NONE,
                                           BuiltinOptions_Conv2DOptions,
@@ -1322,6 +1335,8 @@ inline const BuiltinOptions (&EnumValuesBuiltinOptions())[118]
                                           BuiltinOptions_ReadVariableOptions,
                                           BuiltinOptions_AssignVariableOptions,
                                           BuiltinOptions_RandomOptions,
+                                          BuiltinOptions_GeluOptions,
+                                          BuiltinOptions_LayerNormOptions,
                                           BuiltinOptions_BCQGatherOptions,
                                           BuiltinOptions_BCQFullyConnectedOptions,
                                           BuiltinOptions_InstanceNormOptions};
@@ -1580,8 +1595,8 @@ inline const char *const *EnumNamesBuiltinOptions()
                                          "",
                                          "",
                                          "",
-                                         "",
-                                         "",
+                                         "GeluOptions",
+                                         "LayerNormOptions",
                                          "BCQGatherOptions",
                                          "BCQFullyConnectedOptions",
                                          "InstanceNormOptions",
@@ -2172,6 +2187,16 @@ template <> struct BuiltinOptionsTraits<circle::RandomOptions>
   static const BuiltinOptions enum_value = BuiltinOptions_RandomOptions;
 };
 
+template <> struct BuiltinOptionsTraits<circle::GeluOptions>
+{
+  static const BuiltinOptions enum_value = BuiltinOptions_GeluOptions;
+};
+
+template <> struct BuiltinOptionsTraits<circle::LayerNormOptions>
+{
+  static const BuiltinOptions enum_value = BuiltinOptions_LayerNormOptions;
+};
+
 template <> struct BuiltinOptionsTraits<circle::BCQGatherOptions>
 {
   static const BuiltinOptions enum_value = BuiltinOptions_BCQGatherOptions;
@@ -8707,6 +8732,94 @@ inline flatbuffers::Offset<InstanceNormOptions> CreateInstanceNormOptions(
   return builder_.Finish();
 }
 
+struct GeluOptions FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
+{
+  typedef GeluOptionsBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE
+  {
+    VT_APPROXIMATE = 4
+  };
+  bool approximate() const { return GetField<uint8_t>(VT_APPROXIMATE, 0) != 0; }
+  bool Verify(flatbuffers::Verifier &verifier) const
+  {
+    return VerifyTableStart(verifier) && VerifyField<uint8_t>(verifier, VT_APPROXIMATE) &&
+           verifier.EndTable();
+  }
+};
+
+struct GeluOptionsBuilder
+{
+  typedef GeluOptions Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_approximate(bool approximate)
+  {
+    fbb_.AddElement<uint8_t>(GeluOptions::VT_APPROXIMATE, static_cast<uint8_t>(approximate), 0);
+  }
+  explicit GeluOptionsBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb)
+  {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<GeluOptions> Finish()
+  {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<GeluOptions>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<GeluOptions> CreateGeluOptions(flatbuffers::FlatBufferBuilder &_fbb,
+                                                          bool approximate = false)
+{
+  GeluOptionsBuilder builder_(_fbb);
+  builder_.add_approximate(approximate);
+  return builder_.Finish();
+}
+
+struct LayerNormOptions FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
+{
+  typedef LayerNormOptionsBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE
+  {
+    VT_EPSILON = 4
+  };
+  float epsilon() const { return GetField<float>(VT_EPSILON, 0.0f); }
+  bool Verify(flatbuffers::Verifier &verifier) const
+  {
+    return VerifyTableStart(verifier) && VerifyField<float>(verifier, VT_EPSILON) &&
+           verifier.EndTable();
+  }
+};
+
+struct LayerNormOptionsBuilder
+{
+  typedef LayerNormOptions Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_epsilon(float epsilon)
+  {
+    fbb_.AddElement<float>(LayerNormOptions::VT_EPSILON, epsilon, 0.0f);
+  }
+  explicit LayerNormOptionsBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb)
+  {
+    start_ = fbb_.StartTable();
+  }
+  flatbuffers::Offset<LayerNormOptions> Finish()
+  {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LayerNormOptions>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LayerNormOptions>
+CreateLayerNormOptions(flatbuffers::FlatBufferBuilder &_fbb, float epsilon = 0.0f)
+{
+  LayerNormOptionsBuilder builder_(_fbb);
+  builder_.add_epsilon(epsilon);
+  return builder_.Finish();
+}
+
 struct OperatorCode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
 {
   typedef OperatorCodeBuilder Builder;
@@ -9513,6 +9626,18 @@ struct Operator FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
              ? static_cast<const circle::RandomOptions *>(builtin_options())
              : nullptr;
   }
+  const circle::GeluOptions *builtin_options_as_GeluOptions() const
+  {
+    return builtin_options_type() == circle::BuiltinOptions_GeluOptions
+             ? static_cast<const circle::GeluOptions *>(builtin_options())
+             : nullptr;
+  }
+  const circle::LayerNormOptions *builtin_options_as_LayerNormOptions() const
+  {
+    return builtin_options_type() == circle::BuiltinOptions_LayerNormOptions
+             ? static_cast<const circle::LayerNormOptions *>(builtin_options())
+             : nullptr;
+  }
   const circle::BCQGatherOptions *builtin_options_as_BCQGatherOptions() const
   {
     return builtin_options_type() == circle::BuiltinOptions_BCQGatherOptions
@@ -10300,6 +10425,19 @@ inline const circle::RandomOptions *Operator::builtin_options_as<circle::RandomO
   return builtin_options_as_RandomOptions();
 }
 
+template <>
+inline const circle::GeluOptions *Operator::builtin_options_as<circle::GeluOptions>() const
+{
+  return builtin_options_as_GeluOptions();
+}
+
+template <>
+inline const circle::LayerNormOptions *
+Operator::builtin_options_as<circle::LayerNormOptions>() const
+{
+  return builtin_options_as_LayerNormOptions();
+}
+
 template <>
 inline const circle::BCQGatherOptions *
 Operator::builtin_options_as<circle::BCQGatherOptions>() const
@@ -10556,16 +10694,21 @@ struct Buffer FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
   typedef BufferBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE
   {
-    VT_DATA = 4
+    VT_DATA = 4,
+    VT_OFFSET = 6,
+    VT_SIZE = 8
   };
   const flatbuffers::Vector<uint8_t> *data() const
   {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
   }
+  uint64_t offset() const { return GetField<uint64_t>(VT_OFFSET, 0); }
+  uint64_t size() const { return GetField<uint64_t>(VT_SIZE, 0); }
   bool Verify(flatbuffers::Verifier &verifier) const
   {
     return VerifyTableStart(verifier) && VerifyOffset(verifier, VT_DATA) &&
-           verifier.VerifyVector(data()) && verifier.EndTable();
+           verifier.VerifyVector(data()) && VerifyField<uint64_t>(verifier, VT_OFFSET) &&
+           VerifyField<uint64_t>(verifier, VT_SIZE) && verifier.EndTable();
   }
 };
 
@@ -10578,6 +10721,8 @@ struct BufferBuilder
   {
     fbb_.AddOffset(Buffer::VT_DATA, data);
   }
+  void add_offset(uint64_t offset) { fbb_.AddElement<uint64_t>(Buffer::VT_OFFSET, offset, 0); }
+  void add_size(uint64_t size) { fbb_.AddElement<uint64_t>(Buffer::VT_SIZE, size, 0); }
   explicit BufferBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb)
   {
     start_ = fbb_.StartTable();
@@ -10592,22 +10737,26 @@ struct BufferBuilder
 
 inline flatbuffers::Offset<Buffer>
 CreateBuffer(flatbuffers::FlatBufferBuilder &_fbb,
-             flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0)
+             flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0, uint64_t offset = 0,
+             uint64_t size = 0)
 {
   BufferBuilder builder_(_fbb);
+  builder_.add_size(size);
+  builder_.add_offset(offset);
   builder_.add_data(data);
   return builder_.Finish();
 }
 
 inline flatbuffers::Offset<Buffer> CreateBufferDirect(flatbuffers::FlatBufferBuilder &_fbb,
-                                                      const std::vector<uint8_t> *data = nullptr)
+                                                      const std::vector<uint8_t> *data = nullptr,
+                                                      uint64_t offset = 0, uint64_t size = 0)
 {
   if (data)
   {
     _fbb.ForceVectorAlignment(data->size(), sizeof(uint8_t), 16);
   }
   auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
-  return circle::CreateBuffer(_fbb, data__);
+  return circle::CreateBuffer(_fbb, data__, offset, size);
 }
 
 struct Metadata FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table
@@ -11667,6 +11816,16 @@ inline bool VerifyBuiltinOptions(flatbuffers::Verifier &verifier, const void *ob
       auto ptr = reinterpret_cast<const circle::RandomOptions *>(obj);
       return verifier.VerifyTable(ptr);
     }
+    case BuiltinOptions_GeluOptions:
+    {
+      auto ptr = reinterpret_cast<const circle::GeluOptions *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case BuiltinOptions_LayerNormOptions:
+    {
+      auto ptr = reinterpret_cast<const circle::LayerNormOptions *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
     case BuiltinOptions_BCQGatherOptions:
     {
       auto ptr = reinterpret_cast<const circle::BCQGatherOptions *>(obj);
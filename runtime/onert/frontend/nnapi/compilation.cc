@@ -104,3 +104,22 @@ int ANeuralNetworksCompilation_setPreference(ANeuralNetworksCompilation *compila
   // NYI: nothing to set
   return ANEURALNETWORKS_NO_ERROR;
 }
+
+int ANeuralNetworksCompilation_setCaching(ANeuralNetworksCompilation *compilation,
+                                          const char *cacheDir, const uint8_t *token)
+{
+  if ((compilation == nullptr) || (cacheDir == nullptr) || (token == nullptr))
+  {
+    VERBOSE(NNAPI::Compilation) << "setCaching: Incorrect null pointer parameter(s)" << std::endl;
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  if (compilation->state() != ::onert::compiler::State::CREATED)
+  {
+    VERBOSE(NNAPI::Compilation) << "setCaching: Already finished" << std::endl;
+    return ANEURALNETWORKS_BAD_STATE;
+  }
+
+  compilation->setCaching(cacheDir, token);
+  return ANEURALNETWORKS_NO_ERROR;
+}
@@ -18,6 +18,7 @@
 
 #include <new>
 
+#include "wrapper/ANeuralNetworksBurst.h"
 #include "wrapper/ANeuralNetworksCompilation.h"
 #include "wrapper/ANeuralNetworksExecution.h"
 #include "wrapper/ANeuralNetworksMemory.h"
@@ -47,7 +48,16 @@ int ANeuralNetworksExecution_create(ANeuralNetworksCompilation *compilation,
     return ANEURALNETWORKS_BAD_STATE;
   }
 
-  *execution = new (std::nothrow) ANeuralNetworksExecution{executors};
+  // An execution freed before is reused as it is
+  const auto &pool = compilation->executionPool();
+  if (auto reused = pool->take())
+  {
+    *execution = reused.release();
+    return ANEURALNETWORKS_NO_ERROR;
+  }
+
+  *execution = new (std::nothrow)
+    ANeuralNetworksExecution{executors, pool, compilation->executionBatcher()};
   if (*execution == nullptr)
   {
     VERBOSE(NNAPI::Execution) << "create: Fail to create execution object" << std::endl;
@@ -298,7 +308,48 @@ int ANeuralNetworksExecution_compute(ANeuralNetworksExecution *execution)
   return ANEURALNETWORKS_NO_ERROR;
 }
 
-void ANeuralNetworksExecution_free(ANeuralNetworksExecution *execution) { delete execution; }
+int ANeuralNetworksExecution_burstCompute(ANeuralNetworksExecution *execution,
+                                          ANeuralNetworksBurst *burst)
+{
+  if ((execution == nullptr) || (burst == nullptr))
+  {
+    VERBOSE(NNAPI::Execution) << "burstCompute: Incorrect null pointer parameter(s)" << std::endl;
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+  if (execution->pool() != burst->executionPool())
+  {
+    VERBOSE(NNAPI::Execution) << "burstCompute: Execution is not of the compilation of the burst"
+                              << std::endl;
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  if (!burst->compute(execution))
+  {
+    VERBOSE(NNAPI::Execution) << "burstCompute: Fail to execution" << std::endl;
+    return ANEURALNETWORKS_BAD_STATE;
+  }
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+void ANeuralNetworksExecution_free(ANeuralNetworksExecution *execution)
+{
+  if (execution == nullptr)
+  {
+    return;
+  }
+
+  // The compilation keeps the execution to reuse it, unless an event still waits for it
+  auto pool = execution->pool();
+  if (pool && execution->isIdle())
+  {
+    pool->keep(std::unique_ptr<ANeuralNetworksExecution>{execution});
+    return;
+  }
+
+  delete execution;
+}
 
 int ANeuralNetworksExecution_setInputFromMemory(ANeuralNetworksExecution *execution, int32_t index,
                                                 const ANeuralNetworksOperandType *type,
@@ -318,6 +369,12 @@ int ANeuralNetworksExecution_setInputFromMemory(ANeuralNetworksExecution *execut
     return ANEURALNETWORKS_BAD_DATA;
   }
 
+  // The range bound before was validated then, and is kept as it is
+  if (type == nullptr && execution->isInputBound(index, memory, offset, length))
+  {
+    return ANEURALNETWORKS_NO_ERROR;
+  }
+
   const auto operand_index = execution->getInputOperandIndex(index);
   if (!operand_index.valid())
   {
@@ -372,6 +429,7 @@ int ANeuralNetworksExecution_setInputFromMemory(ANeuralNetworksExecution *execut
     VERBOSE(NNAPI::Execution) << "setInputFromMemory: Fail to set input" << std::endl;
     return ANEURALNETWORKS_BAD_DATA;
   }
+  execution->bindInput(index, memory, offset, length);
 
   return ANEURALNETWORKS_NO_ERROR;
 }
@@ -394,6 +452,12 @@ int ANeuralNetworksExecution_setOutputFromMemory(ANeuralNetworksExecution *execu
     return ANEURALNETWORKS_BAD_DATA;
   }
 
+  // The range bound before was validated then, and is kept as it is
+  if (type == nullptr && execution->isOutputBound(index, memory, offset, length))
+  {
+    return ANEURALNETWORKS_NO_ERROR;
+  }
+
   const auto operand_index = execution->getOutputOperandIndex(index);
   if (!operand_index.valid())
   {
@@ -447,6 +511,7 @@ int ANeuralNetworksExecution_setOutputFromMemory(ANeuralNetworksExecution *execu
     VERBOSE(NNAPI::Execution) << "setOutputFromMemory: Fail to set input" << std::endl;
     return ANEURALNETWORKS_BAD_DATA;
   }
+  execution->bindOutput(index, memory, offset, length);
 
   return ANEURALNETWORKS_NO_ERROR;
 }
@@ -21,6 +21,7 @@
 
 #include <memory>
 #include "wrapper/ANeuralNetworksMemory.h"
+#include "util/logging.h"
 
 int ANeuralNetworksMemory_createFromFd(size_t size, int protect, int fd, size_t offset,
                                        ANeuralNetworksMemory **memory)
@@ -36,7 +37,49 @@ int ANeuralNetworksMemory_createFromFd(size_t size, int protect, int fd, size_t
     return ANEURALNETWORKS_OUT_OF_MEMORY;
   }
 
+  if (!(*memory)->valid())
+  {
+    VERBOSE(NNAPI::Memory) << "createFromFd: Fail to map the file" << std::endl;
+    delete *memory;
+    *memory = nullptr;
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
+  return ANEURALNETWORKS_NO_ERROR;
+}
+
+int ANeuralNetworksMemory_createFromAHardwareBuffer(const AHardwareBuffer *ahwb,
+                                                    ANeuralNetworksMemory **memory)
+{
+  if ((ahwb == nullptr) || (memory == nullptr))
+  {
+    return ANEURALNETWORKS_UNEXPECTED_NULL;
+  }
+
+#if defined(__ANDROID__) && (__ANDROID_API__ >= 26)
+  *memory = new (std::nothrow) ANeuralNetworksMemory{ahwb};
+  if (*memory == nullptr)
+  {
+    return ANEURALNETWORKS_OUT_OF_MEMORY;
+  }
+
+  if (!(*memory)->valid())
+  {
+    VERBOSE(NNAPI::Memory) << "createFromAHardwareBuffer: Only a BLOB that can be locked is "
+                              "supported"
+                           << std::endl;
+    delete *memory;
+    *memory = nullptr;
+    return ANEURALNETWORKS_BAD_DATA;
+  }
+
   return ANEURALNETWORKS_NO_ERROR;
+#else
+  VERBOSE(NNAPI::Memory) << "createFromAHardwareBuffer: Not supported on this platform"
+                         << std::endl;
+  *memory = nullptr;
+  return ANEURALNETWORKS_BAD_DATA;
+#endif
 }
 
 void ANeuralNetworksMemory_free(ANeuralNetworksMemory *memory) { delete memory; }
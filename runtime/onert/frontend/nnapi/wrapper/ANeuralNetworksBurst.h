@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __BURST_H__
+#define __BURST_H__
+
+#include <NeuralNetworks.h>
+
+#include <memory>
+#include <mutex>
+
+#include "ANeuralNetworksExecution.h"
+
+/**
+ * @brief Sequence of executions of a compilation run one at a time
+ *
+ * Executions of a compilation are reused through its pool, which the burst keeps alive.
+ */
+struct ANeuralNetworksBurst
+{
+public:
+  ANeuralNetworksBurst(const std::shared_ptr<ANeuralNetworksExecution::Pool> &pool)
+    : _pool{pool}
+  {
+    // DO NOTHING
+  }
+
+public:
+  const std::shared_ptr<ANeuralNetworksExecution::Pool> &executionPool() const noexcept
+  {
+    return _pool;
+  }
+  bool compute(ANeuralNetworksExecution *execution) noexcept;
+
+private:
+  std::shared_ptr<ANeuralNetworksExecution::Pool> _pool;
+  std::mutex _mutex;
+};
+
+#endif
@@ -16,13 +16,19 @@
 
 #include "ANeuralNetworksCompilation.h"
 
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
 // TODO Support multiple subgraphs
 ANeuralNetworksCompilation::ANeuralNetworksCompilation(const ANeuralNetworksModel *model) noexcept
   : _subgraphs{model->getSubGraphs()}, _tracing_ctx{std::make_unique<onert::util::TracingCtx>(
                                          _subgraphs.get())},
-    _compiler{new onert::compiler::Compiler{_subgraphs, _tracing_ctx.get()}}
+    _compiler{new onert::compiler::Compiler{_subgraphs, _tracing_ctx.get()}},
+    _execution_pool{std::make_shared<ANeuralNetworksExecution::Pool>()}
 {
   if (model->allowedToFp16())
   {
@@ -30,11 +36,33 @@ ANeuralNetworksCompilation::ANeuralNetworksCompilation(const ANeuralNetworksMode
   }
 }
 
+void ANeuralNetworksCompilation::setCaching(const std::string &cache_dir,
+                                            const uint8_t *token) noexcept
+{
+  std::ostringstream token_str;
+  token_str << std::hex << std::setfill('0');
+  for (uint32_t i = 0; i < ANEURALNETWORKS_BYTE_SIZE_OF_CACHE_TOKEN; ++i)
+    token_str << std::setw(2) << static_cast<uint32_t>(token[i]);
+
+  auto &options = _compiler->options();
+  options.compile_cache_dir = cache_dir;
+  options.compile_cache_token = token_str.str();
+}
+
 bool ANeuralNetworksCompilation::finish() noexcept
 {
   try
   {
     _executors = _compiler->compile();
+
+    // Executions started by many clients at once are run in batches
+    const auto max_batch = onert::util::getConfigInt(onert::util::config::EXECUTION_BATCH_SIZE);
+    if (max_batch > 1 && onert::exec::ExecutionBatcher::batchable(*_executors))
+    {
+      const auto timeout = onert::util::getConfigInt(onert::util::config::EXECUTION_BATCH_TIMEOUT);
+      _execution_batcher = std::make_shared<onert::exec::ExecutionBatcher>(
+        _executors, max_batch, std::max(timeout, 0));
+    }
   }
   catch (const std::exception &e)
   {
@@ -17,6 +17,7 @@
 #ifndef __COMPILATION_H__
 #define __COMPILATION_H__
 
+#include "ANeuralNetworksExecution.h"
 #include "ANeuralNetworksModel.h"
 
 #include "compiler/Compiler.h"
@@ -32,12 +33,32 @@ public:
 
 public:
   bool finish() noexcept;
+  /**
+   * @brief Keep the schedule of the compilation in a cache directory
+   *
+   * @param[in] cache_dir Directory to keep the cache in
+   * @param[in] token     Token of ANEURALNETWORKS_BYTE_SIZE_OF_CACHE_TOKEN bytes which the
+   *                      cache entry is keyed by, along with the model and the options
+   */
+  void setCaching(const std::string &cache_dir, const uint8_t *token) noexcept;
 
   onert::compiler::State state(void) noexcept { return _compiler->state(); }
   void publish(std::shared_ptr<onert::exec::ExecutorMap> &executors) noexcept
   {
     executors = _executors;
   }
+  const std::shared_ptr<ANeuralNetworksExecution::Pool> &executionPool() const noexcept
+  {
+    return _execution_pool;
+  }
+  /**
+   * @brief Get the batcher of runs of executions of the compilation
+   * @return Batcher, nullptr if EXECUTION_BATCH_SIZE is not set or the model is not batchable
+   */
+  const std::shared_ptr<onert::exec::ExecutionBatcher> &executionBatcher() const noexcept
+  {
+    return _execution_batcher;
+  }
 
 private:
   std::shared_ptr<onert::ir::Subgraphs> _subgraphs;
@@ -51,6 +72,9 @@ private:
 
   std::shared_ptr<onert::compiler::Compiler> _compiler;
   std::shared_ptr<onert::exec::ExecutorMap> _executors;
+  // Executions freed to be reused
+  std::shared_ptr<ANeuralNetworksExecution::Pool> _execution_pool;
+  std::shared_ptr<onert::exec::ExecutionBatcher> _execution_batcher;
 };
 
 #endif
@@ -15,6 +15,7 @@
  */
 
 #include "ANeuralNetworksExecution.h"
+#include "ANeuralNetworksMemory.h"
 #include "NNAPIConvert.h"
 #include "util/logging.h"
 
@@ -148,6 +149,7 @@ bool ANeuralNetworksExecution::setInput(uint32_t index, const ANeuralNetworksOpe
     // model.
     // TODO Set layout of model
     _execution->setInput(input_index, type_info, shape, buffer, length, onert::ir::Layout::NHWC);
+    _input_bindings.erase(index);
   }
   catch (const std::exception &e)
   {
@@ -216,6 +218,7 @@ bool ANeuralNetworksExecution::setOutput(uint32_t index, const ANeuralNetworksOp
     // model.
     // TODO Set layout of model
     _execution->setOutput(output_index, type_info, shape, buffer, length, onert::ir::Layout::NHWC);
+    _output_bindings.erase(index);
   }
   catch (const std::exception &e)
   {
@@ -231,7 +234,10 @@ bool ANeuralNetworksExecution::startExecute(void) noexcept
 {
   try
   {
-    _execution->startExecute();
+    if (_batcher)
+      _batcher->startExecute(_execution);
+    else
+      _execution->startExecute();
   }
   catch (const std::exception &e)
   {
@@ -247,7 +253,14 @@ bool ANeuralNetworksExecution::execute(void) noexcept
 {
   try
   {
-    _execution->execute();
+    // Runs of other threads at the same time may join the batch of this run
+    if (_batcher)
+    {
+      _batcher->startExecute(_execution);
+      _execution->waitFinish();
+    }
+    else
+      _execution->execute();
   }
   catch (const std::exception &e)
   {
@@ -333,3 +346,85 @@ bool ANeuralNetworksExecution::getOutputOperandDimensions(uint32_t index, uint32
 
   return true;
 }
+
+ANeuralNetworksExecution::MemoryBinding
+ANeuralNetworksExecution::makeBinding(const ANeuralNetworksMemory *memory, size_t offset,
+                                      size_t length) noexcept
+{
+  return MemoryBinding{memory, memory->base(), memory->size(), offset, length};
+}
+
+bool ANeuralNetworksExecution::isBound(const std::unordered_map<uint32_t, MemoryBinding> &bindings,
+                                       int32_t index, const MemoryBinding &binding) noexcept
+{
+  if (index < 0)
+    return false;
+
+  const auto it = bindings.find(static_cast<uint32_t>(index));
+  if (it == bindings.end())
+    return false;
+
+  const auto &bound = it->second;
+  return bound.memory == binding.memory && bound.base == binding.base &&
+         bound.size == binding.size && bound.offset == binding.offset &&
+         bound.length == binding.length;
+}
+
+bool ANeuralNetworksExecution::isInputBound(int32_t index, const ANeuralNetworksMemory *memory,
+                                            size_t offset, size_t length) const noexcept
+{
+  return isBound(_input_bindings, index, makeBinding(memory, offset, length));
+}
+
+bool ANeuralNetworksExecution::isOutputBound(int32_t index, const ANeuralNetworksMemory *memory,
+                                             size_t offset, size_t length) const noexcept
+{
+  return isBound(_output_bindings, index, makeBinding(memory, offset, length));
+}
+
+void ANeuralNetworksExecution::bindInput(uint32_t index, const ANeuralNetworksMemory *memory,
+                                         size_t offset, size_t length) noexcept
+{
+  _input_bindings[index] = makeBinding(memory, offset, length);
+}
+
+void ANeuralNetworksExecution::bindOutput(uint32_t index, const ANeuralNetworksMemory *memory,
+                                          size_t offset, size_t length) noexcept
+{
+  _output_bindings[index] = makeBinding(memory, offset, length);
+}
+
+std::unique_ptr<ANeuralNetworksExecution> ANeuralNetworksExecution::Pool::take() noexcept
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  if (_executions.empty())
+    return nullptr;
+
+  auto execution = std::move(_executions.back());
+  _executions.pop_back();
+  return execution;
+}
+
+void ANeuralNetworksExecution::Pool::keep(
+  std::unique_ptr<ANeuralNetworksExecution> execution) noexcept
+{
+  // Enough for the executions a client runs at once
+  constexpr size_t max_kept = 4;
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  if (_executions.size() >= max_kept)
+  {
+    lock.unlock();
+    execution.reset();
+    return;
+  }
+
+  try
+  {
+    _executions.emplace_back(std::move(execution));
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(EXCEPTION) << e.what() << std::endl;
+  }
+}
@@ -20,14 +20,48 @@
 #include <NeuralNetworks.h>
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "exec/Execution.h"
+#include "exec/ExecutionBatcher.h"
+
+struct ANeuralNetworksMemory;
 
 struct ANeuralNetworksExecution
 {
 public:
-  ANeuralNetworksExecution(const std::shared_ptr<onert::exec::ExecutorMap> &executors)
-    : _execution{std::make_shared<onert::exec::Execution>(executors)}
+  /**
+   * @brief Executions freed to be reused by the next ones of the same compilation
+   *
+   * Reused ones keep their execution state and memory bindings, so creating an execution per
+   * inference costs nothing after the first ones.
+   */
+  class Pool
+  {
+  public:
+    /**
+     * @brief Take an execution kept before
+     * @return Execution, nullptr if none is kept
+     */
+    std::unique_ptr<ANeuralNetworksExecution> take() noexcept;
+    /**
+     * @brief Keep a freed execution, or delete it if enough are kept
+     */
+    void keep(std::unique_ptr<ANeuralNetworksExecution> execution) noexcept;
+
+  private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<ANeuralNetworksExecution>> _executions;
+  };
+
+public:
+  ANeuralNetworksExecution(const std::shared_ptr<onert::exec::ExecutorMap> &executors,
+                           const std::shared_ptr<Pool> &pool = nullptr,
+                           const std::shared_ptr<onert::exec::ExecutionBatcher> &batcher = nullptr)
+    : _execution{std::make_shared<onert::exec::Execution>(executors)}, _pool{pool},
+      _batcher{batcher}
   {
     // DO NOTHING
   }
@@ -52,6 +86,15 @@ public:
   bool hasUnspecifiedDims(const onert::ir::OperandIndex index) noexcept;
   size_t getOperandSize(const onert::ir::OperandIndex index) noexcept;
   const std::shared_ptr<onert::exec::Execution> instance(void) noexcept;
+  /**
+   * @brief Get the pool of the compilation this execution is created from
+   * @return Pool, nullptr if the compilation is freed
+   */
+  std::shared_ptr<Pool> pool(void) const noexcept { return _pool.lock(); }
+  /**
+   * @brief Check no event is waiting for this execution
+   */
+  bool isIdle(void) const noexcept { return _execution.use_count() == 1; }
 
   /**
    * @brief       Get output operand's rank
@@ -70,8 +113,43 @@ public:
    */
   bool getOutputOperandDimensions(uint32_t index, uint32_t *dimensions);
 
+  /**
+   * @brief     Check an input is bound to a range of memory already
+   * @note      A binding is validated once, and then used as it is by later executions
+   */
+  bool isInputBound(int32_t index, const ANeuralNetworksMemory *memory, size_t offset,
+                    size_t length) const noexcept;
+  bool isOutputBound(int32_t index, const ANeuralNetworksMemory *memory, size_t offset,
+                     size_t length) const noexcept;
+  void bindInput(uint32_t index, const ANeuralNetworksMemory *memory, size_t offset,
+                 size_t length) noexcept;
+  void bindOutput(uint32_t index, const ANeuralNetworksMemory *memory, size_t offset,
+                  size_t length) noexcept;
+
+private:
+  struct MemoryBinding
+  {
+    const ANeuralNetworksMemory *memory;
+    // Memory freed and created again may have the same address, but not the same mapping
+    const uint8_t *base;
+    size_t size;
+    size_t offset;
+    size_t length;
+  };
+  static MemoryBinding makeBinding(const ANeuralNetworksMemory *memory, size_t offset,
+                                   size_t length) noexcept;
+  static bool isBound(const std::unordered_map<uint32_t, MemoryBinding> &bindings, int32_t index,
+                      const MemoryBinding &binding) noexcept;
+
 private:
   std::shared_ptr<onert::exec::Execution> _execution;
+  // Not owned, as the pool keeps executions
+  std::weak_ptr<Pool> _pool;
+  // Batcher of runs of executions of the compilation, nullptr if runs are not batched
+  std::shared_ptr<onert::exec::ExecutionBatcher> _batcher;
+  // Inputs and outputs bound to memory, which setting another buffer unbinds
+  std::unordered_map<uint32_t, MemoryBinding> _input_bindings;
+  std::unordered_map<uint32_t, MemoryBinding> _output_bindings;
 };
 
 #endif
@@ -17,18 +17,63 @@
 #include <NeuralNetworks.h>
 #include <sys/mman.h>
 
+#if defined(__ANDROID__) && (__ANDROID_API__ >= 26)
+#include <android/hardware_buffer.h>
+#endif
+
 #include "ANeuralNetworksMemory.h"
 
 //
 // ANeuralNetworksMemory
 //
 ANeuralNetworksMemory::ANeuralNetworksMemory(size_t size, int protect, int fd, size_t offset)
+  : _size{size}, _base{nullptr}, _ahwb{nullptr}
+{
+  // Outputs written to the memory must reach the other mappings of the file
+  void *base = mmap(nullptr, size, protect, MAP_SHARED, fd, offset);
+  if (base != MAP_FAILED)
+    _base = reinterpret_cast<uint8_t *>(base);
+}
+
+#if defined(__ANDROID__) && (__ANDROID_API__ >= 26)
+ANeuralNetworksMemory::ANeuralNetworksMemory(const AHardwareBuffer *ahwb)
+  : _size{0}, _base{nullptr}, _ahwb{nullptr}
 {
-  _base = reinterpret_cast<uint8_t *>(mmap(nullptr, size, protect, MAP_PRIVATE, fd, offset));
-  _size = size;
+  // Only a BLOB is a plain range of bytes, whose width is its size
+  AHardwareBuffer_Desc desc;
+  AHardwareBuffer_describe(ahwb, &desc);
+  if (desc.format != AHARDWAREBUFFER_FORMAT_BLOB)
+    return;
+
+  auto buffer = const_cast<AHardwareBuffer *>(ahwb);
+  void *base = nullptr;
+  const uint64_t usage =
+    AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN | AHARDWAREBUFFER_USAGE_CPU_WRITE_OFTEN;
+  if (AHardwareBuffer_lock(buffer, usage, -1, nullptr, &base) != 0 || base == nullptr)
+    return;
+
+  AHardwareBuffer_acquire(buffer);
+  _ahwb = buffer;
+  _base = reinterpret_cast<uint8_t *>(base);
+  _size = desc.width;
 }
+#endif
 
-ANeuralNetworksMemory::~ANeuralNetworksMemory() { munmap(reinterpret_cast<void *>(_base), _size); }
+ANeuralNetworksMemory::~ANeuralNetworksMemory()
+{
+  if (_base == nullptr)
+    return;
+
+#if defined(__ANDROID__) && (__ANDROID_API__ >= 26)
+  if (_ahwb != nullptr)
+  {
+    AHardwareBuffer_unlock(_ahwb, nullptr);
+    AHardwareBuffer_release(_ahwb);
+    return;
+  }
+#endif
+  munmap(reinterpret_cast<void *>(_base), _size);
+}
 
 bool ANeuralNetworksMemory::vaildAccess(size_t offset, size_t length) const
 {
@@ -37,7 +82,8 @@ bool ANeuralNetworksMemory::vaildAccess(size_t offset, size_t length) const
     return false;
   }
 
-  if ((offset + length) >= _size)
+  // The range may end at the end of the memory
+  if (length > _size - offset)
   {
     return false;
   }
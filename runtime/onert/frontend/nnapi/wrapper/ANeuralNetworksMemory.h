@@ -17,23 +17,43 @@
 #ifndef __MEMORY_H__
 #define __MEMORY_H__
 
+#include <NeuralNetworks.h>
+
 #include <cstdint>
 
 struct ANeuralNetworksMemory
 {
 public:
+  /**
+   * @brief Map a range of a file shared with other users of it, like the driver of the memory
+   */
   ANeuralNetworksMemory(size_t size, int protect, int fd, size_t offset);
+#if defined(__ANDROID__) && (__ANDROID_API__ >= 26)
+  /**
+   * @brief Lock a BLOB AHardwareBuffer for CPU access while the memory lives
+   */
+  explicit ANeuralNetworksMemory(const AHardwareBuffer *ahwb);
+#endif
   ~ANeuralNetworksMemory();
 
+  ANeuralNetworksMemory(const ANeuralNetworksMemory &) = delete;
+  ANeuralNetworksMemory &operator=(const ANeuralNetworksMemory &) = delete;
+
 public:
   size_t size(void) const { return _size; }
   uint8_t *base(void) { return _base; }
   uint8_t *base(void) const { return _base; }
+  /**
+   * @brief Check the memory was mapped or locked successfully
+   */
+  bool valid(void) const { return _base != nullptr; }
   bool vaildAccess(size_t offset, size_t length) const;
 
 private:
   size_t _size;
   uint8_t *_base;
+  // Hardware buffer locked for the memory, nullptr if it is mapped from a file
+  AHardwareBuffer *_ahwb;
 };
 
 #endif // __MEMORY_H__
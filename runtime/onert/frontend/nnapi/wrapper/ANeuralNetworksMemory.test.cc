@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ANeuralNetworksMemory.h"
+
+#include <cstdio>
+#include <sys/mman.h>
+#include <unistd.h>
+
+TEST(MEMORY, access_to_end)
+{
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+  const int fd = fileno(file);
+  ASSERT_EQ(ftruncate(fd, 64), 0);
+
+  ANeuralNetworksMemory memory{64, PROT_READ | PROT_WRITE, fd, 0};
+  ASSERT_TRUE(memory.valid());
+  ASSERT_TRUE(memory.vaildAccess(0, 64));
+  ASSERT_TRUE(memory.vaildAccess(60, 4));
+  ASSERT_FALSE(memory.vaildAccess(60, 8));
+  ASSERT_FALSE(memory.vaildAccess(64, 0));
+
+  // Writes reach the file, as outputs must reach the other users of it
+  memory.base()[0] = 42;
+  uint8_t value = 0;
+  ASSERT_EQ(pread(fd, &value, 1, 0), 1);
+  ASSERT_EQ(value, 42);
+
+  fclose(file);
+}
+
+TEST(MEMORY, neg_invalid_fd)
+{
+  ANeuralNetworksMemory memory{64, PROT_READ, -1, 0};
+  ASSERT_FALSE(memory.valid());
+}
@@ -60,6 +60,12 @@ struct LoaderDomain
   {
     return onert_tflite::VerifyModelBuffer(verifier);
   }
+  static constexpr const char *WEIGHT_FILE_METADATA = "ONE_weight_file";
+  // Metadata with offsets of tensors planned ahead, e.g. by circle-execution-plan
+  static constexpr const char *TENSOR_OFFSET_METADATA = "ONE_tensor_offset_table";
+  static constexpr const char *EXECUTION_ORDER_METADATA = "ONE_execution_order_table";
+  // TFLite buffers have their data only in the flatbuffer
+  static bool getExternalBuffer(const Buffer *, uint64_t &, uint64_t &) { return false; }
 };
 
 class TFLiteLoader final : public base_loader::BaseLoader<LoaderDomain>
@@ -90,11 +96,7 @@ private:
   {
     auto subg = std::make_unique<ir::Graph>();
     // Load tensors
-    _tensor_to_operand.resize(tflite_subg->tensors()->size());
-    for (flatbuffers::uoffset_t i = 0; i < tflite_subg->tensors()->size(); ++i)
-    {
-      _tensor_to_operand[i] = loadOperand(tflite_subg->tensors()->Get(i), *subg);
-    }
+    loadOperands(tflite_subg, *subg);
     // Set inputs
     for (const std::int32_t input_ind : *tflite_subg->inputs())
     {
@@ -108,6 +110,7 @@ private:
                       _tensor_names->at(_tensor_to_operand[output_ind]));
     }
     // Create operations
+    subg->operations().reserve(tflite_subg->operators()->size());
     for (const auto *op : *tflite_subg->operators())
     {
       loadOperation(op, *subg);
@@ -19,10 +19,15 @@
 #include "NeuralNetworksOEM.h"
 #endif
 #include <gtest/gtest.h>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <sys/mman.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <vector>
 // Note: onert is allow to set activation operand constant only,
 //       so we change test to set operand #2 to constant. (ANEURALNETWORKS_FUSED_NONE)
 //       And model's input is changed: [0, 1, 2] -> [0, 1]
@@ -470,6 +475,81 @@ TEST_F(ValidationTestCompilation, Finish) {
     EXPECT_EQ(ANeuralNetworksCompilation_finish(mCompilation), ANEURALNETWORKS_BAD_STATE);
 }
 
+namespace {
+std::vector<std::string> listCacheFiles(const std::string& dir) {
+    std::vector<std::string> files;
+    DIR* stream = opendir(dir.c_str());
+    if (stream == nullptr) return files;
+    while (dirent* entry = readdir(stream)) {
+        const std::string name = entry->d_name;
+        if (name != "." && name != "..") files.push_back(dir + "/" + name);
+    }
+    closedir(stream);
+    return files;
+}
+}  // namespace
+
+TEST_F(ValidationTestCompilation, SetCaching) {
+    std::vector<uint8_t> token(ANEURALNETWORKS_BYTE_SIZE_OF_CACHE_TOKEN, 0);
+    char cacheDirTemp[] = "/tmp/TestCompilationCachingXXXXXX";
+    const char* cacheDir = mkdtemp(cacheDirTemp);
+    ASSERT_NE(cacheDir, nullptr);
+
+    EXPECT_EQ(ANeuralNetworksCompilation_setCaching(nullptr, cacheDir, token.data()),
+              ANEURALNETWORKS_UNEXPECTED_NULL);
+    EXPECT_EQ(ANeuralNetworksCompilation_setCaching(mCompilation, nullptr, token.data()),
+              ANEURALNETWORKS_UNEXPECTED_NULL);
+    EXPECT_EQ(ANeuralNetworksCompilation_setCaching(mCompilation, cacheDir, nullptr),
+              ANEURALNETWORKS_UNEXPECTED_NULL);
+
+    ASSERT_EQ(ANeuralNetworksCompilation_setCaching(mCompilation, cacheDir, token.data()),
+              ANEURALNETWORKS_NO_ERROR);
+    ASSERT_EQ(ANeuralNetworksCompilation_finish(mCompilation), ANEURALNETWORKS_NO_ERROR);
+    EXPECT_EQ(ANeuralNetworksCompilation_setCaching(mCompilation, cacheDir, token.data()),
+              ANEURALNETWORKS_BAD_STATE);
+    auto files = listCacheFiles(cacheDir);
+    ASSERT_EQ(files.size(), 1u);
+
+    // Mark the cached schedule, which is rewritten only when compiling misses the cache
+    std::string contents;
+    {
+        std::ifstream stream(files[0]);
+        contents.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+    ASSERT_EQ(contents.front(), '{');
+    contents.insert(1, "\"marker\" : true,");
+    std::ofstream(files[0]) << contents;
+
+    auto compile = [this, cacheDir](const std::vector<uint8_t>& token) {
+        ANeuralNetworksCompilation* compilation = nullptr;
+        ASSERT_EQ(ANeuralNetworksCompilation_create(mModel, &compilation),
+                  ANEURALNETWORKS_NO_ERROR);
+        ASSERT_EQ(ANeuralNetworksCompilation_setCaching(compilation, cacheDir, token.data()),
+                  ANEURALNETWORKS_NO_ERROR);
+        ASSERT_EQ(ANeuralNetworksCompilation_finish(compilation), ANEURALNETWORKS_NO_ERROR);
+        ANeuralNetworksCompilation_free(compilation);
+    };
+
+    // The same token hits the cache
+    compile(token);
+    ASSERT_EQ(listCacheFiles(cacheDir).size(), 1u);
+    {
+        std::ifstream stream(files[0]);
+        std::string reread{std::istreambuf_iterator<char>(stream),
+                           std::istreambuf_iterator<char>()};
+        EXPECT_NE(reread.find("marker"), std::string::npos);
+    }
+
+    // Another token misses it
+    std::vector<uint8_t> other_token(ANEURALNETWORKS_BYTE_SIZE_OF_CACHE_TOKEN, 1);
+    compile(other_token);
+    files = listCacheFiles(cacheDir);
+    EXPECT_EQ(files.size(), 2u);
+
+    for (const auto& file : files) unlink(file.c_str());
+    rmdir(cacheDir);
+}
+
 TEST_F(ValidationTestExecution, SetInput) {
     ANeuralNetworksExecution* execution;
     EXPECT_EQ(ANeuralNetworksExecution_create(mCompilation, &execution), ANEURALNETWORKS_NO_ERROR);
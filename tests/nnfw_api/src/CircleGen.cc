@@ -525,6 +525,13 @@ uint32_t CircleGen::addOperatorIf(const OperatorParams &params, uint32_t then_su
                                 circle::BuiltinOptions_IfOptions, options);
 }
 
+uint32_t CircleGen::addOperatorGelu(const OperatorParams &params, bool approximate)
+{
+  auto options = circle::CreateGeluOptions(_fbb, approximate).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_GELU,
+                                circle::BuiltinOptions_GeluOptions, options);
+}
+
 uint32_t CircleGen::addOperatorInstanceNorm(const OperatorParams &params, float epsilon,
                                             circle::ActivationFunctionType actfn)
 {
@@ -533,6 +540,13 @@ uint32_t CircleGen::addOperatorInstanceNorm(const OperatorParams &params, float
                                 circle::BuiltinOptions_InstanceNormOptions, options);
 }
 
+uint32_t CircleGen::addOperatorLayerNorm(const OperatorParams &params, float epsilon)
+{
+  auto options = circle::CreateLayerNormOptions(_fbb, epsilon).Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_LAYER_NORM,
+                                circle::BuiltinOptions_LayerNormOptions, options);
+}
+
 uint32_t CircleGen::addOperatorTranspose(const OperatorParams &params)
 {
   auto options = circle::CreateTransposeOptions(_fbb).Union();
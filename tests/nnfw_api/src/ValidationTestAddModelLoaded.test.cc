@@ -246,3 +246,57 @@ TEST_F(ValidationTestAddModelLoaded, neg_debug_get_config)
   ASSERT_EQ(nnfw_get_config(_session, "", buf, sizeof(buf)), NNFW_STATUS_ERROR);
   ASSERT_EQ(nnfw_get_config(_session, "BAD_KEY", buf, sizeof(buf)), NNFW_STATUS_ERROR);
 }
+
+TEST_F(ValidationTestAddModelLoaded, neg_warmup)
+{
+  // Not prepared yet
+  ASSERT_EQ(nnfw_warmup(_session, 1), NNFW_STATUS_INVALID_STATE);
+}
+
+TEST_F(ValidationTestAddModelLoaded, query_run_stats)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_set_config(_session, "RUN_STATS", "1"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+
+  float input = 3.0;
+  float output = 0;
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &input, sizeof(input)));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, &output, sizeof(output)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  ASSERT_FLOAT_EQ(output, 5.0);
+
+  nnfw_run_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_query_run_stats(_session, &stats));
+  ASSERT_GE(stats.num_backends, 1);
+  uint64_t backend_us = 0;
+  for (uint32_t i = 0; i < stats.num_backends; ++i)
+    backend_us += stats.backends[i].time_us;
+  ASSERT_LE(backend_us + stats.permute_us, stats.total_us);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_query_run_stats)
+{
+  nnfw_run_stats stats;
+  // Not prepared yet
+  ASSERT_EQ(nnfw_query_run_stats(_session, &stats), NNFW_STATUS_INVALID_STATE);
+
+  // RUN_STATS is not set
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(_session));
+  ASSERT_EQ(nnfw_query_run_stats(_session, &stats), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_query_run_stats(_session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_set_priority)
+{
+  // Not prepared yet
+  ASSERT_EQ(nnfw_set_priority(_session, 1), NNFW_STATUS_INVALID_STATE);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_clone_session)
+{
+  // Not prepared yet
+  nnfw_session *clone = nullptr;
+  ASSERT_EQ(nnfw_clone_session(_session, &clone), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(nnfw_clone_session(_session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
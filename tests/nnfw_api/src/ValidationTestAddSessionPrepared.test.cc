@@ -17,6 +17,9 @@
 #include "fixtures.h"
 #include "NNPackages.h"
 
+#include <future>
+#include <thread>
+
 using ValidationTestAddSessionPrepared = ValidationTestSessionPrepared<NNPackages::ADD>;
 
 TEST_F(ValidationTestAddSessionPrepared, run)
@@ -70,6 +73,101 @@ TEST_F(ValidationTestAddSessionPrepared, run_async)
   ASSERT_FLOAT_EQ(_output[0], 5.0);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, run_async_with_callback)
+{
+  SetInOutBuffers();
+  _input[0] = 3.0;
+
+  std::promise<NNFW_STATUS> finished;
+  auto callback = [](nnfw_session *, NNFW_STATUS status, void *user_data) {
+    static_cast<std::promise<NNFW_STATUS> *>(user_data)->set_value(status);
+  };
+  NNFW_ENSURE_SUCCESS(nnfw_run_async_with_callback(_session, callback, &finished));
+  ASSERT_EQ(finished.get_future().get(), NNFW_STATUS_NO_ERROR);
+  NNFW_ENSURE_SUCCESS(nnfw_await(_session));
+  ASSERT_FLOAT_EQ(_output[0], 5.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, warmup)
+{
+  SetInOutBuffers();
+  _input[0] = 3.0;
+  _output[0] = -1.0;
+  NNFW_ENSURE_SUCCESS(nnfw_warmup(_session, 2));
+  // Buffers set by users are not touched
+  ASSERT_FLOAT_EQ(_output[0], -1.0);
+
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  ASSERT_FLOAT_EQ(_output[0], 5.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_warmup_zero_runs)
+{
+  ASSERT_EQ(nnfw_warmup(_session, 0), NNFW_STATUS_ERROR);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, set_priority)
+{
+  SetInOutBuffers();
+  _input[0] = 3.0;
+  NNFW_ENSURE_SUCCESS(nnfw_set_priority(_session, 10));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  ASSERT_FLOAT_EQ(_output[0], 5.0);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_clone)
+{
+  nnfw_session *clone = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_clone_session(_session, &clone));
+
+  float clone_input = 7.0f;
+  float clone_output = 0.0f;
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_input(clone, 0, NNFW_TYPE_TENSOR_FLOAT32, &clone_input, sizeof(clone_input)));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_output(clone, 0, NNFW_TYPE_TENSOR_FLOAT32, &clone_output, sizeof(clone_output)));
+
+  SetInOutBuffers();
+  _input[0] = 3.0;
+  NNFW_ENSURE_SUCCESS(nnfw_run_async(clone));
+  NNFW_ENSURE_SUCCESS(nnfw_run(_session));
+  NNFW_ENSURE_SUCCESS(nnfw_await(clone));
+  ASSERT_FLOAT_EQ(_output[0], 5.0);
+  ASSERT_FLOAT_EQ(clone_output, 9.0);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(clone));
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_batcher)
+{
+  nnfw_batcher *batcher = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_batcher(_session, 4, 1000, &batcher));
+
+  constexpr int num_requests = 8;
+  std::array<float, num_requests> inputs;
+  std::array<float, num_requests> outputs;
+  std::array<NNFW_STATUS, num_requests> statuses;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_requests; i++)
+  {
+    inputs[i] = i;
+    threads.emplace_back([&, i]() {
+      const void *input = &inputs[i];
+      void *output = &outputs[i];
+      statuses[i] = nnfw_batcher_run(batcher, &input, &output);
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int i = 0; i < num_requests; i++)
+  {
+    ASSERT_EQ(statuses[i], NNFW_STATUS_NO_ERROR);
+    ASSERT_FLOAT_EQ(outputs[i], i + 2.0);
+  }
+  NNFW_ENSURE_SUCCESS(nnfw_close_batcher(batcher));
+}
+
 TEST_F(ValidationTestAddSessionPrepared, set_input_001)
 {
   char input[32];
@@ -539,3 +539,50 @@ TEST_F(ValidationTestPipelineSession, run_pipeline)
 
   SUCCEED();
 }
+
+TEST_F(ValidationTestPipelineSession, pipeline_stage_time)
+{
+  std::vector<void *> dummy1;
+  std::vector<uint32_t> dummy2;
+
+  build_partition_map();
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_model_from_modelfile(
+    _session, NNPackages::get().getModelAbsoluteFilePath("mobilenet_v1_1.0_224").c_str()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_pipeline(_session, "./partition_map.json"));
+
+  // No stage has run yet
+  uint64_t time_us = 1;
+  NNFW_ENSURE_SUCCESS(nnfw_pipeline_stage_time(_session, 0, &time_us));
+  ASSERT_EQ(time_us, 0);
+
+  NNFW_ENSURE_SUCCESS(nnfw_push_pipeline_input(_session, &dummy1, &dummy2));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session));
+
+  remove("./partition_map.json");
+}
+
+TEST_F(ValidationTestPipelineSession, neg_pipeline_stage_time)
+{
+  std::vector<void *> dummy1;
+  std::vector<uint32_t> dummy2;
+
+  build_partition_map();
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_model_from_modelfile(
+    _session, NNPackages::get().getModelAbsoluteFilePath("mobilenet_v1_1.0_224").c_str()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_pipeline(_session, "./partition_map.json"));
+
+  uint64_t time_us;
+  ASSERT_EQ(nnfw_pipeline_stage_time(_session, 1000, &time_us), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_pipeline_stage_time(_session, 0, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+
+  NNFW_ENSURE_SUCCESS(nnfw_push_pipeline_input(_session, &dummy1, &dummy2));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session));
+
+  remove("./partition_map.json");
+}
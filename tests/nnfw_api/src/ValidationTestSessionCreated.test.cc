@@ -17,6 +17,10 @@
 #include "NNPackages.h"
 #include "fixtures.h"
 
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
 TEST_F(ValidationTestSessionCreated, load_session_001)
 {
   // Existing model must
@@ -72,6 +76,35 @@ TEST_F(ValidationTestSessionCreated, neg_load_invalid_package_2)
   ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_INVALID_STATE);
 }
 
+TEST_F(ValidationTestSessionCreated, neg_load_corrupt_model_not_trusted)
+{
+  CircleGen cgen;
+  int lhs = cgen.addTensor({{1}, circle::TensorType::TensorType_FLOAT32});
+  int rhs = cgen.addTensor({{1}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{1}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+  auto cbuf = cgen.finish();
+
+  // CircleGen does not write the file identifier, so only the verifier rejects the model
+  const auto path = testing::TempDir() + "neg_load_corrupt_model_not_trusted.circle";
+  const auto sidecar_path = path + ".verified";
+  {
+    std::ofstream file{path, std::ios::binary};
+    file.write(reinterpret_cast<const char *>(cbuf.buffer()), cbuf.size());
+  }
+  std::remove(sidecar_path.c_str());
+
+  // The model still loads as before, but it is never recorded as trusted and verified every time
+  setenv("TRUSTED_MODEL", "1", 1);
+  const auto status = nnfw_load_model_from_modelfile(_session, path.c_str());
+  unsetenv("TRUSTED_MODEL");
+  ASSERT_EQ(status, NNFW_STATUS_NO_ERROR);
+  ASSERT_FALSE(std::ifstream{sidecar_path}.good());
+
+  std::remove(path.c_str());
+}
+
 TEST_F(ValidationTestSessionCreated, neg_prepare_001)
 {
   // nnfw_load_model_from_file was not called
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_Gelu)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorGelu({{in}, {out}}, false);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{-3.0, -1.0, -0.5, 0.0, 0.5, 1.0, 2.0, 3.0}},
+    {{-0.004050, -0.158655, -0.154269, 0.0, 0.345731, 0.841345, 1.954500, 2.995950}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_Gelu_Approximate)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorGelu({{in}, {out}}, true);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{-3.0, -1.0, -0.5, 0.0, 0.5, 1.0, 2.0, 3.0}},
+    {{-0.003637, -0.158808, -0.154286, 0.0, 0.345714, 0.841192, 1.954598, 2.996363}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_Gelu_InvalidType)
+{
+  CircleGen cgen;
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_UINT8});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  cgen.addOperatorGelu({{in}, {out}}, false);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailModelLoad();
+
+  SUCCEED();
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "GenModelTest.h"
+
+TEST_F(GenModelTest, OneOp_LayerNorm)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{1, 2, 1, 1});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0, 0, 1, -1});
+  int gamma = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorLayerNorm({{in, gamma, beta}, {out}}, 1e-5f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>(
+    {{1, 2, 3, 4, -2, 0, 0, 6}},
+    {{-1.341635, -0.894424, 1.447212, 0.341635, -0.999999, -0.666666, 0.666667, 0.666666}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_LayerNorm_InvalidType)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{1, 2, 1, 1});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0, 0, 1, -1});
+  int gamma = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{4}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_UINT8});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorLayerNorm({{in, gamma, beta}, {out}}, 1e-5f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailModelLoad();
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_LayerNorm_WrongGammaDepth)
+{
+  CircleGen cgen;
+  uint32_t gamma_buf = cgen.addBuffer(std::vector<float>{1, 2});
+  uint32_t beta_buf = cgen.addBuffer(std::vector<float>{0, 0});
+  int gamma = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, gamma_buf});
+  int beta = cgen.addTensor({{2}, circle::TensorType::TensorType_FLOAT32, beta_buf});
+  int in = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+  int out = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorLayerNorm({{in, gamma, beta}, {out}}, 1e-5f);
+  cgen.setInputsAndOutputs({in}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
@@ -210,6 +210,13 @@ void Args::Initialize(void)
     ("num_runs,r", po::value<int>()->default_value(1)->notifier([&](const auto &v) { _num_runs = v; }), "The number of runs")
     ("warmup_runs,w", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _warmup_runs = v; }), "The number of warmup runs")
     ("run_delay,t", po::value<int>()->default_value(-1)->notifier([&](const auto &v) { _run_delay = v; }), "Delay time(us) between runs (as default no delay")
+    ("load_sessions", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _load_sessions = v; }),
+         "Number of sessions serving 'num_runs' requests concurrently\n"
+         "If given, latency percentiles and throughput are reported instead of run times\n"
+         "and '--write_report' generates {exec}-{nnpkg}-{backend}-load.csv.\n")
+    ("load_qps", po::value<double>()->default_value(0)->notifier([&](const auto &v) { _load_qps = v; }),
+         "Rate of requests arriving at sessions of '--load_sessions'\n"
+         "0: each session takes the next request as soon as it is free\n")
     ("gpumem_poll,g", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _gpumem_poll = v; }), "Check gpu memory polling separately")
     ("mem_poll,m", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _mem_poll = v; }), "Check memory polling")
     ("write_report,p", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _write_report = v; }),
@@ -57,6 +57,8 @@ public:
   const int getNumRuns(void) const { return _num_runs; }
   const int getWarmupRuns(void) const { return _warmup_runs; }
   const int getRunDelay(void) const { return _run_delay; }
+  const int getLoadSessions(void) const { return _load_sessions; }
+  const double getLoadQps(void) const { return _load_qps; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
   const bool getGpuMemoryPoll(void) const { return _gpumem_poll; }
   const bool getMemoryPoll(void) const { return _mem_poll; }
@@ -89,6 +91,8 @@ private:
   int _num_runs;
   int _warmup_runs;
   int _run_delay;
+  int _load_sessions;
+  double _load_qps;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
   bool _gpumem_poll;
   bool _mem_poll;
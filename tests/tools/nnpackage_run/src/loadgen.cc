@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+#include "nnfw.h"
+#include "nnfw_util.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace nnpkg_run
+{
+
+benchmark::LoadResult LoadGenerator::run(uint32_t requests, double qps)
+{
+  using Clock = std::chrono::steady_clock;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<Clock::time_point> arrivals;
+  uint32_t dispatched = 0;
+  std::vector<uint64_t> latencies;
+  latencies.reserve(requests);
+  Clock::time_point last_completion;
+
+  const auto start = Clock::now();
+  auto serve = [&](nnfw_session *session) {
+    while (true)
+    {
+      Clock::time_point arrival;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (qps > 0)
+        {
+          cv.wait(lock, [&]() { return !arrivals.empty() || dispatched == requests; });
+          if (arrivals.empty())
+            return;
+          arrival = arrivals.front();
+          arrivals.pop_front();
+        }
+        else
+        {
+          // Closed loop, where a request arrives as soon as a session is free
+          if (dispatched == requests)
+            return;
+          dispatched++;
+          arrival = Clock::now();
+        }
+      }
+
+      NNPR_ENSURE_STATUS(nnfw_run(session));
+
+      const auto completion = Clock::now();
+      std::lock_guard<std::mutex> lock(mutex);
+      latencies.push_back(
+        std::chrono::duration_cast<std::chrono::microseconds>(completion - arrival).count());
+      last_completion = std::max(last_completion, completion);
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (auto session : sessions_)
+    workers.emplace_back(serve, session);
+
+  if (qps > 0)
+  {
+    const std::chrono::duration<double> interval(1.0 / qps);
+    for (uint32_t i = 0; i < requests; ++i)
+    {
+      const auto arrival = start + std::chrono::duration_cast<Clock::duration>(interval * i);
+      std::this_thread::sleep_until(arrival);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        arrivals.push_back(arrival);
+        dispatched++;
+      }
+      cv.notify_one();
+    }
+    cv.notify_all();
+  }
+
+  for (auto &worker : workers)
+    worker.join();
+
+  const auto duration =
+    latencies.empty()
+      ? 0
+      : std::chrono::duration_cast<std::chrono::microseconds>(last_completion - start).count();
+  return benchmark::LoadResult(std::move(latencies), duration, sessions_.size(), qps);
+}
+
+} // namespace nnpkg_run
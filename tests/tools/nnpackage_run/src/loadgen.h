@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNPACKAGE_RUN_LOADGEN_H__
+#define __NNPACKAGE_RUN_LOADGEN_H__
+
+#include "benchmark/LoadResult.h"
+
+#include <vector>
+
+struct nnfw_session;
+
+namespace nnpkg_run
+{
+/**
+ * @brief Load generator sending requests to sessions which serve them concurrently
+ *
+ * Requests arrive at a target rate whether or not sessions keep up with it (open loop), and
+ * wait in a queue for a free session. The latency of a request is taken from its scheduled
+ * arrival, so the time spent queued behind a slow run is counted as well.
+ */
+class LoadGenerator
+{
+public:
+  LoadGenerator(const std::vector<nnfw_session *> &sessions) : sessions_(sessions) {}
+  /**
+   * @brief Send requests and wait until all of them are served
+   *
+   * @param requests Number of requests
+   * @param qps      Rate requests arrive at, or 0 to let each session take the next at once
+   */
+  benchmark::LoadResult run(uint32_t requests, double qps);
+
+private:
+  std::vector<nnfw_session *> sessions_;
+};
+} // namespace nnpkg_run
+
+#endif // __NNPACKAGE_RUN_LOADGEN_H__
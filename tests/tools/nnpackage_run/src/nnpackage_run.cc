@@ -17,12 +17,14 @@
 #include "allocation.h"
 #include "args.h"
 #include "benchmark.h"
+#include "benchmark/LoadResult.h"
 #if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
 #include "h5formatter.h"
 #endif
 #include "nnfw.h"
 #include "nnfw_util.h"
 #include "nnfw_internal.h"
+#include "loadgen.h"
 #include "randomgen.h"
 #include "rawformatter.h"
 #ifdef RUY_PROFILER
@@ -34,6 +36,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <libgen.h>
+#include <memory>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -123,7 +126,7 @@ int main(const int argc, char **argv)
       }
     };
 
-    auto setTensorInfo = [session](const TensorShapeMap &tensor_shape_map) {
+    auto setTensorInfo = [](nnfw_session *session, const TensorShapeMap &tensor_shape_map) {
       for (auto tensor_shape : tensor_shape_map)
       {
         auto ind = tensor_shape.first;
@@ -173,7 +176,7 @@ int main(const int argc, char **argv)
     if (args.getWhenToUseH5Shape() == WhenToUseH5Shape::PREPARE)
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForPrepare());
 #endif
-    setTensorInfo(args.getShapeMapForPrepare());
+    setTensorInfo(session, args.getShapeMapForPrepare());
 
     // prepare execution
 
@@ -188,7 +191,7 @@ int main(const int argc, char **argv)
         (!args.getLoadFilename().empty() && !args.shapeParamProvided()))
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForRun());
 #endif
-    setTensorInfo(args.getShapeMapForRun());
+    setTensorInfo(session, args.getShapeMapForRun());
 
     // prepare input
     std::vector<Allocation> inputs(num_inputs);
@@ -209,28 +212,64 @@ int main(const int argc, char **argv)
     // prepare output
     uint32_t num_outputs = 0;
     NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
-    std::vector<Allocation> outputs(num_outputs);
     auto output_sizes = args.getOutputSizes();
-    for (uint32_t i = 0; i < num_outputs; i++)
-    {
-      nnfw_tensorinfo ti;
-      uint64_t output_size_in_bytes = 0;
+    auto setOutputs = [&](nnfw_session *session, std::vector<Allocation> &outputs) {
+      for (uint32_t i = 0; i < num_outputs; i++)
       {
-        auto found = output_sizes.find(i);
-        if (found == output_sizes.end())
+        nnfw_tensorinfo ti;
+        NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+        uint64_t output_size_in_bytes = 0;
         {
-          NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
-          output_size_in_bytes = bufsize_for(&ti);
+          auto found = output_sizes.find(i);
+          if (found == output_sizes.end())
+          {
+            output_size_in_bytes = bufsize_for(&ti);
+          }
+          else
+          {
+            output_size_in_bytes = found->second;
+          }
         }
-        else
+        outputs[i].alloc(output_size_in_bytes);
+        NNPR_ENSURE_STATUS(
+          nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
+        NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+      }
+    };
+    std::vector<Allocation> outputs(num_outputs);
+    setOutputs(session, outputs);
+
+    // Other sessions of the load test share the inputs of the first one
+    const bool load_test = args.getLoadSessions() > 0;
+    std::vector<nnfw_session *> load_sessions;
+    std::vector<std::vector<Allocation>> load_outputs(std::max(args.getLoadSessions() - 1, 0));
+    if (load_test)
+    {
+      load_sessions.push_back(session);
+      for (auto &session_outputs : load_outputs)
+      {
+        nnfw_session *load_session = nullptr;
+        NNPR_ENSURE_STATUS(nnfw_create_session(&load_session));
+        NNPR_ENSURE_STATUS(nnfw_load_model_from_file(load_session, nnpackage_path.c_str()));
+        if (available_backends)
+          NNPR_ENSURE_STATUS(nnfw_set_available_backends(load_session, available_backends));
+        setTensorInfo(load_session, args.getShapeMapForPrepare());
+        NNPR_ENSURE_STATUS(nnfw_prepare(load_session));
+        setTensorInfo(load_session, args.getShapeMapForRun());
+        for (uint32_t i = 0; i < num_inputs; i++)
         {
-          output_size_in_bytes = found->second;
+          nnfw_tensorinfo ti;
+          NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(load_session, i, &ti));
+          NNPR_ENSURE_STATUS(
+            nnfw_set_input(load_session, i, ti.dtype, inputs[i].data(), bufsize_for(&ti)));
+          NNPR_ENSURE_STATUS(nnfw_set_input_layout(load_session, i, NNFW_LAYOUT_CHANNELS_LAST));
         }
+        session_outputs.resize(num_outputs);
+        setOutputs(load_session, session_outputs);
+        for (int n = 0; n < args.getWarmupRuns(); n++)
+          NNPR_ENSURE_STATUS(nnfw_run(load_session));
+        load_sessions.push_back(load_session);
       }
-      outputs[i].alloc(output_size_in_bytes);
-      NNPR_ENSURE_STATUS(
-        nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
-      NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
     }
 
     // NOTE: Measuring memory can't avoid taking overhead. Therefore, memory will be measured on the
@@ -241,10 +280,11 @@ int main(const int argc, char **argv)
         "WARMUP",
         [&](const benchmark::Phase &, uint32_t) { NNPR_ENSURE_STATUS(nnfw_run(session)); },
         args.getWarmupRuns());
-      phases.run(
-        "EXECUTE",
-        [&](const benchmark::Phase &, uint32_t) { NNPR_ENSURE_STATUS(nnfw_run(session)); },
-        args.getNumRuns(), true);
+      if (!load_test)
+        phases.run(
+          "EXECUTE",
+          [&](const benchmark::Phase &, uint32_t) { NNPR_ENSURE_STATUS(nnfw_run(session)); },
+          args.getNumRuns(), true);
     }
     else
     {
@@ -257,15 +297,26 @@ int main(const int argc, char **argv)
                     << std::endl;
         },
         args.getWarmupRuns());
-      phases.run(
-        "EXECUTE",
-        [&](const benchmark::Phase &, uint32_t) { NNPR_ENSURE_STATUS(nnfw_run(session)); },
-        [&](const benchmark::Phase &phase, uint32_t nth) {
-          std::cout << "... "
-                    << "run " << nth + 1 << " takes " << phase.time[nth] / 1e3 << " ms"
-                    << std::endl;
-        },
-        args.getNumRuns(), true);
+      if (!load_test)
+        phases.run(
+          "EXECUTE",
+          [&](const benchmark::Phase &, uint32_t) { NNPR_ENSURE_STATUS(nnfw_run(session)); },
+          [&](const benchmark::Phase &phase, uint32_t nth) {
+            std::cout << "... "
+                      << "run " << nth + 1 << " takes " << phase.time[nth] / 1e3 << " ms"
+                      << std::endl;
+          },
+          args.getNumRuns(), true);
+    }
+
+    // Requests of the load test are served by all the sessions at once
+    std::unique_ptr<benchmark::LoadResult> load_result;
+    if (load_test)
+    {
+      load_result = std::make_unique<benchmark::LoadResult>(
+        LoadGenerator(load_sessions).run(args.getNumRuns(), args.getLoadQps()));
+      for (size_t n = 1; n < load_sessions.size(); n++)
+        NNPR_ENSURE_STATUS(nnfw_close_session(load_sessions[n]));
     }
 
 #if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
@@ -280,11 +331,17 @@ int main(const int argc, char **argv)
 
     // TODO Apply verbose level to result
 
-    // prepare result
-    benchmark::Result result(phases);
-
-    // to stdout
-    benchmark::printResult(result);
+    // prepare result and print it to stdout
+    std::unique_ptr<benchmark::Result> result;
+    if (load_test)
+    {
+      benchmark::printLoadResult(*load_result);
+    }
+    else
+    {
+      result = std::make_unique<benchmark::Result>(phases);
+      benchmark::printResult(*result);
+    }
 
     // to csv
     if (args.getWriteReport() == false)
@@ -309,7 +366,10 @@ int main(const int argc, char **argv)
       exec_basename = basename(argv[0]);
     }
 
-    benchmark::writeResult(result, exec_basename, nnpkg_basename, backend_name);
+    if (load_test)
+      benchmark::writeLoadResult(*load_result, exec_basename, nnpkg_basename, backend_name);
+    else
+      benchmark::writeResult(*result, exec_basename, nnpkg_basename, backend_name);
 
     return 0;
   }
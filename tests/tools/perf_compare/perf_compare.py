@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2022 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Compare nnpackage_run reports or traces of a baseline and a candidate.
+
+Reports are the csv files of '--write_report'. Each report is one sample of every figure, so
+several reports per side can be given, e.g. of nightly runs. Traces are the '.chrome.json' files
+of TRACE_FILEPATH, where each run of an operation is a sample of its latency.
+
+A figure regresses if it gets worse by more than the threshold and the change is significant:
+- With several samples on both sides, by Mann-Whitney U test (two-sided) at the given alpha
+- With one report on a side, if the change of the mean is beyond the stddev of both sides
+
+The exit code is 1 if any figure regresses, so that this can gate performance changes.
+"""
+
+import argparse
+import csv
+import json
+import math
+import sys
+from collections import defaultdict
+
+# Figures of a report to compare, and whether lower is better for them
+REPORT_FIGURES = [
+    "ModelLoad_Time", "Prepare_Time", "Execute_Time_Mean", "Execute_Time_P50",
+    "Execute_Time_P90", "Execute_Time_P99", "Peak_RSS", "Peak_HWM", "Peak_PSS"
+]
+
+
+def mean(values):
+    return sum(values) / len(values)
+
+
+def mann_whitney_p(xs, ys):
+    """Two-sided p-value of Mann-Whitney U test by normal approximation with tie correction"""
+    n1, n2 = len(xs), len(ys)
+    ranked = sorted([(v, 0) for v in xs] + [(v, 1) for v in ys])
+    ranks = [0.0] * len(ranked)
+    tie_term = 0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j + 1 < len(ranked) and ranked[j + 1][0] == ranked[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        ties = j - i + 1
+        tie_term += ties**3 - ties
+        i = j + 1
+
+    r1 = sum(rank for rank, (_, side) in zip(ranks, ranked) if side == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    sigma = math.sqrt(n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1))))
+    if sigma == 0:
+        return 1.0
+    z = (abs(u1 - n1 * n2 / 2.0) - 0.5) / sigma
+    return math.erfc(max(z, 0) / math.sqrt(2))
+
+
+class Comparison:
+    def __init__(self, name, base, new, base_stddev=None, new_stddev=None):
+        self.name = name
+        self.base = base
+        self.new = new
+        self.base_stddev = base_stddev
+        self.new_stddev = new_stddev
+
+    def change(self):
+        base = mean(self.base)
+        if base == 0:
+            return 0.0
+        return (mean(self.new) - base) / base * 100.0
+
+    def significant(self, alpha):
+        if len(self.base) > 1 and len(self.new) > 1:
+            return mann_whitney_p(self.base, self.new) < alpha
+        # Single reports have no samples but the stddev of runs
+        noise = math.sqrt((self.base_stddev or 0)**2 + (self.new_stddev or 0)**2)
+        return abs(mean(self.new) - mean(self.base)) > noise
+
+    def regressed(self, threshold, alpha):
+        return self.change() > threshold and self.significant(alpha)
+
+    def improved(self, threshold, alpha):
+        return self.change() < -threshold and self.significant(alpha)
+
+
+def read_report(path):
+    with open(path) as f:
+        rows = list(csv.DictReader(f))
+    if len(rows) != 1:
+        raise RuntimeError("{} does not have a row of results".format(path))
+    return {key: float(value) for key, value in rows[0].items() if is_number(value)}
+
+
+def is_number(value):
+    try:
+        float(value)
+        return True
+    except (TypeError, ValueError):
+        return False
+
+
+def compare_reports(base_paths, new_paths):
+    base = [read_report(path) for path in base_paths]
+    new = [read_report(path) for path in new_paths]
+
+    def stddev(reports, figure):
+        # Stddev of runs applies to execution time only
+        if len(reports) != 1 or not figure.startswith("Execute_Time"):
+            return None
+        return reports[0].get("Execute_Time_Stddev")
+
+    comparisons = []
+    for figure in REPORT_FIGURES:
+        base_values = [report[figure] for report in base if figure in report]
+        new_values = [report[figure] for report in new if figure in report]
+        if not base_values or not new_values:
+            continue
+        comparisons.append(
+            Comparison(figure, base_values, new_values, stddev(base, figure),
+                       stddev(new, figure)))
+    return comparisons
+
+
+def read_trace(path):
+    """Get latencies in us of each operation and subgraph, keyed by their thread and name"""
+    with open(path) as f:
+        events = json.load(f)["traceEvents"]
+
+    begins = defaultdict(list)
+    latencies = defaultdict(list)
+    for event in events:
+        if event.get("ph") not in ("B", "E"):
+            continue
+        key = "{} | {}".format(event["tid"], event["name"])
+        ts = float(event["ts"])
+        if event["ph"] == "B":
+            begins[key].append(ts)
+        elif begins[key]:
+            latencies[key].append(ts - begins[key].pop())
+    return latencies
+
+
+def compare_traces(base_paths, new_paths):
+    base = defaultdict(list)
+    new = defaultdict(list)
+    for path in base_paths:
+        for key, values in read_trace(path).items():
+            base[key] += values
+    for path in new_paths:
+        for key, values in read_trace(path).items():
+            new[key] += values
+
+    # Operations are aligned by session, subgraph, backend, operation index and name
+    comparisons = []
+    for key in sorted(base.keys() & new.keys()):
+        comparisons.append(Comparison(key, base[key], new[key]))
+    for key in sorted(base.keys() ^ new.keys()):
+        side = "baseline" if key in base else "candidate"
+        print("W: {} is only in the {}".format(key, side), file=sys.stderr)
+    return comparisons
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--base", nargs="+", required=True, help="reports or traces of baseline")
+    parser.add_argument("--new", nargs="+", required=True, help="reports or traces of candidate")
+    parser.add_argument("--threshold",
+                        type=float,
+                        default=5.0,
+                        help="change in %% to be a regression (default: 5)")
+    parser.add_argument("--alpha",
+                        type=float,
+                        default=0.01,
+                        help="significance level of the test (default: 0.01)")
+    parser.add_argument("--all", action="store_true", help="print unchanged figures as well")
+    args = parser.parse_args()
+
+    is_trace = [path.endswith(".json") for path in args.base + args.new]
+    if any(is_trace) and not all(is_trace):
+        parser.error("reports and traces cannot be compared with each other")
+
+    if all(is_trace):
+        comparisons = compare_traces(args.base, args.new)
+    else:
+        comparisons = compare_reports(args.base, args.new)
+
+    regressions = 0
+    print("{:>10} {:>14} {:>14} {:>9}  {}".format("status", "baseline", "candidate", "change",
+                                                  "figure"))
+    for comparison in comparisons:
+        if comparison.regressed(args.threshold, args.alpha):
+            status = "REGRESSED"
+            regressions += 1
+        elif comparison.improved(args.threshold, args.alpha):
+            status = "improved"
+        elif args.all:
+            status = "-"
+        else:
+            continue
+        print("{:>10} {:>14.2f} {:>14.2f} {:>8.2f}%  {}".format(
+            status, mean(comparison.base), mean(comparison.new), comparison.change(),
+            comparison.name))
+
+    print("{} of {} figures regressed".format(regressions, len(comparisons)))
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
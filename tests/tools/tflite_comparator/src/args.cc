@@ -38,7 +38,9 @@ void Args::Initialize(void)
   general.add_options()
     ("help,h", "Display available options")
     ("tflite", po::value<std::string>()->default_value("")->required(), "Input tflite model file for serialization")
-    ("data,d", po::value<std::vector<std::string>>()->multitoken()->default_value(std::vector<std::string>{}, ""), "Input data file for model");
+    ("data,d", po::value<std::vector<std::string>>()->multitoken()->default_value(std::vector<std::string>{}, ""), "Input data file for model")
+    ("sequential", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _sequential = v; }), "Run onert and TFLite one after the other, instead of concurrently on separate cores")
+    ("timing", po::value<std::string>()->default_value("")->notifier([&](const auto &v) { _timing_filename = v; }), "File to append 'model,onert_ms,tflite_ms,matched' of the run");
   // clang-format on
 
   _options.add(general);
@@ -33,6 +33,8 @@ public:
 
   const std::string &getTFLiteFilename(void) const { return _tflite_filename; }
   const std::vector<std::string> &getDataFilenames(void) const { return _data_filenames; }
+  bool getSequential(void) const { return _sequential; }
+  const std::string &getTimingFilename(void) const { return _timing_filename; }
 
 private:
   void Initialize();
@@ -44,6 +46,8 @@ private:
 
   std::string _tflite_filename;
   std::vector<std::string> _data_filenames;
+  bool _sequential = false;
+  std::string _timing_filename;
 };
 
 } // namespace TFLiteRun
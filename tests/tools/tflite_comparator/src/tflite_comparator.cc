@@ -27,9 +27,13 @@
 #include <tflite/InterpreterSession.h>
 #include <tflite/interp/FlatBufferBuilder.h>
 
+#include <sched.h>
+
+#include <chrono>
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <thread>
 
 const int RUN_FAILED = 1;
 
@@ -159,12 +163,43 @@ bool compareBuffersExactBool(const uint8_t *ref_buf, const std::vector<uint8_t>
   return match;
 }
 
+double elapsedMs(const std::chrono::steady_clock::time_point &begin)
+{
+  const auto elapsed = std::chrono::steady_clock::now() - begin;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// Split the cores available in two halves, for runtimes not to compete for cores
+bool splitCpus(cpu_set_t &first, cpu_set_t &second)
+{
+  cpu_set_t available;
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &available) != 0)
+    return false;
+  const int count = CPU_COUNT(&available);
+  if (count < 2)
+    return false;
+
+  CPU_ZERO(&first);
+  CPU_ZERO(&second);
+  int index = 0;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+  {
+    if (!CPU_ISSET(cpu, &available))
+      continue;
+    CPU_SET(cpu, index < count / 2 ? &first : &second);
+    ++index;
+  }
+  return true;
+}
+
 int main(const int argc, char **argv)
 {
   TFLiteRun::Args args(argc, argv);
 
   auto tflite_file = args.getTFLiteFilename();
   auto data_files = args.getDataFilenames();
+  const bool sequential = args.getSequential();
+  const auto timing_file = args.getTimingFilename();
 
   if (tflite_file.empty())
   {
@@ -280,14 +315,7 @@ int main(const int argc, char **argv)
       "[ ERROR ] Failure to set output tensor buffer");
   }
 
-  // Execute
-  NNFW_ASSERT_FAIL(nnfw_run(onert_session), "[Execution] Can't execute");
-
-  std::cout << "[Execution] Done!" << std::endl;
-
-  // Compare with tflite
-  std::cout << "[Comparison] Stage start!" << std::endl;
-  // Read tflite model
+  // Read tflite model, which is prepared with the same inputs before runs
   StderrReporter error_reporter;
   auto model = FlatBufferModel::BuildFromFile(tflite_file.c_str(), &error_reporter);
   auto builder = FlatBufferBuilder(*model);
@@ -306,13 +334,60 @@ int main(const int argc, char **argv)
 
   auto sess = std::make_shared<nnfw::tflite::InterpreterSession>(interpreter.get());
   sess->prepare();
-  // Set input and run
   for (uint32_t i = 0; i < num_inputs; i++)
   {
     auto input_tensor = interpreter->tensor(interpreter->inputs().at(i));
     memcpy(input_tensor->data.uint8, inputs[i].data(), inputs[i].size());
   }
-  if (!sess->run())
+
+  // Execute both, which only read the shared inputs
+  double onert_ms = 0.0;
+  double tflite_ms = 0.0;
+  NNFW_STATUS onert_status = NNFW_STATUS_NO_ERROR;
+  bool tflite_succeeded = true;
+
+  auto run_onert = [&]() {
+    const auto begin = std::chrono::steady_clock::now();
+    onert_status = nnfw_run(onert_session);
+    onert_ms = elapsedMs(begin);
+  };
+  auto run_tflite = [&]() {
+    const auto begin = std::chrono::steady_clock::now();
+    tflite_succeeded = sess->run();
+    tflite_ms = elapsedMs(begin);
+  };
+
+  if (sequential)
+  {
+    run_onert();
+    run_tflite();
+  }
+  else
+  {
+    // Pin runners to halves of the cores, which threads runtimes create from now on inherit
+    cpu_set_t onert_cpus, tflite_cpus;
+    const bool split = splitCpus(onert_cpus, tflite_cpus);
+
+    std::thread tflite_thread{[&]() {
+      if (split)
+        sched_setaffinity(0, sizeof(cpu_set_t), &tflite_cpus);
+      run_tflite();
+    }};
+    std::thread onert_thread{[&]() {
+      if (split)
+        sched_setaffinity(0, sizeof(cpu_set_t), &onert_cpus);
+      run_onert();
+    }};
+    onert_thread.join();
+    tflite_thread.join();
+  }
+
+  NNFW_ASSERT_FAIL(onert_status, "[Execution] Can't execute");
+  std::cout << "[Execution] Done!" << std::endl;
+
+  // Compare with tflite
+  std::cout << "[Comparison] Stage start!" << std::endl;
+  if (!tflite_succeeded)
   {
     std::cout << "[Comparison] TFLite run failed!" << std::endl;
     assert(0 && "Run failed!");
@@ -389,6 +464,15 @@ int main(const int argc, char **argv)
   }
   std::cout << "[Comparison] Done!" << std::endl;
 
+  std::cout << "[Timing] " << (sequential ? "Sequential" : "Concurrent")
+            << " run of onert: " << onert_ms << " ms, TFLite: " << tflite_ms << " ms" << std::endl;
+  if (!timing_file.empty())
+  {
+    std::ofstream timing{timing_file, std::ios::app};
+    timing << tflite_file << "," << onert_ms << "," << tflite_ms << ","
+           << (find_unmatched_output ? 0 : 1) << std::endl;
+  }
+
   nnfw_close_session(onert_session);
 
   return ret;
@@ -0,0 +1,107 @@
+#!/bin/bash
+
+set -eu
+
+progname=$(basename "${BASH_SOURCE[0]}")
+script_dir=$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)
+outdir="."
+name=""
+platform="linux"
+backends="cpu"
+op_backend_map=""
+planner="circle_execution_plan"
+runner=""
+
+usage() {
+  echo "Usage: $progname [options] modelfile"
+  echo "Convert circle modelfile to nnpackage with the plan made ahead of time for onert."
+  echo ""
+  echo "Options:"
+  echo "    -h   show this help"
+  echo "    -o   set nnpackage output directory (default=$outdir)"
+  echo "    -p   set nnpackage output name (default=[modelfile name])"
+  echo "    -t   set platform to plan scratchpads of kernels for (default=$platform)"
+  echo "    -b   set backends of onert (default=$backends)"
+  echo "    -m   set backend of each operation, like '0=cpu;3=ruy' (default: by onert)"
+  echo "    -e   set path of circle_execution_plan (default=$planner)"
+  echo "    -r   set path of nnpackage_run to pack weights by running the nnpackage once"
+  echo ""
+  echo "Examples:"
+  echo "    $progname add.circle                      => create nnpackage 'add' in $outdir/"
+  echo "    $progname -o out -b 'cpu;ruy' add.circle  => create nnpackage 'add' in out/"
+  echo "    $progname -r nnpackage_run add.circle     => create nnpackage 'add' with packed weights"
+  exit 1
+}
+
+if [ $# -eq 0 ]; then
+  >&2 echo "For help, type $progname -h"
+  exit 1
+fi
+
+while getopts "ho:p:t:b:m:e:r:" OPTION; do
+  case "${OPTION}" in
+    h) usage;;
+    o) outdir=$OPTARG;;
+    p) name=$OPTARG;;
+    t) platform=$OPTARG;;
+    b) backends=$OPTARG;;
+    m) op_backend_map=$OPTARG;;
+    e) planner=$OPTARG;;
+    r) runner=$OPTARG;;
+    ?) exit 1;;
+  esac
+done
+
+shift $((OPTIND-1))
+
+if [ $# -ne 1 ]; then
+  >&2 echo "error: wrong argument (one modelfile is needed)."
+  >&2 echo "For help, type $progname -h"
+  exit 1
+fi
+
+modelpath=$1
+modelfile=$(basename "$modelpath")
+
+if [[ "$modelfile" != *.circle ]]; then
+  >&2 echo "error: modelfile should be circle."
+  exit 1
+fi
+
+if [ ! -e "$modelpath" ]; then
+  >&2 echo "error: $modelpath does not exist."
+  exit 1
+fi
+
+if [ -z "$name" ]; then
+  name=${modelfile%.*}
+fi
+
+tmpdir=$(mktemp -d)
+trap 'rm -rf "$tmpdir"' EXIT
+
+# Execution order and offsets of tensors and scratchpads in the arena.
+# onert keeps constants out of the arena.
+"$planner" --platform "$platform" --search_execution_order true --ignore_consts true \
+  "$modelpath" "$tmpdir/$modelfile"
+
+# Configs applied by onert on loading the nnpackage.
+# The directory of packed weights is relative to the nnpackage.
+cfgfile="$tmpdir/$name.cfg"
+{
+  echo "BACKENDS=$backends"
+  if [ -n "$op_backend_map" ]; then
+    echo "OP_BACKEND_MAP=$op_backend_map"
+  fi
+  echo "CPU_PACKED_WEIGHT_DIR=packed"
+} > "$cfgfile"
+
+"$script_dir/../model2nnpkg/model2nnpkg.sh" -o "$outdir" -p "$name" -c "$cfgfile" \
+  -m "$tmpdir/$modelfile"
+mkdir -p "$outdir/$name/packed"
+
+# Kernels store their packed weights in the directory on the first prepare
+if [ -n "$runner" ]; then
+  echo "$progname: Packing weights of $name"
+  "$runner" --num_runs 1 "$outdir/$name" > /dev/null
+fi